@@ -9,6 +9,7 @@
 #pragma once
 
 // azure/core
+#include "azure/core/async_response.hpp"
 #include "azure/core/azure_assert.hpp"
 #include "azure/core/base64.hpp"
 #include "azure/core/case_insensitive_containers.hpp"
@@ -21,6 +22,7 @@
 #include "azure/core/modified_conditions.hpp"
 #include "azure/core/nullable.hpp"
 #include "azure/core/operation.hpp"
+#include "azure/core/operation_poller.hpp"
 #include "azure/core/operation_status.hpp"
 #include "azure/core/paged_response.hpp"
 #include "azure/core/platform.hpp"
@@ -42,10 +44,15 @@
 #include "azure/core/http/http.hpp"
 #include "azure/core/http/http_status_code.hpp"
 #include "azure/core/http/raw_response.hpp"
+#include "azure/core/http/request_priority.hpp"
+#include "azure/core/http/response_buffer_pool.hpp"
 #include "azure/core/http/transport.hpp"
 
 // azure/core/http/policies
 #include "azure/core/http/policies/policy.hpp"
+#include "azure/core/http/policies/concurrency_limiter.hpp"
+#include "azure/core/http/policies/retry_budget.hpp"
 
 // azure/core/io
 #include "azure/core/io/body_stream.hpp"
+#include "azure/core/io/shared_buffer.hpp"
@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Completion callbacks of the asynchronous operations of the clients, and an adapter to
+ * `co_await` them from C++20 coroutines.
+ */
+
+#pragma once
+
+#include "azure/core/nullable.hpp"
+#include "azure/core/response.hpp"
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <utility> // for move
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#define AZ_CORE_HAS_COROUTINES 1
+#endif
+#endif
+
+namespace Azure { namespace Core {
+
+  /**
+   * @brief The function called when an asynchronous operation of a client completes.
+   *
+   * @remark It gets either the response, or the error that prevented getting one. The callback
+   * must not throw, and may be called from the calling thread or from a thread of the transport.
+   *
+   * @tparam T The type of the value of the response.
+   */
+  template <class T>
+  using ResponseCallback = std::function<void(Azure::Nullable<Response<T>>, std::exception_ptr)>;
+
+#if defined(AZ_CORE_HAS_COROUTINES)
+  /**
+   * @brief Awaits an asynchronous operation of a client from a C++20 coroutine.
+   *
+   * @remark The coroutine is resumed on the thread calling back, and `co_await` returns the
+   * response or throws the error of the operation. Nothing is sent until the awaitable is
+   * awaited, and the arguments of the operation must be kept alive until it resumes.
+   *
+   * @code
+   * auto response = co_await Azure::Core::ResponseAwaitable<Models::StageBlockResult>(
+   *     [&](Azure::Core::ResponseCallback<Models::StageBlockResult> callback) {
+   *       client.StageBlockAsync(blockId, content, options, context, std::move(callback));
+   *     });
+   * @endcode
+   *
+   * @tparam T The type of the value of the response.
+   */
+  template <class T> class ResponseAwaitable final {
+  public:
+    /**
+     * @brief Constructs a `%ResponseAwaitable` from the function starting the operation.
+     *
+     * @param start Starts the operation, passing it the callback it gets.
+     */
+    explicit ResponseAwaitable(std::function<void(ResponseCallback<T>)> start)
+        : m_start(std::move(start))
+    {
+    }
+
+    ResponseAwaitable(ResponseAwaitable const&) = delete;
+    ResponseAwaitable& operator=(ResponseAwaitable const&) = delete;
+
+    /// @brief The operation is always started on suspension.
+    bool await_ready() const noexcept { return false; }
+
+    /**
+     * @brief Starts the operation.
+     *
+     * @return `false` when the operation completed on the calling thread, to go on without
+     * suspending.
+     */
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+      m_handle = handle;
+      m_start([this](Azure::Nullable<Response<T>> response, std::exception_ptr error) {
+        m_response = std::move(response);
+        m_error = error;
+        // Whichever of the callback and the suspension comes last resumes the coroutine.
+        if (m_completed.exchange(true))
+        {
+          m_handle.resume();
+        }
+      });
+      return !m_completed.exchange(true);
+    }
+
+    /**
+     * @brief Gets the response of the operation, or throws its error.
+     */
+    Response<T> await_resume()
+    {
+      if (m_error)
+      {
+        std::rethrow_exception(m_error);
+      }
+      return std::move(m_response.Value());
+    }
+
+  private:
+    std::function<void(ResponseCallback<T>)> m_start;
+    std::coroutine_handle<> m_handle;
+    std::atomic<bool> m_completed{false};
+    Azure::Nullable<Response<T>> m_response;
+    std::exception_ptr m_error;
+  };
+#endif
+
+}} // namespace Azure::Core
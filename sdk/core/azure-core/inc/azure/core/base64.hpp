@@ -10,6 +10,8 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -45,6 +47,63 @@ namespace Azure { namespace Core {
      * @return The decoded binary data.
      */
     static std::vector<uint8_t> Base64Decode(const std::string& text);
+
+    /**
+     * @brief Gets the length of the Base64 encoded text of binary data, with its padding.
+     *
+     * @param length The length of the binary data.
+     * @return The number of characters of its Base64 encoded text.
+     */
+    static constexpr size_t Base64EncodedLength(size_t length) { return (length + 2) / 3 * 4; }
+
+    /**
+     * @brief Gets the maximum length of the binary data represented by Base64 encoded text, with
+     * or without padding.
+     *
+     * @param length The length of the Base64 encoded text.
+     * @return The maximum number of bytes of the decoded binary data.
+     */
+    static constexpr size_t Base64DecodedMaxLength(size_t length) { return length / 4 * 3 + 2; }
+
+    /**
+     * @brief Encodes binary data into UTF-8 encoded text represented as Base64, in a buffer
+     * provided by the caller.
+     *
+     * @param data The binary data to encode.
+     * @param length The length of the binary data.
+     * @param output The buffer to write the encoded text to, which isn't null terminated.
+     * @param outputLength The length of \p output, at least #Base64EncodedLength of \p length.
+     * @return The number of characters written to \p output.
+     *
+     * @throw std::invalid_argument if \p output is too small.
+     */
+    static size_t Base64Encode(
+        const uint8_t* data,
+        size_t length,
+        char* output,
+        size_t outputLength);
+
+    /**
+     * @brief Decodes the UTF-8 encoded text represented as Base64 into binary data, in a buffer
+     * provided by the caller.
+     *
+     * @param text The Base64 encoded text to decode, with or without padding.
+     * @param length The length of \p text.
+     * @param output The buffer to write the decoded data to.
+     * @param outputLength The length of \p output, which #Base64DecodedMaxLength of \p length is
+     * always enough for.
+     * @return The number of bytes written to \p output.
+     *
+     * @remark \p output can be \p text itself, with \p outputLength being \p length, to decode
+     * the text in place.
+     *
+     * @throw std::invalid_argument if \p text isn't valid Base64 or \p output is too small.
+     */
+    static size_t Base64Decode(
+        const char* text,
+        size_t length,
+        uint8_t* output,
+        size_t outputLength);
   };
 
   namespace _internal {
@@ -56,41 +115,27 @@ namespace Azure { namespace Core {
     class Base64Url final {
 
     public:
-      static std::string Base64UrlEncode(const std::vector<uint8_t>& data)
-      {
-        auto base64 = Azure::Core::Convert::Base64Encode(data);
-        // update to base64url
-        auto trail = base64.find('=');
-        if (trail != std::string::npos)
-        {
-          base64 = base64.substr(0, trail);
-        }
-        std::replace(base64.begin(), base64.end(), '+', '-');
-        std::replace(base64.begin(), base64.end(), '/', '_');
-        return base64;
-      }
+      static std::string Base64UrlEncode(const std::vector<uint8_t>& data);
 
-      static std::vector<uint8_t> Base64UrlDecode(const std::string& text)
+      static std::vector<uint8_t> Base64UrlDecode(const std::string& text);
+
+      // The Base64URL encoded text has no padding.
+      static constexpr size_t Base64UrlEncodedLength(size_t length)
       {
-        std::string base64url(text);
-        // base64url to base64
-        std::replace(base64url.begin(), base64url.end(), '-', '+');
-        std::replace(base64url.begin(), base64url.end(), '_', '/');
-        switch (base64url.size() % 4)
-        {
-          case 0:
-            break;
-          case 2:
-            base64url.append("==");
-            break;
-          case 3:
-            base64url.append("=");
-            break;
-          default:
-            throw std::invalid_argument("Unexpected Base64URL encoding in the HTTP response.");
-        }
-        return Azure::Core::Convert::Base64Decode(base64url);
+        return length / 3 * 4 + (length % 3 == 0 ? 0 : length % 3 + 1);
       }
+
+      static size_t Base64UrlEncode(
+          const uint8_t* data,
+          size_t length,
+          char* output,
+          size_t outputLength);
+
+      static size_t Base64UrlDecode(
+          const char* text,
+          size_t length,
+          uint8_t* output,
+          size_t outputLength);
     };
   } // namespace _internal
 
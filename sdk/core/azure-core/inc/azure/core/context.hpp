@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -36,10 +37,17 @@ namespace Azure { namespace Core {
     }
   };
 
+  namespace _detail {
+    class CancellationWaker;
+    struct CancellationWaiter;
+  } // namespace _detail
+
   /**
    * @brief A context is a node within a tree that represents deadlines and key/value pairs.
    */
   class Context final {
+    friend class _detail::CancellationWaker;
+
   public:
     /**
      * @brief A key used to store and retrieve data in an #Azure::Core::Context object.
@@ -76,10 +84,22 @@ namespace Azure { namespace Core {
     struct ContextSharedState final
     {
       std::shared_ptr<ContextSharedState> Parent;
-      std::atomic<DateTime::rep> Deadline;
+      // Set by Cancel(), a cancelled context has the minimum deadline.
+      std::atomic<bool> Cancelled;
+      // The earliest deadline of this context and of its parents, as it can only get earlier by
+      // cancelling a context.
+      DateTime::rep EarliestDeadline;
       Context::Key Key;
       std::shared_ptr<void> Value;
       const std::type_info& ValueType;
+      // Whether a context of the branch was found cancelled, which can't be undone, and the value
+      // of CancellationCount when it was last checked. The branch is walked again only after
+      // another context is cancelled.
+      mutable std::atomic<bool> BranchCancelled;
+      mutable std::atomic<uint64_t> CheckedCancellationCount;
+      // The threads waiting for this context or one of its children to be cancelled, which are
+      // woken up by Cancel().
+      mutable _detail::CancellationWaiter* Waiters = nullptr;
 
       static constexpr DateTime::rep ToDateTimeRepresentation(DateTime const& dateTime)
       {
@@ -91,17 +111,28 @@ namespace Azure { namespace Core {
         return DateTime(DateTime::time_point(DateTime::duration(dtRepresentation)));
       }
 
+      static DateTime::rep GetEarliestDeadline(
+          const std::shared_ptr<ContextSharedState>& parent,
+          DateTime const& deadline)
+      {
+        auto representation = ToDateTimeRepresentation(deadline);
+        return parent && parent->EarliestDeadline < representation ? parent->EarliestDeadline
+                                                                   : representation;
+      }
+
       explicit ContextSharedState()
-          : Deadline(ToDateTimeRepresentation((DateTime::max)())), Value(nullptr),
-            ValueType(typeid(std::nullptr_t))
+          : Cancelled(false), EarliestDeadline(ToDateTimeRepresentation((DateTime::max)())),
+            Value(nullptr), ValueType(typeid(std::nullptr_t)), BranchCancelled(false),
+            CheckedCancellationCount(0)
       {
       }
 
       explicit ContextSharedState(
           const std::shared_ptr<ContextSharedState>& parent,
           DateTime const& deadline)
-          : Parent(parent), Deadline(ToDateTimeRepresentation(deadline)), Value(nullptr),
-            ValueType(typeid(std::nullptr_t))
+          : Parent(parent), Cancelled(false),
+            EarliestDeadline(GetEarliestDeadline(parent, deadline)), Value(nullptr),
+            ValueType(typeid(std::nullptr_t)), BranchCancelled(false), CheckedCancellationCount(0)
       {
       }
 
@@ -111,12 +142,31 @@ namespace Azure { namespace Core {
           DateTime const& deadline,
           Context::Key const& key,
           T value) // NOTE, should this be T&&
-          : Parent(parent), Deadline(ToDateTimeRepresentation(deadline)), Key(key),
-            Value(std::make_shared<T>(std::move(value))), ValueType(typeid(T))
+          : Parent(parent), Cancelled(false),
+            EarliestDeadline(GetEarliestDeadline(parent, deadline)), Key(key),
+            Value(std::make_shared<T>(std::move(value))), ValueType(typeid(T)),
+            BranchCancelled(false), CheckedCancellationCount(0)
       {
       }
     };
 
+    // The number of contexts cancelled in the process.
+    static AZ_CORE_DLLEXPORT std::atomic<uint64_t> CancellationCount;
+
+    // Walks the branch, only when a context was cancelled since the last time.
+    bool IsBranchCancelled() const noexcept
+    {
+      if (m_contextSharedState->BranchCancelled.load(std::memory_order_acquire))
+      {
+        return true;
+      }
+      return m_contextSharedState->CheckedCancellationCount.load(std::memory_order_acquire)
+          != CancellationCount.load(std::memory_order_acquire)
+          && CheckBranchCancelled();
+    }
+
+    bool CheckBranchCancelled() const noexcept;
+
     std::shared_ptr<ContextSharedState> m_contextSharedState;
 
     explicit Context(std::shared_ptr<ContextSharedState> impl)
@@ -193,7 +243,7 @@ namespace Azure { namespace Core {
      */
     template <class T> bool TryGetValue(Key const& key, T& outputValue) const
     {
-      for (auto ptr = m_contextSharedState; ptr; ptr = ptr->Parent)
+      for (auto ptr = m_contextSharedState.get(); ptr; ptr = ptr->Parent.get())
       {
         if (ptr->Key == key)
         {
@@ -211,17 +261,24 @@ namespace Azure { namespace Core {
      * @brief Cancels the context.
      *
      */
-    void Cancel()
-    {
-      m_contextSharedState->Deadline
-          = ContextSharedState::ToDateTimeRepresentation((DateTime::min)());
-    }
+    void Cancel();
 
     /**
      * @brief Checks if the context is cancelled.
      * @return `true` if this context is cancelled; otherwise, `false`.
      */
-    bool IsCancelled() const noexcept { return GetDeadline() < std::chrono::system_clock::now(); }
+    bool IsCancelled() const noexcept
+    {
+      if (IsBranchCancelled())
+      {
+        return true;
+      }
+      // Contexts without a deadline don't read the clock.
+      auto const deadline = m_contextSharedState->EarliestDeadline;
+      return deadline != ContextSharedState::ToDateTimeRepresentation((DateTime::max)())
+          && ContextSharedState::FromDateTimeRepresentation(deadline)
+          < std::chrono::system_clock::now();
+    }
 
     /**
      * @brief Checks if the context is cancelled.
@@ -45,6 +45,15 @@ namespace Azure { namespace Core { namespace Cryptography {
      */
     virtual std::vector<uint8_t> OnFinal(const uint8_t* data, size_t length) = 0;
 
+    /**
+     * @brief Brings the hash back to the state of a new instance, reusing its context.
+     * @remark The default implementation throws, for the algorithms which can't be reset.
+     */
+    virtual void OnReset()
+    {
+      throw std::runtime_error("The hash algorithm doesn't support Reset().");
+    }
+
   protected:
     /**
      * @brief Constructs a default instance of `%Hash`.
@@ -95,6 +104,19 @@ namespace Azure { namespace Core { namespace Cryptography {
      */
     std::vector<uint8_t> Final() { return Final(nullptr, 0); }
 
+    /**
+     * @brief Discards the data appended so far, so the instance can compute the hash of other
+     * data.
+     * @remark It can be called after #Azure::Core::Cryptography::Hash::Final(). The context of the
+     * algorithm is reused, which is cheaper than constructing a new instance, when many small
+     * pieces of data are hashed one after the other.
+     */
+    void Reset()
+    {
+      OnReset();
+      m_isDone = false;
+    }
+
     /**
      * @brief Destructs `%Hash`.
      *
@@ -159,6 +181,11 @@ namespace Azure { namespace Core { namespace Cryptography {
      * @param length The size of the data provided.
      */
     void OnAppend(const uint8_t* data, size_t length) override;
+
+    /**
+     * @brief Brings the MD5 hash back to the state of a new instance.
+     */
+    void OnReset() override;
   };
 
 }}} // namespace Azure::Core::Cryptography
@@ -54,7 +54,8 @@ namespace _detail {
 class DateTime final : public _detail::Clock::time_point {
 
 private:
-  AZ_CORE_DLLEXPORT static DateTime const SystemClockEpoch;
+  // The DateTime of the epoch of `std::chrono::system_clock`, computed the first time it's used.
+  static DateTime const& SystemClockEpoch();
 
   DateTime(
       int16_t year,
@@ -126,7 +127,7 @@ public:
    */
   DateTime(std::chrono::system_clock::time_point const& systemTime)
       : DateTime(
-          SystemClockEpoch + std::chrono::duration_cast<duration>(systemTime.time_since_epoch()))
+          SystemClockEpoch() + std::chrono::duration_cast<duration>(systemTime.time_since_epoch()))
   {
   }
 
@@ -0,0 +1,193 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Interfaces receiving the spans and the metrics of the HTTP requests sent by the Azure SDK.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace Azure { namespace Core { namespace Diagnostics {
+
+  /**
+   * @brief Durations of the phases of sending an HTTP request, measured by the transport adapter.
+   *
+   * @remark The phases which didn't happen, such as the name lookup when a connection is reused,
+   * and the ones a transport adapter doesn't measure, are zero.
+   */
+  struct HttpRequestTimings final
+  {
+    /**
+     * @brief Time to get a connection from the connection pool of the transport adapter,
+     * including waiting for the pool to be available.
+     */
+    std::chrono::nanoseconds ConnectionPoolWait{};
+
+    /**
+     * @brief Time to resolve the host name of a new connection.
+     */
+    std::chrono::nanoseconds NameLookup{};
+
+    /**
+     * @brief Time to connect a new connection, after the name lookup.
+     */
+    std::chrono::nanoseconds Connect{};
+
+    /**
+     * @brief Time of the TLS handshake of a new connection, after it is connected.
+     */
+    std::chrono::nanoseconds TlsHandshake{};
+
+    /**
+     * @brief Time to send the request headers and body.
+     */
+    std::chrono::nanoseconds RequestSend{};
+
+    /**
+     * @brief Time from the end of sending the request to receiving the response headers.
+     */
+    std::chrono::nanoseconds TimeToFirstByte{};
+
+    /**
+     * @brief Time to download the body of a buffered response.
+     */
+    std::chrono::nanoseconds ResponseTransfer{};
+
+    /**
+     * @brief Whether the request was sent on a connection from the connection pool.
+     */
+    bool ConnectionReused = false;
+  };
+
+  /**
+   * @brief A span of an operation traced by a #Azure::Core::Diagnostics::Tracer.
+   */
+  class Span {
+  public:
+    /**
+     * @brief Destructs `%Span`.
+     *
+     */
+    virtual ~Span() = default;
+
+    /**
+     * @brief Sets an attribute of the span.
+     *
+     * @param name The name of the attribute.
+     * @param value The value of the attribute.
+     */
+    virtual void SetAttribute(std::string const& name, std::string const& value) = 0;
+
+    /**
+     * @brief Sets an attribute of the span.
+     *
+     * @param name The name of the attribute.
+     * @param value The value of the attribute.
+     */
+    virtual void SetAttribute(std::string const& name, int64_t value) = 0;
+
+    /**
+     * @brief Marks the operation of the span as failed.
+     *
+     * @param description The description of the error.
+     */
+    virtual void SetError(std::string const& description) = 0;
+
+    /**
+     * @brief Ends the span. No other method is called after it.
+     *
+     */
+    virtual void End() = 0;
+
+  protected:
+    /**
+     * @brief Constructs a default instance of `%Span`.
+     *
+     */
+    Span() = default;
+  };
+
+  /**
+   * @brief Starts the spans of the HTTP requests sent by SDK clients.
+   *
+   * @remark It's called concurrently by the threads sending requests.
+   */
+  class Tracer {
+  public:
+    /**
+     * @brief Destructs `%Tracer`.
+     *
+     */
+    virtual ~Tracer() = default;
+
+    /**
+     * @brief Starts a span.
+     *
+     * @param name The name of the operation.
+     *
+     * @return The span, which is ended when the operation completes.
+     */
+    virtual std::unique_ptr<Span> StartSpan(std::string const& name) = 0;
+
+  protected:
+    /**
+     * @brief Constructs a default instance of `%Tracer`.
+     *
+     */
+    Tracer() = default;
+  };
+
+  /**
+   * @brief Records the metrics of the HTTP requests sent by SDK clients.
+   *
+   * @remark It's called concurrently by the threads sending requests.
+   */
+  class Meter {
+  public:
+    /**
+     * @brief Destructs `%Meter`.
+     *
+     */
+    virtual ~Meter() = default;
+
+    /**
+     * @brief Records a duration in a histogram.
+     *
+     * @param name The name of the histogram.
+     * @param duration The duration to record.
+     * @param attributes The attributes of the measurement.
+     */
+    virtual void RecordDuration(
+        std::string const& name,
+        std::chrono::nanoseconds duration,
+        std::map<std::string, std::string> const& attributes)
+        = 0;
+
+    /**
+     * @brief Adds to a counter.
+     *
+     * @param name The name of the counter.
+     * @param value The value to add.
+     * @param attributes The attributes of the measurement.
+     */
+    virtual void AddToCounter(
+        std::string const& name,
+        int64_t value,
+        std::map<std::string, std::string> const& attributes)
+        = 0;
+
+  protected:
+    /**
+     * @brief Constructs a default instance of `%Meter`.
+     *
+     */
+    Meter() = default;
+  };
+}}} // namespace Azure::Core::Diagnostics
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <string>
 
@@ -53,6 +54,28 @@ namespace Azure { namespace Core { namespace Diagnostics {
      */
     static void SetLevel(Level level);
 
+    /**
+     * @brief Creates a listener which queues the log messages and reports them to another
+     * listener from a background thread, so that the SDK doesn't wait for the listener to handle
+     * each message.
+     *
+     * @remark Up to \p capacity messages are queued, without taking a lock. The messages logged
+     * while the queue is full are dropped, and their number is reported with a warning. The
+     * background thread reports the queued messages and stops when the last copy of the returned
+     * listener is destroyed, which \p listener must not do itself, by calling #SetListener.
+     *
+     * @param listener A callback function that will be invoked on the background thread for each
+     * log message.
+     * @param capacity The maximum number of log messages queued.
+     *
+     * @return A listener to pass to #SetListener.
+     *
+     * @throw std::invalid_argument if \p listener is `nullptr` or \p capacity is 0.
+     */
+    static std::function<void(Level level, std::string const& message)> CreateAsyncListener(
+        std::function<void(Level level, std::string const& message)> listener,
+        size_t capacity = 1024);
+
   private:
     /**
      * @brief An instance of `%Logger` class cannot be created.
@@ -111,7 +111,7 @@ namespace Azure { namespace Core {
      * @param other The `%RequestFailedException` to be copied.
      */
     RequestFailedException(const RequestFailedException& other)
-        : std::runtime_error(other.Message), StatusCode(other.StatusCode),
+        : std::runtime_error(other), StatusCode(other.StatusCode),
           ReasonPhrase(other.ReasonPhrase), ClientRequestId(other.ClientRequestId),
           RequestId(other.RequestId), ErrorCode(other.ErrorCode), Message(other.Message),
           RawResponse(
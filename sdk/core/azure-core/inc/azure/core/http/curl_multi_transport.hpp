@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief #Azure::Core::Http::HttpTransport implementation via the CURL multi interface, which
+ * multiplexes concurrent requests as HTTP/2 streams over a few connections.
+ */
+
+#pragma once
+
+#include "azure/core/context.hpp"
+#include "azure/core/http/curl_transport.hpp"
+#include "azure/core/http/http.hpp"
+#include "azure/core/http/transport.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace Azure { namespace Core { namespace Http {
+
+  namespace _detail {
+    class CurlMultiHandle;
+  } // namespace _detail
+
+  /**
+   * @brief Set the options for the libcurl multi transport, like the HTTP version and how many
+   * connections and streams it can open.
+   */
+  struct CurlMultiTransportOptions final
+  {
+    /**
+     * @brief The proxy, CA and SSL settings for the connections.
+     *
+     * @remark #Azure::Core::Http::CurlTransportOptions::HttpKeepAlive and
+     * #Azure::Core::Http::CurlTransportOptions::ConnectionPoolOptions don't apply. The connections
+     * are kept open by the libcurl multi handle to be re-used by the next requests.
+     *
+     */
+    CurlTransportOptions ConnectionOptions;
+
+    /**
+     * @brief Negotiate HTTP/2 with the server so concurrent requests to the same host share a
+     * connection.
+     *
+     * @remark HTTP/2 is negotiated for `https` only. libcurl falls back to HTTP/1.1 when the server
+     * doesn't support HTTP/2, and it is always used for `http`. It is `true` by default.
+     *
+     */
+    bool EnableHttp2 = true;
+
+    /**
+     * @brief The maximum number of connections to open to the same host.
+     *
+     * @remark Requests wait for a connection to be available when all of them are busy. Use `0`
+     * for no limit. The default value is 4.
+     *
+     */
+    size_t MaxConnectionsPerHost = 4;
+
+    /**
+     * @brief The maximum number of HTTP/2 streams to run concurrently on one connection.
+     *
+     * @remark The server can set a lower limit. It has no effect on HTTP/1.1 connections, which run
+     * one request at a time. The default value is 100.
+     *
+     */
+    size_t MaxConcurrentStreams = 100;
+  };
+
+  /**
+   * @brief Concrete implementation of an HTTP Transport that uses the libcurl multi interface.
+   *
+   * @remark All the requests sent with a `%CurlMultiTransport` instance, and its copies, are run
+   * by one background thread. Over HTTP/2, requests to the same host are multiplexed as streams on
+   * the same TLS connection instead of each one taking its own socket.
+   */
+  class CurlMultiTransport final : public HttpTransport {
+  private:
+    std::shared_ptr<_detail::CurlMultiHandle> m_multiHandle;
+
+  public:
+    /**
+     * @brief Construct a new CurlMultiTransport object.
+     *
+     * @param options Optional parameter to override the default options.
+     */
+    CurlMultiTransport(CurlMultiTransportOptions const& options = CurlMultiTransportOptions());
+
+    /**
+     * @brief Implements interface to send an HTTP Request and produce an HTTP RawResponse
+     *
+     * @remark The response is returned as soon as the status line and headers are received. The
+     * body is streamed from the background thread while it is read.
+     *
+     * @param request an HTTP Request to be send.
+     * @param context A context to control the request lifetime.
+     *
+     * @return unique ptr to an HTTP RawResponse.
+     */
+    std::unique_ptr<RawResponse> Send(Request& request, Context const& context) override;
+
+    /**
+     * @brief Sends an HTTP Request without blocking the calling thread.
+     *
+     * @remark The \p callback is called from the background thread when the headers are received,
+     * or after the whole body is downloaded if the request buffers its response. It must not block
+     * and must not read a response body that isn't buffered; the body stream can be moved to
+     * another thread to be read.
+     *
+     * @param request an HTTP Request to be send. It must be kept alive until \p callback is called.
+     * @param context A context to control the request lifetime.
+     * @param callback Called with the response, or with the error if the request fails.
+     */
+    void SendAsync(
+        Request& request,
+        Context const& context,
+        SendCompletionCallback callback) override;
+  };
+
+}}} // namespace Azure::Core::Http
@@ -11,6 +11,16 @@
 #include "azure/core/context.hpp"
 #include "azure/core/http/http.hpp"
 #include "azure/core/http/transport.hpp"
+#include "azure/core/nullable.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace Azure { namespace Core { namespace Http {
 
@@ -34,6 +44,282 @@ namespace Azure { namespace Core { namespace Http {
     bool EnableCertificateRevocationListCheck = false;
   };
 
+  /**
+   * @brief The options to control how connections are kept in the libcurl connection pool for
+   * re-use.
+   *
+   * @remark The connection pool is shared by all the #Azure::Core::Http::CurlTransport instances
+   * in the application. These options are applied to the connections created with them.
+   *
+   */
+  struct CurlTransportConnectionPoolOptions final
+  {
+    /**
+     * @brief The maximum number of idle connections to keep in the pool for the same host and
+     * connection settings.
+     *
+     * @remark When the limit is reached, the oldest idle connection for the host is closed to make
+     * room for the connection being returned to the pool. The default value is 1024.
+     *
+     */
+    size_t MaxIdleConnectionsPerHost = 1024;
+
+    /**
+     * @brief The maximum number of idle connections to keep in the pool, for all the hosts.
+     *
+     * @remark When the limit is reached, connections returned to the pool are closed instead. The
+     * default value is no limit.
+     *
+     */
+    size_t MaxIdleConnections = (std::numeric_limits<size_t>::max)();
+
+    /**
+     * @brief The time a connection can remain idle in the pool before it is closed.
+     *
+     * @remark It must be positive. The default value is 60 seconds.
+     *
+     */
+    std::chrono::milliseconds IdleConnectionTimeout = std::chrono::milliseconds(1000 * 60);
+
+    /**
+     * @brief The maximum number of connections in use by requests at the same time for the same
+     * host and connection settings.
+     *
+     * @remark When the limit is reached, a request waits, in order of priority and then of
+     * arrival, for another request to the host to release its connection, or until its context is
+     * cancelled. The time spent waiting is part of
+     * #Azure::Core::Diagnostics::HttpRequestTimings::ConnectionPoolWait. The default value is no
+     * limit.
+     *
+     */
+    size_t MaxConnectionsPerHost = (std::numeric_limits<size_t>::max)();
+
+    /**
+     * @brief The maximum number of connections in use by requests at the same time, for all the
+     * hosts.
+     *
+     * @remark When the limit is reached, a request waits, in order of priority and then of
+     * arrival, for another request to release its connection, or until its context is cancelled.
+     * Idle connections are limited by #MaxIdleConnections instead. The default value is no limit.
+     *
+     */
+    size_t MaxConnections = (std::numeric_limits<size_t>::max)();
+
+    /**
+     * @brief The number of connections of #MaxConnectionsPerHost and of #MaxConnections which only
+     * the requests of #Azure::Core::Http::RequestPriority::High can use.
+     *
+     * @remark The other requests wait once they use all the connections but the reserved ones, so
+     * that bulk transfers leave room for latency-sensitive requests. At least one connection is
+     * left to them. The default value is 0.
+     *
+     */
+    size_t HighPriorityReservedConnections = 0;
+  };
+
+  /**
+   * @brief The options to control how the libcurl transport adapter resolves host names.
+   *
+   * @remark The connections of the connection pool share a DNS cache, so a burst of new
+   * connections to a host resolves its name once.
+   *
+   */
+  struct CurlTransportDnsOptions final
+  {
+    /**
+     * @brief The time the addresses of a host are kept in the DNS cache.
+     *
+     * @remark The default value is 60 seconds. More about this option:
+     * https://curl.se/libcurl/c/CURLOPT_DNS_CACHE_TIMEOUT.html
+     *
+     */
+    std::chrono::seconds CacheTimeout = std::chrono::seconds(60);
+
+    /**
+     * @brief The addresses to connect to for some hosts, instead of resolving their names.
+     *
+     * @remark Each entry is formatted as `HOST:PORT:ADDRESS[,ADDRESS]...`, such as
+     * `account.blob.core.windows.net:443:10.0.0.4`. The connections created with overrides don't
+     * share the DNS cache of the connection pool. More about this option:
+     * https://curl.se/libcurl/c/CURLOPT_RESOLVE.html
+     *
+     */
+    std::vector<std::string> ResolveOverrides;
+
+    /**
+     * @brief How long to wait for a connection to the first address family of a host, IPv6 or
+     * IPv4, before also trying the other one in parallel.
+     *
+     * @remark The default value is 200 milliseconds. More about this option:
+     * https://curl.se/libcurl/c/CURLOPT_HAPPY_EYEBALLS_TIMEOUT_MS.html
+     *
+     */
+    std::chrono::milliseconds HappyEyeballsTimeout = std::chrono::milliseconds(200);
+  };
+
+  /**
+   * @brief The options set on the sockets of the connections created by the libcurl transport
+   * adapter.
+   *
+   * @remark The default values leave the buffer sizes and the congestion control algorithm to the
+   * operating system. Fast networks with a long round trip may need larger buffers to keep enough
+   * data in flight.
+   *
+   */
+  struct CurlTransportSocketOptions final
+  {
+    /**
+     * @brief Disables the Nagle algorithm, so that small writes are sent without waiting for the
+     * acknowledgement of the previous ones.
+     *
+     * @remark The default value is `true`. More about this option:
+     * https://curl.se/libcurl/c/CURLOPT_TCP_NODELAY.html
+     *
+     */
+    bool TcpNoDelay = true;
+
+    /**
+     * @brief The size of the receive buffer of the sockets, `SO_RCVBUF`, in bytes.
+     *
+     * @remark It is set before connecting, so that the TCP window can be scaled for it. The
+     * default value, 0, keeps the size chosen by the operating system.
+     *
+     */
+    int32_t ReceiveBufferSize = 0;
+
+    /**
+     * @brief The size of the send buffer of the sockets, `SO_SNDBUF`, in bytes.
+     *
+     * @remark The default value, 0, keeps the size chosen by the operating system. On Windows, the
+     * ideal send buffer size reported by the system is still set after each upload.
+     *
+     */
+    int32_t SendBufferSize = 0;
+
+    /**
+     * @brief Sends TCP keep-alive probes on idle connections, so that the connections in the pool
+     * aren't dropped by the network appliances in between.
+     *
+     * @remark The default value is `false`. More about this option:
+     * https://curl.se/libcurl/c/CURLOPT_TCP_KEEPALIVE.html
+     *
+     */
+    bool TcpKeepAlive = false;
+
+    /**
+     * @brief How long a connection is idle before the first keep-alive probe is sent.
+     *
+     * @remark The default value is 60 seconds. Only used when #TcpKeepAlive is `true`.
+     *
+     */
+    std::chrono::seconds TcpKeepAliveIdle = std::chrono::seconds(60);
+
+    /**
+     * @brief The interval between the keep-alive probes.
+     *
+     * @remark The default value is 60 seconds. Only used when #TcpKeepAlive is `true`.
+     *
+     */
+    std::chrono::seconds TcpKeepAliveInterval = std::chrono::seconds(60);
+
+    /**
+     * @brief The TCP congestion control algorithm of the sockets, such as `bbr`.
+     *
+     * @remark Only supported on Linux, with an algorithm available to the process. Otherwise, a
+     * warning is logged and the connection uses the default algorithm. The default value, an empty
+     * string, keeps the default algorithm.
+     *
+     */
+    std::string CongestionControl;
+  };
+
+  /**
+   * @brief A snapshot of the connection pool counters for one connection key.
+   *
+   * @remark A connection key is built from the host, the port and the connection settings.
+   *
+   */
+  struct CurlConnectionPoolKeyStatistics final
+  {
+    /**
+     * @brief The number of times a connection was re-used from the pool.
+     *
+     */
+    size_t Hits = 0;
+
+    /**
+     * @brief The number of times a new connection had to be created because there was not an idle
+     * connection in the pool.
+     *
+     */
+    size_t Misses = 0;
+
+    /**
+     * @brief The number of idle connections closed by the pool because they expired, the pool
+     * limits were reached, or the pool was reset after failing connections.
+     *
+     */
+    size_t Evictions = 0;
+
+    /**
+     * @brief The number of connections currently in use by a request.
+     *
+     */
+    size_t ActiveConnections = 0;
+
+    /**
+     * @brief The number of connections currently idle in the pool.
+     *
+     */
+    size_t IdleConnections = 0;
+
+    /**
+     * @brief The number of requests which waited for a connection because of the
+     * `MaxConnectionsPerHost` or `MaxConnections` limits.
+     *
+     */
+    size_t AdmissionWaits = 0;
+
+    /**
+     * @brief The total time spent by requests waiting for a connection because of the
+     * `MaxConnectionsPerHost` or `MaxConnections` limits.
+     *
+     */
+    std::chrono::nanoseconds AdmissionWaitTime{};
+
+    /**
+     * @brief The number of times getting a connection from the pool or moving one back to it
+     * waited for another thread using the same part of the pool.
+     *
+     */
+    size_t LockWaits = 0;
+
+    /**
+     * @brief The total time spent waiting for other threads using the same part of the pool.
+     *
+     */
+    std::chrono::nanoseconds LockWaitTime{};
+  };
+
+  /**
+   * @brief A snapshot of the libcurl connection pool counters.
+   *
+   */
+  struct CurlConnectionPoolStatistics final
+  {
+    /**
+     * @brief The counters added up for all the connection keys.
+     *
+     */
+    CurlConnectionPoolKeyStatistics Total;
+
+    /**
+     * @brief The counters for each connection key.
+     *
+     */
+    std::map<std::string, CurlConnectionPoolKeyStatistics> Keys;
+  };
+
   /**
    * @brief Set the libcurl connection options like a proxy and CA path.
    */
@@ -88,6 +374,68 @@ namespace Azure { namespace Core { namespace Http {
      *
      */
     CurlTransportSslOptions SslOptions;
+
+    /**
+     * @brief Define how connections created with these options are kept in the connection pool.
+     *
+     */
+    CurlTransportConnectionPoolOptions ConnectionPoolOptions;
+
+    /**
+     * @brief Define how host names are resolved.
+     *
+     */
+    CurlTransportDnsOptions DnsOptions;
+
+    /**
+     * @brief Define the options set on the sockets of the connections.
+     *
+     */
+    CurlTransportSocketOptions SocketOptions;
+
+    /**
+     * @brief Request bodies up to this size are sent in the same write to the socket as the
+     * request line and headers.
+     *
+     * @remark This saves a write, and a TLS record, for small requests. Requests with such a body
+     * are sent without `Expect: 100-continue`, since waiting for the server to accept them would
+     * take longer than sending them. The default value is 16KiB.
+     *
+     */
+    size_t MaxCoalescedRequestBodySize = 1024 * 16;
+
+    /**
+     * @brief PUT, POST and PATCH requests with a body larger than this size are sent with
+     * `Expect: 100-continue`, and their body is only sent once the server accepted the request
+     * line and headers.
+     *
+     * @remark A request rejected for its headers, like for an expired token, a failed
+     * precondition or throttling, then doesn't upload a body it would have to upload again. When
+     * not set, only the PUT requests whose body isn't sent with the headers wait for the server.
+     *
+     */
+    Azure::Nullable<int64_t> ExpectContinueThreshold;
+
+    /**
+     * @brief How long to wait for the server to accept a request sent with
+     * `Expect: 100-continue`, before sending its body anyway.
+     *
+     * @remark Servers and proxies not implementing `Expect` only reply once they got the body.
+     * The default value is 1 second.
+     *
+     */
+    std::chrono::milliseconds ExpectContinueTimeout = std::chrono::seconds(1);
+
+    /**
+     * @brief Captures the durations of the phases of sending each request in its response.
+     *
+     * @remark When enabled, the connection reuse, connect, time to first byte and response
+     * transfer durations are available from `RawResponse::GetRequestTimings()`, to tell network
+     * stalls from service latency. Disabled by default, since it reads the steady clock a few more
+     * times per request.
+     *
+     */
+    bool CaptureRequestTimings = false;
   };
 
   /**
@@ -102,9 +450,16 @@ namespace Azure { namespace Core { namespace Http {
      * @brief Construct a new CurlTransport object.
      *
      * @param options Optional parameter to override the default options.
+     *
+     * @throw std::invalid_argument if the `IdleConnectionTimeout` of the options isn't positive.
      */
     CurlTransport(CurlTransportOptions const& options = CurlTransportOptions()) : m_options(options)
     {
+      if (m_options.ConnectionPoolOptions.IdleConnectionTimeout
+          <= std::chrono::milliseconds::zero())
+      {
+        throw std::invalid_argument("IdleConnectionTimeout must be positive.");
+      }
     }
 
     /**
@@ -116,6 +471,36 @@ namespace Azure { namespace Core { namespace Http {
      * @return unique ptr to an HTTP RawResponse.
      */
     std::unique_ptr<RawResponse> Send(Request& request, Context const& context) override;
+
+    /**
+     * @brief Opens connections to a host in parallel and keeps them in the connection pool, so the
+     * first requests to that host don't pay for DNS resolution, TCP and TLS handshakes.
+     *
+     * @remark Only the connections missing to have \p connectionsCount idle connections to the
+     * host are opened. No more connections are opened than what the
+     * #Azure::Core::Http::CurlTransportConnectionPoolOptions allow the pool to keep.
+     *
+     * @param url The URL of the host to open connections to. Only the scheme, host and port are
+     * used.
+     * @param connectionsCount The number of idle connections to have in the pool for the host.
+     * @param context A context to cancel opening the connections that haven't started yet.
+     *
+     * @throw Azure::Core::Http::TransportException if any of the connections can't be opened.
+     */
+    void Prewarm(
+        Azure::Core::Url const& url,
+        size_t connectionsCount,
+        Context const& context = Context());
+
+    /**
+     * @brief Gets a snapshot of the counters from the connection pool shared by all the
+     * #Azure::Core::Http::CurlTransport instances.
+     *
+     * @remark Use it to size the connection pool options from real usage.
+     *
+     * @return The connection pool statistics.
+     */
+    static CurlConnectionPoolStatistics GetConnectionPoolStatistics();
   };
 
 }}} // namespace Azure::Core::Http
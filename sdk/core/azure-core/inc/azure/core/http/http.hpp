@@ -19,6 +19,7 @@
 #include "azure/core/url.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <cstdint>
 #include <functional>
 #include <map>
@@ -26,6 +27,7 @@
 #include <stdexcept>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #if defined(TESTING_BUILD)
@@ -168,6 +170,51 @@ namespace Azure { namespace Core { namespace Http {
     class RetryPolicy;
   }} // namespace Policies::_internal
 
+  namespace _internal {
+    /**
+     * @brief Headers a client sets with the same values on all of its requests, validated and
+     * serialized once.
+     *
+     * @remark A policy builds the block when it is constructed, and adds it to each request with
+     * #Azure::Core::Http::Request::AddHeaderBlock() instead of setting the headers one by one.
+     */
+    class HttpHeaderBlock final {
+    public:
+      /**
+       * @brief Constructs a `%HttpHeaderBlock`.
+       *
+       * @param headers The names and values of the headers. A name set twice keeps the last
+       * value.
+       *
+       * @throw if a name is an invalid header key.
+       */
+      explicit HttpHeaderBlock(std::vector<std::pair<std::string, std::string>> const& headers);
+
+      /**
+       * @brief Get the headers, with lower case names.
+       */
+      std::vector<std::pair<std::string, std::string>> const& GetHeaders() const
+      {
+        return m_headers;
+      }
+
+      /**
+       * @brief Get the headers as written in an HTTP/1.1 message, one `name: value\r\n` line per
+       * header.
+       */
+      std::string const& GetSerializedHeaders() const { return m_serializedHeaders; }
+
+      /**
+       * @brief Checks whether the block has a header named \p name, ignoring the case.
+       */
+      bool Contains(std::string const& name) const;
+
+    private:
+      std::vector<std::pair<std::string, std::string>> m_headers;
+      std::string m_serializedHeaders;
+    };
+  } // namespace _internal
+
   /**
    * @brief A request message from a client to a server.
    *
@@ -198,7 +245,18 @@ namespace Azure { namespace Core { namespace Http {
     HttpMethod m_method;
     Url m_url;
     CaseInsensitiveMap m_headers;
-    CaseInsensitiveMap m_retryHeaders;
+    // The values the headers set during the current try had before it, or null for the headers
+    // that didn't exist. StartTry() puts them back, so that GetHeaders() can return the effective
+    // headers without merging two maps.
+    std::map<
+        std::string,
+        Azure::Nullable<std::string>,
+        Azure::Core::_internal::StringExtensions::CaseInsensitiveComparator>
+        m_headersBeforeTry;
+
+    // The header blocks whose headers are all in m_headers with the values of the block, so that
+    // the transports can write them as serialized.
+    std::vector<std::shared_ptr<const _internal::HttpHeaderBlock>> m_headerBlocks;
 
     Azure::Core::IO::BodyStream* m_bodyStream;
 
@@ -210,11 +268,15 @@ namespace Azure { namespace Core { namespace Http {
     // previously called
     void StartTry();
 
+    // Forgets the header blocks having a header named name, when it is set or removed.
+    void DropHeaderBlocks(std::string const& name);
+
+  public:
     /**
-     * @brief Construct an #Azure::Core::Http::Request.
+     * @brief Constructs a `%Request`.
      *
-     * @param httpMethod HttpMethod.
-     * @param url URL.
+     * @param httpMethod HTTP method.
+     * @param url %Request URL.
      * @param bodyStream #Azure::Core::IO::BodyStream.
      * @param shouldBufferResponse A boolean value indicating whether the returned response should
      * be buffered or returned as a body stream instead.
@@ -229,7 +291,6 @@ namespace Azure { namespace Core { namespace Http {
     {
     }
 
-  public:
     /**
      * @brief Constructs a `%Request`.
      *
@@ -281,6 +342,28 @@ namespace Azure { namespace Core { namespace Http {
      */
     void RemoveHeader(std::string const& name);
 
+    /**
+     * @brief Set the headers of a header block to the #Azure::Core::Http::Request.
+     *
+     * @remark The headers are returned by #GetHeaders() as if they were set with #SetHeader(),
+     * without validating them again. While none of them is set or removed, transports can write
+     * the block as serialized.
+     *
+     * @param headerBlock The header block.
+     */
+    void AddHeaderBlock(std::shared_ptr<const _internal::HttpHeaderBlock> headerBlock);
+
+    /**
+     * @brief Get the header blocks whose headers are all set with the values of the block.
+     *
+     * @remark Used by transports to write these headers as serialized, and the other headers from
+     * #GetHeaders().
+     */
+    std::vector<std::shared_ptr<const _internal::HttpHeaderBlock>> const& GetHeaderBlocks() const
+    {
+      return m_headerBlocks;
+    }
+
     // Methods used by transport layer (and logger) to send request
     /**
      * @brief Get HttpMethod.
@@ -294,6 +377,14 @@ namespace Azure { namespace Core { namespace Http {
      */
     CaseInsensitiveMap GetHeaders() const;
 
+    /**
+     * @brief Get HTTP headers without copying them.
+     *
+     * @remark The reference is valid for the lifetime of the request, and it reflects the headers
+     * set or removed after this call.
+     */
+    CaseInsensitiveMap const& GetHeadersReference() const;
+
     /**
      * @brief Get HTTP body as #Azure::Core::IO::BodyStream.
      *
@@ -330,9 +421,10 @@ namespace Azure { namespace Core { namespace Http {
        * @param headerName The header name for the header to be inserted.
        * @param headerValue The header value for the header to be inserted.
        *
+       * @return The value of the header in \p headers.
        * @throw if \p headerName is invalid.
        */
-      static void InsertHeaderWithValidation(
+      static std::string& InsertHeaderWithValidation(
           CaseInsensitiveMap& headers,
           std::string const& headerName,
           std::string const& headerValue);
@@ -344,24 +436,30 @@ namespace Azure { namespace Core { namespace Http {
       {
         // get name and value from header
         auto start = first;
-        auto end = std::find(start, last, ':');
+        auto end = static_cast<uint8_t const*>(
+            std::memchr(start, ':', static_cast<size_t>(last - start)));
 
-        if (end == last)
+        if (end == nullptr)
         {
           throw std::invalid_argument("Invalid header. No delimiter ':' found.");
         }
 
-        // Always toLower() headers
-        auto headerName
-            = Azure::Core::_internal::StringExtensions::ToLower(std::string(start, end));
+        // Always toLower() headers, in place of the name copied from the buffer
+        std::string headerName(start, end);
+        for (auto& symbol : headerName)
+        {
+          symbol = static_cast<char>(Azure::Core::_internal::StringExtensions::ToLower(
+              static_cast<unsigned char>(symbol)));
+        }
         start = end + 1; // start value
         while (start < last && (*start == ' ' || *start == '\t'))
         {
           ++start;
         }
 
-        end = std::find(start, last, '\r');
-        auto headerValue = std::string(start, end); // remove \r
+        end = static_cast<uint8_t const*>(
+            std::memchr(start, '\r', static_cast<size_t>(last - start)));
+        auto headerValue = std::string(start, end == nullptr ? last : end); // remove \r
 
         response.SetHeader(headerName, headerValue);
       }
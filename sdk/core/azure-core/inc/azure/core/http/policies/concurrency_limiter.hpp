@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Define the limiter adapting the number of concurrent HTTP requests to each host to its
+ * throttling.
+ */
+
+#pragma once
+
+#include "azure/core/context.hpp"
+#include "azure/core/http/raw_response.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace Azure { namespace Core { namespace Http { namespace Policies {
+  /**
+   * @brief Limits the number of concurrent requests to each host, adapting the limit to the
+   * throttling of the host.
+   *
+   * @remark The limit follows an additive increase, multiplicative decrease: each response which
+   * isn't throttled raises the limit of its host by `1 / limit`, about one more request per round
+   * trip, and a throttled response (`429 Too Many Requests` or `503 Service Unavailable`) cuts it by
+   * `decreaseFactor`. When a throttled response has a `Retry-After` header, no request is sent to
+   * its host before the delay. Set the same limiter to the options of the clients sending
+   * requests to the same account, so that they share the limit.
+   */
+  class ConcurrencyLimiter final {
+  public:
+    /**
+     * @brief The time a request to a host started, returned by #Acquire and given back to
+     * #Release.
+     *
+     */
+    using Permit = std::chrono::steady_clock::time_point;
+
+    /**
+     * @brief Constructs a limiter.
+     *
+     * @param initialLimit The limit of a host before any response from it.
+     * @param maxLimit The maximum limit of a host.
+     * @param decreaseFactor The factor applied to the limit of a host by a throttled response,
+     * between 0 and 1.
+     */
+    explicit ConcurrencyLimiter(
+        size_t initialLimit = 16,
+        size_t maxLimit = 1024,
+        double decreaseFactor = 0.5);
+
+    /**
+     * @brief Destructs the limiter, waiting for the requests waiting on a `Retry-After` delay.
+     *
+     */
+    ~ConcurrencyLimiter();
+
+    ConcurrencyLimiter(ConcurrencyLimiter const&) = delete;
+    ConcurrencyLimiter& operator=(ConcurrencyLimiter const&) = delete;
+
+    /**
+     * @brief Waits until a request can be sent to \p host.
+     *
+     * @param host The host the request is sent to.
+     * @param context A context to control the request lifetime.
+     * @return The permit to give back to #Release once the response is received.
+     *
+     * @throw Azure::Core::OperationCancelledException if \p context is cancelled while waiting.
+     */
+    Permit Acquire(std::string const& host, Context const& context);
+
+    /**
+     * @brief Calls \p onAcquired, from the calling thread if a request can be sent to \p host
+     * right away, or else from the thread releasing a request or from a background thread once the
+     * host accepts requests again.
+     *
+     * @param host The host the request is sent to.
+     * @param onAcquired Called with the permit to give back to #Release.
+     */
+    void AcquireAsync(std::string const& host, std::function<void(Permit)> onAcquired);
+
+    /**
+     * @brief Ends a request to \p host, adapting the limit of the host to the response.
+     *
+     * @param host The host the request was sent to.
+     * @param permit The permit from #Acquire or #AcquireAsync.
+     * @param response The response of the request, or `nullptr` if it failed without one.
+     */
+    void Release(std::string const& host, Permit permit, RawResponse const* response);
+
+    /**
+     * @brief Gets the number of concurrent requests allowed to \p host.
+     *
+     */
+    size_t GetLimit(std::string const& host);
+
+  private:
+    struct HostState final
+    {
+      double Limit;
+      size_t InFlight = 0;
+      // Only the responses to the requests started after the last decrease cut the limit again,
+      // so that a burst of throttled responses cuts it once.
+      std::chrono::steady_clock::time_point LastDecrease;
+      std::chrono::steady_clock::time_point PausedUntil;
+      std::deque<std::function<void(Permit)>> Waiters;
+    };
+
+    size_t const m_initialLimit;
+    size_t const m_maxLimit;
+    double const m_decreaseFactor;
+
+    std::mutex m_mutex;
+    std::condition_variable m_released;
+    std::map<std::string, HostState> m_hosts;
+    size_t m_pendingResumes = 0;
+
+    HostState& GetHostState(std::string const& host);
+    void ResumeAfterPause(
+        std::string const& host,
+        std::chrono::steady_clock::time_point pausedUntil);
+    void Release(
+        std::string const& host,
+        Permit permit,
+        RawResponse const* response,
+        bool endsRequest);
+  };
+}}}} // namespace Azure::Core::Http::Policies
@@ -11,11 +11,18 @@
 #include "azure/core/case_insensitive_containers.hpp"
 #include "azure/core/context.hpp"
 #include "azure/core/credentials/credentials.hpp"
+#include "azure/core/diagnostics/instrumentation.hpp"
 #include "azure/core/dll_import_export.hpp"
 #include "azure/core/http/http.hpp"
+#include "azure/core/http/policies/concurrency_limiter.hpp"
+#include "azure/core/http/policies/request_coalescer.hpp"
+#include "azure/core/http/policies/retry_budget.hpp"
+#include "azure/core/http/request_priority.hpp"
+#include "azure/core/http/response_buffer_pool.hpp"
 #include "azure/core/http/transport.hpp"
 #include "azure/core/uuid.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <map>
@@ -40,6 +47,7 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
   namespace _detail {
     std::shared_ptr<HttpTransport> GetTransportAdapter();
     AZ_CORE_DLLEXPORT extern Azure::Core::CaseInsensitiveSet const g_defaultAllowedHttpHeaders;
+    class HedgingState;
   } // namespace _detail
 
   /**
@@ -97,6 +105,17 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
         HttpStatusCode::ServiceUnavailable,
         HttpStatusCode::GatewayTimeout,
     };
+
+    /**
+     * @brief The maximum duration of each try, after which the try is cancelled and retried like
+     * a transport failure.
+     *
+     * @remark A try which hangs then doesn't use up the deadline of the context of the whole
+     * operation, leaving time for the retries. The default value, zero, sets no timeout to the
+     * tries.
+     *
+     */
+    std::chrono::milliseconds TryTimeout = std::chrono::milliseconds::zero();
   };
 
   /**
@@ -119,6 +138,59 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
     Azure::Core::CaseInsensitiveSet AllowedHttpHeaders = _detail::g_defaultAllowedHttpHeaders;
   };
 
+  /**
+   * @brief Instrumentation options, receiving the spans and the metrics of each try of sending an
+   * HTTP request.
+   *
+   * @remark The requests aren't instrumented when neither a tracer nor a meter is set.
+   */
+  struct InstrumentationOptions final
+  {
+    /**
+     * @brief Starts a span for each try of sending an HTTP request, with the durations of its
+     * phases as attributes.
+     *
+     */
+    std::shared_ptr<Azure::Core::Diagnostics::Tracer> Tracer;
+
+    /**
+     * @brief Records the duration of each try of sending an HTTP request and of its phases, and
+     * counts the retries.
+     *
+     */
+    std::shared_ptr<Azure::Core::Diagnostics::Meter> Meter;
+  };
+
+  /**
+   * @brief Hedging options, to send a second copy of the GET and HEAD requests whose response
+   * takes longer than most responses do.
+   *
+   * @remark Hedging cuts the tail latency caused by occasional slow responses, at the cost of the
+   * extra requests: about `1 - DelayPercentile` of the requests are sent twice.
+   */
+  struct HedgingOptions final
+  {
+    /**
+     * @brief Whether GET and HEAD requests are hedged. The default is `false`.
+     *
+     */
+    bool Enabled = false;
+
+    /**
+     * @brief The percentile of the latencies of the recent responses which a request waits for,
+     * before its copy is sent. It's between 0 and 1, and the default is 0.95.
+     *
+     */
+    double DelayPercentile = 0.95;
+
+    /**
+     * @brief The delay before sending the copy of a request, until enough responses are received
+     * to compute the percentile.
+     *
+     */
+    std::chrono::milliseconds InitialDelay = std::chrono::milliseconds(100);
+  };
+
   /**
    * @brief HTTP transport options parameterize the HTTP transport adapter being used.
    */
@@ -139,10 +211,22 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
      *
      */
     std::shared_ptr<HttpTransport> Transport = _detail::GetTransportAdapter();
+
+    /**
+     * @brief Provides the buffers which the bodies of buffered responses are downloaded into.
+     * They go back to the pool when the responses are destroyed.
+     *
+     * @remark When null, the body of each response is downloaded into a new buffer.
+     */
+    std::shared_ptr<Azure::Core::Http::ResponseBufferPool> ResponseBufferPool;
   };
 
   class NextHttpPolicy;
 
+  namespace _internal {
+    class HttpPolicyObserver;
+  }
+
   /**
    * @brief HTTP policy base class.
    * @note An HTTP pipeline inside SDK clients is an stack sequence of HTTP policies.
@@ -170,6 +254,25 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
         NextHttpPolicy nextPolicy,
         Context const& context) const = 0;
 
+    /**
+     * @brief Applies this HTTP policy without waiting for the response.
+     *
+     * @remark The default implementation calls #Send and then \p callback, blocking the calling
+     * thread. Policies override it to pass the request to `nextPolicy.SendAsync()` and handle the
+     * response from \p callback.
+     *
+     * @param request An HTTP request being sent.
+     * @param nextPolicy The next HTTP to invoke after this policy has been applied.
+     * @param context A context to control the request lifetime.
+     * @param callback The function called with the response after this policy, and all subsequent
+     * HTTP policies in the stack sequence of policies have been applied, or with the error.
+     */
+    virtual void SendAsync(
+        Request& request,
+        NextHttpPolicy nextPolicy,
+        Context const& context,
+        SendCompletionCallback callback) const;
+
     /**
      * @brief Destructs `%HttpPolicy`.
      *
@@ -225,6 +328,8 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
     const size_t m_index;
     const std::vector<std::unique_ptr<HttpPolicy>>& m_policies;
 
+    friend class _internal::HttpPolicyObserver;
+
   public:
     /**
      * @brief Constructs an abstraction representing a next line in the stack sequence of policies,
@@ -249,10 +354,78 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
      * sequence of policies have been applied.
      */
     std::unique_ptr<RawResponse> Send(Request& request, Context const& context);
+
+    /**
+     * @brief Applies this HTTP policy without waiting for the response.
+     *
+     * @param request An HTTP request being sent.
+     * @param context A context to control the request lifetime.
+     * @param callback The function called with the response after this policy, and all subsequent
+     * HTTP policies in the stack sequence of policies have been applied, or with the error.
+     */
+    void SendAsync(Request& request, Context const& context, SendCompletionCallback callback);
   };
 
   namespace _internal {
 
+    /**
+     * @brief Observes the calls to the policies of all the pipelines, to break the overhead of a
+     * request down per policy.
+     *
+     * @remark Observing is opt-in: while no observer is installed, calling a policy costs one more
+     * atomic load. Only #Azure::Core::Http::Policies::HttpPolicy::Send is observed.
+     */
+    class HttpPolicyObserver {
+    public:
+      /**
+       * @brief Destructs `%HttpPolicyObserver`.
+       *
+       */
+      virtual ~HttpPolicyObserver() {}
+
+      /**
+       * @brief Called when a policy returns, or throws.
+       *
+       * @remark Called concurrently by the threads sending requests.
+       *
+       * @param policy The policy called.
+       * @param index The index of the policy in its pipeline.
+       * @param elapsed The time spent in the policy, including the policies after it in the
+       * pipeline.
+       */
+      virtual void OnPolicyCalled(
+          HttpPolicy const& policy,
+          size_t index,
+          std::chrono::nanoseconds elapsed)
+          = 0;
+
+      /**
+       * @brief Installs the observer of the calls to the policies, replacing the one installed.
+       *
+       * @remark The observer must be kept alive until the requests sent while it's installed
+       * return.
+       *
+       * @param observer The observer, or `nullptr` to stop observing.
+       */
+      static void Install(HttpPolicyObserver* observer);
+
+      /**
+       * @brief Calls a policy, reporting the call to the observer installed.
+       *
+       * @param policy The policy to call.
+       * @param request An HTTP request being sent.
+       * @param nextPolicy The policy after \p policy.
+       * @param context A context to control the request lifetime.
+       *
+       * @return The response returned by \p policy.
+       */
+      static std::unique_ptr<RawResponse> Send(
+          HttpPolicy const& policy,
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context);
+    };
+
     /**
      * @brief Applying this policy sends an HTTP request over the wire.
      * @remark This policy must be the bottom policy in the stack of the HTTP policy stack.
@@ -281,6 +454,12 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Request& request,
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendCompletionCallback callback) const override;
     };
 
     /**
@@ -293,14 +472,25 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
         : public HttpPolicy {
     private:
       RetryOptions m_retryOptions;
+      std::shared_ptr<RetryBudget> m_retryBudget;
+
+      bool IsRetryWithinBudget() const;
+      void DepositInRetryBudget() const;
 
     public:
       /**
        * Constructs HTTP retry policy with the provided #Azure::Core::Http::Policies::RetryOptions.
        *
        * @param options #Azure::Core::Http::Policies::RetryOptions.
+       * @param retryBudget The budget bounding the retries, shared with other policies. When
+       * null, the requests are retried as the \p options allow regardless of the other requests.
        */
-      explicit RetryPolicy(RetryOptions options) : m_retryOptions(std::move(options)) {}
+      explicit RetryPolicy(
+          RetryOptions options,
+          std::shared_ptr<RetryBudget> retryBudget = nullptr)
+          : m_retryOptions(std::move(options)), m_retryBudget(std::move(retryBudget))
+      {
+      }
 
       std::unique_ptr<HttpPolicy> Clone() const override
       {
@@ -312,6 +502,12 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           NextHttpPolicy nextPolicy,
           Context const& context) const final;
 
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendCompletionCallback callback) const final;
+
       /**
        * @brief Get the Retry Count from the context.
        *
@@ -372,6 +568,18 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
         request.SetHeader(RequestIdHeader, uuid);
         return nextPolicy.Send(request, context);
       }
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendCompletionCallback callback) const override
+      {
+        auto uuid = Uuid::CreateUuid().ToString();
+
+        request.SetHeader(RequestIdHeader, uuid);
+        nextPolicy.SendAsync(request, context, std::move(callback));
+      }
     };
 
     /**
@@ -384,6 +592,8 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
     class TelemetryPolicy final : public HttpPolicy {
     private:
       std::string const m_telemetryId;
+      // The User-Agent header, validated and serialized once for all the requests.
+      std::shared_ptr<const Azure::Core::Http::_internal::HttpHeaderBlock> const m_headerBlock;
 
       static std::string BuildTelemetryId(
           std::string const& componentName,
@@ -402,7 +612,9 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           std::string const& componentName,
           std::string const& componentVersion,
           TelemetryOptions options = TelemetryOptions())
-          : m_telemetryId(BuildTelemetryId(componentName, componentVersion, options.ApplicationId))
+          : m_telemetryId(BuildTelemetryId(componentName, componentVersion, options.ApplicationId)),
+            m_headerBlock(std::make_shared<const Azure::Core::Http::_internal::HttpHeaderBlock>(
+                std::vector<std::pair<std::string, std::string>>{{"User-Agent", m_telemetryId}}))
       {
       }
 
@@ -415,6 +627,12 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Request& request,
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendCompletionCallback callback) const override;
     };
 
     /**
@@ -423,15 +641,41 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
      */
     class BearerTokenAuthenticationPolicy final : public HttpPolicy {
     private:
-      std::shared_ptr<Credentials::TokenCredential const> const m_credential;
-      Credentials::TokenRequestContext m_tokenRequestContext;
-
-      mutable Credentials::AccessToken m_accessToken;
-      mutable std::mutex m_accessTokenMutex;
+      // Shared with the background refresh, which may outlive the policy.
+      struct TokenCache final
+      {
+        std::shared_ptr<Credentials::TokenCredential const> const Credential;
+        Credentials::TokenRequestContext const TokenRequestContext;
+
+        // Null until the first token is fetched. Read and replaced with std::atomic_load() and
+        // std::atomic_store(), so sending a request with a valid token takes no lock.
+        std::shared_ptr<Credentials::AccessToken const> AccessToken;
+        // Held while fetching a token, so that only one token is fetched at a time.
+        std::mutex RefreshMutex;
+        std::atomic<bool> IsRefreshing{false};
+        // After a failed background refresh, the next one waits for a delay doubling with each
+        // failure. Only accessed by whoever set IsRefreshing.
+        std::chrono::steady_clock::time_point NextRefreshTime;
+        std::chrono::seconds RefreshBackoff{0};
+
+        TokenCache(
+            std::shared_ptr<Credentials::TokenCredential const> credential,
+            Credentials::TokenRequestContext tokenRequestContext)
+            : Credential(std::move(credential)),
+              TokenRequestContext(std::move(tokenRequestContext))
+        {
+        }
+      };
+
+      std::shared_ptr<TokenCache> const m_tokenCache;
 
       BearerTokenAuthenticationPolicy(BearerTokenAuthenticationPolicy const&) = delete;
       void operator=(BearerTokenAuthenticationPolicy const&) = delete;
 
+      // Gets a token, fetching it when there's none or it is about to expire, refreshes it in the
+      // background when it expires soon, and sets the authorization header.
+      void AuthorizeRequest(Request& request, Context const& context) const;
+
     public:
       /**
        * @brief Construct a Bearer Token authentication policy.
@@ -442,21 +686,28 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
       explicit BearerTokenAuthenticationPolicy(
           std::shared_ptr<Credentials::TokenCredential const> credential,
           Credentials::TokenRequestContext tokenRequestContext)
-          : m_credential(std::move(credential)),
-            m_tokenRequestContext(std::move(tokenRequestContext))
+          : m_tokenCache(std::make_shared<TokenCache>(
+              std::move(credential),
+              std::move(tokenRequestContext)))
       {
       }
 
       std::unique_ptr<HttpPolicy> Clone() const override
       {
         return std::make_unique<BearerTokenAuthenticationPolicy>(
-            m_credential, m_tokenRequestContext);
+            m_tokenCache->Credential, m_tokenCache->TokenRequestContext);
       }
 
       std::unique_ptr<RawResponse> Send(
           Request& request,
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendCompletionCallback callback) const override;
     };
 
     /**
@@ -480,6 +731,213 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
         return std::make_unique<LogPolicy>(*this);
       }
 
+      std::unique_ptr<RawResponse> Send(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const override;
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendCompletionCallback callback) const override;
+    };
+
+    /**
+     * @brief Traces and measures each try of sending an HTTP request.
+     *
+     * @details Starts a span, and records the duration of the try and of the phases measured by
+     * the transport adapter, which it reports through #GetRequestTimings.
+     * @remark See #Azure::Core::Http::Policies::InstrumentationOptions.
+     */
+    class InstrumentationPolicy final : public HttpPolicy {
+      InstrumentationOptions m_options;
+
+    public:
+      /**
+       * @brief Constructs HTTP instrumentation policy.
+       *
+       */
+      explicit InstrumentationPolicy(InstrumentationOptions options)
+          : m_options(std::move(options))
+      {
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<InstrumentationPolicy>(*this);
+      }
+
+      std::unique_ptr<RawResponse> Send(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const override;
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendCompletionCallback callback) const override;
+
+      /**
+       * @brief Gets the timings of the request being sent, which the transport adapter fills.
+       *
+       * @param context A context to control the request lifetime.
+       * @return The timings, or `nullptr` when the request isn't instrumented.
+       */
+      static Azure::Core::Diagnostics::HttpRequestTimings* GetRequestTimings(
+          Context const& context);
+    };
+
+    /**
+     * @brief Sends a copy of the GET and HEAD requests without a response after a delay, and
+     * returns the first response.
+     *
+     * @details The request is sent from the calling thread, with the policies after this one.
+     * When no response is received after the percentile of the recent latencies set by the
+     * options, a copy of the request is sent from a thread of its own. The try which doesn't
+     * return the response is cancelled, and the destructor joins the threads of the copies still
+     * in flight.
+     * @remark See #Azure::Core::Http::Policies::HedgingOptions.
+     */
+    class HedgingPolicy final : public HttpPolicy {
+      HedgingOptions m_options;
+      std::shared_ptr<_detail::HedgingState> m_state;
+
+    public:
+      /**
+       * @brief Constructs HTTP hedging policy.
+       *
+       */
+      explicit HedgingPolicy(HedgingOptions options);
+
+      /**
+       * @brief Constructs a copy of \p other, with its options but not the latencies it measured.
+       *
+       */
+      HedgingPolicy(HedgingPolicy const& other);
+
+      /**
+       * @brief Waits for the tries in flight, once cancelled.
+       *
+       */
+      ~HedgingPolicy() override;
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<HedgingPolicy>(*this);
+      }
+
+      std::unique_ptr<RawResponse> Send(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const override;
+
+      /**
+       * @brief Checks whether the request being sent is the copy of a request that was sent
+       * first.
+       *
+       * @param context A context to control the request lifetime.
+       * @return `true` for the copy of a hedged request; otherwise, `false`.
+       */
+      static bool IsHedgedTry(Context const& context);
+    };
+
+    /**
+     * @brief Waits for the limiter before sending each try of a request, and adapts the limit of
+     * the host to the response.
+     *
+     * @remark See #Azure::Core::Http::Policies::ConcurrencyLimiter.
+     */
+    class ConcurrencyLimitPolicy final : public HttpPolicy {
+      std::shared_ptr<ConcurrencyLimiter> m_limiter;
+
+    public:
+      /**
+       * @brief Constructs HTTP concurrency limit policy.
+       *
+       * @param limiter The limiter, shared with other policies.
+       */
+      explicit ConcurrencyLimitPolicy(std::shared_ptr<ConcurrencyLimiter> limiter)
+          : m_limiter(std::move(limiter))
+      {
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<ConcurrencyLimitPolicy>(*this);
+      }
+
+      std::unique_ptr<RawResponse> Send(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const override;
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendCompletionCallback callback) const override;
+    };
+
+    /**
+     * @brief Sets the priority of the client options to the requests whose context has none.
+     *
+     * @remark See #Azure::Core::Http::RequestPriority.
+     */
+    class RequestPriorityPolicy final : public HttpPolicy {
+      RequestPriority m_priority;
+
+    public:
+      /**
+       * @brief Constructs HTTP request priority policy.
+       *
+       * @param priority The priority of the requests whose context has none.
+       */
+      explicit RequestPriorityPolicy(RequestPriority priority) : m_priority(priority) {}
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<RequestPriorityPolicy>(*this);
+      }
+
+      std::unique_ptr<RawResponse> Send(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context) const override;
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendCompletionCallback callback) const override;
+    };
+
+    /**
+     * @brief Sends a single try for identical GET requests in flight at the same time, once
+     * they're authorized.
+     *
+     * @remark See #Azure::Core::Http::Policies::RequestCoalescer.
+     */
+    class RequestCoalescingPolicy final : public HttpPolicy {
+      std::shared_ptr<RequestCoalescer> m_coalescer;
+
+    public:
+      /**
+       * @brief Constructs HTTP request coalescing policy.
+       *
+       * @param coalescer The coalescer, shared with other policies.
+       */
+      explicit RequestCoalescingPolicy(std::shared_ptr<RequestCoalescer> coalescer)
+          : m_coalescer(std::move(coalescer))
+      {
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<RequestCoalescingPolicy>(*this);
+      }
+
       std::unique_ptr<RawResponse> Send(
           Request& request,
           NextHttpPolicy nextPolicy,
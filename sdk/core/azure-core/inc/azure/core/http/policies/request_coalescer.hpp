@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Define the coalescer sending one request for identical concurrent GET requests.
+ */
+
+#pragma once
+
+#include "azure/core/context.hpp"
+#include "azure/core/http/http.hpp"
+#include "azure/core/http/raw_response.hpp"
+#include "azure/core/io/shared_buffer.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Azure { namespace Core { namespace Http { namespace Policies {
+  /**
+   * @brief Sends a single request for identical GET requests in flight at the same time, and
+   * passes a copy of its response to each of them.
+   *
+   * @remark Requests are identical when they have the same URL and the same headers, so the same
+   * range, conditions and authorization, apart from the request ID and the date. A coalescer runs
+   * after the authorization is added, so it can be shared by clients with different credentials:
+   * only the requests of the same principal share a response. The first request is sent; the
+   * identical requests started before it gets a response wait for it. Its body is buffered, when
+   * its `Content-Length` is at most `maxBodySize`, and each waiting request gets a response
+   * sharing the buffer. When the body is larger or the first request fails, the waiting requests
+   * are sent on their own. No response is kept once it's passed to the requests waiting for it.
+   */
+  class RequestCoalescer final {
+  public:
+    /**
+     * @brief Constructs a coalescer.
+     *
+     * @param maxBodySize The maximum size of a response body buffered to be shared.
+     */
+    explicit RequestCoalescer(size_t maxBodySize = 4 * 1024 * 1024);
+
+    RequestCoalescer(RequestCoalescer const&) = delete;
+    RequestCoalescer& operator=(RequestCoalescer const&) = delete;
+
+    /**
+     * @brief Sends \p request with \p send, unless an identical request is in flight, in which
+     * case waits for its response.
+     *
+     * @param request The request. Only GET requests without a body are coalesced.
+     * @param context A context to control the request lifetime.
+     * @param send Sends the request and returns its response.
+     * @return The response of the request, or a copy of the response of the identical request.
+     *
+     * @throw Azure::Core::OperationCancelledException if \p context is cancelled while waiting.
+     */
+    std::unique_ptr<RawResponse> Send(
+        Request& request,
+        Context const& context,
+        std::function<std::unique_ptr<RawResponse>()> const& send);
+
+    /**
+     * @brief Gets the number of requests which waited for an identical request in flight,
+     * instead of being sent right away.
+     *
+     */
+    size_t GetCoalescedRequestCount();
+
+  private:
+    struct Flight final
+    {
+      bool Landed = false;
+      // The response without its body, or null if it can't be shared.
+      std::unique_ptr<RawResponse> Response;
+      Azure::Core::IO::SharedBuffer Body;
+    };
+
+    size_t const m_maxBodySize;
+
+    std::mutex m_mutex;
+    std::condition_variable m_landed;
+    std::map<std::string, std::shared_ptr<Flight>> m_flights;
+    size_t m_coalescedRequestCount = 0;
+
+    std::unique_ptr<RawResponse> SendFirst(
+        Request& request,
+        Context const& context,
+        std::function<std::unique_ptr<RawResponse>()> const& send,
+        std::string const& key,
+        std::shared_ptr<Flight> const& flight);
+    void Land(std::string const& key, std::shared_ptr<Flight> const& flight);
+  };
+}}}} // namespace Azure::Core::Http::Policies
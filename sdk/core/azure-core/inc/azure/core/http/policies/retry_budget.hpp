@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Define the budget bounding the retries of the HTTP requests sharing it.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace Azure { namespace Core { namespace Http { namespace Policies {
+  /**
+   * @brief Bounds the retries of the requests sharing it to a fraction of their successful
+   * responses, so that the retries don't multiply the load on a service which is failing.
+   *
+   * @remark The budget is a token bucket: each response which isn't retried deposits
+   * `retryRatio` tokens, `minRetriesPerSecond` tokens are deposited each second, and each retry
+   * withdraws one token. A request isn't retried when the bucket is empty. Set the same budget
+   * to the options of the clients whose retries it bounds, or of all the clients of the process.
+   */
+  class RetryBudget final {
+  public:
+    /**
+     * @brief Constructs a budget, with a full bucket.
+     *
+     * @param retryRatio The number of retries allowed per response which isn't retried.
+     * @param minRetriesPerSecond The number of retries allowed each second regardless of the
+     * responses, so that clients sending few requests can retry them.
+     * @param maxTokens The maximum number of tokens of the bucket, which bounds the burst of
+     * retries.
+     */
+    explicit RetryBudget(
+        double retryRatio = 0.1,
+        double minRetriesPerSecond = 1.0,
+        double maxTokens = 100.0);
+
+    RetryBudget(RetryBudget const&) = delete;
+    RetryBudget& operator=(RetryBudget const&) = delete;
+
+    /**
+     * @brief Deposits the tokens of a response which isn't retried.
+     *
+     */
+    void Deposit();
+
+    /**
+     * @brief Withdraws the token of a retry.
+     *
+     * @return `true` if the request can be retried; `false` if the bucket is empty.
+     */
+    bool TryWithdraw();
+
+    /**
+     * @brief Gets the number of tokens of the bucket.
+     *
+     */
+    double GetTokens();
+
+  private:
+    double const m_retryRatio;
+    double const m_minRetriesPerSecond;
+    double const m_maxTokens;
+
+    std::mutex m_mutex;
+    double m_tokens;
+    std::chrono::steady_clock::time_point m_lastRefill;
+
+    void Refill();
+  };
+}}}} // namespace Azure::Core::Http::Policies
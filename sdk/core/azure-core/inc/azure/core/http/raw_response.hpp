@@ -9,14 +9,73 @@
 #pragma once
 
 #include "azure/core/case_insensitive_containers.hpp"
+#include "azure/core/diagnostics/instrumentation.hpp"
 #include "azure/core/http/http_status_code.hpp"
+#include "azure/core/http/response_buffer_pool.hpp"
 #include "azure/core/io/body_stream.hpp"
+#include "azure/core/nullable.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace Azure { namespace Core { namespace Http {
+  namespace _internal {
+    /**
+     * @brief The IDs of the headers found in most responses of the Azure services.
+     *
+     * @remark #Azure::Core::Http::RawResponse indexes these headers by their ID when they are set,
+     * so that the response builders get them without looking up the headers map.
+     */
+    enum class WellKnownHeader : uint8_t
+    {
+      CacheControl, ///< `cache-control`
+      ContentDisposition, ///< `content-disposition`
+      ContentEncoding, ///< `content-encoding`
+      ContentLanguage, ///< `content-language`
+      ContentLength, ///< `content-length`
+      ContentMd5, ///< `content-md5`
+      ContentRange, ///< `content-range`
+      ContentType, ///< `content-type`
+      Date, ///< `date`
+      ETag, ///< `etag`
+      LastModified, ///< `last-modified`
+      XMsBlobSequenceNumber, ///< `x-ms-blob-sequence-number`
+      XMsBlobType, ///< `x-ms-blob-type`
+      XMsClientRequestId, ///< `x-ms-client-request-id`
+      XMsContentCrc64, ///< `x-ms-content-crc64`
+      XMsCopyId, ///< `x-ms-copy-id`
+      XMsCopyStatus, ///< `x-ms-copy-status`
+      XMsCreationTime, ///< `x-ms-creation-time`
+      XMsEncryptionKeySha256, ///< `x-ms-encryption-key-sha256`
+      XMsEncryptionScope, ///< `x-ms-encryption-scope`
+      XMsFileAttributes, ///< `x-ms-file-attributes`
+      XMsFileChangeTime, ///< `x-ms-file-change-time`
+      XMsFileCreationTime, ///< `x-ms-file-creation-time`
+      XMsFileId, ///< `x-ms-file-id`
+      XMsFileLastWriteTime, ///< `x-ms-file-last-write-time`
+      XMsFileParentId, ///< `x-ms-file-parent-id`
+      XMsFilePermissionKey, ///< `x-ms-file-permission-key`
+      XMsLeaseDuration, ///< `x-ms-lease-duration`
+      XMsLeaseId, ///< `x-ms-lease-id`
+      XMsLeaseState, ///< `x-ms-lease-state`
+      XMsLeaseStatus, ///< `x-ms-lease-status`
+      XMsRequestId, ///< `x-ms-request-id`
+      XMsRequestServerEncrypted, ///< `x-ms-request-server-encrypted`
+      XMsServerEncrypted, ///< `x-ms-server-encrypted`
+      XMsVersion, ///< `x-ms-version`
+      XMsVersionId, ///< `x-ms-version-id`
+    };
+
+    /**
+     * @brief The number of #Azure::Core::Http::_internal::WellKnownHeader IDs.
+     */
+    constexpr static size_t WellKnownHeaderCount = 36;
+  } // namespace _internal
+
   /**
    * @brief After receiving and interpreting a request message, a server responds with an HTTP
    * response message.
@@ -29,9 +88,14 @@ namespace Azure { namespace Core { namespace Http {
     HttpStatusCode m_statusCode;
     std::string m_reasonPhrase;
     CaseInsensitiveMap m_headers;
+    // The values of the well-known headers in m_headers by their ID, or null when not set.
+    std::array<std::string const*, _internal::WellKnownHeaderCount> m_wellKnownHeaders{};
 
     std::unique_ptr<Azure::Core::IO::BodyStream> m_bodyStream;
     std::vector<uint8_t> m_body;
+    // The pool the body goes back to when the response is destroyed.
+    std::shared_ptr<ResponseBufferPool> m_bodyBufferPool;
+    Azure::Nullable<Azure::Core::Diagnostics::HttpRequestTimings> m_requestTimings;
 
     explicit RawResponse(
         int32_t majorVersion,
@@ -79,6 +143,7 @@ namespace Azure { namespace Core { namespace Http {
       AZURE_ASSERT(m_bodyStream == nullptr);
       // Copy body
       m_body = response.GetBody();
+      m_requestTimings = response.m_requestTimings;
     }
 
     /**
@@ -104,8 +169,15 @@ namespace Azure { namespace Core { namespace Http {
     /**
      * @brief Destructs `%RawResponse`.
      *
+     * @remark A body set with a #Azure::Core::Http::ResponseBufferPool goes back to the pool.
      */
-    ~RawResponse() = default;
+    ~RawResponse()
+    {
+      if (m_bodyBufferPool)
+      {
+        m_bodyBufferPool->Release(std::move(m_body));
+      }
+    }
 
     // ===== Methods used to build HTTP response =====
 
@@ -133,7 +205,25 @@ namespace Azure { namespace Core { namespace Http {
      *
      * @param body HTTP response body bytes.
      */
-    void SetBody(std::vector<uint8_t> body) { this->m_body = std::move(body); }
+    void SetBody(std::vector<uint8_t> body) { SetBody(std::move(body), nullptr); }
+
+    /**
+     * @brief Set HTTP response body for this HTTP response, from a buffer of \p bufferPool.
+     *
+     * @param body HTTP response body bytes.
+     * @param bufferPool The pool \p body goes back to when the response is destroyed.
+     */
+    void SetBody(std::vector<uint8_t> body, std::shared_ptr<ResponseBufferPool> bufferPool);
+
+    /**
+     * @brief Set the durations of the phases of sending the request of this HTTP response.
+     *
+     * @param timings The durations measured by the transport adapter.
+     */
+    void SetRequestTimings(Azure::Core::Diagnostics::HttpRequestTimings const& timings)
+    {
+      m_requestTimings = timings;
+    }
 
     // adding getters for version and stream body. Clang will complain on macOS if we have unused
     // fields in a class
@@ -156,6 +246,32 @@ namespace Azure { namespace Core { namespace Http {
      */
     CaseInsensitiveMap const& GetHeaders() const;
 
+    /**
+     * @brief Get the value of a well-known HTTP response header.
+     *
+     * @remark Unlike finding it in #GetHeaders(), this doesn't compare any header name.
+     *
+     * @param header The ID of the header.
+     * @return The header value.
+     * @throw std::out_of_range if the response doesn't have the header.
+     */
+    std::string const& GetHeader(_internal::WellKnownHeader header) const;
+
+    /**
+     * @brief Get the durations of the phases of sending the request of this HTTP response.
+     *
+     * @remark They are only captured by the transport adapters supporting it, when enabled, such
+     * as with #Azure::Core::Http::CurlTransportOptions::CaptureRequestTimings. The response
+     * transfer is only measured for buffered responses, when the body is downloaded to the
+     * response by the pipeline.
+     *
+     * @return The timings, or no value when they weren't captured.
+     */
+    Azure::Nullable<Azure::Core::Diagnostics::HttpRequestTimings> const& GetRequestTimings() const
+    {
+      return m_requestTimings;
+    }
+
     /**
      * @brief Get HTTP response body as #Azure::Core::IO::BodyStream.
      *
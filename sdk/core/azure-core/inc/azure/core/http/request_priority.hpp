@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief The priority of the requests, which the shared capacity of the transport adapters
+ * considers when the requests wait for it.
+ */
+
+#pragma once
+
+#include "azure/core/context.hpp"
+
+namespace Azure { namespace Core { namespace Http {
+
+  /**
+   * @brief The priority class of a request, or of the chunks of a transfer.
+   *
+   * @remark Waiting requests of a higher priority go first, and the capacity reserved for
+   * #RequestPriority::High, such as
+   * #Azure::Core::Http::CurlTransportConnectionPoolOptions::HighPriorityReservedConnections, is
+   * only used by them. Requests of the same priority go in order of arrival.
+   */
+  enum class RequestPriority
+  {
+    /**
+     * @brief Background traffic, which goes after any other waiting request.
+     *
+     */
+    Low,
+
+    /**
+     * @brief The priority of the requests whose context and client options set none.
+     *
+     */
+    Normal,
+
+    /**
+     * @brief Latency-sensitive traffic, which goes first and can use the reserved capacity.
+     *
+     */
+    High,
+  };
+
+  /**
+   * @brief Sets the priority of the requests sent with a context.
+   *
+   * @remark The priority applies to the requests sent with the returned context or any context
+   * derived from it, and takes precedence over the priority of the client options.
+   *
+   * @param context The context to derive from.
+   * @param priority The priority of the requests.
+   * @return A context with the priority.
+   */
+  Context WithRequestPriority(Context const& context, RequestPriority priority);
+
+  /**
+   * @brief Gets the priority of the requests sent with a context.
+   *
+   * @param context A context to control the request lifetime.
+   * @return The priority set by #WithRequestPriority, or #RequestPriority::Normal when there is
+   * none.
+   */
+  RequestPriority GetRequestPriority(Context const& context);
+
+}}} // namespace Azure::Core::Http
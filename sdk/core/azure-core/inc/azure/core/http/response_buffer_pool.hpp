@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Define the pool of the body buffers of buffered HTTP responses.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Http {
+  /**
+   * @brief Reuses the buffers which the bodies of buffered responses are downloaded into.
+   *
+   * @remark A response body downloaded into a buffer of the pool goes back to the pool when the
+   * #Azure::Core::Http::RawResponse is destroyed, so the next responses reuse its capacity
+   * instead of growing a new buffer.
+   */
+  class ResponseBufferPool final {
+  public:
+    /**
+     * @brief Constructs a pool.
+     *
+     * @param maxPooledBuffers The maximum number of free buffers kept by the pool.
+     * @param maxBufferCapacity The capacity above which a buffer given back to the pool is freed
+     * instead of being kept.
+     */
+    explicit ResponseBufferPool(
+        size_t maxPooledBuffers = 16,
+        size_t maxBufferCapacity = 16 * 1024 * 1024)
+        : m_maxPooledBuffers(maxPooledBuffers), m_maxBufferCapacity(maxBufferCapacity)
+    {
+    }
+
+    ResponseBufferPool(ResponseBufferPool const&) = delete;
+    ResponseBufferPool& operator=(ResponseBufferPool const&) = delete;
+
+    /**
+     * @brief Gets an empty buffer, with a capacity of at least \p sizeHint bytes.
+     *
+     * @param sizeHint The expected size of the body, 0 if unknown.
+     */
+    std::vector<uint8_t> Acquire(size_t sizeHint);
+
+    /**
+     * @brief Gives a buffer back to the pool.
+     *
+     * @param buffer A buffer from #Acquire.
+     */
+    void Release(std::vector<uint8_t> buffer);
+
+    /**
+     * @brief Gets the number of free buffers kept by the pool.
+     *
+     */
+    size_t GetPooledBufferCount() const;
+
+  private:
+    size_t m_maxPooledBuffers;
+    size_t m_maxBufferCapacity;
+    mutable std::mutex m_mutex;
+    std::vector<std::vector<uint8_t>> m_buffers;
+  };
+}}} // namespace Azure::Core::Http
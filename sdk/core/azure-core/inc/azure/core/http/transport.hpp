@@ -11,8 +11,21 @@
 #include "azure/core/context.hpp"
 #include "azure/core/http/http.hpp"
 
+#include <exception>
+#include <functional>
+#include <memory>
+
 namespace Azure { namespace Core { namespace Http {
 
+  /**
+   * @brief The function called when a request sent asynchronously completes.
+   *
+   * @remark It gets either the response, or the error that prevented getting one. The callback
+   * must not throw.
+   */
+  using SendCompletionCallback
+      = std::function<void(std::unique_ptr<RawResponse> response, std::exception_ptr error)>;
+
   /**
    * @brief Base class for all HTTP transport implementations.
    */
@@ -31,6 +44,36 @@ namespace Azure { namespace Core { namespace Http {
     // TODO - Should this be const
     virtual std::unique_ptr<RawResponse> Send(Request& request, Context const& context) = 0;
 
+    /**
+     * @brief Send an HTTP request over the wire without waiting for the response.
+     *
+     * @remark The \p request and its body stream must be kept alive until \p callback is called.
+     * The default implementation calls #Send and then \p callback from the calling thread.
+     * Transports with an event loop override it to return right away and call \p callback from
+     * their own thread.
+     *
+     * @param request An #Azure::Core::Http::Request to send.
+     * @param context A context to control the request lifetime.
+     * @param callback The function called with the response or the error.
+     */
+    virtual void SendAsync(
+        Request& request,
+        Context const& context,
+        SendCompletionCallback callback)
+    {
+      std::unique_ptr<RawResponse> response;
+      std::exception_ptr error;
+      try
+      {
+        response = Send(request, context);
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+      callback(std::move(response), error);
+    }
+
     /**
      * @brief Destructs `%HttpTransport`.
      *
@@ -24,6 +24,10 @@
 #include <windows.h>
 #endif
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <type_traits>
 #include <vector>
 #include <winhttp.h>
@@ -39,39 +43,28 @@ namespace Azure { namespace Core { namespace Http {
     {
       Context const& m_context;
       Request& m_request;
-      HINTERNET m_sessionHandle;
-      HINTERNET m_connectionHandle;
+      /**
+       * @brief The connection handle is shared with the transport, which reuses it for all the
+       * requests to the same host and port. It keeps the session handle alive.
+       */
+      std::shared_ptr<void> m_connectionHandle;
       HINTERNET m_requestHandle;
 
       HandleManager(Request& request, Context const& context)
           : m_request(request), m_context(context)
       {
-        m_sessionHandle = NULL;
-        m_connectionHandle = NULL;
         m_requestHandle = NULL;
       }
 
       ~HandleManager()
       {
-        // Close the handles and set them to null to avoid multiple calls to WinHTT to close the
-        // handles.
+        // Close the handle and set it to null to avoid multiple calls to WinHTTP to close it.
+        // The connection handle is closed once no request and no transport use it anymore.
         if (m_requestHandle)
         {
           WinHttpCloseHandle(m_requestHandle);
           m_requestHandle = NULL;
         }
-
-        if (m_connectionHandle)
-        {
-          WinHttpCloseHandle(m_connectionHandle);
-          m_connectionHandle = NULL;
-        }
-
-        if (m_sessionHandle)
-        {
-          WinHttpCloseHandle(m_sessionHandle);
-          m_sessionHandle = NULL;
-        }
       }
     };
 
@@ -139,16 +132,23 @@ namespace Azure { namespace Core { namespace Http {
   private:
     WinHttpTransportOptions m_options;
 
-    void CreateSessionHandle(std::unique_ptr<_detail::HandleManager>& handleManager);
-    void CreateConnectionHandle(std::unique_ptr<_detail::HandleManager>& handleManager);
+    // The session handle is opened by the first request, and the connection handles are cached
+    // by host and port, so that the requests share the connection pool of WinHTTP instead of
+    // opening a session and a connection each.
+    // The requests sent with SendAsync() use their own session, opened with WINHTTP_FLAG_ASYNC,
+    // since a WinHTTP session is either synchronous or asynchronous.
+    std::mutex m_handlesMutex;
+    std::shared_ptr<void> m_sessionHandle;
+    std::map<std::string, std::shared_ptr<void>> m_connectionHandles;
+    std::shared_ptr<void> m_asyncSessionHandle;
+    std::map<std::string, std::shared_ptr<void>> m_asyncConnectionHandles;
+
+    std::shared_ptr<void> CreateSessionHandle(bool isAsync);
+    std::shared_ptr<void> GetConnectionHandle(Azure::Core::Url const& url, bool isAsync);
     void CreateRequestHandle(std::unique_ptr<_detail::HandleManager>& handleManager);
     void Upload(std::unique_ptr<_detail::HandleManager>& handleManager);
     void SendRequest(std::unique_ptr<_detail::HandleManager>& handleManager);
     void ReceiveResponse(std::unique_ptr<_detail::HandleManager>& handleManager);
-    int64_t GetContentLength(
-        std::unique_ptr<_detail::HandleManager>& handleManager,
-        HttpMethod requestMethod,
-        HttpStatusCode responseStatusCode);
     std::unique_ptr<RawResponse> SendRequestAndGetResponse(
         std::unique_ptr<_detail::HandleManager> handleManager,
         HttpMethod requestMethod);
@@ -173,6 +173,27 @@ namespace Azure { namespace Core { namespace Http {
      * @return A unique pointer to an HTTP RawResponse.
      */
     virtual std::unique_ptr<RawResponse> Send(Request& request, Context const& context) override;
+
+    /**
+     * @brief Sends an HTTP Request without blocking the calling thread.
+     *
+     * @remark The request is driven by the WinHTTP status callbacks of an asynchronous session,
+     * and \p callback is called from a WinHTTP thread when the headers are received, or after the
+     * whole body is downloaded if the request buffers its response. It must not block and must not
+     * read a response body that isn't buffered; the body stream can be moved to another thread to
+     * be read.
+     *
+     * @remark The \p context is checked for cancellation each time WinHTTP completes a step of the
+     * request.
+     *
+     * @param request an HTTP Request to be send. It must be kept alive until \p callback is called.
+     * @param context A context to control the request lifetime.
+     * @param callback Called with the response, or with the error if the request fails.
+     */
+    void SendAsync(
+        Request& request,
+        Context const& context,
+        SendCompletionCallback callback) override;
   };
 
 }}} // namespace Azure::Core::Http
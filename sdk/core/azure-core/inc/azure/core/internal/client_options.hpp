@@ -68,9 +68,15 @@ namespace Azure { namespace Core { namespace _internal {
     ClientOptions& operator=(const ClientOptions& other)
     {
       this->Retry = other.Retry;
+      this->RetryBudget = other.RetryBudget;
       this->Transport = other.Transport;
       this->Telemetry = other.Telemetry;
       this->Log = other.Log;
+      this->Instrumentation = other.Instrumentation;
+      this->Hedging = other.Hedging;
+      this->ConcurrencyLimiter = other.ConcurrencyLimiter;
+      this->RequestCoalescer = other.RequestCoalescer;
+      this->Priority = other.Priority;
       this->PerOperationPolicies.reserve(other.PerOperationPolicies.size());
       for (auto& policy : other.PerOperationPolicies)
       {
@@ -90,6 +96,13 @@ namespace Azure { namespace Core { namespace _internal {
      */
     Azure::Core::Http::Policies::RetryOptions Retry;
 
+    /**
+     * @brief The budget bounding the retries of the requests, shared by the clients whose options
+     * share it. There is no budget by default: each request is retried as #Retry allows.
+     *
+     */
+    std::shared_ptr<Azure::Core::Http::Policies::RetryBudget> RetryBudget;
+
     /**
      * @brief Customized HTTP client. We're going to use the default one if this is empty.
      *
@@ -107,6 +120,42 @@ namespace Azure { namespace Core { namespace _internal {
      *
      */
     Azure::Core::Http::Policies::LogOptions Log;
+
+    /**
+     * @brief Define the tracer and the meter instrumenting the HTTP requests.
+     *
+     */
+    Azure::Core::Http::Policies::InstrumentationOptions Instrumentation;
+
+    /**
+     * @brief Define whether and when to send a copy of the GET and HEAD requests which are slow to
+     * get a response.
+     *
+     */
+    Azure::Core::Http::Policies::HedgingOptions Hedging;
+
+    /**
+     * @brief The limiter adapting the number of concurrent requests to each host to its
+     * throttling, shared by the clients whose options share it. There is no limit by default.
+     *
+     */
+    std::shared_ptr<Azure::Core::Http::Policies::ConcurrencyLimiter> ConcurrencyLimiter;
+
+    /**
+     * @brief The coalescer sending a single request for identical GET requests in flight at the
+     * same time, shared by the clients whose options share it. Requests aren't coalesced by
+     * default.
+     *
+     */
+    std::shared_ptr<Azure::Core::Http::Policies::RequestCoalescer> RequestCoalescer;
+
+    /**
+     * @brief The priority of the requests whose context has none, set by
+     * #Azure::Core::Http::WithRequestPriority. The default value is
+     * #Azure::Core::Http::RequestPriority::Normal.
+     *
+     */
+    Azure::Core::Http::RequestPriority Priority = Azure::Core::Http::RequestPriority::Normal;
   };
 
 }}} // namespace Azure::Core::_internal
@@ -67,6 +67,11 @@ namespace Azure { namespace Core { namespace Cryptography { namespace _internal
     {
       return m_portableImplementation->Append(data, length);
     }
+
+    /**
+     * @brief Brings the SHA256 hash back to the state of a new instance.
+     */
+    void OnReset() override { m_portableImplementation->Reset(); }
   };
 
   /**
@@ -119,6 +124,11 @@ namespace Azure { namespace Core { namespace Cryptography { namespace _internal
     {
       return m_portableImplementation->Append(data, length);
     }
+
+    /**
+     * @brief Brings the SHA384 hash back to the state of a new instance.
+     */
+    void OnReset() override { m_portableImplementation->Reset(); }
   };
 
   /**
@@ -171,6 +181,11 @@ namespace Azure { namespace Core { namespace Cryptography { namespace _internal
     {
       return m_portableImplementation->Append(data, length);
     }
+
+    /**
+     * @brief Brings the SHA512 hash back to the state of a new instance.
+     */
+    void OnReset() override { m_portableImplementation->Reset(); }
   };
 
 }}}} // namespace Azure::Core::Cryptography::_internal
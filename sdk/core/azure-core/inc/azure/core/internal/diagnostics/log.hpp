@@ -7,6 +7,7 @@
 #include "azure/core/dll_import_export.hpp"
 
 #include <atomic>
+#include <string>
 #include <type_traits>
 
 namespace Azure { namespace Core { namespace Diagnostics { namespace _internal {
@@ -19,20 +20,49 @@ namespace Azure { namespace Core { namespace Diagnostics { namespace _internal {
 
     static_assert(ATOMIC_BOOL_LOCK_FREE == 2, "atomic<bool> must be lock-free");
 
+    static AZ_CORE_DLLEXPORT std::atomic<bool> g_isInitialized;
     static AZ_CORE_DLLEXPORT std::atomic<bool> g_isLoggingEnabled;
     static AZ_CORE_DLLEXPORT std::atomic<LogLevelInt> g_logLevel;
 
     Log() = delete;
     ~Log() = delete;
 
+    // Sets the listener and the level from the AZURE_LOG_LEVEL environment variable the first
+    // time it's called, rather than when the library is loaded. Returns true.
+    static bool Initialize();
+
   public:
     static bool ShouldWrite(Logger::Level level)
     {
-      return g_isLoggingEnabled && static_cast<LogLevelInt>(level) >= g_logLevel;
+      return (g_isInitialized.load(std::memory_order_acquire) || Initialize()) && g_isLoggingEnabled
+          && static_cast<LogLevelInt>(level) >= g_logLevel;
     }
 
     static void Write(Logger::Level level, std::string const& message);
 
+    // Checks the level before the message is copied into a string.
+    static void Write(Logger::Level level, char const* message)
+    {
+      if (ShouldWrite(level))
+      {
+        Write(level, std::string(message));
+      }
+    }
+
+    /**
+     * @brief Writes the message returned by \p messageFactory, which is only called when messages
+     * of \p level are written, so that disabled messages cost no formatting.
+     */
+    template <typename MessageFactory>
+    static auto Write(Logger::Level level, MessageFactory const& messageFactory)
+        -> decltype(static_cast<void>(std::string(messageFactory())))
+    {
+      if (ShouldWrite(level))
+      {
+        Write(level, std::string(messageFactory()));
+      }
+    }
+
     static void EnableLogging(bool isEnabled);
     static void SetLogLevel(Logger::Level logLevel);
   };
@@ -31,7 +31,10 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
    */
   class HttpPipeline final {
   protected:
-    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> m_policies;
+    // The policies are immutable once the pipeline is constructed, so that the copies of a
+    // pipeline share them instead of cloning every policy.
+    std::shared_ptr<const std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>>>
+        m_policies;
 
   public:
     /**
@@ -50,11 +53,15 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
         throw std::invalid_argument("policies cannot be empty");
       }
 
-      m_policies.reserve(policies.size());
+      std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> clonedPolicies;
+      clonedPolicies.reserve(policies.size());
       for (auto& policy : policies)
       {
-        m_policies.emplace_back(policy->Clone());
+        clonedPolicies.emplace_back(policy->Clone());
       }
+      m_policies = std::make_shared<
+          const std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>>>(
+          std::move(clonedPolicies));
     }
 
     /**
@@ -78,59 +85,110 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
     {
       auto const& perCallClientPolicies = clientOptions.PerOperationPolicies;
       auto const& perRetryClientPolicies = clientOptions.PerRetryPolicies;
-      // Adding 5 for:
+      // Adding 10 for:
+      // - RequestPriorityPolicy
+      // - RequestCoalescingPolicy
       // - TelemetryPolicy
       // - RequestIdPolicy
       // - RetryPolicy
+      // - HedgingPolicy
+      // - ConcurrencyLimitPolicy
       // - LogPolicy
+      // - InstrumentationPolicy
       // - TransportPolicy
       auto pipelineSize = perCallClientPolicies.size() + perRetryClientPolicies.size()
-          + perRetryPolicies.size() + perCallPolicies.size() + 5;
+          + perRetryPolicies.size() + perCallPolicies.size() + 10;
 
-      m_policies.reserve(pipelineSize);
+      std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+      policies.reserve(pipelineSize);
 
       // service-specific per call policies
       for (auto& policy : perCallPolicies)
       {
-        m_policies.emplace_back(policy->Clone());
+        policies.emplace_back(policy->Clone());
       }
       // client-options per call policies.
       for (auto& policy : perCallClientPolicies)
       {
-        m_policies.emplace_back(policy->Clone());
+        policies.emplace_back(policy->Clone());
+      }
+
+      // request priority, only when the client options set one other than the default
+      if (clientOptions.Priority != Azure::Core::Http::RequestPriority::Normal)
+      {
+        policies.emplace_back(
+            std::make_unique<Azure::Core::Http::Policies::_internal::RequestPriorityPolicy>(
+                clientOptions.Priority));
       }
 
       // Request Id
-      m_policies.emplace_back(
+      policies.emplace_back(
           std::make_unique<Azure::Core::Http::Policies::_internal::RequestIdPolicy>());
       // Telemetry
-      m_policies.emplace_back(
+      policies.emplace_back(
           std::make_unique<Azure::Core::Http::Policies::_internal::TelemetryPolicy>(
               telemetryServiceName, telemetryServiceVersion, clientOptions.Telemetry));
 
       // Retry policy
-      m_policies.emplace_back(std::make_unique<Azure::Core::Http::Policies::_internal::RetryPolicy>(
-          clientOptions.Retry));
+      policies.emplace_back(std::make_unique<Azure::Core::Http::Policies::_internal::RetryPolicy>(
+          clientOptions.Retry, clientOptions.RetryBudget));
+
+      // hedging, only when enabled, so that each try and its copy run the per retry policies
+      if (clientOptions.Hedging.Enabled)
+      {
+        policies.emplace_back(
+            std::make_unique<Azure::Core::Http::Policies::_internal::HedgingPolicy>(
+                clientOptions.Hedging));
+      }
+
+      // concurrency limit, only when a limiter is set, so that each try waits for it
+      if (clientOptions.ConcurrencyLimiter)
+      {
+        policies.emplace_back(
+            std::make_unique<Azure::Core::Http::Policies::_internal::ConcurrencyLimitPolicy>(
+                clientOptions.ConcurrencyLimiter));
+      }
 
       // service-specific per retry policies.
       for (auto& policy : perRetryPolicies)
       {
-        m_policies.emplace_back(policy->Clone());
+        policies.emplace_back(policy->Clone());
       }
       // client options per retry policies.
       for (auto& policy : perRetryClientPolicies)
       {
-        m_policies.emplace_back(policy->Clone());
+        policies.emplace_back(policy->Clone());
+      }
+
+      // request coalescing, only when a coalescer is set, after the authorization is added so
+      // that only the requests of the same principal share a response
+      if (clientOptions.RequestCoalescer)
+      {
+        policies.emplace_back(
+            std::make_unique<Azure::Core::Http::Policies::_internal::RequestCoalescingPolicy>(
+                clientOptions.RequestCoalescer));
       }
 
       // logging - won't update request
-      m_policies.emplace_back(
+      policies.emplace_back(
           std::make_unique<Azure::Core::Http::Policies::_internal::LogPolicy>(clientOptions.Log));
 
+      // instrumentation, only when there is a tracer or a meter
+      if (clientOptions.Instrumentation.Tracer || clientOptions.Instrumentation.Meter)
+      {
+        policies.emplace_back(
+            std::make_unique<Azure::Core::Http::Policies::_internal::InstrumentationPolicy>(
+                clientOptions.Instrumentation));
+      }
+
       // transport
-      m_policies.emplace_back(
+      policies.emplace_back(
           std::make_unique<Azure::Core::Http::Policies::_internal::TransportPolicy>(
               clientOptions.Transport));
+
+      m_policies = std::make_shared<
+          const std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>>>(
+          std::move(policies));
     }
 
     /**
@@ -143,30 +201,25 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
      */
     explicit HttpPipeline(
         std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>>&& policies)
-        : m_policies(std::move(policies))
     {
-      if (m_policies.size() == 0)
+      if (policies.size() == 0)
       {
         throw std::invalid_argument("policies cannot be empty");
       }
+      m_policies = std::make_shared<
+          const std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>>>(
+          std::move(policies));
     }
 
     /**
      * @brief Copy constructor.
      *
-     * @remark \p other is expected to have at least one policy.
+     * @remark The copy shares the policies of \p other, which are never modified.
      *
      * @param other Another instance of #Azure::Core::Http::_internal::HttpPipeline to create a copy
      * of.
      */
-    HttpPipeline(const HttpPipeline& other)
-    {
-      m_policies.reserve(other.m_policies.size());
-      for (auto& policy : other.m_policies)
-      {
-        m_policies.emplace_back(policy->Clone());
-      }
-    }
+    HttpPipeline(const HttpPipeline& other) = default;
 
     /**
      * @brief Start the HTTP pipeline.
@@ -182,8 +235,37 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
     {
       // Accessing position zero is fine because pipeline must be constructed with at least one
       // policy.
-      return m_policies[0]->Send(
-          request, Azure::Core::Http::Policies::NextHttpPolicy(0, m_policies), context);
+      return Azure::Core::Http::Policies::_internal::HttpPolicyObserver::Send(
+          *(*m_policies)[0],
+          request,
+          Azure::Core::Http::Policies::NextHttpPolicy(0, *m_policies),
+          context);
+    }
+
+    /**
+     * @brief Start the HTTP pipeline without waiting for the response.
+     *
+     * @remark The pipeline, \p request and its body stream must be kept alive until \p callback
+     * is called. The calling thread is only blocked by the policies and the transport without an
+     * asynchronous implementation.
+     *
+     * @param request The HTTP request to be processed.
+     * @param context A context to control the request lifetime.
+     * @param callback The function called with the HTTP response after the request has been
+     * processed, or with the error.
+     */
+    void SendAsync(
+        Azure::Core::Http::Request& request,
+        Context const& context,
+        Azure::Core::Http::SendCompletionCallback callback) const
+    {
+      // Accessing position zero is fine because pipeline must be constructed with at least one
+      // policy.
+      (*m_policies)[0]->SendAsync(
+          request,
+          Azure::Core::Http::Policies::NextHttpPolicy(0, *m_policies),
+          context,
+          std::move(callback));
     }
   };
 }}}} // namespace Azure::Core::Http::_internal
@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Forward-only reader of JSON documents.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Json { namespace _internal {
+
+  /**
+   * @brief The type of a JSON token.
+   *
+   */
+  enum class JsonTokenType
+  {
+    None,
+    StartObject,
+    EndObject,
+    StartArray,
+    EndArray,
+    PropertyName,
+    String,
+    Number,
+    True,
+    False,
+    Null,
+  };
+
+  /**
+   * @brief Reads the tokens of a JSON document one after the other, without building a tree of
+   * the document, so that models can be deserialized directly from a response body.
+   *
+   * @remark The reader doesn't copy the document, which must outlive it. An invalid document
+   * throws `std::runtime_error` once the reader reaches the invalid token.
+   */
+  class JsonReader final {
+  private:
+    uint8_t const* m_data;
+    size_t m_size;
+    size_t m_position = 0;
+    // The objects and arrays the current token is in.
+    std::vector<JsonTokenType> m_containers;
+    JsonTokenType m_tokenType = JsonTokenType::None;
+    // The text of the current token, without the quotes of strings.
+    size_t m_tokenStart = 0;
+    size_t m_tokenLength = 0;
+    bool m_tokenHasEscapes = false;
+
+    void SkipWhitespace();
+    void ReadValue();
+    void ReadPropertyName();
+    void ReadStringToken(JsonTokenType tokenType);
+    void ReadLiteral(char const* literal, JsonTokenType tokenType);
+    void ReadNumber();
+    void ReadEndOfContainer(JsonTokenType tokenType);
+    [[noreturn]] void ThrowInvalidJson() const;
+    bool ValueEquals(char const* text, size_t length) const;
+
+  public:
+    /**
+     * @brief Constructs a reader of a JSON document.
+     *
+     * @param data The document, encoded in UTF-8.
+     * @param size The size of the document in bytes.
+     */
+    JsonReader(uint8_t const* data, size_t size) : m_data(data), m_size(size) {}
+
+    /**
+     * @brief Constructs a reader of a JSON document.
+     *
+     * @param json The document, encoded in UTF-8.
+     */
+    explicit JsonReader(std::vector<uint8_t> const& json) : JsonReader(json.data(), json.size())
+    {
+    }
+
+    /**
+     * @brief Moves to the next token.
+     *
+     * @return `false` once the whole document is read; otherwise, `true`.
+     */
+    bool Read();
+
+    /**
+     * @brief Moves to the next property name of an object, from the start of the object or from
+     * the last token of the value of the previous property.
+     *
+     * @return `false` once the end of the object is read; otherwise, `true`.
+     */
+    bool ReadNextProperty();
+
+    /**
+     * @brief Gets the type of the current token.
+     *
+     */
+    JsonTokenType GetTokenType() const noexcept { return m_tokenType; }
+
+    /**
+     * @brief Skips the value of the current property name, or the children of the current start
+     * of object or array, so that the current token is the last token of the value.
+     *
+     */
+    void Skip();
+
+    /**
+     * @brief Gets the unescaped text of the current property name or string.
+     *
+     */
+    std::string GetString() const;
+
+    /**
+     * @brief Checks whether the unescaped text of the current property name or string is \p text,
+     * without copying it when it isn't escaped.
+     *
+     */
+    bool ValueEquals(char const* text) const;
+
+    /**
+     * @brief Checks whether the unescaped text of the current property name or string is \p text,
+     * without copying it when it isn't escaped.
+     *
+     */
+    bool ValueEquals(std::string const& text) const;
+
+    /**
+     * @brief Gets the current number, which must be an integer.
+     *
+     */
+    int64_t GetInt64() const;
+
+    /**
+     * @brief Gets the current `true` or `false` token.
+     *
+     */
+    bool GetBool() const;
+  };
+
+}}}} // namespace Azure::Core::Json::_internal
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <string>
 
 namespace Azure { namespace Core { namespace _internal {
@@ -21,12 +23,54 @@ namespace Azure { namespace Core { namespace _internal {
   {
     struct CaseInsensitiveComparator final
     {
-      bool operator()(const std::string& lhs, const std::string& rhs) const
+      /**
+       * @brief Allows the containers to look up keys by C strings without first copying them into
+       * a `std::string`.
+       */
+      using is_transparent = void;
+
+      bool operator()(const std::string& lhs, const std::string& rhs) const noexcept
+      {
+        return Less(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+      }
+
+      bool operator()(const std::string& lhs, const char* rhs) const noexcept
+      {
+        return Less(lhs.data(), lhs.size(), rhs, std::strlen(rhs));
+      }
+
+      bool operator()(const char* lhs, const std::string& rhs) const noexcept
+      {
+        return Less(lhs, std::strlen(lhs), rhs.data(), rhs.size());
+      }
+
+    private:
+      // Same mapping as the locale invariant ToLower(), kept inline since it runs for every
+      // character compared by each lookup in a header map.
+      static unsigned char LowerAscii(char c) noexcept
+      {
+        auto const symbol = static_cast<unsigned char>(c);
+        return (symbol >= 'A' && symbol <= 'Z') ? static_cast<unsigned char>(symbol + ('a' - 'A'))
+                                                : symbol;
+      }
+
+      static bool Less(
+          const char* lhs,
+          std::size_t lhsLength,
+          const char* rhs,
+          std::size_t rhsLength) noexcept
       {
-        return std::lexicographical_compare(
-            lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char c1, char c2) {
-              return ToLower(c1) < ToLower(c2);
-            });
+        auto const length = (std::min)(lhsLength, rhsLength);
+        for (std::size_t i = 0; i < length; ++i)
+        {
+          auto const l = LowerAscii(lhs[i]);
+          auto const r = LowerAscii(rhs[i]);
+          if (l != r)
+          {
+            return l < r;
+          }
+        }
+        return lhsLength < rhsLength;
       }
     };
 
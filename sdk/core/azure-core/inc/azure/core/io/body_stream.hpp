@@ -15,16 +15,38 @@
 #endif
 
 #include "azure/core/context.hpp"
+#include "azure/core/io/shared_buffer.hpp"
 
 #include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <memory>
+#include <utility>
 #include <vector>
 
+namespace Azure { namespace Core { namespace Http {
+  class CurlSession;
+}}} // namespace Azure::Core::Http
+
 namespace Azure { namespace Core { namespace IO {
 
+  /**
+   * @brief A buffer to read a part of the data of a #Azure::Core::IO::BodyStream into.
+   */
+  struct BufferSegment final
+  {
+    /**
+     * @brief Pointer to a first byte of the buffer.
+     */
+    uint8_t* Data;
+
+    /**
+     * @brief Size of the buffer.
+     */
+    size_t Length;
+  };
+
   /**
    * @brief Used to read data to/from a service.
    */
@@ -43,6 +65,26 @@ namespace Azure { namespace Core { namespace IO {
      */
     virtual size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) = 0;
 
+  protected:
+    /**
+     * @brief Read portion of data without copying it, when the stream holds it in memory.
+     *
+     * @remark The default implementation reads the data into \p scratch with `OnRead`. Derived
+     * classes holding their data in memory override it to point \p data at that memory.
+     *
+     * @param data Set to the first byte of the data read.
+     * @param count Maximum number of bytes to read.
+     * @param scratch A buffer for the data which can't be lent by the stream.
+     * @param context A context to control the request lifetime.
+     *
+     * @return Number of bytes read.
+     */
+    virtual size_t OnReadSpan(
+        uint8_t const*& data,
+        size_t count,
+        std::vector<uint8_t>& scratch,
+        Azure::Core::Context const& context);
+
   public:
     /**
      * @brief Destructs `%BodyStream`.
@@ -106,6 +148,47 @@ namespace Azure { namespace Core { namespace IO {
         size_t count,
         Azure::Core::Context const& context = Azure::Core::Context());
 
+    /**
+     * @brief Read #Azure::Core::IO::BodyStream into several buffers, filling each of them in turn,
+     * until they are all filled, or until the stream is read to end.
+     *
+     * @param segments Pointer to the first of the buffers to read the data into.
+     * @param segmentCount Number of buffers to read the data into.
+     * @param context A context to control the request lifetime.
+     *
+     * @return Number of bytes read into all the buffers.
+     */
+    size_t ReadInto(
+        BufferSegment const* segments,
+        size_t segmentCount,
+        Azure::Core::Context const& context = Azure::Core::Context());
+
+    /**
+     * @brief Read portion of data without copying it, when the stream holds it in memory.
+     * @remark Throws if error/cancelled.
+     *
+     * @remark Streams holding their data in memory, such as #Azure::Core::IO::MemoryBodyStream,
+     * point \p data at it. Other streams read the data into \p scratch, which is grown to \p count
+     * bytes when it's smaller, and point \p data at it. The data is valid until the stream is read
+     * again, rewound or destroyed, or \p scratch is changed.
+     *
+     * @param data Set to the first byte of the data read.
+     * @param count Maximum number of bytes to read.
+     * @param scratch A buffer for the data which can't be lent by the stream.
+     * @param context A context to control the request lifetime.
+     *
+     * @return Number of bytes read.
+     */
+    size_t ReadSpan(
+        uint8_t const*& data,
+        size_t count,
+        std::vector<uint8_t>& scratch,
+        Azure::Core::Context const& context = Azure::Core::Context())
+    {
+      context.ThrowIfCancelled();
+      return OnReadSpan(data, count, scratch, context);
+    };
+
     /**
      * @brief Read #Azure::Core::IO::BodyStream until the stream is read to end, allocating memory
      * for the entirety of contents.
@@ -115,19 +198,43 @@ namespace Azure { namespace Core { namespace IO {
      * @return A vector of bytes containing the entirety of data read from the \p body.
      */
     std::vector<uint8_t> ReadToEnd(Azure::Core::Context const& context = Azure::Core::Context());
+
+    /**
+     * @brief Read #Azure::Core::IO::BodyStream until the stream is read to end, into \p buffer.
+     *
+     * @remark The content of \p buffer is replaced, its capacity is reused. When the length of
+     * the stream is known, the buffer is sized for it before reading.
+     *
+     * @param buffer The vector of bytes to read the entirety of data into.
+     * @param context A context to control the request lifetime.
+     */
+    void ReadToEnd(
+        std::vector<uint8_t>& buffer,
+        Azure::Core::Context const& context = Azure::Core::Context());
   };
 
   /**
    * @brief #Azure::Core::IO::BodyStream providing data from an initialized memory buffer.
    */
   class MemoryBodyStream final : public BodyStream {
+    // Sends the buffer to the wire without copying it to an upload chunk first.
+    friend class Azure::Core::Http::CurlSession;
+
   private:
     const uint8_t* m_data;
     size_t m_length;
     size_t m_offset = 0;
+    // Keeps the bytes alive when the stream was constructed from a shared buffer.
+    SharedBuffer m_buffer;
 
     size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
 
+    size_t OnReadSpan(
+        uint8_t const*& data,
+        size_t count,
+        std::vector<uint8_t>& scratch,
+        Azure::Core::Context const& context) override;
+
   public:
     // Forbid constructor for rval so we don't end up storing dangling ptr
     MemoryBodyStream(std::vector<uint8_t> const&&) = delete;
@@ -154,6 +261,19 @@ namespace Azure { namespace Core { namespace IO {
       AZURE_ASSERT(data || length == 0);
     }
 
+    /**
+     * @brief Construct using a shared buffer, which the stream keeps alive.
+     *
+     * @remark The stream can outlive the owners of the bytes it was constructed from, and copies
+     * of it share the bytes instead of copying them.
+     *
+     * @param buffer Shared buffer with the contents to provide the data from to the readers.
+     */
+    explicit MemoryBodyStream(SharedBuffer buffer)
+        : m_data(buffer.GetData()), m_length(buffer.GetSize()), m_buffer(std::move(buffer))
+    {
+    }
+
     int64_t Length() const override { return this->m_length; }
 
     void Rewind() override { m_offset = 0; }
@@ -176,9 +296,13 @@ namespace Azure { namespace Core { namespace IO {
       int64_t m_length;
       // mutable
       int64_t m_offset;
+      // The end of the range the OS was asked to read ahead.
+      int64_t m_readAheadEnd = 0;
 
       size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
 
+      void ReadAhead();
+
     public:
 #if defined(AZ_PLATFORM_POSIX)
       /**
@@ -232,7 +356,11 @@ namespace Azure { namespace Core { namespace IO {
 #endif
 
       // Rewind seeks back to 0
-      void Rewind() override { this->m_offset = 0; }
+      void Rewind() override
+      {
+        this->m_offset = 0;
+        this->m_readAheadEnd = 0;
+      }
 
       int64_t Length() const override { return this->m_length; };
     };
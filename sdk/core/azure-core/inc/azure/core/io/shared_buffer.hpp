@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief An immutable buffer of bytes shared by its copies and slices.
+ */
+
+#pragma once
+
+#include "azure/core/azure_assert.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Azure { namespace Core { namespace IO {
+
+  /**
+   * @brief An immutable buffer of bytes, shared by its copies and slices.
+   *
+   * @remark The bytes are released along with the last copy or slice referring to them, so a
+   * `%SharedBuffer` can be kept by a request sent on another thread, and copied or sliced for
+   * retries and chunks, without copying the bytes.
+   */
+  class SharedBuffer final {
+  private:
+    std::shared_ptr<void const> m_owner;
+    uint8_t const* m_data = nullptr;
+    size_t m_size = 0;
+
+  public:
+    /**
+     * @brief Constructs an empty `%SharedBuffer`.
+     */
+    SharedBuffer() = default;
+
+    /**
+     * @brief Constructs `%SharedBuffer` taking the ownership of a vector of bytes.
+     *
+     * @param buffer Vector of bytes with the contents of the buffer.
+     */
+    explicit SharedBuffer(std::vector<uint8_t> buffer)
+    {
+      auto owner = std::make_shared<std::vector<uint8_t> const>(std::move(buffer));
+      m_data = owner->data();
+      m_size = owner->size();
+      m_owner = std::move(owner);
+    }
+
+    /**
+     * @brief Constructs `%SharedBuffer` taking the ownership of a string.
+     *
+     * @param buffer String with the contents of the buffer.
+     */
+    explicit SharedBuffer(std::string buffer)
+    {
+      auto owner = std::make_shared<std::string const>(std::move(buffer));
+      m_data = reinterpret_cast<uint8_t const*>(owner->data());
+      m_size = owner->size();
+      m_owner = std::move(owner);
+    }
+
+    /**
+     * @brief Gets a pointer to the first byte of the buffer.
+     */
+    uint8_t const* GetData() const { return m_data; }
+
+    /**
+     * @brief Gets the size of the buffer.
+     */
+    size_t GetSize() const { return m_size; }
+
+    /**
+     * @brief Gets a part of the buffer, which shares its bytes.
+     *
+     * @param offset The offset of the first byte of the part in the buffer.
+     * @param length The size of the part.
+     *
+     * @return A `%SharedBuffer` with the bytes from \p offset to \p offset + \p length.
+     */
+    SharedBuffer Slice(size_t offset, size_t length) const
+    {
+      AZURE_ASSERT(offset <= m_size && length <= m_size - offset);
+
+      SharedBuffer slice(*this);
+      slice.m_data = m_data + offset;
+      slice.m_size = length;
+      return slice;
+    }
+  };
+
+}}} // namespace Azure::Core::IO
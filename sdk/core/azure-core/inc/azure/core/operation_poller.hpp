@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Polls many long-running operations with a few threads.
+ */
+
+#pragma once
+
+#include "azure/core/context.hpp"
+#include "azure/core/http/raw_response.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Azure { namespace Core {
+
+  namespace _detail {
+    /**
+     * @brief An operation tracked by an #Azure::Core::OperationPoller, whatever its result type.
+     */
+    class PolledOperation {
+    public:
+      virtual ~PolledOperation() = default;
+
+      /**
+       * @brief Gets updated status of the operation.
+       *
+       * @return The HTTP response of the poll.
+       */
+      virtual Http::RawResponse const& Poll() = 0;
+
+      /**
+       * @brief Checks if the operation is completed.
+       */
+      virtual bool IsDone() const = 0;
+
+      /**
+       * @brief Completes the future of the operation with the operation.
+       */
+      virtual void Complete() = 0;
+
+      /**
+       * @brief Completes the future of the operation with an exception.
+       */
+      virtual void Fail(std::exception_ptr error) = 0;
+
+      /**
+       * @brief The delay before the next poll.
+       */
+      std::chrono::milliseconds Interval{0};
+    };
+
+    template <class TOperation> class TypedPolledOperation final : public PolledOperation {
+    public:
+      explicit TypedPolledOperation(TOperation operation, Context const& context)
+          : m_operation(std::move(operation)), m_context(context)
+      {
+      }
+
+      std::future<TOperation> GetFuture() { return m_promise.get_future(); }
+
+      Http::RawResponse const& Poll() override { return m_operation.Poll(m_context); }
+
+      bool IsDone() const override { return m_operation.IsDone(); }
+
+      void Complete() override { m_promise.set_value(std::move(m_operation)); }
+
+      void Fail(std::exception_ptr error) override { m_promise.set_exception(error); }
+
+    private:
+      TOperation m_operation;
+      Context m_context;
+      std::promise<TOperation> m_promise;
+    };
+  } // namespace _detail
+
+  /**
+   * @brief Optional parameters for #Azure::Core::OperationPoller.
+   */
+  struct OperationPollerOptions final
+  {
+    /**
+     * @brief The delay before the first poll of an operation. It doubles every time the operation
+     * is found running, up to `MaxInterval`.
+     */
+    std::chrono::milliseconds InitialInterval = std::chrono::seconds(1);
+
+    /**
+     * @brief The longest delay between two polls of an operation, unless the service asks for a
+     * longer one.
+     */
+    std::chrono::milliseconds MaxInterval = std::chrono::seconds(30);
+
+    /**
+     * @brief The number of threads polling the operations, which is the maximum number of polls
+     * in progress at the same time.
+     */
+    int32_t MaxConcurrentPolls = 4;
+  };
+
+  /**
+   * @brief Polls many long-running operations until they complete, and completes a future per
+   * operation as it does.
+   *
+   * @remark Unlike #Azure::Core::Operation::PollUntilDone, which blocks a thread per operation,
+   * the operations share `MaxConcurrentPolls` threads polling the operation due first. The delay
+   * between two polls of an operation backs off from `InitialInterval` to `MaxInterval`, unless
+   * the response of the last poll has a `Retry-After` header, whose delay is waited instead.
+   */
+  class OperationPoller final {
+  public:
+    /**
+     * @brief Constructs `%OperationPoller`, which starts the threads polling the operations.
+     *
+     * @param options Optional parameters of the poller.
+     */
+    explicit OperationPoller(OperationPollerOptions const& options = OperationPollerOptions());
+
+    /**
+     * @brief Stops polling, see #Stop.
+     */
+    ~OperationPoller();
+
+    OperationPoller(OperationPoller const&) = delete;
+    OperationPoller& operator=(OperationPoller const&) = delete;
+
+    /**
+     * @brief Starts polling a long-running operation. Can be called from several threads at the
+     * same time.
+     *
+     * @param operation The operation, started by a client.
+     * @param context A context to control the requests polling the operation.
+     *
+     * @return A future completed with the operation once it's done, whether it succeeded or not,
+     * or with the exception a poll of the operation failed with.
+     */
+    template <class TOperation>
+    std::future<TOperation> Add(
+        TOperation operation,
+        Context const& context = Context::ApplicationContext)
+    {
+      auto polledOperation = std::make_unique<_detail::TypedPolledOperation<TOperation>>(
+          std::move(operation), context);
+      auto future = polledOperation->GetFuture();
+      AddPolledOperation(std::move(polledOperation));
+      return future;
+    }
+
+    /**
+     * @brief Stops polling, and waits for the polls in progress. The futures of the operations
+     * not completed yet get an #Azure::Core::OperationCancelledException.
+     */
+    void Stop();
+
+  private:
+    void AddPolledOperation(std::unique_ptr<_detail::PolledOperation> operation);
+    void RunPolls();
+
+    OperationPollerOptions m_options;
+
+    // Guards the variables below.
+    std::mutex m_mutex;
+    std::condition_variable m_stateChanged;
+    // The operations waiting for their next poll, by the time it's due.
+    std::multimap<std::chrono::steady_clock::time_point, std::unique_ptr<_detail::PolledOperation>>
+        m_operations;
+    bool m_stopping = false;
+
+    std::vector<std::thread> m_pollThreads;
+  };
+
+}} // namespace Azure::Core
@@ -8,8 +8,15 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 
 #include "azure/core/context.hpp"
 #include "azure/core/http/raw_response.hpp"
@@ -34,6 +41,48 @@ namespace Azure { namespace Core {
     // `m_hasPage` is then turned to `false` once `MoveToNextPage` is called on the last page.
     bool m_hasPage = true;
 
+    // The pages fetched ahead by #Prefetch(), shared with the thread fetching them.
+    struct PrefetchState final
+    {
+      std::mutex Mutex;
+      std::condition_variable Changed;
+      std::deque<T> Pages;
+      std::exception_ptr Error;
+      size_t MaxPages;
+      bool IsDone = false;
+      bool IsStopped = false;
+    };
+
+    // Null when the pages aren't prefetched.
+    std::shared_ptr<PrefetchState> m_prefetchState;
+
+    void StopPrefetch()
+    {
+      if (m_prefetchState)
+      {
+        std::lock_guard<std::mutex> lock(m_prefetchState->Mutex);
+        m_prefetchState->IsStopped = true;
+        m_prefetchState->Changed.notify_all();
+      }
+      m_prefetchState.reset();
+    }
+
+    static std::unique_ptr<Azure::Core::Http::RawResponse> CopyRawResponse(
+        Azure::Core::Http::RawResponse const* rawResponse)
+    {
+      if (rawResponse == nullptr)
+      {
+        return nullptr;
+      }
+      // The copy constructor of RawResponse copies the body but not the headers.
+      auto copy = std::make_unique<Azure::Core::Http::RawResponse>(*rawResponse);
+      for (auto const& header : rawResponse->GetHeaders())
+      {
+        copy->SetHeader(header.first, header.second);
+      }
+      return copy;
+    }
+
   protected:
     /**
      * @brief Constructs a default instance of `%PagedResponse`.
@@ -48,17 +97,41 @@ namespace Azure { namespace Core {
     PagedResponse(PagedResponse&&) = default;
 
     /**
-     * @brief Assigns another instance of `%PagedResponse` by moving it in.
+     * @brief Assigns another instance of `%PagedResponse` by moving it in. The pages prefetched
+     * for this instance are dropped.
      *
      */
-    PagedResponse& operator=(PagedResponse&&) = default;
+    PagedResponse& operator=(PagedResponse&& other)
+    {
+      if (this != &other)
+      {
+        StopPrefetch();
+        m_hasPage = other.m_hasPage;
+        m_prefetchState = std::move(other.m_prefetchState);
+        CurrentPageToken = std::move(other.CurrentPageToken);
+        NextPageToken = std::move(other.NextPageToken);
+        RawResponse = std::move(other.RawResponse);
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Constructs `%PagedResponse` by copying another instance, to fetch the pages after it.
+     * The HTTP response is copied without its body stream, the prefetched pages aren't.
+     *
+     */
+    PagedResponse(PagedResponse const& other)
+        : m_hasPage(other.m_hasPage), CurrentPageToken(other.CurrentPageToken),
+          NextPageToken(other.NextPageToken), RawResponse(CopyRawResponse(other.RawResponse.get()))
+    {
+    }
 
   public:
     /**
      * @brief Destructs `%PagedResponse`.
      *
      */
-    virtual ~PagedResponse() = default;
+    virtual ~PagedResponse() { StopPrefetch(); }
 
     /**
      * @brief The token used to fetch the current page.
@@ -111,10 +184,115 @@ namespace Azure { namespace Core {
         return;
       }
 
+      if (m_prefetchState)
+      {
+        auto prefetchState = std::move(m_prefetchState);
+        std::unique_lock<std::mutex> lock(prefetchState->Mutex);
+        prefetchState->Changed.wait(lock, [&]() {
+          return !prefetchState->Pages.empty() || prefetchState->Error || prefetchState->IsDone;
+        });
+        if (!prefetchState->Pages.empty())
+        {
+          T page = std::move(prefetchState->Pages.front());
+          prefetchState->Pages.pop_front();
+          prefetchState->Changed.notify_all();
+          lock.unlock();
+          *static_cast<T*>(this) = std::move(page);
+          m_prefetchState = std::move(prefetchState);
+          return;
+        }
+
+        // The current page is unchanged after the error of the prefetch. The next pages are
+        // fetched when moving to them from now on.
+        auto const error = prefetchState->Error;
+        prefetchState->IsStopped = true;
+        prefetchState->Changed.notify_all();
+        if (error)
+        {
+          std::rethrow_exception(error);
+        }
+      }
+
       // Developer must make sure current page is kept unchanged if OnNextPage()
       // throws exception.
       static_cast<T*>(this)->OnNextPage(context);
     }
+
+    /**
+     * @brief Starts fetching the next pages in the background, so that #MoveToNextPage() doesn't
+     * wait for the service when the pages are consumed more slowly than they are fetched.
+     *
+     * @note The pages are fetched one at a time, with up to \p maxPages pages fetched ahead of the
+     * current page. The error of a prefetch is thrown by the #MoveToNextPage() call moving to the
+     * page it failed to fetch, after which the pages are fetched when moving to them.
+     *
+     * @remark T classes must be copyable to fetch the pages after the current one without
+     * changing it. Prefetching stops when the response is destroyed.
+     *
+     * @param maxPages The maximum number of pages fetched ahead. Zero stops prefetching.
+     * @param context A context to control the lifetime of the requests fetching the pages.
+     */
+    void Prefetch(size_t maxPages, const Azure::Core::Context& context = Azure::Core::Context())
+    {
+      StopPrefetch();
+      if (maxPages == 0 || !NextPageToken.HasValue() || NextPageToken.Value().empty())
+      {
+        return;
+      }
+
+      auto prefetchState = std::make_shared<PrefetchState>();
+      prefetchState->MaxPages = maxPages;
+      // A copy of the current page, moved to the next pages by the thread.
+      T cursor(*static_cast<T const*>(this));
+      std::thread([prefetchState, cursor = std::move(cursor), context]() mutable {
+        while (true)
+        {
+          {
+            std::unique_lock<std::mutex> lock(prefetchState->Mutex);
+            prefetchState->Changed.wait(lock, [&]() {
+              return prefetchState->IsStopped
+                  || prefetchState->Pages.size() < prefetchState->MaxPages;
+            });
+            if (prefetchState->IsStopped)
+            {
+              return;
+            }
+          }
+
+          std::exception_ptr error;
+          bool isDone = false;
+          try
+          {
+            cursor.MoveToNextPage(context);
+            isDone = !cursor.NextPageToken.HasValue() || cursor.NextPageToken.Value().empty();
+          }
+          catch (...)
+          {
+            error = std::current_exception();
+          }
+
+          std::lock_guard<std::mutex> lock(prefetchState->Mutex);
+          if (error)
+          {
+            prefetchState->Error = error;
+            prefetchState->Changed.notify_all();
+            return;
+          }
+          // The thread keeps a copy of the page, without its response, to fetch the page after it.
+          auto rawResponse = std::move(cursor.RawResponse);
+          T page(cursor);
+          page.RawResponse = std::move(rawResponse);
+          prefetchState->Pages.push_back(std::move(page));
+          prefetchState->IsDone = isDone;
+          prefetchState->Changed.notify_all();
+          if (isDone)
+          {
+            return;
+          }
+        }
+      }).detach();
+      m_prefetchState = std::move(prefetchState);
+    }
   };
 
 }} // namespace Azure::Core
@@ -21,23 +21,60 @@ namespace Azure { namespace Core {
     inline std::string FormatEncodedUrlQueryParameters(
         std::map<std::string, std::string> const& encodedQueryParameters)
     {
+      size_t length = 0;
+      for (const auto& q : encodedQueryParameters)
       {
-        std::string queryStr;
-        if (!encodedQueryParameters.empty())
-        {
-          auto separator = '?';
-          for (const auto& q : encodedQueryParameters)
-          {
-            queryStr += separator + q.first + '=' + q.second;
-            separator = '&';
-          }
-        }
-
-        return queryStr;
+        length += q.first.size() + q.second.size() + 2;
       }
+
+      std::string queryStr;
+      queryStr.reserve(length);
+      auto separator = '?';
+      for (const auto& q : encodedQueryParameters)
+      {
+        queryStr += separator;
+        queryStr += q.first;
+        queryStr += '=';
+        queryStr += q.second;
+        separator = '&';
+      }
+
+      return queryStr;
     }
   } // namespace _detail
 
+  namespace _internal {
+    /**
+     * @brief Percent-encodes strings, leaving as they are the unreserved characters and the
+     * symbols it was constructed with.
+     *
+     * @remark Constructing one encoder for each set of symbols, instead of passing the symbols to
+     * #Azure::Core::Url::Encode for each string, classifies the characters only once.
+     */
+    class UrlEncoder final {
+    private:
+      bool m_doNotEncode[256];
+
+    public:
+      /**
+       * @brief Constructs an encoder.
+       *
+       * @param doNotEncodeSymbols Symbols which are not encoded in addition to the unreserved
+       * characters.
+       */
+      explicit UrlEncoder(const std::string& doNotEncodeSymbols = "");
+
+      /**
+       * @brief Encodes a string.
+       *
+       * @param value The string to encode.
+       *
+       * @return The encoded string.
+       */
+      std::string Encode(const std::string& value) const;
+    };
+  } // namespace _internal
+
   /**
    * @brief Represents the location where a request will be performed.
    *
@@ -53,11 +90,8 @@ namespace Azure { namespace Core {
     // query parameters are all encoded
     std::map<std::string, std::string> m_encodedQueryParameters;
 
-    // List of default non-URL-encode chars. While URL encoding a string, do not escape any chars in
-    // this set.
-    const static std::unordered_set<unsigned char> defaultNonUrlEncodeChars;
-
-    std::string GetUrlWithoutQuery(bool relative) const;
+    // Formats the URL into a single string sized up front.
+    std::string FormatUrl(bool relative) const;
 
     /**
      * @brief Finds the first '?' symbol and parses everything after it as query parameters.
@@ -214,13 +248,13 @@ namespace Azure { namespace Core {
     uint16_t GetPort() const { return m_port; }
 
     /**
-     * @brief Gets a copy of the list of query parameters from the URL.
+     * @brief Gets the list of query parameters from the URL.
      *
      * @note The query parameters are URL-encoded.
      *
-     * @return A copy of the query parameters map.
+     * @return A reference to the query parameters map, valid for the lifetime of the URL.
      */
-    std::map<std::string, std::string> GetQueryParameters() const
+    std::map<std::string, std::string> const& GetQueryParameters() const
     {
       return m_encodedQueryParameters;
     }
@@ -4,93 +4,502 @@
 #include "azure/core/base64.hpp"
 #include "azure/core/platform.hpp"
 
-#if defined(AZ_PLATFORM_WINDOWS)
-#include <windows.h>
-#elif defined(AZ_PLATFORM_POSIX)
-#include <openssl/bio.h>
-#include <openssl/buffer.h>
-#include <openssl/evp.h>
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(_M_ARM64EC)
+#define AZ_CORE_BASE64_AVX2
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#define AZ_CORE_BASE64_AVX2_TARGET
+#else
+#include <immintrin.h>
+#define AZ_CORE_BASE64_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define AZ_CORE_BASE64_NEON
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
 #endif
 
+#include <array>
+#include <cstring>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
-namespace Azure { namespace Core {
+namespace {
 
-#if defined(AZ_PLATFORM_WINDOWS)
+enum class Base64Alphabet
+{
+  Standard,
+  Url,
+};
 
-  std::string Convert::Base64Encode(const std::vector<uint8_t>& data)
+constexpr char StandardAlphabet[]
+    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr char UrlAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+constexpr uint8_t InvalidSextet = 0xFF;
+
+// The sextet of each character, InvalidSextet for the characters outside of the alphabet.
+using DecodeTable = std::array<uint8_t, 256>;
+
+DecodeTable MakeDecodeTable(const char* alphabet)
+{
+  DecodeTable table;
+  table.fill(InvalidSextet);
+  for (uint8_t i = 0; i < 64; ++i)
   {
-    std::string encoded;
-    // According to RFC 4648, the encoded length should be ceiling(n / 3) * 4
-    DWORD encodedLength = static_cast<DWORD>((data.size() + 2) / 3 * 4);
-    encoded.resize(encodedLength);
+    table[static_cast<uint8_t>(alphabet[i])] = i;
+  }
+  return table;
+}
 
-    CryptBinaryToStringA(
-        reinterpret_cast<const BYTE*>(data.data()),
-        static_cast<DWORD>(data.size()),
-        CRYPT_STRING_BASE64 | CRYPT_STRING_NOCRLF,
-        static_cast<LPSTR>(&encoded[0]),
-        &encodedLength);
+const char* GetAlphabet(Base64Alphabet alphabet)
+{
+  return alphabet == Base64Alphabet::Standard ? StandardAlphabet : UrlAlphabet;
+}
 
-    return encoded;
+const uint8_t* GetDecodeTable(Base64Alphabet alphabet)
+{
+  static const DecodeTable StandardDecodeTable = MakeDecodeTable(StandardAlphabet);
+  static const DecodeTable UrlDecodeTable = MakeDecodeTable(UrlAlphabet);
+  return alphabet == Base64Alphabet::Standard ? StandardDecodeTable.data()
+                                              : UrlDecodeTable.data();
+}
+
+/*
+ * The vectorized codecs handle whole blocks and leave the rest of the data to the scalar ones,
+ * which also report the invalid characters: a decoded block containing any stops the vectorized
+ * loop.
+ *
+ * They take the pointers and lengths by reference, and advance them past the blocks handled.
+ */
+#if defined(AZ_CORE_BASE64_AVX2)
+bool IsAvx2Supported()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 1);
+  // The OS must save the YMM registers.
+  if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 6) != 6)
+  {
+    return false;
   }
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else
+  return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
 
-  std::vector<uint8_t> Convert::Base64Decode(const std::string& text)
+/*
+ * Based on "Faster Base64 Encoding and Decoding Using AVX2 Instructions" by W. Mula and D.
+ * Lemire. Each 128-bit lane encodes 12 bytes into 16 characters.
+ */
+AZ_CORE_BASE64_AVX2_TARGET void EncodeBlocks(
+    const uint8_t*& data,
+    size_t& length,
+    char*& output,
+    Base64Alphabet alphabet)
+{
+  // The bytes b0 b1 b2 of each group go to a 32-bit word as b1 b0 b2 b1.
+  const __m256i spread = _mm256_setr_epi8(
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10,
+      9, 11, 10);
+  // Added to the sextets to get their characters, indexed by the translation below.
+  const __m256i offsets = alphabet == Base64Alphabet::Standard
+      ? _mm256_setr_epi8(
+          'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+          '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0, 'a' - 26, '0' - 52,
+          '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+          '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0)
+      : _mm256_setr_epi8(
+          'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+          '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0, 'a' - 26, '0' - 52,
+          '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+          '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0);
+
+  // The second lane reads 16 bytes from the 12th one.
+  while (length >= 28)
   {
-    std::vector<uint8_t> decoded;
-    // According to RFC 4648, the encoded length should be ceiling(n / 3) * 4, so we can infer an
-    // upper bound here
-    DWORD decodedLength = DWORD(text.length() / 4 * 3);
-    decoded.resize(decodedLength);
-
-    CryptStringToBinaryA(
-        text.data(),
-        static_cast<DWORD>(text.length()),
-        CRYPT_STRING_BASE64 | CRYPT_STRING_STRICT,
-        reinterpret_cast<BYTE*>(decoded.data()),
-        &decodedLength,
-        nullptr,
-        nullptr);
-    decoded.resize(decodedLength);
-    return decoded;
+    __m256i input = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 12)),
+        1);
+    input = _mm256_shuffle_epi8(input, spread);
+
+    const __m256i sextets0and2 = _mm256_mulhi_epu16(
+        _mm256_and_si256(input, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+    const __m256i sextets1and3 = _mm256_mullo_epi16(
+        _mm256_and_si256(input, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+    const __m256i sextets = _mm256_or_si256(sextets0and2, sextets1and3);
+
+    // 0 for a-z, 1 to 10 for 0-9, 11 and 12 for the last two characters, 13 for A-Z.
+    __m256i translation = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+    translation = _mm256_or_si256(
+        translation,
+        _mm256_and_si256(
+            _mm256_cmpgt_epi8(_mm256_set1_epi8(26), sextets), _mm256_set1_epi8(13)));
+    const __m256i characters
+        = _mm256_add_epi8(_mm256_shuffle_epi8(offsets, translation), sextets);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), characters);
+    data += 24;
+    length -= 24;
+    output += 32;
   }
+}
 
-#elif defined(AZ_PLATFORM_POSIX)
+AZ_CORE_BASE64_AVX2_TARGET inline __m256i
+InRange(__m256i characters, char first, char last)
+{
+  return _mm256_and_si256(
+      _mm256_cmpgt_epi8(characters, _mm256_set1_epi8(static_cast<char>(first - 1))),
+      _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(last + 1)), characters));
+}
 
-  std::string Convert::Base64Encode(const std::vector<uint8_t>& data)
+AZ_CORE_BASE64_AVX2_TARGET void DecodeBlocks(
+    const char*& text,
+    size_t& length,
+    uint8_t*& output,
+    Base64Alphabet alphabet)
+{
+  const char char62 = alphabet == Base64Alphabet::Standard ? '+' : '-';
+  const char char63 = alphabet == Base64Alphabet::Standard ? '/' : '_';
+  // The 3 bytes packed from the sextets of each 32-bit word, moved to the first 12 bytes of each
+  // lane, then to the first 24 bytes.
+  const __m256i gather = _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13,
+      12, -1, -1, -1, -1);
+  const __m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+  while (length >= 32)
   {
-    BIO* bio = BIO_new(BIO_s_mem());
-    bio = BIO_push(BIO_new(BIO_f_base64()), bio);
-    BIO_set_flags(bio, BIO_FLAGS_BASE64_NO_NL);
-    BIO_write(bio, data.data(), static_cast<int>(data.size()));
-    BIO_flush(bio);
-    BUF_MEM* bufferPtr;
-    BIO_get_mem_ptr(bio, &bufferPtr);
-    std::string toReturn(bufferPtr->data, bufferPtr->length);
-    BIO_free_all(bio);
+    // The characters past 0x7F are negative, and outside of all the ranges.
+    const __m256i characters = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text));
+    const __m256i upper = InRange(characters, 'A', 'Z');
+    const __m256i lower = InRange(characters, 'a', 'z');
+    const __m256i digit = InRange(characters, '0', '9');
+    const __m256i is62 = _mm256_cmpeq_epi8(characters, _mm256_set1_epi8(char62));
+    const __m256i is63 = _mm256_cmpeq_epi8(characters, _mm256_set1_epi8(char63));
+    const __m256i valid = _mm256_or_si256(
+        _mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, is62)), is63);
+    if (_mm256_movemask_epi8(valid) != -1)
+    {
+      break;
+    }
 
-    return toReturn;
+    __m256i offset = _mm256_and_si256(upper, _mm256_set1_epi8(-'A'));
+    offset = _mm256_or_si256(offset, _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a')));
+    offset = _mm256_or_si256(offset, _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+    offset = _mm256_or_si256(
+        offset, _mm256_and_si256(is62, _mm256_set1_epi8(static_cast<char>(62 - char62))));
+    offset = _mm256_or_si256(
+        offset, _mm256_and_si256(is63, _mm256_set1_epi8(static_cast<char>(63 - char63))));
+    const __m256i sextets = _mm256_add_epi8(characters, offset);
+
+    // s0 s1 s2 s3 to s0 << 6 | s1 and s2 << 6 | s3, then to s0 << 18 | s1 << 12 | s2 << 6 | s3.
+    const __m256i pairs = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+    const __m256i words = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    const __m256i bytes
+        = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(words, gather), compact);
+
+    // Only 24 of the 32 bytes stored are decoded, the output has room for the other 8 unless
+    // fewer than 44 characters are left. The bytes stored end before the next characters, so that
+    // the text can be decoded in place.
+    if (length >= 44)
+    {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), bytes);
+    }
+    else
+    {
+      uint8_t decoded[32];
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(decoded), bytes);
+      std::memcpy(output, decoded, 24);
+    }
+    text += 32;
+    length -= 32;
+    output += 24;
   }
+}
+#elif defined(AZ_CORE_BASE64_NEON)
+inline uint8x16x4_t LoadTable(const uint8_t* table)
+{
+  uint8x16x4_t result;
+  result.val[0] = vld1q_u8(table);
+  result.val[1] = vld1q_u8(table + 16);
+  result.val[2] = vld1q_u8(table + 32);
+  result.val[3] = vld1q_u8(table + 48);
+  return result;
+}
 
-  std::vector<uint8_t> Convert::Base64Decode(const std::string& text)
+// The loads and stores of 3 and 4 interleaved registers split the bytes and the characters of
+// each group, so 48 bytes are encoded into 64 characters with a table lookup.
+void EncodeBlocks(const uint8_t*& data, size_t& length, char*& output, Base64Alphabet alphabet)
+{
+  const uint8x16x4_t characters
+      = LoadTable(reinterpret_cast<const uint8_t*>(GetAlphabet(alphabet)));
+  const uint8x16_t mask = vdupq_n_u8(0x3F);
+
+  while (length >= 48)
   {
-    std::vector<uint8_t> decoded;
-    // According to RFC 4648, the encoded length should be ceiling(n / 3) * 4, so we can infer an
-    // upper bound here
-    size_t maxDecodedLength = text.length() / 4 * 3;
-    decoded.resize(maxDecodedLength);
+    const uint8x16x3_t input = vld3q_u8(data);
+    uint8x16x4_t sextets;
+    sextets.val[0] = vshrq_n_u8(input.val[0], 2);
+    sextets.val[1]
+        = vandq_u8(vorrq_u8(vshlq_n_u8(input.val[0], 4), vshrq_n_u8(input.val[1], 4)), mask);
+    sextets.val[2]
+        = vandq_u8(vorrq_u8(vshlq_n_u8(input.val[1], 2), vshrq_n_u8(input.val[2], 6)), mask);
+    sextets.val[3] = vandq_u8(input.val[2], mask);
+
+    uint8x16x4_t encoded;
+    for (int i = 0; i < 4; ++i)
+    {
+      encoded.val[i] = vqtbl4q_u8(characters, sextets.val[i]);
+    }
+    vst4q_u8(reinterpret_cast<uint8_t*>(output), encoded);
+    data += 48;
+    length -= 48;
+    output += 64;
+  }
+}
 
-    BIO* bio = BIO_new_mem_buf(text.data(), -1);
-    bio = BIO_push(BIO_new(BIO_f_base64()), bio);
-    BIO_set_flags(bio, BIO_FLAGS_BASE64_NO_NL);
-    int decodedLength = BIO_read(bio, &decoded[0], static_cast<int>(text.length()));
-    BIO_free_all(bio);
+void DecodeBlocks(const char*& text, size_t& length, uint8_t*& output, Base64Alphabet alphabet)
+{
+  const uint8_t* decodeTable = GetDecodeTable(alphabet);
+  const uint8x16x4_t lowTable = LoadTable(decodeTable);
+  const uint8x16x4_t highTable = LoadTable(decodeTable + 64);
 
-    decoded.resize(decodedLength);
-    return decoded;
+  while (length >= 64)
+  {
+    const uint8x16x4_t characters = vld4q_u8(reinterpret_cast<const uint8_t*>(text));
+    uint8x16x4_t sextets;
+    uint8x16_t invalid = vdupq_n_u8(0);
+    for (int i = 0; i < 4; ++i)
+    {
+      // The characters up to 0x3F are found in the low table, from 0x40 to 0x7F in the high
+      // one, and the ones past 0x7F in neither.
+      sextets.val[i] = vqtbx4q_u8(
+          vqtbl4q_u8(lowTable, characters.val[i]),
+          highTable,
+          veorq_u8(characters.val[i], vdupq_n_u8(0x40)));
+      invalid = vorrq_u8(
+          invalid, vorrq_u8(sextets.val[i], vandq_u8(characters.val[i], vdupq_n_u8(0x80))));
+    }
+    if (vmaxvq_u8(invalid) > 0x3F)
+    {
+      break;
+    }
+
+    uint8x16x3_t decoded;
+    decoded.val[0] = vorrq_u8(vshlq_n_u8(sextets.val[0], 2), vshrq_n_u8(sextets.val[1], 4));
+    decoded.val[1] = vorrq_u8(vshlq_n_u8(sextets.val[1], 4), vshrq_n_u8(sextets.val[2], 2));
+    decoded.val[2] = vorrq_u8(vshlq_n_u8(sextets.val[2], 6), sextets.val[3]);
+    vst3q_u8(output, decoded);
+    text += 64;
+    length -= 64;
+    output += 48;
+  }
+}
+#endif
+
+size_t Encode(
+    const uint8_t* data,
+    size_t length,
+    char* output,
+    size_t outputLength,
+    Base64Alphabet alphabet)
+{
+  const bool padding = alphabet == Base64Alphabet::Standard;
+  const size_t encodedLength = padding
+      ? Azure::Core::Convert::Base64EncodedLength(length)
+      : Azure::Core::_internal::Base64Url::Base64UrlEncodedLength(length);
+  if (outputLength < encodedLength)
+  {
+    throw std::invalid_argument("The output buffer is too small for the Base64 encoded data.");
   }
+  char* const outputStart = output;
 
+#if defined(AZ_CORE_BASE64_AVX2)
+  static const bool avx2Supported = IsAvx2Supported();
+  if (avx2Supported)
+  {
+    EncodeBlocks(data, length, output, alphabet);
+  }
+#elif defined(AZ_CORE_BASE64_NEON)
+  EncodeBlocks(data, length, output, alphabet);
 #endif
 
+  const char* characters = GetAlphabet(alphabet);
+  for (; length >= 3; data += 3, length -= 3, output += 4)
+  {
+    const uint32_t group = static_cast<uint32_t>(data[0]) << 16
+        | static_cast<uint32_t>(data[1]) << 8 | static_cast<uint32_t>(data[2]);
+    output[0] = characters[group >> 18];
+    output[1] = characters[(group >> 12) & 0x3F];
+    output[2] = characters[(group >> 6) & 0x3F];
+    output[3] = characters[group & 0x3F];
+  }
+  if (length != 0)
+  {
+    const uint32_t group = static_cast<uint32_t>(data[0]) << 16
+        | (length == 2 ? static_cast<uint32_t>(data[1]) << 8 : 0);
+    *output++ = characters[group >> 18];
+    *output++ = characters[(group >> 12) & 0x3F];
+    if (length == 2)
+    {
+      *output++ = characters[(group >> 6) & 0x3F];
+    }
+    if (padding)
+    {
+      *output++ = '=';
+      if (length == 1)
+      {
+        *output++ = '=';
+      }
+    }
+  }
+  return static_cast<size_t>(output - outputStart);
+}
+
+size_t Decode(
+    const char* text,
+    size_t length,
+    uint8_t* output,
+    size_t outputLength,
+    Base64Alphabet alphabet)
+{
+  // The padding is optional, but the text without it can't end with a single character.
+  if (length % 4 == 0 && length != 0 && text[length - 1] == '=')
+  {
+    length -= text[length - 2] == '=' ? 2 : 1;
+  }
+  if (length % 4 == 1)
+  {
+    throw std::invalid_argument("Unexpected length of the Base64 encoded text.");
+  }
+  const size_t decodedLength = length / 4 * 3 + (length % 4 == 0 ? 0 : length % 4 - 1);
+  if (outputLength < decodedLength)
+  {
+    throw std::invalid_argument("The output buffer is too small for the Base64 decoded data.");
+  }
+  uint8_t* const outputStart = output;
+
+#if defined(AZ_CORE_BASE64_AVX2)
+  static const bool avx2Supported = IsAvx2Supported();
+  if (avx2Supported)
+  {
+    DecodeBlocks(text, length, output, alphabet);
+  }
+#elif defined(AZ_CORE_BASE64_NEON)
+  DecodeBlocks(text, length, output, alphabet);
+#endif
+
+  const uint8_t* table = GetDecodeTable(alphabet);
+  while (length != 0)
+  {
+    const size_t groupLength = length < 4 ? length : 4;
+    uint32_t group = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+      const uint8_t sextet = i < groupLength ? table[static_cast<uint8_t>(text[i])] : 0;
+      if (sextet == InvalidSextet)
+      {
+        throw std::invalid_argument("Unexpected character in the Base64 encoded text.");
+      }
+      group = group << 6 | sextet;
+    }
+    for (size_t i = 0; i + 1 < groupLength; ++i)
+    {
+      *output++ = static_cast<uint8_t>(group >> (16 - 8 * i));
+    }
+    text += groupLength;
+    length -= groupLength;
+  }
+  return static_cast<size_t>(output - outputStart);
+}
+
+} // namespace
+
+namespace Azure { namespace Core {
+
+  size_t Convert::Base64Encode(
+      const uint8_t* data,
+      size_t length,
+      char* output,
+      size_t outputLength)
+  {
+    return Encode(data, length, output, outputLength, Base64Alphabet::Standard);
+  }
+
+  size_t Convert::Base64Decode(
+      const char* text,
+      size_t length,
+      uint8_t* output,
+      size_t outputLength)
+  {
+    return Decode(text, length, output, outputLength, Base64Alphabet::Standard);
+  }
+
+  std::string Convert::Base64Encode(const std::vector<uint8_t>& data)
+  {
+    std::string encoded(Base64EncodedLength(data.size()), '\0');
+    if (!encoded.empty())
+    {
+      Encode(data.data(), data.size(), &encoded[0], encoded.size(), Base64Alphabet::Standard);
+    }
+    return encoded;
+  }
+
+  std::vector<uint8_t> Convert::Base64Decode(const std::string& text)
+  {
+    std::vector<uint8_t> decoded(Base64DecodedMaxLength(text.length()));
+    decoded.resize(Decode(
+        text.data(), text.length(), decoded.data(), decoded.size(), Base64Alphabet::Standard));
+    return decoded;
+  }
+
+  namespace _internal {
+
+    size_t Base64Url::Base64UrlEncode(
+        const uint8_t* data,
+        size_t length,
+        char* output,
+        size_t outputLength)
+    {
+      return Encode(data, length, output, outputLength, Base64Alphabet::Url);
+    }
+
+    size_t Base64Url::Base64UrlDecode(
+        const char* text,
+        size_t length,
+        uint8_t* output,
+        size_t outputLength)
+    {
+      return Decode(text, length, output, outputLength, Base64Alphabet::Url);
+    }
+
+    std::string Base64Url::Base64UrlEncode(const std::vector<uint8_t>& data)
+    {
+      std::string encoded(Base64UrlEncodedLength(data.size()), '\0');
+      if (!encoded.empty())
+      {
+        Encode(data.data(), data.size(), &encoded[0], encoded.size(), Base64Alphabet::Url);
+      }
+      return encoded;
+    }
+
+    std::vector<uint8_t> Base64Url::Base64UrlDecode(const std::string& text)
+    {
+      std::vector<uint8_t> decoded(Convert::Base64DecodedMaxLength(text.length()));
+      decoded.resize(Decode(
+          text.data(), text.length(), decoded.data(), decoded.size(), Base64Alphabet::Url));
+      return decoded;
+    }
+
+  } // namespace _internal
+
 }} // namespace Azure::Core
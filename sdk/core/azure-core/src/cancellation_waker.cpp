@@ -0,0 +1,152 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "private/cancellation_waker.hpp"
+
+#include "azure/core/platform.hpp"
+
+#if defined(AZ_PLATFORM_POSIX)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <functional>
+#include <mutex>
+
+using Azure::Core::_detail::CancellationWaker;
+
+#if defined(AZ_PLATFORM_POSIX)
+namespace {
+// A pipe per thread, created the first time the thread waits, so that waiting doesn't open one.
+struct ThreadPipe final
+{
+  int ReadDescriptor = -1;
+  int WriteDescriptor = -1;
+
+  ThreadPipe()
+  {
+    int descriptors[2];
+    if (pipe(descriptors) != 0)
+    {
+      return;
+    }
+    for (auto descriptor : descriptors)
+    {
+      fcntl(descriptor, F_SETFL, fcntl(descriptor, F_GETFL) | O_NONBLOCK);
+      fcntl(descriptor, F_SETFD, FD_CLOEXEC);
+    }
+    ReadDescriptor = descriptors[0];
+    WriteDescriptor = descriptors[1];
+  }
+
+  ~ThreadPipe()
+  {
+    if (ReadDescriptor >= 0)
+    {
+      close(ReadDescriptor);
+      close(WriteDescriptor);
+    }
+  }
+
+  ThreadPipe(const ThreadPipe&) = delete;
+  ThreadPipe& operator=(const ThreadPipe&) = delete;
+};
+
+thread_local ThreadPipe t_pipe;
+
+// The lists of waiters are guarded by one of these locks, picked by the address of the context.
+constexpr size_t WaitersMutexCount = 64;
+std::mutex g_waitersMutexes[WaitersMutexCount];
+
+std::mutex& GetWaitersMutex(void const* sharedState)
+{
+  return g_waitersMutexes[std::hash<void const*>()(sharedState) % WaitersMutexCount];
+}
+} // namespace
+
+CancellationWaker::CancellationWaker(Context const& context)
+    : m_descriptor(t_pipe.ReadDescriptor), m_context(context)
+{
+  if (m_descriptor < 0)
+  {
+    return;
+  }
+  // A wake-up left from a previous wait would only make the first poll return early.
+  Reset();
+  size_t branchLength = 0;
+  for (auto state = m_context.m_contextSharedState.get(); state; state = state->Parent.get())
+  {
+    ++branchLength;
+  }
+  // Sized up front, so that the waiters linked in the lists don't move.
+  m_waiters.resize(branchLength);
+  auto waiter = m_waiters.begin();
+  // Linked before the caller checks its context, so that a context cancelled after the check
+  // wakes this thread up.
+  for (auto state = m_context.m_contextSharedState.get(); state; state = state->Parent.get())
+  {
+    waiter->WriteDescriptor = t_pipe.WriteDescriptor;
+    std::lock_guard<std::mutex> guard(GetWaitersMutex(state));
+    waiter->Next = state->Waiters;
+    if (waiter->Next)
+    {
+      waiter->Next->Previous = &*waiter;
+    }
+    state->Waiters = &*waiter;
+    ++waiter;
+  }
+}
+
+CancellationWaker::~CancellationWaker()
+{
+  auto waiter = m_waiters.begin();
+  for (auto state = m_context.m_contextSharedState.get(); waiter != m_waiters.end();
+       state = state->Parent.get())
+  {
+    std::lock_guard<std::mutex> guard(GetWaitersMutex(state));
+    if (waiter->Previous)
+    {
+      waiter->Previous->Next = waiter->Next;
+    }
+    else
+    {
+      state->Waiters = waiter->Next;
+    }
+    if (waiter->Next)
+    {
+      waiter->Next->Previous = waiter->Previous;
+    }
+    ++waiter;
+  }
+}
+
+void CancellationWaker::Reset() noexcept
+{
+  char buffer[64];
+  while (read(m_descriptor, buffer, sizeof(buffer)) > 0)
+  {
+  }
+}
+
+void CancellationWaker::Wake(Context const& context) noexcept
+{
+  auto const state = context.m_contextSharedState.get();
+  std::lock_guard<std::mutex> guard(GetWaitersMutex(state));
+  for (auto waiter = state->Waiters; waiter; waiter = waiter->Next)
+  {
+    // A full pipe already wakes up its thread.
+    char const wakeUp = 0;
+    (void)write(waiter->WriteDescriptor, &wakeUp, 1);
+  }
+}
+#else
+CancellationWaker::CancellationWaker(Context const& context) : m_descriptor(-1), m_context(context)
+{
+}
+
+CancellationWaker::~CancellationWaker() {}
+
+void CancellationWaker::Reset() noexcept {}
+
+void CancellationWaker::Wake(Context const&) noexcept {}
+#endif
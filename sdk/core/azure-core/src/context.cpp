@@ -3,23 +3,47 @@
 
 #include "azure/core/context.hpp"
 
+#include "private/cancellation_waker.hpp"
+
 using namespace Azure::Core;
 
 Context Context::ApplicationContext;
 
+std::atomic<uint64_t> Context::CancellationCount(0);
+
+void Azure::Core::Context::Cancel()
+{
+  m_contextSharedState->Cancelled = true;
+  ++CancellationCount;
+  // The threads waiting on a socket for this context or one of its children throw.
+  _detail::CancellationWaker::Wake(*this);
+}
+
 Azure::DateTime Azure::Core::Context::GetDeadline() const
 {
-  // Contexts form a tree. Here, we walk from a node all the way back to the root in order to find
-  // the earliest deadline value.
-  auto result = DateTime::max();
-  for (auto ptr = m_contextSharedState; ptr; ptr = ptr->Parent)
+  // The earliest deadline of the branch is kept by each context, only cancelling a context can
+  // make it earlier.
+  if (IsBranchCancelled())
   {
-    auto deadline = ContextSharedState::FromDateTimeRepresentation(ptr->Deadline);
-    if (result > deadline)
+    return (DateTime::min)();
+  }
+  return ContextSharedState::FromDateTimeRepresentation(m_contextSharedState->EarliestDeadline);
+}
+
+bool Azure::Core::Context::CheckBranchCancelled() const noexcept
+{
+  // Read before walking the branch, so that a context cancelled during the walk is checked again
+  // next time.
+  auto const cancellationCount = CancellationCount.load(std::memory_order_acquire);
+  for (auto ptr = m_contextSharedState.get(); ptr; ptr = ptr->Parent.get())
+  {
+    if (ptr->Cancelled.load(std::memory_order_acquire))
     {
-      result = deadline;
+      m_contextSharedState->BranchCancelled.store(true, std::memory_order_release);
+      return true;
     }
   }
-
-  return result;
+  m_contextSharedState->CheckedCancellationCount.store(
+      cancellationCount, std::memory_order_release);
+  return false;
 }
@@ -10,9 +10,12 @@
 
 #include <bcrypt.h>
 #elif defined(AZ_PLATFORM_POSIX)
+#include <openssl/evp.h>
 #include <openssl/md5.h>
 #endif
 
+#include <memory>
+#include <new>
 #include <stdexcept>
 #include <vector>
 
@@ -125,12 +128,16 @@ private:
     return hash;
   }
 
-public:
-  Md5BCrypt()
+  void OnReset()
   {
-    m_buffer.resize(GetMD5AlgorithmProvider().ContextSize);
-    m_hashLength = GetMD5AlgorithmProvider().HashLength;
+    // The hash object is created again in the same buffer.
+    BCryptDestroyHash(m_hashHandle);
+    m_hashHandle = nullptr;
+    CreateHash();
+  }
 
+  void CreateHash()
+  {
     if (!BCRYPT_SUCCESS(
             m_status = BCryptCreateHash(
                 GetMD5AlgorithmProvider().Handle,
@@ -145,6 +152,14 @@ public:
     }
   }
 
+public:
+  Md5BCrypt()
+  {
+    m_buffer.resize(GetMD5AlgorithmProvider().ContextSize);
+    m_hashLength = GetMD5AlgorithmProvider().HashLength;
+    CreateHash();
+  }
+
   ~Md5BCrypt()
   {
     if (m_hashHandle)
@@ -161,23 +176,43 @@ Azure::Core::Cryptography::Md5Hash::Md5Hash() : m_implementation(std::make_uniqu
 
 class Md5OpenSSL final : public Azure::Core::Cryptography::Hash {
 private:
-  std::unique_ptr<MD5_CTX> m_context;
+  std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> m_context;
 
-  void OnAppend(const uint8_t* data, size_t length) { MD5_Update(m_context.get(), data, length); }
+  void OnAppend(const uint8_t* data, size_t length)
+  {
+    if (EVP_DigestUpdate(m_context.get(), data, length) != 1)
+    {
+      throw std::runtime_error("EVP_DigestUpdate failed.");
+    }
+  }
 
   std::vector<uint8_t> OnFinal(const uint8_t* data, size_t length)
   {
     OnAppend(data, length);
     unsigned char hash[MD5_DIGEST_LENGTH];
-    MD5_Final(hash, m_context.get());
+    if (EVP_DigestFinal_ex(m_context.get(), hash, nullptr) != 1)
+    {
+      throw std::runtime_error("EVP_DigestFinal_ex failed.");
+    }
     return std::vector<uint8_t>(std::begin(hash), std::end(hash));
   }
 
+  void OnReset()
+  {
+    if (EVP_DigestInit_ex(m_context.get(), EVP_md5(), nullptr) != 1)
+    {
+      throw std::runtime_error("EVP_DigestInit_ex failed.");
+    }
+  }
+
 public:
-  Md5OpenSSL()
+  Md5OpenSSL() : m_context(EVP_MD_CTX_new(), &EVP_MD_CTX_free)
   {
-    m_context = std::make_unique<MD5_CTX>();
-    MD5_Init(m_context.get());
+    if (!m_context)
+    {
+      throw std::bad_alloc();
+    }
+    OnReset();
   }
 };
 
@@ -198,4 +233,6 @@ namespace Azure { namespace Core { namespace Cryptography {
     return m_implementation->Final(data, length);
   }
 
+  void Md5Hash::OnReset() { m_implementation->Reset(); }
+
 }}} // namespace Azure::Core::Cryptography
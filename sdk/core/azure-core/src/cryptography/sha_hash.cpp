@@ -35,6 +35,7 @@ enum class SHASize
 class SHAWithOpenSSL final : public Azure::Core::Cryptography::Hash {
 private:
   EVP_MD_CTX* m_context;
+  const EVP_MD* m_type = nullptr;
 
   std::vector<uint8_t> OnFinal(const uint8_t* data, size_t length) override
   {
@@ -56,6 +57,15 @@ private:
     }
   }
 
+  void OnReset() override
+  {
+    // Initializing the context again keeps its allocation.
+    if (1 != EVP_DigestInit_ex(m_context, m_type, NULL))
+    {
+      throw std::runtime_error("Crypto error while resetting the hash.");
+    }
+  }
+
 public:
   SHAWithOpenSSL(SHASize size)
   {
@@ -66,21 +76,24 @@ public:
     switch (size)
     {
       case SHASize::SHA256: {
-        if (1 != EVP_DigestInit_ex(m_context, EVP_sha256(), NULL))
+        m_type = EVP_sha256();
+        if (1 != EVP_DigestInit_ex(m_context, m_type, NULL))
         {
           throw std::runtime_error("Crypto error while init Sha256Hash.");
         }
         break;
       }
       case SHASize::SHA384: {
-        if (1 != EVP_DigestInit_ex(m_context, EVP_sha384(), NULL))
+        m_type = EVP_sha384();
+        if (1 != EVP_DigestInit_ex(m_context, m_type, NULL))
         {
           throw std::runtime_error("Crypto error while init Sha384Hash.");
         }
         break;
       }
       case SHASize::SHA512: {
-        if (1 != EVP_DigestInit_ex(m_context, EVP_sha512(), NULL))
+        m_type = EVP_sha512();
+        if (1 != EVP_DigestInit_ex(m_context, m_type, NULL))
         {
           throw std::runtime_error("Crypto error while init Sha512Hash.");
         }
@@ -161,8 +174,28 @@ struct AlgorithmProviderInstance final
   ~AlgorithmProviderInstance() { BCryptCloseAlgorithmProvider(Handle, 0); }
 };
 
+// Opening an algorithm provider is expensive, the providers are shared by the hash instances.
+AlgorithmProviderInstance const& GetSha256AlgorithmProvider()
+{
+  static AlgorithmProviderInstance instance(BCRYPT_SHA256_ALGORITHM);
+  return instance;
+}
+
+AlgorithmProviderInstance const& GetSha384AlgorithmProvider()
+{
+  static AlgorithmProviderInstance instance(BCRYPT_SHA384_ALGORITHM);
+  return instance;
+}
+
+AlgorithmProviderInstance const& GetSha512AlgorithmProvider()
+{
+  static AlgorithmProviderInstance instance(BCRYPT_SHA512_ALGORITHM);
+  return instance;
+}
+
 class SHAWithBCrypt final : public Azure::Core::Cryptography::Hash {
 private:
+  AlgorithmProviderInstance const& m_algorithmProvider;
   std::string m_buffer;
   BCRYPT_HASH_HANDLE m_hashHandle = nullptr;
   size_t m_hashLength = 0;
@@ -195,16 +228,18 @@ private:
     }
   }
 
-public:
-  SHAWithBCrypt(LPCWSTR hashAlgorithm)
+  void OnReset() override
   {
-    AlgorithmProviderInstance algorithmProvider(hashAlgorithm);
-
-    m_buffer.resize(algorithmProvider.ContextSize);
-    m_hashLength = algorithmProvider.HashLength;
+    // The hash object is created again in the same buffer.
+    BCryptDestroyHash(m_hashHandle);
+    m_hashHandle = nullptr;
+    CreateHash();
+  }
 
+  void CreateHash()
+  {
     NTSTATUS status = BCryptCreateHash(
-        algorithmProvider.Handle,
+        m_algorithmProvider.Handle,
         &m_hashHandle,
         reinterpret_cast<PUCHAR>(&m_buffer[0]),
         static_cast<ULONG>(m_buffer.size()),
@@ -217,23 +252,38 @@ public:
     }
   }
 
-  ~SHAWithBCrypt() { BCryptDestroyHash(m_hashHandle); }
+public:
+  SHAWithBCrypt(AlgorithmProviderInstance const& algorithmProvider)
+      : m_algorithmProvider(algorithmProvider)
+  {
+    m_buffer.resize(m_algorithmProvider.ContextSize);
+    m_hashLength = m_algorithmProvider.HashLength;
+    CreateHash();
+  }
+
+  ~SHAWithBCrypt()
+  {
+    if (m_hashHandle)
+    {
+      BCryptDestroyHash(m_hashHandle);
+    }
+  }
 };
 
 } // namespace
 
 Azure::Core::Cryptography::_internal::Sha256Hash::Sha256Hash()
-    : m_portableImplementation(std::make_unique<SHAWithBCrypt>(BCRYPT_SHA256_ALGORITHM))
+    : m_portableImplementation(std::make_unique<SHAWithBCrypt>(GetSha256AlgorithmProvider()))
 {
 }
 
 Azure::Core::Cryptography::_internal::Sha384Hash::Sha384Hash()
-    : m_portableImplementation(std::make_unique<SHAWithBCrypt>(BCRYPT_SHA384_ALGORITHM))
+    : m_portableImplementation(std::make_unique<SHAWithBCrypt>(GetSha384AlgorithmProvider()))
 {
 }
 
 Azure::Core::Cryptography::_internal::Sha512Hash::Sha512Hash()
-    : m_portableImplementation(std::make_unique<SHAWithBCrypt>(BCRYPT_SHA512_ALGORITHM))
+    : m_portableImplementation(std::make_unique<SHAWithBCrypt>(GetSha512AlgorithmProvider()))
 {
 }
 #endif
@@ -6,10 +6,9 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <ctime>
-#include <iomanip>
 #include <limits>
-#include <sstream>
 #include <stdexcept>
 
 using namespace Azure;
@@ -59,7 +58,7 @@ void ValidateDateElementRange(
     T value,
     decltype(value) minValue,
     decltype(value) maxValue,
-    std::string const& valueName)
+    char const* valueName)
 {
   auto outOfRange = 0;
 
@@ -75,7 +74,7 @@ void ValidateDateElementRange(
   if (outOfRange != 0)
   {
     throw std::invalid_argument(
-        "Azure::DateTime " + valueName + " (" + std::to_string(value) + ") cannot be "
+        std::string("Azure::DateTime ") + valueName + " (" + std::to_string(value) + ") cannot be "
         + (outOfRange < 0 ? std::string("less than ") + std::to_string(minValue)
                           : std::string("greater than ") + std::to_string(maxValue))
         + ".");
@@ -384,9 +383,154 @@ void ParseSingleOptionalChar(
     IncreaseAndCheckMinLength(minLength, actualLength, 1);
   }
 }
+// The names packed back to back, for the fixed-layout formats.
+constexpr char DayNameChars[] = "SunMonTueWedThuFriSat";
+constexpr char MonthNameChars[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+// "Fri, 31 Dec 9999 23:59:59 GMT"
+constexpr size_t Rfc1123Length = 29;
+
+// Writes the value with the number of digits given, padded with zeros.
+char* WriteDigits(char* buffer, int32_t value, int digits)
+{
+  for (int i = digits - 1; i >= 0; --i)
+  {
+    buffer[i] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+  return buffer + digits;
+}
+
+// The value of the digits, or -1 if any of the characters isn't one.
+int32_t ReadDigits(char const* str, int digits)
+{
+  int32_t value = 0;
+  bool allDigits = true;
+  for (int i = 0; i < digits; ++i)
+  {
+    auto const digit = static_cast<uint32_t>(static_cast<unsigned char>(str[i])) - '0';
+    allDigits &= digit <= 9;
+    value = (value * 10) + static_cast<int32_t>(digit);
+  }
+  return allDigits ? value : -1;
+}
+
+// The index of the 3-letter name, or -1 if it isn't one of them.
+int8_t FindName(char const* str, char const* names, int8_t count)
+{
+  for (int8_t i = 0; i < count; ++i)
+  {
+    if (std::memcmp(str, names + (3 * i), 3) == 0)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/*
+ * The fast paths parse the fixed-width forms the services send, "Fri, 31 Dec 9999 23:59:59 GMT" and
+ * "9999-12-31T23:59:59[.9999999]Z", with no branch per character. Any other form is left to the
+ * general parser, which also reports the errors.
+ */
+bool TryParseFixedRfc1123(
+    std::string const& str,
+    int16_t* year,
+    int8_t* month,
+    int8_t* day,
+    int8_t* hour,
+    int8_t* minute,
+    int8_t* second,
+    int8_t* dayOfWeek)
+{
+  if (str.length() != Rfc1123Length)
+  {
+    return false;
+  }
+  char const* const s = str.data();
+  if (s[3] != ',' || s[4] != ' ' || s[7] != ' ' || s[11] != ' ' || s[16] != ' ' || s[19] != ':'
+      || s[22] != ':' || s[25] != ' ' || std::memcmp(s + 26, "GMT", 3) != 0)
+  {
+    return false;
+  }
+
+  auto const dayValue = ReadDigits(s + 5, 2);
+  auto const yearValue = ReadDigits(s + 12, 4);
+  auto const hourValue = ReadDigits(s + 17, 2);
+  auto const minuteValue = ReadDigits(s + 20, 2);
+  auto const secondValue = ReadDigits(s + 23, 2);
+  *dayOfWeek = FindName(s, DayNameChars, 7);
+  *month = static_cast<int8_t>(FindName(s + 8, MonthNameChars, 12) + 1);
+  if ((dayValue | yearValue | hourValue | minuteValue | secondValue) < 0 || *dayOfWeek < 0
+      || *month == 0)
+  {
+    return false;
+  }
+
+  *year = static_cast<int16_t>(yearValue);
+  *day = static_cast<int8_t>(dayValue);
+  *hour = static_cast<int8_t>(hourValue);
+  *minute = static_cast<int8_t>(minuteValue);
+  *second = static_cast<int8_t>(secondValue);
+  return true;
+}
+
+bool TryParseFixedRfc3339(
+    std::string const& str,
+    int16_t* year,
+    int8_t* month,
+    int8_t* day,
+    int8_t* hour,
+    int8_t* minute,
+    int8_t* second,
+    int32_t* fracSec)
+{
+  auto const length = str.length();
+  // Up to 7 fractional digits, the ones after are rounded by the general parser.
+  if (length < 20 || length == 21 || length > 28)
+  {
+    return false;
+  }
+  char const* const s = str.data();
+  if (s[4] != '-' || s[7] != '-' || s[10] != 'T' || s[13] != ':' || s[16] != ':'
+      || s[length - 1] != 'Z' || (length > 20 && s[19] != '.'))
+  {
+    return false;
+  }
+
+  auto const yearValue = ReadDigits(s, 4);
+  auto const monthValue = ReadDigits(s + 5, 2);
+  auto const dayValue = ReadDigits(s + 8, 2);
+  auto const hourValue = ReadDigits(s + 11, 2);
+  auto const minuteValue = ReadDigits(s + 14, 2);
+  auto const secondValue = ReadDigits(s + 17, 2);
+  auto const fracDigits = length > 20 ? static_cast<int>(length - 21) : 0;
+  auto fracValue = ReadDigits(s + 20, fracDigits);
+  if ((yearValue | monthValue | dayValue | hourValue | minuteValue | secondValue | fracValue) < 0)
+  {
+    return false;
+  }
+  for (auto i = fracDigits; i < 7; ++i)
+  {
+    fracValue *= 10;
+  }
+
+  *year = static_cast<int16_t>(yearValue);
+  *month = static_cast<int8_t>(monthValue);
+  *day = static_cast<int8_t>(dayValue);
+  *hour = static_cast<int8_t>(hourValue);
+  *minute = static_cast<int8_t>(minuteValue);
+  *second = static_cast<int8_t>(secondValue);
+  *fracSec = fracValue;
+  return true;
+}
 } // namespace
 
-DateTime const DateTime::SystemClockEpoch = GetSystemClockEpoch();
+DateTime const& DateTime::SystemClockEpoch()
+{
+  static DateTime const systemClockEpoch = GetSystemClockEpoch();
+  return systemClockEpoch;
+}
 
 DateTime::DateTime(
     int16_t year,
@@ -444,7 +588,7 @@ DateTime::operator std::chrono::system_clock::time_point() const
   }
 
   return std::chrono::system_clock::time_point()
-      + std::chrono::duration_cast<std::chrono::system_clock::duration>(*this - SystemClockEpoch);
+      + std::chrono::duration_cast<std::chrono::system_clock::duration>(*this - SystemClockEpoch());
 }
 
 DateTime DateTime::Parse(std::string const& dateTime, DateFormat format)
@@ -464,6 +608,17 @@ DateTime DateTime::Parse(std::string const& dateTime, DateFormat format)
   int8_t localDiffHours = 0;
   int8_t localDiffMinutes = 0;
   bool roundFracSecUp = false;
+
+  if (format == DateFormat::Rfc1123
+          ? TryParseFixedRfc1123(
+              dateTime, &year, &month, &day, &hour, &minute, &second, &dayOfWeek)
+          : (format == DateFormat::Rfc3339
+             && TryParseFixedRfc3339(
+                 dateTime, &year, &month, &day, &hour, &minute, &second, &fracSec)))
+  {
+    return DateTime(year, month, day, hour, minute, second, fracSec, dayOfWeek, 0, 0);
+  }
+
   {
     std::string::size_type const DateTimeLength = dateTime.length();
     std::string::size_type minDateTimeLength = 0;
@@ -819,30 +974,55 @@ std::string DateTime::ToStringRfc1123() const
 {
   ThrowIfUnsupportedYear();
 
-  int16_t year = 1;
-
-  // The values that are not supposed to be read before they are written are set to -123... to
-  // avoid warnings on some compilers, yet provide a clearly bad value to make it obvious if
-  // things don't work as expected.
-  int8_t month = -123;
-  int8_t day = -123;
-  int8_t hour = -123;
-  int8_t minute = -123;
-  int8_t second = -123;
-  int32_t fracSec = -1234567890;
-  int8_t dayOfWeek = -123;
-
-  GetDateTimeParts(&year, &month, &day, &hour, &minute, &second, &fracSec, &dayOfWeek);
-
-  std::ostringstream dateString;
-
-  dateString << DayNames[dayOfWeek] << ", " << std::setfill('0') << std::setw(2)
-             << static_cast<int>(day) << ' ' << MonthNames[month - 1] << ' ' << std::setw(4)
-             << static_cast<int>(year) << ' ' << std::setw(2) << static_cast<int>(hour) << ':'
-             << std::setw(2) << static_cast<int>(minute) << ':' << std::setw(2)
-             << static_cast<int>(second) << " GMT";
+  // The requests of the same second format the same date.
+  struct FormattedSecond final
+  {
+    bool IsSet;
+    int64_t Second;
+    char Text[Rfc1123Length];
+  };
+  thread_local FormattedSecond LastFormatted;
+
+  auto const second = time_since_epoch().count() / OneSecondIn100ns;
+  if (!LastFormatted.IsSet || LastFormatted.Second != second)
+  {
+    int16_t year = 1;
+
+    // The values that are not supposed to be read before they are written are set to -123... to
+    // avoid warnings on some compilers, yet provide a clearly bad value to make it obvious if
+    // things don't work as expected.
+    int8_t month = -123;
+    int8_t day = -123;
+    int8_t hour = -123;
+    int8_t minute = -123;
+    int8_t secondOfMinute = -123;
+    int32_t fracSec = -1234567890;
+    int8_t dayOfWeek = -123;
+
+    GetDateTimeParts(
+        &year, &month, &day, &hour, &minute, &secondOfMinute, &fracSec, &dayOfWeek);
+
+    char* cursor = LastFormatted.Text;
+    std::memcpy(cursor, DayNameChars + (3 * dayOfWeek), 3);
+    std::memcpy(cursor + 3, ", ", 2);
+    cursor = WriteDigits(cursor + 5, day, 2);
+    *cursor++ = ' ';
+    std::memcpy(cursor, MonthNameChars + (3 * (month - 1)), 3);
+    cursor[3] = ' ';
+    cursor = WriteDigits(cursor + 4, year, 4);
+    *cursor++ = ' ';
+    cursor = WriteDigits(cursor, hour, 2);
+    *cursor++ = ':';
+    cursor = WriteDigits(cursor, minute, 2);
+    *cursor++ = ':';
+    cursor = WriteDigits(cursor, secondOfMinute, 2);
+    std::memcpy(cursor, " GMT", 4);
+
+    LastFormatted.IsSet = true;
+    LastFormatted.Second = second;
+  }
 
-  return dateString.str();
+  return std::string(LastFormatted.Text, Rfc1123Length);
 }
 
 std::string DateTime::ToString(DateFormat format) const
@@ -879,37 +1059,42 @@ std::string DateTime::ToString(DateFormat format, TimeFractionFormat fractionFor
 
   GetDateTimeParts(&year, &month, &day, &hour, &minute, &second, &fracSec, &dayOfWeek);
 
-  std::ostringstream dateString;
-
-  dateString << std::setfill('0') << std::setw(4) << static_cast<int>(year) << '-' << std::setw(2)
-             << static_cast<int>(month) << '-' << std::setw(2) << static_cast<int>(day) << 'T'
-             << std::setw(2) << static_cast<int>(hour) << ':' << std::setw(2)
-             << static_cast<int>(minute) << ':' << std::setw(2) << static_cast<int>(second);
+  // "9999-12-31T23:59:59.9999999Z"
+  char dateString[28];
+  char* cursor = WriteDigits(dateString, year, 4);
+  *cursor++ = '-';
+  cursor = WriteDigits(cursor, month, 2);
+  *cursor++ = '-';
+  cursor = WriteDigits(cursor, day, 2);
+  *cursor++ = 'T';
+  cursor = WriteDigits(cursor, hour, 2);
+  *cursor++ = ':';
+  cursor = WriteDigits(cursor, minute, 2);
+  *cursor++ = ':';
+  cursor = WriteDigits(cursor, second, 2);
 
   if (fractionFormat == TimeFractionFormat::AllDigits)
   {
-    dateString << '.' << std::setw(7) << static_cast<int>(fracSec);
+    *cursor++ = '.';
+    cursor = WriteDigits(cursor, fracSec, 7);
   }
   else if (fracSec != 0 && fractionFormat != TimeFractionFormat::Truncate)
   {
     // Append fractional second, which is a 7-digit value with no trailing zeros
     // This way, '0001200' becomes '00012'
-    auto setw = 1;
+    auto digits = 7;
     auto frac = fracSec;
-    for (auto div = 1000000; div >= 1; div /= 10)
+    while (frac % 10 == 0)
     {
-      if ((fracSec % div) == 0)
-      {
-        frac /= div;
-        break;
-      }
-      ++setw;
+      frac /= 10;
+      --digits;
     }
 
-    dateString << '.' << std::setw(setw) << static_cast<int>(frac);
+    *cursor++ = '.';
+    cursor = WriteDigits(cursor, frac, digits);
   }
 
-  dateString << 'Z';
+  *cursor++ = 'Z';
 
-  return dateString.str();
+  return std::string(dateString, cursor);
 }
@@ -3,29 +3,130 @@
 
 #include "azure/core/http/policies/policy.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
 
 using Azure::Core::Context;
 using namespace Azure::Core::Http;
 using namespace Azure::Core::Http::Policies;
 using namespace Azure::Core::Http::Policies::_internal;
 
-std::unique_ptr<RawResponse> BearerTokenAuthenticationPolicy::Send(
+namespace {
+// The token is fetched on the request path when it expires in 2 or less minutes, and refreshed in
+// the background when it expires in 5 or less minutes.
+constexpr auto TokenRefreshOffset = std::chrono::minutes(2);
+constexpr auto TokenBackgroundRefreshOffset = std::chrono::minutes(5);
+// The delay before refreshing again in the background after a failure, doubled with each failure.
+constexpr std::chrono::seconds MinRefreshBackoff(5);
+constexpr std::chrono::seconds MaxRefreshBackoff(60);
+} // namespace
+
+void BearerTokenAuthenticationPolicy::AuthorizeRequest(
     Request& request,
-    NextHttpPolicy nextPolicy,
     Context const& context) const
 {
+  auto const tokenCache = m_tokenCache;
+  auto const now = std::chrono::system_clock::now();
+
+  auto accessToken = std::atomic_load(&tokenCache->AccessToken);
+  if (!accessToken || now > accessToken->ExpiresOn - TokenRefreshOffset)
   {
-    std::lock_guard<std::mutex> lock(m_accessTokenMutex);
+    std::lock_guard<std::mutex> lock(tokenCache->RefreshMutex);
 
-    // Refresh the token in 2 or less minutes before the actual expiration.
-    if (std::chrono::system_clock::now() > (m_accessToken.ExpiresOn - std::chrono::minutes(2)))
+    // Another request or the background refresh may have fetched a token in the meantime.
+    accessToken = std::atomic_load(&tokenCache->AccessToken);
+    if (!accessToken || now > accessToken->ExpiresOn - TokenRefreshOffset)
     {
-      m_accessToken = m_credential->GetToken(m_tokenRequestContext, context);
+      accessToken = std::make_shared<Credentials::AccessToken const>(
+          tokenCache->Credential->GetToken(tokenCache->TokenRequestContext, context));
+      std::atomic_store(&tokenCache->AccessToken, accessToken);
+    }
+  }
+  else if (
+      now > accessToken->ExpiresOn - TokenBackgroundRefreshOffset
+      && !tokenCache->IsRefreshing.exchange(true))
+  {
+    if (std::chrono::steady_clock::now() < tokenCache->NextRefreshTime)
+    {
+      // The previous refresh failed, the next one waits for the backoff.
+      tokenCache->IsRefreshing = false;
+    }
+    else
+    {
+      auto refresh = [tokenCache]() {
+        try
+        {
+          std::lock_guard<std::mutex> lock(tokenCache->RefreshMutex);
+          auto const currentToken = std::atomic_load(&tokenCache->AccessToken);
+          if (std::chrono::system_clock::now()
+              > currentToken->ExpiresOn - TokenBackgroundRefreshOffset)
+          {
+            std::atomic_store(
+                &tokenCache->AccessToken,
+                std::make_shared<Credentials::AccessToken const>(tokenCache->Credential->GetToken(
+                    tokenCache->TokenRequestContext, Context::ApplicationContext)));
+          }
+          tokenCache->RefreshBackoff = std::chrono::seconds(0);
+        }
+        catch (...)
+        {
+          // The current token is still used, and a request fetches one once it's about to
+          // expire. Until then, the refresh is retried after a growing delay, so that a failing
+          // credential isn't called by every request.
+          tokenCache->RefreshBackoff = tokenCache->RefreshBackoff == std::chrono::seconds(0)
+              ? MinRefreshBackoff
+              : (std::min)(tokenCache->RefreshBackoff * 2, MaxRefreshBackoff);
+          tokenCache->NextRefreshTime
+              = std::chrono::steady_clock::now() + tokenCache->RefreshBackoff;
+        }
+        tokenCache->IsRefreshing = false;
+      };
+      try
+      {
+        std::thread(std::move(refresh)).detach();
+      }
+      catch (std::system_error const&)
+      {
+        tokenCache->IsRefreshing = false;
+      }
     }
-
-    request.SetHeader("authorization", "Bearer " + m_accessToken.Token);
   }
 
+  request.SetHeader("authorization", "Bearer " + accessToken->Token);
+}
+
+std::unique_ptr<RawResponse> BearerTokenAuthenticationPolicy::Send(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context) const
+{
+  AuthorizeRequest(request, context);
+
   return nextPolicy.Send(request, context);
 }
+
+void BearerTokenAuthenticationPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendCompletionCallback callback) const
+{
+  // Getting a token still blocks the calling thread. It is only done when there's no token yet or
+  // it is about to expire, it's refreshed in the background before that.
+  try
+  {
+    AuthorizeRequest(request, context);
+  }
+  catch (...)
+  {
+    callback(nullptr, std::current_exception());
+    return;
+  }
+
+  nextPolicy.SendAsync(request, context, std::move(callback));
+}
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/policies/policy.hpp"
+
+#include <utility>
+
+using Azure::Core::Context;
+using namespace Azure::Core::Http;
+using namespace Azure::Core::Http::Policies;
+using namespace Azure::Core::Http::Policies::_internal;
+
+std::unique_ptr<RawResponse> ConcurrencyLimitPolicy::Send(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context) const
+{
+  auto const host = request.GetUrl().GetHost();
+  auto const permit = m_limiter->Acquire(host, context);
+
+  std::unique_ptr<RawResponse> response;
+  try
+  {
+    response = nextPolicy.Send(request, context);
+  }
+  catch (...)
+  {
+    m_limiter->Release(host, permit, nullptr);
+    throw;
+  }
+  m_limiter->Release(host, permit, response.get());
+  return response;
+}
+
+void ConcurrencyLimitPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendCompletionCallback callback) const
+{
+  auto limiter = m_limiter;
+  auto host = request.GetUrl().GetHost();
+  limiter->AcquireAsync(
+      host,
+      [limiter, host, &request, nextPolicy, context, callback = std::move(callback)](
+          ConcurrencyLimiter::Permit permit) mutable {
+        if (context.IsCancelled())
+        {
+          limiter->Release(host, permit, nullptr);
+          callback(
+              nullptr,
+              std::make_exception_ptr(
+                  Azure::Core::OperationCancelledException("Request was cancelled by context.")));
+          return;
+        }
+        nextPolicy.SendAsync(
+            request,
+            context,
+            [limiter, host, permit, callback = std::move(callback)](
+                std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+              limiter->Release(host, permit, response.get());
+              callback(std::move(response), error);
+            });
+      });
+}
@@ -0,0 +1,209 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/policies/concurrency_limiter.hpp"
+
+#include "azure/core/internal/diagnostics/log.hpp"
+#include "../private/retry_after.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using Azure::Core::Context;
+using Azure::Core::Http::HttpStatusCode;
+using Azure::Core::Http::RawResponse;
+using Azure::Core::Http::Policies::ConcurrencyLimiter;
+
+namespace {
+bool IsThrottled(RawResponse const& response)
+{
+  auto const statusCode = response.GetStatusCode();
+  return statusCode == HttpStatusCode::TooManyRequests
+      || statusCode == HttpStatusCode::ServiceUnavailable;
+}
+
+// Sleep in short steps to notice when the context is cancelled.
+constexpr auto MaxWaitStep = std::chrono::milliseconds(100);
+} // namespace
+
+ConcurrencyLimiter::ConcurrencyLimiter(
+    size_t initialLimit,
+    size_t maxLimit,
+    double decreaseFactor)
+    : m_initialLimit((std::max)(initialLimit, size_t(1))),
+      m_maxLimit((std::max)(maxLimit, (std::max)(initialLimit, size_t(1)))),
+      m_decreaseFactor((std::min)((std::max)(decreaseFactor, 0.0), 1.0))
+{
+}
+
+ConcurrencyLimiter::~ConcurrencyLimiter()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_released.wait(lock, [this]() { return m_pendingResumes == 0; });
+}
+
+ConcurrencyLimiter::HostState& ConcurrencyLimiter::GetHostState(std::string const& host)
+{
+  auto state = m_hosts.find(host);
+  if (state == m_hosts.end())
+  {
+    state = m_hosts.emplace(host, HostState()).first;
+    state->second.Limit = static_cast<double>(m_initialLimit);
+  }
+  return state->second;
+}
+
+ConcurrencyLimiter::Permit ConcurrencyLimiter::Acquire(
+    std::string const& host,
+    Context const& context)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true)
+  {
+    context.ThrowIfCancelled();
+
+    auto& state = GetHostState(host);
+    auto const now = std::chrono::steady_clock::now();
+    if (now >= state.PausedUntil && state.Waiters.empty()
+        && static_cast<double>(state.InFlight) < state.Limit)
+    {
+      ++state.InFlight;
+      return now;
+    }
+
+    auto wakeUp = now + MaxWaitStep;
+    if (state.PausedUntil > now)
+    {
+      wakeUp = (std::min)(wakeUp, state.PausedUntil);
+    }
+    m_released.wait_until(lock, wakeUp);
+  }
+}
+
+void ConcurrencyLimiter::AcquireAsync(
+    std::string const& host,
+    std::function<void(Permit)> onAcquired)
+{
+  Permit permit;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& state = GetHostState(host);
+    permit = std::chrono::steady_clock::now();
+    if (permit < state.PausedUntil || !state.Waiters.empty()
+        || static_cast<double>(state.InFlight) >= state.Limit)
+    {
+      // The request is sent by Release() or after the pause.
+      state.Waiters.emplace_back(std::move(onAcquired));
+      if (permit < state.PausedUntil && state.Waiters.size() == 1)
+      {
+        ResumeAfterPause(host, state.PausedUntil);
+      }
+      return;
+    }
+    ++state.InFlight;
+  }
+  onAcquired(permit);
+}
+
+void ConcurrencyLimiter::ResumeAfterPause(
+    std::string const& host,
+    std::chrono::steady_clock::time_point pausedUntil)
+{
+  // Called with m_mutex locked. Wait without blocking the thread calling back, which can be the
+  // event loop of the transport.
+  ++m_pendingResumes;
+  std::thread([this, host, pausedUntil]() {
+    std::this_thread::sleep_until(pausedUntil);
+    Release(host, pausedUntil, nullptr, false);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_pendingResumes;
+    // Notified with m_mutex locked, since the destructor can return as soon as it is unlocked.
+    m_released.notify_all();
+  }).detach();
+}
+
+void ConcurrencyLimiter::Release(
+    std::string const& host,
+    Permit permit,
+    RawResponse const* response)
+{
+  Release(host, permit, response, true);
+}
+
+void ConcurrencyLimiter::Release(
+    std::string const& host,
+    Permit permit,
+    RawResponse const* response,
+    bool endsRequest)
+{
+  using Azure::Core::Diagnostics::Logger;
+  using Azure::Core::Diagnostics::_internal::Log;
+
+  std::vector<std::function<void(Permit)>> acquired;
+  Permit now;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& state = GetHostState(host);
+    if (endsRequest && state.InFlight > 0)
+    {
+      --state.InFlight;
+    }
+    now = std::chrono::steady_clock::now();
+
+    if (response != nullptr && IsThrottled(*response))
+    {
+      if (permit > state.LastDecrease)
+      {
+        state.Limit = (std::max)(state.Limit * m_decreaseFactor, 1.0);
+        state.LastDecrease = now;
+        if (Log::ShouldWrite(Logger::Level::Informational))
+        {
+          Log::Write(
+              Logger::Level::Informational,
+              "HTTP requests to " + host + " throttled, concurrency limit lowered to "
+                  + std::to_string(static_cast<size_t>(state.Limit)) + ".");
+        }
+      }
+
+      std::chrono::milliseconds retryAfter{};
+      if (_detail::GetResponseHeaderBasedDelay(*response, retryAfter)
+          && now + retryAfter > state.PausedUntil)
+      {
+        state.PausedUntil = now + retryAfter;
+        if (!state.Waiters.empty())
+        {
+          ResumeAfterPause(host, state.PausedUntil);
+        }
+      }
+    }
+    else if (response != nullptr)
+    {
+      state.Limit
+          = (std::min)(state.Limit + 1.0 / state.Limit, static_cast<double>(m_maxLimit));
+    }
+
+    if (now >= state.PausedUntil)
+    {
+      while (!state.Waiters.empty() && static_cast<double>(state.InFlight) < state.Limit)
+      {
+        ++state.InFlight;
+        acquired.emplace_back(std::move(state.Waiters.front()));
+        state.Waiters.pop_front();
+      }
+    }
+  }
+  m_released.notify_all();
+
+  for (auto& onAcquired : acquired)
+  {
+    onAcquired(now);
+  }
+}
+
+size_t ConcurrencyLimiter::GetLimit(std::string const& host)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return static_cast<size_t>(GetHostState(host).Limit);
+}
@@ -9,11 +9,14 @@
 #include "azure/core/platform.hpp"
 
 // Private include
+#include "../../private/cancellation_waker.hpp"
 #include "curl_connection_pool_private.hpp"
 #include "curl_connection_private.hpp"
 #include "curl_session_private.hpp"
 
 #if defined(AZ_PLATFORM_POSIX)
+#include <netinet/in.h> // for IPPROTO_TCP
+#include <netinet/tcp.h> // for TCP_CONGESTION
 #include <poll.h> // for poll()
 #include <sys/socket.h> // for socket shutdown
 #elif defined(AZ_PLATFORM_WINDOWS)
@@ -26,10 +29,24 @@
 #include <winsock2.h> // for WSAPoll();
 #endif
 
+#if !defined(AZ_PLATFORM_WINDOWS)
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+#endif
+
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
 #include <curl/curl.h>
+#include <exception>
+#include <future>
+#include <limits>
+#include <map>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace {
 std::string const LogMsgPrefix = "[CURL Transport Adapter]: ";
@@ -49,6 +66,96 @@ inline bool SetLibcurlOption(CURL* handle, CURLoption option, T value, CURLcode*
 #pragma warning(pop)
 #endif
 
+// Guards the data shared by the connections through the share handle of the connection pool.
+// Defined before the pool, so that they outlive the connections it releases.
+std::array<std::mutex, CURL_LOCK_DATA_LAST> SharedDataMutexes;
+
+void LockSharedData(CURL*, curl_lock_data data, curl_lock_access, void*)
+{
+  SharedDataMutexes[static_cast<size_t>(data)].lock();
+}
+
+void UnlockSharedData(CURL*, curl_lock_data data, void*)
+{
+  SharedDataMutexes[static_cast<size_t>(data)].unlock();
+}
+
+#if !defined(AZ_PLATFORM_WINDOWS) && OPENSSL_VERSION_NUMBER >= 0x10100000L
+#define AZ_CURL_SHARED_CERTIFICATE_STORE
+/**
+ * @brief The certificate stores loaded from the CA bundles, shared by the TLS contexts of the new
+ * connections, so that OpenSSL doesn't read and parse the bundle again for each of them.
+ */
+class SharedCertificateStores final {
+public:
+  ~SharedCertificateStores()
+  {
+    for (auto const& store : m_stores)
+    {
+      X509_STORE_free(store.second);
+    }
+  }
+
+  // Gets the store with the certificates of caFile and caPath, or `nullptr` if they can't be
+  // loaded.
+  X509_STORE* Get(std::string const& caFile, std::string const& caPath)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const key = caFile + '\n' + caPath;
+    auto ite = m_stores.find(key);
+    if (ite != m_stores.end())
+    {
+      return ite->second;
+    }
+    X509_STORE* store = X509_STORE_new();
+    if (store != nullptr
+        && X509_STORE_load_locations(
+               store,
+               caFile.empty() ? nullptr : caFile.c_str(),
+               caPath.empty() ? nullptr : caPath.c_str())
+            != 1)
+    {
+      X509_STORE_free(store);
+      store = nullptr;
+    }
+    // A bundle which can't be loaded is loaded by libcurl, which reports the error.
+    m_stores.emplace(key, store);
+    return store;
+  }
+
+private:
+  std::mutex m_mutex;
+  std::map<std::string, X509_STORE*> m_stores;
+};
+
+SharedCertificateStores CertificateStores;
+
+// The TLS context of libcurl can only be set up with the OpenSSL linked here when libcurl uses
+// the same major version of OpenSSL.
+bool IsLibcurlUsingLinkedOpenSsl()
+{
+  static bool const isUsingLinkedOpenSsl = []() {
+    auto const versionInfo = curl_version_info(CURLVERSION_NOW);
+    if (versionInfo == nullptr || versionInfo->ssl_version == nullptr)
+    {
+      return false;
+    }
+    std::string const sslVersion(versionInfo->ssl_version);
+    std::string const prefix
+        = "OpenSSL/" + std::to_string(static_cast<unsigned long>(OPENSSL_VERSION_NUMBER) >> 28)
+        + ".";
+    return sslVersion.compare(0, prefix.size(), prefix) == 0;
+  }();
+  return isUsingLinkedOpenSsl;
+}
+
+CURLcode SetCertificateStore(CURL*, void* sslContext, void* store)
+{
+  SSL_CTX_set1_cert_store(static_cast<SSL_CTX*>(sslContext), static_cast<X509_STORE*>(store));
+  return CURLE_OK;
+}
+#endif
+
 enum class PollSocketDirection
 {
   Read = 1,
@@ -77,41 +184,72 @@ int pollSocketUntilEventOrTimeout(
   throw TransportException("Error while sending request. Platform does not support Poll()");
 #endif
 
-  struct pollfd poller;
-  poller.fd = socketFileDescriptor;
+  // Registered before the context is checked, so that cancelling it wakes up the wait.
+  Azure::Core::_detail::CancellationWaker cancellationWaker(context);
+
+  struct pollfd pollers[2];
+  pollers[0].fd = socketFileDescriptor;
 
   // set direction
   if (direction == PollSocketDirection::Read)
   {
-    poller.events = POLLIN;
+    pollers[0].events = POLLIN;
   }
   else
   {
-    poller.events = POLLOUT;
+    pollers[0].events = POLLOUT;
   }
 
-  // Call poll with the poller struct. Poll can handle multiple file descriptors by making an
-  // pollfd array and passing the size of it as the second arg. Since we are only passing one fd,
-  // we use 1 as arg.
-
-  // Cancelation is possible by calling poll() with small time intervals instead of using the
-  // requested timeout. Default interval for calling poll() is 1 sec whenever arg timeout is
-  // greater than 1 sec. Otherwise the interval is set to timeout
-  long interval = 1000; // 1 second
-  if (timeout < interval)
+  // The socket is polled with the descriptor woken up when the context is cancelled. Without one,
+  // cancellation is checked by calling poll() with time intervals of 1 sec at most.
+  bool const canWakeUp = cancellationWaker.GetDescriptor() >= 0;
+  if (canWakeUp)
   {
-    interval = timeout;
+    pollers[1].fd = static_cast<curl_socket_t>(cancellationWaker.GetDescriptor());
+    pollers[1].events = POLLIN;
   }
+  auto const pollerCount = canWakeUp ? 2u : 1u;
+  long const interval = canWakeUp ? timeout : (std::min)(timeout, 1000L);
+
+  auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
   int result = 0;
-  for (long counter = 0; counter < timeout && result == 0; counter = counter + interval)
+  for (;;)
   {
     // check cancelation
     context.ThrowIfCancelled();
+    auto const untilEnd = std::chrono::duration_cast<std::chrono::milliseconds>(
+                              end - std::chrono::steady_clock::now())
+                              .count();
+    if (untilEnd <= 0)
+    {
+      break;
+    }
+    // Wake up at the deadline of the context, like the timeout of a try, to throw right away.
+    auto const now = Azure::DateTime(std::chrono::system_clock::now());
+    int64_t const untilDeadline
+        = std::chrono::duration_cast<std::chrono::milliseconds>(context.GetDeadline() - now)
+              .count();
+    auto const pollInterval = static_cast<long>((std::max)(
+        (std::min)({static_cast<int64_t>(interval), untilEnd, untilDeadline}), int64_t(1)));
 #if defined(AZ_PLATFORM_POSIX)
-    result = poll(&poller, 1, interval);
+    result = poll(pollers, pollerCount, pollInterval);
 #elif defined(AZ_PLATFORM_WINDOWS)
-    result = WSAPoll(&poller, 1, interval);
+    result = WSAPoll(pollers, pollerCount, pollInterval);
 #endif
+    if (result > 0 && canWakeUp && pollers[1].revents != 0)
+    {
+      // The context was cancelled, which is checked on the next iteration.
+      cancellationWaker.Reset();
+      result = pollers[0].revents != 0 ? 1 : 0;
+    }
+    if (result != 0)
+    {
+      break;
+    }
+  }
+  if (result == 0)
+  {
+    context.ThrowIfCancelled();
   }
   // result can be either 0 (timeout) or > 1 (socket ready)
   return result;
@@ -139,15 +277,100 @@ void WinSocketSetBuffSize(curl_socket_t socket)
 
     if (Log::ShouldWrite(Logger::Level::Verbose))
     {
-      Log::Write(
-          Logger::Level::Verbose,
-          LogMsgPrefix + "Windows - calling setsockopt after uploading chunk. ideal = "
-              + std::to_string(ideal) + " result = " + std::to_string(result));
+      Log::Write(Logger::Level::Verbose, [&] {
+        return LogMsgPrefix + "Windows - calling setsockopt after uploading chunk. ideal = "
+            + std::to_string(ideal) + " result = " + std::to_string(result);
+      });
     }
   }
 }
 #endif
 
+// Sets the socket options that libcurl doesn't have, before the socket is connected.
+int SetSocketOptions(void* clientp, curl_socket_t socket, curlsocktype purpose)
+{
+  if (purpose != CURLSOCKTYPE_IPCXN)
+  {
+    return CURL_SOCKOPT_OK;
+  }
+  auto const& options = *static_cast<Azure::Core::Http::CurlTransportSocketOptions const*>(clientp);
+  // The system may cap the buffer sizes, which isn't worth failing the connection.
+  if (options.ReceiveBufferSize > 0)
+  {
+    int const size = options.ReceiveBufferSize;
+    setsockopt(
+        socket, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char const*>(&size), sizeof(size));
+  }
+  if (options.SendBufferSize > 0)
+  {
+    int const size = options.SendBufferSize;
+    setsockopt(
+        socket, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<char const*>(&size), sizeof(size));
+  }
+  if (!options.CongestionControl.empty())
+  {
+#if defined(TCP_CONGESTION)
+    if (setsockopt(
+            socket,
+            IPPROTO_TCP,
+            TCP_CONGESTION,
+            options.CongestionControl.c_str(),
+            static_cast<socklen_t>(options.CongestionControl.size()))
+        != 0)
+#endif
+    {
+      if (Log::ShouldWrite(Logger::Level::Warning))
+      {
+        Log::Write(Logger::Level::Warning, [&] {
+          return LogMsgPrefix + "Failed to set the congestion control algorithm to "
+              + options.CongestionControl + ". The default algorithm is used.";
+        });
+      }
+    }
+  }
+  return CURL_SOCKOPT_OK;
+}
+
+// Parses the hexadecimal chunk size at the start of [first, last), after the \r\n ending the
+// previous chunk. The chunk extensions after it are ignored. Servers can send something like
+// `\n\r\n` for a chunk of zero length data, which is allowed by RFC, so a line without any hex
+// digit is a zero-length chunk.
+size_t ParseChunkSizeLine(uint8_t const* first, uint8_t const* last)
+{
+  while (first < last && (*first == '\r' || *first == '\n' || *first == ' ' || *first == '\t'))
+  {
+    ++first;
+  }
+  size_t chunkSize = 0;
+  for (; first < last; ++first)
+  {
+    size_t digit;
+    if (*first >= '0' && *first <= '9')
+    {
+      digit = static_cast<size_t>(*first - '0');
+    }
+    else if (*first >= 'a' && *first <= 'f')
+    {
+      digit = static_cast<size_t>(*first - 'a' + 10);
+    }
+    else if (*first >= 'A' && *first <= 'F')
+    {
+      digit = static_cast<size_t>(*first - 'A' + 10);
+    }
+    else
+    {
+      break;
+    }
+    if (chunkSize > ((std::numeric_limits<size_t>::max)() >> 4))
+    {
+      throw Azure::Core::Http::TransportException(
+          "Invalid chunk size. The chunk size is too large.");
+    }
+    chunkSize = (chunkSize << 4) | digit;
+  }
+  return chunkSize;
+}
+
 void static inline SetHeader(Azure::Core::Http::RawResponse& response, std::string const& header)
 {
   return Azure::Core::Http::_detail::RawResponseHelpers::SetHeader(
@@ -156,111 +379,197 @@ void static inline SetHeader(Azure::Core::Http::RawResponse& response, std::stri
       reinterpret_cast<uint8_t const*>(header.data() + header.size()));
 }
 
-static inline std::string GetHeadersAsString(Azure::Core::Http::Request const& request)
+static inline bool IsInHeaderBlocks(
+    std::vector<std::shared_ptr<const Azure::Core::Http::_internal::HttpHeaderBlock>> const&
+        headerBlocks,
+    std::string const& name)
 {
-  std::string requestHeaderString;
-
-  for (auto const& header : request.GetHeaders())
+  for (auto const& headerBlock : headerBlocks)
   {
-    requestHeaderString += header.first; // string (key)
-    requestHeaderString += ": ";
-    requestHeaderString += header.second; // string's value
-    requestHeaderString += "\r\n";
+    if (headerBlock->Contains(name))
+    {
+      return true;
+    }
   }
-  requestHeaderString += "\r\n";
-
-  return requestHeaderString;
+  return false;
 }
 
-// Writes an HTTP request with RFC 7230 without the body (head line and headers)
+// Writes an HTTP request with RFC 7230 without the body (head line and headers) to the end of
+// \p buffer
 // https://tools.ietf.org/html/rfc7230#section-3.1.1
-static inline std::string GetHTTPMessagePreBody(Azure::Core::Http::Request const& request)
+static inline void WriteHTTPMessagePreBody(
+    Azure::Core::Http::Request const& request,
+    std::string& buffer)
 {
-  std::string httpRequest(request.GetMethod().ToString());
+  buffer += request.GetMethod().ToString();
   // HTTP version hardcoded to 1.1
-  auto const url = request.GetUrl().GetRelativeUrl();
-  httpRequest += " /" + url + " HTTP/1.1\r\n";
+  buffer += " /";
+  buffer += request.GetUrl().GetRelativeUrl();
+  buffer += " HTTP/1.1\r\n";
 
-  // headers
-  httpRequest += GetHeadersAsString(request);
+  // headers, with the header blocks as serialized
+  auto const& headerBlocks = request.GetHeaderBlocks();
+  for (auto const& headerBlock : headerBlocks)
+  {
+    buffer += headerBlock->GetSerializedHeaders();
+  }
+  for (auto const& header : request.GetHeadersReference())
+  {
+    if (IsInHeaderBlocks(headerBlocks, header.first))
+    {
+      continue;
+    }
+    buffer += header.first; // string (key)
+    buffer += ": ";
+    buffer += header.second; // string's value
+    buffer += "\r\n";
+  }
+  buffer += "\r\n";
+}
 
-  return httpRequest;
+void AddStatistics(
+    Azure::Core::Http::CurlConnectionPoolKeyStatistics& total,
+    Azure::Core::Http::CurlConnectionPoolKeyStatistics const& statistics)
+{
+  total.Hits += statistics.Hits;
+  total.Misses += statistics.Misses;
+  total.Evictions += statistics.Evictions;
+  total.ActiveConnections += statistics.ActiveConnections;
+  total.IdleConnections += statistics.IdleConnections;
+  total.AdmissionWaits += statistics.AdmissionWaits;
+  total.AdmissionWaitTime += statistics.AdmissionWaitTime;
+  total.LockWaits += statistics.LockWaits;
+  total.LockWaitTime += statistics.LockWaitTime;
 }
 
 static void CleanupThread()
 {
   using namespace Azure::Core::Http::_detail;
+  auto& pool = CurlConnectionPool::g_curlConnectionPool;
   for (;;)
   {
     Log::Write(Logger::Level::Verbose, "Clean pool check now...");
-    // Won't continue until the ConnectionPoolMutex is released from MoveConnectionBackToPool
-    std::unique_lock<std::mutex> lockForPoolCleaning(
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-    Log::Write(Logger::Level::Verbose, "Clean pool sleep");
-    // Wait for the default time OR to the signal from the conditional variable.
-    // wait_for releases the mutex lock when it goes to sleep and it takes the lock again when it
-    // wakes up (or it's cancelled).
-    if (CurlConnectionPool::g_curlConnectionPool.ConditionalVariableForCleanThread.wait_for(
-            lockForPoolCleaning,
-            std::chrono::milliseconds(DefaultCleanerIntervalMilliseconds),
-            []() {
-              return CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.size() == 0;
-            }))
-    {
-      // Cancelled by another thead or no connections on wakeup
-      Log::Write(
-          Logger::Level::Verbose,
-          "Clean pool - no connections on wake - return *************************");
-      CurlConnectionPool::g_curlConnectionPool.IsCleanThreadRunning = false;
-      break;
+    {
+      std::unique_lock<std::mutex> lockForCleanThread(pool.CleanThreadMutex);
+      Log::Write(Logger::Level::Verbose, "Clean pool sleep");
+      // Wait for the interval OR to the signal from the conditional variable, which is also sent
+      // when a connection moved to the pool makes the interval shorter.
+      // wait_for releases the mutex lock when it goes to sleep and it takes the lock again when it
+      // wakes up (or it's cancelled).
+      auto const interval = pool.CleanerIntervalMilliseconds.load();
+      if (pool.ConditionalVariableForCleanThread.wait_for(
+              lockForCleanThread,
+              std::chrono::milliseconds(interval),
+              [&pool, interval]() {
+                return pool.PooledConnectionsCount == 0
+                    || pool.CleanerIntervalMilliseconds.load() < interval;
+              })
+          && pool.PooledConnectionsCount == 0)
+      {
+        pool.IsCleanThreadRunning = false;
+        // A connection might have been moved back to the pool after checking the count and before
+        // the running flag was cleared. That connection would not start a new thread, so keep
+        // running in that case.
+        if (pool.PooledConnectionsCount == 0)
+        {
+          // Cancelled by another thead or no connections on wakeup
+          Log::Write(
+              Logger::Level::Verbose,
+              "Clean pool - no connections on wake - return *************************");
+          break;
+        }
+        pool.IsCleanThreadRunning = true;
+      }
     }
 
-    decltype(CurlConnectionPool::g_curlConnectionPool
-                 .ConnectionPoolIndex)::mapped_type connectionsToBeCleaned;
-
     Log::Write(Logger::Level::Verbose, "Clean pool - inspect pool");
-    // loop the connection pool index - Note: lock is re-taken for the mutex
-    // Notes: The size of each host-index is always expected to be greater than 0 because the
-    // host-index is removed anytime it becomes empty.
-    for (auto index = CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.begin();
-         index != CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.end();)
-    {
-      // Each pool index behaves as a Last-in-First-out (connections are added to the pool with
-      // push_front). The last connection moved to the pool will be the first to be re-used. Because
-      // of this, the oldest connection in the pool can be found at the end of the list. Looping the
-      // connection pool backwards until a connection that is not expired is found or until all
-      // connections are removed.
-      auto& connectionList = index->second;
-      auto connectionIter = connectionList.end();
-      while (connectionIter != connectionList.begin())
+    auto const previousInterval = pool.CleanerIntervalMilliseconds.load();
+    auto nextExpiration = (std::chrono::steady_clock::time_point::max)();
+    // Inspect one shard at a time, so requests for connections in other shards are not blocked
+    // while cleaning. Only the keys with an expired connection are inspected.
+    for (auto& shard : pool.ConnectionPoolShards)
+    {
+      std::vector<decltype(shard.ConnectionPoolIndex)::mapped_type::value_type>
+          connectionsToBeCleaned;
+
+      std::unique_lock<std::mutex> lockForPoolCleaning(shard.ConnectionPoolMutex);
+      auto const now = std::chrono::steady_clock::now();
+      while (!shard.ExpirationQueue.empty() && shard.ExpirationQueue.begin()->first <= now)
       {
-        --connectionIter;
-        if ((*connectionIter)->IsExpired())
+        auto const connectionKey = std::move(shard.ExpirationQueue.begin()->second);
+        shard.ExpirationQueue.erase(shard.ExpirationQueue.begin());
+        // Notes: The size of each host-index is always expected to be greater than 0 because the
+        // host-index is removed anytime it becomes empty.
+        auto index = shard.ConnectionPoolIndex.find(connectionKey);
+        if (index == shard.ConnectionPoolIndex.end())
         {
-          // remove connection from the pool and update the connection to the next one
-          // which is going to be list.end()
-          connectionsToBeCleaned.emplace_back(std::move(*connectionIter));
-          connectionIter = connectionList.erase(connectionIter);
+          continue;
         }
-        else
+
+        // Each pool index behaves as a Last-in-First-out (connections are added to the pool with
+        // push_front). The last connection moved to the pool will be the first to be re-used.
+        // Because of this, the oldest connection in the pool can be found at the end of the list.
+        // Looping the connection pool backwards until a connection that is not expired is found or
+        // until all connections are removed.
+        auto& connectionList = index->second;
+        while (!connectionList.empty() && connectionList.back().Connection->IsExpired())
         {
-          break;
+          connectionsToBeCleaned.emplace_back(std::move(connectionList.back()));
+          connectionList.pop_back();
+          --pool.PooledConnectionsCount;
+          ++shard.ConnectionPoolStatistics[connectionKey].Evictions;
         }
-      }
 
-      if (connectionList.empty())
-      {
-        Log::Write(Logger::Level::Verbose, "Clean pool - remove index " + index->first);
-        index = CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.erase(index);
+        if (connectionList.empty())
+        {
+          Log::Write(Logger::Level::Verbose, [&] {
+            return "Clean pool - remove index " + connectionKey;
+          });
+          shard.ConnectionPoolIndex.erase(index);
+          // The counters of a key without connections are kept in the ones of the shard, so the
+          // statistics don't keep every key ever used.
+          auto statistics = shard.ConnectionPoolStatistics.find(connectionKey);
+          if (statistics != shard.ConnectionPoolStatistics.end()
+              && statistics->second.ActiveConnections == 0)
+          {
+            AddStatistics(shard.PrunedStatistics, statistics->second);
+            shard.ConnectionPoolStatistics.erase(statistics);
+          }
+          continue;
+        }
+
+        // The connection was used again after it was moved to the pool, it is inspected once it
+        // can have been idle for its timeout.
+        auto& oldestConnection = connectionList.back();
+        if (oldestConnection.ExpiresOn <= now)
+        {
+          oldestConnection.ExpiresOn
+              = now + oldestConnection.Connection->GetConnectionPoolOptions().IdleConnectionTimeout;
+        }
+        shard.ScheduleExpiration(connectionKey, connectionList);
       }
-      else
+      if (!shard.ExpirationQueue.empty())
       {
-        ++index;
+        nextExpiration = (std::min)(nextExpiration, shard.ExpirationQueue.begin()->first);
       }
+
+      lockForPoolCleaning.unlock();
+      // Do actual connections release work here, without holding the mutex.
     }
 
-    lockForPoolCleaning.unlock();
-    // Do actual connections release work here, without holding the mutex.
+    // The next inspection is when the next connection expires, so the interval grows back once
+    // the connections with a short IdleConnectionTimeout are gone. It is kept when a connection
+    // moved to the pool during the inspection made it shorter.
+    int64_t nextInterval = DefaultCleanerIntervalMilliseconds;
+    if (nextExpiration != (std::chrono::steady_clock::time_point::max)())
+    {
+      auto const untilExpiration = std::chrono::duration_cast<std::chrono::milliseconds>(
+          nextExpiration - std::chrono::steady_clock::now());
+      // Rounded up, so the connection has expired by then.
+      nextInterval = (std::max)(int64_t(1), (std::min)(nextInterval, untilExpiration.count() + 1));
+    }
+    auto expectedInterval = previousInterval;
+    pool.CleanerIntervalMilliseconds.compare_exchange_strong(expectedInterval, nextInterval);
   }
 }
 } // namespace
@@ -283,12 +592,22 @@ Azure::Core::Http::_detail::CurlConnectionPool
 std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const& context)
 {
   // Create CurlSession to perform request
-  Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Creating a new session.");
+  Log::Write(Logger::Level::Verbose, [] { return LogMsgPrefix + "Creating a new session."; });
 
+  Diagnostics::HttpRequestTimings capturedTimings;
+  auto timings = Policies::_internal::InstrumentationPolicy::GetRequestTimings(context);
+  if (timings == nullptr && m_options.CaptureRequestTimings)
+  {
+    timings = &capturedTimings;
+  }
   auto session = std::make_unique<CurlSession>(
       request,
-      CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(request, m_options),
-      m_options.HttpKeepAlive);
+      CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(
+          request, m_options, false, timings, context),
+      m_options.HttpKeepAlive,
+      m_options.MaxCoalescedRequestBodySize,
+      m_options.ExpectContinueThreshold,
+      m_options.ExpectContinueTimeout);
 
   CURLcode performing;
 
@@ -300,7 +619,7 @@ std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const
        getConnectionOpenIntent < _detail::DefaultMaxOpenNewConnectionIntentsAllowed;
        getConnectionOpenIntent++)
   {
-    performing = session->Perform(context);
+    performing = session->Perform(context, timings);
     if (performing != CURLE_UNSUPPORTED_PROTOCOL && performing != CURLE_SEND_ERROR)
     {
       break;
@@ -310,13 +629,21 @@ std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const
     // clean (remove connections) and create a new one. This is because, keep getting connections
     // that fail to perform means a general network disconnection where all connections in the pool
     // won't be no longer valid.
+    // The failed connection is released first, so it doesn't count against the connection limits
+    // of the pool while getting the next one.
+    session.reset();
     session = std::make_unique<CurlSession>(
         request,
         CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(
             request,
             m_options,
-            getConnectionOpenIntent + 1 >= _detail::RequestPoolResetAfterConnectionFailed),
-        m_options.HttpKeepAlive);
+            getConnectionOpenIntent + 1 >= _detail::RequestPoolResetAfterConnectionFailed,
+            timings,
+            context),
+        m_options.HttpKeepAlive,
+        m_options.MaxCoalescedRequestBodySize,
+        m_options.ExpectContinueThreshold,
+        m_options.ExpectContinueTimeout);
   }
 
   if (performing != CURLE_OK)
@@ -325,80 +652,145 @@ std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const
         "Error while sending request. " + std::string(curl_easy_strerror(performing)));
   }
 
-  Log::Write(
-      Logger::Level::Verbose,
-      LogMsgPrefix + "Request completed. Moving response out of session and session to response.");
+  Log::Write(Logger::Level::Verbose, [] {
+    return LogMsgPrefix
+        + "Request completed. Moving response out of session and session to response.";
+  });
 
   // Move Response out of the session
   auto response = session->ExtractResponse();
   // Move the ownership of the CurlSession (bodyStream) to the response
   response->SetBodyStream(std::move(session));
+  if (m_options.CaptureRequestTimings)
+  {
+    response->SetRequestTimings(*timings);
+  }
   return response;
 }
 
-CURLcode CurlSession::Perform(Context const& context)
+CURLcode CurlSession::Perform(Context const& context, Diagnostics::HttpRequestTimings* timings)
 {
   // Set the session state
   m_sessionState = SessionState::PERFORM;
 
   // libcurl settings after connection is open (headers)
   {
-    auto headers = this->m_request.GetHeaders();
+    auto const& headers = this->m_request.GetHeadersReference();
     auto hostHeader = headers.find("Host");
     if (hostHeader == headers.end())
     {
-      Log::Write(Logger::Level::Verbose, LogMsgPrefix + "No Host in request headers. Adding it");
+      Log::Write(Logger::Level::Verbose, [] {
+        return LogMsgPrefix + "No Host in request headers. Adding it";
+      });
       this->m_request.SetHeader("Host", this->m_request.GetUrl().GetHost());
     }
     auto isContentLengthHeaderInRequest = headers.find("content-length");
     if (isContentLengthHeaderInRequest == headers.end())
     {
-      Log::Write(Logger::Level::Verbose, LogMsgPrefix + "No content-length in headers. Adding it");
+      Log::Write(Logger::Level::Verbose, [] {
+        return LogMsgPrefix + "No content-length in headers. Adding it";
+      });
       this->m_request.SetHeader(
           "content-length", std::to_string(this->m_request.GetBodyStream()->Length()));
     }
   }
 
-  // use expect:100 for PUT requests. Server will decide if it can take our request
-  if (this->m_request.GetMethod() == HttpMethod::Put)
+  // Small bodies are sent with the headers.
+  auto const bodyLength = this->m_request.GetBodyStream()->Length();
+  this->m_sendBodyWithHeaders
+      = bodyLength >= 0 && static_cast<size_t>(bodyLength) <= this->m_maxCoalescedBodySize;
+
+  // Large uploads wait for the server to accept the request before sending the body, so that a
+  // rejected request doesn't upload it in vain.
+  auto const method = this->m_request.GetMethod();
+  if (this->m_expectContinueThreshold.HasValue())
+  {
+    this->m_expectContinue = !this->m_sendBodyWithHeaders
+        && bodyLength > this->m_expectContinueThreshold.Value()
+        && (method == HttpMethod::Put || method == HttpMethod::Post
+            || method == HttpMethod::Patch);
+  }
+  else
+  {
+    this->m_expectContinue = method == HttpMethod::Put && !this->m_sendBodyWithHeaders;
+  }
+  if (this->m_expectContinue)
   {
-    Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Using 100-continue for PUT request");
+    Log::Write(
+        Logger::Level::Verbose, [] { return LogMsgPrefix + "Using 100-continue for the upload"; });
     this->m_request.SetHeader("expect", "100-continue");
   }
 
   // Send request. If the connection assigned to this curlSession is closed or the socket is
   // somehow lost, libcurl will return CURLE_UNSUPPORTED_PROTOCOL
   // (https://curl.haxx.se/libcurl/c/curl_easy_send.html). Return the error back.
-  Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Send request without payload");
+  Log::Write(Logger::Level::Verbose, [] { return LogMsgPrefix + "Send request without payload"; });
 
+  auto phaseStart = std::chrono::steady_clock::now();
   auto result = SendRawHttp(context);
   if (result != CURLE_OK)
   {
     return result;
   }
+  if (timings)
+  {
+    auto const now = std::chrono::steady_clock::now();
+    timings->RequestSend = now - phaseStart;
+    phaseStart = now;
+  }
+
+  // Servers not implementing Expect only reply once they got the body, which is sent when they
+  // don't accept the request in time.
+  if (this->m_expectContinue
+      && !m_connection->WaitUntilReadable(this->m_expectContinueTimeout, context))
+  {
+    Log::Write(Logger::Level::Verbose, [] {
+      return LogMsgPrefix + "No reply to 100-continue, upload payload";
+    });
+    result = this->UploadBody(context);
+    if (result != CURLE_OK)
+    {
+      m_sessionState = SessionState::STREAMING;
+      return result;
+    }
+    this->m_expectContinue = false;
+  }
 
-  Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Parse server response");
+  Log::Write(Logger::Level::Verbose, [] { return LogMsgPrefix + "Parse server response"; });
   ReadStatusLineAndHeadersFromRawResponse(context);
+  // A server accepting the request once its body is being sent replies twice.
+  while (!this->m_expectContinue && this->m_lastStatusCode == HttpStatusCode::Continue)
+  {
+    ReadStatusLineAndHeadersFromRawResponse(
+        context, this->m_bodyStartInBuffer < this->m_innerBufferSize);
+  }
+  if (timings)
+  {
+    timings->TimeToFirstByte = std::chrono::steady_clock::now() - phaseStart;
+  }
 
-  // non-PUT request are ready to be stream at this point. Only PUT request would start an uploading
+  // Requests without Expect are ready to be streamed at this point. The others start an uploading
   // transfer where we want to maintain the `PERFORM` state.
-  if (this->m_request.GetMethod() != HttpMethod::Put)
+  if (!this->m_expectContinue)
   {
     m_sessionState = SessionState::STREAMING;
     return result;
   }
 
-  Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Check server response before upload starts");
-  // Check server response from Expect:100-continue for PUT;
+  Log::Write(Logger::Level::Verbose, [] {
+    return LogMsgPrefix + "Check server response before upload starts";
+  });
+  // Check server response from Expect:100-continue;
   // This help to prevent us from start uploading data when Server can't handle it
   if (this->m_lastStatusCode != HttpStatusCode::Continue)
   {
-    Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Server rejected the upload request");
+    Log::Write(
+        Logger::Level::Verbose, [] { return LogMsgPrefix + "Server rejected the upload request"; });
     m_sessionState = SessionState::STREAMING;
     return result; // Won't upload.
   }
 
-  Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Upload payload");
+  Log::Write(Logger::Level::Verbose, [] { return LogMsgPrefix + "Upload payload"; });
   if (this->m_bodyStartInBuffer < this->m_innerBufferSize)
   {
     // If internal buffer has more data after the 100-continue means Server return an error.
@@ -409,15 +801,29 @@ CURLcode CurlSession::Perform(Context const& context)
   }
 
   // Start upload
+  phaseStart = std::chrono::steady_clock::now();
   result = this->UploadBody(context);
   if (result != CURLE_OK)
   {
     m_sessionState = SessionState::STREAMING;
     return result; // will throw transport exception before trying to read
   }
+  if (timings)
+  {
+    // The time to first byte of an upload with 100-continue is the one after the body.
+    auto const now = std::chrono::steady_clock::now();
+    timings->RequestSend += now - phaseStart;
+    phaseStart = now;
+  }
 
-  Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Upload completed. Parse server response");
+  Log::Write(Logger::Level::Verbose, [] {
+    return LogMsgPrefix + "Upload completed. Parse server response";
+  });
   ReadStatusLineAndHeadersFromRawResponse(context);
+  if (timings)
+  {
+    timings->TimeToFirstByte = std::chrono::steady_clock::now() - phaseStart;
+  }
   // If no throw at this point, the request is ready to stream.
   // If any throw happened before this point, the state will remain as PERFORM.
   m_sessionState = SessionState::STREAMING;
@@ -526,11 +932,30 @@ CURLcode CurlConnection::SendBuffer(
 
 CURLcode CurlSession::UploadBody(Context const& context)
 {
-  // Send body UploadStreamPageSize at a time (libcurl default)
-  // NOTE: if stream is on top a contiguous memory, we can avoid allocating this copying buffer
   auto streamBody = this->m_request.GetBodyStream();
   CURLcode sendResult = CURLE_OK;
 
+  // If stream is on top a contiguous memory, send what's left of it as is, without copying it to
+  // an upload buffer
+  auto memoryStream = dynamic_cast<Azure::Core::IO::MemoryBodyStream*>(streamBody);
+  if (memoryStream != nullptr)
+  {
+    if (memoryStream->m_offset == memoryStream->m_length)
+    {
+      return sendResult;
+    }
+    sendResult = m_connection->SendBuffer(
+        memoryStream->m_data + memoryStream->m_offset,
+        memoryStream->m_length - memoryStream->m_offset,
+        context);
+    if (sendResult == CURLE_OK)
+    {
+      memoryStream->m_offset = memoryStream->m_length;
+    }
+    return sendResult;
+  }
+
+  // Send body UploadStreamPageSize at a time (libcurl default)
   auto unique_buffer
       = std::make_unique<uint8_t[]>(static_cast<size_t>(_detail::DefaultUploadChunkSize));
 
@@ -555,15 +980,35 @@ CURLcode CurlSession::UploadBody(Context const& context)
 CURLcode CurlSession::SendRawHttp(Context const& context)
 {
   // something like GET /path HTTP1.0 \r\nheaders\r\n
-  auto rawRequest = GetHTTPMessagePreBody(this->m_request);
-  auto rawRequestLen = rawRequest.size();
+  auto& rawRequest = m_connection->GetSendBuffer();
+  rawRequest.clear();
+  WriteHTTPMessagePreBody(this->m_request, rawRequest);
+
+  if (this->m_sendBodyWithHeaders)
+  {
+    auto streamBody = this->m_request.GetBodyStream();
+    auto const preBodySize = rawRequest.size();
+    rawRequest.resize(preBodySize + static_cast<size_t>(streamBody->Length()));
+    auto const bodySize = streamBody->ReadToCount(
+        reinterpret_cast<uint8_t*>(&rawRequest[0]) + preBodySize,
+        rawRequest.size() - preBodySize,
+        context);
+    rawRequest.resize(preBodySize + bodySize);
+
+    CURLcode sendResult = m_connection->SendBuffer(
+        reinterpret_cast<uint8_t const*>(rawRequest.data()), rawRequest.size(), context);
+    if (sendResult != CURLE_OK)
+    {
+      // The request is sent again on another connection.
+      streamBody->Rewind();
+    }
+    return sendResult;
+  }
 
   CURLcode sendResult = m_connection->SendBuffer(
-      reinterpret_cast<uint8_t const*>(rawRequest.data()),
-      static_cast<size_t>(rawRequestLen),
-      context);
+      reinterpret_cast<uint8_t const*>(rawRequest.data()), rawRequest.size(), context);
 
-  if (sendResult != CURLE_OK || this->m_request.GetMethod() == HttpMethod::Put)
+  if (sendResult != CURLE_OK || this->m_expectContinue)
   {
     return sendResult;
   }
@@ -573,81 +1018,77 @@ CURLcode CurlSession::SendRawHttp(Context const& context)
 
 void CurlSession::ParseChunkSize(Context const& context)
 {
-  // Use this string to construct the chunk size. This is because we could have an internal
-  // buffer like [headers...\r\n123], where 123 is chunk size but we still need to pull more
-  // data fro wire to get the full chunkSize. Next data could be just [\r\n] or [456\r\n]
-  auto strChunkSize = std::string();
+  // Keeps the start of the chunk size line when it is split between reads. This is because we
+  // could have an internal buffer like [headers...\r\n123], where 123 is chunk size but we still
+  // need to pull more data from wire to get the full chunkSize. Next data could be just [\r\n]
+  // or [456\r\n]
+  std::string strChunkSize;
 
   // Move to after chunk size
-  for (bool keepPolling = true; keepPolling;)
+  for (;;)
   {
-    for (size_t index = this->m_bodyStartInBuffer, iteration = 0; index < this->m_innerBufferSize;
-         index++, iteration++)
-    {
-      strChunkSize.append(reinterpret_cast<char*>(&this->m_readBuffer[index]), 1);
-      if (iteration > 1 && this->m_readBuffer[index] == '\n')
-      {
-        // get chunk size. Chunk size comes in Hex value
-        try
-        {
-          // Required cast for MSVC x86
-          this->m_chunkSize = static_cast<size_t>(std::stoull(strChunkSize, nullptr, 16));
-        }
-        catch (std::invalid_argument const&)
-        {
-          // Server can return something like `\n\r\n` for a chunk of zero length data. This is
-          // allowed by RFC. `stoull` will throw invalid_argument if there is not at least one hex
-          // digit to be parsed. For those cases, we consider the response as zero-length.
-          this->m_chunkSize = 0;
-        }
-
-        if (this->m_chunkSize == 0)
-        { // Response with no content. end of chunk
-          keepPolling = false;
-          /*
-           * The index represents the current position while reading.
-           * When the chunkSize is 0, the index should have already read up to the next CRLF.
-           * When reading again, we want to start reading from the next position, so we need to add
-           * 1 to the index.
-           */
-          this->m_bodyStartInBuffer = index + 1;
-          break;
-        }
+    auto const buffer = this->m_readBuffer.data();
+    // The line starts with the \r\n ending the previous chunk data, if any. A \n in the first
+    // two characters of the line can't end it.
+    size_t searchStart = this->m_bodyStartInBuffer
+        + (strChunkSize.size() < 2 ? 2 - strChunkSize.size() : 0);
+    auto const delimiter = searchStart < this->m_innerBufferSize
+        ? static_cast<uint8_t const*>(
+            std::memchr(buffer + searchStart, '\n', this->m_innerBufferSize - searchStart))
+        : nullptr;
+    if (delimiter == nullptr)
+    { // Read all internal buffer and \n was not found, pull from wire
+      strChunkSize.append(
+          buffer + this->m_bodyStartInBuffer,
+          buffer + (std::max)(this->m_bodyStartInBuffer, this->m_innerBufferSize));
+      ReadToInnerBuffer(context);
+      continue;
+    }
+    auto const index = static_cast<size_t>(delimiter - buffer);
 
-        if (index + 1 == this->m_innerBufferSize)
-        {
-          /*
-           * index + 1 represents the next possition to Read. If that's equal to the inner buffer
-           * size it means that there is no more data and we need to fetch more from network. And
-           * whatever we fetch will be the start of the chunk data. The bodyStart is set to 0 to
-           * indicate the the next read call should read from the inner buffer start.
-           */
-          this->m_innerBufferSize = m_connection->ReadFromSocket(
-              this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
-          this->m_bodyStartInBuffer = 0;
-        }
-        else
-        {
-          /*
-           * index + 1 represents the next position to Read. If that's NOT equal to the inner
-           * buffer size, it means that there is chunk data in the inner buffer. So, we set the
-           * start to the next position to read.
-           */
-          this->m_bodyStartInBuffer = index + 1;
-        }
+    // get chunk size. Chunk size comes in Hex value
+    if (strChunkSize.empty())
+    {
+      this->m_chunkSize = ParseChunkSizeLine(buffer + this->m_bodyStartInBuffer, delimiter);
+    }
+    else
+    {
+      strChunkSize.append(buffer + this->m_bodyStartInBuffer, buffer + index);
+      auto const line = reinterpret_cast<uint8_t const*>(strChunkSize.data());
+      this->m_chunkSize = ParseChunkSizeLine(line, line + strChunkSize.size());
+    }
 
-        keepPolling = false;
-        break;
-      }
+    if (this->m_chunkSize == 0)
+    { // Response with no content. end of chunk
+      /*
+       * The index represents the current position while reading.
+       * When the chunkSize is 0, the index should have already read up to the next CRLF.
+       * When reading again, we want to start reading from the next position, so we need to add
+       * 1 to the index.
+       */
+      this->m_bodyStartInBuffer = index + 1;
     }
-    if (keepPolling)
-    { // Read all internal buffer and \n was not found, pull from wire
-      this->m_innerBufferSize = m_connection->ReadFromSocket(
-          this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
-      this->m_bodyStartInBuffer = 0;
+    else if (index + 1 == this->m_innerBufferSize)
+    {
+      /*
+       * index + 1 represents the next possition to Read. If that's equal to the inner buffer
+       * size it means that there is no more data and we need to fetch more from network. And
+       * whatever we fetch will be the start of the chunk data. The bodyStart is set to 0 to
+       * indicate the the next read call should read from the inner buffer start.
+       */
+      ReadToInnerBuffer(context);
+    }
+    else
+    {
+      /*
+       * index + 1 represents the next position to Read. If that's NOT equal to the inner
+       * buffer size, it means that there is chunk data in the inner buffer. So, we set the
+       * start to the next position to read.
+       */
+      this->m_bodyStartInBuffer = index + 1;
     }
+    return;
   }
-  return;
 }
 
 // Read status line plus headers to create a response with no body
@@ -656,47 +1097,33 @@ void CurlSession::ReadStatusLineAndHeadersFromRawResponse(
     bool reuseInternalBuffer)
 {
   auto parser = ResponseBufferParser();
-  auto bufferSize = size_t();
 
   // Keep reading until all headers were read
   while (!parser.IsParseCompleted())
   {
-    size_t bytesParsed = 0;
-    if (reuseInternalBuffer)
-    {
-      // parse from internal buffer. This means previous read from server got more than one
-      // response. This happens when Server returns a 100-continue plus an error code
-      bufferSize = this->m_innerBufferSize - this->m_bodyStartInBuffer;
-      bytesParsed = parser.Parse(this->m_readBuffer + this->m_bodyStartInBuffer, bufferSize);
-      // if parsing from internal buffer is not enough, do next read from wire
-      reuseInternalBuffer = false;
-      // reset body start
-      this->m_bodyStartInBuffer = _detail::DefaultLibcurlReaderSize;
-    }
-    else
+    // parse from internal buffer when reusing it. This means previous read from server got more
+    // than one response. This happens when Server returns a 100-continue plus an error code
+    if (!reuseInternalBuffer)
     {
       // Try to fill internal buffer from socket.
       // If response is smaller than buffer, we will get back the size of the response
-      bufferSize = m_connection->ReadFromSocket(
-          this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
-      if (bufferSize == 0)
+      if (ReadToInnerBuffer(context) == 0)
       {
         // closed connection, prevent application from keep trying to pull more bytes from the wire
         throw TransportException(
             "Connection was closed by the server while trying to read a response");
       }
-      // returns the number of bytes parsed up to the body Start
-      bytesParsed = parser.Parse(this->m_readBuffer, bufferSize);
     }
+    // if parsing from internal buffer is not enough, do next read from wire
+    reuseInternalBuffer = false;
 
-    if (bytesParsed < bufferSize)
-    {
-      this->m_bodyStartInBuffer = bytesParsed; // Body Start
-    }
+    // returns the number of bytes parsed up to the body Start
+    this->m_bodyStartInBuffer += parser.Parse(
+        this->m_readBuffer.data() + this->m_bodyStartInBuffer,
+        this->m_innerBufferSize - this->m_bodyStartInBuffer);
   }
 
   this->m_response = parser.ExtractResponse();
-  this->m_innerBufferSize = bufferSize;
   this->m_lastStatusCode = this->m_response->GetStatusCode();
 
   // For Head request, set the length of body response to 0.
@@ -709,7 +1136,7 @@ void CurlSession::ReadStatusLineAndHeadersFromRawResponse(
       || this->m_lastStatusCode == HttpStatusCode::NotModified)
   {
     this->m_contentLength = 0;
-    this->m_bodyStartInBuffer = _detail::DefaultLibcurlReaderSize;
+    this->m_bodyStartInBuffer = this->m_innerBufferSize;
     return;
   }
 
@@ -741,16 +1168,13 @@ void CurlSession::ReadStatusLineAndHeadersFromRawResponse(
       // Need to move body start after chunk size
       if (this->m_bodyStartInBuffer >= this->m_innerBufferSize)
       { // if nothing on inner buffer, pull from wire
-        this->m_innerBufferSize = m_connection->ReadFromSocket(
-            this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
-        if (this->m_innerBufferSize == 0)
+        if (ReadToInnerBuffer(context) == 0)
         {
           // closed connection, prevent application from keep trying to pull more bytes from the
           // wire
           throw TransportException(
               "Connection was closed by the server while trying to read a response");
         }
-        this->m_bodyStartInBuffer = 0;
       }
 
       ParseChunkSize(context);
@@ -766,6 +1190,23 @@ void CurlSession::ReadStatusLineAndHeadersFromRawResponse(
   */
 }
 
+size_t CurlSession::ReadToInnerBuffer(Context const& context, size_t maxSize)
+{
+  // The last read filled the buffer, there's likely more data waiting on the socket than it can
+  // hold. Grow it to take fewer reads for the rest of the response.
+  if (this->m_innerBufferSize == this->m_readBuffer.size()
+      && this->m_readBuffer.size() < _detail::MaxLibcurlReaderSize)
+  {
+    this->m_readBuffer.resize(
+        (std::min)(this->m_readBuffer.size() * 2, _detail::MaxLibcurlReaderSize));
+  }
+
+  this->m_innerBufferSize = m_connection->ReadFromSocket(
+      this->m_readBuffer.data(), (std::min)(this->m_readBuffer.size(), maxSize), context);
+  this->m_bodyStartInBuffer = 0;
+  return this->m_innerBufferSize;
+}
+
 /**
  * @brief Reads data from network and validates the data is equal to \p expected.
  *
@@ -777,15 +1218,12 @@ void CurlSession::ReadExpected(uint8_t expected, Context const& context)
   if (this->m_bodyStartInBuffer >= this->m_innerBufferSize)
   {
     // end of buffer, pull data from wire
-    this->m_innerBufferSize = m_connection->ReadFromSocket(
-        this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
-    if (this->m_innerBufferSize == 0)
+    if (ReadToInnerBuffer(context) == 0)
     {
       // closed connection, prevent application from keep trying to pull more bytes from the wire
       throw TransportException(
           "Connection was closed by the server while trying to read a response");
     }
-    this->m_bodyStartInBuffer = 0;
   }
   auto data = this->m_readBuffer[this->m_bodyStartInBuffer];
   if (data != expected)
@@ -851,7 +1289,7 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
   {
     // still have data to take from innerbuffer
     Azure::Core::IO::MemoryBodyStream innerBufferMemoryStream(
-        this->m_readBuffer + this->m_bodyStartInBuffer,
+        this->m_readBuffer.data() + this->m_bodyStartInBuffer,
         this->m_innerBufferSize - this->m_bodyStartInBuffer);
 
     // From code inspection, it is guaranteed that the readRequestLength will fit within size_t
@@ -872,7 +1310,28 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
 
   // Read from socket when no more data on internal buffer
   // For chunk request, read a chunk based on chunk size
-  totalRead = m_connection->ReadFromSocket(buffer, static_cast<size_t>(readRequestLength), context);
+  // A read taking the rest of a body with a known length goes straight to the caller's buffer,
+  // since there's nothing after it to keep in the inner buffer.
+  bool const readsRestOfBody = this->m_contentLength > 0
+      && readRequestLength
+          == static_cast<size_t>(this->m_contentLength) - this->m_sessionTotalRead;
+  if (readRequestLength < this->m_readBuffer.size() && !readsRestOfBody)
+  {
+    // Small reads fill the inner buffer, so reading the body in small parts doesn't take one call
+    // to the socket for each of them. Don't read beyond the content-length, the connection is
+    // re-used for the next request.
+    auto const maxSize = this->m_contentLength > 0
+        ? static_cast<size_t>(this->m_contentLength) - this->m_sessionTotalRead
+        : _detail::MaxLibcurlReaderSize;
+    totalRead = (std::min)(ReadToInnerBuffer(context, maxSize), readRequestLength);
+    std::copy(this->m_readBuffer.begin(), this->m_readBuffer.begin() + totalRead, buffer);
+    this->m_bodyStartInBuffer = totalRead;
+  }
+  else
+  {
+    totalRead
+        = m_connection->ReadFromSocket(buffer, static_cast<size_t>(readRequestLength), context);
+  }
   this->m_sessionTotalRead += totalRead;
 
   // Reading 0 bytes means closed connection.
@@ -896,6 +1355,38 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
   return totalRead;
 }
 
+size_t CurlSession::OnReadSpan(
+    uint8_t const*& data,
+    size_t count,
+    std::vector<uint8_t>& scratch,
+    Context const& context)
+{
+  // The next chunk size must be parsed before the bytes after the end of a chunk are lent.
+  bool const isChunkRead
+      = this->m_isChunkedResponseType && this->m_chunkSize == this->m_sessionTotalRead;
+  if (count == 0 || this->IsEOF() || isChunkRead
+      || this->m_bodyStartInBuffer >= this->m_innerBufferSize)
+  {
+    return BodyStream::OnReadSpan(data, count, scratch, context);
+  }
+
+  size_t length = (std::min)(count, this->m_innerBufferSize - this->m_bodyStartInBuffer);
+  if (this->m_isChunkedResponseType)
+  {
+    length = (std::min)(length, this->m_chunkSize - this->m_sessionTotalRead);
+  }
+  if (this->m_contentLength > 0)
+  {
+    length = (std::min)(
+        length, static_cast<size_t>(this->m_contentLength) - this->m_sessionTotalRead);
+  }
+
+  data = this->m_readBuffer.data() + this->m_bodyStartInBuffer;
+  this->m_bodyStartInBuffer += length;
+  this->m_sessionTotalRead += length;
+  return length;
+}
+
 void CurlConnection::Shutdown()
 {
 #if defined(AZ_PLATFORM_POSIX)
@@ -907,6 +1398,17 @@ void CurlConnection::Shutdown()
 }
 
 // Read from socket and return the number of bytes taken from socket
+bool CurlConnection::WaitUntilReadable(std::chrono::milliseconds timeout, Context const& context)
+{
+  auto const pollResult = pollSocketUntilEventOrTimeout(
+      context, m_curlSocket, PollSocketDirection::Read, static_cast<long>(timeout.count()));
+  if (pollResult < 0)
+  {
+    throw TransportException("Error while polling for socket ready read");
+  }
+  return pollResult != 0;
+}
+
 size_t CurlConnection::ReadFromSocket(uint8_t* buffer, size_t bufferSize, Context const& context)
 {
   // loop until read result is not CURLE_AGAIN
@@ -966,119 +1468,97 @@ size_t CurlSession::ResponseBufferParser::Parse(
     uint8_t const* const buffer,
     size_t const bufferSize)
 {
-  if (this->m_parseCompleted)
+  if (this->m_parseCompleted || bufferSize == 0)
   {
     return 0;
   }
 
-  // Read all buffer until \r\n is found
-  size_t start = 0, index = 0;
-  for (; index < bufferSize; index++)
+  size_t start = 0;
+  if (this->m_delimiterStartInPrevPosition)
+  {
+    // The previous buffer ended with \r, which wasn't added to the internal buffer.
+    this->m_delimiterStartInPrevPosition = false;
+    if (buffer[0] == '\n')
+    {
+      start = 1;
+      if (ParseLine(nullptr, nullptr))
+      {
+        return start;
+      }
+    }
+    else
+    {
+      this->m_internalBuffer.push_back('\r');
+    }
+  }
+
+  // Lines end with \r\n. A \n without \r before it is part of the line.
+  for (size_t searchStart = start; searchStart < bufferSize;)
   {
-    if (buffer[index] == '\r')
+    auto const delimiter = static_cast<uint8_t const*>(
+        std::memchr(buffer + searchStart, '\n', bufferSize - searchStart));
+    if (delimiter == nullptr)
+    {
+      break;
+    }
+    auto const index = static_cast<size_t>(delimiter - buffer);
+    searchStart = index + 1;
+    if (index == start || buffer[index - 1] != '\r')
     {
-      this->m_delimiterStartInPrevPosition = true;
       continue;
     }
 
-    if (buffer[index] == '\n' && this->m_delimiterStartInPrevPosition)
+    bool const isParseCompleted = ParseLine(buffer + start, delimiter - 1);
+    start = searchStart;
+    if (isParseCompleted)
     {
-      // found end of delimiter
-      if (this->m_internalBuffer.size() > 0) // Check internal buffer
-      {
-        // At this point, we are reading to append more to internal buffer.
-        // Only append more if index is greater than 1, meaning not when buffer is [\r\nxxx]
-        // only on buffer like [xxx\r\n yyyy], append xxx
-        if (index > 1)
-        {
-          // Previously appended something
-          this->m_internalBuffer.append(buffer + start, buffer + index - 1); // minus 1 to remove \r
-        }
-        if (this->state == ResponseParserState::StatusLine)
-        {
-          // Create Response
-          this->m_response = CreateHTTPResponse(this->m_internalBuffer);
-          // Set state to headers
-          this->state = ResponseParserState::Headers;
-          this->m_delimiterStartInPrevPosition = false;
-          start = index + 1; // jump \n
-        }
-        else if (this->state == ResponseParserState::Headers)
-        {
-          // will throw if header is invalid
-          SetHeader(*this->m_response, this->m_internalBuffer);
-          this->m_delimiterStartInPrevPosition = false;
-          start = index + 1; // jump \n
-        }
-        else
-        {
-          // Should never happen that parser is not statusLIne or Headers and we still try
-          // to parse more.
-          AZURE_UNREACHABLE_CODE();
-        }
-        // clean internal buffer
-        this->m_internalBuffer.clear();
-      }
-      else
-      {
-        // Nothing at internal buffer. Add directly from internal buffer
-        if (this->state == ResponseParserState::StatusLine)
-        {
-          // Create Response
-          this->m_response = CreateHTTPResponse(buffer + start, buffer + index - 1);
-          // Set state to headers
-          this->state = ResponseParserState::Headers;
-          this->m_delimiterStartInPrevPosition = false;
-          start = index + 1; // jump \n
-        }
-        else if (this->state == ResponseParserState::Headers)
-        {
-          // Check if this is end of headers delimiter
-          // 1) internal buffer is empty and \n is the first char on buffer [\nBody...]
-          // 2) index == start + 1. No header data after last \r\n [header\r\n\r\n]
-          if (index == 0 || index == start + 1)
-          {
-            this->m_parseCompleted = true;
-            return index + 1; // plus 1 to advance the \n. If we were at buffer end.
-          }
-
-          // will throw if header is invalid
-          Azure::Core::Http::_detail::RawResponseHelpers::SetHeader(
-              *this->m_response, buffer + start, buffer + index - 1);
-          this->m_delimiterStartInPrevPosition = false;
-          start = index + 1; // jump \n
-        }
-        else
-        {
-          // Should never happen that parser is not statusLIne or Headers and we still try
-          // to parse more.
-          AZURE_UNREACHABLE_CODE();
-        }
-      }
-    }
-    else
-    {
-      if (index == 0 && this->m_internalBuffer.size() > 0 && this->m_delimiterStartInPrevPosition)
-      {
-        // unlikely. But this means a case with buffers like [xx\r], [xxxx]
-        // \r is not delimiter and in previous loop it was omitted, so adding it now
-        this->m_internalBuffer.append("\r");
-      }
-      // \r in the response without \n after it. keep parsing
-      this->m_delimiterStartInPrevPosition = false;
+      return start;
     }
   }
 
   if (start < bufferSize)
   {
     // didn't find the end of delimiter yet, save at internal buffer
-    // If this->m_delimiterStartInPrevPosition is true, buffer ends in \r [xxxx\r]
-    // Don't add \r. IF next char is not \n, we will append \r then on next loop
+    // If the buffer ends in \r [xxxx\r], don't add \r. If next char is not \n, it is added on
+    // next call
+    this->m_delimiterStartInPrevPosition = buffer[bufferSize - 1] == '\r';
     this->m_internalBuffer.append(
         buffer + start, buffer + bufferSize - (this->m_delimiterStartInPrevPosition ? 1 : 0));
   }
 
-  return index;
+  return bufferSize;
+}
+
+bool CurlSession::ResponseBufferParser::ParseLine(uint8_t const* first, uint8_t const* last)
+{
+  // The line was split between buffers, its start is in the internal buffer.
+  if (!this->m_internalBuffer.empty())
+  {
+    this->m_internalBuffer.append(first, last);
+    first = reinterpret_cast<uint8_t const*>(this->m_internalBuffer.data());
+    last = first + this->m_internalBuffer.size();
+  }
+
+  if (this->state == ResponseParserState::StatusLine)
+  {
+    // Create Response
+    this->m_response = CreateHTTPResponse(first, last);
+    // Set state to headers
+    this->state = ResponseParserState::Headers;
+  }
+  else if (first == last)
+  {
+    // An empty line ends the headers
+    this->m_parseCompleted = true;
+  }
+  else
+  {
+    // will throw if header is invalid
+    Azure::Core::Http::_detail::RawResponseHelpers::SetHeader(*this->m_response, first, last);
+  }
+
+  this->m_internalBuffer.clear();
+  return this->m_parseCompleted;
 }
 
 // Finds delimiter '\r' as the end of the
@@ -1195,10 +1675,10 @@ size_t CurlSession::ResponseBufferParser::BuildHeader(
   }
   else
   {
-    // Internal Buffer was not required, create response directly from buffer
-    std::string header(std::string(start, indexOfEndOfStatusLine));
+    // Internal Buffer was not required, create header directly from buffer
     // will throw if header is invalid
-    SetHeader(*this->m_response, header);
+    Azure::Core::Http::_detail::RawResponseHelpers::SetHeader(
+        *this->m_response, start, indexOfEndOfStatusLine);
   }
 
   // reuse buffer
@@ -1246,36 +1726,101 @@ inline std::string GetConnectionKey(std::string const& host, CurlTransportOption
   {
     key.append("0");
   }
+  for (auto const& resolveOverride : options.DnsOptions.ResolveOverrides)
+  {
+    key.append(";");
+    key.append(resolveOverride);
+  }
+  auto const& socketOptions = options.SocketOptions;
+  if (!socketOptions.TcpNoDelay || socketOptions.ReceiveBufferSize > 0
+      || socketOptions.SendBufferSize > 0 || socketOptions.TcpKeepAlive
+      || !socketOptions.CongestionControl.empty())
+  {
+    key.append(";");
+    key.append(socketOptions.TcpNoDelay ? "1" : "0");
+    key.append(std::to_string(socketOptions.ReceiveBufferSize));
+    key.append(",");
+    key.append(std::to_string(socketOptions.SendBufferSize));
+    key.append(",");
+    if (socketOptions.TcpKeepAlive)
+    {
+      key.append(std::to_string(socketOptions.TcpKeepAliveIdle.count()));
+      key.append(":");
+      key.append(std::to_string(socketOptions.TcpKeepAliveInterval.count()));
+    }
+    else
+    {
+      key.append("0");
+    }
+    key.append(",");
+    key.append(socketOptions.CongestionControl);
+  }
   return key;
 }
 } // namespace
 
+std::string CurlConnectionPool::GetConnectionKeyForUrl(
+    Azure::Core::Url const& url,
+    CurlTransportOptions const& options)
+{
+  uint16_t port = url.GetPort();
+  return GetConnectionKey(
+      url.GetScheme() + url.GetHost() + (port != 0 ? std::to_string(port) : ""), options);
+}
+
 std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlConnection(
     Request& request,
     CurlTransportOptions const& options,
-    bool resetPool)
+    bool resetPool,
+    Diagnostics::HttpRequestTimings* timings,
+    Context const& context)
 {
+  auto const start = std::chrono::steady_clock::now();
   uint16_t port = request.GetUrl().GetPort();
   std::string const& host = request.GetUrl().GetScheme() + request.GetUrl().GetHost()
       + (port != 0 ? std::to_string(port) : "");
   std::string const connectionKey = GetConnectionKey(host, options);
 
+  // Without connection limits, requests don't go through the admission lock.
+  auto const& poolOptions = options.ConnectionPoolOptions;
+  bool const isAdmitted
+      = poolOptions.MaxConnectionsPerHost != (std::numeric_limits<size_t>::max)()
+      || poolOptions.MaxConnections != (std::numeric_limits<size_t>::max)();
+  std::chrono::steady_clock::duration admissionWait{};
+  if (isAdmitted)
   {
-    decltype(CurlConnectionPool::g_curlConnectionPool
-                 .ConnectionPoolIndex)::mapped_type connectionsToBeReset;
+    admissionWait = AdmitConnection(connectionKey, poolOptions, context);
+  }
+  // Counts the wait in the statistics of the key, once.
+  auto const addAdmissionWait = [&admissionWait](CurlConnectionPoolKeyStatistics& statistics) {
+    if (admissionWait > std::chrono::steady_clock::duration::zero())
+    {
+      ++statistics.AdmissionWaits;
+      statistics.AdmissionWaitTime += admissionWait;
+      admissionWait = std::chrono::steady_clock::duration::zero();
+    }
+  };
 
-    // Critical section. Needs to own ConnectionPoolMutex before executing
+  {
+    auto& shard = GetShard(connectionKey);
+    decltype(shard.ConnectionPoolIndex)::mapped_type connectionsToBeReset;
+
+    // Critical section. Needs to own the shard ConnectionPoolMutex before executing
     // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
-    std::unique_lock<std::mutex> lock(CurlConnectionPool::ConnectionPoolMutex);
+    auto lock = shard.Lock(connectionKey);
 
     // get a ref to the pool from the map of pools
-    auto hostPoolIndex = g_curlConnectionPool.ConnectionPoolIndex.find(connectionKey);
+    auto hostPoolIndex = shard.ConnectionPoolIndex.find(connectionKey);
 
-    if (hostPoolIndex != g_curlConnectionPool.ConnectionPoolIndex.end()
-        && hostPoolIndex->second.size() > 0)
+    if (hostPoolIndex != shard.ConnectionPoolIndex.end() && hostPoolIndex->second.size() > 0)
     {
+      auto& statistics = shard.ConnectionPoolStatistics[connectionKey];
+      addAdmissionWait(statistics);
       if (resetPool)
       {
+        PooledConnectionsCount -= hostPoolIndex->second.size();
+        statistics.Evictions += hostPoolIndex->second.size();
+        shard.UnscheduleExpiration(connectionKey, hostPoolIndex->second);
         connectionsToBeReset = std::move(hostPoolIndex->second);
         // clean the pool-index as requested in the call. Typically to force a new connection to be
         // created and to discard all current connections in the pool for the host-index. A caller
@@ -1284,19 +1829,37 @@ std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlCo
       }
       else
       {
+        // The oldest connection is only taken when it is the last one.
+        if (hostPoolIndex->second.size() == 1)
+        {
+          shard.UnscheduleExpiration(connectionKey, hostPoolIndex->second);
+        }
         // get ref to first connection
         auto fistConnectionIterator = hostPoolIndex->second.begin();
         // move the connection ref to temp ref
-        auto connection = std::move(*fistConnectionIterator);
+        auto connection = std::move(fistConnectionIterator->Connection);
         // Remove the connection ref from list
         hostPoolIndex->second.erase(fistConnectionIterator);
+        --PooledConnectionsCount;
+        ++statistics.Hits;
+        ++statistics.ActiveConnections;
 
         // Remove index if there are no more connections
         if (hostPoolIndex->second.size() == 0)
         {
-          g_curlConnectionPool.ConnectionPoolIndex.erase(hostPoolIndex);
+          shard.ConnectionPoolIndex.erase(hostPoolIndex);
         }
 
+        // The connection is kept in the pool with the options from the last transport using it.
+        connection->SetConnectionPoolOptions(options.ConnectionPoolOptions);
+        connection->SetAdmitted(isAdmitted);
+        lock.unlock();
+        if (timings)
+        {
+          *timings = Diagnostics::HttpRequestTimings();
+          timings->ConnectionPoolWait = std::chrono::steady_clock::now() - start;
+          timings->ConnectionReused = true;
+        }
         // return connection ref
         return connection;
       }
@@ -1304,8 +1867,158 @@ std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlCo
     lock.unlock();
   }
 
-  // Creating a new connection is thread safe. No need to lock mutex here.
   // No available connection for the pool for the required host. Create one
+  if (timings)
+  {
+    *timings = Diagnostics::HttpRequestTimings();
+    timings->ConnectionPoolWait = std::chrono::steady_clock::now() - start;
+  }
+  std::unique_ptr<CurlNetworkConnection> connection;
+  try
+  {
+    connection = CreateCurlConnection(request, options, timings);
+  }
+  catch (...)
+  {
+    if (isAdmitted)
+    {
+      ReleaseAdmission(connectionKey);
+    }
+    throw;
+  }
+  connection->SetAdmitted(isAdmitted);
+  {
+    auto& shard = GetShard(connectionKey);
+    auto const lock = shard.Lock(connectionKey);
+    auto& statistics = shard.ConnectionPoolStatistics[connectionKey];
+    addAdmissionWait(statistics);
+    ++statistics.Misses;
+    ++statistics.ActiveConnections;
+  }
+  return connection;
+}
+
+void CurlConnectionPool::InitShareHandle()
+{
+  m_shareHandle = curl_share_init();
+  if (m_shareHandle == nullptr)
+  {
+    return;
+  }
+  if (curl_share_setopt(m_shareHandle, CURLSHOPT_LOCKFUNC, LockSharedData) != CURLSHE_OK
+      || curl_share_setopt(m_shareHandle, CURLSHOPT_UNLOCKFUNC, UnlockSharedData) != CURLSHE_OK
+      || curl_share_setopt(m_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION)
+          != CURLSHE_OK
+      || curl_share_setopt(m_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS) != CURLSHE_OK)
+  {
+    // The connections are created without sharing anything.
+    curl_share_cleanup(m_shareHandle);
+    m_shareHandle = nullptr;
+  }
+}
+
+bool CurlConnectionPool::SetSharedCertificateStore(
+    CURL* handle,
+    CurlTransportOptions const& options)
+{
+#if defined(AZ_CURL_SHARED_CERTIFICATE_STORE)
+  if (!options.SslVerifyPeer || !IsLibcurlUsingLinkedOpenSsl())
+  {
+    return false;
+  }
+  // The store has the certificates libcurl would load: the CA bundle of the options, or the
+  // default one, and the default CA directory.
+  std::string caFile = options.CAInfo;
+  std::string caPath;
+#if LIBCURL_VERSION_NUM >= 0x075400 // 7.84.0
+  char* defaultCaFile = nullptr;
+  char* defaultCaPath = nullptr;
+  if (caFile.empty() && curl_easy_getinfo(handle, CURLINFO_CAINFO, &defaultCaFile) == CURLE_OK
+      && defaultCaFile != nullptr)
+  {
+    caFile = defaultCaFile;
+  }
+  if (curl_easy_getinfo(handle, CURLINFO_CAPATH, &defaultCaPath) == CURLE_OK
+      && defaultCaPath != nullptr)
+  {
+    caPath = defaultCaPath;
+  }
+#endif
+  if (caFile.empty() && caPath.empty())
+  {
+    return false;
+  }
+  X509_STORE* store = CertificateStores.Get(caFile, caPath);
+  if (store == nullptr)
+  {
+    return false;
+  }
+  // libcurl doesn't load any certificate, the store is set to its TLS context instead.
+  CURLcode result;
+  return SetLibcurlOption(handle, CURLOPT_SSL_CTX_FUNCTION, SetCertificateStore, &result)
+      && SetLibcurlOption(handle, CURLOPT_SSL_CTX_DATA, static_cast<void*>(store), &result)
+      && SetLibcurlOption(handle, CURLOPT_CAINFO, static_cast<char*>(nullptr), &result)
+      && SetLibcurlOption(handle, CURLOPT_CAPATH, static_cast<char*>(nullptr), &result);
+#else
+  (void)handle;
+  (void)options;
+  return false;
+#endif
+}
+
+CURLcode Azure::Core::Http::_detail::SetLibcurlSocketOptions(
+    CURL* handle,
+    CurlTransportSocketOptions const& options)
+{
+  CURLcode result;
+  if (!SetLibcurlOption(handle, CURLOPT_TCP_NODELAY, options.TcpNoDelay ? 1L : 0L, &result))
+  {
+    return result;
+  }
+  if (options.TcpKeepAlive
+      && !(SetLibcurlOption(handle, CURLOPT_TCP_KEEPALIVE, 1L, &result)
+           && SetLibcurlOption(
+               handle,
+               CURLOPT_TCP_KEEPIDLE,
+               static_cast<long>(options.TcpKeepAliveIdle.count()),
+               &result)
+           && SetLibcurlOption(
+               handle,
+               CURLOPT_TCP_KEEPINTVL,
+               static_cast<long>(options.TcpKeepAliveInterval.count()),
+               &result)))
+  {
+    return result;
+  }
+  if (options.ReceiveBufferSize > 0 || options.SendBufferSize > 0
+      || !options.CongestionControl.empty())
+  {
+    if (!(SetLibcurlOption(handle, CURLOPT_SOCKOPTFUNCTION, SetSocketOptions, &result)
+          && SetLibcurlOption(
+              handle,
+              CURLOPT_SOCKOPTDATA,
+              const_cast<void*>(static_cast<void const*>(&options)),
+              &result)))
+    {
+      return result;
+    }
+  }
+  return CURLE_OK;
+}
+
+std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::CreateCurlConnection(
+    Request const& request,
+    CurlTransportOptions const& options,
+    Diagnostics::HttpRequestTimings* timings)
+{
+  uint16_t port = request.GetUrl().GetPort();
+  std::string const& host = request.GetUrl().GetScheme() + request.GetUrl().GetHost()
+      + (port != 0 ? std::to_string(port) : "");
+  std::string const connectionKey = GetConnectionKey(host, options);
+
+  InitializeCurl();
+
+  // Creating a new connection is thread safe. No need to lock mutex here.
   CURL* newHandle = curl_easy_init();
   if (!newHandle)
   {
@@ -1360,7 +2073,73 @@ std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlCo
     }
   }
 
-  if (!options.CAInfo.empty())
+  // New connections resume the TLS sessions and use the name lookups of the previous ones. The
+  // addresses of the resolve overrides would be added to the shared DNS cache.
+  auto const& dnsOptions = options.DnsOptions;
+  if (m_shareHandle != nullptr && dnsOptions.ResolveOverrides.empty()
+      && !SetLibcurlOption(newHandle, CURLOPT_SHARE, m_shareHandle, &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + host + ". Failed to set share handle. "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+  result = SetLibcurlSocketOptions(newHandle, options.SocketOptions);
+  if (result != CURLE_OK)
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + host
+        + ". Failed to set socket options. " + std::string(curl_easy_strerror(result)));
+  }
+
+  if (!SetLibcurlOption(
+          newHandle,
+          CURLOPT_DNS_CACHE_TIMEOUT,
+          static_cast<long>(dnsOptions.CacheTimeout.count()),
+          &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + host
+        + ". Failed to set DNS cache timeout. " + std::string(curl_easy_strerror(result)));
+  }
+
+#if LIBCURL_VERSION_NUM >= 0x073B00 // 7.59.0
+  if (!SetLibcurlOption(
+          newHandle,
+          CURLOPT_HAPPY_EYEBALLS_TIMEOUT_MS,
+          static_cast<long>(dnsOptions.HappyEyeballsTimeout.count()),
+          &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + host
+        + ". Failed to set happy eyeballs timeout. " + std::string(curl_easy_strerror(result)));
+  }
+#endif
+
+  // Kept until the connection is open, when libcurl has added its addresses to the DNS cache.
+  std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)> resolveOverrides(
+      nullptr, curl_slist_free_all);
+  for (auto const& resolveOverride : dnsOptions.ResolveOverrides)
+  {
+    auto list = curl_slist_append(resolveOverrides.get(), resolveOverride.c_str());
+    if (list == nullptr)
+    {
+      throw Azure::Core::Http::TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + host
+          + ". Failed to add resolve override: " + resolveOverride);
+    }
+    resolveOverrides.release();
+    resolveOverrides.reset(list);
+  }
+  if (resolveOverrides
+      && !SetLibcurlOption(newHandle, CURLOPT_RESOLVE, resolveOverrides.get(), &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + host
+        + ". Failed to set resolve overrides. " + std::string(curl_easy_strerror(result)));
+  }
+
+  if (!SetSharedCertificateStore(newHandle, options) && !options.CAInfo.empty())
   {
     if (!SetLibcurlOption(newHandle, CURLOPT_CAINFO, options.CAInfo.c_str(), &result))
     {
@@ -1396,6 +2175,10 @@ std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlCo
   }
 
   auto performResult = curl_easy_perform(newHandle);
+  if (resolveOverrides)
+  {
+    curl_easy_setopt(newHandle, CURLOPT_RESOLVE, static_cast<curl_slist*>(nullptr));
+  }
   if (performResult != CURLE_OK)
   {
     throw Http::TransportException(
@@ -1403,7 +2186,28 @@ std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlCo
         + std::string(curl_easy_strerror(performResult)));
   }
 
-  return std::make_unique<CurlConnection>(newHandle, connectionKey);
+  if (timings)
+  {
+    // The times of libcurl are in seconds since the start of the transfer, one phase after the
+    // other.
+    double nameLookupTime = 0;
+    double connectTime = 0;
+    double tlsHandshakeTime = 0;
+    curl_easy_getinfo(newHandle, CURLINFO_NAMELOOKUP_TIME, &nameLookupTime);
+    curl_easy_getinfo(newHandle, CURLINFO_CONNECT_TIME, &connectTime);
+    curl_easy_getinfo(newHandle, CURLINFO_APPCONNECT_TIME, &tlsHandshakeTime);
+    auto const toNanoseconds = [](double seconds) {
+      return std::chrono::nanoseconds(seconds > 0 ? static_cast<int64_t>(seconds * 1e9) : 0);
+    };
+    timings->NameLookup = toNanoseconds(nameLookupTime);
+    timings->Connect = toNanoseconds(connectTime - nameLookupTime);
+    // The TLS handshake time is 0 without TLS.
+    timings->TlsHandshake = toNanoseconds(tlsHandshakeTime - connectTime);
+  }
+
+  auto connection = std::make_unique<CurlConnection>(newHandle, connectionKey);
+  connection->SetConnectionPoolOptions(options.ConnectionPoolOptions);
+  return connection;
 }
 
 // Move the connection back to the connection pool. Push it to the front so it becomes the
@@ -1412,43 +2216,125 @@ void CurlConnectionPool::MoveConnectionBackToPool(
     std::unique_ptr<CurlNetworkConnection> connection,
     HttpStatusCode lastStatusCode)
 {
+  // The key is copied, since the connection can be taken from the pool by another thread once it
+  // is moved back to it.
+  std::string const poolId = connection->GetConnectionKey();
+  auto& shard = GetShard(poolId);
+  decltype(shard.ConnectionPoolIndex)::mapped_type::value_type connectionToBeRemoved;
+  bool const isAdmitted = connection->IsAdmitted();
+  connection->SetAdmitted(false);
+
   auto code = static_cast<std::underlying_type<Http::HttpStatusCode>::type>(lastStatusCode);
   // laststatusCode = 0
-  if (code < 200 || code >= 300)
+  // A handler with previous response with Error can't be re-use.
+  // Can't re-used a shut down connection
+  bool const canBeReused = code >= 200 && code < 300 && !connection->IsShutdown();
+
+  bool isMovedToPool = false;
   {
-    // A handler with previous response with Error can't be re-use.
-    return;
+    // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
+    auto const lock = shard.Lock(poolId);
+    auto& statistics = shard.ConnectionPoolStatistics[poolId];
+    if (statistics.ActiveConnections > 0)
+    {
+      --statistics.ActiveConnections;
+    }
+
+    if (canBeReused)
+    {
+      isMovedToPool = AddConnectionToShard(shard, statistics, connection, connectionToBeRemoved);
+    }
   }
 
-  if (connection->IsShutdown())
+  if (isAdmitted)
   {
-    // Can't re-used a shut down connection
-    return;
+    // The connection is closed, when it is not moved to the pool, before a waiting request can
+    // open another one.
+    connection.reset();
+    ReleaseAdmission(poolId);
   }
 
-  Log::Write(Logger::Level::Verbose, "Moving connection to pool...");
+  if (isMovedToPool)
+  {
+    StartCleanThread();
+  }
+}
 
-  decltype(CurlConnectionPool::g_curlConnectionPool
-               .ConnectionPoolIndex)::mapped_type::value_type connectionToBeRemoved;
+bool CurlConnectionPool::AddConnectionToShard(
+    CurlConnectionPoolShard& shard,
+    CurlConnectionPoolKeyStatistics& statistics,
+    std::unique_ptr<CurlNetworkConnection>& connection,
+    CurlPooledConnection& connectionToBeRemoved)
+{
+  auto const& poolOptions = connection->GetConnectionPoolOptions();
+  if (PooledConnectionsCount >= poolOptions.MaxIdleConnections
+      || poolOptions.MaxIdleConnectionsPerHost == 0)
+  {
+    // The pool is full, the connection is closed instead of being kept.
+    ++statistics.Evictions;
+    return false;
+  }
 
-  // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
-  std::unique_lock<std::mutex> lock(CurlConnectionPool::ConnectionPoolMutex);
-  auto& poolId = connection->GetConnectionKey();
-  auto& hostPool = g_curlConnectionPool.ConnectionPoolIndex[poolId];
+  Log::Write(Logger::Level::Verbose, "Moving connection to pool...");
+  auto const& connectionKey = connection->GetConnectionKey();
+  auto& hostPool = shard.ConnectionPoolIndex[connectionKey];
 
-  if (hostPool.size() >= _detail::MaxConnectionsPerIndex && !hostPool.empty())
+  if (hostPool.size() >= poolOptions.MaxIdleConnectionsPerHost)
   {
     // Remove the last connection from the pool to insert this one.
-    auto lastConnection = --hostPool.end();
-    connectionToBeRemoved = std::move(*lastConnection);
-    hostPool.erase(lastConnection);
+    shard.UnscheduleExpiration(connectionKey, hostPool);
+    connectionToBeRemoved = std::move(hostPool.back());
+    hostPool.pop_back();
+    shard.ScheduleExpiration(connectionKey, hostPool);
+    --PooledConnectionsCount;
+    ++statistics.Evictions;
+  }
+
+  // The clean thread needs to wake up as often as the shortest idle timeout in the pool.
+  int64_t const idleTimeout = (std::max)(poolOptions.IdleConnectionTimeout.count(), int64_t(1));
+  auto cleanerInterval = CleanerIntervalMilliseconds.load();
+  if (idleTimeout < cleanerInterval)
+  {
+    // Under the lock of the clean thread, so that the thread is waiting or checks the interval.
+    std::lock_guard<std::mutex> lock(CleanThreadMutex);
+    while (idleTimeout < cleanerInterval
+           && !CleanerIntervalMilliseconds.compare_exchange_weak(cleanerInterval, idleTimeout))
+    {
+    }
+    ConditionalVariableForCleanThread.notify_one();
   }
 
   // update the time when connection was moved back to pool
   connection->UpdateLastUsageTime();
-  hostPool.push_front(std::move(connection));
+  auto const expiresOn = std::chrono::steady_clock::now() + poolOptions.IdleConnectionTimeout;
+  // The new connection is the oldest one of the key only when the list is empty.
+  bool const isOnlyConnection = hostPool.empty();
+  hostPool.push_front({std::move(connection), expiresOn});
+  if (isOnlyConnection)
+  {
+    shard.ScheduleExpiration(connectionKey, hostPool);
+  }
+  ++PooledConnectionsCount;
+  return true;
+}
 
-  if (m_cleanThread.joinable() && !IsCleanThreadRunning)
+void CurlConnectionPool::StartCleanThread()
+{
+  // Only take the clean thread lock when the clean thread is not running. This keeps returning
+  // connections to the pool from contending on a single lock.
+  if (IsCleanThreadRunning)
+  {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(CleanThreadMutex);
+  if (IsCleanThreadRunning)
+  {
+    Log::Write(Logger::Level::Verbose, "Clean thread running. Won't start a new one.");
+    return;
+  }
+
+  if (m_cleanThread.joinable())
   {
     // Clean thread was running before but it's finished, join it to finalize
     m_cleanThread.join();
@@ -1457,15 +2343,233 @@ void CurlConnectionPool::MoveConnectionBackToPool(
   // Cleanup will start a background thread which will close abandoned connections from the pool.
   // This will free-up resources from the app
   // This is the only call to cleanup.
-  if (!m_cleanThread.joinable())
+  Log::Write(Logger::Level::Verbose, "Start clean thread");
+  IsCleanThreadRunning = true;
+  m_cleanThread = std::thread(CleanupThread);
+}
+
+void CurlConnectionPool::PrewarmCurlConnections(
+    Request const& request,
+    CurlTransportOptions const& options,
+    size_t connectionsCount,
+    Context const& context)
+{
+  uint16_t port = request.GetUrl().GetPort();
+  std::string const& host = request.GetUrl().GetScheme() + request.GetUrl().GetHost()
+      + (port != 0 ? std::to_string(port) : "");
+  std::string const connectionKey = GetConnectionKey(host, options);
+
+  // Only open the connections that would be kept in the pool.
+  connectionsCount
+      = (std::min)(connectionsCount, options.ConnectionPoolOptions.MaxIdleConnectionsPerHost);
+  auto const idleConnections = ConnectionsOnPool(connectionKey);
+  if (idleConnections >= connectionsCount)
   {
-    Log::Write(Logger::Level::Verbose, "Start clean thread");
-    IsCleanThreadRunning = true;
-    m_cleanThread = std::thread(CleanupThread);
+    return;
   }
-  else
+
+  Log::Write(Logger::Level::Verbose, [&] {
+    return LogMsgPrefix + "Prewarming " + std::to_string(connectionsCount - idleConnections)
+        + " connections for " + host;
+  });
+
+  // Opening a connection blocks on DNS resolution, TCP and TLS handshakes. Open all connections
+  // in parallel.
+  std::vector<std::future<std::unique_ptr<CurlNetworkConnection>>> newConnections;
+  for (auto count = idleConnections; count < connectionsCount; count++)
   {
-    Log::Write(Logger::Level::Verbose, "Clean thread running. Won't start a new one.");
+    newConnections.emplace_back(std::async(std::launch::async, [&]() {
+      context.ThrowIfCancelled();
+      return CreateCurlConnection(request, options);
+    }));
+  }
+
+  // Keep every connection that was opened, even if some of them failed.
+  std::exception_ptr error;
+  for (auto& newConnection : newConnections)
+  {
+    try
+    {
+      auto connection = newConnection.get();
+      auto& shard = GetShard(connectionKey);
+      decltype(shard.ConnectionPoolIndex)::mapped_type::value_type connectionToBeRemoved;
+      std::lock_guard<std::mutex> lock(shard.ConnectionPoolMutex);
+      AddConnectionToShard(
+          shard, shard.ConnectionPoolStatistics[connectionKey], connection, connectionToBeRemoved);
+    }
+    catch (...)
+    {
+      if (!error)
+      {
+        error = std::current_exception();
+      }
+    }
+  }
+
+  StartCleanThread();
+
+  if (error)
+  {
+    std::rethrow_exception(error);
+  }
+}
+
+void CurlConnectionPool::DiscardConnection(std::unique_ptr<CurlNetworkConnection> connection)
+{
+  std::string const connectionKey = connection->GetConnectionKey();
+  {
+    auto& shard = GetShard(connectionKey);
+    auto const lock = shard.Lock(connectionKey);
+    auto& statistics = shard.ConnectionPoolStatistics[connectionKey];
+    if (statistics.ActiveConnections > 0)
+    {
+      --statistics.ActiveConnections;
+    }
+  }
+  // The connection is closed after the lock is released, and before a waiting request can open
+  // another one.
+  bool const isAdmitted = connection->IsAdmitted();
+  connection.reset();
+  if (isAdmitted)
+  {
+    ReleaseAdmission(connectionKey);
+  }
+}
+
+std::chrono::steady_clock::duration CurlConnectionPool::AdmitConnection(
+    std::string const& connectionKey,
+    CurlTransportConnectionPoolOptions const& options,
+    Context const& context)
+{
+  CurlConnectionAdmissionWaiter waiter;
+  waiter.ConnectionKey = connectionKey;
+  waiter.Priority = GetRequestPriority(context);
+  waiter.MaxConnectionsPerHost = (std::max)(options.MaxConnectionsPerHost, size_t(1));
+  waiter.MaxConnections = (std::max)(options.MaxConnections, size_t(1));
+  if (waiter.Priority != RequestPriority::High)
+  {
+    // The reserved connections are taken off the limits, leaving at least one connection.
+    auto const reserved = options.HighPriorityReservedConnections;
+    waiter.MaxConnectionsPerHost = waiter.MaxConnectionsPerHost > reserved
+        ? waiter.MaxConnectionsPerHost - reserved
+        : size_t(1);
+    waiter.MaxConnections
+        = waiter.MaxConnections > reserved ? waiter.MaxConnections - reserved : size_t(1);
+  }
+
+  std::unique_lock<std::mutex> lock(m_admissionMutex);
+  // A request doesn't go before the requests of the same or a higher priority already waiting for
+  // the same key.
+  bool const isKeyWaiting = std::any_of(
+      m_admissionQueue.begin(),
+      m_admissionQueue.end(),
+      [&waiter](CurlConnectionAdmissionWaiter const* queued) {
+        return queued->ConnectionKey == waiter.ConnectionKey
+            && queued->Priority >= waiter.Priority;
+      });
+  if (!isKeyWaiting && CanAdmit(waiter))
+  {
+    ++m_admittedConnections;
+    ++m_admittedConnectionsPerKey[connectionKey];
+    return std::chrono::steady_clock::duration::zero();
+  }
+
+  Log::Write(Logger::Level::Verbose, [&] {
+    return LogMsgPrefix + "Waiting for a connection to " + connectionKey;
+  });
+  auto const start = std::chrono::steady_clock::now();
+  auto const position = m_admissionQueue.insert(
+      std::find_if(
+          m_admissionQueue.begin(),
+          m_admissionQueue.end(),
+          [&waiter](CurlConnectionAdmissionWaiter const* queued) {
+            return queued->Priority < waiter.Priority;
+          }),
+      &waiter);
+  while (!waiter.IsAdmitted)
+  {
+    if (context.IsCancelled())
+    {
+      m_admissionQueue.erase(position);
+      lock.unlock();
+      context.ThrowIfCancelled();
+    }
+    waiter.Admitted.wait_for(lock, _detail::ConnectionAdmissionCheckInterval);
+  }
+  return std::chrono::steady_clock::now() - start;
+}
+
+void CurlConnectionPool::ReleaseAdmission(std::string const& connectionKey)
+{
+  std::lock_guard<std::mutex> lock(m_admissionMutex);
+  --m_admittedConnections;
+  auto admittedForKey = m_admittedConnectionsPerKey.find(connectionKey);
+  if (--admittedForKey->second == 0)
+  {
+    m_admittedConnectionsPerKey.erase(admittedForKey);
+  }
+
+  // Requests waiting for a key at its limit don't hold back the requests for other keys.
+  for (auto waiter = m_admissionQueue.begin(); waiter != m_admissionQueue.end();)
+  {
+    if (!CanAdmit(**waiter))
+    {
+      ++waiter;
+      continue;
+    }
+    ++m_admittedConnections;
+    ++m_admittedConnectionsPerKey[(*waiter)->ConnectionKey];
+    (*waiter)->IsAdmitted = true;
+    // Notified with the mutex locked, since the waiter is destroyed as soon as it returns.
+    (*waiter)->Admitted.notify_one();
+    waiter = m_admissionQueue.erase(waiter);
+  }
+}
+
+bool CurlConnectionPool::CanAdmit(CurlConnectionAdmissionWaiter const& waiter) const
+{
+  if (m_admittedConnections >= waiter.MaxConnections)
+  {
+    return false;
   }
-  lock.unlock();
+  auto const admittedForKey = m_admittedConnectionsPerKey.find(waiter.ConnectionKey);
+  return admittedForKey == m_admittedConnectionsPerKey.end()
+      || admittedForKey->second < waiter.MaxConnectionsPerHost;
+}
+
+Azure::Core::Http::CurlConnectionPoolStatistics CurlConnectionPool::GetStatistics()
+{
+  Azure::Core::Http::CurlConnectionPoolStatistics poolStatistics;
+  for (auto& shard : ConnectionPoolShards)
+  {
+    std::lock_guard<std::mutex> lock(shard.ConnectionPoolMutex);
+    for (auto const& keyStatistics : shard.ConnectionPoolStatistics)
+    {
+      auto& statistics = poolStatistics.Keys[keyStatistics.first];
+      statistics = keyStatistics.second;
+
+      auto hostPoolIndex = shard.ConnectionPoolIndex.find(keyStatistics.first);
+      statistics.IdleConnections
+          = hostPoolIndex == shard.ConnectionPoolIndex.end() ? 0 : hostPoolIndex->second.size();
+
+      AddStatistics(poolStatistics.Total, statistics);
+    }
+    AddStatistics(poolStatistics.Total, shard.PrunedStatistics);
+  }
+  return poolStatistics;
+}
+
+void CurlTransport::Prewarm(
+    Azure::Core::Url const& url,
+    size_t connectionsCount,
+    Context const& context)
+{
+  Request request(HttpMethod::Get, url);
+  CurlConnectionPool::g_curlConnectionPool.PrewarmCurlConnections(
+      request, m_options, connectionsCount, context);
+}
+
+Azure::Core::Http::CurlConnectionPoolStatistics CurlTransport::GetConnectionPoolStatistics()
+{
+  return CurlConnectionPool::g_curlConnectionPool.GetStatistics();
 }
@@ -9,14 +9,19 @@
 
 #pragma once
 
+#include "azure/core/diagnostics/instrumentation.hpp"
 #include "azure/core/dll_import_export.hpp"
 #include "azure/core/http/http.hpp"
+#include "azure/core/http/request_priority.hpp"
 
 #include "curl_connection_private.hpp"
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <curl/curl.h>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -28,11 +33,158 @@
 namespace Azure { namespace Core { namespace Test {
   class CurlConnectionPool_connectionPoolTest_Test;
   class CurlConnectionPool_uniquePort_Test;
+  class CurlConnectionPool_shardedPool_Test;
+  class CurlConnectionPool_connectionPoolOptions_Test;
+  class CurlConnectionPool_idleConnectionTimeout_Test;
+  class CurlConnectionPool_connectionAdmission_Test;
+  class CurlConnectionPool_connectionAdmissionPriority_Test;
+  class CurlConnectionPool_lockWaits_Test;
 }}} // namespace Azure::Core::Test
 #endif
 
 namespace Azure { namespace Core { namespace Http { namespace _detail {
 
+  /**
+   * @brief A slice of the connection pool guarded by its own mutex.
+   *
+   * @details Connection keys are hashed into a fixed number of shards. Threads getting or
+   * returning connections for different keys are likely to hit different shards, so they don't
+   * contend for the same lock.
+   */
+  /**
+   * @brief A connection parked in the pool.
+   *
+   */
+  struct CurlPooledConnection final
+  {
+    std::unique_ptr<CurlNetworkConnection> Connection;
+
+    /**
+     * @brief The time when the clean thread inspects the connection, which is when it becomes
+     * idle for longer than its `IdleConnectionTimeout`.
+     *
+     */
+    std::chrono::steady_clock::time_point ExpiresOn;
+  };
+
+  struct CurlConnectionPoolShard final
+  {
+    /**
+     * @brief Keeps a unique key for each host and creates a connection pool for each key.
+     *
+     * @details This way getting a connection for a specific host can be done in O(1) instead of
+     * looping a single connection list to find the first connection for the required host.
+     *
+     * @remark There might be multiple connections for each host. Each list behaves as a
+     * Last-in-First-out free list, so the oldest connection of a key is at the end of its list.
+     */
+    std::map<std::string, std::list<CurlPooledConnection>> ConnectionPoolIndex;
+
+    /**
+     * @brief The keys in the `ConnectionPoolIndex`, ordered by the time their oldest connection
+     * expires.
+     *
+     * @details The clean thread only inspects the keys at the start of the queue, so the work done
+     * while holding the shard mutex depends on the number of expired connections rather than on
+     * the size of the pool. A key must be removed from the queue with `UnscheduleExpiration()`
+     * before the end of its list changes, and added back with `ScheduleExpiration()` after.
+     */
+    std::multimap<std::chrono::steady_clock::time_point, std::string> ExpirationQueue;
+
+    /**
+     * @brief The counters for each connection key in the shard. The number of idle connections is
+     * not tracked here, it is taken from the size of the lists in the `ConnectionPoolIndex`.
+     *
+     */
+    std::map<std::string, CurlConnectionPoolKeyStatistics> ConnectionPoolStatistics;
+
+    /**
+     * @brief The counters of the keys removed from `ConnectionPoolStatistics` by the clean
+     * thread, once they had no connections left, which still count in the total.
+     *
+     */
+    CurlConnectionPoolKeyStatistics PrunedStatistics;
+
+    std::mutex ConnectionPoolMutex;
+
+    /**
+     * @brief Locks the `ConnectionPoolMutex`. When another thread owns it, the wait is counted in
+     * the statistics of \p connectionKey.
+     *
+     */
+    std::unique_lock<std::mutex> Lock(std::string const& connectionKey)
+    {
+      std::unique_lock<std::mutex> lock(ConnectionPoolMutex, std::try_to_lock);
+      if (!lock.owns_lock())
+      {
+        auto const start = std::chrono::steady_clock::now();
+        lock.lock();
+        auto& statistics = ConnectionPoolStatistics[connectionKey];
+        ++statistics.LockWaits;
+        statistics.LockWaitTime += std::chrono::steady_clock::now() - start;
+      }
+      return lock;
+    }
+
+    /**
+     * @brief Adds \p connectionKey to the `ExpirationQueue` for the oldest connection in
+     * \p connections, if there is one.
+     *
+     */
+    void ScheduleExpiration(
+        std::string const& connectionKey,
+        std::list<CurlPooledConnection> const& connections)
+    {
+      if (!connections.empty())
+      {
+        ExpirationQueue.emplace(connections.back().ExpiresOn, connectionKey);
+      }
+    }
+
+    /**
+     * @brief Removes \p connectionKey from the `ExpirationQueue`, where it was added for the
+     * oldest connection in \p connections.
+     *
+     */
+    void UnscheduleExpiration(
+        std::string const& connectionKey,
+        std::list<CurlPooledConnection> const& connections)
+    {
+      if (connections.empty())
+      {
+        return;
+      }
+      auto const range = ExpirationQueue.equal_range(connections.back().ExpiresOn);
+      for (auto entry = range.first; entry != range.second; ++entry)
+      {
+        if (entry->second == connectionKey)
+        {
+          ExpirationQueue.erase(entry);
+          return;
+        }
+      }
+    }
+  };
+
+  /**
+   * @brief A request waiting for a connection because of the `MaxConnectionsPerHost` or
+   * `MaxConnections` limits of the pool.
+   *
+   */
+  struct CurlConnectionAdmissionWaiter final
+  {
+    std::string ConnectionKey;
+    RequestPriority Priority;
+    // The limits of the priority, without the connections reserved for higher priorities.
+    size_t MaxConnectionsPerHost;
+    size_t MaxConnections;
+
+    // Set, along with the counters of the admitted connections, by the thread releasing a
+    // connection, before it notifies `Admitted`.
+    bool IsAdmitted = false;
+    std::condition_variable Admitted;
+  };
+
   /**
    * @brief CURL HTTP connection pool makes it possible to re-use one curl connection to perform
    * more than one request. Use this component when connections are not re-used by default.
@@ -45,6 +197,12 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
     // Give access to private to this tests class
     friend class Azure::Core::Test::CurlConnectionPool_connectionPoolTest_Test;
     friend class Azure::Core::Test::CurlConnectionPool_uniquePort_Test;
+    friend class Azure::Core::Test::CurlConnectionPool_shardedPool_Test;
+    friend class Azure::Core::Test::CurlConnectionPool_connectionPoolOptions_Test;
+    friend class Azure::Core::Test::CurlConnectionPool_idleConnectionTimeout_Test;
+    friend class Azure::Core::Test::CurlConnectionPool_connectionAdmission_Test;
+    friend class Azure::Core::Test::CurlConnectionPool_connectionAdmissionPriority_Test;
+    friend class Azure::Core::Test::CurlConnectionPool_lockWaits_Test;
 #endif
 
   public:
@@ -53,19 +211,58 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
       using namespace Azure::Core::Http::_detail;
       if (m_cleanThread.joinable())
       {
+        // Remove all connections
+        ClearIndex();
         {
-          std::unique_lock<std::mutex> lock(ConnectionPoolMutex);
-          // Remove all connections
-          g_curlConnectionPool.ConnectionPoolIndex.clear();
+          // Take the lock so the clean thread can't miss the signal between checking the pool
+          // and going to sleep.
+          std::lock_guard<std::mutex> lock(CleanThreadMutex);
         }
         // Signal clean thread to wake up
         ConditionalVariableForCleanThread.notify_one();
         // join thread
         m_cleanThread.join();
       }
-      curl_global_cleanup();
+      if (m_isCurlInitialized.load())
+      {
+        if (m_shareHandle != nullptr)
+        {
+          curl_share_cleanup(m_shareHandle);
+        }
+        curl_global_cleanup();
+      }
+    }
+
+    /**
+     * @brief Initializes libcurl, and its TLS library, along with the share handle of the
+     * connections, the first time it's called.
+     *
+     * @remark The pool is a static object: libcurl is initialized before the first connection is
+     * created rather than when the process starts, so that loading the library costs nothing
+     * until a request is sent.
+     */
+    void InitializeCurl()
+    {
+      if (!m_isCurlInitialized.load(std::memory_order_acquire))
+      {
+        std::call_once(m_initializeCurlFlag, [this]() {
+          curl_global_init(CURL_GLOBAL_ALL);
+          InitShareHandle();
+          m_isCurlInitialized.store(true, std::memory_order_release);
+        });
+      }
     }
 
+    /**
+     * @brief Gets the key of the connections to a URL, which the connections are pooled by.
+     *
+     * @param url The URL of a request.
+     * @param options The connection settings.
+     */
+    static std::string GetConnectionKeyForUrl(
+        Azure::Core::Url const& url,
+        CurlTransportOptions const& options);
+
     /**
      * @brief Finds a connection to be re-used from the connection pool.
      * @remark If there is not any available connection, a new connection is created.
@@ -75,13 +272,19 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
      * configuration.
      * @param resetPool Request the pool to remove all current connections for the provided
      * options to force the creation of a new connection.
+     * @param timings The timings of the request, where the time to get the connection is added to,
+     * or `nullptr`.
+     * @param context A context to cancel waiting for a connection, when the `MaxConnectionsPerHost`
+     * or `MaxConnections` limits are reached.
      *
      * @return #Azure::Core::Http::CurlNetworkConnection to use.
      */
     std::unique_ptr<CurlNetworkConnection> ExtractOrCreateCurlConnection(
         Request& request,
         CurlTransportOptions const& options,
-        bool resetPool = false);
+        bool resetPool = false,
+        Diagnostics::HttpRequestTimings* timings = nullptr,
+        Context const& context = Context::ApplicationContext);
 
     /**
      * @brief Moves a connection back to the pool to be re-used.
@@ -94,16 +297,115 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
         HttpStatusCode lastStatusCode);
 
     /**
-     * @brief Keeps a unique key for each host and creates a connection pool for each key.
+     * @brief Opens new connections in parallel and adds them to the pool, until there are \p
+     * connectionsCount idle connections for the provided options.
      *
-     * @details This way getting a connection for a specific host can be done in O(1) instead of
-     * looping a single connection list to find the first connection for the required host.
+     * @remark If opening any of the connections fails, the connections that were opened are kept
+     * in the pool and the first error is thrown.
      *
-     * @remark There might be multiple connections for each host.
+     * @param request HTTP request with the URL to open connections to.
+     * @param options The connection settings which includes host name and libcurl handle specific
+     * configuration.
+     * @param connectionsCount The number of idle connections to have in the pool.
+     * @param context A context to cancel opening the connections that haven't started yet.
      */
-    std::map<std::string, std::list<std::unique_ptr<CurlNetworkConnection>>> ConnectionPoolIndex;
+    void PrewarmCurlConnections(
+        Request const& request,
+        CurlTransportOptions const& options,
+        size_t connectionsCount,
+        Context const& context);
 
-    std::mutex ConnectionPoolMutex;
+    /**
+     * @brief Closes a connection taken from the pool that can't be re-used.
+     *
+     * @remark Use it instead of destroying the connection directly, so the pool knows the
+     * connection is no longer in use.
+     *
+     * @param connection CURL HTTP connection to be closed.
+     */
+    void DiscardConnection(std::unique_ptr<CurlNetworkConnection> connection);
+
+    /**
+     * @brief Gets a snapshot of the counters for all the connection keys in the pool.
+     *
+     */
+    CurlConnectionPoolStatistics GetStatistics();
+
+    /**
+     * @brief Gets the number of indexes in the connection pool, across all the shards.
+     *
+     */
+    size_t ConnectionPoolIndexCount()
+    {
+      size_t count = 0;
+      for (auto& shard : ConnectionPoolShards)
+      {
+        std::lock_guard<std::mutex> lock(shard.ConnectionPoolMutex);
+        count += shard.ConnectionPoolIndex.size();
+      }
+      return count;
+    }
+
+    /**
+     * @brief Removes all the connections from the pool.
+     *
+     */
+    void ClearIndex()
+    {
+      for (auto& shard : ConnectionPoolShards)
+      {
+        decltype(shard.ConnectionPoolIndex) connectionsToBeCleaned;
+        {
+          std::lock_guard<std::mutex> lock(shard.ConnectionPoolMutex);
+          for (auto const& index : shard.ConnectionPoolIndex)
+          {
+            PooledConnectionsCount -= index.second.size();
+          }
+          connectionsToBeCleaned = std::move(shard.ConnectionPoolIndex);
+          shard.ConnectionPoolIndex.clear();
+          shard.ExpirationQueue.clear();
+        }
+        // Connections are released here, without holding the shard mutex.
+      }
+    }
+
+    /**
+     * @brief Gets the shard where the connections for \p connectionKey are kept.
+     *
+     * @param connectionKey The key of a connection, as returned by
+     * #Azure::Core::Http::CurlNetworkConnection::GetConnectionKey().
+     */
+    CurlConnectionPoolShard& GetShard(std::string const& connectionKey)
+    {
+      return ConnectionPoolShards
+          [std::hash<std::string>{}(connectionKey) % ConnectionPoolShards.size()];
+    }
+
+    /**
+     * @brief The shards of the pool. Each connection key is always mapped to the same shard.
+     *
+     */
+    std::array<CurlConnectionPoolShard, ConnectionPoolShardCount> ConnectionPoolShards;
+
+    /**
+     * @brief The number of connections currently parked in the pool, across all the shards.
+     *
+     * @remark Updated while holding the lock of the shard where the connection is added or
+     * removed. The clean thread uses it to know when to finish without locking every shard.
+     */
+    std::atomic<size_t> PooledConnectionsCount{0};
+
+    /**
+     * @brief Time for the clean thread to wait before inspecting the pool again.
+     *
+     * @remark It is the time until the next connection in the pool expires, up to
+     * `DefaultCleanerIntervalMilliseconds`, and it is made shorter by a connection moved to the
+     * pool with a shorter `IdleConnectionTimeout`.
+     */
+    std::atomic<int64_t> CleanerIntervalMilliseconds{DefaultCleanerIntervalMilliseconds};
+
+    // Guards the start and finish of the clean thread.
+    std::mutex CleanThreadMutex;
 
     // This is used to put the cleaning pool thread to sleep and yet to be able to wake it if the
     // application finishes.
@@ -111,17 +413,81 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
 
     AZ_CORE_DLLEXPORT static Azure::Core::Http::_detail::CurlConnectionPool g_curlConnectionPool;
 
-    bool IsCleanThreadRunning = false;
+    std::atomic<bool> IsCleanThreadRunning{false};
 
   private:
-    // private constructor to keep this as singleton.
-    CurlConnectionPool() { curl_global_init(CURL_GLOBAL_ALL); }
+    // private constructor to keep this as singleton. It doesn't initialize libcurl, see
+    // `InitializeCurl()`.
+    CurlConnectionPool() {}
+
+    // Creates the share handle of the connections, or leaves it `nullptr` if it can't be set up.
+    void InitShareHandle();
+
+    // Sets up the TLS context of a new connection with the certificate store shared by the
+    // connections with the same CA bundle. Returns `false` when libcurl has to load the bundle.
+    static bool SetSharedCertificateStore(CURL* handle, CurlTransportOptions const& options);
 
     // Makes possible to know the number of current connections in the connection pool for an
     // index
-    size_t ConnectionsOnPool(std::string const& host) { return ConnectionPoolIndex[host].size(); };
+    size_t ConnectionsOnPool(std::string const& host)
+    {
+      auto& shard = GetShard(host);
+      std::lock_guard<std::mutex> lock(shard.ConnectionPoolMutex);
+      auto hostPoolIndex = shard.ConnectionPoolIndex.find(host);
+      return hostPoolIndex == shard.ConnectionPoolIndex.end() ? 0 : hostPoolIndex->second.size();
+    };
+
+    // Creates a new connection, without looking for one in the pool. The durations of its name
+    // lookup, connect and TLS handshake are set to `timings`, if it isn't `nullptr`.
+    std::unique_ptr<CurlNetworkConnection> CreateCurlConnection(
+        Request const& request,
+        CurlTransportOptions const& options,
+        Diagnostics::HttpRequestTimings* timings = nullptr);
+
+    // Adds a connection to the shard, when the pool limits allow it. If a connection needs to be
+    // removed to make room for it, it is moved to `connectionToBeRemoved`, so it can be released
+    // after unlocking the shard mutex. Must be called while owning the shard mutex.
+    bool AddConnectionToShard(
+        CurlConnectionPoolShard& shard,
+        CurlConnectionPoolKeyStatistics& statistics,
+        std::unique_ptr<CurlNetworkConnection>& connection,
+        CurlPooledConnection& connectionToBeRemoved);
+
+    // Starts the clean thread if it is not already running.
+    void StartCleanThread();
+
+    // Waits, behind the requests of the same or a higher priority that came first, until a
+    // connection for `connectionKey` can be used without going over the `MaxConnectionsPerHost`
+    // and `MaxConnections` limits of `options` for the priority of `context`, and counts it as
+    // admitted. Returns the time spent waiting. Throws
+    // `OperationCancelledException` if `context` is cancelled while waiting.
+    std::chrono::steady_clock::duration AdmitConnection(
+        std::string const& connectionKey,
+        CurlTransportConnectionPoolOptions const& options,
+        Context const& context);
+
+    // Stops counting an admitted connection for `connectionKey` and admits the first waiting
+    // requests which fit in their limits.
+    void ReleaseAdmission(std::string const& connectionKey);
+
+    // Whether `waiter` can be admitted now. Must be called while owning `m_admissionMutex`.
+    bool CanAdmit(CurlConnectionAdmissionWaiter const& waiter) const;
 
     std::thread m_cleanThread;
+
+    // Shares the TLS sessions and the DNS cache between the connections of the pool.
+    CURLSH* m_shareHandle = nullptr;
+
+    std::once_flag m_initializeCurlFlag;
+    std::atomic<bool> m_isCurlInitialized{false};
+
+    // Guards the admission counters and queue. It is never held along with a shard mutex.
+    std::mutex m_admissionMutex;
+    // The requests waiting for a connection, by decreasing priority and then in order of arrival.
+    std::list<CurlConnectionAdmissionWaiter*> m_admissionQueue;
+    // The connections in use which were admitted, for all the keys and for each key.
+    size_t m_admittedConnections = 0;
+    std::map<std::string, size_t> m_admittedConnectionsPerKey;
   };
 
 }}}} // namespace Azure::Core::Http::_detail
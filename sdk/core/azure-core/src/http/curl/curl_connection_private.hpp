@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "azure/core/http/curl_transport.hpp"
 #include "azure/core/http/http.hpp"
 
 #include <chrono>
@@ -21,7 +22,15 @@ namespace Azure { namespace Core { namespace Http {
     // libcurl CURL_MAX_WRITE_SIZE is 64k. Using same value for default uploading chunk size.
     // This can be customizable in the HttpRequest
     constexpr static size_t DefaultUploadChunkSize = 1024 * 64;
-    constexpr static size_t DefaultLibcurlReaderSize = 1024;
+    // The default for CurlTransportOptions::MaxCoalescedRequestBodySize.
+    constexpr static size_t DefaultMaxCoalescedRequestBodySize = 1024 * 16;
+    // The default for CurlTransportOptions::ExpectContinueTimeout.
+    constexpr static std::chrono::milliseconds DefaultExpectContinueTimeout
+        = std::chrono::seconds(1);
+    // The session starts reading the response in blocks of this size. The block doubles each time
+    // a read from the socket fills it, up to MaxLibcurlReaderSize.
+    constexpr static size_t DefaultLibcurlReaderSize = 1024 * 16;
+    constexpr static size_t MaxLibcurlReaderSize = 1024 * 256;
     // Run time error template
     constexpr static const char* DefaultFailedToGetNewConnectionTemplate
         = "Fail to get a new connection for: ";
@@ -29,13 +38,25 @@ namespace Azure { namespace Core { namespace Http {
     // After 3 connections are received from the pool and failed to send a request, the next
     // connections would ask the pool to be clean and spawn new connection.
     constexpr static int32_t RequestPoolResetAfterConnectionFailed = 3;
-    // 90 sec -> cleaner wait time before next clean routine
+    // 90 sec -> cleaner wait time before next clean routine. The cleaner wakes up sooner if a
+    // connection in the pool uses a shorter `IdleConnectionTimeout`.
     constexpr static int32_t DefaultCleanerIntervalMilliseconds = 1000 * 90;
-    // 60 sec -> expired connection is when it waits for 60 sec or more and it's not re-used
-    constexpr static int32_t DefaultConnectionExpiredMilliseconds = 1000 * 60;
-    // Define the maximun allowed connections per host-index in the pool. If this number is reached
-    // for the host-index, next connections trying to be added to the pool will be ignored.
-    constexpr static int32_t MaxConnectionsPerIndex = 1024;
+    // Define the number of independently locked shards the connection pool is split into.
+    // Connection keys are hashed to a shard, so concurrent requests to different hosts don't
+    // contend on the same mutex.
+    constexpr static size_t ConnectionPoolShardCount = 16;
+    // A request waiting for a connection because of the pool limits wakes up this often to check
+    // whether its context was cancelled.
+    constexpr static std::chrono::milliseconds ConnectionAdmissionCheckInterval{100};
+
+    /**
+     * @brief Sets the socket options of the connections created by \p handle.
+     *
+     * @remark \p options must outlive the connections created by \p handle.
+     *
+     * @return `CURLE_OK`, or the error of the first option which couldn't be set.
+     */
+    CURLcode SetLibcurlSocketOptions(CURL* handle, CurlTransportSocketOptions const& options);
   } // namespace _detail
 
   /**
@@ -48,6 +69,9 @@ namespace Azure { namespace Core { namespace Http {
   class CurlNetworkConnection {
   protected:
     bool m_isShutDown = false;
+    bool m_isAdmitted = false;
+    CurlTransportConnectionPoolOptions m_connectionPoolOptions;
+    std::string m_sendBuffer;
 
   public:
     /**
@@ -82,6 +106,19 @@ namespace Azure { namespace Core { namespace Http {
      */
     virtual size_t ReadFromSocket(uint8_t* buffer, size_t bufferSize, Context const& context) = 0;
 
+    /**
+     * @brief Waits for data to read from the socket, up to \p timeout.
+     *
+     * @return `false` if there's no data to read after \p timeout. Connections which can't wait
+     * return `true` right away.
+     */
+    virtual bool WaitUntilReadable(std::chrono::milliseconds timeout, Context const& context)
+    {
+      (void)timeout;
+      (void)context;
+      return true;
+    }
+
     /**
      * @brief This method will use libcurl socket to write all the bytes from buffer.
      *
@@ -103,6 +140,49 @@ namespace Azure { namespace Core { namespace Http {
      * @return `true` is the connection was shut it down; otherwise, `false`.
      */
     bool IsShutdown() const { return m_isShutDown; };
+
+    /**
+     * @brief Get the options used by the connection pool to keep this connection for re-use.
+     *
+     */
+    CurlTransportConnectionPoolOptions const& GetConnectionPoolOptions() const
+    {
+      return m_connectionPoolOptions;
+    }
+
+    /**
+     * @brief Set the options used by the connection pool to keep this connection for re-use.
+     *
+     * @param options The connection pool options from the transport that created this connection.
+     */
+    void SetConnectionPoolOptions(CurlTransportConnectionPoolOptions const& options)
+    {
+      m_connectionPoolOptions = options;
+    }
+
+    /**
+     * @brief Check if the connection counts against the `MaxConnectionsPerHost` and
+     * `MaxConnections` limits of the pool while it is in use.
+     *
+     */
+    bool IsAdmitted() const { return m_isAdmitted; }
+
+    /**
+     * @brief Set whether the connection counts against the `MaxConnectionsPerHost` and
+     * `MaxConnections` limits of the pool while it is in use.
+     *
+     */
+    void SetAdmitted(bool isAdmitted) { m_isAdmitted = isAdmitted; }
+
+    /**
+     * @brief Get the buffer where the requests sent on this connection are written before sending
+     * them.
+     *
+     * @remark It keeps its capacity from one request to the next one, so it isn't allocated again
+     * for each request.
+     *
+     */
+    std::string& GetSendBuffer() { return m_sendBuffer; }
   };
 
   /**
@@ -172,7 +252,7 @@ namespace Azure { namespace Core { namespace Http {
       {
         auto connectionOnWaitingTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::steady_clock::now() - this->m_lastUseTime);
-        return connectionOnWaitingTimeMs.count() >= _detail::DefaultConnectionExpiredMilliseconds;
+        return connectionOnWaitingTimeMs >= m_connectionPoolOptions.IdleConnectionTimeout;
       }
 
       /**
@@ -188,6 +268,12 @@ namespace Azure { namespace Core { namespace Http {
        */
       size_t ReadFromSocket(uint8_t* buffer, size_t bufferSize, Context const& context) override;
 
+      /**
+       * @brief Polls the socket for data to read, up to \p timeout.
+       *
+       */
+      bool WaitUntilReadable(std::chrono::milliseconds timeout, Context const& context) override;
+
       /**
        * @brief This method will use libcurl socket to write all the bytes from buffer.
        *
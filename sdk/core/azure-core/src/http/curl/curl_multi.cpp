@@ -0,0 +1,823 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/curl_multi_transport.hpp"
+#include "azure/core/http/http.hpp"
+#include "azure/core/internal/diagnostics/log.hpp"
+
+// Private include
+#include "curl_connection_pool_private.hpp"
+#include "curl_connection_private.hpp"
+#include "curl_multi_private.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <curl/curl.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using Azure::Core::Context;
+using Azure::Core::Diagnostics::Logger;
+using Azure::Core::Diagnostics::_internal::Log;
+using Azure::Core::Http::CurlMultiTransport;
+using Azure::Core::Http::HttpMethod;
+using Azure::Core::Http::HttpStatusCode;
+using Azure::Core::Http::RawResponse;
+using Azure::Core::Http::Request;
+using Azure::Core::Http::TransportException;
+using Azure::Core::Http::_detail::CurlMultiBodyStream;
+using Azure::Core::Http::_detail::CurlMultiHandle;
+using Azure::Core::Http::_detail::CurlMultiTransfer;
+
+namespace {
+std::string const LogMsgPrefix = "[CURL Multi Transport Adapter]: ";
+
+std::string const FailedToSetUpTransferTemplate = "Fail to set up the request for: ";
+
+template <typename T>
+#if defined(_MSC_VER)
+#pragma warning(push)
+// C26812: The enum type 'CURLoption' is un-scoped. Prefer 'enum class' over 'enum' (Enum.3)
+#pragma warning(disable : 26812)
+#endif
+inline void SetLibcurlOption(CURL* handle, CURLoption option, T value, std::string const& url)
+{
+  auto result = curl_easy_setopt(handle, option, value);
+  if (result != CURLE_OK)
+  {
+    throw TransportException(
+        FailedToSetUpTransferTemplate + url + ". " + std::string(curl_easy_strerror(result)));
+  }
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+// Creates the response from a status line like `HTTP/1.1 200 OK` or `HTTP/2 200`. HTTP/2 has no
+// minor version and no reason phrase.
+std::unique_ptr<RawResponse> CreateHTTPResponse(
+    uint8_t const* const begin,
+    uint8_t const* const last)
+{
+  auto start = begin + 5; // HTTP = 4, / = 1, moving to 5th place for version
+  auto end = std::find_if(start, last, [](uint8_t c) { return c == '.' || c == ' '; });
+  auto majorVersion = std::stoi(std::string(start, end));
+
+  auto minorVersion = 0;
+  if (end != last && *end == '.')
+  {
+    start = end + 1; // start of minor version
+    end = std::find(start, last, ' ');
+    minorVersion = std::stoi(std::string(start, end));
+  }
+
+  start = end + 1; // start of status code
+  end = std::find_if(start, last, [](uint8_t c) { return c == ' ' || c == '\r' || c == '\n'; });
+  auto statusCode = std::stoi(std::string(start, end));
+
+  std::string reasonPhrase;
+  if (end != last && *end == ' ')
+  {
+    start = end + 1; // start of reason phrase
+    end = std::find_if(start, last, [](uint8_t c) { return c == '\r' || c == '\n'; });
+    reasonPhrase = std::string(start, end);
+  }
+
+  return std::make_unique<RawResponse>(
+      static_cast<uint16_t>(majorVersion),
+      static_cast<uint16_t>(minorVersion),
+      HttpStatusCode(statusCode),
+      reasonPhrase);
+}
+
+// libcurl callbacks. They run on the background thread of the multi handle and must not throw,
+// errors are kept in the transfer and the transfer is aborted by returning a value libcurl
+// doesn't expect.
+size_t HeaderCallback(char* buffer, size_t size, size_t count, void* userData)
+{
+  auto transfer = static_cast<CurlMultiTransfer*>(userData);
+  size_t const length = size * count;
+  auto const first = reinterpret_cast<uint8_t const*>(buffer);
+  auto const last = first + length;
+
+  try
+  {
+    std::lock_guard<std::mutex> lock(transfer->Mutex);
+    if (transfer->HeadersReceived)
+    {
+      // Trailers are not part of the response.
+      return length;
+    }
+
+    if (length > 5 && std::memcmp(buffer, "HTTP/", 5) == 0)
+    {
+      // A new status line. It replaces informational responses like `100 Continue`.
+      transfer->Response = CreateHTTPResponse(first, last);
+    }
+    else if (*first == '\r' || *first == '\n')
+    {
+      // The empty line at the end of the headers.
+      auto const statusCode = transfer->Response == nullptr
+          ? 0
+          : static_cast<std::underlying_type<HttpStatusCode>::type>(
+              transfer->Response->GetStatusCode());
+      if (statusCode >= 200)
+      {
+        transfer->HeadersReceived = true;
+        // The transport policy downloads error responses to the response's buffer. For requests
+        // sent asynchronously, that is done here before calling back.
+        if (transfer->Callback && statusCode >= 300)
+        {
+          transfer->BufferResponse = true;
+        }
+        transfer->ConditionVariable.notify_all();
+      }
+    }
+    else if (transfer->Response != nullptr)
+    {
+      Azure::Core::Http::_detail::RawResponseHelpers::SetHeader(*transfer->Response, first, last);
+    }
+    return length;
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(transfer->Mutex);
+    transfer->Error = std::current_exception();
+    return 0;
+  }
+}
+
+size_t WriteCallback(char* buffer, size_t size, size_t count, void* userData)
+{
+  auto transfer = static_cast<CurlMultiTransfer*>(userData);
+  size_t const length = size * count;
+
+  std::lock_guard<std::mutex> lock(transfer->Mutex);
+  auto& body = transfer->Body;
+  if (!transfer->BufferResponse
+      && body.size() - transfer->BodyOffset
+          >= Azure::Core::Http::_detail::MultiMaxBufferedResponseBytes)
+  {
+    // Nobody is reading the body. libcurl keeps the data and calls back after the transfer is
+    // resumed.
+    transfer->Paused = true;
+    return CURL_WRITEFUNC_PAUSE;
+  }
+
+  // Drop the bytes already read once they are half of the buffer, so the buffer doesn't keep
+  // growing while the body is read.
+  if (transfer->BodyOffset > 0 && transfer->BodyOffset >= body.size() / 2)
+  {
+    body.erase(body.begin(), body.begin() + transfer->BodyOffset);
+    transfer->BodyOffset = 0;
+  }
+
+  body.insert(body.end(), buffer, buffer + length);
+  transfer->ConditionVariable.notify_all();
+  return length;
+}
+
+size_t ReadCallback(char* buffer, size_t size, size_t count, void* userData)
+{
+  auto transfer = static_cast<CurlMultiTransfer*>(userData);
+
+  // The request body is only read from the background thread while the transfer runs.
+  try
+  {
+    return transfer->HttpRequest->GetBodyStream()->Read(
+        reinterpret_cast<uint8_t*>(buffer), size * count, transfer->TransferContext);
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(transfer->Mutex);
+    transfer->Error = std::current_exception();
+    return CURL_READFUNC_ABORT;
+  }
+}
+
+// For Head request, and NoContent and NotModified responses, the content-length is the one the
+// body would have, but the server doesn't send a body.
+int64_t GetContentLength(Request const& request, RawResponse const& response)
+{
+  auto const statusCode = response.GetStatusCode();
+  if (request.GetMethod() == HttpMethod::Head || statusCode == HttpStatusCode::NoContent
+      || statusCode == HttpStatusCode::NotModified)
+  {
+    return 0;
+  }
+
+  auto const& headers = response.GetHeaders();
+  auto const contentLengthHeader = headers.find("content-length");
+  if (contentLengthHeader != headers.end())
+  {
+    return static_cast<int64_t>(std::stoull(contentLengthHeader->second));
+  }
+  return -1;
+}
+
+CURLM* CreateMultiHandle()
+{
+  // libcurl is initialized by the connection pool the first time it's used.
+  Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.InitializeCurl();
+  return curl_multi_init();
+}
+} // namespace
+
+namespace Azure { namespace Core { namespace Http { namespace _detail {
+
+  CurlMultiHandle::CurlMultiHandle(CurlMultiTransportOptions const& options)
+      : m_options(options), m_multiHandle(CreateMultiHandle())
+  {
+    if (m_multiHandle == nullptr)
+    {
+      throw TransportException("Fail to create the multi handle. curl_multi_init returned Null");
+    }
+
+    curl_multi_setopt(m_multiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    curl_multi_setopt(
+        m_multiHandle,
+        CURLMOPT_MAX_HOST_CONNECTIONS,
+        static_cast<long>(m_options.MaxConnectionsPerHost));
+#if LIBCURL_VERSION_NUM >= 0x074300 // 7.67.0
+    curl_multi_setopt(
+        m_multiHandle,
+        CURLMOPT_MAX_CONCURRENT_STREAMS,
+        static_cast<long>(m_options.MaxConcurrentStreams));
+#endif
+
+    m_thread = std::thread(&CurlMultiHandle::Run, this);
+  }
+
+  CurlMultiHandle::~CurlMultiHandle()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    Wakeup();
+    m_thread.join();
+
+    // Body streams keep the multi handle alive, so no one is waiting for these transfers.
+    for (auto& transfer : m_transfers)
+    {
+      curl_multi_remove_handle(m_multiHandle, transfer.first);
+    }
+    m_transfers.clear();
+    curl_multi_cleanup(m_multiHandle);
+  }
+
+  void CurlMultiHandle::Wakeup()
+  {
+#if LIBCURL_VERSION_NUM >= 0x074400 // 7.68.0
+    curl_multi_wakeup(m_multiHandle);
+#endif
+  }
+
+  std::shared_ptr<CurlMultiTransfer> CurlMultiHandle::CreateTransfer(
+      Request& request,
+      Context const& context)
+  {
+    auto const url = request.GetUrl().GetAbsoluteUrl();
+    auto transfer = std::make_shared<CurlMultiTransfer>(request, context);
+    transfer->EasyHandle = curl_easy_init();
+    if (transfer->EasyHandle == nullptr)
+    {
+      throw TransportException(
+          FailedToSetUpTransferTemplate + url + ". curl_easy_init returned Null");
+    }
+    auto handle = transfer->EasyHandle;
+
+    SetLibcurlOption(handle, CURLOPT_URL, url.c_str(), url);
+    // The background thread can't be interrupted by signals while resolving names.
+    SetLibcurlOption(handle, CURLOPT_NOSIGNAL, 1L, url);
+    // Same timeout as the connections from the CurlTransport: 24h. Libcurl fails uploading on
+    // Windows with higher values.
+    SetLibcurlOption(handle, CURLOPT_TIMEOUT, 60L * 60L * 24L, url);
+
+    auto const& options = m_options.ConnectionOptions;
+    if (!options.Proxy.empty())
+    {
+      SetLibcurlOption(handle, CURLOPT_PROXY, options.Proxy.c_str(), url);
+    }
+    if (!options.CAInfo.empty())
+    {
+      SetLibcurlOption(handle, CURLOPT_CAINFO, options.CAInfo.c_str(), url);
+    }
+    auto const socketResult = Azure::Core::Http::_detail::SetLibcurlSocketOptions(
+        handle, options.SocketOptions);
+    if (socketResult != CURLE_OK)
+    {
+      throw TransportException(
+          FailedToSetUpTransferTemplate + url + ". "
+          + std::string(curl_easy_strerror(socketResult)));
+    }
+    // The transfers of a multi handle share its DNS cache.
+    auto const& dnsOptions = options.DnsOptions;
+    SetLibcurlOption(
+        handle,
+        CURLOPT_DNS_CACHE_TIMEOUT,
+        static_cast<long>(dnsOptions.CacheTimeout.count()),
+        url);
+#if LIBCURL_VERSION_NUM >= 0x073B00 // 7.59.0
+    SetLibcurlOption(
+        handle,
+        CURLOPT_HAPPY_EYEBALLS_TIMEOUT_MS,
+        static_cast<long>(dnsOptions.HappyEyeballsTimeout.count()),
+        url);
+#endif
+    for (auto const& resolveOverride : dnsOptions.ResolveOverrides)
+    {
+      auto list = curl_slist_append(transfer->ResolveOverrides, resolveOverride.c_str());
+      if (list == nullptr)
+      {
+        throw TransportException(
+            FailedToSetUpTransferTemplate + url
+            + ". Failed to add resolve override: " + resolveOverride);
+      }
+      transfer->ResolveOverrides = list;
+    }
+    if (transfer->ResolveOverrides != nullptr)
+    {
+      SetLibcurlOption(handle, CURLOPT_RESOLVE, transfer->ResolveOverrides, url);
+    }
+    long sslOption = 0;
+    if (!options.SslOptions.EnableCertificateRevocationListCheck)
+    {
+      sslOption |= CURLSSLOPT_NO_REVOKE;
+    }
+    SetLibcurlOption(handle, CURLOPT_SSL_OPTIONS, sslOption, url);
+    if (!options.SslVerifyPeer)
+    {
+      SetLibcurlOption(handle, CURLOPT_SSL_VERIFYPEER, 0L, url);
+    }
+
+    if (m_options.EnableHttp2)
+    {
+#if LIBCURL_VERSION_NUM >= 0x072F00 // 7.47.0
+      SetLibcurlOption(
+          handle, CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_2TLS), url);
+#else
+      SetLibcurlOption(
+          handle, CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_2_0), url);
+#endif
+      // Wait for a connection that can multiplex the request instead of opening a new one.
+      SetLibcurlOption(handle, CURLOPT_PIPEWAIT, 1L, url);
+    }
+    else
+    {
+      SetLibcurlOption(
+          handle, CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_1_1), url);
+    }
+
+    auto const method = request.GetMethod();
+    if (method == HttpMethod::Head)
+    {
+      SetLibcurlOption(handle, CURLOPT_NOBODY, 1L, url);
+    }
+    else if (method != HttpMethod::Get)
+    {
+      SetLibcurlOption(handle, CURLOPT_CUSTOMREQUEST, method.ToString().c_str(), url);
+      SetLibcurlOption(handle, CURLOPT_UPLOAD, 1L, url);
+      auto const bodyLength = request.GetBodyStream()->Length();
+      if (bodyLength >= 0)
+      {
+        SetLibcurlOption(
+            handle, CURLOPT_INFILESIZE_LARGE, static_cast<curl_off_t>(bodyLength), url);
+      }
+      SetLibcurlOption(handle, CURLOPT_READFUNCTION, ReadCallback, url);
+      SetLibcurlOption(handle, CURLOPT_READDATA, static_cast<void*>(transfer.get()), url);
+    }
+
+    auto appendHeader = [&](std::string const& header) {
+      auto headers = curl_slist_append(transfer->Headers, header.c_str());
+      if (headers == nullptr)
+      {
+        throw TransportException(
+            FailedToSetUpTransferTemplate + url + ". Failed to add header: " + header);
+      }
+      transfer->Headers = headers;
+    };
+    for (auto const& header : request.GetHeadersReference())
+    {
+      // libcurl removes a header set as `name:`, a header without value is set as `name;`.
+      appendHeader(header.first + (header.second.empty() ? ";" : ": " + header.second));
+    }
+    // Only wait for `100 Continue` before uploading a body above the threshold of the options,
+    // otherwise the server can still reply with an error before the upload is completed.
+    auto const& expectContinueThreshold = m_options.ConnectionOptions.ExpectContinueThreshold;
+    if (expectContinueThreshold.HasValue()
+        && (method == HttpMethod::Put || method == HttpMethod::Post
+            || method == HttpMethod::Patch)
+        && request.GetBodyStream()->Length() > expectContinueThreshold.Value())
+    {
+      appendHeader("Expect: 100-continue");
+      SetLibcurlOption(
+          handle,
+          CURLOPT_EXPECT_100_TIMEOUT_MS,
+          static_cast<long>(m_options.ConnectionOptions.ExpectContinueTimeout.count()),
+          url);
+    }
+    else
+    {
+      appendHeader("Expect:");
+    }
+    SetLibcurlOption(handle, CURLOPT_HTTPHEADER, transfer->Headers, url);
+
+    SetLibcurlOption(handle, CURLOPT_HEADERFUNCTION, HeaderCallback, url);
+    SetLibcurlOption(handle, CURLOPT_HEADERDATA, static_cast<void*>(transfer.get()), url);
+    SetLibcurlOption(handle, CURLOPT_WRITEFUNCTION, WriteCallback, url);
+    SetLibcurlOption(handle, CURLOPT_WRITEDATA, static_cast<void*>(transfer.get()), url);
+
+    return transfer;
+  }
+
+  void CurlMultiHandle::Add(std::shared_ptr<CurlMultiTransfer> transfer)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_transfersToAdd.emplace_back(std::move(transfer));
+    }
+    Wakeup();
+  }
+
+  void CurlMultiHandle::Resume(std::shared_ptr<CurlMultiTransfer> transfer)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_transfersToResume.emplace_back(std::move(transfer));
+    }
+    Wakeup();
+  }
+
+  void CurlMultiHandle::Remove(std::shared_ptr<CurlMultiTransfer> transfer)
+  {
+    // A response dropped from a callback is removed right away, the background thread can't wait
+    // for itself.
+    if (IsBackgroundThread())
+    {
+      RemoveTransfer(transfer, CURLE_ABORTED_BY_CALLBACK);
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(transfer->Mutex);
+      if (transfer->Removed)
+      {
+        return;
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_transfersToRemove.emplace_back(transfer);
+    }
+    Wakeup();
+
+    std::unique_lock<std::mutex> lock(transfer->Mutex);
+    transfer->ConditionVariable.wait(lock, [&transfer]() { return transfer->Removed; });
+  }
+
+  void CurlMultiHandle::RemoveTransfer(
+      std::shared_ptr<CurlMultiTransfer> const& transfer,
+      CURLcode result)
+  {
+    auto found = m_transfers.find(transfer->EasyHandle);
+    if (found != m_transfers.end())
+    {
+      curl_multi_remove_handle(m_multiHandle, transfer->EasyHandle);
+      m_transfers.erase(found);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(transfer->Mutex);
+      if (!transfer->Done)
+      {
+        transfer->Done = true;
+        transfer->Result = result;
+      }
+      transfer->Removed = true;
+    }
+    transfer->ConditionVariable.notify_all();
+  }
+
+  void CurlMultiHandle::Run()
+  {
+    while (true)
+    {
+      decltype(m_transfersToAdd) transfersToAdd;
+      decltype(m_transfersToResume) transfersToResume;
+      decltype(m_transfersToRemove) transfersToRemove;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stop)
+        {
+          return;
+        }
+        transfersToAdd.swap(m_transfersToAdd);
+        transfersToResume.swap(m_transfersToResume);
+        transfersToRemove.swap(m_transfersToRemove);
+      }
+
+      for (auto& transfer : transfersToAdd)
+      {
+        if (transfer->Callback)
+        {
+          m_pendingCallbacks.emplace_back(transfer);
+        }
+        if (curl_multi_add_handle(m_multiHandle, transfer->EasyHandle) == CURLM_OK)
+        {
+          m_transfers.emplace(transfer->EasyHandle, transfer);
+        }
+        else
+        {
+          RemoveTransfer(transfer, CURLE_FAILED_INIT);
+        }
+      }
+
+      for (auto& transfer : transfersToResume)
+      {
+        // The transfer may have been completed or removed since it was paused.
+        if (m_transfers.find(transfer->EasyHandle) != m_transfers.end())
+        {
+          curl_easy_pause(transfer->EasyHandle, CURLPAUSE_CONT);
+        }
+      }
+
+      for (auto& transfer : transfersToRemove)
+      {
+        RemoveTransfer(transfer, CURLE_ABORTED_BY_CALLBACK);
+      }
+
+      int runningHandles = 0;
+      curl_multi_perform(m_multiHandle, &runningHandles);
+
+      CURLMsg* message;
+      int messagesLeft = 0;
+      while ((message = curl_multi_info_read(m_multiHandle, &messagesLeft)) != nullptr)
+      {
+        if (message->msg != CURLMSG_DONE)
+        {
+          continue;
+        }
+        // The message is released when the handle is removed.
+        auto const result = message->data.result;
+        auto found = m_transfers.find(message->easy_handle);
+        if (found != m_transfers.end())
+        {
+          auto transfer = found->second;
+          RemoveTransfer(transfer, result);
+        }
+      }
+
+      RunCallbacks();
+
+#if LIBCURL_VERSION_NUM >= 0x074400 // 7.68.0
+      curl_multi_poll(
+          m_multiHandle,
+          nullptr,
+          0,
+          m_pendingCallbacks.empty() ? 1000 : MultiAsyncPollTimeoutMilliseconds,
+          nullptr);
+#else
+      curl_multi_wait(m_multiHandle, nullptr, 0, MultiPollTimeoutMilliseconds, nullptr);
+#endif
+    }
+  }
+
+  void CurlMultiHandle::RunCallbacks()
+  {
+    for (auto pending = m_pendingCallbacks.begin(); pending != m_pendingCallbacks.end();)
+    {
+      auto transfer = *pending;
+      std::unique_ptr<RawResponse> response;
+      std::exception_ptr error;
+      bool bufferResponse;
+      {
+        std::unique_lock<std::mutex> lock(transfer->Mutex);
+        if (!transfer->Done && (!transfer->HeadersReceived || transfer->BufferResponse))
+        {
+          if (!transfer->TransferContext.IsCancelled())
+          {
+            ++pending;
+            continue;
+          }
+          transfer->Error = std::make_exception_ptr(
+              Azure::Core::OperationCancelledException("Request was cancelled by context."));
+          lock.unlock();
+          RemoveTransfer(transfer, CURLE_ABORTED_BY_CALLBACK);
+          lock.lock();
+        }
+
+        bufferResponse = transfer->BufferResponse;
+        if (transfer->Error)
+        {
+          error = transfer->Error;
+        }
+        else if (!transfer->HeadersReceived)
+        {
+          error = std::make_exception_ptr(TransportException(
+              "Error while sending request. " + std::string(curl_easy_strerror(transfer->Result))));
+        }
+        else if (bufferResponse && transfer->Result != CURLE_OK)
+        {
+          error = std::make_exception_ptr(TransportException(
+              "Error while reading the response. "
+              + std::string(curl_easy_strerror(transfer->Result))));
+        }
+        else
+        {
+          response = std::move(transfer->Response);
+          if (bufferResponse)
+          {
+            if (transfer->BodyOffset == 0)
+            {
+              response->SetBody(std::move(transfer->Body));
+            }
+            else
+            {
+              response->SetBody(std::vector<uint8_t>(
+                  transfer->Body.begin() + transfer->BodyOffset, transfer->Body.end()));
+            }
+            transfer->Body.clear();
+            transfer->BodyOffset = 0;
+          }
+        }
+      }
+      pending = m_pendingCallbacks.erase(pending);
+
+      if (response != nullptr && !bufferResponse)
+      {
+        response->SetBodyStream(std::make_unique<CurlMultiBodyStream>(
+            shared_from_this(),
+            transfer,
+            GetContentLength(*transfer->HttpRequest, *response)));
+      }
+
+      auto callback = std::move(transfer->Callback);
+      transfer->Callback = nullptr;
+      try
+      {
+        callback(std::move(response), error);
+      }
+      catch (std::exception const& e)
+      {
+        Log::Write(
+            Logger::Level::Error,
+            LogMsgPrefix + "Exception thrown from a completion callback. " + e.what());
+      }
+      catch (...)
+      {
+        Log::Write(Logger::Level::Error, [] {
+          return LogMsgPrefix + "Exception thrown from a completion callback.";
+        });
+      }
+
+      // This can release the last reference to the multi handle. See the CurlMultiTransport
+      // constructor.
+      transfer->KeepAlive.reset();
+    }
+  }
+
+  size_t CurlMultiBodyStream::OnRead(uint8_t* buffer, size_t count, Context const& context)
+  {
+    std::unique_lock<std::mutex> lock(m_transfer->Mutex);
+    while (m_transfer->BodyOffset == m_transfer->Body.size() && !m_transfer->Done)
+    {
+      if (m_multiHandle->IsBackgroundThread())
+      {
+        throw TransportException(
+            "Error while reading the response. The body can't be read from a completion callback "
+            "before it is downloaded.");
+      }
+      if (context.IsCancelled())
+      {
+        lock.unlock();
+        context.ThrowIfCancelled();
+      }
+      m_transfer->ConditionVariable.wait_for(lock, MultiCancellationCheckInterval);
+    }
+
+    auto const available = m_transfer->Body.size() - m_transfer->BodyOffset;
+    if (available == 0)
+    {
+      // The transfer is done and the whole body was read.
+      if (m_transfer->Error)
+      {
+        std::rethrow_exception(m_transfer->Error);
+      }
+      if (m_transfer->Result != CURLE_OK)
+      {
+        throw TransportException(
+            "Error while reading the response. "
+            + std::string(curl_easy_strerror(m_transfer->Result)));
+      }
+      return 0;
+    }
+
+    auto const copied = (std::min)(count, available);
+    std::memcpy(buffer, m_transfer->Body.data() + m_transfer->BodyOffset, copied);
+    m_transfer->BodyOffset += copied;
+    if (m_transfer->BodyOffset == m_transfer->Body.size())
+    {
+      m_transfer->Body.clear();
+      m_transfer->BodyOffset = 0;
+    }
+
+    bool const resume = m_transfer->Paused
+        && m_transfer->Body.size() - m_transfer->BodyOffset < MultiMaxBufferedResponseBytes / 2;
+    if (resume)
+    {
+      m_transfer->Paused = false;
+    }
+    lock.unlock();
+
+    if (resume)
+    {
+      m_multiHandle->Resume(m_transfer);
+    }
+    return copied;
+  }
+
+}}}} // namespace Azure::Core::Http::_detail
+
+// When a completion callback releases the last reference to the multi handle, the handle is
+// destroyed from another thread because the background thread can't join itself.
+CurlMultiTransport::CurlMultiTransport(CurlMultiTransportOptions const& options)
+    : m_multiHandle(new CurlMultiHandle(options), [](CurlMultiHandle* multiHandle) {
+        if (multiHandle->IsBackgroundThread())
+        {
+          std::thread([multiHandle]() { delete multiHandle; }).detach();
+        }
+        else
+        {
+          delete multiHandle;
+        }
+      })
+{
+}
+
+std::unique_ptr<RawResponse> CurlMultiTransport::Send(Request& request, Context const& context)
+{
+  Log::Write(Logger::Level::Verbose, [] { return LogMsgPrefix + "Creating a new transfer."; });
+  auto transfer = m_multiHandle->CreateTransfer(request, context);
+  m_multiHandle->Add(transfer);
+
+  std::unique_lock<std::mutex> lock(transfer->Mutex);
+  while (!transfer->HeadersReceived && !transfer->Done)
+  {
+    if (context.IsCancelled())
+    {
+      lock.unlock();
+      m_multiHandle->Remove(transfer);
+      context.ThrowIfCancelled();
+    }
+    transfer->ConditionVariable.wait_for(lock, _detail::MultiCancellationCheckInterval);
+  }
+
+  if (!transfer->HeadersReceived)
+  {
+    // The transfer is done without a response. It was already removed from the multi handle.
+    if (transfer->Error)
+    {
+      std::rethrow_exception(transfer->Error);
+    }
+    throw TransportException(
+        "Error while sending request. " + std::string(curl_easy_strerror(transfer->Result)));
+  }
+
+  Log::Write(Logger::Level::Verbose, [] {
+    return LogMsgPrefix + "Headers received. Streaming the response.";
+  });
+  auto response = std::move(transfer->Response);
+  lock.unlock();
+
+  auto const contentLength = GetContentLength(request, *response);
+  response->SetBodyStream(
+      std::make_unique<CurlMultiBodyStream>(m_multiHandle, std::move(transfer), contentLength));
+  return response;
+}
+
+void CurlMultiTransport::SendAsync(
+    Request& request,
+    Context const& context,
+    SendCompletionCallback callback)
+{
+  Log::Write(Logger::Level::Verbose, [] {
+    return LogMsgPrefix + "Creating a new asynchronous transfer.";
+  });
+  std::shared_ptr<CurlMultiTransfer> transfer;
+  try
+  {
+    transfer = m_multiHandle->CreateTransfer(request, context);
+  }
+  catch (...)
+  {
+    callback(nullptr, std::current_exception());
+    return;
+  }
+
+  transfer->Callback = std::move(callback);
+  transfer->KeepAlive = m_multiHandle;
+  transfer->BufferResponse = request.ShouldBufferResponse();
+  m_multiHandle->Add(std::move(transfer));
+}
@@ -0,0 +1,210 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief The multi handle runs the requests of a #Azure::Core::Http::CurlMultiTransport from one
+ * background thread, and the body stream reads the response downloaded by it.
+ *
+ */
+
+#pragma once
+
+#include "azure/core/context.hpp"
+#include "azure/core/http/curl_multi_transport.hpp"
+#include "azure/core/http/http.hpp"
+#include "azure/core/http/raw_response.hpp"
+#include "azure/core/http/transport.hpp"
+#include "azure/core/io/body_stream.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <curl/curl.h>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Http { namespace _detail {
+
+  /**
+   * @brief The number of downloaded bytes to keep for a response before pausing its transfer
+   * until the body stream is read.
+   *
+   */
+  constexpr static size_t MultiMaxBufferedResponseBytes = 1024 * 1024;
+
+  /**
+   * @brief The time the background thread waits for network activity before checking for new
+   * requests, when libcurl can't be woken up.
+   *
+   */
+  constexpr static long MultiPollTimeoutMilliseconds = 10;
+
+  /**
+   * @brief The time the background thread waits for network activity while there are requests
+   * sent asynchronously, before checking if their context was cancelled.
+   *
+   */
+  constexpr static long MultiAsyncPollTimeoutMilliseconds = 100;
+
+  /**
+   * @brief How often a thread waiting for a transfer checks if its context was cancelled.
+   *
+   */
+  constexpr static std::chrono::milliseconds MultiCancellationCheckInterval
+      = std::chrono::milliseconds(100);
+
+  class CurlMultiHandle;
+
+  /**
+   * @brief The state of one request performed by a #CurlMultiHandle.
+   *
+   * @remark The libcurl callbacks update it from the background thread, and the thread that sent
+   * the request waits on it. The members after `Mutex` are guarded by it.
+   *
+   * @remark A request sent asynchronously has a `Callback`, called from the background thread. Its
+   * transfer keeps the multi handle alive until then.
+   */
+  struct CurlMultiTransfer final
+  {
+    CURL* EasyHandle = nullptr;
+    curl_slist* Headers = nullptr;
+    curl_slist* ResolveOverrides = nullptr;
+    Request* HttpRequest;
+    Context TransferContext;
+    SendCompletionCallback Callback;
+    std::shared_ptr<CurlMultiHandle> KeepAlive;
+
+    std::mutex Mutex;
+    std::condition_variable ConditionVariable;
+    std::unique_ptr<RawResponse> Response;
+    bool HeadersReceived = false;
+    bool BufferResponse = false;
+    std::vector<uint8_t> Body;
+    size_t BodyOffset = 0;
+    bool Paused = false;
+    bool Done = false;
+    bool Removed = false;
+    CURLcode Result = CURLE_OK;
+    std::exception_ptr Error;
+
+    CurlMultiTransfer(Request& request, Context const& context)
+        : HttpRequest(&request), TransferContext(context)
+    {
+    }
+
+    CurlMultiTransfer(CurlMultiTransfer const&) = delete;
+    CurlMultiTransfer& operator=(CurlMultiTransfer const&) = delete;
+
+    ~CurlMultiTransfer()
+    {
+      if (EasyHandle != nullptr)
+      {
+        curl_easy_cleanup(EasyHandle);
+      }
+      curl_slist_free_all(Headers);
+      curl_slist_free_all(ResolveOverrides);
+    }
+  };
+
+  /**
+   * @brief Owns a libcurl multi handle and the background thread performing its transfers.
+   *
+   * @remark libcurl requires a multi handle and its easy handles to be used from one thread at a
+   * time. Other threads queue their changes and wake up the background thread to apply them.
+   */
+  class CurlMultiHandle final : public std::enable_shared_from_this<CurlMultiHandle> {
+  private:
+    CurlMultiTransportOptions m_options;
+    CURLM* m_multiHandle;
+
+    // Guards the queues and the stop flag.
+    std::mutex m_mutex;
+    std::vector<std::shared_ptr<CurlMultiTransfer>> m_transfersToAdd;
+    std::vector<std::shared_ptr<CurlMultiTransfer>> m_transfersToResume;
+    std::vector<std::shared_ptr<CurlMultiTransfer>> m_transfersToRemove;
+    bool m_stop = false;
+
+    // Only used by the background thread.
+    std::map<CURL*, std::shared_ptr<CurlMultiTransfer>> m_transfers;
+    std::vector<std::shared_ptr<CurlMultiTransfer>> m_pendingCallbacks;
+    std::thread m_thread;
+
+    void Run();
+    void RunCallbacks();
+    void Wakeup();
+    void RemoveTransfer(std::shared_ptr<CurlMultiTransfer> const& transfer, CURLcode result);
+
+  public:
+    explicit CurlMultiHandle(CurlMultiTransportOptions const& options);
+    ~CurlMultiHandle();
+
+    CurlMultiHandle(CurlMultiHandle const&) = delete;
+    CurlMultiHandle& operator=(CurlMultiHandle const&) = delete;
+
+    /**
+     * @brief Creates the easy handle for \p request with the callbacks writing to the transfer.
+     *
+     * @throw Azure::Core::Http::TransportException if the easy handle can't be set up.
+     */
+    std::shared_ptr<CurlMultiTransfer> CreateTransfer(Request& request, Context const& context);
+
+    /**
+     * @brief Starts performing the transfer from the background thread.
+     *
+     */
+    void Add(std::shared_ptr<CurlMultiTransfer> transfer);
+
+    /**
+     * @brief Continues a transfer which was paused because nobody was reading its body.
+     *
+     */
+    void Resume(std::shared_ptr<CurlMultiTransfer> transfer);
+
+    /**
+     * @brief Stops a transfer and waits until its callbacks won't be called anymore.
+     *
+     */
+    void Remove(std::shared_ptr<CurlMultiTransfer> transfer);
+
+    /**
+     * @brief Checks if the calling thread is the background thread, where the callbacks of the
+     * requests sent asynchronously run.
+     *
+     */
+    bool IsBackgroundThread() const { return std::this_thread::get_id() == m_thread.get_id(); }
+  };
+
+  /**
+   * @brief The body stream of a response from a #Azure::Core::Http::CurlMultiTransport.
+   *
+   * @remark It reads the bytes downloaded by the background thread. The transfer is stopped when
+   * the stream is destroyed before the whole body is read.
+   */
+  class CurlMultiBodyStream final : public Azure::Core::IO::BodyStream {
+  private:
+    std::shared_ptr<CurlMultiHandle> m_multiHandle;
+    std::shared_ptr<CurlMultiTransfer> m_transfer;
+    int64_t m_contentLength;
+
+    size_t OnRead(uint8_t* buffer, size_t count, Context const& context) override;
+
+  public:
+    CurlMultiBodyStream(
+        std::shared_ptr<CurlMultiHandle> multiHandle,
+        std::shared_ptr<CurlMultiTransfer> transfer,
+        int64_t contentLength)
+        : m_multiHandle(std::move(multiHandle)), m_transfer(std::move(transfer)),
+          m_contentLength(contentLength)
+    {
+    }
+
+    ~CurlMultiBodyStream() override { m_multiHandle->Remove(m_transfer); }
+
+    int64_t Length() const override { return m_contentLength; }
+  };
+
+}}}} // namespace Azure::Core::Http::_detail
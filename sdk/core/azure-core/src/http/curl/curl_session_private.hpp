@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #ifdef TESTING_BUILD
 // Define the class name that reads from ConnectionPool private members
@@ -161,6 +162,19 @@ namespace Azure { namespace Core { namespace Http {
        */
       size_t BuildHeader(uint8_t const* const buffer, size_t const bufferSize);
 
+      /**
+       * @brief Builds the status line or a header of the HTTP RawResponse from a line, without its
+       * `\r\n` delimiter.
+       *
+       * @remark When the internal buffer has the start of the line, [\p first, \p last) is
+       * appended to it first.
+       *
+       * @param first Points to the first character of the line in the parsed buffer.
+       * @param last Points after the last character of the line in the parsed buffer.
+       * @return `true` if the line is the empty line ending the headers; otherwise, `false`.
+       */
+      bool ParseLine(uint8_t const* first, uint8_t const* last);
+
     public:
       /**
        * @brief Construct a new RawResponse Buffer Parser object.
@@ -239,10 +253,10 @@ namespace Azure { namespace Core { namespace Http {
      * inner buffer. When a libcurl stream tries to read part of the body, this field will help to
      * decide how much data to take from the inner buffer before pulling more data from network.
      *
-     * @note The initial value is set to the size of the inner buffer as a sentinel that indicate
-     * that the buffer has not data or all data has already taken from it.
+     * @note The buffer has no data, or all data has already been taken from it, when it is equal
+     * to #m_innerBufferSize.
      */
-    size_t m_bodyStartInBuffer = _detail::DefaultLibcurlReaderSize;
+    size_t m_bodyStartInBuffer = 0;
 
     /**
      * @brief Control field to handle the number of bytes containing relevant data within the
@@ -250,7 +264,7 @@ namespace Azure { namespace Core { namespace Http {
      * from wire into it, it can be holding less then N bytes.
      *
      */
-    size_t m_innerBufferSize = _detail::DefaultLibcurlReaderSize;
+    size_t m_innerBufferSize = 0;
 
     bool m_isChunkedResponseType = false;
 
@@ -275,13 +289,28 @@ namespace Azure { namespace Core { namespace Http {
     size_t m_sessionTotalRead = 0;
 
     /**
-     * @brief Internal buffer from a session used to read bytes from a socket. This buffer is only
-     * used while constructing an HTTP RawResponse without adding a body to it. Customers would
-     * provide their own buffer to copy from socket when reading the HTTP body using streams.
+     * @brief Internal buffer from a session used to read bytes from a socket. It holds the status
+     * line and headers while constructing an HTTP RawResponse, the chunk sizes of a chunked
+     * response, and the body when customers read it in parts smaller than the buffer. Larger reads
+     * copy from the socket straight to the customer's buffer.
+     *
+     * @remark It starts with #Azure::Core::Http::_detail::DefaultLibcurlReaderSize bytes and grows
+     * up to #Azure::Core::Http::_detail::MaxLibcurlReaderSize while reads from the socket fill it.
+     */
+    std::vector<uint8_t> m_readBuffer = std::vector<uint8_t>(_detail::DefaultLibcurlReaderSize);
+
+    /**
+     * @brief Replaces the content of the inner buffer with the next bytes from the socket.
+     *
+     * @param context A context to control the request lifetime.
+     * @param maxSize The maximum number of bytes to read.
      *
+     * @return The number of bytes read, which are set as the content of the inner buffer. `0` if
+     * the connection was closed.
      */
-    uint8_t m_readBuffer[_detail::DefaultLibcurlReaderSize]
-        = {0}; // to work with libcurl custom read.
+    size_t ReadToInnerBuffer(
+        Context const& context,
+        size_t maxSize = _detail::MaxLibcurlReaderSize);
 
     /**
      * @brief Function used when working with Streams to manually write from the HTTP Request to
@@ -358,6 +387,37 @@ namespace Azure { namespace Core { namespace Http {
      */
     bool m_keepAlive = true;
 
+    /**
+     * @brief Request bodies up to this size are sent with the request line and headers.
+     *
+     */
+    size_t m_maxCoalescedBodySize;
+
+    /**
+     * @brief The request body is sent in the same write as the request line and headers.
+     *
+     */
+    bool m_sendBodyWithHeaders = false;
+
+    /**
+     * @brief PUT, POST and PATCH request bodies larger than this size wait for the server to accept
+     * the request. When not set, the PUT request bodies not sent with the headers wait.
+     *
+     */
+    Azure::Nullable<int64_t> m_expectContinueThreshold;
+
+    /**
+     * @brief How long to wait for the server to accept the request before sending the body anyway.
+     *
+     */
+    std::chrono::milliseconds m_expectContinueTimeout;
+
+    /**
+     * @brief The request is sent with `Expect: 100-continue`.
+     *
+     */
+    bool m_expectContinue = false;
+
     /**
      * @brief Implement #Azure::Core::IO::BodyStream::OnRead(). Calling this function pulls data
      * from the wire.
@@ -369,14 +429,40 @@ namespace Azure { namespace Core { namespace Http {
      */
     size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
 
+    /**
+     * @brief Implement #Azure::Core::IO::BodyStream::OnReadSpan(). The body bytes already in the
+     * inner buffer are lent from it, the others are read from the wire into \p scratch.
+     *
+     */
+    size_t OnReadSpan(
+        uint8_t const*& data,
+        size_t count,
+        std::vector<uint8_t>& scratch,
+        Azure::Core::Context const& context) override;
+
   public:
     /**
      * @brief Construct a new Curl Session object. Init internal libcurl handler.
      *
      * @param request reference to an HTTP Request.
+     * @param connection The connection to send the request on.
+     * @param keepAlive Return the connection to the pool when the response is read.
+     * @param maxCoalescedBodySize Request bodies up to this size are sent with the headers.
+     * @param expectContinueThreshold Request bodies larger than this size wait for the server to
+     * accept the request.
+     * @param expectContinueTimeout How long to wait for the server to accept the request.
      */
-    CurlSession(Request& request, std::unique_ptr<CurlNetworkConnection> connection, bool keepAlive)
-        : m_connection(std::move(connection)), m_request(request), m_keepAlive(keepAlive)
+    CurlSession(
+        Request& request,
+        std::unique_ptr<CurlNetworkConnection> connection,
+        bool keepAlive,
+        size_t maxCoalescedBodySize = _detail::DefaultMaxCoalescedRequestBodySize,
+        Azure::Nullable<int64_t> expectContinueThreshold = Azure::Nullable<int64_t>(),
+        std::chrono::milliseconds expectContinueTimeout = _detail::DefaultExpectContinueTimeout)
+        : m_connection(std::move(connection)), m_request(request), m_keepAlive(keepAlive),
+          m_maxCoalescedBodySize(maxCoalescedBodySize),
+          m_expectContinueThreshold(std::move(expectContinueThreshold)),
+          m_expectContinueTimeout(expectContinueTimeout)
     {
     }
 
@@ -393,6 +479,11 @@ namespace Azure { namespace Core { namespace Http {
         _detail::CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
             std::move(m_connection), m_lastStatusCode);
       }
+      else if (m_connection)
+      {
+        _detail::CurlConnectionPool::g_curlConnectionPool.DiscardConnection(
+            std::move(m_connection));
+      }
     }
 
     /**
@@ -400,9 +491,13 @@ namespace Azure { namespace Core { namespace Http {
      * based on the HTTP request configuration.
      *
      * @param context A context to control the request lifetime.
+     * @param timings The timings of the request, where the durations of sending the request and
+     * of waiting for the response headers are set to, or `nullptr`.
      * @return CURLE_OK when the network call is completed successfully.
      */
-    CURLcode Perform(Context const& context);
+    CURLcode Perform(
+        Context const& context,
+        Diagnostics::HttpRequestTimings* timings = nullptr);
 
     /**
      * @brief Moved the ownership of the HTTP RawResponse out of the session.
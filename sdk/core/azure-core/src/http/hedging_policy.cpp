@@ -0,0 +1,296 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/policies/policy.hpp"
+#include "azure/core/internal/diagnostics/log.hpp"
+#include "../private/shared_timer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using Azure::Core::Context;
+using namespace Azure::Core::Http;
+using namespace Azure::Core::Http::Policies;
+using namespace Azure::Core::Http::Policies::_internal;
+
+namespace Azure { namespace Core { namespace Http { namespace Policies { namespace _detail {
+
+  // The latencies of the recent responses, and the threads of the hedged tries.
+  class HedgingState final {
+    // The percentile is computed from the latencies of the last responses, once there are enough
+    // of them.
+    constexpr static size_t MaxLatencyCount = 256;
+    constexpr static size_t MinLatencyCount = 16;
+
+    struct HedgeThread final
+    {
+      std::thread Thread;
+      std::atomic<bool> IsDone{false};
+    };
+
+    std::mutex m_mutex;
+    std::vector<std::chrono::microseconds> m_latencies;
+    size_t m_nextLatency = 0;
+    std::list<HedgeThread> m_hedgeThreads;
+
+  public:
+    void AddLatency(std::chrono::microseconds latency)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_latencies.size() < MaxLatencyCount)
+      {
+        m_latencies.push_back(latency);
+      }
+      else
+      {
+        m_latencies[m_nextLatency] = latency;
+        m_nextLatency = (m_nextLatency + 1) % MaxLatencyCount;
+      }
+    }
+
+    std::chrono::microseconds GetDelay(HedgingOptions const& options)
+    {
+      std::vector<std::chrono::microseconds> latencies;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_latencies.size() < MinLatencyCount)
+        {
+          return options.InitialDelay;
+        }
+        latencies = m_latencies;
+      }
+
+      auto const percentile = (std::min)((std::max)(options.DelayPercentile, 0.0), 1.0);
+      auto const index = (std::min)(
+          static_cast<size_t>(percentile * static_cast<double>(latencies.size())),
+          latencies.size() - 1);
+      std::nth_element(latencies.begin(), latencies.begin() + index, latencies.end());
+      return latencies[index];
+    }
+
+    // Runs a hedged try on a thread of its own, and joins the threads of the tries which ended.
+    void StartHedge(std::function<void()> sendTry)
+    {
+      std::list<HedgeThread> endedThreads;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto ite = m_hedgeThreads.begin(); ite != m_hedgeThreads.end();)
+        {
+          auto const next = std::next(ite);
+          if (ite->IsDone)
+          {
+            endedThreads.splice(endedThreads.end(), m_hedgeThreads, ite);
+          }
+          ite = next;
+        }
+        m_hedgeThreads.emplace_back();
+        auto& hedgeThread = m_hedgeThreads.back();
+        hedgeThread.Thread = std::thread([sendTry = std::move(sendTry), &hedgeThread]() {
+          sendTry();
+          hedgeThread.IsDone = true;
+        });
+      }
+      for (auto& endedThread : endedThreads)
+      {
+        endedThread.Thread.join();
+      }
+    }
+
+    void JoinHedges()
+    {
+      std::list<HedgeThread> hedgeThreads;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        hedgeThreads.swap(m_hedgeThreads);
+      }
+      for (auto& hedgeThread : hedgeThreads)
+      {
+        hedgeThread.Thread.join();
+      }
+    }
+  };
+
+}}}}} // namespace Azure::Core::Http::Policies::_detail
+
+namespace {
+Context::Key const HedgedTryKey;
+
+// The state of a request, sent from the thread of the caller, and of its copy, sent from a thread
+// of its own once the delay expired.
+struct HedgedRequest final
+{
+  HedgedRequest(Request const& request, Context const& context)
+      : PrimaryContext(context.WithValue(HedgedTryKey, false)), HedgeRequest(request),
+        HedgeContext(context.WithValue(HedgedTryKey, true))
+  {
+  }
+
+  Context PrimaryContext;
+  Request HedgeRequest;
+  Context HedgeContext;
+
+  std::mutex Mutex;
+  std::condition_variable HedgeEnded;
+  bool IsPrimaryDone = false;
+  bool IsHedgeStarted = false;
+  bool IsHedgeDone = false;
+  // Whether the copy got a response before the request.
+  bool IsHedgeWinner = false;
+  std::unique_ptr<RawResponse> HedgeResponse;
+};
+} // namespace
+
+HedgingPolicy::HedgingPolicy(HedgingOptions options)
+    : m_options(std::move(options)), m_state(std::make_shared<_detail::HedgingState>())
+{
+}
+
+HedgingPolicy::HedgingPolicy(HedgingPolicy const& other)
+    : HttpPolicy(other), m_options(other.m_options),
+      m_state(std::make_shared<_detail::HedgingState>())
+{
+}
+
+// The tries in flight use the policies after this one, which the pipeline destroys with it.
+HedgingPolicy::~HedgingPolicy() { m_state->JoinHedges(); }
+
+bool HedgingPolicy::IsHedgedTry(Context const& context)
+{
+  bool isHedged = false;
+  context.TryGetValue(HedgedTryKey, isHedged);
+  return isHedged;
+}
+
+std::unique_ptr<RawResponse> HedgingPolicy::Send(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context) const
+{
+  using Azure::Core::Diagnostics::Logger;
+  using Azure::Core::Diagnostics::_internal::Log;
+
+  // Only the idempotent requests without a body can be sent twice.
+  auto const method = request.GetMethod();
+  if (method != HttpMethod::Get && method != HttpMethod::Head)
+  {
+    return nextPolicy.Send(request, context);
+  }
+
+  auto const delay = m_state->GetDelay(m_options);
+  // The copy is made before the request is sent, which the policies after this one can change.
+  auto hedgedRequest = std::make_shared<HedgedRequest>(request, context);
+
+  // The copy is only sent from a thread once the delay expired without a response.
+  auto const hedgeTimer = Azure::Core::_detail::SharedTimer::Schedule(
+      std::chrono::steady_clock::now() + delay,
+      context,
+      [state = m_state, hedgedRequest, nextPolicy, delay](bool isCancelled) {
+        {
+          std::lock_guard<std::mutex> lock(hedgedRequest->Mutex);
+          if (isCancelled || hedgedRequest->IsPrimaryDone)
+          {
+            return;
+          }
+          hedgedRequest->IsHedgeStarted = true;
+        }
+
+        if (Log::ShouldWrite(Logger::Level::Informational))
+        {
+          Log::Write(
+              Logger::Level::Informational,
+              "HTTP request hedged after "
+                  + std::to_string(
+                      std::chrono::duration_cast<std::chrono::milliseconds>(delay).count())
+                  + "ms without a response.");
+        }
+
+        state->StartHedge([state, hedgedRequest, nextPolicy]() {
+          auto const start = std::chrono::steady_clock::now();
+          std::unique_ptr<RawResponse> response;
+          try
+          {
+            response = NextHttpPolicy(nextPolicy).Send(
+                hedgedRequest->HedgeRequest, hedgedRequest->HedgeContext);
+            state->AddLatency(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start));
+          }
+          catch (...)
+          {
+          }
+
+          {
+            std::lock_guard<std::mutex> lock(hedgedRequest->Mutex);
+            hedgedRequest->IsHedgeDone = true;
+            // The first response wins, the request still in flight is cancelled.
+            if (response && !hedgedRequest->IsPrimaryDone)
+            {
+              hedgedRequest->IsHedgeWinner = true;
+              hedgedRequest->HedgeResponse = std::move(response);
+              hedgedRequest->PrimaryContext.Cancel();
+            }
+            else if (response)
+            {
+              hedgedRequest->HedgeResponse = std::move(response);
+            }
+          }
+          hedgedRequest->HedgeEnded.notify_all();
+        });
+      });
+
+  auto const start = std::chrono::steady_clock::now();
+  std::unique_ptr<RawResponse> response;
+  std::exception_ptr error;
+  try
+  {
+    response = nextPolicy.Send(request, hedgedRequest->PrimaryContext);
+    m_state->AddLatency(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start));
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+
+  // Once cancelled, the timer doesn't start the copy.
+  Azure::Core::_detail::SharedTimer::Cancel(hedgeTimer);
+  std::unique_lock<std::mutex> lock(hedgedRequest->Mutex);
+  hedgedRequest->IsPrimaryDone = true;
+  if (!hedgedRequest->IsHedgeStarted || (response && !hedgedRequest->IsHedgeWinner))
+  {
+    lock.unlock();
+    if (hedgedRequest->IsHedgeStarted)
+    {
+      // Cancel the loser.
+      hedgedRequest->HedgeContext.Cancel();
+    }
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+    return response;
+  }
+
+  // The copy got the response, or the request failed and the copy can still get one. An error is
+  // returned once neither can get a response.
+  hedgedRequest->HedgeEnded.wait(lock, [&hedgedRequest] { return hedgedRequest->IsHedgeDone; });
+  if (!hedgedRequest->HedgeResponse)
+  {
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+    return response;
+  }
+
+  // The policies before this one, like the retry policy, see the URL the response came from.
+  request.GetUrl() = hedgedRequest->HedgeRequest.GetUrl();
+  return std::move(hedgedRequest->HedgeResponse);
+}
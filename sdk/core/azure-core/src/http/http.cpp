@@ -4,9 +4,13 @@
 #include "azure/core/http/http.hpp"
 #include "azure/core/http/policies/policy.hpp"
 #include "azure/core/internal/io/null_body_stream.hpp"
+#include "azure/core/internal/strings.hpp"
 #include "azure/core/url.hpp"
 
+#include <algorithm>
+#include <string>
 #include <utility>
+#include <vector>
 
 using namespace Azure::Core;
 using namespace Azure::Core::Http;
@@ -25,7 +29,39 @@ const HttpMethod HttpMethod::Put("PUT");
 const HttpMethod HttpMethod::Delete("DELETE");
 const HttpMethod HttpMethod::Patch("PATCH");
 
-void Azure::Core::Http::_detail::RawResponseHelpers::InsertHeaderWithValidation(
+Azure::Core::Http::_internal::HttpHeaderBlock::HttpHeaderBlock(
+    std::vector<std::pair<std::string, std::string>> const& headers)
+{
+  CaseInsensitiveMap validatedHeaders;
+  for (auto const& header : headers)
+  {
+    _detail::RawResponseHelpers::InsertHeaderWithValidation(
+        validatedHeaders,
+        Azure::Core::_internal::StringExtensions::ToLower(header.first),
+        header.second);
+  }
+
+  m_headers.reserve(validatedHeaders.size());
+  for (auto& header : validatedHeaders)
+  {
+    m_serializedHeaders += header.first;
+    m_serializedHeaders += ": ";
+    m_serializedHeaders += header.second;
+    m_serializedHeaders += "\r\n";
+    m_headers.emplace_back(header.first, std::move(header.second));
+  }
+}
+
+bool Azure::Core::Http::_internal::HttpHeaderBlock::Contains(std::string const& name) const
+{
+  return std::any_of(
+      m_headers.begin(), m_headers.end(), [&name](std::pair<std::string, std::string> const& h) {
+        return Azure::Core::_internal::StringExtensions::LocaleInvariantCaseInsensitiveEqual(
+            h.first, name);
+      });
+}
+
+std::string& Azure::Core::Http::_detail::RawResponseHelpers::InsertHeaderWithValidation(
     Azure::Core::CaseInsensitiveMap& headers,
     std::string const& headerName,
     std::string const& headerValue)
@@ -173,7 +209,9 @@ void Azure::Core::Http::_detail::RawResponseHelpers::InsertHeaderWithValidation(
     }
   }
   // insert (override if duplicated)
-  headers[headerName] = headerValue;
+  auto& value = headers[headerName];
+  value = headerValue;
+  return value;
 }
 
 Request::Request(HttpMethod httpMethod, Url url, bool shouldBufferResponse)
@@ -0,0 +1,200 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/diagnostics/instrumentation.hpp"
+#include "azure/core/http/policies/policy.hpp"
+
+#include <chrono>
+#include <exception>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+using Azure::Core::Context;
+using namespace Azure::Core::Diagnostics;
+using namespace Azure::Core::Http;
+using namespace Azure::Core::Http::Policies;
+using namespace Azure::Core::Http::Policies::_internal;
+
+namespace {
+Context::Key const TimingsKey;
+
+// The state of a try, kept until its response or its error.
+struct InstrumentedTry final
+{
+  HttpRequestTimings Timings;
+  std::unique_ptr<Span> TrySpan;
+  std::map<std::string, std::string> Attributes;
+  std::chrono::steady_clock::time_point Start;
+
+  InstrumentedTry(
+      InstrumentationOptions const& options,
+      Request const& request,
+      int32_t retryCount)
+  {
+    auto const& url = request.GetUrl();
+    auto const method = request.GetMethod().ToString();
+    Attributes.emplace("http.method", method);
+    Attributes.emplace("net.peer.name", url.GetHost());
+
+    if (options.Tracer)
+    {
+      TrySpan = options.Tracer->StartSpan("HTTP " + method);
+      TrySpan->SetAttribute("http.method", method);
+      // The query parameters aren't traced, since they can include SAS tokens.
+      std::string tracedUrl;
+      if (!url.GetScheme().empty())
+      {
+        tracedUrl += url.GetScheme() + "://";
+      }
+      tracedUrl += url.GetHost();
+      if (url.GetPort() != 0)
+      {
+        tracedUrl += ':' + std::to_string(url.GetPort());
+      }
+      tracedUrl += '/' + url.GetPath();
+      TrySpan->SetAttribute("http.url", tracedUrl);
+      if (retryCount >= 0)
+      {
+        TrySpan->SetAttribute("http.retry_count", static_cast<int64_t>(retryCount));
+      }
+    }
+
+    if (options.Meter && retryCount > 0)
+    {
+      options.Meter->AddToCounter("http.client.retries", 1, Attributes);
+    }
+
+    Start = std::chrono::steady_clock::now();
+  }
+
+  void End(
+      InstrumentationOptions const& options,
+      RawResponse const* response,
+      std::exception_ptr error)
+  {
+    auto const duration = std::chrono::steady_clock::now() - Start;
+
+    std::string errorDescription;
+    if (error)
+    {
+      try
+      {
+        std::rethrow_exception(error);
+      }
+      catch (std::exception const& e)
+      {
+        errorDescription = e.what();
+      }
+      catch (...)
+      {
+        errorDescription = "Unknown error.";
+      }
+      Attributes.emplace("error.type", "transport");
+    }
+    else
+    {
+      Attributes.emplace(
+          "http.status_code", std::to_string(static_cast<int>(response->GetStatusCode())));
+    }
+
+    // The phases, with the names of their metrics and span attributes.
+    std::pair<char const*, std::chrono::nanoseconds> const phases[] = {
+        {"http.client.connection_pool_wait", Timings.ConnectionPoolWait},
+        {"http.client.name_lookup", Timings.NameLookup},
+        {"http.client.connect", Timings.Connect},
+        {"http.client.tls_handshake", Timings.TlsHandshake},
+        {"http.client.request_send", Timings.RequestSend},
+        {"http.client.time_to_first_byte", Timings.TimeToFirstByte},
+        {"http.client.response_transfer", Timings.ResponseTransfer},
+    };
+
+    if (TrySpan)
+    {
+      for (auto const& phase : phases)
+      {
+        if (phase.second.count() != 0)
+        {
+          TrySpan->SetAttribute(
+              std::string(phase.first) + "_ns", static_cast<int64_t>(phase.second.count()));
+        }
+      }
+      TrySpan->SetAttribute(
+          "http.client.connection_reused", static_cast<int64_t>(Timings.ConnectionReused));
+      if (error)
+      {
+        TrySpan->SetError(errorDescription);
+      }
+      else
+      {
+        TrySpan->SetAttribute("http.status_code", static_cast<int64_t>(response->GetStatusCode()));
+      }
+      TrySpan->End();
+    }
+
+    if (options.Meter)
+    {
+      options.Meter->RecordDuration(
+          "http.client.duration",
+          std::chrono::duration_cast<std::chrono::nanoseconds>(duration),
+          Attributes);
+      for (auto const& phase : phases)
+      {
+        if (phase.second.count() != 0)
+        {
+          options.Meter->RecordDuration(phase.first, phase.second, Attributes);
+        }
+      }
+    }
+  }
+};
+} // namespace
+
+HttpRequestTimings* InstrumentationPolicy::GetRequestTimings(Context const& context)
+{
+  HttpRequestTimings* timings = nullptr;
+  context.TryGetValue(TimingsKey, timings);
+  return timings;
+}
+
+std::unique_ptr<RawResponse> InstrumentationPolicy::Send(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context) const
+{
+  InstrumentedTry instrumentedTry(m_options, request, RetryPolicy::GetRetryCount(context));
+
+  std::unique_ptr<RawResponse> response;
+  try
+  {
+    response = nextPolicy.Send(request, context.WithValue(TimingsKey, &instrumentedTry.Timings));
+  }
+  catch (...)
+  {
+    instrumentedTry.End(m_options, nullptr, std::current_exception());
+    throw;
+  }
+
+  instrumentedTry.End(m_options, response.get(), nullptr);
+  return response;
+}
+
+void InstrumentationPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendCompletionCallback callback) const
+{
+  auto instrumentedTry
+      = std::make_shared<InstrumentedTry>(m_options, request, RetryPolicy::GetRetryCount(context));
+
+  nextPolicy.SendAsync(
+      request,
+      context.WithValue(TimingsKey, &instrumentedTry->Timings),
+      [options = m_options, instrumentedTry, callback = std::move(callback)](
+          std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+        instrumentedTry->End(options, response.get(), error);
+        callback(std::move(response), error);
+      });
+}
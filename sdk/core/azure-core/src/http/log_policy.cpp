@@ -26,7 +26,7 @@ inline void AppendHeaders(
 {
   for (auto const& header : headers)
   {
-    log << std::endl << header.first << " : ";
+    log << '\n' << header.first << " : ";
 
     if (!header.second.empty())
     {
@@ -63,7 +63,7 @@ inline std::string GetRequestLogMessage(LogOptions const& options, Request const
   LogUrlWithoutQuery(log, requestUrl);
 
   {
-    auto encodedRequestQueryParams = requestUrl.GetQueryParameters();
+    auto const& encodedRequestQueryParams = requestUrl.GetQueryParameters();
 
     std::remove_const<std::remove_reference<decltype(encodedRequestQueryParams)>::type>::type
         loggedQueryParams;
@@ -108,7 +108,7 @@ inline std::string GetRequestLogMessage(LogOptions const& options, Request const
       log << Azure::Core::_detail::FormatEncodedUrlQueryParameters(loggedQueryParams);
     }
   }
-  AppendHeaders(log, request.GetHeaders(), options.AllowedHttpHeaders);
+  AppendHeaders(log, request.GetHeadersReference(), options.AllowedHttpHeaders);
   return log.str();
 }
 
@@ -181,3 +181,36 @@ std::unique_ptr<RawResponse> LogPolicy::Send(
 
   return response;
 }
+
+void LogPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendCompletionCallback callback) const
+{
+  using Azure::Core::Diagnostics::Logger;
+  using Azure::Core::Diagnostics::_internal::Log;
+
+  if (!Log::ShouldWrite(Logger::Level::Verbose))
+  {
+    nextPolicy.SendAsync(request, context, std::move(callback));
+    return;
+  }
+
+  Log::Write(Logger::Level::Informational, GetRequestLogMessage(m_options, request));
+
+  auto const start = std::chrono::system_clock::now();
+  nextPolicy.SendAsync(
+      request,
+      context,
+      [this, start, callback](std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+        auto const end = std::chrono::system_clock::now();
+        if (response != nullptr)
+        {
+          Log::Write(
+              Logger::Level::Informational,
+              GetResponseLogMessage(m_options, *response, end - start));
+        }
+        callback(std::move(response), error);
+      });
+}
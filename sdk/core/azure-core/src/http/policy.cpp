@@ -4,6 +4,9 @@
 #include "azure/core/http/policies/policy.hpp"
 #include "azure/core/http/http.hpp"
 
+#include <atomic>
+#include <chrono>
+
 using Azure::Core::Context;
 using namespace Azure::Core::Http;
 using namespace Azure::Core::Http::Policies;
@@ -18,5 +21,92 @@ std::unique_ptr<RawResponse> NextHttpPolicy::Send(Request& request, Context cons
     throw std::invalid_argument("Invalid pipeline. No transport policy found. Endless policy.");
   }
 
-  return m_policies[m_index + 1]->Send(request, NextHttpPolicy{m_index + 1, m_policies}, context);
+  return Policies::_internal::HttpPolicyObserver::Send(
+      *m_policies[m_index + 1], request, NextHttpPolicy{m_index + 1, m_policies}, context);
+}
+
+void NextHttpPolicy::SendAsync(
+    Request& request,
+    Context const& context,
+    SendCompletionCallback callback)
+{
+  if (m_index == m_policies.size() - 1)
+  {
+    // All the policies have run without running a transport policy
+    throw std::invalid_argument("Invalid pipeline. No transport policy found. Endless policy.");
+  }
+
+  m_policies[m_index + 1]->SendAsync(
+      request, NextHttpPolicy{m_index + 1, m_policies}, context, std::move(callback));
+}
+
+// Policies without an asynchronous implementation block the calling thread until the rest of the
+// pipeline returns.
+void HttpPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendCompletionCallback callback) const
+{
+  std::unique_ptr<RawResponse> response;
+  std::exception_ptr error;
+  try
+  {
+    response = Send(request, nextPolicy, context);
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+  callback(std::move(response), error);
+}
+
+namespace {
+std::atomic<Policies::_internal::HttpPolicyObserver*> g_policyObserver(nullptr);
+
+// Reports the time spent in a policy when it returns or throws.
+class PolicyCallTimer final {
+  Policies::_internal::HttpPolicyObserver& m_observer;
+  HttpPolicy const& m_policy;
+  size_t const m_index;
+  std::chrono::steady_clock::time_point const m_start = std::chrono::steady_clock::now();
+
+public:
+  PolicyCallTimer(
+      Policies::_internal::HttpPolicyObserver& observer,
+      HttpPolicy const& policy,
+      size_t index)
+      : m_observer(observer), m_policy(policy), m_index(index)
+  {
+  }
+
+  ~PolicyCallTimer()
+  {
+    m_observer.OnPolicyCalled(
+        m_policy,
+        m_index,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_start));
+  }
+};
+} // namespace
+
+void Policies::_internal::HttpPolicyObserver::Install(HttpPolicyObserver* observer)
+{
+  g_policyObserver.store(observer, std::memory_order_release);
+}
+
+std::unique_ptr<RawResponse> Policies::_internal::HttpPolicyObserver::Send(
+    HttpPolicy const& policy,
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context)
+{
+  auto const observer = g_policyObserver.load(std::memory_order_acquire);
+  if (observer == nullptr)
+  {
+    return policy.Send(request, nextPolicy, context);
+  }
+  PolicyCallTimer timer(*observer, policy, nextPolicy.m_index);
+  return policy.Send(request, nextPolicy, context);
 }
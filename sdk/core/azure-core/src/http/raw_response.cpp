@@ -5,13 +5,75 @@
 #include "azure/core/http/http.hpp"
 #include "azure/core/internal/strings.hpp"
 
+#include <array>
 #include <cctype>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 using namespace Azure::Core::IO;
 using namespace Azure::Core::Http;
+using Azure::Core::Http::_internal::WellKnownHeader;
+using Azure::Core::Http::_internal::WellKnownHeaderCount;
+
+namespace {
+// The names of the well-known headers, by ID.
+const std::array<std::string, WellKnownHeaderCount> WellKnownHeaderNames{
+    "cache-control",
+    "content-disposition",
+    "content-encoding",
+    "content-language",
+    "content-length",
+    "content-md5",
+    "content-range",
+    "content-type",
+    "date",
+    "etag",
+    "last-modified",
+    "x-ms-blob-sequence-number",
+    "x-ms-blob-type",
+    "x-ms-client-request-id",
+    "x-ms-content-crc64",
+    "x-ms-copy-id",
+    "x-ms-copy-status",
+    "x-ms-creation-time",
+    "x-ms-encryption-key-sha256",
+    "x-ms-encryption-scope",
+    "x-ms-file-attributes",
+    "x-ms-file-change-time",
+    "x-ms-file-creation-time",
+    "x-ms-file-id",
+    "x-ms-file-last-write-time",
+    "x-ms-file-parent-id",
+    "x-ms-file-permission-key",
+    "x-ms-lease-duration",
+    "x-ms-lease-id",
+    "x-ms-lease-state",
+    "x-ms-lease-status",
+    "x-ms-request-id",
+    "x-ms-request-server-encrypted",
+    "x-ms-server-encrypted",
+    "x-ms-version",
+    "x-ms-version-id",
+};
+
+// Returns the ID of the well-known header named \p name, or WellKnownHeaderCount.
+size_t FindWellKnownHeader(std::string const& name)
+{
+  for (size_t header = 0; header < WellKnownHeaderNames.size(); ++header)
+  {
+    auto const& headerName = WellKnownHeaderNames[header];
+    if (headerName.size() == name.size()
+        && Azure::Core::_internal::StringExtensions::LocaleInvariantCaseInsensitiveEqual(
+            headerName, name))
+    {
+      return header;
+    }
+  }
+  return WellKnownHeaderCount;
+}
+} // namespace
 
 HttpStatusCode RawResponse::GetStatusCode() const { return m_statusCode; }
 
@@ -19,9 +81,39 @@ std::string const& RawResponse::GetReasonPhrase() const { return m_reasonPhrase;
 
 Azure::Core::CaseInsensitiveMap const& RawResponse::GetHeaders() const { return this->m_headers; }
 
+std::string const& RawResponse::GetHeader(WellKnownHeader header) const
+{
+  auto const value = this->m_wellKnownHeaders[static_cast<size_t>(header)];
+  if (value == nullptr)
+  {
+    throw std::out_of_range(
+        "The response doesn't have the header "
+        + WellKnownHeaderNames[static_cast<size_t>(header)] + ".");
+  }
+  return *value;
+}
+
 void RawResponse::SetHeader(std::string const& name, std::string const& value)
 {
-  return _detail::RawResponseHelpers::InsertHeaderWithValidation(this->m_headers, name, value);
+  auto const& headerValue
+      = _detail::RawResponseHelpers::InsertHeaderWithValidation(this->m_headers, name, value);
+  auto const header = FindWellKnownHeader(name);
+  if (header < WellKnownHeaderCount)
+  {
+    this->m_wellKnownHeaders[header] = &headerValue;
+  }
+}
+
+void RawResponse::SetBody(
+    std::vector<uint8_t> body,
+    std::shared_ptr<ResponseBufferPool> bufferPool)
+{
+  if (m_bodyBufferPool)
+  {
+    m_bodyBufferPool->Release(std::move(m_body));
+  }
+  m_body = std::move(body);
+  m_bodyBufferPool = std::move(bufferPool);
 }
 
 void RawResponse::SetBodyStream(std::unique_ptr<BodyStream> stream)
@@ -4,43 +4,96 @@
 #include "azure/core/http/http.hpp"
 #include "azure/core/internal/strings.hpp"
 
+#include <algorithm>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace Azure::Core::Http;
 
-namespace {
-// returns left map plus all items in right
-// when duplicates, left items are preferred
-static Azure::Core::CaseInsensitiveMap MergeMaps(
-    Azure::Core::CaseInsensitiveMap left,
-    Azure::Core::CaseInsensitiveMap const& right)
-{
-  left.insert(right.begin(), right.end());
-  return left;
-}
-} // namespace
-
 void Request::SetHeader(std::string const& name, std::string const& value)
 {
   auto headerNameLowerCase = Azure::Core::_internal::StringExtensions::ToLower(name);
-  return this->m_retryModeEnabled ? _detail::RawResponseHelpers::InsertHeaderWithValidation(
-             this->m_retryHeaders, headerNameLowerCase, value)
-                                  : _detail::RawResponseHelpers::InsertHeaderWithValidation(
-                                      this->m_headers, headerNameLowerCase, value);
+  this->DropHeaderBlocks(headerNameLowerCase);
+  if (this->m_retryModeEnabled
+      && this->m_headersBeforeTry.find(headerNameLowerCase) == this->m_headersBeforeTry.end())
+  {
+    // Validate before recording the previous value, so that an invalid header leaves no trace.
+    auto const previous = this->m_headers.find(headerNameLowerCase);
+    Azure::Nullable<std::string> previousValue;
+    if (previous != this->m_headers.end())
+    {
+      previousValue = previous->second;
+    }
+    _detail::RawResponseHelpers::InsertHeaderWithValidation(
+        this->m_headers, headerNameLowerCase, value);
+    this->m_headersBeforeTry.emplace(std::move(headerNameLowerCase), std::move(previousValue));
+    return;
+  }
+  _detail::RawResponseHelpers::InsertHeaderWithValidation(
+      this->m_headers, headerNameLowerCase, value);
 }
 
 void Request::RemoveHeader(std::string const& name)
 {
+  // A removed header isn't restored by the next try, whether it was set before or during this one.
+  this->DropHeaderBlocks(name);
   this->m_headers.erase(name);
-  this->m_retryHeaders.erase(name);
+  this->m_headersBeforeTry.erase(name);
+}
+
+void Request::AddHeaderBlock(std::shared_ptr<const _internal::HttpHeaderBlock> headerBlock)
+{
+  if (this->m_retryModeEnabled)
+  {
+    // The next try resets the headers set during this one, which the blocks don't follow.
+    for (auto const& header : headerBlock->GetHeaders())
+    {
+      this->SetHeader(header.first, header.second);
+    }
+    return;
+  }
+
+  for (auto const& header : headerBlock->GetHeaders())
+  {
+    this->DropHeaderBlocks(header.first);
+    this->m_headers[header.first] = header.second;
+  }
+  this->m_headerBlocks.push_back(std::move(headerBlock));
+}
+
+void Request::DropHeaderBlocks(std::string const& name)
+{
+  if (this->m_headerBlocks.empty())
+  {
+    return;
+  }
+  this->m_headerBlocks.erase(
+      std::remove_if(
+          this->m_headerBlocks.begin(),
+          this->m_headerBlocks.end(),
+          [&name](std::shared_ptr<const _internal::HttpHeaderBlock> const& headerBlock) {
+            return headerBlock->Contains(name);
+          }),
+      this->m_headerBlocks.end());
 }
 
 void Request::StartTry()
 {
   this->m_retryModeEnabled = true;
-  this->m_retryHeaders.clear();
+  for (auto& header : this->m_headersBeforeTry)
+  {
+    if (header.second.HasValue())
+    {
+      this->m_headers[header.first] = std::move(header.second.Value());
+    }
+    else
+    {
+      this->m_headers.erase(header.first);
+    }
+  }
+  this->m_headersBeforeTry.clear();
 
   // Make sure to rewind the body stream before each attempt, including the first.
   // It's possible the request doesn't have a body, so make sure to check if a body stream exists.
@@ -52,9 +105,9 @@ void Request::StartTry()
 
 HttpMethod Request::GetMethod() const { return this->m_method; }
 
-Azure::Core::CaseInsensitiveMap Request::GetHeaders() const
+Azure::Core::CaseInsensitiveMap Request::GetHeaders() const { return this->m_headers; }
+
+Azure::Core::CaseInsensitiveMap const& Request::GetHeadersReference() const
 {
-  // create map with retry headers which are the most important and we don't want
-  // to override them with any duplicate header
-  return MergeMaps(this->m_retryHeaders, this->m_headers);
+  return this->m_headers;
 }
@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/policies/request_coalescer.hpp"
+
+#include "azure/core/io/body_stream.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using Azure::Core::Context;
+using Azure::Core::Http::HttpMethod;
+using Azure::Core::Http::RawResponse;
+using Azure::Core::Http::Request;
+using Azure::Core::Http::Policies::RequestCoalescer;
+using Azure::Core::IO::MemoryBodyStream;
+using Azure::Core::IO::SharedBuffer;
+
+namespace {
+// Wait in short steps to notice when the context is cancelled.
+constexpr auto MaxWaitStep = std::chrono::milliseconds(100);
+
+// The headers which differ between identical requests. The authorization is part of the key, so
+// a signature covering them still keeps the requests apart.
+bool IsPerRequestHeader(std::string const& name)
+{
+  return name == "x-ms-client-request-id" || name == "x-ms-date" || name == "date";
+}
+
+std::string GetRequestKey(Request const& request)
+{
+  std::string key = request.GetUrl().GetAbsoluteUrl();
+  for (auto const& header : request.GetHeadersReference())
+  {
+    if (!IsPerRequestHeader(header.first))
+    {
+      key += '\n' + header.first + ':' + header.second;
+    }
+  }
+  return key;
+}
+
+// Each copy reads the shared body with its own stream, or has its own copy of it when the request
+// buffers its response.
+std::unique_ptr<RawResponse> CopyResponse(
+    RawResponse const& response,
+    SharedBuffer const& body,
+    bool bufferResponse)
+{
+  auto copy = std::make_unique<RawResponse>(response);
+  for (auto const& header : response.GetHeaders())
+  {
+    copy->SetHeader(header.first, header.second);
+  }
+  if (bufferResponse)
+  {
+    copy->SetBody(std::vector<uint8_t>(body.GetData(), body.GetData() + body.GetSize()));
+  }
+  else
+  {
+    copy->SetBodyStream(std::make_unique<MemoryBodyStream>(body));
+  }
+  return copy;
+}
+} // namespace
+
+RequestCoalescer::RequestCoalescer(size_t maxBodySize) : m_maxBodySize(maxBodySize) {}
+
+std::unique_ptr<RawResponse> RequestCoalescer::Send(
+    Request& request,
+    Context const& context,
+    std::function<std::unique_ptr<RawResponse>()> const& send)
+{
+  auto const bodyStream = request.GetBodyStream();
+  if (request.GetMethod() != HttpMethod::Get || (bodyStream && bodyStream->Length() != 0))
+  {
+    return send();
+  }
+
+  auto const key = GetRequestKey(request);
+  std::shared_ptr<Flight> flight;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto found = m_flights.find(key);
+    if (found == m_flights.end())
+    {
+      flight = std::make_shared<Flight>();
+      m_flights.emplace(key, flight);
+      lock.unlock();
+      return SendFirst(request, context, send, key, flight);
+    }
+    flight = found->second;
+    ++m_coalescedRequestCount;
+    while (!flight->Landed)
+    {
+      if (context.IsCancelled())
+      {
+        lock.unlock();
+        context.ThrowIfCancelled();
+      }
+      m_landed.wait_for(lock, MaxWaitStep);
+    }
+  }
+  // The flight doesn't change once it landed.
+  if (flight->Response)
+  {
+    return CopyResponse(*flight->Response, flight->Body, request.ShouldBufferResponse());
+  }
+  // The identical request failed, or its body was too large to be shared.
+  return send();
+}
+
+std::unique_ptr<RawResponse> RequestCoalescer::SendFirst(
+    Request& request,
+    Context const& context,
+    std::function<std::unique_ptr<RawResponse>()> const& send,
+    std::string const& key,
+    std::shared_ptr<Flight> const& flight)
+{
+  std::unique_ptr<RawResponse> response;
+  try
+  {
+    response = send();
+    int64_t contentLength = -1;
+    auto const& headers = response->GetHeaders();
+    auto const contentLengthHeader = headers.find("Content-Length");
+    if (contentLengthHeader != headers.end())
+    {
+      try
+      {
+        contentLength = std::stoll(contentLengthHeader->second);
+      }
+      catch (std::exception const&)
+      {
+      }
+    }
+    if (request.ShouldBufferResponse())
+    {
+      if (response->GetBody().size() <= m_maxBodySize)
+      {
+        flight->Body = SharedBuffer(response->GetBody());
+        flight->Response = std::make_unique<RawResponse>(*response);
+      }
+    }
+    else if (contentLength >= 0 && static_cast<uint64_t>(contentLength) <= m_maxBodySize)
+    {
+      // The body is read before the response is returned, so that it can be shared.
+      auto stream = response->ExtractBodyStream();
+      flight->Body = SharedBuffer(stream ? stream->ReadToEnd(context) : response->GetBody());
+      response->SetBodyStream(std::make_unique<MemoryBodyStream>(flight->Body));
+      flight->Response = std::make_unique<RawResponse>(*response);
+    }
+  }
+  catch (...)
+  {
+    flight->Response.reset();
+    Land(key, flight);
+    throw;
+  }
+  if (flight->Response)
+  {
+    for (auto const& header : response->GetHeaders())
+    {
+      flight->Response->SetHeader(header.first, header.second);
+    }
+  }
+  Land(key, flight);
+  return response;
+}
+
+size_t RequestCoalescer::GetCoalescedRequestCount()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_coalescedRequestCount;
+}
+
+void RequestCoalescer::Land(std::string const& key, std::shared_ptr<Flight> const& flight)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    flight->Landed = true;
+    m_flights.erase(key);
+  }
+  m_landed.notify_all();
+}
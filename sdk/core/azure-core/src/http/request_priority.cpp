@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/request_priority.hpp"
+
+#include "azure/core/http/policies/policy.hpp"
+
+#include <utility>
+
+using Azure::Core::Context;
+using namespace Azure::Core::Http;
+using namespace Azure::Core::Http::Policies;
+using namespace Azure::Core::Http::Policies::_internal;
+
+namespace {
+Context::Key const PriorityKey;
+
+// The context of the request, with the priority of the client options unless it has one.
+Context GetPriorityContext(Context const& context, RequestPriority priority)
+{
+  RequestPriority contextPriority;
+  if (context.TryGetValue(PriorityKey, contextPriority))
+  {
+    return context;
+  }
+  return context.WithValue(PriorityKey, priority);
+}
+} // namespace
+
+namespace Azure { namespace Core { namespace Http {
+
+  Context WithRequestPriority(Context const& context, RequestPriority priority)
+  {
+    return context.WithValue(PriorityKey, priority);
+  }
+
+  RequestPriority GetRequestPriority(Context const& context)
+  {
+    RequestPriority priority = RequestPriority::Normal;
+    context.TryGetValue(PriorityKey, priority);
+    return priority;
+  }
+
+}}} // namespace Azure::Core::Http
+
+std::unique_ptr<RawResponse> RequestPriorityPolicy::Send(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context) const
+{
+  return nextPolicy.Send(request, GetPriorityContext(context, m_priority));
+}
+
+void RequestPriorityPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendCompletionCallback callback) const
+{
+  nextPolicy.SendAsync(request, GetPriorityContext(context, m_priority), std::move(callback));
+}
@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/response_buffer_pool.hpp"
+
+#include <utility>
+
+using namespace Azure::Core::Http;
+
+std::vector<uint8_t> ResponseBufferPool::Acquire(size_t sizeHint)
+{
+  std::vector<uint8_t> buffer;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_buffers.empty())
+    {
+      // The smallest buffer large enough for the body, or else the largest one.
+      auto best = m_buffers.begin();
+      for (auto ite = m_buffers.begin(); ite != m_buffers.end(); ++ite)
+      {
+        bool const fits = ite->capacity() >= sizeHint;
+        bool const bestFits = best->capacity() >= sizeHint;
+        if ((fits && (!bestFits || ite->capacity() < best->capacity()))
+            || (!fits && !bestFits && ite->capacity() > best->capacity()))
+        {
+          best = ite;
+        }
+      }
+      buffer = std::move(*best);
+      m_buffers.erase(best);
+    }
+  }
+  buffer.clear();
+  buffer.reserve(sizeHint);
+  return buffer;
+}
+
+void ResponseBufferPool::Release(std::vector<uint8_t> buffer)
+{
+  if (buffer.capacity() == 0 || buffer.capacity() > m_maxBufferCapacity)
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_buffers.size() < m_maxPooledBuffers)
+  {
+    m_buffers.push_back(std::move(buffer));
+  }
+}
+
+size_t ResponseBufferPool::GetPooledBufferCount() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_buffers.size();
+}
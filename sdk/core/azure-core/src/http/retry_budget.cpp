@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/policies/retry_budget.hpp"
+
+#include <algorithm>
+
+using Azure::Core::Http::Policies::RetryBudget;
+
+RetryBudget::RetryBudget(double retryRatio, double minRetriesPerSecond, double maxTokens)
+    : m_retryRatio(retryRatio), m_minRetriesPerSecond(minRetriesPerSecond),
+      m_maxTokens(maxTokens), m_tokens(maxTokens),
+      m_lastRefill(std::chrono::steady_clock::now())
+{
+}
+
+void RetryBudget::Refill()
+{
+  auto const now = std::chrono::steady_clock::now();
+  auto const elapsed = std::chrono::duration<double>(now - m_lastRefill).count();
+  m_lastRefill = now;
+  m_tokens = (std::min)(m_tokens + elapsed * m_minRetriesPerSecond, m_maxTokens);
+}
+
+void RetryBudget::Deposit()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Refill();
+  m_tokens = (std::min)(m_tokens + m_retryRatio, m_maxTokens);
+}
+
+bool RetryBudget::TryWithdraw()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Refill();
+  if (m_tokens < 1.0)
+  {
+    return false;
+  }
+  m_tokens -= 1.0;
+  return true;
+}
+
+double RetryBudget::GetTokens()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Refill();
+  return m_tokens;
+}
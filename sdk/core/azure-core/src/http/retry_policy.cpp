@@ -3,11 +3,16 @@
 
 #include "azure/core/http/policies/policy.hpp"
 #include "azure/core/internal/diagnostics/log.hpp"
+#include "../private/retry_after.hpp"
+#include "../private/shared_timer.hpp"
 
 #include <algorithm>
 #include <cstdlib>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <sstream>
+#include <string>
 #include <thread>
 
 using Azure::Core::Context;
@@ -15,8 +20,9 @@ using namespace Azure::Core::Http;
 using namespace Azure::Core::Http::Policies;
 using namespace Azure::Core::Http::Policies::_internal;
 
-namespace {
-bool GetResponseHeaderBasedDelay(RawResponse const& response, std::chrono::milliseconds& retryAfter)
+bool Azure::Core::Http::Policies::_detail::GetResponseHeaderBasedDelay(
+    RawResponse const& response,
+    std::chrono::milliseconds& retryAfter)
 {
   // Try to find retry-after headers. There are several of them possible.
   auto const& responseHeaders = response.GetHeaders();
@@ -53,6 +59,7 @@ bool GetResponseHeaderBasedDelay(RawResponse const& response, std::chrono::milli
   return false;
 }
 
+namespace {
 std::chrono::milliseconds CalculateExponentialDelay(
     RetryOptions const& retryOptions,
     int32_t attempt,
@@ -89,8 +96,52 @@ bool WasLastAttempt(RetryOptions const& retryOptions, int32_t attempt)
 }
 
 Context::Key const RetryKey;
+
+// The context of a try, cancelled once the timeout of the try is over.
+Context GetTryContext(Context const& retryContext, RetryOptions const& retryOptions)
+{
+  if (retryOptions.TryTimeout <= std::chrono::milliseconds::zero())
+  {
+    return retryContext;
+  }
+  return retryContext.WithDeadline(
+      Azure::DateTime(std::chrono::system_clock::now() + retryOptions.TryTimeout));
+}
+
+std::string GetTryTimeoutMessage(RetryOptions const& retryOptions)
+{
+  return "HTTP try timed out after " + std::to_string(retryOptions.TryTimeout.count()) + "ms.";
+}
 } // namespace
 
+// Withdraw the token of a retry from the budget, if any.
+bool RetryPolicy::IsRetryWithinBudget() const
+{
+  using Azure::Core::Diagnostics::Logger;
+  using Azure::Core::Diagnostics::_internal::Log;
+
+  if (!m_retryBudget || m_retryBudget->TryWithdraw())
+  {
+    return true;
+  }
+
+  if (Log::ShouldWrite(Logger::Level::Warning))
+  {
+    Log::Write(
+        Logger::Level::Warning, "HTTP retry budget exhausted, the request won't be retried.");
+  }
+  return false;
+}
+
+// A response which isn't retried deposits in the budget, if any.
+void RetryPolicy::DepositInRetryBudget() const
+{
+  if (m_retryBudget)
+  {
+    m_retryBudget->Deposit();
+  }
+}
+
 int32_t RetryPolicy::GetRetryCount(Context const& context)
 {
   int32_t number = -1;
@@ -126,16 +177,22 @@ std::unique_ptr<RawResponse> RetryPolicy::Send(
 
     try
     {
-      auto response = nextPolicy.Send(request, retryContext);
+      auto response = nextPolicy.Send(request, GetTryContext(retryContext, m_retryOptions));
 
       // If we are out of retry attempts, if a response is non-retriable (or simply 200 OK, i.e
       // doesn't need to be retried), then ShouldRetry returns false.
       if (!ShouldRetryOnResponse(*response.get(), m_retryOptions, attempt, retryAfter))
       {
+        DepositInRetryBudget();
         // If this is the second attempt and StartTry was called, we need to stop it. Otherwise
         // trying to perform same request would use last retry query/headers
         return response;
       }
+
+      if (!IsRetryWithinBudget())
+      {
+        return response;
+      }
     }
     catch (const TransportException& e)
     {
@@ -144,10 +201,31 @@ std::unique_ptr<RawResponse> RetryPolicy::Send(
         Log::Write(Logger::Level::Warning, std::string("HTTP Transport error: ") + e.what());
       }
 
-      if (!ShouldRetryOnTransportFailure(m_retryOptions, attempt, retryAfter))
+      if (!ShouldRetryOnTransportFailure(m_retryOptions, attempt, retryAfter)
+          || !IsRetryWithinBudget())
+      {
+        throw;
+      }
+    }
+    catch (const Azure::Core::OperationCancelledException&)
+    {
+      // Only the timeout of the try is retried, not the cancellation of the operation.
+      if (context.IsCancelled())
       {
         throw;
       }
+
+      auto const message = GetTryTimeoutMessage(m_retryOptions);
+      if (Log::ShouldWrite(Logger::Level::Warning))
+      {
+        Log::Write(Logger::Level::Warning, message);
+      }
+
+      if (!ShouldRetryOnTransportFailure(m_retryOptions, attempt, retryAfter)
+          || !IsRetryWithinBudget())
+      {
+        throw TransportException(message);
+      }
     }
 
     if (Log::ShouldWrite(Logger::Level::Informational))
@@ -176,6 +254,177 @@ std::unique_ptr<RawResponse> RetryPolicy::Send(
   }
 }
 
+void RetryPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendCompletionCallback callback) const
+{
+  using Azure::Core::Diagnostics::Logger;
+  using Azure::Core::Diagnostics::_internal::Log;
+
+  // The state of the attempts is kept alive by the callback of the attempt in flight, or by the
+  // timer waiting for the next one. It owns a copy of this policy, which the caller can destroy
+  // once it is called back.
+  struct RetryState final
+  {
+    std::shared_ptr<RetryPolicy const> Policy;
+    Request& HttpRequest;
+    NextHttpPolicy NextPolicy;
+    Context OriginalContext;
+    SendCompletionCallback Callback;
+    int32_t RetryCount = 0;
+    Context RetryContext;
+    int32_t Attempt = 0;
+    std::map<std::string, std::string> OriginalQueryParameters;
+    void (*SendAttempt)(std::shared_ptr<RetryState>) = nullptr;
+
+    RetryState(
+        std::shared_ptr<RetryPolicy const> policy,
+        Request& request,
+        NextHttpPolicy nextPolicy,
+        Context const& context,
+        SendCompletionCallback callback)
+        : Policy(std::move(policy)), HttpRequest(request), NextPolicy(nextPolicy),
+          OriginalContext(context), Callback(std::move(callback)),
+          RetryContext(context.WithValue(RetryKey, &RetryCount))
+    {
+    }
+  };
+
+  auto state = std::make_shared<RetryState>(
+      std::shared_ptr<RetryPolicy const>(static_cast<RetryPolicy*>(Clone().release())),
+      request,
+      nextPolicy,
+      context,
+      std::move(callback));
+  state->SendAttempt = [](std::shared_ptr<RetryState> attemptState) {
+    ++attemptState->Attempt;
+    attemptState->HttpRequest.StartTry();
+    // creates a copy of original query parameters from request
+    attemptState->OriginalQueryParameters
+        = attemptState->HttpRequest.GetUrl().GetQueryParameters();
+
+    auto onResponse = [attemptState](
+                          std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+      auto const& s = attemptState;
+      auto const& policy = *s->Policy;
+      std::chrono::milliseconds retryAfter{};
+      if (!error)
+      {
+        if (!policy.ShouldRetryOnResponse(
+                *response.get(), policy.m_retryOptions, s->Attempt, retryAfter))
+        {
+          policy.DepositInRetryBudget();
+          s->Callback(std::move(response), nullptr);
+          return;
+        }
+
+        if (!policy.IsRetryWithinBudget())
+        {
+          s->Callback(std::move(response), nullptr);
+          return;
+        }
+      }
+      else
+      {
+        try
+        {
+          std::rethrow_exception(error);
+        }
+        catch (const TransportException& e)
+        {
+          if (Log::ShouldWrite(Logger::Level::Warning))
+          {
+            Log::Write(Logger::Level::Warning, std::string("HTTP Transport error: ") + e.what());
+          }
+
+          if (!policy.ShouldRetryOnTransportFailure(
+                  policy.m_retryOptions, s->Attempt, retryAfter)
+              || !policy.IsRetryWithinBudget())
+          {
+            s->Callback(nullptr, error);
+            return;
+          }
+        }
+        catch (const Azure::Core::OperationCancelledException&)
+        {
+          // Only the timeout of the try is retried, not the cancellation of the operation.
+          if (s->OriginalContext.IsCancelled())
+          {
+            s->Callback(nullptr, error);
+            return;
+          }
+
+          auto const message = GetTryTimeoutMessage(policy.m_retryOptions);
+          if (Log::ShouldWrite(Logger::Level::Warning))
+          {
+            Log::Write(Logger::Level::Warning, message);
+          }
+
+          if (!policy.ShouldRetryOnTransportFailure(
+                  policy.m_retryOptions, s->Attempt, retryAfter)
+              || !policy.IsRetryWithinBudget())
+          {
+            s->Callback(nullptr, std::make_exception_ptr(TransportException(message)));
+            return;
+          }
+        }
+        catch (...)
+        {
+          s->Callback(nullptr, error);
+          return;
+        }
+      }
+
+      if (Log::ShouldWrite(Logger::Level::Informational))
+      {
+        std::ostringstream log;
+
+        log << "HTTP Retry attempt #" << s->Attempt << " will be made in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(retryAfter).count() << "ms.";
+
+        Log::Write(Logger::Level::Informational, log.str());
+      }
+
+      // Restore the original query parameters before next retry
+      s->HttpRequest.GetUrl().SetQueryParameters(std::move(s->OriginalQueryParameters));
+
+      // Update retry number
+      s->RetryCount += 1;
+
+      if (retryAfter.count() <= 0)
+      {
+        s->SendAttempt(s);
+        return;
+      }
+
+      // Wait for the next attempt without blocking the thread calling back, which can be the
+      // event loop of the transport.
+      Azure::Core::_detail::SharedTimer::Schedule(
+          std::chrono::steady_clock::now() + retryAfter,
+          s->OriginalContext,
+          [s](bool isCancelled) {
+            if (isCancelled)
+            {
+              s->Callback(
+                  nullptr,
+                  std::make_exception_ptr(Azure::Core::OperationCancelledException(
+                      "Request was cancelled by context.")));
+              return;
+            }
+            s->SendAttempt(s);
+          });
+    };
+
+    attemptState->NextPolicy.SendAsync(
+        attemptState->HttpRequest,
+        GetTryContext(attemptState->RetryContext, attemptState->Policy->m_retryOptions),
+        std::move(onResponse));
+  };
+  state->SendAttempt(state);
+}
+
 bool RetryPolicy::ShouldRetryOnTransportFailure(
     RetryOptions const& retryOptions,
     int32_t attempt,
@@ -233,7 +482,7 @@ bool RetryPolicy::ShouldRetryOnResponse(
     }
   }
 
-  if (!GetResponseHeaderBasedDelay(response, retryAfter))
+  if (!Policies::_detail::GetResponseHeaderBasedDelay(response, retryAfter))
   {
     retryAfter = CalculateExponentialDelay(retryOptions, attempt, jitterFactor);
   }
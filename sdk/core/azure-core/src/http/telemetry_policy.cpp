@@ -162,6 +162,16 @@ std::unique_ptr<RawResponse> TelemetryPolicy::Send(
     NextHttpPolicy nextPolicy,
     Context const& context) const
 {
-  request.SetHeader("User-Agent", m_telemetryId);
+  request.AddHeaderBlock(m_headerBlock);
   return nextPolicy.Send(request, context);
 }
+
+void TelemetryPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendCompletionCallback callback) const
+{
+  request.AddHeaderBlock(m_headerBlock);
+  nextPolicy.SendAsync(request, context, std::move(callback));
+}
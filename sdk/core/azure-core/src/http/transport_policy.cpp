@@ -3,6 +3,8 @@
 
 #include "azure/core/http/policies/policy.hpp"
 
+#include <chrono>
+
 #if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
 #include "azure/core/http/curl_transport.hpp"
 #endif
@@ -17,6 +19,55 @@ using namespace Azure::Core::Http;
 using namespace Azure::Core::Http::Policies;
 using namespace Azure::Core::Http::Policies::_internal;
 
+namespace {
+// Downloads the body stream of the response to its body, into a buffer of the pool if any.
+void DownloadResponseBody(
+    RawResponse& response,
+    BodyStream& bodyStream,
+    std::shared_ptr<ResponseBufferPool> const& bufferPool,
+    Context const& context)
+{
+  if (bufferPool == nullptr)
+  {
+    response.SetBody(bodyStream.ReadToEnd(context));
+    return;
+  }
+  auto const length = bodyStream.Length();
+  auto body = bufferPool->Acquire(length > 0 ? static_cast<size_t>(length) : 0);
+  bodyStream.ReadToEnd(body, context);
+  response.SetBody(std::move(body), bufferPool);
+}
+
+// Same as DownloadResponseBody(), recording the duration of the download to the request timings
+// of the instrumentation policy and of the response, if any.
+void BufferResponseBody(
+    RawResponse& response,
+    BodyStream& bodyStream,
+    std::shared_ptr<ResponseBufferPool> const& bufferPool,
+    Context const& context)
+{
+  auto const timings = InstrumentationPolicy::GetRequestTimings(context);
+  if (timings == nullptr && !response.GetRequestTimings().HasValue())
+  {
+    DownloadResponseBody(response, bodyStream, bufferPool, context);
+    return;
+  }
+  auto const start = std::chrono::steady_clock::now();
+  DownloadResponseBody(response, bodyStream, bufferPool, context);
+  auto const transfer = std::chrono::steady_clock::now() - start;
+  if (timings != nullptr)
+  {
+    timings->ResponseTransfer = transfer;
+  }
+  if (response.GetRequestTimings().HasValue())
+  {
+    auto responseTimings = response.GetRequestTimings().Value();
+    responseTimings.ResponseTransfer = transfer;
+    response.SetRequestTimings(responseTimings);
+  }
+}
+} // namespace
+
 std::shared_ptr<HttpTransport> Azure::Core::Http::Policies::_detail::GetTransportAdapter()
 {
   // The order of these checks is important so that WinHTTP is picked over libcurl on Windows, when
@@ -71,9 +122,64 @@ std::unique_ptr<RawResponse> TransportPolicy::Send(
   // At this point, either the request is `shouldBufferResponse` or it return with an error code.
   // The entire payload needs must be downloaded to the response's buffer.
   auto bodyStream = response->ExtractBodyStream();
-  response->SetBody(bodyStream->ReadToEnd(context));
+  BufferResponseBody(*response, *bodyStream, m_options.ResponseBufferPool, context);
 
   // BodyStream is moved out of response. This makes transport implementation to clean any active
   // session with sockets or internal state.
   return response;
 }
+
+void TransportPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendCompletionCallback callback) const
+{
+  (void)nextPolicy;
+  if (context.IsCancelled())
+  {
+    callback(
+        nullptr,
+        std::make_exception_ptr(
+            Azure::Core::OperationCancelledException("Request was cancelled by context.")));
+    return;
+  }
+
+  m_options.Transport->SendAsync(
+      request,
+      context,
+      [&request, context, callback, bufferPool = m_options.ResponseBufferPool](
+          std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+        if (error)
+        {
+          callback(nullptr, error);
+          return;
+        }
+
+        auto statusCode = static_cast<typename std::underlying_type<Http::HttpStatusCode>::type>(
+            response->GetStatusCode());
+
+        // Same as Send(). Transports calling back from their own thread download the payload to
+        // the response's buffer before calling back, so there is no body stream to read here.
+        if (!request.ShouldBufferResponse() && statusCode < 300)
+        {
+          callback(std::move(response), nullptr);
+          return;
+        }
+
+        try
+        {
+          auto bodyStream = response->ExtractBodyStream();
+          if (bodyStream != nullptr)
+          {
+            BufferResponseBody(*response, *bodyStream, bufferPool, context);
+          }
+        }
+        catch (...)
+        {
+          callback(nullptr, std::current_exception());
+          return;
+        }
+        callback(std::move(response), nullptr);
+      });
+}
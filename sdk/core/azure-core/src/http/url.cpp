@@ -92,7 +92,11 @@ std::string Url::Decode(const std::string& value)
     return t;
   }();
 
+  auto const hexValue
+      = [](char c) { return hexTable[static_cast<size_t>(static_cast<unsigned char>(c))]; };
+
   std::string decodedValue;
+  decodedValue.reserve(value.size());
   for (size_t i = 0; i < value.size();)
   {
     char c = value[i];
@@ -103,11 +107,11 @@ std::string Url::Decode(const std::string& value)
     }
     else if (c == '%')
     {
-      if (i + 2 >= value.size() || hexTable[value[i + 1]] < 0 || hexTable[value[i + 2]] < 0)
+      if (i + 2 >= value.size() || hexValue(value[i + 1]) < 0 || hexValue(value[i + 2]) < 0)
       {
         throw std::runtime_error("failed when decoding URL component");
       }
-      int v = (hexTable[value[i + 1]] << 4) + hexTable[value[i + 2]];
+      int v = (hexValue(value[i + 1]) << 4) + hexValue(value[i + 2]);
       decodedValue += static_cast<std::string::value_type>(v);
       i += 3;
     }
@@ -120,33 +124,70 @@ std::string Url::Decode(const std::string& value)
   return decodedValue;
 }
 
-std::string Url::Encode(const std::string& value, const std::string& doNotEncodeSymbols)
+_internal::UrlEncoder::UrlEncoder(const std::string& doNotEncodeSymbols)
+{
+  // The default non-URL-encode chars, which are never escaped.
+  static constexpr char NonUrlEncodeChars[]
+      = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-._~";
+
+  std::fill(std::begin(m_doNotEncode), std::end(m_doNotEncode), false);
+  for (size_t i = 0; i < sizeof(NonUrlEncodeChars) - 1; ++i)
+  {
+    m_doNotEncode[static_cast<unsigned char>(NonUrlEncodeChars[i])] = true;
+  }
+  for (const char c : doNotEncodeSymbols)
+  {
+    m_doNotEncode[static_cast<unsigned char>(c)] = true;
+  }
+}
+
+std::string _internal::UrlEncoder::Encode(const std::string& value) const
 {
-  const char* hex = "0123456789ABCDEF";
-  std::unordered_set<unsigned char> noEncodingSymbolsSet(
-      doNotEncodeSymbols.begin(), doNotEncodeSymbols.end());
-
-  std::string encoded;
-  for (char c : value)
-  {
-    unsigned char uc = c;
-    // encode if char is not in the default non-encoding set AND if it is NOT in chars to ignore
-    // from user input
-    if (defaultNonUrlEncodeChars.find(uc) == defaultNonUrlEncodeChars.end()
-        && noEncodingSymbolsSet.find(uc) == noEncodingSymbolsSet.end())
+  static constexpr char Hex[] = "0123456789ABCDEF";
+
+  // Size the output first, so that it's written in a single allocation.
+  size_t encodedLength = value.size();
+  for (const char c : value)
+  {
+    if (!m_doNotEncode[static_cast<unsigned char>(c)])
+    {
+      encodedLength += 2;
+    }
+  }
+  if (encodedLength == value.size())
+  {
+    return value;
+  }
+
+  std::string encoded(encodedLength, '\0');
+  auto output = &encoded[0];
+  for (const char c : value)
+  {
+    auto const uc = static_cast<unsigned char>(c);
+    if (m_doNotEncode[uc])
     {
-      encoded += '%';
-      encoded += hex[(uc >> 4) & 0x0f];
-      encoded += hex[uc & 0x0f];
+      *output++ = c;
     }
     else
     {
-      encoded += c;
+      *output++ = '%';
+      *output++ = Hex[uc >> 4];
+      *output++ = Hex[uc & 0x0f];
     }
   }
   return encoded;
 }
 
+std::string Url::Encode(const std::string& value, const std::string& doNotEncodeSymbols)
+{
+  if (doNotEncodeSymbols.empty())
+  {
+    static const _internal::UrlEncoder DefaultEncoder;
+    return DefaultEncoder.Encode(value);
+  }
+  return _internal::UrlEncoder(doNotEncodeSymbols).Encode(value);
+}
+
 void Url::AppendQueryParameters(const std::string& query)
 {
   std::string::const_iterator cur = query.begin();
@@ -178,20 +219,37 @@ void Url::AppendQueryParameters(const std::string& query)
   }
 }
 
-std::string Url::GetUrlWithoutQuery(bool relative) const
+std::string Url::FormatUrl(bool relative) const
 {
+  static constexpr char SchemeSeparator[] = "://";
+  // A colon and up to 5 digits.
+  static constexpr size_t MaxPortLength = 6;
+
+  size_t length = m_encodedPath.size() + 1;
+  if (!relative)
+  {
+    length += m_scheme.size() + sizeof(SchemeSeparator) - 1 + m_host.size() + MaxPortLength;
+  }
+  for (const auto& q : m_encodedQueryParameters)
+  {
+    length += q.first.size() + q.second.size() + 2;
+  }
+
   std::string url;
+  url.reserve(length);
 
   if (!relative)
   {
     if (!m_scheme.empty())
     {
-      url += m_scheme + "://";
+      url += m_scheme;
+      url += SchemeSeparator;
     }
     url += m_host;
     if (m_port != 0)
     {
-      url += ":" + std::to_string(m_port);
+      url += ':';
+      url += std::to_string(m_port);
     }
   }
 
@@ -199,29 +257,25 @@ std::string Url::GetUrlWithoutQuery(bool relative) const
   {
     if (!relative)
     {
-      url += "/";
+      url += '/';
     }
 
     url += m_encodedPath;
   }
 
-  return url;
-}
+  auto separator = '?';
+  for (const auto& q : m_encodedQueryParameters)
+  {
+    url += separator;
+    url += q.first;
+    url += '=';
+    url += q.second;
+    separator = '&';
+  }
 
-std::string Url::GetRelativeUrl() const
-{
-  return GetUrlWithoutQuery(true)
-      + _detail::FormatEncodedUrlQueryParameters(m_encodedQueryParameters);
+  return url;
 }
 
-std::string Url::GetAbsoluteUrl() const
-{
-  return GetUrlWithoutQuery(false)
-      + _detail::FormatEncodedUrlQueryParameters(m_encodedQueryParameters);
-}
+std::string Url::GetRelativeUrl() const { return FormatUrl(true); }
 
-const std::unordered_set<unsigned char> Url::defaultNonUrlEncodeChars
-    = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q',
-       'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
-       'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y',
-       'Z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '-', '.', '_', '~'};
+std::string Url::GetAbsoluteUrl() const { return FormatUrl(false); }
@@ -9,7 +9,11 @@
 
 #include <Windows.h>
 #include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 #include <winhttp.h>
 
 using Azure::Core::Context;
@@ -180,7 +184,7 @@ std::string GetHeadersAsString(Azure::Core::Http::Request const& request)
 {
   std::string requestHeaderString;
 
-  for (auto const& header : request.GetHeaders())
+  for (auto const& header : request.GetHeadersReference())
   {
     requestHeaderString += header.first; // string (key)
     requestHeaderString += ": ";
@@ -201,19 +205,552 @@ void GetErrorAndThrow(const std::string& exceptionMessage)
       exceptionMessage + " Error Code: " + std::to_string(error) + ".");
 }
 
-void WinHttpTransport::CreateSessionHandle(std::unique_ptr<_detail::HandleManager>& handleManager)
+namespace {
+
+HINTERNET OpenRequestHandle(HINTERNET connectionHandle, Request const& request)
+{
+  const std::string& path = request.GetUrl().GetRelativeUrl();
+  HttpMethod requestMethod = request.GetMethod();
+
+  // Create an HTTP request handle.
+  HINTERNET requestHandle = WinHttpOpenRequest(
+      connectionHandle,
+      HttpMethodToWideString(requestMethod).c_str(),
+      path.empty() ? NULL
+                   : StringToWideString(path)
+                         .c_str(), // Name of the target resource of the specified HTTP verb
+      NULL, // Use HTTP/1.1
+      WINHTTP_NO_REFERER,
+      WINHTTP_DEFAULT_ACCEPT_TYPES, // No media types are accepted by the client
+      WINHTTP_FLAG_SECURE); // Uses secure transaction semantics (SSL/TLS)
+
+  if (!requestHandle)
+  {
+    // Errors include:
+    // ERROR_WINHTTP_INCORRECT_HANDLE_TYPE
+    // ERROR_WINHTTP_INTERNAL_ERROR
+    // ERROR_WINHTTP_INVALID_URL
+    // ERROR_WINHTTP_OPERATION_CANCELLED
+    // ERROR_WINHTTP_UNRECOGNIZED_SCHEME
+    // ERROR_NOT_ENOUGH_MEMORY
+    GetErrorAndThrow("Error while getting a request handle.");
+  }
+  return requestHandle;
+}
+
+// Create the response from the status line and headers received for the request, without a body.
+std::unique_ptr<RawResponse> CreateRawResponse(HINTERNET requestHandle)
+{
+  // First, use WinHttpQueryHeaders to obtain the size of the buffer.
+  // The call is expected to fail since no destination buffer is provided.
+  DWORD sizeOfHeaders = 0;
+  if (WinHttpQueryHeaders(
+          requestHandle,
+          WINHTTP_QUERY_RAW_HEADERS,
+          WINHTTP_HEADER_NAME_BY_INDEX,
+          NULL,
+          &sizeOfHeaders,
+          WINHTTP_NO_HEADER_INDEX))
+  {
+    // WinHttpQueryHeaders was expected to fail.
+    throw Azure::Core::Http::TransportException("Error while querying response headers.");
+  }
+
+  {
+    DWORD error = GetLastError();
+    if (error != ERROR_INSUFFICIENT_BUFFER)
+    {
+      throw Azure::Core::Http::TransportException(
+          "Error while querying response headers. Error Code: " + std::to_string(error) + ".");
+    }
+  }
+
+  // Allocate memory for the buffer.
+  std::vector<WCHAR> outputBuffer(sizeOfHeaders / sizeof(WCHAR), 0);
+
+  // Now, use WinHttpQueryHeaders to retrieve all the headers.
+  // Each header is terminated by "\0". An additional "\0" terminates the list of headers.
+  if (!WinHttpQueryHeaders(
+          requestHandle,
+          WINHTTP_QUERY_RAW_HEADERS,
+          WINHTTP_HEADER_NAME_BY_INDEX,
+          outputBuffer.data(),
+          &sizeOfHeaders,
+          WINHTTP_NO_HEADER_INDEX))
+  {
+    GetErrorAndThrow("Error while querying response headers.");
+  }
+
+  auto start = outputBuffer.begin();
+  auto last = start + sizeOfHeaders / sizeof(WCHAR);
+  auto statusLineEnd = std::find(start, last, '\0');
+  start = statusLineEnd + 1; // start of headers
+  std::string responseHeaders = WideStringToString(std::wstring(start, last));
+
+  DWORD sizeOfHttp = sizeOfHeaders;
+
+  // Get the HTTP version.
+  if (!WinHttpQueryHeaders(
+          requestHandle,
+          WINHTTP_QUERY_VERSION,
+          WINHTTP_HEADER_NAME_BY_INDEX,
+          outputBuffer.data(),
+          &sizeOfHttp,
+          WINHTTP_NO_HEADER_INDEX))
+  {
+    GetErrorAndThrow("Error while querying response headers.");
+  }
+
+  start = outputBuffer.begin();
+  // Assuming ASCII here is OK since the input is expected to be an HTTP version string.
+  std::string httpVersion = WideStringToStringASCII(start, start + sizeOfHttp / sizeof(WCHAR));
+
+  uint16_t majorVersion = 0;
+  uint16_t minorVersion = 0;
+  ParseHttpVersion(httpVersion, &majorVersion, &minorVersion);
+
+  DWORD statusCode = 0;
+  DWORD dwSize = sizeof(statusCode);
+
+  // Get the status code as a number.
+  if (!WinHttpQueryHeaders(
+          requestHandle,
+          WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER,
+          WINHTTP_HEADER_NAME_BY_INDEX,
+          &statusCode,
+          &dwSize,
+          WINHTTP_NO_HEADER_INDEX))
+  {
+    GetErrorAndThrow("Error while querying response headers.");
+  }
+
+  HttpStatusCode httpStatusCode = static_cast<HttpStatusCode>(statusCode);
+
+  // Get the optional reason phrase.
+  std::string reasonPhrase;
+  DWORD sizeOfReasonPhrase = sizeOfHeaders;
+
+  if (WinHttpQueryHeaders(
+          requestHandle,
+          WINHTTP_QUERY_STATUS_TEXT,
+          WINHTTP_HEADER_NAME_BY_INDEX,
+          outputBuffer.data(),
+          &sizeOfReasonPhrase,
+          WINHTTP_NO_HEADER_INDEX))
+  {
+    start = outputBuffer.begin();
+    reasonPhrase
+        = WideStringToString(std::wstring(start, start + sizeOfReasonPhrase / sizeof(WCHAR)));
+  }
+
+  // Allocate the instance of the response on the heap with a shared ptr so this memory gets
+  // delegated outside the transport and will be eventually released.
+  auto rawResponse
+      = std::make_unique<RawResponse>(majorVersion, minorVersion, httpStatusCode, reasonPhrase);
+
+  SetHeaders(responseHeaders, rawResponse);
+
+  return rawResponse;
+}
+
+int64_t GetContentLength(
+    HINTERNET requestHandle,
+    HttpMethod requestMethod,
+    HttpStatusCode responseStatusCode)
+{
+  DWORD dwContentLength = 0;
+  DWORD dwSize = sizeof(dwContentLength);
+
+  // For Head request, set the length of body response to 0.
+  // Response will give us content-length as if we were not doing Head saying what would be the
+  // length of the body. However, server won't send any body.
+  // For NoContent status code, also need to set contentLength to 0.
+  int64_t contentLength = 0;
+
+  // Get the content length as a number.
+  if (requestMethod != HttpMethod::Head && responseStatusCode != HttpStatusCode::NoContent)
+  {
+    if (!WinHttpQueryHeaders(
+            requestHandle,
+            WINHTTP_QUERY_CONTENT_LENGTH | WINHTTP_QUERY_FLAG_NUMBER,
+            WINHTTP_HEADER_NAME_BY_INDEX,
+            &dwContentLength,
+            &dwSize,
+            WINHTTP_NO_HEADER_INDEX))
+    {
+      contentLength = -1;
+    }
+    else
+    {
+      contentLength = static_cast<int64_t>(dwContentLength);
+    }
+  }
+
+  return contentLength;
+}
+
+/**
+ * @brief The state of a request sent with #WinHttpTransport::SendAsync.
+ *
+ * @remark It is the context value of the request handle: WinHTTP passes it to each status
+ * callback, and it's deleted by the callback notifying the handle is closing. The handle is closed
+ * when the request fails, once a buffered response is downloaded, or else when the body stream of
+ * the response is destroyed.
+ */
+struct WinHttpAsyncRequest final
+{
+  enum class Phase
+  {
+    Sending,
+    Buffering,
+    Streaming,
+  };
+
+  Request& HttpRequest;
+  Context RequestContext;
+  SendCompletionCallback Callback;
+  std::shared_ptr<void> ConnectionHandle;
+  HINTERNET RequestHandle = NULL;
+  Phase CurrentPhase = Phase::Sending;
+
+  // WinHTTP doesn't copy the data of pending writes and reads, so the buffers are kept here.
+  std::wstring EncodedHeaders;
+  std::unique_ptr<uint8_t[]> UploadBuffer;
+  size_t UploadChunkSize = 0;
+  std::unique_ptr<RawResponse> Response;
+  std::vector<uint8_t> Body;
+  size_t BodySize = 0;
+  int64_t ContentLength = 0;
+
+  // The body stream waits for the completion of its reads.
+  std::mutex ReadMutex;
+  std::condition_variable ReadCompleted;
+  bool IsReadCompleted = false;
+  DWORD BytesRead = 0;
+  DWORD ReadError = ERROR_SUCCESS;
+
+  WinHttpAsyncRequest(
+      Request& request,
+      Context const& context,
+      SendCompletionCallback callback,
+      std::shared_ptr<void> connectionHandle)
+      : HttpRequest(request), RequestContext(context), Callback(std::move(callback)),
+        ConnectionHandle(std::move(connectionHandle))
+  {
+  }
+};
+
+constexpr size_t AsyncReadChunkSize = 1024 * 64;
+
+// Call back with the response or the error. Unless the response has a body stream reading from
+// the request handle, the handle is closed, which deletes the request: it can't be used anymore.
+void Complete(
+    WinHttpAsyncRequest* asyncRequest,
+    std::unique_ptr<RawResponse> response,
+    std::exception_ptr error)
+{
+  auto callback = std::move(asyncRequest->Callback);
+  if (asyncRequest->CurrentPhase != WinHttpAsyncRequest::Phase::Streaming)
+  {
+    WinHttpCloseHandle(asyncRequest->RequestHandle);
+  }
+  callback(std::move(response), error);
+}
+
+void Fail(WinHttpAsyncRequest* asyncRequest, std::string const& message, DWORD error)
+{
+  Complete(
+      asyncRequest,
+      nullptr,
+      std::make_exception_ptr(Azure::Core::Http::TransportException(
+          message + " Error Code: " + std::to_string(error) + ".")));
+}
+
+bool FailIfCancelled(WinHttpAsyncRequest* asyncRequest)
+{
+  if (!asyncRequest->RequestContext.IsCancelled())
+  {
+    return false;
+  }
+  Complete(
+      asyncRequest,
+      nullptr,
+      std::make_exception_ptr(
+          Azure::Core::OperationCancelledException("Request was cancelled by context.")));
+  return true;
+}
+
+void ReadBufferedBody(WinHttpAsyncRequest* asyncRequest)
+{
+  if (FailIfCancelled(asyncRequest))
+  {
+    return;
+  }
+
+  auto& body = asyncRequest->Body;
+  if (body.size() == asyncRequest->BodySize)
+  {
+    body.resize(asyncRequest->BodySize + AsyncReadChunkSize);
+  }
+  if (!WinHttpReadData(
+          asyncRequest->RequestHandle,
+          body.data() + asyncRequest->BodySize,
+          static_cast<DWORD>(body.size() - asyncRequest->BodySize),
+          NULL))
+  {
+    Fail(asyncRequest, "Error while reading available data from the wire.", GetLastError());
+  }
+}
+
+// Write the next chunk of the request body, or wait for the response once it's all written.
+void SendNextChunk(WinHttpAsyncRequest* asyncRequest)
+{
+  if (FailIfCancelled(asyncRequest))
+  {
+    return;
+  }
+
+  size_t chunkSize = 0;
+  if (asyncRequest->UploadBuffer)
+  {
+    try
+    {
+      chunkSize = asyncRequest->HttpRequest.GetBodyStream()->Read(
+          asyncRequest->UploadBuffer.get(),
+          asyncRequest->UploadChunkSize,
+          asyncRequest->RequestContext);
+    }
+    catch (...)
+    {
+      Complete(asyncRequest, nullptr, std::current_exception());
+      return;
+    }
+  }
+
+  if (chunkSize != 0)
+  {
+    if (!WinHttpWriteData(
+            asyncRequest->RequestHandle,
+            asyncRequest->UploadBuffer.get(),
+            static_cast<DWORD>(chunkSize),
+            NULL))
+    {
+      Fail(asyncRequest, "Error while uploading/sending data.", GetLastError());
+    }
+  }
+  else if (!WinHttpReceiveResponse(asyncRequest->RequestHandle, NULL))
+  {
+    Fail(asyncRequest, "Error while receiving a response.", GetLastError());
+  }
+}
+
+class WinHttpAsyncStream final : public Azure::Core::IO::BodyStream {
+private:
+  WinHttpAsyncRequest* m_asyncRequest;
+  int64_t m_contentLength;
+  int64_t m_streamTotalRead = 0;
+  bool m_isEOF = false;
+
+  size_t OnRead(uint8_t* buffer, size_t count, Context const& context) override
+  {
+    if (count == 0 || m_isEOF)
+    {
+      return 0;
+    }
+
+    // No need to check for context cancellation before the I/O because the base class
+    // BodyStream::Read already does that. Like WinHttpStream, a pending read isn't cancelled.
+    (void)context;
+
+    std::unique_lock<std::mutex> lock(m_asyncRequest->ReadMutex);
+    m_asyncRequest->IsReadCompleted = false;
+    lock.unlock();
+
+    if (!WinHttpReadData(
+            m_asyncRequest->RequestHandle,
+            static_cast<LPVOID>(buffer),
+            static_cast<DWORD>((std::min)(count, static_cast<size_t>(MAXDWORD))),
+            NULL))
+    {
+      GetErrorAndThrow("Error while reading available data from the wire.");
+    }
+
+    lock.lock();
+    m_asyncRequest->ReadCompleted.wait(lock, [this] { return m_asyncRequest->IsReadCompleted; });
+    if (m_asyncRequest->ReadError != ERROR_SUCCESS)
+    {
+      throw Azure::Core::Http::TransportException(
+          "Error while reading available data from the wire. Error Code: "
+          + std::to_string(m_asyncRequest->ReadError) + ".");
+    }
+
+    DWORD numberOfBytesRead = m_asyncRequest->BytesRead;
+    m_streamTotalRead += numberOfBytesRead;
+    if (numberOfBytesRead == 0 || (m_contentLength != -1 && m_streamTotalRead == m_contentLength))
+    {
+      m_isEOF = true;
+    }
+    return numberOfBytesRead;
+  }
+
+public:
+  WinHttpAsyncStream(WinHttpAsyncRequest* asyncRequest, int64_t contentLength)
+      : m_asyncRequest(asyncRequest), m_contentLength(contentLength)
+  {
+  }
+
+  ~WinHttpAsyncStream() override { WinHttpCloseHandle(m_asyncRequest->RequestHandle); }
+
+  int64_t Length() const override { return m_contentLength; }
+};
+
+void OnHeadersAvailable(WinHttpAsyncRequest* asyncRequest)
+{
+  if (FailIfCancelled(asyncRequest))
+  {
+    return;
+  }
+
+  try
+  {
+    asyncRequest->Response = CreateRawResponse(asyncRequest->RequestHandle);
+    asyncRequest->ContentLength = GetContentLength(
+        asyncRequest->RequestHandle,
+        asyncRequest->HttpRequest.GetMethod(),
+        asyncRequest->Response->GetStatusCode());
+  }
+  catch (...)
+  {
+    Complete(asyncRequest, nullptr, std::current_exception());
+    return;
+  }
+
+  // The transport policy downloads error responses to the response's buffer. For requests sent
+  // asynchronously, that is done here before calling back.
+  auto const statusCode = static_cast<std::underlying_type<HttpStatusCode>::type>(
+      asyncRequest->Response->GetStatusCode());
+  if (asyncRequest->HttpRequest.ShouldBufferResponse() || statusCode >= 300)
+  {
+    if (asyncRequest->ContentLength == 0)
+    {
+      Complete(asyncRequest, std::move(asyncRequest->Response), nullptr);
+      return;
+    }
+    asyncRequest->CurrentPhase = WinHttpAsyncRequest::Phase::Buffering;
+    if (asyncRequest->ContentLength > 0)
+    {
+      asyncRequest->Body.resize(static_cast<size_t>(asyncRequest->ContentLength));
+    }
+    ReadBufferedBody(asyncRequest);
+    return;
+  }
+
+  asyncRequest->CurrentPhase = WinHttpAsyncRequest::Phase::Streaming;
+  auto response = std::move(asyncRequest->Response);
+  response->SetBodyStream(
+      std::make_unique<WinHttpAsyncStream>(asyncRequest, asyncRequest->ContentLength));
+  Complete(asyncRequest, std::move(response), nullptr);
+}
+
+void OnReadComplete(WinHttpAsyncRequest* asyncRequest, DWORD bytesRead, DWORD error)
+{
+  if (asyncRequest->CurrentPhase == WinHttpAsyncRequest::Phase::Streaming)
+  {
+    {
+      std::lock_guard<std::mutex> lock(asyncRequest->ReadMutex);
+      asyncRequest->IsReadCompleted = true;
+      asyncRequest->BytesRead = bytesRead;
+      asyncRequest->ReadError = error;
+    }
+    asyncRequest->ReadCompleted.notify_all();
+    return;
+  }
+
+  if (error != ERROR_SUCCESS)
+  {
+    Fail(asyncRequest, "Error while reading available data from the wire.", error);
+    return;
+  }
+
+  asyncRequest->BodySize += bytesRead;
+  if (bytesRead != 0
+      && (asyncRequest->ContentLength == -1
+          || asyncRequest->BodySize < static_cast<size_t>(asyncRequest->ContentLength)))
+  {
+    ReadBufferedBody(asyncRequest);
+    return;
+  }
+
+  asyncRequest->Body.resize(asyncRequest->BodySize);
+  asyncRequest->Response->SetBody(std::move(asyncRequest->Body));
+  Complete(asyncRequest, std::move(asyncRequest->Response), nullptr);
+}
+
+// The status callback of the sessions opened with WINHTTP_FLAG_ASYNC, which drives the requests:
+// each completion starts the next step of the request.
+void CALLBACK AsyncStatusCallback(
+    HINTERNET handle,
+    DWORD_PTR context,
+    DWORD status,
+    LPVOID statusInformation,
+    DWORD statusInformationLength)
+{
+  (void)handle;
+
+  // The session and connection handles have no context value.
+  auto asyncRequest = reinterpret_cast<WinHttpAsyncRequest*>(context);
+  if (asyncRequest == nullptr)
+  {
+    return;
+  }
+
+  switch (status)
+  {
+    case WINHTTP_CALLBACK_STATUS_SENDREQUEST_COMPLETE:
+    case WINHTTP_CALLBACK_STATUS_WRITE_COMPLETE:
+      SendNextChunk(asyncRequest);
+      break;
+    case WINHTTP_CALLBACK_STATUS_HEADERS_AVAILABLE:
+      OnHeadersAvailable(asyncRequest);
+      break;
+    case WINHTTP_CALLBACK_STATUS_READ_COMPLETE:
+      OnReadComplete(asyncRequest, statusInformationLength, ERROR_SUCCESS);
+      break;
+    case WINHTTP_CALLBACK_STATUS_REQUEST_ERROR: {
+      auto result = static_cast<WINHTTP_ASYNC_RESULT*>(statusInformation);
+      if (result->dwResult == API_READ_DATA)
+      {
+        OnReadComplete(asyncRequest, 0, result->dwError);
+      }
+      else
+      {
+        Fail(asyncRequest, "Error while sending a request.", result->dwError);
+      }
+      break;
+    }
+    case WINHTTP_CALLBACK_STATUS_HANDLE_CLOSING:
+      delete asyncRequest;
+      break;
+    default:
+      break;
+  }
+}
+} // namespace
+
+std::shared_ptr<void> WinHttpTransport::CreateSessionHandle(bool isAsync)
 {
   // Use WinHttpOpen to obtain a session handle.
-  // The dwFlags is set to 0 - all WinHTTP functions are performed synchronously.
-  handleManager->m_sessionHandle = WinHttpOpen(
+  // The dwFlags is set to 0 - all WinHTTP functions are performed synchronously - unless the
+  // session is used by SendAsync().
+  HINTERNET sessionHandle = WinHttpOpen(
       NULL, // Do not use a fallback user-agent string, and only rely on the header within the
             // request itself.
       WINHTTP_ACCESS_TYPE_NO_PROXY,
       WINHTTP_NO_PROXY_NAME,
       WINHTTP_NO_PROXY_BYPASS,
-      0);
+      isAsync ? WINHTTP_FLAG_ASYNC : 0);
 
-  if (!handleManager->m_sessionHandle)
+  if (!sessionHandle)
   {
     // Errors include:
     // ERROR_WINHTTP_INTERNAL_ERROR
@@ -221,6 +758,21 @@ void WinHttpTransport::CreateSessionHandle(std::unique_ptr<_detail::HandleManage
     GetErrorAndThrow("Error while getting a session handle.");
   }
 
+  // The connection and request handles inherit the status callback of their session.
+  if (isAsync
+      && WinHttpSetStatusCallback(
+             sessionHandle,
+             AsyncStatusCallback,
+             WINHTTP_CALLBACK_FLAG_ALL_COMPLETIONS | WINHTTP_CALLBACK_FLAG_HANDLES,
+             0)
+          == WINHTTP_INVALID_STATUS_CALLBACK)
+  {
+    DWORD error = GetLastError();
+    WinHttpCloseHandle(sessionHandle);
+    throw Azure::Core::Http::TransportException(
+        "Error while setting the status callback. Error Code: " + std::to_string(error) + ".");
+  }
+
 // These options are only available starting from Windows 10 Version 2004, starting 06/09/2020.
 // These are primarily round trip time (RTT) performance optimizations, and hence if they don't get
 // set successfully, we shouldn't fail the request and continue as if the options don't exist.
@@ -228,39 +780,51 @@ void WinHttpTransport::CreateSessionHandle(std::unique_ptr<_detail::HandleManage
 #ifdef WINHTTP_OPTION_TCP_FAST_OPEN
   BOOL tcp_fast_open = TRUE;
   WinHttpSetOption(
-      handleManager->m_sessionHandle,
-      WINHTTP_OPTION_TCP_FAST_OPEN,
-      &tcp_fast_open,
-      sizeof(tcp_fast_open));
+      sessionHandle, WINHTTP_OPTION_TCP_FAST_OPEN, &tcp_fast_open, sizeof(tcp_fast_open));
 #endif
 
 #ifdef WINHTTP_OPTION_TLS_FALSE_START
   BOOL tcp_false_start = TRUE;
   WinHttpSetOption(
-      handleManager->m_sessionHandle,
-      WINHTTP_OPTION_TLS_FALSE_START,
-      &tcp_false_start,
-      sizeof(tcp_false_start));
+      sessionHandle, WINHTTP_OPTION_TLS_FALSE_START, &tcp_false_start, sizeof(tcp_false_start));
 #endif
+
+  return std::shared_ptr<void>(sessionHandle, [](void* handle) { WinHttpCloseHandle(handle); });
 }
 
-void WinHttpTransport::CreateConnectionHandle(
-    std::unique_ptr<_detail::HandleManager>& handleManager)
+std::shared_ptr<void> WinHttpTransport::GetConnectionHandle(
+    Azure::Core::Url const& url,
+    bool isAsync)
 {
   // If port is 0, i.e. INTERNET_DEFAULT_PORT, it uses port 80 for HTTP and port 443 for HTTPS.
-  uint16_t port = handleManager->m_request.GetUrl().GetPort();
+  uint16_t port = url.GetPort();
 
-  handleManager->m_context.ThrowIfCancelled();
+  auto const connectionKey = url.GetHost() + ":" + std::to_string(port);
+
+  std::lock_guard<std::mutex> lock(m_handlesMutex);
+  auto& sessionHandle = isAsync ? m_asyncSessionHandle : m_sessionHandle;
+  auto& connectionHandles = isAsync ? m_asyncConnectionHandles : m_connectionHandles;
+
+  auto const cachedConnection = connectionHandles.find(connectionKey);
+  if (cachedConnection != connectionHandles.end())
+  {
+    return cachedConnection->second;
+  }
+
+  if (!sessionHandle)
+  {
+    sessionHandle = CreateSessionHandle(isAsync);
+  }
 
   // Specify an HTTP server.
-  // This function always operates synchronously.
-  handleManager->m_connectionHandle = WinHttpConnect(
-      handleManager->m_sessionHandle,
-      StringToWideString(handleManager->m_request.GetUrl().GetHost()).c_str(),
+  // This function always operates synchronously, without any network I/O.
+  HINTERNET connectionHandle = WinHttpConnect(
+      sessionHandle.get(),
+      StringToWideString(url.GetHost()).c_str(),
       port == 0 ? INTERNET_DEFAULT_PORT : port,
       0);
 
-  if (!handleManager->m_connectionHandle)
+  if (!connectionHandle)
   {
     // Errors include:
     // ERROR_WINHTTP_INCORRECT_HANDLE_TYPE
@@ -272,36 +836,19 @@ void WinHttpTransport::CreateConnectionHandle(
     // ERROR_NOT_ENOUGH_MEMORY
     GetErrorAndThrow("Error while getting a connection handle.");
   }
+
+  // The connection handle keeps the session handle alive, so that it's closed first even when the
+  // response of a request outlives the transport.
+  std::shared_ptr<void> connection(
+      connectionHandle, [sessionHandle](void* handle) { WinHttpCloseHandle(handle); });
+  connectionHandles.emplace(connectionKey, connection);
+  return connection;
 }
 
 void WinHttpTransport::CreateRequestHandle(std::unique_ptr<_detail::HandleManager>& handleManager)
 {
-  const std::string& path = handleManager->m_request.GetUrl().GetRelativeUrl();
-  HttpMethod requestMethod = handleManager->m_request.GetMethod();
-
-  // Create an HTTP request handle.
-  handleManager->m_requestHandle = WinHttpOpenRequest(
-      handleManager->m_connectionHandle,
-      HttpMethodToWideString(requestMethod).c_str(),
-      path.empty() ? NULL
-                   : StringToWideString(path)
-                         .c_str(), // Name of the target resource of the specified HTTP verb
-      NULL, // Use HTTP/1.1
-      WINHTTP_NO_REFERER,
-      WINHTTP_DEFAULT_ACCEPT_TYPES, // No media types are accepted by the client
-      WINHTTP_FLAG_SECURE); // Uses secure transaction semantics (SSL/TLS)
-
-  if (!handleManager->m_requestHandle)
-  {
-    // Errors include:
-    // ERROR_WINHTTP_INCORRECT_HANDLE_TYPE
-    // ERROR_WINHTTP_INTERNAL_ERROR
-    // ERROR_WINHTTP_INVALID_URL
-    // ERROR_WINHTTP_OPERATION_CANCELLED
-    // ERROR_WINHTTP_UNRECOGNIZED_SCHEME
-    // ERROR_NOT_ENOUGH_MEMORY
-    GetErrorAndThrow("Error while getting a request handle.");
-  }
+  handleManager->m_requestHandle = OpenRequestHandle(
+      handleManager->m_connectionHandle.get(), handleManager->m_request);
 }
 
 // For PUT/POST requests, send additional data using WinHttpWriteData.
@@ -348,7 +895,7 @@ void WinHttpTransport::SendRequest(std::unique_ptr<_detail::HandleManager>& hand
   std::wstring encodedHeaders;
   int encodedHeadersLength = 0;
 
-  auto requestHeaders = handleManager->m_request.GetHeaders();
+  auto const& requestHeaders = handleManager->m_request.GetHeadersReference();
   if (requestHeaders.size() != 0)
   {
     // The encodedHeaders will be null-terminated and the length is calculated.
@@ -429,157 +976,14 @@ void WinHttpTransport::ReceiveResponse(std::unique_ptr<_detail::HandleManager>&
   }
 }
 
-int64_t WinHttpTransport::GetContentLength(
-    std::unique_ptr<_detail::HandleManager>& handleManager,
-    HttpMethod requestMethod,
-    HttpStatusCode responseStatusCode)
-{
-  DWORD dwContentLength = 0;
-  DWORD dwSize = sizeof(dwContentLength);
-
-  // For Head request, set the length of body response to 0.
-  // Response will give us content-length as if we were not doing Head saying what would be the
-  // length of the body. However, server won't send any body.
-  // For NoContent status code, also need to set contentLength to 0.
-  int64_t contentLength = 0;
-
-  // Get the content length as a number.
-  if (requestMethod != HttpMethod::Head && responseStatusCode != HttpStatusCode::NoContent)
-  {
-    if (!WinHttpQueryHeaders(
-            handleManager->m_requestHandle,
-            WINHTTP_QUERY_CONTENT_LENGTH | WINHTTP_QUERY_FLAG_NUMBER,
-            WINHTTP_HEADER_NAME_BY_INDEX,
-            &dwContentLength,
-            &dwSize,
-            WINHTTP_NO_HEADER_INDEX))
-    {
-      contentLength = -1;
-    }
-    else
-    {
-      contentLength = static_cast<int64_t>(dwContentLength);
-    }
-  }
-
-  return contentLength;
-}
-
 std::unique_ptr<RawResponse> WinHttpTransport::SendRequestAndGetResponse(
     std::unique_ptr<_detail::HandleManager> handleManager,
     HttpMethod requestMethod)
 {
-  // First, use WinHttpQueryHeaders to obtain the size of the buffer.
-  // The call is expected to fail since no destination buffer is provided.
-  DWORD sizeOfHeaders = 0;
-  if (WinHttpQueryHeaders(
-          handleManager->m_requestHandle,
-          WINHTTP_QUERY_RAW_HEADERS,
-          WINHTTP_HEADER_NAME_BY_INDEX,
-          NULL,
-          &sizeOfHeaders,
-          WINHTTP_NO_HEADER_INDEX))
-  {
-    // WinHttpQueryHeaders was expected to fail.
-    throw Azure::Core::Http::TransportException("Error while querying response headers.");
-  }
-
-  {
-    DWORD error = GetLastError();
-    if (error != ERROR_INSUFFICIENT_BUFFER)
-    {
-      throw Azure::Core::Http::TransportException(
-          "Error while querying response headers. Error Code: " + std::to_string(error) + ".");
-    }
-  }
-
-  // Allocate memory for the buffer.
-  std::vector<WCHAR> outputBuffer(sizeOfHeaders / sizeof(WCHAR), 0);
-
-  // Now, use WinHttpQueryHeaders to retrieve all the headers.
-  // Each header is terminated by "\0". An additional "\0" terminates the list of headers.
-  if (!WinHttpQueryHeaders(
-          handleManager->m_requestHandle,
-          WINHTTP_QUERY_RAW_HEADERS,
-          WINHTTP_HEADER_NAME_BY_INDEX,
-          outputBuffer.data(),
-          &sizeOfHeaders,
-          WINHTTP_NO_HEADER_INDEX))
-  {
-    GetErrorAndThrow("Error while querying response headers.");
-  }
+  auto rawResponse = CreateRawResponse(handleManager->m_requestHandle);
 
-  auto start = outputBuffer.begin();
-  auto last = start + sizeOfHeaders / sizeof(WCHAR);
-  auto statusLineEnd = std::find(start, last, '\0');
-  start = statusLineEnd + 1; // start of headers
-  std::string responseHeaders = WideStringToString(std::wstring(start, last));
-
-  DWORD sizeOfHttp = sizeOfHeaders;
-
-  // Get the HTTP version.
-  if (!WinHttpQueryHeaders(
-          handleManager->m_requestHandle,
-          WINHTTP_QUERY_VERSION,
-          WINHTTP_HEADER_NAME_BY_INDEX,
-          outputBuffer.data(),
-          &sizeOfHttp,
-          WINHTTP_NO_HEADER_INDEX))
-  {
-    GetErrorAndThrow("Error while querying response headers.");
-  }
-
-  start = outputBuffer.begin();
-  // Assuming ASCII here is OK since the input is expected to be an HTTP version string.
-  std::string httpVersion = WideStringToStringASCII(start, start + sizeOfHttp / sizeof(WCHAR));
-
-  uint16_t majorVersion = 0;
-  uint16_t minorVersion = 0;
-  ParseHttpVersion(httpVersion, &majorVersion, &minorVersion);
-
-  DWORD statusCode = 0;
-  DWORD dwSize = sizeof(statusCode);
-
-  // Get the status code as a number.
-  if (!WinHttpQueryHeaders(
-          handleManager->m_requestHandle,
-          WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER,
-          WINHTTP_HEADER_NAME_BY_INDEX,
-          &statusCode,
-          &dwSize,
-          WINHTTP_NO_HEADER_INDEX))
-  {
-    GetErrorAndThrow("Error while querying response headers.");
-  }
-
-  HttpStatusCode httpStatusCode = static_cast<HttpStatusCode>(statusCode);
-
-  // Get the optional reason phrase.
-  std::string reasonPhrase;
-  DWORD sizeOfReasonPhrase = sizeOfHeaders;
-
-  if (WinHttpQueryHeaders(
-          handleManager->m_requestHandle,
-          WINHTTP_QUERY_STATUS_TEXT,
-          WINHTTP_HEADER_NAME_BY_INDEX,
-          outputBuffer.data(),
-          &sizeOfReasonPhrase,
-          WINHTTP_NO_HEADER_INDEX))
-  {
-    start = outputBuffer.begin();
-    reasonPhrase
-        = WideStringToString(std::wstring(start, start + sizeOfReasonPhrase / sizeof(WCHAR)));
-  }
-
-  // Allocate the instance of the response on the heap with a shared ptr so this memory gets
-  // delegated outside the transport and will be eventually released.
-  auto rawResponse
-      = std::make_unique<RawResponse>(majorVersion, minorVersion, httpStatusCode, reasonPhrase);
-
-  SetHeaders(responseHeaders, rawResponse);
-
-  int64_t contentLength
-      = GetContentLength(handleManager, requestMethod, rawResponse->GetStatusCode());
+  int64_t contentLength = GetContentLength(
+      handleManager->m_requestHandle, requestMethod, rawResponse->GetStatusCode());
 
   rawResponse->SetBodyStream(
       std::make_unique<_detail::WinHttpStream>(std::move(handleManager), contentLength));
@@ -590,8 +994,8 @@ std::unique_ptr<RawResponse> WinHttpTransport::Send(Request& request, Context co
 {
   auto handleManager = std::make_unique<_detail::HandleManager>(request, context);
 
-  CreateSessionHandle(handleManager);
-  CreateConnectionHandle(handleManager);
+  context.ThrowIfCancelled();
+  handleManager->m_connectionHandle = GetConnectionHandle(request.GetUrl(), false);
   CreateRequestHandle(handleManager);
 
   SendRequest(handleManager);
@@ -646,3 +1050,86 @@ size_t _detail::WinHttpStream::OnRead(uint8_t* buffer, size_t count, Context con
   }
   return numberOfBytesRead;
 }
+
+void WinHttpTransport::SendAsync(
+    Request& request,
+    Context const& context,
+    SendCompletionCallback callback)
+{
+  std::unique_ptr<WinHttpAsyncRequest> asyncRequest;
+  int64_t streamLength = 0;
+  try
+  {
+    context.ThrowIfCancelled();
+
+    // Chunked transfer encoding is not supported and the content length needs to be known up
+    // front.
+    streamLength = request.GetBodyStream()->Length();
+    if (streamLength == -1)
+    {
+      throw Azure::Core::Http::TransportException(
+          "When uploading data, the body stream must have a known length.");
+    }
+
+    asyncRequest = std::make_unique<WinHttpAsyncRequest>(
+        request, context, std::move(callback), GetConnectionHandle(request.GetUrl(), true));
+
+    if (request.GetHeadersReference().size() != 0)
+    {
+      asyncRequest->EncodedHeaders = StringToWideString(GetHeadersAsString(request));
+    }
+    if (streamLength > 0)
+    {
+      asyncRequest->UploadChunkSize = _detail::DefaultUploadChunkSize;
+      if (static_cast<size_t>(streamLength) < _detail::MaximumUploadChunkSize)
+      {
+        asyncRequest->UploadChunkSize = static_cast<size_t>(streamLength);
+      }
+      asyncRequest->UploadBuffer = std::make_unique<uint8_t[]>(asyncRequest->UploadChunkSize);
+    }
+
+    asyncRequest->RequestHandle
+        = OpenRequestHandle(asyncRequest->ConnectionHandle.get(), request);
+  }
+  catch (...)
+  {
+    auto const error = std::current_exception();
+    (asyncRequest ? asyncRequest->Callback : callback)(nullptr, error);
+    return;
+  }
+
+  // From now on, the request is deleted when its handle is closed.
+  auto pendingRequest = asyncRequest.get();
+  DWORD_PTR contextValue = reinterpret_cast<DWORD_PTR>(pendingRequest);
+  if (!WinHttpSetOption(
+          pendingRequest->RequestHandle,
+          WINHTTP_OPTION_CONTEXT_VALUE,
+          &contextValue,
+          sizeof(contextValue)))
+  {
+    DWORD error = GetLastError();
+    WinHttpCloseHandle(pendingRequest->RequestHandle);
+    asyncRequest->Callback(
+        nullptr,
+        std::make_exception_ptr(Azure::Core::Http::TransportException(
+            "Error while setting the request context. Error Code: " + std::to_string(error)
+            + ".")));
+    return;
+  }
+  asyncRequest.release();
+
+  // The completion is notified to the status callback, which writes the body and receives the
+  // response. The encoded headers are null-terminated and their length is calculated.
+  if (!WinHttpSendRequest(
+          pendingRequest->RequestHandle,
+          pendingRequest->EncodedHeaders.empty() ? WINHTTP_NO_ADDITIONAL_HEADERS
+                                                 : pendingRequest->EncodedHeaders.c_str(),
+          pendingRequest->EncodedHeaders.empty() ? 0 : static_cast<DWORD>(-1),
+          WINHTTP_NO_REQUEST_DATA,
+          0,
+          streamLength > 0 ? static_cast<DWORD>(streamLength) : 0,
+          contextValue))
+  {
+    Fail(pendingRequest, "Error while sending a request.", GetLastError());
+  }
+}
@@ -58,21 +58,83 @@ size_t BodyStream::ReadToCount(uint8_t* buffer, size_t count, Context const& con
   }
 }
 
+size_t BodyStream::ReadInto(
+    BufferSegment const* segments,
+    size_t segmentCount,
+    Context const& context)
+{
+  AZURE_ASSERT(segments || segmentCount == 0);
+
+  size_t totalRead = 0;
+  for (size_t i = 0; i < segmentCount; ++i)
+  {
+    size_t readBytes = this->ReadToCount(segments[i].Data, segments[i].Length, context);
+    totalRead += readBytes;
+    // A buffer which isn't filled means the end of the stream
+    if (readBytes < segments[i].Length)
+    {
+      break;
+    }
+  }
+  return totalRead;
+}
+
+size_t BodyStream::OnReadSpan(
+    uint8_t const*& data,
+    size_t count,
+    std::vector<uint8_t>& scratch,
+    Context const& context)
+{
+  if (scratch.size() < count)
+  {
+    scratch.resize(count);
+  }
+  data = scratch.data();
+  return this->OnRead(scratch.data(), count, context);
+}
+
 std::vector<uint8_t> BodyStream::ReadToEnd(Context const& context)
 {
-  constexpr size_t chunkSize = 1024 * 8;
   auto buffer = std::vector<uint8_t>();
+  this->ReadToEnd(buffer, context);
+  return buffer;
+}
 
-  for (auto chunkNumber = 0;; chunkNumber++)
+void BodyStream::ReadToEnd(std::vector<uint8_t>& buffer, Context const& context)
+{
+  constexpr size_t chunkSize = 1024 * 8;
+  size_t totalRead = 0;
+
+  auto const length = this->Length();
+  if (length > 0)
   {
-    buffer.resize((static_cast<decltype(buffer)::size_type>(chunkNumber) + 1) * chunkSize);
-    size_t readBytes
-        = this->ReadToCount(buffer.data() + (chunkNumber * chunkSize), chunkSize, context);
+    // With a known length, the buffer is sized to the length and the end of the stream is found by
+    // reading one byte past it, so that a buffer reserved for the length is never reallocated.
+    buffer.resize(static_cast<size_t>(length));
+    totalRead = this->ReadToCount(buffer.data(), buffer.size(), context);
+    if (totalRead < buffer.size())
+    {
+      buffer.resize(totalRead);
+      return;
+    }
+    uint8_t nextByte = 0;
+    if (this->Read(&nextByte, 1, context) == 0)
+    {
+      return;
+    }
+    buffer.push_back(nextByte);
+    ++totalRead;
+  }
 
-    if (readBytes < chunkSize)
+  for (size_t size = std::max(totalRead * 2, chunkSize);; size *= 2)
+  {
+    buffer.resize(size);
+    totalRead += this->ReadToCount(buffer.data() + totalRead, size - totalRead, context);
+
+    if (totalRead < size)
     {
-      buffer.resize(static_cast<size_t>((chunkNumber * chunkSize) + readBytes));
-      return buffer;
+      buffer.resize(totalRead);
+      return;
     }
   }
 }
@@ -89,6 +151,22 @@ size_t MemoryBodyStream::OnRead(uint8_t* buffer, size_t count, Context const& co
   return copy_length;
 }
 
+size_t MemoryBodyStream::OnReadSpan(
+    uint8_t const*& data,
+    size_t count,
+    std::vector<uint8_t>& scratch,
+    Context const& context)
+{
+  (void)scratch;
+  (void)context;
+  size_t const length = std::min(count, this->m_length - this->m_offset);
+  // Lend the buffer instead of copying from it
+  data = this->m_data + this->m_offset;
+  m_offset += length;
+
+  return length;
+}
+
 FileBodyStream::FileBodyStream(const std::string& filename)
 {
   AZURE_ASSERT_MSG(filename.size() > 0, "The file name must not be an empty string.");
@@ -153,6 +231,10 @@ FileBodyStream::FileBodyStream(const std::string& filename)
     {
       throw std::runtime_error("Failed to get size of file. File name: '" + filename + "'");
     }
+#if defined(POSIX_FADV_SEQUENTIAL)
+    // Like FILE_FLAG_SEQUENTIAL_SCAN on Windows, the file is read from beginning to end.
+    (void)posix_fadvise(m_fileDescriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
     m_randomAccessFileBodyStream = std::make_unique<_internal::RandomAccessFileBodyStream>(
         _internal::RandomAccessFileBodyStream(m_fileDescriptor, 0, fileSize));
   }
@@ -5,6 +5,7 @@
 
 #if defined(AZ_PLATFORM_POSIX)
 #include <errno.h>
+#include <fcntl.h>
 #include <unistd.h>
 #elif defined(AZ_PLATFORM_WINDOWS)
 #if !defined(WIN32_LEAN_AND_MEAN)
@@ -19,6 +20,7 @@
 #include "azure/core/context.hpp"
 #include "azure/core/io/body_stream.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <stdexcept>
 #include <string>
@@ -26,11 +28,46 @@
 using Azure::Core::Context;
 using namespace Azure::Core::IO::_internal;
 
+namespace {
+// How far past the read position the OS is asked to read the file ahead.
+constexpr int64_t ReadAheadSize = 4 * 1024 * 1024;
+} // namespace
+
+// Asks the OS to read the next part of the range in the background, so reading the file overlaps
+// sending what was read. The OS is asked again once half of that part has been read.
+void RandomAccessFileBodyStream::ReadAhead()
+{
+#if defined(AZ_PLATFORM_POSIX) && (defined(POSIX_FADV_WILLNEED) || defined(F_RDADVISE))
+  if (this->m_readAheadEnd >= this->m_length
+      || this->m_offset + ReadAheadSize / 2 < this->m_readAheadEnd)
+  {
+    return;
+  }
+  auto const start = std::max(this->m_offset, this->m_readAheadEnd);
+  auto const end = std::min(this->m_offset + ReadAheadSize, this->m_length);
+  // The hint is only an optimization, its errors are ignored.
+#if defined(POSIX_FADV_WILLNEED)
+  (void)posix_fadvise(
+      this->m_fileDescriptor,
+      static_cast<off_t>(this->m_baseOffset + start),
+      static_cast<off_t>(end - start),
+      POSIX_FADV_WILLNEED);
+#else
+  radvisory advisory{};
+  advisory.ra_offset = static_cast<off_t>(this->m_baseOffset + start);
+  advisory.ra_count = static_cast<int>(end - start);
+  (void)fcntl(this->m_fileDescriptor, F_RDADVISE, &advisory);
+#endif
+  this->m_readAheadEnd = end;
+#endif
+}
+
 size_t RandomAccessFileBodyStream::OnRead(
     uint8_t* buffer,
     size_t count,
     Azure::Core::Context const&)
 {
+  ReadAhead();
 
 #if defined(AZ_PLATFORM_POSIX)
 
@@ -0,0 +1,499 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/internal/json/json_reader.hpp"
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+using Azure::Core::Json::_internal::JsonReader;
+using Azure::Core::Json::_internal::JsonTokenType;
+
+namespace {
+bool IsDigit(uint8_t c) { return c >= '0' && c <= '9'; }
+
+constexpr uint64_t EveryByte(uint8_t value) { return 0x0101010101010101ULL * value; }
+
+// Whether one of the 8 bytes of a word ends the plain text of a string: a quote, a backslash or a
+// control character. Strings are scanned a word at a time until there is one.
+bool HasStringSpecialByte(uint64_t word)
+{
+  auto const hasZeroByte
+      = [](uint64_t value) { return (value - EveryByte(1)) & ~value & EveryByte(0x80); };
+  return (hasZeroByte(word ^ EveryByte('"')) | hasZeroByte(word ^ EveryByte('\\'))
+          | ((word - EveryByte(0x20)) & ~word & EveryByte(0x80)))
+      != 0;
+}
+
+int ParseHexDigit(uint8_t c)
+{
+  if (IsDigit(c))
+  {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f')
+  {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F')
+  {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+void AppendUtf8(std::string& text, uint32_t codePoint)
+{
+  if (codePoint < 0x80)
+  {
+    text += static_cast<char>(codePoint);
+  }
+  else if (codePoint < 0x800)
+  {
+    text += static_cast<char>(0xc0 | (codePoint >> 6));
+    text += static_cast<char>(0x80 | (codePoint & 0x3f));
+  }
+  else if (codePoint < 0x10000)
+  {
+    text += static_cast<char>(0xe0 | (codePoint >> 12));
+    text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+    text += static_cast<char>(0x80 | (codePoint & 0x3f));
+  }
+  else
+  {
+    text += static_cast<char>(0xf0 | (codePoint >> 18));
+    text += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+    text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+    text += static_cast<char>(0x80 | (codePoint & 0x3f));
+  }
+}
+} // namespace
+
+void JsonReader::ThrowInvalidJson() const
+{
+  throw std::runtime_error("Invalid JSON at offset " + std::to_string(m_position) + ".");
+}
+
+void JsonReader::SkipWhitespace()
+{
+  while (m_position < m_size
+         && (m_data[m_position] == ' ' || m_data[m_position] == '\t'
+             || m_data[m_position] == '\n' || m_data[m_position] == '\r'))
+  {
+    ++m_position;
+  }
+}
+
+bool JsonReader::Read()
+{
+  SkipWhitespace();
+  if (m_tokenType != JsonTokenType::None && m_containers.empty())
+  {
+    // The value of the document is read, only whitespace may follow it.
+    if (m_position != m_size)
+    {
+      ThrowInvalidJson();
+    }
+    return false;
+  }
+  if (m_position == m_size)
+  {
+    ThrowInvalidJson();
+  }
+
+  auto const c = m_data[m_position];
+  if (m_tokenType == JsonTokenType::None)
+  {
+    ReadValue();
+  }
+  else if (m_tokenType == JsonTokenType::PropertyName)
+  {
+    if (c != ':')
+    {
+      ThrowInvalidJson();
+    }
+    ++m_position;
+    SkipWhitespace();
+    ReadValue();
+  }
+  else if (m_tokenType == JsonTokenType::StartObject)
+  {
+    if (c == '}')
+    {
+      ReadEndOfContainer(JsonTokenType::EndObject);
+    }
+    else
+    {
+      ReadPropertyName();
+    }
+  }
+  else if (m_tokenType == JsonTokenType::StartArray)
+  {
+    if (c == ']')
+    {
+      ReadEndOfContainer(JsonTokenType::EndArray);
+    }
+    else
+    {
+      ReadValue();
+    }
+  }
+  else
+  {
+    // After a value in an object or an array.
+    bool const isObject = m_containers.back() == JsonTokenType::StartObject;
+    if (c == (isObject ? '}' : ']'))
+    {
+      ReadEndOfContainer(isObject ? JsonTokenType::EndObject : JsonTokenType::EndArray);
+    }
+    else if (c == ',')
+    {
+      ++m_position;
+      SkipWhitespace();
+      if (isObject)
+      {
+        ReadPropertyName();
+      }
+      else
+      {
+        ReadValue();
+      }
+    }
+    else
+    {
+      ThrowInvalidJson();
+    }
+  }
+  return true;
+}
+
+void JsonReader::ReadValue()
+{
+  if (m_position == m_size)
+  {
+    ThrowInvalidJson();
+  }
+
+  m_tokenHasEscapes = false;
+  m_tokenStart = m_position;
+  m_tokenLength = 1;
+  switch (m_data[m_position])
+  {
+    case '{':
+      ++m_position;
+      m_tokenType = JsonTokenType::StartObject;
+      m_containers.push_back(JsonTokenType::StartObject);
+      break;
+    case '[':
+      ++m_position;
+      m_tokenType = JsonTokenType::StartArray;
+      m_containers.push_back(JsonTokenType::StartArray);
+      break;
+    case '"':
+      ReadStringToken(JsonTokenType::String);
+      break;
+    case 't':
+      ReadLiteral("true", JsonTokenType::True);
+      break;
+    case 'f':
+      ReadLiteral("false", JsonTokenType::False);
+      break;
+    case 'n':
+      ReadLiteral("null", JsonTokenType::Null);
+      break;
+    default:
+      ReadNumber();
+      break;
+  }
+}
+
+void JsonReader::ReadPropertyName()
+{
+  if (m_position == m_size || m_data[m_position] != '"')
+  {
+    ThrowInvalidJson();
+  }
+  ReadStringToken(JsonTokenType::PropertyName);
+}
+
+void JsonReader::ReadStringToken(JsonTokenType tokenType)
+{
+  auto const start = ++m_position;
+  bool hasEscapes = false;
+  while (true)
+  {
+    while (m_size - m_position >= sizeof(uint64_t))
+    {
+      uint64_t word;
+      std::memcpy(&word, m_data + m_position, sizeof(word));
+      if (HasStringSpecialByte(word))
+      {
+        break;
+      }
+      m_position += sizeof(word);
+    }
+
+    if (m_position == m_size || m_data[m_position] < 0x20)
+    {
+      ThrowInvalidJson();
+    }
+    auto const c = m_data[m_position];
+    if (c == '"')
+    {
+      break;
+    }
+    if (c == '\\')
+    {
+      hasEscapes = true;
+      // The escape sequences are validated when the string is unescaped.
+      ++m_position;
+      if (m_position == m_size)
+      {
+        ThrowInvalidJson();
+      }
+    }
+    ++m_position;
+  }
+
+  m_tokenType = tokenType;
+  m_tokenStart = start;
+  m_tokenLength = m_position - start;
+  m_tokenHasEscapes = hasEscapes;
+  ++m_position;
+}
+
+void JsonReader::ReadLiteral(char const* literal, JsonTokenType tokenType)
+{
+  auto const length = std::strlen(literal);
+  if (m_size - m_position < length || std::memcmp(m_data + m_position, literal, length) != 0)
+  {
+    ThrowInvalidJson();
+  }
+  m_tokenType = tokenType;
+  m_tokenStart = m_position;
+  m_tokenLength = length;
+  m_position += length;
+}
+
+void JsonReader::ReadNumber()
+{
+  auto const start = m_position;
+  if (m_data[m_position] == '-')
+  {
+    ++m_position;
+  }
+  if (m_position == m_size || !IsDigit(m_data[m_position]))
+  {
+    ThrowInvalidJson();
+  }
+  while (m_position < m_size
+         && (IsDigit(m_data[m_position]) || m_data[m_position] == '.'
+             || m_data[m_position] == 'e' || m_data[m_position] == 'E'
+             || m_data[m_position] == '+' || m_data[m_position] == '-'))
+  {
+    ++m_position;
+  }
+  m_tokenType = JsonTokenType::Number;
+  m_tokenStart = start;
+  m_tokenLength = m_position - start;
+}
+
+void JsonReader::ReadEndOfContainer(JsonTokenType tokenType)
+{
+  m_containers.pop_back();
+  m_tokenType = tokenType;
+  m_tokenStart = m_position;
+  m_tokenLength = 1;
+  m_tokenHasEscapes = false;
+  ++m_position;
+}
+
+void JsonReader::Skip()
+{
+  if (m_tokenType == JsonTokenType::PropertyName)
+  {
+    Read();
+  }
+  if (m_tokenType == JsonTokenType::StartObject || m_tokenType == JsonTokenType::StartArray)
+  {
+    auto const depth = m_containers.size();
+    while (m_containers.size() >= depth)
+    {
+      Read();
+    }
+  }
+}
+
+std::string JsonReader::GetString() const
+{
+  if (m_tokenType != JsonTokenType::PropertyName && m_tokenType != JsonTokenType::String)
+  {
+    throw std::runtime_error("The JSON token isn't a string.");
+  }
+
+  auto const text = reinterpret_cast<char const*>(m_data + m_tokenStart);
+  if (!m_tokenHasEscapes)
+  {
+    return std::string(text, m_tokenLength);
+  }
+
+  std::string result;
+  result.reserve(m_tokenLength);
+  auto const throwInvalidEscape
+      = []() { throw std::runtime_error("Invalid escape sequence in JSON string."); };
+  auto const readHex4 = [&](size_t position) {
+    if (m_tokenLength - position < 4)
+    {
+      throwInvalidEscape();
+    }
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+      auto const digit = ParseHexDigit(static_cast<uint8_t>(text[position + i]));
+      if (digit < 0)
+      {
+        throwInvalidEscape();
+      }
+      value = (value << 4) | static_cast<uint32_t>(digit);
+    }
+    return value;
+  };
+
+  for (size_t i = 0; i < m_tokenLength; ++i)
+  {
+    if (text[i] != '\\')
+    {
+      result += text[i];
+      continue;
+    }
+    switch (text[++i])
+    {
+      case '"':
+      case '\\':
+      case '/':
+        result += text[i];
+        break;
+      case 'b':
+        result += '\b';
+        break;
+      case 'f':
+        result += '\f';
+        break;
+      case 'n':
+        result += '\n';
+        break;
+      case 'r':
+        result += '\r';
+        break;
+      case 't':
+        result += '\t';
+        break;
+      case 'u': {
+        uint32_t codePoint = readHex4(i + 1);
+        i += 4;
+        if (codePoint >= 0xd800 && codePoint < 0xdc00)
+        {
+          // A high surrogate, followed by the low surrogate of the pair.
+          if (m_tokenLength - i < 7 || text[i + 1] != '\\' || text[i + 2] != 'u')
+          {
+            throwInvalidEscape();
+          }
+          auto const lowSurrogate = readHex4(i + 3);
+          if (lowSurrogate < 0xdc00 || lowSurrogate >= 0xe000)
+          {
+            throwInvalidEscape();
+          }
+          codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (lowSurrogate - 0xdc00);
+          i += 6;
+        }
+        else if (codePoint >= 0xdc00 && codePoint < 0xe000)
+        {
+          throwInvalidEscape();
+        }
+        AppendUtf8(result, codePoint);
+        break;
+      }
+      default:
+        throwInvalidEscape();
+    }
+  }
+  return result;
+}
+
+bool JsonReader::ReadNextProperty()
+{
+  if (m_containers.empty() || m_containers.back() != JsonTokenType::StartObject
+      || m_tokenType == JsonTokenType::PropertyName)
+  {
+    throw std::runtime_error("Expected a JSON object.");
+  }
+  Read();
+  return m_tokenType == JsonTokenType::PropertyName;
+}
+
+bool JsonReader::ValueEquals(char const* text, size_t length) const
+{
+  if (m_tokenType != JsonTokenType::PropertyName && m_tokenType != JsonTokenType::String)
+  {
+    return false;
+  }
+  if (m_tokenHasEscapes)
+  {
+    return GetString() == std::string(text, length);
+  }
+  return m_tokenLength == length && std::memcmp(m_data + m_tokenStart, text, length) == 0;
+}
+
+bool JsonReader::ValueEquals(char const* text) const
+{
+  return ValueEquals(text, std::strlen(text));
+}
+
+bool JsonReader::ValueEquals(std::string const& text) const
+{
+  return ValueEquals(text.data(), text.size());
+}
+
+int64_t JsonReader::GetInt64() const
+{
+  if (m_tokenType != JsonTokenType::Number)
+  {
+    throw std::runtime_error("The JSON token isn't a number.");
+  }
+
+  size_t i = 0;
+  bool const isNegative = m_data[m_tokenStart] == '-';
+  if (isNegative)
+  {
+    ++i;
+  }
+  uint64_t value = 0;
+  uint64_t const maxValue = isNegative
+      ? static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1
+      : static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+  for (; i < m_tokenLength; ++i)
+  {
+    auto const c = m_data[m_tokenStart + i];
+    if (!IsDigit(c))
+    {
+      throw std::runtime_error("The JSON number isn't an integer.");
+    }
+    auto const digit = static_cast<uint64_t>(c - '0');
+    if (value > (maxValue - digit) / 10)
+    {
+      throw std::runtime_error("The JSON number is out of the range of a 64-bit integer.");
+    }
+    value = value * 10 + digit;
+  }
+  return isNegative ? static_cast<int64_t>(0 - value) : static_cast<int64_t>(value);
+}
+
+bool JsonReader::GetBool() const
+{
+  if (m_tokenType != JsonTokenType::True && m_tokenType != JsonTokenType::False)
+  {
+    throw std::runtime_error("The JSON token isn't a boolean.");
+  }
+  return m_tokenType == JsonTokenType::True;
+}
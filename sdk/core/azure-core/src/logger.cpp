@@ -4,8 +4,13 @@
 #include "azure/core/diagnostics/logger.hpp"
 #include "azure/core/internal/diagnostics/log.hpp"
 
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
 #include <mutex>
-#include <shared_mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
 
 #include "private/environment_log_level_listener.hpp"
 
@@ -13,21 +18,236 @@ using namespace Azure::Core::Diagnostics;
 using namespace Azure::Core::Diagnostics::_internal;
 
 namespace {
-static std::shared_timed_mutex g_logListenerMutex;
-static std::function<void(Logger::Level level, std::string const& message)> g_logListener(
-    _detail::EnvironmentLogLevelListener::GetLogListener());
+using LogListener = std::function<void(Logger::Level level, std::string const& message)>;
+
+// The listener is read without a lock: writers count themselves in a reader counter while they
+// call it, and SetListener() deletes a replaced listener once it has seen the counters of both
+// epochs drop to zero. Readers enter the counters of the current epoch, which SetListener() flips
+// so that the counters it waits for only drain.
+constexpr size_t ReaderCounterCount = 8;
+
+struct alignas(64) ReaderCounter final
+{
+  std::atomic<size_t> Count{0};
+};
+
+std::atomic<LogListener*> g_logListener(nullptr);
+std::atomic<size_t> g_logListenerEpoch(0);
+ReaderCounter g_logListenerReaders[2][ReaderCounterCount];
+std::mutex g_setLogListenerMutex;
+
+// Destroys the listener at exit, so that an asynchronous listener reports its queued messages.
+struct LogListenerDeleter final
+{
+  ~LogListenerDeleter() { delete g_logListener.exchange(nullptr); }
+} g_logListenerDeleter;
+
+size_t GetReaderCounterIndex()
+{
+  static std::atomic<size_t> nextIndex(0);
+  thread_local size_t const index = nextIndex.fetch_add(1) % ReaderCounterCount;
+  return index;
+}
+
+void WaitForReaders(size_t epoch)
+{
+  for (auto& counter : g_logListenerReaders[epoch])
+  {
+    while (counter.Count.load() != 0)
+    {
+      std::this_thread::yield();
+    }
+  }
+}
+
+// Reports the messages queued in a bounded multiple-producer, single-consumer ring buffer from a
+// background thread. Producers don't take a lock unless the background thread is waiting for
+// messages.
+class AsyncLogListener final {
+  struct Slot final
+  {
+    // Equal to the position of the slot when it can be written, and to the position plus one
+    // when it holds a message to report.
+    std::atomic<size_t> Sequence;
+    Logger::Level Level;
+    // Keeps the capacity of the strings which are swapped with the one of the message reported.
+    std::string Message;
+  };
+
+  LogListener m_listener;
+  size_t const m_capacity;
+  std::unique_ptr<Slot[]> m_slots;
+  std::atomic<size_t> m_enqueuePosition{0};
+  size_t m_dequeuePosition = 0;
+  std::atomic<size_t> m_droppedCount{0};
+  std::atomic<bool> m_waiting{false};
+  std::atomic<bool> m_stopping{false};
+  std::mutex m_mutex;
+  std::condition_variable m_wakeUp;
+  std::thread m_thread;
+
+  bool IsEmpty() const
+  {
+    return m_slots[m_dequeuePosition % m_capacity].Sequence.load(std::memory_order_acquire)
+        != m_dequeuePosition + 1;
+  }
+
+  void WakeUp()
+  {
+    // Pairs with the fence of Run(), so that either the background thread sees the message or it
+    // is seen waiting.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_waiting.load(std::memory_order_relaxed))
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_waiting.store(false, std::memory_order_relaxed);
+      }
+      m_wakeUp.notify_one();
+    }
+  }
+
+  void Run()
+  {
+    std::string message;
+    while (true)
+    {
+      while (!IsEmpty())
+      {
+        auto& slot = m_slots[m_dequeuePosition % m_capacity];
+        auto const level = slot.Level;
+        message.swap(slot.Message);
+        slot.Sequence.store(m_dequeuePosition + m_capacity, std::memory_order_release);
+        ++m_dequeuePosition;
+        Report(level, message);
+      }
+
+      auto const droppedCount = m_droppedCount.exchange(0, std::memory_order_relaxed);
+      if (droppedCount != 0)
+      {
+        Report(
+            Logger::Level::Warning,
+            std::to_string(droppedCount)
+                + " log messages were dropped because the asynchronous listener queue was full.");
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_waiting.store(true, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (!IsEmpty() || m_droppedCount.load(std::memory_order_relaxed) != 0)
+      {
+        m_waiting.store(false, std::memory_order_relaxed);
+        continue;
+      }
+      if (m_stopping.load(std::memory_order_relaxed))
+      {
+        return;
+      }
+      m_wakeUp.wait(lock, [this]() { return !m_waiting.load(std::memory_order_relaxed); });
+    }
+  }
+
+  void Report(Logger::Level level, std::string const& message) noexcept
+  {
+    try
+    {
+      m_listener(level, message);
+    }
+    catch (...)
+    {
+      // The exceptions of the listener have no caller to go to from the background thread.
+    }
+  }
+
+public:
+  AsyncLogListener(LogListener listener, size_t capacity)
+      : m_listener(std::move(listener)), m_capacity(capacity), m_slots(new Slot[capacity])
+  {
+    for (size_t i = 0; i < m_capacity; ++i)
+    {
+      m_slots[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+    m_thread = std::thread([this]() { Run(); });
+  }
+
+  ~AsyncLogListener()
+  {
+    m_stopping.store(true, std::memory_order_relaxed);
+    WakeUp();
+    m_thread.join();
+  }
+
+  void Queue(Logger::Level level, std::string const& message)
+  {
+    auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true)
+    {
+      slot = &m_slots[position % m_capacity];
+      auto const sequence = slot->Sequence.load(std::memory_order_acquire);
+      auto const difference
+          = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+      if (difference == 0)
+      {
+        if (m_enqueuePosition.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      else if (difference < 0)
+      {
+        // The slot still holds the message queued a lap before: the queue is full.
+        m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+        WakeUp();
+        return;
+      }
+      else
+      {
+        position = m_enqueuePosition.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->Level = level;
+    slot->Message.assign(message);
+    slot->Sequence.store(position + 1, std::memory_order_release);
+    WakeUp();
+  }
+};
 } // namespace
 
-std::atomic<bool> Log::g_isLoggingEnabled(
-    _detail::EnvironmentLogLevelListener::GetLogListener() != nullptr);
+// Constant-initialized: nothing is done for logging until it's first used.
+std::atomic<bool> Log::g_isInitialized(false);
+std::atomic<bool> Log::g_isLoggingEnabled(false);
+std::atomic<Log::LogLevelInt> Log::g_logLevel(static_cast<LogLevelInt>(Logger::Level::Warning));
 
-std::atomic<Log::LogLevelInt> Log::g_logLevel(static_cast<LogLevelInt>(
-    _detail::EnvironmentLogLevelListener::GetLogLevel(Logger::Level::Warning)));
+bool Log::Initialize()
+{
+  static bool const isInitialized = []() {
+    auto listener = _detail::EnvironmentLogLevelListener::GetLogListener();
+    g_isLoggingEnabled = listener != nullptr;
+    if (listener)
+    {
+      g_logListener.store(new LogListener(std::move(listener)));
+    }
+    g_logLevel = static_cast<LogLevelInt>(
+        _detail::EnvironmentLogLevelListener::GetLogLevel(Logger::Level::Warning));
+    g_isInitialized.store(true, std::memory_order_release);
+    return true;
+  }();
+  return isInitialized;
+}
 
-inline void Log::EnableLogging(bool isEnabled) { g_isLoggingEnabled = isEnabled; }
+inline void Log::EnableLogging(bool isEnabled)
+{
+  Initialize();
+  g_isLoggingEnabled = isEnabled;
+}
 
 inline void Log::SetLogLevel(Logger::Level logLevel)
 {
+  Initialize();
   g_logLevel = static_cast<LogLevelInt>(logLevel);
 }
 
@@ -35,20 +255,58 @@ void Log::Write(Logger::Level level, std::string const& message)
 {
   if (ShouldWrite(level))
   {
-    std::shared_lock<std::shared_timed_mutex> loggerLock(g_logListenerMutex);
-    if (g_logListener)
+    // Sequentially consistent, so that SetListener() either sees the reader counted or the reader
+    // sees the new listener.
+    auto& readers
+        = g_logListenerReaders[g_logListenerEpoch.load() % 2][GetReaderCounterIndex()].Count;
+    readers.fetch_add(1);
+    if (auto const listener = g_logListener.load())
     {
-      g_logListener(level, message);
+      (*listener)(level, message);
     }
+    readers.fetch_sub(1, std::memory_order_release);
   }
 }
 
 void Logger::SetListener(
     std::function<void(Logger::Level level, std::string const& message)> listener)
 {
-  std::unique_lock<std::shared_timed_mutex> loggerLock(g_logListenerMutex);
-  g_logListener = std::move(listener);
-  Log::EnableLogging(g_logListener != nullptr);
+  std::unique_ptr<LogListener> newListener(
+      listener ? new LogListener(std::move(listener)) : nullptr);
+  auto const isEnabled = newListener != nullptr;
+
+  std::lock_guard<std::mutex> lock(g_setLogListenerMutex);
+  // Before the listener is exchanged, so that the listener from the environment doesn't replace
+  // it when logging is initialized.
+  Log::EnableLogging(isEnabled);
+  std::unique_ptr<LogListener> oldListener(g_logListener.exchange(newListener.release()));
+
+  // Once the readers of both epochs have been seen leaving, none is still calling the old
+  // listener.
+  auto const epoch = g_logListenerEpoch.load();
+  g_logListenerEpoch.store(epoch + 1);
+  WaitForReaders(epoch % 2);
+  g_logListenerEpoch.store(epoch + 2);
+  WaitForReaders((epoch + 1) % 2);
 }
 
 void Logger::SetLevel(Logger::Level level) { Log::SetLogLevel(level); }
+
+std::function<void(Logger::Level level, std::string const& message)> Logger::CreateAsyncListener(
+    std::function<void(Logger::Level level, std::string const& message)> listener,
+    size_t capacity)
+{
+  if (!listener)
+  {
+    throw std::invalid_argument("The listener of an asynchronous listener cannot be null.");
+  }
+  if (capacity == 0)
+  {
+    throw std::invalid_argument("The capacity of an asynchronous listener cannot be 0.");
+  }
+
+  auto asyncListener = std::make_shared<AsyncLogListener>(std::move(listener), capacity);
+  return [asyncListener](Logger::Level level, std::string const& message) {
+    asyncListener->Queue(level, message);
+  };
+}
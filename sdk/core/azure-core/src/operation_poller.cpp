@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/operation_poller.hpp"
+
+#include "private/retry_after.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Azure { namespace Core {
+
+  OperationPoller::OperationPoller(OperationPollerOptions const& options) : m_options(options)
+  {
+    if (m_options.InitialInterval.count() <= 0 || m_options.MaxInterval < m_options.InitialInterval)
+    {
+      throw std::invalid_argument(
+          "InitialInterval must be positive and MaxInterval must not be shorter.");
+    }
+    if (m_options.MaxConcurrentPolls <= 0)
+    {
+      throw std::invalid_argument("MaxConcurrentPolls must be positive.");
+    }
+    for (int32_t i = 0; i < m_options.MaxConcurrentPolls; ++i)
+    {
+      m_pollThreads.emplace_back([this]() { RunPolls(); });
+    }
+  }
+
+  OperationPoller::~OperationPoller() { Stop(); }
+
+  void OperationPoller::AddPolledOperation(std::unique_ptr<_detail::PolledOperation> operation)
+  {
+    if (operation->IsDone())
+    {
+      operation->Complete();
+      return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stopping)
+    {
+      throw std::runtime_error("The operation poller is stopped.");
+    }
+    operation->Interval = m_options.InitialInterval;
+    m_operations.emplace(
+        std::chrono::steady_clock::now() + operation->Interval, std::move(operation));
+    m_stateChanged.notify_all();
+  }
+
+  void OperationPoller::Stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+      m_stateChanged.notify_all();
+    }
+    for (auto& thread : m_pollThreads)
+    {
+      if (thread.joinable())
+      {
+        thread.join();
+      }
+    }
+    // The poll threads are gone, the operations left are only touched here.
+    for (auto& operation : m_operations)
+    {
+      operation.second->Fail(std::make_exception_ptr(
+          OperationCancelledException("The operation poller was stopped.")));
+    }
+    m_operations.clear();
+  }
+
+  void OperationPoller::RunPolls()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping)
+    {
+      if (m_operations.empty())
+      {
+        m_stateChanged.wait(lock);
+        continue;
+      }
+      auto next = m_operations.begin();
+      if (std::chrono::steady_clock::now() < next->first)
+      {
+        m_stateChanged.wait_until(lock, next->first);
+        continue;
+      }
+      auto operation = std::move(next->second);
+      m_operations.erase(next);
+      lock.unlock();
+
+      bool isDone = false;
+      std::chrono::milliseconds retryAfter{0};
+      bool hasRetryAfter = false;
+      try
+      {
+        auto const& response = operation->Poll();
+        isDone = operation->IsDone();
+        hasRetryAfter
+            = Http::Policies::_detail::GetResponseHeaderBasedDelay(response, retryAfter);
+      }
+      catch (...)
+      {
+        operation->Fail(std::current_exception());
+        lock.lock();
+        continue;
+      }
+      if (isDone)
+      {
+        operation->Complete();
+        lock.lock();
+        continue;
+      }
+
+      operation->Interval = hasRetryAfter
+          ? retryAfter
+          : std::min(operation->Interval * 2, m_options.MaxInterval);
+      lock.lock();
+      m_operations.emplace(
+          std::chrono::steady_clock::now() + operation->Interval, std::move(operation));
+    }
+  }
+
+}} // namespace Azure::Core
@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "azure/core/context.hpp"
+
+#include <vector>
+
+namespace Azure { namespace Core { namespace _detail {
+
+  /**
+   * @brief A thread waiting for a context to be cancelled, in the list of one of the contexts of
+   * its branch.
+   */
+  struct CancellationWaiter final
+  {
+    CancellationWaiter* Previous = nullptr;
+    CancellationWaiter* Next = nullptr;
+    int WriteDescriptor = -1;
+  };
+
+  /**
+   * @brief Wakes up the calling thread from a wait on a socket when its context is cancelled.
+   *
+   * @remark While it lives, the descriptor of the waker becomes readable when the context or one
+   * of its parents is cancelled, so that the thread polling it with its socket throws right away.
+   * The waker is in the list of waiters of each context of the branch, and cancelling a context
+   * only wakes up the waiters in its list. The descriptor is a pipe kept by the thread; there is
+   * none on the platforms without `poll()` on pipes, such as Windows.
+   */
+  class CancellationWaker final {
+  public:
+    /**
+     * @brief Registers the calling thread to be woken up by the cancellation of \p context.
+     */
+    explicit CancellationWaker(Context const& context);
+
+    ~CancellationWaker();
+
+    CancellationWaker(const CancellationWaker&) = delete;
+    CancellationWaker& operator=(const CancellationWaker&) = delete;
+
+    /**
+     * @brief Gets the descriptor to poll for reading, or `-1` when waking up isn't supported.
+     */
+    int GetDescriptor() const noexcept { return m_descriptor; }
+
+    /**
+     * @brief Drains the descriptor after it was woken up, before waiting on it again.
+     */
+    void Reset() noexcept;
+
+    /**
+     * @brief Wakes up the threads waiting for \p context or one of its children to be cancelled.
+     */
+    static void Wake(Context const& context) noexcept;
+
+  private:
+    int m_descriptor;
+    Context m_context;
+    // One per context of the branch, from the context to the root.
+    std::vector<CancellationWaiter> m_waiters;
+  };
+
+}}} // namespace Azure::Core::_detail
@@ -0,0 +1,22 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "azure/core/http/raw_response.hpp"
+
+#include <chrono>
+
+namespace Azure { namespace Core { namespace Http { namespace Policies { namespace _detail {
+
+  /**
+   * @brief Gets the delay a service asks for before the next request, from the `retry-after-ms`,
+   * `x-ms-retry-after-ms` or `retry-after` header of its \p response.
+   *
+   * @return `true` if the response has one of the headers; otherwise, `false`.
+   */
+  bool GetResponseHeaderBasedDelay(
+      RawResponse const& response,
+      std::chrono::milliseconds& retryAfter);
+
+}}}}} // namespace Azure::Core::Http::Policies::_detail
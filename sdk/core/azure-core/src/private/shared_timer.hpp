@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "azure/core/context.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace Azure { namespace Core { namespace _detail {
+
+  /**
+   * @brief Runs callbacks after a delay, on a thread shared by the whole process.
+   *
+   * @remark The thread is started with the first callback, and the callbacks run on it one after
+   * the other, so they must not block. The callbacks of a cancelled context run at most 100ms
+   * after the cancellation.
+   */
+  class SharedTimer final {
+  public:
+    /**
+     * @brief Runs \p callback once \p time is reached, or once \p context is cancelled.
+     *
+     * @param time The time to run the callback at.
+     * @param context The context cancelling the wait.
+     * @param callback The function run with whether \p context was cancelled.
+     * @return The identifier of the callback, to cancel it.
+     */
+    static uint64_t Schedule(
+        std::chrono::steady_clock::time_point time,
+        Context const& context,
+        std::function<void(bool isCancelled)> callback);
+
+    /**
+     * @brief Cancels a callback which hasn't run yet, or waits for it to return if it's running.
+     *
+     * @remark Once it returns, the callback doesn't run, unless it's called from the callback.
+     *
+     * @param id The identifier returned by #Schedule.
+     */
+    static void Cancel(uint64_t id);
+  };
+
+}}} // namespace Azure::Core::_detail
@@ -0,0 +1,157 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "private/shared_timer.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using Azure::Core::Context;
+using Azure::Core::_detail::SharedTimer;
+
+namespace {
+// The period the contexts of the waiting callbacks are checked at.
+constexpr std::chrono::milliseconds CancellationCheckPeriod(100);
+
+class TimerThread final {
+  struct Entry final
+  {
+    uint64_t Id;
+    std::chrono::steady_clock::time_point Time;
+    Context EntryContext;
+    std::function<void(bool)> Callback;
+  };
+
+  std::mutex m_mutex;
+  std::condition_variable m_changed;
+  std::condition_variable m_callbacksRan;
+  std::vector<Entry> m_entries;
+  uint64_t m_nextId = 0;
+  // The callbacks being run, which are waited for when cancelled.
+  std::vector<uint64_t> m_runningIds;
+  bool m_stopped = false;
+  std::thread m_thread;
+
+  void Run()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopped)
+    {
+      if (m_entries.empty())
+      {
+        m_changed.wait(lock);
+        continue;
+      }
+
+      auto const now = std::chrono::steady_clock::now();
+      std::vector<std::pair<std::function<void(bool)>, bool>> dueCallbacks;
+      auto nextTime = now + CancellationCheckPeriod;
+      for (auto ite = m_entries.begin(); ite != m_entries.end();)
+      {
+        bool const isCancelled = ite->EntryContext.IsCancelled();
+        if (isCancelled || ite->Time <= now)
+        {
+          dueCallbacks.emplace_back(std::move(ite->Callback), isCancelled);
+          m_runningIds.push_back(ite->Id);
+          ite = m_entries.erase(ite);
+        }
+        else
+        {
+          nextTime = (std::min)(nextTime, ite->Time);
+          ++ite;
+        }
+      }
+
+      if (dueCallbacks.empty())
+      {
+        m_changed.wait_until(lock, nextTime);
+        continue;
+      }
+      lock.unlock();
+      for (auto& dueCallback : dueCallbacks)
+      {
+        dueCallback.first(dueCallback.second);
+      }
+      dueCallbacks.clear();
+      lock.lock();
+      m_runningIds.clear();
+      m_callbacksRan.notify_all();
+    }
+  }
+
+public:
+  ~TimerThread()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopped = true;
+    }
+    m_changed.notify_all();
+    if (m_thread.joinable())
+    {
+      m_thread.join();
+    }
+  }
+
+  uint64_t Schedule(
+      std::chrono::steady_clock::time_point time,
+      Context const& context,
+      std::function<void(bool)> callback)
+  {
+    uint64_t id;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_thread.joinable())
+      {
+        m_thread = std::thread([this]() { Run(); });
+      }
+      id = m_nextId++;
+      m_entries.push_back(Entry{id, time, context, std::move(callback)});
+    }
+    m_changed.notify_all();
+    return id;
+  }
+
+  void Cancel(uint64_t id)
+  {
+    std::function<void(bool)> callback;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto entry = std::find_if(
+        m_entries.begin(), m_entries.end(), [id](Entry const& e) { return e.Id == id; });
+    if (entry != m_entries.end())
+    {
+      // Destroyed without the lock, the callback can own anything.
+      callback = std::move(entry->Callback);
+      m_entries.erase(entry);
+      lock.unlock();
+      return;
+    }
+    if (std::this_thread::get_id() != m_thread.get_id())
+    {
+      m_callbacksRan.wait(lock, [this, id]() {
+        return std::find(m_runningIds.begin(), m_runningIds.end(), id) == m_runningIds.end();
+      });
+    }
+  }
+};
+
+TimerThread& GetTimerThread()
+{
+  static TimerThread timerThread;
+  return timerThread;
+}
+} // namespace
+
+uint64_t SharedTimer::Schedule(
+    std::chrono::steady_clock::time_point time,
+    Context const& context,
+    std::function<void(bool isCancelled)> callback)
+{
+  return GetTimerThread().Schedule(time, context, std::move(callback));
+}
+
+void SharedTimer::Cancel(uint64_t id) { GetTimerThread().Cancel(id); }
@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/platform.hpp"
+
+#if defined(AZ_PLATFORM_WINDOWS)
+// Windows needs to go before bcrypt
+#include <windows.h>
+
+#include <bcrypt.h>
+#elif defined(AZ_PLATFORM_POSIX)
+#include <openssl/rand.h> //for RAND_bytes
+#include <pthread.h>
+#endif
+
+#include "azure/core/uuid.hpp"
+
+#include <atomic>
+#include <cstdlib>
+
+using Azure::Core::Uuid;
+
+namespace {
+
+// The random bytes of this many UUIDs are generated at once.
+constexpr size_t UuidsPerBatch = 128;
+
+#if defined(AZ_PLATFORM_POSIX)
+// Incremented in the child of a fork, whose threads must not hand out the random bytes buffered
+// by the parent.
+std::atomic<uint64_t> g_forkGeneration(0);
+#endif
+
+struct RandomBytesBuffer final
+{
+  uint8_t Bytes[UuidsPerBatch * 16];
+  size_t Remaining;
+  uint64_t ForkGeneration;
+};
+
+// Zero-initialized, the buffer of a thread is filled on the first UUID it creates.
+thread_local RandomBytesBuffer t_randomBytes;
+
+void FillRandomBytes(RandomBytesBuffer& buffer)
+{
+#if defined(AZ_PLATFORM_WINDOWS)
+  if (!BCRYPT_SUCCESS(BCryptGenRandom(
+          nullptr,
+          buffer.Bytes,
+          static_cast<ULONG>(sizeof(buffer.Bytes)),
+          BCRYPT_USE_SYSTEM_PREFERRED_RNG)))
+  {
+    abort();
+  }
+#elif defined(AZ_PLATFORM_POSIX)
+  static const bool atForkRegistered
+      = pthread_atfork(nullptr, nullptr, []() { ++g_forkGeneration; }) == 0;
+  (void)atForkRegistered;
+
+  buffer.ForkGeneration = g_forkGeneration.load(std::memory_order_relaxed);
+  // This static cast is safe since we know the buffer size, which is a const, will always fit an
+  // int.
+  int ret = RAND_bytes(buffer.Bytes, static_cast<int>(sizeof(buffer.Bytes)));
+  if (ret <= 0)
+  {
+    abort();
+  }
+#else
+  abort();
+#endif
+  buffer.Remaining = UuidsPerBatch;
+}
+
+} // namespace
+
+namespace Azure { namespace Core {
+
+  std::string Uuid::ToString()
+  {
+    static constexpr char HexDigits[] = "0123456789abcdef";
+
+    // Guid is 36 characters
+    std::string s(36, '-');
+    size_t position = 0;
+    for (size_t i = 0; i < UuidSize; ++i)
+    {
+      if (i == 4 || i == 6 || i == 8 || i == 10)
+      {
+        ++position;
+      }
+      s[position++] = HexDigits[m_uuid[i] >> 4];
+      s[position++] = HexDigits[m_uuid[i] & 0xF];
+    }
+    return s;
+  }
+
+  Uuid Uuid::CreateUuid()
+  {
+    auto& buffer = t_randomBytes;
+#if defined(AZ_PLATFORM_POSIX)
+    if (buffer.ForkGeneration != g_forkGeneration.load(std::memory_order_relaxed))
+    {
+      buffer.Remaining = 0;
+    }
+#endif
+    if (buffer.Remaining == 0)
+    {
+      FillRandomBytes(buffer);
+    }
+
+    uint8_t* uuid = buffer.Bytes + (--buffer.Remaining) * UuidSize;
+
+    // SetVariant to ReservedRFC4122
+    uuid[8] = (uuid[8] | ReservedRFC4122) & 0x7F;
+
+    constexpr uint8_t version = 4;
+
+    uuid[6] = (uuid[6] & 0xF) | (version << 4);
+
+    Uuid result(uuid);
+    // The bytes handed out aren't kept around.
+    std::memset(uuid, 0, UuidSize);
+    return result;
+  }
+
+}} // namespace Azure::Core
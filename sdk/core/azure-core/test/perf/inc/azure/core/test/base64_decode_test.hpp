@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of decoding Base64 text.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/base64.hpp>
+#include <azure/perf.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Test {
+
+  /**
+   * @brief A test to measure decoding Base64 text into binary data, as done for the
+   * transactional hashes and Key Vault results.
+   *
+   * @remark With `--parallel 1`, the operations per second times the size is the throughput of a
+   * core.
+   */
+  class Base64DecodeTest : public Azure::Perf::PerfTest {
+  private:
+    std::string m_encoded;
+    std::vector<uint8_t> m_data;
+
+  public:
+    /**
+     * @brief Construct a new Base64DecodeTest.
+     *
+     * @param options The test options.
+     */
+    Base64DecodeTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief The size of the buffer is defined by a mandatory parameter.
+     *
+     */
+    void Setup() override
+    {
+      long size = m_options.GetMandatoryOption<long>("Size");
+
+      m_data.resize(size);
+      for (size_t i = 0; i < m_data.size(); ++i)
+      {
+        m_data[i] = static_cast<uint8_t>(i * 2654435761U >> 13);
+      }
+      m_encoded = Azure::Core::Convert::Base64Encode(m_data);
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      Azure::Core::Convert::Base64Decode(
+          m_encoded.data(), m_encoded.size(), m_data.data(), m_data.size());
+    }
+
+    /**
+     * @brief Gets the size of the decoded buffer.
+     *
+     */
+    int64_t GetBytesPerOperation() override { return static_cast<int64_t>(m_data.size()); }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {{"Size", {"--size"}, "Size of the buffer (in bytes)", 1, true}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "Base64DecodeTest",
+          "Decode the Base64 text of a buffer.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::Base64DecodeTest>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Core::Test
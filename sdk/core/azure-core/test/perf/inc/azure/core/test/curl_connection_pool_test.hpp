@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of getting connections from the libcurl connection pool.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/http/curl_transport.hpp>
+#include <azure/core/http/http.hpp>
+#include <azure/perf.hpp>
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// The next includes are from Azure Core private headers, to use the connection pool without
+// opening connections.
+#include <http/curl/curl_connection_pool_private.hpp>
+#include <http/curl/curl_connection_private.hpp>
+
+namespace Azure { namespace Core { namespace Test {
+
+  /**
+   * @brief A test to measure getting a connection from the libcurl connection pool and moving it
+   * back, from `--parallel` threads across `--keys` hosts, which shows the contention on the
+   * pool.
+   *
+   * @remark The pool is filled with connections without sockets, one per thread and per host, so
+   * that no connection is ever opened. At the end of the test, the number of times and the time
+   * the threads waited for each other are printed, from the statistics of the pool.
+   */
+  class CurlConnectionPoolTest : public Azure::Perf::PerfTest {
+  private:
+    class PooledConnection final : public Azure::Core::Http::CurlNetworkConnection {
+      std::string const m_connectionKey;
+
+    public:
+      explicit PooledConnection(std::string connectionKey)
+          : m_connectionKey(std::move(connectionKey))
+      {
+      }
+
+      std::string const& GetConnectionKey() const override { return m_connectionKey; }
+      void UpdateLastUsageTime() override {}
+      bool IsExpired() override { return false; }
+      size_t ReadFromSocket(uint8_t*, size_t, Context const&) override { return 0; }
+      CURLcode SendBuffer(uint8_t const*, size_t, Context const&) override { return CURLE_OK; }
+    };
+
+    static Azure::Core::Http::CurlConnectionPoolKeyStatistics& GetInitialStatistics()
+    {
+      static Azure::Core::Http::CurlConnectionPoolKeyStatistics statistics;
+      return statistics;
+    }
+
+    Azure::Core::Http::CurlTransportOptions m_transportOptions;
+    std::vector<std::unique_ptr<Azure::Core::Http::Request>> m_requests;
+    size_t m_nextRequest = 0;
+
+  public:
+    /**
+     * @brief Construct a new CurlConnectionPoolTest.
+     *
+     * @param options The test options.
+     */
+    CurlConnectionPoolTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Takes the statistics of the pool before the test.
+     *
+     */
+    void GlobalSetup() override
+    {
+      GetInitialStatistics()
+          = Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics().Total;
+    }
+
+    /**
+     * @brief Adds a connection for each host to the pool, and starts at a different host on each
+     * thread.
+     *
+     */
+    void Setup() override
+    {
+      static std::atomic<size_t> threadCount(0);
+      auto const keys = m_options.GetOptionOrDefault<size_t>("Keys", 1);
+      for (size_t key = 0; key < keys; ++key)
+      {
+        m_requests.emplace_back(std::make_unique<Azure::Core::Http::Request>(
+            Azure::Core::Http::HttpMethod::Get,
+            Azure::Core::Url("https://host-" + std::to_string(key) + ".example.com")));
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
+            .MoveConnectionBackToPool(
+                std::make_unique<PooledConnection>(
+                    Azure::Core::Http::_detail::CurlConnectionPool::GetConnectionKeyForUrl(
+                        m_requests.back()->GetUrl(), m_transportOptions)),
+                Azure::Core::Http::HttpStatusCode::Ok);
+      }
+      m_nextRequest = threadCount++;
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      auto& pool = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool;
+      auto& request = *m_requests[m_nextRequest++ % m_requests.size()];
+      pool.MoveConnectionBackToPool(
+          pool.ExtractOrCreateCurlConnection(request, m_transportOptions),
+          Azure::Core::Http::HttpStatusCode::Ok);
+    }
+
+    /**
+     * @brief Prints the waits of the threads for each other, and empties the pool.
+     *
+     */
+    void GlobalCleanup() override
+    {
+      auto const& initial = GetInitialStatistics();
+      auto const statistics = Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics().Total;
+      auto const operations = statistics.Hits - initial.Hits;
+      auto const lockWaits = statistics.LockWaits - initial.LockWaits;
+      auto const lockWaitTime = statistics.LockWaitTime - initial.LockWaitTime;
+      std::cout << "=== Connection Pool ===" << std::endl
+                << "Connections taken: " << operations << ", created: "
+                << statistics.Misses - initial.Misses << std::endl
+                << "Lock waits: " << lockWaits << " ("
+                << (operations == 0 ? 0.0 : 100.0 * lockWaits / (2 * operations))
+                << "% of the locks), " << lockWaitTime.count() / 1000 << " us in total" << std::endl
+                << std::endl;
+      Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {{"Keys", {"--keys"}, "Number of hosts the connections are for. Default to 1.", 1}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "CurlConnectionPoolTest",
+          "Get a connection from the libcurl connection pool and move it back.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::CurlConnectionPoolTest>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Core::Test
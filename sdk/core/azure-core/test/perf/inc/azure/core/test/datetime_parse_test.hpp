@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of parsing a date and time.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/datetime.hpp>
+#include <azure/perf.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Test {
+
+  /**
+   * @brief A test to measure parsing a date and time, as done for the `Date` and `Last-Modified`
+   * headers of the responses and the timestamps of the listings.
+   *
+   */
+  class DateTimeParseTest : public Azure::Perf::PerfTest {
+  private:
+    std::string m_dateTime;
+    Azure::DateTime::DateFormat m_format = Azure::DateTime::DateFormat::Rfc1123;
+
+  public:
+    /**
+     * @brief Construct a new DateTimeParseTest.
+     *
+     * @param options The test options.
+     */
+    DateTimeParseTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief The format of the date and time is defined by an optional parameter.
+     *
+     */
+    void Setup() override
+    {
+      auto const format = m_options.GetOptionOrDefault<std::string>("Format", "rfc1123");
+      if (format == "rfc1123")
+      {
+        m_format = Azure::DateTime::DateFormat::Rfc1123;
+        m_dateTime = "Tue, 15 Nov 1994 08:12:31 GMT";
+      }
+      else if (format == "rfc3339")
+      {
+        m_format = Azure::DateTime::DateFormat::Rfc3339;
+        m_dateTime = "1994-11-15T08:12:31.1234567Z";
+      }
+      else
+      {
+        throw std::invalid_argument("Unknown date format " + format + ".");
+      }
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const&) override { Azure::DateTime::Parse(m_dateTime, m_format); }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {{"Format", {"--format"}, "Date format, rfc1123 or rfc3339. Default to rfc1123.", 1}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "DateTimeParseTest",
+          "Parse a date and time.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::DateTimeParseTest>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Core::Test
@@ -0,0 +1,120 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of hashing a buffer.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/cryptography/hash.hpp>
+#include <azure/core/internal/cryptography/sha_hash.hpp>
+#include <azure/perf.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Test {
+
+  /**
+   * @brief A test to measure hashing a buffer, as done for the transactional MD5 of the uploads and
+   * the SHA-256 of the signatures.
+   *
+   * @remark With `--parallel 1`, the throughput reported is the one of a core.
+   */
+  class HashTest : public Azure::Perf::PerfTest {
+  private:
+    std::string m_algorithm;
+    std::vector<uint8_t> m_data;
+
+    std::unique_ptr<Azure::Core::Cryptography::Hash> CreateHash() const
+    {
+      if (m_algorithm == "md5")
+      {
+        return std::make_unique<Azure::Core::Cryptography::Md5Hash>();
+      }
+      if (m_algorithm == "sha256")
+      {
+        return std::make_unique<Azure::Core::Cryptography::_internal::Sha256Hash>();
+      }
+      if (m_algorithm == "sha512")
+      {
+        return std::make_unique<Azure::Core::Cryptography::_internal::Sha512Hash>();
+      }
+      throw std::invalid_argument("Unknown hash algorithm " + m_algorithm + ".");
+    }
+
+  public:
+    /**
+     * @brief Construct a new HashTest.
+     *
+     * @param options The test options.
+     */
+    HashTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief The size of the buffer is defined by a mandatory parameter.
+     *
+     */
+    void Setup() override
+    {
+      m_algorithm = m_options.GetOptionOrDefault<std::string>("Algorithm", "md5");
+      long size = m_options.GetMandatoryOption<long>("Size");
+
+      m_data.resize(size);
+      for (size_t i = 0; i < m_data.size(); ++i)
+      {
+        m_data[i] = static_cast<uint8_t>(i * 2654435761U >> 13);
+      }
+      // Fail in the set up rather than in the loop on an unknown algorithm.
+      CreateHash();
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      CreateHash()->Final(m_data.data(), m_data.size());
+    }
+
+    /**
+     * @brief Gets the size of the buffer.
+     *
+     */
+    int64_t GetBytesPerOperation() override { return static_cast<int64_t>(m_data.size()); }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Algorithm",
+           {"--algorithm"},
+           "Hash algorithm, md5, sha256 or sha512. Default to md5.",
+           1},
+          {"Size", {"--size"}, "Size of the buffer (in bytes)", 1, true}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {"HashTest", "Hash a buffer.", [](Azure::Perf::TestOptions options) {
+                return std::make_unique<Azure::Core::Test::HashTest>(options);
+              }};
+    }
+  };
+
+}}} // namespace Azure::Core::Test
@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of URL-encoding a string.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/url.hpp>
+#include <azure/perf.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Test {
+
+  /**
+   * @brief A test to measure URL-encoding a string, as done for the blob names and the query
+   * parameters of every request.
+   *
+   * @remark The string is a path with a character to escape every few characters.
+   */
+  class UrlEncodeTest : public Azure::Perf::PerfTest {
+  private:
+    std::string m_value;
+
+  public:
+    /**
+     * @brief Construct a new UrlEncodeTest.
+     *
+     * @param options The test options.
+     */
+    UrlEncodeTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief The size of the string is defined by a mandatory parameter.
+     *
+     */
+    void Setup() override
+    {
+      long size = m_options.GetMandatoryOption<long>("Size");
+
+      std::string const pattern = "folder/sub folder/file-name_1.txt?";
+      m_value.resize(size);
+      for (size_t i = 0; i < m_value.size(); ++i)
+      {
+        m_value[i] = pattern[i % pattern.size()];
+      }
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const&) override { Azure::Core::Url::Encode(m_value, "/"); }
+
+    /**
+     * @brief Gets the size of the string.
+     *
+     */
+    int64_t GetBytesPerOperation() override { return static_cast<int64_t>(m_value.size()); }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {{"Size", {"--size"}, "Size of the string (in bytes)", 1, true}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "UrlEncodeTest",
+          "URL-encode a string.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::UrlEncodeTest>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Core::Test
@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the Uuid component performance.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/uuid.hpp>
+#include <azure/perf.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace Azure { namespace Core { namespace Test {
+
+  /**
+   * @brief Measure the cost of creating a UUID string, as done for the request id of every HTTP
+   * request.
+   */
+  class UuidTest : public Azure::Perf::PerfTest {
+  public:
+    /**
+     * @brief Construct a new Uuid test.
+     *
+     * @param options The test options.
+     */
+    UuidTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Create a UUID and format it.
+     *
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      auto uuid = Azure::Core::Uuid::CreateUuid().ToString();
+      if (uuid.size() != 36)
+      {
+        throw std::runtime_error("Unexpected UUID length.");
+      }
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "UuidTest",
+          "Measures the overhead of creating a request id UUID",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::UuidTest>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Core::Test
@@ -3,7 +3,16 @@
 
 #include <azure/perf.hpp>
 
+#include "azure/core/test/base64_decode_test.hpp"
+#include "azure/core/test/base64_encode_test.hpp"
+#if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
+#include "azure/core/test/curl_connection_pool_test.hpp"
+#endif
+#include "azure/core/test/datetime_parse_test.hpp"
+#include "azure/core/test/hash_test.hpp"
 #include "azure/core/test/nullable_test.hpp"
+#include "azure/core/test/url_encode_test.hpp"
+#include "azure/core/test/uuid_test.hpp"
 
 #include <vector>
 
@@ -11,7 +20,17 @@ int main(int argc, char** argv)
 {
 
   // Create the test list
-  std::vector<Azure::Perf::TestMetadata> tests{Azure::Core::Test::NullableTest::GetTestMetadata()};
+  std::vector<Azure::Perf::TestMetadata> tests{
+      Azure::Core::Test::Base64DecodeTest::GetTestMetadata(),
+      Azure::Core::Test::Base64EncodeTest::GetTestMetadata(),
+      Azure::Core::Test::DateTimeParseTest::GetTestMetadata(),
+      Azure::Core::Test::HashTest::GetTestMetadata(),
+      Azure::Core::Test::NullableTest::GetTestMetadata(),
+      Azure::Core::Test::UrlEncodeTest::GetTestMetadata(),
+      Azure::Core::Test::UuidTest::GetTestMetadata()};
+#if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
+  tests.emplace_back(Azure::Core::Test::CurlConnectionPoolTest::GetTestMetadata());
+#endif
 
   Azure::Perf::Program::Run(Azure::Core::Context::ApplicationContext, tests, argc, argv);
 
@@ -0,0 +1,136 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Measures the time from the start of a process to the response of its first HTTP request,
+ * which includes the static initialization of the SDK and the set up of the transport adapter.
+ *
+ * @remark The program starts a loopback HTTP server and runs itself `--runs` times, 20 by default,
+ * as a child process sending one request to the server. It then reports the median and the
+ * minimum of the durations measured by the children:
+ * - From the parent starting the child, through a shell, to the `main()` of the child, which
+ * includes loading the libraries and their static initialization.
+ * - From `main()` to the response of the first request, which includes the set up of the pipeline
+ * and of the transport adapter.
+ *
+ */
+
+#include <azure/core/context.hpp>
+#include <azure/core/http/http.hpp>
+#include <azure/core/internal/client_options.hpp>
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/perf/loopback_http_server.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define popen _popen
+#define pclose _pclose
+#endif
+
+namespace {
+// The clock is steady across processes on the supported platforms: CLOCK_MONOTONIC and
+// QueryPerformanceCounter.
+int64_t Now()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Sends a request to url and prints the durations since startTime, the time the child was started
+// by its parent.
+int RunChild(int64_t mainTime, std::string const& url, int64_t startTime)
+{
+  Azure::Core::_internal::ClientOptions options;
+  Azure::Core::Http::_internal::HttpPipeline pipeline(options, "startup-perf", "1.0.0", {}, {});
+  Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, Azure::Core::Url(url));
+  auto response = pipeline.Send(request, Azure::Core::Context::ApplicationContext);
+  auto const responseTime = Now();
+  if (response->GetStatusCode() != Azure::Core::Http::HttpStatusCode::Ok)
+  {
+    return 1;
+  }
+  std::cout << (mainTime - startTime) << ' ' << (responseTime - mainTime) << std::endl;
+  return 0;
+}
+
+int64_t Median(std::vector<int64_t> values)
+{
+  std::sort(values.begin(), values.end());
+  return values[values.size() / 2];
+}
+
+void Report(std::string const& name, std::vector<int64_t> const& values)
+{
+  std::cout << name << ": median " << Median(values) << "us, min "
+            << *std::min_element(values.begin(), values.end()) << "us" << std::endl;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+  auto const mainTime = Now();
+  if (argc == 4 && std::string(argv[1]) == "--child")
+  {
+    return RunChild(mainTime, argv[2], std::stoll(argv[3]));
+  }
+
+  int runs = 20;
+  if (argc == 3 && std::string(argv[1]) == "--runs")
+  {
+    runs = std::stoi(argv[2]);
+  }
+  else if (argc != 1)
+  {
+    runs = 0;
+  }
+  if (runs <= 0)
+  {
+    std::cerr << "Usage: " << argv[0] << " [--runs <count>]" << std::endl;
+    return 1;
+  }
+
+  Azure::Perf::LoopbackHttpServer server;
+  std::vector<int64_t> toMain;
+  std::vector<int64_t> toFirstResponse;
+  std::vector<int64_t> total;
+  for (int i = 0; i < runs; ++i)
+  {
+    auto const command = std::string("\"") + argv[0] + "\" --child " + server.GetUrl() + " "
+        + std::to_string(Now());
+    auto pipe = popen(command.c_str(), "r");
+    if (pipe == nullptr)
+    {
+      throw std::runtime_error("Failed to start " + command);
+    }
+    char output[64] = {};
+    auto const isRead = fgets(output, sizeof(output), pipe) != nullptr;
+    if (pclose(pipe) != 0 || !isRead)
+    {
+      std::cerr << "The child process failed." << std::endl;
+      return 1;
+    }
+    int64_t childToMain = 0;
+    int64_t childToFirstResponse = 0;
+    std::istringstream(output) >> childToMain >> childToFirstResponse;
+    toMain.push_back(childToMain);
+    toFirstResponse.push_back(childToFirstResponse);
+    total.push_back(childToMain + childToFirstResponse);
+  }
+
+  Report("Process start to main", toMain);
+  Report("Main to first response", toFirstResponse);
+  Report("Process start to first response", total);
+  return 0;
+}
@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: MIT
 
 #include <azure/core/base64.hpp>
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <random>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -117,3 +119,104 @@ TEST(Base64, Roundtrip)
     EXPECT_EQ(Convert::Base64Decode(Convert::Base64Encode(data)), data);
   }
 }
+
+namespace {
+// The encodings of pieces short enough to skip the vectorized codecs.
+std::string EncodeByPieces(const std::vector<uint8_t>& data)
+{
+  std::string encoded;
+  for (size_t offset = 0; offset < data.size(); offset += 21)
+  {
+    encoded += Convert::Base64Encode(std::vector<uint8_t>(
+        data.begin() + offset, data.begin() + std::min(offset + 21, data.size())));
+  }
+  return encoded;
+}
+} // namespace
+
+TEST(Base64, VectorizedBlocks)
+{
+  for (size_t len = 0; len < 400; len++)
+  {
+    std::vector<uint8_t> data(len);
+    RandomBuffer(data.data(), data.size());
+    for (size_t i = 0; i < len; i += 7)
+    {
+      // All the sextets.
+      data[i] = static_cast<uint8_t>(i * 4);
+    }
+
+    const std::string encoded = Convert::Base64Encode(data);
+    EXPECT_EQ(encoded, EncodeByPieces(data));
+    EXPECT_EQ(Convert::Base64Decode(encoded), data);
+
+    std::string base64url = encoded.substr(0, encoded.find('='));
+    std::replace(base64url.begin(), base64url.end(), '+', '-');
+    std::replace(base64url.begin(), base64url.end(), '/', '_');
+    EXPECT_EQ(_internal::Base64Url::Base64UrlEncode(data), base64url);
+    EXPECT_EQ(_internal::Base64Url::Base64UrlDecode(base64url), data);
+  }
+}
+
+TEST(Base64, Buffers)
+{
+  std::vector<uint8_t> data(1000);
+  RandomBuffer(data.data(), data.size());
+
+  std::vector<char> encoded(Convert::Base64EncodedLength(data.size()));
+  EXPECT_EQ(
+      Convert::Base64Encode(data.data(), data.size(), encoded.data(), encoded.size()),
+      encoded.size());
+  EXPECT_EQ(std::string(encoded.begin(), encoded.end()), Convert::Base64Encode(data));
+  EXPECT_THROW(
+      Convert::Base64Encode(data.data(), data.size(), encoded.data(), encoded.size() - 1),
+      std::invalid_argument);
+
+  std::vector<uint8_t> decoded(Convert::Base64DecodedMaxLength(encoded.size()));
+  decoded.resize(
+      Convert::Base64Decode(encoded.data(), encoded.size(), decoded.data(), decoded.size()));
+  EXPECT_EQ(decoded, data);
+  EXPECT_THROW(
+      Convert::Base64Decode(encoded.data(), encoded.size(), decoded.data(), 999),
+      std::invalid_argument);
+
+  // Decoding in place, past the blocks decoded with SIMD instructions.
+  for (size_t len : {0U, 1U, 2U, 47U, 48U, 49U, 500U, 1000U})
+  {
+    const std::vector<uint8_t> expected(data.begin(), data.begin() + len);
+    std::string text = Convert::Base64Encode(expected);
+    text.resize(Convert::Base64Decode(
+        text.data(), text.length(), reinterpret_cast<uint8_t*>(&text[0]), text.length()));
+    EXPECT_EQ(std::vector<uint8_t>(text.begin(), text.end()), expected);
+  }
+
+  std::vector<char> base64url(_internal::Base64Url::Base64UrlEncodedLength(3));
+  EXPECT_EQ(
+      _internal::Base64Url::Base64UrlEncode(data.data(), 2, base64url.data(), base64url.size()),
+      3);
+}
+
+TEST(Base64, Invalid)
+{
+  // Without padding.
+  EXPECT_EQ(Convert::Base64Decode("AQI"), std::vector<uint8_t>({1, 2}));
+  EXPECT_EQ(Convert::Base64Decode("AQ"), std::vector<uint8_t>({1}));
+  EXPECT_EQ(_internal::Base64Url::Base64UrlDecode("AQ=="), std::vector<uint8_t>({1}));
+
+  EXPECT_THROW(Convert::Base64Decode("A"), std::invalid_argument);
+  EXPECT_THROW(Convert::Base64Decode("A==="), std::invalid_argument);
+  EXPECT_THROW(Convert::Base64Decode("AQ=A"), std::invalid_argument);
+  EXPECT_THROW(Convert::Base64Decode("AQ-_"), std::invalid_argument);
+  EXPECT_THROW(_internal::Base64Url::Base64UrlDecode("AQ+/"), std::invalid_argument);
+
+  const std::string text = Convert::Base64Encode(std::vector<uint8_t>(300, 0xAB));
+  for (size_t i : {size_t(0), size_t(31), size_t(100), text.size() - 3})
+  {
+    for (char c : {'-', '=', '*', '\x80', '\xFF'})
+    {
+      std::string invalid = text;
+      invalid[i] = c;
+      EXPECT_THROW(Convert::Base64Decode(invalid), std::invalid_argument);
+    }
+  }
+}
@@ -6,6 +6,11 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
 namespace {
 class TestTokenCredential final : public Azure::Core::Credentials::TokenCredential {
 private:
@@ -26,6 +31,31 @@ public:
   }
 };
 
+// Returns the token once, and fails after that.
+class FailingTokenCredential final : public Azure::Core::Credentials::TokenCredential {
+private:
+  Azure::Core::Credentials::AccessToken m_accessToken;
+
+public:
+  mutable std::atomic<int> GetTokenCount{0};
+
+  explicit FailingTokenCredential(Azure::Core::Credentials::AccessToken accessToken)
+      : m_accessToken(std::move(accessToken))
+  {
+  }
+
+  Azure::Core::Credentials::AccessToken GetToken(
+      Azure::Core::Credentials::TokenRequestContext const&,
+      Azure::Core::Context const&) const override
+  {
+    if (GetTokenCount++ != 0)
+    {
+      throw std::runtime_error("GetToken failed.");
+    }
+    return m_accessToken;
+  }
+};
+
 class TestTransportPolicy final : public Azure::Core::Http::Policies::HttpPolicy {
 public:
   std::unique_ptr<Azure::Core::Http::RawResponse> Send(
@@ -202,3 +232,93 @@ TEST(BearerTokenAuthenticationPolicy, RefreshAfterExpiry)
     }
   }
 }
+
+TEST(BearerTokenAuthenticationPolicy, RefreshInBackgroundBeforeExpiry)
+{
+  using namespace std::chrono_literals;
+  auto accessToken = std::make_shared<Azure::Core::Credentials::AccessToken>();
+
+  std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+
+  policies.emplace_back(
+      std::make_unique<Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicy>(
+          std::make_shared<TestTokenCredential>(accessToken),
+          Azure::Core::Credentials::TokenRequestContext{{"https://microsoft.com/.default"}}));
+
+  policies.emplace_back(std::make_unique<TestTransportPolicy>());
+
+  Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+
+  auto getAuthHeader = [&]() {
+    Azure::Core::Http::Request request(
+        Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("https://www.azure.com"));
+    pipeline.Send(request, Azure::Core::Context());
+    auto const headers = request.GetHeaders();
+    auto const authHeader = headers.find("authorization");
+    EXPECT_NE(authHeader, headers.end());
+    return authHeader == headers.end() ? std::string() : authHeader->second;
+  };
+
+  *accessToken = {"ACCESSTOKEN1", std::chrono::system_clock::now() + 4min};
+  EXPECT_EQ(getAuthHeader(), "Bearer ACCESSTOKEN1");
+
+  // The token expiring soon is still used while a new one is fetched in the background.
+  *accessToken = {"ACCESSTOKEN2", std::chrono::system_clock::now() + 1h};
+  EXPECT_EQ(getAuthHeader(), "Bearer ACCESSTOKEN1");
+
+  auto const deadline = std::chrono::steady_clock::now() + 10s;
+  std::string authHeader;
+  do
+  {
+    std::this_thread::sleep_for(10ms);
+    authHeader = getAuthHeader();
+  } while (authHeader != "Bearer ACCESSTOKEN2" && std::chrono::steady_clock::now() < deadline);
+  EXPECT_EQ(authHeader, "Bearer ACCESSTOKEN2");
+}
+
+TEST(BearerTokenAuthenticationPolicy, BackOffAfterBackgroundRefreshFailure)
+{
+  using namespace std::chrono_literals;
+  auto credential = std::make_shared<FailingTokenCredential>(Azure::Core::Credentials::AccessToken{
+      "ACCESSTOKEN1", std::chrono::system_clock::now() + 4min});
+
+  std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+
+  policies.emplace_back(
+      std::make_unique<Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicy>(
+          credential,
+          Azure::Core::Credentials::TokenRequestContext{{"https://microsoft.com/.default"}}));
+
+  policies.emplace_back(std::make_unique<TestTransportPolicy>());
+
+  Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+
+  auto getAuthHeader = [&]() {
+    Azure::Core::Http::Request request(
+        Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("https://www.azure.com"));
+    pipeline.Send(request, Azure::Core::Context());
+    auto const headers = request.GetHeaders();
+    auto const authHeader = headers.find("authorization");
+    EXPECT_NE(authHeader, headers.end());
+    return authHeader == headers.end() ? std::string() : authHeader->second;
+  };
+
+  // The first token is fetched on the request path, and the second request refreshes it in the
+  // background, which fails.
+  EXPECT_EQ(getAuthHeader(), "Bearer ACCESSTOKEN1");
+  EXPECT_EQ(getAuthHeader(), "Bearer ACCESSTOKEN1");
+  auto const deadline = std::chrono::steady_clock::now() + 10s;
+  while (credential->GetTokenCount < 2 && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_EQ(credential->GetTokenCount, 2);
+
+  // The token, still valid, is used without refreshing it again until the backoff ends.
+  for (int i = 0; i < 10; ++i)
+  {
+    std::this_thread::sleep_for(10ms);
+    EXPECT_EQ(getAuthHeader(), "Bearer ACCESSTOKEN1");
+  }
+  EXPECT_EQ(credential->GetTokenCount, 2);
+}
@@ -24,6 +24,19 @@
 using namespace Azure::Core::IO;
 using namespace Azure::Core;
 
+// A stream of the bytes of a vector, whose length is unknown like a chunked response.
+class UnknownLengthBodyStream final : public BodyStream {
+  MemoryBodyStream m_stream;
+  size_t OnRead(uint8_t* buffer, size_t count, Context const& context) override
+  {
+    return m_stream.Read(buffer, count, context);
+  }
+
+public:
+  explicit UnknownLengthBodyStream(std::vector<uint8_t> const& data) : m_stream(data) {}
+  int64_t Length() const override { return -1; }
+};
+
 // Used to test virtual, default behavior of BodyStream.
 class TestBodyStream final : public BodyStream {
   size_t OnRead(uint8_t*, size_t, Context const&) override { return 0; }
@@ -145,3 +158,135 @@ TEST(FileBodyStream, Read)
   EXPECT_EQ(readSize, FileSize);
   EXPECT_EQ(buffer[FileSize], 0);
 }
+
+TEST(BodyStream, ReadToEndIntoBuffer)
+{
+  std::vector<uint8_t> data(100000);
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = static_cast<uint8_t>(i % 251);
+  }
+
+  // The buffer is sized from the length of the stream, and its capacity is reused.
+  std::vector<uint8_t> buffer(10, 0xff);
+  buffer.reserve(data.size() * 2);
+  auto const reserved = buffer.data();
+  MemoryBodyStream stream(data);
+  stream.ReadToEnd(buffer);
+  EXPECT_EQ(buffer, data);
+  EXPECT_EQ(buffer.data(), reserved);
+
+  // A buffer reserved for exactly the length of the stream isn't reallocated either.
+  std::vector<uint8_t> exactBuffer;
+  exactBuffer.reserve(data.size());
+  auto const exactReserved = exactBuffer.data();
+  MemoryBodyStream exactStream(data);
+  exactStream.ReadToEnd(exactBuffer);
+  EXPECT_EQ(exactBuffer, data);
+  EXPECT_EQ(exactBuffer.data(), exactReserved);
+  EXPECT_EQ(exactBuffer.capacity(), data.size());
+
+  UnknownLengthBodyStream unknownLengthStream(data);
+  std::vector<uint8_t> unknownLengthBuffer;
+  unknownLengthStream.ReadToEnd(unknownLengthBuffer);
+  EXPECT_EQ(unknownLengthBuffer, data);
+
+  MemoryBodyStream emptyStream(nullptr, 0);
+  EXPECT_TRUE(emptyStream.ReadToEnd().empty());
+}
+
+TEST(BodyStream, ReadInto)
+{
+  std::vector<uint8_t> data(100);
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = static_cast<uint8_t>(i);
+  }
+
+  std::vector<uint8_t> first(30);
+  std::vector<uint8_t> second(50);
+  std::vector<uint8_t> third(50);
+  BufferSegment const segments[]
+      = {{first.data(), first.size()}, {second.data(), second.size()}, {third.data(), 50}};
+
+  // The buffers are filled in turn, until the end of the stream.
+  UnknownLengthBodyStream stream(data);
+  EXPECT_EQ(stream.ReadInto(segments, 3), data.size());
+  EXPECT_EQ(first, std::vector<uint8_t>(data.begin(), data.begin() + 30));
+  EXPECT_EQ(second, std::vector<uint8_t>(data.begin() + 30, data.begin() + 80));
+  EXPECT_EQ(
+      std::vector<uint8_t>(third.begin(), third.begin() + 20),
+      std::vector<uint8_t>(data.begin() + 80, data.end()));
+  EXPECT_EQ(stream.ReadInto(segments, 3), 0);
+}
+
+TEST(BodyStream, ReadSpan)
+{
+  std::vector<uint8_t> data(100);
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = static_cast<uint8_t>(i);
+  }
+  std::vector<uint8_t> scratch;
+  uint8_t const* span = nullptr;
+
+  // A memory stream lends its buffer.
+  MemoryBodyStream memoryStream(data);
+  EXPECT_EQ(memoryStream.ReadSpan(span, 60, scratch), 60);
+  EXPECT_EQ(span, data.data());
+  EXPECT_EQ(memoryStream.ReadSpan(span, 60, scratch), 40);
+  EXPECT_EQ(span, data.data() + 60);
+  EXPECT_EQ(memoryStream.ReadSpan(span, 60, scratch), 0);
+  EXPECT_TRUE(scratch.empty());
+
+  // Other streams read into the scratch buffer.
+  UnknownLengthBodyStream stream(data);
+  EXPECT_EQ(stream.ReadSpan(span, 60, scratch), 60);
+  EXPECT_EQ(span, scratch.data());
+  EXPECT_EQ(
+      std::vector<uint8_t>(span, span + 60),
+      std::vector<uint8_t>(data.begin(), data.begin() + 60));
+  EXPECT_EQ(stream.ReadSpan(span, 60, scratch), 40);
+  EXPECT_EQ(
+      std::vector<uint8_t>(span, span + 40),
+      std::vector<uint8_t>(data.begin() + 60, data.end()));
+  EXPECT_EQ(stream.ReadSpan(span, 60, scratch), 0);
+}
+
+TEST(MemoryBodyStream, SharedBuffer)
+{
+  std::vector<uint8_t> data(100);
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = static_cast<uint8_t>(i);
+  }
+  SharedBuffer buffer(data);
+  EXPECT_EQ(buffer.GetSize(), data.size());
+
+  // The stream keeps the bytes alive, and its copies and the slices share them.
+  auto slice = buffer.Slice(10, 50);
+  EXPECT_EQ(slice.GetData(), buffer.GetData() + 10);
+  std::unique_ptr<MemoryBodyStream> stream = std::make_unique<MemoryBodyStream>(slice);
+  auto const sliceData = slice.GetData();
+  buffer = SharedBuffer();
+  slice = SharedBuffer();
+  EXPECT_EQ(slice.GetSize(), 0);
+
+  MemoryBodyStream copy(*stream);
+  stream.reset();
+  std::vector<uint8_t> scratch;
+  uint8_t const* span = nullptr;
+  EXPECT_EQ(copy.ReadSpan(span, 100, scratch), 50);
+  EXPECT_EQ(span, sliceData);
+  EXPECT_EQ(
+      std::vector<uint8_t>(span, span + 50),
+      std::vector<uint8_t>(data.begin() + 10, data.begin() + 60));
+
+  // Rewinding reads the same bytes again.
+  copy.Rewind();
+  EXPECT_EQ(copy.ReadToEnd(), std::vector<uint8_t>(data.begin() + 10, data.begin() + 60));
+
+  MemoryBodyStream stringStream(SharedBuffer(std::string("body")));
+  EXPECT_EQ(stringStream.Length(), 4);
+  EXPECT_EQ(stringStream.ReadToEnd(), std::vector<uint8_t>({'b', 'o', 'd', 'y'}));
+}
@@ -0,0 +1,154 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/policies/concurrency_limiter.hpp"
+#include "azure/core/http/policies/policy.hpp"
+#include "azure/core/internal/http/pipeline.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Azure::Core;
+using namespace Azure::Core::Http;
+using namespace Azure::Core::Http::Policies;
+using namespace Azure::Core::Http::Policies::_internal;
+
+namespace {
+std::string const Host = "account.blob.core.windows.net";
+
+RawResponse MakeResponse(HttpStatusCode statusCode)
+{
+  return RawResponse(1, 1, statusCode, "");
+}
+} // namespace
+
+TEST(ConcurrencyLimiter, IncreasesOnSuccess)
+{
+  ConcurrencyLimiter limiter(4, 8);
+  EXPECT_EQ(limiter.GetLimit(Host), 4U);
+
+  auto const ok = MakeResponse(HttpStatusCode::Ok);
+  // About one more request per round trip of the limit.
+  for (int i = 0; i < 5; ++i)
+  {
+    limiter.Release(Host, limiter.Acquire(Host, Context()), &ok);
+  }
+  EXPECT_EQ(limiter.GetLimit(Host), 5U);
+
+  for (int i = 0; i < 100; ++i)
+  {
+    limiter.Release(Host, limiter.Acquire(Host, Context()), &ok);
+  }
+  EXPECT_EQ(limiter.GetLimit(Host), 8U);
+  EXPECT_EQ(limiter.GetLimit("other.blob.core.windows.net"), 4U);
+}
+
+TEST(ConcurrencyLimiter, DecreasesOnceOnThrottlingBurst)
+{
+  ConcurrencyLimiter limiter(16, 64, 0.5);
+  std::vector<ConcurrencyLimiter::Permit> permits;
+  for (int i = 0; i < 4; ++i)
+  {
+    permits.emplace_back(limiter.Acquire(Host, Context()));
+  }
+
+  auto const throttled = MakeResponse(HttpStatusCode::ServiceUnavailable);
+  for (auto const& permit : permits)
+  {
+    limiter.Release(Host, permit, &throttled);
+  }
+  EXPECT_EQ(limiter.GetLimit(Host), 8U);
+
+  auto const tooManyRequests = MakeResponse(HttpStatusCode::TooManyRequests);
+  limiter.Release(Host, limiter.Acquire(Host, Context()), &tooManyRequests);
+  EXPECT_EQ(limiter.GetLimit(Host), 4U);
+}
+
+TEST(ConcurrencyLimiter, WaitsForRelease)
+{
+  ConcurrencyLimiter limiter(1, 1);
+  auto const permit = limiter.Acquire(Host, Context());
+
+  std::atomic<bool> isAcquired{false};
+  std::thread waiter([&]() {
+    auto const ok = MakeResponse(HttpStatusCode::Ok);
+    limiter.Release(Host, limiter.Acquire(Host, Context()), &ok);
+    isAcquired = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(isAcquired);
+
+  auto const ok = MakeResponse(HttpStatusCode::Ok);
+  limiter.Release(Host, permit, &ok);
+  waiter.join();
+  EXPECT_TRUE(isAcquired);
+}
+
+TEST(ConcurrencyLimiter, WaitIsCancelled)
+{
+  ConcurrencyLimiter limiter(1, 1);
+  auto const permit = limiter.Acquire(Host, Context());
+
+  auto context = Context::ApplicationContext.WithDeadline(
+      std::chrono::system_clock::now() + std::chrono::milliseconds(50));
+  EXPECT_THROW(limiter.Acquire(Host, context), OperationCancelledException);
+  limiter.Release(Host, permit, nullptr);
+}
+
+TEST(ConcurrencyLimiter, PausesOnRetryAfter)
+{
+  ConcurrencyLimiter limiter;
+  auto throttled = MakeResponse(HttpStatusCode::TooManyRequests);
+  throttled.SetHeader("Retry-After", "1");
+  auto const start = std::chrono::steady_clock::now();
+  limiter.Release(Host, limiter.Acquire(Host, Context()), &throttled);
+
+  std::atomic<bool> isAcquired{false};
+  limiter.AcquireAsync(Host, [&](ConcurrencyLimiter::Permit permit) {
+    EXPECT_GE(permit - start, std::chrono::seconds(1));
+    limiter.Release(Host, permit, nullptr);
+    isAcquired = true;
+  });
+  EXPECT_FALSE(isAcquired);
+
+  auto const permit = limiter.Acquire(Host, Context());
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+  limiter.Release(Host, permit, nullptr);
+  EXPECT_TRUE(isAcquired);
+}
+
+TEST(ConcurrencyLimitPolicy, ReleasesOnEachTry)
+{
+  auto limiter = std::make_shared<ConcurrencyLimiter>(2, 2);
+
+  class ThrottlingTransportPolicy final : public HttpPolicy {
+  public:
+    std::unique_ptr<RawResponse> Send(Request&, NextHttpPolicy, Context const&) const override
+    {
+      return std::make_unique<RawResponse>(1, 1, HttpStatusCode::ServiceUnavailable, "");
+    }
+
+    std::unique_ptr<HttpPolicy> Clone() const override
+    {
+      return std::make_unique<ThrottlingTransportPolicy>(*this);
+    }
+  };
+
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<ConcurrencyLimitPolicy>(limiter));
+  policies.emplace_back(std::make_unique<ThrottlingTransportPolicy>());
+  Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+
+  Request request(HttpMethod::Get, Url("https://" + Host));
+  EXPECT_EQ(
+      pipeline.Send(request, Context())->GetStatusCode(), HttpStatusCode::ServiceUnavailable);
+  EXPECT_EQ(limiter->GetLimit(Host), 1U);
+  // The permit of the first request was released.
+  EXPECT_EQ(
+      pipeline.Send(request, Context())->GetStatusCode(), HttpStatusCode::ServiceUnavailable);
+}
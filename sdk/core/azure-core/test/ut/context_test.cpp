@@ -4,8 +4,17 @@
 #include <gtest/gtest.h>
 
 #include <azure/core/context.hpp>
+#include <azure/core/platform.hpp>
+
+#include "private/cancellation_waker.hpp"
+#include "private/shared_timer.hpp"
+
+#if defined(AZ_PLATFORM_POSIX)
+#include <poll.h>
+#endif
 
 #include <chrono>
+#include <future>
 #include <memory>
 #include <string>
 #include <thread>
@@ -435,6 +444,104 @@ TEST(Context, Deadline)
 
     EXPECT_EQ(childCtx.GetDeadline(), Azure::DateTime::min());
   }
+
+  {
+    Context ctx;
+    auto childCtx = ctx.WithDeadline(deadline).WithDeadline(Azure::DateTime::max());
+    EXPECT_EQ(childCtx.GetDeadline(), deadline);
+
+    auto grandChildCtx = childCtx.WithDeadline(Azure::DateTime(2021, 4, 1, 23, 45, 0));
+    EXPECT_EQ(grandChildCtx.GetDeadline(), Azure::DateTime(2021, 4, 1, 23, 45, 0));
+    EXPECT_EQ(childCtx.GetDeadline(), deadline);
+  }
+}
+
+TEST(Context, CancelAfterCheck)
+{
+  Context::Key const key;
+  Context root;
+  auto left = root.WithValue(key, 1).WithValue(key, 2).WithValue(key, 3);
+  auto right = root.WithValue(key, 4);
+
+  EXPECT_FALSE(left.IsCancelled());
+  EXPECT_FALSE(right.IsCancelled());
+
+  // Cancelling a branch doesn't cancel its siblings.
+  right.Cancel();
+  EXPECT_FALSE(left.IsCancelled());
+  EXPECT_TRUE(right.IsCancelled());
+  EXPECT_FALSE(root.IsCancelled());
+
+  // A context already checked is cancelled with its parent.
+  root.Cancel();
+  EXPECT_TRUE(left.IsCancelled());
+  EXPECT_TRUE(left.WithValue(key, 5).IsCancelled());
+  EXPECT_EQ(left.GetDeadline(), Azure::DateTime::min());
+}
+
+#if defined(AZ_PLATFORM_POSIX)
+TEST(Context, CancelWakesUpWaiter)
+{
+  auto parent = Context::ApplicationContext.WithDeadline(Azure::DateTime::max());
+  auto root = parent.WithDeadline(Azure::DateTime::max());
+  auto sibling = parent.WithDeadline(Azure::DateTime::max());
+
+  _detail::CancellationWaker waker(root);
+  ASSERT_GE(waker.GetDescriptor(), 0);
+  struct pollfd poller;
+  poller.fd = waker.GetDescriptor();
+  poller.events = POLLIN;
+  EXPECT_EQ(poll(&poller, 1, 0), 0);
+
+  // Only the cancellation of the context or of a parent wakes up the waiter.
+  sibling.Cancel();
+  EXPECT_EQ(poll(&poller, 1, 0), 0);
+  std::thread canceller([&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    root.Cancel();
+  });
+  auto const start = std::chrono::steady_clock::now();
+  EXPECT_EQ(poll(&poller, 1, 10000), 1);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  canceller.join();
+
+  waker.Reset();
+  EXPECT_EQ(poll(&poller, 1, 0), 0);
+  parent.Cancel();
+  EXPECT_EQ(poll(&poller, 1, 0), 1);
+
+  // Another waiter of the thread isn't woken up by the previous one's context.
+  waker.Reset();
+  auto other = Context::ApplicationContext.WithDeadline(Azure::DateTime::max());
+  {
+    _detail::CancellationWaker otherWaker(other);
+    EXPECT_EQ(poll(&poller, 1, 0), 0);
+  }
+}
+#endif
+
+TEST(Context, SharedTimer)
+{
+  auto const start = std::chrono::steady_clock::now();
+  Context context;
+  std::promise<bool> later;
+  std::promise<bool> sooner;
+  std::promise<bool> cancelled;
+  _detail::SharedTimer::Schedule(
+      start + std::chrono::milliseconds(100), context, [&](bool c) { later.set_value(c); });
+  _detail::SharedTimer::Schedule(
+      start + std::chrono::milliseconds(10), context, [&](bool c) { sooner.set_value(c); });
+  EXPECT_FALSE(sooner.get_future().get());
+  EXPECT_FALSE(later.get_future().get());
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+
+  // A cancelled context doesn't wait for the time.
+  auto child = context.WithDeadline(Azure::DateTime::max());
+  _detail::SharedTimer::Schedule(
+      start + std::chrono::hours(1), child, [&](bool c) { cancelled.set_value(c); });
+  child.Cancel();
+  EXPECT_TRUE(cancelled.get_future().get());
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(30));
 }
 
 TEST(Context, PreCondition)
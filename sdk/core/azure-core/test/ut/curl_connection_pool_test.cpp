@@ -10,9 +10,11 @@
 #include "azure/core/http/curl_transport.hpp"
 #endif
 
+#include <atomic>
 #include <iostream>
 #include <string>
 #include <thread>
+#include <vector>
 
 // The next includes are from Azure Core private headers.
 // They are included to test the connection pool from the libcurl transport adapter implementation.
@@ -34,11 +36,9 @@ namespace Azure { namespace Core { namespace Test {
     TEST(CurlConnectionPool, connectionPoolTest)
     {
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.ClearIndex();
         // Make sure there are nothing in the pool
-        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.size(), 0);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 0);
       }
 
       // Use the same request for all connections.
@@ -63,18 +63,9 @@ namespace Azure { namespace Core { namespace Test {
       }
       // Check that after the connection is gone, it is moved back to the pool
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 1);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            1);
-        auto connectionFromPool
-            = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.begin()
-                  ->second.begin()
-                  ->get();
-        EXPECT_EQ(connectionFromPool->GetConnectionKey(), expectedConnectionKey);
+            CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(expectedConnectionKey), 1);
       }
 
       // Test that asking a connection with same config will re-use the same connection
@@ -85,10 +76,7 @@ namespace Azure { namespace Core { namespace Test {
             = CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(req, options);
 
         // There was just one connection in the pool, it should be empty now
-        EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            0);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 0);
         // And the connection key for the connection we got is the expected
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
 
@@ -99,17 +87,10 @@ namespace Azure { namespace Core { namespace Test {
         session->m_sessionState = Azure::Core::Http::CurlSession::SessionState::STREAMING;
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Check that after the connection is gone, it is moved back to the pool
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 1);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            1);
-        auto values = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                          .ConnectionPoolIndex.begin();
-        EXPECT_EQ(values->second.size(), 1);
-        EXPECT_EQ(values->second.begin()->get()->GetConnectionKey(), expectedConnectionKey);
+            CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(expectedConnectionKey), 1);
       }
 
       // Now test that using a different connection config won't re-use the same connection
@@ -124,17 +105,9 @@ namespace Azure { namespace Core { namespace Test {
         EXPECT_EQ(connection->GetConnectionKey(), secondExpectedKey);
         // One connection still in the pool after getting a new connection and with first expected
         // key
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 1);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            1);
-        EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .begin()
-                ->second.begin()
-                ->get()
-                ->GetConnectionKey(),
-            expectedConnectionKey);
+            CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(expectedConnectionKey), 1);
 
         auto session = std::make_unique<Azure::Core::Http::CurlSession>(
             req, std::move(connection), options.HttpKeepAlive);
@@ -144,20 +117,11 @@ namespace Azure { namespace Core { namespace Test {
       }
 
       // Now there should be 2 index wit one connection each
-      EXPECT_EQ(
-          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-              .size(),
-          2);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 2);
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        auto values = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                          .ConnectionPoolIndex.begin();
-        EXPECT_EQ(values->second.size(), 1);
-        EXPECT_EQ(values->second.begin()->get()->GetConnectionKey(), secondExpectedKey);
-        values++;
-        EXPECT_EQ(values->second.size(), 1);
-        EXPECT_EQ(values->second.begin()->get()->GetConnectionKey(), expectedConnectionKey);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(secondExpectedKey), 1);
+        EXPECT_EQ(
+            CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(expectedConnectionKey), 1);
       }
 
       // Test re-using same custom config
@@ -169,17 +133,8 @@ namespace Azure { namespace Core { namespace Test {
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         // One connection still in the pool after getting a new connection and with first expected
         // key
-        EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            1);
-        EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .begin()
-                ->second.begin()
-                ->get()
-                ->GetConnectionKey(),
-            secondExpectedKey);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 1);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(secondExpectedKey), 1);
 
         auto session = std::make_unique<Azure::Core::Http::CurlSession>(
             req, std::move(connection), options.HttpKeepAlive);
@@ -188,38 +143,22 @@ namespace Azure { namespace Core { namespace Test {
         session->m_sessionState = Azure::Core::Http::CurlSession::SessionState::STREAMING;
       }
       // Now there should be 2 index wit one connection each
-      EXPECT_EQ(
-          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-              .size(),
-          2);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 2);
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        auto values = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                          .ConnectionPoolIndex.begin();
-        EXPECT_EQ(values->second.size(), 1);
-        EXPECT_EQ(values->second.begin()->get()->GetConnectionKey(), secondExpectedKey);
-        values++;
-        EXPECT_EQ(values->second.size(), 1);
-        EXPECT_EQ(values->second.begin()->get()->GetConnectionKey(), expectedConnectionKey);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(secondExpectedKey), 1);
+        EXPECT_EQ(
+            CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(expectedConnectionKey), 1);
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // clean the pool
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.ClearIndex();
       }
 
 #ifdef RUN_LONG_UNIT_TESTS
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // clean the pool
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
-        EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            0);
+        CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 0);
       }
 
       // Test pool clean routine.
@@ -245,17 +184,9 @@ namespace Azure { namespace Core { namespace Test {
       }
 
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 1);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            1);
-        EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                .ConnectionPoolIndex[expectedConnectionKey]
-                .size(),
-            5);
+            CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(expectedConnectionKey), 5);
       }
 
       // Wait for 60 secs (default time to expire a connection)
@@ -273,11 +204,7 @@ namespace Azure { namespace Core { namespace Test {
           std::this_thread::sleep_for(10ms);
           // If test wakes while clean pool is running, it will wait until lock is released by
           // the clean pool thread.
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-          poolIsEmpty = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                            .ConnectionPoolIndex.size()
-              == 0;
+          poolIsEmpty = CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount() == 0;
         }
         EXPECT_TRUE(poolIsEmpty);
       }
@@ -294,7 +221,7 @@ namespace Azure { namespace Core { namespace Test {
       //       std::lock_guard<std::mutex> lock(
       //           CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
       //       // clean the pool
-      //       CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+      //       CurlConnectionPool::g_curlConnectionPool.ClearIndex();
       //     }
 
       //     std::string hostKey("key");
@@ -369,7 +296,7 @@ namespace Azure { namespace Core { namespace Test {
       //       std::lock_guard<std::mutex> lock(
       //           CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
       //       // clean the pool
-      //       CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+      //       CurlConnectionPool::g_curlConnectionPool.ClearIndex();
       //     }
       //   }
     }
@@ -377,15 +304,9 @@ namespace Azure { namespace Core { namespace Test {
     TEST(CurlConnectionPool, uniquePort)
     {
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .clear();
+        CurlConnectionPool::g_curlConnectionPool.ClearIndex();
         // Make sure there is nothing in the pool
-        EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            0);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 0);
       }
 
       {
@@ -401,12 +322,7 @@ namespace Azure { namespace Core { namespace Test {
                               .ExtractOrCreateCurlConnection(req, {});
 
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-          EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
-              0);
+          EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 0);
           EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         }
         // move connection back to the pool
@@ -415,13 +331,8 @@ namespace Azure { namespace Core { namespace Test {
       }
 
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Test connection was moved to the pool
-        EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            1);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 1);
       }
 
       {
@@ -438,26 +349,16 @@ namespace Azure { namespace Core { namespace Test {
 
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           // Check connection in pool is not re-used because the port is different
-          EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
-              1);
+          EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 1);
         }
         // move connection back to the pool
         Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
             .MoveConnectionBackToPool(std::move(connection), Azure::Core::Http::HttpStatusCode::Ok);
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Check 2 connections in the pool
-        EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            2);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 2);
       }
 
       // Re-use connections
@@ -474,12 +375,7 @@ namespace Azure { namespace Core { namespace Test {
                               .ExtractOrCreateCurlConnection(req, {});
 
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-          EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
-              1);
+          EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 1);
         }
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         // move connection back to the pool
@@ -489,12 +385,7 @@ namespace Azure { namespace Core { namespace Test {
 
       {
         // Make sure there is nothing in the pool
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            2);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 2);
       }
       {
         // Request with port
@@ -510,28 +401,348 @@ namespace Azure { namespace Core { namespace Test {
 
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           // Check connection in pool is not re-used because the port is different
-          EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
-              1);
+          EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 1);
         }
         // move connection back to the pool
         Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
             .MoveConnectionBackToPool(std::move(connection), Azure::Core::Http::HttpStatusCode::Ok);
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
-            2);
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .clear();
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 2);
+        CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+      }
+    }
+
+    TEST(CurlConnectionPool, shardedPool)
+    {
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 0);
+
+      constexpr size_t threadsCount = 8;
+      constexpr size_t keysPerThread = 8;
+      std::vector<std::string> keys;
+      for (size_t index = 0; index < threadsCount * keysPerThread; index++)
+      {
+        keys.emplace_back("connection-key-" + std::to_string(index));
+      }
+
+      // Each thread moves some mock connections to the pool, with a different key each one. Keys
+      // are spread across the shards, so threads don't need to wait for each other.
+      std::vector<std::thread> threads;
+      for (size_t thread = 0; thread < threadsCount; thread++)
+      {
+        threads.emplace_back([&keys, thread]() {
+          for (size_t index = 0; index < keysPerThread; index++)
+          {
+            auto& key = keys[thread * keysPerThread + index];
+            auto connection = std::make_unique<MockCurlNetworkConnection>();
+            EXPECT_CALL(*connection, GetConnectionKey()).WillRepeatedly(::testing::ReturnRef(key));
+            EXPECT_CALL(*connection, UpdateLastUsageTime()).Times(1);
+            EXPECT_CALL(*connection, IsExpired()).WillRepeatedly(::testing::Return(false));
+            EXPECT_CALL(*connection, DestructObj()).Times(1);
+            CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
+                std::move(connection), Azure::Core::Http::HttpStatusCode::Ok);
+          }
+        });
+      }
+      for (auto& thread : threads)
+      {
+        thread.join();
+      }
+
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), keys.size());
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.PooledConnectionsCount, keys.size());
+      for (auto const& key : keys)
+      {
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(key), 1);
       }
+
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 0);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.PooledConnectionsCount, 0);
+    }
+
+    TEST(CurlConnectionPool, connectionPoolOptions)
+    {
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+      std::string const connectionKey("connection-pool-options-key");
+      auto const createConnection = [&connectionKey](
+                                        Azure::Core::Http::CurlTransportConnectionPoolOptions const&
+                                            options) {
+        auto connection = std::make_unique<MockCurlNetworkConnection>();
+        EXPECT_CALL(*connection, GetConnectionKey())
+            .WillRepeatedly(::testing::ReturnRef(connectionKey));
+        EXPECT_CALL(*connection, UpdateLastUsageTime()).WillRepeatedly(::testing::Return());
+        EXPECT_CALL(*connection, IsExpired()).WillRepeatedly(::testing::Return(false));
+        EXPECT_CALL(*connection, DestructObj()).Times(1);
+        connection->SetConnectionPoolOptions(options);
+        return connection;
+      };
+      auto const initialStatistics
+          = Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics().Keys[connectionKey];
+
+      // Only two idle connections are kept for the same key.
+      Azure::Core::Http::CurlTransportConnectionPoolOptions options;
+      options.MaxIdleConnectionsPerHost = 2;
+      for (int count = 0; count < 3; count++)
+      {
+        CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
+            createConnection(options), Azure::Core::Http::HttpStatusCode::Ok);
+      }
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(connectionKey), 2);
+
+      // No more connections are kept once the total limit is reached.
+      options.MaxIdleConnectionsPerHost = 10;
+      options.MaxIdleConnections = 2;
+      CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
+          createConnection(options), Azure::Core::Http::HttpStatusCode::Ok);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(connectionKey), 2);
+
+      // Connections with an error response are never kept.
+      CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
+          createConnection({}), Azure::Core::Http::HttpStatusCode::BadRequest);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(connectionKey), 2);
+
+      auto const statistics
+          = Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics().Keys[connectionKey];
+      EXPECT_EQ(statistics.Evictions - initialStatistics.Evictions, 2);
+      EXPECT_EQ(statistics.IdleConnections, 2);
+      EXPECT_EQ(statistics.ActiveConnections, 0);
+
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+      EXPECT_EQ(
+          Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics()
+              .Keys[connectionKey]
+              .IdleConnections,
+          0);
+    }
+
+    TEST(CurlConnectionPool, idleConnectionTimeout)
+    {
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.ConnectionPoolOptions.IdleConnectionTimeout = 0ms;
+      EXPECT_THROW(Azure::Core::Http::CurlTransport{transportOptions}, std::invalid_argument);
+
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+      auto& pool = CurlConnectionPool::g_curlConnectionPool;
+      std::string const connectionKey("idle-connection-timeout-key");
+      Azure::Core::Http::CurlTransportConnectionPoolOptions options;
+      options.IdleConnectionTimeout = 50ms;
+      auto connection = std::make_unique<MockCurlNetworkConnection>();
+      EXPECT_CALL(*connection, GetConnectionKey())
+          .WillRepeatedly(::testing::ReturnRef(connectionKey));
+      EXPECT_CALL(*connection, UpdateLastUsageTime()).WillRepeatedly(::testing::Return());
+      EXPECT_CALL(*connection, IsExpired()).WillRepeatedly(::testing::Return(true));
+      EXPECT_CALL(*connection, DestructObj()).Times(1);
+      connection->SetConnectionPoolOptions(options);
+      auto const initialEvictions
+          = Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics().Total.Evictions;
+      pool.MoveConnectionBackToPool(std::move(connection), Azure::Core::Http::HttpStatusCode::Ok);
+      EXPECT_LE(pool.CleanerIntervalMilliseconds.load(), 50);
+
+      // The connection is closed once expired, even if the clean thread was waiting for longer.
+      auto const timeout = std::chrono::steady_clock::now() + 10s;
+      while (pool.ConnectionsOnPool(connectionKey) != 0
+             && std::chrono::steady_clock::now() < timeout)
+      {
+        std::this_thread::sleep_for(10ms);
+      }
+      EXPECT_EQ(pool.ConnectionsOnPool(connectionKey), 0);
+
+      // The counters of the key are kept in the total only, and the interval grows back.
+      while (pool.CleanerIntervalMilliseconds.load() != DefaultCleanerIntervalMilliseconds
+             && std::chrono::steady_clock::now() < timeout)
+      {
+        std::this_thread::sleep_for(10ms);
+      }
+      EXPECT_EQ(pool.CleanerIntervalMilliseconds.load(), DefaultCleanerIntervalMilliseconds);
+      auto const statistics = Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics();
+      EXPECT_EQ(statistics.Keys.count(connectionKey), 0U);
+      EXPECT_EQ(statistics.Total.Evictions - initialEvictions, 1U);
+    }
+
+    TEST(CurlConnectionPool, connectionAdmission)
+    {
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+      auto& pool = CurlConnectionPool::g_curlConnectionPool;
+      std::string const connectionKey("connection-admission-key");
+      Azure::Core::Http::CurlTransportConnectionPoolOptions options;
+      options.MaxConnectionsPerHost = 1;
+      options.MaxConnections = 2;
+
+      // The first connection for the key is admitted without waiting.
+      EXPECT_EQ(
+          pool.AdmitConnection(connectionKey, options, Azure::Core::Context::ApplicationContext),
+          std::chrono::steady_clock::duration::zero());
+
+      // The next one waits until the first connection is moved back to the pool.
+      std::chrono::steady_clock::duration waited{};
+      std::thread waiting([&]() {
+        waited = pool.AdmitConnection(
+            connectionKey, options, Azure::Core::Context::ApplicationContext);
+      });
+      std::this_thread::sleep_for(50ms);
+
+      // A request waiting behind it gives up when its context is cancelled.
+      Azure::Core::Context cancelled;
+      cancelled.Cancel();
+      EXPECT_THROW(
+          pool.AdmitConnection(connectionKey, options, cancelled),
+          Azure::Core::OperationCancelledException);
+
+      // Requests to other keys aren't held back by the key at its limit.
+      EXPECT_EQ(
+          pool.AdmitConnection("other-key", options, Azure::Core::Context::ApplicationContext),
+          std::chrono::steady_clock::duration::zero());
+
+      auto connection = std::make_unique<MockCurlNetworkConnection>();
+      EXPECT_CALL(*connection, GetConnectionKey())
+          .WillRepeatedly(::testing::ReturnRef(connectionKey));
+      EXPECT_CALL(*connection, UpdateLastUsageTime()).WillRepeatedly(::testing::Return());
+      EXPECT_CALL(*connection, IsExpired()).WillRepeatedly(::testing::Return(false));
+      EXPECT_CALL(*connection, DestructObj()).Times(1);
+      connection->SetAdmitted(true);
+      pool.MoveConnectionBackToPool(std::move(connection), Azure::Core::Http::HttpStatusCode::Ok);
+      waiting.join();
+      EXPECT_GT(waited, std::chrono::steady_clock::duration::zero());
+      EXPECT_EQ(pool.ConnectionsOnPool(connectionKey), 1);
+
+      pool.ReleaseAdmission(connectionKey);
+      pool.ReleaseAdmission("other-key");
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+    }
+
+    TEST(CurlConnectionPool, connectionAdmissionPriority)
+    {
+      auto& pool = CurlConnectionPool::g_curlConnectionPool;
+      std::string const connectionKey("connection-admission-priority-key");
+      Azure::Core::Http::CurlTransportConnectionPoolOptions options;
+      options.MaxConnectionsPerHost = 2;
+      options.HighPriorityReservedConnections = 1;
+      auto const normalContext = Azure::Core::Context::ApplicationContext;
+      auto const highContext = Azure::Core::Http::WithRequestPriority(
+          normalContext, Azure::Core::Http::RequestPriority::High);
+
+      // The connection left to the normal priority is taken, the reserved one isn't.
+      EXPECT_EQ(
+          pool.AdmitConnection(connectionKey, options, normalContext),
+          std::chrono::steady_clock::duration::zero());
+      std::atomic<bool> normalAdmitted{false};
+      std::thread normalWaiting([&]() {
+        pool.AdmitConnection(connectionKey, options, normalContext);
+        normalAdmitted = true;
+      });
+      std::this_thread::sleep_for(50ms);
+
+      // A high priority request goes before the normal one waiting, to the reserved connection.
+      EXPECT_EQ(
+          pool.AdmitConnection(connectionKey, options, highContext),
+          std::chrono::steady_clock::duration::zero());
+
+      // Another one waits, but is admitted first once a connection is released.
+      std::atomic<bool> highAdmitted{false};
+      std::thread highWaiting([&]() {
+        pool.AdmitConnection(connectionKey, options, highContext);
+        highAdmitted = true;
+      });
+      std::this_thread::sleep_for(50ms);
+      pool.ReleaseAdmission(connectionKey);
+      highWaiting.join();
+      EXPECT_TRUE(highAdmitted);
+
+      // The normal request waits until the reserved connection is free too.
+      pool.ReleaseAdmission(connectionKey);
+      std::this_thread::sleep_for(50ms);
+      EXPECT_FALSE(normalAdmitted);
+      pool.ReleaseAdmission(connectionKey);
+      normalWaiting.join();
+      EXPECT_TRUE(normalAdmitted);
+
+      pool.ReleaseAdmission(connectionKey);
+    }
+
+    TEST(CurlConnectionPool, lockWaits)
+    {
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+      auto& pool = CurlConnectionPool::g_curlConnectionPool;
+      std::string const connectionKey("lock-waits-key");
+      auto const initialStatistics
+          = Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics().Keys[connectionKey];
+
+      // Moving a connection back to the pool waits while another thread uses its shard.
+      auto& shard = pool.GetShard(connectionKey);
+      std::unique_lock<std::mutex> shardLock(shard.ConnectionPoolMutex);
+      std::thread moving([&]() {
+        auto connection = std::make_unique<MockCurlNetworkConnection>();
+        EXPECT_CALL(*connection, GetConnectionKey())
+            .WillRepeatedly(::testing::ReturnRef(connectionKey));
+        EXPECT_CALL(*connection, UpdateLastUsageTime()).WillRepeatedly(::testing::Return());
+        EXPECT_CALL(*connection, IsExpired()).WillRepeatedly(::testing::Return(false));
+        EXPECT_CALL(*connection, DestructObj()).Times(1);
+        pool.MoveConnectionBackToPool(std::move(connection), Azure::Core::Http::HttpStatusCode::Ok);
+      });
+      std::this_thread::sleep_for(50ms);
+      shardLock.unlock();
+      moving.join();
+
+      auto const statistics
+          = Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics().Keys[connectionKey];
+      EXPECT_EQ(statistics.LockWaits - initialStatistics.LockWaits, 1);
+      // The thread may start waiting a little after the lock was taken.
+      EXPECT_GE(statistics.LockWaitTime - initialStatistics.LockWaitTime, 25ms);
+      EXPECT_EQ(statistics.IdleConnections, 1);
+      EXPECT_GE(
+          Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics().Total.LockWaits,
+          statistics.LockWaits);
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+    }
+
+    TEST(CurlConnectionPool, prewarm)
+    {
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+      Azure::Core::Http::CurlTransport transport;
+
+      transport.Prewarm(Azure::Core::Url(AzureSdkHttpbinServer::Get()), 2);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 1);
+
+      // Prewarming again won't open more connections when there are enough in the pool.
+      transport.Prewarm(Azure::Core::Url(AzureSdkHttpbinServer::Get()), 1);
+      auto const statistics = Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics();
+      EXPECT_EQ(statistics.Total.IdleConnections, 2);
+
+      // The first request re-uses a prewarmed connection.
+      Azure::Core::Http::Request req(
+          Azure::Core::Http::HttpMethod::Get, Azure::Core::Url(AzureSdkHttpbinServer::Get()));
+      auto connection
+          = CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(req, {});
+      EXPECT_EQ(
+          Azure::Core::Http::CurlTransport::GetConnectionPoolStatistics().Total.Hits,
+          statistics.Total.Hits + 1);
+
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+    }
+
+    TEST(CurlConnectionPool, prewarmFailure)
+    {
+      CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+      Azure::Core::Http::CurlTransport transport;
+
+      // Nothing to open.
+      EXPECT_NO_THROW(transport.Prewarm(Azure::Core::Url("http://localhost:1"), 0));
+
+      // Nothing listens on the port, so the connections can't be opened.
+      EXPECT_THROW(
+          transport.Prewarm(Azure::Core::Url("http://localhost:1"), 2),
+          Azure::Core::Http::TransportException);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndexCount(), 0);
+
+      // Connections are not opened once the context is cancelled.
+      Azure::Core::Context cancelled;
+      cancelled.Cancel();
+      EXPECT_THROW(
+          transport.Prewarm(Azure::Core::Url("http://localhost:1"), 2, cancelled),
+          Azure::Core::OperationCancelledException);
     }
 
     TEST(CurlConnectionPool, resiliencyOnConnectionClosed)
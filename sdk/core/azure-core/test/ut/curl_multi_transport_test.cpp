@@ -0,0 +1,150 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include <azure/core/context.hpp>
+#include <azure/core/http/curl_multi_transport.hpp>
+#include <azure/core/http/http.hpp>
+
+#include "transport_adapter_base_test.hpp"
+
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Test {
+
+  TEST(CurlMultiTransport, multiplexedRequests)
+  {
+    Azure::Core::Http::CurlMultiTransportOptions options;
+    options.MaxConnectionsPerHost = 1;
+    Azure::Core::Http::CurlMultiTransport transport(options);
+
+    // All the requests share one connection as HTTP/2 streams.
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 10; i++)
+    {
+      threads.emplace_back([&transport]() {
+        Azure::Core::Http::Request request(
+            Azure::Core::Http::HttpMethod::Get, Azure::Core::Url(AzureSdkHttpbinServer::Get()));
+        EXPECT_NO_THROW({
+          auto response = transport.Send(request, Azure::Core::Context::ApplicationContext);
+          EXPECT_EQ(response->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+          auto body = response->ExtractBodyStream()->ReadToEnd();
+          EXPECT_NE(body.size(), 0);
+        });
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  TEST(CurlMultiTransport, http1)
+  {
+    Azure::Core::Http::CurlMultiTransportOptions options;
+    options.EnableHttp2 = false;
+    Azure::Core::Http::CurlMultiTransport transport(options);
+
+    Azure::Core::Http::Request request(
+        Azure::Core::Http::HttpMethod::Get, Azure::Core::Url(AzureSdkHttpbinServer::Get()));
+    auto response = transport.Send(request, Azure::Core::Context::ApplicationContext);
+    EXPECT_EQ(response->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+  }
+
+  TEST(CurlMultiTransport, connectionFailure)
+  {
+    Azure::Core::Http::CurlMultiTransport transport;
+
+    // Nothing listens on the port.
+    Azure::Core::Http::Request request(
+        Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("http://localhost:1/get"));
+    EXPECT_THROW(
+        transport.Send(request, Azure::Core::Context::ApplicationContext),
+        Azure::Core::Http::TransportException);
+
+    // The transport can still be used after a failed transfer.
+    std::vector<uint8_t> buffer(1024, 'x');
+    Azure::Core::IO::MemoryBodyStream stream(buffer);
+    Azure::Core::Http::Request putRequest(
+        Azure::Core::Http::HttpMethod::Put, Azure::Core::Url("http://localhost:1/put"), &stream);
+    EXPECT_THROW(
+        transport.Send(putRequest, Azure::Core::Context::ApplicationContext),
+        Azure::Core::Http::TransportException);
+  }
+
+  TEST(CurlMultiTransport, concurrentFailures)
+  {
+    Azure::Core::Http::CurlMultiTransport transport;
+
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 16; i++)
+    {
+      threads.emplace_back([&transport]() {
+        Azure::Core::Http::Request request(
+            Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("http://localhost:1/get"));
+        EXPECT_THROW(
+            transport.Send(request, Azure::Core::Context::ApplicationContext),
+            Azure::Core::Http::TransportException);
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  TEST(CurlMultiTransport, cancelledContext)
+  {
+    Azure::Core::Http::CurlMultiTransport transport;
+    Azure::Core::Context cancelled;
+    cancelled.Cancel();
+
+    Azure::Core::Http::Request request(
+        Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("http://localhost:1/get"));
+    EXPECT_THROW(transport.Send(request, cancelled), Azure::Core::OperationCancelledException);
+  }
+
+  TEST(CurlMultiTransport, sendAsyncFailure)
+  {
+    Azure::Core::Http::CurlMultiTransport transport;
+
+    // The callback is called from the background thread with the error.
+    Azure::Core::Http::Request request(
+        Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("http://localhost:1/get"));
+    std::promise<std::exception_ptr> result;
+    transport.SendAsync(
+        request,
+        Azure::Core::Context::ApplicationContext,
+        [&result](
+            std::unique_ptr<Azure::Core::Http::RawResponse> response, std::exception_ptr error) {
+          EXPECT_EQ(response, nullptr);
+          result.set_value(error);
+        });
+
+    auto error = result.get_future().get();
+    ASSERT_TRUE(error);
+    EXPECT_THROW(std::rethrow_exception(error), Azure::Core::Http::TransportException);
+  }
+
+  TEST(CurlMultiTransport, sendAsyncReleasesTransport)
+  {
+    // The callback releases the last reference to the transport from the background thread.
+    auto transport = std::make_shared<Azure::Core::Http::CurlMultiTransport>();
+    Azure::Core::Http::Request request(
+        Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("http://localhost:1/get"));
+    std::promise<void> done;
+    transport->SendAsync(
+        request,
+        Azure::Core::Context::ApplicationContext,
+        [&done](std::unique_ptr<Azure::Core::Http::RawResponse>, std::exception_ptr) {
+          done.set_value();
+        });
+    transport.reset();
+    done.get_future().get();
+  }
+
+}}} // namespace Azure::Core::Test
@@ -19,9 +19,17 @@
 
 #include "transport_adapter_base_test.hpp"
 
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
+#if !defined(AZ_PLATFORM_WINDOWS)
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
 namespace Azure { namespace Core { namespace Test {
 
   // proxy server can take some minutes to handle the request. Only testing HTTP proxy
@@ -89,7 +97,7 @@ namespace Azure { namespace Core { namespace Test {
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
     EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+                        .ClearIndex());
   }
 
   /*
@@ -207,7 +215,7 @@ namespace Azure { namespace Core { namespace Test {
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
     EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+                        .ClearIndex());
   }
 
   TEST(CurlTransportOptions, httpsDefault)
@@ -239,7 +247,7 @@ namespace Azure { namespace Core { namespace Test {
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
     EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+                        .ClearIndex());
   }
 
   TEST(CurlTransportOptions, disableKeepAlive)
@@ -275,9 +283,153 @@ namespace Azure { namespace Core { namespace Test {
     }
     // Make sure there are no connections in the pool
     EXPECT_EQ(
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .size(),
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
+            .ConnectionPoolIndexCount(),
         0);
   }
 
+  TEST(CurlTransportOptions, captureRequestTimings)
+  {
+    Azure::Core::Http::CurlTransportOptions curlOptions;
+    curlOptions.CaptureRequestTimings = true;
+
+    auto transportAdapter = std::make_shared<Azure::Core::Http::CurlTransport>(curlOptions);
+    Azure::Core::Http::Policies::TransportOptions options;
+    options.Transport = transportAdapter;
+    auto transportPolicy
+        = std::make_unique<Azure::Core::Http::Policies::_internal::TransportPolicy>(options);
+
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+    policies.emplace_back(std::move(transportPolicy));
+    Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
+                        .ClearIndex());
+    Azure::Core::Url url(AzureSdkHttpbinServer::Get());
+    for (auto reused : {false, true})
+    {
+      Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+      auto response = pipeline.Send(request, Azure::Core::Context::ApplicationContext);
+      EXPECT_EQ(response->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+
+      ASSERT_TRUE(response->GetRequestTimings().HasValue());
+      auto const& timings = response->GetRequestTimings().Value();
+      EXPECT_EQ(timings.ConnectionReused, reused);
+      EXPECT_EQ(timings.Connect.count() > 0, !reused);
+      EXPECT_GT(timings.TimeToFirstByte.count(), 0);
+      EXPECT_GT(timings.ResponseTransfer.count(), 0);
+    }
+
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
+                        .ClearIndex());
+  }
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+  namespace {
+    // Answers `200 OK` to one request per connection, on a port of the loopback address.
+    class LocalHttpServer final {
+    public:
+      LocalHttpServer()
+      {
+        m_listener = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t addressLength = sizeof(address);
+        if (m_listener < 0 || bind(m_listener, reinterpret_cast<sockaddr*>(&address), addressLength)
+            || listen(m_listener, 1)
+            || getsockname(m_listener, reinterpret_cast<sockaddr*>(&address), &addressLength))
+        {
+          throw std::runtime_error("Failed to listen on the loopback address.");
+        }
+        Port = std::to_string(ntohs(address.sin_port));
+        m_server = std::thread([this]() { Serve(); });
+      }
+
+      ~LocalHttpServer()
+      {
+        // Unblocks the server if it wasn't connected to.
+        shutdown(m_listener, SHUT_RDWR);
+        m_server.join();
+        close(m_listener);
+      }
+
+      std::string Port;
+
+    private:
+      int m_listener;
+      std::thread m_server;
+
+      void Serve()
+      {
+        for (int connection; (connection = accept(m_listener, nullptr, nullptr)) >= 0;)
+        {
+          char buffer[1024];
+          std::string request;
+          while (request.find("\r\n\r\n") == std::string::npos)
+          {
+            auto const readBytes = recv(connection, buffer, sizeof(buffer), 0);
+            if (readBytes <= 0)
+            {
+              break;
+            }
+            request.append(buffer, static_cast<size_t>(readBytes));
+          }
+          if (!request.empty())
+          {
+            std::string const response
+                = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+            send(connection, response.data(), response.size(), 0);
+          }
+          close(connection);
+        }
+      }
+    };
+  } // namespace
+
+  TEST(CurlTransportOptions, resolveOverrides)
+  {
+    // A local server, reached through a host name which can't be resolved.
+    LocalHttpServer server;
+    Azure::Core::Http::CurlTransportOptions curlOptions;
+    curlOptions.DnsOptions.ResolveOverrides.emplace_back(
+        "azure-sdk-test.invalid:" + server.Port + ":127.0.0.1");
+    Azure::Core::Http::CurlTransport transport(curlOptions);
+
+    Azure::Core::Http::Request request(
+        Azure::Core::Http::HttpMethod::Get,
+        Azure::Core::Url("http://azure-sdk-test.invalid:" + server.Port + "/"));
+    auto response = transport.Send(request, Azure::Core::Context::ApplicationContext);
+    EXPECT_EQ(response->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+  }
+
+  TEST(CurlTransportOptions, socketOptions)
+  {
+    LocalHttpServer server;
+    Azure::Core::Http::CurlTransportOptions curlOptions;
+    curlOptions.SocketOptions.ReceiveBufferSize = 1024 * 1024;
+    curlOptions.SocketOptions.SendBufferSize = 1024 * 1024;
+    curlOptions.SocketOptions.TcpKeepAlive = true;
+    // An algorithm which isn't available is logged, and doesn't fail the connection.
+    curlOptions.SocketOptions.CongestionControl = "azure-sdk-test";
+
+    Azure::Core::Http::Request request(
+        Azure::Core::Http::HttpMethod::Get,
+        Azure::Core::Url("http://127.0.0.1:" + server.Port + "/"));
+    auto connection = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
+                          .ExtractOrCreateCurlConnection(request, curlOptions);
+    // The connections with other socket options aren't reused.
+    EXPECT_NE(
+        connection->GetConnectionKey(),
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
+            .ExtractOrCreateCurlConnection(request, Azure::Core::Http::CurlTransportOptions())
+            ->GetConnectionKey());
+    connection.reset();
+
+    Azure::Core::Http::CurlTransport transport(curlOptions);
+    auto response = transport.Send(request, Azure::Core::Context::ApplicationContext);
+    EXPECT_EQ(response->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+  }
+#endif
+
 }}} // namespace Azure::Core::Test
@@ -21,6 +21,7 @@
 #include <azure/core/http/curl_transport.hpp>
 #include <curl/curl.h>
 #include <gmock/gmock.h>
+#include <chrono>
 #include <gtest/gtest.h>
 #include <string>
 
@@ -45,6 +46,11 @@ namespace Azure { namespace Core { namespace Test {
         ReadFromSocket,
         (uint8_t * buffer, size_t bufferSize, Context const& context),
         (override));
+    MOCK_METHOD(
+        bool,
+        WaitUntilReadable,
+        (std::chrono::milliseconds timeout, Context const& context),
+        (override));
     MOCK_METHOD(
         CURLcode,
         SendBuffer,
@@ -11,6 +11,7 @@
 
 using ::testing::_;
 using ::testing::DoAll;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::ReturnRef;
 using ::testing::SetArrayArgument;
@@ -22,6 +23,7 @@ namespace Azure { namespace Core { namespace Test {
     std::string response(
         "HTTP/1.1 200 Ok\r\nContent-Type: text/html; charset=UTF-8\r\n\r\n{\r\n\"somejson\":45\r}");
     int32_t const payloadSize = static_cast<int32_t>(response.size());
+    std::string connectionKey("connection-key");
 
     // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
     // unique ptr for it
@@ -31,6 +33,8 @@ namespace Azure { namespace Core { namespace Test {
         .WillOnce(DoAll(
             SetArrayArgument<0>(response.data(), response.data() + payloadSize),
             Return(payloadSize)));
+    // The connection is not re-used, the session gives it back to the pool to be discarded
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
 
     // Create the unique ptr to take care about memory free at the end
     std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
@@ -81,8 +85,7 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_NO_THROW(session->Perform(Azure::Core::Context::ApplicationContext));
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
   }
 
   TEST_F(CurlSession, chunkBadFormatResponse)
@@ -132,8 +135,7 @@ namespace Azure { namespace Core { namespace Test {
           Azure::Core::Http::TransportException);
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
   }
 
   TEST_F(CurlSession, chunkSegmentedResponse)
@@ -217,19 +219,449 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_NO_THROW(bodyS->ReadToEnd(Azure::Core::Context::ApplicationContext));
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+  }
+
+  TEST_F(CurlSession, linesSplitBetweenReads)
+  {
+    // The wire returns one of these on every read
+    std::vector<std::string> reads{
+        "HTTP/1.1 200 Ok\r\nX-Ms-Meta: a\nb\r",
+        "\nTransfer-Encoding: chunked\r\n\r\n1",
+        "A;name=value\r",
+        "\n0123456789abcdefghijklmnop\r\n0\r\n\r\n"};
+    size_t readIndex = 0;
+    std::string connectionKey("connection-key");
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .Times(static_cast<int>(reads.size()))
+        .WillRepeatedly(Invoke([&](uint8_t* buffer, size_t, Context const&) {
+          auto const& read = reads[readIndex++];
+          std::copy(read.begin(), read.end(), buffer);
+          return read.size();
+        }));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), true);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context::ApplicationContext));
+      auto response = session->ExtractResponse();
+      // A \n alone doesn't end a line
+      EXPECT_EQ(response->GetHeaders().at("x-ms-meta"), "a\nb");
+      EXPECT_EQ(response->GetHeaders().at("transfer-encoding"), "chunked");
+      response->SetBodyStream(std::move(session));
+      auto bodyS = response->ExtractBodyStream();
+
+      auto const body = bodyS->ReadToEnd(Azure::Core::Context::ApplicationContext);
+      EXPECT_EQ(std::string(body.begin(), body.end()), "0123456789abcdefghijklmnop");
+    }
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+  }
+
+  TEST_F(CurlSession, smallReadsFromInnerBuffer)
+  {
+    std::string response("HTTP/1.1 200 Ok\r\ncontent-length: 10\r\n\r\n");
+    std::string response2("0123456789");
+    std::string connectionKey("connection-key");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    int32_t const payloadSize2 = static_cast<int32_t>(response2.size());
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    // The body is read from the socket once, without reading beyond the content-length
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, 10, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response2.data(), response2.data() + payloadSize2),
+            Return(payloadSize2)))
+        .RetiresOnSaturation();
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), true);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context::ApplicationContext));
+      auto r = session->ExtractResponse();
+      r->SetBodyStream(std::move(session));
+      auto bodyS = r->ExtractBodyStream();
+
+      // Read the body one byte at a time
+      std::string body;
+      uint8_t data = 0;
+      while (bodyS->Read(&data, 1, Azure::Core::Context::ApplicationContext) == 1)
+      {
+        body.append(1, static_cast<char>(data));
+      }
+      EXPECT_EQ(body, response2);
+    }
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+  }
+
+  TEST_F(CurlSession, readRestOfBodyToCallerBuffer)
+  {
+    std::string response("HTTP/1.1 200 Ok\r\ncontent-length: 10\r\n\r\n01");
+    std::string response2("23456789");
+    std::string connectionKey("connection-key");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    int32_t const payloadSize2 = static_cast<int32_t>(response2.size());
+    std::vector<uint8_t> body(10);
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    // The rest of the body is read from the socket right after the part read with the headers
+    EXPECT_CALL(*curlMock, ReadFromSocket(body.data() + 2, 8, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response2.data(), response2.data() + payloadSize2),
+            Return(payloadSize2)))
+        .RetiresOnSaturation();
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), true);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context::ApplicationContext));
+      auto r = session->ExtractResponse();
+      r->SetBodyStream(std::move(session));
+      auto bodyS = r->ExtractBodyStream();
+
+      EXPECT_EQ(
+          bodyS->ReadToCount(body.data(), body.size(), Azure::Core::Context::ApplicationContext),
+          body.size());
+      EXPECT_EQ(std::string(body.begin(), body.end()), "0123456789");
+    }
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+  }
+
+  TEST_F(CurlSession, readSpanFromInnerBuffer)
+  {
+    std::string response("HTTP/1.1 200 Ok\r\ncontent-length: 10\r\n\r\n0123");
+    std::string response2("456789");
+    std::string connectionKey("connection-key");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    int32_t const payloadSize2 = static_cast<int32_t>(response2.size());
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, 6, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response2.data(), response2.data() + payloadSize2),
+            Return(payloadSize2)))
+        .RetiresOnSaturation();
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), true);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context::ApplicationContext));
+      auto r = session->ExtractResponse();
+      r->SetBodyStream(std::move(session));
+      auto bodyS = r->ExtractBodyStream();
+
+      // The body bytes read with the headers are lent from the inner buffer, the rest is read
+      // into the scratch buffer.
+      std::vector<uint8_t> scratch;
+      uint8_t const* span = nullptr;
+      EXPECT_EQ(bodyS->ReadSpan(span, 100, scratch, Azure::Core::Context::ApplicationContext), 4);
+      EXPECT_EQ(std::string(span, span + 4), "0123");
+      EXPECT_TRUE(scratch.empty());
+      EXPECT_EQ(bodyS->ReadSpan(span, 100, scratch, Azure::Core::Context::ApplicationContext), 6);
+      EXPECT_EQ(span, scratch.data());
+      EXPECT_EQ(std::string(span, span + 6), response2);
+      EXPECT_EQ(bodyS->ReadSpan(span, 100, scratch, Azure::Core::Context::ApplicationContext), 0);
+    }
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+  }
+
+  TEST_F(CurlSession, uploadMemoryBodyWithoutCopy)
+  {
+    std::string response("HTTP/1.1 201 Created\r\ncontent-length: 0\r\n\r\n");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    std::string connectionKey("connection-key");
+    std::vector<uint8_t> body(1024 * 1024, 'x');
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    // The headers are sent first, then the body is sent from the stream's buffer in one call
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    EXPECT_CALL(*curlMock, SendBuffer(body.data(), body.size(), _))
+        .WillOnce(Return(CURLE_OK))
+        .RetiresOnSaturation();
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::IO::MemoryBodyStream bodyStream(body);
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Post, url, &bodyStream);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), true);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context::ApplicationContext));
+      EXPECT_EQ(
+          session->ExtractResponse()->GetStatusCode(),
+          Azure::Core::Http::HttpStatusCode::Created);
+    }
+    // The stream was sent to the end
+    uint8_t data = 0;
+    EXPECT_EQ(bodyStream.Read(&data, 1), 0);
+
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+  }
+
+  TEST_F(CurlSession, smallBodySentWithHeaders)
+  {
+    std::string response("HTTP/1.1 201 Created\r\ncontent-length: 0\r\n\r\n");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    std::string connectionKey("connection-key");
+    std::string const body("{\"message\":\"hello\"}");
+    std::string sent;
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    // The headers and the body are sent in one write, without waiting for 100-continue
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _))
+        .WillOnce(DoAll(
+            Invoke([&sent](uint8_t const* buffer, size_t bufferSize, Azure::Core::Context const&) {
+              sent.assign(reinterpret_cast<char const*>(buffer), bufferSize);
+            }),
+            Return(CURLE_OK)));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::IO::MemoryBodyStream bodyStream(
+        reinterpret_cast<uint8_t const*>(body.data()), body.size());
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url, &bodyStream);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), true);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context::ApplicationContext));
+      EXPECT_EQ(
+          session->ExtractResponse()->GetStatusCode(),
+          Azure::Core::Http::HttpStatusCode::Created);
+    }
+    EXPECT_EQ(sent.find("PUT / HTTP/1.1\r\n"), 0);
+    EXPECT_EQ(sent.find("expect"), std::string::npos);
+    EXPECT_EQ(sent.substr(sent.size() - body.size()), body);
+
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+  }
+
+  TEST_F(CurlSession, expectContinueRejectedBeforeUpload)
+  {
+    std::string response("HTTP/1.1 412 Precondition Failed\r\ncontent-length: 0\r\n\r\n");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    std::string connectionKey("connection-key");
+    std::vector<uint8_t> body(1024 * 64, 'x');
+    std::string sent;
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    // Only the headers are sent, the server rejects the request before the body is uploaded
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _))
+        .WillOnce(DoAll(
+            Invoke([&sent](uint8_t const* buffer, size_t bufferSize, Azure::Core::Context const&) {
+              sent.assign(reinterpret_cast<char const*>(buffer), bufferSize);
+            }),
+            Return(CURLE_OK)));
+    EXPECT_CALL(*curlMock, WaitUntilReadable(std::chrono::milliseconds(100), _))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::IO::MemoryBodyStream bodyStream(body);
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Post, url, &bodyStream);
+
+    {
+      // POST requests only wait for the server with a threshold
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request,
+          std::move(uniqueCurlMock),
+          true,
+          Azure::Core::Http::_detail::DefaultMaxCoalescedRequestBodySize,
+          1024 * 32,
+          std::chrono::milliseconds(100));
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context::ApplicationContext));
+      EXPECT_EQ(
+          session->ExtractResponse()->GetStatusCode(),
+          Azure::Core::Http::HttpStatusCode::PreconditionFailed);
+    }
+    EXPECT_NE(sent.find("expect: 100-continue\r\n"), std::string::npos);
+    // Nothing was read from the body
+    EXPECT_EQ(bodyStream.Length(), static_cast<int64_t>(body.size()));
+    uint8_t data = 0;
+    EXPECT_EQ(bodyStream.Read(&data, 1), 1);
+
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+  }
+
+  TEST_F(CurlSession, expectContinueTimeoutUploadsBody)
+  {
+    // The server only accepts the request after the client started sending the body.
+    std::string response("HTTP/1.1 100 Continue\r\n\r\nHTTP/1.1 201 Created\r\n"
+                         "content-length: 0\r\n\r\n");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    std::string connectionKey("connection-key");
+    std::vector<uint8_t> body(1024 * 64, 'x');
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    EXPECT_CALL(*curlMock, SendBuffer(body.data(), body.size(), _))
+        .WillOnce(Return(CURLE_OK))
+        .RetiresOnSaturation();
+    EXPECT_CALL(*curlMock, WaitUntilReadable(_, _)).WillOnce(Return(false));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::IO::MemoryBodyStream bodyStream(body);
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url, &bodyStream);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), true);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context::ApplicationContext));
+      EXPECT_EQ(
+          session->ExtractResponse()->GetStatusCode(),
+          Azure::Core::Http::HttpStatusCode::Created);
+    }
+
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
   }
 
   TEST_F(CurlSession, DoNotReuseConnectionIfDownloadFail)
   {
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+    std::string connectionKey("connection-key");
     // Can't mock the curlMock directly from a unique ptr, heap allocate it first and then make a
     // unique ptr for it
     MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
     // mock an upload error
     EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_SEND_ERROR));
+    // The connection is not re-used, the session gives it back to the pool to be discarded
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
     EXPECT_CALL(*curlMock, DestructObj());
 
     // Create the unique ptr to take care about memory free at the end
@@ -249,8 +681,63 @@ namespace Azure { namespace Core { namespace Test {
     }
     // Check connection pool is empty (connection was not moved to the pool)
     EXPECT_EQ(
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .size(),
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
+            .ConnectionPoolIndexCount(),
         0);
   }
+
+  TEST_F(CurlSession, headerBlockSentAsSerialized)
+  {
+    std::string response("HTTP/1.1 200 Ok\r\ncontent-length: 0\r\n\r\n");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    std::string connectionKey("connection-key");
+    std::string sent;
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _))
+        .WillOnce(DoAll(
+            Invoke([&sent](uint8_t const* buffer, size_t bufferSize, Azure::Core::Context const&) {
+              sent.assign(reinterpret_cast<char const*>(buffer), bufferSize);
+            }),
+            Return(CURLE_OK)));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request with a header block and a header set one by one
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+    request.AddHeaderBlock(std::make_shared<const Azure::Core::Http::_internal::HttpHeaderBlock>(
+        std::vector<std::pair<std::string, std::string>>{
+            {"x-ms-version", "2024-01-01"}, {"User-Agent", "ua"}}));
+    request.SetHeader("x-ms-client-request-id", "id");
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), true);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context::ApplicationContext));
+    }
+    // The block is written as serialized, and its headers aren't written again from the map
+    auto const block = std::string("user-agent: ua\r\nx-ms-version: 2024-01-01\r\n");
+    auto const blockPosition = sent.find(block);
+    EXPECT_NE(blockPosition, std::string::npos);
+    EXPECT_EQ(sent.find("user-agent", blockPosition + 1), std::string::npos);
+    EXPECT_EQ(sent.find("x-ms-version", blockPosition + block.size()), std::string::npos);
+    EXPECT_NE(sent.find("x-ms-client-request-id: id\r\n"), std::string::npos);
+
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ClearIndex();
+  }
+
 }}} // namespace Azure::Core::Test
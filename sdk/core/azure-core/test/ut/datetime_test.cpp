@@ -7,6 +7,7 @@
 
 #include <chrono>
 #include <limits>
+#include <stdexcept>
 
 using namespace Azure;
 
@@ -800,3 +801,49 @@ TEST(DateTime, TimeRoundtrip)
   TestDateTimeRoundtrip<DateTime::TimeFractionFormat::AllDigits>("2021-02-05T10:00:00.0000000Z");
   TestDateTimeRoundtrip<DateTime::TimeFractionFormat::AllDigits>("2021-02-05T20:00:00.0000000Z");
 }
+
+TEST(DateTime, FixedLayoutMatchesGeneralParser)
+{
+  // The same dates in the fixed-width forms and in forms only the general parser reads.
+  EXPECT_EQ(
+      DateTime::Parse("Tue, 16 Feb 2021 04:05:06 GMT", DateTime::DateFormat::Rfc1123),
+      DateTime::Parse("16 Feb 2021 04:05:06 UT", DateTime::DateFormat::Rfc1123));
+  EXPECT_EQ(
+      DateTime::Parse("2021-02-16T04:05:06Z", DateTime::DateFormat::Rfc3339),
+      DateTime::Parse("20210216T040506Z", DateTime::DateFormat::Rfc3339));
+  EXPECT_EQ(
+      DateTime::Parse("2021-02-16T04:05:06.1Z", DateTime::DateFormat::Rfc3339),
+      DateTime::Parse("2021-02-16T04:05:06.1+00:00", DateTime::DateFormat::Rfc3339));
+  EXPECT_EQ(
+      DateTime::Parse("2021-02-16T04:05:06.1234567Z", DateTime::DateFormat::Rfc3339),
+      DateTime::Parse("2021-02-16T04:05:06.12345670Z", DateTime::DateFormat::Rfc3339));
+
+  EXPECT_THROW(
+      DateTime::Parse("Wed, 16 Feb 2021 04:05:06 GMT", DateTime::DateFormat::Rfc1123),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("Tue, 16 Feb 2021 04:05:6x GMT", DateTime::DateFormat::Rfc1123),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("Tue, 30 Feb 2021 04:05:06 GMT", DateTime::DateFormat::Rfc1123),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("2021-02-16T24:05:06Z", DateTime::DateFormat::Rfc3339),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("2021-02-16T04:05:0xZ", DateTime::DateFormat::Rfc3339),
+      std::invalid_argument);
+}
+
+TEST(DateTime, ToStringRfc1123SameSecond)
+{
+  auto const dt1 = DateTime::Parse("2021-02-16T04:05:06.1Z", DateTime::DateFormat::Rfc3339);
+  auto const dt2 = DateTime::Parse("2021-02-16T04:05:06.9Z", DateTime::DateFormat::Rfc3339);
+  auto const dt3 = DateTime::Parse("2021-02-16T04:05:07Z", DateTime::DateFormat::Rfc3339);
+
+  EXPECT_EQ(dt1.ToString(DateTime::DateFormat::Rfc1123), "Tue, 16 Feb 2021 04:05:06 GMT");
+  EXPECT_EQ(dt2.ToString(DateTime::DateFormat::Rfc1123), "Tue, 16 Feb 2021 04:05:06 GMT");
+  EXPECT_EQ(dt3.ToString(DateTime::DateFormat::Rfc1123), "Tue, 16 Feb 2021 04:05:07 GMT");
+  EXPECT_EQ(dt1.ToString(DateTime::DateFormat::Rfc1123), "Tue, 16 Feb 2021 04:05:06 GMT");
+  EXPECT_EQ(DateTime().ToString(DateTime::DateFormat::Rfc1123), "Mon, 01 Jan 0001 00:00:00 GMT");
+}
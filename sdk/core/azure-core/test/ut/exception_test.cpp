@@ -56,3 +56,18 @@ TEST(RequestFailedException, JSONErrorNoError)
   EXPECT_EQ(exception.RequestId, "1");
   EXPECT_EQ(exception.ClientRequestId, "2");
 }
+
+TEST(RequestFailedException, CopyKeepsWhat)
+{
+  Azure::Core::Http::TransportException const exception("Connection refused.");
+
+  auto const error = std::make_exception_ptr(exception);
+  try
+  {
+    std::rethrow_exception(error);
+  }
+  catch (Azure::Core::Http::TransportException const& copy)
+  {
+    EXPECT_EQ(std::string(copy.what()), "Connection refused.");
+  }
+}
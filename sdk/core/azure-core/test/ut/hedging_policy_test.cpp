@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/policies/policy.hpp"
+#include "azure/core/internal/http/pipeline.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Azure::Core;
+using namespace Azure::Core::Http;
+using namespace Azure::Core::Http::Policies;
+using namespace Azure::Core::Http::Policies::_internal;
+
+namespace {
+class TestTransportPolicy final : public HttpPolicy {
+  std::function<std::unique_ptr<RawResponse>(Request&, Context const&)> m_send;
+
+public:
+  TestTransportPolicy(std::function<std::unique_ptr<RawResponse>(Request&, Context const&)> send)
+      : m_send(send)
+  {
+  }
+
+  std::unique_ptr<RawResponse> Send(Request& request, NextHttpPolicy, Context const& context)
+      const override
+  {
+    return m_send(request, context);
+  }
+
+  std::unique_ptr<HttpPolicy> Clone() const override
+  {
+    return std::make_unique<TestTransportPolicy>(*this);
+  }
+};
+
+HedgingOptions GetHedgingOptions()
+{
+  HedgingOptions options;
+  options.Enabled = true;
+  options.InitialDelay = std::chrono::milliseconds(10);
+  return options;
+}
+} // namespace
+
+TEST(HedgingPolicy, SendsCopyOfSlowRequest)
+{
+  std::atomic<int> tryCount{0};
+  std::atomic<bool> isSlowTryCancelled{false};
+  {
+    std::vector<std::unique_ptr<HttpPolicy>> policies;
+    policies.emplace_back(std::make_unique<HedgingPolicy>(GetHedgingOptions()));
+    policies.emplace_back(
+        std::make_unique<TestTransportPolicy>([&](Request& request, Context const& context) {
+          ++tryCount;
+          if (!HedgingPolicy::IsHedgedTry(context))
+          {
+            // The first try waits to be cancelled once the copy got a response.
+            auto const timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (!context.IsCancelled() && std::chrono::steady_clock::now() < timeout)
+            {
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            isSlowTryCancelled = context.IsCancelled();
+            context.ThrowIfCancelled();
+          }
+          request.GetUrl().SetHost("secondary.microsoft.com");
+          return std::make_unique<RawResponse>(1, 1, HttpStatusCode::Ok, "OK");
+        }));
+    Azure::Core::Http::_internal::HttpPipeline pipeline(std::move(policies));
+
+    Request request(HttpMethod::Get, Url("https://www.microsoft.com/path"));
+    auto response = pipeline.Send(request, Context());
+    EXPECT_EQ(response->GetStatusCode(), HttpStatusCode::Ok);
+    EXPECT_EQ(request.GetUrl().GetHost(), "secondary.microsoft.com");
+    EXPECT_EQ(tryCount, 2);
+  }
+  // The pipeline waits for the cancelled try when destroyed.
+  EXPECT_TRUE(isSlowTryCancelled);
+}
+
+TEST(HedgingPolicy, ReturnsFastResponse)
+{
+  std::atomic<int> tryCount{0};
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<HedgingPolicy>(GetHedgingOptions()));
+  std::thread::id tryThread;
+  policies.emplace_back(std::make_unique<TestTransportPolicy>([&](Request&, Context const&) {
+    ++tryCount;
+    tryThread = std::this_thread::get_id();
+    return std::make_unique<RawResponse>(1, 1, HttpStatusCode::NotFound, "Not Found");
+  }));
+  Azure::Core::Http::_internal::HttpPipeline pipeline(std::move(policies));
+
+  Request request(HttpMethod::Head, Url("https://www.microsoft.com/path"));
+  auto response = pipeline.Send(request, Context());
+  EXPECT_EQ(response->GetStatusCode(), HttpStatusCode::NotFound);
+  EXPECT_EQ(tryCount, 1);
+  // The request is sent from the calling thread.
+  EXPECT_EQ(tryThread, std::this_thread::get_id());
+
+  // No copy is sent once the response was returned.
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(tryCount, 1);
+}
+
+TEST(HedgingPolicy, ReturnsErrorOfEachTry)
+{
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<HedgingPolicy>(GetHedgingOptions()));
+  policies.emplace_back(std::make_unique<TestTransportPolicy>(
+      [&](Request&, Context const&) -> std::unique_ptr<RawResponse> {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        throw TransportException("Connection reset.");
+      }));
+  Azure::Core::Http::_internal::HttpPipeline pipeline(std::move(policies));
+
+  Request request(HttpMethod::Get, Url("https://www.microsoft.com/path"));
+  EXPECT_THROW(pipeline.Send(request, Context()), TransportException);
+}
+
+TEST(HedgingPolicy, DoesNotHedgeOtherMethods)
+{
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<HedgingPolicy>(GetHedgingOptions()));
+  policies.emplace_back(
+      std::make_unique<TestTransportPolicy>([&](Request&, Context const& context) {
+        EXPECT_FALSE(HedgingPolicy::IsHedgedTry(context));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return std::make_unique<RawResponse>(1, 1, HttpStatusCode::Created, "Created");
+      }));
+  Azure::Core::Http::_internal::HttpPipeline pipeline(std::move(policies));
+
+  Request request(HttpMethod::Put, Url("https://www.microsoft.com/path"));
+  EXPECT_EQ(pipeline.Send(request, Context())->GetStatusCode(), HttpStatusCode::Created);
+}
@@ -7,6 +7,7 @@
 #include <azure/core/http/http.hpp>
 #include <azure/core/internal/io/null_body_stream.hpp>
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -119,6 +120,66 @@ namespace Azure { namespace Core { namespace Test {
         (std::pair<std::string, std::string>("valid3", "header3")));
   }
 
+  // Response - Well-known headers
+  TEST(TestHttp, response_well_known_headers)
+  {
+    using Azure::Core::Http::_internal::WellKnownHeader;
+
+    Http::RawResponse response(1, 1, Http::HttpStatusCode::Ok, "OK");
+    EXPECT_THROW(response.GetHeader(WellKnownHeader::ETag), std::out_of_range);
+
+    response.SetHeader("ETag", "\"0x1\"");
+    response.SetHeader("x-ms-request-id", "id");
+    EXPECT_EQ(response.GetHeader(WellKnownHeader::ETag), "\"0x1\"");
+    EXPECT_EQ(response.GetHeader(WellKnownHeader::XMsRequestId), "id");
+
+    // same header will just override
+    response.SetHeader("etag", "\"0x2\"");
+    EXPECT_EQ(response.GetHeader(WellKnownHeader::ETag), "\"0x2\"");
+    EXPECT_EQ(response.GetHeaders().size(), 2U);
+
+    // The index follows the headers when the response is moved
+    Http::RawResponse moved(std::move(response));
+    EXPECT_EQ(moved.GetHeader(WellKnownHeader::ETag), "\"0x2\"");
+    EXPECT_THROW(moved.GetHeader(WellKnownHeader::LastModified), std::out_of_range);
+  }
+
+  // Response - Body from a buffer pool
+  TEST(TestHttp, ResponseBufferPool)
+  {
+    auto pool = std::make_shared<Http::ResponseBufferPool>(2, 1024 * 1024);
+    auto buffer = pool->Acquire(1000);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_GE(buffer.capacity(), 1000U);
+    buffer.assign(1000, 1);
+    auto const data = buffer.data();
+
+    {
+      Http::RawResponse response(1, 1, Http::HttpStatusCode::Ok, "OK");
+      response.SetBody(std::move(buffer), pool);
+      EXPECT_EQ(response.GetBody().size(), 1000U);
+      EXPECT_EQ(pool->GetPooledBufferCount(), 0U);
+
+      // A copy doesn't give its body back.
+      Http::RawResponse copy(response);
+      EXPECT_EQ(copy.GetBody().size(), 1000U);
+    }
+    // The body went back to the pool with the response.
+    EXPECT_EQ(pool->GetPooledBufferCount(), 1U);
+    buffer = pool->Acquire(500);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.data(), data);
+
+    // Buffers over the capacity limit, or beyond the number of pooled buffers, are freed.
+    pool->Release(std::vector<uint8_t>(2 * 1024 * 1024));
+    EXPECT_EQ(pool->GetPooledBufferCount(), 0U);
+    for (int i = 0; i < 3; ++i)
+    {
+      pool->Release(std::vector<uint8_t>(100));
+    }
+    EXPECT_EQ(pool->GetPooledBufferCount(), 2U);
+  }
+
   // HTTP Range
   TEST(TestHttp, HttpRange)
   {
@@ -176,6 +237,37 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_TRUE(d);
     }
 
+    {
+      Http::Request req(Http::HttpMethod::Get, Url("http://test.com"));
+      req.SetHeader("name", "value");
+      req.SetHeader("removed", "value");
+
+      auto const& headers = req.GetHeadersReference();
+      auto const headersCopy = req.GetHeaders();
+
+      req.StartTry();
+      req.SetHeader("Name", "retryValue1");
+      req.SetHeader("name", "retryValue2");
+      req.SetHeader("retry", "retryValue");
+      EXPECT_EQ(headers.at("name"), "retryValue2");
+      EXPECT_EQ(headers.at("retry"), "retryValue");
+      EXPECT_EQ(headersCopy.at("name"), "value");
+      EXPECT_FALSE(headersCopy.count("retry"));
+      EXPECT_THROW(req.SetHeader("invalid()", "value"), std::invalid_argument);
+
+      req.RemoveHeader("removed");
+      EXPECT_FALSE(headers.count("removed"));
+
+      req.StartTry();
+      EXPECT_EQ(headers.size(), 1U);
+      EXPECT_EQ(headers.at("name"), "value");
+
+      req.RemoveHeader("name");
+      req.SetHeader("name", "retryValue");
+      req.StartTry();
+      EXPECT_TRUE(headers.empty());
+    }
+
     {
       Http::HttpMethod httpMethod = Http::HttpMethod::Post;
       Url url("http://test.com");
@@ -208,6 +300,61 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_EQ(temp[0], 1);
       EXPECT_EQ(temp[1], 2);
     }
+
+    {
+      // During a try, the headers of a block are set as any other, so the next try resets them.
+      auto const headerBlock = std::make_shared<const Http::_internal::HttpHeaderBlock>(
+          std::vector<std::pair<std::string, std::string>>{{"x-static", "1"}});
+      Http::Request req(Http::HttpMethod::Get, Url("http://test.com"));
+      req.StartTry();
+      req.AddHeaderBlock(headerBlock);
+      EXPECT_TRUE(req.GetHeaderBlocks().empty());
+      EXPECT_EQ(req.GetHeaders().at("x-static"), "1");
+      req.StartTry();
+      EXPECT_TRUE(req.GetHeaders().empty());
+    }
+  }
+
+  TEST(TestHttp, HeaderBlock)
+  {
+    EXPECT_THROW(
+        Http::_internal::HttpHeaderBlock(
+            std::vector<std::pair<std::string, std::string>>{{"invalid()", "value"}}),
+        std::invalid_argument);
+
+    auto const headerBlock = std::make_shared<const Http::_internal::HttpHeaderBlock>(
+        std::vector<std::pair<std::string, std::string>>{{"X-Static", "1"}, {"User-Agent", "ua"}});
+    EXPECT_EQ(headerBlock->GetSerializedHeaders(), "user-agent: ua\r\nx-static: 1\r\n");
+    EXPECT_TRUE(headerBlock->Contains("X-STATIC"));
+    EXPECT_FALSE(headerBlock->Contains("x-other"));
+
+    {
+      Http::Request req(Http::HttpMethod::Get, Url("http://test.com"));
+      req.SetHeader("x-static", "old");
+      req.AddHeaderBlock(headerBlock);
+      EXPECT_EQ(req.GetHeaders().at("x-static"), "1");
+      EXPECT_EQ(req.GetHeaders().at("user-agent"), "ua");
+      EXPECT_EQ(req.GetHeaderBlocks().size(), 1U);
+
+      // Adding the block again doesn't write its headers twice.
+      req.AddHeaderBlock(headerBlock);
+      EXPECT_EQ(req.GetHeaderBlocks().size(), 1U);
+
+      // Any other header leaves the block alone.
+      req.SetHeader("x-other", "value");
+      EXPECT_EQ(req.GetHeaderBlocks().size(), 1U);
+
+      // Setting or removing a header of the block drops it, keeping the other headers.
+      req.SetHeader("X-Static", "2");
+      EXPECT_TRUE(req.GetHeaderBlocks().empty());
+      EXPECT_EQ(req.GetHeaders().at("x-static"), "2");
+      EXPECT_EQ(req.GetHeaders().at("user-agent"), "ua");
+
+      req.AddHeaderBlock(headerBlock);
+      req.RemoveHeader("User-Agent");
+      EXPECT_TRUE(req.GetHeaderBlocks().empty());
+      EXPECT_EQ(req.GetHeaders().count("user-agent"), 0U);
+    }
   }
 
 }}} // namespace Azure::Core::Test
@@ -0,0 +1,223 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/diagnostics/instrumentation.hpp"
+#include "azure/core/http/policies/policy.hpp"
+#include "azure/core/internal/http/pipeline.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Azure::Core;
+using namespace Azure::Core::Diagnostics;
+using namespace Azure::Core::Http;
+using namespace Azure::Core::Http::Policies;
+using namespace Azure::Core::Http::Policies::_internal;
+
+namespace {
+struct SpanRecord final
+{
+  std::string Name;
+  std::map<std::string, std::string> StringAttributes;
+  std::map<std::string, int64_t> IntAttributes;
+  std::string Error;
+  bool Ended = false;
+};
+
+class TestSpan final : public Span {
+  std::shared_ptr<SpanRecord> m_record;
+
+public:
+  explicit TestSpan(std::shared_ptr<SpanRecord> record) : m_record(std::move(record)) {}
+
+  void SetAttribute(std::string const& name, std::string const& value) override
+  {
+    m_record->StringAttributes[name] = value;
+  }
+
+  void SetAttribute(std::string const& name, int64_t value) override
+  {
+    m_record->IntAttributes[name] = value;
+  }
+
+  void SetError(std::string const& description) override { m_record->Error = description; }
+
+  void End() override { m_record->Ended = true; }
+};
+
+class TestTracer final : public Tracer {
+public:
+  std::vector<std::shared_ptr<SpanRecord>> Spans;
+
+  std::unique_ptr<Span> StartSpan(std::string const& name) override
+  {
+    auto record = std::make_shared<SpanRecord>();
+    record->Name = name;
+    Spans.emplace_back(record);
+    return std::make_unique<TestSpan>(record);
+  }
+};
+
+struct Measurement final
+{
+  std::string Name;
+  int64_t Value;
+  std::map<std::string, std::string> Attributes;
+};
+
+class TestMeter final : public Meter {
+public:
+  std::vector<Measurement> Durations;
+  std::vector<Measurement> Counters;
+
+  void RecordDuration(
+      std::string const& name,
+      std::chrono::nanoseconds duration,
+      std::map<std::string, std::string> const& attributes) override
+  {
+    Durations.push_back({name, static_cast<int64_t>(duration.count()), attributes});
+  }
+
+  void AddToCounter(
+      std::string const& name,
+      int64_t value,
+      std::map<std::string, std::string> const& attributes) override
+  {
+    Counters.push_back({name, value, attributes});
+  }
+};
+
+class TestTransportPolicy final : public HttpPolicy {
+  std::function<std::unique_ptr<RawResponse>(Context const&)> m_send;
+
+public:
+  TestTransportPolicy(std::function<std::unique_ptr<RawResponse>(Context const&)> send)
+      : m_send(send)
+  {
+  }
+
+  std::unique_ptr<RawResponse> Send(Request&, NextHttpPolicy, Context const& context)
+      const override
+  {
+    return m_send(context);
+  }
+
+  std::unique_ptr<HttpPolicy> Clone() const override
+  {
+    return std::make_unique<TestTransportPolicy>(*this);
+  }
+};
+} // namespace
+
+TEST(InstrumentationPolicy, TracesAndMeasuresTries)
+{
+  auto tracer = std::make_shared<TestTracer>();
+  auto meter = std::make_shared<TestMeter>();
+  InstrumentationOptions options;
+  options.Tracer = tracer;
+  options.Meter = meter;
+
+  RetryOptions retryOptions;
+  retryOptions.RetryDelay = std::chrono::milliseconds(1);
+  retryOptions.MaxRetryDelay = std::chrono::milliseconds(1);
+
+  int tryCount = 0;
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<RetryPolicy>(retryOptions));
+  policies.emplace_back(std::make_unique<InstrumentationPolicy>(options));
+  policies.emplace_back(std::make_unique<TestTransportPolicy>([&](Context const& context) {
+    auto const timings = InstrumentationPolicy::GetRequestTimings(context);
+    EXPECT_NE(timings, nullptr);
+    timings->ConnectionReused = tryCount != 0;
+    timings->TimeToFirstByte = std::chrono::nanoseconds(1000);
+    return std::make_unique<RawResponse>(
+        1,
+        1,
+        tryCount++ == 0 ? HttpStatusCode::ServiceUnavailable : HttpStatusCode::Ok,
+        "");
+  }));
+  Azure::Core::Http::_internal::HttpPipeline pipeline(std::move(policies));
+
+  Request request(HttpMethod::Get, Url("https://www.microsoft.com:8080/path?sig=secret"));
+  auto response = pipeline.Send(request, Context());
+  EXPECT_EQ(response->GetStatusCode(), HttpStatusCode::Ok);
+
+  ASSERT_EQ(tracer->Spans.size(), 2U);
+  for (int32_t i = 0; i < 2; ++i)
+  {
+    auto const& span = *tracer->Spans[i];
+    EXPECT_EQ(span.Name, "HTTP GET");
+    EXPECT_TRUE(span.Ended);
+    EXPECT_EQ(span.StringAttributes.at("http.method"), "GET");
+    EXPECT_EQ(span.StringAttributes.at("http.url"), "https://www.microsoft.com:8080/path");
+    EXPECT_EQ(span.IntAttributes.at("http.retry_count"), i);
+    EXPECT_EQ(span.IntAttributes.at("http.client.time_to_first_byte_ns"), 1000);
+    EXPECT_EQ(span.IntAttributes.at("http.client.connection_reused"), i);
+    EXPECT_EQ(span.IntAttributes.count("http.client.name_lookup_ns"), 0U);
+    EXPECT_TRUE(span.Error.empty());
+  }
+  EXPECT_EQ(tracer->Spans[0]->IntAttributes.at("http.status_code"), 503);
+  EXPECT_EQ(tracer->Spans[1]->IntAttributes.at("http.status_code"), 200);
+
+  ASSERT_EQ(meter->Counters.size(), 1U);
+  EXPECT_EQ(meter->Counters[0].Name, "http.client.retries");
+  EXPECT_EQ(meter->Counters[0].Value, 1);
+
+  std::vector<std::string> durationNames;
+  for (auto const& duration : meter->Durations)
+  {
+    durationNames.push_back(duration.Name);
+    EXPECT_EQ(duration.Attributes.at("http.method"), "GET");
+    EXPECT_EQ(duration.Attributes.at("net.peer.name"), "www.microsoft.com");
+  }
+  EXPECT_EQ(
+      durationNames,
+      std::vector<std::string>(
+          {"http.client.duration",
+           "http.client.time_to_first_byte",
+           "http.client.duration",
+           "http.client.time_to_first_byte"}));
+  EXPECT_EQ(meter->Durations[0].Attributes.at("http.status_code"), "503");
+  EXPECT_EQ(meter->Durations[2].Attributes.at("http.status_code"), "200");
+}
+
+TEST(InstrumentationPolicy, RecordsErrors)
+{
+  auto tracer = std::make_shared<TestTracer>();
+  auto meter = std::make_shared<TestMeter>();
+  InstrumentationOptions options;
+  options.Tracer = tracer;
+  options.Meter = meter;
+
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<InstrumentationPolicy>(options));
+  policies.emplace_back(
+      std::make_unique<TestTransportPolicy>([](Context const&) -> std::unique_ptr<RawResponse> {
+        throw TransportException("Connection refused.");
+      }));
+  Azure::Core::Http::_internal::HttpPipeline pipeline(std::move(policies));
+
+  Request request(HttpMethod::Put, Url("http://localhost/path"));
+  EXPECT_THROW(pipeline.Send(request, Context()), TransportException);
+
+  ASSERT_EQ(tracer->Spans.size(), 1U);
+  EXPECT_EQ(tracer->Spans[0]->Name, "HTTP PUT");
+  EXPECT_EQ(tracer->Spans[0]->Error, "Connection refused.");
+  EXPECT_TRUE(tracer->Spans[0]->Ended);
+  EXPECT_EQ(tracer->Spans[0]->IntAttributes.count("http.retry_count"), 0U);
+
+  ASSERT_EQ(meter->Durations.size(), 1U);
+  EXPECT_EQ(meter->Durations[0].Attributes.at("error.type"), "transport");
+  EXPECT_TRUE(meter->Counters.empty());
+}
+
+TEST(InstrumentationPolicy, NoTimingsWithoutPolicy)
+{
+  EXPECT_EQ(InstrumentationPolicy::GetRequestTimings(Context()), nullptr);
+}
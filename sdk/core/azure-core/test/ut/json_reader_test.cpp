@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/core/internal/json/json_reader.hpp>
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Azure::Core::Json::_internal;
+
+namespace {
+std::vector<uint8_t> ToBytes(std::string const& text)
+{
+  return std::vector<uint8_t>(text.begin(), text.end());
+}
+
+std::vector<JsonTokenType> ReadTokenTypes(std::string const& text)
+{
+  auto const json = ToBytes(text);
+  JsonReader reader(json);
+  std::vector<JsonTokenType> tokenTypes;
+  while (reader.Read())
+  {
+    tokenTypes.push_back(reader.GetTokenType());
+  }
+  return tokenTypes;
+}
+} // namespace
+
+TEST(JsonReader, Tokens)
+{
+  EXPECT_EQ(
+      ReadTokenTypes(
+          " { \"a\" : [1, -2.5e3, true, false, null, \"b\", {}, []], \"c\": {\"d\": 1} } "),
+      std::vector<JsonTokenType>(
+          {JsonTokenType::StartObject,
+           JsonTokenType::PropertyName,
+           JsonTokenType::StartArray,
+           JsonTokenType::Number,
+           JsonTokenType::Number,
+           JsonTokenType::True,
+           JsonTokenType::False,
+           JsonTokenType::Null,
+           JsonTokenType::String,
+           JsonTokenType::StartObject,
+           JsonTokenType::EndObject,
+           JsonTokenType::StartArray,
+           JsonTokenType::EndArray,
+           JsonTokenType::EndArray,
+           JsonTokenType::PropertyName,
+           JsonTokenType::StartObject,
+           JsonTokenType::PropertyName,
+           JsonTokenType::Number,
+           JsonTokenType::EndObject,
+           JsonTokenType::EndObject}));
+
+  EXPECT_EQ(ReadTokenTypes("42"), std::vector<JsonTokenType>({JsonTokenType::Number}));
+}
+
+TEST(JsonReader, InvalidJson)
+{
+  for (auto const& text : std::vector<std::string>{
+           "",
+           "{",
+           "{\"a\"}",
+           "{\"a\":}",
+           "{\"a\":1,}",
+           "{\"a\":1 \"b\":2}",
+           "[1,]",
+           "[1}",
+           "{1:2}",
+           "tru",
+           "\"abc",
+           "\"a\nb\"",
+           "-",
+           "{} {}",
+       })
+  {
+    EXPECT_THROW(ReadTokenTypes(text), std::runtime_error) << text;
+  }
+}
+
+TEST(JsonReader, LongStrings)
+{
+  // The plain text of strings is scanned several bytes at a time, the special bytes have to be
+  // found at any offset.
+  for (size_t offset = 0; offset < 20; ++offset)
+  {
+    std::string const plain(offset, 'a');
+    auto json = ToBytes("[\"" + plain + "\\\"" + plain + "\xc3\xa9\",\"" + plain + "\"]");
+    JsonReader reader(json);
+    ASSERT_TRUE(reader.Read());
+    ASSERT_TRUE(reader.Read());
+    EXPECT_EQ(reader.GetString(), plain + "\"" + plain + "\xc3\xa9");
+    ASSERT_TRUE(reader.Read());
+    EXPECT_EQ(reader.GetString(), plain);
+
+    EXPECT_THROW(ReadTokenTypes("\"" + plain + "\t" + plain + "\""), std::runtime_error);
+    EXPECT_THROW(ReadTokenTypes("\"" + plain + plain), std::runtime_error);
+  }
+}
+
+TEST(JsonReader, Values)
+{
+  auto const json = ToBytes(
+      "{\"kid\":\"https://vault/keys/1\","
+      "\"escaped\\\"name\":\"a\\\\b\\/c\\n\\u00e9\\ud83d\\ude00\","
+      "\"max\":9223372036854775807,\"min\":-9223372036854775808,\"flag\":true}");
+  JsonReader reader(json);
+  ASSERT_TRUE(reader.Read());
+  EXPECT_THROW(reader.GetString(), std::runtime_error);
+
+  ASSERT_TRUE(reader.ReadNextProperty());
+  EXPECT_TRUE(reader.ValueEquals("kid"));
+  EXPECT_FALSE(reader.ValueEquals("ki"));
+  ASSERT_TRUE(reader.Read());
+  EXPECT_EQ(reader.GetString(), "https://vault/keys/1");
+
+  ASSERT_TRUE(reader.ReadNextProperty());
+  EXPECT_TRUE(reader.ValueEquals(std::string("escaped\"name")));
+  ASSERT_TRUE(reader.Read());
+  EXPECT_EQ(reader.GetString(), "a\\b/c\n\xc3\xa9\xf0\x9f\x98\x80");
+
+  ASSERT_TRUE(reader.ReadNextProperty());
+  ASSERT_TRUE(reader.Read());
+  EXPECT_EQ(reader.GetInt64(), (std::numeric_limits<int64_t>::max)());
+  ASSERT_TRUE(reader.ReadNextProperty());
+  ASSERT_TRUE(reader.Read());
+  EXPECT_EQ(reader.GetInt64(), (std::numeric_limits<int64_t>::min)());
+  EXPECT_THROW(reader.GetBool(), std::runtime_error);
+
+  ASSERT_TRUE(reader.ReadNextProperty());
+  ASSERT_TRUE(reader.Read());
+  EXPECT_TRUE(reader.GetBool());
+
+  EXPECT_FALSE(reader.ReadNextProperty());
+  EXPECT_FALSE(reader.Read());
+}
+
+TEST(JsonReader, InvalidValues)
+{
+  auto const json = ToBytes("[1.5, 9223372036854775808, \"\\x\", \"\\udc00\"]");
+  JsonReader reader(json);
+  ASSERT_TRUE(reader.Read());
+  EXPECT_THROW(reader.ReadNextProperty(), std::runtime_error);
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_TRUE(reader.Read());
+    if (i < 2)
+    {
+      EXPECT_THROW(reader.GetInt64(), std::runtime_error);
+    }
+    else
+    {
+      EXPECT_THROW(reader.GetString(), std::runtime_error);
+    }
+  }
+}
+
+TEST(JsonReader, Skip)
+{
+  auto const json = ToBytes("{\"a\":{\"b\":[1,{\"c\":[]}],\"d\":2},\"e\":[[]],\"f\":\"g\"}");
+  JsonReader reader(json);
+  ASSERT_TRUE(reader.Read());
+  ASSERT_TRUE(reader.ReadNextProperty());
+  reader.Skip();
+  EXPECT_EQ(reader.GetTokenType(), JsonTokenType::EndObject);
+
+  ASSERT_TRUE(reader.ReadNextProperty());
+  EXPECT_TRUE(reader.ValueEquals("e"));
+  ASSERT_TRUE(reader.Read());
+  reader.Skip();
+  EXPECT_EQ(reader.GetTokenType(), JsonTokenType::EndArray);
+
+  ASSERT_TRUE(reader.ReadNextProperty());
+  EXPECT_TRUE(reader.ValueEquals("f"));
+  reader.Skip();
+  EXPECT_EQ(reader.GetString(), "g");
+  EXPECT_FALSE(reader.ReadNextProperty());
+}
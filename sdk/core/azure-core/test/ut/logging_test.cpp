@@ -4,6 +4,16 @@
 #include <azure/core/internal/diagnostics/log.hpp>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
 using Azure::Core::Diagnostics::Logger;
 using Azure::Core::Diagnostics::_internal::Log;
 
@@ -201,3 +211,134 @@ TEST(Logger, Message)
     throw;
   }
 }
+
+TEST(Logger, LazyMessage)
+{
+  std::vector<std::string> messages;
+  Logger::SetListener([&](auto, auto msg) { messages.push_back(msg); });
+  Logger::SetLevel(Logger::Level::Warning);
+
+  int formatCount = 0;
+  auto const format = [&]() {
+    ++formatCount;
+    return "Formatted " + std::to_string(formatCount);
+  };
+
+  Log::Write(Logger::Level::Verbose, format);
+  Log::Write(Logger::Level::Informational, format);
+  EXPECT_EQ(formatCount, 0);
+
+  Log::Write(Logger::Level::Warning, format);
+  EXPECT_EQ(formatCount, 1);
+  ASSERT_EQ(messages.size(), 1U);
+  EXPECT_EQ(messages[0], "Formatted 1");
+
+  Logger::SetListener(nullptr);
+  Log::Write(Logger::Level::Error, format);
+  EXPECT_EQ(formatCount, 1);
+}
+
+TEST(Logger, AsyncListener)
+{
+  EXPECT_THROW(Logger::CreateAsyncListener(nullptr), std::invalid_argument);
+  EXPECT_THROW(Logger::CreateAsyncListener([](auto, auto) {}, 0), std::invalid_argument);
+
+  Logger::SetLevel(Logger::Level::Verbose);
+  {
+    std::vector<std::pair<Logger::Level, std::string>> messages;
+    std::thread::id listenerThread;
+    Logger::SetListener(Logger::CreateAsyncListener([&](auto lvl, auto msg) {
+      listenerThread = std::this_thread::get_id();
+      messages.emplace_back(lvl, msg);
+    }));
+
+    for (int i = 0; i < 100; ++i)
+    {
+      Log::Write(Logger::Level::Informational, "Message " + std::to_string(i));
+    }
+    // The queued messages are reported before the listener is destroyed.
+    Logger::SetListener(nullptr);
+
+    ASSERT_EQ(messages.size(), 100U);
+    for (int i = 0; i < 100; ++i)
+    {
+      EXPECT_EQ(messages[i].first, Logger::Level::Informational);
+      EXPECT_EQ(messages[i].second, "Message " + std::to_string(i));
+    }
+    EXPECT_NE(listenerThread, std::this_thread::get_id());
+  }
+
+  {
+    std::mutex blockMutex;
+    std::unique_lock<std::mutex> block(blockMutex);
+    std::vector<std::pair<Logger::Level, std::string>> messages;
+    Logger::SetListener(Logger::CreateAsyncListener(
+        [&](auto lvl, auto msg) {
+          std::lock_guard<std::mutex> wait(blockMutex);
+          messages.emplace_back(lvl, msg);
+        },
+        2));
+
+    // The first message is taken by the background thread, which then waits for the lock. Of the
+    // next ones, only the first two fit in the queue.
+    Log::Write(Logger::Level::Verbose, "First");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    for (int i = 0; i < 5; ++i)
+    {
+      Log::Write(Logger::Level::Verbose, "Message " + std::to_string(i));
+    }
+    block.unlock();
+    Logger::SetListener(nullptr);
+
+    ASSERT_EQ(messages.size(), 4U);
+    EXPECT_EQ(messages[0].second, "First");
+    EXPECT_EQ(messages[1].second, "Message 0");
+    EXPECT_EQ(messages[2].second, "Message 1");
+    auto const dropped = std::find_if(messages.begin(), messages.end(), [](auto const& message) {
+      return message.first == Logger::Level::Warning;
+    });
+    ASSERT_NE(dropped, messages.end());
+    EXPECT_EQ(dropped->second.find("3 log messages were dropped"), 0U);
+  }
+}
+
+TEST(Logger, SetListenerWhileWriting)
+{
+  Logger::SetLevel(Logger::Level::Verbose);
+
+  std::atomic<bool> stop(false);
+  std::vector<std::thread> writers;
+  for (int i = 0; i < 4; ++i)
+  {
+    writers.emplace_back([&]() {
+      while (!stop)
+      {
+        Log::Write(Logger::Level::Verbose, "Message");
+      }
+    });
+  }
+
+  for (int i = 0; i < 100; ++i)
+  {
+    auto replaced = std::make_shared<std::atomic<bool>>(false);
+    std::atomic<int> callsAfterReplaced(0);
+    Logger::SetListener([replaced, &callsAfterReplaced](auto, auto) {
+      if (*replaced)
+      {
+        ++callsAfterReplaced;
+      }
+    });
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    Logger::SetListener(nullptr);
+    // Once SetListener() returns, the previous listener is no longer called.
+    *replaced = true;
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    EXPECT_EQ(callsAfterReplaced, 0);
+  }
+
+  stop = true;
+  for (auto& writer : writers)
+  {
+    writer.join();
+  }
+}
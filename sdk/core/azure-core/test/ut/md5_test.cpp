@@ -122,6 +122,30 @@ TEST(Md5Hash, ExpectThrow)
 #endif
 }
 
+TEST(Md5Hash, Reset)
+{
+  Md5Hash instance;
+  const std::string data = "Hello Azure!";
+  const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data.data());
+
+  // Partially appended data is discarded.
+  instance.Append(ptr, 5);
+  instance.Reset();
+  EXPECT_EQ(
+      Azure::Core::Convert::Base64Encode(instance.Final(ptr, data.length())),
+      "Pz8543xut4RVSbb2g52Mww==");
+
+  // The instance can be reused after Final().
+  for (int i = 0; i < 3; ++i)
+  {
+    instance.Reset();
+    EXPECT_EQ(Azure::Core::Convert::Base64Encode(instance.Final()), "1B2M2Y8AsgTpgAmY7PhCfg==");
+    instance.Reset();
+    instance.Append(ptr, data.length());
+    EXPECT_EQ(Azure::Core::Convert::Base64Encode(instance.Final()), "Pz8543xut4RVSbb2g52Mww==");
+  }
+}
+
 TEST(Md5Hash, CtorDtor)
 {
   {
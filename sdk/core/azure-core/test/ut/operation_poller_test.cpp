@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include <azure/core/operation.hpp>
+#include <azure/core/operation_poller.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Azure::Core;
+
+namespace {
+  // Completes after a number of polls, with that number as its value.
+  class CountdownOperation final : public Operation<int> {
+  public:
+    explicit CountdownOperation(
+        int numPolls,
+        std::shared_ptr<std::atomic<int>> numPolled,
+        std::string retryAfter = std::string())
+        : m_numPolls(numPolls), m_numPolled(std::move(numPolled)),
+          m_retryAfter(std::move(retryAfter))
+    {
+      m_status = numPolls == 0 ? OperationStatus::Succeeded : OperationStatus::Running;
+    }
+
+    int Value() const override { return m_numPolls; }
+
+    std::string GetResumeToken() const override { return std::string(); }
+
+  private:
+    std::unique_ptr<Http::RawResponse> PollInternal(Context const&) override
+    {
+      if (m_numPolls < 0)
+      {
+        throw std::runtime_error("The operation was not found.");
+      }
+      if (++*m_numPolled >= m_numPolls)
+      {
+        m_status = OperationStatus::Succeeded;
+      }
+      auto response = std::make_unique<Http::RawResponse>(1, 1, Http::HttpStatusCode::Ok, "OK");
+      if (!m_retryAfter.empty())
+      {
+        response->SetHeader("Retry-After", m_retryAfter);
+      }
+      return response;
+    }
+
+    Azure::Response<int> PollUntilDoneInternal(std::chrono::milliseconds, Context&) override
+    {
+      throw std::logic_error("Not used.");
+    }
+
+    Http::RawResponse const& GetRawResponseInternal() const override { return *m_rawResponse; }
+
+    int m_numPolls;
+    std::shared_ptr<std::atomic<int>> m_numPolled;
+    std::string m_retryAfter;
+  };
+} // namespace
+
+TEST(OperationPoller, CompletesOperations)
+{
+  OperationPollerOptions options;
+  options.InitialInterval = std::chrono::milliseconds(1);
+  options.MaxInterval = std::chrono::milliseconds(8);
+  options.MaxConcurrentPolls = 2;
+  OperationPoller poller(options);
+
+  std::vector<std::shared_ptr<std::atomic<int>>> numPolled;
+  std::vector<std::future<CountdownOperation>> futures;
+  for (int i = 0; i < 100; ++i)
+  {
+    numPolled.push_back(std::make_shared<std::atomic<int>>(0));
+    futures.push_back(poller.Add(CountdownOperation(i % 5, numPolled.back())));
+  }
+  for (int i = 0; i < 100; ++i)
+  {
+    auto operation = futures[i].get();
+    EXPECT_TRUE(operation.HasValue());
+    EXPECT_EQ(operation.Value(), i % 5);
+    EXPECT_EQ(*numPolled[i], i % 5);
+  }
+
+  auto failingOperation = poller.Add(CountdownOperation(-1, numPolled[0]));
+  EXPECT_THROW(failingOperation.get(), std::runtime_error);
+}
+
+TEST(OperationPoller, HonorsRetryAfter)
+{
+  OperationPollerOptions options;
+  options.InitialInterval = std::chrono::milliseconds(1);
+  options.MaxInterval = std::chrono::milliseconds(1);
+  OperationPoller poller(options);
+
+  // The second poll waits for the second asked for by the first one.
+  auto numPolled = std::make_shared<std::atomic<int>>(0);
+  auto start = std::chrono::steady_clock::now();
+  auto operation = poller.Add(CountdownOperation(2, numPolled, "1"));
+  EXPECT_EQ(operation.get().Value(), 2);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+TEST(OperationPoller, StopCancelsOperations)
+{
+  OperationPollerOptions options;
+  options.InitialInterval = std::chrono::milliseconds(1);
+  options.MaxInterval = std::chrono::milliseconds(1);
+  auto poller = std::make_unique<OperationPoller>(options);
+
+  auto numPolled = std::make_shared<std::atomic<int>>(0);
+  auto operation = poller->Add(CountdownOperation(1000000, numPolled));
+  while (*numPolled < 10)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  poller.reset();
+  EXPECT_THROW(operation.get(), OperationCancelledException);
+}
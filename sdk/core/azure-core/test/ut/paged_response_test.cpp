@@ -0,0 +1,170 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/core/http/http_status_code.hpp>
+#include <azure/core/paged_response.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Azure::Core;
+
+namespace {
+class PagedService;
+
+class Page final : public PagedResponse<Page> {
+private:
+  friend class PagedService;
+  friend class PagedResponse<Page>;
+
+  std::shared_ptr<PagedService> m_service;
+  void OnNextPage(const Context& context);
+
+public:
+  int Number = 0;
+};
+
+class PagedService final : public std::enable_shared_from_this<PagedService> {
+public:
+  explicit PagedService(int numPages) : NumPages(numPages) {}
+
+  int const NumPages;
+  std::atomic<int> NumFetched{0};
+  // The page failing to be fetched once, if any.
+  std::atomic<int> FailingPage{-1};
+
+  Page GetPage(int number)
+  {
+    int failingPage = number;
+    if (FailingPage.compare_exchange_strong(failingPage, -1))
+    {
+      throw std::runtime_error("Failed to fetch the page.");
+    }
+    ++NumFetched;
+    Page page;
+    page.m_service = shared_from_this();
+    page.Number = number;
+    page.CurrentPageToken = std::to_string(number);
+    page.NextPageToken = number + 1 == NumPages ? std::string() : std::to_string(number + 1);
+    page.RawResponse = std::make_unique<Http::RawResponse>(1, 1, Http::HttpStatusCode::Ok, "OK");
+    return page;
+  }
+};
+
+void Page::OnNextPage(const Context&)
+{
+  *this = m_service->GetPage(std::stoi(NextPageToken.Value()));
+}
+
+// Waits for a condition, which is checked for up to 10 seconds.
+template <class Condition> bool WaitFor(Condition const& condition)
+{
+  for (int i = 0; i < 1000 && !condition(); ++i)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return condition();
+}
+} // namespace
+
+TEST(PagedResponse, Prefetch)
+{
+  auto const service = std::make_shared<PagedService>(10);
+  auto page = service->GetPage(0);
+  page.Prefetch(3);
+
+  // No more than 3 pages are fetched ahead of the current page.
+  EXPECT_TRUE(WaitFor([&]() { return service->NumFetched == 4; }));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(service->NumFetched, 4);
+
+  int expectedNumber = 0;
+  for (; page.HasPage(); page.MoveToNextPage())
+  {
+    EXPECT_EQ(page.Number, expectedNumber);
+    EXPECT_EQ(page.CurrentPageToken, std::to_string(expectedNumber));
+    EXPECT_NE(page.RawResponse, nullptr);
+    ++expectedNumber;
+  }
+  EXPECT_EQ(expectedNumber, 10);
+  EXPECT_EQ(service->NumFetched, 10);
+}
+
+TEST(PagedResponse, PrefetchError)
+{
+  auto const service = std::make_shared<PagedService>(5);
+  service->FailingPage = 3;
+  auto page = service->GetPage(0);
+  page.Prefetch(2);
+
+  page.MoveToNextPage();
+  page.MoveToNextPage();
+  EXPECT_EQ(page.Number, 2);
+  EXPECT_THROW(page.MoveToNextPage(), std::runtime_error);
+  EXPECT_EQ(page.Number, 2);
+
+  // The next pages are fetched when moving to them.
+  page.MoveToNextPage();
+  EXPECT_EQ(page.Number, 3);
+  page.MoveToNextPage();
+  EXPECT_EQ(page.Number, 4);
+  page.MoveToNextPage();
+  EXPECT_FALSE(page.HasPage());
+}
+
+TEST(PagedResponse, PrefetchStopped)
+{
+  auto const service = std::make_shared<PagedService>(100);
+  {
+    auto page = service->GetPage(0);
+    page.Prefetch(2);
+    EXPECT_TRUE(WaitFor([&]() { return service->NumFetched == 3; }));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(service->NumFetched, 3);
+
+  auto page = service->GetPage(0);
+  page.Prefetch(2);
+  page.Prefetch(0);
+  page.MoveToNextPage();
+  EXPECT_EQ(page.Number, 1);
+  EXPECT_LE(service->NumFetched, 7);
+}
+
+TEST(PagedResponse, PrefetchStoppedByAssignment)
+{
+  auto const service = std::make_shared<PagedService>(100);
+  auto page = service->GetPage(0);
+  page.Prefetch(2);
+  EXPECT_TRUE(WaitFor([&]() { return service->NumFetched == 3; }));
+
+  // Assigning another page stops the thread prefetching the pages after the previous one, which
+  // releases its pages.
+  page = service->GetPage(50);
+  EXPECT_TRUE(WaitFor([&]() { return service.use_count() == 2; }));
+  page.MoveToNextPage();
+  EXPECT_EQ(page.Number, 51);
+  EXPECT_EQ(service->NumFetched, 5);
+}
+
+TEST(PagedResponse, CopyRawResponse)
+{
+  auto const service = std::make_shared<PagedService>(2);
+  auto page = service->GetPage(0);
+  page.RawResponse->SetHeader("x-ms-request-id", "id");
+  page.RawResponse->SetBody({1, 2, 3});
+
+  Page copy(page);
+  ASSERT_NE(copy.RawResponse, nullptr);
+  EXPECT_NE(copy.RawResponse, page.RawResponse);
+  EXPECT_EQ(copy.RawResponse->GetStatusCode(), Http::HttpStatusCode::Ok);
+  EXPECT_EQ(copy.RawResponse->GetHeaders().at("x-ms-request-id"), "id");
+  EXPECT_EQ(copy.RawResponse->GetBody(), std::vector<uint8_t>({1, 2, 3}));
+  EXPECT_EQ(copy.NextPageToken.Value(), "1");
+}
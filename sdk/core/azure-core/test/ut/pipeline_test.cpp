@@ -5,6 +5,7 @@
 #include <azure/core/internal/http/pipeline.hpp>
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <vector>
 
 TEST(Pipeline, createPipeline)
@@ -36,6 +37,39 @@ TEST(Pipeline, clonePipeline)
   EXPECT_NO_THROW(Azure::Core::Http::_internal::HttpPipeline pipeline2(pipeline));
 }
 
+TEST(Pipeline, copySharesPolicies)
+{
+  class CountingPolicy final : public Azure::Core::Http::Policies::HttpPolicy {
+    std::atomic<int>& m_clones;
+
+  public:
+    explicit CountingPolicy(std::atomic<int>& clones) : m_clones(clones) {}
+
+    std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+        Azure::Core::Http::Request&,
+        Azure::Core::Http::Policies::NextHttpPolicy,
+        Azure::Core::Context const&) const override
+    {
+      return nullptr;
+    }
+
+    std::unique_ptr<HttpPolicy> Clone() const override
+    {
+      ++m_clones;
+      return std::make_unique<CountingPolicy>(*this);
+    }
+  };
+
+  std::atomic<int> clones{0};
+  std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+  policies.push_back(std::make_unique<CountingPolicy>(clones));
+  Azure::Core::Http::_internal::HttpPipeline pipeline(std::move(policies));
+
+  Azure::Core::Http::_internal::HttpPipeline pipeline2(pipeline);
+  Azure::Core::Http::_internal::HttpPipeline pipeline3(pipeline2);
+  EXPECT_EQ(clones, 0);
+}
+
 TEST(Pipeline, refrefPipeline)
 {
   // Construct pipeline without exception
@@ -5,6 +5,11 @@
 #include <azure/core/internal/http/pipeline.hpp>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -67,6 +72,50 @@ struct TestContextTreeIntegrity final : public Azure::Core::Http::Policies::Http
   }
 };
 
+// Responds with a body stream of the same content to every request.
+class BodyTransport final : public Azure::Core::Http::HttpTransport {
+  std::vector<uint8_t> m_body;
+
+public:
+  explicit BodyTransport(std::vector<uint8_t> body) : m_body(std::move(body)) {}
+
+  std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+      Azure::Core::Http::Request&,
+      Azure::Core::Context const&) override
+  {
+    auto response = std::make_unique<Azure::Core::Http::RawResponse>(
+        1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+    response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(m_body));
+    return response;
+  }
+};
+
+// Responds to every request, recording the priority of its context.
+class PriorityRecorder final : public Azure::Core::Http::Policies::HttpPolicy {
+  std::shared_ptr<Azure::Core::Http::RequestPriority> m_priority;
+
+public:
+  explicit PriorityRecorder(std::shared_ptr<Azure::Core::Http::RequestPriority> priority)
+      : m_priority(std::move(priority))
+  {
+  }
+
+  std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy> Clone() const override
+  {
+    return std::make_unique<PriorityRecorder>(*this);
+  }
+
+  std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+      Azure::Core::Http::Request&,
+      Azure::Core::Http::Policies::NextHttpPolicy,
+      Azure::Core::Context const& context) const override
+  {
+    *m_priority = Azure::Core::Http::GetRequestPriority(context);
+    return std::make_unique<Azure::Core::Http::RawResponse>(
+        1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+  }
+};
+
 class SuccessAfter final : public Azure::Core::Http::Policies::HttpPolicy {
 private:
   int m_successAfter; // Always success
@@ -223,3 +272,202 @@ TEST(Policy, RetryPolicyKeepContext)
   auto withValueContext = Context::ApplicationContext.WithValue(TheKey, std::string("TheValue"));
   pipeline.Send(request, withValueContext);
 }
+
+TEST(Policy, RequestPriorityPolicy)
+{
+  using namespace Azure::Core;
+  using namespace Azure::Core::Http;
+  using namespace Azure::Core::Http::_internal;
+  using namespace Azure::Core::Http::Policies;
+  using namespace Azure::Core::Http::Policies::_internal;
+
+  EXPECT_EQ(GetRequestPriority(Context::ApplicationContext), RequestPriority::Normal);
+
+  auto priority = std::make_shared<RequestPriority>(RequestPriority::Normal);
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.push_back(std::make_unique<RequestPriorityPolicy>(RequestPriority::Low));
+  policies.push_back(std::make_unique<PriorityRecorder>(priority));
+  HttpPipeline pipeline(policies);
+
+  // The priority of the client options applies to the requests whose context has none.
+  Request request(HttpMethod::Get, Url("url"));
+  pipeline.Send(request, Context::ApplicationContext);
+  EXPECT_EQ(*priority, RequestPriority::Low);
+
+  // The priority of the context takes precedence.
+  pipeline.Send(request, WithRequestPriority(Context::ApplicationContext, RequestPriority::High));
+  EXPECT_EQ(*priority, RequestPriority::High);
+}
+
+TEST(Policy, throwWhenNoTransportPolicyAsync)
+{
+  std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+  policies.push_back(
+      std::make_unique<Azure::Core::Http::Policies::_internal::TelemetryPolicy>("test", "test"));
+
+  Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+  Azure::Core::Url url("");
+  Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+  EXPECT_THROW(
+      pipeline.SendAsync(
+          request,
+          Azure::Core::Context::ApplicationContext,
+          [](std::unique_ptr<Azure::Core::Http::RawResponse>, std::exception_ptr) {}),
+      std::invalid_argument);
+}
+
+TEST(Policy, RetryPolicyRetryCycleAsync)
+{
+  using namespace Azure::Core;
+  using namespace Azure::Core::Http;
+  using namespace Azure::Core::Http::_internal;
+  using namespace Azure::Core::Http::Policies;
+  using namespace Azure::Core::Http::Policies::_internal;
+  // Clean the validation global state
+  retryCounterState = 0;
+
+  // The policies without an asynchronous implementation are called through the default one.
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  RetryOptions opt;
+  opt.RetryDelay = std::chrono::milliseconds(10);
+  policies.push_back(std::make_unique<RetryPolicy>(opt));
+  policies.push_back(std::make_unique<TestRetryPolicySharedState>());
+  policies.push_back(std::make_unique<SuccessAfter>(3));
+
+  HttpPipeline pipeline(policies);
+  Request request(HttpMethod::Get, Url("url"));
+  std::promise<HttpStatusCode> statusCode;
+  pipeline.SendAsync(
+      request,
+      Context::ApplicationContext,
+      [&statusCode](std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+        if (error)
+        {
+          statusCode.set_exception(error);
+          return;
+        }
+        statusCode.set_value(response->GetStatusCode());
+      });
+  EXPECT_EQ(statusCode.get_future().get(), HttpStatusCode::Ok);
+  EXPECT_EQ(retryCounterState, 4);
+}
+
+TEST(Policy, RetryPolicyCancelledAsync)
+{
+  using namespace Azure::Core;
+  using namespace Azure::Core::Http;
+  using namespace Azure::Core::Http::_internal;
+  using namespace Azure::Core::Http::Policies;
+  using namespace Azure::Core::Http::Policies::_internal;
+
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  RetryOptions opt;
+  opt.RetryDelay = std::chrono::seconds(10);
+  policies.push_back(std::make_unique<RetryPolicy>(opt));
+  policies.push_back(std::make_unique<SuccessAfter>(3));
+
+  // The context is cancelled while waiting for the first retry.
+  HttpPipeline pipeline(policies);
+  Request request(HttpMethod::Get, Url("url"));
+  Context context;
+  std::promise<std::exception_ptr> result;
+  pipeline.SendAsync(
+      request, context, [&result](std::unique_ptr<RawResponse>, std::exception_ptr error) {
+        result.set_value(error);
+      });
+  context.Cancel();
+
+  auto error = result.get_future().get();
+  ASSERT_TRUE(error);
+  EXPECT_THROW(std::rethrow_exception(error), OperationCancelledException);
+}
+
+TEST(Policy, TransportPolicyResponseBufferPool)
+{
+  using namespace Azure::Core;
+  using namespace Azure::Core::Http;
+  using namespace Azure::Core::Http::_internal;
+  using namespace Azure::Core::Http::Policies;
+  using namespace Azure::Core::Http::Policies::_internal;
+
+  std::vector<uint8_t> const body(50000, 'x');
+  TransportOptions options;
+  options.Transport = std::make_shared<BodyTransport>(body);
+  options.ResponseBufferPool = std::make_shared<ResponseBufferPool>();
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.push_back(std::make_unique<TransportPolicy>(options));
+  HttpPipeline pipeline(policies);
+
+  Url url("");
+  const uint8_t* firstBody = nullptr;
+  for (int i = 0; i < 3; ++i)
+  {
+    Request request(HttpMethod::Get, url);
+    auto response = pipeline.Send(request, Context::ApplicationContext);
+    EXPECT_EQ(response->GetBody(), body);
+    if (i == 0)
+    {
+      firstBody = response->GetBody().data();
+    }
+    else
+    {
+      // The buffer of the previous response is reused.
+      EXPECT_EQ(response->GetBody().data(), firstBody);
+    }
+    EXPECT_EQ(options.ResponseBufferPool->GetPooledBufferCount(), 0U);
+  }
+  EXPECT_EQ(options.ResponseBufferPool->GetPooledBufferCount(), 1U);
+}
+
+TEST(Policy, HttpPolicyObserver)
+{
+  using namespace Azure::Core;
+  using namespace Azure::Core::Http;
+  using namespace Azure::Core::Http::_internal;
+  using namespace Azure::Core::Http::Policies;
+  using namespace Azure::Core::Http::Policies::_internal;
+
+  class CountingObserver final : public HttpPolicyObserver {
+  public:
+    std::vector<size_t> Indexes;
+    std::vector<HttpPolicy const*> Policies;
+    std::vector<std::chrono::nanoseconds> Durations;
+
+    void OnPolicyCalled(HttpPolicy const& policy, size_t index, std::chrono::nanoseconds elapsed)
+        override
+    {
+      Indexes.push_back(index);
+      Policies.push_back(&policy);
+      Durations.push_back(elapsed);
+    }
+  };
+
+  TransportOptions options;
+  options.Transport = std::make_shared<BodyTransport>(std::vector<uint8_t>{1, 2, 3});
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.push_back(std::make_unique<RequestIdPolicy>());
+  policies.push_back(std::make_unique<TelemetryPolicy>("test", "test"));
+  policies.push_back(std::make_unique<TransportPolicy>(options));
+  HttpPipeline pipeline(policies);
+
+  Url url("");
+  CountingObserver observer;
+  HttpPolicyObserver::Install(&observer);
+  {
+    Request request(HttpMethod::Get, url);
+    pipeline.Send(request, Context::ApplicationContext);
+  }
+  HttpPolicyObserver::Install(nullptr);
+  {
+    Request request(HttpMethod::Get, url);
+    pipeline.Send(request, Context::ApplicationContext);
+  }
+
+  // The policies return in the reverse order of their calls, and each call includes the calls
+  // after it.
+  ASSERT_EQ(observer.Indexes, std::vector<size_t>({2, 1, 0}));
+  EXPECT_NE(observer.Policies[0], observer.Policies[1]);
+  EXPECT_NE(observer.Policies[1], observer.Policies[2]);
+  EXPECT_LE(observer.Durations[0], observer.Durations[1]);
+  EXPECT_LE(observer.Durations[1], observer.Durations[2]);
+}
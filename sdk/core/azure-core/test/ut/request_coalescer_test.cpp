@@ -0,0 +1,225 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/policies/policy.hpp"
+#include "azure/core/http/policies/request_coalescer.hpp"
+#include "azure/core/internal/http/pipeline.hpp"
+#include "azure/core/io/body_stream.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Azure::Core;
+using namespace Azure::Core::Http;
+using namespace Azure::Core::Http::Policies;
+using namespace Azure::Core::Http::Policies::_internal;
+
+namespace {
+std::string const BlobUrl = "https://account.blob.core.windows.net/container/blob";
+
+std::unique_ptr<RawResponse> MakeResponse(std::string const& body)
+{
+  auto response = std::make_unique<RawResponse>(1, 1, HttpStatusCode::Ok, "OK");
+  response->SetHeader("Content-Length", std::to_string(body.size()));
+  response->SetHeader("ETag", "\"etag\"");
+  response->SetBodyStream(std::make_unique<IO::MemoryBodyStream>(IO::SharedBuffer(body)));
+  return response;
+}
+
+bool WaitFor(std::function<bool()> const& condition)
+{
+  auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!condition())
+  {
+    if (std::chrono::steady_clock::now() > deadline)
+    {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+std::string ReadBody(RawResponse& response)
+{
+  auto const body = response.ExtractBodyStream()->ReadToEnd();
+  return std::string(body.begin(), body.end());
+}
+} // namespace
+
+TEST(RequestCoalescer, CoalescesIdenticalRequests)
+{
+  constexpr size_t NumRequests = 8;
+  RequestCoalescer coalescer;
+  std::atomic<int> sendCount{0};
+  std::vector<std::string> bodies(NumRequests);
+  std::vector<std::string> eTags(NumRequests);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < NumRequests; ++i)
+  {
+    threads.emplace_back([&, i]() {
+      Request request(HttpMethod::Get, Url(BlobUrl), false);
+      request.SetHeader("x-ms-range", "bytes=0-4");
+      auto response = coalescer.Send(request, Context(), [&]() {
+        ++sendCount;
+        // The response comes once the other requests wait for it.
+        EXPECT_TRUE(
+            WaitFor([&]() { return coalescer.GetCoalescedRequestCount() == NumRequests - 1; }));
+        return MakeResponse("hello");
+      });
+      bodies[i] = ReadBody(*response);
+      eTags[i] = response->GetHeaders().at("etag");
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  EXPECT_EQ(sendCount, 1);
+  for (size_t i = 0; i < NumRequests; ++i)
+  {
+    EXPECT_EQ(bodies[i], "hello");
+    EXPECT_EQ(eTags[i], "\"etag\"");
+  }
+
+  // A buffered response is copied to each request.
+  Request request(HttpMethod::Get, Url(BlobUrl));
+  auto response = coalescer.Send(request, Context(), [&]() {
+    auto buffered = std::make_unique<RawResponse>(1, 1, HttpStatusCode::Ok, "OK");
+    buffered->SetBody(std::vector<uint8_t>{1, 2, 3});
+    return buffered;
+  });
+  EXPECT_EQ(response->GetBody(), std::vector<uint8_t>({1, 2, 3}));
+}
+
+TEST(RequestCoalescer, DifferentRequestsNotCoalesced)
+{
+  RequestCoalescer coalescer;
+  std::atomic<int> sendCount{0};
+  auto sendRange = [&](std::string const& range) {
+    Request request(HttpMethod::Get, Url(BlobUrl), false);
+    request.SetHeader("x-ms-range", range);
+    auto response = coalescer.Send(request, Context(), [&]() {
+      ++sendCount;
+      // Both requests are sent before either gets a response.
+      EXPECT_TRUE(WaitFor([&]() { return sendCount == 2; }));
+      return MakeResponse(range);
+    });
+    EXPECT_EQ(ReadBody(*response), range);
+  };
+  std::thread first(sendRange, "bytes=0-4");
+  std::thread second(sendRange, "bytes=5-9");
+  first.join();
+  second.join();
+  EXPECT_EQ(coalescer.GetCoalescedRequestCount(), 0U);
+}
+
+TEST(RequestCoalescer, RequestsOfDifferentPrincipalsNotCoalesced)
+{
+  // The requests of the same principal are coalesced despite their request IDs and dates, those
+  // of another principal aren't.
+  RequestCoalescer coalescer;
+  std::atomic<int> sendCount{0};
+  auto sendAs = [&](std::string const& authorization, std::string const& requestId) {
+    Request request(HttpMethod::Get, Url(BlobUrl), false);
+    request.SetHeader("Authorization", authorization);
+    request.SetHeader("x-ms-client-request-id", requestId);
+    request.SetHeader("x-ms-date", requestId);
+    auto response = coalescer.Send(request, Context(), [&]() {
+      ++sendCount;
+      // Both principals send their request before either gets a response.
+      EXPECT_TRUE(WaitFor([&]() { return sendCount == 2; }));
+      EXPECT_TRUE(WaitFor([&]() { return coalescer.GetCoalescedRequestCount() == 1; }));
+      return MakeResponse(authorization);
+    });
+    EXPECT_EQ(ReadBody(*response), authorization);
+  };
+  std::thread first(sendAs, "Bearer first", "1");
+  EXPECT_TRUE(WaitFor([&]() { return sendCount == 1; }));
+  std::thread second(sendAs, "Bearer second", "2");
+  std::thread third(sendAs, "Bearer first", "3");
+  first.join();
+  second.join();
+  third.join();
+  EXPECT_EQ(sendCount, 2);
+  EXPECT_EQ(coalescer.GetCoalescedRequestCount(), 1U);
+}
+
+TEST(RequestCoalescer, LargeOrFailedResponsesNotShared)
+{
+  for (bool fail : {false, true})
+  {
+    RequestCoalescer coalescer(4);
+    std::atomic<int> sendCount{0};
+    auto sendRequest = [&]() {
+      Request request(HttpMethod::Get, Url(BlobUrl), false);
+      return coalescer.Send(request, Context(), [&]() -> std::unique_ptr<RawResponse> {
+        if (++sendCount == 1)
+        {
+          EXPECT_TRUE(WaitFor([&]() { return coalescer.GetCoalescedRequestCount() == 1; }));
+          if (fail)
+          {
+            throw TransportException("failed");
+          }
+        }
+        return MakeResponse("hello");
+      });
+    };
+
+    std::string firstBody;
+    std::thread first([&]() {
+      try
+      {
+        firstBody = ReadBody(*sendRequest());
+      }
+      catch (TransportException const&)
+      {
+        firstBody = "failed";
+      }
+    });
+    EXPECT_TRUE(WaitFor([&]() { return sendCount == 1; }));
+    // The waiting request is sent on its own once the first one gets its response.
+    auto second = sendRequest();
+    first.join();
+    EXPECT_EQ(ReadBody(*second), "hello");
+    EXPECT_EQ(firstBody, fail ? "failed" : "hello");
+    EXPECT_EQ(sendCount, 2);
+    EXPECT_EQ(coalescer.GetCoalescedRequestCount(), 1U);
+  }
+}
+
+TEST(RequestCoalescingPolicy, OnlyGetRequestsCoalesced)
+{
+  auto coalescer = std::make_shared<RequestCoalescer>();
+
+  class TransportPolicy final : public HttpPolicy {
+  public:
+    std::unique_ptr<RawResponse> Send(Request&, NextHttpPolicy, Context const&) const override
+    {
+      return MakeResponse("hello");
+    }
+
+    std::unique_ptr<HttpPolicy> Clone() const override
+    {
+      return std::make_unique<TransportPolicy>(*this);
+    }
+  };
+
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<RequestCoalescingPolicy>(coalescer));
+  policies.emplace_back(std::make_unique<TransportPolicy>());
+  Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+
+  Request get(HttpMethod::Get, Url(BlobUrl), false);
+  EXPECT_EQ(ReadBody(*pipeline.Send(get, Context())), "hello");
+  Request put(HttpMethod::Put, Url(BlobUrl), false);
+  EXPECT_EQ(ReadBody(*pipeline.Send(put, Context())), "hello");
+  EXPECT_EQ(coalescer->GetCoalescedRequestCount(), 0U);
+}
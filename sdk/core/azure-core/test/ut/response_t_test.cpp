@@ -3,12 +3,15 @@
 
 #include <gtest/gtest.h>
 
+#include <azure/core/async_response.hpp>
 #include <azure/core/http/http.hpp>
 #include <azure/core/response.hpp>
 
+#include <future>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
 
 using namespace Azure::Core;
 using namespace Azure::Core::Http;
@@ -57,3 +60,58 @@ TEST(ResponseT, value)
   // Fetch Value from const Response
   EXPECT_EQ(constFakeT, constResponse.Value);
 }
+
+#if defined(AZ_CORE_HAS_COROUTINES)
+namespace {
+struct DetachedTask final
+{
+  struct promise_type final
+  {
+    DetachedTask get_return_object() { return {}; }
+    std::suspend_never initial_suspend() { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+DetachedTask AwaitResponses(bool completeOnThread, std::promise<std::string>& result)
+{
+  try
+  {
+    auto response = co_await Azure::Core::ResponseAwaitable<std::string>(
+        [completeOnThread](Azure::Core::ResponseCallback<std::string> callback) {
+          if (!completeOnThread)
+          {
+            callback(Azure::Response<std::string>("value", nullptr), nullptr);
+            return;
+          }
+          std::thread([callback]() {
+            callback(Azure::Response<std::string>("value", nullptr), nullptr);
+          }).detach();
+        });
+    co_await Azure::Core::ResponseAwaitable<std::string>(
+        [&response](Azure::Core::ResponseCallback<std::string> callback) {
+          callback(
+              Azure::Nullable<Azure::Response<std::string>>(),
+              std::make_exception_ptr(std::runtime_error(response.Value)));
+        });
+  }
+  catch (std::runtime_error const& e)
+  {
+    result.set_value(e.what());
+  }
+}
+} // namespace
+
+TEST(ResponseT, awaitable)
+{
+  // The callback is called either before the coroutine is suspended, or after, from a thread.
+  for (bool completeOnThread : {false, true})
+  {
+    std::promise<std::string> result;
+    AwaitResponses(completeOnThread, result);
+    EXPECT_EQ(result.get_future().get(), "value");
+  }
+}
+#endif
@@ -7,6 +7,9 @@
 #include <gtest/gtest.h>
 
 #include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
 
 using namespace Azure::Core::Http;
 using namespace Azure::Core::Http::Policies;
@@ -717,3 +720,138 @@ TEST(RetryPolicy, RetryAfter)
     EXPECT_EQ(retryAfter, 90s);
   }
 }
+
+TEST(RetryPolicy, Budget)
+{
+  using namespace std::chrono_literals;
+
+  // Two retries in the bucket, a retry for two successful responses, and no refill over time.
+  auto budget = std::make_shared<RetryBudget>(0.5, 0.0, 2.0);
+  RetryOptions options{3, 0ms, 0ms, {HttpStatusCode::ServiceUnavailable}};
+
+  int32_t tryCount = 0;
+  auto statusCode = HttpStatusCode::ServiceUnavailable;
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<RetryPolicy>(options, budget));
+  policies.emplace_back(std::make_unique<TestTransportPolicy>([&]() {
+    ++tryCount;
+    return std::make_unique<RawResponse>(1, 1, statusCode, "");
+  }));
+  Azure::Core::Http::_internal::HttpPipeline pipeline(std::move(policies));
+
+  auto const send = [&]() {
+    tryCount = 0;
+    Request request(HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+    return pipeline.Send(request, Azure::Core::Context())->GetStatusCode();
+  };
+
+  // The first request spends the budget, and the next one isn't retried.
+  EXPECT_EQ(send(), HttpStatusCode::ServiceUnavailable);
+  EXPECT_EQ(tryCount, 3);
+  EXPECT_EQ(send(), HttpStatusCode::ServiceUnavailable);
+  EXPECT_EQ(tryCount, 1);
+
+  statusCode = HttpStatusCode::Ok;
+  EXPECT_EQ(send(), HttpStatusCode::Ok);
+  EXPECT_EQ(send(), HttpStatusCode::Ok);
+  EXPECT_EQ(budget->GetTokens(), 1.0);
+
+  statusCode = HttpStatusCode::ServiceUnavailable;
+  EXPECT_EQ(send(), HttpStatusCode::ServiceUnavailable);
+  EXPECT_EQ(tryCount, 2);
+}
+
+TEST(RetryPolicy, BudgetRefill)
+{
+  RetryBudget budget(0.1, 1000.0, 1.0);
+  EXPECT_TRUE(budget.TryWithdraw());
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_TRUE(budget.TryWithdraw());
+  EXPECT_LE(budget.GetTokens(), 1.0);
+}
+
+namespace {
+// Hangs until the context of the try is cancelled for the first tries, then responds.
+class HangingTransportPolicy final : public HttpPolicy {
+  int32_t m_hangingTryCount;
+  std::shared_ptr<int32_t> m_tryCount = std::make_shared<int32_t>(0);
+
+public:
+  explicit HangingTransportPolicy(int32_t hangingTryCount) : m_hangingTryCount(hangingTryCount) {}
+
+  std::shared_ptr<int32_t> GetTryCount() const { return m_tryCount; }
+
+  std::unique_ptr<RawResponse> Send(
+      Request&,
+      NextHttpPolicy,
+      Azure::Core::Context const& context) const override
+  {
+    if ((*m_tryCount)++ < m_hangingTryCount)
+    {
+      while (!context.IsCancelled())
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      context.ThrowIfCancelled();
+    }
+    return std::make_unique<RawResponse>(1, 1, HttpStatusCode::Ok, "OK");
+  }
+
+  std::unique_ptr<HttpPolicy> Clone() const override
+  {
+    return std::make_unique<HangingTransportPolicy>(*this);
+  }
+};
+} // namespace
+
+TEST(RetryPolicy, TryTimeout)
+{
+  using namespace std::chrono_literals;
+
+  RetryOptions options;
+  options.MaxRetries = 2;
+  options.RetryDelay = 0ms;
+  options.TryTimeout = 20ms;
+
+  auto transport = std::make_unique<HangingTransportPolicy>(2);
+  auto tryCount = transport->GetTryCount();
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<RetryPolicy>(options));
+  policies.emplace_back(std::move(transport));
+  Azure::Core::Http::_internal::HttpPipeline pipeline(std::move(policies));
+
+  Request request(HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+  EXPECT_EQ(pipeline.Send(request, Azure::Core::Context())->GetStatusCode(), HttpStatusCode::Ok);
+  EXPECT_EQ(*tryCount, 3);
+
+  // Once the retries are used up, the timeout is a transport failure.
+  *tryCount = 0;
+  options.MaxRetries = 1;
+  std::vector<std::unique_ptr<HttpPolicy>> failingPolicies;
+  failingPolicies.emplace_back(std::make_unique<RetryPolicy>(options));
+  failingPolicies.emplace_back(std::make_unique<HangingTransportPolicy>(2));
+  Azure::Core::Http::_internal::HttpPipeline failingPipeline(std::move(failingPolicies));
+  EXPECT_THROW(failingPipeline.Send(request, Azure::Core::Context()), TransportException);
+}
+
+TEST(RetryPolicy, OperationDeadlineIsNotRetried)
+{
+  using namespace std::chrono_literals;
+
+  RetryOptions options;
+  options.RetryDelay = 0ms;
+  options.TryTimeout = 1min;
+
+  auto transport = std::make_unique<HangingTransportPolicy>(1);
+  auto tryCount = transport->GetTryCount();
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<RetryPolicy>(options));
+  policies.emplace_back(std::move(transport));
+  Azure::Core::Http::_internal::HttpPipeline pipeline(std::move(policies));
+
+  Request request(HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+  auto context = Azure::Core::Context::ApplicationContext.WithDeadline(
+      std::chrono::system_clock::now() + 20ms);
+  EXPECT_THROW(pipeline.Send(request, context), Azure::Core::OperationCancelledException);
+  EXPECT_EQ(*tryCount, 1);
+}
@@ -18,3 +18,32 @@ TEST(SHA, SHA256Test)
   for (size_t i = 0; i != shaResult.size(); i++)
     printf("%02x", shaResult[i]);
 }
+
+TEST(SHA, Reset)
+{
+  uint8_t data[] = "A";
+  Sha256Hash sha256;
+  Sha384Hash sha384;
+  Sha512Hash sha512;
+  const auto expected256 = Sha256Hash().Final(data, sizeof(data));
+  const auto expected384 = Sha384Hash().Final(data, sizeof(data));
+  const auto expected512 = Sha512Hash().Final(data, sizeof(data));
+  for (int i = 0; i < 3; ++i)
+  {
+    // Partially appended data is discarded.
+    sha256.Append(data, 1);
+    sha256.Reset();
+    EXPECT_EQ(sha256.Final(data, sizeof(data)), expected256);
+    sha256.Reset();
+
+    sha384.Append(data, 1);
+    sha384.Reset();
+    EXPECT_EQ(sha384.Final(data, sizeof(data)), expected384);
+    sha384.Reset();
+
+    sha512.Append(data, 1);
+    sha512.Reset();
+    EXPECT_EQ(sha512.Final(data, sizeof(data)), expected512);
+    sha512.Reset();
+  }
+}
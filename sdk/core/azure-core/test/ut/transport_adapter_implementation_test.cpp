@@ -7,6 +7,7 @@
 #include <azure/core/http/transport.hpp>
 
 #if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
+#include "azure/core/http/curl_multi_transport.hpp"
 #include "azure/core/http/curl_transport.hpp"
 #endif
 
@@ -54,7 +55,9 @@ namespace Azure { namespace Core { namespace Test {
       TransportAdapter,
       testing::Values(
           GetTransportOptions("winHttp", std::make_shared<Azure::Core::Http::WinHttpTransport>()),
-          GetTransportOptions("libCurl", std::make_shared<Azure::Core::Http::CurlTransport>())),
+          GetTransportOptions("libCurl", std::make_shared<Azure::Core::Http::CurlTransport>()),
+          GetTransportOptions(
+              "libCurlMulti", std::make_shared<Azure::Core::Http::CurlMultiTransport>())),
       GetSuffix);
 
 #elif defined(BUILD_TRANSPORT_WINHTTP_ADAPTER)
@@ -72,7 +75,9 @@ namespace Azure { namespace Core { namespace Test {
       Test,
       TransportAdapter,
       testing::Values(
-          GetTransportOptions("libCurl", std::make_shared<Azure::Core::Http::CurlTransport>())),
+          GetTransportOptions("libCurl", std::make_shared<Azure::Core::Http::CurlTransport>()),
+          GetTransportOptions(
+              "libCurlMulti", std::make_shared<Azure::Core::Http::CurlMultiTransport>())),
       GetSuffix);
 #else
   /* Custom adapter. Not adding tests */
@@ -288,4 +288,50 @@ namespace Azure { namespace Core { namespace Test {
   {
     EXPECT_THROW(Core::Url url("http://test.com:99999999999999999"), std::out_of_range);
   }
+
+  TEST(URL, encodeDecodeAllBytes)
+  {
+    std::string allBytes;
+    for (int i = 0; i < 256; ++i)
+    {
+      allBytes += static_cast<char>(i);
+    }
+
+    auto const encoded = Core::Url::Encode(allBytes, "/");
+    // 66 unreserved characters and '/' aren't encoded.
+    EXPECT_EQ(encoded.size(), 67U + (256U - 67U) * 3U);
+    EXPECT_NE(encoded.find("%FF"), std::string::npos);
+    EXPECT_EQ(encoded.find("%2F"), std::string::npos);
+    EXPECT_EQ(Core::Url::Decode(encoded), allBytes);
+
+    // Invalid escapes, including bytes out of the ASCII range after the '%'.
+    EXPECT_THROW(Core::Url::Decode("%\xC3\xA9"), std::runtime_error);
+    EXPECT_THROW(Core::Url::Decode("%4"), std::runtime_error);
+    EXPECT_EQ(Core::Url::Decode("a+b%2fc"), "a b/c");
+  }
+
+  TEST(URL, urlEncoder)
+  {
+    Core::_internal::UrlEncoder const encoder("/:");
+    EXPECT_EQ(encoder.Encode("dir/sub dir:file~1.txt"), "dir/sub%20dir:file~1.txt");
+    EXPECT_EQ(encoder.Encode("plain-name_0.txt"), "plain-name_0.txt");
+    EXPECT_EQ(encoder.Encode(""), "");
+    EXPECT_EQ(encoder.Encode("\xE2\x82\xAC?"), "%E2%82%AC%3F");
+    EXPECT_EQ(encoder.Encode("a b?c/d"), Core::Url::Encode("a b?c/d", "/:"));
+    EXPECT_EQ(Core::_internal::UrlEncoder().Encode("a/b"), Core::Url::Encode("a/b"));
+  }
+
+  TEST(URL, absoluteAndRelativeUrl)
+  {
+    Core::Url url("https://account.blob.core.windows.net:8443/container/blob?b=2&a=1");
+    url.AppendQueryParameter("c", "3");
+    EXPECT_EQ(
+        url.GetAbsoluteUrl(),
+        "https://account.blob.core.windows.net:8443/container/blob?a=1&b=2&c=3");
+    EXPECT_EQ(url.GetRelativeUrl(), "container/blob?a=1&b=2&c=3");
+
+    Core::Url empty;
+    EXPECT_EQ(empty.GetAbsoluteUrl(), "");
+    EXPECT_EQ(empty.GetRelativeUrl(), "");
+  }
 }}} // namespace Azure::Core::Test
@@ -5,6 +5,8 @@
 #include <gtest/gtest.h>
 #include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace Azure::Core;
 
@@ -70,3 +72,41 @@ TEST(Uuid, validChars)
       uuidKey,
       4);
 }
+
+TEST(Uuid, Version)
+{
+  // Enough UUIDs to draw random bytes several times.
+  for (int i = 0; i < 1000; i++)
+  {
+    auto uuidKey = Uuid::CreateUuid().ToString();
+    EXPECT_EQ(uuidKey[14], '4');
+  }
+}
+
+TEST(Uuid, RandomnessAcrossThreads)
+{
+  const int numThreads = 8;
+  const int size = 10000;
+  std::vector<std::vector<std::string>> uuids(numThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < numThreads; i++)
+  {
+    threads.emplace_back([&uuids, i]() {
+      for (int j = 0; j < size; j++)
+      {
+        uuids[i].push_back(Uuid::CreateUuid().ToString());
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  std::set<std::string> allUuids;
+  for (auto const& threadUuids : uuids)
+  {
+    allUuids.insert(threadUuids.begin(), threadUuids.end());
+  }
+  EXPECT_EQ(allUuids.size(), static_cast<size_t>(numThreads * size));
+}
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "azure/perf/argagg.hpp"
+#include "azure/perf/async_test.hpp"
 #include "azure/perf/base_test.hpp"
 #include "azure/perf/dynamic_test_options.hpp"
 #include "azure/perf/options.hpp"
@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Count the heap allocations of a performance test application.
+ *
+ * @remark The allocations are only counted by the applications which include
+ * `azure/perf/allocation_hook.hpp`.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace Azure { namespace Perf { namespace _detail {
+  /**
+   * @brief Count a heap allocation. Called by the `operator new` of
+   * `azure/perf/allocation_hook.hpp`.
+   *
+   */
+  void CountAllocation() noexcept;
+
+  /**
+   * @brief Declare that the application counts its heap allocations.
+   *
+   */
+  void EnableAllocationCounting() noexcept;
+
+  /**
+   * @brief Whether the application counts its heap allocations.
+   *
+   */
+  bool IsAllocationCountingEnabled() noexcept;
+
+  /**
+   * @brief Get the number of heap allocations counted since the application started.
+   *
+   */
+  uint64_t GetAllocationCount() noexcept;
+}}} // namespace Azure::Perf::_detail
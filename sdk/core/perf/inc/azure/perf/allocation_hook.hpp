@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Replace the global `operator new` to count the heap allocations of a performance test
+ * application, which the framework then reports per operation.
+ *
+ * @remark Include this header in exactly one source file of the application, such as the one
+ * with `main()`. The counting adds an atomic increment to each allocation.
+ *
+ */
+
+#pragma once
+
+#include "azure/perf/allocation_counter.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace Azure { namespace Perf { namespace _detail {
+  namespace {
+    void* AllocateCounted(std::size_t size) noexcept
+    {
+      CountAllocation();
+      return std::malloc(size == 0 ? 1 : size);
+    }
+
+    struct AllocationCountingRegistration final
+    {
+      AllocationCountingRegistration() { EnableAllocationCounting(); }
+    } const g_allocationCountingRegistration;
+  } // namespace
+}}} // namespace Azure::Perf::_detail
+
+void* operator new(std::size_t size)
+{
+  if (auto const memory = Azure::Perf::_detail::AllocateCounted(size))
+  {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+  if (auto const memory = Azure::Perf::_detail::AllocateCounted(size))
+  {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept
+{
+  return Azure::Perf::_detail::AllocateCounted(size);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept
+{
+  return Azure::Perf::_detail::AllocateCounted(size);
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+
+void operator delete[](void* memory) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::nothrow_t const&) noexcept { std::free(memory); }
+
+void operator delete[](void* memory, std::nothrow_t const&) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
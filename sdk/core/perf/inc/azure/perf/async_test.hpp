@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Define a Performance test whose operations complete asynchronously.
+ *
+ */
+
+#pragma once
+
+#include "azure/perf/test.hpp"
+
+#include <exception>
+#include <functional>
+#include <future>
+
+namespace Azure { namespace Perf {
+  /**
+   * @brief Define a performance test whose operations complete asynchronously.
+   *
+   * @remark The framework runs `Parallel` operations concurrently, starting the next operation of
+   * each from a small pool of threads when the previous one completes. It doesn't use a thread per
+   * operation, so that a high `Parallel` measures the SDK and not the thread scheduling.
+   *
+   */
+  class PerfTestAsync : public Azure::Perf::PerfTest {
+  public:
+    /**
+     * @brief Construct a new asynchronous Performance Test.
+     *
+     * @param options The command-line parsed options.
+     */
+    PerfTestAsync(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Start the main test case.
+     *
+     * @remark \p completion can be called from any thread, including from `RunAsync` itself. The
+     * next operation of the test instance starts once it's called.
+     *
+     * @param context The cancellation token.
+     * @param completion The function to call once the operation completes, with the exception
+     * that failed it if any.
+     */
+    virtual void RunAsync(
+        Azure::Core::Context const& context,
+        std::function<void(std::exception_ptr error)> completion)
+        = 0;
+
+    /**
+     * @brief Run the main test case, waiting for #RunAsync to complete.
+     *
+     * @param context The cancellation token.
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      std::promise<void> completed;
+      RunAsync(context, [&completed](std::exception_ptr error) {
+        if (error)
+        {
+          completed.set_exception(error);
+        }
+        else
+        {
+          completed.set_value();
+        }
+      });
+      completed.get_future().get();
+    }
+  };
+}} // namespace Azure::Perf
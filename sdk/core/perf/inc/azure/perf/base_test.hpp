@@ -13,6 +13,7 @@
 
 #include "azure/perf/test_options.hpp"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -56,6 +57,16 @@ namespace Azure { namespace Perf {
       return std::vector<Azure::Perf::TestOption>();
     };
 
+    /**
+     * @brief Gets the number of bytes processed by an operation of the test.
+     *
+     * @remark When it's not 0, the results also report the throughput in MiB per second and the
+     * duration of an operation in nanoseconds, which suits the microbenchmarks of CPU-bound code.
+     *
+     * @return The number of bytes processed by an operation. Default to 0.
+     */
+    virtual int64_t GetBytesPerOperation() { return 0; }
+
     /**
      * @brief Define the main test case.
      *
@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief An HTTP transport adapter answering every request with the same response, without any
+ * network. Useful to measure the CPU cost of a client and its pipeline.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/context.hpp>
+#include <azure/core/http/http.hpp>
+#include <azure/core/http/transport.hpp>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Azure { namespace Perf {
+
+  /**
+   * @brief An HTTP transport adapter answering every request with the same response, without any
+   * network.
+   *
+   * @remark The request body, if any, is read to its end like a transport sending it would. The
+   * body stream of the responses reads from the transport, which must then outlive them. It can
+   * be shared by concurrent requests.
+   *
+   */
+  class CannedResponseTransport final : public Azure::Core::Http::HttpTransport {
+  private:
+    Azure::Core::Http::HttpStatusCode m_statusCode;
+    std::map<std::string, std::string> m_headers;
+    std::vector<uint8_t> m_body;
+
+  public:
+    /**
+     * @brief Construct a transport adapter answering with a response.
+     *
+     * @remark A `Content-Length` header with the size of \p body is added when \p headers doesn't
+     * have one.
+     *
+     * @param statusCode The status code of the responses.
+     * @param headers The headers of the responses.
+     * @param body The body of the responses.
+     */
+    CannedResponseTransport(
+        Azure::Core::Http::HttpStatusCode statusCode,
+        std::map<std::string, std::string> headers,
+        std::vector<uint8_t> body = {});
+
+    /**
+     * @brief Construct a transport adapter answering with a response.
+     *
+     * @param statusCode The status code of the responses.
+     * @param headers The headers of the responses.
+     * @param body The body of the responses, such as a JSON or an XML document.
+     */
+    CannedResponseTransport(
+        Azure::Core::Http::HttpStatusCode statusCode,
+        std::map<std::string, std::string> headers,
+        std::string const& body)
+        : CannedResponseTransport(
+            statusCode,
+            std::move(headers),
+            std::vector<uint8_t>(body.begin(), body.end()))
+    {
+    }
+
+    /**
+     * @brief Answer a request with the canned response.
+     *
+     * @param request The request to answer.
+     * @param context A context to control the request lifetime.
+     *
+     * @return The canned response.
+     */
+    std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+        Azure::Core::Http::Request& request,
+        Azure::Core::Context const& context) override;
+  };
+}} // namespace Azure::Perf
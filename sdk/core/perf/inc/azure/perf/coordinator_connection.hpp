@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief The TCP connections between the coordinator of a distributed run and its workers.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Azure { namespace Perf { namespace _detail {
+
+#if defined(_WIN32)
+  using SocketHandle = uintptr_t;
+#else
+  using SocketHandle = int;
+#endif
+
+  /**
+   * @brief A TCP connection exchanging lines of text.
+   *
+   */
+  class CoordinatorConnection final {
+  private:
+    SocketHandle m_socket;
+    std::string m_received;
+
+  public:
+    /**
+     * @brief Take ownership of a connected socket.
+     *
+     */
+    explicit CoordinatorConnection(SocketHandle socket);
+
+    /**
+     * @brief Close the connection.
+     *
+     */
+    ~CoordinatorConnection();
+
+    CoordinatorConnection(CoordinatorConnection const&) = delete;
+    CoordinatorConnection& operator=(CoordinatorConnection const&) = delete;
+
+    /**
+     * @brief Connect to the coordinator listening at \p address, as `host:port`.
+     *
+     * @throw std::runtime_error The address is invalid or the connection failed.
+     */
+    static std::unique_ptr<CoordinatorConnection> Connect(std::string const& address);
+
+    /**
+     * @brief Send a line, which mustn't contain a line feed.
+     *
+     * @throw std::runtime_error The connection was closed.
+     */
+    void SendLine(std::string const& line);
+
+    /**
+     * @brief Receive the next line, without its line feed.
+     *
+     * @throw std::runtime_error The connection was closed.
+     */
+    std::string ReceiveLine();
+  };
+
+  /**
+   * @brief Listen for the connections of the workers of a distributed run, on all the interfaces.
+   *
+   */
+  class CoordinatorListener final {
+  private:
+    SocketHandle m_socket;
+    uint16_t m_port = 0;
+
+  public:
+    /**
+     * @brief Start listening on \p port, or on an ephemeral port when it's 0.
+     *
+     * @throw std::runtime_error The socket couldn't be created, bound or listened to.
+     */
+    explicit CoordinatorListener(uint16_t port);
+
+    /**
+     * @brief Stop listening.
+     *
+     */
+    ~CoordinatorListener();
+
+    CoordinatorListener(CoordinatorListener const&) = delete;
+    CoordinatorListener& operator=(CoordinatorListener const&) = delete;
+
+    /**
+     * @brief Get the port listened on.
+     *
+     */
+    uint16_t GetPort() const { return m_port; }
+
+    /**
+     * @brief Wait for the next worker to connect.
+     *
+     * @throw std::runtime_error The connection couldn't be accepted.
+     */
+    std::unique_ptr<CoordinatorConnection> Accept();
+  };
+
+}}} // namespace Azure::Perf::_detail
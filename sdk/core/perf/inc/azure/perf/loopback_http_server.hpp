@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief An HTTP/1.1 server listening on the loopback interface, to measure the throughput of an
+ * HTTP transport adapter without any remote service.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Perf {
+
+  /**
+   * @brief An HTTP/1.1 server listening on an ephemeral port of `127.0.0.1`, answering every
+   * request with a body of the requested size.
+   *
+   * @remark The query of the request defines the response:
+   * - `size`: The size of the body in bytes. Defaults to 0.
+   * - `chunked`: When `true`, the body is sent with the chunked transfer encoding instead of a
+   * `Content-Length`.
+   * - `chunkSize`: The size of each chunk in bytes, with `chunked=true`. Defaults to 16 KiB.
+   *
+   * The request body, if any, is read and discarded. Connections are kept alive unless the
+   * request has a `Connection: close` header. Each connection is served by its own thread, and the
+   * server is stopped when destroyed.
+   */
+  class LoopbackHttpServer final {
+  public:
+#if defined(_WIN32)
+    using SocketHandle = uintptr_t;
+#else
+    using SocketHandle = int;
+#endif
+
+  private:
+    struct Connection final
+    {
+      SocketHandle Socket;
+      std::thread Thread;
+    };
+
+    SocketHandle m_listenSocket;
+    uint16_t m_port = 0;
+    std::atomic<bool> m_isStopping{false};
+    std::thread m_acceptThread;
+    std::mutex m_connectionsMutex;
+    std::vector<Connection> m_connections;
+
+    void Accept();
+    void Serve(SocketHandle connectionSocket, size_t connectionIndex);
+
+  public:
+    /**
+     * @brief Start listening on an ephemeral port of the loopback interface.
+     *
+     * @throw std::runtime_error The socket couldn't be created, bound or listened to.
+     */
+    LoopbackHttpServer();
+
+    /**
+     * @brief Stop the server, closing the connections.
+     *
+     */
+    ~LoopbackHttpServer();
+
+    LoopbackHttpServer(LoopbackHttpServer const&) = delete;
+    LoopbackHttpServer& operator=(LoopbackHttpServer const&) = delete;
+
+    /**
+     * @brief Get the port the server listens on.
+     *
+     */
+    uint16_t GetPort() const { return m_port; }
+
+    /**
+     * @brief Get the URL of the server, `http://127.0.0.1:<port>/`.
+     *
+     */
+    std::string GetUrl() const { return "http://127.0.0.1:" + std::to_string(m_port) + "/"; }
+  };
+}} // namespace Azure::Perf
@@ -28,6 +28,26 @@ namespace Azure { namespace Perf {
    */
   struct GlobalTestOptions
   {
+    /**
+     * @brief JSON results file of a previous run of the test, to compare the throughput of the
+     * iterations to.
+     *
+     */
+    std::string Baseline;
+
+    /**
+     * @brief Address of the coordinator of a distributed run, as `host:port`, to run as one of
+     * its workers.
+     *
+     */
+    std::string Coordinator;
+
+    /**
+     * @brief Port the coordinator of a distributed run listens on for its workers.
+     *
+     */
+    int CoordinatorPort = 7777;
+
     /**
      * @brief Define the duration of test in seconds
      *
@@ -90,12 +110,33 @@ namespace Azure { namespace Perf {
      */
     Azure::Nullable<int> Rate;
 
+    /**
+     * @brief Decrease of the mean throughput compared to the baseline, in percent, reported as a
+     * regression when it's also significant.
+     *
+     */
+    int RegressionThreshold = 5;
+
+    /**
+     * @brief File to write the results of each test iteration to, as CSV if its name ends with
+     * `.csv` and as JSON otherwise.
+     *
+     */
+    std::string ResultsFile;
+
     /**
      * @brief Duration of warmup in seconds.
      *
      */
     int Warmup = 5;
 
+    /**
+     * @brief Number of worker processes to coordinate, which makes this process the coordinator
+     * of a distributed run instead of running the test.
+     *
+     */
+    int Workers = 0;
+
     /**
      * @brief Create an array of the performance framework options.
      *
@@ -23,17 +23,17 @@ namespace Azure { namespace Perf {
   class RandomStream {
   private:
     /**
-     * @brief Wraps a stream and keep reading bytes from it by rewinding it until some length.
+     * @brief Reads a block of random bytes, generated once per process, over and over until some
+     * length.
      *
-     * @note Enables to create a stream with huge size by re-using a small buffer.
+     * @note Enables to create a stream with huge size without generating random bytes for each
+     * stream, so reading it costs a copy.
      *
      */
     class CircularStream : public Azure::Core::IO::BodyStream {
     private:
-      std::unique_ptr<std::vector<uint8_t>> m_buffer;
       size_t m_length;
       size_t m_totalRead = 0;
-      Azure::Core::IO::MemoryBodyStream m_memoryStream;
 
       size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
 
@@ -44,10 +44,47 @@ namespace Azure { namespace Perf {
       void Rewind() override { m_totalRead = 0; }
     };
 
+    /**
+     * @brief Reads the same byte until some length, without reading any memory.
+     *
+     */
+    class RepeatedStream : public Azure::Core::IO::BodyStream {
+    private:
+      size_t m_length;
+      uint8_t m_value;
+      size_t m_totalRead = 0;
+
+      size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
+
+    public:
+      RepeatedStream(size_t size, uint8_t value) : m_length(size), m_value(value) {}
+
+      int64_t Length() const override { return this->m_length; }
+      void Rewind() override { m_totalRead = 0; }
+    };
+
   public:
+    /**
+     * @brief Creates a stream of \p size random bytes.
+     *
+     * @remark The bytes repeat a block of 1 MiB shared by all the streams.
+     */
     static std::unique_ptr<Azure::Core::IO::BodyStream> Create(size_t size)
     {
       return std::make_unique<CircularStream>(size);
     }
+
+    /**
+     * @brief Creates a stream of \p size bytes all equal to \p value.
+     *
+     * @remark Reading it only fills the buffer, so upload tests measure the transfer rather than
+     * the reading of the body. The content is trivially compressible.
+     */
+    static std::unique_ptr<Azure::Core::IO::BodyStream> CreateRepeated(
+        size_t size,
+        uint8_t value = 0)
+    {
+      return std::make_unique<RepeatedStream>(size, value);
+    }
   };
 }} // namespace Azure::Perf
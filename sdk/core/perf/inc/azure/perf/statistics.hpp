@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Summarize the results of the iterations of a test, and compare them to a baseline.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Azure { namespace Perf { namespace _detail {
+  /**
+   * @brief The summary of a sample of measurements, like the throughputs of the iterations.
+   *
+   */
+  struct SampleSummary final
+  {
+    size_t Count = 0;
+    double Mean = 0;
+    /**
+     * @brief The sample standard deviation, 0 with less than two measurements.
+     *
+     */
+    double StandardDeviation = 0;
+    /**
+     * @brief Half the width of the 95% confidence interval of the mean, from the Student's t
+     * distribution, 0 with less than two measurements.
+     *
+     */
+    double ConfidenceInterval = 0;
+  };
+
+  /**
+   * @brief Summarize a sample of measurements.
+   *
+   */
+  SampleSummary Summarize(std::vector<double> const& values);
+
+  /**
+   * @brief Whether the mean of \p sample is lower than the mean of \p baseline, with a 95%
+   * confidence, according to a one-sided Welch's t-test.
+   *
+   * @remark Both samples need at least two measurements to be compared, otherwise the difference
+   * is never significant.
+   */
+  bool IsSignificantlyLower(SampleSummary const& sample, SampleSummary const& baseline);
+}}} // namespace Azure::Perf::_detail
@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/perf/allocation_counter.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+// The allocations are counted in several counters, each on its own cache line, so that the
+// threads of a parallel test don't contend on one.
+constexpr size_t AllocationCounterCount = 16;
+
+struct alignas(64) AllocationCounter final
+{
+  std::atomic<uint64_t> Count;
+};
+
+// Zero-initialized before any dynamic initialization, since operator new can be called before.
+AllocationCounter g_allocationCounters[AllocationCounterCount];
+std::atomic<bool> g_isAllocationCountingEnabled;
+
+size_t GetAllocationCounterIndex() noexcept
+{
+  // The address of a thread local variable is distinct for each thread, without the dynamic
+  // initialization of a thread local index.
+  // The thread local storage of the threads is aligned the same way, so the address is hashed.
+  thread_local char threadMarker;
+  auto const address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&threadMarker));
+  return static_cast<size_t>((address * 0x9E3779B97F4A7C15ULL) >> 60) % AllocationCounterCount;
+}
+} // namespace
+
+void Azure::Perf::_detail::CountAllocation() noexcept
+{
+  g_allocationCounters[GetAllocationCounterIndex()].Count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Azure::Perf::_detail::EnableAllocationCounting() noexcept
+{
+  g_isAllocationCountingEnabled.store(true, std::memory_order_relaxed);
+}
+
+bool Azure::Perf::_detail::IsAllocationCountingEnabled() noexcept
+{
+  return g_isAllocationCountingEnabled.load(std::memory_order_relaxed);
+}
+
+uint64_t Azure::Perf::_detail::GetAllocationCount() noexcept
+{
+  uint64_t count = 0;
+  for (auto const& counter : g_allocationCounters)
+  {
+    count += counter.Count.load(std::memory_order_relaxed);
+  }
+  return count;
+}
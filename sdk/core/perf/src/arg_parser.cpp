@@ -49,6 +49,18 @@ Azure::Perf::GlobalTestOptions Azure::Perf::Program::ArgParser::Parse(
     argagg::parser_results const& parsedArgs)
 {
   Azure::Perf::GlobalTestOptions options;
+  if (parsedArgs["Baseline"])
+  {
+    options.Baseline = parsedArgs["Baseline"].as<std::string>();
+  }
+  if (parsedArgs["Coordinator"])
+  {
+    options.Coordinator = parsedArgs["Coordinator"].as<std::string>();
+  }
+  if (parsedArgs["CoordinatorPort"])
+  {
+    options.CoordinatorPort = parsedArgs["CoordinatorPort"];
+  }
   if (parsedArgs["Duration"])
   {
     options.Duration = parsedArgs["Duration"];
@@ -89,10 +101,22 @@ Azure::Perf::GlobalTestOptions Azure::Perf::Program::ArgParser::Parse(
   {
     options.Rate = parsedArgs["Rate"];
   }
+  if (parsedArgs["RegressionThreshold"])
+  {
+    options.RegressionThreshold = parsedArgs["RegressionThreshold"];
+  }
+  if (parsedArgs["ResultsFile"])
+  {
+    options.ResultsFile = parsedArgs["ResultsFile"].as<std::string>();
+  }
   if (parsedArgs["Warmup"])
   {
     options.Warmup = parsedArgs["Warmup"];
   }
+  if (parsedArgs["Workers"])
+  {
+    options.Workers = parsedArgs["Workers"];
+  }
 
   return options;
 }
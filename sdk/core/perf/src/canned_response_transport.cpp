@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/perf/canned_response_transport.hpp"
+
+#include <azure/core/internal/strings.hpp>
+#include <azure/core/io/body_stream.hpp>
+
+#include <algorithm>
+
+using Azure::Core::Context;
+using namespace Azure::Core::Http;
+
+Azure::Perf::CannedResponseTransport::CannedResponseTransport(
+    HttpStatusCode statusCode,
+    std::map<std::string, std::string> headers,
+    std::vector<uint8_t> body)
+    : m_statusCode(statusCode), m_headers(std::move(headers)), m_body(std::move(body))
+{
+  auto const hasContentLength
+      = std::any_of(m_headers.begin(), m_headers.end(), [](auto const& header) {
+          return Azure::Core::_internal::StringExtensions::LocaleInvariantCaseInsensitiveEqual(
+              header.first, "Content-Length");
+        });
+  if (!hasContentLength)
+  {
+    m_headers.emplace("Content-Length", std::to_string(m_body.size()));
+  }
+}
+
+std::unique_ptr<RawResponse> Azure::Perf::CannedResponseTransport::Send(
+    Request& request,
+    Context const& context)
+{
+  context.ThrowIfCancelled();
+
+  if (auto const bodyStream = request.GetBodyStream())
+  {
+    uint8_t buffer[16 * 1024];
+    while (bodyStream->Read(buffer, sizeof(buffer), context) != 0)
+    {
+    }
+  }
+
+  auto response = std::make_unique<RawResponse>(1, 1, m_statusCode, "");
+  for (auto const& header : m_headers)
+  {
+    response->SetHeader(header.first, header.second);
+  }
+  response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(m_body));
+  return response;
+}
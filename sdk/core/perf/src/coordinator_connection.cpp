@@ -0,0 +1,218 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/perf/coordinator_connection.hpp"
+
+#if defined(_WIN32)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <stdexcept>
+
+using Azure::Perf::_detail::CoordinatorConnection;
+using Azure::Perf::_detail::CoordinatorListener;
+using Azure::Perf::_detail::SocketHandle;
+
+namespace {
+#if defined(_WIN32)
+constexpr SocketHandle InvalidSocket = INVALID_SOCKET;
+constexpr int SendFlags = 0;
+
+void CloseSocket(SocketHandle socket) { closesocket(socket); }
+
+void StartSockets()
+{
+  WSADATA wsaData;
+  if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+  {
+    throw std::runtime_error("Failed to initialize Winsock.");
+  }
+}
+
+void StopSockets() { WSACleanup(); }
+#else
+constexpr SocketHandle InvalidSocket = -1;
+#if defined(MSG_NOSIGNAL)
+constexpr int SendFlags = MSG_NOSIGNAL;
+#else
+constexpr int SendFlags = 0;
+#endif
+
+void CloseSocket(SocketHandle socket) { close(socket); }
+
+void StartSockets() {}
+
+void StopSockets() {}
+#endif
+
+constexpr size_t ReceiveBufferSize = 4096;
+
+// The messages are small and answered right away.
+void SetNoDelay(SocketHandle socket)
+{
+  int const noDelay = 1;
+  setsockopt(
+      socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char const*>(&noDelay), sizeof(noDelay));
+#if defined(SO_NOSIGPIPE)
+  int const noSigPipe = 1;
+  setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+}
+} // namespace
+
+CoordinatorConnection::CoordinatorConnection(SocketHandle socket) : m_socket(socket)
+{
+  StartSockets();
+  SetNoDelay(m_socket);
+}
+
+CoordinatorConnection::~CoordinatorConnection()
+{
+  CloseSocket(m_socket);
+  StopSockets();
+}
+
+std::unique_ptr<CoordinatorConnection> CoordinatorConnection::Connect(std::string const& address)
+{
+  auto const colon = address.rfind(':');
+  if (colon == std::string::npos || colon == 0 || colon + 1 == address.size())
+  {
+    throw std::runtime_error("The coordinator address " + address + " isn't host:port.");
+  }
+  auto const host = address.substr(0, colon);
+  auto const port = address.substr(colon + 1);
+
+  StartSockets();
+  addrinfo hints{};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_protocol = IPPROTO_TCP;
+  addrinfo* addresses = nullptr;
+  if (getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses) != 0)
+  {
+    StopSockets();
+    throw std::runtime_error("Failed to resolve the coordinator address " + address + ".");
+  }
+  auto socketHandle = InvalidSocket;
+  for (auto candidate = addresses; candidate != nullptr; candidate = candidate->ai_next)
+  {
+    socketHandle = socket(candidate->ai_family, candidate->ai_socktype, candidate->ai_protocol);
+    if (socketHandle == InvalidSocket)
+    {
+      continue;
+    }
+    if (connect(socketHandle, candidate->ai_addr, static_cast<int>(candidate->ai_addrlen)) == 0)
+    {
+      break;
+    }
+    CloseSocket(socketHandle);
+    socketHandle = InvalidSocket;
+  }
+  freeaddrinfo(addresses);
+  if (socketHandle == InvalidSocket)
+  {
+    StopSockets();
+    throw std::runtime_error("Failed to connect to the coordinator at " + address + ".");
+  }
+  auto connection = std::make_unique<CoordinatorConnection>(socketHandle);
+  StopSockets();
+  return connection;
+}
+
+void CoordinatorConnection::SendLine(std::string const& line)
+{
+  auto const message = line + '\n';
+  for (size_t offset = 0; offset != message.size();)
+  {
+    auto const sent = send(
+        m_socket, message.data() + offset, static_cast<int>(message.size() - offset), SendFlags);
+    if (sent <= 0)
+    {
+      throw std::runtime_error("The connection between the coordinator and a worker was closed.");
+    }
+    offset += static_cast<size_t>(sent);
+  }
+}
+
+std::string CoordinatorConnection::ReceiveLine()
+{
+  while (true)
+  {
+    auto const lineEnd = m_received.find('\n');
+    if (lineEnd != std::string::npos)
+    {
+      auto line = m_received.substr(0, lineEnd);
+      m_received.erase(0, lineEnd + 1);
+      return line;
+    }
+    char buffer[ReceiveBufferSize];
+    auto const received = recv(m_socket, buffer, static_cast<int>(sizeof(buffer)), 0);
+    if (received <= 0)
+    {
+      throw std::runtime_error("The connection between the coordinator and a worker was closed.");
+    }
+    m_received.append(buffer, static_cast<size_t>(received));
+  }
+}
+
+CoordinatorListener::CoordinatorListener(uint16_t port)
+{
+  StartSockets();
+  m_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (m_socket == InvalidSocket)
+  {
+    StopSockets();
+    throw std::runtime_error("Failed to create the coordinator socket.");
+  }
+  int const reuseAddress = 1;
+  setsockopt(
+      m_socket,
+      SOL_SOCKET,
+      SO_REUSEADDR,
+      reinterpret_cast<char const*>(&reuseAddress),
+      sizeof(reuseAddress));
+
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(port);
+  socklen_t addressSize = sizeof(address);
+  if (bind(m_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+      || listen(m_socket, SOMAXCONN) != 0
+      || getsockname(m_socket, reinterpret_cast<sockaddr*>(&address), &addressSize) != 0)
+  {
+    CloseSocket(m_socket);
+    StopSockets();
+    throw std::runtime_error("Failed to listen on port " + std::to_string(port) + ".");
+  }
+  m_port = ntohs(address.sin_port);
+}
+
+CoordinatorListener::~CoordinatorListener()
+{
+  CloseSocket(m_socket);
+  StopSockets();
+}
+
+std::unique_ptr<CoordinatorConnection> CoordinatorListener::Accept()
+{
+  auto const connectionSocket = accept(m_socket, nullptr, nullptr);
+  if (connectionSocket == InvalidSocket)
+  {
+    throw std::runtime_error("Failed to accept the connection of a worker.");
+  }
+  return std::make_unique<CoordinatorConnection>(connectionSocket);
+}
@@ -0,0 +1,402 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/perf/loopback_http_server.hpp"
+
+#include <azure/core/internal/strings.hpp>
+
+#if defined(_WIN32)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+using Azure::Perf::LoopbackHttpServer;
+
+namespace {
+#if defined(_WIN32)
+constexpr LoopbackHttpServer::SocketHandle InvalidSocket = INVALID_SOCKET;
+constexpr int ShutdownBoth = SD_BOTH;
+constexpr int SendFlags = 0;
+
+void CloseSocket(LoopbackHttpServer::SocketHandle socket) { closesocket(socket); }
+#else
+constexpr LoopbackHttpServer::SocketHandle InvalidSocket = -1;
+constexpr int ShutdownBoth = SHUT_RDWR;
+#if defined(MSG_NOSIGNAL)
+constexpr int SendFlags = MSG_NOSIGNAL;
+#else
+constexpr int SendFlags = 0;
+#endif
+
+void CloseSocket(LoopbackHttpServer::SocketHandle socket) { close(socket); }
+#endif
+
+constexpr size_t ReceiveBufferSize = 16 * 1024;
+constexpr size_t DefaultChunkSize = 16 * 1024;
+
+// The bodies are sent from this buffer, large enough to make few send calls.
+std::vector<char> const& GetBodyBuffer()
+{
+  static std::vector<char> const buffer(256 * 1024, 'x');
+  return buffer;
+}
+
+bool SendAll(LoopbackHttpServer::SocketHandle socket, char const* data, size_t size)
+{
+  while (size != 0)
+  {
+    auto const chunk = static_cast<int>(std::min<size_t>(size, 1024 * 1024 * 1024));
+    auto const sent = send(socket, data, chunk, SendFlags);
+    if (sent <= 0)
+    {
+      return false;
+    }
+    data += sent;
+    size -= static_cast<size_t>(sent);
+  }
+  return true;
+}
+
+bool SendBody(LoopbackHttpServer::SocketHandle socket, size_t size)
+{
+  auto const& buffer = GetBodyBuffer();
+  while (size != 0)
+  {
+    auto const chunk = std::min(size, buffer.size());
+    if (!SendAll(socket, buffer.data(), chunk))
+    {
+      return false;
+    }
+    size -= chunk;
+  }
+  return true;
+}
+
+struct RequestTarget final
+{
+  size_t Size = 0;
+  bool IsChunked = false;
+  size_t ChunkSize = DefaultChunkSize;
+};
+
+RequestTarget ParseTarget(std::string const& target)
+{
+  RequestTarget result;
+  auto const queryStart = target.find('?');
+  if (queryStart == std::string::npos)
+  {
+    return result;
+  }
+
+  size_t position = queryStart + 1;
+  while (position < target.size())
+  {
+    auto end = target.find('&', position);
+    if (end == std::string::npos)
+    {
+      end = target.size();
+    }
+    auto const parameter = target.substr(position, end - position);
+    auto const equal = parameter.find('=');
+    auto const name = parameter.substr(0, equal);
+    auto const value = equal == std::string::npos ? std::string() : parameter.substr(equal + 1);
+    if (name == "size")
+    {
+      result.Size = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+    }
+    else if (name == "chunked")
+    {
+      result.IsChunked = value == "true";
+    }
+    else if (name == "chunkSize")
+    {
+      result.ChunkSize = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+    }
+    position = end + 1;
+  }
+  if (result.ChunkSize == 0)
+  {
+    result.ChunkSize = DefaultChunkSize;
+  }
+  return result;
+}
+
+bool SendResponse(
+    LoopbackHttpServer::SocketHandle socket,
+    RequestTarget const& target,
+    bool hasBody,
+    bool closeConnection)
+{
+  std::string headers = "HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\n";
+  if (closeConnection)
+  {
+    headers += "Connection: close\r\n";
+  }
+  if (target.IsChunked)
+  {
+    headers += "Transfer-Encoding: chunked\r\n\r\n";
+  }
+  else
+  {
+    headers += "Content-Length: " + std::to_string(target.Size) + "\r\n\r\n";
+  }
+  if (!SendAll(socket, headers.data(), headers.size()))
+  {
+    return false;
+  }
+  if (!hasBody)
+  {
+    return true;
+  }
+
+  if (!target.IsChunked)
+  {
+    return SendBody(socket, target.Size);
+  }
+  for (size_t remaining = target.Size; remaining != 0;)
+  {
+    auto const chunk = std::min(remaining, target.ChunkSize);
+    char chunkHeader[32];
+    auto const chunkHeaderSize = std::snprintf(
+        chunkHeader, sizeof(chunkHeader), "%llx\r\n", static_cast<unsigned long long>(chunk));
+    if (!SendAll(socket, chunkHeader, static_cast<size_t>(chunkHeaderSize))
+        || !SendBody(socket, chunk) || !SendAll(socket, "\r\n", 2))
+    {
+      return false;
+    }
+    remaining -= chunk;
+  }
+  return SendAll(socket, "0\r\n\r\n", 5);
+}
+} // namespace
+
+LoopbackHttpServer::LoopbackHttpServer()
+{
+#if defined(_WIN32)
+  WSADATA wsaData;
+  if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+  {
+    throw std::runtime_error("Failed to initialize Winsock.");
+  }
+#endif
+
+  m_listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (m_listenSocket == InvalidSocket)
+  {
+#if defined(_WIN32)
+    WSACleanup();
+#endif
+    throw std::runtime_error("Failed to create the loopback server socket.");
+  }
+
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  socklen_t addressSize = sizeof(address);
+  if (bind(m_listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+      || listen(m_listenSocket, SOMAXCONN) != 0
+      || getsockname(m_listenSocket, reinterpret_cast<sockaddr*>(&address), &addressSize) != 0)
+  {
+    CloseSocket(m_listenSocket);
+#if defined(_WIN32)
+    WSACleanup();
+#endif
+    throw std::runtime_error("Failed to listen on the loopback interface.");
+  }
+  m_port = ntohs(address.sin_port);
+
+  m_acceptThread = std::thread([this]() { Accept(); });
+}
+
+LoopbackHttpServer::~LoopbackHttpServer()
+{
+  m_isStopping = true;
+
+  // Closing the listening socket doesn't wake a blocked accept on every platform, so a
+  // connection is made for the accept thread to see the server is stopping.
+  auto const wakeSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (wakeSocket != InvalidSocket)
+  {
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(m_port);
+    connect(wakeSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    CloseSocket(wakeSocket);
+  }
+  m_acceptThread.join();
+  CloseSocket(m_listenSocket);
+
+  // No connection is added once the accept thread is joined. The blocked receives of the
+  // connections still open return once their sockets are shut down.
+  {
+    std::lock_guard<std::mutex> lock(m_connectionsMutex);
+    for (auto const& connection : m_connections)
+    {
+      if (connection.Socket != InvalidSocket)
+      {
+        shutdown(connection.Socket, ShutdownBoth);
+      }
+    }
+  }
+  for (auto& connection : m_connections)
+  {
+    connection.Thread.join();
+  }
+
+#if defined(_WIN32)
+  WSACleanup();
+#endif
+}
+
+void LoopbackHttpServer::Accept()
+{
+  while (true)
+  {
+    auto const connectionSocket = accept(m_listenSocket, nullptr, nullptr);
+    if (m_isStopping)
+    {
+      if (connectionSocket != InvalidSocket)
+      {
+        CloseSocket(connectionSocket);
+      }
+      return;
+    }
+    if (connectionSocket == InvalidSocket)
+    {
+      continue;
+    }
+
+    int const noDelay = 1;
+    setsockopt(
+        connectionSocket,
+        IPPROTO_TCP,
+        TCP_NODELAY,
+        reinterpret_cast<char const*>(&noDelay),
+        sizeof(noDelay));
+#if defined(SO_NOSIGPIPE)
+    int const noSigPipe = 1;
+    setsockopt(connectionSocket, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+    std::lock_guard<std::mutex> lock(m_connectionsMutex);
+    auto const connectionIndex = m_connections.size();
+    m_connections.push_back({connectionSocket, std::thread()});
+    m_connections.back().Thread = std::thread(
+        [this, connectionSocket, connectionIndex]() { Serve(connectionSocket, connectionIndex); });
+  }
+}
+
+void LoopbackHttpServer::Serve(SocketHandle connectionSocket, size_t connectionIndex)
+{
+  using Azure::Core::_internal::StringExtensions;
+
+  std::string received;
+  char buffer[ReceiveBufferSize];
+  bool closeConnection = false;
+  while (!closeConnection)
+  {
+    // Read the request line and headers.
+    size_t headersEnd;
+    while ((headersEnd = received.find("\r\n\r\n")) == std::string::npos)
+    {
+      auto const size = recv(connectionSocket, buffer, static_cast<int>(sizeof(buffer)), 0);
+      if (size <= 0)
+      {
+        closeConnection = true;
+        break;
+      }
+      received.append(buffer, static_cast<size_t>(size));
+    }
+    if (closeConnection)
+    {
+      break;
+    }
+
+    auto const requestLineEnd = received.find("\r\n");
+    auto const requestLine = received.substr(0, requestLineEnd);
+    auto const methodEnd = requestLine.find(' ');
+    auto const targetEnd = requestLine.find(' ', methodEnd + 1);
+    if (methodEnd == std::string::npos || targetEnd == std::string::npos)
+    {
+      break;
+    }
+    auto const method = requestLine.substr(0, methodEnd);
+    auto const target = ParseTarget(requestLine.substr(methodEnd + 1, targetEnd - methodEnd - 1));
+
+    size_t contentLength = 0;
+    for (auto lineStart = requestLineEnd + 2; lineStart < headersEnd;)
+    {
+      auto const lineEnd = received.find("\r\n", lineStart);
+      auto const colon = received.find(':', lineStart);
+      if (colon != std::string::npos && colon < lineEnd)
+      {
+        auto const name = received.substr(lineStart, colon - lineStart);
+        auto value = received.substr(colon + 1, lineEnd - colon - 1);
+        value.erase(0, value.find_first_not_of(' '));
+        if (StringExtensions::LocaleInvariantCaseInsensitiveEqual(name, "Content-Length"))
+        {
+          contentLength = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        }
+        else if (
+            StringExtensions::LocaleInvariantCaseInsensitiveEqual(name, "Connection")
+            && StringExtensions::LocaleInvariantCaseInsensitiveEqual(value, "close"))
+        {
+          closeConnection = true;
+        }
+      }
+      lineStart = lineEnd + 2;
+    }
+    received.erase(0, headersEnd + 4);
+
+    // Discard the request body.
+    while (received.size() < contentLength)
+    {
+      contentLength -= received.size();
+      received.clear();
+      auto const size = recv(connectionSocket, buffer, static_cast<int>(sizeof(buffer)), 0);
+      if (size <= 0)
+      {
+        closeConnection = true;
+        break;
+      }
+      received.append(buffer, static_cast<size_t>(size));
+    }
+    if (received.size() >= contentLength)
+    {
+      received.erase(0, contentLength);
+    }
+    else
+    {
+      break;
+    }
+
+    if (!SendResponse(connectionSocket, target, method != "HEAD", closeConnection))
+    {
+      break;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_connectionsMutex);
+  CloseSocket(connectionSocket);
+  m_connections[connectionIndex].Socket = InvalidSocket;
+}
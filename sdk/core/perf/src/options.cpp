@@ -8,6 +8,9 @@
 void Azure::Perf::to_json(Azure::Core::Json::_internal::json& j, const GlobalTestOptions& p)
 {
   j = Azure::Core::Json::_internal::json{
+      {"Baseline", p.Baseline},
+      {"Coordinator", p.Coordinator},
+      {"CoordinatorPort", p.CoordinatorPort},
       {"Duration", p.Duration},
       {"Host", p.Host},
       {"Insecure", p.Insecure},
@@ -16,7 +19,10 @@ void Azure::Perf::to_json(Azure::Core::Json::_internal::json& j, const GlobalTes
       {"Latency", p.Latency},
       {"NoCleanup", p.NoCleanup},
       {"Parallel", p.Parallel},
-      {"Warmup", p.Warmup}};
+      {"RegressionThreshold", p.RegressionThreshold},
+      {"ResultsFile", p.ResultsFile},
+      {"Warmup", p.Warmup},
+      {"Workers", p.Workers}};
   if (p.Port)
   {
     j["Port"] = p.Port.Value();
@@ -52,6 +58,20 @@ std::vector<Azure::Perf::TestOption> Azure::Perf::GlobalTestOptions::GetOptionMe
     [Option('w', "warmup", Default = 5, HelpText = "Duration of warmup in seconds")]
   */
   return {
+      {"Baseline",
+       {"--baseline"},
+       "Compare the throughput of the iterations to the JSON results file of a previous run, "
+       "exiting with 1 on a regression. Default to no baseline.",
+       1},
+      {"Coordinator",
+       {"--coordinator"},
+       "Run as a worker of the coordinator of a distributed run at this host:port. Default to "
+       "no coordinator.",
+       1},
+      {"CoordinatorPort",
+       {"--coordinator-port"},
+       "Port the coordinator of a distributed run listens on. Default to 7777.",
+       1},
       {"Duration",
        {"-d", "--duration"},
        "Duration of the test in seconds. Default to 10 seconds.",
@@ -74,6 +94,21 @@ std::vector<Azure::Perf::TestOption> Azure::Perf::GlobalTestOptions::GetOptionMe
        1},
       {"Port", {"--port"}, "Port to redirect HTTP requests. Default to no redirection.", 1},
       {"Rate", {"-r", "--rate"}, "Target throughput (ops/sec). Default to no throughput.", 1},
+      {"RegressionThreshold",
+       {"--regression-threshold"},
+       "Decrease of the mean throughput compared to the baseline, in percent, reported as a "
+       "regression when it's also statistically significant. Default to 5.",
+       1},
+      {"ResultsFile",
+       {"--results-file"},
+       "Write the results of each iteration to a file, as CSV if its name ends with .csv and as "
+       "JSON otherwise. Default to no file.",
+       1},
       {"Warmup", {"-w", "--warmup"}, "Duration of warmup in seconds. Default to 5 seconds.", 1},
+      {"Workers",
+       {"--workers"},
+       "Coordinate a distributed run of this number of workers, starting their iterations "
+       "together and aggregating their results, instead of running the test. Default to 0.",
+       1},
       {"help", {"-h", "--help"}, "Display help information.", 0}};
 }
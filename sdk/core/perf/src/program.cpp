@@ -2,14 +2,49 @@
 // SPDX-License-Identifier: MIT
 
 #include "azure/perf/program.hpp"
+#include "azure/perf/allocation_counter.hpp"
 #include "azure/perf/argagg.hpp"
+#include "azure/perf/async_test.hpp"
+#include "azure/perf/coordinator_connection.hpp"
+#include "azure/perf/statistics.hpp"
 
 #include <azure/core/internal/json/json.hpp>
 #include <azure/core/internal/strings.hpp>
+#include <azure/core/platform.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 #include <thread>
+#include <vector>
+
+#if defined(AZ_PLATFORM_WINDOWS)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
 
 namespace {
 
@@ -64,6 +99,39 @@ inline std::string ReplaceAll(
   return src;
 }
 
+inline Azure::Core::Json::_internal::json GetTestOptionsAsJson(
+    std::vector<Azure::Perf::TestOption> const& testOptions,
+    argagg::parser_results const& parsedArgs)
+{
+  Azure::Core::Json::_internal::json optionsAsJson = Azure::Core::Json::_internal::json::object();
+  for (auto option : testOptions)
+  {
+    try
+    {
+      optionsAsJson[option.Name]
+          = option.sensitiveData ? "***" : parsedArgs[option.Name].as<std::string>();
+    }
+    catch (std::out_of_range const&)
+    {
+      if (!option.required)
+      {
+        // arg was not parsed
+        optionsAsJson[option.Name] = "default value";
+      }
+      else
+      {
+        // re-throw
+        throw std::invalid_argument("Missing mandatory parameter: " + option.Name);
+      }
+    }
+    catch (std::exception const&)
+    {
+      throw;
+    }
+  }
+  return optionsAsJson;
+}
+
 inline void PrintOptions(
     Azure::Perf::GlobalTestOptions const& options,
     std::vector<Azure::Perf::TestOption> const& testOptions,
@@ -78,54 +146,672 @@ inline void PrintOptions(
   if (testOptions.size() > 0)
   {
     std::cout << std::endl << "=== Test Options ===" << std::endl;
-    Azure::Core::Json::_internal::json optionsAsJson;
-    for (auto option : testOptions)
+    auto const optionsAsJson = GetTestOptionsAsJson(testOptions, parsedArgs);
+    std::cout << ReplaceAll(optionsAsJson.dump(), ",", ",\n") << std::endl << std::endl;
+  }
+}
+
+// The resources used by all the threads of the process.
+struct ProcessUsage final
+{
+  std::chrono::duration<double> CpuTime{};
+  // Voluntary and involuntary context switches, which Windows doesn't count for a process.
+  int64_t ContextSwitches = -1;
+};
+
+inline ProcessUsage GetProcessUsage()
+{
+  ProcessUsage processUsage;
+#if defined(AZ_PLATFORM_WINDOWS)
+  FILETIME creationTime;
+  FILETIME exitTime;
+  FILETIME kernelTime;
+  FILETIME userTime;
+  if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+  {
+    return processUsage;
+  }
+  auto const toHundredsOfNanoseconds = [](FILETIME const& time) {
+    return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+  };
+  processUsage.CpuTime = std::chrono::duration<double>(
+      (toHundredsOfNanoseconds(kernelTime) + toHundredsOfNanoseconds(userTime)) / 1e7);
+#else
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return processUsage;
+  }
+  processUsage.CpuTime = std::chrono::duration<double>(
+      usage.ru_utime.tv_sec + usage.ru_stime.tv_sec
+      + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6);
+  processUsage.ContextSwitches = static_cast<int64_t>(usage.ru_nvcsw + usage.ru_nivcsw);
+#endif
+  return processUsage;
+}
+
+// Counts latencies the way an HDR histogram does: each power of two range of nanoseconds is split
+// into SubBucketCount linear buckets, so that the reported latencies are within 1% of the recorded
+// ones, whatever their magnitude.
+class LatencyHistogram final {
+  static constexpr int SubBucketBits = 7;
+  static constexpr uint64_t SubBucketCount = uint64_t(1) << SubBucketBits;
+  static constexpr size_t BucketCount = (64 - SubBucketBits + 1) * SubBucketCount;
+
+  std::vector<uint64_t> m_counts;
+  uint64_t m_totalCount = 0;
+  uint64_t m_maxValue = 0;
+
+  static size_t GetBucketIndex(uint64_t value)
+  {
+    if (value < SubBucketCount)
     {
-      try
+      return static_cast<size_t>(value);
+    }
+    int exponent = SubBucketBits;
+    while ((value >> (exponent + 1)) != 0)
+    {
+      ++exponent;
+    }
+    auto const shift = exponent - SubBucketBits;
+    return static_cast<size_t>((shift + 1) * SubBucketCount + (value >> shift) - SubBucketCount);
+  }
+
+  // The highest value counted in a bucket, which is what the percentiles report.
+  static uint64_t GetHighestValue(size_t bucketIndex)
+  {
+    if (bucketIndex < SubBucketCount)
+    {
+      return bucketIndex;
+    }
+    auto const shift = bucketIndex / SubBucketCount - 1;
+    auto const subBucket = bucketIndex % SubBucketCount + SubBucketCount;
+    return ((subBucket + 1) << shift) - 1;
+  }
+
+public:
+  LatencyHistogram() : m_counts(BucketCount) {}
+
+  void Record(std::chrono::nanoseconds latency)
+  {
+    auto const value = latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0;
+    ++m_counts[GetBucketIndex(value)];
+    ++m_totalCount;
+    m_maxValue = (std::max)(m_maxValue, value);
+  }
+
+  void Merge(LatencyHistogram const& other)
+  {
+    for (size_t index = 0; index != BucketCount; index++)
+    {
+      m_counts[index] += other.m_counts[index];
+    }
+    m_totalCount += other.m_totalCount;
+    m_maxValue = (std::max)(m_maxValue, other.m_maxValue);
+  }
+
+  uint64_t GetTotalCount() const { return m_totalCount; }
+
+  std::chrono::nanoseconds GetMax() const { return std::chrono::nanoseconds(m_maxValue); }
+
+  std::chrono::nanoseconds GetPercentile(double percentile) const
+  {
+    auto const rank = (std::max)(
+        uint64_t(1), static_cast<uint64_t>(std::ceil(percentile / 100 * m_totalCount)));
+    uint64_t count = 0;
+    for (size_t index = 0; index != BucketCount; index++)
+    {
+      count += m_counts[index];
+      if (count >= rank)
       {
-        optionsAsJson[option.Name]
-            = option.sensitiveData ? "***" : parsedArgs[option.Name].as<std::string>();
+        return std::chrono::nanoseconds((std::min)(GetHighestValue(index), m_maxValue));
       }
-      catch (std::out_of_range const&)
+    }
+    return GetMax();
+  }
+
+  // Only the buckets counted are written, as [index, count] pairs.
+  Azure::Core::Json::_internal::json ToJson() const
+  {
+    auto counts = Azure::Core::Json::_internal::json::array();
+    for (size_t index = 0; index != BucketCount; index++)
+    {
+      if (m_counts[index] != 0)
       {
-        if (!option.required)
-        {
-          // arg was not parsed
-          optionsAsJson[option.Name] = "default value";
-        }
-        else
+        counts.push_back({index, m_counts[index]});
+      }
+    }
+    return {{"Max", m_maxValue}, {"Counts", std::move(counts)}};
+  }
+
+  static LatencyHistogram FromJson(Azure::Core::Json::_internal::json const& histogramAsJson)
+  {
+    LatencyHistogram histogram;
+    histogram.m_maxValue = histogramAsJson.at("Max").get<uint64_t>();
+    for (auto const& bucket : histogramAsJson.at("Counts"))
+    {
+      auto const index = bucket.at(0).get<size_t>();
+      if (index >= BucketCount)
+      {
+        throw std::runtime_error("Invalid latency histogram.");
+      }
+      histogram.m_counts[index] += bucket.at(1).get<uint64_t>();
+      histogram.m_totalCount += bucket.at(1).get<uint64_t>();
+    }
+    return histogram;
+  }
+};
+
+// A latency of the distribution of an iteration, in milliseconds.
+struct LatencyPercentile final
+{
+  // The name in the results file.
+  std::string Name;
+  // 100 for the maximum latency.
+  double Percentile;
+  double Milliseconds;
+};
+
+// The results of an iteration, written to the results file.
+struct IterationResult final
+{
+  std::string Name;
+  uint64_t Operations = 0;
+  double WeightedAverageSeconds = 0;
+  double OperationsPerSecond = 0;
+  double CpuSeconds = 0;
+  // -1 when not measured.
+  int64_t ContextSwitches = -1;
+  // -1 when the application doesn't count its allocations.
+  int64_t Allocations = -1;
+  std::vector<LatencyPercentile> Latencies;
+  // The latencies of all the threads, sent to the coordinator of a distributed run.
+  LatencyHistogram Histogram;
+};
+
+inline std::vector<LatencyPercentile> GetLatencyDistribution(
+    std::vector<LatencyHistogram> const& latencies)
+{
+  LatencyHistogram merged;
+  for (auto const& histogram : latencies)
+  {
+    merged.Merge(histogram);
+  }
+  if (merged.GetTotalCount() == 0)
+  {
+    return {};
+  }
+
+  auto const toMilliseconds = [](std::chrono::nanoseconds latency) {
+    return std::chrono::duration<double, std::milli>(latency).count();
+  };
+  std::vector<LatencyPercentile> distribution;
+  for (auto const& percentile : {std::make_pair("p50", 50.0),
+                                 std::make_pair("p90", 90.0),
+                                 std::make_pair("p99", 99.0),
+                                 std::make_pair("p99.9", 99.9)})
+  {
+    distribution.push_back(
+        {percentile.first,
+         percentile.second,
+         toMilliseconds(merged.GetPercentile(percentile.second))});
+  }
+  distribution.push_back({"max", 100, toMilliseconds(merged.GetMax())});
+  return distribution;
+}
+
+inline void PrintLatencies(std::vector<LatencyPercentile> const& distribution)
+{
+  if (distribution.empty())
+  {
+    return;
+  }
+
+  std::cout << "=== Latency Distribution ===" << std::endl << std::fixed;
+  for (auto const& latency : distribution)
+  {
+    if (latency.Percentile == 100)
+    {
+      std::cout << "[    max]  ";
+    }
+    else
+    {
+      std::cout << "[" << std::setw(6) << std::setprecision(1) << latency.Percentile << "%]  ";
+    }
+    std::cout << std::setprecision(6) << latency.Milliseconds << "ms" << std::endl;
+  }
+  std::cout << std::endl;
+  std::cout.unsetf(std::ios_base::floatfield);
+  std::cout << std::setprecision(6);
+}
+
+// Quotes a CSV field.
+inline std::string ToCsvField(std::string const& value)
+{
+  return "\"" + ReplaceAll(value, "\"", "\"\"") + "\"";
+}
+
+// Writes the results as CSV when the name of the file ends with .csv, and as JSON otherwise.
+inline void WriteResultsFile(
+    std::string const& fileName,
+    std::string const& testName,
+    Azure::Core::Json::_internal::json const& globalOptions,
+    Azure::Core::Json::_internal::json const& testOptions,
+    std::vector<IterationResult> const& results)
+{
+  std::ofstream file(fileName, std::ios_base::out | std::ios_base::trunc);
+  if (!file)
+  {
+    throw std::runtime_error("Failed to open the results file " + fileName + ".");
+  }
+
+  auto const csvExtension = std::string(".csv");
+  auto const isCsv = fileName.size() >= csvExtension.size()
+      && Azure::Core::_internal::StringExtensions::LocaleInvariantCaseInsensitiveEqual(
+          fileName.substr(fileName.size() - csvExtension.size()), csvExtension);
+  if (isCsv)
+  {
+    file << std::setprecision(std::numeric_limits<double>::max_digits10);
+    // One row per iteration, with the options as JSON in the last columns.
+    file << "Test,Iteration,Operations,Seconds,OperationsPerSecond,CpuSeconds,ContextSwitches,"
+            "Allocations,P50Milliseconds,P90Milliseconds,P99Milliseconds,P99.9Milliseconds,"
+            "MaxMilliseconds,GlobalOptions,TestOptions\n";
+    for (auto const& result : results)
+    {
+      file << ToCsvField(testName) << ',' << ToCsvField(result.Name) << ',' << result.Operations
+           << ',' << result.WeightedAverageSeconds << ',' << result.OperationsPerSecond << ','
+           << result.CpuSeconds << ',';
+      // The counts which weren't measured are empty.
+      if (result.ContextSwitches >= 0)
+      {
+        file << result.ContextSwitches;
+      }
+      file << ',';
+      if (result.Allocations >= 0)
+      {
+        file << result.Allocations;
+      }
+      for (size_t index = 0; index != 5; index++)
+      {
+        file << ',';
+        if (index < result.Latencies.size())
         {
-          // re-throw
-          throw std::invalid_argument("Missing mandatory parameter: " + option.Name);
+          file << result.Latencies[index].Milliseconds;
         }
       }
-      catch (std::exception const&)
+      file << ',' << ToCsvField(globalOptions.dump()) << ',' << ToCsvField(testOptions.dump())
+           << '\n';
+    }
+  }
+  else
+  {
+    Azure::Core::Json::_internal::json resultsAsJson;
+    resultsAsJson["Test"] = testName;
+    resultsAsJson["GlobalOptions"] = globalOptions;
+    resultsAsJson["TestOptions"] = testOptions;
+    resultsAsJson["Iterations"] = Azure::Core::Json::_internal::json::array();
+    for (auto const& result : results)
+    {
+      Azure::Core::Json::_internal::json iteration{
+          {"Name", result.Name},
+          {"Operations", result.Operations},
+          {"Seconds", result.WeightedAverageSeconds},
+          {"OperationsPerSecond", result.OperationsPerSecond},
+          {"CpuSeconds", result.CpuSeconds}};
+      if (result.ContextSwitches >= 0)
+      {
+        iteration["ContextSwitches"] = result.ContextSwitches;
+      }
+      if (result.Allocations >= 0)
+      {
+        iteration["Allocations"] = result.Allocations;
+      }
+      if (!result.Latencies.empty())
       {
-        throw;
+        auto& latencies = iteration["LatencyMilliseconds"];
+        for (auto const& latency : result.Latencies)
+        {
+          latencies[latency.Name] = latency.Milliseconds;
+        }
       }
+      resultsAsJson["Iterations"].push_back(std::move(iteration));
     }
-    std::cout << ReplaceAll(optionsAsJson.dump(), ",", ",\n") << std::endl << std::endl;
+    file << resultsAsJson.dump(2) << '\n';
+  }
+
+  if (!file)
+  {
+    throw std::runtime_error("Failed to write the results file " + fileName + ".");
+  }
+}
+
+inline std::vector<double> GetThroughputs(std::vector<IterationResult> const& results)
+{
+  std::vector<double> throughputs;
+  for (auto const& result : results)
+  {
+    throughputs.push_back(result.OperationsPerSecond);
+  }
+  return throughputs;
+}
+
+inline void PrintSummary(
+    std::string const& name,
+    Azure::Perf::_detail::SampleSummary const& summary)
+{
+  std::cout << std::fixed << std::setprecision(2) << name << ": " << summary.Mean << " ops/s";
+  if (summary.Count > 1)
+  {
+    std::cout << " +/- " << summary.ConfidenceInterval << " (95% CI, stddev "
+              << summary.StandardDeviation << ", " << summary.Count << " iterations)";
   }
+  std::cout << std::endl;
+  std::cout.unsetf(std::ios_base::floatfield);
+  std::cout << std::setprecision(6);
 }
 
+// Reads the throughputs of the iterations of a JSON results file.
+inline std::vector<double> ReadBaseline(std::string const& fileName, std::string const& testName)
+{
+  std::ifstream file(fileName);
+  if (!file)
+  {
+    throw std::runtime_error("Failed to open the baseline file " + fileName + ".");
+  }
+  Azure::Core::Json::_internal::json baseline;
+  try
+  {
+    file >> baseline;
+  }
+  catch (std::exception const&)
+  {
+    throw std::runtime_error("The baseline file " + fileName + " isn't a JSON results file.");
+  }
+  if (!Azure::Core::_internal::StringExtensions::LocaleInvariantCaseInsensitiveEqual(
+          baseline.value("Test", std::string()), testName))
+  {
+    throw std::runtime_error("The baseline file " + fileName + " isn't a run of " + testName + ".");
+  }
+  std::vector<double> throughputs;
+  for (auto const& iteration : baseline.at("Iterations"))
+  {
+    throughputs.push_back(iteration.at("OperationsPerSecond").get<double>());
+  }
+  if (throughputs.empty())
+  {
+    throw std::runtime_error("The baseline file " + fileName + " has no iteration.");
+  }
+  return throughputs;
+}
+
+// Summarizes the throughput of the iterations, and compares it to the baseline. Returns true on a
+// regression: a decrease larger than the threshold, which isn't noise when both runs have enough
+// iterations to tell.
+inline bool AnalyzeResults(
+    std::vector<IterationResult> const& results,
+    Azure::Perf::GlobalTestOptions const& options,
+    std::string const& testName)
+{
+  auto const summary = Azure::Perf::_detail::Summarize(GetThroughputs(results));
+  if (results.size() > 1)
+  {
+    std::cout << "=== Iterations Summary ===" << std::endl;
+    PrintSummary("Throughput", summary);
+    std::cout << std::endl;
+  }
+  if (options.Baseline.empty())
+  {
+    return false;
+  }
+
+  auto const baseline = Azure::Perf::_detail::Summarize(ReadBaseline(options.Baseline, testName));
+  std::cout << "=== Baseline Comparison ===" << std::endl;
+  PrintSummary("Baseline", baseline);
+  PrintSummary("Current", summary);
+  auto const change = baseline.Mean > 0 ? (summary.Mean - baseline.Mean) / baseline.Mean * 100 : 0;
+  std::cout << "Change: " << std::fixed << std::setprecision(2) << change << "%" << std::endl;
+  std::cout.unsetf(std::ios_base::floatfield);
+  std::cout << std::setprecision(6);
+  auto const isBeyondThreshold = -change > options.RegressionThreshold;
+  auto const canTestSignificance = summary.Count > 1 && baseline.Count > 1;
+  auto const isRegression = isBeyondThreshold
+      && (!canTestSignificance || Azure::Perf::_detail::IsSignificantlyLower(summary, baseline));
+  if (!canTestSignificance)
+  {
+    std::cout << "Not enough iterations to tell a change from noise, run at least 2." << std::endl;
+  }
+  if (isRegression)
+  {
+    std::cout << "REGRESSION: the throughput decreased by more than " << options.RegressionThreshold
+              << "%." << std::endl;
+  }
+  else if (isBeyondThreshold)
+  {
+    std::cout << "The decrease is within the noise of the iterations." << std::endl;
+  }
+  std::cout << std::endl;
+  return isRegression;
+}
+
+// Schedules the operations of all the threads at a fixed arrival rate, for open-loop runs. The
+// operations which can't start on time, because all the threads are busy, start as soon as a
+// thread is available, and their latency includes the time they waited for it.
+class OperationSchedule final {
+  std::chrono::steady_clock::time_point const m_start;
+  std::chrono::duration<double> const m_interval;
+  std::atomic<uint64_t> m_nextOperation{0};
+
+public:
+  explicit OperationSchedule(int rate)
+      : m_start(std::chrono::steady_clock::now()), m_interval(1.0 / rate)
+  {
+  }
+
+  // Gets the time the next operation is intended to start at.
+  std::chrono::steady_clock::time_point GetNextStartTime()
+  {
+    auto const operation = m_nextOperation.fetch_add(1, std::memory_order_relaxed);
+    return m_start
+        + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+               m_interval * static_cast<double>(operation));
+  }
+};
+
 inline void RunLoop(
     Azure::Core::Context const& context,
     Azure::Perf::PerfTest& test,
     uint64_t& completedOperations,
     std::chrono::nanoseconds& lastCompletionTimes,
-    bool latency,
+    LatencyHistogram* latencies,
+    OperationSchedule* schedule,
     bool& isCancelled)
 {
-  (void)latency;
   auto start = std::chrono::system_clock::now();
   while (!isCancelled)
   {
-    test.Run(context);
+    if (schedule != nullptr)
+    {
+      // Open loop: the latency is measured from the intended start time, so that the operations
+      // delayed by the slow ones before them are accounted for.
+      auto const operationStart = schedule->GetNextStartTime();
+      std::this_thread::sleep_until(operationStart);
+      if (isCancelled)
+      {
+        break;
+      }
+      test.Run(context);
+      if (latencies != nullptr)
+      {
+        latencies->Record(std::chrono::steady_clock::now() - operationStart);
+      }
+    }
+    else if (latencies == nullptr)
+    {
+      test.Run(context);
+    }
+    else
+    {
+      auto const operationStart = std::chrono::steady_clock::now();
+      test.Run(context);
+      latencies->Record(std::chrono::steady_clock::now() - operationStart);
+    }
     completedOperations += 1;
     lastCompletionTimes = std::chrono::system_clock::now() - start;
   }
 }
 
+// Runs the tasks posted to it on a few threads.
+class TaskPool final {
+  std::mutex m_mutex;
+  std::condition_variable m_taskPosted;
+  std::deque<std::function<void(size_t threadIndex)>> m_tasks;
+  bool m_stopping = false;
+  std::vector<std::thread> m_threads;
+
+  void Run(size_t threadIndex)
+  {
+    while (true)
+    {
+      std::function<void(size_t threadIndex)> task;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_taskPosted.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+        if (m_tasks.empty())
+        {
+          return;
+        }
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+      }
+      task(threadIndex);
+    }
+  }
+
+public:
+  explicit TaskPool(size_t threadCount)
+  {
+    for (size_t index = 0; index != threadCount; index++)
+    {
+      m_threads.emplace_back([this, index]() { Run(index); });
+    }
+  }
+
+  ~TaskPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+    }
+    m_taskPosted.notify_all();
+    for (auto& thread : m_threads)
+    {
+      thread.join();
+    }
+  }
+
+  size_t GetThreadCount() const { return m_threads.size(); }
+
+  // The task gets the index of the thread running it.
+  void Post(std::function<void(size_t threadIndex)> task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_tasks.push_back(std::move(task));
+    }
+    m_taskPosted.notify_one();
+  }
+};
+
+// Runs the operations of asynchronous tests, one at a time for each test instance, until the
+// duration is reached. The completion of an operation posts the start of the next one to the pool,
+// so that the threads of the transport only call back. The latencies are recorded in the histogram
+// of the pool thread.
+inline void RunAsyncLoops(
+    Azure::Core::Context const& context,
+    std::vector<std::unique_ptr<Azure::Perf::PerfTest>> const& tests,
+    std::vector<uint64_t>& completedOperations,
+    std::vector<std::chrono::nanoseconds>& lastCompletionTimes,
+    std::vector<LatencyHistogram>& latencies,
+    TaskPool& pool,
+    std::chrono::seconds duration)
+{
+  std::atomic<bool> isCancelled(false);
+  std::mutex mutex;
+  std::condition_variable allCompleted;
+  auto runningCount = tests.size();
+  std::exception_ptr firstError;
+  auto const start = std::chrono::system_clock::now();
+
+  std::function<void(size_t index)> startOperation;
+  auto const completeOperation = [&](size_t index,
+                                     std::chrono::steady_clock::time_point operationStart,
+                                     std::chrono::steady_clock::time_point completionTime,
+                                     std::exception_ptr error,
+                                     size_t threadIndex) {
+    if (!error)
+    {
+      if (!latencies.empty())
+      {
+        latencies[threadIndex].Record(completionTime - operationStart);
+      }
+      completedOperations[index] += 1;
+      lastCompletionTimes[index] = std::chrono::system_clock::now() - start;
+    }
+    if (error || isCancelled.load())
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (error && !firstError)
+      {
+        // Stops all the test instances on the first error, like a failed synchronous test.
+        firstError = error;
+        isCancelled = true;
+      }
+      if (--runningCount == 0)
+      {
+        allCompleted.notify_all();
+      }
+      return;
+    }
+    startOperation(index);
+  };
+
+  startOperation = [&](size_t index) {
+    auto const operationStart = std::chrono::steady_clock::now();
+    try
+    {
+      static_cast<Azure::Perf::PerfTestAsync&>(*tests[index])
+          .RunAsync(context, [&, index, operationStart](std::exception_ptr error) {
+            auto const completionTime = std::chrono::steady_clock::now();
+            pool.Post([&, index, operationStart, completionTime, error](size_t threadIndex) {
+              completeOperation(index, operationStart, completionTime, error, threadIndex);
+            });
+          });
+    }
+    catch (...)
+    {
+      auto const error = std::current_exception();
+      pool.Post([&, index, operationStart, error](size_t threadIndex) {
+        completeOperation(
+            index, operationStart, std::chrono::steady_clock::now(), error, threadIndex);
+      });
+    }
+  };
+
+  for (size_t index = 0; index != tests.size(); index++)
+  {
+    pool.Post([&startOperation, index](size_t) { startOperation(index); });
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  allCompleted.wait_for(lock, duration, [&runningCount]() { return runningCount == 0; });
+  isCancelled = true;
+  allCompleted.wait(lock, [&runningCount]() { return runningCount == 0; });
+  if (firstError)
+  {
+    std::rethrow_exception(firstError);
+  }
+}
+
 template <class T> inline std::string FormatNumber(T const& number, bool showDecimals = true)
 {
   auto fullString = std::to_string(number);
@@ -159,6 +845,30 @@ template <class T> inline std::string FormatNumber(T const& number, bool showDec
   return numberString;
 }
 
+inline void PrintUsage(IterationResult const& result)
+{
+  if (result.Operations == 0)
+  {
+    return;
+  }
+
+  auto const operations = static_cast<double>(result.Operations);
+  std::cout << "=== Resource Usage ===" << std::endl
+            << "CPU time: " << FormatNumber(result.CpuSeconds * 1e6 / operations) << " us/op"
+            << std::endl;
+  if (result.ContextSwitches >= 0)
+  {
+    std::cout << "Context switches: " << FormatNumber(result.ContextSwitches / operations)
+              << " /op" << std::endl;
+  }
+  if (result.Allocations >= 0)
+  {
+    std::cout << "Heap allocations: " << FormatNumber(result.Allocations / operations) << " /op"
+              << std::endl;
+  }
+  std::cout << std::endl;
+}
+
 template <class T> inline T Sum(std::vector<T> const& array)
 {
   T s = 0;
@@ -182,7 +892,7 @@ inline std::vector<double> ZipAvg(
   return s;
 }
 
-inline void RunTests(
+inline IterationResult RunTests(
     Azure::Core::Context const& context,
     std::vector<std::unique_ptr<Azure::Perf::PerfTest>> const& tests,
     Azure::Perf::GlobalTestOptions const& options,
@@ -193,10 +903,32 @@ inline void RunTests(
   auto parallelTestsCount = options.Parallel;
   auto durationInSeconds = warmup ? options.Warmup : options.Duration;
   // auto jobStatistics = warmup ? false : options.JobStatistics;
-  // auto latency = warmup ? false : options.Latency;
+  auto latency = warmup ? false : options.Latency;
+
+  auto const isAsync = dynamic_cast<Azure::Perf::PerfTestAsync*>(tests[0].get()) != nullptr;
+
+  if (options.Rate && options.Rate.Value() <= 0)
+  {
+    throw std::invalid_argument("The rate must be a positive number of operations per second.");
+  }
+  if (options.Rate && isAsync)
+  {
+    throw std::invalid_argument("The rate option isn't supported by asynchronous tests.");
+  }
+
+  // The operations of asynchronous tests run on a thread per core at most.
+  std::unique_ptr<TaskPool> pool;
+  if (isAsync)
+  {
+    pool = std::make_unique<TaskPool>((std::min)(
+        tests.size(), static_cast<size_t>((std::max)(1U, std::thread::hardware_concurrency()))));
+  }
 
   std::vector<uint64_t> completedOperations(parallelTestsCount);
   std::vector<std::chrono::nanoseconds> lastCompletionTimes(parallelTestsCount);
+  // One histogram per thread, merged once the threads are done.
+  std::vector<LatencyHistogram> latencies(
+      latency ? (isAsync ? pool->GetThreadCount() : static_cast<size_t>(parallelTestsCount)) : 0);
 
   /********************* Progress Reporter ******************************/
   Azure::Core::Context progresToken;
@@ -217,13 +949,48 @@ inline void RunTests(
         }
       });
 
+  std::unique_ptr<OperationSchedule> schedule;
+  if (options.Rate)
+  {
+    schedule = std::make_unique<OperationSchedule>(options.Rate.Value());
+  }
+
+  auto const usageAtStart = GetProcessUsage();
+  auto const allocationsAtStart = Azure::Perf::_detail::GetAllocationCount();
+
   /********************* parallel test creation ******************************/
-  std::vector<std::thread> tasks(tests.size());
+  std::vector<std::thread> tasks(isAsync ? 0 : tests.size());
   auto deadLineSeconds = std::chrono::seconds(durationInSeconds);
-  for (size_t index = 0; index != tests.size(); index++)
+  std::exception_ptr asyncError;
+  if (isAsync)
+  {
+    try
+    {
+      RunAsyncLoops(
+          context,
+          tests,
+          completedOperations,
+          lastCompletionTimes,
+          latencies,
+          *pool,
+          deadLineSeconds);
+    }
+    catch (...)
+    {
+      asyncError = std::current_exception();
+    }
+  }
+  for (size_t index = 0; index != tasks.size(); index++)
   {
     tasks[index] = std::thread(
-        [index, &tests, &completedOperations, &lastCompletionTimes, &deadLineSeconds, &context]() {
+        [index,
+         &tests,
+         &completedOperations,
+         &lastCompletionTimes,
+         &latencies,
+         &schedule,
+         &deadLineSeconds,
+         &context]() {
           bool isCancelled = false;
           // Azure::Context is not good performer for checking cancellation inside the test loop
           auto manualCancellation = std::thread([&deadLineSeconds, &isCancelled] {
@@ -237,7 +1004,8 @@ inline void RunTests(
               *tests[index],
               completedOperations[index],
               lastCompletionTimes[index],
-              false,
+              latencies.empty() ? nullptr : &latencies[index],
+              schedule.get(),
               isCancelled);
 
           manualCancellation.join();
@@ -249,9 +1017,16 @@ inline void RunTests(
     t.join();
   }
 
+  auto const allocations = Azure::Perf::_detail::GetAllocationCount() - allocationsAtStart;
+  auto const usage = GetProcessUsage();
+
   // Stop progress
   progresToken.Cancel();
   progressThread.join();
+  if (asyncError)
+  {
+    std::rethrow_exception(asyncError);
+  }
 
   std::cout << std::endl << "=== Results ===";
 
@@ -265,8 +1040,209 @@ inline void RunTests(
             << " operations in a weighted-average of "
             << FormatNumber(weightedAverageSeconds, false) << "s ("
             << FormatNumber(operationsPerSecond) << " ops/s, " << secondsPerOperation << " s/op)"
-            << std::endl
             << std::endl;
+  auto const bytesPerOperation = tests[0]->GetBytesPerOperation();
+  if (bytesPerOperation > 0)
+  {
+    std::cout << "Throughput: "
+              << FormatNumber(operationsPerSecond * bytesPerOperation / (1024 * 1024))
+              << " MiB/s (" << FormatNumber(secondsPerOperation * 1e9) << " ns/op)" << std::endl;
+  }
+  std::cout << std::endl;
+
+  IterationResult result;
+  result.Name = title;
+  result.Operations = totalOperations;
+  result.WeightedAverageSeconds = weightedAverageSeconds;
+  result.OperationsPerSecond = operationsPerSecond;
+  result.CpuSeconds = (usage.CpuTime - usageAtStart.CpuTime).count();
+  if (usageAtStart.ContextSwitches >= 0 && usage.ContextSwitches >= 0)
+  {
+    result.ContextSwitches = usage.ContextSwitches - usageAtStart.ContextSwitches;
+  }
+  if (Azure::Perf::_detail::IsAllocationCountingEnabled())
+  {
+    result.Allocations = static_cast<int64_t>(allocations);
+  }
+  if (latency)
+  {
+    for (auto const& histogram : latencies)
+    {
+      result.Histogram.Merge(histogram);
+    }
+    result.Latencies = GetLatencyDistribution(latencies);
+    PrintLatencies(result.Latencies);
+  }
+  if (!warmup)
+  {
+    PrintUsage(result);
+  }
+  return result;
+}
+
+// The results of the iteration of a worker, as sent to the coordinator on a single line.
+inline std::string WorkerResultToJson(IterationResult const& result)
+{
+  Azure::Core::Json::_internal::json resultAsJson{
+      {"Operations", result.Operations},
+      {"OperationsPerSecond", result.OperationsPerSecond},
+      {"CpuSeconds", result.CpuSeconds},
+      {"ContextSwitches", result.ContextSwitches},
+      {"Allocations", result.Allocations}};
+  if (!result.Latencies.empty())
+  {
+    resultAsJson["Latency"] = result.Histogram.ToJson();
+  }
+  return resultAsJson.dump();
+}
+
+inline IterationResult WorkerResultFromJson(std::string const& line)
+{
+  auto const resultAsJson = Azure::Core::Json::_internal::json::parse(line);
+  IterationResult result;
+  result.Operations = resultAsJson.at("Operations").get<uint64_t>();
+  result.OperationsPerSecond = resultAsJson.at("OperationsPerSecond").get<double>();
+  result.CpuSeconds = resultAsJson.at("CpuSeconds").get<double>();
+  result.ContextSwitches = resultAsJson.at("ContextSwitches").get<int64_t>();
+  result.Allocations = resultAsJson.at("Allocations").get<int64_t>();
+  if (resultAsJson.contains("Latency"))
+  {
+    result.Histogram = LatencyHistogram::FromJson(resultAsJson.at("Latency"));
+  }
+  return result;
+}
+
+// The workers run in parallel, so their throughputs add up, and the latencies are those of all
+// their operations.
+inline IterationResult AggregateWorkerResults(
+    std::string const& title,
+    std::vector<IterationResult> const& workerResults)
+{
+  IterationResult result;
+  result.Name = title;
+  result.ContextSwitches = 0;
+  result.Allocations = 0;
+  std::vector<LatencyHistogram> latencies;
+  for (auto const& workerResult : workerResults)
+  {
+    result.Operations += workerResult.Operations;
+    result.OperationsPerSecond += workerResult.OperationsPerSecond;
+    result.CpuSeconds += workerResult.CpuSeconds;
+    // The counts are only reported when all the workers measured them.
+    result.ContextSwitches = result.ContextSwitches < 0 || workerResult.ContextSwitches < 0
+        ? -1
+        : result.ContextSwitches + workerResult.ContextSwitches;
+    result.Allocations = result.Allocations < 0 || workerResult.Allocations < 0
+        ? -1
+        : result.Allocations + workerResult.Allocations;
+    latencies.push_back(workerResult.Histogram);
+  }
+  if (result.OperationsPerSecond > 0)
+  {
+    result.WeightedAverageSeconds = result.Operations / result.OperationsPerSecond;
+  }
+  result.Latencies = GetLatencyDistribution(latencies);
+  return result;
+}
+
+// Coordinates a distributed run: once all the workers are connected, each iteration starts when
+// all of them are ready, which is once they are warmed up for the first one, and the results they
+// send back are aggregated.
+inline std::vector<IterationResult> RunCoordinator(Azure::Perf::GlobalTestOptions const& options)
+{
+  if (options.CoordinatorPort < 0 || options.CoordinatorPort > 65535)
+  {
+    throw std::invalid_argument("The coordinator port must be between 0 and 65535.");
+  }
+  Azure::Perf::_detail::CoordinatorListener listener(
+      static_cast<uint16_t>(options.CoordinatorPort));
+  std::cout << "=== Coordinator ===" << std::endl
+            << "Waiting for " << options.Workers << " workers on port " << listener.GetPort()
+            << "." << std::endl;
+  std::vector<std::unique_ptr<Azure::Perf::_detail::CoordinatorConnection>> workers;
+  for (int index = 0; index != options.Workers; index++)
+  {
+    workers.push_back(listener.Accept());
+    std::cout << "Worker " << index + 1 << " connected." << std::endl;
+  }
+
+  std::string iterationInfo;
+  std::vector<IterationResult> results;
+  for (int iteration = 0; iteration < options.Iterations; iteration++)
+  {
+    if (iteration > 0)
+    {
+      iterationInfo.append(FormatNumber(iteration));
+    }
+    auto const title = "Test" + iterationInfo;
+    for (auto& worker : workers)
+    {
+      if (worker->ReceiveLine() != "READY")
+      {
+        throw std::runtime_error("Unexpected message from a worker.");
+      }
+    }
+    for (auto& worker : workers)
+    {
+      worker->SendLine("START");
+    }
+    std::cout << "=== " << title << " ===" << std::endl;
+
+    std::vector<IterationResult> workerResults;
+    for (auto& worker : workers)
+    {
+      workerResults.push_back(WorkerResultFromJson(worker->ReceiveLine()));
+    }
+    auto result = AggregateWorkerResults(title, workerResults);
+    std::cout << std::endl
+              << "=== Aggregated Results ===" << std::endl
+              << "Completed " << FormatNumber(result.Operations, false) << " operations on "
+              << workers.size() << " workers in a weighted-average of "
+              << FormatNumber(result.WeightedAverageSeconds, false) << "s ("
+              << FormatNumber(result.OperationsPerSecond) << " ops/s)" << std::endl
+              << std::endl;
+    PrintLatencies(result.Latencies);
+    PrintUsage(result);
+    results.push_back(std::move(result));
+  }
+  for (auto& worker : workers)
+  {
+    if (worker->ReceiveLine() != "READY")
+    {
+      throw std::runtime_error("Unexpected message from a worker.");
+    }
+    worker->SendLine("STOP");
+  }
+  return results;
+}
+
+// Runs the iterations of a worker of a distributed run, until its coordinator stops it.
+inline void RunWorker(
+    Azure::Core::Context const& context,
+    std::vector<std::unique_ptr<Azure::Perf::PerfTest>> const& tests,
+    Azure::Perf::GlobalTestOptions const& options,
+    Azure::Perf::_detail::CoordinatorConnection& coordinator)
+{
+  std::string iterationInfo;
+  for (int iteration = 0;; iteration++)
+  {
+    coordinator.SendLine("READY");
+    auto const command = coordinator.ReceiveLine();
+    if (command == "STOP")
+    {
+      return;
+    }
+    if (command != "START")
+    {
+      throw std::runtime_error("Unexpected message from the coordinator.");
+    }
+    if (iteration > 0)
+    {
+      iterationInfo.append(FormatNumber(iteration));
+    }
+    auto const result = RunTests(context, tests, options, "Test" + iterationInfo);
+    coordinator.SendLine(WorkerResultToJson(result));
+  }
 }
 
 } // namespace
@@ -307,6 +1283,39 @@ void Azure::Perf::Program::Run(
   // Print options
   PrintOptions(options, testOptions, argResults);
 
+  /******************** Distributed run ******************************/
+  if (options.Workers > 0)
+  {
+    // The coordinator doesn't run the test, the workers do.
+    try
+    {
+      auto const results = RunCoordinator(options);
+      if (!options.ResultsFile.empty())
+      {
+        WriteResultsFile(
+            options.ResultsFile,
+            testMetadata->Name,
+            options,
+            GetTestOptionsAsJson(testOptions, argResults),
+            results);
+      }
+      if (AnalyzeResults(results, options, testMetadata->Name))
+      {
+        std::exit(1);
+      }
+    }
+    catch (std::exception const& error)
+    {
+      std::cout << "Error: " << error.what();
+    }
+    return;
+  }
+  std::unique_ptr<Azure::Perf::_detail::CoordinatorConnection> coordinator;
+  if (!options.Coordinator.empty())
+  {
+    coordinator = Azure::Perf::_detail::CoordinatorConnection::Connect(options.Coordinator);
+  }
+
   // Create parallel pool of tests
   int const parallelTasks = options.Parallel;
   std::vector<std::unique_ptr<Azure::Perf::PerfTest>> parallelTest(parallelTasks);
@@ -340,16 +1349,35 @@ void Azure::Perf::Program::Run(
 
   /******************** Tests ******************************/
   std::string iterationInfo;
+  std::vector<IterationResult> results;
+  bool isRegression = false;
   try
   {
-    for (int iteration = 0; iteration < options.Iterations; iteration++)
+    // The coordinator of a distributed run starts the iterations, and aggregates their results.
+    if (coordinator)
+    {
+      RunWorker(context, parallelTest, options, *coordinator);
+    }
+    for (int iteration = 0; !coordinator && iteration < options.Iterations; iteration++)
     {
       if (iteration > 0)
       {
         iterationInfo.append(FormatNumber(iteration));
       }
-      RunTests(context, parallelTest, options, "Test" + iterationInfo);
+      results.push_back(RunTests(context, parallelTest, options, "Test" + iterationInfo));
     }
+
+    if (!coordinator && !options.ResultsFile.empty())
+    {
+      WriteResultsFile(
+          options.ResultsFile,
+          testMetadata->Name,
+          options,
+          GetTestOptionsAsJson(testOptions, argResults),
+          results);
+    }
+    // The coordinator of a distributed run analyzes the aggregated results.
+    isRegression = !coordinator && AnalyzeResults(results, options, testMetadata->Name);
   }
   catch (std::exception const& error)
   {
@@ -371,4 +1399,9 @@ void Azure::Perf::Program::Run(
     }
     test->GlobalCleanup();
   }
+
+  if (isRegression)
+  {
+    std::exit(1);
+  }
 }
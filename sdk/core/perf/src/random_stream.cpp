@@ -14,49 +14,89 @@
 #endif
 #endif
 
-static thread_local std::mt19937_64 random_generator(std::random_device{}());
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 namespace {
 
-static uint8_t RandomChar()
-{
-  static const uint8_t charset[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
-  std::uniform_int_distribution<size_t> distribution(0, sizeof(charset) - 2);
-  return charset[distribution(random_generator)];
-}
+static constexpr size_t DefaultRandomStreamBufferSize = 1024 * 1024;
 
-void RandomBuffer(uint8_t* buffer, size_t length)
-{
-  uint8_t* start_addr = buffer;
-  uint8_t* end_addr = buffer + length;
+// xoshiro256++ run as independent lanes, laid out so the compiler can vectorize the loop over
+// the lanes.
+class RandomGenerator final {
+public:
+  static constexpr size_t Lanes = 4;
 
-  const size_t rand_int_size = sizeof(uint64_t);
-  while (uintptr_t(start_addr) % rand_int_size != 0 && start_addr < end_addr)
+  RandomGenerator()
   {
-    *(start_addr++) = RandomChar();
+    std::random_device device;
+    uint64_t seed = (static_cast<uint64_t>(device()) << 32) | device();
+    for (size_t lane = 0; lane < Lanes; ++lane)
+    {
+      m_s0[lane] = SplitMix64(seed);
+      m_s1[lane] = SplitMix64(seed);
+      m_s2[lane] = SplitMix64(seed);
+      m_s3[lane] = SplitMix64(seed);
+    }
   }
 
-  std::uniform_int_distribution<uint64_t> distribution(0ULL, std::numeric_limits<uint64_t>::max());
-  while (start_addr + rand_int_size <= end_addr)
+  // Fills whole groups of Lanes words.
+  void Fill(uint64_t* words, size_t count)
   {
-    *reinterpret_cast<uint64_t*>(start_addr) = distribution(random_generator);
-    start_addr += rand_int_size;
+    for (size_t i = 0; i + Lanes <= count; i += Lanes)
+    {
+      for (size_t lane = 0; lane < Lanes; ++lane)
+      {
+        words[i + lane] = RotateLeft(m_s0[lane] + m_s3[lane], 23) + m_s0[lane];
+        const uint64_t t = m_s1[lane] << 17;
+        m_s2[lane] ^= m_s0[lane];
+        m_s3[lane] ^= m_s1[lane];
+        m_s1[lane] ^= m_s2[lane];
+        m_s0[lane] ^= m_s3[lane];
+        m_s2[lane] ^= t;
+        m_s3[lane] = RotateLeft(m_s3[lane], 45);
+      }
+    }
   }
-  while (start_addr < end_addr)
+
+private:
+  static uint64_t RotateLeft(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+  static uint64_t SplitMix64(uint64_t& state)
   {
-    *(start_addr++) = RandomChar();
+    uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
   }
-}
 
-static constexpr size_t DefaultRandomStreamBufferSize = 1024 * 1024;
+  uint64_t m_s0[Lanes];
+  uint64_t m_s1[Lanes];
+  uint64_t m_s2[Lanes];
+  uint64_t m_s3[Lanes];
+};
+
+// The random bytes are generated once, and only read afterwards.
+std::vector<uint8_t> const& GetRandomBlock()
+{
+  static std::vector<uint8_t> const block = []() {
+    constexpr size_t WordCount = DefaultRandomStreamBufferSize / sizeof(uint64_t);
+    static_assert(WordCount % RandomGenerator::Lanes == 0, "Whole groups of lanes.");
+    std::vector<uint64_t> words(WordCount);
+    RandomGenerator().Fill(words.data(), words.size());
+    std::vector<uint8_t> bytes(DefaultRandomStreamBufferSize);
+    std::memcpy(bytes.data(), words.data(), bytes.size());
+    return bytes;
+  }();
+  return block;
+}
 
 } // namespace
 
-Azure::Perf::RandomStream::CircularStream::CircularStream(size_t size)
-    : m_buffer(std::make_unique<std::vector<uint8_t>>(DefaultRandomStreamBufferSize)),
-      m_length(size), m_memoryStream(*m_buffer)
+Azure::Perf::RandomStream::CircularStream::CircularStream(size_t size) : m_length(size)
 {
-  RandomBuffer(m_buffer->data(), DefaultRandomStreamBufferSize);
+  GetRandomBlock();
 }
 
 size_t Azure::Perf::RandomStream::CircularStream::OnRead(
@@ -64,22 +104,29 @@ size_t Azure::Perf::RandomStream::CircularStream::OnRead(
     size_t count,
     Azure::Core::Context const& context)
 {
-  size_t available = m_length - m_totalRead;
-  if (available == 0)
-  {
-    return 0;
-  }
-
-  size_t toRead = std::min(count, available);
-  auto read = m_memoryStream.Read(buffer, toRead, context);
-
-  // Circurl implementation. Rewind the stream every time we reach the end
-  if (read == 0) // No more bytes to read from.
+  (void)context;
+  auto const& block = GetRandomBlock();
+  size_t const toRead = std::min(count, m_length - m_totalRead);
+  // Circular implementation. The block is copied from the offset reached, over and over.
+  for (size_t read = 0; read < toRead;)
   {
-    m_memoryStream.Rewind();
-    read = m_memoryStream.Read(buffer, toRead, context);
+    size_t const offset = (m_totalRead + read) % block.size();
+    size_t const copySize = std::min(toRead - read, block.size() - offset);
+    std::memcpy(buffer + read, block.data() + offset, copySize);
+    read += copySize;
   }
+  m_totalRead += toRead;
+  return toRead;
+}
 
-  m_totalRead += read;
-  return read;
+size_t Azure::Perf::RandomStream::RepeatedStream::OnRead(
+    uint8_t* buffer,
+    size_t count,
+    Azure::Core::Context const& context)
+{
+  (void)context;
+  size_t const toRead = std::min(count, m_length - m_totalRead);
+  std::memset(buffer, m_value, toRead);
+  m_totalRead += toRead;
+  return toRead;
 }
@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/perf/statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// The quantile of the Student's t distribution for the confidence intervals, or the one-sided
+// tests, at 95%. The normal distribution is close enough past 30 degrees of freedom.
+double GetTQuantile(double degreesOfFreedom, bool oneSided)
+{
+  // 97.5% quantiles, for two-sided 95% intervals.
+  static constexpr double TwoSided[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306,
+                                        2.262,  2.228, 2.201, 2.179, 2.160, 2.145, 2.131, 2.120,
+                                        2.110,  2.101, 2.093, 2.086, 2.080, 2.074, 2.069, 2.064,
+                                        2.060,  2.056, 2.052, 2.048, 2.045, 2.042};
+  // 95% quantiles, for one-sided tests at 95%.
+  static constexpr double OneSided[] = {6.314, 2.920, 2.353, 2.132, 2.015, 1.943, 1.895, 1.860,
+                                        1.833, 1.812, 1.796, 1.782, 1.771, 1.761, 1.753, 1.746,
+                                        1.740, 1.734, 1.729, 1.725, 1.721, 1.717, 1.714, 1.711,
+                                        1.708, 1.706, 1.703, 1.701, 1.699, 1.697};
+  constexpr size_t TableSize = sizeof(TwoSided) / sizeof(TwoSided[0]);
+  // Rounding the degrees of freedom down is conservative.
+  auto const index = static_cast<size_t>(std::floor(degreesOfFreedom)) - 1;
+  if (index >= TableSize)
+  {
+    return oneSided ? 1.645 : 1.960;
+  }
+  return oneSided ? OneSided[index] : TwoSided[index];
+}
+} // namespace
+
+Azure::Perf::_detail::SampleSummary Azure::Perf::_detail::Summarize(
+    std::vector<double> const& values)
+{
+  SampleSummary summary;
+  summary.Count = values.size();
+  if (values.empty())
+  {
+    return summary;
+  }
+  for (auto const value : values)
+  {
+    summary.Mean += value;
+  }
+  summary.Mean /= static_cast<double>(values.size());
+  if (values.size() < 2)
+  {
+    return summary;
+  }
+  double squares = 0;
+  for (auto const value : values)
+  {
+    squares += (value - summary.Mean) * (value - summary.Mean);
+  }
+  summary.StandardDeviation = std::sqrt(squares / static_cast<double>(values.size() - 1));
+  summary.ConfidenceInterval = GetTQuantile(static_cast<double>(values.size() - 1), false)
+      * summary.StandardDeviation / std::sqrt(static_cast<double>(values.size()));
+  return summary;
+}
+
+bool Azure::Perf::_detail::IsSignificantlyLower(
+    SampleSummary const& sample,
+    SampleSummary const& baseline)
+{
+  if (sample.Count < 2 || baseline.Count < 2 || sample.Mean >= baseline.Mean)
+  {
+    return false;
+  }
+  auto const sampleVariance
+      = sample.StandardDeviation * sample.StandardDeviation / static_cast<double>(sample.Count);
+  auto const baselineVariance = baseline.StandardDeviation * baseline.StandardDeviation
+      / static_cast<double>(baseline.Count);
+  auto const variance = sampleVariance + baselineVariance;
+  if (variance == 0)
+  {
+    // Both samples are constant, and differ.
+    return true;
+  }
+  // Welch-Satterthwaite degrees of freedom.
+  auto const degreesOfFreedom = variance * variance
+      / (sampleVariance * sampleVariance / static_cast<double>(sample.Count - 1)
+         + baselineVariance * baselineVariance / static_cast<double>(baseline.Count - 1));
+  auto const t = (baseline.Mean - sample.Mean) / std::sqrt(variance);
+  return t > GetTQuantile((std::max)(degreesOfFreedom, 1.0), true);
+}
@@ -38,6 +38,7 @@ namespace Azure { namespace Perf { namespace Test {
      */
     void GlobalSetup() override
     {
+      HttpClientGetTest::GlobalSetup();
       _detail::HttpClient = std::make_unique<Azure::Core::Http::CurlTransport>();
     }
 
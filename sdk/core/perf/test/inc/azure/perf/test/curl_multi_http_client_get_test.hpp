@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief An example of an asynchronous performance test.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/http/curl_multi_transport.hpp>
+#include <azure/core/http/http.hpp>
+#include <azure/perf.hpp>
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Perf { namespace Test {
+
+  namespace _detail {
+    static std::unique_ptr<Azure::Core::Http::CurlMultiTransport> CurlMultiHttpClient;
+  } // namespace _detail
+
+  /**
+   * @brief A performance test sending requests concurrently through the libcurl multi transport,
+   * without a thread per request.
+   *
+   */
+  class CurlMultiHttpClientGetTest : public Azure::Perf::PerfTestAsync {
+  private:
+    Azure::Core::Url m_url;
+
+  public:
+    /**
+     * @brief Construct a new libcurl multi HTTP client test.
+     *
+     * @param options The command-line parsed options.
+     */
+    CurlMultiHttpClientGetTest(Azure::Perf::TestOptions options) : PerfTestAsync(options) {}
+
+    /**
+     * @brief Set up the HTTP client
+     *
+     */
+    void GlobalSetup() override
+    {
+      _detail::CurlMultiHttpClient = std::make_unique<Azure::Core::Http::CurlMultiTransport>();
+    }
+
+    /**
+     * @brief Get and set the URL option
+     *
+     */
+    void Setup() override
+    {
+      m_url = Azure::Core::Url(m_options.GetMandatoryOption<std::string>("url"));
+    }
+
+    /**
+     * @brief The test definition
+     *
+     * @param ctx The cancellation token.
+     * @param completion Called once the response body is downloaded.
+     */
+    void RunAsync(
+        Azure::Core::Context const& ctx,
+        std::function<void(std::exception_ptr error)> completion) override
+    {
+      // The request is buffering its response, which the transport downloads before calling back.
+      auto request
+          = std::make_shared<Azure::Core::Http::Request>(Azure::Core::Http::HttpMethod::Get, m_url);
+      _detail::CurlMultiHttpClient->SendAsync(
+          *request,
+          ctx,
+          [request, completion](
+              std::unique_ptr<Azure::Core::Http::RawResponse>, std::exception_ptr error) {
+            completion(error);
+          });
+    }
+
+    /**
+     * @brief Release the HTTP client
+     *
+     */
+    void GlobalCleanup() override { _detail::CurlMultiHttpClient.reset(); }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {{"url", {"--url"}, "Url to send the HTTP request. *Required parameter.", 1, true}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "curlMultiHttpClientGet",
+          "Send HTTP GET requests to a configurable URL concurrently using the libcurl multi "
+          "interface.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Perf::Test::CurlMultiHttpClientGetTest>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Perf::Test
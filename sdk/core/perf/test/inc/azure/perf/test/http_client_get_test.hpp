@@ -10,18 +10,21 @@
 #pragma once
 
 #include <azure/perf.hpp>
+#include <azure/perf/loopback_http_server.hpp>
 
 #include <azure/core/http/http.hpp>
 #include <azure/core/http/transport.hpp>
 #include <azure/core/io/body_stream.hpp>
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace Azure { namespace Perf { namespace Test {
 
   namespace _detail {
     static std::unique_ptr<Azure::Core::Http::HttpTransport> HttpClient;
+    static std::unique_ptr<Azure::Perf::LoopbackHttpServer> LoopbackServer;
   } // namespace _detail
 
   /**
@@ -41,12 +44,46 @@ namespace Azure { namespace Perf { namespace Test {
     HttpClientGetTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
 
     /**
-     * @brief Get and set the URL option
+     * @brief Start a loopback HTTP server when no URL is given.
+     *
+     * @remark Derived tests setting up the HTTP client must call it.
+     */
+    void GlobalSetup() override
+    {
+      if (m_options.GetOptionOrDefault<std::string>("url", "").empty())
+      {
+        _detail::LoopbackServer = std::make_unique<Azure::Perf::LoopbackHttpServer>();
+      }
+    }
+
+    /**
+     * @brief Get and set the URL option, or the URL of the loopback server.
      *
      */
     void Setup() override
     {
-      m_url = Azure::Core::Url(m_options.GetMandatoryOption<std::string>("url"));
+      if (!_detail::LoopbackServer)
+      {
+        m_url = Azure::Core::Url(m_options.GetMandatoryOption<std::string>("url"));
+        return;
+      }
+
+      m_url = Azure::Core::Url(_detail::LoopbackServer->GetUrl());
+      m_url.AppendQueryParameter("size", std::to_string(m_options.GetOptionOrDefault("Size", 0L)));
+      if (m_options.GetOptionOrDefault("Chunked", false))
+      {
+        m_url.AppendQueryParameter("chunked", "true");
+      }
+    }
+
+    /**
+     * @brief Stop the HTTP client and the loopback server.
+     *
+     */
+    void GlobalCleanup() override
+    {
+      _detail::HttpClient.reset();
+      _detail::LoopbackServer.reset();
     }
 
     /**
@@ -70,7 +107,18 @@ namespace Azure { namespace Perf { namespace Test {
      */
     std::vector<Azure::Perf::TestOption> GetTestOptions() override
     {
-      return {{"url", {"--url"}, "Url to send the HTTP request. *Required parameter.", 1, true}};
+      return {
+          {"url",
+           {"--url"},
+           "Url to send the HTTP request. Default to a loopback HTTP server answering with the "
+           "size and encoding below.",
+           1},
+          {"Size", {"--size", "-s"}, "Size of the loopback server responses (in bytes).", 1},
+          {"Chunked",
+           {"--chunked"},
+           "Send the loopback server responses with the chunked transfer encoding. Default to "
+           "false.",
+           1}};
     }
   };
 
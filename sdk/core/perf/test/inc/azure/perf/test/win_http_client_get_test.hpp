@@ -34,6 +34,7 @@ namespace Azure { namespace Perf { namespace Test {
      */
     void GlobalSetup() override
     {
+      HttpClientGetTest::GlobalSetup();
       _detail::HttpClient = std::make_unique<Azure::Core::Http::WinHttpTransport>();
     }
 
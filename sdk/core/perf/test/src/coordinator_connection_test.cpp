@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include <azure/perf/coordinator_connection.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using Azure::Perf::_detail::CoordinatorConnection;
+using Azure::Perf::_detail::CoordinatorListener;
+
+TEST(coordinator_connection, exchange_lines)
+{
+  CoordinatorListener listener(0);
+  EXPECT_NE(listener.GetPort(), 0);
+
+  std::string received;
+  std::thread worker([&listener, &received]() {
+    auto coordinator
+        = CoordinatorConnection::Connect("127.0.0.1:" + std::to_string(listener.GetPort()));
+    coordinator->SendLine("READY");
+    received = coordinator->ReceiveLine();
+    // Lines sent together are received one at a time.
+    coordinator->SendLine("first");
+    coordinator->SendLine(std::string(10000, 'x'));
+  });
+
+  auto worker_connection = listener.Accept();
+  EXPECT_EQ(worker_connection->ReceiveLine(), "READY");
+  worker_connection->SendLine("START");
+  EXPECT_EQ(worker_connection->ReceiveLine(), "first");
+  EXPECT_EQ(worker_connection->ReceiveLine(), std::string(10000, 'x'));
+  worker.join();
+  EXPECT_EQ(received, "START");
+
+  // The worker closed its connection.
+  EXPECT_THROW(worker_connection->ReceiveLine(), std::runtime_error);
+}
+
+TEST(coordinator_connection, invalid_address)
+{
+  EXPECT_THROW(CoordinatorConnection::Connect("localhost"), std::runtime_error);
+  EXPECT_THROW(CoordinatorConnection::Connect("localhost:"), std::runtime_error);
+}
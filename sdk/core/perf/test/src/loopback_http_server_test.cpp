@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include <azure/perf/loopback_http_server.hpp>
+
+#if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
+#include <azure/core/http/curl_transport.hpp>
+#endif
+#include <azure/core/context.hpp>
+#include <azure/core/http/http.hpp>
+#include <azure/core/url.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST(loopback_http_server, listen)
+{
+  Azure::Perf::LoopbackHttpServer server;
+  EXPECT_NE(server.GetPort(), 0);
+  EXPECT_EQ(server.GetUrl(), "http://127.0.0.1:" + std::to_string(server.GetPort()) + "/");
+}
+
+#if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
+namespace {
+std::vector<uint8_t> Get(
+    Azure::Core::Http::HttpTransport& transport,
+    Azure::Perf::LoopbackHttpServer const& server,
+    std::string const& query)
+{
+  Azure::Core::Http::Request request(
+      Azure::Core::Http::HttpMethod::Get, Azure::Core::Url(server.GetUrl() + "?" + query));
+  auto response = transport.Send(request, Azure::Core::Context::ApplicationContext);
+  EXPECT_EQ(response->GetStatusCode(), Azure::Core::Http::HttpStatusCode::Ok);
+  return response->ExtractBodyStream()->ReadToEnd(Azure::Core::Context::ApplicationContext);
+}
+} // namespace
+
+TEST(loopback_http_server, content_length)
+{
+  Azure::Perf::LoopbackHttpServer server;
+  Azure::Core::Http::CurlTransport transport;
+
+  EXPECT_EQ(Get(transport, server, "size=0").size(), 0);
+  // The connection is kept alive between the requests.
+  for (int i = 0; i < 3; i++)
+  {
+    EXPECT_EQ(Get(transport, server, "size=1048577"), std::vector<uint8_t>(1048577, 'x'));
+  }
+}
+
+TEST(loopback_http_server, chunked)
+{
+  Azure::Perf::LoopbackHttpServer server;
+  Azure::Core::Http::CurlTransport transport;
+
+  EXPECT_EQ(Get(transport, server, "size=0&chunked=true").size(), 0);
+  EXPECT_EQ(
+      Get(transport, server, "size=100000&chunked=true&chunkSize=777"),
+      std::vector<uint8_t>(100000, 'x'));
+  EXPECT_EQ(
+      Get(transport, server, "chunked=true&size=300000"), std::vector<uint8_t>(300000, 'x'));
+}
+#endif
@@ -2,11 +2,13 @@
 // SPDX-License-Identifier: MIT
 
 #include <azure/perf.hpp>
+#include <azure/perf/allocation_hook.hpp>
 
 #include "azure/perf/test/delay_test.hpp"
 #include "azure/perf/test/extended_options_test.hpp"
 #if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
 #include "azure/perf/test/curl_http_client_get_test.hpp"
+#include "azure/perf/test/curl_multi_http_client_get_test.hpp"
 #endif
 #if defined(BUILD_TRANSPORT_WINHTTP_ADAPTER)
 #include "azure/perf/test/win_http_client_get_test.hpp"
@@ -28,6 +30,7 @@ int main(int argc, char** argv)
 
 #if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
   tests.emplace_back(Azure::Perf::Test::CurlHttpClientGetTest::GetTestMetadata());
+  tests.emplace_back(Azure::Perf::Test::CurlMultiHttpClientGetTest::GetTestMetadata());
 #endif
 
 #if defined(BUILD_TRANSPORT_WINHTTP_ADAPTER)
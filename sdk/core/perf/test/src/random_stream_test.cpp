@@ -4,6 +4,8 @@
 #include <gtest/gtest.h>
 
 #include <azure/perf/random_stream.hpp>
+
+#include <algorithm>
 #include <vector>
 
 TEST(circular_stream, basic)
@@ -43,3 +45,49 @@ TEST(circular_stream, basic)
     EXPECT_EQ(buffer[i], buffer2[i]);
   }
 }
+
+TEST(circular_stream, unaligned_reads)
+{
+  size_t const blockSize = 1024 * 1024;
+  size_t const totalSize = blockSize * 2 + 100;
+  auto r_stream = Azure::Perf::RandomStream::Create(totalSize);
+  auto content = r_stream->ReadToEnd(Azure::Core::Context::ApplicationContext);
+  ASSERT_EQ(content.size(), totalSize);
+  // The bytes repeat the block.
+  for (size_t i = blockSize; i != totalSize; i++)
+  {
+    EXPECT_EQ(content[i], content[i - blockSize]);
+  }
+
+  // Reads crossing the end of the block.
+  r_stream->Rewind();
+  std::vector<uint8_t> buffer(totalSize);
+  size_t offset = 0;
+  while (auto count = r_stream->Read(
+             buffer.data() + offset, 300 * 1024, Azure::Core::Context::ApplicationContext))
+  {
+    offset += count;
+  }
+  EXPECT_EQ(offset, totalSize);
+  EXPECT_EQ(buffer, content);
+
+  // Streams share the same random bytes.
+  auto other = Azure::Perf::RandomStream::Create(100)->ReadToEnd(
+      Azure::Core::Context::ApplicationContext);
+  EXPECT_TRUE(std::equal(other.begin(), other.end(), content.begin()));
+}
+
+TEST(repeated_stream, basic)
+{
+  auto r_stream = Azure::Perf::RandomStream::CreateRepeated(1000, 'a');
+  EXPECT_EQ(r_stream->Length(), 1000);
+  std::vector<uint8_t> buffer(600);
+  EXPECT_EQ(r_stream->Read(buffer.data(), 600, Azure::Core::Context::ApplicationContext), 600U);
+  EXPECT_EQ(r_stream->Read(buffer.data(), 600, Azure::Core::Context::ApplicationContext), 400U);
+  EXPECT_EQ(r_stream->Read(buffer.data(), 600, Azure::Core::Context::ApplicationContext), 0U);
+  EXPECT_EQ(std::count(buffer.begin(), buffer.begin() + 400, 'a'), 400);
+
+  r_stream->Rewind();
+  auto content = r_stream->ReadToEnd(Azure::Core::Context::ApplicationContext);
+  EXPECT_EQ(content, std::vector<uint8_t>(1000, 'a'));
+}
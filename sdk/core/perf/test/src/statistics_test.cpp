@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include <azure/perf/statistics.hpp>
+
+#include <cmath>
+#include <vector>
+
+using Azure::Perf::_detail::IsSignificantlyLower;
+using Azure::Perf::_detail::Summarize;
+
+TEST(statistics, summarize)
+{
+  auto const empty = Summarize({});
+  EXPECT_EQ(empty.Count, 0U);
+  EXPECT_EQ(empty.Mean, 0);
+
+  auto const single = Summarize({42});
+  EXPECT_EQ(single.Count, 1U);
+  EXPECT_EQ(single.Mean, 42);
+  EXPECT_EQ(single.StandardDeviation, 0);
+  EXPECT_EQ(single.ConfidenceInterval, 0);
+
+  auto const summary = Summarize({2, 4, 4, 4, 5, 5, 7, 9});
+  EXPECT_EQ(summary.Count, 8U);
+  EXPECT_DOUBLE_EQ(summary.Mean, 5);
+  EXPECT_NEAR(summary.StandardDeviation, 2.138, 0.001);
+  // t(0.975, 7) = 2.365
+  EXPECT_NEAR(summary.ConfidenceInterval, 2.365 * 2.138 / std::sqrt(8.0), 0.001);
+}
+
+TEST(statistics, significantly_lower)
+{
+  auto const baseline = Summarize({100, 102, 98, 101, 99});
+  // Within the noise.
+  EXPECT_FALSE(IsSignificantlyLower(Summarize({99, 101, 97, 100, 98}), baseline));
+  // Clearly lower.
+  EXPECT_TRUE(IsSignificantlyLower(Summarize({90, 91, 89, 90, 92}), baseline));
+  // Higher is never a regression.
+  EXPECT_FALSE(IsSignificantlyLower(Summarize({110, 111, 109, 110, 112}), baseline));
+  // Not enough measurements.
+  EXPECT_FALSE(IsSignificantlyLower(Summarize({50}), baseline));
+  EXPECT_FALSE(IsSignificantlyLower(baseline, Summarize({200})));
+  // Constant samples.
+  EXPECT_TRUE(IsSignificantlyLower(Summarize({1, 1}), Summarize({2, 2})));
+}
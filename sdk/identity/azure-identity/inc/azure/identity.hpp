@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include "azure/identity/chained_token_credential.hpp"
 #include "azure/identity/client_secret_credential.hpp"
 #include "azure/identity/dll_import_export.hpp"
 #include "azure/identity/environment_credential.hpp"
 #include "azure/identity/managed_identity_credential.hpp"
+#include "azure/identity/token_cache_persistence.hpp"
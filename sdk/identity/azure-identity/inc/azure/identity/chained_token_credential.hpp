@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Chained Token Credential and options.
+ */
+
+#pragma once
+
+#include <azure/core/credentials/credentials.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Azure { namespace Identity {
+  /**
+   * @brief Options for the Chained Token Credential.
+   *
+   */
+  struct ChainedTokenCredentialOptions final
+  {
+    /**
+     * @brief How long a source is tried before the next one, until a source gets a token. A
+     * Managed Identity source probing an IMDS endpoint that isn't there would otherwise only fail
+     * once the connection and its retries time out.
+     *
+     * @note The requests to the source that got a token aren't limited.
+     */
+    std::chrono::milliseconds ProbeTimeout = std::chrono::seconds(10);
+  };
+
+  /**
+   * @brief Chained Token Credential tries its sources in order, and keeps using the first one that
+   * gets a token.
+   *
+   * @note Once a source got a token, the next tokens are only got from that source, with a single
+   * call, and its errors are thrown. Until then, each call tries the sources again.
+   */
+  class ChainedTokenCredential final : public Core::Credentials::TokenCredential {
+  public:
+    /**
+     * @brief The credentials to get the tokens from, in order.
+     *
+     */
+    using Sources = std::vector<std::shared_ptr<Core::Credentials::TokenCredential const>>;
+
+  private:
+    Sources m_sources;
+    std::chrono::milliseconds m_probeTimeout;
+    // Serializes the probes, so that concurrent calls wait for the first one to find a source.
+    mutable std::mutex m_probeMutex;
+    mutable std::atomic<Core::Credentials::TokenCredential const*> m_selectedSource{nullptr};
+
+  public:
+    /**
+     * @brief Constructs a Chained Token Credential.
+     *
+     * @param sources The credentials to get the tokens from, in order.
+     * @param options Options for trying the sources.
+     *
+     * @throw std::invalid_argument \p sources is empty or has a null credential.
+     */
+    explicit ChainedTokenCredential(
+        Sources sources,
+        ChainedTokenCredentialOptions const& options = ChainedTokenCredentialOptions());
+
+    /**
+     * @brief Destructs `%ChainedTokenCredential`.
+     *
+     */
+    ~ChainedTokenCredential() override;
+
+    /**
+     * @brief Gets an authentication token from the first source that gets one.
+     *
+     * @param tokenRequestContext A context to get the token in.
+     * @param context A context to control the request lifetime.
+     *
+     * @throw Azure::Core::Credentials::AuthenticationException None of the sources got a token, or
+     * the source that got one earlier failed.
+     */
+    Core::Credentials::AccessToken GetToken(
+        Core::Credentials::TokenRequestContext const& tokenRequestContext,
+        Core::Context const& context) const override;
+  };
+
+}} // namespace Azure::Identity
@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Azure { namespace Identity {
   namespace _detail {
@@ -68,6 +69,20 @@ namespace Azure { namespace Identity {
     Core::Credentials::AccessToken GetToken(
         Core::Credentials::TokenRequestContext const& tokenRequestContext,
         Core::Context const& context) const override;
+
+    /**
+     * @brief Acquires the tokens for some scopes ahead of the first requests, such as at startup,
+     * so that the requests get them from the token cache instead of the Managed Identity endpoint.
+     *
+     * @param scopes Authentication scopes, a token is acquired for each of them concurrently.
+     * @param context A context to control the request lifetime.
+     *
+     * @throw Azure::Core::Credentials::AuthenticationException Authentication error occurred
+     * acquiring one of the tokens.
+     */
+    void Warmup(
+        std::vector<std::string> const& scopes,
+        Core::Context const& context = Core::Context()) const;
   };
 
 }} // namespace Azure::Identity
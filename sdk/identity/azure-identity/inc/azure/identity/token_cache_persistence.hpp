@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Persistence of the tokens cached by the credentials in an encrypted file.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Identity {
+  /**
+   * @brief Options for persisting the cached tokens.
+   *
+   */
+  struct TokenCachePersistenceOptions final
+  {
+    /**
+     * @brief The path of the cache file. A lock file with the `.lock` extension appended is created
+     * next to it.
+     *
+     */
+    std::string FilePath;
+
+    /**
+     * @brief The 256-bit AES key the cache file is encrypted with. Processes sharing the file have
+     * to use the same key.
+     *
+     */
+    std::vector<uint8_t> EncryptionKey;
+  };
+
+  /**
+   * @brief Persists the tokens cached by the credentials of the process in an encrypted file, so
+   * that the processes started later reuse the tokens that are still valid instead of requesting
+   * them again. Concurrent processes lock the file while they use it.
+   *
+   * @remark The tokens are keyed by a hash of the token requests, so that the file doesn't hold
+   * any client secret. Failing to read or write the file, such as when it was encrypted with
+   * another key, doesn't fail getting the token.
+   *
+   */
+  class TokenCachePersistence final {
+  private:
+    TokenCachePersistence() = delete;
+    ~TokenCachePersistence() = delete;
+
+  public:
+    /**
+     * @brief Starts persisting the cached tokens.
+     *
+     * @param options The file and its encryption key.
+     *
+     * @throw std::invalid_argument The file path is empty, or the key isn't 32 bytes long.
+     */
+    static void Enable(TokenCachePersistenceOptions const& options);
+
+    /**
+     * @brief Stops persisting the cached tokens. The file is left as is.
+     *
+     */
+    static void Disable();
+  };
+}} // namespace Azure::Identity
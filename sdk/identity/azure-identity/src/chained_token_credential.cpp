@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/identity/chained_token_credential.hpp"
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+
+using namespace Azure::Identity;
+using Azure::Core::Credentials::AccessToken;
+using Azure::Core::Credentials::AuthenticationException;
+
+ChainedTokenCredential::ChainedTokenCredential(
+    Sources sources,
+    ChainedTokenCredentialOptions const& options)
+    : m_sources(std::move(sources)), m_probeTimeout(options.ProbeTimeout)
+{
+  if (m_sources.empty())
+  {
+    throw std::invalid_argument("ChainedTokenCredential needs at least one source.");
+  }
+  for (auto const& source : m_sources)
+  {
+    if (!source)
+    {
+      throw std::invalid_argument("ChainedTokenCredential sources can't be null.");
+    }
+  }
+}
+
+ChainedTokenCredential::~ChainedTokenCredential() = default;
+
+AccessToken ChainedTokenCredential::GetToken(
+    Azure::Core::Credentials::TokenRequestContext const& tokenRequestContext,
+    Azure::Core::Context const& context) const
+{
+  if (auto const selectedSource = m_selectedSource.load(std::memory_order_acquire))
+  {
+    return selectedSource->GetToken(tokenRequestContext, context);
+  }
+
+  std::lock_guard<std::mutex> lock(m_probeMutex);
+  // Another call may have found the source while this one waited.
+  if (auto const selectedSource = m_selectedSource.load(std::memory_order_acquire))
+  {
+    return selectedSource->GetToken(tokenRequestContext, context);
+  }
+
+  std::string errors;
+  for (auto const& source : m_sources)
+  {
+    try
+    {
+      auto const probeContext = context.WithDeadline(
+          std::chrono::system_clock::now()
+          + std::chrono::duration_cast<std::chrono::system_clock::duration>(m_probeTimeout));
+      auto token = source->GetToken(tokenRequestContext, probeContext);
+      m_selectedSource.store(source.get(), std::memory_order_release);
+      return token;
+    }
+    catch (std::exception const& e)
+    {
+      // Only the probe timing out moves on to the next source, not the caller cancelling.
+      context.ThrowIfCancelled();
+      errors += errors.empty() ? e.what() : std::string(" ") + e.what();
+    }
+  }
+
+  throw AuthenticationException(
+      "ChainedTokenCredential failed to get a token from any of its sources: " + errors);
+}
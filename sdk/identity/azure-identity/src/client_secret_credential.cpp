@@ -42,18 +42,18 @@ Azure::Core::Credentials::AccessToken ClientSecretCredential::GetToken(
     using _detail::TokenCredentialImpl;
     using Azure::Core::Http::HttpMethod;
 
-    std::ostringstream body;
-    body << m_requestBody;
+    // The body is the one formatted at construction, with the scopes of the request appended.
+    std::string body = m_requestBody;
     {
       auto const& scopes = tokenRequestContext.Scopes;
       if (!scopes.empty())
       {
-        body << "&scope=" << TokenCredentialImpl::FormatScopes(scopes, m_isAdfs);
+        body += "&scope=" + TokenCredentialImpl::FormatScopes(scopes, m_isAdfs);
       }
     }
 
     auto request = std::make_unique<TokenCredentialImpl::TokenRequest>(
-        HttpMethod::Post, m_requestUrl, body.str());
+        HttpMethod::Post, m_requestUrl, std::move(body));
 
     if (m_isAdfs)
     {
@@ -4,6 +4,9 @@
 #include "azure/identity/managed_identity_credential.hpp"
 #include "private/managed_identity_source.hpp"
 
+#include <exception>
+#include <future>
+
 using namespace Azure::Identity;
 
 namespace {
@@ -48,3 +51,41 @@ Azure::Core::Credentials::AccessToken ManagedIdentityCredential::GetToken(
 {
   return m_managedIdentitySource->GetToken(tokenRequestContext, context);
 }
+
+void ManagedIdentityCredential::Warmup(
+    std::vector<std::string> const& scopes,
+    Azure::Core::Context const& context) const
+{
+  using Azure::Core::Credentials::TokenRequestContext;
+
+  std::vector<std::future<void>> tokenFutures;
+  for (auto const& scope : scopes)
+  {
+    tokenFutures.emplace_back(std::async(std::launch::async, [this, scope, &context]() {
+      TokenRequestContext tokenRequestContext;
+      tokenRequestContext.Scopes = {scope};
+      GetToken(tokenRequestContext, context);
+    }));
+  }
+
+  // Every token is waited for before the first error is thrown, the futures refer to the context.
+  std::exception_ptr firstError;
+  for (auto& tokenFuture : tokenFutures)
+  {
+    try
+    {
+      tokenFuture.get();
+    }
+    catch (...)
+    {
+      if (!firstError)
+      {
+        firstError = std::current_exception();
+      }
+    }
+  }
+  if (firstError)
+  {
+    std::rethrow_exception(firstError);
+  }
+}
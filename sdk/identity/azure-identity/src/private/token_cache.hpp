@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Process-wide cache of the tokens fetched by the credentials.
+ */
+
+#pragma once
+
+#include <azure/core/credentials/credentials.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace Azure { namespace Identity { namespace _detail {
+  /**
+   * @brief Caches the tokens of all the credentials in the process, so that credentials requesting
+   * the same token share it, and fetches each token only once at a time.
+   *
+   * @remark The expired tokens are removed as new keys are added.
+   */
+  class TokenCache final {
+  private:
+    TokenCache() = delete;
+    ~TokenCache() = delete;
+
+  public:
+    /**
+     * @brief Gets the cached token for a key, fetching a new one when there's none or it expires
+     * in 5 or less minutes.
+     *
+     * @param key Identifies the token, such as the authority, tenant, client and scopes it is
+     * requested for. Only its hash is kept, since it can hold a client secret.
+     * @param getNewToken A function to fetch a new token. Concurrent calls for the same key wait
+     * for a single fetch.
+     *
+     * @return The cached or the new token.
+     */
+    static Core::Credentials::AccessToken GetToken(
+        std::string const& key,
+        std::function<Core::Credentials::AccessToken()> const& getNewToken);
+
+    /**
+     * @brief Removes all the cached tokens.
+     *
+     */
+    static void Clear();
+
+    /**
+     * @brief Gets the number of keys in the cache.
+     *
+     */
+    static size_t GetSize();
+  };
+}}} // namespace Azure::Identity::_detail
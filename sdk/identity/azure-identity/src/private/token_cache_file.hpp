@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Encrypted file persisting the cached tokens across processes.
+ */
+
+#pragma once
+
+#include "azure/identity/token_cache_persistence.hpp"
+
+#include <azure/core/credentials/credentials.hpp>
+
+#include <memory>
+#include <string>
+
+namespace Azure { namespace Identity { namespace _detail {
+  /**
+   * @brief Reads and writes the tokens of an encrypted cache file, holding a lock on the file
+   * while doing so.
+   *
+   */
+  class TokenCacheFile final {
+  private:
+    TokenCachePersistenceOptions m_options;
+
+  public:
+    /**
+     * @brief Constructs `%TokenCacheFile`.
+     *
+     * @param options The file and its encryption key.
+     *
+     * @throw std::invalid_argument The file path is empty, or the key isn't 32 bytes long.
+     */
+    explicit TokenCacheFile(TokenCachePersistenceOptions options);
+
+    /**
+     * @brief Finds the token persisted for a key.
+     *
+     * @param key The hash of the key of the token in #TokenCache.
+     *
+     * @return The token, or `nullptr` when there's none or the file can't be read.
+     */
+    std::unique_ptr<Core::Credentials::AccessToken> Find(std::string const& key) const;
+
+    /**
+     * @brief Persists the token for a key, along with the unexpired tokens of the file. Failing
+     * to write the file is ignored.
+     *
+     * @param key The hash of the key of the token in #TokenCache.
+     * @param token The token.
+     */
+    void Save(std::string const& key, Core::Credentials::AccessToken const& token) const;
+  };
+}}} // namespace Azure::Identity::_detail
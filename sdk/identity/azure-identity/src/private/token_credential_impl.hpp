@@ -63,7 +63,7 @@ namespace Azure { namespace Identity { namespace _detail {
      */
     class TokenRequest final {
     private:
-      std::unique_ptr<std::string> m_body;
+      Core::IO::SharedBuffer m_body;
       std::unique_ptr<Core::IO::MemoryBodyStream> m_memoryBodyStream;
 
     public:
@@ -81,14 +81,11 @@ namespace Azure { namespace Identity { namespace _detail {
        * @param body Body for the `HttpRequest`.
        */
       explicit TokenRequest(Core::Http::HttpMethod httpMethod, Core::Url url, std::string body)
-          : m_body(new std::string(std::move(body))),
-            m_memoryBodyStream(new Core::IO::MemoryBodyStream(
-                reinterpret_cast<uint8_t const*>(m_body->data()),
-                m_body->size())),
+          : m_body(std::move(body)), m_memoryBodyStream(new Core::IO::MemoryBodyStream(m_body)),
             HttpRequest(std::move(httpMethod), std::move(url), m_memoryBodyStream.get())
       {
         HttpRequest.SetHeader("Content-Type", "application/x-www-form-urlencoded");
-        HttpRequest.SetHeader("Content-Length", std::to_string(m_body->size()));
+        HttpRequest.SetHeader("Content-Length", std::to_string(m_body.GetSize()));
       }
 
       /**
@@ -98,6 +95,18 @@ namespace Azure { namespace Identity { namespace _detail {
       explicit TokenRequest(Core::Http::Request httpRequest) : HttpRequest(std::move(httpRequest))
       {
       }
+
+      /**
+       * @brief Gets the body of the `HttpRequest`.
+       *
+       * @return The body of the `HttpRequest`, empty if it was constructed from an HTTP request.
+       */
+      std::string GetBody() const
+      {
+        return m_body.GetSize() == 0
+            ? std::string()
+            : std::string(reinterpret_cast<char const*>(m_body.GetData()), m_body.GetSize());
+      }
     };
 
     /**
@@ -109,6 +118,9 @@ namespace Azure { namespace Identity { namespace _detail {
      * another request.
      *
      * @throw Azure::Core::Credentials::AuthenticationException Authentication error occurred.
+     *
+     * @note The tokens are cached process-wide, keyed by the method, URL, headers and body of the
+     * request \p createRequest creates first, so credentials requesting the same token share it.
      */
     Core::Credentials::AccessToken GetToken(
         Core::Context const& context,
@@ -117,5 +129,14 @@ namespace Azure { namespace Identity { namespace _detail {
             Core::Http::HttpStatusCode statusCode,
             Core::Http::RawResponse const& response)> const& shouldRetry
         = [](auto const, auto const&) { return nullptr; }) const;
+
+  private:
+    // Sends the token request, and the requests shouldRetry returns, and parses the token.
+    Core::Credentials::AccessToken RequestToken(
+        Core::Context const& context,
+        std::unique_ptr<TokenRequest> request,
+        std::function<std::unique_ptr<TokenRequest>(
+            Core::Http::HttpStatusCode statusCode,
+            Core::Http::RawResponse const& response)> const& shouldRetry) const;
   };
 }}} // namespace Azure::Identity::_detail
@@ -0,0 +1,148 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "private/token_cache.hpp"
+
+#include "azure/identity/token_cache_persistence.hpp"
+#include "private/token_cache_file.hpp"
+
+#include <azure/core/base64.hpp>
+#include <azure/core/internal/cryptography/sha_hash.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+
+using Azure::Core::Credentials::AccessToken;
+using Azure::Identity::TokenCachePersistence;
+using Azure::Identity::_detail::TokenCache;
+using Azure::Identity::_detail::TokenCacheFile;
+
+namespace {
+// A token expiring this soon is refreshed, so that the bearer token policies refreshing their token
+// ahead of expiry get a new one.
+constexpr auto MinimumExpiration = std::chrono::minutes(5);
+
+struct CacheEntry final
+{
+  // Held while fetching the token.
+  std::mutex Mutex;
+  std::unique_ptr<AccessToken> Token;
+};
+
+// The expired tokens are removed once the cache reaches this size, which is then doubled, so
+// that a process requesting many different tokens doesn't keep all of them.
+constexpr size_t MinimumSweepSize = 64;
+
+std::mutex g_cacheMutex;
+// Indexed by the hash of the keys.
+std::map<std::string, std::shared_ptr<CacheEntry>> g_cache;
+size_t g_sweepSize = MinimumSweepSize;
+// Set when the tokens are persisted.
+std::shared_ptr<TokenCacheFile const> g_cacheFile;
+
+bool IsExpiring(AccessToken const& token)
+{
+  return token.ExpiresOn < std::chrono::system_clock::now() + MinimumExpiration;
+}
+
+// The keys hold the client secrets of the requests, so only their hash is kept.
+std::string HashKey(std::string const& key)
+{
+  auto const hash = Azure::Core::Cryptography::_internal::Sha256Hash().Final(
+      reinterpret_cast<uint8_t const*>(key.data()), key.size());
+  return Azure::Core::Convert::Base64Encode(hash);
+}
+
+// Removes the entries without a token or with an expired one. Called with g_cacheMutex held, the
+// entries are only copied with it held, so an entry only referenced by the cache isn't in use.
+void RemoveExpiredEntries()
+{
+  auto const now = std::chrono::system_clock::now();
+  for (auto ite = g_cache.begin(); ite != g_cache.end();)
+  {
+    auto const& entry = *ite->second;
+    if (ite->second.use_count() == 1 && (!entry.Token || entry.Token->ExpiresOn < now))
+    {
+      ite = g_cache.erase(ite);
+    }
+    else
+    {
+      ++ite;
+    }
+  }
+  g_sweepSize = (std::max)(MinimumSweepSize, g_cache.size() * 2);
+}
+} // namespace
+
+AccessToken TokenCache::GetToken(
+    std::string const& key,
+    std::function<AccessToken()> const& getNewToken)
+{
+  auto const hashedKey = HashKey(key);
+  std::shared_ptr<CacheEntry> entry;
+  std::shared_ptr<TokenCacheFile const> cacheFile;
+  {
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+    auto cachedEntry = g_cache.find(hashedKey);
+    if (cachedEntry == g_cache.end())
+    {
+      if (g_cache.size() >= g_sweepSize)
+      {
+        RemoveExpiredEntries();
+      }
+      cachedEntry = g_cache.emplace(hashedKey, std::make_shared<CacheEntry>()).first;
+    }
+    entry = cachedEntry->second;
+    cacheFile = g_cacheFile;
+  }
+
+  std::lock_guard<std::mutex> lock(entry->Mutex);
+  if (!entry->Token || IsExpiring(*entry->Token))
+  {
+    // A token persisted by an earlier process is reused until it's about to expire.
+    auto persistedToken = cacheFile ? cacheFile->Find(hashedKey) : nullptr;
+    if (persistedToken && !IsExpiring(*persistedToken))
+    {
+      entry->Token = std::move(persistedToken);
+    }
+    else
+    {
+      entry->Token = std::make_unique<AccessToken>(getNewToken());
+      if (cacheFile)
+      {
+        cacheFile->Save(hashedKey, *entry->Token);
+      }
+    }
+  }
+
+  return *entry->Token;
+}
+
+void TokenCache::Clear()
+{
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+  g_cache.clear();
+  g_sweepSize = MinimumSweepSize;
+}
+
+size_t TokenCache::GetSize()
+{
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+  return g_cache.size();
+}
+
+void TokenCachePersistence::Enable(TokenCachePersistenceOptions const& options)
+{
+  auto cacheFile = std::make_shared<TokenCacheFile const>(options);
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+  g_cacheFile = std::move(cacheFile);
+}
+
+void TokenCachePersistence::Disable()
+{
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+  g_cacheFile.reset();
+}
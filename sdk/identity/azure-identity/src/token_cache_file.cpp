@@ -0,0 +1,454 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "private/token_cache_file.hpp"
+
+#include <azure/core/datetime.hpp>
+#include <azure/core/internal/json/json.hpp>
+#include <azure/core/platform.hpp>
+
+#if defined(AZ_PLATFORM_WINDOWS)
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+// Windows needs to go before bcrypt
+#include <windows.h>
+
+#include <bcrypt.h>
+#elif defined(AZ_PLATFORM_POSIX)
+#include <cerrno>
+#include <fcntl.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using Azure::Core::Credentials::AccessToken;
+using Azure::Core::Json::_internal::json;
+using Azure::Identity::TokenCachePersistenceOptions;
+using Azure::Identity::_detail::TokenCacheFile;
+
+namespace {
+constexpr size_t KeySize = 32;
+constexpr size_t NonceSize = 12;
+constexpr size_t TagSize = 16;
+
+// The file is laid out as the nonce, the encrypted JSON document, and the authentication tag.
+#if defined(AZ_PLATFORM_WINDOWS)
+class AesGcmKey final {
+  BCRYPT_ALG_HANDLE m_algorithm = nullptr;
+  BCRYPT_KEY_HANDLE m_key = nullptr;
+
+public:
+  explicit AesGcmKey(std::vector<uint8_t> const& key)
+  {
+    if (!BCRYPT_SUCCESS(
+            BCryptOpenAlgorithmProvider(&m_algorithm, BCRYPT_AES_ALGORITHM, nullptr, 0)))
+    {
+      throw std::runtime_error("BCryptOpenAlgorithmProvider failed.");
+    }
+    if (!BCRYPT_SUCCESS(BCryptSetProperty(
+            m_algorithm,
+            BCRYPT_CHAINING_MODE,
+            reinterpret_cast<PUCHAR>(const_cast<wchar_t*>(BCRYPT_CHAIN_MODE_GCM)),
+            sizeof(BCRYPT_CHAIN_MODE_GCM),
+            0))
+        || !BCRYPT_SUCCESS(BCryptGenerateSymmetricKey(
+            m_algorithm,
+            &m_key,
+            nullptr,
+            0,
+            const_cast<PUCHAR>(key.data()),
+            static_cast<ULONG>(key.size()),
+            0)))
+    {
+      BCryptCloseAlgorithmProvider(m_algorithm, 0);
+      throw std::runtime_error("Failed to create the AES key.");
+    }
+  }
+
+  ~AesGcmKey()
+  {
+    BCryptDestroyKey(m_key);
+    BCryptCloseAlgorithmProvider(m_algorithm, 0);
+  }
+
+  AesGcmKey(AesGcmKey const&) = delete;
+  AesGcmKey& operator=(AesGcmKey const&) = delete;
+
+  BCRYPT_KEY_HANDLE Get() const { return m_key; }
+};
+
+std::vector<uint8_t> Encrypt(std::vector<uint8_t> const& key, std::string const& plaintext)
+{
+  std::vector<uint8_t> file(NonceSize + plaintext.size() + TagSize);
+  if (!BCRYPT_SUCCESS(BCryptGenRandom(
+          nullptr, file.data(), static_cast<ULONG>(NonceSize), BCRYPT_USE_SYSTEM_PREFERRED_RNG)))
+  {
+    throw std::runtime_error("BCryptGenRandom failed.");
+  }
+
+  AesGcmKey aesKey(key);
+  BCRYPT_AUTHENTICATED_CIPHER_MODE_INFO authInfo;
+  BCRYPT_INIT_AUTH_MODE_INFO(authInfo);
+  authInfo.pbNonce = file.data();
+  authInfo.cbNonce = static_cast<ULONG>(NonceSize);
+  authInfo.pbTag = file.data() + NonceSize + plaintext.size();
+  authInfo.cbTag = static_cast<ULONG>(TagSize);
+
+  ULONG encryptedSize = 0;
+  if (!BCRYPT_SUCCESS(BCryptEncrypt(
+          aesKey.Get(),
+          reinterpret_cast<PUCHAR>(const_cast<char*>(plaintext.data())),
+          static_cast<ULONG>(plaintext.size()),
+          &authInfo,
+          nullptr,
+          0,
+          file.data() + NonceSize,
+          static_cast<ULONG>(plaintext.size()),
+          &encryptedSize,
+          0)))
+  {
+    throw std::runtime_error("BCryptEncrypt failed.");
+  }
+  return file;
+}
+
+// Returns false when the file wasn't encrypted with the key or was altered.
+bool Decrypt(std::vector<uint8_t> const& key, std::vector<uint8_t> file, std::string& plaintext)
+{
+  if (file.size() < NonceSize + TagSize)
+  {
+    return false;
+  }
+  auto const encryptedSize = file.size() - NonceSize - TagSize;
+
+  AesGcmKey aesKey(key);
+  BCRYPT_AUTHENTICATED_CIPHER_MODE_INFO authInfo;
+  BCRYPT_INIT_AUTH_MODE_INFO(authInfo);
+  authInfo.pbNonce = file.data();
+  authInfo.cbNonce = static_cast<ULONG>(NonceSize);
+  authInfo.pbTag = file.data() + NonceSize + encryptedSize;
+  authInfo.cbTag = static_cast<ULONG>(TagSize);
+
+  plaintext.resize(encryptedSize);
+  ULONG decryptedSize = 0;
+  return BCRYPT_SUCCESS(BCryptDecrypt(
+      aesKey.Get(),
+      file.data() + NonceSize,
+      static_cast<ULONG>(encryptedSize),
+      &authInfo,
+      nullptr,
+      0,
+      reinterpret_cast<PUCHAR>(&plaintext[0]),
+      static_cast<ULONG>(encryptedSize),
+      &decryptedSize,
+      0));
+}
+
+// Holds an exclusive lock on the lock file, shared with the other processes.
+class FileLock final {
+  HANDLE m_handle;
+
+public:
+  explicit FileLock(std::string const& path)
+  {
+    m_handle = CreateFileA(
+        path.c_str(),
+        GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr,
+        OPEN_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (m_handle == INVALID_HANDLE_VALUE)
+    {
+      throw std::runtime_error("Failed to open the token cache lock file.");
+    }
+    OVERLAPPED overlapped = {};
+    if (!LockFileEx(m_handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped))
+    {
+      CloseHandle(m_handle);
+      throw std::runtime_error("Failed to lock the token cache file.");
+    }
+  }
+
+  ~FileLock()
+  {
+    OVERLAPPED overlapped = {};
+    UnlockFileEx(m_handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+    CloseHandle(m_handle);
+  }
+
+  FileLock(FileLock const&) = delete;
+  FileLock& operator=(FileLock const&) = delete;
+};
+
+void WriteFile(std::string const& path, std::vector<uint8_t> const& content)
+{
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<char const*>(content.data()), content.size());
+  if (!file)
+  {
+    throw std::runtime_error("Failed to write the token cache file.");
+  }
+}
+#elif defined(AZ_PLATFORM_POSIX)
+struct CipherContextDeleter final
+{
+  void operator()(EVP_CIPHER_CTX* context) const { EVP_CIPHER_CTX_free(context); }
+};
+
+std::unique_ptr<EVP_CIPHER_CTX, CipherContextDeleter> CreateCipherContext()
+{
+  std::unique_ptr<EVP_CIPHER_CTX, CipherContextDeleter> context(EVP_CIPHER_CTX_new());
+  if (!context)
+  {
+    throw std::runtime_error("EVP_CIPHER_CTX_new failed.");
+  }
+  return context;
+}
+
+std::vector<uint8_t> Encrypt(std::vector<uint8_t> const& key, std::string const& plaintext)
+{
+  std::vector<uint8_t> file(NonceSize + plaintext.size() + TagSize);
+  if (RAND_bytes(file.data(), static_cast<int>(NonceSize)) != 1)
+  {
+    throw std::runtime_error("RAND_bytes failed.");
+  }
+
+  auto context = CreateCipherContext();
+  int encryptedSize = 0;
+  int finalSize = 0;
+  if (EVP_EncryptInit_ex(context.get(), EVP_aes_256_gcm(), nullptr, nullptr, nullptr) != 1
+      || EVP_CIPHER_CTX_ctrl(
+             context.get(), EVP_CTRL_GCM_SET_IVLEN, static_cast<int>(NonceSize), nullptr)
+          != 1
+      || EVP_EncryptInit_ex(context.get(), nullptr, nullptr, key.data(), file.data()) != 1
+      || EVP_EncryptUpdate(
+             context.get(),
+             file.data() + NonceSize,
+             &encryptedSize,
+             reinterpret_cast<uint8_t const*>(plaintext.data()),
+             static_cast<int>(plaintext.size()))
+          != 1
+      || EVP_EncryptFinal_ex(context.get(), file.data() + NonceSize + encryptedSize, &finalSize)
+          != 1
+      || EVP_CIPHER_CTX_ctrl(
+             context.get(),
+             EVP_CTRL_GCM_GET_TAG,
+             static_cast<int>(TagSize),
+             file.data() + NonceSize + plaintext.size())
+          != 1)
+  {
+    throw std::runtime_error("Failed to encrypt the token cache.");
+  }
+  return file;
+}
+
+// Returns false when the file wasn't encrypted with the key or was altered.
+bool Decrypt(std::vector<uint8_t> const& key, std::vector<uint8_t> file, std::string& plaintext)
+{
+  if (file.size() < NonceSize + TagSize)
+  {
+    return false;
+  }
+  auto const encryptedSize = file.size() - NonceSize - TagSize;
+  plaintext.resize(encryptedSize);
+
+  auto context = CreateCipherContext();
+  int decryptedSize = 0;
+  int finalSize = 0;
+  return EVP_DecryptInit_ex(context.get(), EVP_aes_256_gcm(), nullptr, nullptr, nullptr) == 1
+      && EVP_CIPHER_CTX_ctrl(
+             context.get(), EVP_CTRL_GCM_SET_IVLEN, static_cast<int>(NonceSize), nullptr)
+      == 1
+      && EVP_DecryptInit_ex(context.get(), nullptr, nullptr, key.data(), file.data()) == 1
+      && EVP_DecryptUpdate(
+             context.get(),
+             reinterpret_cast<uint8_t*>(&plaintext[0]),
+             &decryptedSize,
+             file.data() + NonceSize,
+             static_cast<int>(encryptedSize))
+      == 1
+      && EVP_CIPHER_CTX_ctrl(
+             context.get(),
+             EVP_CTRL_GCM_SET_TAG,
+             static_cast<int>(TagSize),
+             file.data() + NonceSize + encryptedSize)
+      == 1
+      && EVP_DecryptFinal_ex(
+             context.get(), reinterpret_cast<uint8_t*>(&plaintext[0]) + decryptedSize, &finalSize)
+      == 1;
+}
+
+// Holds an exclusive lock on the lock file, shared with the other processes.
+class FileLock final {
+  int m_descriptor;
+
+public:
+  explicit FileLock(std::string const& path)
+  {
+    m_descriptor = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (m_descriptor == -1)
+    {
+      throw std::runtime_error("Failed to open the token cache lock file.");
+    }
+    int result;
+    do
+    {
+      result = flock(m_descriptor, LOCK_EX);
+    } while (result == -1 && errno == EINTR);
+    if (result == -1)
+    {
+      close(m_descriptor);
+      throw std::runtime_error("Failed to lock the token cache file.");
+    }
+  }
+
+  // Closing the descriptor releases the lock.
+  ~FileLock() { close(m_descriptor); }
+
+  FileLock(FileLock const&) = delete;
+  FileLock& operator=(FileLock const&) = delete;
+};
+
+void WriteFile(std::string const& path, std::vector<uint8_t> const& content)
+{
+  // Only the user can read the file, even though it's encrypted.
+  int descriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (descriptor == -1)
+  {
+    throw std::runtime_error("Failed to open the token cache file.");
+  }
+  size_t written = 0;
+  while (written < content.size())
+  {
+    auto const result = write(descriptor, content.data() + written, content.size() - written);
+    if (result == -1 && errno == EINTR)
+    {
+      continue;
+    }
+    if (result <= 0)
+    {
+      close(descriptor);
+      throw std::runtime_error("Failed to write the token cache file.");
+    }
+    written += static_cast<size_t>(result);
+  }
+  close(descriptor);
+}
+#endif
+
+std::vector<uint8_t> ReadFile(std::string const& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file)
+  {
+    return {};
+  }
+  return std::vector<uint8_t>(
+      (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+// Reads the tokens of the file, or none when it doesn't exist or can't be decrypted.
+json ReadTokens(TokenCachePersistenceOptions const& options)
+{
+  auto file = ReadFile(options.FilePath);
+  std::string content;
+  if (file.empty() || !Decrypt(options.EncryptionKey, std::move(file), content))
+  {
+    return json::array();
+  }
+  auto const document = json::parse(content);
+  auto const tokens = document.find("tokens");
+  return tokens != document.end() && tokens->is_array() ? *tokens : json::array();
+}
+} // namespace
+
+TokenCacheFile::TokenCacheFile(TokenCachePersistenceOptions options) : m_options(std::move(options))
+{
+  if (m_options.FilePath.empty())
+  {
+    throw std::invalid_argument("The token cache file path is empty.");
+  }
+  if (m_options.EncryptionKey.size() != KeySize)
+  {
+    throw std::invalid_argument("The token cache encryption key must be 32 bytes long.");
+  }
+}
+
+std::unique_ptr<AccessToken> TokenCacheFile::Find(std::string const& key) const
+{
+  try
+  {
+    FileLock lock(m_options.FilePath + ".lock");
+    for (auto const& entry : ReadTokens(m_options))
+    {
+      if (entry.value("key", std::string()) == key)
+      {
+        auto token = std::make_unique<AccessToken>();
+        token->Token = entry.at("token").get<std::string>();
+        token->ExpiresOn = Azure::DateTime::Parse(
+            entry.at("expiresOn").get<std::string>(), Azure::DateTime::DateFormat::Rfc3339);
+        return token;
+      }
+    }
+  }
+  catch (std::exception const&)
+  {
+    // The token is fetched again.
+  }
+  return nullptr;
+}
+
+void TokenCacheFile::Save(std::string const& key, AccessToken const& token) const
+{
+  try
+  {
+    FileLock lock(m_options.FilePath + ".lock");
+
+    json tokens = json::array();
+    auto const now = std::chrono::system_clock::now();
+    try
+    {
+      for (auto const& entry : ReadTokens(m_options))
+      {
+        if (entry.value("key", std::string()) != key
+            && Azure::DateTime::Parse(
+                   entry.at("expiresOn").get<std::string>(), Azure::DateTime::DateFormat::Rfc3339)
+                > now)
+        {
+          tokens.push_back(entry);
+        }
+      }
+    }
+    catch (std::exception const&)
+    {
+      // An unreadable file is replaced.
+      tokens = json::array();
+    }
+
+    tokens.push_back(
+        {{"key", key},
+         {"token", token.Token},
+         {"expiresOn", token.ExpiresOn.ToString(Azure::DateTime::DateFormat::Rfc3339)}});
+
+    json document;
+    document["tokens"] = std::move(tokens);
+    WriteFile(m_options.FilePath, Encrypt(m_options.EncryptionKey, document.dump()));
+  }
+  catch (std::exception const&)
+  {
+    // The token is still cached by the process.
+  }
+}
@@ -6,9 +6,12 @@
 #include <azure/core/url.hpp>
 
 #include "private/package_version.hpp"
+#include "private/token_cache.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <sstream>
+#include <utility>
 
 using namespace Azure::Identity::_detail;
 
@@ -46,134 +49,314 @@ std::string TokenCredentialImpl::FormatScopes(
   auto const scopesEnd = scopes.end();
   for (++scopesIter; scopesIter != scopesEnd; ++scopesIter)
   {
-    scopesStr += std::string(" ") + Url::Encode(*scopesIter);
+    scopesStr += ' ';
+    scopesStr += Url::Encode(*scopesIter);
   }
 
   return scopesStr;
 }
 
-Azure::Core::Credentials::AccessToken TokenCredentialImpl::GetToken(
-    Core::Context const& context,
-    std::function<std::unique_ptr<TokenCredentialImpl::TokenRequest>()> const& createRequest,
-    std::function<std::unique_ptr<TokenCredentialImpl::TokenRequest>(
-        Azure::Core::Http::HttpStatusCode statusCode,
-        Azure::Core::Http::RawResponse const& response)> const& shouldRetry) const
-{
-  using Azure::Core::Credentials::AuthenticationException;
-  using Azure::Core::Http::HttpStatusCode;
-  using Azure::Core::Http::RawResponse;
+namespace {
+std::string const errorMsgPrefix("GetToken: ");
 
-  static std::string const errorMsgPrefix("GetToken: ");
+// Parses the members of a token response in a single pass over the response body, without copying
+// it. The other members, and the values nested in them, are skipped.
+class TokenResponseParser final {
+private:
+  char const* m_pos;
+  char const* const m_end;
 
-  try
+  [[noreturn]] static void ThrowInvalidJson()
   {
-    std::unique_ptr<RawResponse> response;
+    throw Azure::Core::Credentials::AuthenticationException(
+        errorMsgPrefix + "response json: invalid.");
+  }
+
+  void SkipWhitespace()
+  {
+    while (m_pos != m_end
+           && (*m_pos == ' ' || *m_pos == '\t' || *m_pos == '\n' || *m_pos == '\r'))
     {
-      auto request = createRequest();
-      for (;;)
+      ++m_pos;
+    }
+  }
+
+  void Expect(char c)
+  {
+    SkipWhitespace();
+    if (m_pos == m_end || *m_pos != c)
+    {
+      ThrowInvalidJson();
+    }
+    ++m_pos;
+  }
+
+  // Parses a string, the position being at its opening quote. The value is left escaped, escapes
+  // are rare in token responses and only the access token needs to be unescaped.
+  std::pair<char const*, char const*> ParseString(bool* hasEscapes = nullptr)
+  {
+    Expect('\"');
+    auto const begin = m_pos;
+    for (; m_pos != m_end && *m_pos != '\"'; ++m_pos)
+    {
+      if (*m_pos == '\\')
       {
-        response = m_httpPipeline.Send(request->HttpRequest, context);
-        if (!response)
+        if (hasEscapes != nullptr)
         {
-          throw AuthenticationException(errorMsgPrefix + "null response");
+          *hasEscapes = true;
         }
-
-        auto const statusCode = response->GetStatusCode();
-        if (statusCode == HttpStatusCode::Ok)
+        if (++m_pos == m_end)
         {
           break;
         }
-
-        request = shouldRetry(statusCode, *response);
-        if (request == nullptr)
-        {
-          std::ostringstream errorMsg;
-          errorMsg << errorMsgPrefix << "error response: "
-                   << static_cast<std::underlying_type<HttpStatusCode>::type>(statusCode) << " "
-                   << response->GetReasonPhrase();
-
-          throw AuthenticationException(errorMsg.str());
-        }
-
-        response.reset();
       }
     }
-
-    auto const& responseBodyVector = response->GetBody();
-    std::string responseBody(responseBodyVector.begin(), responseBodyVector.end());
-
-    // TODO: use JSON parser.
-    auto const responseBodySize = responseBody.size();
-
-    static std::string const jsonExpiresIn = "expires_in";
-    static std::string const jsonAccessToken = "access_token";
-
-    auto responseBodyPos = responseBody.find(':', responseBody.find(jsonExpiresIn));
-    if (responseBodyPos == std::string::npos)
+    if (m_pos == m_end)
     {
-      std::ostringstream errorMsg;
-      errorMsg << errorMsgPrefix << "response json: \'" << jsonExpiresIn << "\' not found.";
-
-      throw AuthenticationException(errorMsg.str());
+      ThrowInvalidJson();
     }
+    return {begin, m_pos++};
+  }
 
-    for (; responseBodyPos < responseBodySize; ++responseBodyPos)
+  static std::string Unescape(char const* begin, char const* end)
+  {
+    std::string value;
+    value.reserve(static_cast<size_t>(end - begin));
+    for (auto pos = begin; pos != end; ++pos)
     {
-      auto c = responseBody[responseBodyPos];
-      if (c != ':' && c != ' ' && c != '\"' && c != '\'')
+      if (*pos != '\\')
       {
-        break;
+        value += *pos;
+        continue;
       }
-    }
-
-    long long expiresInSeconds = 0;
-    for (; responseBodyPos < responseBodySize; ++responseBodyPos)
-    {
-      auto c = responseBody[responseBodyPos];
-      if (c < '0' || c > '9')
+      switch (*++pos)
       {
-        break;
+        case 'b':
+          value += '\b';
+          break;
+        case 'f':
+          value += '\f';
+          break;
+        case 'n':
+          value += '\n';
+          break;
+        case 'r':
+          value += '\r';
+          break;
+        case 't':
+          value += '\t';
+          break;
+        case 'u':
+          // Tokens are ASCII, other code points aren't expected.
+          if (end - pos < 5 || pos[1] != '0' || pos[2] != '0' || pos[3] > '7')
+          {
+            ThrowInvalidJson();
+          }
+          value += static_cast<char>(std::stoi(std::string(pos + 1, pos + 5), nullptr, 16));
+          pos += 4;
+          break;
+        default:
+          value += *pos;
+          break;
       }
-
-      expiresInSeconds = (expiresInSeconds * 10) + (static_cast<long long>(c) - '0');
     }
+    return value;
+  }
 
-    responseBodyPos = responseBody.find(':', responseBody.find(jsonAccessToken));
-    if (responseBodyPos == std::string::npos)
+  // Parses a number of seconds, which some endpoints return as a string.
+  long long ParseSeconds()
+  {
+    SkipWhitespace();
+    auto const isString = m_pos != m_end && *m_pos == '\"';
+    auto const value = isString ? ParseString() : std::make_pair(m_pos, m_pos);
+    auto pos = value.first;
+    auto const end = isString ? value.second : m_end;
+
+    long long seconds = 0;
+    auto const digitsBegin = pos;
+    for (; pos != end && *pos >= '0' && *pos <= '9'; ++pos)
+    {
+      seconds = (seconds * 10) + (static_cast<long long>(*pos) - '0');
+    }
+    if (pos == digitsBegin)
+    {
+      ThrowInvalidJson();
+    }
+    if (!isString)
     {
-      std::ostringstream errorMsg;
-      errorMsg << errorMsgPrefix << "response json: \'" << jsonAccessToken << "\' not found.";
+      m_pos = pos;
+    }
+    return seconds;
+  }
 
-      throw AuthenticationException(errorMsg.str());
+  void SkipValue()
+  {
+    SkipWhitespace();
+    if (m_pos == m_end)
+    {
+      ThrowInvalidJson();
+    }
+    if (*m_pos == '\"')
+    {
+      ParseString();
+      return;
+    }
+    if (*m_pos != '{' && *m_pos != '[')
+    {
+      // A number, true, false or null.
+      while (m_pos != m_end && *m_pos != ',' && *m_pos != '}' && *m_pos != ']')
+      {
+        ++m_pos;
+      }
+      return;
     }
 
-    for (; responseBodyPos < responseBodySize; ++responseBodyPos)
+    int depth = 0;
+    do
     {
-      auto c = responseBody[responseBodyPos];
-      if (c != ':' && c != ' ' && c != '\"' && c != '\'')
+      if (*m_pos == '\"')
       {
-        break;
+        ParseString();
+        continue;
+      }
+      if (*m_pos == '{' || *m_pos == '[')
+      {
+        ++depth;
+      }
+      else if (*m_pos == '}' || *m_pos == ']')
+      {
+        --depth;
       }
+      ++m_pos;
+    } while (depth != 0 && m_pos != m_end);
+    if (depth != 0)
+    {
+      ThrowInvalidJson();
     }
+  }
 
-    auto const tokenBegin = responseBodyPos;
-    for (; responseBodyPos < responseBodySize; ++responseBodyPos)
+  static bool IsKey(std::pair<char const*, char const*> const& key, char const* name, size_t size)
+  {
+    return static_cast<size_t>(key.second - key.first) == size
+        && std::equal(key.first, key.second, name);
+  }
+
+public:
+  explicit TokenResponseParser(std::vector<uint8_t> const& responseBody)
+      : m_pos(reinterpret_cast<char const*>(responseBody.data())),
+        m_end(m_pos + responseBody.size())
+  {
+  }
+
+  Azure::Core::Credentials::AccessToken Parse()
+  {
+    using Azure::Core::Credentials::AuthenticationException;
+
+    constexpr char jsonExpiresIn[] = "expires_in";
+    constexpr char jsonAccessToken[] = "access_token";
+
+    std::string accessToken;
+    bool hasAccessToken = false;
+    long long expiresInSeconds = 0;
+    bool hasExpiresIn = false;
+
+    Expect('{');
+    SkipWhitespace();
+    if (m_pos != m_end && *m_pos == '}')
     {
-      auto c = responseBody[responseBodyPos];
-      if (c == '\"' || c == '\'')
+      ++m_pos;
+    }
+    else
+    {
+      for (;;)
       {
+        auto const key = ParseString();
+        Expect(':');
+        if (IsKey(key, jsonExpiresIn, sizeof(jsonExpiresIn) - 1))
+        {
+          expiresInSeconds = ParseSeconds();
+          hasExpiresIn = true;
+        }
+        else if (IsKey(key, jsonAccessToken, sizeof(jsonAccessToken) - 1))
+        {
+          bool hasEscapes = false;
+          auto const value = ParseString(&hasEscapes);
+          accessToken = hasEscapes ? Unescape(value.first, value.second)
+                                   : std::string(value.first, value.second);
+          hasAccessToken = true;
+        }
+        else
+        {
+          SkipValue();
+        }
+
+        SkipWhitespace();
+        if (m_pos != m_end && *m_pos == ',')
+        {
+          ++m_pos;
+          continue;
+        }
+        Expect('}');
         break;
       }
     }
-    auto const tokenEnd = responseBodyPos;
 
-    auto const responseBodyBegin = responseBody.begin();
+    if (!hasExpiresIn)
+    {
+      throw AuthenticationException(
+          errorMsgPrefix + "response json: \'" + jsonExpiresIn + "\' not found.");
+    }
+    if (!hasAccessToken)
+    {
+      throw AuthenticationException(
+          errorMsgPrefix + "response json: \'" + jsonAccessToken + "\' not found.");
+    }
 
     return {
-        std::string(responseBodyBegin + tokenBegin, responseBodyBegin + tokenEnd),
+        std::move(accessToken),
         std::chrono::system_clock::now() + std::chrono::seconds(expiresInSeconds),
     };
   }
+};
+
+Azure::Core::Credentials::AccessToken ParseTokenResponse(std::vector<uint8_t> const& responseBody)
+{
+  return TokenResponseParser(responseBody).Parse();
+}
+
+std::string GetTokenCacheKey(TokenCredentialImpl::TokenRequest const& request)
+{
+  auto const& httpRequest = request.HttpRequest;
+
+  std::string key = httpRequest.GetMethod().ToString() + " "
+      + httpRequest.GetUrl().GetAbsoluteUrl() + "\n";
+  for (auto const& header : httpRequest.GetHeaders())
+  {
+    key += header.first + ":" + header.second + "\n";
+  }
+
+  return key + "\n" + request.GetBody();
+}
+} // namespace
+
+Azure::Core::Credentials::AccessToken TokenCredentialImpl::GetToken(
+    Core::Context const& context,
+    std::function<std::unique_ptr<TokenCredentialImpl::TokenRequest>()> const& createRequest,
+    std::function<std::unique_ptr<TokenCredentialImpl::TokenRequest>(
+        Azure::Core::Http::HttpStatusCode statusCode,
+        Azure::Core::Http::RawResponse const& response)> const& shouldRetry) const
+{
+  using Azure::Core::Credentials::AuthenticationException;
+
+  try
+  {
+    auto request = createRequest();
+    auto const cacheKey = GetTokenCacheKey(*request);
+
+    return TokenCache::GetToken(cacheKey, [&]() {
+      return RequestToken(context, std::move(request), shouldRetry);
+    });
+  }
   catch (AuthenticationException const&)
   {
     throw;
@@ -187,3 +370,48 @@ Azure::Core::Credentials::AccessToken TokenCredentialImpl::GetToken(
     throw AuthenticationException("unknown error");
   }
 }
+
+Azure::Core::Credentials::AccessToken TokenCredentialImpl::RequestToken(
+    Core::Context const& context,
+    std::unique_ptr<TokenCredentialImpl::TokenRequest> request,
+    std::function<std::unique_ptr<TokenCredentialImpl::TokenRequest>(
+        Azure::Core::Http::HttpStatusCode statusCode,
+        Azure::Core::Http::RawResponse const& response)> const& shouldRetry) const
+{
+  using Azure::Core::Credentials::AuthenticationException;
+  using Azure::Core::Http::HttpStatusCode;
+  using Azure::Core::Http::RawResponse;
+
+  std::unique_ptr<RawResponse> response;
+  {
+    for (;;)
+    {
+      response = m_httpPipeline.Send(request->HttpRequest, context);
+      if (!response)
+      {
+        throw AuthenticationException(errorMsgPrefix + "null response");
+      }
+
+      auto const statusCode = response->GetStatusCode();
+      if (statusCode == HttpStatusCode::Ok)
+      {
+        break;
+      }
+
+      request = shouldRetry(statusCode, *response);
+      if (request == nullptr)
+      {
+        std::ostringstream errorMsg;
+        errorMsg << errorMsgPrefix << "error response: "
+                 << static_cast<std::underlying_type<HttpStatusCode>::type>(statusCode) << " "
+                 << response->GetReasonPhrase();
+
+        throw AuthenticationException(errorMsg.str());
+      }
+
+      response.reset();
+    }
+  }
+
+  return ParseTokenResponse(response->GetBody());
+}
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/identity/chained_token_credential.hpp"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using Azure::Core::Context;
+using Azure::Core::Credentials::AccessToken;
+using Azure::Core::Credentials::AuthenticationException;
+using Azure::Core::Credentials::TokenCredential;
+using Azure::Core::Credentials::TokenRequestContext;
+using Azure::Identity::ChainedTokenCredential;
+using Azure::Identity::ChainedTokenCredentialOptions;
+
+namespace {
+class TestCredential final : public TokenCredential {
+  std::function<AccessToken(Context const&)> m_getToken;
+
+public:
+  mutable int NumCalls = 0;
+
+  explicit TestCredential(std::function<AccessToken(Context const&)> getToken)
+      : m_getToken(std::move(getToken))
+  {
+  }
+
+  AccessToken GetToken(TokenRequestContext const&, Context const& context) const override
+  {
+    ++NumCalls;
+    return m_getToken(context);
+  }
+};
+
+AccessToken Succeed(Context const&)
+{
+  return {"ACCESSTOKEN", std::chrono::system_clock::now() + std::chrono::hours(1)};
+}
+
+AccessToken Fail(Context const&) { throw AuthenticationException("unavailable"); }
+
+// Stands for an endpoint that doesn't answer until the context is cancelled.
+AccessToken Hang(Context const& context)
+{
+  while (true)
+  {
+    context.ThrowIfCancelled();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+} // namespace
+
+TEST(ChainedTokenCredential, MemoizesFirstSucceedingSource)
+{
+  auto failing = std::make_shared<TestCredential>(Fail);
+  auto succeeding = std::make_shared<TestCredential>(Succeed);
+  auto last = std::make_shared<TestCredential>(Succeed);
+  ChainedTokenCredential credential({failing, succeeding, last});
+
+  TokenRequestContext tokenRequestContext;
+  tokenRequestContext.Scopes = {"https://vault.azure.net/.default"};
+  EXPECT_EQ(credential.GetToken(tokenRequestContext, Context()).Token, "ACCESSTOKEN");
+  EXPECT_EQ(credential.GetToken(tokenRequestContext, Context()).Token, "ACCESSTOKEN");
+
+  EXPECT_EQ(failing->NumCalls, 1);
+  EXPECT_EQ(succeeding->NumCalls, 2);
+  EXPECT_EQ(last->NumCalls, 0);
+}
+
+TEST(ChainedTokenCredential, ProbeTimeout)
+{
+  auto hanging = std::make_shared<TestCredential>(Hang);
+  auto succeeding = std::make_shared<TestCredential>(Succeed);
+  ChainedTokenCredentialOptions options;
+  options.ProbeTimeout = std::chrono::milliseconds(100);
+  ChainedTokenCredential credential({hanging, succeeding}, options);
+
+  auto const start = std::chrono::steady_clock::now();
+  EXPECT_EQ(credential.GetToken({}, Context()).Token, "ACCESSTOKEN");
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  EXPECT_EQ(hanging->NumCalls, 1);
+}
+
+TEST(ChainedTokenCredential, AllSourcesFail)
+{
+  auto first = std::make_shared<TestCredential>(Fail);
+  auto second = std::make_shared<TestCredential>(Fail);
+  ChainedTokenCredential credential({first, second});
+
+  EXPECT_THROW(credential.GetToken({}, Context()), AuthenticationException);
+  // Nothing is memoized, the sources are tried again.
+  EXPECT_THROW(credential.GetToken({}, Context()), AuthenticationException);
+  EXPECT_EQ(first->NumCalls, 2);
+  EXPECT_EQ(second->NumCalls, 2);
+}
+
+TEST(ChainedTokenCredential, InvalidSources)
+{
+  EXPECT_THROW(ChainedTokenCredential({}), std::invalid_argument);
+  EXPECT_THROW(ChainedTokenCredential({nullptr}), std::invalid_argument);
+}
@@ -108,3 +108,58 @@ TEST(ClientSecretCredential, AzureStack)
   EXPECT_GT(response.AccessToken.ExpiresOn, response.EarliestExpiration + 3600s);
   EXPECT_LT(response.AccessToken.ExpiresOn, response.LatestExpiration + 3600s);
 }
+
+TEST(ClientSecretCredential, TokenResponseParsing)
+{
+  auto const createCredential = [](auto transport) {
+    ClientSecretCredentialOptions options;
+    options.AuthorityHost = "https://microsoft.com/";
+    options.Transport.Transport = transport;
+
+    return std::make_unique<ClientSecretCredential>(
+        "01234567-89ab-cdef-fedc-ba8976543210",
+        "fedcba98-7654-3210-0123-456789abcdef",
+        "CLIENTSECRET",
+        options);
+  };
+
+  auto const actual = CredentialTestHelper::SimulateTokenRequest(
+      createCredential,
+      {{{"https://azure.com/.default"}}, {{"https://outlook.com/.default"}}},
+      std::vector<std::string>{
+          "{\"token_type\":\"Bearer\",\"ext_expires_in\":60,\"expires_in\":3600,"
+          "\"access_token\":\"ACCESSTOKEN1\"}",
+          "{ \"access_token\" : \"ACCESS\\/TOKEN\\u0032\",\n \"nested\" : {\"a\":[1, \"}\"]},\n"
+          " \"expires_in\" : \"7200\" }"});
+
+  EXPECT_EQ(actual.Requests.size(), 2U);
+  EXPECT_EQ(actual.Responses.size(), 2U);
+  auto const& response0 = actual.Responses.at(0);
+  auto const& response1 = actual.Responses.at(1);
+
+  EXPECT_EQ(response0.AccessToken.Token, "ACCESSTOKEN1");
+  EXPECT_EQ(response1.AccessToken.Token, "ACCESS/TOKEN2");
+
+  using namespace std::chrono_literals;
+  EXPECT_GT(response0.AccessToken.ExpiresOn, response0.EarliestExpiration + 3600s);
+  EXPECT_LT(response0.AccessToken.ExpiresOn, response0.LatestExpiration + 3600s);
+
+  EXPECT_GT(response1.AccessToken.ExpiresOn, response1.EarliestExpiration + 7200s);
+  EXPECT_LT(response1.AccessToken.ExpiresOn, response1.LatestExpiration + 7200s);
+
+  using Azure::Core::Credentials::AuthenticationException;
+  for (auto const& responseBody : {
+           "{\"expires_in\":3600}",
+           "{\"access_token\":\"ACCESSTOKEN1\"}",
+           "{\"expires_in\":3600, \"access_token\":\"ACCESSTOKEN1\"",
+           "\"expires_in\":3600, \"access_token\":\"ACCESSTOKEN1\"}",
+       })
+  {
+    EXPECT_THROW(
+        CredentialTestHelper::SimulateTokenRequest(
+            createCredential,
+            {{{"https://azure.com/.default"}}},
+            std::vector<std::string>{responseBody}),
+        AuthenticationException);
+  }
+}
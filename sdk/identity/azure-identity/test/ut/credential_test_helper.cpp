@@ -4,6 +4,7 @@
 #include "credential_test_helper.hpp"
 
 #include "private/environment.hpp"
+#include "private/token_cache.hpp"
 
 #include <azure/core/platform.hpp>
 
@@ -117,6 +118,9 @@ CredentialTestHelper::TokenRequestSimulationResult CredentialTestHelper::Simulat
   auto const nResponses = responses.size();
   auto const nRequestTimes = tokenRequestContexts.size();
 
+  // Every simulation requests its tokens from the server, the tokens of earlier ones aren't reused.
+  Azure::Identity::_detail::TokenCache::Clear();
+
   TokenRequestSimulationResult result;
   {
     result.Requests.reserve(nResponses);
@@ -738,3 +738,42 @@ TEST(ManagedIdentityCredential, ImdsClientId)
   EXPECT_GT(response1.AccessToken.ExpiresOn, response1.EarliestExpiration + 7200s);
   EXPECT_LT(response1.AccessToken.ExpiresOn, response1.LatestExpiration + 7200s);
 }
+
+TEST(ManagedIdentityCredential, ImdsWarmup)
+{
+  auto const actual = CredentialTestHelper::SimulateTokenRequest(
+      [](auto transport) {
+        TokenCredentialOptions options;
+        options.Transport.Transport = transport;
+
+        CredentialTestHelper::EnvironmentOverride const env({
+            {"MSI_ENDPOINT", ""},
+            {"MSI_SECRET", ""},
+            {"IDENTITY_ENDPOINT", ""},
+            {"IMDS_ENDPOINT", ""},
+            {"IDENTITY_HEADER", ""},
+            {"IDENTITY_SERVER_THUMBPRINT", ""},
+        });
+
+        return std::make_unique<ManagedIdentityCredential>(options);
+      },
+      {{{"https://azure.com/.default"}}, {{"https://azure.com/.default"}}},
+      std::vector<std::string>{"{\"expires_in\":3600, \"access_token\":\"ACCESSTOKEN1\"}"},
+      [](auto const& credential, auto const& tokenRequestContext, auto const& context) {
+        // The concurrent warmups of the same scope and the requests share a single token.
+        static_cast<ManagedIdentityCredential const&>(credential)
+            .Warmup({"https://azure.com/.default", "https://azure.com/.default"}, context);
+        return credential.GetToken(tokenRequestContext, context);
+      });
+
+  EXPECT_EQ(actual.Requests.size(), 1U);
+
+  EXPECT_EQ(
+      actual.Requests.at(0).AbsoluteUrl,
+      "http://169.254.169.254/metadata/identity/oauth2/token"
+      "?api-version=2018-02-01"
+      "&resource=https%3A%2F%2Fazure.com");
+
+  EXPECT_EQ(actual.Responses.at(0).AccessToken.Token, "ACCESSTOKEN1");
+  EXPECT_EQ(actual.Responses.at(1).AccessToken.Token, "ACCESSTOKEN1");
+}
@@ -0,0 +1,199 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "private/token_cache.hpp"
+
+#include <azure/identity/token_cache_persistence.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Azure::Core::Credentials::AccessToken;
+using Azure::Identity::TokenCachePersistence;
+using Azure::Identity::TokenCachePersistenceOptions;
+using Azure::Identity::_detail::TokenCache;
+
+TEST(TokenCache, ReuseWhileValid)
+{
+  using namespace std::chrono_literals;
+  TokenCache::Clear();
+
+  int numFetches = 0;
+  auto const getNewToken = [&]() -> AccessToken {
+    ++numFetches;
+    return {"ACCESSTOKEN" + std::to_string(numFetches), std::chrono::system_clock::now() + 1h};
+  };
+
+  EXPECT_EQ(TokenCache::GetToken("A", getNewToken).Token, "ACCESSTOKEN1");
+  EXPECT_EQ(TokenCache::GetToken("A", getNewToken).Token, "ACCESSTOKEN1");
+  EXPECT_EQ(TokenCache::GetToken("B", getNewToken).Token, "ACCESSTOKEN2");
+  EXPECT_EQ(numFetches, 2);
+
+  TokenCache::Clear();
+  EXPECT_EQ(TokenCache::GetToken("A", getNewToken).Token, "ACCESSTOKEN3");
+  TokenCache::Clear();
+}
+
+TEST(TokenCache, RefreshNearExpiry)
+{
+  using namespace std::chrono_literals;
+  TokenCache::Clear();
+
+  EXPECT_EQ(
+      TokenCache::GetToken(
+          "A",
+          []() -> AccessToken {
+            return {"ACCESSTOKEN1", std::chrono::system_clock::now() + 5min};
+          })
+          .Token,
+      "ACCESSTOKEN1");
+
+  EXPECT_EQ(
+      TokenCache::GetToken(
+          "A",
+          []() -> AccessToken {
+            return {"ACCESSTOKEN2", std::chrono::system_clock::now() + 1h};
+          })
+          .Token,
+      "ACCESSTOKEN2");
+  TokenCache::Clear();
+}
+
+TEST(TokenCache, FailedFetchNotCached)
+{
+  using namespace std::chrono_literals;
+  TokenCache::Clear();
+
+  EXPECT_THROW(
+      TokenCache::GetToken("A", []() -> AccessToken { throw std::runtime_error("error"); }),
+      std::runtime_error);
+
+  EXPECT_EQ(
+      TokenCache::GetToken(
+          "A",
+          []() -> AccessToken {
+            return {"ACCESSTOKEN1", std::chrono::system_clock::now() + 1h};
+          })
+          .Token,
+      "ACCESSTOKEN1");
+  TokenCache::Clear();
+}
+
+TEST(TokenCache, ExpiredTokensRemoved)
+{
+  using namespace std::chrono_literals;
+  TokenCache::Clear();
+
+  EXPECT_EQ(
+      TokenCache::GetToken(
+          "VALID",
+          []() -> AccessToken {
+            return {"ACCESSTOKEN", std::chrono::system_clock::now() + 1h};
+          })
+          .Token,
+      "ACCESSTOKEN");
+  for (int i = 0; i < 1000; ++i)
+  {
+    TokenCache::GetToken(std::to_string(i), []() -> AccessToken {
+      return {"EXPIRED", std::chrono::system_clock::now() - 1h};
+    });
+  }
+
+  // The expired tokens are removed as the cache grows, the valid one is kept.
+  EXPECT_LT(TokenCache::GetSize(), 200U);
+  EXPECT_EQ(
+      TokenCache::GetToken(
+          "VALID",
+          []() -> AccessToken {
+            return {"ACCESSTOKEN2", std::chrono::system_clock::now() + 1h};
+          })
+          .Token,
+      "ACCESSTOKEN");
+  TokenCache::Clear();
+}
+
+TEST(TokenCache, SingleFetchForConcurrentRequests)
+{
+  using namespace std::chrono_literals;
+  TokenCache::Clear();
+
+  std::atomic<int> numFetches{0};
+  auto const getNewToken = [&]() -> AccessToken {
+    ++numFetches;
+    std::this_thread::sleep_for(100ms);
+    return {"ACCESSTOKEN1", std::chrono::system_clock::now() + 1h};
+  };
+
+  std::vector<std::thread> threads;
+  std::vector<std::string> tokens(8);
+  for (size_t i = 0; i < tokens.size(); ++i)
+  {
+    threads.emplace_back([&, i]() { tokens[i] = TokenCache::GetToken("A", getNewToken).Token; });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  EXPECT_EQ(numFetches, 1);
+  for (auto const& token : tokens)
+  {
+    EXPECT_EQ(token, "ACCESSTOKEN1");
+  }
+  TokenCache::Clear();
+}
+
+TEST(TokenCache, PersistedAcrossProcesses)
+{
+  using namespace std::chrono_literals;
+  TokenCache::Clear();
+
+  TokenCachePersistenceOptions options;
+  options.FilePath = "token_cache_test.bin";
+  options.EncryptionKey = std::vector<uint8_t>(32, 1);
+  std::remove(options.FilePath.c_str());
+  TokenCachePersistence::Enable(options);
+
+  int numFetches = 0;
+  auto const getNewToken = [&]() -> AccessToken {
+    ++numFetches;
+    return {"ACCESSTOKEN" + std::to_string(numFetches), std::chrono::system_clock::now() + 1h};
+  };
+
+  EXPECT_EQ(TokenCache::GetToken("A", getNewToken).Token, "ACCESSTOKEN1");
+  EXPECT_EQ(TokenCache::GetToken("B", getNewToken).Token, "ACCESSTOKEN2");
+
+  // A new process only has the tokens of the file.
+  TokenCache::Clear();
+  EXPECT_EQ(TokenCache::GetToken("A", getNewToken).Token, "ACCESSTOKEN1");
+  EXPECT_EQ(TokenCache::GetToken("B", getNewToken).Token, "ACCESSTOKEN2");
+  EXPECT_EQ(numFetches, 2);
+
+  // The file can't be decrypted with another key, so the token is fetched again.
+  TokenCache::Clear();
+  options.EncryptionKey = std::vector<uint8_t>(32, 2);
+  TokenCachePersistence::Enable(options);
+  EXPECT_EQ(TokenCache::GetToken("A", getNewToken).Token, "ACCESSTOKEN3");
+
+  TokenCachePersistence::Disable();
+  TokenCache::Clear();
+  std::remove(options.FilePath.c_str());
+  std::remove((options.FilePath + ".lock").c_str());
+}
+
+TEST(TokenCache, PersistenceInvalidOptions)
+{
+  TokenCachePersistenceOptions options;
+  options.EncryptionKey = std::vector<uint8_t>(32, 1);
+  EXPECT_THROW(TokenCachePersistence::Enable(options), std::invalid_argument);
+
+  options.FilePath = "token_cache_test.bin";
+  options.EncryptionKey = std::vector<uint8_t>(16, 1);
+  EXPECT_THROW(TokenCachePersistence::Enable(options), std::invalid_argument);
+}
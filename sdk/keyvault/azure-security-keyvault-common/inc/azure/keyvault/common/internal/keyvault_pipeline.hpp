@@ -9,20 +9,137 @@
 
 #pragma once
 
+#include <azure/core/async_response.hpp>
 #include <azure/core/context.hpp>
 #include <azure/core/http/http.hpp>
+#include <azure/core/http/policies/policy.hpp>
 #include <azure/core/internal/http/pipeline.hpp>
 #include <azure/core/internal/json/json.hpp>
 #include <azure/core/internal/json/json_serializable.hpp>
+#include <azure/core/nullable.hpp>
 #include <azure/core/response.hpp>
 
+#include <chrono>
+#include <cstdint>
+#include <exception>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 namespace Azure { namespace Security { namespace KeyVault { namespace _internal {
 
+  /**
+   * @brief The number of requests a Key Vault accepts for a class of operations in an interval.
+   *
+   */
+  struct KeyVaultRequestBudget final
+  {
+    /**
+     * @brief The number of requests accepted in #Interval. Zero doesn't limit the requests.
+     *
+     */
+    int32_t Requests = 0;
+
+    /**
+     * @brief The interval the requests are counted over.
+     *
+     */
+    std::chrono::milliseconds Interval = std::chrono::seconds(10);
+  };
+
+  /**
+   * @brief A token bucket holding up the requests sent beyond a #KeyVaultRequestBudget until the
+   * budget allows them, in the order they came in.
+   *
+   */
+  class KeyVaultRateLimiter final {
+    std::mutex m_mutex;
+    KeyVaultRequestBudget m_budget;
+    double m_tokens;
+    std::chrono::steady_clock::time_point m_refilledOn;
+
+  public:
+    /**
+     * @brief Construct a rate limiter with a full bucket.
+     *
+     * @param budget The requests allowed per interval.
+     */
+    explicit KeyVaultRateLimiter(KeyVaultRequestBudget const& budget);
+
+    /**
+     * @brief Get the rate limiter shared by the process for \p key, usually a vault host and a
+     * class of operations. The limiter takes \p budget when it differs from its current one.
+     *
+     * @param key The identifier of the limiter.
+     * @param budget The requests allowed per interval.
+     * @return The shared rate limiter.
+     */
+    static std::shared_ptr<KeyVaultRateLimiter> GetShared(
+        std::string const& key,
+        KeyVaultRequestBudget const& budget);
+
+    /**
+     * @brief Change the requests allowed per interval. The requests already waiting keep their
+     * turn.
+     *
+     * @param budget The requests allowed per interval.
+     */
+    void SetBudget(KeyVaultRequestBudget const& budget);
+
+    /**
+     * @brief Take a request from the budget, waiting until the budget allows it.
+     *
+     * @param context The context for cancellation. A cancelled request gives back its turn.
+     */
+    void Acquire(Azure::Core::Context const& context);
+  };
+
+  /**
+   * @brief An HTTP policy holding up each request in the rate limiter shared by the process for
+   * its vault host and its class of operations.
+   *
+   */
+  class KeyVaultRateLimitPolicy final : public Azure::Core::Http::Policies::HttpPolicy {
+  public:
+    /**
+     * @brief Gives the class of operations of a request, or an empty string to not limit it.
+     *
+     */
+    using OperationClassifier = std::function<std::string(Azure::Core::Http::Request const&)>;
+
+  private:
+    OperationClassifier m_classify;
+    std::map<std::string, KeyVaultRequestBudget> m_budgets;
+
+  public:
+    /**
+     * @brief Construct a rate limit policy.
+     *
+     * @param classify Gives the class of operations of a request.
+     * @param budgets The requests allowed per interval for each class of operations. The classes
+     * without a budget aren't limited.
+     */
+    explicit KeyVaultRateLimitPolicy(
+        OperationClassifier classify,
+        std::map<std::string, KeyVaultRequestBudget> budgets)
+        : m_classify(std::move(classify)), m_budgets(std::move(budgets))
+    {
+    }
+
+    std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy> Clone() const override
+    {
+      return std::make_unique<KeyVaultRateLimitPolicy>(*this);
+    }
+
+    std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+        Azure::Core::Http::Request& request,
+        Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
+        Azure::Core::Context const& context) const override;
+  };
+
   /**
    * @brief The HTTP pipeline used by Key Vault clients.
    *
@@ -67,6 +184,21 @@ namespace Azure { namespace Security { namespace KeyVault { namespace _internal
         Azure::Core::Context const& context,
         Azure::Core::Http::Request& request) const;
 
+    /**
+     * @brief Start the HTTP transfer based on the \p request, without waiting for the response.
+     *
+     * @remark The pipeline is kept alive until \p callback is called, the request and the context
+     * must be kept alive by the caller.
+     *
+     * @param context The context for per-operation options or cancellation.
+     * @param request The HTTP request to be sent.
+     * @param callback The function called with the raw response, or with the error.
+     */
+    void SendRequestAsync(
+        Azure::Core::Context const& context,
+        Azure::Core::Http::Request& request,
+        Azure::Core::Http::SendCompletionCallback callback) const;
+
   public:
     /**
      * @brief Construct a new Key Vault Pipeline.
@@ -168,6 +300,69 @@ namespace Azure { namespace Security { namespace KeyVault { namespace _internal
       return Azure::Response<T>(value, std::move(response));
     }
 
+    /**
+     * @brief Create and send the HTTP request, with payload content when \p serializeContentFn
+     * isn't empty, without waiting for the response. Uses the \p factoryFn function to create the
+     * response type.
+     *
+     * @param context The context for per-operation options or cancellation.
+     * @param method The method for the request.
+     * @param serializeContentFn The function producing the HTTP payload, or an empty function.
+     * @param factoryFn The function to deserialize and produce T from the raw response.
+     * @param path A path for the request represented as a vector of strings.
+     * @param callback The function called with the object produced by the \p factoryFn and the
+     * raw response from the network, or with the error.
+     */
+    template <class T>
+    void SendRequestAsync(
+        Azure::Core::Context const& context,
+        Azure::Core::Http::HttpMethod method,
+        std::function<std::string()> const& serializeContentFn,
+        std::function<T(Azure::Core::Http::RawResponse const& rawResponse)> factoryFn,
+        std::vector<std::string> const& path,
+        Azure::Core::ResponseCallback<T> callback) const
+    {
+      // Kept alive until the callback is called.
+      struct State final
+      {
+        Azure::Core::Context Context;
+        std::string Content;
+        std::unique_ptr<Azure::Core::IO::MemoryBodyStream> ContentStream;
+        std::unique_ptr<Azure::Core::Http::Request> Request;
+      };
+      auto state = std::make_shared<State>();
+      state->Context = context;
+      if (serializeContentFn)
+      {
+        state->Content = serializeContentFn();
+        state->ContentStream = std::make_unique<Azure::Core::IO::MemoryBodyStream>(
+            reinterpret_cast<const uint8_t*>(state->Content.data()), state->Content.size());
+      }
+      state->Request = std::make_unique<Azure::Core::Http::Request>(
+          CreateRequest(method, state->ContentStream.get(), path));
+      SendRequestAsync(
+          state->Context,
+          *state->Request,
+          [state, factoryFn = std::move(factoryFn), callback = std::move(callback)](
+              std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse,
+              std::exception_ptr error) {
+            Azure::Nullable<Azure::Response<T>> response;
+            if (!error)
+            {
+              try
+              {
+                T value = factoryFn(*rawResponse);
+                response = Azure::Response<T>(std::move(value), std::move(rawResponse));
+              }
+              catch (...)
+              {
+                error = std::current_exception();
+              }
+            }
+            callback(std::move(response), error);
+          });
+    }
+
     /**
      * @brief Create a key vault request and send it using the Azure Core pipeline directly to avoid
      * checking the respone code.
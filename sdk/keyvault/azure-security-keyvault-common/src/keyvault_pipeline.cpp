@@ -7,10 +7,16 @@
 #include <azure/core/exception.hpp>
 #include <azure/core/http/http.hpp>
 
+#include <algorithm>
+#include <thread>
+
 using namespace Azure::Security::KeyVault;
 using namespace Azure::Core::Http::_internal;
 
 namespace {
+// Waiting requests wake up at least this often to notice the cancellation.
+constexpr std::chrono::milliseconds MaxWaitSlice(500);
+
 inline Azure::Core::Http::Request InitRequest(
     Azure::Core::Http::HttpMethod method,
     Azure::Core::IO::BodyStream* content,
@@ -74,3 +80,134 @@ std::unique_ptr<Azure::Core::Http::RawResponse> _internal::KeyVaultPipeline::Sen
   }
   return response;
 }
+
+void _internal::KeyVaultPipeline::SendRequestAsync(
+    Azure::Core::Context const& context,
+    Azure::Core::Http::Request& request,
+    Azure::Core::Http::SendCompletionCallback callback) const
+{
+  // The copy of the pipeline shares its policies, which outlive the client.
+  auto pipeline = std::make_shared<HttpPipeline>(m_pipeline);
+  pipeline->SendAsync(
+      request,
+      context,
+      [pipeline, callback = std::move(callback)](
+          std::unique_ptr<Azure::Core::Http::RawResponse> response, std::exception_ptr error) {
+        if (!error)
+        {
+          switch (response->GetStatusCode())
+          {
+            case Azure::Core::Http::HttpStatusCode::Ok:
+            case Azure::Core::Http::HttpStatusCode::Created:
+            case Azure::Core::Http::HttpStatusCode::Accepted:
+            case Azure::Core::Http::HttpStatusCode::NoContent:
+              break;
+            default:
+              error = std::make_exception_ptr(Azure::Core::RequestFailedException(response));
+              response.reset();
+          }
+        }
+        callback(std::move(response), error);
+      });
+}
+
+_internal::KeyVaultRateLimiter::KeyVaultRateLimiter(KeyVaultRequestBudget const& budget)
+    : m_budget(budget), m_tokens(budget.Requests), m_refilledOn(std::chrono::steady_clock::now())
+{
+}
+
+std::shared_ptr<_internal::KeyVaultRateLimiter> _internal::KeyVaultRateLimiter::GetShared(
+    std::string const& key,
+    KeyVaultRequestBudget const& budget)
+{
+  // The limiters live as long as the process so that the clients created later keep the budget
+  // spent by the previous ones. There is one per vault and class of operations.
+  static std::mutex limitersMutex;
+  static std::map<std::string, std::shared_ptr<KeyVaultRateLimiter>> limiters;
+
+  std::shared_ptr<KeyVaultRateLimiter> limiter;
+  {
+    std::lock_guard<std::mutex> guard(limitersMutex);
+    auto& entry = limiters[key];
+    if (entry == nullptr)
+    {
+      entry = std::make_shared<KeyVaultRateLimiter>(budget);
+      return entry;
+    }
+    limiter = entry;
+  }
+  limiter->SetBudget(budget);
+  return limiter;
+}
+
+void _internal::KeyVaultRateLimiter::SetBudget(KeyVaultRequestBudget const& budget)
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (budget.Requests == m_budget.Requests && budget.Interval == m_budget.Interval)
+  {
+    return;
+  }
+  m_budget = budget;
+  m_tokens = (std::min)(m_tokens, static_cast<double>(budget.Requests));
+}
+
+void _internal::KeyVaultRateLimiter::Acquire(Azure::Core::Context const& context)
+{
+  std::chrono::steady_clock::time_point allowedOn;
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_budget.Requests <= 0 || m_budget.Interval <= std::chrono::milliseconds::zero())
+    {
+      return;
+    }
+    double const tokensPerMillisecond
+        = static_cast<double>(m_budget.Requests) / m_budget.Interval.count();
+
+    auto const now = std::chrono::steady_clock::now();
+    auto const elapsed = std::chrono::duration<double, std::milli>(now - m_refilledOn).count();
+    m_tokens = (std::min)(
+        static_cast<double>(m_budget.Requests), m_tokens + elapsed * tokensPerMillisecond);
+    m_refilledOn = now;
+
+    // Taking the token before it's refilled queues the request behind the ones already waiting.
+    m_tokens -= 1;
+    if (m_tokens >= 0)
+    {
+      return;
+    }
+    auto const wait = std::chrono::duration<double, std::milli>(-m_tokens / tokensPerMillisecond);
+    allowedOn = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(wait);
+  }
+
+  for (auto now = std::chrono::steady_clock::now(); now < allowedOn;
+       now = std::chrono::steady_clock::now())
+  {
+    if (context.IsCancelled())
+    {
+      {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_tokens += 1;
+      }
+      context.ThrowIfCancelled();
+    }
+    std::this_thread::sleep_for((std::min)(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(MaxWaitSlice),
+        allowedOn - now));
+  }
+}
+
+std::unique_ptr<Azure::Core::Http::RawResponse> _internal::KeyVaultRateLimitPolicy::Send(
+    Azure::Core::Http::Request& request,
+    Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
+    Azure::Core::Context const& context) const
+{
+  auto const operationClass = m_classify(request);
+  auto const budget = m_budgets.find(operationClass);
+  if (!operationClass.empty() && budget != m_budgets.end() && budget->second.Requests > 0)
+  {
+    KeyVaultRateLimiter::GetShared(
+        request.GetUrl().GetHost() + "/" + operationClass, budget->second)
+        ->Acquire(context);
+  }
+  return nextPolicy.Send(request, context);
+}
@@ -8,6 +8,7 @@
 #include <azure/core/internal/client_options.hpp>
 #include <azure/keyvault/common/internal/keyvault_pipeline.hpp>
 
+#include <chrono>
 #include <memory>
 
 using namespace Azure::Security::KeyVault::_internal;
@@ -23,3 +24,43 @@ TEST(KeyVaultPipeline, initPipeline)
       options, "service-name", "service-version", std::move(policies), {});
   EXPECT_NO_THROW(KeyVaultPipeline p(url, "version", std::move(pipeline)));
 }
+
+TEST(KeyVaultRateLimiter, HoldsUpRequestsBeyondBudget)
+{
+  KeyVaultRequestBudget budget;
+  budget.Requests = 2;
+  budget.Interval = std::chrono::milliseconds(200);
+  KeyVaultRateLimiter limiter(budget);
+
+  auto const start = std::chrono::steady_clock::now();
+  // The first two requests use the full bucket, the next two wait for 100ms each.
+  for (int i = 0; i < 4; ++i)
+  {
+    limiter.Acquire(Azure::Core::Context());
+  }
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(190));
+}
+
+TEST(KeyVaultRateLimiter, CancelledRequestThrows)
+{
+  KeyVaultRequestBudget budget;
+  budget.Requests = 1;
+  budget.Interval = std::chrono::hours(1);
+  KeyVaultRateLimiter limiter(budget);
+  limiter.Acquire(Azure::Core::Context());
+
+  auto context = Azure::Core::Context::ApplicationContext.WithDeadline(
+      std::chrono::system_clock::now() + std::chrono::milliseconds(100));
+  EXPECT_THROW(limiter.Acquire(context), Azure::Core::OperationCancelledException);
+}
+
+TEST(KeyVaultRateLimiter, SharedByKey)
+{
+  KeyVaultRequestBudget budget;
+  budget.Requests = 10;
+  auto first = KeyVaultRateLimiter::GetShared("vault.test/cryptography", budget);
+  auto second = KeyVaultRateLimiter::GetShared("vault.test/cryptography", budget);
+  auto other = KeyVaultRateLimiter::GetShared("vault.test/other", budget);
+  EXPECT_EQ(first, second);
+  EXPECT_NE(first, other);
+}
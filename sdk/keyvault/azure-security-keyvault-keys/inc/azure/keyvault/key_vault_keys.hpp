@@ -24,12 +24,14 @@
 #include "azure/keyvault/keys/dll_import_export.hpp"
 #include "azure/keyvault/keys/import_key_options.hpp"
 #include "azure/keyvault/keys/json_web_key.hpp"
+#include "azure/keyvault/keys/key_backup_options.hpp"
 #include "azure/keyvault/keys/key_client.hpp"
 #include "azure/keyvault/keys/key_client_options.hpp"
 #include "azure/keyvault/keys/key_create_options.hpp"
 #include "azure/keyvault/keys/key_curve_name.hpp"
 #include "azure/keyvault/keys/key_operation.hpp"
 #include "azure/keyvault/keys/key_properties.hpp"
+#include "azure/keyvault/keys/key_rate_limit_options.hpp"
 #include "azure/keyvault/keys/key_type.hpp"
 #include "azure/keyvault/keys/key_vault_key.hpp"
 #include "azure/keyvault/keys/list_keys_result.hpp"
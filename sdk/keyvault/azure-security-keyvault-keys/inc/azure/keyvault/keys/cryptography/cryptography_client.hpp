@@ -21,14 +21,19 @@
 #include "azure/keyvault/keys/internal/cryptography/cryptography_provider.hpp"
 #include "azure/keyvault/keys/internal/cryptography/remote_cryptography_client.hpp"
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Azure {
   namespace Security {
     namespace KeyVault {
       namespace Keys {
         namespace Cryptography {
+  namespace _detail {
+    class UnwrappedKeyCache;
+  } // namespace _detail
 
   /**
    * @brief A client used to perform cryptographic operations with Azure Key Vault keys.
@@ -38,11 +43,15 @@ namespace Azure {
   private:
     std::shared_ptr<Azure::Security::KeyVault::_internal::KeyVaultPipeline> m_pipeline;
     std::string m_keyId;
+    std::chrono::milliseconds m_keyCacheDuration;
     std::shared_ptr<
         Azure::Security::KeyVault::Keys::Cryptography::_detail::RemoteCryptographyClient>
         m_remoteProvider;
     std::shared_ptr<Azure::Security::KeyVault::Keys::Cryptography::_detail::CryptographyProvider>
         m_provider;
+    // Null when the unwrapped keys aren't cached.
+    std::shared_ptr<Azure::Security::KeyVault::Keys::Cryptography::_detail::UnwrappedKeyCache>
+        m_unwrappedKeyCache;
 
     explicit CryptographyClient(
         std::string const& keyId,
@@ -144,6 +153,42 @@ namespace Azure {
         std::vector<uint8_t> const& encryptedKey,
         Azure::Core::Context const& context = Azure::Core::Context());
 
+    /**
+     * @brief Encrypts many keys, such as the data encryption keys of an envelope encryption, with
+     * up to #KeyWrapBatchOptions::Concurrency keys wrapped at the same time.
+     *
+     * @param algorithm The #KeyWrapAlgorithm to use.
+     * @param keys The keys to encrypt.
+     * @param options Optional parameters for the operation.
+     * @param context A #Azure::Core::Context to cancel the operation.
+     * @return The result of wrapping each key, in the order of the keys.
+     * @remark The exception of the first key failing to be wrapped is thrown once the keys being
+     * wrapped are done, the keys not started yet aren't wrapped.
+     */
+    std::vector<WrapResult> WrapKeys(
+        KeyWrapAlgorithm algorithm,
+        std::vector<std::vector<uint8_t>> const& keys,
+        KeyWrapBatchOptions const& options = KeyWrapBatchOptions(),
+        Azure::Core::Context const& context = Azure::Core::Context());
+
+    /**
+     * @brief Decrypts many encrypted keys, with up to #KeyWrapBatchOptions::Concurrency keys
+     * unwrapped at the same time.
+     *
+     * @param algorithm The #KeyWrapAlgorithm to use.
+     * @param encryptedKeys The encrypted keys.
+     * @param options Optional parameters for the operation.
+     * @param context A #Azure::Core::Context to cancel the operation.
+     * @return The result of unwrapping each key, in the order of the encrypted keys.
+     * @remark The exception of the first key failing to be unwrapped is thrown once the keys being
+     * unwrapped are done, the keys not started yet aren't unwrapped.
+     */
+    std::vector<UnwrapResult> UnwrapKeys(
+        KeyWrapAlgorithm algorithm,
+        std::vector<std::vector<uint8_t>> const& encryptedKeys,
+        KeyWrapBatchOptions const& options = KeyWrapBatchOptions(),
+        Azure::Core::Context const& context = Azure::Core::Context());
+
     /**
      * @brief Signs the specified digest.
      *
@@ -160,6 +205,25 @@ namespace Azure {
         std::vector<uint8_t> const& digest,
         Azure::Core::Context const& context = Azure::Core::Context());
 
+    /**
+     * @brief Signs the specified digest, without waiting for the response of Key Vault.
+     *
+     * @remark The digest is signed on the calling thread when the key is available locally, the
+     * response has no raw response then. The first operation of the client gets the key from Key
+     * Vault on the calling thread. Use Azure::Core::ResponseAwaitable to `co_await` the signature.
+     *
+     * @param algorithm The #SignatureAlgorithm to use.
+     * @param digest The pre-hashed digest to sign. The hash algorithm used to compute the digest
+     * must be compatable with the specified algorithm.
+     * @param context A #Azure::Core::Context to cancel the operation.
+     * @param callback The function called with the #SignResult, or with the error.
+     */
+    void SignAsync(
+        SignatureAlgorithm algorithm,
+        std::vector<uint8_t> const& digest,
+        Azure::Core::Context const& context,
+        Azure::Core::ResponseCallback<SignResult> callback);
+
     /**
      * @brief Signs the specified data.
      *
@@ -13,6 +13,12 @@
 #include <azure/core/internal/client_options.hpp>
 
 #include "azure/keyvault/keys/dll_import_export.hpp"
+#include "azure/keyvault/keys/key_rate_limit_options.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
 
 namespace Azure {
   namespace Security {
@@ -71,6 +77,37 @@ namespace Azure {
      */
     ServiceVersion Version;
 
+    /**
+     * @brief How long the key got from Key Vault for local operations is shared by the
+     * #CryptographyClient instances created for the same key identifier in the process. A new
+     * client starts with the cached key instead of getting it again. Zero doesn't cache the key.
+     *
+     */
+    std::chrono::milliseconds KeyCacheDuration = std::chrono::minutes(5);
+
+    /**
+     * @brief How long the keys unwrapped by the #CryptographyClient are cached, so that unwrapping
+     * the same encrypted key again doesn't call Key Vault. Zero doesn't cache the unwrapped keys.
+     *
+     * @remark The cached keys are held in the memory of the process.
+     *
+     */
+    std::chrono::milliseconds UnwrappedKeyCacheDuration = std::chrono::milliseconds::zero();
+
+    /**
+     * @brief The maximum total size, in bytes, of the encrypted and unwrapped keys cached by the
+     * #CryptographyClient. The least recently used keys are evicted beyond this size.
+     *
+     */
+    size_t UnwrappedKeyCacheSize = 1024 * 1024;
+
+    /**
+     * @brief The request budget of the vault, shared with the other clients of the process.
+     * Nothing is limited by default.
+     *
+     */
+    KeyRateLimitOptions RateLimits;
+
     /**
      * @brief Construct a new Key Client Options object.
      *
@@ -81,4 +118,18 @@ namespace Azure {
     {
     }
   };
+
+  /**
+   * @brief Optional parameters for #CryptographyClient::WrapKeys and
+   * #CryptographyClient::UnwrapKeys.
+   *
+   */
+  struct KeyWrapBatchOptions final
+  {
+    /**
+     * @brief The maximum number of keys wrapped or unwrapped at the same time.
+     *
+     */
+    int32_t Concurrency = 8;
+  };
 }}}}} // namespace Azure::Security::KeyVault::Keys::Cryptography
@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief EC local cryptography provider.
+ *
+ */
+
+#pragma once
+
+#include "azure/keyvault/keys/internal/cryptography/local_cryptography_provider.hpp"
+
+#include <memory>
+#include <string>
+
+namespace Azure {
+  namespace Security {
+    namespace KeyVault {
+      namespace Keys {
+        namespace Cryptography {
+  namespace _detail {
+
+    /**
+     * @brief Verifies signatures locally with the public key of an EC key, which is imported once
+     * and shared by all the verifications. The other operations, which need the private key, are
+     * left to the remote client.
+     *
+     */
+    struct EcCryptographyProvider final : public LocalCryptographyProvider
+    {
+      EcCryptographyProvider(
+          Azure::Security::KeyVault::Keys::JsonWebKey const& keyMaterial,
+          Azure::Security::KeyVault::Keys::KeyProperties const& keyProperties,
+          bool localOnly);
+
+      bool SupportsOperation(
+          Azure::Security::KeyVault::Keys::KeyOperation operation) const noexcept override
+      {
+        if (operation == Azure::Security::KeyVault::Keys::KeyOperation::Encrypt
+            || operation == Azure::Security::KeyVault::Keys::KeyOperation::Decrypt
+            || operation == Azure::Security::KeyVault::Keys::KeyOperation::Sign
+            || operation == Azure::Security::KeyVault::Keys::KeyOperation::Verify
+            || operation == Azure::Security::KeyVault::Keys::KeyOperation::WrapKey
+            || operation == Azure::Security::KeyVault::Keys::KeyOperation::UnwrapKey)
+        {
+          return m_keyMaterial.SupportsOperation(operation);
+        }
+        return false;
+      }
+
+      EncryptResult Encrypt(
+          EncryptParameters const& parameters,
+          Azure::Core::Context const& context) const override;
+
+      DecryptResult Decrypt(
+          DecryptParameters const& parameters,
+          Azure::Core::Context const& context) const override;
+
+      WrapResult WrapKey(
+          KeyWrapAlgorithm const& algorithm,
+          std::vector<uint8_t> const& key,
+          Azure::Core::Context const& context) const override;
+
+      UnwrapResult UnwrapKey(
+          KeyWrapAlgorithm const& algorithm,
+          std::vector<uint8_t> const& encryptedKey,
+          Azure::Core::Context const& context) const override;
+
+      SignResult Sign(
+          SignatureAlgorithm const& algorithm,
+          std::vector<uint8_t> const& digest,
+          Azure::Core::Context const& context) const override;
+
+      VerifyResult Verify(
+          SignatureAlgorithm const& algorithm,
+          std::vector<uint8_t> const& digest,
+          std::vector<uint8_t> const& signature,
+          Azure::Core::Context const& context) const override;
+
+    private:
+      struct PublicKey;
+
+      // The size in bytes of the coordinates and of the halves of a signature, zero if the curve
+      // isn't supported locally.
+      size_t m_coordinateSize = 0;
+      // Null if the key can't be used locally.
+      std::shared_ptr<PublicKey const> m_publicKey;
+    };
+}}}}}} // namespace Azure::Security::KeyVault::Keys::Cryptography::_detail
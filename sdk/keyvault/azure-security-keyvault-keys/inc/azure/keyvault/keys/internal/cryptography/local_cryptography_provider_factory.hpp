@@ -9,7 +9,9 @@
 
 #pragma once
 
+#include "azure/keyvault/keys/internal/cryptography/aes_cryptography_provider.hpp"
 #include "azure/keyvault/keys/internal/cryptography/cryptography_provider.hpp"
+#include "azure/keyvault/keys/internal/cryptography/ec_cryptography_provider.hpp"
 #include "azure/keyvault/keys/internal/cryptography/rsa_cryptography_provider.hpp"
 #include "azure/keyvault/keys/key_vault_key.hpp"
 
@@ -37,6 +39,16 @@ namespace Azure {
         {
           return std::make_unique<RsaCryptographyProvider>(keyMaterial, keyProperties, localOnly);
         }
+        if (keyMaterial.KeyType == Azure::Security::KeyVault::Keys::KeyVaultKeyType::Ec
+            || keyMaterial.KeyType == Azure::Security::KeyVault::Keys::KeyVaultKeyType::EcHsm)
+        {
+          return std::make_unique<EcCryptographyProvider>(keyMaterial, keyProperties, localOnly);
+        }
+        if (keyMaterial.KeyType == Azure::Security::KeyVault::Keys::KeyVaultKeyType::Oct
+            || keyMaterial.KeyType == Azure::Security::KeyVault::Keys::KeyVaultKeyType::OctHsm)
+        {
+          return std::make_unique<AesCryptographyProvider>(keyMaterial, keyProperties, localOnly);
+        }
         return nullptr;
       }
 
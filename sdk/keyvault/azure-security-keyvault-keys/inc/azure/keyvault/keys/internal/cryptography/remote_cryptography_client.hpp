@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <azure/core/async_response.hpp>
 #include <azure/core/response.hpp>
 #include <azure/core/url.hpp>
 
@@ -93,6 +94,12 @@ namespace Azure {
           std::vector<uint8_t> const& digest,
           Azure::Core::Context const& context) const;
 
+      void SignWithResponseAsync(
+          SignatureAlgorithm const& algorithm,
+          std::vector<uint8_t> const& digest,
+          Azure::Core::Context const& context,
+          Azure::Core::ResponseCallback<SignResult> callback) const;
+
       SignResult Sign(
           SignatureAlgorithm const& algorithm,
           std::vector<uint8_t> const& digest,
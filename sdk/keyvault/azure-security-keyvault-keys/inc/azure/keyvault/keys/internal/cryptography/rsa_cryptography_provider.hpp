@@ -21,15 +21,19 @@ namespace Azure {
         namespace Cryptography {
   namespace _detail {
 
+    /**
+     * @brief Encrypts, wraps keys and verifies signatures locally with the public key of an RSA
+     * key. The key, and an OpenSSL context prepared for each algorithm, are created once and
+     * duplicated by every operation, so operations from several threads don't parse the key again.
+     * The operations which need the private key are left to the remote client.
+     *
+     */
     struct RsaCryptographyProvider final : public LocalCryptographyProvider
     {
       RsaCryptographyProvider(
           Azure::Security::KeyVault::Keys::JsonWebKey const& keyMaterial,
           Azure::Security::KeyVault::Keys::KeyProperties const& keyProperties,
-          bool localOnly)
-          : LocalCryptographyProvider(keyMaterial, keyProperties, localOnly)
-      {
-      }
+          bool localOnly);
 
       bool SupportsOperation(
           Azure::Security::KeyVault::Keys::KeyOperation operation) const noexcept override
@@ -66,13 +70,19 @@ namespace Azure {
 
       SignResult Sign(
           SignatureAlgorithm const& algorithm,
-          std::vector<uint8_t> const& sigest,
+          std::vector<uint8_t> const& digest,
           Azure::Core::Context const& context) const override;
 
       VerifyResult Verify(
           SignatureAlgorithm const& algorithm,
-          std::vector<uint8_t> const& sigest,
+          std::vector<uint8_t> const& digest,
           std::vector<uint8_t> const& signature,
           Azure::Core::Context const& context) const override;
+
+    private:
+      struct PublicKey;
+
+      // Null if the key can't be used locally.
+      std::shared_ptr<PublicKey const> m_publicKey;
     };
 }}}}}} // namespace Azure::Security::KeyVault::Keys::Cryptography::_detail
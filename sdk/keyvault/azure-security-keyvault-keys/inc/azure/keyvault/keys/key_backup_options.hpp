@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Defines the options and the results to back up and restore many keys.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Security { namespace KeyVault { namespace Keys {
+
+  /**
+   * @brief Receives the backup of a key, as soon as it's got from Key Vault. It's called by one
+   * thread at a time.
+   *
+   * @remark An exception thrown by the sink fails the backup of the key.
+   *
+   */
+  using KeyBackupSink
+      = std::function<void(std::string const& name, std::vector<uint8_t> const& backup)>;
+
+  /**
+   * @brief Gives the next key backup to restore, and the name of the key to report its result.
+   * It's called by one thread at a time, and returns false once there are no more backups.
+   *
+   * @remark An exception thrown by the source stops the restore, and is thrown once the backups
+   * being restored are done.
+   *
+   */
+  using KeyBackupSource = std::function<bool(std::string& name, std::vector<uint8_t>& backup)>;
+
+  /**
+   * @brief Optional parameters for #KeyClient::BackupKeys and #KeyClient::RestoreKeyBackups.
+   *
+   */
+  struct BulkKeyBackupOptions final
+  {
+    /**
+     * @brief The maximum number of keys backed up or restored at the same time.
+     *
+     */
+    int32_t Concurrency = 8;
+
+    /**
+     * @brief How many times a key is retried when Key Vault still throttles it once the retries of
+     * the client are exhausted.
+     *
+     */
+    int32_t MaxThrottledRetries = 5;
+
+    /**
+     * @brief How long all the keys wait after Key Vault throttled one of them, when the response
+     * has no Retry-After header. The delay doubles with every retry of the key.
+     *
+     */
+    std::chrono::milliseconds ThrottledDelay = std::chrono::seconds(1);
+  };
+
+  /**
+   * @brief The failure to back up or restore a key.
+   *
+   */
+  struct KeyBackupFailure final
+  {
+    /**
+     * @brief The name of the key.
+     *
+     */
+    std::string Name;
+
+    /**
+     * @brief The exception the key failed with.
+     *
+     */
+    std::exception_ptr Error;
+  };
+
+  /**
+   * @brief The results of backing up or restoring many keys.
+   *
+   */
+  struct BulkKeyBackupResult final
+  {
+    /**
+     * @brief The number of keys backed up or restored.
+     *
+     */
+    int64_t SucceededCount = 0;
+
+    /**
+     * @brief The keys which failed, in no particular order.
+     *
+     */
+    std::vector<KeyBackupFailure> Failures;
+  };
+}}}} // namespace Azure::Security::KeyVault::Keys
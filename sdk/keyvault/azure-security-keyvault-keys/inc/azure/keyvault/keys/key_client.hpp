@@ -13,6 +13,7 @@
 
 #include "azure/keyvault/keys/delete_key_operation.hpp"
 #include "azure/keyvault/keys/import_key_options.hpp"
+#include "azure/keyvault/keys/key_backup_options.hpp"
 #include "azure/keyvault/keys/key_client_options.hpp"
 #include "azure/keyvault/keys/key_create_options.hpp"
 #include "azure/keyvault/keys/key_type.hpp"
@@ -104,6 +105,23 @@ namespace Azure { namespace Security { namespace KeyVault { namespace Keys {
         GetKeyOptions const& options = GetKeyOptions(),
         Azure::Core::Context const& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Gets the public part of a stored key, without waiting for the response.
+     *
+     * @remark The calling thread is only blocked by the policies and the transport without an
+     * asynchronous implementation. Use Azure::Core::ResponseAwaitable to `co_await` the key.
+     *
+     * @param name The name of the key.
+     * @param options Optional parameters for this operation.
+     * @param context The context for the operation can be used for request cancellation.
+     * @param callback The function called with the Key, or with the error.
+     */
+    void GetKeyAsync(
+        std::string const& name,
+        GetKeyOptions const& options,
+        Azure::Core::Context const& context,
+        Azure::Core::ResponseCallback<KeyVaultKey> callback) const;
+
     /**
      * @brief Creates and stores a new key in Key Vault. The create key operation can be used to
      * create any key type in Azure Key Vault. If the named key already exists, Azure Key Vault
@@ -367,6 +385,44 @@ namespace Azure { namespace Security { namespace KeyVault { namespace Keys {
         std::vector<uint8_t> const& backup,
         Azure::Core::Context const& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Backs up all the keys of the vault, with up to #BulkKeyBackupOptions::Concurrency
+     * keys backed up at the same time, and hands each backup to a sink as soon as it's got.
+     *
+     * @remark The keys are listed with #GetPropertiesOfKeys while the keys already listed are
+     * backed up. The keys managed by Key Vault for certificates are skipped, they're backed up
+     * with their certificates. When Key Vault throttles a key, all the keys wait for the delay of
+     * its Retry-After header before the key is retried. This operation requires the keys/list and
+     * keys/backup permissions.
+     *
+     * @param sink Receives the backup of each key.
+     * @param options Optional parameters for this operation.
+     * @param context A #Azure::Core::Context controlling the request lifetime.
+     * @return The number of keys backed up and the keys which failed. The exception of a failure
+     * to list the keys is thrown once the keys listed are backed up.
+     */
+    BulkKeyBackupResult BackupKeys(
+        KeyBackupSink const& sink,
+        BulkKeyBackupOptions const& options = BulkKeyBackupOptions(),
+        Azure::Core::Context const& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Restores many backed up keys, with up to #BulkKeyBackupOptions::Concurrency keys
+     * restored at the same time, reading each backup from a source only when it's restored.
+     *
+     * @remark When Key Vault throttles a key, all the keys wait for the delay of its Retry-After
+     * header before the key is retried. This operation requires the keys/restore permission.
+     *
+     * @param source Gives the backups to restore.
+     * @param options Optional parameters for this operation.
+     * @param context A #Azure::Core::Context controlling the request lifetime.
+     * @return The number of keys restored and the keys which failed.
+     */
+    BulkKeyBackupResult RestoreKeyBackups(
+        KeyBackupSource const& source,
+        BulkKeyBackupOptions const& options = BulkKeyBackupOptions(),
+        Azure::Core::Context const& context = Azure::Core::Context()) const;
+
     /**
      * @brief Imports an externally created ket, stores it, and returns jey parameters and
      * attributes to the client.
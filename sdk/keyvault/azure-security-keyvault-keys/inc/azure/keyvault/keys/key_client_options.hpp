@@ -12,6 +12,7 @@
 #include <azure/core/internal/client_options.hpp>
 
 #include "azure/keyvault/keys/dll_import_export.hpp"
+#include "azure/keyvault/keys/key_rate_limit_options.hpp"
 #include "azure/keyvault/keys/key_vault_key.hpp"
 
 namespace Azure { namespace Security { namespace KeyVault { namespace Keys {
@@ -56,6 +57,13 @@ namespace Azure { namespace Security { namespace KeyVault { namespace Keys {
   {
     ServiceVersion Version;
 
+    /**
+     * @brief The request budget of the vault, shared with the other clients of the process.
+     * Nothing is limited by default.
+     *
+     */
+    KeyRateLimitOptions RateLimits;
+
     /**
      * @brief Construct a new Key Client Options object.
      *
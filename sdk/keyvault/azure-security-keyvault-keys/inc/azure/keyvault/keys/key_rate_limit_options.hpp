@@ -0,0 +1,53 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Defines the request budget of a vault, to limit the rate of the requests sent by the
+ * clients.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace Azure { namespace Security { namespace KeyVault { namespace Keys {
+
+  /**
+   * @brief The number of requests the vault accepts in an interval for each class of operations.
+   * The clients of the process sending requests to the same vault share the budget, and hold up
+   * the requests beyond it until the budget allows them, instead of getting them throttled.
+   *
+   * @remark Zero doesn't limit the requests of a class of operations.
+   *
+   */
+  struct KeyRateLimitOptions final
+  {
+    /**
+     * @brief The interval the requests are counted over.
+     *
+     */
+    std::chrono::milliseconds Interval = std::chrono::seconds(10);
+
+    /**
+     * @brief The number of encrypt, decrypt, wrap, unwrap, sign and verify requests accepted in
+     * #Interval.
+     *
+     */
+    int32_t CryptographyRequests = 0;
+
+    /**
+     * @brief The number of create key requests accepted in #Interval.
+     *
+     */
+    int32_t CreateKeyRequests = 0;
+
+    /**
+     * @brief The number of other requests accepted in #Interval.
+     *
+     */
+    int32_t OtherRequests = 0;
+  };
+}}}} // namespace Azure::Security::KeyVault::Keys
@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/keyvault/keys/internal/cryptography/aes_cryptography_provider.hpp"
+
+#include <azure/core/platform.hpp>
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#endif
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace Azure {
+  namespace Security {
+    namespace KeyVault {
+      namespace Keys {
+        namespace Cryptography {
+  namespace _detail {
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+    namespace {
+      // The AES key wrap cipher of an algorithm, null if the algorithm isn't an AES key wrap one
+      // or doesn't match the size of the key.
+      EVP_CIPHER const* GetKeyWrapCipher(KeyWrapAlgorithm const& algorithm, size_t keySize)
+      {
+        if (algorithm == KeyWrapAlgorithm::A128KW && keySize == 16)
+        {
+          return EVP_aes_128_wrap();
+        }
+        if (algorithm == KeyWrapAlgorithm::A192KW && keySize == 24)
+        {
+          return EVP_aes_192_wrap();
+        }
+        if (algorithm == KeyWrapAlgorithm::A256KW && keySize == 32)
+        {
+          return EVP_aes_256_wrap();
+        }
+        return nullptr;
+      }
+
+      // Wraps or unwraps a key with the AES key wrap algorithm of RFC 3394.
+      std::vector<uint8_t> TransformKey(
+          EVP_CIPHER const* cipher,
+          std::vector<uint8_t> const& keyEncryptionKey,
+          std::vector<uint8_t> const& input,
+          bool wrap)
+      {
+        // The key to wrap is made of 64-bit blocks, at least two, the wrapped key has one more.
+        if (input.size() % 8 != 0 || input.size() < (wrap ? 16U : 24U))
+        {
+          throw std::invalid_argument("The key size must be a multiple of 8 bytes.");
+        }
+
+        std::unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)> context(
+            EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free);
+        if (!context)
+        {
+          throw std::runtime_error("Failed to create the cipher context.");
+        }
+        EVP_CIPHER_CTX_set_flags(context.get(), EVP_CIPHER_CTX_FLAG_WRAP_ALLOW);
+        if (EVP_CipherInit_ex(
+                context.get(), cipher, nullptr, keyEncryptionKey.data(), nullptr, wrap ? 1 : 0)
+            != 1)
+        {
+          ERR_clear_error();
+          throw std::runtime_error("Failed to initialize the key wrap cipher.");
+        }
+
+        std::vector<uint8_t> output(wrap ? input.size() + 8 : input.size());
+        int outputSize = 0;
+        int finalSize = 0;
+        if (EVP_CipherUpdate(
+                context.get(),
+                output.data(),
+                &outputSize,
+                input.data(),
+                static_cast<int>(input.size()))
+                != 1
+            || EVP_CipherFinal_ex(context.get(), output.data() + outputSize, &finalSize) != 1)
+        {
+          ERR_clear_error();
+          throw std::runtime_error(
+              wrap ? "Failed to wrap the key."
+                   : "Failed to unwrap the key, it failed the integrity check.");
+        }
+        output.resize(static_cast<size_t>(outputSize + finalSize));
+        return output;
+      }
+    } // namespace
+#endif
+
+    EncryptResult AesCryptographyProvider::Encrypt(
+        EncryptParameters const& parameters,
+        Azure::Core::Context const&) const
+    {
+      EncryptResult result;
+      result.Algorithm = parameters.Algorithm;
+      return result;
+    }
+
+    DecryptResult AesCryptographyProvider::Decrypt(
+        DecryptParameters const& parameters,
+        Azure::Core::Context const&) const
+    {
+      DecryptResult result;
+      result.Algorithm = parameters.Algorithm;
+      return result;
+    }
+
+    WrapResult AesCryptographyProvider::WrapKey(
+        KeyWrapAlgorithm const& algorithm,
+        std::vector<uint8_t> const& key,
+        Azure::Core::Context const&) const
+    {
+      // Without an encrypted key, the key is wrapped by the remote client.
+      WrapResult result;
+      result.Algorithm = algorithm;
+#if !defined(AZ_PLATFORM_WINDOWS)
+      if (auto const cipher = GetKeyWrapCipher(algorithm, m_keyMaterial.K.size()))
+      {
+        result.EncryptedKey = TransformKey(cipher, m_keyMaterial.K, key, true);
+        result.KeyId = m_keyMaterial.Id;
+      }
+#else
+      (void)key;
+#endif
+      return result;
+    }
+
+    UnwrapResult AesCryptographyProvider::UnwrapKey(
+        KeyWrapAlgorithm const& algorithm,
+        std::vector<uint8_t> const& encryptedKey,
+        Azure::Core::Context const&) const
+    {
+      // Without a key, the key is unwrapped by the remote client.
+      UnwrapResult result;
+      result.Algorithm = algorithm;
+#if !defined(AZ_PLATFORM_WINDOWS)
+      if (auto const cipher = GetKeyWrapCipher(algorithm, m_keyMaterial.K.size()))
+      {
+        result.Key = TransformKey(cipher, m_keyMaterial.K, encryptedKey, false);
+        result.KeyId = m_keyMaterial.Id;
+      }
+#else
+      (void)encryptedKey;
+#endif
+      return result;
+    }
+
+    SignResult AesCryptographyProvider::Sign(
+        SignatureAlgorithm const& algorithm,
+        std::vector<uint8_t> const&,
+        Azure::Core::Context const&) const
+    {
+      SignResult result;
+      result.Algorithm = algorithm;
+      return result;
+    }
+
+    VerifyResult AesCryptographyProvider::Verify(
+        SignatureAlgorithm const& algorithm,
+        std::vector<uint8_t> const&,
+        std::vector<uint8_t> const&,
+        Azure::Core::Context const&) const
+    {
+      VerifyResult result{};
+      result.Algorithm = algorithm;
+      return result;
+    }
+
+}}}}}} // namespace Azure::Security::KeyVault::Keys::Cryptography::_detail
@@ -12,6 +12,13 @@
 #include "azure/keyvault/keys/internal/cryptography/local_cryptography_provider_factory.hpp"
 #include "azure/keyvault/keys/key_operation.hpp"
 
+#include "../private/key_material_cache.hpp"
+#include "../private/unwrapped_key_cache.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -30,12 +37,13 @@ inline std::vector<uint8_t> CreateDigest(
     SignatureAlgorithm algorithm,
     Azure::Core::IO::BodyStream& data)
 {
-  // Use heap for the reading buffer.
-  auto heapBuffer = std::make_unique<std::vector<uint8_t>>(DefaultStreamDigestReadSize);
-  auto* buffer = heapBuffer.get()->data();
+  // Streams holding their data in memory are hashed in place, the others are read into the
+  // scratch buffer.
+  std::vector<uint8_t> scratch;
+  uint8_t const* buffer = nullptr;
   auto hashAlgorithm = algorithm.GetHashAlgorithm();
-  for (size_t read = data.Read(buffer, DefaultStreamDigestReadSize); read > 0;
-       read = data.Read(buffer, DefaultStreamDigestReadSize))
+  for (size_t read = data.ReadSpan(buffer, DefaultStreamDigestReadSize, scratch); read > 0;
+       read = data.ReadSpan(buffer, DefaultStreamDigestReadSize, scratch))
   {
     hashAlgorithm->Append(buffer, read);
   }
@@ -49,6 +57,69 @@ inline std::vector<uint8_t> CreateDigest(
   auto hashAlgorithm = algorithm.GetHashAlgorithm();
   return hashAlgorithm->Final(data.data(), data.size());
 }
+
+// Runs an operation for each index, on up to concurrency threads, and returns the results in the
+// order of the indexes. The exception of the first failed operation is thrown once the running
+// operations are done.
+template <class T, class Operation>
+std::vector<T> RunConcurrently(size_t count, int32_t concurrency, Operation const& operation)
+{
+  std::vector<T> results(count);
+  std::atomic<size_t> nextIndex(0);
+  std::atomic<bool> failed(false);
+  auto const runOperations = [&]() {
+    for (size_t index = nextIndex++; index < count && !failed; index = nextIndex++)
+    {
+      try
+      {
+        results[index] = operation(index);
+      }
+      catch (...)
+      {
+        failed = true;
+        throw;
+      }
+    }
+  };
+
+  auto const numThreads
+      = std::min(count, static_cast<size_t>(std::max(concurrency, static_cast<int32_t>(1))));
+  std::vector<std::future<void>> threads;
+  // The calling thread runs operations too.
+  for (size_t i = 1; i < numThreads; ++i)
+  {
+    threads.push_back(std::async(std::launch::async, runOperations));
+  }
+
+  std::exception_ptr error;
+  try
+  {
+    runOperations();
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+  for (auto& thread : threads)
+  {
+    try
+    {
+      thread.get();
+    }
+    catch (...)
+    {
+      if (!error)
+      {
+        error = std::current_exception();
+      }
+    }
+  }
+  if (error)
+  {
+    std::rethrow_exception(error);
+  }
+  return results;
+}
 } // namespace
 
 void CryptographyClient::Initialize(std::string const&, Azure::Core::Context const& context)
@@ -60,8 +131,12 @@ void CryptographyClient::Initialize(std::string const&, Azure::Core::Context con
 
   try
   {
-    auto key = m_remoteProvider->GetKey(context).Value;
-    m_provider = LocalCryptographyProviderFactory::Create(key);
+    // The clients created for the same key share its local provider instead of each getting the
+    // key from Key Vault.
+    m_provider = KeyMaterialCache::GetProvider(
+        m_keyId, m_keyCacheDuration, [&]() -> std::shared_ptr<CryptographyProvider> {
+          return LocalCryptographyProviderFactory::Create(m_remoteProvider->GetKey(context).Value);
+        });
     if (m_provider == nullptr)
     {
       // KeyVaultKeyType is not supported locally. Use remote client.
@@ -90,6 +165,7 @@ CryptographyClient::CryptographyClient(
 {
   auto apiVersion = options.Version.ToString();
   m_keyId = keyId;
+  m_keyCacheDuration = options.KeyCacheDuration;
   m_remoteProvider = std::make_shared<RemoteCryptographyClient>(keyId, credential, options);
   m_pipeline = m_remoteProvider->Pipeline;
 
@@ -97,6 +173,12 @@ CryptographyClient::CryptographyClient(
   {
     m_provider = m_remoteProvider;
   }
+
+  if (options.UnwrappedKeyCacheDuration > std::chrono::milliseconds::zero())
+  {
+    m_unwrappedKeyCache = std::make_shared<UnwrappedKeyCache>(
+        options.UnwrappedKeyCacheDuration, options.UnwrappedKeyCacheSize);
+  }
 }
 
 EncryptResult CryptographyClient::Encrypt(
@@ -246,6 +328,10 @@ UnwrapResult CryptographyClient::UnwrapKey(
 
   // Default result has empty values.
   UnwrapResult result;
+  if (m_unwrappedKeyCache && m_unwrappedKeyCache->TryGet(algorithm, encryptedKey, result))
+  {
+    return result;
+  }
 
   // m_provider can be local or remote, depending on how it was init.
   if (m_provider->SupportsOperation(KeyOperation::UnwrapKey))
@@ -272,11 +358,51 @@ UnwrapResult CryptographyClient::UnwrapKey(
 
       result = m_remoteProvider->UnwrapKey(algorithm, encryptedKey, context);
     }
+
+    if (m_unwrappedKeyCache && !result.Key.empty())
+    {
+      m_unwrappedKeyCache->Add(algorithm, encryptedKey, result);
+    }
   }
 
   return result;
 }
 
+std::vector<WrapResult> CryptographyClient::WrapKeys(
+    KeyWrapAlgorithm algorithm,
+    std::vector<std::vector<uint8_t>> const& keys,
+    KeyWrapBatchOptions const& options,
+    Azure::Core::Context const& context)
+{
+  if (m_provider == nullptr && !keys.empty())
+  {
+    // Initialized before the keys are wrapped at the same time.
+    Initialize(KeyOperation::WrapKey.ToString(), context);
+  }
+
+  return RunConcurrently<WrapResult>(keys.size(), options.Concurrency, [&](size_t index) {
+    return WrapKey(algorithm, keys[index], context);
+  });
+}
+
+std::vector<UnwrapResult> CryptographyClient::UnwrapKeys(
+    KeyWrapAlgorithm algorithm,
+    std::vector<std::vector<uint8_t>> const& encryptedKeys,
+    KeyWrapBatchOptions const& options,
+    Azure::Core::Context const& context)
+{
+  if (m_provider == nullptr && !encryptedKeys.empty())
+  {
+    // Initialized before the keys are unwrapped at the same time.
+    Initialize(KeyOperation::UnwrapKey.ToString(), context);
+  }
+
+  return RunConcurrently<UnwrapResult>(
+      encryptedKeys.size(), options.Concurrency, [&](size_t index) {
+        return UnwrapKey(algorithm, encryptedKeys[index], context);
+      });
+}
+
 SignResult CryptographyClient::Sign(
     SignatureAlgorithm algorithm,
     std::vector<uint8_t> const& digest,
@@ -322,6 +448,58 @@ SignResult CryptographyClient::Sign(
   return result;
 }
 
+void CryptographyClient::SignAsync(
+    SignatureAlgorithm algorithm,
+    std::vector<uint8_t> const& digest,
+    Azure::Core::Context const& context,
+    Azure::Core::ResponseCallback<SignResult> callback)
+{
+  // Signs as Sign() does, except that Key Vault is called without waiting for the response.
+  SignResult result;
+  try
+  {
+    if (m_provider == nullptr)
+    {
+      Initialize(KeyOperation::Sign.ToString(), context);
+    }
+    if (!m_provider->SupportsOperation(KeyOperation::Sign))
+    {
+      callback(Azure::Response<SignResult>(std::move(result), nullptr), nullptr);
+      return;
+    }
+    if (m_provider != m_remoteProvider)
+    {
+      try
+      {
+        result = m_provider->Sign(algorithm, digest, context);
+      }
+      catch (std::exception const&)
+      {
+        if (!m_provider->CanRemote())
+        {
+          throw;
+        }
+      }
+    }
+    if (result.Signature.size() == 0)
+    {
+      AZURE_ASSERT_FALSE(LocalOnly());
+    }
+  }
+  catch (...)
+  {
+    callback(Azure::Nullable<Azure::Response<SignResult>>(), std::current_exception());
+    return;
+  }
+
+  if (result.Signature.size() != 0)
+  {
+    callback(Azure::Response<SignResult>(std::move(result), nullptr), nullptr);
+    return;
+  }
+  m_remoteProvider->SignWithResponseAsync(algorithm, digest, context, std::move(callback));
+}
+
 SignResult CryptographyClient::SignData(
     SignatureAlgorithm algorithm,
     Azure::Core::IO::BodyStream& data,
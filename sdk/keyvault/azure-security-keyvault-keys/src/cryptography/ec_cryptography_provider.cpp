@@ -0,0 +1,268 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/keyvault/keys/internal/cryptography/ec_cryptography_provider.hpp"
+
+#include "../private/der_encoding.hpp"
+
+#include <azure/core/platform.hpp>
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+#include <openssl/bn.h>
+#include <openssl/ecdsa.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+#endif
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace Azure {
+  namespace Security {
+    namespace KeyVault {
+      namespace Keys {
+        namespace Cryptography {
+  namespace _detail {
+
+#if defined(AZ_PLATFORM_WINDOWS)
+    // The signatures are verified by the remote client.
+    struct EcCryptographyProvider::PublicKey final
+    {
+    };
+#else
+    struct EcCryptographyProvider::PublicKey final
+    {
+      EVP_PKEY* Key;
+
+      explicit PublicKey(EVP_PKEY* key) : Key(key) {}
+      PublicKey(PublicKey const&) = delete;
+      PublicKey& operator=(PublicKey const&) = delete;
+      ~PublicKey() { EVP_PKEY_free(Key); }
+    };
+#endif
+
+    namespace {
+      struct CurveInfo final
+      {
+        size_t CoordinateSize;
+        // The DER encoding of the object identifier of the curve.
+        std::vector<uint8_t> Oid;
+        SignatureAlgorithm Algorithm;
+        size_t DigestSize;
+      };
+
+      bool GetCurveInfo(Azure::Nullable<KeyCurveName> const& curveName, CurveInfo& curveInfo)
+      {
+        if (!curveName.HasValue())
+        {
+          return false;
+        }
+        if (curveName.Value() == KeyCurveName::P256)
+        {
+          curveInfo = {
+              32,
+              {0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x03, 0x01, 0x07},
+              SignatureAlgorithm::ES256,
+              32};
+        }
+        else if (curveName.Value() == KeyCurveName::P256K)
+        {
+          curveInfo
+              = {32, {0x06, 0x05, 0x2b, 0x81, 0x04, 0x00, 0x0a}, SignatureAlgorithm::ES256K, 32};
+        }
+        else if (curveName.Value() == KeyCurveName::P384)
+        {
+          curveInfo
+              = {48, {0x06, 0x05, 0x2b, 0x81, 0x04, 0x00, 0x22}, SignatureAlgorithm::ES384, 48};
+        }
+        else if (curveName.Value() == KeyCurveName::P521)
+        {
+          curveInfo
+              = {66, {0x06, 0x05, 0x2b, 0x81, 0x04, 0x00, 0x23}, SignatureAlgorithm::ES512, 64};
+        }
+        else
+        {
+          return false;
+        }
+        return true;
+      }
+
+      // Left-pads a coordinate the service may return without its leading zeros.
+      bool AppendCoordinate(
+          std::vector<uint8_t>& point,
+          std::vector<uint8_t> const& coordinate,
+          size_t coordinateSize)
+      {
+        if (coordinate.empty() || coordinate.size() > coordinateSize)
+        {
+          return false;
+        }
+        point.insert(point.end(), coordinateSize - coordinate.size(), 0);
+        point.insert(point.end(), coordinate.begin(), coordinate.end());
+        return true;
+      }
+    } // namespace
+
+    EcCryptographyProvider::EcCryptographyProvider(
+        Azure::Security::KeyVault::Keys::JsonWebKey const& keyMaterial,
+        Azure::Security::KeyVault::Keys::KeyProperties const& keyProperties,
+        bool localOnly)
+        : LocalCryptographyProvider(keyMaterial, keyProperties, localOnly)
+    {
+#if !defined(AZ_PLATFORM_WINDOWS)
+      CurveInfo curveInfo;
+      if (!GetCurveInfo(m_keyMaterial.CurveName, curveInfo))
+      {
+        return;
+      }
+
+      // The uncompressed point, in a SubjectPublicKeyInfo the key is imported from.
+      std::vector<uint8_t> point{0x00, 0x04};
+      if (!AppendCoordinate(point, m_keyMaterial.X, curveInfo.CoordinateSize)
+          || !AppendCoordinate(point, m_keyMaterial.Y, curveInfo.CoordinateSize))
+      {
+        return;
+      }
+      std::vector<uint8_t> algorithmIdentifier;
+      // id-ecPublicKey
+      AppendDerElement(algorithmIdentifier, 0x06, {0x2a, 0x86, 0x48, 0xce, 0x3d, 0x02, 0x01});
+      algorithmIdentifier.insert(
+          algorithmIdentifier.end(), curveInfo.Oid.begin(), curveInfo.Oid.end());
+      std::vector<uint8_t> publicKeyInfo;
+      AppendDerElement(publicKeyInfo, 0x30, algorithmIdentifier);
+      AppendDerElement(publicKeyInfo, 0x03, point);
+      std::vector<uint8_t> der;
+      AppendDerElement(der, 0x30, publicKeyInfo);
+
+      auto derData = static_cast<uint8_t const*>(der.data());
+      auto key = d2i_PUBKEY(nullptr, &derData, static_cast<long>(der.size()));
+      if (key == nullptr)
+      {
+        ERR_clear_error();
+        return;
+      }
+      m_publicKey = std::make_shared<PublicKey const>(key);
+      m_coordinateSize = curveInfo.CoordinateSize;
+#endif
+    }
+
+    EncryptResult EcCryptographyProvider::Encrypt(
+        EncryptParameters const& parameters,
+        Azure::Core::Context const&) const
+    {
+      EncryptResult result;
+      result.Algorithm = parameters.Algorithm;
+      return result;
+    }
+
+    DecryptResult EcCryptographyProvider::Decrypt(
+        DecryptParameters const& parameters,
+        Azure::Core::Context const&) const
+    {
+      DecryptResult result;
+      result.Algorithm = parameters.Algorithm;
+      return result;
+    }
+
+    WrapResult EcCryptographyProvider::WrapKey(
+        KeyWrapAlgorithm const& algorithm,
+        std::vector<uint8_t> const&,
+        Azure::Core::Context const&) const
+    {
+      WrapResult result;
+      result.Algorithm = algorithm;
+      return result;
+    }
+
+    UnwrapResult EcCryptographyProvider::UnwrapKey(
+        KeyWrapAlgorithm const& algorithm,
+        std::vector<uint8_t> const&,
+        Azure::Core::Context const&) const
+    {
+      UnwrapResult result;
+      result.Algorithm = algorithm;
+      return result;
+    }
+
+    SignResult EcCryptographyProvider::Sign(
+        SignatureAlgorithm const& algorithm,
+        std::vector<uint8_t> const&,
+        Azure::Core::Context const&) const
+    {
+      // Key Vault doesn't return the private key, signatures are made by the remote client.
+      SignResult result;
+      result.Algorithm = algorithm;
+      return result;
+    }
+
+    VerifyResult EcCryptographyProvider::Verify(
+        SignatureAlgorithm const& algorithm,
+        std::vector<uint8_t> const& digest,
+        std::vector<uint8_t> const& signature,
+        Azure::Core::Context const&) const
+    {
+      // Without a key id, the signature is verified by the remote client.
+      VerifyResult result{};
+      result.Algorithm = algorithm;
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+      CurveInfo curveInfo;
+      if (!m_publicKey || !GetCurveInfo(m_keyMaterial.CurveName, curveInfo)
+          || !(algorithm == curveInfo.Algorithm) || digest.size() != curveInfo.DigestSize)
+      {
+        return result;
+      }
+
+      result.KeyId = m_keyMaterial.Id;
+      if (signature.size() != 2 * m_coordinateSize)
+      {
+        result.IsValid = false;
+        return result;
+      }
+
+      // The signature is the concatenation of R and S, OpenSSL verifies their DER encoding.
+      std::unique_ptr<ECDSA_SIG, decltype(&ECDSA_SIG_free)> ecdsaSignature(
+          ECDSA_SIG_new(), ECDSA_SIG_free);
+      auto r = BN_bin2bn(signature.data(), static_cast<int>(m_coordinateSize), nullptr);
+      auto s = BN_bin2bn(
+          signature.data() + m_coordinateSize, static_cast<int>(m_coordinateSize), nullptr);
+      if (!ecdsaSignature || r == nullptr || s == nullptr
+          || ECDSA_SIG_set0(ecdsaSignature.get(), r, s) != 1)
+      {
+        BN_free(r);
+        BN_free(s);
+        throw std::runtime_error("Failed to decode the signature.");
+      }
+      auto const derSize = i2d_ECDSA_SIG(ecdsaSignature.get(), nullptr);
+      if (derSize <= 0)
+      {
+        throw std::runtime_error("Failed to encode the signature.");
+      }
+      std::vector<uint8_t> der(static_cast<size_t>(derSize));
+      auto derData = der.data();
+      i2d_ECDSA_SIG(ecdsaSignature.get(), &derData);
+
+      std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> context(
+          EVP_PKEY_CTX_new(m_publicKey->Key, nullptr), EVP_PKEY_CTX_free);
+      if (!context || EVP_PKEY_verify_init(context.get()) != 1)
+      {
+        throw std::runtime_error("Failed to initialize the signature verification.");
+      }
+      auto const verified
+          = EVP_PKEY_verify(context.get(), der.data(), der.size(), digest.data(), digest.size());
+      ERR_clear_error();
+      if (verified < 0)
+      {
+        throw std::runtime_error("Failed to verify the signature.");
+      }
+      result.IsValid = verified == 1;
+#else
+      (void)digest;
+      (void)signature;
+#endif
+      return result;
+    }
+
+}}}}}} // namespace Azure::Security::KeyVault::Keys::Cryptography::_detail
@@ -2,9 +2,10 @@
 // SPDX-License-Identifier: MIT
 
 #include <azure/core/base64.hpp>
-#include <azure/core/internal/json/json.hpp>
+#include <azure/core/internal/json/json_reader.hpp>
 
 #include "../private/cryptography_serializers.hpp"
+#include "../private/json_reader_helpers.hpp"
 #include "../private/key_constants.hpp"
 #include "azure/keyvault/keys/cryptography/encrypt_result.hpp"
 
@@ -24,31 +25,35 @@ namespace Azure {
   EncryptResult _detail::EncryptResultSerializer::EncryptResultDeserialize(
       Azure::Core::Http::RawResponse const& rawResponse)
   {
-    auto const& body = rawResponse.GetBody();
-    auto jsonParser = json::parse(body);
-
     EncryptResult result;
-    result.KeyId = jsonParser[KeyIdPropertyName].get<std::string>();
-    result.Ciphertext
-        = Base64Url::Base64UrlDecode(jsonParser[ValueParameterValue].get<std::string>());
-
-    if (jsonParser.contains(IvValue) && !jsonParser[IvValue].is_null())
-    {
-      result.Iv = Base64Url::Base64UrlDecode(jsonParser[IvValue].get<std::string>());
-    }
-
-    if (jsonParser.contains(AdditionalAuthenticatedValue)
-        && !jsonParser[AdditionalAuthenticatedValue].is_null())
-    {
-      result.AdditionalAuthenticatedData
-          = Base64Url::Base64UrlDecode(jsonParser[AdditionalAuthenticatedValue].get<std::string>());
-    }
-
-    if (jsonParser.contains(AuthenticationTagValue)
-        && !jsonParser[AuthenticationTagValue].is_null())
+    JsonReader reader(rawResponse.GetBody());
+    ReadStartObject(reader);
+    while (reader.ReadNextProperty())
     {
-      result.AuthenticationTag
-          = Base64Url::Base64UrlDecode(jsonParser[AuthenticationTagValue].get<std::string>());
+      if (reader.ValueEquals(KeyIdPropertyName))
+      {
+        result.KeyId = ReadStringValue(reader);
+      }
+      else if (reader.ValueEquals(ValueParameterValue))
+      {
+        result.Ciphertext = ReadBase64UrlValue(reader);
+      }
+      else if (reader.ValueEquals(IvValue))
+      {
+        result.Iv = ReadBase64UrlValue(reader);
+      }
+      else if (reader.ValueEquals(AdditionalAuthenticatedValue))
+      {
+        result.AdditionalAuthenticatedData = ReadBase64UrlValue(reader);
+      }
+      else if (reader.ValueEquals(AuthenticationTagValue))
+      {
+        result.AuthenticationTag = ReadBase64UrlValue(reader);
+      }
+      else
+      {
+        reader.Skip();
+      }
     }
 
     return result;
@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "../private/key_material_cache.hpp"
+
+#include <map>
+#include <mutex>
+
+using Azure::Security::KeyVault::Keys::Cryptography::_detail::CryptographyProvider;
+using Azure::Security::KeyVault::Keys::Cryptography::_detail::KeyMaterialCache;
+
+namespace {
+struct CacheEntry final
+{
+  // Held while creating the provider.
+  std::mutex Mutex;
+  bool IsCreated = false;
+  std::chrono::steady_clock::time_point CreatedOn;
+  std::shared_ptr<CryptographyProvider> Provider;
+};
+
+std::mutex g_cacheMutex;
+std::map<std::string, std::shared_ptr<CacheEntry>> g_cache;
+} // namespace
+
+std::shared_ptr<CryptographyProvider> KeyMaterialCache::GetProvider(
+    std::string const& keyId,
+    std::chrono::milliseconds duration,
+    std::function<std::shared_ptr<CryptographyProvider>()> const& createProvider)
+{
+  if (duration <= std::chrono::milliseconds::zero())
+  {
+    return createProvider();
+  }
+
+  std::shared_ptr<CacheEntry> entry;
+  {
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+    auto& cachedEntry = g_cache[keyId];
+    if (!cachedEntry)
+    {
+      cachedEntry = std::make_shared<CacheEntry>();
+    }
+    entry = cachedEntry;
+  }
+
+  std::lock_guard<std::mutex> lock(entry->Mutex);
+  auto const now = std::chrono::steady_clock::now();
+  if (!entry->IsCreated || now - entry->CreatedOn >= duration)
+  {
+    entry->Provider = createProvider();
+    entry->CreatedOn = now;
+    entry->IsCreated = true;
+  }
+
+  return entry->Provider;
+}
+
+void KeyMaterialCache::Clear()
+{
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+  g_cache.clear();
+}
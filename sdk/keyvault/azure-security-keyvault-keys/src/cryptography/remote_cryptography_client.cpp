@@ -7,6 +7,7 @@
 
 #include "../private/cryptography_serializers.hpp"
 #include "../private/key_constants.hpp"
+#include "../private/key_rate_limit_policy.hpp"
 #include "../private/key_serializers.hpp"
 #include "../private/key_sign_parameters.hpp"
 #include "../private/key_verify_parameters.hpp"
@@ -33,6 +34,12 @@ RemoteCryptographyClient::RemoteCryptographyClient(
   // Remote client is init with the URL to a key vault key.
   KeyId = Azure::Core::Url(keyId);
   std::vector<std::unique_ptr<HttpPolicy>> perRetrypolicies;
+  // Held up before getting a token, so that the token isn't stale when the request is sent.
+  if (auto rateLimitPolicy
+      = Azure::Security::KeyVault::Keys::_detail::CreateRateLimitPolicy(options.RateLimits))
+  {
+    perRetrypolicies.emplace_back(std::move(rateLimitPolicy));
+  }
   {
     Azure::Core::Credentials::TokenRequestContext const tokenContext
         = {{"https://vault.azure.net/.default"}};
@@ -189,6 +196,28 @@ Azure::Response<SignResult> RemoteCryptographyClient::SignWithResponse(
       {"sign"});
 }
 
+void RemoteCryptographyClient::SignWithResponseAsync(
+    SignatureAlgorithm const& algorithm,
+    std::vector<uint8_t> const& digest,
+    Azure::Core::Context const& context,
+    Azure::Core::ResponseCallback<SignResult> callback) const
+{
+  Pipeline->SendRequestAsync<SignResult>(
+      context,
+      Azure::Core::Http::HttpMethod::Post,
+      [&algorithm, &digest]() {
+        return KeySignParametersSerializer::KeySignParametersSerialize(
+            KeySignParameters(algorithm.ToString(), digest));
+      },
+      [algorithm](Azure::Core::Http::RawResponse const& rawResponse) {
+        auto result = SignResultSerializer::SignResultDeserialize(rawResponse);
+        result.Algorithm = algorithm;
+        return result;
+      },
+      {"sign"},
+      std::move(callback));
+}
+
 SignResult RemoteCryptographyClient::Sign(
     SignatureAlgorithm const& algorithm,
     std::vector<uint8_t> const& digest,
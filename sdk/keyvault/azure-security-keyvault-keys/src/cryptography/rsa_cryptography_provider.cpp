@@ -3,7 +3,20 @@
 
 #include "azure/keyvault/keys/internal/cryptography/rsa_cryptography_provider.hpp"
 
+#include "../private/der_encoding.hpp"
+
+#include <azure/core/platform.hpp>
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/rsa.h>
+#include <openssl/x509.h>
+#endif
+
+#include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
 
 namespace Azure {
@@ -13,12 +26,211 @@ namespace Azure {
         namespace Cryptography {
   namespace _detail {
 
+#if defined(AZ_PLATFORM_WINDOWS)
+    // The operations are done by the remote client.
+    struct RsaCryptographyProvider::PublicKey final
+    {
+    };
+#else
+    namespace {
+      using ContextPointer = std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)>;
+
+      struct PreparedContext final
+      {
+        EVP_PKEY_CTX* Context;
+        // The size of the digests verified with the context.
+        size_t DigestSize;
+      };
+
+      // Null if the algorithm isn't available in OpenSSL.
+      ContextPointer CreateEncryptContext(EVP_PKEY* key, int padding, EVP_MD const* oaepDigest)
+      {
+        ContextPointer context(EVP_PKEY_CTX_new(key, nullptr), EVP_PKEY_CTX_free);
+        if (!context || EVP_PKEY_encrypt_init(context.get()) != 1
+            || EVP_PKEY_CTX_set_rsa_padding(context.get(), padding) <= 0
+            || (oaepDigest != nullptr
+                && (EVP_PKEY_CTX_set_rsa_oaep_md(context.get(), oaepDigest) <= 0
+                    || EVP_PKEY_CTX_set_rsa_mgf1_md(context.get(), oaepDigest) <= 0)))
+        {
+          ERR_clear_error();
+          context.reset();
+        }
+        return context;
+      }
+
+      // Null if the algorithm isn't available in OpenSSL.
+      ContextPointer CreateVerifyContext(EVP_PKEY* key, int padding, EVP_MD const* digest)
+      {
+        ContextPointer context(EVP_PKEY_CTX_new(key, nullptr), EVP_PKEY_CTX_free);
+        if (!context || EVP_PKEY_verify_init(context.get()) != 1
+            || EVP_PKEY_CTX_set_rsa_padding(context.get(), padding) <= 0
+            || EVP_PKEY_CTX_set_signature_md(context.get(), digest) <= 0
+            || (padding == RSA_PKCS1_PSS_PADDING
+                && EVP_PKEY_CTX_set_rsa_pss_saltlen(context.get(), RSA_PSS_SALTLEN_DIGEST) <= 0))
+        {
+          ERR_clear_error();
+          context.reset();
+        }
+        return context;
+      }
+
+      // Duplicates the context prepared for an algorithm, null if there's none.
+      ContextPointer DuplicateContext(
+          std::map<std::string, PreparedContext> const& contexts,
+          std::string const& algorithm)
+      {
+        auto const prepared = contexts.find(algorithm);
+        if (prepared == contexts.end())
+        {
+          return ContextPointer(nullptr, EVP_PKEY_CTX_free);
+        }
+        ContextPointer context(EVP_PKEY_CTX_dup(prepared->second.Context), EVP_PKEY_CTX_free);
+        if (!context)
+        {
+          throw std::runtime_error("Failed to duplicate the RSA context.");
+        }
+        return context;
+      }
+
+      // Encrypts with the public key, for both encryption and key wrapping.
+      std::vector<uint8_t> EncryptWithContext(
+          EVP_PKEY_CTX* context,
+          std::vector<uint8_t> const& plaintext)
+      {
+        size_t size = 0;
+        if (EVP_PKEY_encrypt(context, nullptr, &size, plaintext.data(), plaintext.size()) != 1)
+        {
+          ERR_clear_error();
+          throw std::runtime_error("Failed to encrypt with the RSA key.");
+        }
+        std::vector<uint8_t> ciphertext(size);
+        if (EVP_PKEY_encrypt(context, ciphertext.data(), &size, plaintext.data(), plaintext.size())
+            != 1)
+        {
+          ERR_clear_error();
+          throw std::runtime_error("Failed to encrypt with the RSA key.");
+        }
+        ciphertext.resize(size);
+        return ciphertext;
+      }
+    } // namespace
+
+    struct RsaCryptographyProvider::PublicKey final
+    {
+      EVP_PKEY* Key;
+      // The contexts prepared for each algorithm, keyed by the name of the algorithm. The key wrap
+      // algorithms share the contexts of the encryption algorithms with the same name.
+      std::map<std::string, PreparedContext> EncryptContexts;
+      std::map<std::string, PreparedContext> VerifyContexts;
+
+      explicit PublicKey(EVP_PKEY* key) : Key(key) {}
+      PublicKey(PublicKey const&) = delete;
+      PublicKey& operator=(PublicKey const&) = delete;
+
+      ~PublicKey()
+      {
+        for (auto const& context : EncryptContexts)
+        {
+          EVP_PKEY_CTX_free(context.second.Context);
+        }
+        for (auto const& context : VerifyContexts)
+        {
+          EVP_PKEY_CTX_free(context.second.Context);
+        }
+        EVP_PKEY_free(Key);
+      }
+    };
+#endif
+
+    RsaCryptographyProvider::RsaCryptographyProvider(
+        Azure::Security::KeyVault::Keys::JsonWebKey const& keyMaterial,
+        Azure::Security::KeyVault::Keys::KeyProperties const& keyProperties,
+        bool localOnly)
+        : LocalCryptographyProvider(keyMaterial, keyProperties, localOnly)
+    {
+#if !defined(AZ_PLATFORM_WINDOWS)
+      if (m_keyMaterial.N.empty() || m_keyMaterial.E.empty())
+      {
+        return;
+      }
+
+      // The RSAPublicKey, in a SubjectPublicKeyInfo the key is imported from.
+      std::vector<uint8_t> rsaPublicKeyContent;
+      AppendDerInteger(rsaPublicKeyContent, m_keyMaterial.N);
+      AppendDerInteger(rsaPublicKeyContent, m_keyMaterial.E);
+      std::vector<uint8_t> subjectPublicKey{0x00};
+      AppendDerElement(subjectPublicKey, 0x30, rsaPublicKeyContent);
+      std::vector<uint8_t> algorithmIdentifier;
+      // rsaEncryption, without parameters.
+      AppendDerElement(
+          algorithmIdentifier, 0x06, {0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01});
+      AppendDerElement(algorithmIdentifier, 0x05, {});
+      std::vector<uint8_t> publicKeyInfo;
+      AppendDerElement(publicKeyInfo, 0x30, algorithmIdentifier);
+      AppendDerElement(publicKeyInfo, 0x03, subjectPublicKey);
+      std::vector<uint8_t> der;
+      AppendDerElement(der, 0x30, publicKeyInfo);
+
+      auto derData = static_cast<uint8_t const*>(der.data());
+      auto key = d2i_PUBKEY(nullptr, &derData, static_cast<long>(der.size()));
+      if (key == nullptr)
+      {
+        ERR_clear_error();
+        return;
+      }
+      auto publicKey = std::make_shared<PublicKey>(key);
+
+      auto const addEncryptContext
+          = [&](EncryptionAlgorithm const& algorithm, int padding, EVP_MD const* oaepDigest) {
+              auto context = CreateEncryptContext(key, padding, oaepDigest);
+              if (context)
+              {
+                publicKey->EncryptContexts[algorithm.ToString()] = {context.release(), 0};
+              }
+            };
+      addEncryptContext(EncryptionAlgorithm::Rsa15, RSA_PKCS1_PADDING, nullptr);
+      addEncryptContext(EncryptionAlgorithm::RsaOaep, RSA_PKCS1_OAEP_PADDING, EVP_sha1());
+      addEncryptContext(EncryptionAlgorithm::RsaOaep256, RSA_PKCS1_OAEP_PADDING, EVP_sha256());
+
+      auto const addVerifyContext
+          = [&](SignatureAlgorithm const& algorithm, int padding, EVP_MD const* digest) {
+              auto context = CreateVerifyContext(key, padding, digest);
+              if (context)
+              {
+                publicKey->VerifyContexts[algorithm.ToString()]
+                    = {context.release(), static_cast<size_t>(EVP_MD_size(digest))};
+              }
+            };
+      addVerifyContext(SignatureAlgorithm::RS256, RSA_PKCS1_PADDING, EVP_sha256());
+      addVerifyContext(SignatureAlgorithm::RS384, RSA_PKCS1_PADDING, EVP_sha384());
+      addVerifyContext(SignatureAlgorithm::RS512, RSA_PKCS1_PADDING, EVP_sha512());
+      addVerifyContext(SignatureAlgorithm::PS256, RSA_PKCS1_PSS_PADDING, EVP_sha256());
+      addVerifyContext(SignatureAlgorithm::PS384, RSA_PKCS1_PSS_PADDING, EVP_sha384());
+      addVerifyContext(SignatureAlgorithm::PS512, RSA_PKCS1_PSS_PADDING, EVP_sha512());
+
+      m_publicKey = std::move(publicKey);
+#endif
+    }
+
     EncryptResult RsaCryptographyProvider::Encrypt(
         EncryptParameters const& parameters,
         Azure::Core::Context const&) const
     {
+      // Without a ciphertext, the plaintext is encrypted by the remote client.
       EncryptResult result;
       result.Algorithm = parameters.Algorithm;
+#if !defined(AZ_PLATFORM_WINDOWS)
+      if (m_publicKey)
+      {
+        auto const context
+            = DuplicateContext(m_publicKey->EncryptContexts, parameters.Algorithm.ToString());
+        if (context)
+        {
+          result.Ciphertext = EncryptWithContext(context.get(), parameters.Plaintext);
+          result.KeyId = m_keyMaterial.Id;
+        }
+      }
+#endif
       return result;
     }
 
@@ -36,9 +248,22 @@ namespace Azure {
         std::vector<uint8_t> const& key,
         Azure::Core::Context const&) const
     {
+      // Without an encrypted key, the key is wrapped by the remote client.
       WrapResult result;
-      (void)key;
       result.Algorithm = algorithm;
+#if !defined(AZ_PLATFORM_WINDOWS)
+      if (m_publicKey)
+      {
+        auto const context = DuplicateContext(m_publicKey->EncryptContexts, algorithm.ToString());
+        if (context)
+        {
+          result.EncryptedKey = EncryptWithContext(context.get(), key);
+          result.KeyId = m_keyMaterial.Id;
+        }
+      }
+#else
+      (void)key;
+#endif
       return result;
     }
 
@@ -70,10 +295,33 @@ namespace Azure {
         std::vector<uint8_t> const& signature,
         Azure::Core::Context const&) const
     {
-      VerifyResult result;
+      // Without a key id, the signature is verified by the remote client.
+      VerifyResult result{};
+      result.Algorithm = algorithm;
+#if !defined(AZ_PLATFORM_WINDOWS)
+      if (m_publicKey)
+      {
+        auto const prepared = m_publicKey->VerifyContexts.find(algorithm.ToString());
+        if (prepared != m_publicKey->VerifyContexts.end()
+            && prepared->second.DigestSize == digest.size())
+        {
+          auto const context = DuplicateContext(m_publicKey->VerifyContexts, algorithm.ToString());
+          // Malformed signatures fail like invalid ones.
+          result.IsValid = EVP_PKEY_verify(
+                               context.get(),
+                               signature.data(),
+                               signature.size(),
+                               digest.data(),
+                               digest.size())
+              == 1;
+          ERR_clear_error();
+          result.KeyId = m_keyMaterial.Id;
+        }
+      }
+#else
       (void)digest;
       (void)signature;
-      result.Algorithm = algorithm;
+#endif
       return result;
     }
 
@@ -2,9 +2,10 @@
 // SPDX-License-Identifier: MIT
 
 #include <azure/core/base64.hpp>
-#include <azure/core/internal/json/json.hpp>
+#include <azure/core/internal/json/json_reader.hpp>
 
 #include "../private/cryptography_serializers.hpp"
+#include "../private/json_reader_helpers.hpp"
 #include "../private/key_constants.hpp"
 #include "azure/keyvault/keys/cryptography/sign_result.hpp"
 
@@ -24,13 +25,24 @@ namespace Azure {
   SignResult _detail::SignResultSerializer::SignResultDeserialize(
       Azure::Core::Http::RawResponse const& rawResponse)
   {
-    auto const& body = rawResponse.GetBody();
-    auto jsonParser = json::parse(body);
-
     SignResult result;
-    result.KeyId = jsonParser[KeyIdPropertyName].get<std::string>();
-    result.Signature
-        = Base64Url::Base64UrlDecode(jsonParser[ValueParameterValue].get<std::string>());
+    JsonReader reader(rawResponse.GetBody());
+    ReadStartObject(reader);
+    while (reader.ReadNextProperty())
+    {
+      if (reader.ValueEquals(KeyIdPropertyName))
+      {
+        result.KeyId = ReadStringValue(reader);
+      }
+      else if (reader.ValueEquals(ValueParameterValue))
+      {
+        result.Signature = ReadBase64UrlValue(reader);
+      }
+      else
+      {
+        reader.Skip();
+      }
+    }
 
     return result;
   }
@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "../private/unwrapped_key_cache.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+using Azure::Security::KeyVault::Keys::Cryptography::KeyWrapAlgorithm;
+using Azure::Security::KeyVault::Keys::Cryptography::UnwrapResult;
+using Azure::Security::KeyVault::Keys::Cryptography::_detail::UnwrappedKeyCache;
+
+namespace {
+std::string CreateCacheKey(
+    KeyWrapAlgorithm const& algorithm,
+    std::vector<uint8_t> const& encryptedKey)
+{
+  std::string cacheKey = algorithm.ToString();
+  cacheKey += '\0';
+  cacheKey.append(encryptedKey.begin(), encryptedKey.end());
+  return cacheKey;
+}
+
+size_t GetEntrySize(std::string const& cacheKey, UnwrapResult const& result)
+{
+  return cacheKey.size() + result.Key.size();
+}
+} // namespace
+
+UnwrappedKeyCache::~UnwrappedKeyCache()
+{
+  for (auto& entry : m_entries)
+  {
+    std::fill(entry.Result.Key.begin(), entry.Result.Key.end(), static_cast<uint8_t>(0));
+  }
+}
+
+void UnwrappedKeyCache::Erase(std::list<CacheEntry>::iterator entry)
+{
+  m_size -= GetEntrySize(entry->CacheKey, entry->Result);
+  std::fill(entry->Result.Key.begin(), entry->Result.Key.end(), static_cast<uint8_t>(0));
+  m_index.erase(entry->CacheKey);
+  m_entries.erase(entry);
+}
+
+bool UnwrappedKeyCache::TryGet(
+    KeyWrapAlgorithm const& algorithm,
+    std::vector<uint8_t> const& encryptedKey,
+    UnwrapResult& result)
+{
+  auto const cacheKey = CreateCacheKey(algorithm, encryptedKey);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const indexEntry = m_index.find(cacheKey);
+  if (indexEntry == m_index.end())
+  {
+    return false;
+  }
+  auto const entry = indexEntry->second;
+  if (std::chrono::steady_clock::now() >= entry->ExpiresOn)
+  {
+    Erase(entry);
+    return false;
+  }
+
+  m_entries.splice(m_entries.begin(), m_entries, entry);
+  result = entry->Result;
+  return true;
+}
+
+void UnwrappedKeyCache::Add(
+    KeyWrapAlgorithm const& algorithm,
+    std::vector<uint8_t> const& encryptedKey,
+    UnwrapResult const& result)
+{
+  auto cacheKey = CreateCacheKey(algorithm, encryptedKey);
+  auto const entrySize = GetEntrySize(cacheKey, result);
+  if (entrySize > m_maxSize)
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const indexEntry = m_index.find(cacheKey);
+  if (indexEntry != m_index.end())
+  {
+    Erase(indexEntry->second);
+  }
+  while (m_size + entrySize > m_maxSize)
+  {
+    Erase(std::prev(m_entries.end()));
+  }
+
+  m_entries.push_front({cacheKey, result, std::chrono::steady_clock::now() + m_duration});
+  m_index.emplace(std::move(cacheKey), m_entries.begin());
+  m_size += entrySize;
+}
@@ -1,9 +1,10 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // SPDX-License-Identifier: MIT
 
-#include <azure/core/internal/json/json.hpp>
+#include <azure/core/internal/json/json_reader.hpp>
 
 #include "../private/cryptography_serializers.hpp"
+#include "../private/json_reader_helpers.hpp"
 #include "../private/key_constants.hpp"
 #include "azure/keyvault/keys/cryptography/verify_result.hpp"
 
@@ -22,11 +23,21 @@ namespace Azure {
   VerifyResult _detail::VerifyResultSerializer::VerifyResultDeserialize(
       Azure::Core::Http::RawResponse const& rawResponse)
   {
-    auto const& body = rawResponse.GetBody();
-    auto jsonParser = json::parse(body);
-
-    VerifyResult result;
-    result.IsValid = jsonParser[ValueParameterValue].get<bool>();
+    VerifyResult result{};
+    JsonReader reader(rawResponse.GetBody());
+    ReadStartObject(reader);
+    while (reader.ReadNextProperty())
+    {
+      if (reader.ValueEquals(ValueParameterValue))
+      {
+        reader.Read();
+        result.IsValid = reader.GetBool();
+      }
+      else
+      {
+        reader.Skip();
+      }
+    }
 
     return result;
   }
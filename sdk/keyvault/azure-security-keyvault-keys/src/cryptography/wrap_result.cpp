@@ -2,9 +2,10 @@
 // SPDX-License-Identifier: MIT
 
 #include <azure/core/base64.hpp>
-#include <azure/core/internal/json/json.hpp>
+#include <azure/core/internal/json/json_reader.hpp>
 
 #include "../private/cryptography_serializers.hpp"
+#include "../private/json_reader_helpers.hpp"
 #include "../private/key_constants.hpp"
 #include "azure/keyvault/keys/cryptography/wrap_result.hpp"
 
@@ -24,16 +25,23 @@ namespace Azure {
   WrapResult _detail::WrapResultSerializer::WrapResultDeserialize(
       Azure::Core::Http::RawResponse const& rawResponse)
   {
-    auto const& body = rawResponse.GetBody();
-    auto jsonParser = json::parse(body);
-
     WrapResult result;
-    result.KeyId = jsonParser[KeyIdPropertyName].get<std::string>();
-
-    if (jsonParser.contains(ValueParameterValue) && !jsonParser[ValueParameterValue].is_null())
+    JsonReader reader(rawResponse.GetBody());
+    ReadStartObject(reader);
+    while (reader.ReadNextProperty())
     {
-      result.EncryptedKey
-          = Base64Url::Base64UrlDecode(jsonParser[ValueParameterValue].get<std::string>());
+      if (reader.ValueEquals(KeyIdPropertyName))
+      {
+        result.KeyId = ReadStringValue(reader);
+      }
+      else if (reader.ValueEquals(ValueParameterValue))
+      {
+        result.EncryptedKey = ReadBase64UrlValue(reader);
+      }
+      else
+      {
+        reader.Skip();
+      }
     }
 
     return result;
@@ -3,13 +3,18 @@
 
 #include <azure/core/base64.hpp>
 #include <azure/core/internal/json/json_optional.hpp>
+#include <azure/core/internal/json/json_reader.hpp>
 
 #include "azure/keyvault/keys/json_web_key.hpp"
 #include "azure/keyvault/keys/key_curve_name.hpp"
+#include "private/json_reader_helpers.hpp"
 #include "private/key_constants.hpp"
 #include "private/key_serializers.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -49,7 +54,7 @@ static inline void WriteJsonIfVectorHasData(
       [](std::vector<uint8_t> const& value) { return value.size() > 0; },
       jsonKey,
       keyName,
-      Base64Url::Base64UrlEncode);
+      [](std::vector<uint8_t> const& value) { return Base64Url::Base64UrlEncode(value); });
 }
 } // namespace
 
@@ -125,3 +130,85 @@ void Azure::Security::KeyVault::Keys::_detail::JsonWebKeySerializer::JsonWebDese
     AssignBytesIfExists(jsonKey, _detail::YPropertyName, srcKey.Y);
   }
 }
+
+void Azure::Security::KeyVault::Keys::_detail::JsonWebKeySerializer::JsonWebDeserialize(
+    JsonWebKey& srcKey,
+    Azure::Core::Json::_internal::JsonReader& reader)
+{
+  struct BytesProperty final
+  {
+    char const* Name;
+    std::vector<uint8_t> JsonWebKey::*Bytes;
+  };
+  static BytesProperty const BytesProperties[] = {
+      {_detail::NPropertyName, &JsonWebKey::N},
+      {_detail::EPropertyName, &JsonWebKey::E},
+      {_detail::DPPropertyName, &JsonWebKey::DP},
+      {_detail::DQPropertyName, &JsonWebKey::DQ},
+      {_detail::QIPropertyName, &JsonWebKey::QI},
+      {_detail::PPropertyName, &JsonWebKey::P},
+      {_detail::QPropertyName, &JsonWebKey::Q},
+      {_detail::DPropertyName, &JsonWebKey::D},
+      {_detail::KPropertyName, &JsonWebKey::K},
+      {_detail::TPropertyName, &JsonWebKey::T},
+      {_detail::XPropertyName, &JsonWebKey::X},
+      {_detail::YPropertyName, &JsonWebKey::Y},
+  };
+
+  if (reader.GetTokenType() == JsonTokenType::Null)
+  {
+    return;
+  }
+  while (reader.ReadNextProperty())
+  {
+    if (reader.ValueEquals(_detail::KeyOpsPropertyName))
+    {
+      reader.Read();
+      if (reader.GetTokenType() == JsonTokenType::Null)
+      {
+        continue;
+      }
+      if (reader.GetTokenType() != JsonTokenType::StartArray)
+      {
+        throw std::runtime_error("Expected a JSON array of key operations.");
+      }
+      std::vector<KeyOperation> keyOperations;
+      while (reader.Read() && reader.GetTokenType() != JsonTokenType::EndArray)
+      {
+        keyOperations.emplace_back(KeyOperation(reader.GetString()));
+      }
+      srcKey.SetKeyOperations(keyOperations);
+    }
+    else if (reader.ValueEquals(_detail::KeyIdPropertyName))
+    {
+      srcKey.Id = ReadStringValue(reader);
+    }
+    else if (reader.ValueEquals(_detail::KeyTypePropertyName))
+    {
+      srcKey.KeyType = KeyVaultKeyType(ReadStringValue(reader));
+    }
+    else if (reader.ValueEquals(_detail::CurveNamePropertyName))
+    {
+      reader.Read();
+      if (reader.GetTokenType() != JsonTokenType::Null)
+      {
+        srcKey.CurveName = KeyCurveName(reader.GetString());
+      }
+    }
+    else
+    {
+      auto const bytesProperty = std::find_if(
+          std::begin(BytesProperties),
+          std::end(BytesProperties),
+          [&reader](BytesProperty const& property) { return reader.ValueEquals(property.Name); });
+      if (bytesProperty != std::end(BytesProperties))
+      {
+        srcKey.*(bytesProperty->Bytes) = ReadBase64UrlValue(reader);
+      }
+      else
+      {
+        reader.Skip();
+      }
+    }
+  }
+}
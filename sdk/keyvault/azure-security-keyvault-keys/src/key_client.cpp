@@ -2,17 +2,28 @@
 // SPDX-License-Identifier: MIT
 
 #include <azure/core/credentials/credentials.hpp>
+#include <azure/core/exception.hpp>
 #include <azure/core/http/http.hpp>
 #include <azure/core/http/policies/policy.hpp>
 
 #include "azure/keyvault/keys/key_client.hpp"
 #include "private/key_backup.hpp"
 #include "private/key_constants.hpp"
+#include "private/key_rate_limit_policy.hpp"
 #include "private/key_request_parameters.hpp"
 #include "private/key_serializers.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace Azure::Security::KeyVault::Keys;
@@ -119,6 +130,11 @@ KeyClient::KeyClient(
   auto apiVersion = options.Version.ToString();
 
   std::vector<std::unique_ptr<HttpPolicy>> perRetrypolicies;
+  // Held up before getting a token, so that the token isn't stale when the request is sent.
+  if (auto rateLimitPolicy = _detail::CreateRateLimitPolicy(options.RateLimits))
+  {
+    perRetrypolicies.emplace_back(std::move(rateLimitPolicy));
+  }
   {
     Azure::Core::Credentials::TokenRequestContext const tokenContext
         = {{"https://vault.azure.net/.default"}};
@@ -148,6 +164,23 @@ Azure::Response<KeyVaultKey> KeyClient::GetKey(
       {_detail::KeysPath, name, options.Version});
 }
 
+void KeyClient::GetKeyAsync(
+    std::string const& name,
+    GetKeyOptions const& options,
+    Azure::Core::Context const& context,
+    Azure::Core::ResponseCallback<KeyVaultKey> callback) const
+{
+  m_pipeline->SendRequestAsync<KeyVaultKey>(
+      context,
+      Azure::Core::Http::HttpMethod::Get,
+      nullptr,
+      [name](Azure::Core::Http::RawResponse const& rawResponse) {
+        return _detail::KeyVaultKeySerializer::KeyVaultKeyDeserialize(name, rawResponse);
+      },
+      {_detail::KeysPath, name, options.Version},
+      std::move(callback));
+}
+
 Azure::Response<KeyVaultKey> KeyClient::CreateKey(
     std::string const& name,
     KeyVaultKeyType keyType,
@@ -412,3 +445,279 @@ Azure::Response<KeyVaultKey> KeyClient::ImportKey(
       },
       {_detail::KeysPath, importKeyOptions.Name()});
 }
+
+namespace {
+// Pauses all the operations of a bulk backup or restore while Key Vault throttles them.
+class ThrottleGate final {
+public:
+  explicit ThrottleGate(BulkKeyBackupOptions const& options) : m_options(options) {}
+
+  // Runs an operation once the pause is over, and retries it after a pause when it's throttled.
+  template <class Operation>
+  void Run(Azure::Core::Context const& context, Operation const& operation)
+  {
+    for (int32_t attempt = 0;; ++attempt)
+    {
+      Wait(context);
+      try
+      {
+        operation();
+        return;
+      }
+      catch (Azure::Core::RequestFailedException const& e)
+      {
+        if (e.StatusCode != HttpStatusCode::TooManyRequests
+            || attempt >= m_options.MaxThrottledRetries)
+        {
+          throw;
+        }
+        Pause(GetRetryAfter(e, m_options.ThrottledDelay * (int64_t(1) << std::min(attempt, 16))));
+      }
+    }
+  }
+
+private:
+  static std::chrono::milliseconds GetRetryAfter(
+      Azure::Core::RequestFailedException const& e,
+      std::chrono::milliseconds defaultDelay)
+  {
+    if (e.RawResponse)
+    {
+      auto const& headers = e.RawResponse->GetHeaders();
+      auto const header = headers.find("retry-after");
+      if (header != headers.end())
+      {
+        try
+        {
+          return std::chrono::seconds(std::stoi(header->second));
+        }
+        catch (std::exception const&)
+        {
+          // Not a number of seconds, such as an HTTP date.
+        }
+      }
+    }
+    return defaultDelay;
+  }
+
+  void Pause(std::chrono::milliseconds delay)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pausedUntil = std::max(m_pausedUntil, std::chrono::steady_clock::now() + delay);
+  }
+
+  void Wait(Azure::Core::Context const& context)
+  {
+    while (true)
+    {
+      context.ThrowIfCancelled();
+      std::chrono::steady_clock::time_point pausedUntil;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        pausedUntil = m_pausedUntil;
+      }
+      auto const now = std::chrono::steady_clock::now();
+      if (now >= pausedUntil)
+      {
+        return;
+      }
+      // Wakes up regularly to notice the cancellation.
+      std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+          pausedUntil - now, std::chrono::seconds(1)));
+    }
+  }
+
+  BulkKeyBackupOptions const& m_options;
+  std::mutex m_mutex;
+  std::chrono::steady_clock::time_point m_pausedUntil;
+};
+
+// Runs a worker on concurrency threads, and throws the first exception escaping a worker once
+// they're all done.
+template <class Worker> void RunWorkers(int32_t concurrency, Worker const& worker)
+{
+  std::vector<std::future<void>> threads;
+  for (int32_t i = 0; i < concurrency; ++i)
+  {
+    threads.push_back(std::async(std::launch::async, worker));
+  }
+  std::exception_ptr error;
+  for (auto& thread : threads)
+  {
+    try
+    {
+      thread.get();
+    }
+    catch (...)
+    {
+      if (!error)
+      {
+        error = std::current_exception();
+      }
+    }
+  }
+  if (error)
+  {
+    std::rethrow_exception(error);
+  }
+}
+} // namespace
+
+BulkKeyBackupResult KeyClient::BackupKeys(
+    KeyBackupSink const& sink,
+    BulkKeyBackupOptions const& options,
+    Azure::Core::Context const& context) const
+{
+  if (options.Concurrency <= 0)
+  {
+    throw std::invalid_argument("Concurrency must be positive.");
+  }
+  BulkKeyBackupResult result;
+  ThrottleGate throttleGate(options);
+  std::mutex sinkMutex;
+
+  // Guards the variables below.
+  std::mutex mutex;
+  std::condition_variable namesChanged;
+  std::deque<std::string> names;
+  bool listed = false;
+
+  auto backupKeys = [&]() {
+    while (true)
+    {
+      std::string name;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        namesChanged.wait(lock, [&]() { return !names.empty() || listed; });
+        if (names.empty())
+        {
+          return;
+        }
+        name = std::move(names.front());
+        names.pop_front();
+      }
+      context.ThrowIfCancelled();
+      try
+      {
+        std::vector<uint8_t> backup;
+        throttleGate.Run(context, [&]() { backup = BackupKey(name, context).Value; });
+        {
+          std::lock_guard<std::mutex> lock(sinkMutex);
+          sink(name, backup);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        ++result.SucceededCount;
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        result.Failures.push_back({name, std::current_exception()});
+      }
+    }
+  };
+  auto workers = std::async(std::launch::async, [&]() {
+    RunWorkers(options.Concurrency, backupKeys);
+  });
+
+  // The next pages are listed while the keys already listed are backed up.
+  std::exception_ptr listingError;
+  try
+  {
+    GetPropertiesOfKeysOptions listOptions;
+    while (true)
+    {
+      KeyPropertiesPageResult page;
+      throttleGate.Run(context, [&]() { page = GetPropertiesOfKeys(listOptions, context); });
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto const& keyProperties : page.Items)
+        {
+          if (!keyProperties.Managed)
+          {
+            names.push_back(keyProperties.Name);
+          }
+        }
+      }
+      namesChanged.notify_all();
+      if (!page.NextPageToken.HasValue() || page.NextPageToken.Value().empty())
+      {
+        break;
+      }
+      listOptions.NextPageToken = page.NextPageToken;
+    }
+  }
+  catch (...)
+  {
+    listingError = std::current_exception();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    listed = true;
+  }
+  namesChanged.notify_all();
+  workers.get();
+  if (listingError)
+  {
+    std::rethrow_exception(listingError);
+  }
+  return result;
+}
+
+BulkKeyBackupResult KeyClient::RestoreKeyBackups(
+    KeyBackupSource const& source,
+    BulkKeyBackupOptions const& options,
+    Azure::Core::Context const& context) const
+{
+  if (options.Concurrency <= 0)
+  {
+    throw std::invalid_argument("Concurrency must be positive.");
+  }
+  BulkKeyBackupResult result;
+  ThrottleGate throttleGate(options);
+
+  // Guards the variables below.
+  std::mutex mutex;
+  bool exhausted = false;
+
+  auto restoreKeys = [&]() {
+    while (true)
+    {
+      std::string name;
+      std::vector<uint8_t> backup;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (exhausted)
+        {
+          return;
+        }
+        try
+        {
+          exhausted = !source(name, backup);
+        }
+        catch (...)
+        {
+          exhausted = true;
+          throw;
+        }
+        if (exhausted)
+        {
+          return;
+        }
+      }
+      context.ThrowIfCancelled();
+      try
+      {
+        throttleGate.Run(context, [&]() { RestoreKeyBackup(backup, context); });
+        std::lock_guard<std::mutex> lock(mutex);
+        ++result.SucceededCount;
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        result.Failures.push_back({name, std::current_exception()});
+      }
+    }
+  };
+  RunWorkers(options.Concurrency, restoreKeys);
+  return result;
+}
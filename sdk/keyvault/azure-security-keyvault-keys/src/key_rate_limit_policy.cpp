@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "private/key_rate_limit_policy.hpp"
+
+#include <azure/core/internal/strings.hpp>
+#include <azure/keyvault/common/internal/keyvault_pipeline.hpp>
+
+#include <map>
+#include <string>
+
+using namespace Azure::Security::KeyVault;
+
+namespace {
+constexpr static const char CryptographyOperations[] = "cryptography";
+constexpr static const char CreateKeyOperations[] = "createkey";
+constexpr static const char OtherOperations[] = "other";
+
+std::string ClassifyOperation(Azure::Core::Http::Request const& request)
+{
+  auto const& path = request.GetUrl().GetPath();
+  auto const lastSeparator = path.find_last_of('/');
+  auto const operation = Azure::Core::_internal::StringExtensions::ToLower(
+      lastSeparator == std::string::npos ? path : path.substr(lastSeparator + 1));
+
+  if (operation == "encrypt" || operation == "decrypt" || operation == "wrapkey"
+      || operation == "unwrapkey" || operation == "sign" || operation == "verify")
+  {
+    return CryptographyOperations;
+  }
+  if (operation == "create")
+  {
+    return CreateKeyOperations;
+  }
+  return OtherOperations;
+}
+
+_internal::KeyVaultRequestBudget MakeBudget(int32_t requests, std::chrono::milliseconds interval)
+{
+  _internal::KeyVaultRequestBudget budget;
+  budget.Requests = requests;
+  budget.Interval = interval;
+  return budget;
+}
+} // namespace
+
+std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>
+Azure::Security::KeyVault::Keys::_detail::CreateRateLimitPolicy(KeyRateLimitOptions const& options)
+{
+  if (options.CryptographyRequests <= 0 && options.CreateKeyRequests <= 0
+      && options.OtherRequests <= 0)
+  {
+    return nullptr;
+  }
+  std::map<std::string, _internal::KeyVaultRequestBudget> budgets;
+  budgets[CryptographyOperations] = MakeBudget(options.CryptographyRequests, options.Interval);
+  budgets[CreateKeyOperations] = MakeBudget(options.CreateKeyRequests, options.Interval);
+  budgets[OtherOperations] = MakeBudget(options.OtherRequests, options.Interval);
+  return std::make_unique<_internal::KeyVaultRateLimitPolicy>(
+      ClassifyOperation, std::move(budgets));
+}
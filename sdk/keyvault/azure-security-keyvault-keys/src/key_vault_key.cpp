@@ -3,10 +3,12 @@
 
 #include <azure/core/internal/json/json.hpp>
 #include <azure/core/internal/json/json_optional.hpp>
+#include <azure/core/internal/json/json_reader.hpp>
 #include <azure/core/internal/json/json_serializable.hpp>
 #include <azure/core/url.hpp>
 
 #include "azure/keyvault/keys/key_vault_key.hpp"
+#include "private/json_reader_helpers.hpp"
 #include "private/key_constants.hpp"
 #include "private/key_serializers.hpp"
 
@@ -35,9 +37,97 @@ void _detail::KeyVaultKeySerializer::KeyVaultKeyDeserialize(
     KeyVaultKey& key,
     Azure::Core::Http::RawResponse const& rawResponse)
 {
-  auto const& body = rawResponse.GetBody();
-  auto jsonParser = json::parse(body);
-  _detail::KeyVaultKeySerializer::KeyVaultKeyDeserialize(key, jsonParser);
+  JsonReader reader(rawResponse.GetBody());
+  _detail::ReadStartObject(reader);
+  _detail::KeyVaultKeySerializer::KeyVaultKeyDeserialize(key, reader);
+}
+
+void _detail::KeyVaultKeySerializer::KeyVaultKeyDeserialize(KeyVaultKey& key, JsonReader& reader)
+{
+  // Reads a nullable date, in POSIX time.
+  auto const readDateTime = [&reader](Azure::Nullable<Azure::DateTime>& destination) {
+    reader.Read();
+    if (reader.GetTokenType() != JsonTokenType::Null)
+    {
+      destination = PosixTimeConverter::PosixTimeToDateTime(reader.GetInt64());
+    }
+  };
+
+  while (reader.ReadNextProperty())
+  {
+    if (reader.ValueEquals(_detail::KeyPropertyName))
+    {
+      reader.Read();
+      _detail::JsonWebKeySerializer::JsonWebDeserialize(key.Key, reader);
+    }
+    else if (reader.ValueEquals(_detail::AttributesPropertyName))
+    {
+      reader.Read();
+      if (reader.GetTokenType() == JsonTokenType::Null)
+      {
+        continue;
+      }
+      while (reader.ReadNextProperty())
+      {
+        if (reader.ValueEquals(_detail::EnabledPropertyName))
+        {
+          reader.Read();
+          if (reader.GetTokenType() != JsonTokenType::Null)
+          {
+            key.Properties.Enabled = reader.GetBool();
+          }
+        }
+        else if (reader.ValueEquals(_detail::NbfPropertyName))
+        {
+          readDateTime(key.Properties.NotBefore);
+        }
+        else if (reader.ValueEquals(_detail::ExpPropertyName))
+        {
+          readDateTime(key.Properties.ExpiresOn);
+        }
+        else if (reader.ValueEquals(_detail::CreatedPropertyName))
+        {
+          readDateTime(key.Properties.CreatedOn);
+        }
+        else if (reader.ValueEquals(_detail::UpdatedPropertyName))
+        {
+          readDateTime(key.Properties.UpdatedOn);
+        }
+        else
+        {
+          reader.Skip();
+        }
+      }
+    }
+    else if (reader.ValueEquals(_detail::TagsPropertyName))
+    {
+      reader.Read();
+      if (reader.GetTokenType() == JsonTokenType::Null)
+      {
+        continue;
+      }
+      while (reader.ReadNextProperty())
+      {
+        auto tagName = reader.GetString();
+        key.Properties.Tags.emplace(std::move(tagName), _detail::ReadStringValue(reader));
+      }
+    }
+    else if (reader.ValueEquals(_detail::ManagedPropertyName))
+    {
+      reader.Read();
+      if (reader.GetTokenType() != JsonTokenType::Null)
+      {
+        key.Properties.Managed = reader.GetBool();
+      }
+    }
+    else
+    {
+      reader.Skip();
+    }
+  }
+
+  // Parse URL for the vaultUri, keyVersion
+  _detail::KeyVaultKeySerializer::ParseKeyUrl(key.Properties, key.Key.Id);
 }
 
 void _detail::KeyVaultKeySerializer::KeyVaultKeyDeserialize(
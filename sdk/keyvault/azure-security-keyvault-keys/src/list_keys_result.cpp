@@ -3,129 +3,197 @@
 
 #include "azure/keyvault/keys/list_keys_result.hpp"
 #include "azure/keyvault/keys/key_client.hpp"
+#include "private/json_reader_helpers.hpp"
 #include "private/key_constants.hpp"
 #include "private/key_serializers.hpp"
 
-#include <azure/core/internal/json/json.hpp>
-#include <azure/core/internal/json/json_optional.hpp>
-#include <azure/core/internal/json/json_serializable.hpp>
+#include <azure/core/internal/json/json_reader.hpp>
 #include <azure/core/url.hpp>
 
 using namespace Azure::Security::KeyVault::Keys;
 using namespace Azure::Core::Json::_internal;
 
-KeyPropertiesPageResult
-_detail::KeyPropertiesPageResultSerializer::KeyPropertiesPageResultDeserialize(
-    Azure::Core::Http::RawResponse const& rawResponse)
+namespace {
+// Reads a nullable date, in POSIX time, into a date or a nullable date.
+template <class DateTime> void ReadDateTime(JsonReader& reader, DateTime& destination)
 {
-  using Azure::Core::_internal::PosixTimeConverter;
-
-  KeyPropertiesPageResult result;
-  auto const& body = rawResponse.GetBody();
-  auto jsonParser = json::parse(body);
-
-  JsonOptional::SetIfExists(result.NextPageToken, jsonParser, "nextLink");
+  reader.Read();
+  if (reader.GetTokenType() != JsonTokenType::Null)
+  {
+    destination
+        = Azure::Core::_internal::PosixTimeConverter::PosixTimeToDateTime(reader.GetInt64());
+  }
+}
 
-  // Key properties
-  auto keyPropertiesJson = jsonParser["value"];
-  for (auto const& key : keyPropertiesJson)
+// Reads the members of a key of a page, the reader being at its start. The members which aren't
+// properties of the key are passed to readOtherProperty, which reads or skips their value.
+template <class ReadOtherProperty>
+void ReadPageItem(
+    JsonReader& reader,
+    KeyProperties& properties,
+    ReadOtherProperty const& readOtherProperty)
+{
+  while (reader.ReadNextProperty())
   {
-    KeyProperties keyProperties;
-    keyProperties.Id = key[_detail::KeyIdPropertyName].get<std::string>();
-    _detail::KeyVaultKeySerializer::ParseKeyUrl(keyProperties, keyProperties.Id);
-    // "Attributes"
-    if (key.contains(_detail::AttributesPropertyName))
+    if (reader.ValueEquals(_detail::KeyIdPropertyName))
     {
-      auto attributes = key[_detail::AttributesPropertyName];
-
-      JsonOptional::SetIfExists(keyProperties.Enabled, attributes, _detail::EnabledPropertyName);
-      JsonOptional::SetIfExists<int64_t, Azure::DateTime>(
-          keyProperties.NotBefore,
-          attributes,
-          _detail::NbfPropertyName,
-          PosixTimeConverter::PosixTimeToDateTime);
-      JsonOptional::SetIfExists<int64_t, Azure::DateTime>(
-          keyProperties.ExpiresOn,
-          attributes,
-          _detail::ExpPropertyName,
-          PosixTimeConverter::PosixTimeToDateTime);
-      JsonOptional::SetIfExists<int64_t, Azure::DateTime>(
-          keyProperties.CreatedOn,
-          attributes,
-          _detail::CreatedPropertyName,
-          PosixTimeConverter::PosixTimeToDateTime);
-      JsonOptional::SetIfExists<int64_t, Azure::DateTime>(
-          keyProperties.UpdatedOn,
-          attributes,
-          _detail::UpdatedPropertyName,
-          PosixTimeConverter::PosixTimeToDateTime);
+      properties.Id = _detail::ReadStringValue(reader);
     }
-
-    // "Tags"
-    if (key.contains(_detail::TagsPropertyName))
+    else if (reader.ValueEquals(_detail::AttributesPropertyName))
+    {
+      reader.Read();
+      if (reader.GetTokenType() == JsonTokenType::Null)
+      {
+        continue;
+      }
+      while (reader.ReadNextProperty())
+      {
+        if (reader.ValueEquals(_detail::EnabledPropertyName))
+        {
+          reader.Read();
+          if (reader.GetTokenType() != JsonTokenType::Null)
+          {
+            properties.Enabled = reader.GetBool();
+          }
+        }
+        else if (reader.ValueEquals(_detail::NbfPropertyName))
+        {
+          ReadDateTime(reader, properties.NotBefore);
+        }
+        else if (reader.ValueEquals(_detail::ExpPropertyName))
+        {
+          ReadDateTime(reader, properties.ExpiresOn);
+        }
+        else if (reader.ValueEquals(_detail::CreatedPropertyName))
+        {
+          ReadDateTime(reader, properties.CreatedOn);
+        }
+        else if (reader.ValueEquals(_detail::UpdatedPropertyName))
+        {
+          ReadDateTime(reader, properties.UpdatedOn);
+        }
+        else if (reader.ValueEquals(_detail::RecoveryLevelPropertyName))
+        {
+          properties.RecoveryLevel = _detail::ReadStringValue(reader);
+        }
+        else
+        {
+          reader.Skip();
+        }
+      }
+    }
+    else if (reader.ValueEquals(_detail::TagsPropertyName))
     {
-      auto const& tags = key[_detail::TagsPropertyName];
-      for (auto tag = tags.begin(); tag != tags.end(); ++tag)
+      reader.Read();
+      if (reader.GetTokenType() == JsonTokenType::Null)
       {
-        keyProperties.Tags.emplace(tag.key(), tag.value().get<std::string>());
+        continue;
+      }
+      while (reader.ReadNextProperty())
+      {
+        auto tagName = reader.GetString();
+        properties.Tags.emplace(std::move(tagName), _detail::ReadStringValue(reader));
       }
     }
-
-    // managed
-    if (key.contains(_detail::ManagedPropertyName))
+    else if (reader.ValueEquals(_detail::ManagedPropertyName))
     {
-      keyProperties.Managed = key[_detail::ManagedPropertyName].get<bool>();
+      reader.Read();
+      if (reader.GetTokenType() != JsonTokenType::Null)
+      {
+        properties.Managed = reader.GetBool();
+      }
+    }
+    else
+    {
+      readOtherProperty();
     }
-
-    result.Items.emplace_back(keyProperties);
   }
-
-  return result;
+  _detail::KeyVaultKeySerializer::ParseKeyUrl(properties, properties.Id);
 }
 
-DeletedKeyPageResult _detail::KeyPropertiesPageResultSerializer::DeletedKeyPageResultDeserialize(
-    Azure::Core::Http::RawResponse const& rawResponse)
+// Reads the next link of a page and passes each of its items to readItem, the reader being at the
+// start of the item.
+template <class ReadItem>
+void ReadPage(
+    std::vector<uint8_t> const& body,
+    Azure::Nullable<std::string>& nextPageToken,
+    ReadItem const& readItem)
 {
-  using Azure::Core::_internal::PosixTimeConverter;
-
-  auto const& body = rawResponse.GetBody();
-  auto jsonParser = Azure::Core::Json::_internal::json::parse(body);
-
-  DeletedKeyPageResult deletedKeyPageResult;
-
-  JsonOptional::SetIfExists(deletedKeyPageResult.NextPageToken, jsonParser, "nextLink");
-
-  auto deletedKeys = jsonParser["value"];
-  for (auto const& key : deletedKeys)
+  JsonReader reader(body);
+  _detail::ReadStartObject(reader);
+  while (reader.ReadNextProperty())
   {
-    DeletedKey deletedKey;
-    deletedKey.Properties.Id = key[_detail::KeyIdPropertyName].get<std::string>();
-    _detail::KeyVaultKeySerializer::ParseKeyUrl(deletedKey.Properties, deletedKey.Properties.Id);
-
-    if (!key[_detail::RecoveryIdPropertyName].is_null())
+    if (reader.ValueEquals("nextLink"))
     {
-      deletedKey.RecoveryId = key[_detail::RecoveryIdPropertyName].get<std::string>();
+      reader.Read();
+      if (reader.GetTokenType() != JsonTokenType::Null)
+      {
+        nextPageToken = reader.GetString();
+      }
     }
-    if (!key[_detail::AttributesPropertyName][_detail::RecoveryLevelPropertyName].is_null())
+    else if (reader.ValueEquals("value"))
     {
-      deletedKey.Properties.RecoveryLevel
-          = key[_detail::AttributesPropertyName][_detail::RecoveryLevelPropertyName]
-                .get<std::string>();
+      reader.Read();
+      if (reader.GetTokenType() != JsonTokenType::StartArray)
+      {
+        reader.Skip();
+        continue;
+      }
+      while (reader.Read() && reader.GetTokenType() == JsonTokenType::StartObject)
+      {
+        readItem(reader);
+      }
+    }
+    else
+    {
+      reader.Skip();
     }
-    JsonOptional::SetIfExists<int64_t, Azure::DateTime>(
-        deletedKey.DeletedDate,
-        key,
-        _detail::DeletedOnPropertyName,
-        PosixTimeConverter::PosixTimeToDateTime);
-    JsonOptional::SetIfExists<int64_t, Azure::DateTime>(
-        deletedKey.ScheduledPurgeDate,
-        key,
-        _detail::ScheduledPurgeDatePropertyName,
-        PosixTimeConverter::PosixTimeToDateTime);
-
-    deletedKeyPageResult.Items.emplace_back(deletedKey);
   }
+}
+} // namespace
 
+KeyPropertiesPageResult
+_detail::KeyPropertiesPageResultSerializer::KeyPropertiesPageResultDeserialize(
+    Azure::Core::Http::RawResponse const& rawResponse)
+{
+  KeyPropertiesPageResult result;
+  ReadPage(rawResponse.GetBody(), result.NextPageToken, [&result](JsonReader& reader) {
+    KeyProperties keyProperties;
+    ReadPageItem(reader, keyProperties, [&reader]() { reader.Skip(); });
+    result.Items.emplace_back(std::move(keyProperties));
+  });
+  return result;
+}
+
+DeletedKeyPageResult _detail::KeyPropertiesPageResultSerializer::DeletedKeyPageResultDeserialize(
+    Azure::Core::Http::RawResponse const& rawResponse)
+{
+  DeletedKeyPageResult deletedKeyPageResult;
+  ReadPage(
+      rawResponse.GetBody(),
+      deletedKeyPageResult.NextPageToken,
+      [&deletedKeyPageResult](JsonReader& reader) {
+        DeletedKey deletedKey;
+        ReadPageItem(reader, deletedKey.Properties, [&reader, &deletedKey]() {
+          if (reader.ValueEquals(_detail::RecoveryIdPropertyName))
+          {
+            deletedKey.RecoveryId = _detail::ReadStringValue(reader);
+          }
+          else if (reader.ValueEquals(_detail::DeletedOnPropertyName))
+          {
+            ReadDateTime(reader, deletedKey.DeletedDate);
+          }
+          else if (reader.ValueEquals(_detail::ScheduledPurgeDatePropertyName))
+          {
+            ReadDateTime(reader, deletedKey.ScheduledPurgeDate);
+          }
+          else
+          {
+            reader.Skip();
+          }
+        });
+        deletedKeyPageResult.Items.emplace_back(std::move(deletedKey));
+      });
   return deletedKeyPageResult;
 }
 
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief DER encoding of the public keys imported by the local cryptography providers.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Azure {
+  namespace Security {
+    namespace KeyVault {
+      namespace Keys {
+        namespace Cryptography {
+  namespace _detail {
+
+    /**
+     * @brief Appends a DER element, whose content is up to 64KiB long.
+     *
+     * @param der The DER encoding to append the element to.
+     * @param tag The tag of the element.
+     * @param content The encoded content of the element.
+     */
+    inline void AppendDerElement(
+        std::vector<uint8_t>& der,
+        uint8_t tag,
+        std::vector<uint8_t> const& content)
+    {
+      der.push_back(tag);
+      auto const size = content.size();
+      if (size >= 0x100)
+      {
+        der.push_back(0x82);
+        der.push_back(static_cast<uint8_t>(size >> 8));
+        der.push_back(static_cast<uint8_t>(size));
+      }
+      else if (size >= 0x80)
+      {
+        der.push_back(0x81);
+        der.push_back(static_cast<uint8_t>(size));
+      }
+      else
+      {
+        der.push_back(static_cast<uint8_t>(size));
+      }
+      der.insert(der.end(), content.begin(), content.end());
+    }
+
+    /**
+     * @brief Appends a DER integer.
+     *
+     * @param der The DER encoding to append the integer to.
+     * @param value The big-endian unsigned value of the integer.
+     */
+    inline void AppendDerInteger(std::vector<uint8_t>& der, std::vector<uint8_t> const& value)
+    {
+      auto begin = value.begin();
+      while (begin != value.end() && *begin == 0)
+      {
+        ++begin;
+      }
+      // A leading zero keeps the integer positive.
+      std::vector<uint8_t> content;
+      if (begin == value.end() || (*begin & 0x80) != 0)
+      {
+        content.push_back(0);
+      }
+      content.insert(content.end(), begin, value.end());
+      AppendDerElement(der, 0x02, content);
+    }
+}}}}}} // namespace Azure::Security::KeyVault::Keys::Cryptography::_detail
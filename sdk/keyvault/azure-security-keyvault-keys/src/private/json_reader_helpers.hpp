@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Helpers to deserialize the key vault keys models with a JSON reader.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/base64.hpp>
+#include <azure/core/internal/json/json_reader.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Security { namespace KeyVault { namespace Keys { namespace _detail {
+  // Reads the first token of a response body, which must be an object.
+  inline void ReadStartObject(Azure::Core::Json::_internal::JsonReader& reader)
+  {
+    if (!reader.Read()
+        || reader.GetTokenType() != Azure::Core::Json::_internal::JsonTokenType::StartObject)
+    {
+      throw std::runtime_error("Expected a JSON object.");
+    }
+  }
+
+  // Reads the value of the current property as a string, null is read as an empty string.
+  inline std::string ReadStringValue(Azure::Core::Json::_internal::JsonReader& reader)
+  {
+    reader.Read();
+    return reader.GetTokenType() == Azure::Core::Json::_internal::JsonTokenType::Null
+        ? std::string()
+        : reader.GetString();
+  }
+
+  // Reads the value of the current property as base64url encoded bytes, null is read as no bytes.
+  inline std::vector<uint8_t> ReadBase64UrlValue(Azure::Core::Json::_internal::JsonReader& reader)
+  {
+    return Azure::Core::_internal::Base64Url::Base64UrlDecode(ReadStringValue(reader));
+  }
+}}}}} // namespace Azure::Security::KeyVault::Keys::_detail
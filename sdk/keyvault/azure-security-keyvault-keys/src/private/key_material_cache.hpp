@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Process-wide cache of the local providers created from the keys got from Key Vault.
+ *
+ */
+
+#pragma once
+
+#include "azure/keyvault/keys/internal/cryptography/cryptography_provider.hpp"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace Azure {
+  namespace Security {
+    namespace KeyVault {
+      namespace Keys {
+        namespace Cryptography {
+  namespace _detail {
+    /**
+     * @brief Caches the local providers of all the cryptography clients in the process, so that
+     * the clients created for the same key share the key material got from Key Vault, and the key
+     * is got only once at a time.
+     *
+     */
+    class KeyMaterialCache final {
+    private:
+      KeyMaterialCache() = delete;
+      ~KeyMaterialCache() = delete;
+
+    public:
+      /**
+       * @brief Gets the cached provider for a key, creating a new one when there's none or it was
+       * created more than \p duration ago.
+       *
+       * @param keyId The key identifier the cryptography client is created with.
+       * @param duration How long a provider is cached.
+       * @param createProvider A function getting the key and creating its local provider, null
+       * when the key type isn't supported locally. Concurrent calls for the same key wait for a
+       * single call. A provider isn't cached when the function throws.
+       *
+       * @return The cached or the new provider, which may be null.
+       */
+      static std::shared_ptr<CryptographyProvider> GetProvider(
+          std::string const& keyId,
+          std::chrono::milliseconds duration,
+          std::function<std::shared_ptr<CryptographyProvider>()> const& createProvider);
+
+      /**
+       * @brief Removes all the cached providers.
+       *
+       */
+      static void Clear();
+    };
+}}}}}} // namespace Azure::Security::KeyVault::Keys::Cryptography::_detail
@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Creates the policy limiting the rate of the requests sent to a vault.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/http/policies/policy.hpp>
+
+#include "azure/keyvault/keys/key_rate_limit_options.hpp"
+
+#include <memory>
+
+namespace Azure { namespace Security { namespace KeyVault { namespace Keys { namespace _detail {
+
+  /**
+   * @brief Create the policy holding up the requests beyond the budget of \p options, or nullptr
+   * when \p options doesn't limit any request.
+   *
+   */
+  std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy> CreateRateLimitPolicy(
+      KeyRateLimitOptions const& options);
+}}}}} // namespace Azure::Security::KeyVault::Keys::_detail
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <azure/core/internal/json/json.hpp>
+#include <azure/core/internal/json/json_reader.hpp>
 
 #include "azure/keyvault/keys/deleted_key.hpp"
 #include "azure/keyvault/keys/import_key_options.hpp"
@@ -40,6 +41,11 @@ namespace Azure { namespace Security { namespace KeyVault { namespace Keys { nam
         KeyVaultKey& key,
         Azure::Core::Json::_internal::json const& json);
 
+    // Updates a Key from the object at the current token of a JSON reader.
+    static void KeyVaultKeyDeserialize(
+        KeyVaultKey& key,
+        Azure::Core::Json::_internal::JsonReader& reader);
+
     static std::string GetUrlAuthorityWithScheme(Azure::Core::Url const& url)
     {
       std::string urlString;
@@ -115,6 +121,11 @@ namespace Azure { namespace Security { namespace KeyVault { namespace Keys { nam
     static void JsonWebDeserialize(
         JsonWebKey& srcKey,
         Azure::Core::Json::_internal::json const& jsonParser);
+
+    // Reads the JWK at the current token of a JSON reader, the value of the "key" property.
+    static void JsonWebDeserialize(
+        JsonWebKey& srcKey,
+        Azure::Core::Json::_internal::JsonReader& reader);
   };
 
 }}}}} // namespace Azure::Security::KeyVault::Keys::_detail
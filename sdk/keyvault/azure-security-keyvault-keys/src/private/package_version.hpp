@@ -11,9 +11,9 @@
 #include <cstdint>
 
 #define AZURE_SECURITY_KEYVAULT_KEYS_VERSION_MAJOR 4
-#define AZURE_SECURITY_KEYVAULT_KEYS_VERSION_MINOR 0
+#define AZURE_SECURITY_KEYVAULT_KEYS_VERSION_MINOR 1
 #define AZURE_SECURITY_KEYVAULT_KEYS_VERSION_PATCH 0
-#define AZURE_SECURITY_KEYVAULT_KEYS_VERSION_PRERELEASE ""
+#define AZURE_SECURITY_KEYVAULT_KEYS_VERSION_PRERELEASE "beta.1"
 
 #define AZURE_SECURITY_KEYVAULT_KEYS_VERSION_ITOA_HELPER(i) #i
 #define AZURE_SECURITY_KEYVAULT_KEYS_VERSION_ITOA(i) \
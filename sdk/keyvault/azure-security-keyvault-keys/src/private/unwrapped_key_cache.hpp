@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Cache of the keys unwrapped by a cryptography client.
+ *
+ */
+
+#pragma once
+
+#include "azure/keyvault/keys/cryptography/key_wrap_algorithm.hpp"
+#include "azure/keyvault/keys/cryptography/unwrap_result.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Azure {
+  namespace Security {
+    namespace KeyVault {
+      namespace Keys {
+        namespace Cryptography {
+  namespace _detail {
+    /**
+     * @brief Caches the keys unwrapped by a cryptography client, so that the same encrypted key is
+     * unwrapped by Key Vault only once while it's cached. The least recently used keys are evicted
+     * when the cached keys exceed the maximum size, and their memory is cleared.
+     *
+     */
+    class UnwrappedKeyCache final {
+    private:
+      struct CacheEntry final
+      {
+        std::string CacheKey;
+        UnwrapResult Result;
+        std::chrono::steady_clock::time_point ExpiresOn;
+      };
+
+      std::chrono::milliseconds m_duration;
+      size_t m_maxSize;
+
+      // Guards the variables below.
+      std::mutex m_mutex;
+      // The most recently used entry first.
+      std::list<CacheEntry> m_entries;
+      std::unordered_map<std::string, std::list<CacheEntry>::iterator> m_index;
+      size_t m_size = 0;
+
+      // Removes an entry, clearing the key. Must be called with m_mutex locked.
+      void Erase(std::list<CacheEntry>::iterator entry);
+
+    public:
+      /**
+       * @brief Construct a new cache.
+       *
+       * @param duration How long an unwrapped key is cached.
+       * @param maxSize The maximum total size of the cached encrypted and unwrapped keys, in
+       * bytes.
+       */
+      UnwrappedKeyCache(std::chrono::milliseconds duration, size_t maxSize)
+          : m_duration(duration), m_maxSize(maxSize)
+      {
+      }
+
+      ~UnwrappedKeyCache();
+
+      UnwrappedKeyCache(UnwrappedKeyCache const&) = delete;
+      UnwrappedKeyCache& operator=(UnwrappedKeyCache const&) = delete;
+
+      /**
+       * @brief Gets the cached result of unwrapping a key.
+       *
+       * @param algorithm The algorithm the key was wrapped with.
+       * @param encryptedKey The wrapped key.
+       * @param result Set to the cached result when there's one.
+       * @return Whether a result, not expired, is cached.
+       */
+      bool TryGet(
+          KeyWrapAlgorithm const& algorithm,
+          std::vector<uint8_t> const& encryptedKey,
+          UnwrapResult& result);
+
+      /**
+       * @brief Caches the result of unwrapping a key.
+       *
+       * @param algorithm The algorithm the key was wrapped with.
+       * @param encryptedKey The wrapped key.
+       * @param result The result of unwrapping the key.
+       */
+      void Add(
+          KeyWrapAlgorithm const& algorithm,
+          std::vector<uint8_t> const& encryptedKey,
+          UnwrapResult const& result);
+    };
+}}}}}} // namespace Azure::Security::KeyVault::Keys::Cryptography::_detail
@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the CPU cost of getting a key, with a canned response.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/base64.hpp>
+#include <azure/core/credentials/credentials.hpp>
+#include <azure/core/datetime.hpp>
+#include <azure/perf.hpp>
+#include <azure/perf/canned_response_transport.hpp>
+
+#include <azure/keyvault/key_vault_keys.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Security { namespace KeyVault { namespace Keys { namespace Test {
+
+  /**
+   * @brief A test to measure getting a key, without network.
+   *
+   * @remark The token comes from a credential that never expires, so that the test measures the
+   * client, the pipeline, and deserializing the key.
+   */
+  class GetKeyOffline : public Azure::Perf::PerfTest {
+  private:
+    class StaticTokenCredential final : public Azure::Core::Credentials::TokenCredential {
+    public:
+      Azure::Core::Credentials::AccessToken GetToken(
+          Azure::Core::Credentials::TokenRequestContext const&,
+          Azure::Core::Context const&) const override
+      {
+        return {"token", Azure::DateTime(9999)};
+      }
+    };
+
+    const std::string m_vaultUrl = "https://vault.vault.azure.net";
+    const std::string m_keyName = "key";
+    std::unique_ptr<Azure::Security::KeyVault::Keys::KeyClient> m_client;
+
+    /**
+     * @brief Get the JSON document of a 2048-bit RSA key.
+     *
+     */
+    std::string GetResponseBody() const
+    {
+      auto modulus = Azure::Core::Convert::Base64Encode(std::vector<uint8_t>(256, 0xC3));
+      // The key parameters are base64url encoded.
+      for (auto& c : modulus)
+      {
+        c = c == '+' ? '-' : c == '/' ? '_' : c;
+      }
+      modulus.erase(modulus.find_last_not_of('=') + 1);
+
+      return "{\"key\":{\"kid\":\"" + m_vaultUrl + "/keys/" + m_keyName
+          + "/78deebed173b48e48f55abf87ed4cf71\",\"kty\":\"RSA\",\"key_ops\":[\"encrypt\","
+            "\"decrypt\",\"sign\",\"verify\",\"wrapKey\",\"unwrapKey\"],\"n\":\""
+          + modulus
+          + "\",\"e\":\"AQAB\"},\"attributes\":{\"enabled\":true,\"created\":1632766917,"
+            "\"updated\":1632766917,\"recoveryLevel\":\"Recoverable+Purgeable\","
+            "\"recoverableDays\":90},\"tags\":{\"purpose\":\"perf\"}}";
+    }
+
+  public:
+    /**
+     * @brief Create the key client, answered with a key.
+     *
+     */
+    void Setup() override
+    {
+      Azure::Security::KeyVault::Keys::KeyClientOptions options;
+      options.Transport.Transport = std::make_shared<Azure::Perf::CannedResponseTransport>(
+          Azure::Core::Http::HttpStatusCode::Ok,
+          std::map<std::string, std::string>{
+              {"Cache-Control", "no-cache"},
+              {"Content-Type", "application/json; charset=utf-8"},
+              {"Date", "Mon, 27 Sep 2021 18:22:03 GMT"},
+              {"Expires", "-1"},
+              {"Pragma", "no-cache"},
+              {"x-ms-client-request-id", "6f3c5b0e-2b3e-4c0a-5d3f-8a0e9b1c7d21"},
+              {"x-ms-keyvault-network-info",
+               "conn_type=Ipv4;addr=10.0.0.1;act_addr_fam=InterNetwork;"},
+              {"x-ms-keyvault-region", "westus2"},
+              {"x-ms-keyvault-service-version", "1.9.79.3"},
+              {"x-ms-request-id", "0f1e2d3c-401e-0062-5a2b-b3c1d4000000"}},
+          GetResponseBody());
+      m_client = std::make_unique<Azure::Security::KeyVault::Keys::KeyClient>(
+          m_vaultUrl, std::make_shared<StaticTokenCredential>(), options);
+    }
+
+    /**
+     * @brief Construct a new GetKeyOffline test.
+     *
+     * @param options The test options.
+     */
+    GetKeyOffline(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_client->GetKey(m_keyName, {}, context);
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "GetKeyOffline",
+          "Get a key, answered by a canned response.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Security::KeyVault::Keys::Test::GetKeyOffline>(options);
+          }};
+    }
+  };
+
+}}}}} // namespace Azure::Security::KeyVault::Keys::Test
@@ -3,6 +3,7 @@
 
 #include <azure/perf.hpp>
 
+#include "azure/keyvault/keys/test/get_key_offline_test.hpp"
 #include "azure/keyvault/keys/test/get_key_test.hpp"
 
 int main(int argc, char** argv)
@@ -10,7 +11,8 @@ int main(int argc, char** argv)
 
   // Create the test list
   std::vector<Azure::Perf::TestMetadata> tests{
-      Azure::Security::KeyVault::Keys::Test::GetKey::GetTestMetadata()};
+      Azure::Security::KeyVault::Keys::Test::GetKey::GetTestMetadata(),
+      Azure::Security::KeyVault::Keys::Test::GetKeyOffline::GetTestMetadata()};
 
   Azure::Perf::Program::Run(Azure::Core::Context::ApplicationContext, tests, argc, argv);
 
@@ -15,6 +15,7 @@
 #include <private/key_constants.hpp>
 
 #include <iostream>
+#include <map>
 #include <string>
 #include <thread>
 
@@ -82,3 +83,57 @@ TEST_F(KeyVaultClientTest, BackupKey)
     CheckValidResponse(response, Azure::Core::Http::HttpStatusCode::NoContent);
   }
 }
+
+TEST_F(KeyVaultClientTest, BackupKeys)
+{
+  KeyClient keyClient(m_keyVaultUrl, m_credential);
+  std::vector<std::string> keyNames;
+  for (int i = 0; i < 3; ++i)
+  {
+    keyNames.push_back(GetUniqueName() + std::to_string(i));
+    auto response = keyClient.CreateKey(keyNames.back(), KeyVaultKeyType::Ec);
+    CheckValidResponse(response);
+  }
+
+  std::map<std::string, std::vector<uint8_t>> backups;
+  BulkKeyBackupOptions options;
+  options.Concurrency = 2;
+  auto result = keyClient.BackupKeys(
+      [&backups](std::string const& name, std::vector<uint8_t> const& backup) {
+        backups[name] = backup;
+      },
+      options);
+  EXPECT_EQ(result.SucceededCount, static_cast<int64_t>(backups.size()));
+  for (auto const& keyName : keyNames)
+  {
+    EXPECT_FALSE(backups[keyName].empty());
+    for (auto const& failure : result.Failures)
+    {
+      EXPECT_NE(failure.Name, keyName);
+    }
+  }
+
+  // The keys still exist, so every restore fails and is reported without throwing.
+  auto backup = backups.begin();
+  auto restoreResult = keyClient.RestoreKeyBackups(
+      [&backup, &backups](std::string& name, std::vector<uint8_t>& value) {
+        if (backup == backups.end())
+        {
+          return false;
+        }
+        name = backup->first;
+        value = backup->second;
+        ++backup;
+        return true;
+      },
+      options);
+  EXPECT_EQ(restoreResult.SucceededCount, 0);
+  EXPECT_EQ(restoreResult.Failures.size(), backups.size());
+
+  for (auto const& keyName : keyNames)
+  {
+    auto response = keyClient.StartDeleteKey(keyName);
+    response.PollUntilDone(std::chrono::milliseconds(1000));
+    keyClient.PurgeDeletedKey(keyName);
+  }
+}
@@ -13,6 +13,8 @@
 
 #include <azure/keyvault/key_vault_keys.hpp>
 
+#include <exception>
+#include <future>
 #include <string>
 #include <vector>
 
@@ -130,6 +132,45 @@ TEST_P(KeyVaultClientTest, RemoteSignVerifyRSA256)
   }
 }
 
+TEST_F(KeyVaultClientTest, RemoteSignAsync)
+{
+  KeyClient keyClient(m_keyVaultUrl, m_credential);
+  std::string keyName(GetUniqueName());
+  std::string digestSource("A single block of plaintext");
+
+  CreateEcKeyOptions ecKeyOptions(keyName);
+  ecKeyOptions.CurveName = KeyCurveName::P256;
+  auto ecKey = keyClient.CreateEcKey(ecKeyOptions).Value;
+  CryptographyClient cryptoClient(ecKey.Id(), m_credential);
+
+  Azure::Core::Cryptography::_internal::Sha256Hash sha256;
+  auto signatureAlgorithm = SignatureAlgorithm::ES256;
+  std::vector<uint8_t> digest
+      = sha256.Final(reinterpret_cast<const uint8_t*>(digestSource.data()), digestSource.size());
+
+  // The result is got through a future, as a caller without coroutines would.
+  std::promise<SignResult> signature;
+  cryptoClient.SignAsync(
+      signatureAlgorithm,
+      digest,
+      Azure::Core::Context(),
+      [&](Azure::Nullable<Azure::Response<SignResult>> response, std::exception_ptr error) {
+        if (error)
+        {
+          signature.set_exception(error);
+          return;
+        }
+        signature.set_value(std::move(response.Value().Value));
+      });
+  auto signResult = signature.get_future().get();
+  EXPECT_EQ(signResult.Algorithm.ToString(), signatureAlgorithm.ToString());
+  EXPECT_EQ(signResult.KeyId, ecKey.Id());
+  EXPECT_TRUE(signResult.Signature.size() > 0);
+
+  auto verifyResult = cryptoClient.Verify(signResult.Algorithm, digest, signResult.Signature);
+  EXPECT_TRUE(verifyResult.IsValid);
+}
+
 TEST_F(KeyVaultClientTest, RemoteSignVerifyES256)
 {
   KeyClient keyClient(m_keyVaultUrl, m_credential);
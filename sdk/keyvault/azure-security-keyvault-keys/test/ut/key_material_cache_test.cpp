@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "./../../src/private/key_material_cache.hpp"
+
+#include <azure/keyvault/keys/internal/cryptography/local_cryptography_provider_factory.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace Azure::Security::KeyVault::Keys;
+using namespace Azure::Security::KeyVault::Keys::Cryptography::_detail;
+
+namespace {
+std::shared_ptr<CryptographyProvider> CreateProvider()
+{
+  JsonWebKey key;
+  key.Id = "https://vault.azure.net/keys/oct/1";
+  key.KeyType = KeyVaultKeyType::Oct;
+  key.K = std::vector<uint8_t>(16);
+  return LocalCryptographyProviderFactory::Create(key, KeyProperties());
+}
+} // namespace
+
+TEST(KeyMaterialCache, ReuseWithinDuration)
+{
+  using namespace std::chrono_literals;
+  KeyMaterialCache::Clear();
+
+  int numCreated = 0;
+  auto const createProvider = [&]() {
+    ++numCreated;
+    return CreateProvider();
+  };
+
+  auto const provider = KeyMaterialCache::GetProvider("A", 1h, createProvider);
+  EXPECT_NE(provider, nullptr);
+  EXPECT_EQ(KeyMaterialCache::GetProvider("A", 1h, createProvider), provider);
+  EXPECT_NE(KeyMaterialCache::GetProvider("B", 1h, createProvider), provider);
+  EXPECT_EQ(numCreated, 2);
+
+  // Keys not supported locally are cached too.
+  EXPECT_EQ(
+      KeyMaterialCache::GetProvider(
+          "C", 1h, []() -> std::shared_ptr<CryptographyProvider> { return nullptr; }),
+      nullptr);
+  EXPECT_EQ(KeyMaterialCache::GetProvider("C", 1h, createProvider), nullptr);
+  EXPECT_EQ(numCreated, 2);
+
+  KeyMaterialCache::Clear();
+  EXPECT_NE(KeyMaterialCache::GetProvider("A", 1h, createProvider), provider);
+  EXPECT_EQ(numCreated, 3);
+  KeyMaterialCache::Clear();
+}
+
+TEST(KeyMaterialCache, CreateAgainAfterDuration)
+{
+  using namespace std::chrono_literals;
+  KeyMaterialCache::Clear();
+
+  int numCreated = 0;
+  auto const createProvider = [&]() {
+    ++numCreated;
+    return CreateProvider();
+  };
+
+  KeyMaterialCache::GetProvider("A", 10ms, createProvider);
+  std::this_thread::sleep_for(20ms);
+  KeyMaterialCache::GetProvider("A", 10ms, createProvider);
+  EXPECT_EQ(numCreated, 2);
+
+  // Zero doesn't cache.
+  KeyMaterialCache::GetProvider("B", 0ms, createProvider);
+  KeyMaterialCache::GetProvider("B", 0ms, createProvider);
+  EXPECT_EQ(numCreated, 4);
+  KeyMaterialCache::Clear();
+}
+
+TEST(KeyMaterialCache, FailureNotCached)
+{
+  using namespace std::chrono_literals;
+  KeyMaterialCache::Clear();
+
+  EXPECT_THROW(
+      KeyMaterialCache::GetProvider(
+          "A",
+          1h,
+          []() -> std::shared_ptr<CryptographyProvider> { throw std::runtime_error("error"); }),
+      std::runtime_error);
+  EXPECT_NE(KeyMaterialCache::GetProvider("A", 1h, CreateProvider), nullptr);
+  KeyMaterialCache::Clear();
+}
+
+TEST(KeyMaterialCache, SingleCreation)
+{
+  using namespace std::chrono_literals;
+  KeyMaterialCache::Clear();
+
+  std::atomic<int> numCreated(0);
+  auto const createProvider = [&]() {
+    ++numCreated;
+    std::this_thread::sleep_for(50ms);
+    return CreateProvider();
+  };
+
+  std::vector<std::thread> threads;
+  std::vector<std::shared_ptr<CryptographyProvider>> providers(8);
+  for (size_t i = 0; i < providers.size(); ++i)
+  {
+    threads.emplace_back(
+        [&, i]() { providers[i] = KeyMaterialCache::GetProvider("A", 1h, createProvider); });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  EXPECT_EQ(numCreated, 1);
+  for (auto const& provider : providers)
+  {
+    EXPECT_EQ(provider, providers.front());
+  }
+  KeyMaterialCache::Clear();
+}
@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "./../../src/private/cryptography_serializers.hpp"
+#include "./../../src/private/key_serializers.hpp"
+
+#include <azure/core/http/raw_response.hpp>
+#include <azure/core/io/body_stream.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace Azure::Security::KeyVault::Keys;
+using namespace Azure::Security::KeyVault::Keys::Cryptography;
+using Azure::Security::KeyVault::Keys::_detail::KeyPropertiesPageResultSerializer;
+using Azure::Security::KeyVault::Keys::_detail::KeyVaultKeySerializer;
+using Azure::Security::KeyVault::Keys::Cryptography::_detail::EncryptResultSerializer;
+using Azure::Security::KeyVault::Keys::Cryptography::_detail::UnwrapResultSerializer;
+using Azure::Security::KeyVault::Keys::Cryptography::_detail::VerifyResultSerializer;
+
+namespace {
+std::unique_ptr<Azure::Core::Http::RawResponse> CreateResponse(std::string const& body)
+{
+  auto response = std::make_unique<Azure::Core::Http::RawResponse>(
+      1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+  response->SetBody(std::vector<uint8_t>(body.begin(), body.end()));
+  return response;
+}
+} // namespace
+
+TEST(KeySerializers, KeyVaultKeyDeserialize)
+{
+  auto const response = CreateResponse(
+      "{\"key\":{\"kid\":\"https://myvault.vault.azure.net/keys/MyKey/78deebed\",\"kty\":\"RSA\","
+      "\"key_ops\":[\"encrypt\",\"verify\"],\"n\":\"AQAB_-8\",\"e\":\"AQAB\",\"crv\":null},"
+      "\"attributes\":{\"enabled\":true,\"nbf\":null,\"created\":1493942451,"
+      "\"recoveryLevel\":\"Recoverable+Purgeable\",\"future\":{\"a\":[1,{}]}},"
+      "\"tags\":{\"purpose\":\"unit test\",\"es\\\"caped\":\"\\u00e9\"},\"managed\":true,"
+      "\"release_policy\":{\"data\":\"abc\"}}");
+
+  auto const key = KeyVaultKeySerializer::KeyVaultKeyDeserialize("MyKey", *response);
+  EXPECT_EQ(key.Key.Id, "https://myvault.vault.azure.net/keys/MyKey/78deebed");
+  EXPECT_EQ(key.Properties.Name, "MyKey");
+  EXPECT_EQ(key.Properties.Version, "78deebed");
+  EXPECT_EQ(key.Properties.VaultUrl, "https://myvault.vault.azure.net");
+  EXPECT_EQ(key.GetKeyType(), KeyVaultKeyType::Rsa);
+  ASSERT_EQ(key.KeyOperations().size(), 2U);
+  EXPECT_EQ(key.KeyOperations()[0], KeyOperation::Encrypt);
+  EXPECT_EQ(key.KeyOperations()[1], KeyOperation::Verify);
+  EXPECT_EQ(key.Key.N, std::vector<uint8_t>({0x01, 0x00, 0x01, 0xff, 0xef}));
+  EXPECT_EQ(key.Key.E, std::vector<uint8_t>({0x01, 0x00, 0x01}));
+  EXPECT_FALSE(key.Key.CurveName.HasValue());
+  EXPECT_TRUE(key.Properties.Enabled.Value());
+  EXPECT_FALSE(key.Properties.NotBefore.HasValue());
+  EXPECT_EQ(
+      key.Properties.CreatedOn.Value(),
+      Azure::Core::_internal::PosixTimeConverter::PosixTimeToDateTime(1493942451));
+  EXPECT_EQ(key.Properties.Tags.at("purpose"), "unit test");
+  EXPECT_EQ(key.Properties.Tags.at("es\"caped"), "\xc3\xa9");
+  EXPECT_TRUE(key.Properties.Managed);
+
+  EXPECT_THROW(
+      KeyVaultKeySerializer::KeyVaultKeyDeserialize(*CreateResponse("{\"key\":[]}")),
+      std::runtime_error);
+}
+
+TEST(KeySerializers, CryptographyResultsDeserialize)
+{
+  auto const encryptResult = EncryptResultSerializer::EncryptResultDeserialize(*CreateResponse(
+      "{\"kid\":\"https://myvault.vault.azure.net/keys/MyKey/1\",\"value\":\"AQID\",\"iv\":null,"
+      "\"tag\":\"BA\"}"));
+  EXPECT_EQ(encryptResult.KeyId, "https://myvault.vault.azure.net/keys/MyKey/1");
+  EXPECT_EQ(encryptResult.Ciphertext, std::vector<uint8_t>({0x01, 0x02, 0x03}));
+  EXPECT_TRUE(encryptResult.Iv.empty());
+  EXPECT_EQ(encryptResult.AuthenticationTag, std::vector<uint8_t>({0x04}));
+
+  auto const unwrapResult = UnwrapResultSerializer::UnwrapResultDeserialize(
+      *CreateResponse("{\"value\":\"AQID\",\"kid\":\"https://myvault.vault.azure.net/keys/k/1\"}"));
+  EXPECT_EQ(unwrapResult.KeyId, "https://myvault.vault.azure.net/keys/k/1");
+  EXPECT_EQ(unwrapResult.Key, std::vector<uint8_t>({0x01, 0x02, 0x03}));
+
+  EXPECT_TRUE(
+      VerifyResultSerializer::VerifyResultDeserialize(*CreateResponse(" { \"value\" : true } "))
+          .IsValid);
+  EXPECT_THROW(
+      VerifyResultSerializer::VerifyResultDeserialize(*CreateResponse("{\"value\":1}")),
+      std::runtime_error);
+}
+
+TEST(KeySerializers, KeyPropertiesPageResultDeserialize)
+{
+  auto const page = KeyPropertiesPageResultSerializer::KeyPropertiesPageResultDeserialize(
+      *CreateResponse(
+          "{\"value\":[{\"kid\":\"https://myvault.vault.azure.net/keys/k1/v1\","
+          "\"attributes\":{\"enabled\":false,\"exp\":null,\"updated\":1493942451},"
+          "\"tags\":{\"a\":\"b\"},\"future\":[1]},"
+          "{\"kid\":\"https://myvault.vault.azure.net/keys/k2/v2\",\"managed\":true}],"
+          "\"nextLink\":\"https://myvault.vault.azure.net/keys?$skiptoken=abc\"}"));
+  ASSERT_EQ(page.Items.size(), 2U);
+  EXPECT_EQ(page.Items[0].Name, "k1");
+  EXPECT_EQ(page.Items[0].Version, "v1");
+  EXPECT_FALSE(page.Items[0].Enabled.Value());
+  EXPECT_FALSE(page.Items[0].ExpiresOn.HasValue());
+  EXPECT_EQ(
+      page.Items[0].UpdatedOn.Value(),
+      Azure::Core::_internal::PosixTimeConverter::PosixTimeToDateTime(1493942451));
+  EXPECT_EQ(page.Items[0].Tags.at("a"), "b");
+  EXPECT_EQ(page.Items[1].Name, "k2");
+  EXPECT_TRUE(page.Items[1].Managed);
+  EXPECT_EQ(page.NextPageToken.Value(), "https://myvault.vault.azure.net/keys?$skiptoken=abc");
+
+  auto const deletedPage = KeyPropertiesPageResultSerializer::DeletedKeyPageResultDeserialize(
+      *CreateResponse(
+          "{\"nextLink\":null,\"value\":[{\"kid\":\"https://myvault.vault.azure.net/keys/k/v\","
+          "\"recoveryId\":\"https://myvault.vault.azure.net/deletedkeys/k\","
+          "\"deletedDate\":1493942451,\"scheduledPurgeDate\":null}]}"));
+  ASSERT_EQ(deletedPage.Items.size(), 1U);
+  EXPECT_EQ(deletedPage.Items[0].Name(), "k");
+  EXPECT_EQ(deletedPage.Items[0].RecoveryId, "https://myvault.vault.azure.net/deletedkeys/k");
+  EXPECT_EQ(
+      deletedPage.Items[0].DeletedDate,
+      Azure::Core::_internal::PosixTimeConverter::PosixTimeToDateTime(1493942451));
+  EXPECT_FALSE(deletedPage.NextPageToken.HasValue());
+}
@@ -0,0 +1,278 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "gtest/gtest.h"
+
+#include <azure/core/context.hpp>
+#include <azure/core/platform.hpp>
+#include <azure/keyvault/keys/internal/cryptography/local_cryptography_provider_factory.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace Azure::Security::KeyVault::Keys;
+using namespace Azure::Security::KeyVault::Keys::Cryptography;
+using namespace Azure::Security::KeyVault::Keys::Cryptography::_detail;
+
+namespace {
+JsonWebKey CreateEcKey()
+{
+  JsonWebKey key;
+  key.Id = "https://vault.azure.net/keys/ec/1";
+  key.KeyType = KeyVaultKeyType::Ec;
+  key.CurveName = KeyCurveName::P256;
+  key.X = {0x6f, 0xcb, 0x92, 0x9a, 0x28, 0x34, 0x8c, 0x70, 0x73, 0xc1, 0x28, 0x94,
+           0x8c, 0x89, 0x6b, 0x11, 0x94, 0xf0, 0x49, 0x5c, 0xb1, 0xe9, 0x03, 0x1f,
+           0xd8, 0x56, 0x66, 0x57, 0xc0, 0x3c, 0x7b, 0x43};
+  key.Y = {0xd2, 0xdf, 0xc0, 0x5c, 0x21, 0xa2, 0xe6, 0x67, 0x95, 0xa0, 0x41, 0x97,
+           0x3b, 0x52, 0x0d, 0xf2, 0x35, 0x49, 0x31, 0x8f, 0x6c, 0xfe, 0xfb, 0x18,
+           0x1e, 0x6a, 0x87, 0x3d, 0x41, 0x4b, 0xcf, 0xa5};
+  key.SetKeyOperations({KeyOperation::Sign, KeyOperation::Verify});
+  return key;
+}
+
+// The SHA-256 digest of "Azure Key Vault" and its signature with the private key of CreateEcKey().
+std::vector<uint8_t> const EcDigest
+    = {0x54, 0x9c, 0xde, 0xb9, 0x9f, 0x38, 0x7d, 0x7d, 0x1c, 0x06, 0x5b, 0xa4,
+       0x04, 0xd8, 0xd2, 0xc1, 0x13, 0x0a, 0xf9, 0x11, 0xbd, 0xbf, 0xd7, 0x1c,
+       0x3b, 0xf7, 0x6a, 0xb8, 0x59, 0x00, 0x6e, 0x83};
+std::vector<uint8_t> const EcSignature
+    = {0xde, 0x51, 0x27, 0x1f, 0x5f, 0x63, 0x47, 0xb7, 0x27, 0xae, 0x76, 0xf7,
+       0xeb, 0x46, 0x7f, 0xe3, 0x04, 0xbd, 0xe3, 0x08, 0xb2, 0x02, 0x96, 0xa2,
+       0xf5, 0x89, 0xc5, 0x32, 0x61, 0x24, 0x85, 0xb9, 0xa6, 0x22, 0x34, 0x8a,
+       0xcc, 0xf8, 0xb9, 0x58, 0x48, 0xb9, 0x43, 0xc8, 0x53, 0x3a, 0x45, 0xbc,
+       0x2b, 0xe6, 0x9b, 0x24, 0xea, 0x22, 0x8b, 0x48, 0xab, 0xe8, 0xdc, 0xd2,
+       0x60, 0x7f, 0x60, 0xe6};
+
+JsonWebKey CreateOctKey()
+{
+  // The key encryption key of the RFC 3394 test vectors.
+  JsonWebKey key;
+  key.Id = "https://vault.azure.net/keys/oct/1";
+  key.KeyType = KeyVaultKeyType::Oct;
+  key.K = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+           0x0c, 0x0d, 0x0e, 0x0f};
+  key.SetKeyOperations({KeyOperation::WrapKey, KeyOperation::UnwrapKey});
+  return key;
+}
+
+JsonWebKey CreateRsaKey()
+{
+  JsonWebKey key;
+  key.Id = "https://vault.azure.net/keys/rsa/1";
+  key.KeyType = KeyVaultKeyType::Rsa;
+  key.N = {0xa4, 0x6f, 0x92, 0xf4, 0x8c, 0x8d, 0x1a, 0x6f, 0xe9, 0xdc, 0x92, 0x4e,
+           0xce, 0xab, 0x07, 0x1b, 0x74, 0x06, 0x28, 0x18, 0x10, 0x44, 0x3a, 0xba,
+           0xbd, 0x6c, 0x42, 0x9a, 0x14, 0x2f, 0x42, 0xb4, 0x92, 0x4b, 0xe9, 0x99,
+           0xc6, 0x75, 0x0d, 0x70, 0xbd, 0xc1, 0x67, 0x9b, 0xad, 0xb8, 0xb1, 0x27,
+           0x8a, 0x11, 0xa4, 0x24, 0xb6, 0x59, 0x51, 0x19, 0x59, 0x23, 0x6d, 0xb1,
+           0x03, 0x3b, 0xaa, 0xaf, 0xa6, 0x73, 0x6f, 0x1e, 0xf1, 0x54, 0xa1, 0x20,
+           0xb2, 0xec, 0x3d, 0x72, 0x7f, 0x87, 0x40, 0x47, 0xe4, 0x2d, 0x70, 0x8a,
+           0x6a, 0x35, 0x61, 0x49, 0x7e, 0x8e, 0xc6, 0x91, 0x13, 0x0d, 0x54, 0x49,
+           0xd2, 0x50, 0x71, 0x37, 0xa4, 0xef, 0x6e, 0xdd, 0x77, 0xab, 0xd5, 0xa8,
+           0x41, 0xb8, 0xdd, 0xd4, 0x89, 0xeb, 0x85, 0x2d, 0x97, 0x13, 0x1a, 0x21,
+           0xa0, 0xef, 0xc5, 0xe9, 0xab, 0x28, 0x5b, 0xc6, 0xf3, 0x8f, 0xa4, 0x8f,
+           0x49, 0x08, 0x09, 0x83, 0x39, 0x1f, 0x19, 0x84, 0x97, 0xf7, 0x6b, 0x3d,
+           0x9f, 0x5f, 0x6a, 0x88, 0x15, 0x5e, 0x9c, 0x2d, 0x2d, 0x37, 0x36, 0x73,
+           0x94, 0xcc, 0x54, 0x0d, 0x7d, 0x43, 0x60, 0x7f, 0xc8, 0x29, 0xe8, 0xb3,
+           0x90, 0x32, 0x2c, 0xde, 0x79, 0xd3, 0x13, 0x1e, 0xb5, 0x51, 0xec, 0xd5,
+           0xa8, 0x27, 0x0a, 0xab, 0x79, 0x49, 0x40, 0x78, 0xd9, 0xc1, 0x42, 0xa0,
+           0xbb, 0xa0, 0x1f, 0x38, 0x42, 0x2c, 0xa9, 0x79, 0x28, 0x90, 0x78, 0xbe,
+           0xf9, 0xaa, 0x22, 0xad, 0x9f, 0x7b, 0xea, 0x32, 0x41, 0xac, 0x20, 0xd7,
+           0x91, 0x10, 0x90, 0x76, 0x88, 0x08, 0xe4, 0x09, 0xe3, 0x88, 0xf8, 0x6a,
+           0x6d, 0x83, 0xe6, 0x15, 0xd2, 0xf0, 0x6a, 0x60, 0xe3, 0xcd, 0x9c, 0xd1,
+           0xd4, 0xc7, 0x0f, 0xb8, 0x96, 0xf9, 0xf1, 0xaa, 0x87, 0xe6, 0x99, 0x68,
+           0x26, 0xab, 0xed, 0x75};
+  key.E = {0x01, 0x00, 0x01};
+  key.SetKeyOperations({KeyOperation::Encrypt, KeyOperation::WrapKey, KeyOperation::Verify});
+  return key;
+}
+
+// The SHA-256 digest of "abc" and its RS256 and PS256 signatures with the private key of
+// CreateRsaKey().
+std::vector<uint8_t> const RsaDigest
+    = {0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde,
+       0x5d, 0xae, 0x22, 0x23, 0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+       0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad};
+std::vector<uint8_t> const RsaPkcs1Signature
+    = {0x2b, 0x5b, 0x8f, 0x77, 0x71, 0x9e, 0x53, 0x8a, 0xc7, 0x87, 0x89, 0xe4,
+       0x0d, 0x47, 0x8a, 0x63, 0x65, 0x65, 0x8c, 0xb0, 0x71, 0x93, 0x84, 0xc7,
+       0xb9, 0x42, 0x9e, 0x0d, 0x15, 0x4e, 0x72, 0xb7, 0x37, 0xed, 0xf6, 0x9f,
+       0xda, 0x32, 0x6e, 0x48, 0xe5, 0xe7, 0x4c, 0xc4, 0x78, 0x77, 0xb2, 0x72,
+       0xbc, 0xed, 0x11, 0x73, 0x69, 0xc4, 0xbe, 0x6d, 0x8b, 0x3d, 0x23, 0x3c,
+       0x13, 0xa3, 0x88, 0xfb, 0x9f, 0xef, 0x19, 0x49, 0x80, 0x3e, 0x1a, 0x23,
+       0xdc, 0x40, 0x43, 0xca, 0x9f, 0x87, 0x80, 0x54, 0x98, 0xf0, 0x0d, 0xf7,
+       0x32, 0x31, 0x09, 0xbb, 0xc3, 0x6c, 0x82, 0x69, 0x9f, 0x26, 0x3d, 0x44,
+       0xbf, 0xcc, 0x9f, 0x0d, 0x83, 0xcd, 0xb1, 0xe8, 0xe2, 0xa5, 0xea, 0x0f,
+       0x77, 0x85, 0xd7, 0xfd, 0x1e, 0x8e, 0xf5, 0xf5, 0x97, 0xf3, 0x32, 0x60,
+       0x12, 0x80, 0xd3, 0x8c, 0x7b, 0x89, 0x2d, 0xd2, 0xee, 0xda, 0x4f, 0x2c,
+       0x8d, 0xe4, 0xfe, 0x83, 0x35, 0xa7, 0xfc, 0x21, 0xc9, 0xa5, 0x87, 0xd9,
+       0x64, 0x4c, 0xe4, 0x3a, 0xac, 0x9a, 0xa7, 0x38, 0xe6, 0xf2, 0x42, 0xdb,
+       0x6c, 0xbc, 0xa7, 0xbf, 0x7c, 0x6e, 0x24, 0x1c, 0xff, 0x30, 0x49, 0xc6,
+       0x7f, 0xc8, 0x85, 0x5b, 0x82, 0xd3, 0x9f, 0xf3, 0x36, 0xd5, 0x84, 0x9d,
+       0x40, 0xbe, 0xc8, 0xb2, 0x79, 0x1d, 0x3d, 0x49, 0xe3, 0x22, 0x47, 0x15,
+       0x94, 0xc0, 0xee, 0x04, 0xe0, 0x9e, 0x19, 0x64, 0xa1, 0xed, 0x40, 0xac,
+       0x67, 0x35, 0xae, 0xea, 0x70, 0xdb, 0xb8, 0xc2, 0xe7, 0x66, 0xb5, 0x5d,
+       0x7f, 0xfc, 0x57, 0xef, 0xfb, 0x7f, 0x83, 0xf6, 0xc6, 0xdb, 0xeb, 0x9e,
+       0x76, 0x74, 0xc5, 0x33, 0xaf, 0xc3, 0xf2, 0xe9, 0x20, 0x4e, 0x2f, 0xb5,
+       0x1a, 0xc4, 0x7b, 0xe0, 0x72, 0x38, 0x98, 0xf3, 0x76, 0x39, 0xac, 0x95,
+       0x81, 0xf1, 0xce, 0xa7};
+std::vector<uint8_t> const RsaPssSignature
+    = {0x07, 0x60, 0x93, 0x61, 0xb5, 0xc0, 0x6e, 0x62, 0xaa, 0xdc, 0x92, 0xa7,
+       0xfc, 0x6f, 0x3c, 0x6e, 0x88, 0x86, 0x1c, 0xa9, 0x1b, 0xcd, 0xb1, 0x3a,
+       0x29, 0x4a, 0x19, 0xbe, 0xb1, 0x6a, 0xba, 0xb6, 0x98, 0x45, 0x24, 0x40,
+       0x17, 0x52, 0xde, 0x34, 0x40, 0x4d, 0x0c, 0x59, 0x84, 0xf9, 0xcd, 0x74,
+       0x20, 0x00, 0x3d, 0xd0, 0x5a, 0xd8, 0x57, 0xfb, 0xdc, 0x14, 0x02, 0xd5,
+       0x34, 0x3c, 0x48, 0x0b, 0x7f, 0xc6, 0x1e, 0xc0, 0x3b, 0x61, 0x9f, 0x1f,
+       0x7f, 0x78, 0xd9, 0x92, 0x2b, 0x7f, 0x42, 0x14, 0x9a, 0x46, 0x35, 0xab,
+       0x25, 0x03, 0xce, 0x4b, 0xc6, 0x34, 0xda, 0x7e, 0x28, 0x96, 0xcc, 0x43,
+       0x1c, 0xe5, 0x13, 0x7e, 0xae, 0x36, 0xc4, 0x50, 0xe1, 0x81, 0xc5, 0x59,
+       0x01, 0xd2, 0x07, 0xae, 0xe0, 0x65, 0xef, 0x2a, 0x87, 0x9e, 0x8c, 0x05,
+       0x61, 0xbf, 0x4b, 0xcf, 0x3f, 0x1a, 0xe2, 0xb9, 0x02, 0xbc, 0xa0, 0x03,
+       0xf0, 0x86, 0xfa, 0xc7, 0xf6, 0x29, 0xd7, 0xb2, 0x5b, 0xcd, 0x8d, 0xc3,
+       0x4f, 0x1b, 0xc6, 0x76, 0x1f, 0xd3, 0x30, 0x27, 0xa3, 0xa1, 0x84, 0x07,
+       0x7a, 0x8c, 0x87, 0xbb, 0xa2, 0x7c, 0x7f, 0xad, 0x79, 0xe9, 0x61, 0xfd,
+       0xb1, 0x54, 0x11, 0xd0, 0xc6, 0x7b, 0x8f, 0x43, 0xd8, 0x4a, 0x9e, 0xca,
+       0xa4, 0xd3, 0xf8, 0x6b, 0x2e, 0x1a, 0x66, 0x3f, 0xa3, 0x2d, 0x7f, 0x75,
+       0x0b, 0x43, 0x24, 0xa3, 0x29, 0x92, 0x96, 0x3b, 0xfa, 0x3c, 0xc9, 0x44,
+       0x53, 0xca, 0x3d, 0x9a, 0x6f, 0x59, 0x7c, 0x80, 0x10, 0x17, 0x72, 0xc3,
+       0xc0, 0x58, 0x75, 0xd9, 0xb9, 0x3d, 0x23, 0x5d, 0xf9, 0x39, 0x63, 0xdd,
+       0x59, 0x73, 0x21, 0x81, 0x21, 0x3e, 0x0b, 0x75, 0x78, 0x02, 0xc5, 0x02,
+       0x2f, 0xe4, 0x66, 0xac, 0x72, 0x8d, 0xcd, 0x87, 0x00, 0xc1, 0xd1, 0x0e,
+       0x99, 0x78, 0x53, 0x42};
+
+} // namespace
+
+TEST(LocalCryptographyProvider, EcVerify)
+{
+  auto const provider = LocalCryptographyProviderFactory::Create(CreateEcKey(), KeyProperties());
+  ASSERT_NE(provider, nullptr);
+  EXPECT_TRUE(provider->SupportsOperation(KeyOperation::Verify));
+  EXPECT_FALSE(provider->SupportsOperation(KeyOperation::WrapKey));
+
+  auto const context = Azure::Core::Context();
+  auto result = provider->Verify(SignatureAlgorithm::ES256, EcDigest, EcSignature, context);
+#if defined(AZ_PLATFORM_WINDOWS)
+  // Left to the remote client.
+  EXPECT_TRUE(result.KeyId.empty());
+#else
+  EXPECT_EQ(result.KeyId, "https://vault.azure.net/keys/ec/1");
+  EXPECT_TRUE(result.IsValid);
+  EXPECT_EQ(result.Algorithm, SignatureAlgorithm::ES256);
+
+  auto tamperedSignature = EcSignature;
+  tamperedSignature[10] ^= 0x01;
+  result = provider->Verify(SignatureAlgorithm::ES256, EcDigest, tamperedSignature, context);
+  EXPECT_EQ(result.KeyId, "https://vault.azure.net/keys/ec/1");
+  EXPECT_FALSE(result.IsValid);
+
+  auto tamperedDigest = EcDigest;
+  tamperedDigest[0] ^= 0x01;
+  result = provider->Verify(SignatureAlgorithm::ES256, tamperedDigest, EcSignature, context);
+  EXPECT_FALSE(result.IsValid);
+#endif
+
+  // Algorithms not matching the curve, and signatures, are left to the remote client.
+  result = provider->Verify(SignatureAlgorithm::ES384, EcDigest, EcSignature, context);
+  EXPECT_TRUE(result.KeyId.empty());
+  EXPECT_TRUE(provider->Sign(SignatureAlgorithm::ES256, EcDigest, context).Signature.empty());
+}
+
+TEST(LocalCryptographyProvider, AesWrapUnwrap)
+{
+  auto const provider = LocalCryptographyProviderFactory::Create(CreateOctKey(), KeyProperties());
+  ASSERT_NE(provider, nullptr);
+  EXPECT_TRUE(provider->SupportsOperation(KeyOperation::WrapKey));
+  EXPECT_TRUE(provider->SupportsOperation(KeyOperation::UnwrapKey));
+
+  std::vector<uint8_t> const key
+      = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb,
+         0xcc, 0xdd, 0xee, 0xff};
+  std::vector<uint8_t> const encryptedKey
+      = {0x1f, 0xa6, 0x8b, 0x0a, 0x81, 0x12, 0xb4, 0x47, 0xae, 0xf3, 0x4b, 0xd8,
+         0xfb, 0x5a, 0x7b, 0x82, 0x9d, 0x3e, 0x86, 0x23, 0x71, 0xd2, 0xcf, 0xe5};
+
+  auto const context = Azure::Core::Context();
+#if defined(AZ_PLATFORM_WINDOWS)
+  EXPECT_TRUE(provider->WrapKey(KeyWrapAlgorithm::A128KW, key, context).EncryptedKey.empty());
+#else
+  auto const wrapResult = provider->WrapKey(KeyWrapAlgorithm::A128KW, key, context);
+  EXPECT_EQ(wrapResult.EncryptedKey, encryptedKey);
+  EXPECT_EQ(wrapResult.KeyId, "https://vault.azure.net/keys/oct/1");
+
+  auto const unwrapResult = provider->UnwrapKey(KeyWrapAlgorithm::A128KW, encryptedKey, context);
+  EXPECT_EQ(unwrapResult.Key, key);
+
+  auto tamperedKey = encryptedKey;
+  tamperedKey[0] ^= 0x01;
+  EXPECT_THROW(
+      provider->UnwrapKey(KeyWrapAlgorithm::A128KW, tamperedKey, context), std::runtime_error);
+#endif
+
+  // The key doesn't match the size of the algorithm, it's left to the remote client.
+  EXPECT_TRUE(provider->WrapKey(KeyWrapAlgorithm::A256KW, key, context).EncryptedKey.empty());
+}
+
+TEST(LocalCryptographyProvider, RsaVerify)
+{
+  auto const provider = LocalCryptographyProviderFactory::Create(CreateRsaKey(), KeyProperties());
+  ASSERT_NE(provider, nullptr);
+
+  auto const context = Azure::Core::Context();
+#if defined(AZ_PLATFORM_WINDOWS)
+  EXPECT_TRUE(
+      provider->Verify(SignatureAlgorithm::RS256, RsaDigest, RsaPkcs1Signature, context)
+          .KeyId.empty());
+#else
+  // The same prepared contexts are used by every verification.
+  for (int i = 0; i < 2; ++i)
+  {
+    auto result
+        = provider->Verify(SignatureAlgorithm::RS256, RsaDigest, RsaPkcs1Signature, context);
+    EXPECT_EQ(result.KeyId, "https://vault.azure.net/keys/rsa/1");
+    EXPECT_TRUE(result.IsValid);
+    result = provider->Verify(SignatureAlgorithm::PS256, RsaDigest, RsaPssSignature, context);
+    EXPECT_TRUE(result.IsValid);
+  }
+
+  auto tamperedSignature = RsaPkcs1Signature;
+  tamperedSignature[10] ^= 0x01;
+  EXPECT_FALSE(provider->Verify(SignatureAlgorithm::RS256, RsaDigest, tamperedSignature, context)
+                   .IsValid);
+  EXPECT_FALSE(provider->Verify(SignatureAlgorithm::PS256, RsaDigest, RsaPkcs1Signature, context)
+                   .IsValid);
+#endif
+
+  // The digest doesn't match the size of the algorithm, it's left to the remote client.
+  EXPECT_TRUE(provider->Verify(SignatureAlgorithm::RS384, RsaDigest, RsaPkcs1Signature, context)
+                  .KeyId.empty());
+}
+
+TEST(LocalCryptographyProvider, RsaEncrypt)
+{
+  auto const provider = LocalCryptographyProviderFactory::Create(CreateRsaKey(), KeyProperties());
+  ASSERT_NE(provider, nullptr);
+
+  auto const context = Azure::Core::Context();
+  auto const parameters = EncryptParameters::RsaOaep256Parameters(RsaDigest);
+#if defined(AZ_PLATFORM_WINDOWS)
+  EXPECT_TRUE(provider->Encrypt(parameters, context).Ciphertext.empty());
+#else
+  auto const first = provider->Encrypt(parameters, context);
+  EXPECT_EQ(first.KeyId, "https://vault.azure.net/keys/rsa/1");
+  EXPECT_EQ(first.Algorithm, EncryptionAlgorithm::RsaOaep256);
+  EXPECT_EQ(first.Ciphertext.size(), 256U);
+  // The padding is random.
+  EXPECT_NE(provider->Encrypt(parameters, context).Ciphertext, first.Ciphertext);
+
+  auto const wrapResult = provider->WrapKey(KeyWrapAlgorithm::Rsa15, RsaDigest, context);
+  EXPECT_EQ(wrapResult.EncryptedKey.size(), 256U);
+  EXPECT_EQ(wrapResult.KeyId, "https://vault.azure.net/keys/rsa/1");
+#endif
+
+  // Decryption needs the private key, it's left to the remote client.
+  auto const decryptParameters
+      = DecryptParameters::RsaOaep256Parameters(std::vector<uint8_t>(256));
+  EXPECT_TRUE(provider->Decrypt(decryptParameters, context).Plaintext.empty());
+}
@@ -12,6 +12,8 @@
 #include <azure/core/internal/strings.hpp>
 #include <azure/keyvault/key_vault_keys.hpp>
 
+#include <exception>
+#include <future>
 #include <string>
 using namespace Azure::Security::KeyVault::Keys;
 using namespace Azure::Security::KeyVault::Keys::Test;
@@ -166,3 +168,31 @@ TEST_F(MockedTransportAdapterTest, GetPropertiesOfKeys)
   auto response = m_client->GetPropertiesOfKeys();
   EXPECT_NE(response.RawResponse, nullptr);
 }
+
+TEST_F(MockedTransportAdapterTest, GetKeyAsync)
+{
+  std::string applicationId("CreateKeyEC");
+  m_clientOptions.Telemetry.ApplicationId = applicationId;
+  m_client = std::make_unique<
+      Azure::Security::KeyVault::Keys::Test::KeyClientWithNoAuthenticationPolicy>(
+      "url", m_clientOptions);
+
+  // The result is got through a future, as a caller without coroutines would.
+  std::promise<KeyVaultKey> key;
+  m_client->GetKeyAsync(
+      "name",
+      GetKeyOptions(),
+      Azure::Core::Context(),
+      [&](Azure::Nullable<Azure::Response<KeyVaultKey>> response, std::exception_ptr error) {
+        if (error)
+        {
+          key.set_exception(error);
+          return;
+        }
+        key.set_value(std::move(response.Value().Value));
+      });
+
+  auto value = key.get_future().get();
+  EXPECT_EQ(value.Name(), "CreateSoftKeyTest");
+  EXPECT_EQ(value.GetKeyType(), KeyVaultKeyType::Ec);
+}
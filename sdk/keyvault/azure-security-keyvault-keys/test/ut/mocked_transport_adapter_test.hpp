@@ -47,7 +47,7 @@ namespace Azure { namespace Security { namespace KeyVault { namespace Keys { nam
       {
         response->SetHeader(header.first, header.second);
       }
-      auto updatedFakeKey = UpdateFakeKey(_detail::FakeKey, request.GetHeaders()["user-agent"]);
+      auto updatedFakeKey = UpdateFakeKey(_detail::FakeKey, request.GetHeaders().at("user-agent"));
       std::string bodyCount(updatedFakeKey);
       response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(
           reinterpret_cast<const uint8_t*>(updatedFakeKey), bodyCount.size()));
@@ -0,0 +1,150 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "./../../src/private/key_material_cache.hpp"
+#include "./../../src/private/unwrapped_key_cache.hpp"
+
+#include <azure/core/platform.hpp>
+#include <azure/keyvault/keys/cryptography/cryptography_client.hpp>
+#include <azure/keyvault/keys/internal/cryptography/local_cryptography_provider_factory.hpp>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace Azure::Security::KeyVault::Keys;
+using namespace Azure::Security::KeyVault::Keys::Cryptography;
+using namespace Azure::Security::KeyVault::Keys::Cryptography::_detail;
+
+namespace {
+UnwrapResult CreateResult(size_t keySize)
+{
+  UnwrapResult result;
+  result.KeyId = "https://vault.azure.net/keys/oct/1";
+  result.Key = std::vector<uint8_t>(keySize, 0x01);
+  result.Algorithm = KeyWrapAlgorithm::A128KW;
+  return result;
+}
+
+class NoCredential final : public Azure::Core::Credentials::TokenCredential {
+public:
+  Azure::Core::Credentials::AccessToken GetToken(
+      Azure::Core::Credentials::TokenRequestContext const&,
+      Azure::Core::Context const&) const override
+  {
+    throw Azure::Core::Credentials::AuthenticationException("No token in unit tests.");
+  }
+};
+} // namespace
+
+TEST(UnwrappedKeyCache, ReuseWithinDuration)
+{
+  using namespace std::chrono_literals;
+  UnwrappedKeyCache cache(10ms, 1024);
+
+  std::vector<uint8_t> const encryptedKey(24, 0x02);
+  UnwrapResult result;
+  EXPECT_FALSE(cache.TryGet(KeyWrapAlgorithm::A128KW, encryptedKey, result));
+
+  cache.Add(KeyWrapAlgorithm::A128KW, encryptedKey, CreateResult(16));
+  EXPECT_TRUE(cache.TryGet(KeyWrapAlgorithm::A128KW, encryptedKey, result));
+  EXPECT_EQ(result.Key, std::vector<uint8_t>(16, 0x01));
+  EXPECT_EQ(result.KeyId, "https://vault.azure.net/keys/oct/1");
+  // The algorithm is part of the key of the cache.
+  EXPECT_FALSE(cache.TryGet(KeyWrapAlgorithm::A256KW, encryptedKey, result));
+
+  std::this_thread::sleep_for(20ms);
+  EXPECT_FALSE(cache.TryGet(KeyWrapAlgorithm::A128KW, encryptedKey, result));
+}
+
+TEST(UnwrappedKeyCache, EvictLeastRecentlyUsed)
+{
+  using namespace std::chrono_literals;
+  // Each entry takes the algorithm, a separator, 24 bytes of encrypted key and 16 bytes of key.
+  size_t const entrySize = KeyWrapAlgorithm::A128KW.ToString().size() + 1 + 24 + 16;
+  UnwrappedKeyCache cache(1h, entrySize * 2);
+
+  std::vector<uint8_t> const first(24, 0x01);
+  std::vector<uint8_t> const second(24, 0x02);
+  std::vector<uint8_t> const third(24, 0x03);
+  UnwrapResult result;
+  cache.Add(KeyWrapAlgorithm::A128KW, first, CreateResult(16));
+  cache.Add(KeyWrapAlgorithm::A128KW, second, CreateResult(16));
+  EXPECT_TRUE(cache.TryGet(KeyWrapAlgorithm::A128KW, first, result));
+
+  cache.Add(KeyWrapAlgorithm::A128KW, third, CreateResult(16));
+  EXPECT_TRUE(cache.TryGet(KeyWrapAlgorithm::A128KW, first, result));
+  EXPECT_FALSE(cache.TryGet(KeyWrapAlgorithm::A128KW, second, result));
+  EXPECT_TRUE(cache.TryGet(KeyWrapAlgorithm::A128KW, third, result));
+
+  // An entry larger than the cache isn't cached.
+  cache.Add(KeyWrapAlgorithm::A128KW, second, CreateResult(entrySize * 2));
+  EXPECT_FALSE(cache.TryGet(KeyWrapAlgorithm::A128KW, second, result));
+  EXPECT_TRUE(cache.TryGet(KeyWrapAlgorithm::A128KW, first, result));
+}
+
+TEST(CryptographyClient, WrapUnwrapKeys)
+{
+  using namespace std::chrono_literals;
+  std::string const keyId = "https://vault.azure.net/keys/oct/1";
+  // The key of the client is already cached, so it's never got from Key Vault.
+  KeyMaterialCache::Clear();
+  KeyMaterialCache::GetProvider(keyId, 1h, [&]() -> std::shared_ptr<CryptographyProvider> {
+    JsonWebKey key;
+    key.Id = keyId;
+    key.KeyType = KeyVaultKeyType::Oct;
+    key.K = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+             0x0c, 0x0d, 0x0e, 0x0f};
+    key.SetKeyOperations({KeyOperation::WrapKey, KeyOperation::UnwrapKey});
+    return LocalCryptographyProviderFactory::Create(key, KeyProperties());
+  });
+
+  CryptographyClientOptions options;
+  options.UnwrappedKeyCacheDuration = 1h;
+  CryptographyClient client(keyId, std::make_shared<NoCredential>(), options);
+
+  std::vector<std::vector<uint8_t>> keys;
+  for (uint8_t i = 0; i < 20; ++i)
+  {
+    keys.push_back(std::vector<uint8_t>(16, i));
+  }
+  KeyWrapBatchOptions batchOptions;
+  batchOptions.Concurrency = 4;
+
+#if defined(AZ_PLATFORM_WINDOWS)
+  // Local key wrapping isn't available, the client would call Key Vault.
+  (void)client;
+  (void)batchOptions;
+#else
+  auto const wrapResults = client.WrapKeys(KeyWrapAlgorithm::A128KW, keys, batchOptions);
+  ASSERT_EQ(wrapResults.size(), keys.size());
+  std::vector<std::vector<uint8_t>> encryptedKeys;
+  for (auto const& wrapResult : wrapResults)
+  {
+    EXPECT_EQ(wrapResult.EncryptedKey.size(), 24U);
+    encryptedKeys.push_back(wrapResult.EncryptedKey);
+  }
+
+  for (int i = 0; i < 2; ++i)
+  {
+    auto const unwrapResults
+        = client.UnwrapKeys(KeyWrapAlgorithm::A128KW, encryptedKeys, batchOptions);
+    ASSERT_EQ(unwrapResults.size(), keys.size());
+    for (size_t j = 0; j < keys.size(); ++j)
+    {
+      EXPECT_EQ(unwrapResults[j].Key, keys[j]);
+    }
+  }
+
+  // The first failure is thrown.
+  encryptedKeys[5][0] ^= 0x01;
+  EXPECT_THROW(
+      client.UnwrapKeys(KeyWrapAlgorithm::A128KW, encryptedKeys, batchOptions), std::exception);
+#endif
+
+  EXPECT_TRUE(client.WrapKeys(KeyWrapAlgorithm::A128KW, {}, batchOptions).empty());
+  KeyMaterialCache::Clear();
+}
@@ -9,11 +9,20 @@
 #pragma once
 
 #include "azure/storage/blobs/append_blob_client.hpp"
+#include "azure/storage/blobs/append_blob_tail_reader.hpp"
+#include "azure/storage/blobs/append_blob_writer.hpp"
+#include "azure/storage/blobs/blob_batch_client.hpp"
 #include "azure/storage/blobs/blob_client.hpp"
 #include "azure/storage/blobs/blob_container_client.hpp"
+#include "azure/storage/blobs/blob_content_cache.hpp"
 #include "azure/storage/blobs/blob_lease_client.hpp"
+#include "azure/storage/blobs/blob_properties_cache.hpp"
+#include "azure/storage/blobs/blob_random_access_reader.hpp"
 #include "azure/storage/blobs/blob_sas_builder.hpp"
 #include "azure/storage/blobs/blob_service_client.hpp"
 #include "azure/storage/blobs/block_blob_client.hpp"
+#include "azure/storage/blobs/client_side_encryption.hpp"
 #include "azure/storage/blobs/dll_import_export.hpp"
 #include "azure/storage/blobs/page_blob_client.hpp"
+#include "azure/storage/blobs/sharded_blob_container_client.hpp"
+#include "azure/storage/blobs/user_delegation_key_cache.hpp"
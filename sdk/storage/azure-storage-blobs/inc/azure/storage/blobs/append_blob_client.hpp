@@ -173,6 +173,7 @@ namespace Azure { namespace Storage { namespace Blobs {
   private:
     explicit AppendBlobClient(BlobClient blobClient);
     friend class BlobClient;
+    friend class BlobContainerClient;
   };
 
 }}} // namespace Azure::Storage::Blobs
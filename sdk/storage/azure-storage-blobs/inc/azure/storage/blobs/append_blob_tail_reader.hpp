@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <azure/core/context.hpp>
+#include <azure/core/etag.hpp>
+#include <azure/core/io/shared_buffer.hpp>
+
+#include "azure/storage/blobs/append_blob_client.hpp"
+#include "azure/storage/blobs/blob_options.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  /**
+   * @brief AppendBlobTailReader follows an append blob, and passes the bytes appended to it to a
+   * handler in order.
+   *
+   * @remark Each poll is a single ranged download from the end of the bytes read. Once they're
+   * all read, it's conditioned on the ETag of the blob, so the service answers polls of an
+   * unchanged blob with no content. The delay between two polls halves down to `MinPollInterval`
+   * while bytes are appended, and doubles up to `MaxPollInterval` while they aren't. A failed
+   * poll is passed to the error handler, and retried after `MaxPollInterval`.
+   */
+  class AppendBlobTailReader final {
+  public:
+    /**
+     * @brief A function receiving the bytes appended, from an offset in the blob. It's called by
+     * the thread of the reader, which doesn't poll until it returns. If it throws, the exception
+     * is passed to the error handler, and the bytes aren't passed again.
+     */
+    using DataHandler = std::function<void(int64_t offset, Azure::Core::IO::SharedBuffer data)>;
+
+    /**
+     * @brief A function receiving the error of a failed poll.
+     */
+    using ErrorHandler = std::function<void(std::exception_ptr error)>;
+
+    /**
+     * @brief Initializes a new instance of the AppendBlobTailReader, which starts the thread
+     * polling the blob.
+     *
+     * @param appendBlobClient An AppendBlobClient representing the append blob to follow.
+     * @param onData The function receiving the bytes appended.
+     * @param onError The function receiving the errors, if not null.
+     * @param options Optional parameters of the reader.
+     */
+    explicit AppendBlobTailReader(
+        AppendBlobClient appendBlobClient,
+        DataHandler onData,
+        ErrorHandler onError = ErrorHandler(),
+        const AppendBlobTailReaderOptions& options = AppendBlobTailReaderOptions());
+
+    /**
+     * @brief Stops polling, see #Stop.
+     */
+    ~AppendBlobTailReader();
+
+    AppendBlobTailReader(const AppendBlobTailReader&) = delete;
+    AppendBlobTailReader& operator=(const AppendBlobTailReader&) = delete;
+
+    /**
+     * @brief Gets the offset in the blob the next bytes passed to the handler start from.
+     *
+     * @return The offset, after all the bytes passed to the handler.
+     */
+    int64_t GetOffset();
+
+    /**
+     * @brief Stops polling, and waits for the poll in progress. Must not be called from a
+     * handler.
+     */
+    void Stop();
+
+  private:
+    // Downloads the bytes appended from m_offset. Returns whether any were.
+    bool Poll();
+    void RunPolls();
+
+    AppendBlobClient m_appendBlobClient;
+    DataHandler m_onData;
+    ErrorHandler m_onError;
+    AppendBlobTailReaderOptions m_options;
+    // Cancelled when the reader is stopped.
+    Azure::Core::Context m_pollContext;
+    // The ETag of the blob once all of its bytes are read, to poll it with If-None-Match.
+    Azure::ETag m_readETag;
+    // Whether the blob has more bytes than the last poll downloaded.
+    bool m_hasMore = false;
+
+    // Guards the variables below.
+    std::mutex m_mutex;
+    std::condition_variable m_stateChanged;
+    int64_t m_offset;
+    bool m_stopping = false;
+
+    std::thread m_pollThread;
+  };
+
+}}} // namespace Azure::Storage::Blobs
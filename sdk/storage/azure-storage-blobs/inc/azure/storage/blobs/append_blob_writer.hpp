@@ -0,0 +1,114 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <azure/core/nullable.hpp>
+
+#include "azure/storage/blobs/append_blob_client.hpp"
+#include "azure/storage/blobs/blob_options.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  /**
+   * @brief AppendBlobWriter appends the writes of many threads to an append blob with group
+   * commit: the writes queued while a block is in flight coalesce into the next block, up to the
+   * maximum block size, so the number of blocks and of round trips doesn't grow with the number of
+   * writes.
+   *
+   * @remark Each block is appended with an append position condition, so pipelined blocks can't
+   * be committed out of order. A block reaching the service before the previous one is sent again
+   * once the previous one is committed. After a failed block, the writes not committed yet fail
+   * too.
+   */
+  class AppendBlobWriter final {
+  public:
+    /**
+     * @brief Initializes a new instance of the AppendBlobWriter.
+     *
+     * @param appendBlobClient An AppendBlobClient representing the append blob to write, which
+     * must exist.
+     * @param options Optional parameters of the writer.
+     */
+    explicit AppendBlobWriter(
+        AppendBlobClient appendBlobClient,
+        const AppendBlobWriterOptions& options = AppendBlobWriterOptions());
+
+    /**
+     * @brief Waits for all the writes to be committed.
+     */
+    ~AppendBlobWriter();
+
+    AppendBlobWriter(const AppendBlobWriter&) = delete;
+    AppendBlobWriter& operator=(const AppendBlobWriter&) = delete;
+
+    /**
+     * @brief Queues data to be appended after the data of the previous writes. Can be called from
+     * several threads at the same time.
+     *
+     * @param data The data to write, copied before the function returns.
+     * @param size The size of the data in bytes.
+     * @return A future which becomes ready once the data is committed to the blob, or holds the
+     * exception the data failed to be appended with.
+     */
+    std::future<void> Write(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Waits for all the writes queued so far to be committed, and throws the exception of
+     * the first failed block if any.
+     */
+    void Flush();
+
+  private:
+    struct PendingWrite final
+    {
+      std::vector<uint8_t> Data;
+      // The number of bytes already taken by a block.
+      size_t Offset = 0;
+      std::promise<void> Committed;
+    };
+
+    struct Block final
+    {
+      std::vector<uint8_t> Data;
+      // Null if the block is appended before the size of the blob is known.
+      Azure::Nullable<int64_t> Offset;
+      // The writes ending in this block.
+      std::vector<std::promise<void>> Committed;
+    };
+
+    // Starts the blocks allowed by the options. Must be called with m_mutex locked.
+    void StartBlocks();
+    // Submits again the parked blocks which are next, or fails them after an error. Must be
+    // called with m_mutex locked.
+    void ResendBlocks();
+    void AppendBlock(const std::shared_ptr<Block>& block);
+
+    AppendBlobClient m_appendBlobClient;
+    AppendBlobWriterOptions m_options;
+
+    // Guards the variables below.
+    std::mutex m_mutex;
+    std::condition_variable m_blockFinished;
+    std::deque<PendingWrite> m_pendingWrites;
+    int64_t m_pendingSize = 0;
+    // Where the next block is appended, and the end of the committed blocks, once known.
+    Azure::Nullable<int64_t> m_nextOffset;
+    Azure::Nullable<int64_t> m_committedOffset;
+    int32_t m_numAppending = 0;
+    // The blocks which reached the service before the previous one, waiting for it to be
+    // committed.
+    std::vector<std::shared_ptr<Block>> m_blocksToResend;
+    std::exception_ptr m_error;
+  };
+
+}}} // namespace Azure::Storage::Blobs
@@ -0,0 +1,162 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <azure/core/credentials/credentials.hpp>
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/core/url.hpp>
+#include <azure/storage/common/storage_credential.hpp>
+
+#include "azure/storage/blobs/blob_options.hpp"
+#include "azure/storage/blobs/blob_responses.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  /**
+   * @brief A batch of sub-requests to be submitted in a single request with
+   * #Azure::Storage::Blobs::BlobBatchClient::SubmitBatch.
+   */
+  class BlobBatch final {
+  public:
+    /**
+     * @brief The maximum number of sub-requests in a batch.
+     */
+    constexpr static int32_t MaxSubRequests = 256;
+
+    /**
+     * @brief Adds a sub-request to delete a blob.
+     *
+     * @param blobContainerName The name of the container containing the blob to delete.
+     * @param blobName The name of the blob to delete.
+     * @param options Optional parameters to execute this function.
+     * @return An index of this sub-request in
+     * #Azure::Storage::Blobs::Models::SubmitBlobBatchResult::DeleteBlobResults.
+     */
+    int32_t DeleteBlob(
+        const std::string& blobContainerName,
+        const std::string& blobName,
+        const DeleteBlobOptions& options = DeleteBlobOptions());
+
+    /**
+     * @brief Adds a sub-request to set the tier of a blob.
+     *
+     * @param blobContainerName The name of the container containing the blob to set the tier of.
+     * @param blobName The name of the blob to set the tier of.
+     * @param tier Indicates the tier to be set on the blob.
+     * @param options Optional parameters to execute this function.
+     * @return An index of this sub-request in
+     * #Azure::Storage::Blobs::Models::SubmitBlobBatchResult::SetBlobAccessTierResults.
+     */
+    int32_t SetBlobAccessTier(
+        const std::string& blobContainerName,
+        const std::string& blobName,
+        Models::AccessTier tier,
+        const SetBlobAccessTierOptions& options = SetBlobAccessTierOptions());
+
+  private:
+    friend class BlobBatchClient;
+
+    struct DeleteBlobSubRequest final
+    {
+      std::string BlobContainerName;
+      std::string BlobName;
+      DeleteBlobOptions Options;
+    };
+
+    struct SetBlobAccessTierSubRequest final
+    {
+      std::string BlobContainerName;
+      std::string BlobName;
+      Models::AccessTier Tier;
+      SetBlobAccessTierOptions Options;
+    };
+
+    std::vector<DeleteBlobSubRequest> m_deleteBlobSubRequests;
+    std::vector<SetBlobAccessTierSubRequest> m_setBlobAccessTierSubRequests;
+  };
+
+  /**
+   * The BlobBatchClient allows you to submit up to 256 delete or set access tier operations on the
+   * blobs of a storage account in a single request, sparing a round trip for each of them.
+   */
+  class BlobBatchClient final {
+  public:
+    /**
+     * @brief Initialize a new instance of BlobBatchClient.
+     *
+     * @param connectionString A connection string includes the authentication information required
+     * for your application to access data in an Azure Storage account at runtime.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     * @return A new BlobBatchClient instance.
+     */
+    static BlobBatchClient CreateFromConnectionString(
+        const std::string& connectionString,
+        const BlobClientOptions& options = BlobClientOptions());
+
+    /**
+     * @brief Initialize a new instance of BlobBatchClient.
+     *
+     * @param serviceUrl A URL referencing the blob service that includes the name of the account.
+     * @param credential The shared key credential used to sign the batch and its sub-requests.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     */
+    explicit BlobBatchClient(
+        const std::string& serviceUrl,
+        std::shared_ptr<StorageSharedKeyCredential> credential,
+        const BlobClientOptions& options = BlobClientOptions());
+
+    /**
+     * @brief Initialize a new instance of BlobBatchClient.
+     *
+     * @param serviceUrl A URL referencing the blob service that includes the name of the account.
+     * @param credential The token credential used to sign the batch and its sub-requests.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     */
+    explicit BlobBatchClient(
+        const std::string& serviceUrl,
+        std::shared_ptr<Core::Credentials::TokenCredential> credential,
+        const BlobClientOptions& options = BlobClientOptions());
+
+    /**
+     * @brief Initialize a new instance of BlobBatchClient.
+     *
+     * @param serviceUrl A URL referencing the blob service that includes the name of the account,
+     * and possibly also a SAS token.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     */
+    explicit BlobBatchClient(
+        const std::string& serviceUrl,
+        const BlobClientOptions& options = BlobClientOptions());
+
+    /**
+     * @brief Submits a batch of sub-requests in a single multipart request.
+     *
+     * @param batch The batch of sub-requests.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A SubmitBlobBatchResult containing the responses of the sub-requests.
+     * @remark The sub-requests are executed in no particular order, and a failed sub-request
+     * doesn't fail the other ones.
+     */
+    Azure::Response<Models::SubmitBlobBatchResult> SubmitBatch(
+        const BlobBatch& batch,
+        const SubmitBlobBatchOptions& options = SubmitBlobBatchOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+  private:
+    Azure::Core::Url m_serviceUrl;
+    std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    // Signs the sub-requests without sending them.
+    std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_subRequestPipeline;
+  };
+
+}}} // namespace Azure::Storage::Blobs
@@ -4,10 +4,13 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include <azure/core/async_response.hpp>
 #include <azure/core/credentials/credentials.hpp>
 #include <azure/storage/common/storage_credential.hpp>
 
@@ -247,6 +250,23 @@ namespace Azure { namespace Storage { namespace Blobs {
         const DownloadBlobOptions& options = DownloadBlobOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Downloads a blob or a blob range from the service, without waiting for the response.
+     *
+     * @remark \p callback is called once the properties of the blob are received, and the
+     * content is read from the body stream of the result. The calling thread is only blocked by
+     * the policies and the transport without an asynchronous implementation. The prefetch
+     * options aren't supported. Use Azure::Core::ResponseAwaitable to `co_await` the download.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @param callback The function called with the DownloadBlobResult, or with the error.
+     */
+    void DownloadAsync(
+        const DownloadBlobOptions& options,
+        const Azure::Core::Context& context,
+        Azure::Core::ResponseCallback<Models::DownloadBlobResult> callback) const;
+
     /**
      * @brief Downloads a blob or a blob range from the service to a memory buffer using parallel
      * requests.
@@ -278,6 +298,60 @@ namespace Azure { namespace Storage { namespace Blobs {
         const DownloadBlobToOptions& options = DownloadBlobToOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Downloads a blob or a blob range from the service using parallel requests, and passes
+     * its content in order to a sink.
+     *
+     * @remark Chunks downloaded ahead of the ones not yet passed to \p sink are held in memory,
+     * up to Concurrency chunks of ChunkSize bytes. The content isn't staged in a buffer of the size
+     * of the blob, it suits blobs piped into a decompressor or a socket. Chunks always have
+     * ChunkSize bytes, the Strategy of the transfer options isn't used.
+     *
+     * @param sink Called with consecutive pieces of the blob content, from one thread at a time.
+     * An exception thrown by the sink stops the download and is rethrown.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A DownloadBlobToResult describing the downloaded blob.
+     */
+    Azure::Response<Models::DownloadBlobToResult> DownloadTo(
+        const std::function<void(const uint8_t* data, size_t size)>& sink,
+        const DownloadBlobToOptions& options = DownloadBlobToOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Downloads several ranges of a blob using parallel requests. Ranges close to each
+     * other are merged into a single request.
+     *
+     * @remark The ranges are downloaded from the same version of the blob. Unless IfMatch is set
+     * in the access conditions, the request with the lowest offset is sent first, and the others
+     * are conditioned on the ETag it returned. Ranges ending beyond the end of the blob are
+     * truncated.
+     *
+     * @param ranges The ranges to download, with their lengths. They may overlap.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A DownloadBlobRangesResult with the content of each range.
+     */
+    Azure::Response<Models::DownloadBlobRangesResult> DownloadRanges(
+        const std::vector<Core::Http::HttpRange>& ranges,
+        const DownloadBlobRangesOptions& options = DownloadBlobRangesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Selects records of a blob with a SQL expression, which is evaluated by the service.
+     * Only the selected records are transferred.
+     *
+     * @param querySqlExpression The SQL expression selecting the records.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A QueryBlobResult describing the queried blob. QueryBlobResult.BodyStream contains
+     * the selected records, decoded from the response while they are read.
+     */
+    Azure::Response<Models::QueryBlobResult> Query(
+        const std::string& querySqlExpression,
+        const QueryBlobOptions& options = QueryBlobOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Creates a read-only snapshot of a blob.
      *
@@ -350,24 +424,88 @@ namespace Azure { namespace Storage { namespace Blobs {
         const GetBlobTagsOptions& options = GetBlobTagsOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Gets the bytes transferred by the parallel uploads and downloads of this client and
+     * of its copies.
+     *
+     * @return The transfer statistics of the client.
+     */
+    TransferStatistics GetTransferStatistics() const
+    {
+      return m_transferCounters->GetStatistics();
+    }
+
   protected:
     Azure::Core::Url m_blobUrl;
     std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    // The same pipeline without the credential of the client, for the requests to source blobs
+    // which are authorized by their URL.
+    std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_sourcePipeline;
     Azure::Nullable<EncryptionKey> m_customerProvidedKey;
     Azure::Nullable<std::string> m_encryptionScope;
+    std::shared_ptr<TransferScheduler> m_transferScheduler;
+    std::shared_ptr<BufferPool> m_bufferPool;
+    std::shared_ptr<BlobPropertiesCache> m_propertiesCache;
+    std::shared_ptr<_internal::TransferCounters> m_transferCounters
+        = std::make_shared<_internal::TransferCounters>();
 
   private:
     explicit BlobClient(
         Azure::Core::Url blobUrl,
         std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline,
         Azure::Nullable<EncryptionKey> customerProvidedKey = Azure::Nullable<EncryptionKey>(),
-        Azure::Nullable<std::string> encryptionScope = Azure::Nullable<std::string>())
+        Azure::Nullable<std::string> encryptionScope = Azure::Nullable<std::string>(),
+        std::shared_ptr<TransferScheduler> transferScheduler = nullptr,
+        std::shared_ptr<BufferPool> bufferPool = nullptr,
+        std::shared_ptr<BlobPropertiesCache> propertiesCache = nullptr,
+        std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> sourcePipeline = nullptr)
         : m_blobUrl(std::move(blobUrl)), m_pipeline(std::move(pipeline)),
+          m_sourcePipeline(std::move(sourcePipeline)),
           m_customerProvidedKey(std::move(customerProvidedKey)),
-          m_encryptionScope(std::move(encryptionScope))
+          m_encryptionScope(std::move(encryptionScope)),
+          m_transferScheduler(std::move(transferScheduler)), m_bufferPool(std::move(bufferPool)),
+          m_propertiesCache(std::move(propertiesCache))
     {
     }
 
+    Azure::Response<Models::DownloadBlobResult> DownloadWithPrefetch(
+        const DownloadBlobOptions& options,
+        const Azure::Core::Context& context) const;
+
+    _detail::BlobRestClient::Blob::DownloadBlobOptions GetDownloadProtocolLayerOptions(
+        const DownloadBlobOptions& options) const;
+
+    // Makes the body stream of a download retry on network failures, and fills the properties
+    // the service omits.
+    void CompleteDownloadResponse(
+        Azure::Response<Models::DownloadBlobResult>& downloadResponse,
+        const DownloadBlobOptions& options) const;
+
+    // Downloads a blob encrypted on the client in parallel. The size of the decrypted content is
+    // passed to sizeFunc, then the decrypted chunks to writeFunc, with their offsets, from the
+    // transfer threads.
+    Azure::Response<Models::DownloadBlobToResult> DownloadDecryptedTo(
+        const std::function<void(int64_t size)>& sizeFunc,
+        const std::function<void(const uint8_t* data, size_t size, int64_t offset)>& writeFunc,
+        const DownloadBlobToOptions& options,
+        const Azure::Core::Context& context) const;
+
+    // Serves a DownloadTo from the content cache of its options. The size of the content is
+    // passed to sizeFunc, then the content to writeFunc, with its offsets. Returns null if the blob
+    // isn't cached, or was changed since it was cached.
+    std::unique_ptr<Azure::Response<Models::DownloadBlobToResult>> DownloadFromContentCache(
+        const std::function<void(int64_t size)>& sizeFunc,
+        const std::function<void(const uint8_t* data, size_t size, int64_t offset)>& writeFunc,
+        const DownloadBlobToOptions& options,
+        const Azure::Core::Context& context) const;
+
+    // Caches the content of a DownloadTo in the content cache of its options, written to a file
+    // by writeFunc.
+    void StoreInContentCache(
+        const Models::DownloadBlobToResult& result,
+        const std::function<void(const std::string& fileName)>& writeFunc,
+        const DownloadBlobToOptions& options) const;
+
     friend class BlobContainerClient;
     friend class Files::DataLake::DataLakeFileSystemClient;
     friend class Files::DataLake::DataLakeDirectoryClient;
@@ -4,8 +4,13 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
+
+#include <azure/storage/common/bulk_operation.hpp>
 
 #include "azure/storage/blobs/blob_client.hpp"
 
@@ -212,6 +217,55 @@ namespace Azure { namespace Storage { namespace Blobs {
         const ListBlobsOptions& options = ListBlobsOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Returns a sequence of blobs in this container, like ListBlobs(), but only
+     * deserializes the requested fields of the blobs, into compact items. The strings of a page
+     * are kept together in one buffer, so a page takes a few allocations instead of several for
+     * each blob.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A ListBlobsCompactPagedResponse describing the blobs in the container.
+     */
+    ListBlobsCompactPagedResponse ListBlobsCompact(
+        const ListBlobsCompactOptions& options = ListBlobsCompactOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Returns a sequence of blobs in this container, like ListBlobs(), but deserializes the
+     * blobs of each page while the page is received. The first blobs are available before the
+     * rest of the page arrives, and only the blob being read is kept in memory, whatever the
+     * page size.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations. It also cancels reading the
+     * blobs of the first page.
+     * @return A ListBlobsPageStream reading the blobs in the container.
+     */
+    ListBlobsPageStream ListBlobsStreaming(
+        const ListBlobsOptions& options = ListBlobsOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Lists the blobs in this container with several concurrent sequences of requests,
+     * instead of one request after the other. The blobs are partitioned by the virtual
+     * directories discovered with ListBlobsByHierarchy(), up to PartitionDepth levels deep, and
+     * the partitions are listed concurrently.
+     *
+     * @remark Blobs are passed page by page, in no particular order across partitions.
+     * \p pageReceivedFunc is called by one thread at a time. Blobs outside of any virtual
+     * directory only make one partition, so a container without delimiters in its blob names is
+     * listed serially.
+     *
+     * @param pageReceivedFunc Called with each page of blobs.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     */
+    void ListBlobsParallel(
+        const std::function<void(std::vector<Models::BlobItem>)>& pageReceivedFunc,
+        const ListBlobsParallelOptions& options = ListBlobsParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Returns a collection of blobs in this container. Enumerating the blobs may make
      * multiple requests to the service while fetching all the values. Blobs are ordered
@@ -285,20 +339,72 @@ namespace Azure { namespace Storage { namespace Blobs {
         const UploadBlockBlobOptions& options = UploadBlockBlobOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Uploads local files as block blobs of this container, keeping up to Concurrency
+     * uploads in flight. Meant for many small files, whose uploads are dominated by the cost of
+     * a request rather than by the size of their content.
+     *
+     * @remark The uploads run on the transfer threads of the client and share its connections.
+     * Each one reads its file in memory, then sends it with a single request, so the files are
+     * read while the others are sent. An upload failing doesn't stop the others.
+     *
+     * @param files The name of each file, and the name of the blob it's uploaded to.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A BulkOperationResult with the error of each upload, in the order of \p files.
+     */
+    BulkOperationResult UploadFiles(
+        const std::vector<std::pair<std::string, std::string>>& files,
+        const UploadBlobFilesOptions& options = UploadBlobFilesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Synchronizes the blobs under a virtual directory of this container with a local
+     * directory, uploading only the files whose blob is missing or different.
+     *
+     * @remark The local directory is walked while the blobs are listed. A file is the same as its
+     * blob if they have the same size and the blob has the last write time of the file, recorded
+     * in its metadata when it was uploaded. Otherwise, if the blob has an MD5, the file is the
+     * same if it has the same MD5, and the metadata of the blob is updated. The files changing
+     * during the synchronization may be uploaded or not.
+     *
+     * @param localDirectoryName The local directory to synchronize from.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A SyncBlobsFromDirectoryResult describing the changes made to the container.
+     */
+    Models::SyncBlobsFromDirectoryResult SyncFromDirectory(
+        const std::string& localDirectoryName,
+        const SyncBlobsFromDirectoryOptions& options = SyncBlobsFromDirectoryOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
   private:
     Azure::Core::Url m_blobContainerUrl;
     std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    // The same pipeline without the credential of the client, for the requests to source blobs
+    // which are authorized by their URL.
+    std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_sourcePipeline;
     Azure::Nullable<EncryptionKey> m_customerProvidedKey;
     Azure::Nullable<std::string> m_encryptionScope;
+    std::shared_ptr<TransferScheduler> m_transferScheduler;
+    std::shared_ptr<BufferPool> m_bufferPool;
+    std::shared_ptr<BlobPropertiesCache> m_propertiesCache;
 
     explicit BlobContainerClient(
         Azure::Core::Url blobContainerUrl,
         std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline,
         Azure::Nullable<EncryptionKey> customerProvidedKey,
-        Azure::Nullable<std::string> encryptionScope)
+        Azure::Nullable<std::string> encryptionScope,
+        std::shared_ptr<TransferScheduler> transferScheduler,
+        std::shared_ptr<BufferPool> bufferPool,
+        std::shared_ptr<BlobPropertiesCache> propertiesCache,
+        std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> sourcePipeline)
         : m_blobContainerUrl(std::move(blobContainerUrl)), m_pipeline(std::move(pipeline)),
+          m_sourcePipeline(std::move(sourcePipeline)),
           m_customerProvidedKey(std::move(customerProvidedKey)),
-          m_encryptionScope(std::move(encryptionScope))
+          m_encryptionScope(std::move(encryptionScope)),
+          m_transferScheduler(std::move(transferScheduler)), m_bufferPool(std::move(bufferPool)),
+          m_propertiesCache(std::move(propertiesCache))
     {
     }
 
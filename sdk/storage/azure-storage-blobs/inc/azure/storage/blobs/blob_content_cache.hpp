@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <azure/core/datetime.hpp>
+#include <azure/core/etag.hpp>
+#include <azure/core/nullable.hpp>
+#include <azure/core/url.hpp>
+
+#include "azure/storage/blobs/protocol/blob_rest_client.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  class BlobClient;
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobContentCache.
+   */
+  struct BlobContentCacheOptions final
+  {
+    /**
+     * @brief The local directory the content of the blobs is stored in. It's created if it's
+     * missing.
+     */
+    std::string Directory;
+
+    /**
+     * @brief The maximum number of bytes of content stored. Once it's reached, the blobs used
+     * least recently are evicted. Larger blobs aren't cached.
+     */
+    int64_t MaxSize = 16LL * 1024 * 1024 * 1024;
+  };
+
+  /**
+   * @brief Caches the content of the blobs downloaded with
+   * #Azure::Storage::Blobs::BlobClient::DownloadTo in a local directory, so that downloading them
+   * again is served from the disk.
+   *
+   * @remark The blobs are identified by their URLs, without the query parameters other than the
+   * snapshot and the version ID, and the content is stored with the ETag it was downloaded with.
+   * A cached blob is served after a request getting its properties, if its ETag didn't change.
+   * Snapshots and versions can't change, so they are served without any request. Only the
+   * content, the ETag, the last modified time and the type of a blob are stored: the other
+   * details of a download served without a request are left empty.
+   *
+   * @remark The content found in the directory when the cache is constructed is reused, and
+   * evicted first. The directory must only be used by one cache at a time.
+   */
+  class BlobContentCache final {
+  public:
+    /**
+     * @brief Constructs a cache.
+     *
+     * @param options Optional parameters for the cache.
+     */
+    explicit BlobContentCache(BlobContentCacheOptions options);
+
+    BlobContentCache(const BlobContentCache&) = delete;
+    BlobContentCache& operator=(const BlobContentCache&) = delete;
+
+    /**
+     * @brief Gets the number of bytes of content stored.
+     */
+    int64_t GetSize();
+
+  private:
+    struct Entry final
+    {
+      std::string Key;
+      Azure::ETag ETag;
+      Azure::DateTime LastModified;
+      Models::BlobType BlobType;
+      int64_t Size = 0;
+    };
+
+    // The key of a blob, its URL without the query parameters other than the snapshot and the
+    // version ID.
+    static std::string GetKey(const Azure::Core::Url& blobUrl);
+    // Whether the content of the blob can't change.
+    static bool IsImmutable(const Azure::Core::Url& blobUrl);
+
+    // Gets the blob cached with a key, as the one used most recently, and the name of the file
+    // with its content.
+    Azure::Nullable<Entry> Find(const std::string& key, std::string& fileName);
+    // Caches the content of a blob, written to the file by writeFunc. The blobs used least
+    // recently are evicted to make room for it. Failures are ignored.
+    void Store(Entry entry, const std::function<void(const std::string& fileName)>& writeFunc);
+    void Remove(const std::string& key);
+
+    std::string GetFileName(const std::string& key, const char* extension) const;
+    void RemoveFiles(const std::string& key);
+
+    BlobContentCacheOptions m_options;
+    std::mutex m_mutex;
+    // The entries used most recently come first.
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+    int64_t m_size = 0;
+    int64_t m_nextTemporaryFile = 0;
+
+    friend class BlobClient;
+  };
+
+}}} // namespace Azure::Storage::Blobs
@@ -7,6 +7,8 @@
 #include <mutex>
 #include <string>
 
+#include <azure/storage/common/lease_keeper.hpp>
+
 #include "azure/storage/blobs/blob_client.hpp"
 #include "azure/storage/blobs/blob_container_client.hpp"
 
@@ -126,6 +128,22 @@ namespace Azure { namespace Storage { namespace Blobs {
         const BreakLeaseOptions& options = BreakLeaseOptions(),
         const Azure::Core::Context& context = Azure::Core::Context());
 
+    /**
+     * @brief Renews the lease in the background with a LeaseKeeper, until it's removed from the
+     * keeper or lost.
+     *
+     * @remark The lease is renewed with its current ID, so it's lost if it's changed afterwards.
+     *
+     * @param leaseKeeper The keeper renewing the lease.
+     * @param duration The duration the lease was acquired with.
+     * @param onLost Handles the loss of the lease. If null, it's ignored.
+     * @return The key of the lease in \p leaseKeeper, to remove it.
+     */
+    int64_t KeepRenewed(
+        LeaseKeeper& leaseKeeper,
+        std::chrono::seconds duration,
+        LeaseKeeper::LostLeaseHandler onLost = LeaseKeeper::LostLeaseHandler());
+
   private:
     Azure::Nullable<BlobClient> m_blobClient;
     Azure::Nullable<BlobContainerClient> m_blobContainerClient;
@@ -5,6 +5,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -13,11 +14,21 @@
 #include <azure/core/match_conditions.hpp>
 #include <azure/core/modified_conditions.hpp>
 #include <azure/storage/common/access_conditions.hpp>
-
+#include <azure/storage/common/buffer_pool.hpp>
+#include <azure/storage/common/endpoint_health_tracker.hpp>
+#include <azure/storage/common/transfer_journal.hpp>
+#include <azure/storage/common/transfer_scheduler.hpp>
+#include <azure/storage/common/transfer_statistics.hpp>
+
+#include "azure/storage/blobs/blob_content_cache.hpp"
+#include "azure/storage/blobs/blob_properties_cache.hpp"
+#include "azure/storage/blobs/client_side_encryption.hpp"
 #include "azure/storage/blobs/protocol/blob_rest_client.hpp"
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  class BlobBatchClient;
+
   /**
    * @brief Specifies access conditions for a container.
    */
@@ -152,10 +163,36 @@ namespace Azure { namespace Storage { namespace Blobs {
      */
     std::string SecondaryHostForRetryReads;
 
+    /**
+     * @brief Tracks the health of the primary host for the clients sharing it, so that their read
+     * requests are sent to #SecondaryHostForRetryReads first while the primary host is unhealthy.
+     * If null, each read request is sent to the primary host first.
+     */
+    std::shared_ptr<Azure::Storage::EndpointHealthTracker> EndpointHealthTracker;
+
     /**
      * API version used by this client.
      */
     std::string ApiVersion = _detail::ApiVersion;
+
+    /**
+     * @brief Bounds the chunks of the concurrent uploads and downloads of all the clients sharing
+     * it. If null, only the `Concurrency` of each call bounds its chunks.
+     */
+    std::shared_ptr<Azure::Storage::TransferScheduler> TransferScheduler;
+
+    /**
+     * @brief Provides the chunk buffers of the uploads and downloads of all the clients sharing
+     * it. If null, the clients share #Azure::Storage::BufferPool::GetDefault().
+     */
+    std::shared_ptr<Azure::Storage::BufferPool> BufferPool;
+
+    /**
+     * @brief Caches the properties of the blobs got by all the clients sharing it, and conditions
+     * their downloads on the cached ETags. If null, the properties are always got from the
+     * service.
+     */
+    std::shared_ptr<BlobPropertiesCache> PropertiesCache;
   };
 
   /**
@@ -249,6 +286,35 @@ namespace Azure { namespace Storage { namespace Blobs {
     Azure::Nullable<int32_t> PageSizeHint;
   };
 
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Blobs::BlobServiceClient::FindBlobsByTagsParallel.
+   */
+  struct FindBlobsByTagsParallelOptions final
+  {
+    /**
+     * @brief The containers the query is partitioned by. If empty, the query is partitioned by all
+     * the containers of the account.
+     */
+    std::vector<std::string> BlobContainerNames;
+
+    /**
+     * @brief Specifies the maximum number of blobs to return in each page.
+     */
+    Azure::Nullable<int32_t> PageSizeHint;
+
+    /**
+     * @brief The maximum number of partitions walked concurrently.
+     */
+    int32_t Concurrency = 8;
+
+    /**
+     * @brief The maximum number of pages received and not read yet. The partitions wait for the
+     * pages to be read beyond it.
+     */
+    int32_t PrefetchPages = 16;
+  };
+
   /**
    * @brief Optional parameters for #Azure::Storage::Blobs::BlobContainerClient::Create.
    */
@@ -357,6 +423,80 @@ namespace Azure { namespace Storage { namespace Blobs {
     Models::ListBlobsIncludeFlags Include = Models::ListBlobsIncludeFlags::None;
   };
 
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobContainerClient::ListBlobsCompact.
+   */
+  struct ListBlobsCompactOptions final
+  {
+    /**
+     * @brief Specifies a string that filters the results to return only blobs whose
+     * name begins with the specified prefix.
+     */
+    Azure::Nullable<std::string> Prefix;
+
+    /**
+     * @brief A string value that identifies the portion of the list of blobs to be
+     * returned with the next listing operation.
+     */
+    Azure::Nullable<std::string> ContinuationToken;
+
+    /**
+     * @brief Specifies the maximum number of blobs to return.
+     */
+    Azure::Nullable<int32_t> PageSizeHint;
+
+    /**
+     * @brief Specifies whether soft-deleted blobs should be included in the response.
+     */
+    bool IncludeDeleted = false;
+
+    /**
+     * @brief The fields of the blobs to deserialize, besides their name.
+     */
+    Models::CompactBlobItemFields Fields
+        = Models::CompactBlobItemFields::BlobSize | Models::CompactBlobItemFields::ETag;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobContainerClient::ListBlobsParallel.
+   */
+  struct ListBlobsParallelOptions final
+  {
+    /**
+     * @brief Specifies a string that filters the results to return only blobs whose
+     * name begins with the specified prefix.
+     */
+    Azure::Nullable<std::string> Prefix;
+
+    /**
+     * @brief Specifies the maximum number of blobs to return in each page.
+     */
+    Azure::Nullable<int32_t> PageSizeHint;
+
+    /**
+     * @brief Specifies one or more datasets to include in the response.
+     */
+    Models::ListBlobsIncludeFlags Include = Models::ListBlobsIncludeFlags::None;
+
+    /**
+     * @brief The delimiter of the virtual directories the blobs are partitioned into. Each
+     * partition is listed on its own, concurrently with the others.
+     */
+    std::string Delimiter = "/";
+
+    /**
+     * @brief The number of levels of virtual directories discovered to partition the blobs. The
+     * directories at this level are listed flat, with all the blobs they contain. Must be at
+     * least 1.
+     */
+    int32_t PartitionDepth = 2;
+
+    /**
+     * @brief The maximum number of partitions listed concurrently.
+     */
+    int32_t Concurrency = 5;
+  };
+
   /**
    * @brief Optional parameters for #Azure::Storage::Blobs::BlobContainerClient::GetAccessPolicy.
    */
@@ -528,6 +668,24 @@ namespace Azure { namespace Storage { namespace Blobs {
      * @brief Optional conditions that must be met to perform this operation.
      */
     BlobAccessConditions AccessConditions;
+
+    /**
+     * @brief Options for reading the body stream with parallel range requests.
+     */
+    struct
+    {
+      /**
+       * @brief The number of range requests the body stream issues ahead of the reader, whose
+       * content it holds until it is read. 0, the default, reads the blob over a single
+       * connection.
+       */
+      int32_t Concurrency = 0;
+
+      /**
+       * @brief The number of bytes in each range request.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+    } PrefetchOptions;
   };
 
   /**
@@ -540,6 +698,24 @@ namespace Azure { namespace Storage { namespace Blobs {
      */
     Azure::Nullable<Core::Http::HttpRange> Range;
 
+    /**
+     * @brief Decrypts the content of a blob encrypted on the client, in the transfer threads as
+     * the chunks are received. Blobs without encryption data in their metadata are downloaded as
+     * they are. Only supported when downloading to a buffer or a file, without a Range, and can't
+     * be used with TransferOptions.Journal, ComputeContentCrc64 or DecompressContent. The chunks
+     * are sized with TransferStrategy::Fixed, rounded up to whole encrypted segments.
+     */
+    Azure::Nullable<ClientSideEncryptionOptions> ClientSideEncryption;
+
+    /**
+     * @brief Serves the download from this cache when the blob is cached, and caches the blob
+     * once it's downloaded. Only supported when downloading to a buffer or a file, and ignored
+     * with ClientSideEncryption or with TransferOptions.Journal, ComputeContentCrc64,
+     * ValidateContentCrc64 or DecompressContent. A blob is only cached when it's downloaded
+     * without a Range, but a Range of a cached blob is served from the cache.
+     */
+    std::shared_ptr<BlobContentCache> ContentCache;
+
     /**
      * @brief Options for parallel transfer.
      */
@@ -561,9 +737,212 @@ namespace Azure { namespace Storage { namespace Blobs {
        * @brief The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * @brief How the chunks are sized. With TransferStrategy::Adaptive, InitialChunkSize isn't
+       * used: the first request downloads ChunkSize bytes, then the chunk size grows or shrinks
+       * with the observed throughput.
+       */
+      TransferStrategy Strategy = TransferStrategy::Fixed;
+
+      /**
+       * @brief When downloading to a file, writes it bypassing the page cache if the file system
+       * supports it, so a large download doesn't evict the cache of other processes.
+       */
+      bool UseUnbufferedFileIo = false;
+
+      /**
+       * @brief When downloading to a file, allocates the space of the whole file before writing
+       * it, if the file system supports it.
+       */
+      bool PreallocateFile = false;
+
+      /**
+       * @brief When downloading to a file, writes it in the background, so the transfer threads
+       * keep receiving while the chunks are written. Uses io_uring on Linux, when available, and
+       * overlapped I/O on Windows.
+       */
+      bool UseAsyncFileIo = false;
+
+      /**
+       * @brief When downloading to a file, sizes the file once the size of the blob is known and
+       * maps it in memory, so the transfer threads receive the chunks straight into the file,
+       * without copying them through a buffer nor writing them with system calls. Takes
+       * precedence over UseUnbufferedFileIo, PreallocateFile and UseAsyncFileIo, and is ignored
+       * with ClientSideEncryption, a Journal or DecompressContent.
+       */
+      bool UseMemoryMappedFile = false;
+
+      /**
+       * @brief Computes the CRC64 of the downloaded content in the transfer threads, chunk by
+       * chunk as they are received, and returns it in the ContentCrc64 of the result.
+       */
+      bool ComputeContentCrc64 = false;
+
+      /**
+       * @brief Requests the CRC64 of the range of each chunk from the service, and checks each
+       * chunk against it in the transfer thread receiving it. The service hashes ranges of up to
+       * 4MiB, so the chunks are sized with TransferStrategy::Fixed and limited to 4MiB. With
+       * ComputeContentCrc64, the CRC64 of the content is concatenated from the ones of the chunks.
+       */
+      bool ValidateContentCrc64 = false;
+
+      /**
+       * @brief When downloading to a file, records the chunks written in this journal, so that a
+       * download interrupted is resumed by downloading the same blob to the same file with the
+       * same journal. Only the chunks missing are downloaded, unless the blob was changed in the
+       * meantime. The chunks are sized with TransferStrategy::Fixed and written synchronously,
+       * starting with a first request of ChunkSize bytes. Can't be used with ComputeContentCrc64.
+       */
+      std::shared_ptr<TransferJournal> Journal;
+
+      /**
+       * @brief Decompresses the content of a blob with a gzip ContentEncoding as it's received,
+       * in order, so the decompressed content is written. The chunks are still downloaded in
+       * parallel. Only supported when downloading to a file or a sink, without a Range or a
+       * Journal. The CRC64 computed with ComputeContentCrc64 is the one of the compressed content.
+       */
+      bool DecompressContent = false;
+
+      /**
+       * @brief Called with the number of bytes of the blob downloaded so far and the number of
+       * bytes to download, as the chunks are received. It's called by one thread at a time, at
+       * most once per ProgressInterval, and once more when the download is done.
+       */
+      std::function<void(int64_t bytesTransferred, int64_t totalBytes)> ProgressHandler;
+
+      /**
+       * @brief The minimum interval between two calls of ProgressHandler.
+       */
+      std::chrono::milliseconds ProgressInterval = std::chrono::milliseconds(100);
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobClient::DownloadRanges.
+   */
+  struct DownloadBlobRangesOptions final
+  {
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
+     */
+    BlobAccessConditions AccessConditions;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief Ranges separated by up to this number of bytes are downloaded in a single request,
+       * along with the bytes between them.
+       */
+      int64_t MaxGapSize = 64 * 1024;
+
+      /**
+       * @brief Ranges are merged only up to this number of bytes per request. A larger range is
+       * downloaded alone.
+       */
+      int64_t MaxMergedRangeSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of threads that may be used in a parallel transfer.
+       */
+      int32_t Concurrency = 5;
     } TransferOptions;
   };
 
+  /**
+   * @brief Describes how the records are serialized in the blob read by
+   * #Azure::Storage::Blobs::BlobClient::Query, or in its results.
+   */
+  class BlobQueryTextOptions final {
+  public:
+    /**
+     * @brief Creates the options of CSV text.
+     *
+     * @param recordSeparator The string separating the records.
+     * @param columnSeparator The string separating the fields of a record.
+     * @param quotationCharacter The character enclosing a field, if any.
+     * @param escapeCharacter The character escaping a quotation character in a field, if any.
+     * @param hasHeaders Indicates whether the first record holds the names of the fields.
+     * @return The options of CSV text.
+     */
+    static BlobQueryTextOptions CreateCsvTextOptions(
+        const std::string& recordSeparator = "\n",
+        const std::string& columnSeparator = ",",
+        const std::string& quotationCharacter = std::string(),
+        const std::string& escapeCharacter = std::string(),
+        bool hasHeaders = false)
+    {
+      BlobQueryTextOptions options;
+      options.m_configuration.FormatType = "delimited";
+      options.m_configuration.RecordSeparator = recordSeparator;
+      options.m_configuration.ColumnSeparator = columnSeparator;
+      options.m_configuration.FieldQuote = quotationCharacter;
+      options.m_configuration.EscapeChar = escapeCharacter;
+      options.m_configuration.HasHeaders = hasHeaders;
+      return options;
+    }
+
+    /**
+     * @brief Creates the options of JSON text.
+     *
+     * @param recordSeparator The string separating the records.
+     * @return The options of JSON text.
+     */
+    static BlobQueryTextOptions CreateJsonTextOptions(const std::string& recordSeparator = "\n")
+    {
+      BlobQueryTextOptions options;
+      options.m_configuration.FormatType = "json";
+      options.m_configuration.RecordSeparator = recordSeparator;
+      return options;
+    }
+
+  private:
+    BlobQueryTextOptions() = default;
+
+    friend class BlobClient;
+
+    Models::_detail::QueryTextConfiguration m_configuration;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobClient::Query.
+   */
+  struct QueryBlobOptions final
+  {
+    /**
+     * @brief How the records are serialized in the blob. The service reads the blob as CSV text
+     * with the default options of BlobQueryTextOptions::CreateCsvTextOptions if it's not set.
+     */
+    Azure::Nullable<BlobQueryTextOptions> InputTextConfiguration;
+
+    /**
+     * @brief How the selected records are serialized in the results. They are serialized as the
+     * input if it's not set.
+     */
+    Azure::Nullable<BlobQueryTextOptions> OutputTextConfiguration;
+
+    /**
+     * @brief Callback called with the number of bytes of the blob scanned so far and the size of
+     * the blob, while the results are read.
+     */
+    std::function<void(int64_t, int64_t)> ProgressHandler;
+
+    /**
+     * @brief Callback called with the errors reported by the service while the results are read.
+     * Without a callback, non-fatal errors are ignored and a fatal error throws an exception from
+     * the reading of the results.
+     */
+    std::function<void(Models::BlobQueryError)> ErrorHandler;
+
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
+     */
+    BlobAccessConditions AccessConditions;
+  };
+
   /**
    * @brief Optional parameters for #Azure::Storage::Blobs::BlobClient::CreateSnapshot.
    */
@@ -706,6 +1085,15 @@ namespace Azure { namespace Storage { namespace Blobs {
      */
     Azure::Nullable<ContentHash> TransactionalContentHash;
 
+    /**
+     * @brief Hashes the content with this algorithm while it's sent, so the content is read once.
+     * As the hash is only known once the content is sent, it can't be sent for the service to
+     * verify the content. Instead, it's checked against the hash of the content received returned
+     * by the service, if it's of the same algorithm, and returned in the TransactionalContentHash
+     * of the result otherwise. Can't be used with TransactionalContentHash.
+     */
+    Azure::Nullable<HashAlgorithm> ComputeTransactionalContentHash;
+
     /**
      * @brief The standard HTTP header system properties to set.
      */
@@ -757,6 +1145,14 @@ namespace Azure { namespace Storage { namespace Blobs {
      */
     Azure::Nullable<Models::AccessTier> AccessTier;
 
+    /**
+     * @brief Encrypts the content on the client before it's uploaded, in the transfer threads
+     * block by block. The blocks are sized with TransferStrategy::Fixed, rounded up to whole
+     * encrypted segments. Can't be used with TransferOptions.ComputeContentCrc64, Journal or
+     * CompressContent.
+     */
+    Azure::Nullable<ClientSideEncryptionOptions> ClientSideEncryption;
+
     /**
      * @brief Options for parallel transfer.
      */
@@ -778,6 +1174,73 @@ namespace Azure { namespace Storage { namespace Blobs {
        * @brief The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * @brief How the chunks are sized. With TransferStrategy::Adaptive, ChunkSize is the size
+       * of the first blocks, then the block size grows or shrinks with the observed throughput.
+       */
+      TransferStrategy Strategy = TransferStrategy::Fixed;
+
+      /**
+       * @brief When uploading from a file, maps it in memory and stages each block from a view of
+       * the mapping, instead of reading the blocks from the file. The file must not be truncated
+       * while it's uploaded.
+       */
+      bool UseMemoryMappedFile = false;
+
+      /**
+       * @brief When uploading from a file, reads the blocks bypassing the page cache if the file
+       * system supports it. Has no effect with UseMemoryMappedFile, or when the file is uploaded
+       * with a single upload operation.
+       */
+      bool UseUnbufferedFileIo = false;
+
+      /**
+       * @brief Computes the CRC64 of each block in the transfer threads, and sends it for the
+       * service to verify the block. The CRC64 of the blocks are combined into the CRC64 of the
+       * whole content, returned in the ContentCrc64 of the result.
+       */
+      bool ComputeContentCrc64 = false;
+
+      /**
+       * @brief When uploading from a file in blocks, records the blocks staged in this journal, so
+       * that an upload interrupted is resumed by uploading the same file to the same blob with the
+       * same journal. Only the blocks missing from the uncommitted blocks of the blob are staged,
+       * unless the file was written in the meantime. The blocks are sized with
+       * TransferStrategy::Fixed. Can't be used with ComputeContentCrc64.
+       */
+      std::shared_ptr<TransferJournal> Journal;
+
+      /**
+       * @brief Compresses the content with gzip as it's uploaded, and sets the ContentEncoding
+       * of the blob to gzip. Each block is compressed in the transfer thread staging it, into a
+       * gzip member of its own, so the blob is the concatenation of the members. ChunkSize and
+       * SingleUploadThreshold apply to the uncompressed content. Can't be used with
+       * ComputeContentCrc64.
+       */
+      bool CompressContent = false;
+
+      /**
+       * @brief When uploading from a stream, computes the MD5 of the whole content while the
+       * stream is read, and sets it as the ContentHash of the blob, unless HttpHeaders has one.
+       * MD5 can't be combined from the hashes of blocks read out of order, so it's only supported
+       * with a stream, which is read in order. Can't be used with CompressContent or
+       * ClientSideEncryption.
+       */
+      bool ComputeContentMd5 = false;
+
+      /**
+       * @brief Called with the number of bytes of the content uploaded so far and the size of the
+       * content, as the blocks are staged. The size is -1 until it's known, when uploading from a
+       * stream. It's called by one thread at a time, at most once per ProgressInterval, and once
+       * more when the upload is done.
+       */
+      std::function<void(int64_t bytesTransferred, int64_t totalBytes)> ProgressHandler;
+
+      /**
+       * @brief The minimum interval between two calls of ProgressHandler.
+       */
+      std::chrono::milliseconds ProgressInterval = std::chrono::milliseconds(100);
     } TransferOptions;
   };
 
@@ -793,6 +1256,15 @@ namespace Azure { namespace Storage { namespace Blobs {
      */
     Azure::Nullable<ContentHash> TransactionalContentHash;
 
+    /**
+     * @brief Hashes the content with this algorithm while it's sent, so the content is read once.
+     * As the hash is only known once the content is sent, it can't be sent for the service to
+     * verify the content. Instead, it's checked against the hash of the content received returned
+     * by the service, if it's of the same algorithm, and returned in the TransactionalContentHash
+     * of the result otherwise. Can't be used with TransactionalContentHash.
+     */
+    Azure::Nullable<HashAlgorithm> ComputeTransactionalContentHash;
+
     /**
      * @brief Optional conditions that must be met to perform this operation.
      */
@@ -830,20 +1302,11 @@ namespace Azure { namespace Storage { namespace Blobs {
   };
 
   /**
-   * @brief Optional parameters for #Azure::Storage::Blobs::BlockBlobClient::CommitBlockList.
+   * @brief Optional parameters for
+   * #Azure::Storage::Blobs::BlockBlobClient::CopyFromUriParallel.
    */
-  struct CommitBlockListOptions final
+  struct CopyBlockBlobFromUriParallelOptions final
   {
-    /**
-     * @brief The standard HTTP header system properties to set.
-     */
-    Models::BlobHttpHeaders HttpHeaders;
-
-    /**
-     * @brief Name-value pairs associated with the blob as metadata.
-     */
-    Storage::Metadata Metadata;
-
     /**
      * @brief The tags to set for this blob.
      */
@@ -858,21 +1321,118 @@ namespace Azure { namespace Storage { namespace Blobs {
      * @brief Optional conditions that must be met to perform this operation.
      */
     BlobAccessConditions AccessConditions;
-  };
 
-  /**
-   * @brief Optional parameters for #Azure::Storage::Blobs::BlockBlobClient::GetBlockList.
-   */
-  struct GetBlockListOptions final
-  {
     /**
-     * @brief Specifies whether to return the list of committed blocks, the list of uncommitted
-     * blocks, or both lists together.
+     * @brief Options for parallel transfer.
      */
-    Models::BlockListType ListType = Models::BlockListType::Committed;
-
-    /**
-     * @brief Optional conditions that must be met to perform this operation.
+    struct
+    {
+      /**
+       * @brief The number of bytes of the source staged by each block. By default, 8MiB, or more
+       * for a source of more than 50000 blocks. This value cannot be larger than 4000 MiB.
+       */
+      Azure::Nullable<int64_t> ChunkSize;
+
+      /**
+       * @brief The maximum number of blocks staged at the same time.
+       */
+      int32_t Concurrency = 5;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlockBlobClient::UploadDeltaFrom.
+   */
+  struct UploadBlockBlobDeltaFromOptions final
+  {
+    /**
+     * @brief The standard HTTP header system properties to set.
+     */
+    Models::BlobHttpHeaders HttpHeaders;
+
+    /**
+     * @brief Name-value pairs associated with the blob as metadata.
+     */
+    Storage::Metadata Metadata;
+
+    /**
+     * @brief The tags to set for this blob.
+     */
+    std::map<std::string, std::string> Tags;
+
+    /**
+     * @brief Indicates the tier to be set on blob.
+     */
+    Azure::Nullable<Models::AccessTier> AccessTier;
+
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
+     */
+    LeaseAccessConditions AccessConditions;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief The average size of the blocks the file is split into. The blocks are between a
+       * quarter of and four times this size. Uploads of the same blob must use the same size for
+       * their blocks to be reused. This value cannot be larger than 1000 MiB.
+       */
+      int64_t AverageBlockSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of blocks staged at the same time.
+       */
+      int32_t Concurrency = 5;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlockBlobClient::CommitBlockList.
+   */
+  struct CommitBlockListOptions final
+  {
+    /**
+     * @brief The standard HTTP header system properties to set.
+     */
+    Models::BlobHttpHeaders HttpHeaders;
+
+    /**
+     * @brief Name-value pairs associated with the blob as metadata.
+     */
+    Storage::Metadata Metadata;
+
+    /**
+     * @brief The tags to set for this blob.
+     */
+    std::map<std::string, std::string> Tags;
+
+    /**
+     * @brief Indicates the tier to be set on blob.
+     */
+    Azure::Nullable<Models::AccessTier> AccessTier;
+
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
+     */
+    BlobAccessConditions AccessConditions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlockBlobClient::GetBlockList.
+   */
+  struct GetBlockListOptions final
+  {
+    /**
+     * @brief Specifies whether to return the list of committed blocks, the list of uncommitted
+     * blocks, or both lists together.
+     */
+    Models::BlockListType ListType = Models::BlockListType::Committed;
+
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
      */
     struct : public LeaseAccessConditions, public TagAccessConditions
     {
@@ -1076,6 +1636,112 @@ namespace Azure { namespace Storage { namespace Blobs {
     BlobAccessConditions AccessConditions;
   };
 
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::PageBlobClient::DownloadSparseTo.
+   */
+  struct DownloadSparseBlobToOptions final
+  {
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
+     */
+    BlobAccessConditions AccessConditions;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief The maximum number of bytes in a single request. Populated page ranges larger than
+       * this are downloaded in several requests.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of threads that may be used in a parallel transfer.
+       */
+      int32_t Concurrency = 5;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::PageBlobClient::SyncFromSnapshotDiff.
+   */
+  struct SyncPageBlobFromSnapshotDiffOptions final
+  {
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
+     */
+    BlobAccessConditions AccessConditions;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief The maximum number of bytes in a single request. Changed page ranges larger than
+       * this are downloaded in several requests.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of threads that may be used in a parallel transfer.
+       */
+      int32_t Concurrency = 5;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::PageBlobClient::UploadFrom.
+   */
+  struct UploadPageBlobFromOptions final
+  {
+    /**
+     * @brief The standard HTTP header system properties to set.
+     */
+    Models::BlobHttpHeaders HttpHeaders;
+
+    /**
+     * @brief Name-value pairs associated with the blob as metadata.
+     */
+    Storage::Metadata Metadata;
+
+    /**
+     * @brief The tags to set for this blob.
+     */
+    std::map<std::string, std::string> Tags;
+
+    /**
+     * @brief Indicates the tier to be set on blob.
+     */
+    Azure::Nullable<Models::AccessTier> AccessTier;
+
+    /**
+     * @brief Optional conditions that must be met to perform this operation. The lease ID is also
+     * used to upload the pages.
+     */
+    BlobAccessConditions AccessConditions;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief The number of bytes of the content each transfer thread scans for zero pages at a
+       * time, which is also the maximum number of bytes in a single request. Rounded down to a
+       * multiple of 512 bytes, and limited to 4MiB.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of threads that may be used in a parallel transfer.
+       */
+      int32_t Concurrency = 5;
+    } TransferOptions;
+  };
+
   /**
    * @brief Optional parameters for #Azure::Storage::Blobs::PageBlobClient::StartCopyIncremental.
    */
@@ -1087,4 +1753,216 @@ namespace Azure { namespace Storage { namespace Blobs {
     BlobAccessConditions AccessConditions;
   };
 
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobBatchClient::SubmitBatch.
+   */
+  struct SubmitBlobBatchOptions final
+  {
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobServiceClient::SubmitBulkOperations.
+   */
+  struct SubmitBlobBulkOperationsOptions final
+  {
+    /**
+     * @brief The client submitting the deletions and the access tier changes of blobs in batches of
+     * up to 256 operations. If null, or if a batch request fails, they're sent as single requests.
+     */
+    std::shared_ptr<BlobBatchClient> BatchClient;
+
+    /**
+     * @brief The maximum number of requests in flight at the same time.
+     */
+    int32_t Concurrency = 16;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobContainerClient::UploadFiles.
+   */
+  struct UploadBlobFilesOptions final
+  {
+    /**
+     * @brief The maximum number of uploads in flight at the same time.
+     */
+    int32_t Concurrency = 16;
+
+    /**
+     * @brief Files up to this size are read in memory and uploaded with a single request. Larger
+     * files are uploaded with UploadFrom(), one block at a time.
+     */
+    int64_t SingleUploadThreshold = 4 * 1024 * 1024;
+
+    /**
+     * @brief Indicates the tier to be set on the blobs.
+     */
+    Azure::Nullable<Models::AccessTier> AccessTier;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobContainerClient::SyncFromDirectory.
+   */
+  struct SyncBlobsFromDirectoryOptions final
+  {
+    /**
+     * @brief The virtual directory of the container the local directory is synchronized to, such
+     * as "backup/". Each file is uploaded to the blob named after it and its path relative to
+     * the local directory.
+     */
+    std::string Prefix;
+
+    /**
+     * @brief Deletes the blobs under Prefix which no longer have a local file.
+     */
+    bool DeleteExtraBlobs = false;
+
+    /**
+     * @brief A local file where the MD5 of the files are cached, with their size and their last
+     * write time, so that a file isn't read again to be compared to its blob until it changes.
+     * The file is created if it doesn't exist. If null, the MD5 of the files are computed each
+     * time they're compared.
+     */
+    Azure::Nullable<std::string> HashCacheFile;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief Files smaller than this are uploaded with a single upload operation.
+       */
+      int64_t SingleUploadThreshold = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of bytes in a single request.
+       */
+      Azure::Nullable<int64_t> ChunkSize;
+
+      /**
+       * @brief The maximum number of files, and of blocks of the larger files, transferred at the
+       * same time.
+       */
+      int32_t Concurrency = 5;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::AppendBlobWriter.
+   */
+  struct AppendBlobWriterOptions final
+  {
+    /**
+     * @brief The size of the blob, where the first write is appended. If null, the first block is
+     * appended alone, and the next ones are pipelined once its offset is known.
+     */
+    Azure::Nullable<int64_t> Position;
+
+    /**
+     * @brief The maximum number of bytes in a block. The service accepts blocks up to 4MiB.
+     */
+    int64_t MaxBlockSize = 4 * 1024 * 1024;
+
+    /**
+     * @brief The maximum number of blocks in flight. While a block is in flight, only full blocks
+     * are sent, the writes coalesce into the next block otherwise.
+     */
+    int32_t Concurrency = 2;
+
+    /**
+     * @brief Optional lease conditions that must be met to append the blocks.
+     */
+    LeaseAccessConditions AccessConditions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::AppendBlobTailReader.
+   */
+  struct AppendBlobTailReaderOptions final
+  {
+    /**
+     * @brief The offset in the blob the reader starts from.
+     */
+    int64_t Offset = 0;
+
+    /**
+     * @brief The maximum number of bytes downloaded by a request. The rest of the new bytes are
+     * downloaded by the next request, right away.
+     */
+    int64_t MaxReadSize = 4 * 1024 * 1024;
+
+    /**
+     * @brief The delay between two polls while bytes keep being appended.
+     */
+    std::chrono::milliseconds MinPollInterval = std::chrono::milliseconds(100);
+
+    /**
+     * @brief The delay between two polls once nothing is appended for a while, which bounds the
+     * latency of the bytes appended then.
+     */
+    std::chrono::milliseconds MaxPollInterval = std::chrono::seconds(5);
+
+    /**
+     * @brief Optional lease conditions that must be met to read the blob.
+     */
+    LeaseAccessConditions AccessConditions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobRandomAccessReader.
+   */
+  struct BlobRandomAccessReaderOptions final
+  {
+    /**
+     * @brief Optional conditions that must be met to read the blob. If IfMatch isn't set, the
+     * reads are conditioned on the ETag of the blob when it's first read.
+     */
+    BlobAccessConditions AccessConditions;
+
+    /**
+     * @brief The size of the blocks the blob is downloaded and cached in.
+     */
+    int64_t BlockSize = 1024 * 1024;
+
+    /**
+     * @brief The number of bytes of the blocks cached, the blocks used least recently are evicted
+     * beyond it.
+     */
+    int64_t CacheSize = 64 * 1024 * 1024;
+
+    /**
+     * @brief The number of parts of the cache with their own lock, so that concurrent reads
+     * seldom wait for each other.
+     */
+    size_t ShardCount = 8;
+
+    /**
+     * @brief The number of blocks downloaded ahead in the background once the reads are found
+     * sequential. 0 disables the read-ahead.
+     */
+    int32_t ReadAheadBlocks = 4;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::UserDelegationKeyCache.
+   */
+  struct UserDelegationKeyCacheOptions final
+  {
+    /**
+     * @brief How long each key is valid for, up to 7 days.
+     */
+    std::chrono::seconds KeyValidity = std::chrono::hours(24);
+
+    /**
+     * @brief How long before a key expires a new one is got in the background. It must be shorter
+     * than `KeyValidity`, and should be longer than the SAS generated with the cache are valid for.
+     */
+    std::chrono::seconds RefreshBeforeExpiry = std::chrono::hours(1);
+
+    /**
+     * @brief How long after a failure to get a new key in the background it's got again.
+     */
+    std::chrono::milliseconds RetryDelay = std::chrono::seconds(30);
+  };
+
 }}} // namespace Azure::Storage::Blobs
@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <azure/core/nullable.hpp>
+#include <azure/core/response.hpp>
+
+#include "azure/storage/blobs/protocol/blob_rest_client.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobPropertiesCache.
+   */
+  struct BlobPropertiesCacheOptions final
+  {
+    /**
+     * @brief The number of blobs whose properties are cached. Once it's reached, the properties
+     * used least recently are evicted.
+     */
+    size_t Capacity = 1024;
+
+    /**
+     * @brief How long the properties of a blob are served from the cache after they were got.
+     */
+    std::chrono::milliseconds TimeToLive = std::chrono::seconds(30);
+
+    /**
+     * @brief The number of parts of the cache with their own lock, so that the clients sharing it
+     * from several threads seldom wait for each other.
+     */
+    size_t ShardCount = 16;
+  };
+
+  /**
+   * @brief Caches the properties of the blobs got by the clients sharing it, so that getting them
+   * again is served locally.
+   *
+   * @remark The blobs are identified by their URLs. While the properties of a blob are cached,
+   * its downloads without access conditions are only performed if the blob still has the cached
+   * ETag. If it was changed, the properties are evicted and the blob is downloaded again without
+   * the condition, and the next call to #Azure::Storage::Blobs::BlobClient::GetProperties gets
+   * them from the service. The properties are also evicted when the blob is deleted, uploaded, or
+   * its metadata, HTTP headers or access tier are set through a client sharing the cache.
+   */
+  class BlobPropertiesCache final {
+  public:
+    /**
+     * @brief Constructs a cache.
+     *
+     * @param options Optional parameters for the cache.
+     */
+    explicit BlobPropertiesCache(BlobPropertiesCacheOptions options = BlobPropertiesCacheOptions());
+
+    ~BlobPropertiesCache();
+
+    BlobPropertiesCache(const BlobPropertiesCache&) = delete;
+    BlobPropertiesCache& operator=(const BlobPropertiesCache&) = delete;
+
+    /**
+     * @brief Gets the cached properties of a blob.
+     *
+     * @param blobUrl The URL of the blob.
+     * @return A copy of the response the properties were got with, or null if they aren't cached
+     * or are older than #BlobPropertiesCacheOptions::TimeToLive.
+     */
+    Azure::Nullable<Azure::Response<Models::BlobProperties>> Get(const std::string& blobUrl);
+
+    /**
+     * @brief Caches the properties of a blob.
+     *
+     * @param blobUrl The URL of the blob.
+     * @param response The response the properties were got with, which is copied.
+     */
+    void Set(const std::string& blobUrl, const Azure::Response<Models::BlobProperties>& response);
+
+    /**
+     * @brief Evicts the properties of a blob.
+     *
+     * @param blobUrl The URL of the blob.
+     */
+    void Remove(const std::string& blobUrl);
+
+  private:
+    struct Shard;
+
+    Shard& GetShard(const std::string& blobUrl);
+
+    BlobPropertiesCacheOptions m_options;
+    size_t m_shardCapacity;
+    std::vector<std::unique_ptr<Shard>> m_shards;
+  };
+
+}}} // namespace Azure::Storage::Blobs
@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <azure/core/context.hpp>
+#include <azure/core/etag.hpp>
+#include <azure/core/io/body_stream.hpp>
+
+#include "azure/storage/blobs/blob_client.hpp"
+#include "azure/storage/blobs/blob_options.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  namespace _detail {
+    class BlobRandomAccessReaderState;
+  } // namespace _detail
+
+  /**
+   * @brief BlobRandomAccessReader reads a blob at random offsets, through a cache of fixed-size
+   * blocks of the blob.
+   *
+   * @remark The blob is downloaded by blocks of `BlockSize` bytes, kept in a cache of up to
+   * `CacheSize` bytes, so that small reads close to each other take a single request. When a read
+   * starts where the previous one ended, the next `ReadAheadBlocks` blocks are downloaded in the
+   * background. All the reads are of the version of the blob first read: once the blob has
+   * changed, they fail with the status code 412.
+   */
+  class BlobRandomAccessReader final {
+  public:
+    /**
+     * @brief Initializes a new instance of the BlobRandomAccessReader.
+     *
+     * @param blobClient The client of the blob to read.
+     * @param options Optional parameters of the reader.
+     */
+    explicit BlobRandomAccessReader(
+        BlobClient blobClient,
+        const BlobRandomAccessReaderOptions& options = BlobRandomAccessReaderOptions());
+
+    /**
+     * @brief Cancels the downloads in the background.
+     */
+    ~BlobRandomAccessReader();
+
+    BlobRandomAccessReader(const BlobRandomAccessReader&) = delete;
+    BlobRandomAccessReader& operator=(const BlobRandomAccessReader&) = delete;
+
+    /**
+     * @brief Reads bytes of the blob from an offset. Can be called from several threads at the
+     * same time.
+     *
+     * @param offset The offset of the first byte to read.
+     * @param buffer The buffer the bytes are copied to.
+     * @param count The number of bytes to read.
+     * @param context Context for cancelling long running operations.
+     * @return The number of bytes read, which is less than count only at the end of the blob.
+     */
+    size_t Read(
+        int64_t offset,
+        uint8_t* buffer,
+        size_t count,
+        const Azure::Core::Context& context = Azure::Core::Context());
+
+    /**
+     * @brief Gets the size of the blob read.
+     *
+     * @param context Context for cancelling long running operations.
+     * @return The size of the blob, in bytes.
+     */
+    int64_t GetSize(const Azure::Core::Context& context = Azure::Core::Context());
+
+    /**
+     * @brief Gets the ETag of the version of the blob read.
+     *
+     * @param context Context for cancelling long running operations.
+     * @return The ETag of the blob.
+     */
+    Azure::ETag GetETag(const Azure::Core::Context& context = Azure::Core::Context());
+
+    /**
+     * @brief Gets a stream reading the whole blob through the reader. The stream can outlive the
+     * reader.
+     *
+     * @param context Context for cancelling long running operations.
+     * @return A stream of the contents of the blob.
+     */
+    std::unique_ptr<Azure::Core::IO::BodyStream> GetBodyStream(
+        const Azure::Core::Context& context = Azure::Core::Context());
+
+  private:
+    // Shared with the downloads in the background and the body streams.
+    std::shared_ptr<_detail::BlobRandomAccessReaderState> m_state;
+  };
+
+}}} // namespace Azure::Storage::Blobs
@@ -4,10 +4,12 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include <azure/core/io/shared_buffer.hpp>
 #include <azure/core/operation.hpp>
 #include <azure/core/paged_response.hpp>
 
@@ -24,9 +26,14 @@ namespace Azure { namespace Storage {
 
     class BlobServiceClient;
     class BlobContainerClient;
+    class ShardedBlobContainerClient;
     class BlobClient;
     class PageBlobClient;
 
+    namespace _detail {
+      class FindBlobsByTagsParallelState;
+    } // namespace _detail
+
     namespace Models {
 
       /**
@@ -54,13 +61,266 @@ namespace Azure { namespace Storage {
          */
         Azure::Nullable<ContentHash> TransactionalContentHash;
 
+        /**
+         * The CRC64 of the downloaded content, computed while it was downloaded, if
+         * ComputeContentCrc64 was set in the options.
+         */
+        Azure::Nullable<ContentHash> ContentCrc64;
+
         /**
          * Details information of the downloaded blob.
          */
         DownloadBlobDetails Details;
       };
 
-      using UploadBlockBlobFromResult = UploadBlockBlobResult;
+      /**
+       * @brief Response type for #Azure::Storage::Blobs::BlobClient::DownloadRanges.
+       */
+      struct DownloadBlobRangesResult final
+      {
+        /**
+         * The content of each range, in the order of the ranges. The contents of ranges merged
+         * into a request share the buffer it was downloaded to.
+         */
+        std::vector<Azure::Core::IO::SharedBuffer> Contents;
+
+        /**
+         * The ETag contains a value that you can use to perform operations conditionally.
+         */
+        Azure::ETag ETag;
+
+        /**
+         * The date/time that the blob was last modified. The date format follows RFC 1123.
+         */
+        Azure::DateTime LastModified;
+
+        /**
+         * Size of the blob.
+         */
+        int64_t BlobSize = 0;
+
+        /**
+         * The number of bytes downloaded, including the gaps between the ranges merged.
+         */
+        int64_t DownloadedSize = 0;
+      };
+
+      /**
+       * @brief Response type for #Azure::Storage::Blobs::PageBlobClient::DownloadSparseTo.
+       */
+      struct DownloadSparseBlobToResult final
+      {
+        /**
+         * The ETag contains a value that you can use to perform operations conditionally.
+         */
+        Azure::ETag ETag;
+
+        /**
+         * The date/time that the blob was last modified. The date format follows RFC 1123.
+         */
+        Azure::DateTime LastModified;
+
+        /**
+         * Size of the blob.
+         */
+        int64_t BlobSize = 0;
+
+        /**
+         * The number of bytes downloaded, which is the total size of the populated page ranges.
+         */
+        int64_t DownloadedSize = 0;
+      };
+
+      /**
+       * @brief Response type for #Azure::Storage::Blobs::PageBlobClient::SyncFromSnapshotDiff.
+       */
+      struct SyncPageBlobFromSnapshotDiffResult final
+      {
+        /**
+         * The ETag contains a value that you can use to perform operations conditionally.
+         */
+        Azure::ETag ETag;
+
+        /**
+         * The date/time that the blob was last modified. The date format follows RFC 1123.
+         */
+        Azure::DateTime LastModified;
+
+        /**
+         * Size of the blob, which is the size of the file after the sync.
+         */
+        int64_t BlobSize = 0;
+
+        /**
+         * The number of bytes downloaded, which is the total size of the changed page ranges.
+         */
+        int64_t DownloadedSize = 0;
+
+        /**
+         * The number of bytes zeroed in the file, which is the total size of the cleared page
+         * ranges.
+         */
+        int64_t ClearedSize = 0;
+      };
+
+      /**
+       * @brief Response type for #Azure::Storage::Blobs::PageBlobClient::UploadFrom.
+       */
+      struct UploadPageBlobFromResult final
+      {
+        /**
+         * The ETag contains a value that you can use to perform operations conditionally.
+         */
+        Azure::ETag ETag;
+
+        /**
+         * The date/time that the blob was last modified. The date format follows RFC 1123.
+         */
+        Azure::DateTime LastModified;
+
+        /**
+         * Size of the blob, which is the size of the content rounded up to a multiple of 512
+         * bytes.
+         */
+        int64_t BlobSize = 0;
+
+        /**
+         * The number of bytes uploaded, which is the total size of the pages that aren't all
+         * zeros.
+         */
+        int64_t UploadedSize = 0;
+      };
+
+      /**
+       * @brief Response type for #Azure::Storage::Blobs::BlockBlobClient::UploadFrom.
+       */
+      struct UploadBlockBlobFromResult final
+      {
+        /**
+         * The ETag contains a value that you can use to perform operations conditionally.
+         */
+        Azure::ETag ETag;
+
+        /**
+         * The date and time the container was last modified. Any operation that modifies the blob,
+         * including an update of the metadata or properties, changes the last-modified time of the
+         * blob.
+         */
+        Azure::DateTime LastModified;
+
+        /**
+         * A string value that uniquely identifies the blob. This value is null if Blob Versioning
+         * is not enabled.
+         */
+        Azure::Nullable<std::string> VersionId;
+
+        /**
+         * True if the blob data and metadata are completely encrypted using the specified
+         * algorithm. Otherwise, the value is set to false (when the blob is unencrypted, or if only
+         * parts of the blob/application metadata are encrypted).
+         */
+        bool IsServerEncrypted = false;
+
+        /**
+         * The SHA-256 hash of the encryption key used to encrypt the blob data and metadata.
+         */
+        Azure::Nullable<std::vector<uint8_t>> EncryptionKeySha256;
+
+        /**
+         * Name of the encryption scope used to encrypt the blob data and metadata.
+         */
+        Azure::Nullable<std::string> EncryptionScope;
+
+        /**
+         * If the blob was uploaded with a single upload operation, the hash of the content
+         * returned by the service.
+         */
+        Azure::Nullable<ContentHash> TransactionalContentHash;
+
+        /**
+         * The CRC64 of the uploaded content, computed while it was uploaded, if
+         * ComputeContentCrc64 was set in the options.
+         */
+        Azure::Nullable<ContentHash> ContentCrc64;
+      };
+
+      /**
+       * @brief Response type for #Azure::Storage::Blobs::BlockBlobClient::UploadDeltaFrom.
+       */
+      struct UploadBlockBlobDeltaFromResult final
+      {
+        /**
+         * The ETag contains a value that you can use to perform operations conditionally.
+         */
+        Azure::ETag ETag;
+
+        /**
+         * The date and time the container was last modified. Any operation that modifies the blob,
+         * including an update of the metadata or properties, changes the last-modified time of the
+         * blob.
+         */
+        Azure::DateTime LastModified;
+
+        /**
+         * A string value that uniquely identifies the blob. This value is null if Blob Versioning
+         * is not enabled.
+         */
+        Azure::Nullable<std::string> VersionId;
+
+        /**
+         * True if the blob data and metadata are completely encrypted using the specified
+         * algorithm. Otherwise, the value is set to false (when the blob is unencrypted, or if only
+         * parts of the blob/application metadata are encrypted).
+         */
+        bool IsServerEncrypted = false;
+
+        /**
+         * The SHA-256 hash of the encryption key used to encrypt the blob data and metadata.
+         */
+        Azure::Nullable<std::vector<uint8_t>> EncryptionKeySha256;
+
+        /**
+         * Name of the encryption scope used to encrypt the blob data and metadata.
+         */
+        Azure::Nullable<std::string> EncryptionScope;
+
+        /**
+         * Size of the blob, which is the size of the file.
+         */
+        int64_t BlobSize = 0;
+
+        /**
+         * The number of bytes uploaded, which is the total size of the blocks not found in the
+         * blob.
+         */
+        int64_t UploadedSize = 0;
+      };
+
+      /**
+       * @brief Response type for #Azure::Storage::Blobs::BlobContainerClient::SyncFromDirectory.
+       */
+      struct SyncBlobsFromDirectoryResult final
+      {
+        /**
+         * The number of files uploaded, because their blob was missing or different.
+         */
+        int64_t NumberOfUploadedFiles = 0;
+
+        /**
+         * The number of files whose blob was already up to date.
+         */
+        int64_t NumberOfSkippedFiles = 0;
+
+        /**
+         * The number of blobs deleted because their file no longer exists.
+         */
+        int64_t NumberOfDeletedBlobs = 0;
+
+        /**
+         * The total size of the files uploaded.
+         */
+        int64_t UploadedSize = 0;
+      };
 
       /**
        * @brief Response type for #Azure::Storage::Blobs::BlobLeaseClient::Acquire.
@@ -163,6 +423,27 @@ namespace Azure { namespace Storage {
         std::string LeaseId;
       };
 
+      /**
+       * @brief Response type for #Azure::Storage::Blobs::BlobBatchClient::SubmitBatch.
+       *
+       * @remark A failed sub-request doesn't fail the batch. Its response carries the status code
+       * and the error returned by the service.
+       */
+      struct SubmitBlobBatchResult final
+      {
+        /**
+         * Responses of the delete sub-requests, in the order they were added to the batch. Deleted
+         * is false for the blobs that failed to be deleted.
+         */
+        std::vector<Azure::Response<DeleteBlobResult>> DeleteBlobResults;
+
+        /**
+         * Responses of the set access tier sub-requests, in the order they were added to the
+         * batch.
+         */
+        std::vector<Azure::Response<SetBlobAccessTierResult>> SetBlobAccessTierResults;
+      };
+
     } // namespace Models
 
     /**
@@ -267,6 +548,46 @@ namespace Azure { namespace Storage {
       friend class Azure::Core::PagedResponse<FindBlobsByTagsPagedResponse>;
     };
 
+    /**
+     * @brief Response type for
+     * #Azure::Storage::Blobs::BlobServiceClient::FindBlobsByTagsParallel. The partitions of the
+     * query are walked concurrently in the background, up to a number of pages ahead of the
+     * reads.
+     */
+    class FindBlobsByTagsParallelStream final {
+    public:
+      /**
+       * @brief Stops walking the partitions, and waits for the requests in progress.
+       */
+      ~FindBlobsByTagsParallelStream();
+
+      FindBlobsByTagsParallelStream(FindBlobsByTagsParallelStream&&) = default;
+      FindBlobsByTagsParallelStream& operator=(FindBlobsByTagsParallelStream&&) = default;
+
+      /**
+       * @brief Reads the next page of blobs received from any partition, waiting for one if none
+       * is.
+       *
+       * @param context Context for cancelling the wait.
+       * @return The blobs of the page, or null once all the partitions have been walked.
+       * @remark Throws the error a partition failed with, once the pages received before it have
+       * been read.
+       */
+      Azure::Nullable<std::vector<Models::TaggedBlobItem>> ReadNextPage(
+          const Azure::Core::Context& context = Azure::Core::Context());
+
+    private:
+      explicit FindBlobsByTagsParallelStream(
+          std::shared_ptr<_detail::FindBlobsByTagsParallelState> state)
+          : m_state(std::move(state))
+      {
+      }
+
+      std::shared_ptr<_detail::FindBlobsByTagsParallelState> m_state;
+
+      friend class BlobServiceClient;
+    };
+
     /**
      * @brief Response type for #Azure::Storage::Blobs::BlobContainerClient::ListBlobs.
      */
@@ -302,6 +623,143 @@ namespace Azure { namespace Storage {
       friend class Azure::Core::PagedResponse<ListBlobsPagedResponse>;
     };
 
+    /**
+     * @brief Response type for #Azure::Storage::Blobs::ShardedBlobContainerClient::ListBlobs.
+     */
+    class ShardedListBlobsPagedResponse final
+        : public Azure::Core::PagedResponse<ShardedListBlobsPagedResponse> {
+    public:
+      /**
+       * Blob name prefix that's used to filter the result.
+       */
+      std::string Prefix;
+
+      /**
+       * Blob items, of a page of each shard listed.
+       */
+      std::vector<Models::BlobItem> Blobs;
+
+    private:
+      void OnNextPage(const Azure::Core::Context& context);
+
+      std::shared_ptr<ShardedBlobContainerClient> m_shardedBlobContainerClient;
+      ListBlobsOptions m_operationOptions;
+
+      friend class ShardedBlobContainerClient;
+      friend class Azure::Core::PagedResponse<ShardedListBlobsPagedResponse>;
+    };
+
+    /**
+     * @brief Response type for #Azure::Storage::Blobs::BlobContainerClient::ListBlobsCompact.
+     */
+    class ListBlobsCompactPagedResponse final
+        : public Azure::Core::PagedResponse<ListBlobsCompactPagedResponse> {
+    public:
+      /**
+       * Service endpoint.
+       */
+      std::string ServiceEndpoint;
+
+      /**
+       * Name of the container.
+       */
+      std::string BlobContainerName;
+
+      /**
+       * Blob name prefix that's used to filter the result.
+       */
+      std::string Prefix;
+
+      /**
+       * Blob items. Their strings are valid until the response moves to the next page or is
+       * destroyed.
+       */
+      std::vector<Models::CompactBlobItem> Blobs;
+
+    private:
+      void OnNextPage(const Azure::Core::Context& context);
+
+      std::vector<char> m_arena;
+      std::shared_ptr<BlobContainerClient> m_blobContainerClient;
+      ListBlobsCompactOptions m_operationOptions;
+
+      friend class BlobContainerClient;
+      friend class Azure::Core::PagedResponse<ListBlobsCompactPagedResponse>;
+    };
+
+    /**
+     * @brief Response type for #Azure::Storage::Blobs::BlobContainerClient::ListBlobsStreaming.
+     * The blobs of a page are deserialized one at a time while the page is received, instead of
+     * all at once after the whole page has been buffered.
+     */
+    class ListBlobsPageStream final {
+    public:
+      /**
+       * Service endpoint.
+       */
+      std::string ServiceEndpoint;
+
+      /**
+       * Name of the container.
+       */
+      std::string BlobContainerName;
+
+      /**
+       * Blob name prefix that's used to filter the result.
+       */
+      std::string Prefix;
+
+      /**
+       * The token of the current page.
+       */
+      std::string CurrentPageToken;
+
+      /**
+       * The token of the next page, set once ReadNextBlob() has returned null. Empty or null on
+       * the last page.
+       */
+      Azure::Nullable<std::string> NextPageToken;
+
+      /**
+       * The HTTP response of the current page, without its body stream, which is read by
+       * ReadNextBlob().
+       */
+      std::unique_ptr<Azure::Core::Http::RawResponse> RawResponse;
+
+      /**
+       * @brief Reads the next blob of the current page.
+       *
+       * @return The next blob, or null after the last blob of the page.
+       */
+      Azure::Nullable<Models::BlobItem> ReadNextBlob();
+
+      /**
+       * @brief Checks if a page exists.
+       *
+       * @return False if MoveToNextPage() was called on the last page.
+       */
+      bool HasPage() const { return m_hasPage; }
+
+      /**
+       * @brief Moves to the next page. The blobs left in the current page are read and discarded.
+       *
+       * @param context Context for cancelling long running operations.
+       */
+      void MoveToNextPage(const Azure::Core::Context& context = Azure::Core::Context());
+
+    private:
+      ListBlobsPageStream() = default;
+
+      std::unique_ptr<_detail::BlobRestClient::BlobContainer::ListBlobsResultStreamReader>
+          m_reader;
+      Azure::Nullable<Models::BlobItem> m_nextBlob;
+      std::shared_ptr<BlobContainerClient> m_blobContainerClient;
+      ListBlobsOptions m_operationOptions;
+      bool m_hasPage = true;
+
+      friend class BlobContainerClient;
+    };
+
     /**
      * @brief Response type for #Azure::Storage::Blobs::BlobContainerClient::ByHierarchy.
      */
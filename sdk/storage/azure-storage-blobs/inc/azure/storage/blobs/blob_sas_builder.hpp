@@ -4,6 +4,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <azure/storage/common/account_sas_builder.hpp>
 
@@ -289,6 +290,20 @@ namespace Azure { namespace Storage { namespace Sas {
      */
     std::string GenerateSasToken(const StorageSharedKeyCredential& credential);
 
+    /**
+     * @brief Uses the StorageSharedKeyCredential to sign a blob SAS for each of many blobs in
+     * #BlobContainerName, which share the other fields of this builder. The parts of the string
+     * to sign and of the SAS shared by the blobs are formatted once, and the blobs are signed with
+     * the key the credential decodes once.
+     *
+     * @param blobNames The names of the blobs being made accessible.
+     * @param credential The storage account's shared key credential.
+     * @return The SAS query parameters of each blob, in the order of \p blobNames.
+     */
+    std::vector<std::string> GenerateSasTokens(
+        const std::vector<std::string>& blobNames,
+        const StorageSharedKeyCredential& credential);
+
     /**
      * @brief Uses an account's user delegation key to sign this shared access signature, to
      * produce the proper SAS query parameters for authentication requests.
@@ -304,6 +319,14 @@ namespace Azure { namespace Storage { namespace Sas {
 
   private:
     std::string Permissions;
+
+    // Formats the string to sign around the blob name and the SAS around the signature.
+    void FormatSasTemplate(
+        const std::string& accountName,
+        std::string& stringToSignPrefix,
+        std::string& stringToSignSuffix,
+        std::string& sasTokenPrefix,
+        std::string& sasTokenSuffix);
   };
 
 }}} // namespace Azure::Storage::Sas
@@ -3,16 +3,128 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <azure/core/credentials/credentials.hpp>
+#include <azure/storage/common/bulk_operation.hpp>
 #include <azure/storage/common/storage_credential.hpp>
 
+#include "azure/storage/blobs/blob_batch_client.hpp"
 #include "azure/storage/blobs/blob_container_client.hpp"
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  class BlobServiceClient;
+
+  /**
+   * @brief Operations on many containers and blobs of an account, to be submitted with
+   * #Azure::Storage::Blobs::BlobServiceClient::SubmitBulkOperations.
+   */
+  class BlobBulkOperations final {
+  public:
+    /**
+     * @brief Adds an operation creating a container.
+     *
+     * @param blobContainerName The name of the container to create.
+     * @param options Optional parameters to execute the operation.
+     * @return The index of the operation in
+     * #Azure::Storage::BulkOperationResult::Errors.
+     */
+    size_t CreateBlobContainer(
+        const std::string& blobContainerName,
+        const CreateBlobContainerOptions& options = CreateBlobContainerOptions());
+
+    /**
+     * @brief Adds an operation deleting a container.
+     *
+     * @param blobContainerName The name of the container to delete.
+     * @param options Optional parameters to execute the operation.
+     * @return The index of the operation in
+     * #Azure::Storage::BulkOperationResult::Errors.
+     */
+    size_t DeleteBlobContainer(
+        const std::string& blobContainerName,
+        const DeleteBlobContainerOptions& options = DeleteBlobContainerOptions());
+
+    /**
+     * @brief Adds an operation setting the metadata of a container.
+     *
+     * @param blobContainerName The name of the container.
+     * @param metadata The metadata to set.
+     * @param options Optional parameters to execute the operation.
+     * @return The index of the operation in
+     * #Azure::Storage::BulkOperationResult::Errors.
+     */
+    size_t SetBlobContainerMetadata(
+        const std::string& blobContainerName,
+        Metadata metadata,
+        const SetBlobContainerMetadataOptions& options = SetBlobContainerMetadataOptions());
+
+    /**
+     * @brief Adds an operation deleting a blob, which can be batched.
+     *
+     * @param blobContainerName The name of the container containing the blob.
+     * @param blobName The name of the blob to delete.
+     * @param options Optional parameters to execute the operation.
+     * @return The index of the operation in
+     * #Azure::Storage::BulkOperationResult::Errors.
+     */
+    size_t DeleteBlob(
+        const std::string& blobContainerName,
+        const std::string& blobName,
+        const DeleteBlobOptions& options = DeleteBlobOptions());
+
+    /**
+     * @brief Adds an operation setting the metadata of a blob.
+     *
+     * @param blobContainerName The name of the container containing the blob.
+     * @param blobName The name of the blob.
+     * @param metadata The metadata to set.
+     * @param options Optional parameters to execute the operation.
+     * @return The index of the operation in
+     * #Azure::Storage::BulkOperationResult::Errors.
+     */
+    size_t SetBlobMetadata(
+        const std::string& blobContainerName,
+        const std::string& blobName,
+        Metadata metadata,
+        const SetBlobMetadataOptions& options = SetBlobMetadataOptions());
+
+    /**
+     * @brief Adds an operation setting the tier of a blob, which can be batched.
+     *
+     * @param blobContainerName The name of the container containing the blob.
+     * @param blobName The name of the blob.
+     * @param tier The tier to set.
+     * @param options Optional parameters to execute the operation.
+     * @return The index of the operation in
+     * #Azure::Storage::BulkOperationResult::Errors.
+     */
+    size_t SetBlobAccessTier(
+        const std::string& blobContainerName,
+        const std::string& blobName,
+        Models::AccessTier tier,
+        const SetBlobAccessTierOptions& options = SetBlobAccessTierOptions());
+
+  private:
+    friend class BlobServiceClient;
+
+    struct Operation final
+    {
+      // Sends the operation as a single request.
+      std::function<void(const BlobServiceClient&, const Azure::Core::Context&)> Execute;
+      // Adds the operation to a batch, if it can be batched. Returns its index in the results of
+      // its kind.
+      std::function<int32_t(BlobBatch&)> AddToBatch;
+      bool IsDeletion = false;
+    };
+
+    std::vector<Operation> m_operations;
+  };
+
   /**
    * The BlobServiceClient allows you to manipulate Azure Storage service resources and blob
    * containers. The storage account provides the top-level namespace for the Blob service.
@@ -186,6 +298,24 @@ namespace Azure { namespace Storage { namespace Blobs {
         const FindBlobsByTagsOptions& options = FindBlobsByTagsOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Finds the blobs of the account whose tags match an expression, with a query per
+     * container walked concurrently instead of a single sequence of pages.
+     *
+     * @param tagFilterSqlExpression The where parameter enables the caller to query blobs whose
+     * tags match a given expression. It mustn't have a `@container` condition, which is added for
+     * each container.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations. It's also used to walk the
+     * partitions in the background.
+     * @return A FindBlobsByTagsParallelStream reading the pages of the blobs, in no particular
+     * order across containers.
+     */
+    FindBlobsByTagsParallelStream FindBlobsByTagsParallel(
+        const std::string& tagFilterSqlExpression,
+        const FindBlobsByTagsParallelOptions& options = FindBlobsByTagsParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Creates a new blob container under the specified account. If the container with the
      * same name already exists, the operation fails.
@@ -229,10 +359,33 @@ namespace Azure { namespace Storage { namespace Blobs {
         const UndeleteBlobContainerOptions& options = UndeleteBlobContainerOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Runs many operations on the containers and the blobs of the account in parallel. A
+     * failed operation doesn't stop the other ones.
+     *
+     * @param operations The operations to run, in no particular order.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return The error of each operation, null for the operations that succeeded.
+     * @remark With a `BatchClient`, the operations that can be batched are submitted in batches
+     * of up to 256 operations, and the other ones as single requests. The operations of a batch
+     * whose request fails as a whole are sent as single requests.
+     */
+    BulkOperationResult SubmitBulkOperations(
+        const BlobBulkOperations& operations,
+        const SubmitBlobBulkOperationsOptions& options = SubmitBlobBulkOperationsOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
   private:
     Azure::Core::Url m_serviceUrl;
     std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    // The same pipeline without the credential of the client, for the requests to source blobs
+    // which are authorized by their URL.
+    std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_sourcePipeline;
     Azure::Nullable<EncryptionKey> m_customerProvidedKey;
     Azure::Nullable<std::string> m_encryptionScope;
+    std::shared_ptr<TransferScheduler> m_transferScheduler;
+    std::shared_ptr<BufferPool> m_bufferPool;
+    std::shared_ptr<BlobPropertiesCache> m_propertiesCache;
   };
 }}} // namespace Azure::Storage::Blobs
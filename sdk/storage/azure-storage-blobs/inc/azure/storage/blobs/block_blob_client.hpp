@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -127,6 +128,25 @@ namespace Azure { namespace Storage { namespace Blobs {
         const UploadBlockBlobOptions& options = UploadBlockBlobOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Creates a new block blob, or updates the content of an existing block blob, without
+     * waiting for the response.
+     *
+     * @remark \p content must be kept alive until \p callback is called. The calling thread is
+     * only blocked by the policies and the transport without an asynchronous implementation. Use
+     * Azure::Core::ResponseAwaitable to `co_await` the upload.
+     *
+     * @param content A BodyStream containing the content to upload.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @param callback The function called with the UploadBlockBlobResult, or with the error.
+     */
+    void UploadAsync(
+        Azure::Core::IO::BodyStream& content,
+        const UploadBlockBlobOptions& options,
+        const Azure::Core::Context& context,
+        Azure::Core::ResponseCallback<Models::UploadBlockBlobResult> callback) const;
+
     /**
      * @brief Creates a new block blob, or updates the content of an existing block blob. Updating
      * an existing block blob overwrites any existing metadata on the blob.
@@ -157,6 +177,48 @@ namespace Azure { namespace Storage { namespace Blobs {
         const UploadBlockBlobFromOptions& options = UploadBlockBlobFromOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Creates a new block blob, or updates the content of an existing block blob, from a
+     * stream read once to its end. Updating an existing block blob overwrites any existing
+     * metadata on the blob.
+     *
+     * @remark The stream doesn't need to know its length or to be rewindable, such as a pipe or a
+     * socket. Blocks of TransferOptions.ChunkSize bytes, 4MiB by default, are read one after the
+     * other into up to TransferOptions.Concurrency buffers and staged concurrently, then committed
+     * when the stream ends. Content shorter than a block is uploaded with a single upload
+     * operation. TransferOptions.SingleUploadThreshold and TransferOptions.Strategy aren't used.
+     *
+     * @param content A stream containing the content to upload.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A UploadBlockBlobFromResult describing the state of the updated block blob.
+     */
+    Azure::Response<Models::UploadBlockBlobFromResult> UploadFrom(
+        Azure::Core::IO::BodyStream& content,
+        const UploadBlockBlobFromOptions& options = UploadBlockBlobFromOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Uploads a file to this block blob, staging only the blocks the blob doesn't have
+     * already. The file is split into blocks whose boundaries depend on their content, named after
+     * the SHA-256 of their content, so that a file changed in a few places shares most of its
+     * blocks with the blob uploaded from its previous version. Only the blocks missing from the
+     * committed blocks of the blob are staged, then all of them are committed.
+     *
+     * @remark The blocks are only reused from a blob uploaded by this function with the same
+     * TransferOptions.AverageBlockSize. The blob must not be changed by another client during the
+     * upload, or the commit fails.
+     *
+     * @param fileName A file containing the content to upload.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A UploadBlockBlobDeltaFromResult describing the state of the updated block blob.
+     */
+    Azure::Response<Models::UploadBlockBlobDeltaFromResult> UploadDeltaFrom(
+        const std::string& fileName,
+        const UploadBlockBlobDeltaFromOptions& options = UploadBlockBlobDeltaFromOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Creates a new block as part of a block blob's staging area to be eventually
      * committed via the CommitBlockList operation.
@@ -174,6 +236,28 @@ namespace Azure { namespace Storage { namespace Blobs {
         const StageBlockOptions& options = StageBlockOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Creates a new block as part of a block blob's staging area, without waiting for the
+     * response.
+     *
+     * @remark \p content must be kept alive until \p callback is called. The calling thread is
+     * only blocked by the policies and the transport without an asynchronous implementation. Use
+     * Azure::Core::ResponseAwaitable to `co_await` the block.
+     *
+     * @param blockId A valid Base64 string value that identifies the block. Prior to encoding, the
+     * string must be less than or equal to 64 bytes in size.
+     * @param content A BodyStream containing the content to upload.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @param callback The function called with the StageBlockResult, or with the error.
+     */
+    void StageBlockAsync(
+        const std::string& blockId,
+        Azure::Core::IO::BodyStream& content,
+        const StageBlockOptions& options,
+        const Azure::Core::Context& context,
+        Azure::Core::ResponseCallback<Models::StageBlockResult> callback) const;
+
     /**
      * @brief Creates a new block to be committed as part of a blob where the contents are read from
      * the sourceUri.
@@ -194,6 +278,28 @@ namespace Azure { namespace Storage { namespace Blobs {
         const StageBlockFromUriOptions& options = StageBlockFromUriOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Copies a blob to this block blob by staging ranges of the source as blocks
+     * concurrently, then committing them. The bytes are copied by the service, without going
+     * through this host. Updating an existing block blob overwrites any existing metadata on the
+     * blob.
+     *
+     * @remark Unlike StartCopyFromUri, the copy is done when the function returns, and its
+     * throughput is set by TransferOptions.Concurrency and the transfer scheduler of the client.
+     * The source must be public or authorized with a SAS, like with StageBlockFromUri. Its HTTP
+     * headers and metadata are copied, and the blocks are only staged from the version of the
+     * source found when the copy starts.
+     *
+     * @param sourceUri Specifies the uri of the source blob.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A CommitBlockListResult describing the state of the updated block blob.
+     */
+    Azure::Response<Models::CommitBlockListResult> CopyFromUriParallel(
+        const std::string& sourceUri,
+        const CopyBlockBlobFromUriParallelOptions& options = CopyBlockBlobFromUriParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Writes a blob by specifying the list of block IDs that make up the blob. In order to
      * be written as part of a blob, a block must have been successfully written to the server in a
@@ -228,9 +334,47 @@ namespace Azure { namespace Storage { namespace Blobs {
         const GetBlockListOptions& options = GetBlockListOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Retrieves the list of blocks of a block blob, like GetBlockList(), but deserializes
+     * them while the response is received, and passes them to blocksFunc in batches of compact
+     * blocks. Only a batch is kept in memory, whatever the number of blocks.
+     *
+     * @param blocksFunc The function called with each batch of blocks, in order. The names of the
+     * blocks are valid until it returns.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A GetBlockListStreamingResult describing the block blob.
+     */
+    Azure::Response<Models::GetBlockListStreamingResult> GetBlockListStreaming(
+        const std::function<void(const Models::CompactBlobBlock* blocks, size_t count)>&
+            blocksFunc,
+        const GetBlockListOptions& options = GetBlockListOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
   private:
     explicit BlockBlobClient(BlobClient blobClient);
+
+    _detail::BlobRestClient::BlockBlob::UploadBlockBlobOptions GetUploadProtocolLayerOptions(
+        const UploadBlockBlobOptions& options) const;
+
+    _detail::BlobRestClient::BlockBlob::StageBlockOptions GetStageBlockProtocolLayerOptions(
+        const std::string& blockId,
+        const StageBlockOptions& options) const;
+
+    // Commits the blocks numbered from 0 to numBlocks - 1 by UploadFrom, whose IDs are formatted
+    // while the request body is sent.
+    Azure::Response<Models::CommitBlockListResult> CommitNumberedBlockList(
+        int64_t numBlocks,
+        const CommitBlockListOptions& options,
+        const Azure::Core::Context& context) const;
+
+    Azure::Response<Models::CommitBlockListResult> CommitBlockList(
+        const std::vector<std::string>& blockIds,
+        int64_t numNumberedBlocks,
+        const CommitBlockListOptions& options,
+        const Azure::Core::Context& context) const;
     friend class BlobClient;
+    friend class BlobContainerClient;
     friend class Files::DataLake::DataLakeFileClient;
   };
 
@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <azure/core/context.hpp>
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  /**
+   * @brief A key encrypting the content keys of client-side encrypted blobs, such as a key in
+   * Azure Key Vault.
+   *
+   * @remark A key in Key Vault is used by implementing #WrapKey and #UnwrapKey with the WrapKey
+   * and UnwrapKey operations of its `CryptographyClient`. The functions may be called from
+   * several threads at once.
+   */
+  class KeyEncryptionKey {
+  public:
+    virtual ~KeyEncryptionKey() = default;
+
+    /**
+     * @brief Gets the identifier of the key, stored with the content key it wraps.
+     */
+    virtual std::string GetKeyId() const = 0;
+
+    /**
+     * @brief Encrypts a content key.
+     *
+     * @param algorithm The key wrap algorithm, such as "RSA-OAEP-256".
+     * @param key The content key.
+     * @param context Context for cancelling long running operations.
+     * @return The encrypted content key.
+     */
+    virtual std::vector<uint8_t> WrapKey(
+        const std::string& algorithm,
+        const std::vector<uint8_t>& key,
+        const Azure::Core::Context& context)
+        = 0;
+
+    /**
+     * @brief Decrypts a content key encrypted by #WrapKey.
+     *
+     * @param algorithm The key wrap algorithm the content key was encrypted with.
+     * @param encryptedKey The encrypted content key.
+     * @param context Context for cancelling long running operations.
+     * @return The content key.
+     */
+    virtual std::vector<uint8_t> UnwrapKey(
+        const std::string& algorithm,
+        const std::vector<uint8_t>& encryptedKey,
+        const Azure::Core::Context& context)
+        = 0;
+
+  protected:
+    KeyEncryptionKey() = default;
+    KeyEncryptionKey(const KeyEncryptionKey&) = default;
+    KeyEncryptionKey& operator=(const KeyEncryptionKey&) = default;
+  };
+
+  /**
+   * @brief Options for the client-side encryption of the content of a blob.
+   *
+   * @remark The content is encrypted with AES-256-GCM in segments of 4MiB, each with a nonce of
+   * its own, so the chunks of a transfer are encrypted and decrypted in the transfer threads
+   * independently. The content key is generated for each upload, and stored in the metadata of
+   * the blob wrapped by the key encryption key.
+   */
+  struct ClientSideEncryptionOptions final
+  {
+    /**
+     * @brief The key wrapping the content keys.
+     */
+    std::shared_ptr<Blobs::KeyEncryptionKey> KeyEncryptionKey;
+
+    /**
+     * @brief The algorithm the content keys are wrapped with when uploading.
+     */
+    std::string KeyWrapAlgorithm = "RSA-OAEP-256";
+
+    /**
+     * @brief If true, downloading a blob without encryption data fails instead of returning its
+     * content as it is, so that a blob replaced by a plaintext one isn't taken as decrypted.
+     */
+    bool RequireEncryption = true;
+  };
+
+}}} // namespace Azure::Storage::Blobs
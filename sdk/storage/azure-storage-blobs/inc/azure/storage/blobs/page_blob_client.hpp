@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -219,6 +220,23 @@ namespace Azure { namespace Storage { namespace Blobs {
         const GetPageRangesOptions& options = GetPageRangesOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Returns the valid page ranges for a page blob or snapshot of a page blob, like
+     * GetPageRanges(), but deserializes them while the response is received, and passes them to
+     * rangesFunc in batches of compact ranges. Only a batch is kept in memory, whatever the number
+     * of ranges, and the ranges the caller keeps are up to rangesFunc.
+     *
+     * @param rangesFunc The function called with each batch of page ranges, in order.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A GetPageRangesStreamingResult describing the page blob.
+     */
+    Azure::Response<Models::GetPageRangesStreamingResult> GetPageRangesStreaming(
+        const std::function<void(const Models::CompactPageRange* ranges, size_t count)>&
+            rangesFunc,
+        const GetPageRangesOptions& options = GetPageRangesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Returns the list of page ranges that differ between a previous snapshot and this page
      * blob. Changes include both updated and cleared pages.
@@ -272,10 +290,84 @@ namespace Azure { namespace Storage { namespace Blobs {
         const StartBlobCopyIncrementalOptions& options = StartBlobCopyIncrementalOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Downloads this page blob to a sparse file. Only the populated page ranges are
+     * downloaded, in parallel, and the clear ones are left as holes of the file, which read as
+     * zeros without taking space on disk.
+     *
+     * @param fileName A file path to write the downloaded content to.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A DownloadSparseBlobToResult describing the downloaded blob.
+     * @remark On a file system not supporting sparse files, the clear ranges are written as zeros
+     * by the file system itself, still without being downloaded.
+     */
+    Azure::Response<Models::DownloadSparseBlobToResult> DownloadSparseTo(
+        const std::string& fileName,
+        const DownloadSparseBlobToOptions& options = DownloadSparseBlobToOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Brings a local copy of a snapshot of this page blob up to date with a later snapshot.
+     * Only the page ranges changed between the two snapshots are downloaded, in parallel, and the
+     * cleared ones are zeroed in the file, as holes where the file system supports it.
+     *
+     * @param fileName A file path holding the content of previousSnapshot, updated in place.
+     * @param previousSnapshot The snapshot the file holds the content of.
+     * @param snapshot The later snapshot to update the file to. An empty string updates the file to
+     * the current content of the blob.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A SyncPageBlobFromSnapshotDiffResult describing the synced blob.
+     * @remark If an error occurs, the file holds neither snapshot and must be synced again.
+     */
+    Azure::Response<Models::SyncPageBlobFromSnapshotDiffResult> SyncFromSnapshotDiff(
+        const std::string& fileName,
+        const std::string& previousSnapshot,
+        const std::string& snapshot,
+        const SyncPageBlobFromSnapshotDiffOptions& options = SyncPageBlobFromSnapshotDiffOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Creates a new page blob with the content of a buffer, or replaces an existing blob.
+     * The content is scanned in parallel for pages of 512 bytes that are all zeros, which are
+     * skipped since the new blob reads as zeros, and the other pages are uploaded concurrently.
+     *
+     * @param buffer A memory buffer containing the content to upload.
+     * @param bufferSize Size of the memory buffer. The last page is padded with zeros if the size
+     * isn't a multiple of 512 bytes.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A UploadPageBlobFromResult describing the state of the created page blob.
+     */
+    Azure::Response<Models::UploadPageBlobFromResult> UploadFrom(
+        const uint8_t* buffer,
+        size_t bufferSize,
+        const UploadPageBlobFromOptions& options = UploadPageBlobFromOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Creates a new page blob with the content of a file, such as a disk image, or replaces
+     * an existing blob. The file is read and scanned in parallel for pages of 512 bytes that are
+     * all zeros, which are skipped since the new blob reads as zeros, and the other pages are
+     * uploaded concurrently. A sparse disk image is uploaded in proportion to its used size.
+     *
+     * @param fileName A file containing the content to upload. The last page is padded with zeros
+     * if the size of the file isn't a multiple of 512 bytes.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A UploadPageBlobFromResult describing the state of the created page blob.
+     */
+    Azure::Response<Models::UploadPageBlobFromResult> UploadFrom(
+        const std::string& fileName,
+        const UploadPageBlobFromOptions& options = UploadPageBlobFromOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
   private:
     explicit PageBlobClient(BlobClient blobClient);
 
     friend class BlobClient;
+    friend class BlobContainerClient;
   };
 
 }}} // namespace Azure::Storage::Blobs
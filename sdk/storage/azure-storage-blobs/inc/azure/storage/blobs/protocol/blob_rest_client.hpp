@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -2023,6 +2027,211 @@ namespace Azure { namespace Storage { namespace Blobs {
       return lhs;
     }
 
+    enum class CompactBlobItemFields
+    {
+      /**
+       * Only the name of the blobs is deserialized.
+       */
+      None = 0,
+      /**
+       * The size of the blobs is deserialized.
+       */
+      BlobSize = 1,
+      /**
+       * The ETag of the blobs is deserialized.
+       */
+      ETag = 2,
+      /**
+       * The last modified time of the blobs is deserialized.
+       */
+      LastModified = 4,
+      /**
+       * Whether the blobs are deleted is deserialized.
+       */
+      IsDeleted = 8,
+    }; // bitwise enum CompactBlobItemFields
+
+    inline CompactBlobItemFields operator|(CompactBlobItemFields lhs, CompactBlobItemFields rhs)
+    {
+      using type = std::underlying_type_t<CompactBlobItemFields>;
+      return static_cast<CompactBlobItemFields>(static_cast<type>(lhs) | static_cast<type>(rhs));
+    }
+
+    inline CompactBlobItemFields& operator|=(CompactBlobItemFields& lhs, CompactBlobItemFields rhs)
+    {
+      lhs = lhs | rhs;
+      return lhs;
+    }
+
+    inline CompactBlobItemFields operator&(CompactBlobItemFields lhs, CompactBlobItemFields rhs)
+    {
+      using type = std::underlying_type_t<CompactBlobItemFields>;
+      return static_cast<CompactBlobItemFields>(static_cast<type>(lhs) & static_cast<type>(rhs));
+    }
+
+    inline CompactBlobItemFields& operator&=(CompactBlobItemFields& lhs, CompactBlobItemFields rhs)
+    {
+      lhs = lhs & rhs;
+      return lhs;
+    }
+
+    /**
+     * @brief A blob item with a few of the fields of #Azure::Storage::Blobs::Models::BlobItem. Its
+     * strings are owned by the page it comes from, and are only valid as long as the page is.
+     */
+    struct CompactBlobItem final
+    {
+      /**
+       * Blob name, NUL-terminated.
+       */
+      const char* Name = "";
+      /**
+       * Length of the blob name, in bytes.
+       */
+      size_t NameLength = 0;
+      /**
+       * Size in bytes, if CompactBlobItemFields::BlobSize was requested.
+       */
+      int64_t BlobSize = 0;
+      /**
+       * ETag, NUL-terminated, if CompactBlobItemFields::ETag was requested. Empty otherwise.
+       */
+      const char* ETag = "";
+      /**
+       * The date and time the blob was last modified, if CompactBlobItemFields::LastModified was
+       * requested.
+       */
+      Azure::DateTime LastModified;
+      /**
+       * Indicates whether this blob was deleted, if CompactBlobItemFields::IsDeleted was
+       * requested.
+       */
+      bool IsDeleted = false;
+    }; // struct CompactBlobItem
+
+    /**
+     * @brief A page range of a page blob, with a length that is always known, unlike
+     * #Azure::Core::Http::HttpRange.
+     */
+    struct CompactPageRange final
+    {
+      /**
+       * Offset of the first byte of the range.
+       */
+      int64_t Offset = 0;
+      /**
+       * Length of the range, in bytes.
+       */
+      int64_t Length = 0;
+    }; // struct CompactPageRange
+
+    /**
+     * @brief A block of a block blob. Its name is owned by the batch it comes from, and is only
+     * valid as long as the batch is.
+     */
+    struct CompactBlobBlock final
+    {
+      /**
+       * Base64 encoded block ID, NUL-terminated.
+       */
+      const char* Name = "";
+      /**
+       * Length of the block ID, in bytes.
+       */
+      size_t NameLength = 0;
+      /**
+       * Block size in bytes.
+       */
+      int64_t Size = 0;
+      /**
+       * Indicates whether the block is in the committed block list, rather than in the
+       * uncommitted one.
+       */
+      bool IsCommitted = false;
+    }; // struct CompactBlobBlock
+
+    /**
+     * @brief Response type for #Azure::Storage::Blobs::PageBlobClient::GetPageRangesStreaming.
+     */
+    struct GetPageRangesStreamingResult final
+    {
+      /**
+       * The ETag contains a value that you can use to perform operations conditionally.
+       */
+      Azure::ETag ETag;
+      /**
+       * The date and time the blob was last modified.
+       */
+      Azure::DateTime LastModified;
+      /**
+       * Size of the blob.
+       */
+      int64_t BlobSize = 0;
+    }; // struct GetPageRangesStreamingResult
+
+    /**
+     * @brief Response type for #Azure::Storage::Blobs::BlockBlobClient::GetBlockListStreaming.
+     */
+    struct GetBlockListStreamingResult final
+    {
+      /**
+       * The ETag contains a value that you can use to perform operations conditionally.
+       */
+      Azure::ETag ETag;
+      /**
+       * The date and time the blob was last modified.
+       */
+      Azure::DateTime LastModified;
+      /**
+       * Size of the blob.
+       */
+      int64_t BlobSize = 0;
+    }; // struct GetBlockListStreamingResult
+
+    /**
+     * @brief An error reported while a blob was queried.
+     */
+    struct BlobQueryError final
+    {
+      /**
+       * The name of the error.
+       */
+      std::string Name;
+      /**
+       * A description of the error.
+       */
+      std::string Description;
+      /**
+       * Indicates whether the error stopped the query.
+       */
+      bool IsFatal = false;
+      /**
+       * The position in the blob of the error.
+       */
+      int64_t Position = 0;
+    }; // struct BlobQueryError
+
+    /**
+     * @brief Response type for #Azure::Storage::Blobs::BlobClient::Query.
+     */
+    struct QueryBlobResult final
+    {
+      /**
+       * The records selected by the query, in the output format of the query.
+       */
+      std::unique_ptr<Azure::Core::IO::BodyStream> BodyStream;
+      /**
+       * The ETag contains a value that you can use to perform operations conditionally.
+       */
+      Azure::ETag ETag;
+      /**
+       * The date and time the blob was last modified. Any operation that modifies the blob,
+       * including an update of the metadata or properties, changes the last-modified time of the
+       * blob.
+       */
+      Azure::DateTime LastModified;
+    }; // struct QueryBlobResult
+
     /**
      * @brief Azure::Storage::Blobs::PageBlobClient::Resize.
      */
@@ -2648,6 +2857,32 @@ namespace Azure { namespace Storage { namespace Blobs {
       }; // struct ListBlobsResult
     } // namespace _detail
 
+    namespace _detail {
+      struct ListBlobsCompactResult final
+      {
+        std::string ServiceEndpoint;
+        std::string BlobContainerName;
+        std::string Prefix;
+        Azure::Nullable<std::string> ContinuationToken;
+        std::vector<CompactBlobItem> Items;
+        // Holds the strings of the items.
+        std::vector<char> Arena;
+      }; // struct ListBlobsCompactResult
+    } // namespace _detail
+
+    namespace _detail {
+      struct QueryTextConfiguration final
+      {
+        // "delimited" or "json".
+        std::string FormatType;
+        std::string RecordSeparator;
+        std::string ColumnSeparator;
+        std::string FieldQuote;
+        std::string EscapeChar;
+        bool HasHeaders = false;
+      }; // struct QueryTextConfiguration
+    } // namespace _detail
+
     namespace _detail {
       struct ReleaseBlobContainerLeaseResult final
       {
@@ -2806,67 +3041,11 @@ namespace Azure { namespace Storage { namespace Blobs {
   namespace _detail {
 
     using namespace Models;
+    using Azure::Core::Http::_internal::WellKnownHeader;
 
-    inline std::string ListBlobContainersIncludeFlagsToString(
-        const ListBlobContainersIncludeFlags& val)
-    {
-      ListBlobContainersIncludeFlags value_list[] = {
-          ListBlobContainersIncludeFlags::Metadata,
-          ListBlobContainersIncludeFlags::Deleted,
-      };
-      const char* string_list[] = {
-          "metadata",
-          "deleted",
-      };
-      std::string ret;
-      for (size_t i = 0; i < sizeof(value_list) / sizeof(ListBlobContainersIncludeFlags); ++i)
-      {
-        if ((val & value_list[i]) == value_list[i])
-        {
-          if (!ret.empty())
-          {
-            ret += ",";
-          }
-          ret += string_list[i];
-        }
-      }
-      return ret;
-    }
+    std::string ListBlobContainersIncludeFlagsToString(const ListBlobContainersIncludeFlags& val);
 
-    inline std::string ListBlobsIncludeFlagsToString(const ListBlobsIncludeFlags& val)
-    {
-      ListBlobsIncludeFlags value_list[] = {
-          ListBlobsIncludeFlags::Copy,
-          ListBlobsIncludeFlags::Deleted,
-          ListBlobsIncludeFlags::Metadata,
-          ListBlobsIncludeFlags::Snapshots,
-          ListBlobsIncludeFlags::Versions,
-          ListBlobsIncludeFlags::UncomittedBlobs,
-          ListBlobsIncludeFlags::Tags,
-      };
-      const char* string_list[] = {
-          "copy",
-          "deleted",
-          "metadata",
-          "snapshots",
-          "versions",
-          "uncommittedblobs",
-          "tags",
-      };
-      std::string ret;
-      for (size_t i = 0; i < sizeof(value_list) / sizeof(ListBlobsIncludeFlags); ++i)
-      {
-        if ((val & value_list[i]) == value_list[i])
-        {
-          if (!ret.empty())
-          {
-            ret += ",";
-          }
-          ret += string_list[i];
-        }
-      }
-      return ret;
-    }
+    std::string ListBlobsIncludeFlagsToString(const ListBlobsIncludeFlags& val);
 
     class BlobRestClient final {
     public:
@@ -2885,58 +3064,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const ListBlobContainersOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "list");
-          if (options.Prefix.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "prefix", _internal::UrlEncodeQueryParameter(options.Prefix.Value()));
-          }
-          if (options.ContinuationToken.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "marker", _internal::UrlEncodeQueryParameter(options.ContinuationToken.Value()));
-          }
-          if (options.MaxResults.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "maxresults", std::to_string(options.MaxResults.Value()));
-          }
-          std::string list_blob_containers_include_flags
-              = ListBlobContainersIncludeFlagsToString(options.Include);
-          if (!list_blob_containers_include_flags.empty())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "include", _internal::UrlEncodeQueryParameter(list_blob_containers_include_flags));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::ListBlobContainersResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& httpResponseBody = httpResponse.GetBody();
-            _internal::XmlReader reader(
-                reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = ListBlobContainersResultInternalFromXml(reader);
-          }
-          return Azure::Response<Models::_detail::ListBlobContainersResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct GetUserDelegationKeyOptions final
         {
@@ -2949,47 +3077,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const GetUserDelegationKeyOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          std::string xml_body;
-          {
-            _internal::XmlWriter writer;
-            GetUserDelegationKeyOptionsToXml(writer, options);
-            xml_body = writer.GetDocument();
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
-          }
-          Azure::Core::IO::MemoryBodyStream xml_body_stream(
-              reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
-          auto request = Azure::Core::Http::Request(
-              Azure::Core::Http::HttpMethod::Post, url, &xml_body_stream);
-          request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
-          request.GetUrl().AppendQueryParameter("restype", "service");
-          request.GetUrl().AppendQueryParameter("comp", "userdelegationkey");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          UserDelegationKey response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& httpResponseBody = httpResponse.GetBody();
-            _internal::XmlReader reader(
-                reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = UserDelegationKeyFromXml(reader);
-          }
-          return Azure::Response<UserDelegationKey>(std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct GetServicePropertiesOptions final
         {
@@ -3000,37 +3088,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const GetServicePropertiesOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter("restype", "service");
-          request.GetUrl().AppendQueryParameter("comp", "properties");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          BlobServiceProperties response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& httpResponseBody = httpResponse.GetBody();
-            _internal::XmlReader reader(
-                reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = BlobServicePropertiesFromXml(reader);
-          }
-          return Azure::Response<BlobServiceProperties>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct SetServicePropertiesOptions final
         {
@@ -3042,42 +3100,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const SetServicePropertiesOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          std::string xml_body;
-          {
-            _internal::XmlWriter writer;
-            SetServicePropertiesOptionsToXml(writer, options);
-            xml_body = writer.GetDocument();
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
-          }
-          Azure::Core::IO::MemoryBodyStream xml_body_stream(
-              reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
-          auto request = Azure::Core::Http::Request(
-              Azure::Core::Http::HttpMethod::Put, url, &xml_body_stream);
-          request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
-          request.GetUrl().AppendQueryParameter("restype", "service");
-          request.GetUrl().AppendQueryParameter("comp", "properties");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          SetServicePropertiesResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 202))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          return Azure::Response<SetServicePropertiesResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct GetAccountInfoOptions final
         {
@@ -3088,34 +3111,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const GetAccountInfoOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Head, url);
-          request.GetUrl().AppendQueryParameter("restype", "account");
-          request.GetUrl().AppendQueryParameter("comp", "properties");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          AccountInfo response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.SkuName = SkuName(httpResponse.GetHeaders().at("x-ms-sku-name"));
-          response.AccountKind = AccountKind(httpResponse.GetHeaders().at("x-ms-account-kind"));
-          response.IsHierarchicalNamespaceEnabled
-              = httpResponse.GetHeaders().at("x-ms-is-hns-enabled") == "true";
-          return Azure::Response<AccountInfo>(std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct GetServiceStatisticsOptions final
         {
@@ -3126,36 +3122,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const GetServiceStatisticsOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter("restype", "service");
-          request.GetUrl().AppendQueryParameter("comp", "stats");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          ServiceStatistics response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& httpResponseBody = httpResponse.GetBody();
-            _internal::XmlReader reader(
-                reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = ServiceStatisticsFromXml(reader);
-          }
-          return Azure::Response<ServiceStatistics>(std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct FindBlobsByTagsOptions final
         {
@@ -3169,3413 +3136,454 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const FindBlobsByTagsOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "blobs");
-          request.GetUrl().AppendQueryParameter(
-              "where", _internal::UrlEncodeQueryParameter(options.Where));
-          if (options.ContinuationToken.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "marker", _internal::UrlEncodeQueryParameter(options.ContinuationToken.Value()));
-          }
-          if (options.MaxResults.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "maxresults", std::to_string(options.MaxResults.Value()));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::FindBlobsByTagsResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& httpResponseBody = httpResponse.GetBody();
-            _internal::XmlReader reader(
-                reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = FindBlobsByTagsResultInternalFromXml(reader);
-          }
-          return Azure::Response<Models::_detail::FindBlobsByTagsResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
       private:
-        static BlobServiceProperties BlobServicePropertiesFromXml(_internal::XmlReader& reader)
+        static BlobServiceProperties BlobServicePropertiesFromXml(_internal::XmlReader& reader);
+
+        static Models::_detail::FindBlobsByTagsResult FindBlobsByTagsResultInternalFromXml(
+            _internal::XmlReader& reader);
+
+        static Models::_detail::ListBlobContainersResult ListBlobContainersResultInternalFromXml(
+            _internal::XmlReader& reader);
+
+        static ServiceStatistics ServiceStatisticsFromXml(_internal::XmlReader& reader);
+
+        static UserDelegationKey UserDelegationKeyFromXml(_internal::XmlReader& reader);
+
+        static AnalyticsLogging AnalyticsLoggingFromXml(_internal::XmlReader& reader);
+
+        static BlobContainerItem BlobContainerItemFromXml(_internal::XmlReader& reader);
+
+        static CorsRule CorsRuleFromXml(_internal::XmlReader& reader);
+
+        static GeoReplication GeoReplicationFromXml(_internal::XmlReader& reader);
+
+        static Metrics MetricsFromXml(_internal::XmlReader& reader);
+
+        static RetentionPolicy RetentionPolicyFromXml(_internal::XmlReader& reader);
+
+        static StaticWebsite StaticWebsiteFromXml(_internal::XmlReader& reader);
+
+        static TaggedBlobItem TaggedBlobItemFromXml(_internal::XmlReader& reader);
+
+        static Metadata MetadataFromXml(_internal::XmlReader& reader);
+
+        static void GetUserDelegationKeyOptionsToXml(
+            _internal::XmlWriter& writer,
+            const GetUserDelegationKeyOptions& options);
+
+        static void SetServicePropertiesOptionsToXml(
+            _internal::XmlWriter& writer,
+            const SetServicePropertiesOptions& options);
+
+        static void BlobServicePropertiesToXml(
+            _internal::XmlWriter& writer,
+            const BlobServiceProperties& options);
+
+        static void AnalyticsLoggingToXml(
+            _internal::XmlWriter& writer,
+            const AnalyticsLogging& options);
+
+        static void CorsRuleToXml(_internal::XmlWriter& writer, const CorsRule& options);
+
+        static void MetricsToXml(_internal::XmlWriter& writer, const Metrics& options);
+
+        static void RetentionPolicyToXml(
+            _internal::XmlWriter& writer,
+            const RetentionPolicy& options);
+
+        static void StaticWebsiteToXml(_internal::XmlWriter& writer, const StaticWebsite& options);
+
+      }; // class Service
+
+      class BlobContainer final {
+      public:
+        struct CreateBlobContainerOptions final
         {
-          BlobServiceProperties ret;
-          enum class XmlTagName
-          {
-            k_StorageServiceProperties,
-            k_Logging,
-            k_HourMetrics,
-            k_MinuteMetrics,
-            k_Cors,
-            k_CorsRule,
-            k_DefaultServiceVersion,
-            k_DeleteRetentionPolicy,
-            k_StaticWebsite,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "StorageServiceProperties")
-              {
-                path.emplace_back(XmlTagName::k_StorageServiceProperties);
-              }
-              else if (node.Name == "Logging")
-              {
-                path.emplace_back(XmlTagName::k_Logging);
-              }
-              else if (node.Name == "HourMetrics")
-              {
-                path.emplace_back(XmlTagName::k_HourMetrics);
-              }
-              else if (node.Name == "MinuteMetrics")
-              {
-                path.emplace_back(XmlTagName::k_MinuteMetrics);
-              }
-              else if (node.Name == "Cors")
-              {
-                path.emplace_back(XmlTagName::k_Cors);
-              }
-              else if (node.Name == "CorsRule")
-              {
-                path.emplace_back(XmlTagName::k_CorsRule);
-              }
-              else if (node.Name == "DefaultServiceVersion")
-              {
-                path.emplace_back(XmlTagName::k_DefaultServiceVersion);
-              }
-              else if (node.Name == "DeleteRetentionPolicy")
-              {
-                path.emplace_back(XmlTagName::k_DeleteRetentionPolicy);
-              }
-              else if (node.Name == "StaticWebsite")
-              {
-                path.emplace_back(XmlTagName::k_StaticWebsite);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
-                  && path[1] == XmlTagName::k_Logging)
-              {
-                ret.Logging = AnalyticsLoggingFromXml(reader);
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
-                  && path[1] == XmlTagName::k_HourMetrics)
-              {
-                ret.HourMetrics = MetricsFromXml(reader);
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
-                  && path[1] == XmlTagName::k_MinuteMetrics)
-              {
-                ret.MinuteMetrics = MetricsFromXml(reader);
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 3 && path[0] == XmlTagName::k_StorageServiceProperties
-                  && path[1] == XmlTagName::k_Cors && path[2] == XmlTagName::k_CorsRule)
-              {
-                ret.Cors.emplace_back(CorsRuleFromXml(reader));
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
-                  && path[1] == XmlTagName::k_DeleteRetentionPolicy)
-              {
-                ret.DeleteRetentionPolicy = RetentionPolicyFromXml(reader);
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
-                  && path[1] == XmlTagName::k_StaticWebsite)
-              {
-                ret.StaticWebsite = StaticWebsiteFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
-                  && path[1] == XmlTagName::k_DefaultServiceVersion)
-              {
-                ret.DefaultServiceVersion = node.Value;
-              }
-            }
-          }
-          return ret;
-        }
+          Azure::Nullable<int32_t> Timeout;
+          PublicAccessType AccessType = PublicAccessType::None;
+          Storage::Metadata Metadata;
+          Azure::Nullable<std::string> DefaultEncryptionScope;
+          Azure::Nullable<bool> PreventEncryptionScopeOverride;
+        }; // struct CreateBlobContainerOptions
 
-        static Models::_detail::FindBlobsByTagsResult FindBlobsByTagsResultInternalFromXml(
-            _internal::XmlReader& reader)
+        static Azure::Response<CreateBlobContainerResult> Create(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const CreateBlobContainerOptions& options,
+            const Azure::Core::Context& context);
+
+        struct DeleteBlobContainerOptions final
         {
-          Models::_detail::FindBlobsByTagsResult ret;
-          enum class XmlTagName
-          {
-            k_EnumerationResults,
-            k_NextMarker,
-            k_Blobs,
-            k_Blob,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "EnumerationResults")
-              {
-                path.emplace_back(XmlTagName::k_EnumerationResults);
-              }
-              else if (node.Name == "NextMarker")
-              {
-                path.emplace_back(XmlTagName::k_NextMarker);
-              }
-              else if (node.Name == "Blobs")
-              {
-                path.emplace_back(XmlTagName::k_Blobs);
-              }
-              else if (node.Name == "Blob")
-              {
-                path.emplace_back(XmlTagName::k_Blob);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
-              {
-                ret.Items.emplace_back(TaggedBlobItemFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_NextMarker)
-              {
-                ret.ContinuationToken = node.Value;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Attribute)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
-                  && node.Name == "ServiceEndpoint")
-              {
-                ret.ServiceEndpoint = node.Value;
-              }
-            }
-          }
-          return ret;
-        }
+          Azure::Nullable<int32_t> Timeout;
+          Azure::Nullable<std::string> LeaseId;
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
+        }; // struct DeleteBlobContainerOptions
 
-        static Models::_detail::ListBlobContainersResult ListBlobContainersResultInternalFromXml(
-            _internal::XmlReader& reader)
+        static Azure::Response<DeleteBlobContainerResult> Delete(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const DeleteBlobContainerOptions& options,
+            const Azure::Core::Context& context);
+
+        struct UndeleteBlobContainerOptions final
         {
-          Models::_detail::ListBlobContainersResult ret;
-          enum class XmlTagName
-          {
-            k_EnumerationResults,
-            k_Prefix,
-            k_NextMarker,
-            k_Containers,
-            k_Container,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "EnumerationResults")
-              {
-                path.emplace_back(XmlTagName::k_EnumerationResults);
-              }
-              else if (node.Name == "Prefix")
-              {
-                path.emplace_back(XmlTagName::k_Prefix);
-              }
-              else if (node.Name == "NextMarker")
-              {
-                path.emplace_back(XmlTagName::k_NextMarker);
-              }
-              else if (node.Name == "Containers")
-              {
-                path.emplace_back(XmlTagName::k_Containers);
-              }
-              else if (node.Name == "Container")
-              {
-                path.emplace_back(XmlTagName::k_Container);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_Containers && path[2] == XmlTagName::k_Container)
-              {
-                ret.Items.emplace_back(BlobContainerItemFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_Prefix)
-              {
-                ret.Prefix = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_NextMarker)
-              {
-                ret.ContinuationToken = node.Value;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Attribute)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
-                  && node.Name == "ServiceEndpoint")
-              {
-                ret.ServiceEndpoint = node.Value;
-              }
-            }
-          }
-          return ret;
-        }
+          Azure::Nullable<int32_t> Timeout;
+          std::string DeletedBlobContainerName;
+          std::string DeletedBlobContainerVersion;
+        }; // struct UndeleteBlobContainerOptions
+
+        static Azure::Response<Models::_detail::UndeleteBlobContainerResult> Undelete(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const UndeleteBlobContainerOptions& options,
+            const Azure::Core::Context& context);
 
-        static ServiceStatistics ServiceStatisticsFromXml(_internal::XmlReader& reader)
+        struct GetBlobContainerPropertiesOptions final
         {
-          ServiceStatistics ret;
-          enum class XmlTagName
-          {
-            k_StorageServiceStats,
-            k_GeoReplication,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "StorageServiceStats")
-              {
-                path.emplace_back(XmlTagName::k_StorageServiceStats);
-              }
-              else if (node.Name == "GeoReplication")
-              {
-                path.emplace_back(XmlTagName::k_GeoReplication);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 2 && path[0] == XmlTagName::k_StorageServiceStats
-                  && path[1] == XmlTagName::k_GeoReplication)
-              {
-                ret.GeoReplication = GeoReplicationFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-            }
-          }
-          return ret;
-        }
+          Azure::Nullable<int32_t> Timeout;
+          Azure::Nullable<std::string> LeaseId;
+        }; // struct GetBlobContainerPropertiesOptions
+
+        static Azure::Response<BlobContainerProperties> GetProperties(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const GetBlobContainerPropertiesOptions& options,
+            const Azure::Core::Context& context);
 
-        static UserDelegationKey UserDelegationKeyFromXml(_internal::XmlReader& reader)
+        struct SetBlobContainerMetadataOptions final
         {
-          UserDelegationKey ret;
-          enum class XmlTagName
-          {
-            k_UserDelegationKey,
-            k_SignedOid,
-            k_SignedTid,
-            k_SignedStart,
-            k_SignedExpiry,
-            k_SignedService,
-            k_SignedVersion,
-            k_Value,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "UserDelegationKey")
-              {
-                path.emplace_back(XmlTagName::k_UserDelegationKey);
-              }
-              else if (node.Name == "SignedOid")
-              {
-                path.emplace_back(XmlTagName::k_SignedOid);
-              }
-              else if (node.Name == "SignedTid")
-              {
-                path.emplace_back(XmlTagName::k_SignedTid);
-              }
-              else if (node.Name == "SignedStart")
-              {
-                path.emplace_back(XmlTagName::k_SignedStart);
-              }
-              else if (node.Name == "SignedExpiry")
-              {
-                path.emplace_back(XmlTagName::k_SignedExpiry);
-              }
-              else if (node.Name == "SignedService")
-              {
-                path.emplace_back(XmlTagName::k_SignedService);
-              }
-              else if (node.Name == "SignedVersion")
-              {
-                path.emplace_back(XmlTagName::k_SignedVersion);
-              }
-              else if (node.Name == "Value")
-              {
-                path.emplace_back(XmlTagName::k_Value);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
-                  && path[1] == XmlTagName::k_SignedOid)
-              {
-                ret.SignedObjectId = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
-                  && path[1] == XmlTagName::k_SignedTid)
-              {
-                ret.SignedTenantId = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
-                  && path[1] == XmlTagName::k_SignedStart)
-              {
-                ret.SignedStartsOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
-                  && path[1] == XmlTagName::k_SignedExpiry)
-              {
-                ret.SignedExpiresOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
-                  && path[1] == XmlTagName::k_SignedService)
-              {
-                ret.SignedService = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
-                  && path[1] == XmlTagName::k_SignedVersion)
-              {
-                ret.SignedVersion = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
-                  && path[1] == XmlTagName::k_Value)
-              {
-                ret.Value = node.Value;
-              }
-            }
-          }
-          return ret;
-        }
-
-        static AnalyticsLogging AnalyticsLoggingFromXml(_internal::XmlReader& reader)
-        {
-          AnalyticsLogging ret;
-          enum class XmlTagName
-          {
-            k_Version,
-            k_Delete,
-            k_Read,
-            k_Write,
-            k_RetentionPolicy,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "Version")
-              {
-                path.emplace_back(XmlTagName::k_Version);
-              }
-              else if (node.Name == "Delete")
-              {
-                path.emplace_back(XmlTagName::k_Delete);
-              }
-              else if (node.Name == "Read")
-              {
-                path.emplace_back(XmlTagName::k_Read);
-              }
-              else if (node.Name == "Write")
-              {
-                path.emplace_back(XmlTagName::k_Write);
-              }
-              else if (node.Name == "RetentionPolicy")
-              {
-                path.emplace_back(XmlTagName::k_RetentionPolicy);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 1 && path[0] == XmlTagName::k_RetentionPolicy)
-              {
-                ret.RetentionPolicy = RetentionPolicyFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_Version)
-              {
-                ret.Version = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_Delete)
-              {
-                ret.Delete = node.Value == "true";
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_Read)
-              {
-                ret.Read = node.Value == "true";
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_Write)
-              {
-                ret.Write = node.Value == "true";
-              }
-            }
-          }
-          return ret;
-        }
+          Azure::Nullable<int32_t> Timeout;
+          Storage::Metadata Metadata;
+          Azure::Nullable<std::string> LeaseId;
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+        }; // struct SetBlobContainerMetadataOptions
 
-        static BlobContainerItem BlobContainerItemFromXml(_internal::XmlReader& reader)
-        {
-          BlobContainerItem ret;
-          enum class XmlTagName
-          {
-            k_Name,
-            k_Properties,
-            k_Etag,
-            k_LastModified,
-            k_PublicAccess,
-            k_HasImmutabilityPolicy,
-            k_HasLegalHold,
-            k_LeaseStatus,
-            k_LeaseState,
-            k_LeaseDuration,
-            k_DefaultEncryptionScope,
-            k_DenyEncryptionScopeOverride,
-            k_Metadata,
-            k_Deleted,
-            k_Version,
-            k_DeletedTime,
-            k_RemainingRetentionDays,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "Name")
-              {
-                path.emplace_back(XmlTagName::k_Name);
-              }
-              else if (node.Name == "Properties")
-              {
-                path.emplace_back(XmlTagName::k_Properties);
-              }
-              else if (node.Name == "Etag")
-              {
-                path.emplace_back(XmlTagName::k_Etag);
-              }
-              else if (node.Name == "Last-Modified")
-              {
-                path.emplace_back(XmlTagName::k_LastModified);
-              }
-              else if (node.Name == "PublicAccess")
-              {
-                path.emplace_back(XmlTagName::k_PublicAccess);
-              }
-              else if (node.Name == "HasImmutabilityPolicy")
-              {
-                path.emplace_back(XmlTagName::k_HasImmutabilityPolicy);
-              }
-              else if (node.Name == "HasLegalHold")
-              {
-                path.emplace_back(XmlTagName::k_HasLegalHold);
-              }
-              else if (node.Name == "LeaseStatus")
-              {
-                path.emplace_back(XmlTagName::k_LeaseStatus);
-              }
-              else if (node.Name == "LeaseState")
-              {
-                path.emplace_back(XmlTagName::k_LeaseState);
-              }
-              else if (node.Name == "LeaseDuration")
-              {
-                path.emplace_back(XmlTagName::k_LeaseDuration);
-              }
-              else if (node.Name == "DefaultEncryptionScope")
-              {
-                path.emplace_back(XmlTagName::k_DefaultEncryptionScope);
-              }
-              else if (node.Name == "DenyEncryptionScopeOverride")
-              {
-                path.emplace_back(XmlTagName::k_DenyEncryptionScopeOverride);
-              }
-              else if (node.Name == "Metadata")
-              {
-                path.emplace_back(XmlTagName::k_Metadata);
-              }
-              else if (node.Name == "Deleted")
-              {
-                path.emplace_back(XmlTagName::k_Deleted);
-              }
-              else if (node.Name == "Version")
-              {
-                path.emplace_back(XmlTagName::k_Version);
-              }
-              else if (node.Name == "DeletedTime")
-              {
-                path.emplace_back(XmlTagName::k_DeletedTime);
-              }
-              else if (node.Name == "RemainingRetentionDays")
-              {
-                path.emplace_back(XmlTagName::k_RemainingRetentionDays);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 1 && path[0] == XmlTagName::k_Metadata)
-              {
-                ret.Details.Metadata = MetadataFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_Name)
-              {
-                ret.Name = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_Etag)
-              {
-                ret.Details.ETag = Azure::ETag(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_LastModified)
-              {
-                ret.Details.LastModified
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_PublicAccess)
-              {
-                ret.Details.AccessType = PublicAccessType(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_HasImmutabilityPolicy)
-              {
-                ret.Details.HasImmutabilityPolicy = node.Value == "true";
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_HasLegalHold)
-              {
-                ret.Details.HasLegalHold = node.Value == "true";
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_LeaseStatus)
-              {
-                ret.Details.LeaseStatus = LeaseStatus(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_LeaseState)
-              {
-                ret.Details.LeaseState = LeaseState(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_LeaseDuration)
-              {
-                ret.Details.LeaseDuration = LeaseDurationType(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_DefaultEncryptionScope)
-              {
-                ret.Details.DefaultEncryptionScope = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_DenyEncryptionScopeOverride)
-              {
-                ret.Details.PreventEncryptionScopeOverride = node.Value == "true";
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_Deleted)
-              {
-                ret.IsDeleted = node.Value == "true";
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_Version)
-              {
-                ret.VersionId = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_DeletedTime)
-              {
-                ret.Details.DeletedOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_RemainingRetentionDays)
-              {
-                ret.Details.RemainingRetentionDays = std::stoi(node.Value);
-              }
-            }
-          }
-          return ret;
-        }
+        static Azure::Response<SetBlobContainerMetadataResult> SetMetadata(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const SetBlobContainerMetadataOptions& options,
+            const Azure::Core::Context& context);
 
-        static CorsRule CorsRuleFromXml(_internal::XmlReader& reader)
+        struct ListBlobsOptions final
         {
-          CorsRule ret;
-          enum class XmlTagName
-          {
-            k_AllowedOrigins,
-            k_AllowedMethods,
-            k_MaxAgeInSeconds,
-            k_ExposedHeaders,
-            k_AllowedHeaders,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "AllowedOrigins")
-              {
-                path.emplace_back(XmlTagName::k_AllowedOrigins);
-              }
-              else if (node.Name == "AllowedMethods")
-              {
-                path.emplace_back(XmlTagName::k_AllowedMethods);
-              }
-              else if (node.Name == "MaxAgeInSeconds")
-              {
-                path.emplace_back(XmlTagName::k_MaxAgeInSeconds);
-              }
-              else if (node.Name == "ExposedHeaders")
-              {
-                path.emplace_back(XmlTagName::k_ExposedHeaders);
-              }
-              else if (node.Name == "AllowedHeaders")
-              {
-                path.emplace_back(XmlTagName::k_AllowedHeaders);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_AllowedOrigins)
-              {
-                ret.AllowedOrigins = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_AllowedMethods)
-              {
-                ret.AllowedMethods = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_MaxAgeInSeconds)
-              {
-                ret.MaxAgeInSeconds = std::stoi(node.Value);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_ExposedHeaders)
-              {
-                ret.ExposedHeaders = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_AllowedHeaders)
-              {
-                ret.AllowedHeaders = node.Value;
-              }
-            }
-          }
-          return ret;
-        }
+          Azure::Nullable<int32_t> Timeout;
+          Azure::Nullable<std::string> Prefix;
+          Azure::Nullable<std::string> ContinuationToken;
+          Azure::Nullable<int32_t> MaxResults;
+          ListBlobsIncludeFlags Include = ListBlobsIncludeFlags::None;
+        }; // struct ListBlobsOptions
 
-        static GeoReplication GeoReplicationFromXml(_internal::XmlReader& reader)
-        {
-          GeoReplication ret;
-          enum class XmlTagName
-          {
-            k_Status,
-            k_LastSyncTime,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "Status")
-              {
-                path.emplace_back(XmlTagName::k_Status);
-              }
-              else if (node.Name == "LastSyncTime")
-              {
-                path.emplace_back(XmlTagName::k_LastSyncTime);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_Status)
-              {
-                ret.Status = GeoReplicationStatus(node.Value);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_LastSyncTime)
-              {
-                ret.LastSyncedOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
-              }
-            }
-          }
-          return ret;
-        }
+        static Azure::Response<Models::_detail::ListBlobsResult> ListBlobs(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const ListBlobsOptions& options,
+            const Azure::Core::Context& context);
 
-        static Metrics MetricsFromXml(_internal::XmlReader& reader)
-        {
-          Metrics ret;
-          enum class XmlTagName
-          {
-            k_Version,
-            k_Enabled,
-            k_IncludeAPIs,
-            k_RetentionPolicy,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "Version")
-              {
-                path.emplace_back(XmlTagName::k_Version);
-              }
-              else if (node.Name == "Enabled")
-              {
-                path.emplace_back(XmlTagName::k_Enabled);
-              }
-              else if (node.Name == "IncludeAPIs")
-              {
-                path.emplace_back(XmlTagName::k_IncludeAPIs);
-              }
-              else if (node.Name == "RetentionPolicy")
-              {
-                path.emplace_back(XmlTagName::k_RetentionPolicy);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 1 && path[0] == XmlTagName::k_RetentionPolicy)
-              {
-                ret.RetentionPolicy = RetentionPolicyFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_Version)
-              {
-                ret.Version = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_Enabled)
-              {
-                ret.IsEnabled = node.Value == "true";
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_IncludeAPIs)
-              {
-                ret.IncludeApis = node.Value == "true";
-              }
-            }
-          }
-          return ret;
-        }
-
-        static RetentionPolicy RetentionPolicyFromXml(_internal::XmlReader& reader)
-        {
-          RetentionPolicy ret;
-          enum class XmlTagName
-          {
-            k_Enabled,
-            k_Days,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "Enabled")
-              {
-                path.emplace_back(XmlTagName::k_Enabled);
-              }
-              else if (node.Name == "Days")
-              {
-                path.emplace_back(XmlTagName::k_Days);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_Enabled)
-              {
-                ret.IsEnabled = node.Value == "true";
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_Days)
-              {
-                ret.Days = std::stoi(node.Value);
-              }
-            }
-          }
-          return ret;
-        }
-
-        static StaticWebsite StaticWebsiteFromXml(_internal::XmlReader& reader)
-        {
-          StaticWebsite ret;
-          enum class XmlTagName
-          {
-            k_Enabled,
-            k_IndexDocument,
-            k_DefaultIndexDocumentPath,
-            k_ErrorDocument404Path,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "Enabled")
-              {
-                path.emplace_back(XmlTagName::k_Enabled);
-              }
-              else if (node.Name == "IndexDocument")
-              {
-                path.emplace_back(XmlTagName::k_IndexDocument);
-              }
-              else if (node.Name == "DefaultIndexDocumentPath")
-              {
-                path.emplace_back(XmlTagName::k_DefaultIndexDocumentPath);
-              }
-              else if (node.Name == "ErrorDocument404Path")
-              {
-                path.emplace_back(XmlTagName::k_ErrorDocument404Path);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_Enabled)
-              {
-                ret.IsEnabled = node.Value == "true";
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_IndexDocument)
-              {
-                ret.IndexDocument = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_DefaultIndexDocumentPath)
-              {
-                ret.DefaultIndexDocumentPath = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_ErrorDocument404Path)
-              {
-                ret.ErrorDocument404Path = node.Value;
-              }
-            }
-          }
-          return ret;
-        }
-
-        static TaggedBlobItem TaggedBlobItemFromXml(_internal::XmlReader& reader)
-        {
-          TaggedBlobItem ret;
-          enum class XmlTagName
-          {
-            k_Name,
-            k_ContainerName,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "Name")
-              {
-                path.emplace_back(XmlTagName::k_Name);
-              }
-              else if (node.Name == "ContainerName")
-              {
-                path.emplace_back(XmlTagName::k_ContainerName);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_Name)
-              {
-                ret.BlobName = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_ContainerName)
-              {
-                ret.BlobContainerName = node.Value;
-              }
-            }
-          }
-          return ret;
-        }
-
-        static Metadata MetadataFromXml(_internal::XmlReader& reader)
-        {
-          Metadata ret;
-          int depth = 0;
-          std::string key;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (depth++ == 0)
-              {
-                key = node.Name;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (depth-- == 0)
-              {
-                break;
-              }
-            }
-            else if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
-            {
-              ret.emplace(std::move(key), node.Value);
-            }
-          }
-          return ret;
-        }
-
-        static void GetUserDelegationKeyOptionsToXml(
-            _internal::XmlWriter& writer,
-            const GetUserDelegationKeyOptions& options)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "KeyInfo"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Start"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text,
-              std::string(),
-              options.StartsOn.ToString(
-                  Azure::DateTime::DateFormat::Rfc3339,
-                  Azure::DateTime::TimeFractionFormat::Truncate)});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Expiry"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text,
-              std::string(),
-              options.ExpiresOn.ToString(
-                  Azure::DateTime::DateFormat::Rfc3339,
-                  Azure::DateTime::TimeFractionFormat::Truncate)});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
-
-        static void SetServicePropertiesOptionsToXml(
-            _internal::XmlWriter& writer,
-            const SetServicePropertiesOptions& options)
-        {
-          writer.Write(
-              _internal::XmlNode{_internal::XmlNodeType::StartTag, "StorageServiceProperties"});
-          BlobServicePropertiesToXml(writer, options.Properties);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
-
-        static void BlobServicePropertiesToXml(
-            _internal::XmlWriter& writer,
-            const BlobServiceProperties& options)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Logging"});
-          AnalyticsLoggingToXml(writer, options.Logging);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "HourMetrics"});
-          MetricsToXml(writer, options.HourMetrics);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "MinuteMetrics"});
-          MetricsToXml(writer, options.MinuteMetrics);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Cors"});
-          for (const auto& i : options.Cors)
-          {
-            CorsRuleToXml(writer, i);
-          }
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          if (options.DefaultServiceVersion.HasValue())
-          {
-            writer.Write(
-                _internal::XmlNode{_internal::XmlNodeType::StartTag, "DefaultServiceVersion"});
-            writer.Write(_internal::XmlNode{
-                _internal::XmlNodeType::Text,
-                std::string(),
-                options.DefaultServiceVersion.Value()});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          }
-          writer.Write(
-              _internal::XmlNode{_internal::XmlNodeType::StartTag, "DeleteRetentionPolicy"});
-          RetentionPolicyToXml(writer, options.DeleteRetentionPolicy);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "StaticWebsite"});
-          StaticWebsiteToXml(writer, options.StaticWebsite);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
-
-        static void AnalyticsLoggingToXml(
-            _internal::XmlWriter& writer,
-            const AnalyticsLogging& options)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Version"});
-          writer.Write(
-              _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Version});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Delete"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), options.Delete ? "true" : "false"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Read"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), options.Read ? "true" : "false"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Write"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), options.Write ? "true" : "false"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "RetentionPolicy"});
-          RetentionPolicyToXml(writer, options.RetentionPolicy);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
-
-        static void CorsRuleToXml(_internal::XmlWriter& writer, const CorsRule& options)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "CorsRule"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AllowedOrigins"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), options.AllowedOrigins});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AllowedMethods"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), options.AllowedMethods});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AllowedHeaders"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), options.AllowedHeaders});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "ExposedHeaders"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), options.ExposedHeaders});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "MaxAgeInSeconds"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text,
-              std::string(),
-              std::to_string(options.MaxAgeInSeconds)});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
-
-        static void MetricsToXml(_internal::XmlWriter& writer, const Metrics& options)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Version"});
-          writer.Write(
-              _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Version});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Enabled"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), options.IsEnabled ? "true" : "false"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          if (options.IncludeApis.HasValue())
-          {
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "IncludeAPIs"});
-            writer.Write(_internal::XmlNode{
-                _internal::XmlNodeType::Text,
-                std::string(),
-                options.IncludeApis.Value() ? "true" : "false"});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          }
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "RetentionPolicy"});
-          RetentionPolicyToXml(writer, options.RetentionPolicy);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
-
-        static void RetentionPolicyToXml(
-            _internal::XmlWriter& writer,
-            const RetentionPolicy& options)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Enabled"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), options.IsEnabled ? "true" : "false"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          if (options.Days.HasValue())
-          {
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Days"});
-            writer.Write(_internal::XmlNode{
-                _internal::XmlNodeType::Text, std::string(), std::to_string(options.Days.Value())});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          }
-        }
-
-        static void StaticWebsiteToXml(_internal::XmlWriter& writer, const StaticWebsite& options)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Enabled"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), options.IsEnabled ? "true" : "false"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          if (options.IndexDocument.HasValue())
-          {
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "IndexDocument"});
-            writer.Write(_internal::XmlNode{
-                _internal::XmlNodeType::Text, std::string(), options.IndexDocument.Value()});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          }
-          if (options.DefaultIndexDocumentPath.HasValue())
-          {
-            writer.Write(
-                _internal::XmlNode{_internal::XmlNodeType::StartTag, "DefaultIndexDocumentPath"});
-            writer.Write(_internal::XmlNode{
-                _internal::XmlNodeType::Text,
-                std::string(),
-                options.DefaultIndexDocumentPath.Value()});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          }
-          if (options.ErrorDocument404Path.HasValue())
-          {
-            writer.Write(
-                _internal::XmlNode{_internal::XmlNodeType::StartTag, "ErrorDocument404Path"});
-            writer.Write(_internal::XmlNode{
-                _internal::XmlNodeType::Text, std::string(), options.ErrorDocument404Path.Value()});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          }
-        }
-
-      }; // class Service
-
-      class BlobContainer final {
-      public:
-        struct CreateBlobContainerOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          PublicAccessType AccessType = PublicAccessType::None;
-          Storage::Metadata Metadata;
-          Azure::Nullable<std::string> DefaultEncryptionScope;
-          Azure::Nullable<bool> PreventEncryptionScopeOverride;
-        }; // struct CreateBlobContainerOptions
-
-        static Azure::Response<CreateBlobContainerResult> Create(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const CreateBlobContainerOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          for (const auto& pair : options.Metadata)
-          {
-            request.SetHeader("x-ms-meta-" + pair.first, pair.second);
-          }
-          if (!options.AccessType.ToString().empty())
-          {
-            request.SetHeader("x-ms-blob-public-access", options.AccessType.ToString());
-          }
-          if (options.DefaultEncryptionScope.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-default-encryption-scope", options.DefaultEncryptionScope.Value());
-          }
-          if (options.PreventEncryptionScopeOverride.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-deny-encryption-scope-override",
-                options.PreventEncryptionScopeOverride.Value() ? "true" : "false");
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          CreateBlobContainerResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          return Azure::Response<CreateBlobContainerResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct DeleteBlobContainerOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          Azure::Nullable<std::string> LeaseId;
-          Azure::Nullable<Azure::DateTime> IfModifiedSince;
-          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
-        }; // struct DeleteBlobContainerOptions
-
-        static Azure::Response<DeleteBlobContainerResult> Delete(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const DeleteBlobContainerOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Delete, url);
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          DeleteBlobContainerResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 202))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          return Azure::Response<DeleteBlobContainerResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct UndeleteBlobContainerOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          std::string DeletedBlobContainerName;
-          std::string DeletedBlobContainerVersion;
-        }; // struct UndeleteBlobContainerOptions
-
-        static Azure::Response<Models::_detail::UndeleteBlobContainerResult> Undelete(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const UndeleteBlobContainerOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.GetUrl().AppendQueryParameter("comp", "undelete");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.SetHeader("x-ms-deleted-container-name", options.DeletedBlobContainerName);
-          request.SetHeader("x-ms-deleted-container-version", options.DeletedBlobContainerVersion);
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::UndeleteBlobContainerResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          return Azure::Response<Models::_detail::UndeleteBlobContainerResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct GetBlobContainerPropertiesOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          Azure::Nullable<std::string> LeaseId;
-        }; // struct GetBlobContainerPropertiesOptions
-
-        static Azure::Response<BlobContainerProperties> GetProperties(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const GetBlobContainerPropertiesOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Head, url);
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          BlobContainerProperties response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-meta-");
-               i != httpResponse.GetHeaders().end() && i->first.substr(0, 10) == "x-ms-meta-";
-               ++i)
-          {
-            response.Metadata.emplace(i->first.substr(10), i->second);
-          }
-          auto x_ms_blob_public_access__iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-public-access");
-          if (x_ms_blob_public_access__iterator != httpResponse.GetHeaders().end())
-          {
-            response.AccessType = PublicAccessType(x_ms_blob_public_access__iterator->second);
-          }
-          response.HasImmutabilityPolicy
-              = httpResponse.GetHeaders().at("x-ms-has-immutability-policy") == "true";
-          response.HasLegalHold = httpResponse.GetHeaders().at("x-ms-has-legal-hold") == "true";
-          response.LeaseStatus = LeaseStatus(httpResponse.GetHeaders().at("x-ms-lease-status"));
-          response.LeaseState = LeaseState(httpResponse.GetHeaders().at("x-ms-lease-state"));
-          auto x_ms_lease_duration__iterator
-              = httpResponse.GetHeaders().find("x-ms-lease-duration");
-          if (x_ms_lease_duration__iterator != httpResponse.GetHeaders().end())
-          {
-            response.LeaseDuration = LeaseDurationType(x_ms_lease_duration__iterator->second);
-          }
-          response.DefaultEncryptionScope
-              = httpResponse.GetHeaders().at("x-ms-default-encryption-scope");
-          response.PreventEncryptionScopeOverride
-              = httpResponse.GetHeaders().at("x-ms-deny-encryption-scope-override") == "true";
-          return Azure::Response<BlobContainerProperties>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct SetBlobContainerMetadataOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          Storage::Metadata Metadata;
-          Azure::Nullable<std::string> LeaseId;
-          Azure::Nullable<Azure::DateTime> IfModifiedSince;
-        }; // struct SetBlobContainerMetadataOptions
-
-        static Azure::Response<SetBlobContainerMetadataResult> SetMetadata(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const SetBlobContainerMetadataOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.GetUrl().AppendQueryParameter("comp", "metadata");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          for (const auto& pair : options.Metadata)
-          {
-            request.SetHeader("x-ms-meta-" + pair.first, pair.second);
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          SetBlobContainerMetadataResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          return Azure::Response<SetBlobContainerMetadataResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct ListBlobsOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          Azure::Nullable<std::string> Prefix;
-          Azure::Nullable<std::string> ContinuationToken;
-          Azure::Nullable<int32_t> MaxResults;
-          ListBlobsIncludeFlags Include = ListBlobsIncludeFlags::None;
-        }; // struct ListBlobsOptions
-
-        static Azure::Response<Models::_detail::ListBlobsResult> ListBlobs(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const ListBlobsOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.GetUrl().AppendQueryParameter("comp", "list");
-          if (options.Prefix.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "prefix", _internal::UrlEncodeQueryParameter(options.Prefix.Value()));
-          }
-          if (options.ContinuationToken.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "marker", _internal::UrlEncodeQueryParameter(options.ContinuationToken.Value()));
-          }
-          if (options.MaxResults.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "maxresults", std::to_string(options.MaxResults.Value()));
-          }
-          std::string list_blobs_include_flags = ListBlobsIncludeFlagsToString(options.Include);
-          if (!list_blobs_include_flags.empty())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "include", _internal::UrlEncodeQueryParameter(list_blobs_include_flags));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::ListBlobsResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& httpResponseBody = httpResponse.GetBody();
-            _internal::XmlReader reader(
-                reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = ListBlobsResultInternalFromXml(reader);
-          }
-          return Azure::Response<Models::_detail::ListBlobsResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct ListBlobsByHierarchyOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          Azure::Nullable<std::string> Prefix;
-          Azure::Nullable<std::string> Delimiter;
-          Azure::Nullable<std::string> ContinuationToken;
-          Azure::Nullable<int32_t> MaxResults;
-          ListBlobsIncludeFlags Include = ListBlobsIncludeFlags::None;
-        }; // struct ListBlobsByHierarchyOptions
-
-        static Azure::Response<Models::_detail::ListBlobsByHierarchyResult> ListBlobsByHierarchy(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const ListBlobsByHierarchyOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.GetUrl().AppendQueryParameter("comp", "list");
-          if (options.Prefix.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "prefix", _internal::UrlEncodeQueryParameter(options.Prefix.Value()));
-          }
-          if (options.Delimiter.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "delimiter", _internal::UrlEncodeQueryParameter(options.Delimiter.Value()));
-          }
-          if (options.ContinuationToken.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "marker", _internal::UrlEncodeQueryParameter(options.ContinuationToken.Value()));
-          }
-          if (options.MaxResults.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "maxresults", std::to_string(options.MaxResults.Value()));
-          }
-          std::string list_blobs_include_flags = ListBlobsIncludeFlagsToString(options.Include);
-          if (!list_blobs_include_flags.empty())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "include", _internal::UrlEncodeQueryParameter(list_blobs_include_flags));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::ListBlobsByHierarchyResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& httpResponseBody = httpResponse.GetBody();
-            _internal::XmlReader reader(
-                reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = ListBlobsByHierarchyResultInternalFromXml(reader);
-          }
-          return Azure::Response<Models::_detail::ListBlobsByHierarchyResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct GetBlobContainerAccessPolicyOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          Azure::Nullable<std::string> LeaseId;
-        }; // struct GetBlobContainerAccessPolicyOptions
-
-        static Azure::Response<BlobContainerAccessPolicy> GetAccessPolicy(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const GetBlobContainerAccessPolicyOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.GetUrl().AppendQueryParameter("comp", "acl");
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          BlobContainerAccessPolicy response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& httpResponseBody = httpResponse.GetBody();
-            _internal::XmlReader reader(
-                reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = BlobContainerAccessPolicyFromXml(reader);
-          }
-          auto x_ms_blob_public_access__iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-public-access");
-          if (x_ms_blob_public_access__iterator != httpResponse.GetHeaders().end())
-          {
-            response.AccessType = PublicAccessType(x_ms_blob_public_access__iterator->second);
-          }
-          return Azure::Response<BlobContainerAccessPolicy>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct SetBlobContainerAccessPolicyOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          PublicAccessType AccessType = PublicAccessType::None;
-          Azure::Nullable<std::string> LeaseId;
-          Azure::Nullable<Azure::DateTime> IfModifiedSince;
-          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
-          std::vector<SignedIdentifier> SignedIdentifiers;
-        }; // struct SetBlobContainerAccessPolicyOptions
-
-        static Azure::Response<SetBlobContainerAccessPolicyResult> SetAccessPolicy(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const SetBlobContainerAccessPolicyOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          std::string xml_body;
-          {
-            _internal::XmlWriter writer;
-            SetBlobContainerAccessPolicyOptionsToXml(writer, options);
-            xml_body = writer.GetDocument();
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
-          }
-          Azure::Core::IO::MemoryBodyStream xml_body_stream(
-              reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
-          auto request = Azure::Core::Http::Request(
-              Azure::Core::Http::HttpMethod::Put, url, &xml_body_stream);
-          request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.GetUrl().AppendQueryParameter("comp", "acl");
-          if (!options.AccessType.ToString().empty())
-          {
-            request.SetHeader("x-ms-blob-public-access", options.AccessType.ToString());
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          SetBlobContainerAccessPolicyResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          return Azure::Response<SetBlobContainerAccessPolicyResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct AcquireBlobContainerLeaseOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          std::chrono::seconds LeaseDuration;
-          Azure::Nullable<std::string> ProposedLeaseId;
-          Azure::Nullable<Azure::DateTime> IfModifiedSince;
-          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
-        }; // struct AcquireBlobContainerLeaseOptions
-
-        static Azure::Response<Models::_detail::AcquireBlobContainerLeaseResult> AcquireLease(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const AcquireBlobContainerLeaseOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.GetUrl().AppendQueryParameter("comp", "lease");
-          request.SetHeader("x-ms-lease-action", "acquire");
-          request.SetHeader("x-ms-lease-duration", std::to_string(options.LeaseDuration.count()));
-          if (options.ProposedLeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-proposed-lease-id", options.ProposedLeaseId.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::AcquireBlobContainerLeaseResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.LeaseId = httpResponse.GetHeaders().at("x-ms-lease-id");
-          return Azure::Response<Models::_detail::AcquireBlobContainerLeaseResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct RenewBlobContainerLeaseOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          std::string LeaseId;
-          Azure::Nullable<Azure::DateTime> IfModifiedSince;
-          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
-        }; // struct RenewBlobContainerLeaseOptions
-
-        static Azure::Response<Models::_detail::RenewBlobContainerLeaseResult> RenewLease(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const RenewBlobContainerLeaseOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.GetUrl().AppendQueryParameter("comp", "lease");
-          request.SetHeader("x-ms-lease-action", "renew");
-          request.SetHeader("x-ms-lease-id", options.LeaseId);
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::RenewBlobContainerLeaseResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.LeaseId = httpResponse.GetHeaders().at("x-ms-lease-id");
-          return Azure::Response<Models::_detail::RenewBlobContainerLeaseResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct ChangeBlobContainerLeaseOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          std::string LeaseId;
-          std::string ProposedLeaseId;
-          Azure::Nullable<Azure::DateTime> IfModifiedSince;
-          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
-        }; // struct ChangeBlobContainerLeaseOptions
-
-        static Azure::Response<Models::_detail::ChangeBlobContainerLeaseResult> ChangeLease(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const ChangeBlobContainerLeaseOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.GetUrl().AppendQueryParameter("comp", "lease");
-          request.SetHeader("x-ms-lease-action", "change");
-          request.SetHeader("x-ms-lease-id", options.LeaseId);
-          request.SetHeader("x-ms-proposed-lease-id", options.ProposedLeaseId);
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::ChangeBlobContainerLeaseResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.LeaseId = httpResponse.GetHeaders().at("x-ms-lease-id");
-          return Azure::Response<Models::_detail::ChangeBlobContainerLeaseResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct ReleaseBlobContainerLeaseOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          std::string LeaseId;
-          Azure::Nullable<Azure::DateTime> IfModifiedSince;
-          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
-        }; // struct ReleaseBlobContainerLeaseOptions
-
-        static Azure::Response<Models::_detail::ReleaseBlobContainerLeaseResult> ReleaseLease(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const ReleaseBlobContainerLeaseOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.GetUrl().AppendQueryParameter("comp", "lease");
-          request.SetHeader("x-ms-lease-action", "release");
-          request.SetHeader("x-ms-lease-id", options.LeaseId);
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::ReleaseBlobContainerLeaseResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          return Azure::Response<Models::_detail::ReleaseBlobContainerLeaseResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-        struct BreakBlobContainerLeaseOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          Azure::Nullable<std::chrono::seconds> BreakPeriod;
-          Azure::Nullable<Azure::DateTime> IfModifiedSince;
-          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
-        }; // struct BreakBlobContainerLeaseOptions
-
-        static Azure::Response<Models::_detail::BreakBlobContainerLeaseResult> BreakLease(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const BreakBlobContainerLeaseOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("restype", "container");
-          request.GetUrl().AppendQueryParameter("comp", "lease");
-          request.SetHeader("x-ms-lease-action", "break");
-          if (options.BreakPeriod.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-lease-break-period", std::to_string(options.BreakPeriod.Value().count()));
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::BreakBlobContainerLeaseResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 202))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.LeaseTime = std::stoi(httpResponse.GetHeaders().at("x-ms-lease-time"));
-          return Azure::Response<Models::_detail::BreakBlobContainerLeaseResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
-
-      private:
-        static BlobContainerAccessPolicy BlobContainerAccessPolicyFromXml(
-            _internal::XmlReader& reader)
-        {
-          BlobContainerAccessPolicy ret;
-          enum class XmlTagName
-          {
-            k_SignedIdentifiers,
-            k_SignedIdentifier,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "SignedIdentifiers")
-              {
-                path.emplace_back(XmlTagName::k_SignedIdentifiers);
-              }
-              else if (node.Name == "SignedIdentifier")
-              {
-                path.emplace_back(XmlTagName::k_SignedIdentifier);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 2 && path[0] == XmlTagName::k_SignedIdentifiers
-                  && path[1] == XmlTagName::k_SignedIdentifier)
-              {
-                ret.SignedIdentifiers.emplace_back(SignedIdentifierFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-            }
-          }
-          return ret;
-        }
-
-        static Models::_detail::ListBlobsByHierarchyResult
-        ListBlobsByHierarchyResultInternalFromXml(_internal::XmlReader& reader)
-        {
-          Models::_detail::ListBlobsByHierarchyResult ret;
-          enum class XmlTagName
-          {
-            k_EnumerationResults,
-            k_Prefix,
-            k_Delimiter,
-            k_NextMarker,
-            k_Blobs,
-            k_Blob,
-            k_BlobPrefix,
-            k_Name,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "EnumerationResults")
-              {
-                path.emplace_back(XmlTagName::k_EnumerationResults);
-              }
-              else if (node.Name == "Prefix")
-              {
-                path.emplace_back(XmlTagName::k_Prefix);
-              }
-              else if (node.Name == "Delimiter")
-              {
-                path.emplace_back(XmlTagName::k_Delimiter);
-              }
-              else if (node.Name == "NextMarker")
-              {
-                path.emplace_back(XmlTagName::k_NextMarker);
-              }
-              else if (node.Name == "Blobs")
-              {
-                path.emplace_back(XmlTagName::k_Blobs);
-              }
-              else if (node.Name == "Blob")
-              {
-                path.emplace_back(XmlTagName::k_Blob);
-              }
-              else if (node.Name == "BlobPrefix")
-              {
-                path.emplace_back(XmlTagName::k_BlobPrefix);
-              }
-              else if (node.Name == "Name")
-              {
-                path.emplace_back(XmlTagName::k_Name);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
-              {
-                ret.Items.emplace_back(BlobItemFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_Prefix)
-              {
-                ret.Prefix = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_Delimiter)
-              {
-                ret.Delimiter = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_NextMarker)
-              {
-                ret.ContinuationToken = node.Value;
-              }
-              else if (
-                  path.size() == 4 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_BlobPrefix
-                  && path[3] == XmlTagName::k_Name)
-              {
-                ret.BlobPrefixes.emplace_back(node.Value);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Attribute)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
-                  && node.Name == "ServiceEndpoint")
-              {
-                ret.ServiceEndpoint = node.Value;
-              }
-              else if (
-                  path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
-                  && node.Name == "ContainerName")
-              {
-                ret.BlobContainerName = node.Value;
-              }
-            }
-          }
-          return ret;
-        }
-
-        static Models::_detail::ListBlobsResult ListBlobsResultInternalFromXml(
-            _internal::XmlReader& reader)
-        {
-          Models::_detail::ListBlobsResult ret;
-          enum class XmlTagName
-          {
-            k_EnumerationResults,
-            k_Prefix,
-            k_NextMarker,
-            k_Blobs,
-            k_Blob,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "EnumerationResults")
-              {
-                path.emplace_back(XmlTagName::k_EnumerationResults);
-              }
-              else if (node.Name == "Prefix")
-              {
-                path.emplace_back(XmlTagName::k_Prefix);
-              }
-              else if (node.Name == "NextMarker")
-              {
-                path.emplace_back(XmlTagName::k_NextMarker);
-              }
-              else if (node.Name == "Blobs")
-              {
-                path.emplace_back(XmlTagName::k_Blobs);
-              }
-              else if (node.Name == "Blob")
-              {
-                path.emplace_back(XmlTagName::k_Blob);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
-              {
-                ret.Items.emplace_back(BlobItemFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_Prefix)
-              {
-                ret.Prefix = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
-                  && path[1] == XmlTagName::k_NextMarker)
-              {
-                ret.ContinuationToken = node.Value;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Attribute)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
-                  && node.Name == "ServiceEndpoint")
-              {
-                ret.ServiceEndpoint = node.Value;
-              }
-              else if (
-                  path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
-                  && node.Name == "ContainerName")
-              {
-                ret.BlobContainerName = node.Value;
-              }
-            }
-          }
-          return ret;
-        }
-
-        static BlobItem BlobItemFromXml(_internal::XmlReader& reader)
-        {
-          BlobItem ret;
-          enum class XmlTagName
-          {
-            k_Name,
-            k_Deleted,
-            k_Snapshot,
-            k_VersionId,
-            k_IsCurrentVersion,
-            k_Properties,
-            k_ContentType,
-            k_ContentEncoding,
-            k_ContentLanguage,
-            k_ContentMD5,
-            k_CacheControl,
-            k_ContentDisposition,
-            k_CreationTime,
-            k_ExpiryTime,
-            k_LastAccessTime,
-            k_LastModified,
-            k_Etag,
-            k_ContentLength,
-            k_BlobType,
-            k_AccessTier,
-            k_AccessTierInferred,
-            k_AccessTierChangeTime,
-            k_ArchiveStatus,
-            k_RehydratePriority,
-            k_LeaseStatus,
-            k_LeaseState,
-            k_LeaseDuration,
-            k_ServerEncrypted,
-            k_CustomerProvidedKeySha256,
-            k_EncryptionScope,
-            k_Sealed,
-            k_xmsblobsequencenumber,
-            k_CopyId,
-            k_CopyStatus,
-            k_CopySource,
-            k_CopyProgress,
-            k_CopyCompletionTime,
-            k_CopyStatusDescription,
-            k_IncrementalCopy,
-            k_CopyDestinationSnapshot,
-            k_DeletedTime,
-            k_RemainingRetentionDays,
-            k_TagCount,
-            k_Metadata,
-            k_OrMetadata,
-            k_Tags,
-            k_TagSet,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "Name")
-              {
-                path.emplace_back(XmlTagName::k_Name);
-              }
-              else if (node.Name == "Deleted")
-              {
-                path.emplace_back(XmlTagName::k_Deleted);
-              }
-              else if (node.Name == "Snapshot")
-              {
-                path.emplace_back(XmlTagName::k_Snapshot);
-              }
-              else if (node.Name == "VersionId")
-              {
-                path.emplace_back(XmlTagName::k_VersionId);
-              }
-              else if (node.Name == "IsCurrentVersion")
-              {
-                path.emplace_back(XmlTagName::k_IsCurrentVersion);
-              }
-              else if (node.Name == "Properties")
-              {
-                path.emplace_back(XmlTagName::k_Properties);
-              }
-              else if (node.Name == "Content-Type")
-              {
-                path.emplace_back(XmlTagName::k_ContentType);
-              }
-              else if (node.Name == "Content-Encoding")
-              {
-                path.emplace_back(XmlTagName::k_ContentEncoding);
-              }
-              else if (node.Name == "Content-Language")
-              {
-                path.emplace_back(XmlTagName::k_ContentLanguage);
-              }
-              else if (node.Name == "Content-MD5")
-              {
-                path.emplace_back(XmlTagName::k_ContentMD5);
-              }
-              else if (node.Name == "Cache-Control")
-              {
-                path.emplace_back(XmlTagName::k_CacheControl);
-              }
-              else if (node.Name == "Content-Disposition")
-              {
-                path.emplace_back(XmlTagName::k_ContentDisposition);
-              }
-              else if (node.Name == "Creation-Time")
-              {
-                path.emplace_back(XmlTagName::k_CreationTime);
-              }
-              else if (node.Name == "Expiry-Time")
-              {
-                path.emplace_back(XmlTagName::k_ExpiryTime);
-              }
-              else if (node.Name == "LastAccessTime")
-              {
-                path.emplace_back(XmlTagName::k_LastAccessTime);
-              }
-              else if (node.Name == "Last-Modified")
-              {
-                path.emplace_back(XmlTagName::k_LastModified);
-              }
-              else if (node.Name == "Etag")
-              {
-                path.emplace_back(XmlTagName::k_Etag);
-              }
-              else if (node.Name == "Content-Length")
-              {
-                path.emplace_back(XmlTagName::k_ContentLength);
-              }
-              else if (node.Name == "BlobType")
-              {
-                path.emplace_back(XmlTagName::k_BlobType);
-              }
-              else if (node.Name == "AccessTier")
-              {
-                path.emplace_back(XmlTagName::k_AccessTier);
-              }
-              else if (node.Name == "AccessTierInferred")
-              {
-                path.emplace_back(XmlTagName::k_AccessTierInferred);
-              }
-              else if (node.Name == "AccessTierChangeTime")
-              {
-                path.emplace_back(XmlTagName::k_AccessTierChangeTime);
-              }
-              else if (node.Name == "ArchiveStatus")
-              {
-                path.emplace_back(XmlTagName::k_ArchiveStatus);
-              }
-              else if (node.Name == "RehydratePriority")
-              {
-                path.emplace_back(XmlTagName::k_RehydratePriority);
-              }
-              else if (node.Name == "LeaseStatus")
-              {
-                path.emplace_back(XmlTagName::k_LeaseStatus);
-              }
-              else if (node.Name == "LeaseState")
-              {
-                path.emplace_back(XmlTagName::k_LeaseState);
-              }
-              else if (node.Name == "LeaseDuration")
-              {
-                path.emplace_back(XmlTagName::k_LeaseDuration);
-              }
-              else if (node.Name == "ServerEncrypted")
-              {
-                path.emplace_back(XmlTagName::k_ServerEncrypted);
-              }
-              else if (node.Name == "CustomerProvidedKeySha256")
-              {
-                path.emplace_back(XmlTagName::k_CustomerProvidedKeySha256);
-              }
-              else if (node.Name == "EncryptionScope")
-              {
-                path.emplace_back(XmlTagName::k_EncryptionScope);
-              }
-              else if (node.Name == "Sealed")
-              {
-                path.emplace_back(XmlTagName::k_Sealed);
-              }
-              else if (node.Name == "x-ms-blob-sequence-number")
-              {
-                path.emplace_back(XmlTagName::k_xmsblobsequencenumber);
-              }
-              else if (node.Name == "CopyId")
-              {
-                path.emplace_back(XmlTagName::k_CopyId);
-              }
-              else if (node.Name == "CopyStatus")
-              {
-                path.emplace_back(XmlTagName::k_CopyStatus);
-              }
-              else if (node.Name == "CopySource")
-              {
-                path.emplace_back(XmlTagName::k_CopySource);
-              }
-              else if (node.Name == "CopyProgress")
-              {
-                path.emplace_back(XmlTagName::k_CopyProgress);
-              }
-              else if (node.Name == "CopyCompletionTime")
-              {
-                path.emplace_back(XmlTagName::k_CopyCompletionTime);
-              }
-              else if (node.Name == "CopyStatusDescription")
-              {
-                path.emplace_back(XmlTagName::k_CopyStatusDescription);
-              }
-              else if (node.Name == "IncrementalCopy")
-              {
-                path.emplace_back(XmlTagName::k_IncrementalCopy);
-              }
-              else if (node.Name == "CopyDestinationSnapshot")
-              {
-                path.emplace_back(XmlTagName::k_CopyDestinationSnapshot);
-              }
-              else if (node.Name == "DeletedTime")
-              {
-                path.emplace_back(XmlTagName::k_DeletedTime);
-              }
-              else if (node.Name == "RemainingRetentionDays")
-              {
-                path.emplace_back(XmlTagName::k_RemainingRetentionDays);
-              }
-              else if (node.Name == "TagCount")
-              {
-                path.emplace_back(XmlTagName::k_TagCount);
-              }
-              else if (node.Name == "Metadata")
-              {
-                path.emplace_back(XmlTagName::k_Metadata);
-              }
-              else if (node.Name == "OrMetadata")
-              {
-                path.emplace_back(XmlTagName::k_OrMetadata);
-              }
-              else if (node.Name == "Tags")
-              {
-                path.emplace_back(XmlTagName::k_Tags);
-              }
-              else if (node.Name == "TagSet")
-              {
-                path.emplace_back(XmlTagName::k_TagSet);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 1 && path[0] == XmlTagName::k_Metadata)
-              {
-                ret.Details.Metadata = MetadataFromXml(reader);
-                path.pop_back();
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_OrMetadata)
-              {
-                ret.Details.ObjectReplicationSourceProperties
-                    = ObjectReplicationSourcePropertiesFromXml(reader);
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Tags
-                  && path[1] == XmlTagName::k_TagSet)
-              {
-                ret.Details.Tags = TagsFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_Name)
-              {
-                ret.Name = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_Deleted)
-              {
-                ret.IsDeleted = node.Value == "true";
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_Snapshot)
-              {
-                ret.Snapshot = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_VersionId)
-              {
-                ret.VersionId = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_IsCurrentVersion)
-              {
-                ret.IsCurrentVersion = node.Value == "true";
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_ContentType)
-              {
-                ret.Details.HttpHeaders.ContentType = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_ContentEncoding)
-              {
-                ret.Details.HttpHeaders.ContentEncoding = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_ContentLanguage)
-              {
-                ret.Details.HttpHeaders.ContentLanguage = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_ContentMD5)
-              {
-                ret.Details.HttpHeaders.ContentHash.Value
-                    = Azure::Core::Convert::Base64Decode(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_CacheControl)
-              {
-                ret.Details.HttpHeaders.CacheControl = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_ContentDisposition)
-              {
-                ret.Details.HttpHeaders.ContentDisposition = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_CreationTime)
-              {
-                ret.Details.CreatedOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_ExpiryTime)
-              {
-                ret.Details.ExpiresOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_LastAccessTime)
-              {
-                ret.Details.LastAccessedOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_LastModified)
-              {
-                ret.Details.LastModified
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_Etag)
-              {
-                ret.Details.ETag = Azure::ETag(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_ContentLength)
-              {
-                ret.BlobSize = std::stoll(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_BlobType)
-              {
-                ret.BlobType = BlobType(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_AccessTier)
-              {
-                ret.Details.AccessTier = AccessTier(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_AccessTierInferred)
-              {
-                ret.Details.IsAccessTierInferred = node.Value == "true";
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_AccessTierChangeTime)
-              {
-                ret.Details.AccessTierChangedOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_ArchiveStatus)
-              {
-                ret.Details.ArchiveStatus = ArchiveStatus(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_RehydratePriority)
-              {
-                ret.Details.RehydratePriority = RehydratePriority(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_LeaseStatus)
-              {
-                ret.Details.LeaseStatus = LeaseStatus(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_LeaseState)
-              {
-                ret.Details.LeaseState = LeaseState(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_LeaseDuration)
-              {
-                ret.Details.LeaseDuration = LeaseDurationType(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_ServerEncrypted)
-              {
-                ret.Details.IsServerEncrypted = node.Value == "true";
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_CustomerProvidedKeySha256)
-              {
-                ret.Details.EncryptionKeySha256 = Azure::Core::Convert::Base64Decode(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_EncryptionScope)
-              {
-                ret.Details.EncryptionScope = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_Sealed)
-              {
-                ret.Details.IsSealed = node.Value == "true";
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_xmsblobsequencenumber)
-              {
-                ret.Details.SequenceNumber = std::stoll(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_CopyId)
-              {
-                ret.Details.CopyId = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_CopyStatus)
-              {
-                ret.Details.CopyStatus = CopyStatus(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_CopySource)
-              {
-                ret.Details.CopySource = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_CopyProgress)
-              {
-                ret.Details.CopyProgress = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_CopyCompletionTime)
-              {
-                ret.Details.CopyCompletedOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_CopyStatusDescription)
-              {
-                ret.Details.CopyStatusDescription = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_IncrementalCopy)
-              {
-                ret.Details.IsIncrementalCopy = node.Value == "true";
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_CopyDestinationSnapshot)
-              {
-                ret.Details.IncrementalCopyDestinationSnapshot = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_DeletedTime)
-              {
-                ret.Details.DeletedOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_RemainingRetentionDays)
-              {
-                ret.Details.RemainingRetentionDays = std::stoi(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_Properties
-                  && path[1] == XmlTagName::k_TagCount)
-              {
-                ret.Details.TagCount = std::stoi(node.Value);
-              }
-            }
-          }
-          return ret;
-        }
-
-        static SignedIdentifier SignedIdentifierFromXml(_internal::XmlReader& reader)
-        {
-          SignedIdentifier ret;
+        /**
+         * Deserializes the blobs of a ListBlobs response one at a time, while the response body is
+         * received.
+         */
+        class ListBlobsResultStreamReader final {
+        public:
+          explicit ListBlobsResultStreamReader(
+              std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse,
+              const Azure::Core::Context& context)
+              : RawResponse(std::move(rawResponse)), m_bodyStream(RawResponse->ExtractBodyStream()),
+                m_reader(*m_bodyStream, context)
+          {
+          }
+
+          /**
+           * Returns the next blob, or null after the last one. The fields of Result that follow
+           * the blobs in the response are set once null is returned.
+           */
+          Azure::Nullable<BlobItem> ReadNext()
+          {
+            while (!m_done)
+            {
+              auto node = m_reader.Read();
+              if (node.Type == _internal::XmlNodeType::End)
+              {
+                m_done = true;
+              }
+              else if (node.Type == _internal::XmlNodeType::EndTag)
+              {
+                if (m_path.size() > 0)
+                {
+                  m_path.pop_back();
+                }
+                else
+                {
+                  m_done = true;
+                }
+              }
+              else if (node.Type == _internal::XmlNodeType::StartTag)
+              {
+                if (node.Name == "EnumerationResults")
+                {
+                  m_path.emplace_back(XmlTagName::k_EnumerationResults);
+                }
+                else if (node.Name == "Prefix")
+                {
+                  m_path.emplace_back(XmlTagName::k_Prefix);
+                }
+                else if (node.Name == "NextMarker")
+                {
+                  m_path.emplace_back(XmlTagName::k_NextMarker);
+                }
+                else if (node.Name == "Blobs")
+                {
+                  m_path.emplace_back(XmlTagName::k_Blobs);
+                }
+                else if (node.Name == "Blob")
+                {
+                  m_path.emplace_back(XmlTagName::k_Blob);
+                }
+                else
+                {
+                  m_path.emplace_back(XmlTagName::k_Unknown);
+                }
+                if (m_path.size() == 3 && m_path[0] == XmlTagName::k_EnumerationResults
+                    && m_path[1] == XmlTagName::k_Blobs && m_path[2] == XmlTagName::k_Blob)
+                {
+                  m_path.pop_back();
+                  return BlobItemFromXml(m_reader);
+                }
+              }
+              else if (node.Type == _internal::XmlNodeType::Text)
+              {
+                if (m_path.size() == 2 && m_path[0] == XmlTagName::k_EnumerationResults
+                    && m_path[1] == XmlTagName::k_Prefix)
+                {
+                  Result.Prefix = node.Value;
+                }
+                else if (
+                    m_path.size() == 2 && m_path[0] == XmlTagName::k_EnumerationResults
+                    && m_path[1] == XmlTagName::k_NextMarker)
+                {
+                  Result.ContinuationToken = node.Value;
+                }
+              }
+              else if (node.Type == _internal::XmlNodeType::Attribute)
+              {
+                if (m_path.size() == 1 && m_path[0] == XmlTagName::k_EnumerationResults
+                    && node.Name == "ServiceEndpoint")
+                {
+                  Result.ServiceEndpoint = node.Value;
+                }
+                else if (
+                    m_path.size() == 1 && m_path[0] == XmlTagName::k_EnumerationResults
+                    && node.Name == "ContainerName")
+                {
+                  Result.BlobContainerName = node.Value;
+                }
+              }
+            }
+            return Azure::Nullable<BlobItem>();
+          }
+
+          Models::_detail::ListBlobsResult Result;
+          std::unique_ptr<Azure::Core::Http::RawResponse> RawResponse;
+
+        private:
           enum class XmlTagName
           {
-            k_Id,
-            k_AccessPolicy,
-            k_Start,
-            k_Expiry,
-            k_Permission,
+            k_EnumerationResults,
+            k_Prefix,
+            k_NextMarker,
+            k_Blobs,
+            k_Blob,
             k_Unknown,
           };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "Id")
-              {
-                path.emplace_back(XmlTagName::k_Id);
-              }
-              else if (node.Name == "AccessPolicy")
-              {
-                path.emplace_back(XmlTagName::k_AccessPolicy);
-              }
-              else if (node.Name == "Start")
-              {
-                path.emplace_back(XmlTagName::k_Start);
-              }
-              else if (node.Name == "Expiry")
-              {
-                path.emplace_back(XmlTagName::k_Expiry);
-              }
-              else if (node.Name == "Permission")
-              {
-                path.emplace_back(XmlTagName::k_Permission);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::k_Id)
-              {
-                ret.Id = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_AccessPolicy
-                  && path[1] == XmlTagName::k_Start)
-              {
-                ret.StartsOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_AccessPolicy
-                  && path[1] == XmlTagName::k_Expiry)
-              {
-                ret.ExpiresOn
-                    = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_AccessPolicy
-                  && path[1] == XmlTagName::k_Permission)
-              {
-                ret.Permissions = node.Value;
-              }
-            }
-          }
-          return ret;
-        }
 
-        static std::map<std::string, std::string> TagsFromXml(_internal::XmlReader& reader)
+          std::unique_ptr<Azure::Core::IO::BodyStream> m_bodyStream;
+          _internal::XmlReader m_reader;
+          std::vector<XmlTagName> m_path;
+          bool m_done = false;
+        };
+
+        /**
+         * Sends a ListBlobs request whose response body is left in the body stream of the returned
+         * response, to be deserialized while it is received.
+         */
+        static std::unique_ptr<Azure::Core::Http::RawResponse> ListBlobsUnbuffered(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const ListBlobsOptions& options,
+            const Azure::Core::Context& context);
+
+        /**
+         * Sends a ListBlobs request whose response body is deserialized while it is received, with
+         * a ListBlobsResultStreamReader.
+         */
+        static std::unique_ptr<ListBlobsResultStreamReader> ListBlobsStreaming(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const ListBlobsOptions& options,
+            const Azure::Core::Context& context);
+
+        /**
+         * Sends a ListBlobs request and deserializes only the requested fields of the blobs, into
+         * CompactBlobItems whose strings are kept in the arena of the result.
+         */
+        static Azure::Response<Models::_detail::ListBlobsCompactResult> ListBlobsCompact(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const ListBlobsOptions& options,
+            CompactBlobItemFields fields,
+            const Azure::Core::Context& context);
+
+        struct ListBlobsByHierarchyOptions final
         {
-          std::map<std::string, std::string> ret;
-          int depth = 0;
-          std::string key;
-          bool is_key = false;
-          bool is_value = false;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              ++depth;
-              if (node.Name == "Key")
-              {
-                is_key = true;
-              }
-              else if (node.Name == "Value")
-              {
-                is_value = true;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (depth-- == 0)
-              {
-                break;
-              }
-            }
-            if (depth == 2 && node.Type == _internal::XmlNodeType::Text)
-            {
-              if (is_key)
-              {
-                key = node.Value;
-                is_key = false;
-              }
-              else if (is_value)
-              {
-                ret.emplace(std::move(key), node.Value);
-                is_value = false;
-              }
-            }
-          }
-          return ret;
-        }
+          Azure::Nullable<int32_t> Timeout;
+          Azure::Nullable<std::string> Prefix;
+          Azure::Nullable<std::string> Delimiter;
+          Azure::Nullable<std::string> ContinuationToken;
+          Azure::Nullable<int32_t> MaxResults;
+          ListBlobsIncludeFlags Include = ListBlobsIncludeFlags::None;
+        }; // struct ListBlobsByHierarchyOptions
 
-        static std::vector<ObjectReplicationPolicy> ObjectReplicationSourcePropertiesFromXml(
-            _internal::XmlReader& reader)
+        static Azure::Response<Models::_detail::ListBlobsByHierarchyResult> ListBlobsByHierarchy(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const ListBlobsByHierarchyOptions& options,
+            const Azure::Core::Context& context);
+
+        struct GetBlobContainerAccessPolicyOptions final
         {
-          int depth = 0;
-          std::map<std::string, std::vector<ObjectReplicationRule>> orPropertiesMap;
-          std::string policyId;
-          std::string ruleId;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              ++depth;
-              std::string startTagName = node.Name;
-              if (startTagName.substr(0, 3) == "or-")
-              {
-                auto underscorePos = startTagName.find('_', 3);
-                policyId
-                    = std::string(startTagName.begin() + 3, startTagName.begin() + underscorePos);
-                ruleId = startTagName.substr(underscorePos + 1);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (depth-- == 0)
-              {
-                break;
-              }
-            }
-            if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
-            {
-              ObjectReplicationRule rule;
-              rule.RuleId = std::move(ruleId);
-              rule.ReplicationStatus = ObjectReplicationStatus(node.Value);
-              orPropertiesMap[policyId].emplace_back(std::move(rule));
-            }
-          }
-          std::vector<ObjectReplicationPolicy> ret;
-          for (auto& property : orPropertiesMap)
-          {
-            ObjectReplicationPolicy policy;
-            policy.PolicyId = property.first;
-            policy.Rules = std::move(property.second);
-            ret.emplace_back(std::move(policy));
-          }
-          return ret;
-        }
+          Azure::Nullable<int32_t> Timeout;
+          Azure::Nullable<std::string> LeaseId;
+        }; // struct GetBlobContainerAccessPolicyOptions
+
+        static Azure::Response<BlobContainerAccessPolicy> GetAccessPolicy(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const GetBlobContainerAccessPolicyOptions& options,
+            const Azure::Core::Context& context);
 
-        static Metadata MetadataFromXml(_internal::XmlReader& reader)
+        struct SetBlobContainerAccessPolicyOptions final
         {
-          Metadata ret;
-          int depth = 0;
-          std::string key;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (depth++ == 0)
-              {
-                key = node.Name;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (depth-- == 0)
-              {
-                break;
-              }
-            }
-            else if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
-            {
-              ret.emplace(std::move(key), node.Value);
-            }
-          }
-          return ret;
-        }
+          Azure::Nullable<int32_t> Timeout;
+          PublicAccessType AccessType = PublicAccessType::None;
+          Azure::Nullable<std::string> LeaseId;
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
+          std::vector<SignedIdentifier> SignedIdentifiers;
+        }; // struct SetBlobContainerAccessPolicyOptions
+
+        static Azure::Response<SetBlobContainerAccessPolicyResult> SetAccessPolicy(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const SetBlobContainerAccessPolicyOptions& options,
+            const Azure::Core::Context& context);
+
+        struct AcquireBlobContainerLeaseOptions final
+        {
+          Azure::Nullable<int32_t> Timeout;
+          std::chrono::seconds LeaseDuration;
+          Azure::Nullable<std::string> ProposedLeaseId;
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
+        }; // struct AcquireBlobContainerLeaseOptions
+
+        static Azure::Response<Models::_detail::AcquireBlobContainerLeaseResult> AcquireLease(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const AcquireBlobContainerLeaseOptions& options,
+            const Azure::Core::Context& context);
+
+        struct RenewBlobContainerLeaseOptions final
+        {
+          Azure::Nullable<int32_t> Timeout;
+          std::string LeaseId;
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
+        }; // struct RenewBlobContainerLeaseOptions
+
+        static Azure::Response<Models::_detail::RenewBlobContainerLeaseResult> RenewLease(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const RenewBlobContainerLeaseOptions& options,
+            const Azure::Core::Context& context);
+
+        struct ChangeBlobContainerLeaseOptions final
+        {
+          Azure::Nullable<int32_t> Timeout;
+          std::string LeaseId;
+          std::string ProposedLeaseId;
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
+        }; // struct ChangeBlobContainerLeaseOptions
+
+        static Azure::Response<Models::_detail::ChangeBlobContainerLeaseResult> ChangeLease(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const ChangeBlobContainerLeaseOptions& options,
+            const Azure::Core::Context& context);
+
+        struct ReleaseBlobContainerLeaseOptions final
+        {
+          Azure::Nullable<int32_t> Timeout;
+          std::string LeaseId;
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
+        }; // struct ReleaseBlobContainerLeaseOptions
+
+        static Azure::Response<Models::_detail::ReleaseBlobContainerLeaseResult> ReleaseLease(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const ReleaseBlobContainerLeaseOptions& options,
+            const Azure::Core::Context& context);
+
+        struct BreakBlobContainerLeaseOptions final
+        {
+          Azure::Nullable<int32_t> Timeout;
+          Azure::Nullable<std::chrono::seconds> BreakPeriod;
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
+        }; // struct BreakBlobContainerLeaseOptions
+
+        static Azure::Response<Models::_detail::BreakBlobContainerLeaseResult> BreakLease(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const BreakBlobContainerLeaseOptions& options,
+            const Azure::Core::Context& context);
+
+      private:
+        static BlobContainerAccessPolicy BlobContainerAccessPolicyFromXml(
+            _internal::XmlReader& reader);
+
+        static Models::_detail::ListBlobsByHierarchyResult
+        ListBlobsByHierarchyResultInternalFromXml(_internal::XmlReader& reader);
+
+        static Models::_detail::ListBlobsCompactResult ListBlobsCompactResultFromXml(
+            _internal::XmlReader& reader,
+            CompactBlobItemFields fields);
+
+        static Models::_detail::ListBlobsResult ListBlobsResultInternalFromXml(
+            _internal::XmlReader& reader);
+
+        static BlobItem BlobItemFromXml(_internal::XmlReader& reader);
+
+        static SignedIdentifier SignedIdentifierFromXml(_internal::XmlReader& reader);
+
+        static std::map<std::string, std::string> TagsFromXml(_internal::XmlReader& reader);
+
+        static std::vector<ObjectReplicationPolicy> ObjectReplicationSourcePropertiesFromXml(
+            _internal::XmlReader& reader);
+
+        static Metadata MetadataFromXml(_internal::XmlReader& reader);
 
         static void SetBlobContainerAccessPolicyOptionsToXml(
             _internal::XmlWriter& writer,
-            const SetBlobContainerAccessPolicyOptions& options)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "SignedIdentifiers"});
-          for (const auto& i : options.SignedIdentifiers)
-          {
-            SignedIdentifierToXml(writer, i);
-          }
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+            const SetBlobContainerAccessPolicyOptions& options);
 
         static void SignedIdentifierToXml(
             _internal::XmlWriter& writer,
-            const SignedIdentifier& options)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "SignedIdentifier"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Id"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Id});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AccessPolicy"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Start"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text,
-              std::string(),
-              options.StartsOn.ToString(
-                  Azure::DateTime::DateFormat::Rfc3339,
-                  Azure::DateTime::TimeFractionFormat::AllDigits)});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Expiry"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text,
-              std::string(),
-              options.ExpiresOn.ToString(
-                  Azure::DateTime::DateFormat::Rfc3339,
-                  Azure::DateTime::TimeFractionFormat::AllDigits)});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Permission"});
-          writer.Write(
-              _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Permissions});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+            const SignedIdentifier& options);
 
       }; // class BlobContainer
 
@@ -6589,356 +3597,50 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Nullable<std::string> EncryptionKey;
           Azure::Nullable<std::vector<uint8_t>> EncryptionKeySha256;
           Azure::Nullable<EncryptionAlgorithmType> EncryptionAlgorithm;
-          Azure::Nullable<std::string> LeaseId;
+          Azure::Nullable<std::string> LeaseId;
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
+          Azure::ETag IfMatch;
+          Azure::ETag IfNoneMatch;
+          Azure::Nullable<std::string> IfTags;
+        }; // struct DownloadBlobOptions
+
+        static Azure::Core::Http::Request DownloadCreateMessage(
+            const Azure::Core::Url& url,
+            const DownloadBlobOptions& options);
+
+        static Azure::Response<DownloadBlobResult> DownloadCreateResponse(
+            std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
+            const Azure::Core::Context& context);
+
+        static Azure::Response<DownloadBlobResult> Download(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const DownloadBlobOptions& options,
+            const Azure::Core::Context& context);
+
+        struct QueryBlobOptions final
+        {
+          Azure::Nullable<int32_t> Timeout;
+          std::string QueryExpression;
+          Azure::Nullable<Models::_detail::QueryTextConfiguration> InputTextConfiguration;
+          Azure::Nullable<Models::_detail::QueryTextConfiguration> OutputTextConfiguration;
+          Azure::Nullable<std::string> LeaseId;
+          Azure::Nullable<std::string> EncryptionKey;
+          Azure::Nullable<std::vector<uint8_t>> EncryptionKeySha256;
+          Azure::Nullable<EncryptionAlgorithmType> EncryptionAlgorithm;
           Azure::Nullable<Azure::DateTime> IfModifiedSince;
           Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
           Azure::ETag IfMatch;
           Azure::ETag IfNoneMatch;
           Azure::Nullable<std::string> IfTags;
-        }; // struct DownloadBlobOptions
+        }; // struct QueryBlobOptions
 
-        static Azure::Response<DownloadBlobResult> Download(
+        static Azure::Response<QueryBlobResult> Query(
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
-            const DownloadBlobOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url, false);
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.Range.HasValue())
-          {
-            std::string headerValue = "bytes=" + std::to_string(options.Range.Value().Offset) + "-";
-            if (options.Range.Value().Length.HasValue())
-            {
-              headerValue += std::to_string(
-                  options.Range.Value().Offset + options.Range.Value().Length.Value() - 1);
-            }
-            request.SetHeader("x-ms-range", std::move(headerValue));
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.RangeHashAlgorithm.HasValue())
-          {
-            if (options.RangeHashAlgorithm.Value() == HashAlgorithm::Md5)
-            {
-              request.SetHeader("x-ms-range-get-content-md5", "true");
-            }
-            else if (options.RangeHashAlgorithm.Value() == HashAlgorithm::Crc64)
-            {
-              request.SetHeader("x-ms-range-get-content-crc64", "true");
-            }
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          DownloadBlobResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200 || http_status_code == 206))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.BodyStream = httpResponse.ExtractBodyStream();
-          {
-            const auto& headers = httpResponse.GetHeaders();
-            auto content_md5_iterator = headers.find("content-md5");
-            if (content_md5_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Md5;
-              hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-            auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
-            if (x_ms_content_crc64_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Crc64;
-              hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-          }
-          response.BlobType = BlobType(httpResponse.GetHeaders().at("x-ms-blob-type"));
-          auto content_range_iterator = httpResponse.GetHeaders().find("content-range");
-          if (content_range_iterator != httpResponse.GetHeaders().end())
-          {
-            const std::string& content_range = content_range_iterator->second;
-            auto bytes_pos = content_range.find("bytes ");
-            auto dash_pos = content_range.find("-", bytes_pos + 6);
-            auto slash_pos = content_range.find("/", dash_pos + 1);
-            int64_t range_start_offset = std::stoll(std::string(
-                content_range.begin() + bytes_pos + 6, content_range.begin() + dash_pos));
-            int64_t range_end_offset = std::stoll(std::string(
-                content_range.begin() + dash_pos + 1, content_range.begin() + slash_pos));
-            response.ContentRange = Azure::Core::Http::HttpRange{
-                range_start_offset, range_end_offset - range_start_offset + 1};
-          }
-          else
-          {
-            response.ContentRange = Azure::Core::Http::HttpRange{
-                0, std::stoll(httpResponse.GetHeaders().at("content-length"))};
-          }
-          if (content_range_iterator != httpResponse.GetHeaders().end())
-          {
-            const std::string& content_range = content_range_iterator->second;
-            auto slash_pos = content_range.find("/");
-            response.BlobSize = std::stoll(content_range.substr(slash_pos + 1));
-          }
-          else
-          {
-            response.BlobSize = std::stoll(httpResponse.GetHeaders().at("content-length"));
-          }
-          response.Details.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.Details.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          auto content_type__iterator = httpResponse.GetHeaders().find("content-type");
-          if (content_type__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.HttpHeaders.ContentType = content_type__iterator->second;
-          }
-          auto content_encoding__iterator = httpResponse.GetHeaders().find("content-encoding");
-          if (content_encoding__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.HttpHeaders.ContentEncoding = content_encoding__iterator->second;
-          }
-          auto content_language__iterator = httpResponse.GetHeaders().find("content-language");
-          if (content_language__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.HttpHeaders.ContentLanguage = content_language__iterator->second;
-          }
-          auto cache_control__iterator = httpResponse.GetHeaders().find("cache-control");
-          if (cache_control__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.HttpHeaders.CacheControl = cache_control__iterator->second;
-          }
-          if (http_status_code == 200)
-          {
-            auto content_md5__iterator = httpResponse.GetHeaders().find("content-md5");
-            if (content_md5__iterator != httpResponse.GetHeaders().end())
-            {
-              response.Details.HttpHeaders.ContentHash.Value
-                  = Azure::Core::Convert::Base64Decode(content_md5__iterator->second);
-            }
-          }
-          auto x_ms_blob_content_md5__iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-content-md5");
-          if (x_ms_blob_content_md5__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.HttpHeaders.ContentHash.Value
-                = Azure::Core::Convert::Base64Decode(x_ms_blob_content_md5__iterator->second);
-          }
-          auto content_disposition__iterator
-              = httpResponse.GetHeaders().find("content-disposition");
-          if (content_disposition__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.HttpHeaders.ContentDisposition = content_disposition__iterator->second;
-          }
-          for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-meta-");
-               i != httpResponse.GetHeaders().end() && i->first.substr(0, 10) == "x-ms-meta-";
-               ++i)
-          {
-            response.Details.Metadata.emplace(i->first.substr(10), i->second);
-          }
-          response.Details.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          auto x_ms_lease_status__iterator = httpResponse.GetHeaders().find("x-ms-lease-status");
-          if (x_ms_lease_status__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.LeaseStatus = LeaseStatus(x_ms_lease_status__iterator->second);
-          }
-          auto x_ms_lease_state__iterator = httpResponse.GetHeaders().find("x-ms-lease-state");
-          if (x_ms_lease_state__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.LeaseState = LeaseState(x_ms_lease_state__iterator->second);
-          }
-          auto x_ms_lease_duration__iterator
-              = httpResponse.GetHeaders().find("x-ms-lease-duration");
-          if (x_ms_lease_duration__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.LeaseDuration
-                = LeaseDurationType(x_ms_lease_duration__iterator->second);
-          }
-          response.Details.CreatedOn = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("x-ms-creation-time"),
-              Azure::DateTime::DateFormat::Rfc1123);
-          auto x_ms_expiry_time__iterator = httpResponse.GetHeaders().find("x-ms-expiry-time");
-          if (x_ms_expiry_time__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.ExpiresOn = Azure::DateTime::Parse(
-                x_ms_expiry_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
-          }
-          auto x_ms_last_access_time__iterator
-              = httpResponse.GetHeaders().find("x-ms-last-access-time");
-          if (x_ms_last_access_time__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.LastAccessedOn = Azure::DateTime::Parse(
-                x_ms_last_access_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
-          }
-          auto x_ms_blob_sequence_number__iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-sequence-number");
-          if (x_ms_blob_sequence_number__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.SequenceNumber
-                = std::stoll(x_ms_blob_sequence_number__iterator->second);
-          }
-          auto x_ms_blob_committed_block_count__iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-committed-block-count");
-          if (x_ms_blob_committed_block_count__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.CommittedBlockCount
-                = std::stoi(x_ms_blob_committed_block_count__iterator->second);
-          }
-          auto x_ms_blob_sealed__iterator = httpResponse.GetHeaders().find("x-ms-blob-sealed");
-          if (x_ms_blob_sealed__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.IsSealed = x_ms_blob_sealed__iterator->second == "true";
-          }
-          auto x_ms_or_policy_id__iterator = httpResponse.GetHeaders().find("x-ms-or-policy-id");
-          if (x_ms_or_policy_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.ObjectReplicationDestinationPolicyId
-                = x_ms_or_policy_id__iterator->second;
-          }
-          {
-            std::map<std::string, std::vector<ObjectReplicationRule>> orPropertiesMap;
-            for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-or-");
-                 i != httpResponse.GetHeaders().end() && i->first.substr(0, 8) == "x-ms-or-";
-                 ++i)
-            {
-              const std::string& header = i->first;
-              auto underscorePos = header.find('_', 8);
-              if (underscorePos == std::string::npos)
-              {
-                continue;
-              }
-              std::string policyId
-                  = std::string(header.begin() + 8, header.begin() + underscorePos);
-              std::string ruleId = header.substr(underscorePos + 1);
-
-              ObjectReplicationRule rule;
-              rule.RuleId = std::move(ruleId);
-              rule.ReplicationStatus = ObjectReplicationStatus(i->second);
-              orPropertiesMap[policyId].emplace_back(std::move(rule));
-            }
-            for (auto& property : orPropertiesMap)
-            {
-              ObjectReplicationPolicy policy;
-              policy.PolicyId = property.first;
-              policy.Rules = std::move(property.second);
-              response.Details.ObjectReplicationSourceProperties.emplace_back(std::move(policy));
-            }
-          }
-          auto x_ms_tag_count__iterator = httpResponse.GetHeaders().find("x-ms-tag-count");
-          if (x_ms_tag_count__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.TagCount = std::stoi(x_ms_tag_count__iterator->second);
-          }
-          auto x_ms_copy_id__iterator = httpResponse.GetHeaders().find("x-ms-copy-id");
-          if (x_ms_copy_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.CopyId = x_ms_copy_id__iterator->second;
-          }
-          auto x_ms_copy_source__iterator = httpResponse.GetHeaders().find("x-ms-copy-source");
-          if (x_ms_copy_source__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.CopySource = x_ms_copy_source__iterator->second;
-          }
-          auto x_ms_copy_status__iterator = httpResponse.GetHeaders().find("x-ms-copy-status");
-          if (x_ms_copy_status__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.CopyStatus = CopyStatus(x_ms_copy_status__iterator->second);
-          }
-          auto x_ms_copy_status_description__iterator
-              = httpResponse.GetHeaders().find("x-ms-copy-status-description");
-          if (x_ms_copy_status_description__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.CopyStatusDescription = x_ms_copy_status_description__iterator->second;
-          }
-          auto x_ms_copy_progress__iterator = httpResponse.GetHeaders().find("x-ms-copy-progress");
-          if (x_ms_copy_progress__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.CopyProgress = x_ms_copy_progress__iterator->second;
-          }
-          auto x_ms_copy_completion_time__iterator
-              = httpResponse.GetHeaders().find("x-ms-copy-completion-time");
-          if (x_ms_copy_completion_time__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.CopyCompletedOn = Azure::DateTime::Parse(
-                x_ms_copy_completion_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
-          }
-          auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
-          if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.VersionId = x_ms_version_id__iterator->second;
-          }
-          auto x_ms_is_current_version__iterator
-              = httpResponse.GetHeaders().find("x-ms-is-current-version");
-          if (x_ms_is_current_version__iterator != httpResponse.GetHeaders().end())
-          {
-            response.Details.IsCurrentVersion = x_ms_is_current_version__iterator->second == "true";
-          }
-          return Azure::Response<DownloadBlobResult>(std::move(response), std::move(pHttpResponse));
-        }
+            const QueryBlobOptions& options,
+            const Azure::Core::Context& context);
 
         struct DeleteBlobOptions final
         {
@@ -6954,78 +3656,17 @@ namespace Azure { namespace Storage { namespace Blobs {
 
         static Azure::Core::Http::Request DeleteCreateMessage(
             const Azure::Core::Url& url,
-            const DeleteBlobOptions& options)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Delete, url);
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.DeleteSnapshots.HasValue())
-          {
-            request.SetHeader("x-ms-delete-snapshots", options.DeleteSnapshots.Value().ToString());
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          return request;
-        }
+            const DeleteBlobOptions& options);
 
         static Azure::Response<DeleteBlobResult> DeleteCreateResponse(
             std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
-            const Azure::Core::Context& context)
-        {
-          (void)context;
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          DeleteBlobResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 202))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          return Azure::Response<DeleteBlobResult>(std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         static Azure::Response<DeleteBlobResult> Delete(
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const DeleteBlobOptions& options,
-            const Azure::Core::Context& context)
-        {
-          auto request = DeleteCreateMessage(url, options);
-          auto pHttpResponse = pipeline.Send(request, context);
-          return DeleteCreateResponse(std::move(pHttpResponse), context);
-        }
+            const Azure::Core::Context& context);
 
         struct SetBlobExpiryOptions final
         {
@@ -7038,39 +3679,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const SetBlobExpiryOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "expiry");
-          request.SetHeader("x-ms-expiry-option", options.ExpiryOrigin.ToString());
-          if (options.ExpiryTime.HasValue())
-          {
-            request.SetHeader("x-ms-expiry-time", options.ExpiryTime.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          SetBlobExpiryResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          return Azure::Response<SetBlobExpiryResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct UndeleteBlobOptions final
         {
@@ -7081,30 +3690,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const UndeleteBlobOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "undelete");
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          UndeleteBlobResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          return Azure::Response<UndeleteBlobResult>(std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct GetBlobPropertiesOptions final
         {
@@ -7121,317 +3707,10 @@ namespace Azure { namespace Storage { namespace Blobs {
         }; // struct GetBlobPropertiesOptions
 
         static Azure::Response<BlobProperties> GetProperties(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const GetBlobPropertiesOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Head, url);
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          BlobProperties response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.CreatedOn = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("x-ms-creation-time"),
-              Azure::DateTime::DateFormat::Rfc1123);
-          auto x_ms_expiry_time__iterator = httpResponse.GetHeaders().find("x-ms-expiry-time");
-          if (x_ms_expiry_time__iterator != httpResponse.GetHeaders().end())
-          {
-            response.ExpiresOn = Azure::DateTime::Parse(
-                x_ms_expiry_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
-          }
-          auto x_ms_last_access_time__iterator
-              = httpResponse.GetHeaders().find("x-ms-last-access-time");
-          if (x_ms_last_access_time__iterator != httpResponse.GetHeaders().end())
-          {
-            response.LastAccessedOn = Azure::DateTime::Parse(
-                x_ms_last_access_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
-          }
-          for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-meta-");
-               i != httpResponse.GetHeaders().end() && i->first.substr(0, 10) == "x-ms-meta-";
-               ++i)
-          {
-            response.Metadata.emplace(i->first.substr(10), i->second);
-          }
-          response.BlobType = BlobType(httpResponse.GetHeaders().at("x-ms-blob-type"));
-          auto x_ms_lease_status__iterator = httpResponse.GetHeaders().find("x-ms-lease-status");
-          if (x_ms_lease_status__iterator != httpResponse.GetHeaders().end())
-          {
-            response.LeaseStatus = LeaseStatus(x_ms_lease_status__iterator->second);
-          }
-          auto x_ms_lease_state__iterator = httpResponse.GetHeaders().find("x-ms-lease-state");
-          if (x_ms_lease_state__iterator != httpResponse.GetHeaders().end())
-          {
-            response.LeaseState = LeaseState(x_ms_lease_state__iterator->second);
-          }
-          auto x_ms_lease_duration__iterator
-              = httpResponse.GetHeaders().find("x-ms-lease-duration");
-          if (x_ms_lease_duration__iterator != httpResponse.GetHeaders().end())
-          {
-            response.LeaseDuration = LeaseDurationType(x_ms_lease_duration__iterator->second);
-          }
-          response.BlobSize = std::stoll(httpResponse.GetHeaders().at("content-length"));
-          auto content_type__iterator = httpResponse.GetHeaders().find("content-type");
-          if (content_type__iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentType = content_type__iterator->second;
-          }
-          auto content_encoding__iterator = httpResponse.GetHeaders().find("content-encoding");
-          if (content_encoding__iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentEncoding = content_encoding__iterator->second;
-          }
-          auto content_language__iterator = httpResponse.GetHeaders().find("content-language");
-          if (content_language__iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentLanguage = content_language__iterator->second;
-          }
-          auto cache_control__iterator = httpResponse.GetHeaders().find("cache-control");
-          if (cache_control__iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.CacheControl = cache_control__iterator->second;
-          }
-          auto content_md5__iterator = httpResponse.GetHeaders().find("content-md5");
-          if (content_md5__iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentHash.Value
-                = Azure::Core::Convert::Base64Decode(content_md5__iterator->second);
-          }
-          auto x_ms_blob_content_md5__iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-content-md5");
-          if (x_ms_blob_content_md5__iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentHash.Value
-                = Azure::Core::Convert::Base64Decode(x_ms_blob_content_md5__iterator->second);
-          }
-          auto content_disposition__iterator
-              = httpResponse.GetHeaders().find("content-disposition");
-          if (content_disposition__iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentDisposition = content_disposition__iterator->second;
-          }
-          auto x_ms_blob_sequence_number__iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-sequence-number");
-          if (x_ms_blob_sequence_number__iterator != httpResponse.GetHeaders().end())
-          {
-            response.SequenceNumber = std::stoll(x_ms_blob_sequence_number__iterator->second);
-          }
-          auto x_ms_blob_committed_block_count__iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-committed-block-count");
-          if (x_ms_blob_committed_block_count__iterator != httpResponse.GetHeaders().end())
-          {
-            response.CommittedBlockCount
-                = std::stoi(x_ms_blob_committed_block_count__iterator->second);
-          }
-          auto x_ms_blob_sealed__iterator = httpResponse.GetHeaders().find("x-ms-blob-sealed");
-          if (x_ms_blob_sealed__iterator != httpResponse.GetHeaders().end())
-          {
-            response.IsSealed = x_ms_blob_sealed__iterator->second == "true";
-          }
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          auto x_ms_access_tier__iterator = httpResponse.GetHeaders().find("x-ms-access-tier");
-          if (x_ms_access_tier__iterator != httpResponse.GetHeaders().end())
-          {
-            response.AccessTier = AccessTier(x_ms_access_tier__iterator->second);
-          }
-          auto x_ms_access_tier_inferred__iterator
-              = httpResponse.GetHeaders().find("x-ms-access-tier-inferred");
-          if (x_ms_access_tier_inferred__iterator != httpResponse.GetHeaders().end())
-          {
-            response.IsAccessTierInferred = x_ms_access_tier_inferred__iterator->second == "true";
-          }
-          auto x_ms_archive_status__iterator
-              = httpResponse.GetHeaders().find("x-ms-archive-status");
-          if (x_ms_archive_status__iterator != httpResponse.GetHeaders().end())
-          {
-            response.ArchiveStatus = ArchiveStatus(x_ms_archive_status__iterator->second);
-          }
-          auto x_ms_rehydrate_priority__iterator
-              = httpResponse.GetHeaders().find("x-ms-rehydrate-priority");
-          if (x_ms_rehydrate_priority__iterator != httpResponse.GetHeaders().end())
-          {
-            response.RehydratePriority
-                = RehydratePriority(x_ms_rehydrate_priority__iterator->second);
-          }
-          auto x_ms_access_tier_change_time__iterator
-              = httpResponse.GetHeaders().find("x-ms-access-tier-change-time");
-          if (x_ms_access_tier_change_time__iterator != httpResponse.GetHeaders().end())
-          {
-            response.AccessTierChangedOn = Azure::DateTime::Parse(
-                x_ms_access_tier_change_time__iterator->second,
-                Azure::DateTime::DateFormat::Rfc1123);
-          }
-          auto x_ms_copy_id__iterator = httpResponse.GetHeaders().find("x-ms-copy-id");
-          if (x_ms_copy_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.CopyId = x_ms_copy_id__iterator->second;
-          }
-          auto x_ms_copy_source__iterator = httpResponse.GetHeaders().find("x-ms-copy-source");
-          if (x_ms_copy_source__iterator != httpResponse.GetHeaders().end())
-          {
-            response.CopySource = x_ms_copy_source__iterator->second;
-          }
-          auto x_ms_copy_status__iterator = httpResponse.GetHeaders().find("x-ms-copy-status");
-          if (x_ms_copy_status__iterator != httpResponse.GetHeaders().end())
-          {
-            response.CopyStatus = CopyStatus(x_ms_copy_status__iterator->second);
-          }
-          auto x_ms_copy_status_description__iterator
-              = httpResponse.GetHeaders().find("x-ms-copy-status-description");
-          if (x_ms_copy_status_description__iterator != httpResponse.GetHeaders().end())
-          {
-            response.CopyStatusDescription = x_ms_copy_status_description__iterator->second;
-          }
-          auto x_ms_incremental_copy__iterator
-              = httpResponse.GetHeaders().find("x-ms-incremental-copy");
-          if (x_ms_incremental_copy__iterator != httpResponse.GetHeaders().end())
-          {
-            response.IsIncrementalCopy = x_ms_incremental_copy__iterator->second == "true";
-          }
-          auto x_ms_copy_destination_snapshot__iterator
-              = httpResponse.GetHeaders().find("x-ms-copy-destination-snapshot");
-          if (x_ms_copy_destination_snapshot__iterator != httpResponse.GetHeaders().end())
-          {
-            response.IncrementalCopyDestinationSnapshot
-                = x_ms_copy_destination_snapshot__iterator->second;
-          }
-          auto x_ms_copy_progress__iterator = httpResponse.GetHeaders().find("x-ms-copy-progress");
-          if (x_ms_copy_progress__iterator != httpResponse.GetHeaders().end())
-          {
-            response.CopyProgress = x_ms_copy_progress__iterator->second;
-          }
-          auto x_ms_copy_completion_time__iterator
-              = httpResponse.GetHeaders().find("x-ms-copy-completion-time");
-          if (x_ms_copy_completion_time__iterator != httpResponse.GetHeaders().end())
-          {
-            response.CopyCompletedOn = Azure::DateTime::Parse(
-                x_ms_copy_completion_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
-          }
-          auto x_ms_or_policy_id__iterator = httpResponse.GetHeaders().find("x-ms-or-policy-id");
-          if (x_ms_or_policy_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.ObjectReplicationDestinationPolicyId = x_ms_or_policy_id__iterator->second;
-          }
-          {
-            std::map<std::string, std::vector<ObjectReplicationRule>> orPropertiesMap;
-            for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-or-");
-                 i != httpResponse.GetHeaders().end() && i->first.substr(0, 8) == "x-ms-or-";
-                 ++i)
-            {
-              const std::string& header = i->first;
-              auto underscorePos = header.find('_', 8);
-              if (underscorePos == std::string::npos)
-              {
-                continue;
-              }
-              std::string policyId
-                  = std::string(header.begin() + 8, header.begin() + underscorePos);
-              std::string ruleId = header.substr(underscorePos + 1);
-
-              ObjectReplicationRule rule;
-              rule.RuleId = std::move(ruleId);
-              rule.ReplicationStatus = ObjectReplicationStatus(i->second);
-              orPropertiesMap[policyId].emplace_back(std::move(rule));
-            }
-            for (auto& property : orPropertiesMap)
-            {
-              ObjectReplicationPolicy policy;
-              policy.PolicyId = property.first;
-              policy.Rules = std::move(property.second);
-              response.ObjectReplicationSourceProperties.emplace_back(std::move(policy));
-            }
-          }
-          auto x_ms_tag_count__iterator = httpResponse.GetHeaders().find("x-ms-tag-count");
-          if (x_ms_tag_count__iterator != httpResponse.GetHeaders().end())
-          {
-            response.TagCount = std::stoi(x_ms_tag_count__iterator->second);
-          }
-          auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
-          if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.VersionId = x_ms_version_id__iterator->second;
-          }
-          auto x_ms_is_current_version__iterator
-              = httpResponse.GetHeaders().find("x-ms-is-current-version");
-          if (x_ms_is_current_version__iterator != httpResponse.GetHeaders().end())
-          {
-            response.IsCurrentVersion = x_ms_is_current_version__iterator->second == "true";
-          }
-          return Azure::Response<BlobProperties>(std::move(response), std::move(pHttpResponse));
-        }
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const GetBlobPropertiesOptions& options,
+            const Azure::Core::Context& context);
 
         struct SetBlobHttpHeadersOptions final
         {
@@ -7449,95 +3728,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const SetBlobHttpHeadersOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("comp", "properties");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (!options.HttpHeaders.ContentType.empty())
-          {
-            request.SetHeader("x-ms-blob-content-type", options.HttpHeaders.ContentType);
-          }
-          if (!options.HttpHeaders.ContentEncoding.empty())
-          {
-            request.SetHeader("x-ms-blob-content-encoding", options.HttpHeaders.ContentEncoding);
-          }
-          if (!options.HttpHeaders.ContentLanguage.empty())
-          {
-            request.SetHeader("x-ms-blob-content-language", options.HttpHeaders.ContentLanguage);
-          }
-          if (!options.HttpHeaders.CacheControl.empty())
-          {
-            request.SetHeader("x-ms-blob-cache-control", options.HttpHeaders.CacheControl);
-          }
-          if (!Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value).empty())
-          {
-            request.SetHeader(
-                "x-ms-blob-content-md5",
-                Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value));
-          }
-          if (!options.HttpHeaders.ContentDisposition.empty())
-          {
-            request.SetHeader(
-                "x-ms-blob-content-disposition", options.HttpHeaders.ContentDisposition);
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          SetBlobHttpHeadersResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          auto x_ms_blob_sequence_number__iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-sequence-number");
-          if (x_ms_blob_sequence_number__iterator != httpResponse.GetHeaders().end())
-          {
-            response.SequenceNumber = std::stoll(x_ms_blob_sequence_number__iterator->second);
-          }
-          return Azure::Response<SetBlobHttpHeadersResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct SetBlobMetadataOptions final
         {
@@ -7559,106 +3750,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const SetBlobMetadataOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("comp", "metadata");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          for (const auto& pair : options.Metadata)
-          {
-            request.SetHeader("x-ms-meta-" + pair.first, pair.second);
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          SetBlobMetadataResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          auto x_ms_blob_sequence_number__iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-sequence-number");
-          if (x_ms_blob_sequence_number__iterator != httpResponse.GetHeaders().end())
-          {
-            response.SequenceNumber = std::stoll(x_ms_blob_sequence_number__iterator->second);
-          }
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          return Azure::Response<SetBlobMetadataResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct SetBlobAccessTierOptions final
         {
@@ -7671,63 +3763,17 @@ namespace Azure { namespace Storage { namespace Blobs {
 
         static Azure::Core::Http::Request SetAccessTierCreateMessage(
             const Azure::Core::Url& url,
-            const SetBlobAccessTierOptions& options)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("comp", "tier");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.SetHeader("x-ms-access-tier", options.AccessTier.ToString());
-          if (options.RehydratePriority.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-rehydrate-priority", options.RehydratePriority.Value().ToString());
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          return request;
-        }
+            const SetBlobAccessTierOptions& options);
 
         static Azure::Response<SetBlobAccessTierResult> SetAccessTierCreateResponse(
             std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
-            const Azure::Core::Context& context)
-        {
-          (void)context;
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          SetBlobAccessTierResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200 || http_status_code == 202))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          return Azure::Response<SetBlobAccessTierResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         static Azure::Response<SetBlobAccessTierResult> SetAccessTier(
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const SetBlobAccessTierOptions& options,
-            const Azure::Core::Context& context)
-        {
-          auto request = SetAccessTierCreateMessage(url, options);
-          auto pHttpResponse = pipeline.Send(request, context);
-          return SetAccessTierCreateResponse(std::move(pHttpResponse), context);
-        }
+            const Azure::Core::Context& context);
 
         struct StartBlobCopyFromUriOptions final
         {
@@ -7756,131 +3802,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const StartBlobCopyFromUriOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          for (const auto& pair : options.Metadata)
-          {
-            request.SetHeader("x-ms-meta-" + pair.first, pair.second);
-          }
-          if (!options.Tags.empty())
-          {
-            std::string blobTagsValue;
-            for (const auto& tag : options.Tags)
-            {
-              if (!blobTagsValue.empty())
-              {
-                blobTagsValue += "&";
-              }
-              blobTagsValue += _internal::UrlEncodeQueryParameter(tag.first) + "="
-                  + _internal::UrlEncodeQueryParameter(tag.second);
-            }
-            request.SetHeader("x-ms-tags", std::move(blobTagsValue));
-          }
-          request.SetHeader("x-ms-copy-source", options.SourceUri);
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.AccessTier.HasValue())
-          {
-            request.SetHeader("x-ms-access-tier", options.AccessTier.Value().ToString());
-          }
-          if (options.RehydratePriority.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-rehydrate-priority", options.RehydratePriority.Value().ToString());
-          }
-          if (options.ShouldSealDestination.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-seal-blob", options.ShouldSealDestination.Value() ? "true" : "false");
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          if (options.SourceIfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-source-if-modified-since",
-                options.SourceIfModifiedSince.Value().ToString(
-                    Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.SourceIfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-source-if-unmodified-since",
-                options.SourceIfUnmodifiedSince.Value().ToString(
-                    Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.SourceIfMatch.HasValue() && !options.SourceIfMatch.ToString().empty())
-          {
-            request.SetHeader("x-ms-source-if-match", options.SourceIfMatch.ToString());
-          }
-          if (options.SourceIfNoneMatch.HasValue() && !options.SourceIfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("x-ms-source-if-none-match", options.SourceIfNoneMatch.ToString());
-          }
-          if (options.SourceIfTags.HasValue())
-          {
-            request.SetHeader("x-ms-source-if-tags", options.SourceIfTags.Value());
-          }
-          if (options.SourceLeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-source-lease-id", options.SourceLeaseId.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::StartBlobCopyFromUriResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 202))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.CopyId = httpResponse.GetHeaders().at("x-ms-copy-id");
-          response.CopyStatus = CopyStatus(httpResponse.GetHeaders().at("x-ms-copy-status"));
-          auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
-          if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.VersionId = x_ms_version_id__iterator->second;
-          }
-          return Azure::Response<Models::_detail::StartBlobCopyFromUriResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct AbortBlobCopyFromUriOptions final
         {
@@ -7893,38 +3815,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const AbortBlobCopyFromUriOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "copy");
-          request.GetUrl().AppendQueryParameter(
-              "copyid", _internal::UrlEncodeQueryParameter(options.CopyId));
-          request.SetHeader("x-ms-copy-action", "abort");
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          AbortBlobCopyFromUriResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 204))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          return Azure::Response<AbortBlobCopyFromUriResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct CreateBlobSnapshotOptions final
         {
@@ -7946,106 +3837,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const CreateBlobSnapshotOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("comp", "snapshot");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          for (const auto& pair : options.Metadata)
-          {
-            request.SetHeader("x-ms-meta-" + pair.first, pair.second);
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          CreateBlobSnapshotResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          response.Snapshot = httpResponse.GetHeaders().at("x-ms-snapshot");
-          auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
-          if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.VersionId = x_ms_version_id__iterator->second;
-          }
-          return Azure::Response<CreateBlobSnapshotResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct GetBlobTagsOptions final
         {
@@ -8057,40 +3849,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const GetBlobTagsOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "tags");
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::GetBlobTagsResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& httpResponseBody = httpResponse.GetBody();
-            _internal::XmlReader reader(
-                reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = GetBlobTagsResultInternalFromXml(reader);
-          }
-          return Azure::Response<Models::_detail::GetBlobTagsResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct SetBlobTagsOptions final
         {
@@ -8103,45 +3862,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const SetBlobTagsOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          std::string xml_body;
-          {
-            _internal::XmlWriter writer;
-            SetBlobTagsOptionsToXml(writer, options);
-            xml_body = writer.GetDocument();
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
-          }
-          Azure::Core::IO::MemoryBodyStream xml_body_stream(
-              reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
-          auto request = Azure::Core::Http::Request(
-              Azure::Core::Http::HttpMethod::Put, url, &xml_body_stream);
-          request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "tags");
-          request.SetHeader("Content-Type", "application/xml; charset=UTF-8");
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          SetBlobTagsResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 204))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          return Azure::Response<SetBlobTagsResult>(std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct AcquireBlobLeaseOptions final
         {
@@ -8159,65 +3880,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const AcquireBlobLeaseOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "lease");
-          request.SetHeader("x-ms-lease-action", "acquire");
-          request.SetHeader("x-ms-lease-duration", std::to_string(options.LeaseDuration.count()));
-          if (options.ProposedLeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-proposed-lease-id", options.ProposedLeaseId.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::AcquireBlobLeaseResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.LeaseId = httpResponse.GetHeaders().at("x-ms-lease-id");
-          return Azure::Response<Models::_detail::AcquireBlobLeaseResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct RenewBlobLeaseOptions final
         {
@@ -8234,61 +3897,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const RenewBlobLeaseOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "lease");
-          request.SetHeader("x-ms-lease-action", "renew");
-          request.SetHeader("x-ms-lease-id", options.LeaseId);
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::RenewBlobLeaseResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.LeaseId = httpResponse.GetHeaders().at("x-ms-lease-id");
-          return Azure::Response<Models::_detail::RenewBlobLeaseResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct ChangeBlobLeaseOptions final
         {
@@ -8306,132 +3915,24 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const ChangeBlobLeaseOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "lease");
-          request.SetHeader("x-ms-lease-action", "change");
-          request.SetHeader("x-ms-lease-id", options.LeaseId);
-          request.SetHeader("x-ms-proposed-lease-id", options.ProposedLeaseId);
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::ChangeBlobLeaseResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.LeaseId = httpResponse.GetHeaders().at("x-ms-lease-id");
-          return Azure::Response<Models::_detail::ChangeBlobLeaseResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct ReleaseBlobLeaseOptions final
         {
           Azure::Nullable<int32_t> Timeout;
           std::string LeaseId;
-          Azure::Nullable<Azure::DateTime> IfModifiedSince;
-          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
-          Azure::ETag IfMatch;
-          Azure::ETag IfNoneMatch;
-          Azure::Nullable<std::string> IfTags;
-        }; // struct ReleaseBlobLeaseOptions
-
-        static Azure::Response<Models::_detail::ReleaseBlobLeaseResult> ReleaseLease(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const ReleaseBlobLeaseOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "lease");
-          request.SetHeader("x-ms-lease-action", "release");
-          request.SetHeader("x-ms-lease-id", options.LeaseId);
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::ReleaseBlobLeaseResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          return Azure::Response<Models::_detail::ReleaseBlobLeaseResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
+          Azure::ETag IfMatch;
+          Azure::ETag IfNoneMatch;
+          Azure::Nullable<std::string> IfTags;
+        }; // struct ReleaseBlobLeaseOptions
+
+        static Azure::Response<Models::_detail::ReleaseBlobLeaseResult> ReleaseLease(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const ReleaseBlobLeaseOptions& options,
+            const Azure::Core::Context& context);
 
         struct BreakBlobLeaseOptions final
         {
@@ -8448,194 +3949,25 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const BreakBlobLeaseOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.GetUrl().AppendQueryParameter("comp", "lease");
-          request.SetHeader("x-ms-lease-action", "break");
-          if (options.BreakPeriod.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-lease-break-period", std::to_string(options.BreakPeriod.Value().count()));
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::BreakBlobLeaseResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 202))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.LeaseTime = std::stoi(httpResponse.GetHeaders().at("x-ms-lease-time"));
-          return Azure::Response<Models::_detail::BreakBlobLeaseResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
       private:
+        static void QueryBlobOptionsToXml(
+            _internal::XmlWriter& writer,
+            const QueryBlobOptions& options);
+
+        static void QueryTextConfigurationToXml(
+            _internal::XmlWriter& writer,
+            const Models::_detail::QueryTextConfiguration& options);
+
         static Models::_detail::GetBlobTagsResult GetBlobTagsResultInternalFromXml(
-            _internal::XmlReader& reader)
-        {
-          Models::_detail::GetBlobTagsResult ret;
-          enum class XmlTagName
-          {
-            k_Tags,
-            k_TagSet,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "Tags")
-              {
-                path.emplace_back(XmlTagName::k_Tags);
-              }
-              else if (node.Name == "TagSet")
-              {
-                path.emplace_back(XmlTagName::k_TagSet);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 2 && path[0] == XmlTagName::k_Tags
-                  && path[1] == XmlTagName::k_TagSet)
-              {
-                ret.Tags = TagsFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-            }
-          }
-          return ret;
-        }
+            _internal::XmlReader& reader);
 
-        static std::map<std::string, std::string> TagsFromXml(_internal::XmlReader& reader)
-        {
-          std::map<std::string, std::string> ret;
-          int depth = 0;
-          std::string key;
-          bool is_key = false;
-          bool is_value = false;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              ++depth;
-              if (node.Name == "Key")
-              {
-                is_key = true;
-              }
-              else if (node.Name == "Value")
-              {
-                is_value = true;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (depth-- == 0)
-              {
-                break;
-              }
-            }
-            if (depth == 2 && node.Type == _internal::XmlNodeType::Text)
-            {
-              if (is_key)
-              {
-                key = node.Value;
-                is_key = false;
-              }
-              else if (is_value)
-              {
-                ret.emplace(std::move(key), node.Value);
-                is_value = false;
-              }
-            }
-          }
-          return ret;
-        }
+        static std::map<std::string, std::string> TagsFromXml(_internal::XmlReader& reader);
 
         static void SetBlobTagsOptionsToXml(
             _internal::XmlWriter& writer,
-            const SetBlobTagsOptions& options)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Tags"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "TagSet"});
-          for (const auto& i : options.Tags)
-          {
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Tag"});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Key"});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::Text, std::string(), i.first});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Value"});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::Text, std::string(), i.second});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          }
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+            const SetBlobTagsOptions& options);
 
       }; // class Blob
 
@@ -8661,192 +3993,21 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Nullable<std::string> IfTags;
         }; // struct UploadBlockBlobOptions
 
+        static Azure::Core::Http::Request UploadCreateMessage(
+            const Azure::Core::Url& url,
+            Azure::Core::IO::BodyStream& requestBody,
+            const UploadBlockBlobOptions& options);
+
+        static Azure::Response<UploadBlockBlobResult> UploadCreateResponse(
+            std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
+            const Azure::Core::Context& context);
+
         static Azure::Response<UploadBlockBlobResult> Upload(
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             Azure::Core::IO::BodyStream& requestBody,
             const UploadBlockBlobOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request
-              = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url, &requestBody);
-          request.SetHeader("Content-Length", std::to_string(requestBody.Length()));
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.TransactionalContentHash.HasValue())
-          {
-            if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
-            {
-              request.SetHeader(
-                  "Content-MD5",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-            else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
-            {
-              request.SetHeader(
-                  "x-ms-content-crc64",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-          }
-          if (!options.HttpHeaders.ContentType.empty())
-          {
-            request.SetHeader("x-ms-blob-content-type", options.HttpHeaders.ContentType);
-          }
-          if (!options.HttpHeaders.ContentEncoding.empty())
-          {
-            request.SetHeader("x-ms-blob-content-encoding", options.HttpHeaders.ContentEncoding);
-          }
-          if (!options.HttpHeaders.ContentLanguage.empty())
-          {
-            request.SetHeader("x-ms-blob-content-language", options.HttpHeaders.ContentLanguage);
-          }
-          if (!options.HttpHeaders.CacheControl.empty())
-          {
-            request.SetHeader("x-ms-blob-cache-control", options.HttpHeaders.CacheControl);
-          }
-          if (!Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value).empty())
-          {
-            request.SetHeader(
-                "x-ms-blob-content-md5",
-                Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value));
-          }
-          if (!options.HttpHeaders.ContentDisposition.empty())
-          {
-            request.SetHeader(
-                "x-ms-blob-content-disposition", options.HttpHeaders.ContentDisposition);
-          }
-          for (const auto& pair : options.Metadata)
-          {
-            request.SetHeader("x-ms-meta-" + pair.first, pair.second);
-          }
-          if (!options.Tags.empty())
-          {
-            std::string blobTagsValue;
-            for (const auto& tag : options.Tags)
-            {
-              if (!blobTagsValue.empty())
-              {
-                blobTagsValue += "&";
-              }
-              blobTagsValue += _internal::UrlEncodeQueryParameter(tag.first) + "="
-                  + _internal::UrlEncodeQueryParameter(tag.second);
-            }
-            request.SetHeader("x-ms-tags", std::move(blobTagsValue));
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          request.SetHeader("x-ms-blob-type", "BlockBlob");
-          if (options.AccessTier.HasValue())
-          {
-            request.SetHeader("x-ms-access-tier", options.AccessTier.Value().ToString());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          UploadBlockBlobResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          {
-            const auto& headers = httpResponse.GetHeaders();
-            auto content_md5_iterator = headers.find("content-md5");
-            if (content_md5_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Md5;
-              hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-            auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
-            if (x_ms_content_crc64_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Crc64;
-              hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-          }
-          auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
-          if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.VersionId = x_ms_version_id__iterator->second;
-          }
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          return Azure::Response<UploadBlockBlobResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct StageBlockOptions final
         {
@@ -8860,276 +4021,53 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Nullable<std::string> EncryptionScope;
         }; // struct StageBlockOptions
 
-        static Azure::Response<StageBlockResult> StageBlock(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+        static Azure::Core::Http::Request StageBlockCreateMessage(
             const Azure::Core::Url& url,
             Azure::Core::IO::BodyStream& requestBody,
-            const StageBlockOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request
-              = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url, &requestBody);
-          request.SetHeader("Content-Length", std::to_string(requestBody.Length()));
-          request.GetUrl().AppendQueryParameter("comp", "block");
-          request.GetUrl().AppendQueryParameter(
-              "blockid", _internal::UrlEncodeQueryParameter(options.BlockId));
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.TransactionalContentHash.HasValue())
-          {
-            if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
-            {
-              request.SetHeader(
-                  "Content-MD5",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-            else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
-            {
-              request.SetHeader(
-                  "x-ms-content-crc64",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          StageBlockResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& headers = httpResponse.GetHeaders();
-            auto content_md5_iterator = headers.find("content-md5");
-            if (content_md5_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Md5;
-              hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-            auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
-            if (x_ms_content_crc64_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Crc64;
-              hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-          }
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          return Azure::Response<StageBlockResult>(std::move(response), std::move(pHttpResponse));
-        }
+            const StageBlockOptions& options);
 
-        struct StageBlockFromUriOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          std::string BlockId;
-          std::string SourceUri;
-          Azure::Nullable<Azure::Core::Http::HttpRange> SourceRange;
-          Azure::Nullable<ContentHash> TransactionalContentHash;
-          Azure::Nullable<std::string> LeaseId;
-          Azure::Nullable<std::string> EncryptionKey;
-          Azure::Nullable<std::vector<uint8_t>> EncryptionKeySha256;
-          Azure::Nullable<EncryptionAlgorithmType> EncryptionAlgorithm;
-          Azure::Nullable<std::string> EncryptionScope;
-          Azure::Nullable<Azure::DateTime> SourceIfModifiedSince;
-          Azure::Nullable<Azure::DateTime> SourceIfUnmodifiedSince;
-          Azure::ETag SourceIfMatch;
-          Azure::ETag SourceIfNoneMatch;
-        }; // struct StageBlockFromUriOptions
+        static Azure::Response<StageBlockResult> StageBlockCreateResponse(
+            std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
+            const Azure::Core::Context& context);
 
-        static Azure::Response<StageBlockFromUriResult> StageBlockFromUri(
+        static Azure::Response<StageBlockResult> StageBlock(
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
-            const StageBlockFromUriOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("comp", "block");
-          request.GetUrl().AppendQueryParameter(
-              "blockid", _internal::UrlEncodeQueryParameter(options.BlockId));
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.SetHeader("x-ms-copy-source", options.SourceUri);
-          if (options.SourceRange.HasValue())
-          {
-            std::string headerValue
-                = "bytes=" + std::to_string(options.SourceRange.Value().Offset) + "-";
-            if (options.SourceRange.Value().Length.HasValue())
-            {
-              headerValue += std::to_string(
-                  options.SourceRange.Value().Offset + options.SourceRange.Value().Length.Value()
-                  - 1);
-            }
-            request.SetHeader("x-ms-source_range", std::move(headerValue));
-          }
-          if (options.TransactionalContentHash.HasValue())
-          {
-            if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
-            {
-              request.SetHeader(
-                  "x-ms-source-content-md5",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-            else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
-            {
-              request.SetHeader(
-                  "x-ms-source-content-crc64",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.SourceIfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-source-if-modified-since",
-                options.SourceIfModifiedSince.Value().ToString(
-                    Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.SourceIfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-source-if-unmodified-since",
-                options.SourceIfUnmodifiedSince.Value().ToString(
-                    Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.SourceIfMatch.HasValue() && !options.SourceIfMatch.ToString().empty())
-          {
-            request.SetHeader("x-ms-source-if-match", options.SourceIfMatch.ToString());
-          }
-          if (options.SourceIfNoneMatch.HasValue() && !options.SourceIfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("x-ms-source-if-none-match", options.SourceIfNoneMatch.ToString());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          StageBlockFromUriResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& headers = httpResponse.GetHeaders();
-            auto content_md5_iterator = headers.find("content-md5");
-            if (content_md5_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Md5;
-              hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-            auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
-            if (x_ms_content_crc64_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Crc64;
-              hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-          }
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          return Azure::Response<StageBlockFromUriResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            Azure::Core::IO::BodyStream& requestBody,
+            const StageBlockOptions& options,
+            const Azure::Core::Context& context);
+
+        struct StageBlockFromUriOptions final
+        {
+          Azure::Nullable<int32_t> Timeout;
+          std::string BlockId;
+          std::string SourceUri;
+          Azure::Nullable<Azure::Core::Http::HttpRange> SourceRange;
+          Azure::Nullable<ContentHash> TransactionalContentHash;
+          Azure::Nullable<std::string> LeaseId;
+          Azure::Nullable<std::string> EncryptionKey;
+          Azure::Nullable<std::vector<uint8_t>> EncryptionKeySha256;
+          Azure::Nullable<EncryptionAlgorithmType> EncryptionAlgorithm;
+          Azure::Nullable<std::string> EncryptionScope;
+          Azure::Nullable<Azure::DateTime> SourceIfModifiedSince;
+          Azure::Nullable<Azure::DateTime> SourceIfUnmodifiedSince;
+          Azure::ETag SourceIfMatch;
+          Azure::ETag SourceIfNoneMatch;
+        }; // struct StageBlockFromUriOptions
+
+        static Azure::Response<StageBlockFromUriResult> StageBlockFromUri(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const StageBlockFromUriOptions& options,
+            const Azure::Core::Context& context);
 
         struct CommitBlockListOptions final
         {
           Azure::Nullable<int32_t> Timeout;
           std::vector<std::pair<BlockType, std::string>> BlockList;
+          // Latest blocks with the IDs of FormatNumberedBlockId from 0 to NumberedBlockCount - 1,
+          // after BlockList.
+          int64_t NumberedBlockCount = 0;
           BlobHttpHeaders HttpHeaders;
           Storage::Metadata Metadata;
           std::map<std::string, std::string> Tags;
@@ -9146,365 +4084,182 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Nullable<Models::AccessTier> AccessTier;
         }; // struct CommitBlockListOptions
 
-        static Azure::Response<CommitBlockListResult> CommitBlockList(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const CommitBlockListOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          std::string xml_body;
-          {
-            _internal::XmlWriter writer;
-            CommitBlockListOptionsToXml(writer, options);
-            xml_body = writer.GetDocument();
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
-          }
-          Azure::Core::IO::MemoryBodyStream xml_body_stream(
-              reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
-          auto request = Azure::Core::Http::Request(
-              Azure::Core::Http::HttpMethod::Put, url, &xml_body_stream);
-          request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
-          request.GetUrl().AppendQueryParameter("comp", "blocklist");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (!options.HttpHeaders.ContentType.empty())
-          {
-            request.SetHeader("x-ms-blob-content-type", options.HttpHeaders.ContentType);
-          }
-          if (!options.HttpHeaders.ContentEncoding.empty())
-          {
-            request.SetHeader("x-ms-blob-content-encoding", options.HttpHeaders.ContentEncoding);
-          }
-          if (!options.HttpHeaders.ContentLanguage.empty())
-          {
-            request.SetHeader("x-ms-blob-content-language", options.HttpHeaders.ContentLanguage);
-          }
-          if (!options.HttpHeaders.CacheControl.empty())
-          {
-            request.SetHeader("x-ms-blob-cache-control", options.HttpHeaders.CacheControl);
-          }
-          if (!Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value).empty())
-          {
-            request.SetHeader(
-                "x-ms-blob-content-md5",
-                Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value));
-          }
-          if (!options.HttpHeaders.ContentDisposition.empty())
-          {
-            request.SetHeader(
-                "x-ms-blob-content-disposition", options.HttpHeaders.ContentDisposition);
-          }
-          for (const auto& pair : options.Metadata)
-          {
-            request.SetHeader("x-ms-meta-" + pair.first, pair.second);
-          }
-          if (!options.Tags.empty())
+        static constexpr size_t NumberedBlockIdLength = 88;
+
+        /**
+         * Writes the ID of block number id, the Base64 of id in 64 decimal digits, into the
+         * NumberedBlockIdLength characters of blockId.
+         */
+        static void FormatNumberedBlockId(int64_t id, char* blockId);
+
+        /**
+         * Generates the XML body of a CommitBlockList request while it's read, one block at a
+         * time, so the block list isn't serialized in memory before it's sent.
+         */
+        class BlockListBodyStream final : public Azure::Core::IO::BodyStream {
+        public:
+          explicit BlockListBodyStream(const CommitBlockListOptions& options) : m_options(options)
           {
-            std::string blobTagsValue;
-            for (const auto& tag : options.Tags)
+            m_length = static_cast<int64_t>(std::strlen(Header) + std::strlen(Footer));
+            for (const auto& block : m_options.BlockList)
             {
-              if (!blobTagsValue.empty())
-              {
-                blobTagsValue += "&";
-              }
-              blobTagsValue += _internal::UrlEncodeQueryParameter(tag.first) + "="
-                  + _internal::UrlEncodeQueryParameter(tag.second);
+              m_length += static_cast<int64_t>(
+                  block.first.ToString().length() * 2 + 5 + EscapedLength(block.second));
             }
-            request.SetHeader("x-ms-tags", std::move(blobTagsValue));
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.AccessTier.HasValue())
-          {
-            request.SetHeader("x-ms-access-tier", options.AccessTier.Value().ToString());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          CommitBlockListResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
-          if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.VersionId = x_ms_version_id__iterator->second;
-          }
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+            m_length += m_options.NumberedBlockCount
+                * static_cast<int64_t>(
+                            BlockType::Latest.ToString().length() * 2 + 5 + NumberedBlockIdLength);
+            Rewind();
           }
-          return Azure::Response<CommitBlockListResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
 
-        struct GetBlockListOptions final
-        {
-          Azure::Nullable<int32_t> Timeout;
-          BlockListType ListType = BlockListType::Committed;
-          Azure::Nullable<std::string> LeaseId;
-          Azure::Nullable<std::string> IfTags;
-        }; // struct GetBlockListOptions
+          int64_t Length() const override { return m_length; }
 
-        static Azure::Response<GetBlockListResult> GetBlockList(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const GetBlockListOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter("comp", "blocklist");
-          request.GetUrl().AppendQueryParameter(
-              "blocklisttype", _internal::UrlEncodeQueryParameter(options.ListType.ToString()));
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          GetBlockListResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
+          void Rewind() override
           {
-            const auto& httpResponseBody = httpResponse.GetBody();
-            _internal::XmlReader reader(
-                reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = GetBlockListResultFromXml(reader);
+            m_nextEntry = 0;
+            m_entry = Header;
+            m_entryOffset = 0;
           }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.BlobSize = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-content-length"));
-          return Azure::Response<GetBlockListResult>(std::move(response), std::move(pHttpResponse));
-        }
 
-      private:
-        static GetBlockListResult GetBlockListResultFromXml(_internal::XmlReader& reader)
-        {
-          GetBlockListResult ret;
-          enum class XmlTagName
-          {
-            k_BlockList,
-            k_CommittedBlocks,
-            k_Block,
-            k_UncommittedBlocks,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
+        private:
+          static constexpr const char* Header = "<?xml version=\"1.0\"?>\n<BlockList>";
+          static constexpr const char* Footer = "</BlockList>";
+
+          static size_t EscapedLength(const std::string& value)
           {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
+            size_t length = value.length();
+            for (const char c : value)
             {
-              break;
+              length += c == '&' ? 4 : (c == '<' || c == '>' ? 3 : 0);
             }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
+            return length;
+          }
+
+          void AppendElement(const std::string& name, const char* value, size_t valueLength)
+          {
+            m_entry += '<';
+            m_entry += name;
+            m_entry += '>';
+            for (size_t i = 0; i < valueLength; ++i)
             {
-              if (node.Name == "BlockList")
-              {
-                path.emplace_back(XmlTagName::k_BlockList);
-              }
-              else if (node.Name == "CommittedBlocks")
+              const char c = value[i];
+              if (c == '&')
               {
-                path.emplace_back(XmlTagName::k_CommittedBlocks);
+                m_entry += "&amp;";
               }
-              else if (node.Name == "Block")
+              else if (c == '<')
               {
-                path.emplace_back(XmlTagName::k_Block);
+                m_entry += "&lt;";
               }
-              else if (node.Name == "UncommittedBlocks")
+              else if (c == '>')
               {
-                path.emplace_back(XmlTagName::k_UncommittedBlocks);
+                m_entry += "&gt;";
               }
               else
               {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 3 && path[0] == XmlTagName::k_BlockList
-                  && path[1] == XmlTagName::k_CommittedBlocks && path[2] == XmlTagName::k_Block)
-              {
-                ret.CommittedBlocks.emplace_back(BlobBlockFromXml(reader));
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 3 && path[0] == XmlTagName::k_BlockList
-                  && path[1] == XmlTagName::k_UncommittedBlocks && path[2] == XmlTagName::k_Block)
-              {
-                ret.UncommittedBlocks.emplace_back(BlobBlockFromXml(reader));
-                path.pop_back();
+                m_entry += c;
               }
             }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-            }
+            m_entry += "</";
+            m_entry += name;
+            m_entry += '>';
           }
-          return ret;
-        }
 
-        static BlobBlock BlobBlockFromXml(_internal::XmlReader& reader)
-        {
-          BlobBlock ret;
-          enum class XmlTagName
-          {
-            k_Name,
-            k_Size,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
+          // Formats the entry after the current one, reusing the buffer of the entry.
+          bool FormatNextEntry()
           {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
+            const int64_t numBlocks = static_cast<int64_t>(m_options.BlockList.size());
+            const int64_t entry = m_nextEntry++;
+            m_entry.clear();
+            m_entryOffset = 0;
+            if (entry < numBlocks)
             {
-              break;
+              const auto& block = m_options.BlockList[static_cast<size_t>(entry)];
+              AppendElement(block.first.ToString(), block.second.data(), block.second.length());
             }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
+            else if (entry < numBlocks + m_options.NumberedBlockCount)
             {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
+              char blockId[NumberedBlockIdLength];
+              FormatNumberedBlockId(entry - numBlocks, blockId);
+              AppendElement(BlockType::Latest.ToString(), blockId, NumberedBlockIdLength);
             }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
+            else if (entry == numBlocks + m_options.NumberedBlockCount)
             {
-              if (node.Name == "Name")
-              {
-                path.emplace_back(XmlTagName::k_Name);
-              }
-              else if (node.Name == "Size")
-              {
-                path.emplace_back(XmlTagName::k_Size);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              m_entry = Footer;
             }
-            else if (node.Type == _internal::XmlNodeType::Text)
+            else
             {
-              if (path.size() == 1 && path[0] == XmlTagName::k_Name)
-              {
-                ret.Name = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::k_Size)
+              return false;
+            }
+            return true;
+          }
+
+          size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context)
+              override
+          {
+            (void)context;
+            size_t bytesRead = 0;
+            while (bytesRead < count)
+            {
+              if (m_entryOffset == m_entry.length() && !FormatNextEntry())
               {
-                ret.Size = std::stoll(node.Value);
+                break;
               }
+              const size_t length = std::min(count - bytesRead, m_entry.length() - m_entryOffset);
+              std::memcpy(buffer + bytesRead, m_entry.data() + m_entryOffset, length);
+              m_entryOffset += length;
+              bytesRead += length;
             }
+            return bytesRead;
           }
-          return ret;
-        }
 
-        static void CommitBlockListOptionsToXml(
-            _internal::XmlWriter& writer,
-            const CommitBlockListOptions& options)
+          const CommitBlockListOptions& m_options;
+          int64_t m_length = 0;
+          int64_t m_nextEntry = 0;
+          std::string m_entry;
+          size_t m_entryOffset = 0;
+        };
+
+        static Azure::Response<CommitBlockListResult> CommitBlockList(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const CommitBlockListOptions& options,
+            const Azure::Core::Context& context);
+
+        struct GetBlockListOptions final
         {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "BlockList"});
-          for (const auto& i : options.BlockList)
-          {
-            writer.Write(
-                _internal::XmlNode{_internal::XmlNodeType::StartTag, i.first.ToString(), i.second});
-          }
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+          Azure::Nullable<int32_t> Timeout;
+          BlockListType ListType = BlockListType::Committed;
+          Azure::Nullable<std::string> LeaseId;
+          Azure::Nullable<std::string> IfTags;
+        }; // struct GetBlockListOptions
+
+        static Azure::Response<GetBlockListResult> GetBlockList(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const GetBlockListOptions& options,
+            const Azure::Core::Context& context);
+
+        /**
+         * Sends a GetBlockList request whose response body is deserialized while it is received.
+         * The blocks are passed to blocksFunc in batches of CompactBlobBlocks, whose names are
+         * valid until blocksFunc returns.
+         */
+        static Azure::Response<GetBlockListStreamingResult> GetBlockListStreaming(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const GetBlockListOptions& options,
+            const std::function<void(const CompactBlobBlock* blocks, size_t count)>& blocksFunc,
+            const Azure::Core::Context& context);
+
+      private:
+        static GetBlockListResult GetBlockListResultFromXml(_internal::XmlReader& reader);
+
+        static void CompactBlobBlocksFromXml(
+            _internal::XmlReader& reader,
+            const std::function<void(const CompactBlobBlock* blocks, size_t count)>& blocksFunc);
+
+        static BlobBlock BlobBlockFromXml(_internal::XmlReader& reader);
 
       }; // class BlockBlob
 
@@ -9521,170 +4276,21 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Nullable<Models::AccessTier> AccessTier;
           Azure::Nullable<std::string> EncryptionKey;
           Azure::Nullable<std::vector<uint8_t>> EncryptionKeySha256;
-          Azure::Nullable<EncryptionAlgorithmType> EncryptionAlgorithm;
-          Azure::Nullable<std::string> EncryptionScope;
-          Azure::Nullable<Azure::DateTime> IfModifiedSince;
-          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
-          Azure::ETag IfMatch;
-          Azure::ETag IfNoneMatch;
-          Azure::Nullable<std::string> IfTags;
-          std::map<std::string, std::string> Tags;
-        }; // struct CreatePageBlobOptions
-
-        static Azure::Response<CreatePageBlobResult> Create(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const CreatePageBlobOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (!options.HttpHeaders.ContentType.empty())
-          {
-            request.SetHeader("x-ms-blob-content-type", options.HttpHeaders.ContentType);
-          }
-          if (!options.HttpHeaders.ContentEncoding.empty())
-          {
-            request.SetHeader("x-ms-blob-content-encoding", options.HttpHeaders.ContentEncoding);
-          }
-          if (!options.HttpHeaders.ContentLanguage.empty())
-          {
-            request.SetHeader("x-ms-blob-content-language", options.HttpHeaders.ContentLanguage);
-          }
-          if (!options.HttpHeaders.CacheControl.empty())
-          {
-            request.SetHeader("x-ms-blob-cache-control", options.HttpHeaders.CacheControl);
-          }
-          if (!Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value).empty())
-          {
-            request.SetHeader(
-                "x-ms-blob-content-md5",
-                Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value));
-          }
-          if (!options.HttpHeaders.ContentDisposition.empty())
-          {
-            request.SetHeader(
-                "x-ms-blob-content-disposition", options.HttpHeaders.ContentDisposition);
-          }
-          for (const auto& pair : options.Metadata)
-          {
-            request.SetHeader("x-ms-meta-" + pair.first, pair.second);
-          }
-          if (!options.Tags.empty())
-          {
-            std::string blobTagsValue;
-            for (const auto& tag : options.Tags)
-            {
-              if (!blobTagsValue.empty())
-              {
-                blobTagsValue += "&";
-              }
-              blobTagsValue += _internal::UrlEncodeQueryParameter(tag.first) + "="
-                  + _internal::UrlEncodeQueryParameter(tag.second);
-            }
-            request.SetHeader("x-ms-tags", std::move(blobTagsValue));
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          request.SetHeader("x-ms-blob-type", "PageBlob");
-          request.SetHeader("x-ms-blob-content-length", std::to_string(options.BlobSize));
-          if (options.SequenceNumber.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-blob-sequence-number", std::to_string(options.SequenceNumber.Value()));
-          }
-          if (options.AccessTier.HasValue())
-          {
-            request.SetHeader("x-ms-access-tier", options.AccessTier.Value().ToString());
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          CreatePageBlobResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
-          if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.VersionId = x_ms_version_id__iterator->second;
-          }
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          return Azure::Response<CreatePageBlobResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+          Azure::Nullable<EncryptionAlgorithmType> EncryptionAlgorithm;
+          Azure::Nullable<std::string> EncryptionScope;
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
+          Azure::ETag IfMatch;
+          Azure::ETag IfNoneMatch;
+          Azure::Nullable<std::string> IfTags;
+          std::map<std::string, std::string> Tags;
+        }; // struct CreatePageBlobOptions
+
+        static Azure::Response<CreatePageBlobResult> Create(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const CreatePageBlobOptions& options,
+            const Azure::Core::Context& context);
 
         struct UploadPageBlobPagesOptions final
         {
@@ -9711,162 +4317,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             const Azure::Core::Url& url,
             Azure::Core::IO::BodyStream& requestBody,
             const UploadPageBlobPagesOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request
-              = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url, &requestBody);
-          request.SetHeader("Content-Length", std::to_string(requestBody.Length()));
-          request.GetUrl().AppendQueryParameter("comp", "page");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          {
-            std::string headerValue = "bytes=" + std::to_string(options.Range.Offset) + "-";
-            if (options.Range.Length.HasValue())
-            {
-              headerValue
-                  += std::to_string(options.Range.Offset + options.Range.Length.Value() - 1);
-            }
-            request.SetHeader("x-ms-range", std::move(headerValue));
-          }
-          if (options.TransactionalContentHash.HasValue())
-          {
-            if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
-            {
-              request.SetHeader(
-                  "Content-MD5",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-            else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
-            {
-              request.SetHeader(
-                  "x-ms-content-crc64",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-          }
-          request.SetHeader("x-ms-page-write", "update");
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfSequenceNumberLessThanOrEqualTo.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-le",
-                std::to_string(options.IfSequenceNumberLessThanOrEqualTo.Value()));
-          }
-          if (options.IfSequenceNumberLessThan.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-lt",
-                std::to_string(options.IfSequenceNumberLessThan.Value()));
-          }
-          if (options.IfSequenceNumberEqualTo.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-eq",
-                std::to_string(options.IfSequenceNumberEqualTo.Value()));
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          UploadPagesResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          {
-            const auto& headers = httpResponse.GetHeaders();
-            auto content_md5_iterator = headers.find("content-md5");
-            if (content_md5_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Md5;
-              hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-            auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
-            if (x_ms_content_crc64_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Crc64;
-              hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-          }
-          response.SequenceNumber
-              = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-sequence-number"));
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          return Azure::Response<UploadPagesResult>(std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct UploadPageBlobPagesFromUriOptions final
         {
@@ -9898,194 +4349,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const UploadPageBlobPagesFromUriOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("comp", "page");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          {
-            std::string headerValue = "bytes=" + std::to_string(options.Range.Offset) + "-";
-            if (options.Range.Length.HasValue())
-            {
-              headerValue
-                  += std::to_string(options.Range.Offset + options.Range.Length.Value() - 1);
-            }
-            request.SetHeader("x-ms-range", std::move(headerValue));
-          }
-          request.SetHeader("x-ms-copy-source", options.SourceUri);
-          {
-            std::string headerValue = "bytes=" + std::to_string(options.SourceRange.Offset) + "-";
-            if (options.SourceRange.Length.HasValue())
-            {
-              headerValue += std::to_string(
-                  options.SourceRange.Offset + options.SourceRange.Length.Value() - 1);
-            }
-            request.SetHeader("x-ms-source-range", std::move(headerValue));
-          }
-          if (options.TransactionalContentHash.HasValue())
-          {
-            if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
-            {
-              request.SetHeader(
-                  "x-ms-source-content-md5",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-            else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
-            {
-              request.SetHeader(
-                  "x-ms-source-content-crc64",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-          }
-          request.SetHeader("x-ms-page-write", "update");
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfSequenceNumberLessThanOrEqualTo.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-le",
-                std::to_string(options.IfSequenceNumberLessThanOrEqualTo.Value()));
-          }
-          if (options.IfSequenceNumberLessThan.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-lt",
-                std::to_string(options.IfSequenceNumberLessThan.Value()));
-          }
-          if (options.IfSequenceNumberEqualTo.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-eq",
-                std::to_string(options.IfSequenceNumberEqualTo.Value()));
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          if (options.SourceIfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-source-if-modified-since",
-                options.SourceIfModifiedSince.Value().ToString(
-                    Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.SourceIfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-source-if-unmodified-since",
-                options.SourceIfUnmodifiedSince.Value().ToString(
-                    Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.SourceIfMatch.HasValue() && !options.SourceIfMatch.ToString().empty())
-          {
-            request.SetHeader("x-ms-source-if-match", options.SourceIfMatch.ToString());
-          }
-          if (options.SourceIfNoneMatch.HasValue() && !options.SourceIfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("x-ms-source-if-none-match", options.SourceIfNoneMatch.ToString());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          UploadPagesFromUriResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          {
-            const auto& headers = httpResponse.GetHeaders();
-            auto content_md5_iterator = headers.find("content-md5");
-            if (content_md5_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Md5;
-              hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-            auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
-            if (x_ms_content_crc64_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Crc64;
-              hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-          }
-          response.SequenceNumber
-              = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-sequence-number"));
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          return Azure::Response<UploadPagesFromUriResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct ClearPageBlobPagesOptions final
         {
@@ -10110,110 +4374,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const ClearPageBlobPagesOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("comp", "page");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          {
-            std::string headerValue = "bytes=" + std::to_string(options.Range.Offset) + "-";
-            if (options.Range.Length.HasValue())
-            {
-              headerValue
-                  += std::to_string(options.Range.Offset + options.Range.Length.Value() - 1);
-            }
-            request.SetHeader("x-ms-range", std::move(headerValue));
-          }
-          request.SetHeader("x-ms-page-write", "clear");
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfSequenceNumberLessThanOrEqualTo.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-le",
-                std::to_string(options.IfSequenceNumberLessThanOrEqualTo.Value()));
-          }
-          if (options.IfSequenceNumberLessThan.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-lt",
-                std::to_string(options.IfSequenceNumberLessThan.Value()));
-          }
-          if (options.IfSequenceNumberEqualTo.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-eq",
-                std::to_string(options.IfSequenceNumberEqualTo.Value()));
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          ClearPagesResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.SequenceNumber
-              = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-sequence-number"));
-          return Azure::Response<ClearPagesResult>(std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct ResizePageBlobOptions final
         {
@@ -10238,102 +4399,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const ResizePageBlobOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("comp", "properties");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.SetHeader("x-ms-blob-content-length", std::to_string(options.BlobSize));
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfSequenceNumberLessThanOrEqualTo.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-le",
-                std::to_string(options.IfSequenceNumberLessThanOrEqualTo.Value()));
-          }
-          if (options.IfSequenceNumberLessThan.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-lt",
-                std::to_string(options.IfSequenceNumberLessThan.Value()));
-          }
-          if (options.IfSequenceNumberEqualTo.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-if-sequence-number-eq",
-                std::to_string(options.IfSequenceNumberEqualTo.Value()));
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          ResizePageBlobResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.SequenceNumber
-              = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-sequence-number"));
-          return Azure::Response<ResizePageBlobResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct GetPageBlobPageRangesOptions final
         {
@@ -10353,337 +4419,48 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const GetPageBlobPageRangesOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter("comp", "pagelist");
-          if (options.PreviousSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "prevsnapshot",
-                _internal::UrlEncodeQueryParameter(options.PreviousSnapshot.Value()));
-          }
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.Range.HasValue())
-          {
-            std::string headerValue = "bytes=" + std::to_string(options.Range.Value().Offset) + "-";
-            if (options.Range.Value().Length.HasValue())
-            {
-              headerValue += std::to_string(
-                  options.Range.Value().Offset + options.Range.Value().Length.Value() - 1);
-            }
-            request.SetHeader("x-ms-range", std::move(headerValue));
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.PreviousSnapshotUrl.HasValue())
-          {
-            request.SetHeader("x-ms-previous-snapshot-url", options.PreviousSnapshotUrl.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::GetPageRangesResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          {
-            const auto& httpResponseBody = httpResponse.GetBody();
-            _internal::XmlReader reader(
-                reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = GetPageRangesResultInternalFromXml(reader);
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.BlobSize = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-content-length"));
-          return Azure::Response<Models::_detail::GetPageRangesResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
+
+        /**
+         * Sends a GetPageRanges request whose response body is deserialized while it is received.
+         * The page ranges are passed to rangesFunc in batches of CompactPageRanges.
+         */
+        static Azure::Response<GetPageRangesStreamingResult> GetPageRangesStreaming(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const GetPageBlobPageRangesOptions& options,
+            const std::function<void(const CompactPageRange* ranges, size_t count)>& rangesFunc,
+            const Azure::Core::Context& context);
 
         struct StartBlobCopyIncrementalOptions final
         {
           Azure::Nullable<int32_t> Timeout;
           std::string CopySource;
-          Azure::Nullable<Azure::DateTime> IfModifiedSince;
-          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
-          Azure::ETag IfMatch;
-          Azure::ETag IfNoneMatch;
-          Azure::Nullable<std::string> IfTags;
-        }; // struct StartBlobCopyIncrementalOptions
-
-        static Azure::Response<Models::_detail::StartBlobCopyIncrementalResult>
-        StartCopyIncremental(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const StartBlobCopyIncrementalOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("comp", "incrementalcopy");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.SetHeader("x-ms-copy-source", options.CopySource);
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::StartBlobCopyIncrementalResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 202))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          response.CopyId = httpResponse.GetHeaders().at("x-ms-copy-id");
-          response.CopyStatus = CopyStatus(httpResponse.GetHeaders().at("x-ms-copy-status"));
-          auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
-          if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.VersionId = x_ms_version_id__iterator->second;
-          }
-          return Azure::Response<Models::_detail::StartBlobCopyIncrementalResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+          Azure::Nullable<Azure::DateTime> IfModifiedSince;
+          Azure::Nullable<Azure::DateTime> IfUnmodifiedSince;
+          Azure::ETag IfMatch;
+          Azure::ETag IfNoneMatch;
+          Azure::Nullable<std::string> IfTags;
+        }; // struct StartBlobCopyIncrementalOptions
+
+        static Azure::Response<Models::_detail::StartBlobCopyIncrementalResult>
+        StartCopyIncremental(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const StartBlobCopyIncrementalOptions& options,
+            const Azure::Core::Context& context);
 
       private:
         static Models::_detail::GetPageRangesResult GetPageRangesResultInternalFromXml(
-            _internal::XmlReader& reader)
-        {
-          Models::_detail::GetPageRangesResult ret;
-          enum class XmlTagName
-          {
-            k_PageList,
-            k_PageRange,
-            k_ClearRange,
-            k_Unknown,
-          };
-          std::vector<XmlTagName> path;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (node.Name == "PageList")
-              {
-                path.emplace_back(XmlTagName::k_PageList);
-              }
-              else if (node.Name == "PageRange")
-              {
-                path.emplace_back(XmlTagName::k_PageRange);
-              }
-              else if (node.Name == "ClearRange")
-              {
-                path.emplace_back(XmlTagName::k_ClearRange);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
-              if (path.size() == 2 && path[0] == XmlTagName::k_PageList
-                  && path[1] == XmlTagName::k_PageRange)
-              {
-                ret.PageRanges.emplace_back(PageRangesFromXml(reader));
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::k_PageList
-                  && path[1] == XmlTagName::k_ClearRange)
-              {
-                ret.ClearRanges.emplace_back(ClearRangesFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-            }
-          }
-          return ret;
-        }
+            _internal::XmlReader& reader);
 
-        static Azure::Core::Http::HttpRange ClearRangesFromXml(_internal::XmlReader& reader)
-        {
-          int depth = 0;
-          bool is_start = false;
-          bool is_end = false;
-          int64_t start = 0;
-          int64_t end = 0;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag && node.Name == "Start")
-            {
-              ++depth;
-              is_start = true;
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag && node.Name == "End")
-            {
-              ++depth;
-              is_end = true;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              is_start = false;
-              is_end = false;
-              if (depth-- == 0)
-              {
-                break;
-              }
-            }
-            if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
-            {
-              if (is_start)
-              {
-                start = std::stoll(node.Value);
-              }
-              else if (is_end)
-              {
-                end = std::stoll(node.Value);
-              }
-            }
-          }
-          Azure::Core::Http::HttpRange ret;
-          ret.Offset = start;
-          ret.Length = end - start + 1;
-          return ret;
-        }
+        static Azure::Core::Http::HttpRange ClearRangesFromXml(_internal::XmlReader& reader);
 
-        static Azure::Core::Http::HttpRange PageRangesFromXml(_internal::XmlReader& reader)
-        {
-          int depth = 0;
-          bool is_start = false;
-          bool is_end = false;
-          int64_t start = 0;
-          int64_t end = 0;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag && node.Name == "Start")
-            {
-              ++depth;
-              is_start = true;
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag && node.Name == "End")
-            {
-              ++depth;
-              is_end = true;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              is_start = false;
-              is_end = false;
-              if (depth-- == 0)
-              {
-                break;
-              }
-            }
-            if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
-            {
-              if (is_start)
-              {
-                start = std::stoll(node.Value);
-              }
-              else if (is_end)
-              {
-                end = std::stoll(node.Value);
-              }
-            }
-          }
-          Azure::Core::Http::HttpRange ret;
-          ret.Offset = start;
-          ret.Length = end - start + 1;
-          return ret;
-        }
+        static Azure::Core::Http::HttpRange PageRangesFromXml(_internal::XmlReader& reader);
+
+        static void CompactPageRangesFromXml(
+            _internal::XmlReader& reader,
+            const std::function<void(const CompactPageRange* ranges, size_t count)>& rangesFunc);
 
       }; // class PageBlob
 
@@ -10711,146 +4488,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const CreateAppendBlobOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (!options.HttpHeaders.ContentType.empty())
-          {
-            request.SetHeader("x-ms-blob-content-type", options.HttpHeaders.ContentType);
-          }
-          if (!options.HttpHeaders.ContentEncoding.empty())
-          {
-            request.SetHeader("x-ms-blob-content-encoding", options.HttpHeaders.ContentEncoding);
-          }
-          if (!options.HttpHeaders.ContentLanguage.empty())
-          {
-            request.SetHeader("x-ms-blob-content-language", options.HttpHeaders.ContentLanguage);
-          }
-          if (!options.HttpHeaders.CacheControl.empty())
-          {
-            request.SetHeader("x-ms-blob-cache-control", options.HttpHeaders.CacheControl);
-          }
-          if (!Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value).empty())
-          {
-            request.SetHeader(
-                "x-ms-blob-content-md5",
-                Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value));
-          }
-          if (!options.HttpHeaders.ContentDisposition.empty())
-          {
-            request.SetHeader(
-                "x-ms-blob-content-disposition", options.HttpHeaders.ContentDisposition);
-          }
-          for (const auto& pair : options.Metadata)
-          {
-            request.SetHeader("x-ms-meta-" + pair.first, pair.second);
-          }
-          if (!options.Tags.empty())
-          {
-            std::string blobTagsValue;
-            for (const auto& tag : options.Tags)
-            {
-              if (!blobTagsValue.empty())
-              {
-                blobTagsValue += "&";
-              }
-              blobTagsValue += _internal::UrlEncodeQueryParameter(tag.first) + "="
-                  + _internal::UrlEncodeQueryParameter(tag.second);
-            }
-            request.SetHeader("x-ms-tags", std::move(blobTagsValue));
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          request.SetHeader("x-ms-blob-type", "AppendBlob");
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          CreateAppendBlobResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
-          if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
-          {
-            response.VersionId = x_ms_version_id__iterator->second;
-          }
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          return Azure::Response<CreateAppendBlobResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct AppendBlockOptions final
         {
@@ -10875,146 +4513,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             const Azure::Core::Url& url,
             Azure::Core::IO::BodyStream& requestBody,
             const AppendBlockOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request
-              = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url, &requestBody);
-          request.SetHeader("Content-Length", std::to_string(requestBody.Length()));
-          request.GetUrl().AppendQueryParameter("comp", "appendblock");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.TransactionalContentHash.HasValue())
-          {
-            if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
-            {
-              request.SetHeader(
-                  "Content-MD5",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-            else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
-            {
-              request.SetHeader(
-                  "x-ms-content-crc64",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.MaxSize.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-blob-condition-maxsize", std::to_string(options.MaxSize.Value()));
-          }
-          if (options.AppendPosition.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-blob-condition-appendpos", std::to_string(options.AppendPosition.Value()));
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          AppendBlockResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          {
-            const auto& headers = httpResponse.GetHeaders();
-            auto content_md5_iterator = headers.find("content-md5");
-            if (content_md5_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Md5;
-              hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-            auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
-            if (x_ms_content_crc64_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Crc64;
-              hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-          }
-          response.AppendOffset
-              = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-append-offset"));
-          response.CommittedBlockCount
-              = std::stoi(httpResponse.GetHeaders().at("x-ms-blob-committed-block-count"));
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          return Azure::Response<AppendBlockResult>(std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct AppendBlockFromUriOptions final
         {
@@ -11040,159 +4539,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const AppendBlockFromUriOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("comp", "appendblock");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.SetHeader("x-ms-copy-source", options.SourceUri);
-          if (options.SourceRange.HasValue())
-          {
-            std::string headerValue
-                = "bytes=" + std::to_string(options.SourceRange.Value().Offset) + "-";
-            if (options.SourceRange.Value().Length.HasValue())
-            {
-              headerValue += std::to_string(
-                  options.SourceRange.Value().Offset + options.SourceRange.Value().Length.Value()
-                  - 1);
-            }
-            request.SetHeader("x-ms-source-range", std::move(headerValue));
-          }
-          if (options.TransactionalContentHash.HasValue())
-          {
-            if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
-            {
-              request.SetHeader(
-                  "x-ms-source-content-md5",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-            else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
-            {
-              request.SetHeader(
-                  "x-ms-source-content-crc64",
-                  Azure::Core::Convert::Base64Encode(
-                      options.TransactionalContentHash.Value().Value));
-            }
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.MaxSize.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-blob-condition-maxsize", std::to_string(options.MaxSize.Value()));
-          }
-          if (options.AppendPosition.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-blob-condition-appendpos", std::to_string(options.AppendPosition.Value()));
-          }
-          if (options.EncryptionKey.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
-          }
-          if (options.EncryptionKeySha256.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-key-sha256",
-                Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
-          }
-          if (options.EncryptionAlgorithm.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
-          }
-          if (options.EncryptionScope.HasValue())
-          {
-            request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          AppendBlockFromUriResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 201))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          {
-            const auto& headers = httpResponse.GetHeaders();
-            auto content_md5_iterator = headers.find("content-md5");
-            if (content_md5_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Md5;
-              hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-            auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
-            if (x_ms_content_crc64_iterator != headers.end())
-            {
-              ContentHash hash;
-              hash.Algorithm = HashAlgorithm::Crc64;
-              hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
-              response.TransactionalContentHash = std::move(hash);
-            }
-          }
-          response.AppendOffset
-              = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-append-offset"));
-          response.CommittedBlockCount
-              = std::stoi(httpResponse.GetHeaders().at("x-ms-blob-committed-block-count"));
-          response.IsServerEncrypted
-              = httpResponse.GetHeaders().at("x-ms-request-server-encrypted") == "true";
-          auto x_ms_encryption_key_sha256__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256
-                = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
-          }
-          auto x_ms_encryption_scope__iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = x_ms_encryption_scope__iterator->second;
-          }
-          return Azure::Response<AppendBlockFromUriResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
         struct SealAppendBlobOptions final
         {
@@ -11210,67 +4557,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             const Azure::Core::Url& url,
             const SealAppendBlobOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader("Content-Length", "0");
-          request.GetUrl().AppendQueryParameter("comp", "seal");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          if (options.LeaseId.HasValue())
-          {
-            request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
-          }
-          if (options.IfModifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Modified-Since",
-                options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfUnmodifiedSince.HasValue())
-          {
-            request.SetHeader(
-                "If-Unmodified-Since",
-                options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
-          }
-          if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
-          {
-            request.SetHeader("If-Match", options.IfMatch.ToString());
-          }
-          if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
-          {
-            request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
-          }
-          if (options.IfTags.HasValue())
-          {
-            request.SetHeader("x-ms-if-tags", options.IfTags.Value());
-          }
-          if (options.AppendPosition.HasValue())
-          {
-            request.SetHeader(
-                "x-ms-blob-condition-appendpos", std::to_string(options.AppendPosition.Value()));
-          }
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          SealAppendBlobResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 200))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ETag = Azure::ETag(httpResponse.GetHeaders().at("etag"));
-          response.LastModified = Azure::DateTime::Parse(
-              httpResponse.GetHeaders().at("last-modified"), Azure::DateTime::DateFormat::Rfc1123);
-          return Azure::Response<SealAppendBlobResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
       private:
       }; // class AppendBlob
@@ -11288,34 +4575,7 @@ namespace Azure { namespace Storage { namespace Blobs {
             const Azure::Core::Url& url,
             Azure::Core::IO::BodyStream& requestBody,
             const SubmitBlobBatchOptions& options,
-            const Azure::Core::Context& context)
-        {
-          (void)options;
-          auto request
-              = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Post, url, &requestBody);
-          request.SetHeader("Content-Length", std::to_string(requestBody.Length()));
-          request.GetUrl().AppendQueryParameter("comp", "batch");
-          request.SetHeader("x-ms-version", "2020-02-10");
-          if (options.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                "timeout", std::to_string(options.Timeout.Value()));
-          }
-          request.SetHeader("Content-Type", options.ContentType);
-          auto pHttpResponse = pipeline.Send(request, context);
-          Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
-          Models::_detail::SubmitBlobBatchResult response;
-          auto http_status_code
-              = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
-                  httpResponse.GetStatusCode());
-          if (!(http_status_code == 202))
-          {
-            throw StorageException::CreateFromResponse(std::move(pHttpResponse));
-          }
-          response.ContentType = httpResponse.GetHeaders().at("content-type");
-          return Azure::Response<Models::_detail::SubmitBlobBatchResult>(
-              std::move(response), std::move(pHttpResponse));
-        }
+            const Azure::Core::Context& context);
 
       private:
       }; // class BlobBatch
@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <azure/core/credentials/credentials.hpp>
+
+#include "azure/storage/blobs/blob_container_client.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  /**
+   * @brief The ShardedBlobContainerClient spreads the blobs of one logical container across
+   * containers of several storage accounts, so that the ingress and the requests per second add up
+   * past the limits of a single account.
+   *
+   * @remark Each blob goes to the shard with the highest hash of the blob name and of the URL of
+   * the shard's container (rendezvous hashing). The shard of a blob doesn't depend on the order of
+   * the shards, and adding a shard only moves the blobs which go to the new one.
+   *
+   * @remark The clients of the shards created from URLs share the transport, the transfer
+   * scheduler, the buffer pool and the properties cache of the options. Those created with a token
+   * credential also share the access tokens, which are fetched once for all the accounts.
+   */
+  class ShardedBlobContainerClient final {
+  public:
+    /**
+     * @brief Initialize a new instance of ShardedBlobContainerClient.
+     *
+     * @param blobContainerUrls The urls of the containers of the shards, which include the name of
+     * their account and the name of the container.
+     * @param credential The token credential used to sign requests, for all the shards.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     */
+    explicit ShardedBlobContainerClient(
+        const std::vector<std::string>& blobContainerUrls,
+        std::shared_ptr<Core::Credentials::TokenCredential> credential,
+        const BlobClientOptions& options = BlobClientOptions());
+
+    /**
+     * @brief Initialize a new instance of ShardedBlobContainerClient.
+     *
+     * @param blobContainerUrls The urls of the containers of the shards, which include the name of
+     * their account and the name of the container, and possibly also a SAS token.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     */
+    explicit ShardedBlobContainerClient(
+        const std::vector<std::string>& blobContainerUrls,
+        const BlobClientOptions& options = BlobClientOptions());
+
+    /**
+     * @brief Initialize a new instance of ShardedBlobContainerClient.
+     *
+     * @param shards The clients of the containers of the shards, such as clients created with the
+     * shared key of each account.
+     */
+    explicit ShardedBlobContainerClient(std::vector<BlobContainerClient> shards);
+
+    /**
+     * @brief Gets the index of the shard of a blob.
+     *
+     * @param blobName The name of the blob.
+     * @return The index of the shard in #GetShards.
+     */
+    size_t GetShardIndex(const std::string& blobName) const;
+
+    /**
+     * @brief Gets the clients of the containers of the shards.
+     *
+     */
+    const std::vector<BlobContainerClient>& GetShards() const { return m_shards; }
+
+    /**
+     * @brief Create a new BlobClient object for a blob of the container of its shard.
+     *
+     * @param blobName The name of the blob.
+     * @return A new BlobClient instance.
+     */
+    BlobClient GetBlobClient(const std::string& blobName) const;
+
+    /**
+     * @brief Create a new BlockBlobClient object for a blob of the container of its shard.
+     *
+     * @param blobName The name of the blob.
+     * @return A new BlockBlobClient instance.
+     */
+    BlockBlobClient GetBlockBlobClient(const std::string& blobName) const;
+
+    /**
+     * @brief Create a new AppendBlobClient object for a blob of the container of its shard.
+     *
+     * @param blobName The name of the blob.
+     * @return A new AppendBlobClient instance.
+     */
+    AppendBlobClient GetAppendBlobClient(const std::string& blobName) const;
+
+    /**
+     * @brief Create a new PageBlobClient object for a blob of the container of its shard.
+     *
+     * @param blobName The name of the blob.
+     * @return A new PageBlobClient instance.
+     */
+    PageBlobClient GetPageBlobClient(const std::string& blobName) const;
+
+    /**
+     * @brief Returns a collection of the blobs of all the shards. Each page lists a page of each
+     * shard which has blobs left, and the shards are listed concurrently.
+     *
+     * @remark Blobs are ordered lexicographically by name within the blobs of a shard only. The
+     * continuation tokens are only valid with the same shards, in the same order.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A ShardedListBlobsPagedResponse describing the blobs of the shards.
+     */
+    ShardedListBlobsPagedResponse ListBlobs(
+        const ListBlobsOptions& options = ListBlobsOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+  private:
+    std::vector<BlobContainerClient> m_shards;
+    // The hash of the url of the container of each shard, which the hash of a blob name starts
+    // from.
+    std::vector<uint64_t> m_shardSeeds;
+  };
+
+}}} // namespace Azure::Storage::Blobs
@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <azure/core/context.hpp>
+#include <azure/core/nullable.hpp>
+
+#include "azure/storage/blobs/blob_options.hpp"
+#include "azure/storage/blobs/blob_sas_builder.hpp"
+#include "azure/storage/blobs/blob_service_client.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  /**
+   * @brief UserDelegationKeyCache keeps a user delegation key of a storage account, to generate
+   * user delegation SAS without getting a key from the service every time.
+   *
+   * @remark The first key is got by the first call needing it. Then a thread of the cache gets a
+   * new key `RefreshBeforeExpiry` before the current one expires, so the calls keep using the
+   * current key meanwhile. When no key is valid, a single call gets a new one at a time, and the
+   * other calls wait for it.
+   */
+  class UserDelegationKeyCache final {
+  public:
+    /**
+     * @brief Initializes a new instance of the UserDelegationKeyCache, which starts the thread
+     * refreshing the key.
+     *
+     * @param serviceClient A BlobServiceClient authenticated with a token credential, used to get
+     * the keys.
+     * @param accountName The name of the storage account.
+     * @param options Optional parameters of the cache.
+     */
+    explicit UserDelegationKeyCache(
+        BlobServiceClient serviceClient,
+        std::string accountName,
+        const UserDelegationKeyCacheOptions& options = UserDelegationKeyCacheOptions());
+
+    /**
+     * @brief Stops refreshing the key, see #Stop.
+     */
+    ~UserDelegationKeyCache();
+
+    UserDelegationKeyCache(const UserDelegationKeyCache&) = delete;
+    UserDelegationKeyCache& operator=(const UserDelegationKeyCache&) = delete;
+
+    /**
+     * @brief Gets a valid user delegation key, from the cache unless none is. Can be called from
+     * several threads at the same time.
+     *
+     * @param context Context for cancelling long running operations.
+     * @return The user delegation key.
+     */
+    Models::UserDelegationKey GetKey(const Azure::Core::Context& context = Azure::Core::Context());
+
+    /**
+     * @brief Signs a shared access signature with the cached user delegation key.
+     *
+     * @param sasBuilder The shared access signature to sign. It shouldn't be valid after the key
+     * expires, which is at least `RefreshBeforeExpiry` later.
+     * @param context Context for cancelling long running operations.
+     * @return The SAS query parameters used for authenticating requests.
+     */
+    std::string GenerateSasToken(
+        Sas::BlobSasBuilder sasBuilder,
+        const Azure::Core::Context& context = Azure::Core::Context());
+
+    /**
+     * @brief Stops refreshing the key, and waits for the refresh in progress.
+     */
+    void Stop();
+
+  private:
+    // Gets a new key, with m_fetching set by the caller.
+    Models::UserDelegationKey FetchKey(const Azure::Core::Context& context);
+    void RunRefresh();
+
+    BlobServiceClient m_serviceClient;
+    std::string m_accountName;
+    UserDelegationKeyCacheOptions m_options;
+    // Cancelled when the cache is stopped.
+    Azure::Core::Context m_refreshContext;
+
+    // Guards the variables below.
+    std::mutex m_mutex;
+    std::condition_variable m_stateChanged;
+    Azure::Nullable<Models::UserDelegationKey> m_key;
+    // The key is refreshed in the background from this time.
+    std::chrono::system_clock::time_point m_refreshTime;
+    // Whether a new key is being got.
+    bool m_fetching = false;
+    bool m_stopping = false;
+
+    std::thread m_refreshThread;
+  };
+
+}}} // namespace Azure::Storage::Blobs
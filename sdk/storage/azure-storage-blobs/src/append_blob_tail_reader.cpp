@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/blobs/append_blob_tail_reader.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include <azure/storage/common/storage_exception.hpp>
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  AppendBlobTailReader::AppendBlobTailReader(
+      AppendBlobClient appendBlobClient,
+      DataHandler onData,
+      ErrorHandler onError,
+      const AppendBlobTailReaderOptions& options)
+      : m_appendBlobClient(std::move(appendBlobClient)), m_onData(std::move(onData)),
+        m_onError(std::move(onError)), m_options(options), m_offset(options.Offset)
+  {
+    if (!m_onData)
+    {
+      throw std::invalid_argument("onData cannot be null.");
+    }
+    if (m_options.Offset < 0 || m_options.MaxReadSize <= 0)
+    {
+      throw std::invalid_argument("Offset cannot be negative and MaxReadSize must be positive.");
+    }
+    if (m_options.MinPollInterval.count() <= 0
+        || m_options.MaxPollInterval < m_options.MinPollInterval)
+    {
+      throw std::invalid_argument(
+          "MinPollInterval must be positive and MaxPollInterval must not be shorter.");
+    }
+    m_pollThread = std::thread([this]() { RunPolls(); });
+  }
+
+  AppendBlobTailReader::~AppendBlobTailReader() { Stop(); }
+
+  int64_t AppendBlobTailReader::GetOffset()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_offset;
+  }
+
+  void AppendBlobTailReader::Stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+      m_stateChanged.notify_all();
+    }
+    m_pollContext.Cancel();
+    if (m_pollThread.joinable())
+    {
+      m_pollThread.join();
+    }
+  }
+
+  bool AppendBlobTailReader::Poll()
+  {
+    // Only the poll thread updates the offset.
+    const int64_t offset = m_offset;
+    DownloadBlobOptions downloadOptions;
+    downloadOptions.Range = Core::Http::HttpRange();
+    downloadOptions.Range.Value().Offset = offset;
+    downloadOptions.Range.Value().Length = m_options.MaxReadSize;
+    downloadOptions.AccessConditions.LeaseId = m_options.AccessConditions.LeaseId;
+    if (!m_hasMore && m_readETag.HasValue())
+    {
+      downloadOptions.AccessConditions.IfNoneMatch = m_readETag;
+    }
+
+    Azure::Core::IO::SharedBuffer data;
+    int64_t blobSize = 0;
+    Azure::ETag eTag;
+    try
+    {
+      auto download = m_appendBlobClient.Download(downloadOptions, m_pollContext);
+      data = Azure::Core::IO::SharedBuffer(download.Value.BodyStream->ReadToEnd(m_pollContext));
+      blobSize = download.Value.BlobSize;
+      eTag = download.Value.Details.ETag;
+    }
+    catch (StorageException& e)
+    {
+      // The blob is unchanged, or has no bytes after the offset.
+      if (e.StatusCode == Azure::Core::Http::HttpStatusCode::NotModified
+          || e.StatusCode == Azure::Core::Http::HttpStatusCode::RangeNotSatisfiable)
+      {
+        m_hasMore = false;
+        return false;
+      }
+      throw;
+    }
+    if (data.GetSize() == 0)
+    {
+      m_hasMore = false;
+      return false;
+    }
+
+    const int64_t nextOffset = offset + static_cast<int64_t>(data.GetSize());
+    m_hasMore = nextOffset < blobSize;
+    m_readETag = m_hasMore ? Azure::ETag() : eTag;
+    // The bytes aren't passed again when the handler throws.
+    std::exception_ptr handlerError;
+    try
+    {
+      m_onData(offset, std::move(data));
+    }
+    catch (...)
+    {
+      handlerError = std::current_exception();
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_offset = nextOffset;
+    }
+    if (handlerError)
+    {
+      std::rethrow_exception(handlerError);
+    }
+    return true;
+  }
+
+  void AppendBlobTailReader::RunPolls()
+  {
+    std::chrono::milliseconds interval = m_options.MinPollInterval;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping)
+    {
+      lock.unlock();
+      bool hasData = false;
+      std::exception_ptr error;
+      try
+      {
+        hasData = Poll();
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+      if (error && m_onError && !m_pollContext.IsCancelled())
+      {
+        try
+        {
+          m_onError(error);
+        }
+        catch (...)
+        {
+        }
+      }
+      lock.lock();
+
+      if (error)
+      {
+        interval = m_options.MaxPollInterval;
+      }
+      else if (hasData)
+      {
+        interval = std::max(interval / 2, m_options.MinPollInterval);
+        if (m_hasMore)
+        {
+          continue;
+        }
+      }
+      else
+      {
+        interval = std::min(interval * 2, m_options.MaxPollInterval);
+      }
+      m_stateChanged.wait_for(lock, interval, [this]() { return m_stopping; });
+    }
+  }
+
+}}} // namespace Azure::Storage::Blobs
@@ -0,0 +1,229 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/blobs/append_blob_writer.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <azure/core/io/body_stream.hpp>
+#include <azure/storage/common/internal/thread_pool.hpp>
+#include <azure/storage/common/storage_exception.hpp>
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  AppendBlobWriter::AppendBlobWriter(
+      AppendBlobClient appendBlobClient,
+      const AppendBlobWriterOptions& options)
+      : m_appendBlobClient(std::move(appendBlobClient)), m_options(options),
+        m_nextOffset(options.Position), m_committedOffset(options.Position)
+  {
+    if (m_options.MaxBlockSize <= 0)
+    {
+      throw std::invalid_argument("MaxBlockSize must be positive.");
+    }
+  }
+
+  AppendBlobWriter::~AppendBlobWriter()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_blockFinished.wait(lock, [&]() { return m_pendingWrites.empty() && m_numAppending == 0; });
+  }
+
+  std::future<void> AppendBlobWriter::Write(const uint8_t* data, size_t size)
+  {
+    std::promise<void> committed;
+    auto future = committed.get_future();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_error)
+    {
+      committed.set_exception(m_error);
+      return future;
+    }
+    if (size == 0)
+    {
+      committed.set_value();
+      return future;
+    }
+    PendingWrite write;
+    write.Data.assign(data, data + size);
+    write.Committed = std::move(committed);
+    m_pendingWrites.push_back(std::move(write));
+    m_pendingSize += static_cast<int64_t>(size);
+    StartBlocks();
+    return future;
+  }
+
+  void AppendBlobWriter::Flush()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_blockFinished.wait(lock, [&]() { return m_pendingWrites.empty() && m_numAppending == 0; });
+    if (m_error)
+    {
+      std::rethrow_exception(m_error);
+    }
+  }
+
+  void AppendBlobWriter::StartBlocks()
+  {
+    while (!m_error && !m_pendingWrites.empty()
+           && m_numAppending < std::max(m_options.Concurrency, 1))
+    {
+      // Blocks are pipelined only when they're full and their offset is known.
+      if (m_numAppending != 0
+          && (!m_nextOffset.HasValue() || m_pendingSize < m_options.MaxBlockSize))
+      {
+        break;
+      }
+
+      auto block = std::make_shared<Block>();
+      const size_t blockSize
+          = static_cast<size_t>(std::min(m_pendingSize, m_options.MaxBlockSize));
+      block->Data.reserve(blockSize);
+      while (block->Data.size() < blockSize)
+      {
+        auto& write = m_pendingWrites.front();
+        const size_t copySize
+            = std::min(blockSize - block->Data.size(), write.Data.size() - write.Offset);
+        block->Data.insert(
+            block->Data.end(),
+            write.Data.begin() + write.Offset,
+            write.Data.begin() + write.Offset + copySize);
+        write.Offset += copySize;
+        if (write.Offset == write.Data.size())
+        {
+          block->Committed.push_back(std::move(write.Committed));
+          m_pendingWrites.pop_front();
+        }
+      }
+      m_pendingSize -= static_cast<int64_t>(blockSize);
+      block->Offset = m_nextOffset;
+      if (m_nextOffset.HasValue())
+      {
+        m_nextOffset = m_nextOffset.Value() + static_cast<int64_t>(blockSize);
+      }
+
+      ++m_numAppending;
+      _internal::ThreadPool::GetDefault().Submit([this, block]() { AppendBlock(block); });
+    }
+  }
+
+  void AppendBlobWriter::ResendBlocks()
+  {
+    for (auto ite = m_blocksToResend.begin(); ite != m_blocksToResend.end();)
+    {
+      auto block = *ite;
+      if (m_error)
+      {
+        for (auto& committed : block->Committed)
+        {
+          committed.set_exception(m_error);
+        }
+        --m_numAppending;
+      }
+      else if (block->Offset.Value() == m_committedOffset.Value())
+      {
+        _internal::ThreadPool::GetDefault().Submit([this, block]() { AppendBlock(block); });
+      }
+      else
+      {
+        ++ite;
+        continue;
+      }
+      ite = m_blocksToResend.erase(ite);
+    }
+  }
+
+  void AppendBlobWriter::AppendBlock(const std::shared_ptr<Block>& block)
+  {
+    const int64_t blockSize = static_cast<int64_t>(block->Data.size());
+    int64_t appendOffset = 0;
+    std::exception_ptr error;
+    while (true)
+    {
+      // Whether the blocks before this one were all committed when it's sent.
+      bool isNextBlock = true;
+      if (block->Offset.HasValue())
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        isNextBlock = m_committedOffset.Value() == block->Offset.Value();
+      }
+      try
+      {
+        Azure::Core::IO::MemoryBodyStream content(block->Data.data(), block->Data.size());
+        AppendBlockOptions appendOptions;
+        appendOptions.AccessConditions.LeaseId = m_options.AccessConditions.LeaseId;
+        appendOptions.AccessConditions.IfAppendPositionEqual = block->Offset;
+        appendOffset = m_appendBlobClient.AppendBlock(content, appendOptions).Value.AppendOffset;
+        break;
+      }
+      catch (StorageException& e)
+      {
+        // A block pipelined behind another one may reach the service first, it's sent again once
+        // the blocks before it are committed.
+        if (e.ErrorCode != "AppendPositionConditionNotMet" || isNextBlock)
+        {
+          error = std::current_exception();
+          break;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_error)
+        {
+          error = m_error;
+          break;
+        }
+        // Rather than waiting on a thread of the pool, the block is parked, still counted as
+        // appending, and the completion of the previous block submits it again.
+        if (m_committedOffset.Value() != block->Offset.Value())
+        {
+          m_blocksToResend.push_back(block);
+          return;
+        }
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+        break;
+      }
+    }
+
+    for (auto& committed : block->Committed)
+    {
+      if (error)
+      {
+        committed.set_exception(error);
+      }
+      else
+      {
+        committed.set_value();
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_numAppending;
+    if (!error)
+    {
+      if (!m_nextOffset.HasValue())
+      {
+        m_nextOffset = appendOffset + blockSize;
+      }
+      m_committedOffset = appendOffset + blockSize;
+    }
+    else if (!m_error)
+    {
+      m_error = error;
+      for (auto& write : m_pendingWrites)
+      {
+        write.Committed.set_exception(error);
+      }
+      m_pendingWrites.clear();
+      m_pendingSize = 0;
+    }
+    ResendBlocks();
+    StartBlocks();
+    // Notified under the lock, the writer may be destroyed as soon as it's released.
+    m_blockFinished.notify_all();
+  }
+
+}}} // namespace Azure::Storage::Blobs
@@ -0,0 +1,579 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "private/avro_parser.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <azure/core/internal/json/json.hpp>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace _detail {
+
+  namespace {
+    using Azure::Core::Json::_internal::json;
+
+    // The member of an object of the schema, which must be there.
+    const json& GetMember(const json& schemaJson, const char* name)
+    {
+      auto member = schemaJson.find(name);
+      if (member == schemaJson.end())
+      {
+        throw std::runtime_error("Invalid Avro schema, missing " + std::string(name) + ".");
+      }
+      return *member;
+    }
+
+    // The array member of an object of the schema, which must be there.
+    const json& GetArrayMember(const json& schemaJson, const char* name)
+    {
+      const auto& member = GetMember(schemaJson, name);
+      if (!member.is_array())
+      {
+        throw std::runtime_error("Invalid Avro schema, " + std::string(name) + " isn't an array.");
+      }
+      return member;
+    }
+
+    const AvroSchema* ParseSchema(
+        const json& schemaJson,
+        const std::string& enclosingNamespace,
+        std::vector<std::unique_ptr<AvroSchema>>& schemas,
+        std::map<std::string, const AvroSchema*>& namedSchemas)
+    {
+      auto newSchema = [&schemas](AvroDatumType type) {
+        schemas.push_back(std::make_unique<AvroSchema>());
+        schemas.back()->Type = type;
+        return schemas.back().get();
+      };
+
+      if (schemaJson.is_array())
+      {
+        auto schema = newSchema(AvroDatumType::Union);
+        for (const auto& branch : schemaJson)
+        {
+          schema->Children.push_back(
+              ParseSchema(branch, enclosingNamespace, schemas, namedSchemas));
+        }
+        return schema;
+      }
+
+      if (schemaJson.is_object() && !GetMember(schemaJson, "type").is_string())
+      {
+        return ParseSchema(
+            GetMember(schemaJson, "type"), enclosingNamespace, schemas, namedSchemas);
+      }
+      if (!schemaJson.is_object() && !schemaJson.is_string())
+      {
+        throw std::runtime_error("Invalid Avro schema.");
+      }
+
+      const std::string typeName = schemaJson.is_string()
+          ? schemaJson.get<std::string>()
+          : GetMember(schemaJson, "type").get<std::string>();
+      static const std::map<std::string, AvroDatumType> PrimitiveTypes = {
+          {"null", AvroDatumType::Null},
+          {"boolean", AvroDatumType::Bool},
+          {"int", AvroDatumType::Int},
+          {"long", AvroDatumType::Long},
+          {"float", AvroDatumType::Float},
+          {"double", AvroDatumType::Double},
+          {"bytes", AvroDatumType::Bytes},
+          {"string", AvroDatumType::String},
+      };
+      auto primitiveType = PrimitiveTypes.find(typeName);
+      if (primitiveType != PrimitiveTypes.end())
+      {
+        return newSchema(primitiveType->second);
+      }
+
+      if (schemaJson.is_string())
+      {
+        // A reference to a named type defined earlier.
+        for (const auto& name :
+             {enclosingNamespace.empty() ? typeName : enclosingNamespace + "." + typeName,
+              typeName})
+        {
+          auto namedSchema = namedSchemas.find(name);
+          if (namedSchema != namedSchemas.end())
+          {
+            return namedSchema->second;
+          }
+        }
+        throw std::runtime_error("Unknown Avro type " + typeName + ".");
+      }
+
+      if (typeName == "array")
+      {
+        auto schema = newSchema(AvroDatumType::Array);
+        schema->Children.push_back(
+            ParseSchema(GetMember(schemaJson, "items"), enclosingNamespace, schemas, namedSchemas));
+        return schema;
+      }
+      if (typeName == "map")
+      {
+        auto schema = newSchema(AvroDatumType::Map);
+        schema->Children.push_back(ParseSchema(
+            GetMember(schemaJson, "values"), enclosingNamespace, schemas, namedSchemas));
+        return schema;
+      }
+
+      AvroSchema* schema;
+      if (typeName == "record")
+      {
+        schema = newSchema(AvroDatumType::Record);
+      }
+      else if (typeName == "enum")
+      {
+        schema = newSchema(AvroDatumType::Enum);
+      }
+      else if (typeName == "fixed")
+      {
+        schema = newSchema(AvroDatumType::Fixed);
+      }
+      else
+      {
+        throw std::runtime_error("Unknown Avro type " + typeName + ".");
+      }
+
+      std::string fullName = GetMember(schemaJson, "name").get<std::string>();
+      if (fullName.find('.') == std::string::npos)
+      {
+        const std::string schemaNamespace = schemaJson.contains("namespace")
+            ? GetMember(schemaJson, "namespace").get<std::string>()
+            : enclosingNamespace;
+        if (!schemaNamespace.empty())
+        {
+          fullName = schemaNamespace + "." + fullName;
+        }
+      }
+      const size_t namespaceEnd = fullName.rfind('.');
+      const std::string schemaNamespace
+          = namespaceEnd == std::string::npos ? std::string() : fullName.substr(0, namespaceEnd);
+      schema->Name
+          = namespaceEnd == std::string::npos ? fullName : fullName.substr(namespaceEnd + 1);
+      // Registered before the fields are parsed, so that they can refer to it.
+      namedSchemas[fullName] = schema;
+
+      if (typeName == "record")
+      {
+        for (const auto& field : GetArrayMember(schemaJson, "fields"))
+        {
+          schema->Names.push_back(GetMember(field, "name").get<std::string>());
+          schema->Children.push_back(
+              ParseSchema(GetMember(field, "type"), schemaNamespace, schemas, namedSchemas));
+        }
+      }
+      else if (typeName == "enum")
+      {
+        for (const auto& symbol : GetArrayMember(schemaJson, "symbols"))
+        {
+          schema->Names.push_back(symbol.get<std::string>());
+        }
+      }
+      else
+      {
+        schema->Size = GetMember(schemaJson, "size").get<size_t>();
+      }
+      return schema;
+    }
+  } // namespace
+
+  const AvroDatum& AvroDatum::Field(const std::string& name) const
+  {
+    if (Schema != nullptr && Schema->Type == AvroDatumType::Record)
+    {
+      for (size_t i = 0; i < Schema->Names.size() && i < Items.size(); ++i)
+      {
+        if (Schema->Names[i] == name)
+        {
+          return Items[i];
+        }
+      }
+    }
+    throw std::runtime_error("Avro record has no field " + name + ".");
+  }
+
+  AvroObjectContainerReader::AvroObjectContainerReader(Azure::Core::IO::BodyStream& stream)
+      : m_stream(stream), m_buffer(64 * 1024)
+  {
+  }
+
+  bool AvroObjectContainerReader::AtEnd(const Azure::Core::Context& context)
+  {
+    if (m_bufferOffset == m_bufferLength)
+    {
+      m_bufferOffset = 0;
+      m_bufferLength = m_stream.Read(m_buffer.data(), m_buffer.size(), context);
+    }
+    return m_bufferLength == 0;
+  }
+
+  uint8_t AvroObjectContainerReader::ReadByte(const Azure::Core::Context& context)
+  {
+    if (AtEnd(context))
+    {
+      throw std::runtime_error("Unexpected end of Avro stream.");
+    }
+    return m_buffer[m_bufferOffset++];
+  }
+
+  void AvroObjectContainerReader::Read(
+      uint8_t* buffer,
+      size_t count,
+      const Azure::Core::Context& context)
+  {
+    while (count != 0)
+    {
+      if (AtEnd(context))
+      {
+        throw std::runtime_error("Unexpected end of Avro stream.");
+      }
+      const size_t length = std::min(count, m_bufferLength - m_bufferOffset);
+      std::memcpy(buffer, m_buffer.data() + m_bufferOffset, length);
+      m_bufferOffset += length;
+      buffer += length;
+      count -= length;
+    }
+  }
+
+  void AvroObjectContainerReader::ReadString(
+      std::string& value,
+      size_t count,
+      const Azure::Core::Context& context)
+  {
+    // Appended piece by piece, so that a corrupted length fails at the end of the stream instead
+    // of allocating it.
+    value.clear();
+    while (count != 0)
+    {
+      if (AtEnd(context))
+      {
+        throw std::runtime_error("Unexpected end of Avro stream.");
+      }
+      const size_t length = std::min(count, m_bufferLength - m_bufferOffset);
+      value.append(reinterpret_cast<const char*>(m_buffer.data() + m_bufferOffset), length);
+      m_bufferOffset += length;
+      count -= length;
+    }
+  }
+
+  int64_t AvroObjectContainerReader::ReadLong(const Azure::Core::Context& context)
+  {
+    // Zigzag-encoded variable-length integer.
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7)
+    {
+      if (shift >= 64)
+      {
+        throw std::runtime_error("Invalid Avro integer.");
+      }
+      const uint8_t byte = ReadByte(context);
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+      {
+        break;
+      }
+    }
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+
+  void AvroObjectContainerReader::ReadHeader(const Azure::Core::Context& context)
+  {
+    uint8_t magic[4];
+    Read(magic, sizeof(magic), context);
+    if (std::memcmp(magic, "Obj\x01", sizeof(magic)) != 0)
+    {
+      throw std::runtime_error("Invalid Avro object container file.");
+    }
+
+    std::string schemaJson;
+    std::string codec;
+    std::string key;
+    std::string value;
+    while (true)
+    {
+      int64_t count = ReadLong(context);
+      if (count == 0)
+      {
+        break;
+      }
+      if (count < 0)
+      {
+        count = -count;
+        ReadLong(context);
+      }
+      for (int64_t i = 0; i < count; ++i)
+      {
+        const int64_t keyLength = ReadLong(context);
+        if (keyLength < 0)
+        {
+          throw std::runtime_error("Invalid Avro object container file.");
+        }
+        ReadString(key, static_cast<size_t>(keyLength), context);
+        const int64_t valueLength = ReadLong(context);
+        if (valueLength < 0)
+        {
+          throw std::runtime_error("Invalid Avro object container file.");
+        }
+        ReadString(value, static_cast<size_t>(valueLength), context);
+        if (key == "avro.schema")
+        {
+          schemaJson = value;
+        }
+        else if (key == "avro.codec")
+        {
+          codec = value;
+        }
+      }
+    }
+    if (!codec.empty() && codec != "null")
+    {
+      throw std::runtime_error("Unsupported Avro codec " + codec + ".");
+    }
+    Read(m_syncMarker, sizeof(m_syncMarker), context);
+
+    try
+    {
+      m_schema = ParseSchema(json::parse(schemaJson), std::string(), m_schemas, m_namedSchemas);
+    }
+    catch (const json::exception&)
+    {
+      // Not JSON, or a member of the wrong type.
+      throw std::runtime_error("Invalid Avro schema.");
+    }
+  }
+
+  void AvroObjectContainerReader::ReadSyncMarker(const Azure::Core::Context& context)
+  {
+    uint8_t syncMarker[sizeof(m_syncMarker)];
+    Read(syncMarker, sizeof(syncMarker), context);
+    if (std::memcmp(syncMarker, m_syncMarker, sizeof(syncMarker)) != 0)
+    {
+      throw std::runtime_error("Invalid Avro sync marker.");
+    }
+  }
+
+  void AvroObjectContainerReader::Decode(
+      const AvroSchema& schema,
+      AvroDatum& datum,
+      const Azure::Core::Context& context)
+  {
+    datum.Schema = &schema;
+    switch (schema.Type)
+    {
+      case AvroDatumType::Null:
+        break;
+      case AvroDatumType::Bool:
+        datum.Bool = ReadByte(context) != 0;
+        break;
+      case AvroDatumType::Int:
+      case AvroDatumType::Long:
+        datum.Long = ReadLong(context);
+        break;
+      case AvroDatumType::Float: {
+        uint8_t bytes[4];
+        Read(bytes, sizeof(bytes), context);
+        uint32_t bits = 0;
+        for (size_t i = 0; i < sizeof(bytes); ++i)
+        {
+          bits |= static_cast<uint32_t>(bytes[i]) << (8 * i);
+        }
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        datum.Double = value;
+        break;
+      }
+      case AvroDatumType::Double: {
+        uint8_t bytes[8];
+        Read(bytes, sizeof(bytes), context);
+        uint64_t bits = 0;
+        for (size_t i = 0; i < sizeof(bytes); ++i)
+        {
+          bits |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+        }
+        std::memcpy(&datum.Double, &bits, sizeof(datum.Double));
+        break;
+      }
+      case AvroDatumType::Bytes:
+      case AvroDatumType::String: {
+        const int64_t length = ReadLong(context);
+        if (length < 0)
+        {
+          throw std::runtime_error("Invalid Avro string length.");
+        }
+        ReadString(datum.String, static_cast<size_t>(length), context);
+        break;
+      }
+      case AvroDatumType::Fixed:
+        ReadString(datum.String, schema.Size, context);
+        break;
+      case AvroDatumType::Enum: {
+        const int64_t index = ReadLong(context);
+        if (index < 0 || static_cast<uint64_t>(index) >= schema.Names.size())
+        {
+          throw std::runtime_error("Invalid Avro enum index.");
+        }
+        datum.Long = index;
+        datum.String = schema.Names[static_cast<size_t>(index)];
+        break;
+      }
+      case AvroDatumType::Record:
+        // Resized rather than cleared, so that decoding records of the same type reuses the
+        // memory of their fields.
+        datum.Items.resize(schema.Children.size());
+        for (size_t i = 0; i < schema.Children.size(); ++i)
+        {
+          Decode(*schema.Children[i], datum.Items[i], context);
+        }
+        break;
+      case AvroDatumType::Array:
+      case AvroDatumType::Map:
+        datum.Items.clear();
+        datum.Keys.clear();
+        while (true)
+        {
+          int64_t count = ReadLong(context);
+          if (count == 0)
+          {
+            break;
+          }
+          if (count < 0)
+          {
+            count = -count;
+            ReadLong(context);
+          }
+          for (int64_t i = 0; i < count; ++i)
+          {
+            if (schema.Type == AvroDatumType::Map)
+            {
+              const int64_t keyLength = ReadLong(context);
+              if (keyLength < 0)
+              {
+                throw std::runtime_error("Invalid Avro string length.");
+              }
+              datum.Keys.emplace_back();
+              ReadString(datum.Keys.back(), static_cast<size_t>(keyLength), context);
+            }
+            datum.Items.emplace_back();
+            Decode(*schema.Children[0], datum.Items.back(), context);
+          }
+        }
+        break;
+      case AvroDatumType::Union: {
+        const int64_t index = ReadLong(context);
+        if (index < 0 || static_cast<uint64_t>(index) >= schema.Children.size())
+        {
+          throw std::runtime_error("Invalid Avro union index.");
+        }
+        Decode(*schema.Children[static_cast<size_t>(index)], datum, context);
+        break;
+      }
+    }
+  }
+
+  bool AvroObjectContainerReader::Next(AvroDatum& datum, const Azure::Core::Context& context)
+  {
+    if (!m_headerRead)
+    {
+      ReadHeader(context);
+      m_headerRead = true;
+    }
+    while (m_remainingObjects == 0)
+    {
+      if (AtEnd(context))
+      {
+        return false;
+      }
+      m_remainingObjects = ReadLong(context);
+      if (m_remainingObjects < 0)
+      {
+        m_remainingObjects = -m_remainingObjects;
+      }
+      // The size of the block in bytes.
+      ReadLong(context);
+      if (m_remainingObjects == 0)
+      {
+        ReadSyncMarker(context);
+      }
+    }
+    Decode(*m_schema, datum, context);
+    if (--m_remainingObjects == 0)
+    {
+      ReadSyncMarker(context);
+    }
+    return true;
+  }
+
+  size_t BlobQueryBodyStream::OnRead(
+      uint8_t* buffer,
+      size_t count,
+      const Azure::Core::Context& context)
+  {
+    while (true)
+    {
+      if (m_record.Schema != nullptr && m_record.Schema->Name == "resultData")
+      {
+        const std::string& data = m_record.Field("data").String;
+        if (m_resultOffset < data.length())
+        {
+          const size_t length = std::min(count, data.length() - m_resultOffset);
+          std::memcpy(buffer, data.data() + m_resultOffset, length);
+          m_resultOffset += length;
+          return length;
+        }
+      }
+      if (m_ended)
+      {
+        return 0;
+      }
+
+      m_resultOffset = 0;
+      if (!m_reader.Next(m_record, context))
+      {
+        throw std::runtime_error("Unexpected end of blob query results.");
+      }
+      const std::string& recordName = m_record.Schema->Name;
+      if (recordName == "progress")
+      {
+        if (m_progressHandler)
+        {
+          m_progressHandler(
+              m_record.Field("bytesScanned").Long, m_record.Field("totalBytes").Long);
+        }
+      }
+      else if (recordName == "error")
+      {
+        Models::BlobQueryError error;
+        error.Name = m_record.Field("name").String;
+        error.Description = m_record.Field("description").String;
+        error.IsFatal = m_record.Field("fatal").Bool;
+        error.Position = m_record.Field("position").Long;
+        if (m_errorHandler)
+        {
+          m_errorHandler(std::move(error));
+        }
+        else if (error.IsFatal)
+        {
+          throw std::runtime_error(error.Name + ": " + error.Description);
+        }
+      }
+      else if (recordName == "end")
+      {
+        m_ended = true;
+        // Reads the rest of the response, so that its connection can be reused.
+        uint8_t rest[64];
+        while (m_inner->Read(rest, sizeof(rest), context) != 0)
+        {
+        }
+        if (m_progressHandler)
+        {
+          const int64_t totalBytes = m_record.Field("totalBytes").Long;
+          m_progressHandler(totalBytes, totalBytes);
+        }
+      }
+    }
+  }
+
+}}}} // namespace Azure::Storage::Blobs::_detail
@@ -0,0 +1,483 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/blobs/blob_batch_client.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+#include <azure/core/http/policies/policy.hpp>
+#include <azure/core/internal/strings.hpp>
+#include <azure/core/io/body_stream.hpp>
+#include <azure/core/uuid.hpp>
+#include <azure/storage/common/internal/constants.hpp>
+#include <azure/storage/common/internal/shared_key_policy.hpp>
+#include <azure/storage/common/internal/storage_per_retry_policy.hpp>
+#include <azure/storage/common/internal/storage_service_version_policy.hpp>
+#include <azure/storage/common/storage_common.hpp>
+#include <azure/storage/common/storage_exception.hpp>
+
+#include "private/package_version.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  namespace {
+    const char* LineEnding = "\r\n";
+
+    /**
+     * Ends the sub-request pipeline. The sub-requests are only signed, they are sent in the body of
+     * the batch request.
+     */
+    class NoopTransportPolicy final : public Azure::Core::Http::Policies::HttpPolicy {
+    public:
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<NoopTransportPolicy>(*this);
+      }
+
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Http::Request& request,
+          Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
+          const Azure::Core::Context& context) const override
+      {
+        (void)request;
+        (void)nextPolicy;
+        (void)context;
+        return std::make_unique<Azure::Core::Http::RawResponse>(
+            1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+      }
+    };
+
+    std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> CreateSubRequestPipeline(
+        std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy> authenticationPolicy)
+    {
+      std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+      policies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
+      if (authenticationPolicy)
+      {
+        policies.emplace_back(std::move(authenticationPolicy));
+      }
+      policies.emplace_back(std::make_unique<NoopTransportPolicy>());
+      return std::make_shared<Azure::Core::Http::_internal::HttpPipeline>(std::move(policies));
+    }
+
+    void AppendSubRequest(
+        std::string& body,
+        const std::string& boundary,
+        int32_t contentId,
+        const Azure::Core::Http::Request& request)
+    {
+      body += "--" + boundary + LineEnding;
+      body += std::string("Content-Type: application/http") + LineEnding;
+      body += std::string("Content-Transfer-Encoding: binary") + LineEnding;
+      body += "Content-ID: " + std::to_string(contentId) + LineEnding;
+      body += LineEnding;
+      body += request.GetMethod().ToString() + " /" + request.GetUrl().GetRelativeUrl()
+          + " HTTP/1.1" + LineEnding;
+      for (const auto& header : request.GetHeadersReference())
+      {
+        body += header.first + ": " + header.second + LineEnding;
+      }
+      body += LineEnding;
+    }
+
+    /**
+     * Reads the line starting at pos without its line ending, and moves pos to the next line.
+     */
+    std::string ReadLine(const std::string& text, size_t& pos)
+    {
+      size_t end = text.find('\n', pos);
+      if (end == std::string::npos)
+      {
+        end = text.length();
+      }
+      std::string line = text.substr(pos, end - pos);
+      if (!line.empty() && line.back() == '\r')
+      {
+        line.pop_back();
+      }
+      pos = std::min(end + 1, text.length());
+      return line;
+    }
+
+    struct SubResponse final
+    {
+      int32_t ContentId = -1;
+      std::unique_ptr<Azure::Core::Http::RawResponse> RawResponse;
+    };
+
+    SubResponse ParseSubResponse(const std::string& part)
+    {
+      const std::string parseError = "Failed to parse batch response.";
+
+      SubResponse subResponse;
+      size_t pos = 0;
+      // The rest of the boundary line.
+      ReadLine(part, pos);
+      for (std::string line = ReadLine(part, pos); !line.empty(); line = ReadLine(part, pos))
+      {
+        const std::string contentIdHeader = "Content-ID:";
+        if (Azure::Core::_internal::StringExtensions::LocaleInvariantCaseInsensitiveEqual(
+                line.substr(0, contentIdHeader.length()), contentIdHeader))
+        {
+          subResponse.ContentId = std::atoi(line.substr(contentIdHeader.length()).c_str());
+        }
+      }
+
+      // HTTP/1.1 202 Accepted
+      const std::string statusLine = ReadLine(part, pos);
+      const std::string httpVersionPrefix = "HTTP/";
+      if (statusLine.compare(0, httpVersionPrefix.length(), httpVersionPrefix) != 0)
+      {
+        throw std::runtime_error(parseError);
+      }
+      size_t versionEnd = statusLine.find(' ');
+      size_t statusCodeEnd = statusLine.find(' ', versionEnd + 1);
+      if (versionEnd == std::string::npos)
+      {
+        throw std::runtime_error(parseError);
+      }
+      const std::string version = statusLine.substr(
+          httpVersionPrefix.length(), versionEnd - httpVersionPrefix.length());
+      const size_t dot = version.find('.');
+      const int32_t majorVersion = std::atoi(version.substr(0, dot).c_str());
+      const int32_t minorVersion
+          = dot == std::string::npos ? 0 : std::atoi(version.substr(dot + 1).c_str());
+      const int statusCode
+          = std::atoi(statusLine.substr(versionEnd + 1, statusCodeEnd - versionEnd - 1).c_str());
+      const std::string reasonPhrase = statusCodeEnd == std::string::npos
+          ? std::string()
+          : statusLine.substr(statusCodeEnd + 1);
+      subResponse.RawResponse = std::make_unique<Azure::Core::Http::RawResponse>(
+          majorVersion,
+          minorVersion,
+          static_cast<Azure::Core::Http::HttpStatusCode>(statusCode),
+          reasonPhrase);
+
+      for (std::string line = ReadLine(part, pos); !line.empty(); line = ReadLine(part, pos))
+      {
+        const size_t colon = line.find(':');
+        if (colon == std::string::npos)
+        {
+          throw std::runtime_error(parseError);
+        }
+        const size_t valueStart = line.find_first_not_of(' ', colon + 1);
+        subResponse.RawResponse->SetHeader(
+            line.substr(0, colon),
+            valueStart == std::string::npos ? std::string() : line.substr(valueStart));
+      }
+
+      // The line ending before the next boundary belongs to the boundary.
+      size_t bodyEnd = part.length();
+      if (bodyEnd >= pos + 2 && part.compare(bodyEnd - 2, 2, LineEnding) == 0)
+      {
+        bodyEnd -= 2;
+      }
+      subResponse.RawResponse->SetBody(std::vector<uint8_t>(
+          part.begin() + static_cast<std::ptrdiff_t>(pos),
+          part.begin() + static_cast<std::ptrdiff_t>(std::max(bodyEnd, pos))));
+      return subResponse;
+    }
+
+    std::vector<SubResponse> ParseBatchResponse(
+        const std::string& body,
+        const std::string& boundary)
+    {
+      const std::string parseError = "Failed to parse batch response.";
+      const std::string delimiter = "--" + boundary;
+
+      std::vector<SubResponse> subResponses;
+      size_t pos = body.find(delimiter);
+      if (pos == std::string::npos)
+      {
+        throw std::runtime_error(parseError);
+      }
+      while (true)
+      {
+        pos += delimiter.length();
+        if (body.compare(pos, 2, "--") == 0)
+        {
+          break;
+        }
+        const size_t next = body.find(delimiter, pos);
+        if (next == std::string::npos)
+        {
+          throw std::runtime_error(parseError);
+        }
+        subResponses.push_back(ParseSubResponse(body.substr(pos, next - pos)));
+        pos = next;
+      }
+      return subResponses;
+    }
+  } // namespace
+
+  int32_t BlobBatch::DeleteBlob(
+      const std::string& blobContainerName,
+      const std::string& blobName,
+      const DeleteBlobOptions& options)
+  {
+    DeleteBlobSubRequest subRequest;
+    subRequest.BlobContainerName = blobContainerName;
+    subRequest.BlobName = blobName;
+    subRequest.Options = options;
+    m_deleteBlobSubRequests.push_back(std::move(subRequest));
+    return static_cast<int32_t>(m_deleteBlobSubRequests.size() - 1);
+  }
+
+  int32_t BlobBatch::SetBlobAccessTier(
+      const std::string& blobContainerName,
+      const std::string& blobName,
+      Models::AccessTier tier,
+      const SetBlobAccessTierOptions& options)
+  {
+    SetBlobAccessTierSubRequest subRequest;
+    subRequest.BlobContainerName = blobContainerName;
+    subRequest.BlobName = blobName;
+    subRequest.Tier = std::move(tier);
+    subRequest.Options = options;
+    m_setBlobAccessTierSubRequests.push_back(std::move(subRequest));
+    return static_cast<int32_t>(m_setBlobAccessTierSubRequests.size() - 1);
+  }
+
+  BlobBatchClient BlobBatchClient::CreateFromConnectionString(
+      const std::string& connectionString,
+      const BlobClientOptions& options)
+  {
+    auto parsedConnectionString = _internal::ParseConnectionString(connectionString);
+    auto serviceUrl = std::move(parsedConnectionString.BlobServiceUrl);
+
+    if (parsedConnectionString.KeyCredential)
+    {
+      return BlobBatchClient(
+          serviceUrl.GetAbsoluteUrl(), parsedConnectionString.KeyCredential, options);
+    }
+    else
+    {
+      return BlobBatchClient(serviceUrl.GetAbsoluteUrl(), options);
+    }
+  }
+
+  BlobBatchClient::BlobBatchClient(
+      const std::string& serviceUrl,
+      std::shared_ptr<StorageSharedKeyCredential> credential,
+      const BlobClientOptions& options)
+      : m_serviceUrl(serviceUrl)
+  {
+    BlobClientOptions newOptions = options;
+    newOptions.PerRetryPolicies.emplace_back(
+        std::make_unique<_internal::SharedKeyPolicy>(credential));
+
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
+    perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
+    perOperationPolicies.emplace_back(
+        std::make_unique<_internal::StorageServiceVersionPolicy>(newOptions.ApiVersion));
+    m_pipeline = std::make_shared<Azure::Core::Http::_internal::HttpPipeline>(
+        newOptions,
+        _internal::BlobServicePackageName,
+        _detail::PackageVersion::ToString(),
+        std::move(perRetryPolicies),
+        std::move(perOperationPolicies));
+
+    m_subRequestPipeline
+        = CreateSubRequestPipeline(std::make_unique<_internal::SharedKeyPolicy>(credential));
+  }
+
+  BlobBatchClient::BlobBatchClient(
+      const std::string& serviceUrl,
+      std::shared_ptr<Core::Credentials::TokenCredential> credential,
+      const BlobClientOptions& options)
+      : m_serviceUrl(serviceUrl)
+  {
+    Azure::Core::Credentials::TokenRequestContext tokenContext;
+    tokenContext.Scopes.emplace_back(_internal::StorageScope);
+
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
+    perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
+    perRetryPolicies.emplace_back(
+        std::make_unique<Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicy>(
+            credential, tokenContext));
+    perOperationPolicies.emplace_back(
+        std::make_unique<_internal::StorageServiceVersionPolicy>(options.ApiVersion));
+    m_pipeline = std::make_shared<Azure::Core::Http::_internal::HttpPipeline>(
+        options,
+        _internal::BlobServicePackageName,
+        _detail::PackageVersion::ToString(),
+        std::move(perRetryPolicies),
+        std::move(perOperationPolicies));
+
+    m_subRequestPipeline = CreateSubRequestPipeline(
+        std::make_unique<Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicy>(
+            credential, tokenContext));
+  }
+
+  BlobBatchClient::BlobBatchClient(const std::string& serviceUrl, const BlobClientOptions& options)
+      : m_serviceUrl(serviceUrl)
+  {
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
+    perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
+    perOperationPolicies.emplace_back(
+        std::make_unique<_internal::StorageServiceVersionPolicy>(options.ApiVersion));
+    m_pipeline = std::make_shared<Azure::Core::Http::_internal::HttpPipeline>(
+        options,
+        _internal::BlobServicePackageName,
+        _detail::PackageVersion::ToString(),
+        std::move(perRetryPolicies),
+        std::move(perOperationPolicies));
+
+    m_subRequestPipeline = CreateSubRequestPipeline(nullptr);
+  }
+
+  Azure::Response<Models::SubmitBlobBatchResult> BlobBatchClient::SubmitBatch(
+      const BlobBatch& batch,
+      const SubmitBlobBatchOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    (void)options;
+
+    const size_t numDeleteBlobSubRequests = batch.m_deleteBlobSubRequests.size();
+    const size_t numSubRequests
+        = numDeleteBlobSubRequests + batch.m_setBlobAccessTierSubRequests.size();
+    if (numSubRequests == 0)
+    {
+      throw std::invalid_argument("Batch cannot be empty.");
+    }
+    if (numSubRequests > static_cast<size_t>(BlobBatch::MaxSubRequests))
+    {
+      throw std::invalid_argument(
+          "Batch cannot contain more than " + std::to_string(BlobBatch::MaxSubRequests)
+          + " sub-requests.");
+    }
+
+    const std::string boundary = "batch_" + Azure::Core::Uuid::CreateUuid().ToString();
+
+    std::string requestBody;
+    int32_t contentId = 0;
+    for (const auto& subRequest : batch.m_deleteBlobSubRequests)
+    {
+      auto blobUrl = m_serviceUrl;
+      blobUrl.AppendPath(_internal::UrlEncodePath(subRequest.BlobContainerName));
+      blobUrl.AppendPath(_internal::UrlEncodePath(subRequest.BlobName));
+
+      _detail::BlobRestClient::Blob::DeleteBlobOptions protocolLayerOptions;
+      protocolLayerOptions.DeleteSnapshots = subRequest.Options.DeleteSnapshots;
+      protocolLayerOptions.LeaseId = subRequest.Options.AccessConditions.LeaseId;
+      protocolLayerOptions.IfModifiedSince = subRequest.Options.AccessConditions.IfModifiedSince;
+      protocolLayerOptions.IfUnmodifiedSince
+          = subRequest.Options.AccessConditions.IfUnmodifiedSince;
+      protocolLayerOptions.IfMatch = subRequest.Options.AccessConditions.IfMatch;
+      protocolLayerOptions.IfNoneMatch = subRequest.Options.AccessConditions.IfNoneMatch;
+      protocolLayerOptions.IfTags = subRequest.Options.AccessConditions.TagConditions;
+      auto request
+          = _detail::BlobRestClient::Blob::DeleteCreateMessage(blobUrl, protocolLayerOptions);
+      // The service version is taken from the batch request.
+      request.RemoveHeader("x-ms-version");
+      request.SetHeader("Content-Length", "0");
+      m_subRequestPipeline->Send(request, context);
+      AppendSubRequest(requestBody, boundary, contentId++, request);
+    }
+    for (const auto& subRequest : batch.m_setBlobAccessTierSubRequests)
+    {
+      auto blobUrl = m_serviceUrl;
+      blobUrl.AppendPath(_internal::UrlEncodePath(subRequest.BlobContainerName));
+      blobUrl.AppendPath(_internal::UrlEncodePath(subRequest.BlobName));
+
+      _detail::BlobRestClient::Blob::SetBlobAccessTierOptions protocolLayerOptions;
+      protocolLayerOptions.AccessTier = subRequest.Tier;
+      protocolLayerOptions.RehydratePriority = subRequest.Options.RehydratePriority;
+      protocolLayerOptions.LeaseId = subRequest.Options.AccessConditions.LeaseId;
+      protocolLayerOptions.IfTags = subRequest.Options.AccessConditions.TagConditions;
+      auto request = _detail::BlobRestClient::Blob::SetAccessTierCreateMessage(
+          blobUrl, protocolLayerOptions);
+      request.RemoveHeader("x-ms-version");
+      m_subRequestPipeline->Send(request, context);
+      AppendSubRequest(requestBody, boundary, contentId++, request);
+    }
+    requestBody += "--" + boundary + "--" + LineEnding;
+
+    Azure::Core::IO::MemoryBodyStream requestBodyStream(
+        reinterpret_cast<const uint8_t*>(requestBody.data()), requestBody.length());
+    _detail::BlobRestClient::BlobBatch::SubmitBlobBatchOptions protocolLayerOptions;
+    protocolLayerOptions.ContentType = "multipart/mixed; boundary=" + boundary;
+    auto response = _detail::BlobRestClient::BlobBatch::SubmitBatch(
+        *m_pipeline, m_serviceUrl, requestBodyStream, protocolLayerOptions, context);
+
+    const std::string& contentType = response.Value.ContentType;
+    const std::string boundaryParameter = "boundary=";
+    const size_t boundaryPos = contentType.find(boundaryParameter);
+    if (boundaryPos == std::string::npos)
+    {
+      throw std::runtime_error("Failed to parse batch response.");
+    }
+    std::string responseBoundary = contentType.substr(boundaryPos + boundaryParameter.length());
+    responseBoundary = responseBoundary.substr(0, responseBoundary.find(';'));
+    const auto& responseBody = response.RawResponse->GetBody();
+    auto subResponses = ParseBatchResponse(
+        std::string(responseBody.begin(), responseBody.end()), responseBoundary);
+
+    // The service answers a batch it cannot process with a single sub-response carrying no
+    // Content-ID.
+    if (subResponses.size() == 1 && subResponses[0].ContentId == -1)
+    {
+      throw StorageException::CreateFromResponse(std::move(subResponses[0].RawResponse));
+    }
+
+    std::vector<std::unique_ptr<Azure::Core::Http::RawResponse>> orderedSubResponses(
+        numSubRequests);
+    for (auto& subResponse : subResponses)
+    {
+      if (subResponse.ContentId < 0
+          || static_cast<size_t>(subResponse.ContentId) >= numSubRequests
+          || orderedSubResponses[static_cast<size_t>(subResponse.ContentId)])
+      {
+        throw std::runtime_error("Failed to parse batch response.");
+      }
+      orderedSubResponses[static_cast<size_t>(subResponse.ContentId)]
+          = std::move(subResponse.RawResponse);
+    }
+
+    Models::SubmitBlobBatchResult ret;
+    for (size_t i = 0; i < numSubRequests; ++i)
+    {
+      if (!orderedSubResponses[i])
+      {
+        throw std::runtime_error("Failed to parse batch response.");
+      }
+      if (i < numDeleteBlobSubRequests)
+      {
+        try
+        {
+          ret.DeleteBlobResults.push_back(_detail::BlobRestClient::Blob::DeleteCreateResponse(
+              std::move(orderedSubResponses[i]), context));
+        }
+        catch (StorageException& e)
+        {
+          Models::DeleteBlobResult result;
+          result.Deleted = false;
+          ret.DeleteBlobResults.push_back(Azure::Response<Models::DeleteBlobResult>(
+              std::move(result), std::move(e.RawResponse)));
+        }
+      }
+      else
+      {
+        try
+        {
+          ret.SetBlobAccessTierResults.push_back(
+              _detail::BlobRestClient::Blob::SetAccessTierCreateResponse(
+                  std::move(orderedSubResponses[i]), context));
+        }
+        catch (StorageException& e)
+        {
+          ret.SetBlobAccessTierResults.push_back(Azure::Response<Models::SetBlobAccessTierResult>(
+              Models::SetBlobAccessTierResult(), std::move(e.RawResponse)));
+        }
+      }
+    }
+    return Azure::Response<Models::SubmitBlobBatchResult>(
+        std::move(ret), std::move(response.RawResponse));
+  }
+
+}}} // namespace Azure::Storage::Blobs
@@ -4,9 +4,14 @@
 #include "azure/storage/blobs/blob_client.hpp"
 
 #include <azure/core/http/policies/policy.hpp>
+#include <azure/storage/common/internal/async_file_writer.hpp>
+#include <azure/storage/common/internal/async_operation.hpp>
+#include <azure/storage/common/internal/chunked_crc64.hpp>
 #include <azure/storage/common/internal/concurrent_transfer.hpp>
 #include <azure/storage/common/internal/constants.hpp>
 #include <azure/storage/common/internal/file_io.hpp>
+#include <azure/storage/common/internal/gzip.hpp>
+#include <azure/storage/common/internal/parallel_prefetch_stream.hpp>
 #include <azure/storage/common/internal/reliable_stream.hpp>
 #include <azure/storage/common/internal/shared_key_policy.hpp>
 #include <azure/storage/common/internal/storage_per_retry_policy.hpp>
@@ -18,12 +23,135 @@
 #include "azure/storage/blobs/block_blob_client.hpp"
 #include "azure/storage/blobs/page_blob_client.hpp"
 
+#include "private/avro_parser.hpp"
+#include "private/client_side_encryption.hpp"
 #include "private/package_version.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace {
+    // Bounds of the chunk size of adaptive downloads, unless the configured chunk size is outside.
+    constexpr int64_t MinAdaptiveChunkSize = 1 * 1024 * 1024;
+    constexpr int64_t MaxAdaptiveChunkSize = 256 * 1024 * 1024;
+
+    // The size of the writes of a download to a file.
+    constexpr size_t AsyncFileIoBufferSize = 4 * 1024 * 1024;
+
+    // The largest range the service returns the CRC64 of.
+    constexpr int64_t MaxRangeHashSize = 4 * 1024 * 1024;
+
+    // Limits the chunks of a download validated with the CRC64 of their ranges to the ranges the
+    // service hashes. Returns false if they already are.
+    bool LimitChunksToRangeHashSize(DownloadBlobToOptions& options)
+    {
+      auto& transferOptions = options.TransferOptions;
+      if (!transferOptions.ValidateContentCrc64
+          || (transferOptions.Strategy == TransferStrategy::Fixed
+              && transferOptions.InitialChunkSize <= MaxRangeHashSize
+              && transferOptions.ChunkSize <= MaxRangeHashSize))
+      {
+        return false;
+      }
+      transferOptions.Strategy = TransferStrategy::Fixed;
+      transferOptions.InitialChunkSize
+          = std::min(transferOptions.InitialChunkSize, MaxRangeHashSize);
+      transferOptions.ChunkSize = std::min(transferOptions.ChunkSize, MaxRangeHashSize);
+      return true;
+    }
+
+    // Downloads the first chunk of a DownloadTo. When the chunks are validated, it's requested as a
+    // range even without one, so the service hashes it, unless the blob is empty.
+    Azure::Response<Models::DownloadBlobResult> DownloadFirstChunk(
+        const BlobClient& client,
+        DownloadBlobOptions firstChunkOptions,
+        int64_t firstChunkLength,
+        bool validateContentCrc64,
+        const Azure::Core::Context& context)
+    {
+      if (!validateContentCrc64)
+      {
+        return client.Download(firstChunkOptions, context);
+      }
+      firstChunkOptions.RangeHashAlgorithm = HashAlgorithm::Crc64;
+      if (firstChunkOptions.Range.HasValue())
+      {
+        return client.Download(firstChunkOptions, context);
+      }
+      firstChunkOptions.Range = Core::Http::HttpRange();
+      firstChunkOptions.Range.Value().Offset = 0;
+      firstChunkOptions.Range.Value().Length = firstChunkLength;
+      try
+      {
+        return client.Download(firstChunkOptions, context);
+      }
+      catch (StorageException& e)
+      {
+        if (e.StatusCode != Azure::Core::Http::HttpStatusCode::RangeNotSatisfiable)
+        {
+          throw;
+        }
+      }
+      firstChunkOptions.Range.Reset();
+      firstChunkOptions.RangeHashAlgorithm.Reset();
+      return client.Download(firstChunkOptions, context);
+    }
+
+    // Checks a chunk received, whose CRC64 was appended to contentCrc64, against the CRC64 of its
+    // range returned by the service.
+    void VerifyChunkCrc64(
+        _internal::ChunkedCrc64& contentCrc64,
+        int64_t offset,
+        int64_t length,
+        const Azure::Nullable<ContentHash>& rangeHash)
+    {
+      if (length == 0)
+      {
+        return;
+      }
+      if (!rangeHash.HasValue() || rangeHash.Value().Algorithm != HashAlgorithm::Crc64
+          || contentCrc64.GetRangeHash(offset, length).Value != rangeHash.Value().Value)
+      {
+        throw Azure::Core::RequestFailedException(
+            "The CRC64 of the content received doesn't match the CRC64 of its range.");
+      }
+    }
+
+    // Whether a DownloadTo is served from, and cached in, its content cache.
+    bool UsesContentCache(const DownloadBlobToOptions& options)
+    {
+      const auto& transferOptions = options.TransferOptions;
+      return options.ContentCache && !options.ClientSideEncryption.HasValue()
+          && !transferOptions.Journal && !transferOptions.ComputeContentCrc64
+          && !transferOptions.ValidateContentCrc64 && !transferOptions.DecompressContent;
+    }
+
+    void CopyFile(const std::string& source, const std::string& destination, int64_t size)
+    {
+      _internal::FileReader reader(source);
+      _internal::FileWriter writer(destination);
+      std::vector<uint8_t> buffer(
+          static_cast<size_t>(std::min<int64_t>(size, AsyncFileIoBufferSize)));
+      for (int64_t offset = 0; offset < size;)
+      {
+        const size_t readSize = reader.Read(
+            buffer.data(),
+            static_cast<size_t>(std::min<int64_t>(size - offset, buffer.size())),
+            offset);
+        if (readSize == 0)
+        {
+          throw std::runtime_error("Failed to read file.");
+        }
+        writer.Write(buffer.data(), readSize, offset);
+        offset += readSize;
+      }
+    }
+  } // namespace
+
   BlobClient BlobClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& blobContainerName,
@@ -58,7 +186,9 @@ namespace Azure { namespace Storage { namespace Blobs {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_blobUrl.GetHost(), newOptions.SecondaryHostForRetryReads));
+        m_blobUrl.GetHost(),
+        newOptions.SecondaryHostForRetryReads,
+        newOptions.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     perOperationPolicies.emplace_back(
         std::make_unique<_internal::StorageServiceVersionPolicy>(newOptions.ApiVersion));
@@ -79,7 +209,9 @@ namespace Azure { namespace Storage { namespace Blobs {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_blobUrl.GetHost(), options.SecondaryHostForRetryReads));
+        m_blobUrl.GetHost(),
+        options.SecondaryHostForRetryReads,
+        options.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     {
       Azure::Core::Credentials::TokenRequestContext tokenContext;
@@ -100,12 +232,15 @@ namespace Azure { namespace Storage { namespace Blobs {
 
   BlobClient::BlobClient(const std::string& blobUrl, const BlobClientOptions& options)
       : m_blobUrl(blobUrl), m_customerProvidedKey(options.CustomerProvidedKey),
-        m_encryptionScope(options.EncryptionScope)
+        m_encryptionScope(options.EncryptionScope), m_transferScheduler(options.TransferScheduler),
+        m_bufferPool(options.BufferPool), m_propertiesCache(options.PropertiesCache)
   {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_blobUrl.GetHost(), options.SecondaryHostForRetryReads));
+        m_blobUrl.GetHost(),
+        options.SecondaryHostForRetryReads,
+        options.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     perOperationPolicies.emplace_back(
         std::make_unique<_internal::StorageServiceVersionPolicy>(options.ApiVersion));
@@ -115,6 +250,8 @@ namespace Azure { namespace Storage { namespace Blobs {
         _detail::PackageVersion::ToString(),
         std::move(perRetryPolicies),
         std::move(perOperationPolicies));
+    // The constructors with a credential replace the pipeline, this one stays without it.
+    m_sourcePipeline = m_pipeline;
   }
 
   BlockBlobClient BlobClient::AsBlockBlobClient() const { return BlockBlobClient(*this); }
@@ -156,6 +293,112 @@ namespace Azure { namespace Storage { namespace Blobs {
   Azure::Response<Models::DownloadBlobResult> BlobClient::Download(
       const DownloadBlobOptions& options,
       const Azure::Core::Context& context) const
+  {
+    if (options.PrefetchOptions.Concurrency > 0)
+    {
+      return DownloadWithPrefetch(options, context);
+    }
+
+    auto protocolLayerOptions = GetDownloadProtocolLayerOptions(options);
+    const bool isConditionedOnCachedETag
+        = m_propertiesCache && !options.AccessConditions.IfMatch.HasValue()
+        && protocolLayerOptions.IfMatch.HasValue();
+
+    auto downloadResponse = [&]() {
+      try
+      {
+        return _detail::BlobRestClient::Blob::Download(
+            *m_pipeline, m_blobUrl, protocolLayerOptions, _internal::WithReplicaStatus(context));
+      }
+      catch (StorageException& e)
+      {
+        if (!isConditionedOnCachedETag
+            || e.StatusCode != Azure::Core::Http::HttpStatusCode::PreconditionFailed)
+        {
+          throw;
+        }
+      }
+      // The blob was changed since its properties were cached, they're evicted and the blob is
+      // downloaded again without the condition.
+      m_propertiesCache->Remove(m_blobUrl.GetAbsoluteUrl());
+      protocolLayerOptions.IfMatch = Azure::ETag();
+      return _detail::BlobRestClient::Blob::Download(
+          *m_pipeline, m_blobUrl, protocolLayerOptions, _internal::WithReplicaStatus(context));
+    }();
+    CompleteDownloadResponse(downloadResponse, options);
+    return downloadResponse;
+  }
+
+  void BlobClient::DownloadAsync(
+      const DownloadBlobOptions& options,
+      const Azure::Core::Context& context,
+      Azure::Core::ResponseCallback<Models::DownloadBlobResult> callback) const
+  {
+    if (options.PrefetchOptions.Concurrency > 0)
+    {
+      throw std::invalid_argument("The prefetch options aren't supported by DownloadAsync.");
+    }
+
+    auto protocolLayerOptions = GetDownloadProtocolLayerOptions(options);
+    // The client is copied, the response is completed after this function returns.
+    auto blobClient = std::make_shared<BlobClient>(*this);
+    auto sendDownload
+        = [blobClient, options, context](
+              const _detail::BlobRestClient::Blob::DownloadBlobOptions& protocolLayerOptions,
+              Azure::Core::ResponseCallback<Models::DownloadBlobResult> callback) {
+            _internal::SendAsync<Models::DownloadBlobResult>(
+                blobClient->m_pipeline,
+                _detail::BlobRestClient::Blob::DownloadCreateMessage(
+                    blobClient->m_blobUrl, protocolLayerOptions),
+                _internal::WithReplicaStatus(context),
+                [blobClient, options, context](
+                    std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse) {
+                  auto downloadResponse = _detail::BlobRestClient::Blob::DownloadCreateResponse(
+                      std::move(rawResponse), context);
+                  blobClient->CompleteDownloadResponse(downloadResponse, options);
+                  return downloadResponse;
+                },
+                std::move(callback));
+          };
+    if (!m_propertiesCache || options.AccessConditions.IfMatch.HasValue()
+        || !protocolLayerOptions.IfMatch.HasValue())
+    {
+      sendDownload(protocolLayerOptions, std::move(callback));
+      return;
+    }
+
+    // Same as Download(), the blob is downloaded again without the cached ETag if it was changed.
+    sendDownload(
+        protocolLayerOptions,
+        [blobClient, sendDownload, protocolLayerOptions, callback](
+            Azure::Nullable<Azure::Response<Models::DownloadBlobResult>> response,
+            std::exception_ptr error) mutable {
+          if (error)
+          {
+            try
+            {
+              std::rethrow_exception(error);
+            }
+            catch (StorageException& e)
+            {
+              if (e.StatusCode == Azure::Core::Http::HttpStatusCode::PreconditionFailed)
+              {
+                blobClient->m_propertiesCache->Remove(blobClient->m_blobUrl.GetAbsoluteUrl());
+                protocolLayerOptions.IfMatch = Azure::ETag();
+                sendDownload(protocolLayerOptions, std::move(callback));
+                return;
+              }
+            }
+            catch (...)
+            {
+            }
+          }
+          callback(std::move(response), error);
+        });
+  }
+
+  _detail::BlobRestClient::Blob::DownloadBlobOptions BlobClient::GetDownloadProtocolLayerOptions(
+      const DownloadBlobOptions& options) const
   {
     _detail::BlobRestClient::Blob::DownloadBlobOptions protocolLayerOptions;
     protocolLayerOptions.Range = options.Range;
@@ -172,16 +415,36 @@ namespace Azure { namespace Storage { namespace Blobs {
       protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.Value().KeyHash;
       protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm;
     }
+    // Without conditions of the caller, the blob is only downloaded if it's still the one whose
+    // properties are cached, so that the properties are got again if it was changed.
+    const bool hasAccessConditions = protocolLayerOptions.LeaseId.HasValue()
+        || protocolLayerOptions.IfModifiedSince.HasValue()
+        || protocolLayerOptions.IfUnmodifiedSince.HasValue()
+        || protocolLayerOptions.IfMatch.HasValue() || protocolLayerOptions.IfNoneMatch.HasValue()
+        || protocolLayerOptions.IfTags.HasValue();
+    if (m_propertiesCache && !hasAccessConditions)
+    {
+      auto cachedProperties = m_propertiesCache->Get(m_blobUrl.GetAbsoluteUrl());
+      if (cachedProperties.HasValue())
+      {
+        protocolLayerOptions.IfMatch = cachedProperties.Value().Value.ETag;
+      }
+    }
+    return protocolLayerOptions;
+  }
 
-    auto downloadResponse = _detail::BlobRestClient::Blob::Download(
-        *m_pipeline, m_blobUrl, protocolLayerOptions, _internal::WithReplicaStatus(context));
-
+  void BlobClient::CompleteDownloadResponse(
+      Azure::Response<Models::DownloadBlobResult>& downloadResponse,
+      const DownloadBlobOptions& options) const
+  {
     {
       // In case network failure during reading the body
       const Azure::ETag eTag = downloadResponse.Value.Details.ETag;
 
-      auto retryFunction
-          = [this, options, eTag](int64_t retryOffset, const Azure::Core::Context& context)
+      // The client is copied, the body stream may be read after an asynchronous download has
+      // released it.
+      auto retryFunction = [blobClient = *this, options, eTag](
+                               int64_t retryOffset, const Azure::Core::Context& context)
           -> std::unique_ptr<Azure::Core::IO::BodyStream> {
         DownloadBlobOptions newOptions = options;
         newOptions.Range = Core::Http::HttpRange();
@@ -192,11 +455,12 @@ namespace Azure { namespace Storage { namespace Blobs {
           newOptions.Range.Value().Length = options.Range.Value().Length.Value() - retryOffset;
         }
         newOptions.AccessConditions.IfMatch = eTag;
-        return std::move(Download(newOptions, context).Value.BodyStream);
+        return std::move(blobClient.Download(newOptions, context).Value.BodyStream);
       };
 
       _internal::ReliableStreamOptions reliableStreamOptions;
       reliableStreamOptions.MaxRetryRequests = _internal::ReliableStreamRetryCount;
+      reliableStreamOptions.MinBytesPerSecond = _internal::ReliableStreamMinBytesPerSecond;
       downloadResponse.Value.BodyStream = std::make_unique<_internal::ReliableStream>(
           std::move(downloadResponse.Value.BodyStream), reliableStreamOptions, retryFunction);
     }
@@ -210,7 +474,83 @@ namespace Azure { namespace Storage { namespace Blobs {
     {
       downloadResponse.Value.Details.IsCurrentVersion = false;
     }
-    return downloadResponse;
+  }
+
+  Azure::Response<Models::DownloadBlobResult> BlobClient::DownloadWithPrefetch(
+      const DownloadBlobOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    DownloadBlobOptions singleOptions = options;
+    singleOptions.PrefetchOptions.Concurrency = 0;
+
+    // The first chunk gets the size of the blob, and is read while the next ones are fetched.
+    const int64_t rangeOffset = options.Range.HasValue() ? options.Range.Value().Offset : 0;
+    DownloadBlobOptions firstChunkOptions = singleOptions;
+    firstChunkOptions.Range = Core::Http::HttpRange();
+    firstChunkOptions.Range.Value().Offset = rangeOffset;
+    firstChunkOptions.Range.Value().Length = options.PrefetchOptions.ChunkSize;
+    if (options.Range.HasValue() && options.Range.Value().Length.HasValue())
+    {
+      firstChunkOptions.Range.Value().Length = std::min(
+          options.PrefetchOptions.ChunkSize, options.Range.Value().Length.Value());
+    }
+
+    Azure::Nullable<Azure::Response<Models::DownloadBlobResult>> firstChunk;
+    try
+    {
+      firstChunk = Download(firstChunkOptions, context);
+    }
+    catch (StorageException& e)
+    {
+      // An empty blob has no range to request.
+      if (options.Range.HasValue()
+          || e.StatusCode != Azure::Core::Http::HttpStatusCode::RangeNotSatisfiable)
+      {
+        throw;
+      }
+      return Download(singleOptions, context);
+    }
+    auto response = std::move(firstChunk.Value());
+
+    int64_t rangeLength = response.Value.BlobSize - rangeOffset;
+    if (options.Range.HasValue() && options.Range.Value().Length.HasValue())
+    {
+      rangeLength = std::min(rangeLength, options.Range.Value().Length.Value());
+    }
+    if (rangeLength <= response.Value.BodyStream->Length())
+    {
+      return response;
+    }
+
+    // The client is copied, the stream keeps fetching after this function returns.
+    const Azure::ETag eTag = response.Value.Details.ETag;
+    auto chunkFetcher = [client = *this, singleOptions, eTag](
+                            int64_t offset, int64_t length, const Azure::Core::Context& context)
+        -> std::unique_ptr<Azure::Core::IO::BodyStream> {
+      DownloadBlobOptions chunkOptions = singleOptions;
+      chunkOptions.Range = Core::Http::HttpRange();
+      chunkOptions.Range.Value().Offset = offset;
+      chunkOptions.Range.Value().Length = length;
+      chunkOptions.RangeHashAlgorithm.Reset();
+      chunkOptions.AccessConditions.IfMatch = eTag;
+      return std::move(client.Download(chunkOptions, context).Value.BodyStream);
+    };
+
+    _internal::ParallelPrefetchStreamOptions prefetchOptions;
+    prefetchOptions.ChunkSize = options.PrefetchOptions.ChunkSize;
+    prefetchOptions.Concurrency = options.PrefetchOptions.Concurrency;
+    prefetchOptions.BufferPool = m_bufferPool;
+    response.Value.BodyStream = std::make_unique<_internal::ParallelPrefetchBodyStream>(
+        std::move(response.Value.BodyStream),
+        rangeOffset,
+        rangeLength,
+        prefetchOptions,
+        std::move(chunkFetcher),
+        context);
+    response.Value.ContentRange.Offset = rangeOffset;
+    response.Value.ContentRange.Length = rangeLength;
+    response.Value.TransactionalContentHash.Reset();
+    return response;
   }
 
   Azure::Response<Models::DownloadBlobToResult> BlobClient::DownloadTo(
@@ -219,11 +559,66 @@ namespace Azure { namespace Storage { namespace Blobs {
       const DownloadBlobToOptions& options,
       const Azure::Core::Context& context) const
   {
+    if (options.TransferOptions.DecompressContent)
+    {
+      throw Azure::Core::RequestFailedException(
+          "DecompressContent can't be used when downloading to a buffer.");
+    }
+    if (options.ClientSideEncryption.HasValue())
+    {
+      return DownloadDecryptedTo(
+          [bufferSize](int64_t size) {
+            if (static_cast<uint64_t>(size) > bufferSize)
+            {
+              throw Azure::Core::RequestFailedException(
+                  "Buffer is not big enough, blob size is " + std::to_string(size) + ".");
+            }
+          },
+          [buffer](const uint8_t* data, size_t size, int64_t offset) {
+            std::copy(data, data + size, buffer + offset);
+          },
+          options,
+          context);
+    }
+    const bool useContentCache = UsesContentCache(options);
+    if (useContentCache)
+    {
+      auto cached = DownloadFromContentCache(
+          [bufferSize](int64_t size) {
+            if (static_cast<uint64_t>(size) > bufferSize)
+            {
+              throw Azure::Core::RequestFailedException(
+                  "Buffer is not big enough, blob range size is " + std::to_string(size) + ".");
+            }
+          },
+          [buffer](const uint8_t* data, size_t size, int64_t offset) {
+            std::copy(data, data + size, buffer + offset);
+          },
+          options,
+          context);
+      if (cached)
+      {
+        return std::move(*cached);
+      }
+    }
+    DownloadBlobToOptions limitedOptions = options;
+    if (LimitChunksToRangeHashSize(limitedOptions))
+    {
+      return DownloadTo(buffer, bufferSize, limitedOptions, context);
+    }
+    _internal::TransferProgressReporter progressReporter(
+        m_transferCounters,
+        false,
+        options.TransferOptions.ProgressHandler,
+        options.TransferOptions.ProgressInterval);
+
     // Just start downloading using an initial chunk. If it's a small blob, we'll get the whole
     // thing in one shot. If it's a large blob, we'll get its full size in Content-Range and can
     // keep downloading it in chunks.
     const int64_t firstChunkOffset = options.Range.HasValue() ? options.Range.Value().Offset : 0;
-    int64_t firstChunkLength = options.TransferOptions.InitialChunkSize;
+    const bool adaptive = options.TransferOptions.Strategy == TransferStrategy::Adaptive;
+    int64_t firstChunkLength
+        = adaptive ? options.TransferOptions.ChunkSize : options.TransferOptions.InitialChunkSize;
     if (options.Range.HasValue() && options.Range.Value().Length.HasValue())
     {
       firstChunkLength = std::min(firstChunkLength, options.Range.Value().Length.Value());
@@ -236,7 +631,10 @@ namespace Azure { namespace Storage { namespace Blobs {
       firstChunkOptions.Range.Value().Length = firstChunkLength;
     }
 
-    auto firstChunk = Download(firstChunkOptions, context);
+    const auto firstChunkStart = std::chrono::steady_clock::now();
+    const bool validateContentCrc64 = options.TransferOptions.ValidateContentCrc64;
+    auto firstChunk = DownloadFirstChunk(
+        *this, firstChunkOptions, firstChunkLength, validateContentCrc64, context);
     const Azure::ETag eTag = firstChunk.Value.Details.ETag;
 
     const int64_t blobSize = firstChunk.Value.BlobSize;
@@ -254,6 +652,7 @@ namespace Azure { namespace Storage { namespace Blobs {
       blobRangeSize = blobSize;
     }
     firstChunkLength = std::min(firstChunkLength, blobRangeSize);
+    progressReporter.SetTotalBytes(blobRangeSize);
 
     if (static_cast<uint64_t>(blobRangeSize) > std::numeric_limits<size_t>::max()
         || static_cast<size_t>(blobRangeSize) > bufferSize)
@@ -269,6 +668,19 @@ namespace Azure { namespace Storage { namespace Blobs {
       throw Azure::Core::RequestFailedException("Error when reading body stream.");
     }
     firstChunk.Value.BodyStream.reset();
+    std::unique_ptr<_internal::ChunkedCrc64> contentCrc64;
+    if (options.TransferOptions.ComputeContentCrc64 || validateContentCrc64)
+    {
+      contentCrc64 = std::make_unique<_internal::ChunkedCrc64>();
+      contentCrc64->Append(0, buffer, static_cast<size_t>(firstChunkLength));
+    }
+    if (validateContentCrc64)
+    {
+      VerifyChunkCrc64(
+          *contentCrc64, 0, firstChunkLength, firstChunk.Value.TransactionalContentHash);
+    }
+    progressReporter.OnBytesTransferred(firstChunkLength);
+    const auto firstChunkDuration = std::chrono::steady_clock::now() - firstChunkStart;
 
     auto returnTypeConverter = [](Azure::Response<Models::DownloadBlobResult>& response) {
       Models::DownloadBlobToResult ret;
@@ -283,49 +695,510 @@ namespace Azure { namespace Storage { namespace Blobs {
     auto ret = returnTypeConverter(firstChunk);
 
     // Keep downloading the remaining in parallel
-    auto downloadChunkFunc
-        = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-            DownloadBlobOptions chunkOptions;
-            chunkOptions.Range = Core::Http::HttpRange();
-            chunkOptions.Range.Value().Offset = offset;
-            chunkOptions.Range.Value().Length = length;
-            chunkOptions.AccessConditions.IfMatch = eTag;
-            auto chunk = Download(chunkOptions, context);
-            int64_t bytesRead = chunk.Value.BodyStream->ReadToCount(
-                buffer + (offset - firstChunkOffset),
-                static_cast<size_t>(chunkOptions.Range.Value().Length.Value()),
-                context);
-            if (bytesRead != chunkOptions.Range.Value().Length.Value())
+    auto downloadChunkFunc = [&](int64_t offset,
+                                 int64_t length,
+                                 int64_t chunkId,
+                                 int64_t numChunks,
+                                 const Azure::Core::Context& chunkContext) {
+      DownloadBlobOptions chunkOptions;
+      chunkOptions.Range = Core::Http::HttpRange();
+      chunkOptions.Range.Value().Offset = offset;
+      chunkOptions.Range.Value().Length = length;
+      chunkOptions.AccessConditions.IfMatch = eTag;
+      if (validateContentCrc64)
+      {
+        chunkOptions.RangeHashAlgorithm = HashAlgorithm::Crc64;
+      }
+      auto chunk = Download(chunkOptions, chunkContext);
+      int64_t bytesRead = chunk.Value.BodyStream->ReadToCount(
+          buffer + (offset - firstChunkOffset),
+          static_cast<size_t>(chunkOptions.Range.Value().Length.Value()),
+          chunkContext);
+      if (bytesRead != chunkOptions.Range.Value().Length.Value())
+      {
+        throw Azure::Core::RequestFailedException("Error when reading body stream.");
+      }
+      if (contentCrc64)
+      {
+        contentCrc64->Append(
+            offset - firstChunkOffset,
+            buffer + (offset - firstChunkOffset),
+            static_cast<size_t>(length));
+      }
+      if (validateContentCrc64)
+      {
+        VerifyChunkCrc64(
+            *contentCrc64, offset - firstChunkOffset, length, chunk.Value.TransactionalContentHash);
+      }
+
+      if (chunkId == numChunks - 1)
+      {
+        ret = returnTypeConverter(chunk);
+        ret.Value.TransactionalContentHash.Reset();
+      }
+      progressReporter.OnBytesTransferred(length);
+    };
+
+    int64_t remainingOffset = firstChunkOffset + firstChunkLength;
+    int64_t remainingSize = blobRangeSize - firstChunkLength;
+
+    if (adaptive)
+    {
+      _internal::AdaptiveChunkController controller(
+          options.TransferOptions.ChunkSize,
+          std::min(options.TransferOptions.ChunkSize, MinAdaptiveChunkSize),
+          std::max(options.TransferOptions.ChunkSize, MaxAdaptiveChunkSize),
+          options.TransferOptions.Concurrency);
+      controller.OnChunkTransferred(firstChunkLength, firstChunkDuration);
+      _internal::AdaptiveConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          controller,
+          downloadChunkFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    else
+    {
+      _internal::ConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          options.TransferOptions.ChunkSize,
+          options.TransferOptions.Concurrency,
+          downloadChunkFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    progressReporter.OnTransferDone();
+    ret.Value.ContentRange.Offset = firstChunkOffset;
+    ret.Value.ContentRange.Length = blobRangeSize;
+    if (options.TransferOptions.ComputeContentCrc64)
+    {
+      ret.Value.ContentCrc64 = contentCrc64->Final();
+    }
+    if (useContentCache && !options.Range.HasValue())
+    {
+      StoreInContentCache(
+          ret.Value,
+          [buffer, blobRangeSize](const std::string& cacheFileName) {
+            _internal::FileWriter(cacheFileName)
+                .Write(buffer, static_cast<size_t>(blobRangeSize), 0);
+          },
+          options);
+    }
+    return ret;
+  }
+
+  Azure::Response<Models::DownloadBlobToResult> BlobClient::DownloadTo(
+      const std::string& fileName,
+      const DownloadBlobToOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    if (options.ClientSideEncryption.HasValue())
+    {
+      _internal::FileWriter fileWriter(fileName);
+      return DownloadDecryptedTo(
+          [&fileWriter, &options](int64_t size) {
+            if (options.TransferOptions.PreallocateFile)
             {
-              throw Azure::Core::RequestFailedException("Error when reading body stream.");
+              fileWriter.Preallocate(size);
             }
-
-            if (chunkId == numChunks - 1)
+          },
+          [&fileWriter](const uint8_t* data, size_t size, int64_t offset) {
+            fileWriter.Write(data, size, offset);
+          },
+          options,
+          context);
+    }
+    DownloadBlobToOptions limitedOptions = options;
+    if (LimitChunksToRangeHashSize(limitedOptions))
+    {
+      return DownloadTo(fileName, limitedOptions, context);
+    }
+    const bool useContentCache = UsesContentCache(options);
+    if (useContentCache)
+    {
+      // The file is only opened once the blob is found in the cache.
+      std::unique_ptr<_internal::FileWriter> fileWriter;
+      auto cached = DownloadFromContentCache(
+          [&fileWriter, &fileName, &options](int64_t size) {
+            fileWriter = std::make_unique<_internal::FileWriter>(fileName);
+            if (options.TransferOptions.PreallocateFile)
             {
-              ret = returnTypeConverter(chunk);
-              ret.Value.TransactionalContentHash.Reset();
+              fileWriter->Preallocate(size);
             }
-          };
+          },
+          [&fileWriter](const uint8_t* data, size_t size, int64_t offset) {
+            fileWriter->Write(data, size, offset);
+          },
+          options,
+          context);
+      if (cached)
+      {
+        return std::move(*cached);
+      }
+    }
+    // Just start downloading using an initial chunk. If it's a small blob, we'll get the whole
+    // thing in one shot. If it's a large blob, we'll get its full size in Content-Range and can
+    // keep downloading it in chunks.
+    const int64_t firstChunkOffset = options.Range.HasValue() ? options.Range.Value().Offset : 0;
+    const auto& journal = options.TransferOptions.Journal;
+    if (journal && options.TransferOptions.ComputeContentCrc64)
+    {
+      throw Azure::Core::RequestFailedException(
+          "ComputeContentCrc64 can't be used with a transfer journal.");
+    }
+    if (options.TransferOptions.DecompressContent)
+    {
+      if (journal)
+      {
+        throw Azure::Core::RequestFailedException(
+            "DecompressContent can't be used with a transfer journal.");
+      }
+      // The size of the decompressed content isn't known in advance, so the file is written in
+      // order as the content is decompressed.
+      _internal::FileWriter fileWriter(fileName);
+      int64_t fileOffset = 0;
+      return DownloadTo(
+          [&fileWriter, &fileOffset](const uint8_t* data, size_t size) {
+            fileWriter.Write(data, size, fileOffset);
+            fileOffset += static_cast<int64_t>(size);
+          },
+          options,
+          context);
+    }
+    _internal::TransferProgressReporter progressReporter(
+        m_transferCounters,
+        false,
+        options.TransferOptions.ProgressHandler,
+        options.TransferOptions.ProgressInterval);
+
+    const bool adaptive
+        = options.TransferOptions.Strategy == TransferStrategy::Adaptive && !journal;
+    // With a journal, the first chunk is downloaded again when resuming, so it's kept small.
+    int64_t firstChunkLength = adaptive || journal ? options.TransferOptions.ChunkSize
+                                                   : options.TransferOptions.InitialChunkSize;
+    if (options.Range.HasValue() && options.Range.Value().Length.HasValue())
+    {
+      firstChunkLength = std::min(firstChunkLength, options.Range.Value().Length.Value());
+    }
+
+    DownloadBlobOptions firstChunkOptions;
+    firstChunkOptions.Range = options.Range;
+    if (firstChunkOptions.Range.HasValue())
+    {
+      firstChunkOptions.Range.Value().Length = firstChunkLength;
+    }
+
+    const bool useMemoryMappedFile = options.TransferOptions.UseMemoryMappedFile && !journal;
+    _internal::FileWriter fileWriter(
+        fileName,
+        options.TransferOptions.UseUnbufferedFileIo && !useMemoryMappedFile,
+        /* truncate */ !journal);
+
+    const auto firstChunkStart = std::chrono::steady_clock::now();
+    const bool validateContentCrc64 = options.TransferOptions.ValidateContentCrc64;
+    auto firstChunk = DownloadFirstChunk(
+        *this, firstChunkOptions, firstChunkLength, validateContentCrc64, context);
+    const Azure::ETag eTag = firstChunk.Value.Details.ETag;
+
+    const int64_t blobSize = firstChunk.Value.BlobSize;
+    int64_t blobRangeSize;
+    if (firstChunkOptions.Range.HasValue())
+    {
+      blobRangeSize = blobSize - firstChunkOffset;
+      if (options.Range.HasValue() && options.Range.Value().Length.HasValue())
+      {
+        blobRangeSize = std::min(blobRangeSize, options.Range.Value().Length.Value());
+      }
+    }
+    else
+    {
+      blobRangeSize = blobSize;
+    }
+    firstChunkLength = std::min(firstChunkLength, blobRangeSize);
+    progressReporter.SetTotalBytes(blobRangeSize);
+    // The chunks are received straight into the mapped file, which allocates its space.
+    std::unique_ptr<_internal::WritableFileMapping> fileMapping;
+    if (useMemoryMappedFile)
+    {
+      fileMapping = std::make_unique<_internal::WritableFileMapping>(fileName, blobRangeSize);
+    }
+    else if (options.TransferOptions.PreallocateFile)
+    {
+      fileWriter.Preallocate(blobRangeSize);
+    }
+
+    // The ETag is part of the transfer, so the chunks done are downloaded again if the blob was
+    // changed. The SAS token of the URL is left out of the journal.
+    std::unique_ptr<_internal::TransferProgress> progress;
+    if (journal)
+    {
+      progress = std::make_unique<_internal::TransferProgress>(
+          journal,
+          "download " + m_blobUrl.GetHost() + "/" + m_blobUrl.GetPath() + " " + eTag.ToString()
+              + " " + std::to_string(firstChunkOffset) + " " + std::to_string(blobRangeSize) + " "
+              + std::to_string(options.TransferOptions.ChunkSize));
+      // The file isn't truncated, so that the chunks done are kept.
+      fileWriter.SetSparseSize(blobRangeSize);
+    }
+
+    // Writes in the background, so the transfer threads keep receiving.
+    std::unique_ptr<_internal::AsyncFileWriter> asyncFileWriter;
+    // With a journal, the chunks are written before they are recorded as done.
+    if (options.TransferOptions.UseAsyncFileIo && !journal && !fileMapping)
+    {
+      asyncFileWriter = std::make_unique<_internal::AsyncFileWriter>(
+          fileWriter,
+          AsyncFileIoBufferSize,
+          static_cast<size_t>(std::max(options.TransferOptions.Concurrency, 1)) * 2);
+    }
+
+    std::unique_ptr<_internal::ChunkedCrc64> contentCrc64;
+    if (options.TransferOptions.ComputeContentCrc64 || validateContentCrc64)
+    {
+      contentCrc64 = std::make_unique<_internal::ChunkedCrc64>();
+    }
+
+    auto bodyStreamToFile = [this, &fileMapping](
+                                Azure::Core::IO::BodyStream& stream,
+                                _internal::FileWriter& fileWriter,
+                                _internal::AsyncFileWriter* asyncFileWriter,
+                                _internal::ChunkedCrc64* contentCrc64,
+                                int64_t offset,
+                                int64_t length,
+                                const Azure::Core::Context& context) {
+      if (fileMapping)
+      {
+        uint8_t* data = fileMapping->GetData() + offset;
+        if (stream.ReadToCount(data, static_cast<size_t>(length), context)
+            != static_cast<size_t>(length))
+        {
+          throw Azure::Core::RequestFailedException("Error when reading body stream.");
+        }
+        if (contentCrc64)
+        {
+          contentCrc64->Append(offset, data, static_cast<size_t>(length));
+        }
+        return;
+      }
+      constexpr size_t bufferSize = AsyncFileIoBufferSize;
+      constexpr int64_t alignment = static_cast<int64_t>(_internal::UnbufferedFileIoAlignment);
+      _internal::PooledBuffer buffer;
+      if (!asyncFileWriter)
+      {
+        buffer = _internal::PooledBuffer(m_bufferPool, bufferSize);
+      }
+      while (length > 0)
+      {
+        size_t readSize = static_cast<size_t>(std::min<int64_t>(bufferSize, length));
+        // The first write ends at an aligned offset, so the next ones can bypass the page cache.
+        if (offset % alignment != 0)
+        {
+          readSize = static_cast<size_t>(
+              std::min<int64_t>(static_cast<int64_t>(readSize), alignment - offset % alignment));
+        }
+        uint8_t* data = asyncFileWriter ? asyncFileWriter->AcquireBuffer() : buffer.GetData();
+        try
+        {
+          if (stream.ReadToCount(data, readSize, context) != readSize)
+          {
+            throw Azure::Core::RequestFailedException("Error when reading body stream.");
+          }
+        }
+        catch (...)
+        {
+          if (asyncFileWriter)
+          {
+            asyncFileWriter->ReleaseBuffer(data);
+          }
+          throw;
+        }
+        if (contentCrc64)
+        {
+          contentCrc64->Append(offset, data, readSize);
+        }
+        if (asyncFileWriter)
+        {
+          asyncFileWriter->Write(data, readSize, offset);
+        }
+        else
+        {
+          fileWriter.Write(data, readSize, offset);
+        }
+        length -= readSize;
+        offset += readSize;
+      }
+    };
+
+    bodyStreamToFile(
+        *(firstChunk.Value.BodyStream),
+        fileWriter,
+        asyncFileWriter.get(),
+        contentCrc64.get(),
+        0,
+        firstChunkLength,
+        context);
+    if (validateContentCrc64)
+    {
+      VerifyChunkCrc64(
+          *contentCrc64, 0, firstChunkLength, firstChunk.Value.TransactionalContentHash);
+    }
+    firstChunk.Value.BodyStream.reset();
+    progressReporter.OnBytesTransferred(firstChunkLength);
+    const auto firstChunkDuration = std::chrono::steady_clock::now() - firstChunkStart;
+
+    auto returnTypeConverter = [](Azure::Response<Models::DownloadBlobResult>& response) {
+      Models::DownloadBlobToResult ret;
+      ret.BlobType = std::move(response.Value.BlobType);
+      ret.ContentRange = std::move(response.Value.ContentRange);
+      ret.BlobSize = response.Value.BlobSize;
+      ret.TransactionalContentHash = std::move(response.Value.TransactionalContentHash);
+      ret.Details = std::move(response.Value.Details);
+      return Azure::Response<Models::DownloadBlobToResult>(
+          std::move(ret), std::move(response.RawResponse));
+    };
+    auto ret = returnTypeConverter(firstChunk);
+
+    // Keep downloading the remaining in parallel
+    auto downloadChunkFunc = [&](int64_t offset,
+                                 int64_t length,
+                                 int64_t chunkId,
+                                 int64_t numChunks,
+                                 const Azure::Core::Context& chunkContext) {
+      if (progress && progress->IsChunkDone(chunkId))
+      {
+        return;
+      }
+      DownloadBlobOptions chunkOptions;
+      chunkOptions.Range = Core::Http::HttpRange();
+      chunkOptions.Range.Value().Offset = offset;
+      chunkOptions.Range.Value().Length = length;
+      chunkOptions.AccessConditions.IfMatch = eTag;
+      if (validateContentCrc64)
+      {
+        chunkOptions.RangeHashAlgorithm = HashAlgorithm::Crc64;
+      }
+      auto chunk = Download(chunkOptions, chunkContext);
+      bodyStreamToFile(
+          *(chunk.Value.BodyStream),
+          fileWriter,
+          asyncFileWriter.get(),
+          contentCrc64.get(),
+          offset - firstChunkOffset,
+          chunkOptions.Range.Value().Length.Value(),
+          chunkContext);
+      if (validateContentCrc64)
+      {
+        VerifyChunkCrc64(
+            *contentCrc64, offset - firstChunkOffset, length, chunk.Value.TransactionalContentHash);
+      }
+
+      if (chunkId == numChunks - 1)
+      {
+        ret = returnTypeConverter(chunk);
+        ret.Value.TransactionalContentHash.Reset();
+      }
+      if (progress)
+      {
+        progress->OnChunkDone(chunkId);
+      }
+      progressReporter.OnBytesTransferred(length);
+    };
 
     int64_t remainingOffset = firstChunkOffset + firstChunkLength;
     int64_t remainingSize = blobRangeSize - firstChunkLength;
 
-    _internal::ConcurrentTransfer(
-        remainingOffset,
-        remainingSize,
-        options.TransferOptions.ChunkSize,
-        options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+    if (adaptive)
+    {
+      _internal::AdaptiveChunkController controller(
+          options.TransferOptions.ChunkSize,
+          std::min(options.TransferOptions.ChunkSize, MinAdaptiveChunkSize),
+          std::max(options.TransferOptions.ChunkSize, MaxAdaptiveChunkSize),
+          options.TransferOptions.Concurrency);
+      controller.OnChunkTransferred(firstChunkLength, firstChunkDuration);
+      _internal::AdaptiveConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          controller,
+          downloadChunkFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    else
+    {
+      _internal::ConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          options.TransferOptions.ChunkSize,
+          options.TransferOptions.Concurrency,
+          downloadChunkFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    if (asyncFileWriter)
+    {
+      asyncFileWriter->Flush();
+    }
+    fileMapping.reset();
+    if (progress)
+    {
+      // The last chunk may have been done before, and the hash of the first chunk isn't the hash
+      // of the content.
+      if (remainingSize > 0)
+      {
+        ret.Value.TransactionalContentHash.Reset();
+      }
+      progress->OnTransferDone();
+    }
+    progressReporter.OnTransferDone();
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = blobRangeSize;
+    if (options.TransferOptions.ComputeContentCrc64)
+    {
+      ret.Value.ContentCrc64 = contentCrc64->Final();
+    }
+    if (useContentCache && !options.Range.HasValue())
+    {
+      StoreInContentCache(
+          ret.Value,
+          [&fileName, blobRangeSize](const std::string& cacheFileName) {
+            CopyFile(fileName, cacheFileName, blobRangeSize);
+          },
+          options);
+    }
     return ret;
   }
 
   Azure::Response<Models::DownloadBlobToResult> BlobClient::DownloadTo(
-      const std::string& fileName,
+      const std::function<void(const uint8_t* data, size_t size)>& sink,
       const DownloadBlobToOptions& options,
       const Azure::Core::Context& context) const
   {
+    if (options.TransferOptions.DecompressContent && options.Range.HasValue())
+    {
+      throw Azure::Core::RequestFailedException("DecompressContent can't be used with a Range.");
+    }
+    if (options.ClientSideEncryption.HasValue())
+    {
+      throw Azure::Core::RequestFailedException(
+          "ClientSideEncryption can't be used when downloading to a sink.");
+    }
+    DownloadBlobToOptions limitedOptions = options;
+    if (LimitChunksToRangeHashSize(limitedOptions))
+    {
+      return DownloadTo(sink, limitedOptions, context);
+    }
+    _internal::TransferProgressReporter progressReporter(
+        m_transferCounters,
+        false,
+        options.TransferOptions.ProgressHandler,
+        options.TransferOptions.ProgressInterval);
+
     // Just start downloading using an initial chunk. If it's a small blob, we'll get the whole
     // thing in one shot. If it's a large blob, we'll get its full size in Content-Range and can
     // keep downloading it in chunks.
@@ -343,9 +1216,9 @@ namespace Azure { namespace Storage { namespace Blobs {
       firstChunkOptions.Range.Value().Length = firstChunkLength;
     }
 
-    _internal::FileWriter fileWriter(fileName);
-
-    auto firstChunk = Download(firstChunkOptions, context);
+    const bool validateContentCrc64 = options.TransferOptions.ValidateContentCrc64;
+    auto firstChunk = DownloadFirstChunk(
+        *this, firstChunkOptions, firstChunkLength, validateContentCrc64, context);
     const Azure::ETag eTag = firstChunk.Value.Details.ETag;
 
     const int64_t blobSize = firstChunk.Value.BlobSize;
@@ -363,29 +1236,57 @@ namespace Azure { namespace Storage { namespace Blobs {
       blobRangeSize = blobSize;
     }
     firstChunkLength = std::min(firstChunkLength, blobRangeSize);
+    progressReporter.SetTotalBytes(blobRangeSize);
+
+    std::unique_ptr<_internal::ChunkedCrc64> contentCrc64;
+    if (options.TransferOptions.ComputeContentCrc64 || validateContentCrc64)
+    {
+      contentCrc64 = std::make_unique<_internal::ChunkedCrc64>();
+    }
+
+    // The chunks reach the sink in order, so they are decompressed as they come.
+    std::unique_ptr<_internal::GzipDecoder> gzipDecoder;
+    std::function<void(const uint8_t*, size_t)> contentSink = sink;
+    if (options.TransferOptions.DecompressContent
+        && firstChunk.Value.Details.HttpHeaders.ContentEncoding == "gzip")
+    {
+      gzipDecoder = std::make_unique<_internal::GzipDecoder>();
+      contentSink = [&gzipDecoder, &sink](const uint8_t* data, size_t size) {
+        gzipDecoder->Decode(data, size, sink);
+      };
+    }
 
-    auto bodyStreamToFile = [](Azure::Core::IO::BodyStream& stream,
-                               _internal::FileWriter& fileWriter,
-                               int64_t offset,
-                               int64_t length,
-                               const Azure::Core::Context& context) {
-      constexpr size_t bufferSize = 4 * 1024 * 1024;
-      std::vector<uint8_t> buffer(bufferSize);
+    {
+      // The first chunk can be large, it goes to the sink in pieces no larger than a chunk.
+      _internal::PooledBuffer buffer(
+          m_bufferPool,
+          static_cast<size_t>(
+              std::max<int64_t>(std::min(firstChunkLength, options.TransferOptions.ChunkSize), 1)));
+      int64_t length = firstChunkLength;
       while (length > 0)
       {
-        size_t readSize = static_cast<size_t>(std::min<int64_t>(bufferSize, length));
-        size_t bytesRead = stream.ReadToCount(buffer.data(), readSize, context);
+        size_t readSize = static_cast<size_t>(
+            std::min<int64_t>(static_cast<int64_t>(buffer.GetSize()), length));
+        size_t bytesRead
+            = firstChunk.Value.BodyStream->ReadToCount(buffer.GetData(), readSize, context);
         if (bytesRead != readSize)
         {
           throw Azure::Core::RequestFailedException("Error when reading body stream.");
         }
-        fileWriter.Write(buffer.data(), bytesRead, offset);
+        if (contentCrc64)
+        {
+          contentCrc64->Append(firstChunkLength - length, buffer.GetData(), bytesRead);
+        }
+        contentSink(buffer.GetData(), bytesRead);
         length -= bytesRead;
-        offset += bytesRead;
+        progressReporter.OnBytesTransferred(static_cast<int64_t>(bytesRead));
       }
-    };
-
-    bodyStreamToFile(*(firstChunk.Value.BodyStream), fileWriter, 0, firstChunkLength, context);
+    }
+    if (validateContentCrc64)
+    {
+      VerifyChunkCrc64(
+          *contentCrc64, 0, firstChunkLength, firstChunk.Value.TransactionalContentHash);
+    }
     firstChunk.Value.BodyStream.reset();
 
     auto returnTypeConverter = [](Azure::Response<Models::DownloadBlobResult>& response) {
@@ -400,43 +1301,356 @@ namespace Azure { namespace Storage { namespace Blobs {
     };
     auto ret = returnTypeConverter(firstChunk);
 
-    // Keep downloading the remaining in parallel
-    auto downloadChunkFunc
-        = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-            DownloadBlobOptions chunkOptions;
-            chunkOptions.Range = Core::Http::HttpRange();
-            chunkOptions.Range.Value().Offset = offset;
-            chunkOptions.Range.Value().Length = length;
-            chunkOptions.AccessConditions.IfMatch = eTag;
-            auto chunk = Download(chunkOptions, context);
-            bodyStreamToFile(
-                *(chunk.Value.BodyStream),
-                fileWriter,
-                offset - firstChunkOffset,
-                chunkOptions.Range.Value().Length.Value(),
-                context);
-
-            if (chunkId == numChunks - 1)
-            {
-              ret = returnTypeConverter(chunk);
-              ret.Value.TransactionalContentHash.Reset();
-            }
-          };
+    // Keep downloading the remaining in parallel, and pass the chunks to the sink in order.
+    auto downloadChunkFunc = [&](int64_t offset,
+                                 int64_t length,
+                                 int64_t chunkId,
+                                 int64_t numChunks,
+                                 uint8_t* buffer,
+                                 const Azure::Core::Context& chunkContext) {
+      DownloadBlobOptions chunkOptions;
+      chunkOptions.Range = Core::Http::HttpRange();
+      chunkOptions.Range.Value().Offset = offset;
+      chunkOptions.Range.Value().Length = length;
+      chunkOptions.AccessConditions.IfMatch = eTag;
+      if (validateContentCrc64)
+      {
+        chunkOptions.RangeHashAlgorithm = HashAlgorithm::Crc64;
+      }
+      auto chunk = Download(chunkOptions, chunkContext);
+      int64_t bytesRead
+          = chunk.Value.BodyStream->ReadToCount(buffer, static_cast<size_t>(length), chunkContext);
+      if (bytesRead != length)
+      {
+        throw Azure::Core::RequestFailedException("Error when reading body stream.");
+      }
+      if (contentCrc64)
+      {
+        contentCrc64->Append(offset - firstChunkOffset, buffer, static_cast<size_t>(length));
+      }
+      if (validateContentCrc64)
+      {
+        VerifyChunkCrc64(
+            *contentCrc64, offset - firstChunkOffset, length, chunk.Value.TransactionalContentHash);
+      }
+
+      if (chunkId == numChunks - 1)
+      {
+        ret = returnTypeConverter(chunk);
+        ret.Value.TransactionalContentHash.Reset();
+      }
+      progressReporter.OnBytesTransferred(length);
+    };
 
     int64_t remainingOffset = firstChunkOffset + firstChunkLength;
     int64_t remainingSize = blobRangeSize - firstChunkLength;
 
-    _internal::ConcurrentTransfer(
+    _internal::OrderedConcurrentTransfer(
         remainingOffset,
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        contentSink,
+        context,
+        m_transferScheduler.get(),
+        m_bufferPool,
+        _internal::GetTransferThreadPool(m_bufferPool));
+    if (gzipDecoder)
+    {
+      gzipDecoder->Finish();
+    }
+    progressReporter.OnTransferDone();
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = blobRangeSize;
+    if (options.TransferOptions.ComputeContentCrc64)
+    {
+      ret.Value.ContentCrc64 = contentCrc64->Final();
+    }
     return ret;
   }
 
+  std::unique_ptr<Azure::Response<Models::DownloadBlobToResult>>
+  BlobClient::DownloadFromContentCache(
+      const std::function<void(int64_t size)>& sizeFunc,
+      const std::function<void(const uint8_t* data, size_t size, int64_t offset)>& writeFunc,
+      const DownloadBlobToOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    auto& contentCache = *options.ContentCache;
+    const std::string key = BlobContentCache::GetKey(m_blobUrl);
+    std::string cacheFileName;
+    auto entry = contentCache.Find(key, cacheFileName);
+    if (!entry.HasValue())
+    {
+      return nullptr;
+    }
+
+    Models::DownloadBlobToResult result;
+    std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse;
+    if (BlobContentCache::IsImmutable(m_blobUrl))
+    {
+      // Snapshots and versions don't change, so no request is needed.
+      rawResponse = std::make_unique<Azure::Core::Http::RawResponse>(
+          1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+      rawResponse->SetHeader("ETag", entry.Value().ETag.ToString());
+      rawResponse->SetHeader(
+          "Last-Modified",
+          entry.Value().LastModified.ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    else
+    {
+      auto properties = GetProperties(GetBlobPropertiesOptions(), context);
+      if (properties.Value.ETag != entry.Value().ETag)
+      {
+        contentCache.Remove(key);
+        return nullptr;
+      }
+      auto& details = result.Details;
+      details.CreatedOn = properties.Value.CreatedOn;
+      details.ExpiresOn = std::move(properties.Value.ExpiresOn);
+      details.LastAccessedOn = std::move(properties.Value.LastAccessedOn);
+      details.HttpHeaders = std::move(properties.Value.HttpHeaders);
+      details.Metadata = std::move(properties.Value.Metadata);
+      details.SequenceNumber = std::move(properties.Value.SequenceNumber);
+      details.CommittedBlockCount = std::move(properties.Value.CommittedBlockCount);
+      details.IsSealed = std::move(properties.Value.IsSealed);
+      details.LeaseDuration = std::move(properties.Value.LeaseDuration);
+      details.LeaseState = std::move(properties.Value.LeaseState);
+      details.LeaseStatus = std::move(properties.Value.LeaseStatus);
+      details.IsServerEncrypted = properties.Value.IsServerEncrypted;
+      details.EncryptionKeySha256 = std::move(properties.Value.EncryptionKeySha256);
+      details.EncryptionScope = std::move(properties.Value.EncryptionScope);
+      details.ObjectReplicationDestinationPolicyId
+          = std::move(properties.Value.ObjectReplicationDestinationPolicyId);
+      details.ObjectReplicationSourceProperties
+          = std::move(properties.Value.ObjectReplicationSourceProperties);
+      details.TagCount = std::move(properties.Value.TagCount);
+      details.CopyId = std::move(properties.Value.CopyId);
+      details.CopySource = std::move(properties.Value.CopySource);
+      details.CopyStatus = std::move(properties.Value.CopyStatus);
+      details.CopyStatusDescription = std::move(properties.Value.CopyStatusDescription);
+      details.CopyProgress = std::move(properties.Value.CopyProgress);
+      details.CopyCompletedOn = std::move(properties.Value.CopyCompletedOn);
+      details.VersionId = std::move(properties.Value.VersionId);
+      details.IsCurrentVersion = std::move(properties.Value.IsCurrentVersion);
+      rawResponse = std::move(properties.RawResponse);
+    }
+    result.BlobType = entry.Value().BlobType;
+    result.BlobSize = entry.Value().Size;
+    result.Details.ETag = entry.Value().ETag;
+    result.Details.LastModified = entry.Value().LastModified;
+
+    int64_t offset = 0;
+    int64_t length = entry.Value().Size;
+    if (options.Range.HasValue())
+    {
+      // The service fails the ranges starting past the end of the blob.
+      offset = options.Range.Value().Offset;
+      if (offset >= length && length != 0)
+      {
+        return nullptr;
+      }
+      length = std::max<int64_t>(length - offset, 0);
+      if (options.Range.Value().Length.HasValue())
+      {
+        length = std::min(length, options.Range.Value().Length.Value());
+      }
+    }
+
+    std::unique_ptr<_internal::FileReader> fileReader;
+    try
+    {
+      fileReader = std::make_unique<_internal::FileReader>(cacheFileName);
+    }
+    catch (const std::exception&)
+    {
+      contentCache.Remove(key);
+      return nullptr;
+    }
+    sizeFunc(length);
+
+    _internal::TransferProgressReporter progressReporter(
+        m_transferCounters,
+        false,
+        options.TransferOptions.ProgressHandler,
+        options.TransferOptions.ProgressInterval);
+    progressReporter.SetTotalBytes(length);
+    const int64_t bufferSize = std::min<int64_t>(length, AsyncFileIoBufferSize);
+    _internal::PooledBuffer buffer(
+        m_bufferPool, static_cast<size_t>(std::max<int64_t>(bufferSize, 1)));
+    for (int64_t position = 0; position < length;)
+    {
+      const size_t readSize = fileReader->Read(
+          buffer.GetData(),
+          static_cast<size_t>(std::min<int64_t>(length - position, buffer.GetSize())),
+          offset + position);
+      if (readSize == 0)
+      {
+        throw std::runtime_error("Failed to read file.");
+      }
+      writeFunc(buffer.GetData(), readSize, position);
+      position += readSize;
+      progressReporter.OnBytesTransferred(readSize);
+    }
+    progressReporter.OnTransferDone();
+
+    result.ContentRange.Offset = offset;
+    result.ContentRange.Length = length;
+    return std::make_unique<Azure::Response<Models::DownloadBlobToResult>>(
+        std::move(result), std::move(rawResponse));
+  }
+
+  void BlobClient::StoreInContentCache(
+      const Models::DownloadBlobToResult& result,
+      const std::function<void(const std::string& fileName)>& writeFunc,
+      const DownloadBlobToOptions& options) const
+  {
+    BlobContentCache::Entry entry;
+    entry.Key = BlobContentCache::GetKey(m_blobUrl);
+    entry.ETag = result.Details.ETag;
+    entry.LastModified = result.Details.LastModified;
+    entry.BlobType = result.BlobType;
+    entry.Size = result.BlobSize;
+    options.ContentCache->Store(std::move(entry), writeFunc);
+  }
+
+  Azure::Response<Models::DownloadBlobToResult> BlobClient::DownloadDecryptedTo(
+      const std::function<void(int64_t size)>& sizeFunc,
+      const std::function<void(const uint8_t* data, size_t size, int64_t offset)>& writeFunc,
+      const DownloadBlobToOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    const auto& keyEncryptionKey = options.ClientSideEncryption.Value().KeyEncryptionKey;
+    if (!keyEncryptionKey)
+    {
+      throw Azure::Core::RequestFailedException("ClientSideEncryption needs a KeyEncryptionKey.");
+    }
+    if (options.Range.HasValue() || options.TransferOptions.Journal
+        || options.TransferOptions.ComputeContentCrc64
+        || options.TransferOptions.ValidateContentCrc64
+        || options.TransferOptions.DecompressContent)
+    {
+      throw Azure::Core::RequestFailedException(
+          "ClientSideEncryption can't be used with a Range, a transfer journal, "
+          "ComputeContentCrc64, ValidateContentCrc64 or DecompressContent.");
+    }
+
+    // The content key is unwrapped before the chunks are downloaded, and the chunks are aligned
+    // on the encrypted segments so that each chunk is decrypted on its own.
+    auto properties = GetProperties(GetBlobPropertiesOptions(), context);
+    const Azure::ETag eTag = properties.Value.ETag;
+    const int64_t blobSize = properties.Value.BlobSize;
+    std::unique_ptr<_detail::SegmentedContentCipher> cipher;
+    auto encryptionData = properties.Value.Metadata.find(_detail::EncryptionDataMetadataKey);
+    if (encryptionData != properties.Value.Metadata.end())
+    {
+      cipher = std::make_unique<_detail::SegmentedContentCipher>(
+          _detail::SegmentedContentCipher::FromEncryptionData(
+              encryptionData->second, blobSize, *keyEncryptionKey, context));
+    }
+    else if (options.ClientSideEncryption.Value().RequireEncryption)
+    {
+      throw Azure::Core::RequestFailedException(
+          "The blob isn't encrypted with client-side encryption.");
+    }
+    const int64_t contentSize = cipher ? cipher->GetDecryptedSize(blobSize) : blobSize;
+    sizeFunc(contentSize);
+
+    _internal::TransferProgressReporter progressReporter(
+        m_transferCounters,
+        false,
+        options.TransferOptions.ProgressHandler,
+        options.TransferOptions.ProgressInterval);
+    progressReporter.SetTotalBytes(blobSize);
+
+    int64_t chunkSize = std::max<int64_t>(options.TransferOptions.ChunkSize, 1);
+    if (cipher)
+    {
+      const int64_t encryptedSegmentSize = cipher->GetEncryptedSegmentSize();
+      chunkSize = (chunkSize + encryptedSegmentSize - 1) / encryptedSegmentSize
+          * encryptedSegmentSize;
+    }
+
+    auto returnTypeConverter = [](Azure::Response<Models::DownloadBlobResult>& response) {
+      Models::DownloadBlobToResult ret;
+      ret.BlobType = std::move(response.Value.BlobType);
+      ret.ContentRange = std::move(response.Value.ContentRange);
+      ret.BlobSize = response.Value.BlobSize;
+      ret.TransactionalContentHash = std::move(response.Value.TransactionalContentHash);
+      ret.Details = std::move(response.Value.Details);
+      return Azure::Response<Models::DownloadBlobToResult>(
+          std::move(ret), std::move(response.RawResponse));
+    };
+    std::unique_ptr<Azure::Response<Models::DownloadBlobToResult>> ret;
+
+    auto downloadChunkFunc = [&](int64_t offset,
+                                 int64_t length,
+                                 int64_t chunkId,
+                                 int64_t,
+                                 const Azure::Core::Context& chunkContext) {
+      DownloadBlobOptions chunkOptions;
+      chunkOptions.Range = Core::Http::HttpRange();
+      chunkOptions.Range.Value().Offset = offset;
+      chunkOptions.Range.Value().Length = length;
+      chunkOptions.AccessConditions.IfMatch = eTag;
+      auto chunk = Download(chunkOptions, chunkContext);
+      _internal::PooledBuffer buffer(m_bufferPool, static_cast<size_t>(length));
+      if (chunk.Value.BodyStream->ReadToCount(buffer.GetData(), buffer.GetSize(), chunkContext)
+          != buffer.GetSize())
+      {
+        throw Azure::Core::RequestFailedException("Error when reading body stream.");
+      }
+      if (cipher)
+      {
+        _internal::PooledBuffer decrypted(
+            m_bufferPool, static_cast<size_t>(cipher->GetDecryptedSize(length)));
+        cipher->Decrypt(buffer.GetData(), buffer.GetSize(), decrypted.GetData());
+        writeFunc(
+            decrypted.GetData(),
+            decrypted.GetSize(),
+            offset / cipher->GetEncryptedSegmentSize() * cipher->GetSegmentSize());
+      }
+      else
+      {
+        writeFunc(buffer.GetData(), buffer.GetSize(), offset);
+      }
+      if (chunkId == 0)
+      {
+        ret = std::make_unique<Azure::Response<Models::DownloadBlobToResult>>(
+            returnTypeConverter(chunk));
+      }
+      progressReporter.OnBytesTransferred(length);
+    };
+
+    if (blobSize == 0)
+    {
+      DownloadBlobOptions downloadOptions;
+      downloadOptions.AccessConditions.IfMatch = eTag;
+      auto response = Download(downloadOptions, context);
+      ret = std::make_unique<Azure::Response<Models::DownloadBlobToResult>>(
+          returnTypeConverter(response));
+    }
+    else
+    {
+      _internal::ConcurrentTransfer(
+          0,
+          blobSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          downloadChunkFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    progressReporter.OnTransferDone();
+    ret->Value.BlobSize = contentSize;
+    ret->Value.ContentRange.Offset = 0;
+    ret->Value.ContentRange.Length = contentSize;
+    ret->Value.TransactionalContentHash.Reset();
+    return std::move(*ret);
+  }
+
   Azure::Response<Models::BlobProperties> BlobClient::GetProperties(
       const GetBlobPropertiesOptions& options,
       const Azure::Core::Context& context) const
@@ -454,6 +1668,20 @@ namespace Azure { namespace Storage { namespace Blobs {
       protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.Value().KeyHash;
       protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm;
     }
+    // The properties got with conditions aren't served from the cache, they are cached though.
+    const bool hasAccessConditions = protocolLayerOptions.LeaseId.HasValue()
+        || protocolLayerOptions.IfModifiedSince.HasValue()
+        || protocolLayerOptions.IfUnmodifiedSince.HasValue()
+        || protocolLayerOptions.IfMatch.HasValue() || protocolLayerOptions.IfNoneMatch.HasValue()
+        || protocolLayerOptions.IfTags.HasValue();
+    if (m_propertiesCache && !hasAccessConditions)
+    {
+      auto cachedProperties = m_propertiesCache->Get(m_blobUrl.GetAbsoluteUrl());
+      if (cachedProperties.HasValue())
+      {
+        return std::move(cachedProperties.Value());
+      }
+    }
     auto response = _detail::BlobRestClient::Blob::GetProperties(
         *m_pipeline, m_blobUrl, protocolLayerOptions, _internal::WithReplicaStatus(context));
     if (response.Value.AccessTier.HasValue() && !response.Value.IsAccessTierInferred.HasValue())
@@ -473,6 +1701,10 @@ namespace Azure { namespace Storage { namespace Blobs {
     {
       response.Value.IsSealed = false;
     }
+    if (m_propertiesCache)
+    {
+      m_propertiesCache->Set(m_blobUrl.GetAbsoluteUrl(), response);
+    }
     return response;
   }
 
@@ -489,8 +1721,13 @@ namespace Azure { namespace Storage { namespace Blobs {
     protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
     protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
     protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
-    return _detail::BlobRestClient::Blob::SetHttpHeaders(
+    auto response = _detail::BlobRestClient::Blob::SetHttpHeaders(
         *m_pipeline, m_blobUrl, protocolLayerOptions, context);
+    if (m_propertiesCache)
+    {
+      m_propertiesCache->Remove(m_blobUrl.GetAbsoluteUrl());
+    }
+    return response;
   }
 
   Azure::Response<Models::SetBlobMetadataResult> BlobClient::SetMetadata(
@@ -513,8 +1750,13 @@ namespace Azure { namespace Storage { namespace Blobs {
       protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm;
     }
     protocolLayerOptions.EncryptionScope = m_encryptionScope;
-    return _detail::BlobRestClient::Blob::SetMetadata(
+    auto response = _detail::BlobRestClient::Blob::SetMetadata(
         *m_pipeline, m_blobUrl, protocolLayerOptions, context);
+    if (m_propertiesCache)
+    {
+      m_propertiesCache->Remove(m_blobUrl.GetAbsoluteUrl());
+    }
+    return response;
   }
 
   Azure::Response<Models::SetBlobAccessTierResult> BlobClient::SetAccessTier(
@@ -527,8 +1769,13 @@ namespace Azure { namespace Storage { namespace Blobs {
     protocolLayerOptions.RehydratePriority = options.RehydratePriority;
     protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
     protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
-    return _detail::BlobRestClient::Blob::SetAccessTier(
+    auto response = _detail::BlobRestClient::Blob::SetAccessTier(
         *m_pipeline, m_blobUrl, protocolLayerOptions, context);
+    if (m_propertiesCache)
+    {
+      m_propertiesCache->Remove(m_blobUrl.GetAbsoluteUrl());
+    }
+    return response;
   }
 
   StartBlobCopyOperation BlobClient::StartCopyFromUri(
@@ -599,6 +1846,174 @@ namespace Azure { namespace Storage { namespace Blobs {
         *m_pipeline, m_blobUrl, protocolLayerOptions, context);
   }
 
+  Azure::Response<Models::DownloadBlobRangesResult> BlobClient::DownloadRanges(
+      const std::vector<Core::Http::HttpRange>& ranges,
+      const DownloadBlobRangesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    if (ranges.empty())
+    {
+      throw std::invalid_argument("Ranges cannot be empty.");
+    }
+    for (const auto& range : ranges)
+    {
+      if (range.Offset < 0 || !range.Length.HasValue() || range.Length.Value() <= 0)
+      {
+        throw std::invalid_argument("Each range must have a positive length.");
+      }
+    }
+
+    // The ranges downloaded by a single request.
+    struct MergedRange final
+    {
+      int64_t Offset;
+      int64_t End;
+      std::vector<size_t> RangeIds;
+    };
+    std::vector<size_t> rangeIds(ranges.size());
+    for (size_t i = 0; i < rangeIds.size(); ++i)
+    {
+      rangeIds[i] = i;
+    }
+    std::stable_sort(rangeIds.begin(), rangeIds.end(), [&ranges](size_t lhs, size_t rhs) {
+      return ranges[lhs].Offset < ranges[rhs].Offset;
+    });
+    std::vector<MergedRange> mergedRanges;
+    for (auto rangeId : rangeIds)
+    {
+      const auto& range = ranges[rangeId];
+      const int64_t end = range.Offset + range.Length.Value();
+      if (!mergedRanges.empty())
+      {
+        auto& last = mergedRanges.back();
+        const int64_t mergedEnd = std::max(last.End, end);
+        if (range.Offset - last.End <= options.TransferOptions.MaxGapSize
+            && mergedEnd - last.Offset <= options.TransferOptions.MaxMergedRangeSize)
+        {
+          last.End = mergedEnd;
+          last.RangeIds.push_back(rangeId);
+          continue;
+        }
+      }
+      mergedRanges.push_back(MergedRange{range.Offset, end, {rangeId}});
+    }
+
+    Models::DownloadBlobRangesResult ret;
+    ret.Contents.resize(ranges.size());
+    std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse;
+    std::atomic<int64_t> downloadedSize{0};
+
+    // Each merged range writes the contents of its own ranges.
+    auto downloadMergedRange = [&](const MergedRange& mergedRange,
+                                   const BlobAccessConditions& accessConditions,
+                                   const Azure::Core::Context& rangeContext) {
+      DownloadBlobOptions downloadOptions;
+      downloadOptions.Range = Core::Http::HttpRange();
+      downloadOptions.Range.Value().Offset = mergedRange.Offset;
+      downloadOptions.Range.Value().Length = mergedRange.End - mergedRange.Offset;
+      downloadOptions.AccessConditions = accessConditions;
+      auto download = Download(downloadOptions, rangeContext);
+
+      Core::IO::SharedBuffer content(download.Value.BodyStream->ReadToEnd(rangeContext));
+      downloadedSize += static_cast<int64_t>(content.GetSize());
+      for (auto rangeId : mergedRange.RangeIds)
+      {
+        const auto& range = ranges[rangeId];
+        const size_t offset = static_cast<size_t>(
+            std::min<int64_t>(range.Offset - mergedRange.Offset, content.GetSize()));
+        const size_t length = static_cast<size_t>(
+            std::min<int64_t>(range.Length.Value(), content.GetSize() - offset));
+        ret.Contents[rangeId] = content.Slice(offset, length);
+      }
+      return download;
+    };
+    auto setProperties = [&](Azure::Response<Models::DownloadBlobResult>& download) {
+      ret.ETag = download.Value.Details.ETag;
+      ret.LastModified = download.Value.Details.LastModified;
+      ret.BlobSize = download.Value.BlobSize;
+      rawResponse = std::move(download.RawResponse);
+    };
+
+    size_t firstParallelRange = 0;
+    BlobAccessConditions parallelAccessConditions = options.AccessConditions;
+    if (!options.AccessConditions.IfMatch.HasValue())
+    {
+      // Pins the version of the blob the other ranges are downloaded from.
+      auto download = downloadMergedRange(mergedRanges[0], options.AccessConditions, context);
+      setProperties(download);
+      parallelAccessConditions = BlobAccessConditions();
+      parallelAccessConditions.IfMatch = ret.ETag;
+      parallelAccessConditions.LeaseId = options.AccessConditions.LeaseId;
+      firstParallelRange = 1;
+    }
+
+    auto downloadChunkFunc = [&](int64_t chunkId,
+                                 int64_t,
+                                 int64_t,
+                                 int64_t,
+                                 const Azure::Core::Context& chunkContext) {
+      const size_t mergedRangeId = firstParallelRange + static_cast<size_t>(chunkId);
+      auto download = downloadMergedRange(
+          mergedRanges[mergedRangeId], parallelAccessConditions, chunkContext);
+      if (mergedRangeId == 0)
+      {
+        setProperties(download);
+      }
+    };
+    if (mergedRanges.size() > firstParallelRange)
+    {
+      _internal::ConcurrentTransfer(
+          0,
+          static_cast<int64_t>(mergedRanges.size() - firstParallelRange),
+          1,
+          options.TransferOptions.Concurrency,
+          downloadChunkFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    ret.DownloadedSize = downloadedSize;
+
+    return Azure::Response<Models::DownloadBlobRangesResult>(
+        std::move(ret), std::move(rawResponse));
+  }
+
+  Azure::Response<Models::QueryBlobResult> BlobClient::Query(
+      const std::string& querySqlExpression,
+      const QueryBlobOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    _detail::BlobRestClient::Blob::QueryBlobOptions protocolLayerOptions;
+    protocolLayerOptions.QueryExpression = querySqlExpression;
+    if (options.InputTextConfiguration.HasValue())
+    {
+      protocolLayerOptions.InputTextConfiguration
+          = options.InputTextConfiguration.Value().m_configuration;
+    }
+    if (options.OutputTextConfiguration.HasValue())
+    {
+      protocolLayerOptions.OutputTextConfiguration
+          = options.OutputTextConfiguration.Value().m_configuration;
+    }
+    protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
+    protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
+    protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
+    protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
+    protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
+    protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
+    if (m_customerProvidedKey.HasValue())
+    {
+      protocolLayerOptions.EncryptionKey = m_customerProvidedKey.Value().Key;
+      protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.Value().KeyHash;
+      protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm;
+    }
+    auto response = _detail::BlobRestClient::Blob::Query(
+        *m_pipeline, m_blobUrl, protocolLayerOptions, context);
+    response.Value.BodyStream = std::make_unique<_detail::BlobQueryBodyStream>(
+        std::move(response.Value.BodyStream), options.ProgressHandler, options.ErrorHandler);
+    return response;
+  }
+
   Azure::Response<Models::DeleteBlobResult> BlobClient::Delete(
       const DeleteBlobOptions& options,
       const Azure::Core::Context& context) const
@@ -611,8 +2026,13 @@ namespace Azure { namespace Storage { namespace Blobs {
     protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
     protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
     protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
-    return _detail::BlobRestClient::Blob::Delete(
+    auto response = _detail::BlobRestClient::Blob::Delete(
         *m_pipeline, m_blobUrl, protocolLayerOptions, context);
+    if (m_propertiesCache)
+    {
+      m_propertiesCache->Remove(m_blobUrl.GetAbsoluteUrl());
+    }
+    return response;
   }
 
   Azure::Response<Models::DeleteBlobResult> BlobClient::DeleteIfExists(
@@ -3,8 +3,21 @@
 
 #include "azure/storage/blobs/blob_container_client.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+#include <azure/core/base64.hpp>
+#include <azure/core/cryptography/hash.hpp>
 #include <azure/core/http/policies/policy.hpp>
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
 #include <azure/storage/common/internal/constants.hpp>
+#include <azure/storage/common/internal/file_io.hpp>
 #include <azure/storage/common/internal/shared_key_policy.hpp>
 #include <azure/storage/common/internal/storage_per_retry_policy.hpp>
 #include <azure/storage/common/internal/storage_service_version_policy.hpp>
@@ -19,6 +32,134 @@
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace {
+    // Fills the fields the service omits when they have their default value.
+    void FillBlobItemDefaults(Models::BlobItem& item)
+    {
+      if (item.Details.AccessTier.HasValue() && !item.Details.IsAccessTierInferred.HasValue())
+      {
+        item.Details.IsAccessTierInferred = false;
+      }
+      if (item.VersionId.HasValue() && !item.IsCurrentVersion.HasValue())
+      {
+        item.IsCurrentVersion = false;
+      }
+      if (item.BlobType == Models::BlobType::AppendBlob && !item.Details.IsSealed)
+      {
+        item.Details.IsSealed = false;
+      }
+      if (item.Details.CopyStatus.HasValue() && !item.Details.IsIncrementalCopy.HasValue())
+      {
+        item.Details.IsIncrementalCopy = false;
+      }
+    }
+
+    // The metadata of a synchronized blob recording the last write time of its file.
+    constexpr static const char* SyncLastWriteTimeMetadataKey = "synclastwritetime";
+
+    struct SyncHashCacheEntry final
+    {
+      int64_t Size = 0;
+      int64_t LastWriteTime = 0;
+      std::vector<uint8_t> Md5;
+    };
+
+    // Each line of the cache is the size, the last write time, the Base64 MD5 and the relative
+    // path of a file, separated by spaces. Lines which can't be parsed are ignored.
+    std::map<std::string, SyncHashCacheEntry> ReadSyncHashCache(const std::string& fileName)
+    {
+      std::map<std::string, SyncHashCacheEntry> cache;
+      std::string content;
+      try
+      {
+        _internal::FileReader fileReader(fileName);
+        content.resize(static_cast<size_t>(fileReader.GetFileSize()));
+        content.resize(
+            fileReader.Read(reinterpret_cast<uint8_t*>(&content[0]), content.size(), 0));
+      }
+      catch (const std::runtime_error&)
+      {
+        // There's no cache yet.
+        return cache;
+      }
+
+      size_t lineBegin = 0;
+      while (lineBegin < content.size())
+      {
+        const size_t lineEnd = std::min(content.find('\n', lineBegin), content.size());
+        const std::string line = content.substr(lineBegin, lineEnd - lineBegin);
+        lineBegin = lineEnd + 1;
+        const size_t sizeEnd = line.find(' ');
+        if (sizeEnd == std::string::npos)
+        {
+          continue;
+        }
+        const size_t timeEnd = line.find(' ', sizeEnd + 1);
+        if (timeEnd == std::string::npos)
+        {
+          continue;
+        }
+        const size_t md5End = line.find(' ', timeEnd + 1);
+        if (md5End == std::string::npos)
+        {
+          continue;
+        }
+        try
+        {
+          SyncHashCacheEntry entry;
+          entry.Size = std::stoll(line.substr(0, sizeEnd));
+          entry.LastWriteTime = std::stoll(line.substr(sizeEnd + 1, timeEnd - sizeEnd - 1));
+          entry.Md5 = Azure::Core::Convert::Base64Decode(
+              line.substr(timeEnd + 1, md5End - timeEnd - 1));
+          cache[line.substr(md5End + 1)] = std::move(entry);
+        }
+        catch (const std::exception&)
+        {
+          continue;
+        }
+      }
+      return cache;
+    }
+
+    void WriteSyncHashCache(
+        const std::string& fileName,
+        const std::map<std::string, SyncHashCacheEntry>& cache)
+    {
+      std::string content;
+      for (const auto& entry : cache)
+      {
+        content += std::to_string(entry.second.Size) + " "
+            + std::to_string(entry.second.LastWriteTime) + " "
+            + Azure::Core::Convert::Base64Encode(entry.second.Md5) + " " + entry.first + "\n";
+      }
+      _internal::FileWriter fileWriter(fileName);
+      if (!content.empty())
+      {
+        fileWriter.Write(reinterpret_cast<const uint8_t*>(content.data()), content.size(), 0);
+      }
+    }
+
+    std::vector<uint8_t> ComputeFileMd5(const std::string& fileName)
+    {
+      _internal::FileReader fileReader(fileName);
+      std::vector<uint8_t> buffer(
+          static_cast<size_t>(std::min<int64_t>(fileReader.GetFileSize(), 4 * 1024 * 1024)));
+      Azure::Core::Cryptography::Md5Hash md5;
+      int64_t offset = 0;
+      while (offset < fileReader.GetFileSize())
+      {
+        const size_t bytesRead = fileReader.Read(buffer.data(), buffer.size(), offset);
+        if (bytesRead == 0)
+        {
+          break;
+        }
+        md5.Append(buffer.data(), bytesRead);
+        offset += static_cast<int64_t>(bytesRead);
+      }
+      return md5.Final();
+    }
+  } // namespace
+
   BlobContainerClient BlobContainerClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& blobContainerName,
@@ -52,7 +193,9 @@ namespace Azure { namespace Storage { namespace Blobs {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_blobContainerUrl.GetHost(), newOptions.SecondaryHostForRetryReads));
+        m_blobContainerUrl.GetHost(),
+        newOptions.SecondaryHostForRetryReads,
+        newOptions.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     perOperationPolicies.emplace_back(
         std::make_unique<_internal::StorageServiceVersionPolicy>(newOptions.ApiVersion));
@@ -73,7 +216,9 @@ namespace Azure { namespace Storage { namespace Blobs {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_blobContainerUrl.GetHost(), options.SecondaryHostForRetryReads));
+        m_blobContainerUrl.GetHost(),
+        options.SecondaryHostForRetryReads,
+        options.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     {
       Azure::Core::Credentials::TokenRequestContext tokenContext;
@@ -96,12 +241,15 @@ namespace Azure { namespace Storage { namespace Blobs {
       const std::string& blobContainerUrl,
       const BlobClientOptions& options)
       : m_blobContainerUrl(blobContainerUrl), m_customerProvidedKey(options.CustomerProvidedKey),
-        m_encryptionScope(options.EncryptionScope)
+        m_encryptionScope(options.EncryptionScope), m_transferScheduler(options.TransferScheduler),
+        m_bufferPool(options.BufferPool), m_propertiesCache(options.PropertiesCache)
   {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_blobContainerUrl.GetHost(), options.SecondaryHostForRetryReads));
+        m_blobContainerUrl.GetHost(),
+        options.SecondaryHostForRetryReads,
+        options.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     perOperationPolicies.emplace_back(
         std::make_unique<_internal::StorageServiceVersionPolicy>(options.ApiVersion));
@@ -111,28 +259,38 @@ namespace Azure { namespace Storage { namespace Blobs {
         _detail::PackageVersion::ToString(),
         std::move(perRetryPolicies),
         std::move(perOperationPolicies));
+    // The constructors with a credential replace the pipeline, this one stays without it.
+    m_sourcePipeline = m_pipeline;
   }
 
   BlobClient BlobContainerClient::GetBlobClient(const std::string& blobName) const
   {
     auto blobUrl = m_blobContainerUrl;
     blobUrl.AppendPath(_internal::UrlEncodePath(blobName));
-    return BlobClient(std::move(blobUrl), m_pipeline, m_customerProvidedKey, m_encryptionScope);
+    return BlobClient(
+        std::move(blobUrl),
+        m_pipeline,
+        m_customerProvidedKey,
+        m_encryptionScope,
+        m_transferScheduler,
+        m_bufferPool,
+        m_propertiesCache,
+        m_sourcePipeline);
   }
 
   BlockBlobClient BlobContainerClient::GetBlockBlobClient(const std::string& blobName) const
   {
-    return GetBlobClient(blobName).AsBlockBlobClient();
+    return BlockBlobClient(GetBlobClient(blobName));
   }
 
   AppendBlobClient BlobContainerClient::GetAppendBlobClient(const std::string& blobName) const
   {
-    return GetBlobClient(blobName).AsAppendBlobClient();
+    return AppendBlobClient(GetBlobClient(blobName));
   }
 
   PageBlobClient BlobContainerClient::GetPageBlobClient(const std::string& blobName) const
   {
-    return GetBlobClient(blobName).AsPageBlobClient();
+    return PageBlobClient(GetBlobClient(blobName));
   }
 
   Azure::Response<Models::CreateBlobContainerResult> BlobContainerClient::Create(
@@ -249,22 +407,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         _internal::WithReplicaStatus(context));
     for (auto& i : response.Value.Items)
     {
-      if (i.Details.AccessTier.HasValue() && !i.Details.IsAccessTierInferred.HasValue())
-      {
-        i.Details.IsAccessTierInferred = false;
-      }
-      if (i.VersionId.HasValue() && !i.IsCurrentVersion.HasValue())
-      {
-        i.IsCurrentVersion = false;
-      }
-      if (i.BlobType == Models::BlobType::AppendBlob && !i.Details.IsSealed)
-      {
-        i.Details.IsSealed = false;
-      }
-      if (i.Details.CopyStatus.HasValue() && !i.Details.IsIncrementalCopy.HasValue())
-      {
-        i.Details.IsIncrementalCopy = false;
-      }
+      FillBlobItemDefaults(i);
     }
 
     ListBlobsPagedResponse pagedResponse;
@@ -275,49 +418,247 @@ namespace Azure { namespace Storage { namespace Blobs {
     pagedResponse.m_blobContainerClient = std::make_shared<BlobContainerClient>(*this);
     pagedResponse.m_operationOptions = options;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken;
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
     pagedResponse.RawResponse = std::move(response.RawResponse);
 
     return pagedResponse;
   }
 
-  ListBlobsByHierarchyPagedResponse BlobContainerClient::ListBlobsByHierarchy(
-      const std::string& delimiter,
+  ListBlobsCompactPagedResponse BlobContainerClient::ListBlobsCompact(
+      const ListBlobsCompactOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    _detail::BlobRestClient::BlobContainer::ListBlobsOptions protocolLayerOptions;
+    protocolLayerOptions.Prefix = options.Prefix;
+    if (options.ContinuationToken.HasValue() && !options.ContinuationToken.Value().empty())
+    {
+      protocolLayerOptions.ContinuationToken = options.ContinuationToken;
+    }
+    protocolLayerOptions.MaxResults = options.PageSizeHint;
+    if (options.IncludeDeleted)
+    {
+      protocolLayerOptions.Include = Models::ListBlobsIncludeFlags::Deleted;
+    }
+    auto response = _detail::BlobRestClient::BlobContainer::ListBlobsCompact(
+        *m_pipeline,
+        m_blobContainerUrl,
+        protocolLayerOptions,
+        options.Fields,
+        _internal::WithReplicaStatus(context));
+
+    ListBlobsCompactPagedResponse pagedResponse;
+    pagedResponse.ServiceEndpoint = std::move(response.Value.ServiceEndpoint);
+    pagedResponse.BlobContainerName = std::move(response.Value.BlobContainerName);
+    pagedResponse.Prefix = std::move(response.Value.Prefix);
+    // Moving the arena keeps its buffer, which the blobs point to.
+    pagedResponse.Blobs = std::move(response.Value.Items);
+    pagedResponse.m_arena = std::move(response.Value.Arena);
+    pagedResponse.m_blobContainerClient = std::make_shared<BlobContainerClient>(*this);
+    pagedResponse.m_operationOptions = options;
+    pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
+    pagedResponse.RawResponse = std::move(response.RawResponse);
+
+    return pagedResponse;
+  }
+
+  ListBlobsPageStream BlobContainerClient::ListBlobsStreaming(
       const ListBlobsOptions& options,
       const Azure::Core::Context& context) const
   {
-    _detail::BlobRestClient::BlobContainer::ListBlobsByHierarchyOptions protocolLayerOptions;
+    _detail::BlobRestClient::BlobContainer::ListBlobsOptions protocolLayerOptions;
     protocolLayerOptions.Prefix = options.Prefix;
-    protocolLayerOptions.Delimiter = delimiter;
     if (options.ContinuationToken.HasValue() && !options.ContinuationToken.Value().empty())
     {
       protocolLayerOptions.ContinuationToken = options.ContinuationToken;
     }
     protocolLayerOptions.MaxResults = options.PageSizeHint;
     protocolLayerOptions.Include = options.Include;
-    auto response = _detail::BlobRestClient::BlobContainer::ListBlobsByHierarchy(
+    auto reader = _detail::BlobRestClient::BlobContainer::ListBlobsStreaming(
         *m_pipeline,
         m_blobContainerUrl,
         protocolLayerOptions,
         _internal::WithReplicaStatus(context));
-    for (auto& i : response.Value.Items)
+
+    ListBlobsPageStream pageStream;
+    // The fields of the page come before its blobs, reading the first blob reads them.
+    pageStream.m_nextBlob = reader->ReadNext();
+    pageStream.ServiceEndpoint = reader->Result.ServiceEndpoint;
+    pageStream.BlobContainerName = reader->Result.BlobContainerName;
+    pageStream.Prefix = reader->Result.Prefix;
+    // The reader has extracted the body stream, the response only keeps the status and headers.
+    pageStream.RawResponse = std::move(reader->RawResponse);
+    pageStream.m_reader = std::move(reader);
+    pageStream.m_blobContainerClient = std::make_shared<BlobContainerClient>(*this);
+    pageStream.m_operationOptions = options;
+    pageStream.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
+    if (!pageStream.m_nextBlob.HasValue())
+    {
+      pageStream.NextPageToken
+          = pageStream.m_reader->Result.ContinuationToken.ValueOr(std::string());
+    }
+    return pageStream;
+  }
+
+  Azure::Nullable<Models::BlobItem> ListBlobsPageStream::ReadNextBlob()
+  {
+    Azure::Nullable<Models::BlobItem> blob;
+    if (m_nextBlob.HasValue())
+    {
+      blob = std::move(m_nextBlob);
+      m_nextBlob.Reset();
+    }
+    else if (!NextPageToken.HasValue())
+    {
+      blob = m_reader->ReadNext();
+    }
+    if (!blob.HasValue())
+    {
+      NextPageToken = m_reader->Result.ContinuationToken.ValueOr(std::string());
+      return blob;
+    }
+    FillBlobItemDefaults(blob.Value());
+    return blob;
+  }
+
+  void BlobContainerClient::ListBlobsParallel(
+      const std::function<void(std::vector<Models::BlobItem>)>& pageReceivedFunc,
+      const ListBlobsParallelOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    if (options.PartitionDepth < 1)
+    {
+      throw std::invalid_argument("PartitionDepth must be at least 1.");
+    }
+    if (options.Delimiter.empty())
     {
-      if (i.Details.AccessTier.HasValue() && !i.Details.IsAccessTierInferred.HasValue())
+      throw std::invalid_argument("Delimiter cannot be empty.");
+    }
+
+    struct Partition final
+    {
+      std::string Prefix;
+      int32_t Depth;
+    };
+
+    std::mutex mutex;
+    std::condition_variable partitionsChanged;
+    std::deque<Partition> partitions{Partition{options.Prefix.ValueOr(std::string()), 0}};
+    int numListing = 0;
+    std::exception_ptr firstError;
+    std::mutex pageReceivedMutex;
+
+    auto deliverPage = [&](std::vector<Models::BlobItem> blobs) {
+      if (!blobs.empty())
+      {
+        std::lock_guard<std::mutex> guard(pageReceivedMutex);
+        pageReceivedFunc(std::move(blobs));
+      }
+    };
+
+    auto listPartition = [&](const Partition& partition) {
+      ListBlobsOptions listOptions;
+      if (!partition.Prefix.empty())
       {
-        i.Details.IsAccessTierInferred = false;
+        listOptions.Prefix = partition.Prefix;
       }
-      if (i.VersionId.HasValue() && !i.IsCurrentVersion.HasValue())
+      listOptions.PageSizeHint = options.PageSizeHint;
+      listOptions.Include = options.Include;
+      if (partition.Depth < options.PartitionDepth)
       {
-        i.IsCurrentVersion = false;
+        // The virtual directories of this level become new partitions, the blobs next to them
+        // are listed here.
+        for (auto page = ListBlobsByHierarchy(options.Delimiter, listOptions, context);
+             page.HasPage();
+             page.MoveToNextPage(context))
+        {
+          if (!page.BlobPrefixes.empty())
+          {
+            std::lock_guard<std::mutex> guard(mutex);
+            for (auto& prefix : page.BlobPrefixes)
+            {
+              partitions.push_back(Partition{std::move(prefix), partition.Depth + 1});
+            }
+          }
+          partitionsChanged.notify_all();
+          deliverPage(std::move(page.Blobs));
+        }
       }
-      if (i.BlobType == Models::BlobType::AppendBlob && !i.Details.IsSealed)
+      else
       {
-        i.Details.IsSealed = false;
+        for (auto page = ListBlobs(listOptions, context); page.HasPage();
+             page.MoveToNextPage(context))
+        {
+          deliverPage(std::move(page.Blobs));
+        }
       }
-      if (i.Details.CopyStatus.HasValue() && !i.Details.IsIncrementalCopy.HasValue())
+    };
+
+    auto threadFunc = [&]() {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (true)
       {
-        i.Details.IsIncrementalCopy = false;
+        // Partitions being listed may still discover new ones.
+        partitionsChanged.wait(
+            lock, [&]() { return firstError || !partitions.empty() || numListing == 0; });
+        if (firstError || partitions.empty())
+        {
+          break;
+        }
+        auto partition = std::move(partitions.front());
+        partitions.pop_front();
+        ++numListing;
+        lock.unlock();
+        std::exception_ptr error;
+        try
+        {
+          listPartition(partition);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+        lock.lock();
+        --numListing;
+        if (error && !firstError)
+        {
+          firstError = error;
+        }
+        partitionsChanged.notify_all();
       }
+    };
+
+    Storage::_detail::RunConcurrently(
+        std::max(options.Concurrency, 1) - 1, threadFunc, _internal::ThreadPool::GetDefault());
+
+    if (firstError)
+    {
+      std::rethrow_exception(firstError);
+    }
+  }
+
+  ListBlobsByHierarchyPagedResponse BlobContainerClient::ListBlobsByHierarchy(
+      const std::string& delimiter,
+      const ListBlobsOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    _detail::BlobRestClient::BlobContainer::ListBlobsByHierarchyOptions protocolLayerOptions;
+    protocolLayerOptions.Prefix = options.Prefix;
+    protocolLayerOptions.Delimiter = delimiter;
+    if (options.ContinuationToken.HasValue() && !options.ContinuationToken.Value().empty())
+    {
+      protocolLayerOptions.ContinuationToken = options.ContinuationToken;
+    }
+    protocolLayerOptions.MaxResults = options.PageSizeHint;
+    protocolLayerOptions.Include = options.Include;
+    auto response = _detail::BlobRestClient::BlobContainer::ListBlobsByHierarchy(
+        *m_pipeline,
+        m_blobContainerUrl,
+        protocolLayerOptions,
+        _internal::WithReplicaStatus(context));
+    for (auto& i : response.Value.Items)
+    {
+      FillBlobItemDefaults(i);
     }
 
     ListBlobsByHierarchyPagedResponse pagedResponse;
@@ -332,7 +673,7 @@ namespace Azure { namespace Storage { namespace Blobs {
     pagedResponse.m_operationOptions = options;
     pagedResponse.m_delimiter = delimiter;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken;
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
     pagedResponse.RawResponse = std::move(response.RawResponse);
 
     return pagedResponse;
@@ -388,4 +729,292 @@ namespace Azure { namespace Storage { namespace Blobs {
         std::move(blockBlobClient), std::move(response.RawResponse));
   }
 
+  Models::SyncBlobsFromDirectoryResult BlobContainerClient::SyncFromDirectory(
+      const std::string& localDirectoryName,
+      const SyncBlobsFromDirectoryOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    // The uploads of all the files share a transfer scheduler bounding the blocks in flight.
+    BlobContainerClient operationClient(*this);
+    if (!operationClient.m_transferScheduler)
+    {
+      TransferSchedulerOptions schedulerOptions;
+      schedulerOptions.MaxConcurrentChunks = std::max(options.TransferOptions.Concurrency, 1);
+      operationClient.m_transferScheduler = std::make_shared<TransferScheduler>(schedulerOptions);
+    }
+
+    struct LocalFile final
+    {
+      std::string RelativePath;
+      int64_t Size;
+      int64_t LastWriteTime;
+    };
+    struct RemoteBlob final
+    {
+      int64_t Size;
+      Storage::Metadata Metadata;
+      std::vector<uint8_t> ContentMd5;
+    };
+
+    // Guards all the variables below, while the tasks run.
+    std::mutex mutex;
+    std::vector<LocalFile> localFiles;
+    // By the path of their file.
+    std::map<std::string, RemoteBlob> remoteBlobs;
+    std::map<std::string, SyncHashCacheEntry> hashCache;
+    Models::SyncBlobsFromDirectoryResult result;
+
+    // The local directory is walked while the blobs are listed.
+    _internal::TaskQueue listTasks;
+    std::function<void(const std::string&)> walkDirectory;
+    walkDirectory = [&](const std::string& relativePath) {
+      const std::string localPath
+          = relativePath.empty() ? localDirectoryName : localDirectoryName + "/" + relativePath;
+      for (const auto& entry : _internal::ListLocalDirectory(localPath))
+      {
+        std::string entryPath = relativePath.empty() ? entry.Name : relativePath + "/" + entry.Name;
+        if (entry.IsDirectory)
+        {
+          listTasks.Push([&, entryPath]() { walkDirectory(entryPath); });
+          continue;
+        }
+        std::lock_guard<std::mutex> guard(mutex);
+        localFiles.push_back(LocalFile{std::move(entryPath), entry.Size, entry.LastWriteTime});
+      }
+    };
+    listTasks.Push(
+        [&]() {
+          ListBlobsParallelOptions listOptions;
+          if (!options.Prefix.empty())
+          {
+            listOptions.Prefix = options.Prefix;
+          }
+          listOptions.Include = Models::ListBlobsIncludeFlags::Metadata;
+          listOptions.Concurrency = options.TransferOptions.Concurrency;
+          ListBlobsParallel(
+              [&](std::vector<Models::BlobItem> blobs) {
+                std::lock_guard<std::mutex> guard(mutex);
+                for (auto& blob : blobs)
+                {
+                  RemoteBlob remoteBlob;
+                  remoteBlob.Size = blob.BlobSize;
+                  remoteBlob.Metadata = std::move(blob.Details.Metadata);
+                  if (blob.Details.HttpHeaders.ContentHash.Algorithm == HashAlgorithm::Md5)
+                  {
+                    remoteBlob.ContentMd5 = std::move(blob.Details.HttpHeaders.ContentHash.Value);
+                  }
+                  remoteBlobs.emplace(
+                      blob.Name.substr(options.Prefix.size()), std::move(remoteBlob));
+                }
+              },
+              listOptions,
+              context);
+        },
+        true);
+    listTasks.Push([&]() { walkDirectory(std::string()); }, true);
+    if (options.HashCacheFile.HasValue())
+    {
+      hashCache = ReadSyncHashCache(options.HashCacheFile.Value());
+    }
+    listTasks.Run(options.TransferOptions.Concurrency);
+
+    auto getFileMd5 = [&](const LocalFile& file) {
+      {
+        std::lock_guard<std::mutex> guard(mutex);
+        auto cached = hashCache.find(file.RelativePath);
+        if (cached != hashCache.end() && cached->second.Size == file.Size
+            && cached->second.LastWriteTime == file.LastWriteTime)
+        {
+          return cached->second.Md5;
+        }
+      }
+      auto md5 = ComputeFileMd5(localDirectoryName + "/" + file.RelativePath);
+      std::lock_guard<std::mutex> guard(mutex);
+      hashCache[file.RelativePath] = SyncHashCacheEntry{file.Size, file.LastWriteTime, md5};
+      return md5;
+    };
+
+    // Uploads a file, unless it turns out to have the same content as its blob.
+    auto syncFile = [&](const LocalFile& file, const RemoteBlob* remoteBlob) {
+      auto blockBlobClient = operationClient.GetBlockBlobClient(options.Prefix + file.RelativePath);
+      const std::string lastWriteTime = std::to_string(file.LastWriteTime);
+      std::vector<uint8_t> md5;
+      // With a cache, the MD5 of the files are kept in their blobs, to compare them next time.
+      if (options.HashCacheFile.HasValue()
+          || (remoteBlob && remoteBlob->Size == file.Size && !remoteBlob->ContentMd5.empty()))
+      {
+        md5 = getFileMd5(file);
+      }
+      if (remoteBlob && remoteBlob->Size == file.Size && !md5.empty()
+          && md5 == remoteBlob->ContentMd5)
+      {
+        // Only the last write time changed, it's recorded so that the file isn't read again.
+        auto metadata = remoteBlob->Metadata;
+        metadata[SyncLastWriteTimeMetadataKey] = lastWriteTime;
+        blockBlobClient.SetMetadata(metadata, SetBlobMetadataOptions(), context);
+        std::lock_guard<std::mutex> guard(mutex);
+        ++result.NumberOfSkippedFiles;
+        return;
+      }
+
+      UploadBlockBlobFromOptions uploadOptions;
+      if (!md5.empty())
+      {
+        uploadOptions.HttpHeaders.ContentHash.Algorithm = HashAlgorithm::Md5;
+        uploadOptions.HttpHeaders.ContentHash.Value = std::move(md5);
+      }
+      uploadOptions.Metadata[SyncLastWriteTimeMetadataKey] = lastWriteTime;
+      uploadOptions.TransferOptions.SingleUploadThreshold
+          = options.TransferOptions.SingleUploadThreshold;
+      uploadOptions.TransferOptions.ChunkSize = options.TransferOptions.ChunkSize;
+      uploadOptions.TransferOptions.Concurrency = options.TransferOptions.Concurrency;
+      blockBlobClient.UploadFrom(
+          localDirectoryName + "/" + file.RelativePath, uploadOptions, context);
+      std::lock_guard<std::mutex> guard(mutex);
+      ++result.NumberOfUploadedFiles;
+      result.UploadedSize += file.Size;
+    };
+
+    _internal::TaskQueue syncTasks;
+    std::set<std::string> localPaths;
+    for (const auto& file : localFiles)
+    {
+      localPaths.insert(file.RelativePath);
+      auto remoteBlob = remoteBlobs.find(file.RelativePath);
+      if (remoteBlob == remoteBlobs.end())
+      {
+        syncTasks.Push([&syncFile, &file]() { syncFile(file, nullptr); });
+        continue;
+      }
+      const auto& metadata = remoteBlob->second.Metadata;
+      auto recordedLastWriteTime = metadata.find(SyncLastWriteTimeMetadataKey);
+      if (remoteBlob->second.Size == file.Size && recordedLastWriteTime != metadata.end()
+          && recordedLastWriteTime->second == std::to_string(file.LastWriteTime))
+      {
+        ++result.NumberOfSkippedFiles;
+        continue;
+      }
+      const RemoteBlob* remoteBlobPtr = &remoteBlob->second;
+      syncTasks.Push([&syncFile, &file, remoteBlobPtr]() { syncFile(file, remoteBlobPtr); });
+    }
+    if (options.DeleteExtraBlobs)
+    {
+      for (const auto& remoteBlob : remoteBlobs)
+      {
+        if (localPaths.count(remoteBlob.first) != 0)
+        {
+          continue;
+        }
+        const std::string blobName = options.Prefix + remoteBlob.first;
+        syncTasks.Push([&, blobName]() {
+          DeleteBlobOptions deleteOptions;
+          deleteOptions.DeleteSnapshots = Models::DeleteSnapshotsOption::IncludeSnapshots;
+          operationClient.DeleteBlob(blobName, deleteOptions, context);
+          std::lock_guard<std::mutex> guard(mutex);
+          ++result.NumberOfDeletedBlobs;
+        });
+      }
+    }
+
+    // The hashes computed are cached even if the synchronization fails.
+    std::exception_ptr error;
+    try
+    {
+      syncTasks.Run(options.TransferOptions.Concurrency);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+    if (options.HashCacheFile.HasValue())
+    {
+      std::map<std::string, SyncHashCacheEntry> currentHashes;
+      for (auto& entry : hashCache)
+      {
+        if (localPaths.count(entry.first) != 0)
+        {
+          currentHashes.insert(std::move(entry));
+        }
+      }
+      WriteSyncHashCache(options.HashCacheFile.Value(), currentHashes);
+    }
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+    return result;
+  }
+
+  BulkOperationResult BlobContainerClient::UploadFiles(
+      const std::vector<std::pair<std::string, std::string>>& files,
+      const UploadBlobFilesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    if (options.Concurrency <= 0)
+    {
+      throw std::invalid_argument("Concurrency must be positive.");
+    }
+    BulkOperationResult ret;
+    ret.Errors.resize(files.size());
+    if (files.empty())
+    {
+      return ret;
+    }
+
+    // Each upload records its own error, so the transfer never stops early.
+    auto uploadFileFunc = [&](int64_t,
+                              int64_t,
+                              int64_t fileId,
+                              int64_t,
+                              const Azure::Core::Context& fileContext) {
+      const auto& file = files[static_cast<size_t>(fileId)];
+      try
+      {
+        auto blockBlobClient = GetBlockBlobClient(file.second);
+        _internal::FileReader fileReader(file.first);
+        if (fileReader.GetFileSize() > options.SingleUploadThreshold)
+        {
+          UploadBlockBlobFromOptions uploadOptions;
+          uploadOptions.AccessTier = options.AccessTier;
+          uploadOptions.TransferOptions.SingleUploadThreshold = options.SingleUploadThreshold;
+          uploadOptions.TransferOptions.Concurrency = 1;
+          blockBlobClient.UploadFrom(file.first, uploadOptions, fileContext);
+          return;
+        }
+        _internal::PooledBuffer buffer(
+            m_bufferPool, static_cast<size_t>(fileReader.GetFileSize()));
+        if (fileReader.Read(buffer.GetData(), buffer.GetSize(), 0) != buffer.GetSize())
+        {
+          throw std::runtime_error("Failed to read file.");
+        }
+        Azure::Core::IO::MemoryBodyStream contentStream(buffer.GetData(), buffer.GetSize());
+        UploadBlockBlobOptions uploadOptions;
+        uploadOptions.AccessTier = options.AccessTier;
+        blockBlobClient.Upload(contentStream, uploadOptions, fileContext);
+      }
+      catch (...)
+      {
+        ret.Errors[static_cast<size_t>(fileId)] = std::current_exception();
+      }
+    };
+    _internal::ConcurrentTransfer(
+        0,
+        static_cast<int64_t>(files.size()),
+        1,
+        options.Concurrency,
+        uploadFileFunc,
+        context,
+        m_transferScheduler.get(),
+        _internal::GetTransferThreadPool(m_bufferPool));
+
+    for (const auto& error : ret.Errors)
+    {
+      if (error)
+      {
+        ++ret.FailedCount;
+      }
+    }
+    return ret;
+  }
+
 }}} // namespace Azure::Storage::Blobs
@@ -0,0 +1,259 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/blobs/blob_content_cache.hpp"
+
+#include <azure/core/cryptography/hash.hpp>
+#include <azure/storage/common/internal/file_io.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  namespace {
+    constexpr const char* DataExtension = ".data";
+    constexpr const char* MetadataExtension = ".meta";
+    constexpr const char* TemporaryExtension = ".tmp";
+
+    bool EndsWith(const std::string& s, const std::string& suffix)
+    {
+      return s.length() >= suffix.length()
+          && s.compare(s.length() - suffix.length(), suffix.length(), suffix) == 0;
+    }
+  } // namespace
+
+  BlobContentCache::BlobContentCache(BlobContentCacheOptions options)
+      : m_options(std::move(options))
+  {
+    if (m_options.Directory.empty())
+    {
+      throw std::invalid_argument("The directory of the content cache is empty.");
+    }
+    _internal::CreateLocalDirectories(m_options.Directory);
+
+    std::unordered_map<std::string, int64_t> dataSizes;
+    std::vector<std::string> metadataFiles;
+    for (const auto& file : _internal::ListLocalDirectory(m_options.Directory))
+    {
+      if (file.IsDirectory)
+      {
+        continue;
+      }
+      const std::string path = m_options.Directory + "/" + file.Name;
+      if (EndsWith(file.Name, DataExtension))
+      {
+        dataSizes.emplace(path.substr(0, path.length() - strlen(DataExtension)), file.Size);
+      }
+      else if (EndsWith(file.Name, MetadataExtension))
+      {
+        metadataFiles.push_back(path.substr(0, path.length() - strlen(MetadataExtension)));
+      }
+      else if (EndsWith(file.Name, TemporaryExtension))
+      {
+        // Left over by a cache which stopped while storing a blob.
+        std::remove(path.data());
+      }
+    }
+
+    for (const auto& stem : metadataFiles)
+    {
+      Entry entry;
+      std::string eTag;
+      std::string lastModified;
+      std::string blobType;
+      std::ifstream metadata(stem + MetadataExtension);
+      auto dataSize = dataSizes.find(stem);
+      bool valid = std::getline(metadata, entry.Key) && std::getline(metadata, eTag)
+          && std::getline(metadata, lastModified) && std::getline(metadata, blobType)
+          && dataSize != dataSizes.end() && stem == GetFileName(entry.Key, "")
+          && m_index.count(entry.Key) == 0;
+      metadata.close();
+      if (valid)
+      {
+        try
+        {
+          entry.ETag = Azure::ETag(eTag);
+          entry.LastModified
+              = Azure::DateTime::Parse(lastModified, Azure::DateTime::DateFormat::Rfc3339);
+          entry.BlobType = Models::BlobType(blobType);
+          entry.Size = dataSize->second;
+        }
+        catch (const std::exception&)
+        {
+          valid = false;
+        }
+      }
+      if (!valid)
+      {
+        std::remove((stem + MetadataExtension).data());
+        std::remove((stem + DataExtension).data());
+        continue;
+      }
+      m_size += entry.Size;
+      m_entries.push_back(std::move(entry));
+      m_index.emplace(m_entries.back().Key, std::prev(m_entries.end()));
+      dataSizes.erase(dataSize);
+    }
+    // Content without its metadata can't be served.
+    for (const auto& dataSize : dataSizes)
+    {
+      std::remove((dataSize.first + DataExtension).data());
+    }
+
+    while (m_size > m_options.MaxSize)
+    {
+      RemoveFiles(m_entries.back().Key);
+      m_size -= m_entries.back().Size;
+      m_index.erase(m_entries.back().Key);
+      m_entries.pop_back();
+    }
+  }
+
+  int64_t BlobContentCache::GetSize()
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_size;
+  }
+
+  std::string BlobContentCache::GetKey(const Azure::Core::Url& blobUrl)
+  {
+    Azure::Core::Url key(blobUrl);
+    for (const auto& parameter : blobUrl.GetQueryParameters())
+    {
+      if (parameter.first != "snapshot" && parameter.first != "versionid")
+      {
+        key.RemoveQueryParameter(parameter.first);
+      }
+    }
+    return key.GetAbsoluteUrl();
+  }
+
+  bool BlobContentCache::IsImmutable(const Azure::Core::Url& blobUrl)
+  {
+    const auto& parameters = blobUrl.GetQueryParameters();
+    return parameters.count("snapshot") != 0 || parameters.count("versionid") != 0;
+  }
+
+  Azure::Nullable<BlobContentCache::Entry> BlobContentCache::Find(
+      const std::string& key,
+      std::string& fileName)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto found = m_index.find(key);
+    if (found == m_index.end())
+    {
+      return Azure::Nullable<Entry>();
+    }
+    m_entries.splice(m_entries.begin(), m_entries, found->second);
+    fileName = GetFileName(key, DataExtension);
+    return *found->second;
+  }
+
+  void BlobContentCache::Store(
+      Entry entry,
+      const std::function<void(const std::string& fileName)>& writeFunc)
+  {
+    if (entry.Size > m_options.MaxSize)
+    {
+      return;
+    }
+    std::string temporaryFileName;
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      temporaryFileName = m_options.Directory + "/" + std::to_string(m_nextTemporaryFile++)
+          + TemporaryExtension;
+    }
+    try
+    {
+      writeFunc(temporaryFileName);
+    }
+    catch (const std::exception&)
+    {
+      std::remove(temporaryFileName.data());
+      return;
+    }
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto found = m_index.find(entry.Key);
+    if (found != m_index.end())
+    {
+      m_size -= found->second->Size;
+      m_entries.erase(found->second);
+      m_index.erase(found);
+    }
+    RemoveFiles(entry.Key);
+
+    const std::string dataFileName = GetFileName(entry.Key, DataExtension);
+    const std::string metadataFileName = GetFileName(entry.Key, MetadataExtension);
+    if (std::rename(temporaryFileName.data(), dataFileName.data()) != 0)
+    {
+      std::remove(temporaryFileName.data());
+      return;
+    }
+    {
+      std::ofstream metadata(metadataFileName, std::ios::trunc);
+      metadata << entry.Key << '\n'
+               << entry.ETag.ToString() << '\n'
+               << entry.LastModified.ToString(Azure::DateTime::DateFormat::Rfc3339) << '\n'
+               << entry.BlobType.ToString() << '\n';
+      metadata.close();
+      if (!metadata)
+      {
+        RemoveFiles(entry.Key);
+        return;
+      }
+    }
+
+    m_size += entry.Size;
+    m_entries.push_front(std::move(entry));
+    m_index.emplace(m_entries.front().Key, m_entries.begin());
+    while (m_size > m_options.MaxSize)
+    {
+      RemoveFiles(m_entries.back().Key);
+      m_size -= m_entries.back().Size;
+      m_index.erase(m_entries.back().Key);
+      m_entries.pop_back();
+    }
+  }
+
+  void BlobContentCache::Remove(const std::string& key)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto found = m_index.find(key);
+    if (found == m_index.end())
+    {
+      return;
+    }
+    RemoveFiles(key);
+    m_size -= found->second->Size;
+    m_entries.erase(found->second);
+    m_index.erase(found);
+  }
+
+  std::string BlobContentCache::GetFileName(const std::string& key, const char* extension) const
+  {
+    static constexpr char HexDigits[] = "0123456789abcdef";
+    const auto hash = Azure::Core::Cryptography::Md5Hash().Final(
+        reinterpret_cast<const uint8_t*>(key.data()), key.length());
+    std::string fileName = m_options.Directory + "/";
+    for (const auto byte : hash)
+    {
+      fileName += HexDigits[byte >> 4];
+      fileName += HexDigits[byte & 0x0f];
+    }
+    return fileName + extension;
+  }
+
+  void BlobContentCache::RemoveFiles(const std::string& key)
+  {
+    std::remove(GetFileName(key, MetadataExtension).data());
+    std::remove(GetFileName(key, DataExtension).data());
+  }
+
+}}} // namespace Azure::Storage::Blobs
@@ -3,6 +3,8 @@
 
 #include "azure/storage/blobs/blob_lease_client.hpp"
 
+#include <memory>
+
 #include <azure/core/azure_assert.hpp>
 #include <azure/core/uuid.hpp>
 
@@ -351,4 +353,21 @@ namespace Azure { namespace Storage { namespace Blobs {
       AZURE_UNREACHABLE_CODE();
     }
   }
+
+  int64_t BlobLeaseClient::KeepRenewed(
+      LeaseKeeper& leaseKeeper,
+      std::chrono::seconds duration,
+      LeaseKeeper::LostLeaseHandler onLost)
+  {
+    // The keeper renews the lease with a client of its own.
+    auto leaseClient = m_blobClient.HasValue()
+        ? std::make_shared<BlobLeaseClient>(m_blobClient.Value(), GetLeaseId())
+        : std::make_shared<BlobLeaseClient>(m_blobContainerClient.Value(), GetLeaseId());
+    return leaseKeeper.AddLease(
+        [leaseClient](const Azure::Core::Context& context) {
+          leaseClient->Renew(RenewLeaseOptions(), context);
+        },
+        duration,
+        std::move(onLost));
+  }
 }}} // namespace Azure::Storage::Blobs
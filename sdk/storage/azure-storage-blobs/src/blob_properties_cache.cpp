@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/blobs/blob_properties_cache.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  namespace {
+    // Copying a raw response leaves its headers out.
+    std::unique_ptr<Azure::Core::Http::RawResponse> CopyRawResponse(
+        const Azure::Core::Http::RawResponse& rawResponse)
+    {
+      auto copy = std::make_unique<Azure::Core::Http::RawResponse>(rawResponse);
+      for (const auto& header : rawResponse.GetHeaders())
+      {
+        copy->SetHeader(header.first, header.second);
+      }
+      return copy;
+    }
+  } // namespace
+
+  struct BlobPropertiesCache::Shard final
+  {
+    struct Entry final
+    {
+      std::string BlobUrl;
+      Models::BlobProperties Properties;
+      std::unique_ptr<Azure::Core::Http::RawResponse> RawResponse;
+      std::chrono::steady_clock::time_point ExpiresOn;
+    };
+
+    std::mutex Mutex;
+    // The entries used most recently come first.
+    std::list<Entry> Entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> Index;
+  };
+
+  BlobPropertiesCache::BlobPropertiesCache(BlobPropertiesCacheOptions options)
+      : m_options(std::move(options))
+  {
+    const size_t shardCount = std::max<size_t>(m_options.ShardCount, 1);
+    m_shardCapacity = std::max<size_t>((m_options.Capacity + shardCount - 1) / shardCount, 1);
+    for (size_t i = 0; i < shardCount; ++i)
+    {
+      m_shards.push_back(std::make_unique<Shard>());
+    }
+  }
+
+  BlobPropertiesCache::~BlobPropertiesCache() = default;
+
+  BlobPropertiesCache::Shard& BlobPropertiesCache::GetShard(const std::string& blobUrl)
+  {
+    return *m_shards[std::hash<std::string>()(blobUrl) % m_shards.size()];
+  }
+
+  Azure::Nullable<Azure::Response<Models::BlobProperties>> BlobPropertiesCache::Get(
+      const std::string& blobUrl)
+  {
+    auto& shard = GetShard(blobUrl);
+    std::lock_guard<std::mutex> guard(shard.Mutex);
+    auto ite = shard.Index.find(blobUrl);
+    if (ite == shard.Index.end())
+    {
+      return Azure::Nullable<Azure::Response<Models::BlobProperties>>();
+    }
+    if (std::chrono::steady_clock::now() >= ite->second->ExpiresOn)
+    {
+      shard.Entries.erase(ite->second);
+      shard.Index.erase(ite);
+      return Azure::Nullable<Azure::Response<Models::BlobProperties>>();
+    }
+    shard.Entries.splice(shard.Entries.begin(), shard.Entries, ite->second);
+    return Azure::Response<Models::BlobProperties>(
+        ite->second->Properties,
+        CopyRawResponse(*ite->second->RawResponse));
+  }
+
+  void BlobPropertiesCache::Set(
+      const std::string& blobUrl,
+      const Azure::Response<Models::BlobProperties>& response)
+  {
+    if (m_options.TimeToLive <= std::chrono::milliseconds::zero())
+    {
+      return;
+    }
+    Shard::Entry entry{
+        blobUrl,
+        response.Value,
+        CopyRawResponse(*response.RawResponse),
+        std::chrono::steady_clock::now() + m_options.TimeToLive};
+
+    auto& shard = GetShard(blobUrl);
+    std::lock_guard<std::mutex> guard(shard.Mutex);
+    auto ite = shard.Index.find(blobUrl);
+    if (ite != shard.Index.end())
+    {
+      shard.Entries.erase(ite->second);
+      shard.Index.erase(ite);
+    }
+    else if (shard.Entries.size() >= m_shardCapacity)
+    {
+      shard.Index.erase(shard.Entries.back().BlobUrl);
+      shard.Entries.pop_back();
+    }
+    shard.Entries.push_front(std::move(entry));
+    shard.Index.emplace(blobUrl, shard.Entries.begin());
+  }
+
+  void BlobPropertiesCache::Remove(const std::string& blobUrl)
+  {
+    auto& shard = GetShard(blobUrl);
+    std::lock_guard<std::mutex> guard(shard.Mutex);
+    auto ite = shard.Index.find(blobUrl);
+    if (ite != shard.Index.end())
+    {
+      shard.Entries.erase(ite->second);
+      shard.Index.erase(ite);
+    }
+  }
+
+}}} // namespace Azure::Storage::Blobs
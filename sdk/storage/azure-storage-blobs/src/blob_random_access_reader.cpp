@@ -0,0 +1,350 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/blobs/blob_random_access_reader.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <future>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <azure/core/io/shared_buffer.hpp>
+#include <azure/storage/common/internal/thread_pool.hpp>
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  namespace _detail {
+    class BlobRandomAccessReaderState final
+        : public std::enable_shared_from_this<BlobRandomAccessReaderState> {
+    public:
+      BlobRandomAccessReaderState(
+          BlobClient blobClient,
+          const BlobRandomAccessReaderOptions& options)
+          : m_blobClient(std::move(blobClient)), m_options(options), m_shards(options.ShardCount)
+      {
+        m_maxBlocksPerShard = std::max<int64_t>(
+            1,
+            m_options.CacheSize / m_options.BlockSize / static_cast<int64_t>(m_options.ShardCount));
+      }
+
+      size_t Read(
+          int64_t offset,
+          uint8_t* buffer,
+          size_t count,
+          const Azure::Core::Context& context)
+      {
+        Pin(context);
+        if (offset < 0)
+        {
+          throw std::invalid_argument("Offset cannot be negative.");
+        }
+        if (offset >= m_blobSize || count == 0)
+        {
+          return 0;
+        }
+        const int64_t end = offset + std::min<int64_t>(count, m_blobSize - offset);
+        const int64_t firstBlockId = offset / m_options.BlockSize;
+        const int64_t lastBlockId = (end - 1) / m_options.BlockSize;
+
+        const bool isSequential = m_lastReadEnd.exchange(end) == offset;
+        if (isSequential)
+        {
+          // Started before waiting for the blocks read, so that they download meanwhile.
+          for (int64_t blockId = lastBlockId + 1;
+               blockId <= lastBlockId + m_options.ReadAheadBlocks
+               && blockId * m_options.BlockSize < m_blobSize;
+               ++blockId)
+          {
+            ReadAhead(blockId);
+          }
+        }
+
+        for (int64_t blockId = firstBlockId; blockId <= lastBlockId; ++blockId)
+        {
+          const auto block = GetBlock(blockId, context);
+          const int64_t blockOffset = blockId * m_options.BlockSize;
+          const int64_t copyBegin = std::max(offset, blockOffset);
+          const int64_t copyEnd
+              = std::min(end, blockOffset + static_cast<int64_t>(block.GetSize()));
+          if (copyEnd <= copyBegin)
+          {
+            throw std::runtime_error("The block downloaded is shorter than expected.");
+          }
+          std::memcpy(
+              buffer + (copyBegin - offset),
+              block.GetData() + (copyBegin - blockOffset),
+              static_cast<size_t>(copyEnd - copyBegin));
+        }
+        return static_cast<size_t>(end - offset);
+      }
+
+      int64_t GetSize(const Azure::Core::Context& context)
+      {
+        Pin(context);
+        return m_blobSize;
+      }
+
+      Azure::ETag GetETag(const Azure::Core::Context& context)
+      {
+        Pin(context);
+        return m_accessConditions.IfMatch;
+      }
+
+      void Cancel() { m_readAheadContext.Cancel(); }
+
+    private:
+      struct CachedBlock final
+      {
+        std::shared_future<Azure::Core::IO::SharedBuffer> Content;
+        std::list<int64_t>::iterator LruPosition;
+        // Tells the block apart from one cached again after it was evicted.
+        int64_t Generation = 0;
+      };
+
+      struct CacheShard final
+      {
+        std::mutex Mutex;
+        // The most recently used block first.
+        std::list<int64_t> Lru;
+        std::unordered_map<int64_t, CachedBlock> Blocks;
+      };
+
+      // Gets the version of the blob all the reads are of, once.
+      void Pin(const Azure::Core::Context& context)
+      {
+        if (m_pinned)
+        {
+          return;
+        }
+        std::lock_guard<std::mutex> lock(m_pinMutex);
+        if (m_pinned)
+        {
+          return;
+        }
+        GetBlobPropertiesOptions propertiesOptions;
+        propertiesOptions.AccessConditions = m_options.AccessConditions;
+        auto properties = m_blobClient.GetProperties(propertiesOptions, context);
+        m_blobSize = properties.Value.BlobSize;
+        m_accessConditions = m_options.AccessConditions;
+        if (!m_accessConditions.IfMatch.HasValue())
+        {
+          m_accessConditions.IfMatch = properties.Value.ETag;
+        }
+        m_pinned = true;
+      }
+
+      Azure::Core::IO::SharedBuffer DownloadBlock(
+          int64_t blockId,
+          const Azure::Core::Context& context)
+      {
+        DownloadBlobOptions downloadOptions;
+        downloadOptions.Range = Core::Http::HttpRange();
+        downloadOptions.Range.Value().Offset = blockId * m_options.BlockSize;
+        downloadOptions.Range.Value().Length = std::min(
+            m_options.BlockSize, m_blobSize - downloadOptions.Range.Value().Offset);
+        downloadOptions.AccessConditions = m_accessConditions;
+        auto download = m_blobClient.Download(downloadOptions, context);
+        return Azure::Core::IO::SharedBuffer(download.Value.BodyStream->ReadToEnd(context));
+      }
+
+      CacheShard& GetShard(int64_t blockId)
+      {
+        return m_shards[static_cast<size_t>(blockId) % m_shards.size()];
+      }
+
+      // Caches a block being downloaded, with the lock of the shard held. Returns its generation.
+      int64_t InsertBlock(
+          CacheShard& shard,
+          int64_t blockId,
+          std::shared_future<Azure::Core::IO::SharedBuffer> content)
+      {
+        while (static_cast<int64_t>(shard.Blocks.size()) >= m_maxBlocksPerShard)
+        {
+          // Waiters of an evicted block being downloaded keep their future.
+          shard.Blocks.erase(shard.Lru.back());
+          shard.Lru.pop_back();
+        }
+        shard.Lru.push_front(blockId);
+        CachedBlock block;
+        block.Content = std::move(content);
+        block.LruPosition = shard.Lru.begin();
+        block.Generation = ++m_nextGeneration;
+        const int64_t generation = block.Generation;
+        shard.Blocks.emplace(blockId, std::move(block));
+        return generation;
+      }
+
+      // Downloads a block cached by InsertBlock, which is uncached if the download fails.
+      void FetchBlock(
+          int64_t blockId,
+          int64_t generation,
+          std::promise<Azure::Core::IO::SharedBuffer>& promise,
+          const Azure::Core::Context& context)
+      {
+        try
+        {
+          promise.set_value(DownloadBlock(blockId, context));
+        }
+        catch (...)
+        {
+          {
+            auto& shard = GetShard(blockId);
+            std::lock_guard<std::mutex> lock(shard.Mutex);
+            auto ite = shard.Blocks.find(blockId);
+            if (ite != shard.Blocks.end() && ite->second.Generation == generation)
+            {
+              shard.Lru.erase(ite->second.LruPosition);
+              shard.Blocks.erase(ite);
+            }
+          }
+          promise.set_exception(std::current_exception());
+        }
+      }
+
+      Azure::Core::IO::SharedBuffer GetBlock(int64_t blockId, const Azure::Core::Context& context)
+      {
+        auto& shard = GetShard(blockId);
+        std::promise<Azure::Core::IO::SharedBuffer> promise;
+        std::shared_future<Azure::Core::IO::SharedBuffer> content;
+        int64_t generation = 0;
+        {
+          std::lock_guard<std::mutex> lock(shard.Mutex);
+          auto ite = shard.Blocks.find(blockId);
+          if (ite != shard.Blocks.end())
+          {
+            shard.Lru.splice(shard.Lru.begin(), shard.Lru, ite->second.LruPosition);
+            content = ite->second.Content;
+          }
+          else
+          {
+            content = promise.get_future().share();
+            generation = InsertBlock(shard, blockId, content);
+          }
+        }
+        if (generation != 0)
+        {
+          FetchBlock(blockId, generation, promise, context);
+        }
+        return content.get();
+      }
+
+      void ReadAhead(int64_t blockId)
+      {
+        auto& shard = GetShard(blockId);
+        auto promise = std::make_shared<std::promise<Azure::Core::IO::SharedBuffer>>();
+        int64_t generation = 0;
+        {
+          std::lock_guard<std::mutex> lock(shard.Mutex);
+          if (shard.Blocks.count(blockId) != 0)
+          {
+            return;
+          }
+          generation = InsertBlock(shard, blockId, promise->get_future().share());
+        }
+        auto self = shared_from_this();
+        Storage::_internal::ThreadPool::GetDefault().Submit(
+            [self, blockId, generation, promise]() {
+              self->FetchBlock(blockId, generation, *promise, self->m_readAheadContext);
+            });
+      }
+
+      BlobClient m_blobClient;
+      BlobRandomAccessReaderOptions m_options;
+      int64_t m_maxBlocksPerShard = 1;
+      // Cancelled when the reader is destroyed.
+      Azure::Core::Context m_readAheadContext;
+
+      // Guards the variables below, which are constant once pinned.
+      std::mutex m_pinMutex;
+      std::atomic<bool> m_pinned{false};
+      int64_t m_blobSize = 0;
+      BlobAccessConditions m_accessConditions;
+
+      std::vector<CacheShard> m_shards;
+      std::atomic<int64_t> m_nextGeneration{0};
+      std::atomic<int64_t> m_lastReadEnd{-1};
+    };
+  } // namespace _detail
+
+  namespace {
+    class BlobRandomAccessReaderStream final : public Azure::Core::IO::BodyStream {
+    public:
+      BlobRandomAccessReaderStream(
+          std::shared_ptr<_detail::BlobRandomAccessReaderState> state,
+          int64_t length)
+          : m_state(std::move(state)), m_length(length)
+      {
+      }
+
+      int64_t Length() const override { return m_length; }
+
+      void Rewind() override { m_offset = 0; }
+
+    private:
+      size_t OnRead(uint8_t* buffer, size_t count, const Azure::Core::Context& context) override
+      {
+        const size_t bytesRead = m_state->Read(m_offset, buffer, count, context);
+        m_offset += static_cast<int64_t>(bytesRead);
+        return bytesRead;
+      }
+
+      std::shared_ptr<_detail::BlobRandomAccessReaderState> m_state;
+      int64_t m_length;
+      int64_t m_offset = 0;
+    };
+  } // namespace
+
+  BlobRandomAccessReader::BlobRandomAccessReader(
+      BlobClient blobClient,
+      const BlobRandomAccessReaderOptions& options)
+  {
+    if (options.BlockSize <= 0)
+    {
+      throw std::invalid_argument("BlockSize must be positive.");
+    }
+    if (options.CacheSize < 0 || options.ShardCount == 0)
+    {
+      throw std::invalid_argument("CacheSize cannot be negative and ShardCount must be positive.");
+    }
+    if (options.ReadAheadBlocks < 0)
+    {
+      throw std::invalid_argument("ReadAheadBlocks cannot be negative.");
+    }
+    m_state
+        = std::make_shared<_detail::BlobRandomAccessReaderState>(std::move(blobClient), options);
+  }
+
+  BlobRandomAccessReader::~BlobRandomAccessReader() { m_state->Cancel(); }
+
+  size_t BlobRandomAccessReader::Read(
+      int64_t offset,
+      uint8_t* buffer,
+      size_t count,
+      const Azure::Core::Context& context)
+  {
+    return m_state->Read(offset, buffer, count, context);
+  }
+
+  int64_t BlobRandomAccessReader::GetSize(const Azure::Core::Context& context)
+  {
+    return m_state->GetSize(context);
+  }
+
+  Azure::ETag BlobRandomAccessReader::GetETag(const Azure::Core::Context& context)
+  {
+    return m_state->GetETag(context);
+  }
+
+  std::unique_ptr<Azure::Core::IO::BodyStream> BlobRandomAccessReader::GetBodyStream(
+      const Azure::Core::Context& context)
+  {
+    return std::make_unique<BlobRandomAccessReaderStream>(m_state, m_state->GetSize(context));
+  }
+
+}}} // namespace Azure::Storage::Blobs
@@ -7,6 +7,7 @@
 #include "azure/storage/blobs/blob_container_client.hpp"
 #include "azure/storage/blobs/blob_service_client.hpp"
 #include "azure/storage/blobs/page_blob_client.hpp"
+#include "azure/storage/blobs/sharded_blob_container_client.hpp"
 
 namespace Azure { namespace Storage { namespace Blobs {
 
@@ -80,6 +81,32 @@ namespace Azure { namespace Storage { namespace Blobs {
     *this = m_blobContainerClient->ListBlobs(m_operationOptions, context);
   }
 
+  void ShardedListBlobsPagedResponse::OnNextPage(const Azure::Core::Context& context)
+  {
+    m_operationOptions.ContinuationToken = NextPageToken;
+    *this = m_shardedBlobContainerClient->ListBlobs(m_operationOptions, context);
+  }
+
+  void ListBlobsCompactPagedResponse::OnNextPage(const Azure::Core::Context& context)
+  {
+    m_operationOptions.ContinuationToken = NextPageToken;
+    *this = m_blobContainerClient->ListBlobsCompact(m_operationOptions, context);
+  }
+
+  void ListBlobsPageStream::MoveToNextPage(const Azure::Core::Context& context)
+  {
+    while (ReadNextBlob().HasValue())
+    {
+    }
+    if (NextPageToken.Value().empty())
+    {
+      m_hasPage = false;
+      return;
+    }
+    m_operationOptions.ContinuationToken = NextPageToken;
+    *this = m_blobContainerClient->ListBlobsStreaming(m_operationOptions, context);
+  }
+
   void ListBlobsByHierarchyPagedResponse::OnNextPage(const Azure::Core::Context& context)
   {
     m_operationOptions.ContinuationToken = NextPageToken;
@@ -94,3 +94,8744 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Models {
   const ScheduleBlobExpiryOriginType ScheduleBlobExpiryOriginType::Absolute("Absolute");
 
 }}}} // namespace Azure::Storage::Blobs::Models
+
+namespace Azure { namespace Storage { namespace Blobs { namespace _detail {
+
+  std::string ListBlobContainersIncludeFlagsToString(const ListBlobContainersIncludeFlags& val)
+  {
+    ListBlobContainersIncludeFlags value_list[] = {
+        ListBlobContainersIncludeFlags::Metadata,
+        ListBlobContainersIncludeFlags::Deleted,
+    };
+    const char* string_list[] = {
+        "metadata",
+        "deleted",
+    };
+    std::string ret;
+    for (size_t i = 0; i < sizeof(value_list) / sizeof(ListBlobContainersIncludeFlags); ++i)
+    {
+      if ((val & value_list[i]) == value_list[i])
+      {
+        if (!ret.empty())
+        {
+          ret += ",";
+        }
+        ret += string_list[i];
+      }
+    }
+    return ret;
+  }
+
+  std::string ListBlobsIncludeFlagsToString(const ListBlobsIncludeFlags& val)
+  {
+    ListBlobsIncludeFlags value_list[] = {
+        ListBlobsIncludeFlags::Copy,
+        ListBlobsIncludeFlags::Deleted,
+        ListBlobsIncludeFlags::Metadata,
+        ListBlobsIncludeFlags::Snapshots,
+        ListBlobsIncludeFlags::Versions,
+        ListBlobsIncludeFlags::UncomittedBlobs,
+        ListBlobsIncludeFlags::Tags,
+    };
+    const char* string_list[] = {
+        "copy",
+        "deleted",
+        "metadata",
+        "snapshots",
+        "versions",
+        "uncommittedblobs",
+        "tags",
+    };
+    std::string ret;
+    for (size_t i = 0; i < sizeof(value_list) / sizeof(ListBlobsIncludeFlags); ++i)
+    {
+      if ((val & value_list[i]) == value_list[i])
+      {
+        if (!ret.empty())
+        {
+          ret += ",";
+        }
+        ret += string_list[i];
+      }
+    }
+    return ret;
+  }
+
+  Azure::Response<Models::_detail::ListBlobContainersResult>
+  BlobRestClient::Service::ListBlobContainers(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ListBlobContainersOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "list");
+    if (options.Prefix.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "prefix", _internal::UrlEncodeQueryParameter(options.Prefix.Value()));
+    }
+    if (options.ContinuationToken.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "marker", _internal::UrlEncodeQueryParameter(options.ContinuationToken.Value()));
+    }
+    if (options.MaxResults.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "maxresults", std::to_string(options.MaxResults.Value()));
+    }
+    std::string list_blob_containers_include_flags
+        = ListBlobContainersIncludeFlagsToString(options.Include);
+    if (!list_blob_containers_include_flags.empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "include", _internal::UrlEncodeQueryParameter(list_blob_containers_include_flags));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::ListBlobContainersResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& httpResponseBody = httpResponse.GetBody();
+      _internal::XmlReader reader(
+          reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
+      response = ListBlobContainersResultInternalFromXml(reader);
+    }
+    return Azure::Response<Models::_detail::ListBlobContainersResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<UserDelegationKey> BlobRestClient::Service::GetUserDelegationKey(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetUserDelegationKeyOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    std::string xml_body;
+    {
+      _internal::XmlWriter writer;
+      GetUserDelegationKeyOptionsToXml(writer, options);
+      xml_body = writer.GetDocument();
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
+    }
+    Azure::Core::IO::MemoryBodyStream xml_body_stream(
+        reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
+    auto request = Azure::Core::Http::Request(
+        Azure::Core::Http::HttpMethod::Post, url, &xml_body_stream);
+    request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
+    request.GetUrl().AppendQueryParameter("restype", "service");
+    request.GetUrl().AppendQueryParameter("comp", "userdelegationkey");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    UserDelegationKey response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& httpResponseBody = httpResponse.GetBody();
+      _internal::XmlReader reader(
+          reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
+      response = UserDelegationKeyFromXml(reader);
+    }
+    return Azure::Response<UserDelegationKey>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<BlobServiceProperties> BlobRestClient::Service::GetProperties(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetServicePropertiesOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+    request.GetUrl().AppendQueryParameter("restype", "service");
+    request.GetUrl().AppendQueryParameter("comp", "properties");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    BlobServiceProperties response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& httpResponseBody = httpResponse.GetBody();
+      _internal::XmlReader reader(
+          reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
+      response = BlobServicePropertiesFromXml(reader);
+    }
+    return Azure::Response<BlobServiceProperties>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<SetServicePropertiesResult> BlobRestClient::Service::SetProperties(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const SetServicePropertiesOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    std::string xml_body;
+    {
+      _internal::XmlWriter writer;
+      SetServicePropertiesOptionsToXml(writer, options);
+      xml_body = writer.GetDocument();
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
+    }
+    Azure::Core::IO::MemoryBodyStream xml_body_stream(
+        reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
+    auto request = Azure::Core::Http::Request(
+        Azure::Core::Http::HttpMethod::Put, url, &xml_body_stream);
+    request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
+    request.GetUrl().AppendQueryParameter("restype", "service");
+    request.GetUrl().AppendQueryParameter("comp", "properties");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    SetServicePropertiesResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 202))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    return Azure::Response<SetServicePropertiesResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<AccountInfo> BlobRestClient::Service::GetAccountInfo(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetAccountInfoOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Head, url);
+    request.GetUrl().AppendQueryParameter("restype", "account");
+    request.GetUrl().AppendQueryParameter("comp", "properties");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    AccountInfo response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.SkuName = SkuName(httpResponse.GetHeaders().at("x-ms-sku-name"));
+    response.AccountKind = AccountKind(httpResponse.GetHeaders().at("x-ms-account-kind"));
+    response.IsHierarchicalNamespaceEnabled
+        = httpResponse.GetHeaders().at("x-ms-is-hns-enabled") == "true";
+    return Azure::Response<AccountInfo>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<ServiceStatistics> BlobRestClient::Service::GetStatistics(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetServiceStatisticsOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+    request.GetUrl().AppendQueryParameter("restype", "service");
+    request.GetUrl().AppendQueryParameter("comp", "stats");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    ServiceStatistics response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& httpResponseBody = httpResponse.GetBody();
+      _internal::XmlReader reader(
+          reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
+      response = ServiceStatisticsFromXml(reader);
+    }
+    return Azure::Response<ServiceStatistics>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::FindBlobsByTagsResult> BlobRestClient::Service::FindBlobsByTags(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const FindBlobsByTagsOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "blobs");
+    request.GetUrl().AppendQueryParameter(
+        "where", _internal::UrlEncodeQueryParameter(options.Where));
+    if (options.ContinuationToken.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "marker", _internal::UrlEncodeQueryParameter(options.ContinuationToken.Value()));
+    }
+    if (options.MaxResults.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "maxresults", std::to_string(options.MaxResults.Value()));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::FindBlobsByTagsResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& httpResponseBody = httpResponse.GetBody();
+      _internal::XmlReader reader(
+          reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
+      response = FindBlobsByTagsResultInternalFromXml(reader);
+    }
+    return Azure::Response<Models::_detail::FindBlobsByTagsResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  BlobServiceProperties
+  BlobRestClient::Service::BlobServicePropertiesFromXml(_internal::XmlReader& reader)
+  {
+    BlobServiceProperties ret;
+    enum class XmlTagName
+    {
+      k_StorageServiceProperties,
+      k_Logging,
+      k_HourMetrics,
+      k_MinuteMetrics,
+      k_Cors,
+      k_CorsRule,
+      k_DefaultServiceVersion,
+      k_DeleteRetentionPolicy,
+      k_StaticWebsite,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "StorageServiceProperties")
+        {
+          path.emplace_back(XmlTagName::k_StorageServiceProperties);
+        }
+        else if (node.Name == "Logging")
+        {
+          path.emplace_back(XmlTagName::k_Logging);
+        }
+        else if (node.Name == "HourMetrics")
+        {
+          path.emplace_back(XmlTagName::k_HourMetrics);
+        }
+        else if (node.Name == "MinuteMetrics")
+        {
+          path.emplace_back(XmlTagName::k_MinuteMetrics);
+        }
+        else if (node.Name == "Cors")
+        {
+          path.emplace_back(XmlTagName::k_Cors);
+        }
+        else if (node.Name == "CorsRule")
+        {
+          path.emplace_back(XmlTagName::k_CorsRule);
+        }
+        else if (node.Name == "DefaultServiceVersion")
+        {
+          path.emplace_back(XmlTagName::k_DefaultServiceVersion);
+        }
+        else if (node.Name == "DeleteRetentionPolicy")
+        {
+          path.emplace_back(XmlTagName::k_DeleteRetentionPolicy);
+        }
+        else if (node.Name == "StaticWebsite")
+        {
+          path.emplace_back(XmlTagName::k_StaticWebsite);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
+            && path[1] == XmlTagName::k_Logging)
+        {
+          ret.Logging = AnalyticsLoggingFromXml(reader);
+          path.pop_back();
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
+            && path[1] == XmlTagName::k_HourMetrics)
+        {
+          ret.HourMetrics = MetricsFromXml(reader);
+          path.pop_back();
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
+            && path[1] == XmlTagName::k_MinuteMetrics)
+        {
+          ret.MinuteMetrics = MetricsFromXml(reader);
+          path.pop_back();
+        }
+        else if (
+            path.size() == 3 && path[0] == XmlTagName::k_StorageServiceProperties
+            && path[1] == XmlTagName::k_Cors && path[2] == XmlTagName::k_CorsRule)
+        {
+          ret.Cors.emplace_back(CorsRuleFromXml(reader));
+          path.pop_back();
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
+            && path[1] == XmlTagName::k_DeleteRetentionPolicy)
+        {
+          ret.DeleteRetentionPolicy = RetentionPolicyFromXml(reader);
+          path.pop_back();
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
+            && path[1] == XmlTagName::k_StaticWebsite)
+        {
+          ret.StaticWebsite = StaticWebsiteFromXml(reader);
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
+            && path[1] == XmlTagName::k_DefaultServiceVersion)
+        {
+          ret.DefaultServiceVersion = node.Value;
+        }
+      }
+    }
+    return ret;
+  }
+
+  Models::_detail::FindBlobsByTagsResult
+  BlobRestClient::Service::FindBlobsByTagsResultInternalFromXml(_internal::XmlReader& reader)
+  {
+    Models::_detail::FindBlobsByTagsResult ret;
+    enum class XmlTagName
+    {
+      k_EnumerationResults,
+      k_NextMarker,
+      k_Blobs,
+      k_Blob,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "EnumerationResults")
+        {
+          path.emplace_back(XmlTagName::k_EnumerationResults);
+        }
+        else if (node.Name == "NextMarker")
+        {
+          path.emplace_back(XmlTagName::k_NextMarker);
+        }
+        else if (node.Name == "Blobs")
+        {
+          path.emplace_back(XmlTagName::k_Blobs);
+        }
+        else if (node.Name == "Blob")
+        {
+          path.emplace_back(XmlTagName::k_Blob);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
+        {
+          ret.Items.emplace_back(TaggedBlobItemFromXml(reader));
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_NextMarker)
+        {
+          ret.ContinuationToken = node.Value;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Attribute)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
+            && node.Name == "ServiceEndpoint")
+        {
+          ret.ServiceEndpoint = node.Value;
+        }
+      }
+    }
+    return ret;
+  }
+
+  Models::_detail::ListBlobContainersResult
+  BlobRestClient::Service::ListBlobContainersResultInternalFromXml(_internal::XmlReader& reader)
+  {
+    Models::_detail::ListBlobContainersResult ret;
+    enum class XmlTagName
+    {
+      k_EnumerationResults,
+      k_Prefix,
+      k_NextMarker,
+      k_Containers,
+      k_Container,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "EnumerationResults")
+        {
+          path.emplace_back(XmlTagName::k_EnumerationResults);
+        }
+        else if (node.Name == "Prefix")
+        {
+          path.emplace_back(XmlTagName::k_Prefix);
+        }
+        else if (node.Name == "NextMarker")
+        {
+          path.emplace_back(XmlTagName::k_NextMarker);
+        }
+        else if (node.Name == "Containers")
+        {
+          path.emplace_back(XmlTagName::k_Containers);
+        }
+        else if (node.Name == "Container")
+        {
+          path.emplace_back(XmlTagName::k_Container);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Containers && path[2] == XmlTagName::k_Container)
+        {
+          ret.Items.emplace_back(BlobContainerItemFromXml(reader));
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Prefix)
+        {
+          ret.Prefix = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_NextMarker)
+        {
+          ret.ContinuationToken = node.Value;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Attribute)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
+            && node.Name == "ServiceEndpoint")
+        {
+          ret.ServiceEndpoint = node.Value;
+        }
+      }
+    }
+    return ret;
+  }
+
+  ServiceStatistics BlobRestClient::Service::ServiceStatisticsFromXml(_internal::XmlReader& reader)
+  {
+    ServiceStatistics ret;
+    enum class XmlTagName
+    {
+      k_StorageServiceStats,
+      k_GeoReplication,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "StorageServiceStats")
+        {
+          path.emplace_back(XmlTagName::k_StorageServiceStats);
+        }
+        else if (node.Name == "GeoReplication")
+        {
+          path.emplace_back(XmlTagName::k_GeoReplication);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 2 && path[0] == XmlTagName::k_StorageServiceStats
+            && path[1] == XmlTagName::k_GeoReplication)
+        {
+          ret.GeoReplication = GeoReplicationFromXml(reader);
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+      }
+    }
+    return ret;
+  }
+
+  UserDelegationKey BlobRestClient::Service::UserDelegationKeyFromXml(_internal::XmlReader& reader)
+  {
+    UserDelegationKey ret;
+    enum class XmlTagName
+    {
+      k_UserDelegationKey,
+      k_SignedOid,
+      k_SignedTid,
+      k_SignedStart,
+      k_SignedExpiry,
+      k_SignedService,
+      k_SignedVersion,
+      k_Value,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "UserDelegationKey")
+        {
+          path.emplace_back(XmlTagName::k_UserDelegationKey);
+        }
+        else if (node.Name == "SignedOid")
+        {
+          path.emplace_back(XmlTagName::k_SignedOid);
+        }
+        else if (node.Name == "SignedTid")
+        {
+          path.emplace_back(XmlTagName::k_SignedTid);
+        }
+        else if (node.Name == "SignedStart")
+        {
+          path.emplace_back(XmlTagName::k_SignedStart);
+        }
+        else if (node.Name == "SignedExpiry")
+        {
+          path.emplace_back(XmlTagName::k_SignedExpiry);
+        }
+        else if (node.Name == "SignedService")
+        {
+          path.emplace_back(XmlTagName::k_SignedService);
+        }
+        else if (node.Name == "SignedVersion")
+        {
+          path.emplace_back(XmlTagName::k_SignedVersion);
+        }
+        else if (node.Name == "Value")
+        {
+          path.emplace_back(XmlTagName::k_Value);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
+            && path[1] == XmlTagName::k_SignedOid)
+        {
+          ret.SignedObjectId = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
+            && path[1] == XmlTagName::k_SignedTid)
+        {
+          ret.SignedTenantId = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
+            && path[1] == XmlTagName::k_SignedStart)
+        {
+          ret.SignedStartsOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
+            && path[1] == XmlTagName::k_SignedExpiry)
+        {
+          ret.SignedExpiresOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
+            && path[1] == XmlTagName::k_SignedService)
+        {
+          ret.SignedService = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
+            && path[1] == XmlTagName::k_SignedVersion)
+        {
+          ret.SignedVersion = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_UserDelegationKey
+            && path[1] == XmlTagName::k_Value)
+        {
+          ret.Value = node.Value;
+        }
+      }
+    }
+    return ret;
+  }
+
+  AnalyticsLogging BlobRestClient::Service::AnalyticsLoggingFromXml(_internal::XmlReader& reader)
+  {
+    AnalyticsLogging ret;
+    enum class XmlTagName
+    {
+      k_Version,
+      k_Delete,
+      k_Read,
+      k_Write,
+      k_RetentionPolicy,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "Version")
+        {
+          path.emplace_back(XmlTagName::k_Version);
+        }
+        else if (node.Name == "Delete")
+        {
+          path.emplace_back(XmlTagName::k_Delete);
+        }
+        else if (node.Name == "Read")
+        {
+          path.emplace_back(XmlTagName::k_Read);
+        }
+        else if (node.Name == "Write")
+        {
+          path.emplace_back(XmlTagName::k_Write);
+        }
+        else if (node.Name == "RetentionPolicy")
+        {
+          path.emplace_back(XmlTagName::k_RetentionPolicy);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 1 && path[0] == XmlTagName::k_RetentionPolicy)
+        {
+          ret.RetentionPolicy = RetentionPolicyFromXml(reader);
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_Version)
+        {
+          ret.Version = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_Delete)
+        {
+          ret.Delete = node.Value == "true";
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_Read)
+        {
+          ret.Read = node.Value == "true";
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_Write)
+        {
+          ret.Write = node.Value == "true";
+        }
+      }
+    }
+    return ret;
+  }
+
+  BlobContainerItem BlobRestClient::Service::BlobContainerItemFromXml(_internal::XmlReader& reader)
+  {
+    BlobContainerItem ret;
+    enum class XmlTagName
+    {
+      k_Name,
+      k_Properties,
+      k_Etag,
+      k_LastModified,
+      k_PublicAccess,
+      k_HasImmutabilityPolicy,
+      k_HasLegalHold,
+      k_LeaseStatus,
+      k_LeaseState,
+      k_LeaseDuration,
+      k_DefaultEncryptionScope,
+      k_DenyEncryptionScopeOverride,
+      k_Metadata,
+      k_Deleted,
+      k_Version,
+      k_DeletedTime,
+      k_RemainingRetentionDays,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "Name")
+        {
+          path.emplace_back(XmlTagName::k_Name);
+        }
+        else if (node.Name == "Properties")
+        {
+          path.emplace_back(XmlTagName::k_Properties);
+        }
+        else if (node.Name == "Etag")
+        {
+          path.emplace_back(XmlTagName::k_Etag);
+        }
+        else if (node.Name == "Last-Modified")
+        {
+          path.emplace_back(XmlTagName::k_LastModified);
+        }
+        else if (node.Name == "PublicAccess")
+        {
+          path.emplace_back(XmlTagName::k_PublicAccess);
+        }
+        else if (node.Name == "HasImmutabilityPolicy")
+        {
+          path.emplace_back(XmlTagName::k_HasImmutabilityPolicy);
+        }
+        else if (node.Name == "HasLegalHold")
+        {
+          path.emplace_back(XmlTagName::k_HasLegalHold);
+        }
+        else if (node.Name == "LeaseStatus")
+        {
+          path.emplace_back(XmlTagName::k_LeaseStatus);
+        }
+        else if (node.Name == "LeaseState")
+        {
+          path.emplace_back(XmlTagName::k_LeaseState);
+        }
+        else if (node.Name == "LeaseDuration")
+        {
+          path.emplace_back(XmlTagName::k_LeaseDuration);
+        }
+        else if (node.Name == "DefaultEncryptionScope")
+        {
+          path.emplace_back(XmlTagName::k_DefaultEncryptionScope);
+        }
+        else if (node.Name == "DenyEncryptionScopeOverride")
+        {
+          path.emplace_back(XmlTagName::k_DenyEncryptionScopeOverride);
+        }
+        else if (node.Name == "Metadata")
+        {
+          path.emplace_back(XmlTagName::k_Metadata);
+        }
+        else if (node.Name == "Deleted")
+        {
+          path.emplace_back(XmlTagName::k_Deleted);
+        }
+        else if (node.Name == "Version")
+        {
+          path.emplace_back(XmlTagName::k_Version);
+        }
+        else if (node.Name == "DeletedTime")
+        {
+          path.emplace_back(XmlTagName::k_DeletedTime);
+        }
+        else if (node.Name == "RemainingRetentionDays")
+        {
+          path.emplace_back(XmlTagName::k_RemainingRetentionDays);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 1 && path[0] == XmlTagName::k_Metadata)
+        {
+          ret.Details.Metadata = MetadataFromXml(reader);
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_Name)
+        {
+          ret.Name = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_Etag)
+        {
+          ret.Details.ETag = Azure::ETag(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_LastModified)
+        {
+          ret.Details.LastModified
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_PublicAccess)
+        {
+          ret.Details.AccessType = PublicAccessType(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_HasImmutabilityPolicy)
+        {
+          ret.Details.HasImmutabilityPolicy = node.Value == "true";
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_HasLegalHold)
+        {
+          ret.Details.HasLegalHold = node.Value == "true";
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_LeaseStatus)
+        {
+          ret.Details.LeaseStatus = LeaseStatus(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_LeaseState)
+        {
+          ret.Details.LeaseState = LeaseState(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_LeaseDuration)
+        {
+          ret.Details.LeaseDuration = LeaseDurationType(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_DefaultEncryptionScope)
+        {
+          ret.Details.DefaultEncryptionScope = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_DenyEncryptionScopeOverride)
+        {
+          ret.Details.PreventEncryptionScopeOverride = node.Value == "true";
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_Deleted)
+        {
+          ret.IsDeleted = node.Value == "true";
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_Version)
+        {
+          ret.VersionId = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_DeletedTime)
+        {
+          ret.Details.DeletedOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_RemainingRetentionDays)
+        {
+          ret.Details.RemainingRetentionDays = std::stoi(node.Value);
+        }
+      }
+    }
+    return ret;
+  }
+
+  CorsRule BlobRestClient::Service::CorsRuleFromXml(_internal::XmlReader& reader)
+  {
+    CorsRule ret;
+    enum class XmlTagName
+    {
+      k_AllowedOrigins,
+      k_AllowedMethods,
+      k_MaxAgeInSeconds,
+      k_ExposedHeaders,
+      k_AllowedHeaders,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "AllowedOrigins")
+        {
+          path.emplace_back(XmlTagName::k_AllowedOrigins);
+        }
+        else if (node.Name == "AllowedMethods")
+        {
+          path.emplace_back(XmlTagName::k_AllowedMethods);
+        }
+        else if (node.Name == "MaxAgeInSeconds")
+        {
+          path.emplace_back(XmlTagName::k_MaxAgeInSeconds);
+        }
+        else if (node.Name == "ExposedHeaders")
+        {
+          path.emplace_back(XmlTagName::k_ExposedHeaders);
+        }
+        else if (node.Name == "AllowedHeaders")
+        {
+          path.emplace_back(XmlTagName::k_AllowedHeaders);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_AllowedOrigins)
+        {
+          ret.AllowedOrigins = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_AllowedMethods)
+        {
+          ret.AllowedMethods = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_MaxAgeInSeconds)
+        {
+          ret.MaxAgeInSeconds = std::stoi(node.Value);
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_ExposedHeaders)
+        {
+          ret.ExposedHeaders = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_AllowedHeaders)
+        {
+          ret.AllowedHeaders = node.Value;
+        }
+      }
+    }
+    return ret;
+  }
+
+  GeoReplication BlobRestClient::Service::GeoReplicationFromXml(_internal::XmlReader& reader)
+  {
+    GeoReplication ret;
+    enum class XmlTagName
+    {
+      k_Status,
+      k_LastSyncTime,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "Status")
+        {
+          path.emplace_back(XmlTagName::k_Status);
+        }
+        else if (node.Name == "LastSyncTime")
+        {
+          path.emplace_back(XmlTagName::k_LastSyncTime);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_Status)
+        {
+          ret.Status = GeoReplicationStatus(node.Value);
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_LastSyncTime)
+        {
+          ret.LastSyncedOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+      }
+    }
+    return ret;
+  }
+
+  Metrics BlobRestClient::Service::MetricsFromXml(_internal::XmlReader& reader)
+  {
+    Metrics ret;
+    enum class XmlTagName
+    {
+      k_Version,
+      k_Enabled,
+      k_IncludeAPIs,
+      k_RetentionPolicy,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "Version")
+        {
+          path.emplace_back(XmlTagName::k_Version);
+        }
+        else if (node.Name == "Enabled")
+        {
+          path.emplace_back(XmlTagName::k_Enabled);
+        }
+        else if (node.Name == "IncludeAPIs")
+        {
+          path.emplace_back(XmlTagName::k_IncludeAPIs);
+        }
+        else if (node.Name == "RetentionPolicy")
+        {
+          path.emplace_back(XmlTagName::k_RetentionPolicy);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 1 && path[0] == XmlTagName::k_RetentionPolicy)
+        {
+          ret.RetentionPolicy = RetentionPolicyFromXml(reader);
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_Version)
+        {
+          ret.Version = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_Enabled)
+        {
+          ret.IsEnabled = node.Value == "true";
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_IncludeAPIs)
+        {
+          ret.IncludeApis = node.Value == "true";
+        }
+      }
+    }
+    return ret;
+  }
+
+  RetentionPolicy BlobRestClient::Service::RetentionPolicyFromXml(_internal::XmlReader& reader)
+  {
+    RetentionPolicy ret;
+    enum class XmlTagName
+    {
+      k_Enabled,
+      k_Days,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "Enabled")
+        {
+          path.emplace_back(XmlTagName::k_Enabled);
+        }
+        else if (node.Name == "Days")
+        {
+          path.emplace_back(XmlTagName::k_Days);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_Enabled)
+        {
+          ret.IsEnabled = node.Value == "true";
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_Days)
+        {
+          ret.Days = std::stoi(node.Value);
+        }
+      }
+    }
+    return ret;
+  }
+
+  StaticWebsite BlobRestClient::Service::StaticWebsiteFromXml(_internal::XmlReader& reader)
+  {
+    StaticWebsite ret;
+    enum class XmlTagName
+    {
+      k_Enabled,
+      k_IndexDocument,
+      k_DefaultIndexDocumentPath,
+      k_ErrorDocument404Path,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "Enabled")
+        {
+          path.emplace_back(XmlTagName::k_Enabled);
+        }
+        else if (node.Name == "IndexDocument")
+        {
+          path.emplace_back(XmlTagName::k_IndexDocument);
+        }
+        else if (node.Name == "DefaultIndexDocumentPath")
+        {
+          path.emplace_back(XmlTagName::k_DefaultIndexDocumentPath);
+        }
+        else if (node.Name == "ErrorDocument404Path")
+        {
+          path.emplace_back(XmlTagName::k_ErrorDocument404Path);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_Enabled)
+        {
+          ret.IsEnabled = node.Value == "true";
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_IndexDocument)
+        {
+          ret.IndexDocument = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_DefaultIndexDocumentPath)
+        {
+          ret.DefaultIndexDocumentPath = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_ErrorDocument404Path)
+        {
+          ret.ErrorDocument404Path = node.Value;
+        }
+      }
+    }
+    return ret;
+  }
+
+  TaggedBlobItem BlobRestClient::Service::TaggedBlobItemFromXml(_internal::XmlReader& reader)
+  {
+    TaggedBlobItem ret;
+    enum class XmlTagName
+    {
+      k_Name,
+      k_ContainerName,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "Name")
+        {
+          path.emplace_back(XmlTagName::k_Name);
+        }
+        else if (node.Name == "ContainerName")
+        {
+          path.emplace_back(XmlTagName::k_ContainerName);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_Name)
+        {
+          ret.BlobName = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_ContainerName)
+        {
+          ret.BlobContainerName = node.Value;
+        }
+      }
+    }
+    return ret;
+  }
+
+  Metadata BlobRestClient::Service::MetadataFromXml(_internal::XmlReader& reader)
+  {
+    Metadata ret;
+    int depth = 0;
+    std::string key;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (depth++ == 0)
+        {
+          key = node.Name;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (depth-- == 0)
+        {
+          break;
+        }
+      }
+      else if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
+      {
+        ret.emplace(std::move(key), node.Value);
+      }
+    }
+    return ret;
+  }
+
+  void BlobRestClient::Service::GetUserDelegationKeyOptionsToXml(
+      _internal::XmlWriter& writer,
+      const GetUserDelegationKeyOptions& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "KeyInfo"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Start"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text,
+        std::string(),
+        options.StartsOn.ToString(
+            Azure::DateTime::DateFormat::Rfc3339,
+            Azure::DateTime::TimeFractionFormat::Truncate)});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Expiry"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text,
+        std::string(),
+        options.ExpiresOn.ToString(
+            Azure::DateTime::DateFormat::Rfc3339,
+            Azure::DateTime::TimeFractionFormat::Truncate)});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+  }
+
+  void BlobRestClient::Service::SetServicePropertiesOptionsToXml(
+      _internal::XmlWriter& writer,
+      const SetServicePropertiesOptions& options)
+  {
+    writer.Write(
+        _internal::XmlNode{_internal::XmlNodeType::StartTag, "StorageServiceProperties"});
+    BlobServicePropertiesToXml(writer, options.Properties);
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+  }
+
+  void BlobRestClient::Service::BlobServicePropertiesToXml(
+      _internal::XmlWriter& writer,
+      const BlobServiceProperties& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Logging"});
+    AnalyticsLoggingToXml(writer, options.Logging);
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "HourMetrics"});
+    MetricsToXml(writer, options.HourMetrics);
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "MinuteMetrics"});
+    MetricsToXml(writer, options.MinuteMetrics);
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Cors"});
+    for (const auto& i : options.Cors)
+    {
+      CorsRuleToXml(writer, i);
+    }
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    if (options.DefaultServiceVersion.HasValue())
+    {
+      writer.Write(
+          _internal::XmlNode{_internal::XmlNodeType::StartTag, "DefaultServiceVersion"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text,
+          std::string(),
+          options.DefaultServiceVersion.Value()});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    }
+    writer.Write(
+        _internal::XmlNode{_internal::XmlNodeType::StartTag, "DeleteRetentionPolicy"});
+    RetentionPolicyToXml(writer, options.DeleteRetentionPolicy);
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "StaticWebsite"});
+    StaticWebsiteToXml(writer, options.StaticWebsite);
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+  }
+
+  void BlobRestClient::Service::AnalyticsLoggingToXml(
+      _internal::XmlWriter& writer,
+      const AnalyticsLogging& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Version"});
+    writer.Write(
+        _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Version});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Delete"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text, std::string(), options.Delete ? "true" : "false"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Read"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text, std::string(), options.Read ? "true" : "false"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Write"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text, std::string(), options.Write ? "true" : "false"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "RetentionPolicy"});
+    RetentionPolicyToXml(writer, options.RetentionPolicy);
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+  }
+
+  void BlobRestClient::Service::CorsRuleToXml(_internal::XmlWriter& writer, const CorsRule& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "CorsRule"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AllowedOrigins"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text, std::string(), options.AllowedOrigins});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AllowedMethods"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text, std::string(), options.AllowedMethods});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AllowedHeaders"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text, std::string(), options.AllowedHeaders});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "ExposedHeaders"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text, std::string(), options.ExposedHeaders});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "MaxAgeInSeconds"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text,
+        std::string(),
+        std::to_string(options.MaxAgeInSeconds)});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+  }
+
+  void BlobRestClient::Service::MetricsToXml(_internal::XmlWriter& writer, const Metrics& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Version"});
+    writer.Write(
+        _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Version});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Enabled"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text, std::string(), options.IsEnabled ? "true" : "false"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    if (options.IncludeApis.HasValue())
+    {
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "IncludeAPIs"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text,
+          std::string(),
+          options.IncludeApis.Value() ? "true" : "false"});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    }
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "RetentionPolicy"});
+    RetentionPolicyToXml(writer, options.RetentionPolicy);
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+  }
+
+  void BlobRestClient::Service::RetentionPolicyToXml(
+      _internal::XmlWriter& writer,
+      const RetentionPolicy& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Enabled"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text, std::string(), options.IsEnabled ? "true" : "false"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    if (options.Days.HasValue())
+    {
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Days"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text, std::string(), std::to_string(options.Days.Value())});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    }
+  }
+
+  void BlobRestClient::Service::StaticWebsiteToXml(
+      _internal::XmlWriter& writer,
+      const StaticWebsite& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Enabled"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text, std::string(), options.IsEnabled ? "true" : "false"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    if (options.IndexDocument.HasValue())
+    {
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "IndexDocument"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text, std::string(), options.IndexDocument.Value()});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    }
+    if (options.DefaultIndexDocumentPath.HasValue())
+    {
+      writer.Write(
+          _internal::XmlNode{_internal::XmlNodeType::StartTag, "DefaultIndexDocumentPath"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text,
+          std::string(),
+          options.DefaultIndexDocumentPath.Value()});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    }
+    if (options.ErrorDocument404Path.HasValue())
+    {
+      writer.Write(
+          _internal::XmlNode{_internal::XmlNodeType::StartTag, "ErrorDocument404Path"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text, std::string(), options.ErrorDocument404Path.Value()});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    }
+  }
+
+  Azure::Response<CreateBlobContainerResult> BlobRestClient::BlobContainer::Create(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const CreateBlobContainerOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    for (const auto& pair : options.Metadata)
+    {
+      request.SetHeader("x-ms-meta-" + pair.first, pair.second);
+    }
+    if (!options.AccessType.ToString().empty())
+    {
+      request.SetHeader("x-ms-blob-public-access", options.AccessType.ToString());
+    }
+    if (options.DefaultEncryptionScope.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-default-encryption-scope", options.DefaultEncryptionScope.Value());
+    }
+    if (options.PreventEncryptionScopeOverride.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-deny-encryption-scope-override",
+          options.PreventEncryptionScopeOverride.Value() ? "true" : "false");
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    CreateBlobContainerResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    return Azure::Response<CreateBlobContainerResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<DeleteBlobContainerResult> BlobRestClient::BlobContainer::Delete(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const DeleteBlobContainerOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Delete, url);
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    DeleteBlobContainerResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 202))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    return Azure::Response<DeleteBlobContainerResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::UndeleteBlobContainerResult>
+  BlobRestClient::BlobContainer::Undelete(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const UndeleteBlobContainerOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "undelete");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.SetHeader("x-ms-deleted-container-name", options.DeletedBlobContainerName);
+    request.SetHeader("x-ms-deleted-container-version", options.DeletedBlobContainerVersion);
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::UndeleteBlobContainerResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    return Azure::Response<Models::_detail::UndeleteBlobContainerResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<BlobContainerProperties> BlobRestClient::BlobContainer::GetProperties(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetBlobContainerPropertiesOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Head, url);
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    BlobContainerProperties response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-meta-");
+         i != httpResponse.GetHeaders().end() && i->first.substr(0, 10) == "x-ms-meta-";
+         ++i)
+    {
+      response.Metadata.emplace(i->first.substr(10), i->second);
+    }
+    auto x_ms_blob_public_access__iterator
+        = httpResponse.GetHeaders().find("x-ms-blob-public-access");
+    if (x_ms_blob_public_access__iterator != httpResponse.GetHeaders().end())
+    {
+      response.AccessType = PublicAccessType(x_ms_blob_public_access__iterator->second);
+    }
+    response.HasImmutabilityPolicy
+        = httpResponse.GetHeaders().at("x-ms-has-immutability-policy") == "true";
+    response.HasLegalHold = httpResponse.GetHeaders().at("x-ms-has-legal-hold") == "true";
+    response.LeaseStatus
+        = LeaseStatus(httpResponse.GetHeader(WellKnownHeader::XMsLeaseStatus));
+    response.LeaseState = LeaseState(httpResponse.GetHeader(WellKnownHeader::XMsLeaseState));
+    auto x_ms_lease_duration__iterator
+        = httpResponse.GetHeaders().find("x-ms-lease-duration");
+    if (x_ms_lease_duration__iterator != httpResponse.GetHeaders().end())
+    {
+      response.LeaseDuration = LeaseDurationType(x_ms_lease_duration__iterator->second);
+    }
+    response.DefaultEncryptionScope
+        = httpResponse.GetHeaders().at("x-ms-default-encryption-scope");
+    response.PreventEncryptionScopeOverride
+        = httpResponse.GetHeaders().at("x-ms-deny-encryption-scope-override") == "true";
+    return Azure::Response<BlobContainerProperties>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<SetBlobContainerMetadataResult> BlobRestClient::BlobContainer::SetMetadata(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const SetBlobContainerMetadataOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "metadata");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    for (const auto& pair : options.Metadata)
+    {
+      request.SetHeader("x-ms-meta-" + pair.first, pair.second);
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    SetBlobContainerMetadataResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    return Azure::Response<SetBlobContainerMetadataResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::ListBlobsResult> BlobRestClient::BlobContainer::ListBlobs(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ListBlobsOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "list");
+    if (options.Prefix.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "prefix", _internal::UrlEncodeQueryParameter(options.Prefix.Value()));
+    }
+    if (options.ContinuationToken.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "marker", _internal::UrlEncodeQueryParameter(options.ContinuationToken.Value()));
+    }
+    if (options.MaxResults.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "maxresults", std::to_string(options.MaxResults.Value()));
+    }
+    std::string list_blobs_include_flags = ListBlobsIncludeFlagsToString(options.Include);
+    if (!list_blobs_include_flags.empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "include", _internal::UrlEncodeQueryParameter(list_blobs_include_flags));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::ListBlobsResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& httpResponseBody = httpResponse.GetBody();
+      _internal::XmlReader reader(
+          reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
+      response = ListBlobsResultInternalFromXml(reader);
+    }
+    return Azure::Response<Models::_detail::ListBlobsResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  std::unique_ptr<Azure::Core::Http::RawResponse>
+  BlobRestClient::BlobContainer::ListBlobsUnbuffered(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ListBlobsOptions& options,
+      const Azure::Core::Context& context)
+  {
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url, false);
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "list");
+    if (options.Prefix.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "prefix", _internal::UrlEncodeQueryParameter(options.Prefix.Value()));
+    }
+    if (options.ContinuationToken.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "marker", _internal::UrlEncodeQueryParameter(options.ContinuationToken.Value()));
+    }
+    if (options.MaxResults.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "maxresults", std::to_string(options.MaxResults.Value()));
+    }
+    std::string list_blobs_include_flags = ListBlobsIncludeFlagsToString(options.Include);
+    if (!list_blobs_include_flags.empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "include", _internal::UrlEncodeQueryParameter(list_blobs_include_flags));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            pHttpResponse->GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    return pHttpResponse;
+  }
+
+  std::unique_ptr<BlobRestClient::BlobContainer::ListBlobsResultStreamReader>
+  BlobRestClient::BlobContainer::ListBlobsStreaming(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ListBlobsOptions& options,
+      const Azure::Core::Context& context)
+  {
+    return std::make_unique<ListBlobsResultStreamReader>(
+        ListBlobsUnbuffered(pipeline, url, options, context), context);
+  }
+
+  Azure::Response<Models::_detail::ListBlobsCompactResult>
+  BlobRestClient::BlobContainer::ListBlobsCompact(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ListBlobsOptions& options,
+      CompactBlobItemFields fields,
+      const Azure::Core::Context& context)
+  {
+    auto pHttpResponse = ListBlobsUnbuffered(pipeline, url, options, context);
+    Models::_detail::ListBlobsCompactResult response;
+    {
+      auto bodyStream = pHttpResponse->ExtractBodyStream();
+      _internal::XmlReader reader(*bodyStream, context);
+      response = ListBlobsCompactResultFromXml(reader, fields);
+    }
+    return Azure::Response<Models::_detail::ListBlobsCompactResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::ListBlobsByHierarchyResult>
+  BlobRestClient::BlobContainer::ListBlobsByHierarchy(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ListBlobsByHierarchyOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "list");
+    if (options.Prefix.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "prefix", _internal::UrlEncodeQueryParameter(options.Prefix.Value()));
+    }
+    if (options.Delimiter.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "delimiter", _internal::UrlEncodeQueryParameter(options.Delimiter.Value()));
+    }
+    if (options.ContinuationToken.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "marker", _internal::UrlEncodeQueryParameter(options.ContinuationToken.Value()));
+    }
+    if (options.MaxResults.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "maxresults", std::to_string(options.MaxResults.Value()));
+    }
+    std::string list_blobs_include_flags = ListBlobsIncludeFlagsToString(options.Include);
+    if (!list_blobs_include_flags.empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "include", _internal::UrlEncodeQueryParameter(list_blobs_include_flags));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::ListBlobsByHierarchyResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& httpResponseBody = httpResponse.GetBody();
+      _internal::XmlReader reader(
+          reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
+      response = ListBlobsByHierarchyResultInternalFromXml(reader);
+    }
+    return Azure::Response<Models::_detail::ListBlobsByHierarchyResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<BlobContainerAccessPolicy> BlobRestClient::BlobContainer::GetAccessPolicy(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetBlobContainerAccessPolicyOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "acl");
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    BlobContainerAccessPolicy response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& httpResponseBody = httpResponse.GetBody();
+      _internal::XmlReader reader(
+          reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
+      response = BlobContainerAccessPolicyFromXml(reader);
+    }
+    auto x_ms_blob_public_access__iterator
+        = httpResponse.GetHeaders().find("x-ms-blob-public-access");
+    if (x_ms_blob_public_access__iterator != httpResponse.GetHeaders().end())
+    {
+      response.AccessType = PublicAccessType(x_ms_blob_public_access__iterator->second);
+    }
+    return Azure::Response<BlobContainerAccessPolicy>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<SetBlobContainerAccessPolicyResult>
+  BlobRestClient::BlobContainer::SetAccessPolicy(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const SetBlobContainerAccessPolicyOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    std::string xml_body;
+    {
+      _internal::XmlWriter writer;
+      SetBlobContainerAccessPolicyOptionsToXml(writer, options);
+      xml_body = writer.GetDocument();
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
+    }
+    Azure::Core::IO::MemoryBodyStream xml_body_stream(
+        reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
+    auto request = Azure::Core::Http::Request(
+        Azure::Core::Http::HttpMethod::Put, url, &xml_body_stream);
+    request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "acl");
+    if (!options.AccessType.ToString().empty())
+    {
+      request.SetHeader("x-ms-blob-public-access", options.AccessType.ToString());
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    SetBlobContainerAccessPolicyResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    return Azure::Response<SetBlobContainerAccessPolicyResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::AcquireBlobContainerLeaseResult>
+  BlobRestClient::BlobContainer::AcquireLease(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const AcquireBlobContainerLeaseOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "lease");
+    request.SetHeader("x-ms-lease-action", "acquire");
+    request.SetHeader("x-ms-lease-duration", std::to_string(options.LeaseDuration.count()));
+    if (options.ProposedLeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-proposed-lease-id", options.ProposedLeaseId.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::AcquireBlobContainerLeaseResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.LeaseId = httpResponse.GetHeader(WellKnownHeader::XMsLeaseId);
+    return Azure::Response<Models::_detail::AcquireBlobContainerLeaseResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::RenewBlobContainerLeaseResult>
+  BlobRestClient::BlobContainer::RenewLease(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const RenewBlobContainerLeaseOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "lease");
+    request.SetHeader("x-ms-lease-action", "renew");
+    request.SetHeader("x-ms-lease-id", options.LeaseId);
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::RenewBlobContainerLeaseResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.LeaseId = httpResponse.GetHeader(WellKnownHeader::XMsLeaseId);
+    return Azure::Response<Models::_detail::RenewBlobContainerLeaseResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::ChangeBlobContainerLeaseResult>
+  BlobRestClient::BlobContainer::ChangeLease(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ChangeBlobContainerLeaseOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "lease");
+    request.SetHeader("x-ms-lease-action", "change");
+    request.SetHeader("x-ms-lease-id", options.LeaseId);
+    request.SetHeader("x-ms-proposed-lease-id", options.ProposedLeaseId);
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::ChangeBlobContainerLeaseResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.LeaseId = httpResponse.GetHeader(WellKnownHeader::XMsLeaseId);
+    return Azure::Response<Models::_detail::ChangeBlobContainerLeaseResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::ReleaseBlobContainerLeaseResult>
+  BlobRestClient::BlobContainer::ReleaseLease(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ReleaseBlobContainerLeaseOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "lease");
+    request.SetHeader("x-ms-lease-action", "release");
+    request.SetHeader("x-ms-lease-id", options.LeaseId);
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::ReleaseBlobContainerLeaseResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    return Azure::Response<Models::_detail::ReleaseBlobContainerLeaseResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::BreakBlobContainerLeaseResult>
+  BlobRestClient::BlobContainer::BreakLease(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const BreakBlobContainerLeaseOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "lease");
+    request.SetHeader("x-ms-lease-action", "break");
+    if (options.BreakPeriod.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-lease-break-period", std::to_string(options.BreakPeriod.Value().count()));
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::BreakBlobContainerLeaseResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 202))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.LeaseTime = std::stoi(httpResponse.GetHeaders().at("x-ms-lease-time"));
+    return Azure::Response<Models::_detail::BreakBlobContainerLeaseResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  BlobContainerAccessPolicy
+  BlobRestClient::BlobContainer::BlobContainerAccessPolicyFromXml(_internal::XmlReader& reader)
+  {
+    BlobContainerAccessPolicy ret;
+    enum class XmlTagName
+    {
+      k_SignedIdentifiers,
+      k_SignedIdentifier,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "SignedIdentifiers")
+        {
+          path.emplace_back(XmlTagName::k_SignedIdentifiers);
+        }
+        else if (node.Name == "SignedIdentifier")
+        {
+          path.emplace_back(XmlTagName::k_SignedIdentifier);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 2 && path[0] == XmlTagName::k_SignedIdentifiers
+            && path[1] == XmlTagName::k_SignedIdentifier)
+        {
+          ret.SignedIdentifiers.emplace_back(SignedIdentifierFromXml(reader));
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+      }
+    }
+    return ret;
+  }
+
+  Models::_detail::ListBlobsByHierarchyResult
+  BlobRestClient::BlobContainer::ListBlobsByHierarchyResultInternalFromXml(
+      _internal::XmlReader& reader)
+  {
+    Models::_detail::ListBlobsByHierarchyResult ret;
+    enum class XmlTagName
+    {
+      k_EnumerationResults,
+      k_Prefix,
+      k_Delimiter,
+      k_NextMarker,
+      k_Blobs,
+      k_Blob,
+      k_BlobPrefix,
+      k_Name,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "EnumerationResults")
+        {
+          path.emplace_back(XmlTagName::k_EnumerationResults);
+        }
+        else if (node.Name == "Prefix")
+        {
+          path.emplace_back(XmlTagName::k_Prefix);
+        }
+        else if (node.Name == "Delimiter")
+        {
+          path.emplace_back(XmlTagName::k_Delimiter);
+        }
+        else if (node.Name == "NextMarker")
+        {
+          path.emplace_back(XmlTagName::k_NextMarker);
+        }
+        else if (node.Name == "Blobs")
+        {
+          path.emplace_back(XmlTagName::k_Blobs);
+        }
+        else if (node.Name == "Blob")
+        {
+          path.emplace_back(XmlTagName::k_Blob);
+        }
+        else if (node.Name == "BlobPrefix")
+        {
+          path.emplace_back(XmlTagName::k_BlobPrefix);
+        }
+        else if (node.Name == "Name")
+        {
+          path.emplace_back(XmlTagName::k_Name);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
+        {
+          ret.Items.emplace_back(BlobItemFromXml(reader));
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Prefix)
+        {
+          ret.Prefix = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Delimiter)
+        {
+          ret.Delimiter = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_NextMarker)
+        {
+          ret.ContinuationToken = node.Value;
+        }
+        else if (
+            path.size() == 4 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_BlobPrefix
+            && path[3] == XmlTagName::k_Name)
+        {
+          ret.BlobPrefixes.emplace_back(node.Value);
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Attribute)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
+            && node.Name == "ServiceEndpoint")
+        {
+          ret.ServiceEndpoint = node.Value;
+        }
+        else if (
+            path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
+            && node.Name == "ContainerName")
+        {
+          ret.BlobContainerName = node.Value;
+        }
+      }
+    }
+    return ret;
+  }
+
+  Models::_detail::ListBlobsCompactResult
+  BlobRestClient::BlobContainer::ListBlobsCompactResultFromXml(
+      _internal::XmlReader& reader,
+      CompactBlobItemFields fields)
+  {
+    Models::_detail::ListBlobsCompactResult ret;
+    enum class XmlTagName
+    {
+      k_EnumerationResults,
+      k_Prefix,
+      k_NextMarker,
+      k_Blobs,
+      k_Blob,
+      k_Name,
+      k_Deleted,
+      k_Properties,
+      k_ContentLength,
+      k_Etag,
+      k_LastModified,
+      k_Unknown,
+    };
+    const bool needBlobSize
+        = (fields & CompactBlobItemFields::BlobSize) == CompactBlobItemFields::BlobSize;
+    const bool needETag
+        = (fields & CompactBlobItemFields::ETag) == CompactBlobItemFields::ETag;
+    const bool needLastModified = (fields & CompactBlobItemFields::LastModified)
+        == CompactBlobItemFields::LastModified;
+    const bool needIsDeleted
+        = (fields & CompactBlobItemFields::IsDeleted) == CompactBlobItemFields::IsDeleted;
+    // The strings are appended to the arena, which may grow, so they are pointed to once all
+    // of them are there. Names and ETags are NUL-terminated in the arena.
+    struct ArenaStrings final
+    {
+      size_t NameOffset = 0;
+      size_t ETagOffset = 0;
+      bool HasETag = false;
+    };
+    std::vector<ArenaStrings> arenaStrings;
+    auto appendToArena = [&ret](const _internal::XmlString& value) {
+      size_t offset = ret.Arena.size();
+      ret.Arena.insert(ret.Arena.end(), value.data(), value.data() + value.length());
+      ret.Arena.push_back('\0');
+      return offset;
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "EnumerationResults")
+        {
+          path.emplace_back(XmlTagName::k_EnumerationResults);
+        }
+        else if (node.Name == "Prefix")
+        {
+          path.emplace_back(XmlTagName::k_Prefix);
+        }
+        else if (node.Name == "NextMarker")
+        {
+          path.emplace_back(XmlTagName::k_NextMarker);
+        }
+        else if (node.Name == "Blobs")
+        {
+          path.emplace_back(XmlTagName::k_Blobs);
+        }
+        else if (node.Name == "Blob")
+        {
+          path.emplace_back(XmlTagName::k_Blob);
+        }
+        else if (node.Name == "Name")
+        {
+          path.emplace_back(XmlTagName::k_Name);
+        }
+        else if (node.Name == "Deleted")
+        {
+          path.emplace_back(XmlTagName::k_Deleted);
+        }
+        else if (node.Name == "Properties")
+        {
+          path.emplace_back(XmlTagName::k_Properties);
+        }
+        else if (node.Name == "Content-Length")
+        {
+          path.emplace_back(XmlTagName::k_ContentLength);
+        }
+        else if (node.Name == "Etag")
+        {
+          path.emplace_back(XmlTagName::k_Etag);
+        }
+        else if (node.Name == "Last-Modified")
+        {
+          path.emplace_back(XmlTagName::k_LastModified);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
+        {
+          ret.Items.emplace_back();
+          arenaStrings.emplace_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Prefix)
+        {
+          ret.Prefix = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_NextMarker)
+        {
+          ret.ContinuationToken = node.Value;
+        }
+        else if (
+            path.size() == 4 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob
+            && path[3] == XmlTagName::k_Name)
+        {
+          arenaStrings.back().NameOffset = appendToArena(node.Value);
+          ret.Items.back().NameLength = node.Value.length();
+        }
+        else if (
+            needIsDeleted && path.size() == 4 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob
+            && path[3] == XmlTagName::k_Deleted)
+        {
+          ret.Items.back().IsDeleted = node.Value == "true";
+        }
+        else if (
+            path.size() == 5 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob
+            && path[3] == XmlTagName::k_Properties)
+        {
+          if (needBlobSize && path[4] == XmlTagName::k_ContentLength)
+          {
+            ret.Items.back().BlobSize = std::strtoll(node.Value.data(), nullptr, 10);
+          }
+          else if (needETag && path[4] == XmlTagName::k_Etag)
+          {
+            arenaStrings.back().ETagOffset = appendToArena(node.Value);
+            arenaStrings.back().HasETag = true;
+          }
+          else if (needLastModified && path[4] == XmlTagName::k_LastModified)
+          {
+            ret.Items.back().LastModified
+                = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+          }
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Attribute)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
+            && node.Name == "ServiceEndpoint")
+        {
+          ret.ServiceEndpoint = node.Value;
+        }
+        else if (
+            path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
+            && node.Name == "ContainerName")
+        {
+          ret.BlobContainerName = node.Value;
+        }
+      }
+    }
+    for (size_t i = 0; i < ret.Items.size(); ++i)
+    {
+      if (ret.Items[i].NameLength != 0)
+      {
+        ret.Items[i].Name = &ret.Arena[arenaStrings[i].NameOffset];
+      }
+      if (arenaStrings[i].HasETag)
+      {
+        ret.Items[i].ETag = &ret.Arena[arenaStrings[i].ETagOffset];
+      }
+    }
+    return ret;
+  }
+
+  Models::_detail::ListBlobsResult
+  BlobRestClient::BlobContainer::ListBlobsResultInternalFromXml(_internal::XmlReader& reader)
+  {
+    Models::_detail::ListBlobsResult ret;
+    enum class XmlTagName
+    {
+      k_EnumerationResults,
+      k_Prefix,
+      k_NextMarker,
+      k_Blobs,
+      k_Blob,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "EnumerationResults")
+        {
+          path.emplace_back(XmlTagName::k_EnumerationResults);
+        }
+        else if (node.Name == "Prefix")
+        {
+          path.emplace_back(XmlTagName::k_Prefix);
+        }
+        else if (node.Name == "NextMarker")
+        {
+          path.emplace_back(XmlTagName::k_NextMarker);
+        }
+        else if (node.Name == "Blobs")
+        {
+          path.emplace_back(XmlTagName::k_Blobs);
+        }
+        else if (node.Name == "Blob")
+        {
+          path.emplace_back(XmlTagName::k_Blob);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
+        {
+          ret.Items.emplace_back(BlobItemFromXml(reader));
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_Prefix)
+        {
+          ret.Prefix = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_EnumerationResults
+            && path[1] == XmlTagName::k_NextMarker)
+        {
+          ret.ContinuationToken = node.Value;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Attribute)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
+            && node.Name == "ServiceEndpoint")
+        {
+          ret.ServiceEndpoint = node.Value;
+        }
+        else if (
+            path.size() == 1 && path[0] == XmlTagName::k_EnumerationResults
+            && node.Name == "ContainerName")
+        {
+          ret.BlobContainerName = node.Value;
+        }
+      }
+    }
+    return ret;
+  }
+
+  BlobItem BlobRestClient::BlobContainer::BlobItemFromXml(_internal::XmlReader& reader)
+  {
+    BlobItem ret;
+    enum class XmlTagName
+    {
+      k_Name,
+      k_Deleted,
+      k_Snapshot,
+      k_VersionId,
+      k_IsCurrentVersion,
+      k_Properties,
+      k_ContentType,
+      k_ContentEncoding,
+      k_ContentLanguage,
+      k_ContentMD5,
+      k_CacheControl,
+      k_ContentDisposition,
+      k_CreationTime,
+      k_ExpiryTime,
+      k_LastAccessTime,
+      k_LastModified,
+      k_Etag,
+      k_ContentLength,
+      k_BlobType,
+      k_AccessTier,
+      k_AccessTierInferred,
+      k_AccessTierChangeTime,
+      k_ArchiveStatus,
+      k_RehydratePriority,
+      k_LeaseStatus,
+      k_LeaseState,
+      k_LeaseDuration,
+      k_ServerEncrypted,
+      k_CustomerProvidedKeySha256,
+      k_EncryptionScope,
+      k_Sealed,
+      k_xmsblobsequencenumber,
+      k_CopyId,
+      k_CopyStatus,
+      k_CopySource,
+      k_CopyProgress,
+      k_CopyCompletionTime,
+      k_CopyStatusDescription,
+      k_IncrementalCopy,
+      k_CopyDestinationSnapshot,
+      k_DeletedTime,
+      k_RemainingRetentionDays,
+      k_TagCount,
+      k_Metadata,
+      k_OrMetadata,
+      k_Tags,
+      k_TagSet,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "Name")
+        {
+          path.emplace_back(XmlTagName::k_Name);
+        }
+        else if (node.Name == "Deleted")
+        {
+          path.emplace_back(XmlTagName::k_Deleted);
+        }
+        else if (node.Name == "Snapshot")
+        {
+          path.emplace_back(XmlTagName::k_Snapshot);
+        }
+        else if (node.Name == "VersionId")
+        {
+          path.emplace_back(XmlTagName::k_VersionId);
+        }
+        else if (node.Name == "IsCurrentVersion")
+        {
+          path.emplace_back(XmlTagName::k_IsCurrentVersion);
+        }
+        else if (node.Name == "Properties")
+        {
+          path.emplace_back(XmlTagName::k_Properties);
+        }
+        else if (node.Name == "Content-Type")
+        {
+          path.emplace_back(XmlTagName::k_ContentType);
+        }
+        else if (node.Name == "Content-Encoding")
+        {
+          path.emplace_back(XmlTagName::k_ContentEncoding);
+        }
+        else if (node.Name == "Content-Language")
+        {
+          path.emplace_back(XmlTagName::k_ContentLanguage);
+        }
+        else if (node.Name == "Content-MD5")
+        {
+          path.emplace_back(XmlTagName::k_ContentMD5);
+        }
+        else if (node.Name == "Cache-Control")
+        {
+          path.emplace_back(XmlTagName::k_CacheControl);
+        }
+        else if (node.Name == "Content-Disposition")
+        {
+          path.emplace_back(XmlTagName::k_ContentDisposition);
+        }
+        else if (node.Name == "Creation-Time")
+        {
+          path.emplace_back(XmlTagName::k_CreationTime);
+        }
+        else if (node.Name == "Expiry-Time")
+        {
+          path.emplace_back(XmlTagName::k_ExpiryTime);
+        }
+        else if (node.Name == "LastAccessTime")
+        {
+          path.emplace_back(XmlTagName::k_LastAccessTime);
+        }
+        else if (node.Name == "Last-Modified")
+        {
+          path.emplace_back(XmlTagName::k_LastModified);
+        }
+        else if (node.Name == "Etag")
+        {
+          path.emplace_back(XmlTagName::k_Etag);
+        }
+        else if (node.Name == "Content-Length")
+        {
+          path.emplace_back(XmlTagName::k_ContentLength);
+        }
+        else if (node.Name == "BlobType")
+        {
+          path.emplace_back(XmlTagName::k_BlobType);
+        }
+        else if (node.Name == "AccessTier")
+        {
+          path.emplace_back(XmlTagName::k_AccessTier);
+        }
+        else if (node.Name == "AccessTierInferred")
+        {
+          path.emplace_back(XmlTagName::k_AccessTierInferred);
+        }
+        else if (node.Name == "AccessTierChangeTime")
+        {
+          path.emplace_back(XmlTagName::k_AccessTierChangeTime);
+        }
+        else if (node.Name == "ArchiveStatus")
+        {
+          path.emplace_back(XmlTagName::k_ArchiveStatus);
+        }
+        else if (node.Name == "RehydratePriority")
+        {
+          path.emplace_back(XmlTagName::k_RehydratePriority);
+        }
+        else if (node.Name == "LeaseStatus")
+        {
+          path.emplace_back(XmlTagName::k_LeaseStatus);
+        }
+        else if (node.Name == "LeaseState")
+        {
+          path.emplace_back(XmlTagName::k_LeaseState);
+        }
+        else if (node.Name == "LeaseDuration")
+        {
+          path.emplace_back(XmlTagName::k_LeaseDuration);
+        }
+        else if (node.Name == "ServerEncrypted")
+        {
+          path.emplace_back(XmlTagName::k_ServerEncrypted);
+        }
+        else if (node.Name == "CustomerProvidedKeySha256")
+        {
+          path.emplace_back(XmlTagName::k_CustomerProvidedKeySha256);
+        }
+        else if (node.Name == "EncryptionScope")
+        {
+          path.emplace_back(XmlTagName::k_EncryptionScope);
+        }
+        else if (node.Name == "Sealed")
+        {
+          path.emplace_back(XmlTagName::k_Sealed);
+        }
+        else if (node.Name == "x-ms-blob-sequence-number")
+        {
+          path.emplace_back(XmlTagName::k_xmsblobsequencenumber);
+        }
+        else if (node.Name == "CopyId")
+        {
+          path.emplace_back(XmlTagName::k_CopyId);
+        }
+        else if (node.Name == "CopyStatus")
+        {
+          path.emplace_back(XmlTagName::k_CopyStatus);
+        }
+        else if (node.Name == "CopySource")
+        {
+          path.emplace_back(XmlTagName::k_CopySource);
+        }
+        else if (node.Name == "CopyProgress")
+        {
+          path.emplace_back(XmlTagName::k_CopyProgress);
+        }
+        else if (node.Name == "CopyCompletionTime")
+        {
+          path.emplace_back(XmlTagName::k_CopyCompletionTime);
+        }
+        else if (node.Name == "CopyStatusDescription")
+        {
+          path.emplace_back(XmlTagName::k_CopyStatusDescription);
+        }
+        else if (node.Name == "IncrementalCopy")
+        {
+          path.emplace_back(XmlTagName::k_IncrementalCopy);
+        }
+        else if (node.Name == "CopyDestinationSnapshot")
+        {
+          path.emplace_back(XmlTagName::k_CopyDestinationSnapshot);
+        }
+        else if (node.Name == "DeletedTime")
+        {
+          path.emplace_back(XmlTagName::k_DeletedTime);
+        }
+        else if (node.Name == "RemainingRetentionDays")
+        {
+          path.emplace_back(XmlTagName::k_RemainingRetentionDays);
+        }
+        else if (node.Name == "TagCount")
+        {
+          path.emplace_back(XmlTagName::k_TagCount);
+        }
+        else if (node.Name == "Metadata")
+        {
+          path.emplace_back(XmlTagName::k_Metadata);
+        }
+        else if (node.Name == "OrMetadata")
+        {
+          path.emplace_back(XmlTagName::k_OrMetadata);
+        }
+        else if (node.Name == "Tags")
+        {
+          path.emplace_back(XmlTagName::k_Tags);
+        }
+        else if (node.Name == "TagSet")
+        {
+          path.emplace_back(XmlTagName::k_TagSet);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 1 && path[0] == XmlTagName::k_Metadata)
+        {
+          ret.Details.Metadata = MetadataFromXml(reader);
+          path.pop_back();
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_OrMetadata)
+        {
+          ret.Details.ObjectReplicationSourceProperties
+              = ObjectReplicationSourcePropertiesFromXml(reader);
+          path.pop_back();
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Tags
+            && path[1] == XmlTagName::k_TagSet)
+        {
+          ret.Details.Tags = TagsFromXml(reader);
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_Name)
+        {
+          ret.Name = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_Deleted)
+        {
+          ret.IsDeleted = node.Value == "true";
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_Snapshot)
+        {
+          ret.Snapshot = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_VersionId)
+        {
+          ret.VersionId = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_IsCurrentVersion)
+        {
+          ret.IsCurrentVersion = node.Value == "true";
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_ContentType)
+        {
+          ret.Details.HttpHeaders.ContentType = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_ContentEncoding)
+        {
+          ret.Details.HttpHeaders.ContentEncoding = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_ContentLanguage)
+        {
+          ret.Details.HttpHeaders.ContentLanguage = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_ContentMD5)
+        {
+          ret.Details.HttpHeaders.ContentHash.Value
+              = Azure::Core::Convert::Base64Decode(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_CacheControl)
+        {
+          ret.Details.HttpHeaders.CacheControl = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_ContentDisposition)
+        {
+          ret.Details.HttpHeaders.ContentDisposition = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_CreationTime)
+        {
+          ret.Details.CreatedOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_ExpiryTime)
+        {
+          ret.Details.ExpiresOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_LastAccessTime)
+        {
+          ret.Details.LastAccessedOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_LastModified)
+        {
+          ret.Details.LastModified
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_Etag)
+        {
+          ret.Details.ETag = Azure::ETag(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_ContentLength)
+        {
+          ret.BlobSize = std::stoll(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_BlobType)
+        {
+          ret.BlobType = BlobType(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_AccessTier)
+        {
+          ret.Details.AccessTier = AccessTier(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_AccessTierInferred)
+        {
+          ret.Details.IsAccessTierInferred = node.Value == "true";
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_AccessTierChangeTime)
+        {
+          ret.Details.AccessTierChangedOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_ArchiveStatus)
+        {
+          ret.Details.ArchiveStatus = ArchiveStatus(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_RehydratePriority)
+        {
+          ret.Details.RehydratePriority = RehydratePriority(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_LeaseStatus)
+        {
+          ret.Details.LeaseStatus = LeaseStatus(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_LeaseState)
+        {
+          ret.Details.LeaseState = LeaseState(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_LeaseDuration)
+        {
+          ret.Details.LeaseDuration = LeaseDurationType(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_ServerEncrypted)
+        {
+          ret.Details.IsServerEncrypted = node.Value == "true";
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_CustomerProvidedKeySha256)
+        {
+          ret.Details.EncryptionKeySha256 = Azure::Core::Convert::Base64Decode(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_EncryptionScope)
+        {
+          ret.Details.EncryptionScope = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_Sealed)
+        {
+          ret.Details.IsSealed = node.Value == "true";
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_xmsblobsequencenumber)
+        {
+          ret.Details.SequenceNumber = std::stoll(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_CopyId)
+        {
+          ret.Details.CopyId = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_CopyStatus)
+        {
+          ret.Details.CopyStatus = CopyStatus(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_CopySource)
+        {
+          ret.Details.CopySource = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_CopyProgress)
+        {
+          ret.Details.CopyProgress = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_CopyCompletionTime)
+        {
+          ret.Details.CopyCompletedOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_CopyStatusDescription)
+        {
+          ret.Details.CopyStatusDescription = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_IncrementalCopy)
+        {
+          ret.Details.IsIncrementalCopy = node.Value == "true";
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_CopyDestinationSnapshot)
+        {
+          ret.Details.IncrementalCopyDestinationSnapshot = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_DeletedTime)
+        {
+          ret.Details.DeletedOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_RemainingRetentionDays)
+        {
+          ret.Details.RemainingRetentionDays = std::stoi(node.Value);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_Properties
+            && path[1] == XmlTagName::k_TagCount)
+        {
+          ret.Details.TagCount = std::stoi(node.Value);
+        }
+      }
+    }
+    return ret;
+  }
+
+  SignedIdentifier
+  BlobRestClient::BlobContainer::SignedIdentifierFromXml(_internal::XmlReader& reader)
+  {
+    SignedIdentifier ret;
+    enum class XmlTagName
+    {
+      k_Id,
+      k_AccessPolicy,
+      k_Start,
+      k_Expiry,
+      k_Permission,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "Id")
+        {
+          path.emplace_back(XmlTagName::k_Id);
+        }
+        else if (node.Name == "AccessPolicy")
+        {
+          path.emplace_back(XmlTagName::k_AccessPolicy);
+        }
+        else if (node.Name == "Start")
+        {
+          path.emplace_back(XmlTagName::k_Start);
+        }
+        else if (node.Name == "Expiry")
+        {
+          path.emplace_back(XmlTagName::k_Expiry);
+        }
+        else if (node.Name == "Permission")
+        {
+          path.emplace_back(XmlTagName::k_Permission);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_Id)
+        {
+          ret.Id = node.Value;
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_AccessPolicy
+            && path[1] == XmlTagName::k_Start)
+        {
+          ret.StartsOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_AccessPolicy
+            && path[1] == XmlTagName::k_Expiry)
+        {
+          ret.ExpiresOn
+              = Azure::DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_AccessPolicy
+            && path[1] == XmlTagName::k_Permission)
+        {
+          ret.Permissions = node.Value;
+        }
+      }
+    }
+    return ret;
+  }
+
+  std::map<std::string, std::string>
+  BlobRestClient::BlobContainer::TagsFromXml(_internal::XmlReader& reader)
+  {
+    std::map<std::string, std::string> ret;
+    int depth = 0;
+    std::string key;
+    bool is_key = false;
+    bool is_value = false;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        ++depth;
+        if (node.Name == "Key")
+        {
+          is_key = true;
+        }
+        else if (node.Name == "Value")
+        {
+          is_value = true;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (depth-- == 0)
+        {
+          break;
+        }
+      }
+      if (depth == 2 && node.Type == _internal::XmlNodeType::Text)
+      {
+        if (is_key)
+        {
+          key = node.Value;
+          is_key = false;
+        }
+        else if (is_value)
+        {
+          ret.emplace(std::move(key), node.Value);
+          is_value = false;
+        }
+      }
+    }
+    return ret;
+  }
+
+  std::vector<ObjectReplicationPolicy>
+  BlobRestClient::BlobContainer::ObjectReplicationSourcePropertiesFromXml(
+      _internal::XmlReader& reader)
+  {
+    int depth = 0;
+    std::map<std::string, std::vector<ObjectReplicationRule>> orPropertiesMap;
+    std::string policyId;
+    std::string ruleId;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        ++depth;
+        std::string startTagName = node.Name;
+        if (startTagName.substr(0, 3) == "or-")
+        {
+          auto underscorePos = startTagName.find('_', 3);
+          policyId
+              = std::string(startTagName.begin() + 3, startTagName.begin() + underscorePos);
+          ruleId = startTagName.substr(underscorePos + 1);
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (depth-- == 0)
+        {
+          break;
+        }
+      }
+      if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
+      {
+        ObjectReplicationRule rule;
+        rule.RuleId = std::move(ruleId);
+        rule.ReplicationStatus = ObjectReplicationStatus(node.Value);
+        orPropertiesMap[policyId].emplace_back(std::move(rule));
+      }
+    }
+    std::vector<ObjectReplicationPolicy> ret;
+    for (auto& property : orPropertiesMap)
+    {
+      ObjectReplicationPolicy policy;
+      policy.PolicyId = property.first;
+      policy.Rules = std::move(property.second);
+      ret.emplace_back(std::move(policy));
+    }
+    return ret;
+  }
+
+  Metadata BlobRestClient::BlobContainer::MetadataFromXml(_internal::XmlReader& reader)
+  {
+    Metadata ret;
+    int depth = 0;
+    std::string key;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (depth++ == 0)
+        {
+          key = node.Name;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (depth-- == 0)
+        {
+          break;
+        }
+      }
+      else if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
+      {
+        ret.emplace(std::move(key), node.Value);
+      }
+    }
+    return ret;
+  }
+
+  void BlobRestClient::BlobContainer::SetBlobContainerAccessPolicyOptionsToXml(
+      _internal::XmlWriter& writer,
+      const SetBlobContainerAccessPolicyOptions& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "SignedIdentifiers"});
+    for (const auto& i : options.SignedIdentifiers)
+    {
+      SignedIdentifierToXml(writer, i);
+    }
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+  }
+
+  void BlobRestClient::BlobContainer::SignedIdentifierToXml(
+      _internal::XmlWriter& writer,
+      const SignedIdentifier& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "SignedIdentifier"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Id"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Id});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AccessPolicy"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Start"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text,
+        std::string(),
+        options.StartsOn.ToString(
+            Azure::DateTime::DateFormat::Rfc3339,
+            Azure::DateTime::TimeFractionFormat::AllDigits)});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Expiry"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text,
+        std::string(),
+        options.ExpiresOn.ToString(
+            Azure::DateTime::DateFormat::Rfc3339,
+            Azure::DateTime::TimeFractionFormat::AllDigits)});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Permission"});
+    writer.Write(
+        _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Permissions});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+  }
+
+  Azure::Core::Http::Request BlobRestClient::Blob::DownloadCreateMessage(
+      const Azure::Core::Url& url,
+      const DownloadBlobOptions& options)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url, false);
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.Range.HasValue())
+    {
+      std::string headerValue = "bytes=" + std::to_string(options.Range.Value().Offset) + "-";
+      if (options.Range.Value().Length.HasValue())
+      {
+        headerValue += std::to_string(
+            options.Range.Value().Offset + options.Range.Value().Length.Value() - 1);
+      }
+      request.SetHeader("x-ms-range", std::move(headerValue));
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.RangeHashAlgorithm.HasValue())
+    {
+      if (options.RangeHashAlgorithm.Value() == HashAlgorithm::Md5)
+      {
+        request.SetHeader("x-ms-range-get-content-md5", "true");
+      }
+      else if (options.RangeHashAlgorithm.Value() == HashAlgorithm::Crc64)
+      {
+        request.SetHeader("x-ms-range-get-content-crc64", "true");
+      }
+    }
+    return request;
+  }
+
+  Azure::Response<DownloadBlobResult> BlobRestClient::Blob::DownloadCreateResponse(
+      std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
+      const Azure::Core::Context& context)
+  {
+    (void)context;
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    DownloadBlobResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200 || http_status_code == 206))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.BodyStream = httpResponse.ExtractBodyStream();
+    {
+      const auto& headers = httpResponse.GetHeaders();
+      auto content_md5_iterator = headers.find("content-md5");
+      if (content_md5_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Md5;
+        hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+      auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
+      if (x_ms_content_crc64_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+    }
+    response.BlobType = BlobType(httpResponse.GetHeader(WellKnownHeader::XMsBlobType));
+    auto content_range_iterator = httpResponse.GetHeaders().find("content-range");
+    if (content_range_iterator != httpResponse.GetHeaders().end())
+    {
+      const std::string& content_range = content_range_iterator->second;
+      auto bytes_pos = content_range.find("bytes ");
+      auto dash_pos = content_range.find("-", bytes_pos + 6);
+      auto slash_pos = content_range.find("/", dash_pos + 1);
+      int64_t range_start_offset = std::stoll(std::string(
+          content_range.begin() + bytes_pos + 6, content_range.begin() + dash_pos));
+      int64_t range_end_offset = std::stoll(std::string(
+          content_range.begin() + dash_pos + 1, content_range.begin() + slash_pos));
+      response.ContentRange = Azure::Core::Http::HttpRange{
+          range_start_offset, range_end_offset - range_start_offset + 1};
+    }
+    else
+    {
+      response.ContentRange = Azure::Core::Http::HttpRange{
+          0, std::stoll(httpResponse.GetHeader(WellKnownHeader::ContentLength))};
+    }
+    if (content_range_iterator != httpResponse.GetHeaders().end())
+    {
+      const std::string& content_range = content_range_iterator->second;
+      auto slash_pos = content_range.find("/");
+      response.BlobSize = std::stoll(content_range.substr(slash_pos + 1));
+    }
+    else
+    {
+      response.BlobSize = std::stoll(httpResponse.GetHeader(WellKnownHeader::ContentLength));
+    }
+    response.Details.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.Details.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    auto content_type__iterator = httpResponse.GetHeaders().find("content-type");
+    if (content_type__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.HttpHeaders.ContentType = content_type__iterator->second;
+    }
+    auto content_encoding__iterator = httpResponse.GetHeaders().find("content-encoding");
+    if (content_encoding__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.HttpHeaders.ContentEncoding = content_encoding__iterator->second;
+    }
+    auto content_language__iterator = httpResponse.GetHeaders().find("content-language");
+    if (content_language__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.HttpHeaders.ContentLanguage = content_language__iterator->second;
+    }
+    auto cache_control__iterator = httpResponse.GetHeaders().find("cache-control");
+    if (cache_control__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.HttpHeaders.CacheControl = cache_control__iterator->second;
+    }
+    if (http_status_code == 200)
+    {
+      auto content_md5__iterator = httpResponse.GetHeaders().find("content-md5");
+      if (content_md5__iterator != httpResponse.GetHeaders().end())
+      {
+        response.Details.HttpHeaders.ContentHash.Value
+            = Azure::Core::Convert::Base64Decode(content_md5__iterator->second);
+      }
+    }
+    auto x_ms_blob_content_md5__iterator
+        = httpResponse.GetHeaders().find("x-ms-blob-content-md5");
+    if (x_ms_blob_content_md5__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.HttpHeaders.ContentHash.Value
+          = Azure::Core::Convert::Base64Decode(x_ms_blob_content_md5__iterator->second);
+    }
+    auto content_disposition__iterator
+        = httpResponse.GetHeaders().find("content-disposition");
+    if (content_disposition__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.HttpHeaders.ContentDisposition = content_disposition__iterator->second;
+    }
+    for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-meta-");
+         i != httpResponse.GetHeaders().end() && i->first.substr(0, 10) == "x-ms-meta-";
+         ++i)
+    {
+      response.Details.Metadata.emplace(i->first.substr(10), i->second);
+    }
+    response.Details.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    auto x_ms_lease_status__iterator = httpResponse.GetHeaders().find("x-ms-lease-status");
+    if (x_ms_lease_status__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.LeaseStatus = LeaseStatus(x_ms_lease_status__iterator->second);
+    }
+    auto x_ms_lease_state__iterator = httpResponse.GetHeaders().find("x-ms-lease-state");
+    if (x_ms_lease_state__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.LeaseState = LeaseState(x_ms_lease_state__iterator->second);
+    }
+    auto x_ms_lease_duration__iterator
+        = httpResponse.GetHeaders().find("x-ms-lease-duration");
+    if (x_ms_lease_duration__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.LeaseDuration
+          = LeaseDurationType(x_ms_lease_duration__iterator->second);
+    }
+    response.Details.CreatedOn = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::XMsCreationTime),
+        Azure::DateTime::DateFormat::Rfc1123);
+    auto x_ms_expiry_time__iterator = httpResponse.GetHeaders().find("x-ms-expiry-time");
+    if (x_ms_expiry_time__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.ExpiresOn = Azure::DateTime::Parse(
+          x_ms_expiry_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
+    }
+    auto x_ms_last_access_time__iterator
+        = httpResponse.GetHeaders().find("x-ms-last-access-time");
+    if (x_ms_last_access_time__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.LastAccessedOn = Azure::DateTime::Parse(
+          x_ms_last_access_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
+    }
+    auto x_ms_blob_sequence_number__iterator
+        = httpResponse.GetHeaders().find("x-ms-blob-sequence-number");
+    if (x_ms_blob_sequence_number__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.SequenceNumber
+          = std::stoll(x_ms_blob_sequence_number__iterator->second);
+    }
+    auto x_ms_blob_committed_block_count__iterator
+        = httpResponse.GetHeaders().find("x-ms-blob-committed-block-count");
+    if (x_ms_blob_committed_block_count__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.CommittedBlockCount
+          = std::stoi(x_ms_blob_committed_block_count__iterator->second);
+    }
+    auto x_ms_blob_sealed__iterator = httpResponse.GetHeaders().find("x-ms-blob-sealed");
+    if (x_ms_blob_sealed__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.IsSealed = x_ms_blob_sealed__iterator->second == "true";
+    }
+    auto x_ms_or_policy_id__iterator = httpResponse.GetHeaders().find("x-ms-or-policy-id");
+    if (x_ms_or_policy_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.ObjectReplicationDestinationPolicyId
+          = x_ms_or_policy_id__iterator->second;
+    }
+    {
+      std::map<std::string, std::vector<ObjectReplicationRule>> orPropertiesMap;
+      for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-or-");
+           i != httpResponse.GetHeaders().end() && i->first.substr(0, 8) == "x-ms-or-";
+           ++i)
+      {
+        const std::string& header = i->first;
+        auto underscorePos = header.find('_', 8);
+        if (underscorePos == std::string::npos)
+        {
+          continue;
+        }
+        std::string policyId
+            = std::string(header.begin() + 8, header.begin() + underscorePos);
+        std::string ruleId = header.substr(underscorePos + 1);
+
+        ObjectReplicationRule rule;
+        rule.RuleId = std::move(ruleId);
+        rule.ReplicationStatus = ObjectReplicationStatus(i->second);
+        orPropertiesMap[policyId].emplace_back(std::move(rule));
+      }
+      for (auto& property : orPropertiesMap)
+      {
+        ObjectReplicationPolicy policy;
+        policy.PolicyId = property.first;
+        policy.Rules = std::move(property.second);
+        response.Details.ObjectReplicationSourceProperties.emplace_back(std::move(policy));
+      }
+    }
+    auto x_ms_tag_count__iterator = httpResponse.GetHeaders().find("x-ms-tag-count");
+    if (x_ms_tag_count__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.TagCount = std::stoi(x_ms_tag_count__iterator->second);
+    }
+    auto x_ms_copy_id__iterator = httpResponse.GetHeaders().find("x-ms-copy-id");
+    if (x_ms_copy_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.CopyId = x_ms_copy_id__iterator->second;
+    }
+    auto x_ms_copy_source__iterator = httpResponse.GetHeaders().find("x-ms-copy-source");
+    if (x_ms_copy_source__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.CopySource = x_ms_copy_source__iterator->second;
+    }
+    auto x_ms_copy_status__iterator = httpResponse.GetHeaders().find("x-ms-copy-status");
+    if (x_ms_copy_status__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.CopyStatus = CopyStatus(x_ms_copy_status__iterator->second);
+    }
+    auto x_ms_copy_status_description__iterator
+        = httpResponse.GetHeaders().find("x-ms-copy-status-description");
+    if (x_ms_copy_status_description__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.CopyStatusDescription = x_ms_copy_status_description__iterator->second;
+    }
+    auto x_ms_copy_progress__iterator = httpResponse.GetHeaders().find("x-ms-copy-progress");
+    if (x_ms_copy_progress__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.CopyProgress = x_ms_copy_progress__iterator->second;
+    }
+    auto x_ms_copy_completion_time__iterator
+        = httpResponse.GetHeaders().find("x-ms-copy-completion-time");
+    if (x_ms_copy_completion_time__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.CopyCompletedOn = Azure::DateTime::Parse(
+          x_ms_copy_completion_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
+    }
+    auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
+    if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.VersionId = x_ms_version_id__iterator->second;
+    }
+    auto x_ms_is_current_version__iterator
+        = httpResponse.GetHeaders().find("x-ms-is-current-version");
+    if (x_ms_is_current_version__iterator != httpResponse.GetHeaders().end())
+    {
+      response.Details.IsCurrentVersion = x_ms_is_current_version__iterator->second == "true";
+    }
+    return Azure::Response<DownloadBlobResult>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<DownloadBlobResult> BlobRestClient::Blob::Download(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const DownloadBlobOptions& options,
+      const Azure::Core::Context& context)
+  {
+    auto request = DownloadCreateMessage(url, options);
+    auto pHttpResponse = pipeline.Send(request, context);
+    return DownloadCreateResponse(std::move(pHttpResponse), context);
+  }
+
+  Azure::Response<QueryBlobResult> BlobRestClient::Blob::Query(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const QueryBlobOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    std::string xml_body;
+    {
+      _internal::XmlWriter writer;
+      QueryBlobOptionsToXml(writer, options);
+      xml_body = writer.GetDocument();
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
+    }
+    Azure::Core::IO::MemoryBodyStream xml_body_stream(
+        reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
+    auto request = Azure::Core::Http::Request(
+        Azure::Core::Http::HttpMethod::Post, url, &xml_body_stream, false);
+    request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
+    request.GetUrl().AppendQueryParameter("comp", "query");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    QueryBlobResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200 || http_status_code == 206))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.BodyStream = httpResponse.ExtractBodyStream();
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    return Azure::Response<QueryBlobResult>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Core::Http::Request BlobRestClient::Blob::DeleteCreateMessage(
+      const Azure::Core::Url& url,
+      const DeleteBlobOptions& options)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Delete, url);
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.DeleteSnapshots.HasValue())
+    {
+      request.SetHeader("x-ms-delete-snapshots", options.DeleteSnapshots.Value().ToString());
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    return request;
+  }
+
+  Azure::Response<DeleteBlobResult> BlobRestClient::Blob::DeleteCreateResponse(
+      std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
+      const Azure::Core::Context& context)
+  {
+    (void)context;
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    DeleteBlobResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 202))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    return Azure::Response<DeleteBlobResult>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<DeleteBlobResult> BlobRestClient::Blob::Delete(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const DeleteBlobOptions& options,
+      const Azure::Core::Context& context)
+  {
+    auto request = DeleteCreateMessage(url, options);
+    auto pHttpResponse = pipeline.Send(request, context);
+    return DeleteCreateResponse(std::move(pHttpResponse), context);
+  }
+
+  Azure::Response<SetBlobExpiryResult> BlobRestClient::Blob::ScheduleDeletion(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const SetBlobExpiryOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "expiry");
+    request.SetHeader("x-ms-expiry-option", options.ExpiryOrigin.ToString());
+    if (options.ExpiryTime.HasValue())
+    {
+      request.SetHeader("x-ms-expiry-time", options.ExpiryTime.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    SetBlobExpiryResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    return Azure::Response<SetBlobExpiryResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<UndeleteBlobResult> BlobRestClient::Blob::Undelete(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const UndeleteBlobOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "undelete");
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    UndeleteBlobResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    return Azure::Response<UndeleteBlobResult>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<BlobProperties> BlobRestClient::Blob::GetProperties(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetBlobPropertiesOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Head, url);
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    BlobProperties response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.CreatedOn = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::XMsCreationTime),
+        Azure::DateTime::DateFormat::Rfc1123);
+    auto x_ms_expiry_time__iterator = httpResponse.GetHeaders().find("x-ms-expiry-time");
+    if (x_ms_expiry_time__iterator != httpResponse.GetHeaders().end())
+    {
+      response.ExpiresOn = Azure::DateTime::Parse(
+          x_ms_expiry_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
+    }
+    auto x_ms_last_access_time__iterator
+        = httpResponse.GetHeaders().find("x-ms-last-access-time");
+    if (x_ms_last_access_time__iterator != httpResponse.GetHeaders().end())
+    {
+      response.LastAccessedOn = Azure::DateTime::Parse(
+          x_ms_last_access_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
+    }
+    for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-meta-");
+         i != httpResponse.GetHeaders().end() && i->first.substr(0, 10) == "x-ms-meta-";
+         ++i)
+    {
+      response.Metadata.emplace(i->first.substr(10), i->second);
+    }
+    response.BlobType = BlobType(httpResponse.GetHeader(WellKnownHeader::XMsBlobType));
+    auto x_ms_lease_status__iterator = httpResponse.GetHeaders().find("x-ms-lease-status");
+    if (x_ms_lease_status__iterator != httpResponse.GetHeaders().end())
+    {
+      response.LeaseStatus = LeaseStatus(x_ms_lease_status__iterator->second);
+    }
+    auto x_ms_lease_state__iterator = httpResponse.GetHeaders().find("x-ms-lease-state");
+    if (x_ms_lease_state__iterator != httpResponse.GetHeaders().end())
+    {
+      response.LeaseState = LeaseState(x_ms_lease_state__iterator->second);
+    }
+    auto x_ms_lease_duration__iterator
+        = httpResponse.GetHeaders().find("x-ms-lease-duration");
+    if (x_ms_lease_duration__iterator != httpResponse.GetHeaders().end())
+    {
+      response.LeaseDuration = LeaseDurationType(x_ms_lease_duration__iterator->second);
+    }
+    response.BlobSize = std::stoll(httpResponse.GetHeader(WellKnownHeader::ContentLength));
+    auto content_type__iterator = httpResponse.GetHeaders().find("content-type");
+    if (content_type__iterator != httpResponse.GetHeaders().end())
+    {
+      response.HttpHeaders.ContentType = content_type__iterator->second;
+    }
+    auto content_encoding__iterator = httpResponse.GetHeaders().find("content-encoding");
+    if (content_encoding__iterator != httpResponse.GetHeaders().end())
+    {
+      response.HttpHeaders.ContentEncoding = content_encoding__iterator->second;
+    }
+    auto content_language__iterator = httpResponse.GetHeaders().find("content-language");
+    if (content_language__iterator != httpResponse.GetHeaders().end())
+    {
+      response.HttpHeaders.ContentLanguage = content_language__iterator->second;
+    }
+    auto cache_control__iterator = httpResponse.GetHeaders().find("cache-control");
+    if (cache_control__iterator != httpResponse.GetHeaders().end())
+    {
+      response.HttpHeaders.CacheControl = cache_control__iterator->second;
+    }
+    auto content_md5__iterator = httpResponse.GetHeaders().find("content-md5");
+    if (content_md5__iterator != httpResponse.GetHeaders().end())
+    {
+      response.HttpHeaders.ContentHash.Value
+          = Azure::Core::Convert::Base64Decode(content_md5__iterator->second);
+    }
+    auto x_ms_blob_content_md5__iterator
+        = httpResponse.GetHeaders().find("x-ms-blob-content-md5");
+    if (x_ms_blob_content_md5__iterator != httpResponse.GetHeaders().end())
+    {
+      response.HttpHeaders.ContentHash.Value
+          = Azure::Core::Convert::Base64Decode(x_ms_blob_content_md5__iterator->second);
+    }
+    auto content_disposition__iterator
+        = httpResponse.GetHeaders().find("content-disposition");
+    if (content_disposition__iterator != httpResponse.GetHeaders().end())
+    {
+      response.HttpHeaders.ContentDisposition = content_disposition__iterator->second;
+    }
+    auto x_ms_blob_sequence_number__iterator
+        = httpResponse.GetHeaders().find("x-ms-blob-sequence-number");
+    if (x_ms_blob_sequence_number__iterator != httpResponse.GetHeaders().end())
+    {
+      response.SequenceNumber = std::stoll(x_ms_blob_sequence_number__iterator->second);
+    }
+    auto x_ms_blob_committed_block_count__iterator
+        = httpResponse.GetHeaders().find("x-ms-blob-committed-block-count");
+    if (x_ms_blob_committed_block_count__iterator != httpResponse.GetHeaders().end())
+    {
+      response.CommittedBlockCount
+          = std::stoi(x_ms_blob_committed_block_count__iterator->second);
+    }
+    auto x_ms_blob_sealed__iterator = httpResponse.GetHeaders().find("x-ms-blob-sealed");
+    if (x_ms_blob_sealed__iterator != httpResponse.GetHeaders().end())
+    {
+      response.IsSealed = x_ms_blob_sealed__iterator->second == "true";
+    }
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    auto x_ms_access_tier__iterator = httpResponse.GetHeaders().find("x-ms-access-tier");
+    if (x_ms_access_tier__iterator != httpResponse.GetHeaders().end())
+    {
+      response.AccessTier = AccessTier(x_ms_access_tier__iterator->second);
+    }
+    auto x_ms_access_tier_inferred__iterator
+        = httpResponse.GetHeaders().find("x-ms-access-tier-inferred");
+    if (x_ms_access_tier_inferred__iterator != httpResponse.GetHeaders().end())
+    {
+      response.IsAccessTierInferred = x_ms_access_tier_inferred__iterator->second == "true";
+    }
+    auto x_ms_archive_status__iterator
+        = httpResponse.GetHeaders().find("x-ms-archive-status");
+    if (x_ms_archive_status__iterator != httpResponse.GetHeaders().end())
+    {
+      response.ArchiveStatus = ArchiveStatus(x_ms_archive_status__iterator->second);
+    }
+    auto x_ms_rehydrate_priority__iterator
+        = httpResponse.GetHeaders().find("x-ms-rehydrate-priority");
+    if (x_ms_rehydrate_priority__iterator != httpResponse.GetHeaders().end())
+    {
+      response.RehydratePriority
+          = RehydratePriority(x_ms_rehydrate_priority__iterator->second);
+    }
+    auto x_ms_access_tier_change_time__iterator
+        = httpResponse.GetHeaders().find("x-ms-access-tier-change-time");
+    if (x_ms_access_tier_change_time__iterator != httpResponse.GetHeaders().end())
+    {
+      response.AccessTierChangedOn = Azure::DateTime::Parse(
+          x_ms_access_tier_change_time__iterator->second,
+          Azure::DateTime::DateFormat::Rfc1123);
+    }
+    auto x_ms_copy_id__iterator = httpResponse.GetHeaders().find("x-ms-copy-id");
+    if (x_ms_copy_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.CopyId = x_ms_copy_id__iterator->second;
+    }
+    auto x_ms_copy_source__iterator = httpResponse.GetHeaders().find("x-ms-copy-source");
+    if (x_ms_copy_source__iterator != httpResponse.GetHeaders().end())
+    {
+      response.CopySource = x_ms_copy_source__iterator->second;
+    }
+    auto x_ms_copy_status__iterator = httpResponse.GetHeaders().find("x-ms-copy-status");
+    if (x_ms_copy_status__iterator != httpResponse.GetHeaders().end())
+    {
+      response.CopyStatus = CopyStatus(x_ms_copy_status__iterator->second);
+    }
+    auto x_ms_copy_status_description__iterator
+        = httpResponse.GetHeaders().find("x-ms-copy-status-description");
+    if (x_ms_copy_status_description__iterator != httpResponse.GetHeaders().end())
+    {
+      response.CopyStatusDescription = x_ms_copy_status_description__iterator->second;
+    }
+    auto x_ms_incremental_copy__iterator
+        = httpResponse.GetHeaders().find("x-ms-incremental-copy");
+    if (x_ms_incremental_copy__iterator != httpResponse.GetHeaders().end())
+    {
+      response.IsIncrementalCopy = x_ms_incremental_copy__iterator->second == "true";
+    }
+    auto x_ms_copy_destination_snapshot__iterator
+        = httpResponse.GetHeaders().find("x-ms-copy-destination-snapshot");
+    if (x_ms_copy_destination_snapshot__iterator != httpResponse.GetHeaders().end())
+    {
+      response.IncrementalCopyDestinationSnapshot
+          = x_ms_copy_destination_snapshot__iterator->second;
+    }
+    auto x_ms_copy_progress__iterator = httpResponse.GetHeaders().find("x-ms-copy-progress");
+    if (x_ms_copy_progress__iterator != httpResponse.GetHeaders().end())
+    {
+      response.CopyProgress = x_ms_copy_progress__iterator->second;
+    }
+    auto x_ms_copy_completion_time__iterator
+        = httpResponse.GetHeaders().find("x-ms-copy-completion-time");
+    if (x_ms_copy_completion_time__iterator != httpResponse.GetHeaders().end())
+    {
+      response.CopyCompletedOn = Azure::DateTime::Parse(
+          x_ms_copy_completion_time__iterator->second, Azure::DateTime::DateFormat::Rfc1123);
+    }
+    auto x_ms_or_policy_id__iterator = httpResponse.GetHeaders().find("x-ms-or-policy-id");
+    if (x_ms_or_policy_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.ObjectReplicationDestinationPolicyId = x_ms_or_policy_id__iterator->second;
+    }
+    {
+      std::map<std::string, std::vector<ObjectReplicationRule>> orPropertiesMap;
+      for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-or-");
+           i != httpResponse.GetHeaders().end() && i->first.substr(0, 8) == "x-ms-or-";
+           ++i)
+      {
+        const std::string& header = i->first;
+        auto underscorePos = header.find('_', 8);
+        if (underscorePos == std::string::npos)
+        {
+          continue;
+        }
+        std::string policyId
+            = std::string(header.begin() + 8, header.begin() + underscorePos);
+        std::string ruleId = header.substr(underscorePos + 1);
+
+        ObjectReplicationRule rule;
+        rule.RuleId = std::move(ruleId);
+        rule.ReplicationStatus = ObjectReplicationStatus(i->second);
+        orPropertiesMap[policyId].emplace_back(std::move(rule));
+      }
+      for (auto& property : orPropertiesMap)
+      {
+        ObjectReplicationPolicy policy;
+        policy.PolicyId = property.first;
+        policy.Rules = std::move(property.second);
+        response.ObjectReplicationSourceProperties.emplace_back(std::move(policy));
+      }
+    }
+    auto x_ms_tag_count__iterator = httpResponse.GetHeaders().find("x-ms-tag-count");
+    if (x_ms_tag_count__iterator != httpResponse.GetHeaders().end())
+    {
+      response.TagCount = std::stoi(x_ms_tag_count__iterator->second);
+    }
+    auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
+    if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.VersionId = x_ms_version_id__iterator->second;
+    }
+    auto x_ms_is_current_version__iterator
+        = httpResponse.GetHeaders().find("x-ms-is-current-version");
+    if (x_ms_is_current_version__iterator != httpResponse.GetHeaders().end())
+    {
+      response.IsCurrentVersion = x_ms_is_current_version__iterator->second == "true";
+    }
+    return Azure::Response<BlobProperties>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<SetBlobHttpHeadersResult> BlobRestClient::Blob::SetHttpHeaders(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const SetBlobHttpHeadersOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("comp", "properties");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (!options.HttpHeaders.ContentType.empty())
+    {
+      request.SetHeader("x-ms-blob-content-type", options.HttpHeaders.ContentType);
+    }
+    if (!options.HttpHeaders.ContentEncoding.empty())
+    {
+      request.SetHeader("x-ms-blob-content-encoding", options.HttpHeaders.ContentEncoding);
+    }
+    if (!options.HttpHeaders.ContentLanguage.empty())
+    {
+      request.SetHeader("x-ms-blob-content-language", options.HttpHeaders.ContentLanguage);
+    }
+    if (!options.HttpHeaders.CacheControl.empty())
+    {
+      request.SetHeader("x-ms-blob-cache-control", options.HttpHeaders.CacheControl);
+    }
+    if (!Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value).empty())
+    {
+      request.SetHeader(
+          "x-ms-blob-content-md5",
+          Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value));
+    }
+    if (!options.HttpHeaders.ContentDisposition.empty())
+    {
+      request.SetHeader(
+          "x-ms-blob-content-disposition", options.HttpHeaders.ContentDisposition);
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    SetBlobHttpHeadersResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    auto x_ms_blob_sequence_number__iterator
+        = httpResponse.GetHeaders().find("x-ms-blob-sequence-number");
+    if (x_ms_blob_sequence_number__iterator != httpResponse.GetHeaders().end())
+    {
+      response.SequenceNumber = std::stoll(x_ms_blob_sequence_number__iterator->second);
+    }
+    return Azure::Response<SetBlobHttpHeadersResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<SetBlobMetadataResult> BlobRestClient::Blob::SetMetadata(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const SetBlobMetadataOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("comp", "metadata");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    for (const auto& pair : options.Metadata)
+    {
+      request.SetHeader("x-ms-meta-" + pair.first, pair.second);
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    SetBlobMetadataResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    auto x_ms_blob_sequence_number__iterator
+        = httpResponse.GetHeaders().find("x-ms-blob-sequence-number");
+    if (x_ms_blob_sequence_number__iterator != httpResponse.GetHeaders().end())
+    {
+      response.SequenceNumber = std::stoll(x_ms_blob_sequence_number__iterator->second);
+    }
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    return Azure::Response<SetBlobMetadataResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Core::Http::Request BlobRestClient::Blob::SetAccessTierCreateMessage(
+      const Azure::Core::Url& url,
+      const SetBlobAccessTierOptions& options)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("comp", "tier");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.SetHeader("x-ms-access-tier", options.AccessTier.ToString());
+    if (options.RehydratePriority.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-rehydrate-priority", options.RehydratePriority.Value().ToString());
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    return request;
+  }
+
+  Azure::Response<SetBlobAccessTierResult> BlobRestClient::Blob::SetAccessTierCreateResponse(
+      std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
+      const Azure::Core::Context& context)
+  {
+    (void)context;
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    SetBlobAccessTierResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200 || http_status_code == 202))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    return Azure::Response<SetBlobAccessTierResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<SetBlobAccessTierResult> BlobRestClient::Blob::SetAccessTier(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const SetBlobAccessTierOptions& options,
+      const Azure::Core::Context& context)
+  {
+    auto request = SetAccessTierCreateMessage(url, options);
+    auto pHttpResponse = pipeline.Send(request, context);
+    return SetAccessTierCreateResponse(std::move(pHttpResponse), context);
+  }
+
+  Azure::Response<Models::_detail::StartBlobCopyFromUriResult>
+  BlobRestClient::Blob::StartCopyFromUri(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const StartBlobCopyFromUriOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    for (const auto& pair : options.Metadata)
+    {
+      request.SetHeader("x-ms-meta-" + pair.first, pair.second);
+    }
+    if (!options.Tags.empty())
+    {
+      std::string blobTagsValue;
+      for (const auto& tag : options.Tags)
+      {
+        if (!blobTagsValue.empty())
+        {
+          blobTagsValue += "&";
+        }
+        blobTagsValue += _internal::UrlEncodeQueryParameter(tag.first) + "="
+            + _internal::UrlEncodeQueryParameter(tag.second);
+      }
+      request.SetHeader("x-ms-tags", std::move(blobTagsValue));
+    }
+    request.SetHeader("x-ms-copy-source", options.SourceUri);
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.AccessTier.HasValue())
+    {
+      request.SetHeader("x-ms-access-tier", options.AccessTier.Value().ToString());
+    }
+    if (options.RehydratePriority.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-rehydrate-priority", options.RehydratePriority.Value().ToString());
+    }
+    if (options.ShouldSealDestination.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-seal-blob", options.ShouldSealDestination.Value() ? "true" : "false");
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    if (options.SourceIfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-source-if-modified-since",
+          options.SourceIfModifiedSince.Value().ToString(
+              Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.SourceIfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-source-if-unmodified-since",
+          options.SourceIfUnmodifiedSince.Value().ToString(
+              Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.SourceIfMatch.HasValue() && !options.SourceIfMatch.ToString().empty())
+    {
+      request.SetHeader("x-ms-source-if-match", options.SourceIfMatch.ToString());
+    }
+    if (options.SourceIfNoneMatch.HasValue() && !options.SourceIfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("x-ms-source-if-none-match", options.SourceIfNoneMatch.ToString());
+    }
+    if (options.SourceIfTags.HasValue())
+    {
+      request.SetHeader("x-ms-source-if-tags", options.SourceIfTags.Value());
+    }
+    if (options.SourceLeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-source-lease-id", options.SourceLeaseId.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::StartBlobCopyFromUriResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 202))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.CopyId = httpResponse.GetHeader(WellKnownHeader::XMsCopyId);
+    response.CopyStatus = CopyStatus(httpResponse.GetHeader(WellKnownHeader::XMsCopyStatus));
+    auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
+    if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.VersionId = x_ms_version_id__iterator->second;
+    }
+    return Azure::Response<Models::_detail::StartBlobCopyFromUriResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<AbortBlobCopyFromUriResult> BlobRestClient::Blob::AbortCopyFromUri(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const AbortBlobCopyFromUriOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "copy");
+    request.GetUrl().AppendQueryParameter(
+        "copyid", _internal::UrlEncodeQueryParameter(options.CopyId));
+    request.SetHeader("x-ms-copy-action", "abort");
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    AbortBlobCopyFromUriResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 204))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    return Azure::Response<AbortBlobCopyFromUriResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<CreateBlobSnapshotResult> BlobRestClient::Blob::CreateSnapshot(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const CreateBlobSnapshotOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("comp", "snapshot");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    for (const auto& pair : options.Metadata)
+    {
+      request.SetHeader("x-ms-meta-" + pair.first, pair.second);
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    CreateBlobSnapshotResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    response.Snapshot = httpResponse.GetHeaders().at("x-ms-snapshot");
+    auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
+    if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.VersionId = x_ms_version_id__iterator->second;
+    }
+    return Azure::Response<CreateBlobSnapshotResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::GetBlobTagsResult> BlobRestClient::Blob::GetTags(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetBlobTagsOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "tags");
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::GetBlobTagsResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& httpResponseBody = httpResponse.GetBody();
+      _internal::XmlReader reader(
+          reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
+      response = GetBlobTagsResultInternalFromXml(reader);
+    }
+    return Azure::Response<Models::_detail::GetBlobTagsResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<SetBlobTagsResult> BlobRestClient::Blob::SetTags(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const SetBlobTagsOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    std::string xml_body;
+    {
+      _internal::XmlWriter writer;
+      SetBlobTagsOptionsToXml(writer, options);
+      xml_body = writer.GetDocument();
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
+    }
+    Azure::Core::IO::MemoryBodyStream xml_body_stream(
+        reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
+    auto request = Azure::Core::Http::Request(
+        Azure::Core::Http::HttpMethod::Put, url, &xml_body_stream);
+    request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "tags");
+    request.SetHeader("Content-Type", "application/xml; charset=UTF-8");
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    SetBlobTagsResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 204))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    return Azure::Response<SetBlobTagsResult>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::AcquireBlobLeaseResult> BlobRestClient::Blob::AcquireLease(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const AcquireBlobLeaseOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "lease");
+    request.SetHeader("x-ms-lease-action", "acquire");
+    request.SetHeader("x-ms-lease-duration", std::to_string(options.LeaseDuration.count()));
+    if (options.ProposedLeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-proposed-lease-id", options.ProposedLeaseId.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::AcquireBlobLeaseResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.LeaseId = httpResponse.GetHeader(WellKnownHeader::XMsLeaseId);
+    return Azure::Response<Models::_detail::AcquireBlobLeaseResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::RenewBlobLeaseResult> BlobRestClient::Blob::RenewLease(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const RenewBlobLeaseOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "lease");
+    request.SetHeader("x-ms-lease-action", "renew");
+    request.SetHeader("x-ms-lease-id", options.LeaseId);
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::RenewBlobLeaseResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.LeaseId = httpResponse.GetHeader(WellKnownHeader::XMsLeaseId);
+    return Azure::Response<Models::_detail::RenewBlobLeaseResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::ChangeBlobLeaseResult> BlobRestClient::Blob::ChangeLease(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ChangeBlobLeaseOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "lease");
+    request.SetHeader("x-ms-lease-action", "change");
+    request.SetHeader("x-ms-lease-id", options.LeaseId);
+    request.SetHeader("x-ms-proposed-lease-id", options.ProposedLeaseId);
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::ChangeBlobLeaseResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.LeaseId = httpResponse.GetHeader(WellKnownHeader::XMsLeaseId);
+    return Azure::Response<Models::_detail::ChangeBlobLeaseResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::ReleaseBlobLeaseResult> BlobRestClient::Blob::ReleaseLease(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ReleaseBlobLeaseOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "lease");
+    request.SetHeader("x-ms-lease-action", "release");
+    request.SetHeader("x-ms-lease-id", options.LeaseId);
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::ReleaseBlobLeaseResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    return Azure::Response<Models::_detail::ReleaseBlobLeaseResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::BreakBlobLeaseResult> BlobRestClient::Blob::BreakLease(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const BreakBlobLeaseOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.GetUrl().AppendQueryParameter("comp", "lease");
+    request.SetHeader("x-ms-lease-action", "break");
+    if (options.BreakPeriod.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-lease-break-period", std::to_string(options.BreakPeriod.Value().count()));
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::BreakBlobLeaseResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 202))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.LeaseTime = std::stoi(httpResponse.GetHeaders().at("x-ms-lease-time"));
+    return Azure::Response<Models::_detail::BreakBlobLeaseResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  void BlobRestClient::Blob::QueryBlobOptionsToXml(
+      _internal::XmlWriter& writer,
+      const QueryBlobOptions& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "QueryRequest"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "QueryType"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::Text, std::string(), "SQL"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Expression"});
+    writer.Write(_internal::XmlNode{
+        _internal::XmlNodeType::Text, std::string(), options.QueryExpression});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    if (options.InputTextConfiguration.HasValue())
+    {
+      writer.Write(
+          _internal::XmlNode{_internal::XmlNodeType::StartTag, "InputSerialization"});
+      QueryTextConfigurationToXml(writer, options.InputTextConfiguration.Value());
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    }
+    if (options.OutputTextConfiguration.HasValue())
+    {
+      writer.Write(
+          _internal::XmlNode{_internal::XmlNodeType::StartTag, "OutputSerialization"});
+      QueryTextConfigurationToXml(writer, options.OutputTextConfiguration.Value());
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    }
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+  }
+
+  void BlobRestClient::Blob::QueryTextConfigurationToXml(
+      _internal::XmlWriter& writer,
+      const Models::_detail::QueryTextConfiguration& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Format"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Type"});
+    writer.Write(
+        _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.FormatType});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    if (options.FormatType == "delimited")
+    {
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::StartTag, "DelimitedTextConfiguration"});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "ColumnSeparator"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text, std::string(), options.ColumnSeparator});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "FieldQuote"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text, std::string(), options.FieldQuote});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "RecordSeparator"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text, std::string(), options.RecordSeparator});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "EscapeChar"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text, std::string(), options.EscapeChar});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "HasHeaders"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text,
+          std::string(),
+          options.HasHeaders ? "true" : "false"});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    }
+    else
+    {
+      writer.Write(
+          _internal::XmlNode{_internal::XmlNodeType::StartTag, "JsonTextConfiguration"});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "RecordSeparator"});
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::Text, std::string(), options.RecordSeparator});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    }
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+  }
+
+  Models::_detail::GetBlobTagsResult
+  BlobRestClient::Blob::GetBlobTagsResultInternalFromXml(_internal::XmlReader& reader)
+  {
+    Models::_detail::GetBlobTagsResult ret;
+    enum class XmlTagName
+    {
+      k_Tags,
+      k_TagSet,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "Tags")
+        {
+          path.emplace_back(XmlTagName::k_Tags);
+        }
+        else if (node.Name == "TagSet")
+        {
+          path.emplace_back(XmlTagName::k_TagSet);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 2 && path[0] == XmlTagName::k_Tags
+            && path[1] == XmlTagName::k_TagSet)
+        {
+          ret.Tags = TagsFromXml(reader);
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+      }
+    }
+    return ret;
+  }
+
+  std::map<std::string, std::string> BlobRestClient::Blob::TagsFromXml(_internal::XmlReader& reader)
+  {
+    std::map<std::string, std::string> ret;
+    int depth = 0;
+    std::string key;
+    bool is_key = false;
+    bool is_value = false;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        ++depth;
+        if (node.Name == "Key")
+        {
+          is_key = true;
+        }
+        else if (node.Name == "Value")
+        {
+          is_value = true;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (depth-- == 0)
+        {
+          break;
+        }
+      }
+      if (depth == 2 && node.Type == _internal::XmlNodeType::Text)
+      {
+        if (is_key)
+        {
+          key = node.Value;
+          is_key = false;
+        }
+        else if (is_value)
+        {
+          ret.emplace(std::move(key), node.Value);
+          is_value = false;
+        }
+      }
+    }
+    return ret;
+  }
+
+  void BlobRestClient::Blob::SetBlobTagsOptionsToXml(
+      _internal::XmlWriter& writer,
+      const SetBlobTagsOptions& options)
+  {
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Tags"});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "TagSet"});
+    for (const auto& i : options.Tags)
+    {
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Tag"});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Key"});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::Text, std::string(), i.first});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Value"});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::Text, std::string(), i.second});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    }
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+  }
+
+  Azure::Core::Http::Request BlobRestClient::BlockBlob::UploadCreateMessage(
+      const Azure::Core::Url& url,
+      Azure::Core::IO::BodyStream& requestBody,
+      const UploadBlockBlobOptions& options)
+  {
+    (void)options;
+    auto request
+        = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url, &requestBody);
+    request.SetHeader("Content-Length", std::to_string(requestBody.Length()));
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.TransactionalContentHash.HasValue())
+    {
+      if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
+      {
+        request.SetHeader(
+            "Content-MD5",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+      else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
+      {
+        request.SetHeader(
+            "x-ms-content-crc64",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+    }
+    if (!options.HttpHeaders.ContentType.empty())
+    {
+      request.SetHeader("x-ms-blob-content-type", options.HttpHeaders.ContentType);
+    }
+    if (!options.HttpHeaders.ContentEncoding.empty())
+    {
+      request.SetHeader("x-ms-blob-content-encoding", options.HttpHeaders.ContentEncoding);
+    }
+    if (!options.HttpHeaders.ContentLanguage.empty())
+    {
+      request.SetHeader("x-ms-blob-content-language", options.HttpHeaders.ContentLanguage);
+    }
+    if (!options.HttpHeaders.CacheControl.empty())
+    {
+      request.SetHeader("x-ms-blob-cache-control", options.HttpHeaders.CacheControl);
+    }
+    if (!Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value).empty())
+    {
+      request.SetHeader(
+          "x-ms-blob-content-md5",
+          Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value));
+    }
+    if (!options.HttpHeaders.ContentDisposition.empty())
+    {
+      request.SetHeader(
+          "x-ms-blob-content-disposition", options.HttpHeaders.ContentDisposition);
+    }
+    for (const auto& pair : options.Metadata)
+    {
+      request.SetHeader("x-ms-meta-" + pair.first, pair.second);
+    }
+    if (!options.Tags.empty())
+    {
+      std::string blobTagsValue;
+      for (const auto& tag : options.Tags)
+      {
+        if (!blobTagsValue.empty())
+        {
+          blobTagsValue += "&";
+        }
+        blobTagsValue += _internal::UrlEncodeQueryParameter(tag.first) + "="
+            + _internal::UrlEncodeQueryParameter(tag.second);
+      }
+      request.SetHeader("x-ms-tags", std::move(blobTagsValue));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    request.SetHeader("x-ms-blob-type", "BlockBlob");
+    if (options.AccessTier.HasValue())
+    {
+      request.SetHeader("x-ms-access-tier", options.AccessTier.Value().ToString());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    return request;
+  }
+
+  Azure::Response<UploadBlockBlobResult> BlobRestClient::BlockBlob::UploadCreateResponse(
+      std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
+      const Azure::Core::Context& context)
+  {
+    (void)context;
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    UploadBlockBlobResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    {
+      const auto& headers = httpResponse.GetHeaders();
+      auto content_md5_iterator = headers.find("content-md5");
+      if (content_md5_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Md5;
+        hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+      auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
+      if (x_ms_content_crc64_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+    }
+    auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
+    if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.VersionId = x_ms_version_id__iterator->second;
+    }
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    return Azure::Response<UploadBlockBlobResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<UploadBlockBlobResult> BlobRestClient::BlockBlob::Upload(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      Azure::Core::IO::BodyStream& requestBody,
+      const UploadBlockBlobOptions& options,
+      const Azure::Core::Context& context)
+  {
+    auto request = UploadCreateMessage(url, requestBody, options);
+    auto pHttpResponse = pipeline.Send(request, context);
+    return UploadCreateResponse(std::move(pHttpResponse), context);
+  }
+
+  Azure::Core::Http::Request BlobRestClient::BlockBlob::StageBlockCreateMessage(
+      const Azure::Core::Url& url,
+      Azure::Core::IO::BodyStream& requestBody,
+      const StageBlockOptions& options)
+  {
+    (void)options;
+    auto request
+        = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url, &requestBody);
+    request.SetHeader("Content-Length", std::to_string(requestBody.Length()));
+    request.GetUrl().AppendQueryParameter("comp", "block");
+    request.GetUrl().AppendQueryParameter(
+        "blockid", _internal::UrlEncodeQueryParameter(options.BlockId));
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.TransactionalContentHash.HasValue())
+    {
+      if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
+      {
+        request.SetHeader(
+            "Content-MD5",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+      else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
+      {
+        request.SetHeader(
+            "x-ms-content-crc64",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    return request;
+  }
+
+  Azure::Response<StageBlockResult> BlobRestClient::BlockBlob::StageBlockCreateResponse(
+      std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
+      const Azure::Core::Context& context)
+  {
+    (void)context;
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    StageBlockResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& headers = httpResponse.GetHeaders();
+      auto content_md5_iterator = headers.find("content-md5");
+      if (content_md5_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Md5;
+        hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+      auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
+      if (x_ms_content_crc64_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+    }
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    return Azure::Response<StageBlockResult>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<StageBlockResult> BlobRestClient::BlockBlob::StageBlock(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      Azure::Core::IO::BodyStream& requestBody,
+      const StageBlockOptions& options,
+      const Azure::Core::Context& context)
+  {
+    auto request = StageBlockCreateMessage(url, requestBody, options);
+    auto pHttpResponse = pipeline.Send(request, context);
+    return StageBlockCreateResponse(std::move(pHttpResponse), context);
+  }
+
+  Azure::Response<StageBlockFromUriResult> BlobRestClient::BlockBlob::StageBlockFromUri(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const StageBlockFromUriOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("comp", "block");
+    request.GetUrl().AppendQueryParameter(
+        "blockid", _internal::UrlEncodeQueryParameter(options.BlockId));
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.SetHeader("x-ms-copy-source", options.SourceUri);
+    if (options.SourceRange.HasValue())
+    {
+      std::string headerValue
+          = "bytes=" + std::to_string(options.SourceRange.Value().Offset) + "-";
+      if (options.SourceRange.Value().Length.HasValue())
+      {
+        headerValue += std::to_string(
+            options.SourceRange.Value().Offset + options.SourceRange.Value().Length.Value()
+            - 1);
+      }
+      request.SetHeader("x-ms-source_range", std::move(headerValue));
+    }
+    if (options.TransactionalContentHash.HasValue())
+    {
+      if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
+      {
+        request.SetHeader(
+            "x-ms-source-content-md5",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+      else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
+      {
+        request.SetHeader(
+            "x-ms-source-content-crc64",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.SourceIfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-source-if-modified-since",
+          options.SourceIfModifiedSince.Value().ToString(
+              Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.SourceIfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-source-if-unmodified-since",
+          options.SourceIfUnmodifiedSince.Value().ToString(
+              Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.SourceIfMatch.HasValue() && !options.SourceIfMatch.ToString().empty())
+    {
+      request.SetHeader("x-ms-source-if-match", options.SourceIfMatch.ToString());
+    }
+    if (options.SourceIfNoneMatch.HasValue() && !options.SourceIfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("x-ms-source-if-none-match", options.SourceIfNoneMatch.ToString());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    StageBlockFromUriResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& headers = httpResponse.GetHeaders();
+      auto content_md5_iterator = headers.find("content-md5");
+      if (content_md5_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Md5;
+        hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+      auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
+      if (x_ms_content_crc64_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+    }
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    return Azure::Response<StageBlockFromUriResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  void BlobRestClient::BlockBlob::FormatNumberedBlockId(int64_t id, char* blockId)
+  {
+    constexpr size_t DigitsLength = 64;
+    const char* base64Chars
+        = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    char digits[DigitsLength + 2] = {};
+    for (size_t i = DigitsLength; i > 0; --i)
+    {
+      digits[i - 1] = static_cast<char>('0' + id % 10);
+      id /= 10;
+    }
+    // The last group has a single byte, and is padded.
+    for (size_t i = 0, j = 0; i < DigitsLength; i += 3, j += 4)
+    {
+      const uint32_t group = (static_cast<uint32_t>(static_cast<uint8_t>(digits[i])) << 16)
+          | (static_cast<uint32_t>(static_cast<uint8_t>(digits[i + 1])) << 8)
+          | static_cast<uint32_t>(static_cast<uint8_t>(digits[i + 2]));
+      blockId[j] = base64Chars[(group >> 18) & 0x3f];
+      blockId[j + 1] = base64Chars[(group >> 12) & 0x3f];
+      blockId[j + 2] = i + 1 < DigitsLength ? base64Chars[(group >> 6) & 0x3f] : '=';
+      blockId[j + 3] = i + 2 < DigitsLength ? base64Chars[group & 0x3f] : '=';
+    }
+  }
+
+  Azure::Response<CommitBlockListResult> BlobRestClient::BlockBlob::CommitBlockList(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const CommitBlockListOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    BlockListBodyStream xml_body_stream(options);
+    auto request = Azure::Core::Http::Request(
+        Azure::Core::Http::HttpMethod::Put, url, &xml_body_stream);
+    request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
+    request.GetUrl().AppendQueryParameter("comp", "blocklist");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (!options.HttpHeaders.ContentType.empty())
+    {
+      request.SetHeader("x-ms-blob-content-type", options.HttpHeaders.ContentType);
+    }
+    if (!options.HttpHeaders.ContentEncoding.empty())
+    {
+      request.SetHeader("x-ms-blob-content-encoding", options.HttpHeaders.ContentEncoding);
+    }
+    if (!options.HttpHeaders.ContentLanguage.empty())
+    {
+      request.SetHeader("x-ms-blob-content-language", options.HttpHeaders.ContentLanguage);
+    }
+    if (!options.HttpHeaders.CacheControl.empty())
+    {
+      request.SetHeader("x-ms-blob-cache-control", options.HttpHeaders.CacheControl);
+    }
+    if (!Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value).empty())
+    {
+      request.SetHeader(
+          "x-ms-blob-content-md5",
+          Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value));
+    }
+    if (!options.HttpHeaders.ContentDisposition.empty())
+    {
+      request.SetHeader(
+          "x-ms-blob-content-disposition", options.HttpHeaders.ContentDisposition);
+    }
+    for (const auto& pair : options.Metadata)
+    {
+      request.SetHeader("x-ms-meta-" + pair.first, pair.second);
+    }
+    if (!options.Tags.empty())
+    {
+      std::string blobTagsValue;
+      for (const auto& tag : options.Tags)
+      {
+        if (!blobTagsValue.empty())
+        {
+          blobTagsValue += "&";
+        }
+        blobTagsValue += _internal::UrlEncodeQueryParameter(tag.first) + "="
+            + _internal::UrlEncodeQueryParameter(tag.second);
+      }
+      request.SetHeader("x-ms-tags", std::move(blobTagsValue));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.AccessTier.HasValue())
+    {
+      request.SetHeader("x-ms-access-tier", options.AccessTier.Value().ToString());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    CommitBlockListResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
+    if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.VersionId = x_ms_version_id__iterator->second;
+    }
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    return Azure::Response<CommitBlockListResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<GetBlockListResult> BlobRestClient::BlockBlob::GetBlockList(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetBlockListOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+    request.GetUrl().AppendQueryParameter("comp", "blocklist");
+    request.GetUrl().AppendQueryParameter(
+        "blocklisttype", _internal::UrlEncodeQueryParameter(options.ListType.ToString()));
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    GetBlockListResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& httpResponseBody = httpResponse.GetBody();
+      _internal::XmlReader reader(
+          reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
+      response = GetBlockListResultFromXml(reader);
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.BlobSize = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-content-length"));
+    return Azure::Response<GetBlockListResult>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<GetBlockListStreamingResult> BlobRestClient::BlockBlob::GetBlockListStreaming(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetBlockListOptions& options,
+      const std::function<void(const CompactBlobBlock* blocks, size_t count)>& blocksFunc,
+      const Azure::Core::Context& context)
+  {
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url, false);
+    request.GetUrl().AppendQueryParameter("comp", "blocklist");
+    request.GetUrl().AppendQueryParameter(
+        "blocklisttype", _internal::UrlEncodeQueryParameter(options.ListType.ToString()));
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    GetBlockListStreamingResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      auto bodyStream = httpResponse.ExtractBodyStream();
+      _internal::XmlReader reader(*bodyStream, context);
+      CompactBlobBlocksFromXml(reader, blocksFunc);
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.BlobSize = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-content-length"));
+    return Azure::Response<GetBlockListStreamingResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  GetBlockListResult
+  BlobRestClient::BlockBlob::GetBlockListResultFromXml(_internal::XmlReader& reader)
+  {
+    GetBlockListResult ret;
+    enum class XmlTagName
+    {
+      k_BlockList,
+      k_CommittedBlocks,
+      k_Block,
+      k_UncommittedBlocks,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "BlockList")
+        {
+          path.emplace_back(XmlTagName::k_BlockList);
+        }
+        else if (node.Name == "CommittedBlocks")
+        {
+          path.emplace_back(XmlTagName::k_CommittedBlocks);
+        }
+        else if (node.Name == "Block")
+        {
+          path.emplace_back(XmlTagName::k_Block);
+        }
+        else if (node.Name == "UncommittedBlocks")
+        {
+          path.emplace_back(XmlTagName::k_UncommittedBlocks);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 3 && path[0] == XmlTagName::k_BlockList
+            && path[1] == XmlTagName::k_CommittedBlocks && path[2] == XmlTagName::k_Block)
+        {
+          ret.CommittedBlocks.emplace_back(BlobBlockFromXml(reader));
+          path.pop_back();
+        }
+        else if (
+            path.size() == 3 && path[0] == XmlTagName::k_BlockList
+            && path[1] == XmlTagName::k_UncommittedBlocks && path[2] == XmlTagName::k_Block)
+        {
+          ret.UncommittedBlocks.emplace_back(BlobBlockFromXml(reader));
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+      }
+    }
+    return ret;
+  }
+
+  BlobBlock BlobRestClient::BlockBlob::BlobBlockFromXml(_internal::XmlReader& reader)
+  {
+    BlobBlock ret;
+    enum class XmlTagName
+    {
+      k_Name,
+      k_Size,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "Name")
+        {
+          path.emplace_back(XmlTagName::k_Name);
+        }
+        else if (node.Name == "Size")
+        {
+          path.emplace_back(XmlTagName::k_Size);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 1 && path[0] == XmlTagName::k_Name)
+        {
+          ret.Name = node.Value;
+        }
+        else if (path.size() == 1 && path[0] == XmlTagName::k_Size)
+        {
+          ret.Size = std::stoll(node.Value);
+        }
+      }
+    }
+    return ret;
+  }
+
+  void BlobRestClient::BlockBlob::CompactBlobBlocksFromXml(
+      _internal::XmlReader& reader,
+      const std::function<void(const CompactBlobBlock* blocks, size_t count)>& blocksFunc)
+  {
+    enum class XmlTagName
+    {
+      k_BlockList,
+      k_CommittedBlocks,
+      k_UncommittedBlocks,
+      k_Block,
+      k_Name,
+      k_Size,
+      k_Unknown,
+    };
+    // The blocks are passed in batches, so the memory used doesn't grow with the number of
+    // blocks. The names are appended to the arena, which may grow, so they are pointed to once
+    // the batch is complete.
+    constexpr size_t BatchSize = 1024;
+    std::vector<CompactBlobBlock> batch;
+    batch.reserve(BatchSize);
+    std::vector<size_t> nameOffsets;
+    nameOffsets.reserve(BatchSize);
+    std::vector<char> arena;
+    auto passBatch = [&]() {
+      for (size_t i = 0; i < batch.size(); ++i)
+      {
+        if (batch[i].NameLength != 0)
+        {
+          batch[i].Name = &arena[nameOffsets[i]];
+        }
+      }
+      blocksFunc(batch.data(), batch.size());
+      batch.clear();
+      nameOffsets.clear();
+      arena.clear();
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          if (path.size() == 3 && path[2] == XmlTagName::k_Block && batch.size() == BatchSize)
+          {
+            passBatch();
+          }
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "BlockList")
+        {
+          path.emplace_back(XmlTagName::k_BlockList);
+        }
+        else if (node.Name == "CommittedBlocks")
+        {
+          path.emplace_back(XmlTagName::k_CommittedBlocks);
+        }
+        else if (node.Name == "UncommittedBlocks")
+        {
+          path.emplace_back(XmlTagName::k_UncommittedBlocks);
+        }
+        else if (node.Name == "Block")
+        {
+          path.emplace_back(XmlTagName::k_Block);
+        }
+        else if (node.Name == "Name")
+        {
+          path.emplace_back(XmlTagName::k_Name);
+        }
+        else if (node.Name == "Size")
+        {
+          path.emplace_back(XmlTagName::k_Size);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 3 && path[0] == XmlTagName::k_BlockList
+            && (path[1] == XmlTagName::k_CommittedBlocks
+                || path[1] == XmlTagName::k_UncommittedBlocks)
+            && path[2] == XmlTagName::k_Block)
+        {
+          batch.emplace_back();
+          batch.back().IsCommitted = path[1] == XmlTagName::k_CommittedBlocks;
+          nameOffsets.emplace_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 4 && path[0] == XmlTagName::k_BlockList
+            && (path[1] == XmlTagName::k_CommittedBlocks
+                || path[1] == XmlTagName::k_UncommittedBlocks)
+            && path[2] == XmlTagName::k_Block)
+        {
+          if (path[3] == XmlTagName::k_Name)
+          {
+            nameOffsets.back() = arena.size();
+            arena.insert(arena.end(), node.Value.data(), node.Value.data() + node.Value.length());
+            arena.push_back('\0');
+            batch.back().NameLength = node.Value.length();
+          }
+          else if (path[3] == XmlTagName::k_Size)
+          {
+            batch.back().Size = std::strtoll(node.Value.data(), nullptr, 10);
+          }
+        }
+      }
+    }
+    if (!batch.empty())
+    {
+      passBatch();
+    }
+  }
+
+  Azure::Response<CreatePageBlobResult> BlobRestClient::PageBlob::Create(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const CreatePageBlobOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (!options.HttpHeaders.ContentType.empty())
+    {
+      request.SetHeader("x-ms-blob-content-type", options.HttpHeaders.ContentType);
+    }
+    if (!options.HttpHeaders.ContentEncoding.empty())
+    {
+      request.SetHeader("x-ms-blob-content-encoding", options.HttpHeaders.ContentEncoding);
+    }
+    if (!options.HttpHeaders.ContentLanguage.empty())
+    {
+      request.SetHeader("x-ms-blob-content-language", options.HttpHeaders.ContentLanguage);
+    }
+    if (!options.HttpHeaders.CacheControl.empty())
+    {
+      request.SetHeader("x-ms-blob-cache-control", options.HttpHeaders.CacheControl);
+    }
+    if (!Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value).empty())
+    {
+      request.SetHeader(
+          "x-ms-blob-content-md5",
+          Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value));
+    }
+    if (!options.HttpHeaders.ContentDisposition.empty())
+    {
+      request.SetHeader(
+          "x-ms-blob-content-disposition", options.HttpHeaders.ContentDisposition);
+    }
+    for (const auto& pair : options.Metadata)
+    {
+      request.SetHeader("x-ms-meta-" + pair.first, pair.second);
+    }
+    if (!options.Tags.empty())
+    {
+      std::string blobTagsValue;
+      for (const auto& tag : options.Tags)
+      {
+        if (!blobTagsValue.empty())
+        {
+          blobTagsValue += "&";
+        }
+        blobTagsValue += _internal::UrlEncodeQueryParameter(tag.first) + "="
+            + _internal::UrlEncodeQueryParameter(tag.second);
+      }
+      request.SetHeader("x-ms-tags", std::move(blobTagsValue));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    request.SetHeader("x-ms-blob-type", "PageBlob");
+    request.SetHeader("x-ms-blob-content-length", std::to_string(options.BlobSize));
+    if (options.SequenceNumber.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-blob-sequence-number", std::to_string(options.SequenceNumber.Value()));
+    }
+    if (options.AccessTier.HasValue())
+    {
+      request.SetHeader("x-ms-access-tier", options.AccessTier.Value().ToString());
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    CreatePageBlobResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
+    if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.VersionId = x_ms_version_id__iterator->second;
+    }
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    return Azure::Response<CreatePageBlobResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<UploadPagesResult> BlobRestClient::PageBlob::UploadPages(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      Azure::Core::IO::BodyStream& requestBody,
+      const UploadPageBlobPagesOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request
+        = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url, &requestBody);
+    request.SetHeader("Content-Length", std::to_string(requestBody.Length()));
+    request.GetUrl().AppendQueryParameter("comp", "page");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    {
+      std::string headerValue = "bytes=" + std::to_string(options.Range.Offset) + "-";
+      if (options.Range.Length.HasValue())
+      {
+        headerValue
+            += std::to_string(options.Range.Offset + options.Range.Length.Value() - 1);
+      }
+      request.SetHeader("x-ms-range", std::move(headerValue));
+    }
+    if (options.TransactionalContentHash.HasValue())
+    {
+      if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
+      {
+        request.SetHeader(
+            "Content-MD5",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+      else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
+      {
+        request.SetHeader(
+            "x-ms-content-crc64",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+    }
+    request.SetHeader("x-ms-page-write", "update");
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfSequenceNumberLessThanOrEqualTo.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-le",
+          std::to_string(options.IfSequenceNumberLessThanOrEqualTo.Value()));
+    }
+    if (options.IfSequenceNumberLessThan.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-lt",
+          std::to_string(options.IfSequenceNumberLessThan.Value()));
+    }
+    if (options.IfSequenceNumberEqualTo.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-eq",
+          std::to_string(options.IfSequenceNumberEqualTo.Value()));
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    UploadPagesResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    {
+      const auto& headers = httpResponse.GetHeaders();
+      auto content_md5_iterator = headers.find("content-md5");
+      if (content_md5_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Md5;
+        hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+      auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
+      if (x_ms_content_crc64_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+    }
+    response.SequenceNumber
+        = std::stoll(httpResponse.GetHeader(WellKnownHeader::XMsBlobSequenceNumber));
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    return Azure::Response<UploadPagesResult>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<UploadPagesFromUriResult> BlobRestClient::PageBlob::UploadPagesFromUri(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const UploadPageBlobPagesFromUriOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("comp", "page");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    {
+      std::string headerValue = "bytes=" + std::to_string(options.Range.Offset) + "-";
+      if (options.Range.Length.HasValue())
+      {
+        headerValue
+            += std::to_string(options.Range.Offset + options.Range.Length.Value() - 1);
+      }
+      request.SetHeader("x-ms-range", std::move(headerValue));
+    }
+    request.SetHeader("x-ms-copy-source", options.SourceUri);
+    {
+      std::string headerValue = "bytes=" + std::to_string(options.SourceRange.Offset) + "-";
+      if (options.SourceRange.Length.HasValue())
+      {
+        headerValue += std::to_string(
+            options.SourceRange.Offset + options.SourceRange.Length.Value() - 1);
+      }
+      request.SetHeader("x-ms-source-range", std::move(headerValue));
+    }
+    if (options.TransactionalContentHash.HasValue())
+    {
+      if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
+      {
+        request.SetHeader(
+            "x-ms-source-content-md5",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+      else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
+      {
+        request.SetHeader(
+            "x-ms-source-content-crc64",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+    }
+    request.SetHeader("x-ms-page-write", "update");
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfSequenceNumberLessThanOrEqualTo.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-le",
+          std::to_string(options.IfSequenceNumberLessThanOrEqualTo.Value()));
+    }
+    if (options.IfSequenceNumberLessThan.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-lt",
+          std::to_string(options.IfSequenceNumberLessThan.Value()));
+    }
+    if (options.IfSequenceNumberEqualTo.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-eq",
+          std::to_string(options.IfSequenceNumberEqualTo.Value()));
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    if (options.SourceIfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-source-if-modified-since",
+          options.SourceIfModifiedSince.Value().ToString(
+              Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.SourceIfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-source-if-unmodified-since",
+          options.SourceIfUnmodifiedSince.Value().ToString(
+              Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.SourceIfMatch.HasValue() && !options.SourceIfMatch.ToString().empty())
+    {
+      request.SetHeader("x-ms-source-if-match", options.SourceIfMatch.ToString());
+    }
+    if (options.SourceIfNoneMatch.HasValue() && !options.SourceIfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("x-ms-source-if-none-match", options.SourceIfNoneMatch.ToString());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    UploadPagesFromUriResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    {
+      const auto& headers = httpResponse.GetHeaders();
+      auto content_md5_iterator = headers.find("content-md5");
+      if (content_md5_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Md5;
+        hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+      auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
+      if (x_ms_content_crc64_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+    }
+    response.SequenceNumber
+        = std::stoll(httpResponse.GetHeader(WellKnownHeader::XMsBlobSequenceNumber));
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    return Azure::Response<UploadPagesFromUriResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<ClearPagesResult> BlobRestClient::PageBlob::ClearPages(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ClearPageBlobPagesOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("comp", "page");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    {
+      std::string headerValue = "bytes=" + std::to_string(options.Range.Offset) + "-";
+      if (options.Range.Length.HasValue())
+      {
+        headerValue
+            += std::to_string(options.Range.Offset + options.Range.Length.Value() - 1);
+      }
+      request.SetHeader("x-ms-range", std::move(headerValue));
+    }
+    request.SetHeader("x-ms-page-write", "clear");
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfSequenceNumberLessThanOrEqualTo.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-le",
+          std::to_string(options.IfSequenceNumberLessThanOrEqualTo.Value()));
+    }
+    if (options.IfSequenceNumberLessThan.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-lt",
+          std::to_string(options.IfSequenceNumberLessThan.Value()));
+    }
+    if (options.IfSequenceNumberEqualTo.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-eq",
+          std::to_string(options.IfSequenceNumberEqualTo.Value()));
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    ClearPagesResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.SequenceNumber
+        = std::stoll(httpResponse.GetHeader(WellKnownHeader::XMsBlobSequenceNumber));
+    return Azure::Response<ClearPagesResult>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<ResizePageBlobResult> BlobRestClient::PageBlob::Resize(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const ResizePageBlobOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("comp", "properties");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.SetHeader("x-ms-blob-content-length", std::to_string(options.BlobSize));
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfSequenceNumberLessThanOrEqualTo.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-le",
+          std::to_string(options.IfSequenceNumberLessThanOrEqualTo.Value()));
+    }
+    if (options.IfSequenceNumberLessThan.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-lt",
+          std::to_string(options.IfSequenceNumberLessThan.Value()));
+    }
+    if (options.IfSequenceNumberEqualTo.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-if-sequence-number-eq",
+          std::to_string(options.IfSequenceNumberEqualTo.Value()));
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    ResizePageBlobResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.SequenceNumber
+        = std::stoll(httpResponse.GetHeader(WellKnownHeader::XMsBlobSequenceNumber));
+    return Azure::Response<ResizePageBlobResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::GetPageRangesResult> BlobRestClient::PageBlob::GetPageRanges(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetPageBlobPageRangesOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+    request.GetUrl().AppendQueryParameter("comp", "pagelist");
+    if (options.PreviousSnapshot.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "prevsnapshot",
+          _internal::UrlEncodeQueryParameter(options.PreviousSnapshot.Value()));
+    }
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.Range.HasValue())
+    {
+      std::string headerValue = "bytes=" + std::to_string(options.Range.Value().Offset) + "-";
+      if (options.Range.Value().Length.HasValue())
+      {
+        headerValue += std::to_string(
+            options.Range.Value().Offset + options.Range.Value().Length.Value() - 1);
+      }
+      request.SetHeader("x-ms-range", std::move(headerValue));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.PreviousSnapshotUrl.HasValue())
+    {
+      request.SetHeader("x-ms-previous-snapshot-url", options.PreviousSnapshotUrl.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::GetPageRangesResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      const auto& httpResponseBody = httpResponse.GetBody();
+      _internal::XmlReader reader(
+          reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
+      response = GetPageRangesResultInternalFromXml(reader);
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.BlobSize = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-content-length"));
+    return Azure::Response<Models::_detail::GetPageRangesResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<GetPageRangesStreamingResult> BlobRestClient::PageBlob::GetPageRangesStreaming(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const GetPageBlobPageRangesOptions& options,
+      const std::function<void(const CompactPageRange* ranges, size_t count)>& rangesFunc,
+      const Azure::Core::Context& context)
+  {
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url, false);
+    request.GetUrl().AppendQueryParameter("comp", "pagelist");
+    if (options.PreviousSnapshot.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "prevsnapshot",
+          _internal::UrlEncodeQueryParameter(options.PreviousSnapshot.Value()));
+    }
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.Range.HasValue())
+    {
+      std::string headerValue = "bytes=" + std::to_string(options.Range.Value().Offset) + "-";
+      if (options.Range.Value().Length.HasValue())
+      {
+        headerValue += std::to_string(
+            options.Range.Value().Offset + options.Range.Value().Length.Value() - 1);
+      }
+      request.SetHeader("x-ms-range", std::move(headerValue));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.PreviousSnapshotUrl.HasValue())
+    {
+      request.SetHeader("x-ms-previous-snapshot-url", options.PreviousSnapshotUrl.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    GetPageRangesStreamingResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    {
+      auto bodyStream = httpResponse.ExtractBodyStream();
+      _internal::XmlReader reader(*bodyStream, context);
+      CompactPageRangesFromXml(reader, rangesFunc);
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.BlobSize = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-content-length"));
+    return Azure::Response<GetPageRangesStreamingResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::StartBlobCopyIncrementalResult>
+  BlobRestClient::PageBlob::StartCopyIncremental(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const StartBlobCopyIncrementalOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("comp", "incrementalcopy");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.SetHeader("x-ms-copy-source", options.CopySource);
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::StartBlobCopyIncrementalResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 202))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    response.CopyId = httpResponse.GetHeader(WellKnownHeader::XMsCopyId);
+    response.CopyStatus = CopyStatus(httpResponse.GetHeader(WellKnownHeader::XMsCopyStatus));
+    auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
+    if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.VersionId = x_ms_version_id__iterator->second;
+    }
+    return Azure::Response<Models::_detail::StartBlobCopyIncrementalResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Models::_detail::GetPageRangesResult
+  BlobRestClient::PageBlob::GetPageRangesResultInternalFromXml(_internal::XmlReader& reader)
+  {
+    Models::_detail::GetPageRangesResult ret;
+    enum class XmlTagName
+    {
+      k_PageList,
+      k_PageRange,
+      k_ClearRange,
+      k_Unknown,
+    };
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "PageList")
+        {
+          path.emplace_back(XmlTagName::k_PageList);
+        }
+        else if (node.Name == "PageRange")
+        {
+          path.emplace_back(XmlTagName::k_PageRange);
+        }
+        else if (node.Name == "ClearRange")
+        {
+          path.emplace_back(XmlTagName::k_ClearRange);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 2 && path[0] == XmlTagName::k_PageList
+            && path[1] == XmlTagName::k_PageRange)
+        {
+          ret.PageRanges.emplace_back(PageRangesFromXml(reader));
+          path.pop_back();
+        }
+        else if (
+            path.size() == 2 && path[0] == XmlTagName::k_PageList
+            && path[1] == XmlTagName::k_ClearRange)
+        {
+          ret.ClearRanges.emplace_back(ClearRangesFromXml(reader));
+          path.pop_back();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+      }
+    }
+    return ret;
+  }
+
+  Azure::Core::Http::HttpRange
+  BlobRestClient::PageBlob::ClearRangesFromXml(_internal::XmlReader& reader)
+  {
+    int depth = 0;
+    bool is_start = false;
+    bool is_end = false;
+    int64_t start = 0;
+    int64_t end = 0;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag && node.Name == "Start")
+      {
+        ++depth;
+        is_start = true;
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag && node.Name == "End")
+      {
+        ++depth;
+        is_end = true;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        is_start = false;
+        is_end = false;
+        if (depth-- == 0)
+        {
+          break;
+        }
+      }
+      if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
+      {
+        if (is_start)
+        {
+          start = std::stoll(node.Value);
+        }
+        else if (is_end)
+        {
+          end = std::stoll(node.Value);
+        }
+      }
+    }
+    Azure::Core::Http::HttpRange ret;
+    ret.Offset = start;
+    ret.Length = end - start + 1;
+    return ret;
+  }
+
+  Azure::Core::Http::HttpRange
+  BlobRestClient::PageBlob::PageRangesFromXml(_internal::XmlReader& reader)
+  {
+    int depth = 0;
+    bool is_start = false;
+    bool is_end = false;
+    int64_t start = 0;
+    int64_t end = 0;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag && node.Name == "Start")
+      {
+        ++depth;
+        is_start = true;
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag && node.Name == "End")
+      {
+        ++depth;
+        is_end = true;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        is_start = false;
+        is_end = false;
+        if (depth-- == 0)
+        {
+          break;
+        }
+      }
+      if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
+      {
+        if (is_start)
+        {
+          start = std::stoll(node.Value);
+        }
+        else if (is_end)
+        {
+          end = std::stoll(node.Value);
+        }
+      }
+    }
+    Azure::Core::Http::HttpRange ret;
+    ret.Offset = start;
+    ret.Length = end - start + 1;
+    return ret;
+  }
+
+  void BlobRestClient::PageBlob::CompactPageRangesFromXml(
+      _internal::XmlReader& reader,
+      const std::function<void(const CompactPageRange* ranges, size_t count)>& rangesFunc)
+  {
+    enum class XmlTagName
+    {
+      k_PageList,
+      k_PageRange,
+      k_Start,
+      k_End,
+      k_Unknown,
+    };
+    // The ranges are passed in batches, so the memory used doesn't grow with the number of
+    // ranges.
+    constexpr size_t BatchSize = 4096;
+    std::vector<CompactPageRange> batch;
+    batch.reserve(BatchSize);
+    int64_t end = 0;
+    std::vector<XmlTagName> path;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (path.size() > 0)
+        {
+          if (path.size() == 2 && path[0] == XmlTagName::k_PageList
+              && path[1] == XmlTagName::k_PageRange)
+          {
+            batch.back().Length = end - batch.back().Offset + 1;
+            if (batch.size() == BatchSize)
+            {
+              rangesFunc(batch.data(), batch.size());
+              batch.clear();
+            }
+          }
+          path.pop_back();
+        }
+        else
+        {
+          break;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        if (node.Name == "PageList")
+        {
+          path.emplace_back(XmlTagName::k_PageList);
+        }
+        else if (node.Name == "PageRange")
+        {
+          path.emplace_back(XmlTagName::k_PageRange);
+        }
+        else if (node.Name == "Start")
+        {
+          path.emplace_back(XmlTagName::k_Start);
+        }
+        else if (node.Name == "End")
+        {
+          path.emplace_back(XmlTagName::k_End);
+        }
+        else
+        {
+          path.emplace_back(XmlTagName::k_Unknown);
+        }
+        if (path.size() == 2 && path[0] == XmlTagName::k_PageList
+            && path[1] == XmlTagName::k_PageRange)
+        {
+          batch.emplace_back();
+          end = 0;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (path.size() == 3 && path[0] == XmlTagName::k_PageList
+            && path[1] == XmlTagName::k_PageRange)
+        {
+          if (path[2] == XmlTagName::k_Start)
+          {
+            batch.back().Offset = std::strtoll(node.Value.data(), nullptr, 10);
+          }
+          else if (path[2] == XmlTagName::k_End)
+          {
+            end = std::strtoll(node.Value.data(), nullptr, 10);
+          }
+        }
+      }
+    }
+    if (!batch.empty())
+    {
+      rangesFunc(batch.data(), batch.size());
+    }
+  }
+
+  Azure::Response<CreateAppendBlobResult> BlobRestClient::AppendBlob::Create(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const CreateAppendBlobOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (!options.HttpHeaders.ContentType.empty())
+    {
+      request.SetHeader("x-ms-blob-content-type", options.HttpHeaders.ContentType);
+    }
+    if (!options.HttpHeaders.ContentEncoding.empty())
+    {
+      request.SetHeader("x-ms-blob-content-encoding", options.HttpHeaders.ContentEncoding);
+    }
+    if (!options.HttpHeaders.ContentLanguage.empty())
+    {
+      request.SetHeader("x-ms-blob-content-language", options.HttpHeaders.ContentLanguage);
+    }
+    if (!options.HttpHeaders.CacheControl.empty())
+    {
+      request.SetHeader("x-ms-blob-cache-control", options.HttpHeaders.CacheControl);
+    }
+    if (!Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value).empty())
+    {
+      request.SetHeader(
+          "x-ms-blob-content-md5",
+          Azure::Core::Convert::Base64Encode(options.HttpHeaders.ContentHash.Value));
+    }
+    if (!options.HttpHeaders.ContentDisposition.empty())
+    {
+      request.SetHeader(
+          "x-ms-blob-content-disposition", options.HttpHeaders.ContentDisposition);
+    }
+    for (const auto& pair : options.Metadata)
+    {
+      request.SetHeader("x-ms-meta-" + pair.first, pair.second);
+    }
+    if (!options.Tags.empty())
+    {
+      std::string blobTagsValue;
+      for (const auto& tag : options.Tags)
+      {
+        if (!blobTagsValue.empty())
+        {
+          blobTagsValue += "&";
+        }
+        blobTagsValue += _internal::UrlEncodeQueryParameter(tag.first) + "="
+            + _internal::UrlEncodeQueryParameter(tag.second);
+      }
+      request.SetHeader("x-ms-tags", std::move(blobTagsValue));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    request.SetHeader("x-ms-blob-type", "AppendBlob");
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    CreateAppendBlobResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    auto x_ms_version_id__iterator = httpResponse.GetHeaders().find("x-ms-version-id");
+    if (x_ms_version_id__iterator != httpResponse.GetHeaders().end())
+    {
+      response.VersionId = x_ms_version_id__iterator->second;
+    }
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    return Azure::Response<CreateAppendBlobResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<AppendBlockResult> BlobRestClient::AppendBlob::AppendBlock(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      Azure::Core::IO::BodyStream& requestBody,
+      const AppendBlockOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request
+        = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url, &requestBody);
+    request.SetHeader("Content-Length", std::to_string(requestBody.Length()));
+    request.GetUrl().AppendQueryParameter("comp", "appendblock");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.TransactionalContentHash.HasValue())
+    {
+      if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
+      {
+        request.SetHeader(
+            "Content-MD5",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+      else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
+      {
+        request.SetHeader(
+            "x-ms-content-crc64",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.MaxSize.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-blob-condition-maxsize", std::to_string(options.MaxSize.Value()));
+    }
+    if (options.AppendPosition.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-blob-condition-appendpos", std::to_string(options.AppendPosition.Value()));
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    AppendBlockResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    {
+      const auto& headers = httpResponse.GetHeaders();
+      auto content_md5_iterator = headers.find("content-md5");
+      if (content_md5_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Md5;
+        hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+      auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
+      if (x_ms_content_crc64_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+    }
+    response.AppendOffset
+        = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-append-offset"));
+    response.CommittedBlockCount
+        = std::stoi(httpResponse.GetHeaders().at("x-ms-blob-committed-block-count"));
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    return Azure::Response<AppendBlockResult>(std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<AppendBlockFromUriResult> BlobRestClient::AppendBlob::AppendBlockFromUri(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const AppendBlockFromUriOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("comp", "appendblock");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.SetHeader("x-ms-copy-source", options.SourceUri);
+    if (options.SourceRange.HasValue())
+    {
+      std::string headerValue
+          = "bytes=" + std::to_string(options.SourceRange.Value().Offset) + "-";
+      if (options.SourceRange.Value().Length.HasValue())
+      {
+        headerValue += std::to_string(
+            options.SourceRange.Value().Offset + options.SourceRange.Value().Length.Value()
+            - 1);
+      }
+      request.SetHeader("x-ms-source-range", std::move(headerValue));
+    }
+    if (options.TransactionalContentHash.HasValue())
+    {
+      if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Md5)
+      {
+        request.SetHeader(
+            "x-ms-source-content-md5",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+      else if (options.TransactionalContentHash.Value().Algorithm == HashAlgorithm::Crc64)
+      {
+        request.SetHeader(
+            "x-ms-source-content-crc64",
+            Azure::Core::Convert::Base64Encode(
+                options.TransactionalContentHash.Value().Value));
+      }
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.MaxSize.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-blob-condition-maxsize", std::to_string(options.MaxSize.Value()));
+    }
+    if (options.AppendPosition.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-blob-condition-appendpos", std::to_string(options.AppendPosition.Value()));
+    }
+    if (options.EncryptionKey.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-key", options.EncryptionKey.Value());
+    }
+    if (options.EncryptionKeySha256.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-key-sha256",
+          Azure::Core::Convert::Base64Encode(options.EncryptionKeySha256.Value()));
+    }
+    if (options.EncryptionAlgorithm.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-encryption-algorithm", options.EncryptionAlgorithm.Value().ToString());
+    }
+    if (options.EncryptionScope.HasValue())
+    {
+      request.SetHeader("x-ms-encryption-scope", options.EncryptionScope.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    AppendBlockFromUriResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 201))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    {
+      const auto& headers = httpResponse.GetHeaders();
+      auto content_md5_iterator = headers.find("content-md5");
+      if (content_md5_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Md5;
+        hash.Value = Azure::Core::Convert::Base64Decode(content_md5_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+      auto x_ms_content_crc64_iterator = headers.find("x-ms-content-crc64");
+      if (x_ms_content_crc64_iterator != headers.end())
+      {
+        ContentHash hash;
+        hash.Algorithm = HashAlgorithm::Crc64;
+        hash.Value = Azure::Core::Convert::Base64Decode(x_ms_content_crc64_iterator->second);
+        response.TransactionalContentHash = std::move(hash);
+      }
+    }
+    response.AppendOffset
+        = std::stoll(httpResponse.GetHeaders().at("x-ms-blob-append-offset"));
+    response.CommittedBlockCount
+        = std::stoi(httpResponse.GetHeaders().at("x-ms-blob-committed-block-count"));
+    response.IsServerEncrypted
+        = httpResponse.GetHeader(WellKnownHeader::XMsRequestServerEncrypted) == "true";
+    auto x_ms_encryption_key_sha256__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
+    if (x_ms_encryption_key_sha256__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionKeySha256
+          = Azure::Core::Convert::Base64Decode(x_ms_encryption_key_sha256__iterator->second);
+    }
+    auto x_ms_encryption_scope__iterator
+        = httpResponse.GetHeaders().find("x-ms-encryption-scope");
+    if (x_ms_encryption_scope__iterator != httpResponse.GetHeaders().end())
+    {
+      response.EncryptionScope = x_ms_encryption_scope__iterator->second;
+    }
+    return Azure::Response<AppendBlockFromUriResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<SealAppendBlobResult> BlobRestClient::AppendBlob::Seal(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      const SealAppendBlobOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url);
+    request.SetHeader("Content-Length", "0");
+    request.GetUrl().AppendQueryParameter("comp", "seal");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    if (options.LeaseId.HasValue())
+    {
+      request.SetHeader("x-ms-lease-id", options.LeaseId.Value());
+    }
+    if (options.IfModifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Modified-Since",
+          options.IfModifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfUnmodifiedSince.HasValue())
+    {
+      request.SetHeader(
+          "If-Unmodified-Since",
+          options.IfUnmodifiedSince.Value().ToString(Azure::DateTime::DateFormat::Rfc1123));
+    }
+    if (options.IfMatch.HasValue() && !options.IfMatch.ToString().empty())
+    {
+      request.SetHeader("If-Match", options.IfMatch.ToString());
+    }
+    if (options.IfNoneMatch.HasValue() && !options.IfNoneMatch.ToString().empty())
+    {
+      request.SetHeader("If-None-Match", options.IfNoneMatch.ToString());
+    }
+    if (options.IfTags.HasValue())
+    {
+      request.SetHeader("x-ms-if-tags", options.IfTags.Value());
+    }
+    if (options.AppendPosition.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-blob-condition-appendpos", std::to_string(options.AppendPosition.Value()));
+    }
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    SealAppendBlobResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 200))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ETag = Azure::ETag(httpResponse.GetHeader(WellKnownHeader::ETag));
+    response.LastModified = Azure::DateTime::Parse(
+        httpResponse.GetHeader(WellKnownHeader::LastModified),
+        Azure::DateTime::DateFormat::Rfc1123);
+    return Azure::Response<SealAppendBlobResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+  Azure::Response<Models::_detail::SubmitBlobBatchResult> BlobRestClient::BlobBatch::SubmitBatch(
+      Azure::Core::Http::_internal::HttpPipeline& pipeline,
+      const Azure::Core::Url& url,
+      Azure::Core::IO::BodyStream& requestBody,
+      const SubmitBlobBatchOptions& options,
+      const Azure::Core::Context& context)
+  {
+    (void)options;
+    auto request
+        = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Post, url, &requestBody);
+    request.SetHeader("Content-Length", std::to_string(requestBody.Length()));
+    request.GetUrl().AppendQueryParameter("comp", "batch");
+    request.SetHeader("x-ms-version", "2020-02-10");
+    if (options.Timeout.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "timeout", std::to_string(options.Timeout.Value()));
+    }
+    request.SetHeader("Content-Type", options.ContentType);
+    auto pHttpResponse = pipeline.Send(request, context);
+    Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
+    Models::_detail::SubmitBlobBatchResult response;
+    auto http_status_code
+        = static_cast<std::underlying_type<Azure::Core::Http::HttpStatusCode>::type>(
+            httpResponse.GetStatusCode());
+    if (!(http_status_code == 202))
+    {
+      throw StorageException::CreateFromResponse(std::move(pHttpResponse));
+    }
+    response.ContentType = httpResponse.GetHeader(WellKnownHeader::ContentType);
+    return Azure::Response<Models::_detail::SubmitBlobBatchResult>(
+        std::move(response), std::move(pHttpResponse));
+  }
+
+}}}} // namespace Azure::Storage::Blobs::_detail
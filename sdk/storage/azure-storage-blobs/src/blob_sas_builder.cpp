@@ -107,14 +107,13 @@ namespace Azure { namespace Storage { namespace Sas {
     }
   }
 
-  std::string BlobSasBuilder::GenerateSasToken(const StorageSharedKeyCredential& credential)
+  void BlobSasBuilder::FormatSasTemplate(
+      const std::string& accountName,
+      std::string& stringToSignPrefix,
+      std::string& stringToSignSuffix,
+      std::string& sasTokenPrefix,
+      std::string& sasTokenSuffix)
   {
-    std::string canonicalName = "/blob/" + credential.AccountName + "/" + BlobContainerName;
-    if (Resource == BlobSasResource::Blob || Resource == BlobSasResource::BlobSnapshot
-        || Resource == BlobSasResource::BlobVersion)
-    {
-      canonicalName += "/" + BlobName;
-    }
     std::string protocol = _detail::SasProtocolToString(Protocol);
     std::string resource = BlobSasResourceToString(Resource);
 
@@ -137,16 +136,14 @@ namespace Azure { namespace Storage { namespace Sas {
             Azure::DateTime::DateFormat::Rfc3339, Azure::DateTime::TimeFractionFormat::Truncate)
         : "";
 
-    std::string stringToSign = Permissions + "\n" + startsOnStr + "\n" + expiresOnStr + "\n"
-        + canonicalName + "\n" + Identifier + "\n" + (IPRange.HasValue() ? IPRange.Value() : "")
+    // The blob name, if any, goes between the prefix and the suffix of the string to sign.
+    stringToSignPrefix = Permissions + "\n" + startsOnStr + "\n" + expiresOnStr + "\n" + "/blob/"
+        + accountName + "/" + BlobContainerName;
+    stringToSignSuffix = "\n" + Identifier + "\n" + (IPRange.HasValue() ? IPRange.Value() : "")
         + "\n" + protocol + "\n" + _internal::DefaultSasVersion + "\n" + resource + "\n"
         + snapshotVersion + "\n" + CacheControl + "\n" + ContentDisposition + "\n" + ContentEncoding
         + "\n" + ContentLanguage + "\n" + ContentType;
 
-    std::string signature = Azure::Core::Convert::Base64Encode(_internal::HmacSha256(
-        std::vector<uint8_t>(stringToSign.begin(), stringToSign.end()),
-        Azure::Core::Convert::Base64Decode(credential.GetAccountKey())));
-
     Azure::Core::Url builder;
     builder.AppendQueryParameter(
         "sv", _internal::UrlEncodeQueryParameter(_internal::DefaultSasVersion));
@@ -172,7 +169,7 @@ namespace Azure { namespace Storage { namespace Sas {
     {
       builder.AppendQueryParameter("sp", _internal::UrlEncodeQueryParameter(Permissions));
     }
-    builder.AppendQueryParameter("sig", _internal::UrlEncodeQueryParameter(signature));
+    builder.AppendQueryParameter("sig", "");
     if (!CacheControl.empty())
     {
       builder.AppendQueryParameter("rscc", _internal::UrlEncodeQueryParameter(CacheControl));
@@ -194,7 +191,68 @@ namespace Azure { namespace Storage { namespace Sas {
       builder.AppendQueryParameter("rsct", _internal::UrlEncodeQueryParameter(ContentType));
     }
 
-    return builder.GetAbsoluteUrl();
+    // The values are encoded, so the signature is the only parameter value following "sig=".
+    const std::string sasToken = builder.GetAbsoluteUrl();
+    const size_t signaturePos = sasToken.find("sig=") + 4;
+    sasTokenPrefix = sasToken.substr(0, signaturePos);
+    sasTokenSuffix = sasToken.substr(signaturePos);
+  }
+
+  std::string BlobSasBuilder::GenerateSasToken(const StorageSharedKeyCredential& credential)
+  {
+    std::string stringToSign;
+    std::string stringToSignSuffix;
+    std::string sasToken;
+    std::string sasTokenSuffix;
+    FormatSasTemplate(
+        credential.AccountName, stringToSign, stringToSignSuffix, sasToken, sasTokenSuffix);
+    if (Resource == BlobSasResource::Blob || Resource == BlobSasResource::BlobSnapshot
+        || Resource == BlobSasResource::BlobVersion)
+    {
+      stringToSign += "/" + BlobName;
+    }
+    stringToSign += stringToSignSuffix;
+
+    std::string signature = Azure::Core::Convert::Base64Encode(credential.GetSigningContext()->Sign(
+        reinterpret_cast<const uint8_t*>(stringToSign.data()), stringToSign.length()));
+    return sasToken + _internal::UrlEncodeQueryParameter(signature) + sasTokenSuffix;
+  }
+
+  std::vector<std::string> BlobSasBuilder::GenerateSasTokens(
+      const std::vector<std::string>& blobNames,
+      const StorageSharedKeyCredential& credential)
+  {
+    if (Resource != BlobSasResource::Blob)
+    {
+      throw std::invalid_argument("GenerateSasTokens only supports BlobSasResource::Blob.");
+    }
+    std::string stringToSignPrefix;
+    std::string stringToSignSuffix;
+    std::string sasTokenPrefix;
+    std::string sasTokenSuffix;
+    FormatSasTemplate(
+        credential.AccountName,
+        stringToSignPrefix,
+        stringToSignSuffix,
+        sasTokenPrefix,
+        sasTokenSuffix);
+    const auto signingContext = credential.GetSigningContext();
+
+    std::vector<std::string> sasTokens;
+    sasTokens.reserve(blobNames.size());
+    std::string stringToSign;
+    for (const auto& blobName : blobNames)
+    {
+      stringToSign.assign(stringToSignPrefix);
+      stringToSign += '/';
+      stringToSign += blobName;
+      stringToSign += stringToSignSuffix;
+      std::string signature = Azure::Core::Convert::Base64Encode(signingContext->Sign(
+          reinterpret_cast<const uint8_t*>(stringToSign.data()), stringToSign.length()));
+      sasTokens.push_back(
+          sasTokenPrefix + _internal::UrlEncodeQueryParameter(signature) + sasTokenSuffix);
+    }
+    return sasTokens;
   }
 
   std::string BlobSasBuilder::GenerateSasToken(
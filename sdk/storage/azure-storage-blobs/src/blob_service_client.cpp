@@ -3,18 +3,293 @@
 
 #include "azure/storage/blobs/blob_service_client.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+
 #include <azure/core/http/policies/policy.hpp>
 #include <azure/storage/common/internal/constants.hpp>
 #include <azure/storage/common/internal/shared_key_policy.hpp>
 #include <azure/storage/common/internal/storage_per_retry_policy.hpp>
 #include <azure/storage/common/internal/storage_service_version_policy.hpp>
 #include <azure/storage/common/internal/storage_switch_to_secondary_policy.hpp>
+#include <azure/storage/common/internal/thread_pool.hpp>
 #include <azure/storage/common/storage_common.hpp>
+#include <azure/storage/common/storage_exception.hpp>
 
 #include "private/package_version.hpp"
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace {
+    // The error of a sub-request of a batch, null if it succeeded.
+    template <class T> std::exception_ptr GetSubRequestError(Azure::Response<T>& response)
+    {
+      if (static_cast<int>(response.RawResponse->GetStatusCode()) < 300)
+      {
+        return nullptr;
+      }
+      return std::make_exception_ptr(
+          StorageException::CreateFromResponse(std::move(response.RawResponse)));
+    }
+  } // namespace
+
+  namespace _detail {
+    class FindBlobsByTagsParallelState final
+        : public std::enable_shared_from_this<FindBlobsByTagsParallelState> {
+    public:
+      FindBlobsByTagsParallelState(
+          BlobServiceClient serviceClient,
+          std::deque<std::string> partitions,
+          const FindBlobsByTagsParallelOptions& options,
+          const Azure::Core::Context& context)
+          : m_serviceClient(std::move(serviceClient)), m_options(options),
+            m_walkContext(context.WithDeadline((Azure::DateTime::max)())),
+            m_partitions(std::move(partitions))
+      {
+      }
+
+      void Start()
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto numWalkers = std::min<size_t>(
+            static_cast<size_t>(m_options.Concurrency), m_partitions.size());
+        for (size_t i = 0; i < numWalkers; ++i)
+        {
+          ++m_numRunning;
+          auto self = shared_from_this();
+          Storage::_internal::ThreadPool::GetDefault().Submit([self]() { self->Walk(); });
+        }
+      }
+
+      Azure::Nullable<std::vector<Models::TaggedBlobItem>> ReadNextPage(
+          const Azure::Core::Context& context)
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true)
+        {
+          if (!m_pages.empty())
+          {
+            auto page = std::move(m_pages.front());
+            m_pages.pop_front();
+            m_stateChanged.notify_all();
+            return page;
+          }
+          if (m_error)
+          {
+            std::rethrow_exception(m_error);
+          }
+          if (m_numRunning == 0)
+          {
+            return Azure::Nullable<std::vector<Models::TaggedBlobItem>>();
+          }
+          // Wakes up now and then to check the context.
+          m_stateChanged.wait_for(lock, std::chrono::milliseconds(100));
+          context.ThrowIfCancelled();
+        }
+      }
+
+      void Stop()
+      {
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          m_stopping = true;
+          m_stateChanged.notify_all();
+        }
+        m_walkContext.Cancel();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_stateChanged.wait(lock, [&]() { return m_numRunning == 0; });
+      }
+
+    private:
+      // Walks the pages of the partitions left, one partition after the other.
+      void Walk()
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (!m_stopping && !m_error && !m_partitions.empty())
+        {
+          auto tagFilterSqlExpression = std::move(m_partitions.front());
+          m_partitions.pop_front();
+          lock.unlock();
+          try
+          {
+            FindBlobsByTagsOptions findOptions;
+            findOptions.PageSizeHint = m_options.PageSizeHint;
+            for (auto page = m_serviceClient.FindBlobsByTags(
+                     tagFilterSqlExpression, findOptions, m_walkContext);
+                 page.HasPage();
+                 page.MoveToNextPage(m_walkContext))
+            {
+              if (page.TaggedBlobs.empty())
+              {
+                continue;
+              }
+              std::unique_lock<std::mutex> pageLock(m_mutex);
+              m_stateChanged.wait(pageLock, [&]() {
+                return m_stopping
+                    || m_pages.size() < static_cast<size_t>(m_options.PrefetchPages);
+              });
+              if (m_stopping)
+              {
+                break;
+              }
+              m_pages.push_back(std::move(page.TaggedBlobs));
+              m_stateChanged.notify_all();
+            }
+          }
+          catch (...)
+          {
+            std::lock_guard<std::mutex> errorLock(m_mutex);
+            if (!m_error && !m_stopping)
+            {
+              m_error = std::current_exception();
+            }
+          }
+          lock.lock();
+        }
+        --m_numRunning;
+        // Notified under the lock, the state may be destroyed as soon as it's released.
+        m_stateChanged.notify_all();
+      }
+
+      BlobServiceClient m_serviceClient;
+      FindBlobsByTagsParallelOptions m_options;
+      // Cancelled when the stream is destroyed.
+      Azure::Core::Context m_walkContext;
+
+      // Guards the variables below.
+      std::mutex m_mutex;
+      std::condition_variable m_stateChanged;
+      // The expressions of the partitions not walked yet.
+      std::deque<std::string> m_partitions;
+      std::deque<std::vector<Models::TaggedBlobItem>> m_pages;
+      int32_t m_numRunning = 0;
+      std::exception_ptr m_error;
+      bool m_stopping = false;
+    };
+  } // namespace _detail
+
+  FindBlobsByTagsParallelStream::~FindBlobsByTagsParallelStream()
+  {
+    if (m_state)
+    {
+      m_state->Stop();
+    }
+  }
+
+  Azure::Nullable<std::vector<Models::TaggedBlobItem>> FindBlobsByTagsParallelStream::ReadNextPage(
+      const Azure::Core::Context& context)
+  {
+    return m_state->ReadNextPage(context);
+  }
+
+  size_t BlobBulkOperations::CreateBlobContainer(
+      const std::string& blobContainerName,
+      const CreateBlobContainerOptions& options)
+  {
+    Operation operation;
+    operation.Execute = [blobContainerName, options](
+                            const BlobServiceClient& serviceClient,
+                            const Azure::Core::Context& context) {
+      serviceClient.CreateBlobContainer(blobContainerName, options, context);
+    };
+    m_operations.push_back(std::move(operation));
+    return m_operations.size() - 1;
+  }
+
+  size_t BlobBulkOperations::DeleteBlobContainer(
+      const std::string& blobContainerName,
+      const DeleteBlobContainerOptions& options)
+  {
+    Operation operation;
+    operation.Execute = [blobContainerName, options](
+                            const BlobServiceClient& serviceClient,
+                            const Azure::Core::Context& context) {
+      serviceClient.DeleteBlobContainer(blobContainerName, options, context);
+    };
+    m_operations.push_back(std::move(operation));
+    return m_operations.size() - 1;
+  }
+
+  size_t BlobBulkOperations::SetBlobContainerMetadata(
+      const std::string& blobContainerName,
+      Metadata metadata,
+      const SetBlobContainerMetadataOptions& options)
+  {
+    Operation operation;
+    operation.Execute = [blobContainerName, metadata, options](
+                            const BlobServiceClient& serviceClient,
+                            const Azure::Core::Context& context) {
+      serviceClient.GetBlobContainerClient(blobContainerName)
+          .SetMetadata(metadata, options, context);
+    };
+    m_operations.push_back(std::move(operation));
+    return m_operations.size() - 1;
+  }
+
+  size_t BlobBulkOperations::DeleteBlob(
+      const std::string& blobContainerName,
+      const std::string& blobName,
+      const DeleteBlobOptions& options)
+  {
+    Operation operation;
+    operation.Execute = [blobContainerName, blobName, options](
+                            const BlobServiceClient& serviceClient,
+                            const Azure::Core::Context& context) {
+      serviceClient.GetBlobContainerClient(blobContainerName)
+          .GetBlobClient(blobName)
+          .Delete(options, context);
+    };
+    operation.AddToBatch = [blobContainerName, blobName, options](BlobBatch& batch) {
+      return batch.DeleteBlob(blobContainerName, blobName, options);
+    };
+    operation.IsDeletion = true;
+    m_operations.push_back(std::move(operation));
+    return m_operations.size() - 1;
+  }
+
+  size_t BlobBulkOperations::SetBlobMetadata(
+      const std::string& blobContainerName,
+      const std::string& blobName,
+      Metadata metadata,
+      const SetBlobMetadataOptions& options)
+  {
+    Operation operation;
+    operation.Execute = [blobContainerName, blobName, metadata, options](
+                            const BlobServiceClient& serviceClient,
+                            const Azure::Core::Context& context) {
+      serviceClient.GetBlobContainerClient(blobContainerName)
+          .GetBlobClient(blobName)
+          .SetMetadata(metadata, options, context);
+    };
+    m_operations.push_back(std::move(operation));
+    return m_operations.size() - 1;
+  }
+
+  size_t BlobBulkOperations::SetBlobAccessTier(
+      const std::string& blobContainerName,
+      const std::string& blobName,
+      Models::AccessTier tier,
+      const SetBlobAccessTierOptions& options)
+  {
+    Operation operation;
+    operation.Execute = [blobContainerName, blobName, tier, options](
+                            const BlobServiceClient& serviceClient,
+                            const Azure::Core::Context& context) {
+      serviceClient.GetBlobContainerClient(blobContainerName)
+          .GetBlobClient(blobName)
+          .SetAccessTier(tier, options, context);
+    };
+    operation.AddToBatch = [blobContainerName, blobName, tier, options](BlobBatch& batch) {
+      return batch.SetBlobAccessTier(blobContainerName, blobName, tier, options);
+    };
+    m_operations.push_back(std::move(operation));
+    return m_operations.size() - 1;
+  }
+
   BlobServiceClient BlobServiceClient::CreateFromConnectionString(
       const std::string& connectionString,
       const BlobClientOptions& options)
@@ -46,7 +321,9 @@ namespace Azure { namespace Storage { namespace Blobs {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_serviceUrl.GetHost(), newOptions.SecondaryHostForRetryReads));
+        m_serviceUrl.GetHost(),
+        newOptions.SecondaryHostForRetryReads,
+        newOptions.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     perOperationPolicies.emplace_back(
         std::make_unique<_internal::StorageServiceVersionPolicy>(newOptions.ApiVersion));
@@ -67,7 +344,9 @@ namespace Azure { namespace Storage { namespace Blobs {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_serviceUrl.GetHost(), options.SecondaryHostForRetryReads));
+        m_serviceUrl.GetHost(),
+        options.SecondaryHostForRetryReads,
+        options.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     {
       Azure::Core::Credentials::TokenRequestContext tokenContext;
@@ -90,12 +369,15 @@ namespace Azure { namespace Storage { namespace Blobs {
       const std::string& serviceUrl,
       const BlobClientOptions& options)
       : m_serviceUrl(serviceUrl), m_customerProvidedKey(options.CustomerProvidedKey),
-        m_encryptionScope(options.EncryptionScope)
+        m_encryptionScope(options.EncryptionScope), m_transferScheduler(options.TransferScheduler),
+        m_bufferPool(options.BufferPool), m_propertiesCache(options.PropertiesCache)
   {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_serviceUrl.GetHost(), options.SecondaryHostForRetryReads));
+        m_serviceUrl.GetHost(),
+        options.SecondaryHostForRetryReads,
+        options.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     perOperationPolicies.emplace_back(
         std::make_unique<_internal::StorageServiceVersionPolicy>(options.ApiVersion));
@@ -105,6 +387,8 @@ namespace Azure { namespace Storage { namespace Blobs {
         _detail::PackageVersion::ToString(),
         std::move(perRetryPolicies),
         std::move(perOperationPolicies));
+    // The constructors with a credential replace the pipeline, this one stays without it.
+    m_sourcePipeline = m_pipeline;
   }
 
   BlobContainerClient BlobServiceClient::GetBlobContainerClient(
@@ -113,7 +397,14 @@ namespace Azure { namespace Storage { namespace Blobs {
     auto blobContainerUrl = m_serviceUrl;
     blobContainerUrl.AppendPath(_internal::UrlEncodePath(blobContainerName));
     return BlobContainerClient(
-        std::move(blobContainerUrl), m_pipeline, m_customerProvidedKey, m_encryptionScope);
+        std::move(blobContainerUrl),
+        m_pipeline,
+        m_customerProvidedKey,
+        m_encryptionScope,
+        m_transferScheduler,
+        m_bufferPool,
+        m_propertiesCache,
+        m_sourcePipeline);
   }
 
   ListBlobContainersPagedResponse BlobServiceClient::ListBlobContainers(
@@ -138,7 +429,7 @@ namespace Azure { namespace Storage { namespace Blobs {
     pagedResponse.m_blobServiceClient = std::make_shared<BlobServiceClient>(*this);
     pagedResponse.m_operationOptions = options;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken;
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
     pagedResponse.RawResponse = std::move(response.RawResponse);
 
     return pagedResponse;
@@ -220,12 +511,52 @@ namespace Azure { namespace Storage { namespace Blobs {
     pagedResponse.m_operationOptions = options;
     pagedResponse.m_tagFilterSqlExpression = tagFilterSqlExpression;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken;
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
     pagedResponse.RawResponse = std::move(response.RawResponse);
 
     return pagedResponse;
   }
 
+  FindBlobsByTagsParallelStream BlobServiceClient::FindBlobsByTagsParallel(
+      const std::string& tagFilterSqlExpression,
+      const FindBlobsByTagsParallelOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    if (options.Concurrency <= 0 || options.PrefetchPages <= 0)
+    {
+      throw std::invalid_argument("Concurrency and PrefetchPages must be positive.");
+    }
+    if (tagFilterSqlExpression.find("@container") != std::string::npos)
+    {
+      throw std::invalid_argument("The expression is already restricted to a container.");
+    }
+
+    std::vector<std::string> blobContainerNames = options.BlobContainerNames;
+    if (blobContainerNames.empty())
+    {
+      for (auto page = ListBlobContainers(ListBlobContainersOptions(), context); page.HasPage();
+           page.MoveToNextPage(context))
+      {
+        for (const auto& blobContainer : page.BlobContainers)
+        {
+          blobContainerNames.push_back(blobContainer.Name);
+        }
+      }
+    }
+    // Container names have no quotes to escape.
+    std::deque<std::string> partitions;
+    for (const auto& blobContainerName : blobContainerNames)
+    {
+      partitions.push_back(
+          "@container = '" + blobContainerName + "' AND " + tagFilterSqlExpression);
+    }
+
+    auto state = std::make_shared<_detail::FindBlobsByTagsParallelState>(
+        *this, std::move(partitions), options, context);
+    state->Start();
+    return FindBlobsByTagsParallelStream(std::move(state));
+  }
+
   Azure::Response<BlobContainerClient> BlobServiceClient::CreateBlobContainer(
       const std::string& blobContainerName,
       const CreateBlobContainerOptions& options,
@@ -266,4 +597,93 @@ namespace Azure { namespace Storage { namespace Blobs {
         std::move(blobContainerClient), std::move(response.RawResponse));
   }
 
+  BulkOperationResult BlobServiceClient::SubmitBulkOperations(
+      const BlobBulkOperations& operations,
+      const SubmitBlobBulkOperationsOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    const auto& bulkOperations = operations.m_operations;
+    BulkOperationResult ret;
+    ret.Errors.resize(bulkOperations.size());
+
+    // Each unit records the errors of its own operations.
+    auto executeSingle = [&](size_t operationId, const Azure::Core::Context& unitContext) {
+      try
+      {
+        bulkOperations[operationId].Execute(*this, unitContext);
+      }
+      catch (...)
+      {
+        ret.Errors[operationId] = std::current_exception();
+      }
+    };
+    auto executeBatch = [&](const std::vector<size_t>& operationIds,
+                            const Azure::Core::Context& unitContext) {
+      BlobBatch batch;
+      std::vector<int32_t> subRequestIds;
+      for (auto operationId : operationIds)
+      {
+        subRequestIds.push_back(bulkOperations[operationId].AddToBatch(batch));
+      }
+      Models::SubmitBlobBatchResult batchResult;
+      try
+      {
+        batchResult = std::move(
+            options.BatchClient->SubmitBatch(batch, SubmitBlobBatchOptions(), unitContext).Value);
+      }
+      catch (...)
+      {
+        for (auto operationId : operationIds)
+        {
+          executeSingle(operationId, unitContext);
+        }
+        return;
+      }
+      for (size_t i = 0; i < operationIds.size(); ++i)
+      {
+        const size_t subRequestId = static_cast<size_t>(subRequestIds[i]);
+        ret.Errors[operationIds[i]] = bulkOperations[operationIds[i]].IsDeletion
+            ? GetSubRequestError(batchResult.DeleteBlobResults[subRequestId])
+            : GetSubRequestError(batchResult.SetBlobAccessTierResults[subRequestId]);
+      }
+    };
+
+    std::vector<BulkOperation> units;
+    std::vector<size_t> batchedOperationIds;
+    for (size_t i = 0; i < bulkOperations.size(); ++i)
+    {
+      if (options.BatchClient && bulkOperations[i].AddToBatch)
+      {
+        batchedOperationIds.push_back(i);
+      }
+      else
+      {
+        units.push_back([&executeSingle, i](const Azure::Core::Context& unitContext) {
+          executeSingle(i, unitContext);
+        });
+      }
+    }
+    for (size_t begin = 0; begin < batchedOperationIds.size(); begin += BlobBatch::MaxSubRequests)
+    {
+      const size_t end = std::min(begin + BlobBatch::MaxSubRequests, batchedOperationIds.size());
+      std::vector<size_t> operationIds(
+          batchedOperationIds.begin() + begin, batchedOperationIds.begin() + end);
+      units.push_back([&executeBatch, operationIds](const Azure::Core::Context& unitContext) {
+        executeBatch(operationIds, unitContext);
+      });
+    }
+
+    BulkOperationOptions bulkOptions;
+    bulkOptions.Concurrency = options.Concurrency;
+    ExecuteBulkOperations(units, bulkOptions, context);
+    for (const auto& error : ret.Errors)
+    {
+      if (error)
+      {
+        ++ret.FailedCount;
+      }
+    }
+    return ret;
+  }
+
 }}} // namespace Azure::Storage::Blobs
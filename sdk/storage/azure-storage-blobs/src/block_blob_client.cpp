@@ -15,16 +15,170 @@
 #include <windows.h>
 #endif
 
+#include <azure/core/cryptography/hash.hpp>
+#include <azure/core/internal/cryptography/sha_hash.hpp>
 #include <azure/core/io/body_stream.hpp>
 #include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/async_operation.hpp>
+#include <azure/storage/common/internal/chunked_crc64.hpp>
 #include <azure/storage/common/internal/concurrent_transfer.hpp>
 #include <azure/storage/common/internal/constants.hpp>
+#include <azure/storage/common/internal/content_defined_chunker.hpp>
 #include <azure/storage/common/internal/file_io.hpp>
+#include <azure/storage/common/internal/gzip.hpp>
+#include <azure/storage/common/internal/hashing_body_stream.hpp>
 #include <azure/storage/common/internal/storage_switch_to_secondary_policy.hpp>
 #include <azure/storage/common/storage_common.hpp>
 
+#include "private/client_side_encryption.hpp"
+
+#include <set>
+#include <stdexcept>
+
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace {
+    // The size of the pieces a file is read in to compute its CRC64 before a single upload.
+    constexpr size_t FileCrc64BufferSize = 4 * 1024 * 1024;
+
+    Azure::Response<Models::UploadBlockBlobFromResult> FromUploadBlockBlobResult(
+        Azure::Response<Models::UploadBlockBlobResult> response,
+        Azure::Nullable<ContentHash> contentCrc64)
+    {
+      Models::UploadBlockBlobFromResult ret;
+      ret.ETag = std::move(response.Value.ETag);
+      ret.LastModified = std::move(response.Value.LastModified);
+      ret.VersionId = std::move(response.Value.VersionId);
+      ret.IsServerEncrypted = response.Value.IsServerEncrypted;
+      ret.EncryptionKeySha256 = std::move(response.Value.EncryptionKeySha256);
+      ret.EncryptionScope = std::move(response.Value.EncryptionScope);
+      ret.TransactionalContentHash = std::move(response.Value.TransactionalContentHash);
+      ret.ContentCrc64 = std::move(contentCrc64);
+      return Azure::Response<Models::UploadBlockBlobFromResult>(
+          std::move(ret), std::move(response.RawResponse));
+    }
+
+    // Checks the hash computed while the content was sent against the hash of the content
+    // received returned by the service, or returns the computed hash without one.
+    void CheckTransactionalContentHash(
+        ContentHash computedHash,
+        Azure::Nullable<ContentHash>& responseHash)
+    {
+      if (!responseHash.HasValue())
+      {
+        responseHash = std::move(computedHash);
+      }
+      else if (
+          responseHash.Value().Algorithm == computedHash.Algorithm
+          && responseHash.Value().Value != computedHash.Value)
+      {
+        throw Azure::Core::RequestFailedException(
+            "The hash of the content sent doesn't match the hash of the content received.");
+      }
+    }
+
+    // Compresses or encrypts the blocks of UploadFrom before they are sent, as set in the
+    // options.
+    class BlockEncoder final {
+    public:
+      BlockEncoder(
+          const UploadBlockBlobFromOptions& options,
+          std::shared_ptr<BufferPool> bufferPool,
+          const Azure::Core::Context& context)
+          : m_options(options), m_bufferPool(std::move(bufferPool))
+      {
+        if (options.TransferOptions.CompressContent && options.TransferOptions.ComputeContentCrc64)
+        {
+          throw Azure::Core::RequestFailedException(
+              "ComputeContentCrc64 can't be used with CompressContent.");
+        }
+        if (options.ClientSideEncryption.HasValue())
+        {
+          if (!options.ClientSideEncryption.Value().KeyEncryptionKey)
+          {
+            throw Azure::Core::RequestFailedException(
+                "ClientSideEncryption needs a KeyEncryptionKey.");
+          }
+          if (options.TransferOptions.ComputeContentCrc64 || options.TransferOptions.Journal
+              || options.TransferOptions.CompressContent)
+          {
+            throw Azure::Core::RequestFailedException(
+                "ClientSideEncryption can't be used with ComputeContentCrc64, a transfer journal "
+                "or CompressContent.");
+          }
+          m_cipher = std::make_unique<_detail::SegmentedContentCipher>();
+          m_encryptionData
+              = m_cipher->GetEncryptionData(options.ClientSideEncryption.Value(), context);
+        }
+      }
+
+      bool IsEnabled() const { return m_options.TransferOptions.CompressContent || m_cipher; }
+
+      bool IsEncrypting() const { return m_cipher != nullptr; }
+
+      Models::BlobHttpHeaders GetHttpHeaders() const
+      {
+        Models::BlobHttpHeaders httpHeaders = m_options.HttpHeaders;
+        if (m_options.TransferOptions.CompressContent)
+        {
+          httpHeaders.ContentEncoding = "gzip";
+        }
+        return httpHeaders;
+      }
+
+      Storage::Metadata GetMetadata() const
+      {
+        Storage::Metadata metadata = m_options.Metadata;
+        if (m_cipher)
+        {
+          metadata[_detail::EncryptionDataMetadataKey] = m_encryptionData;
+        }
+        return metadata;
+      }
+
+      // Encrypted blocks hold whole segments, but the last one.
+      int64_t AlignBlockSize(int64_t blockSize) const
+      {
+        if (!m_cipher)
+        {
+          return blockSize;
+        }
+        const int64_t segmentSize = m_cipher->GetSegmentSize();
+        return (blockSize + segmentSize - 1) / segmentSize * segmentSize;
+      }
+
+      // Compresses a block into a gzip member of its own, or encrypts it. data and size are
+      // updated to the encoded block, held in buffer.
+      void Encode(const uint8_t*& data, size_t& size, _internal::PooledBuffer& buffer) const
+      {
+        size_t encodedSize;
+        if (m_options.TransferOptions.CompressContent)
+        {
+          buffer = _internal::PooledBuffer(m_bufferPool, _internal::GzipMaxCompressedSize(size));
+          encodedSize = _internal::GzipCompress(data, size, buffer.GetData(), buffer.GetSize());
+        }
+        else if (m_cipher)
+        {
+          encodedSize = static_cast<size_t>(m_cipher->GetEncryptedSize(size));
+          buffer = _internal::PooledBuffer(m_bufferPool, std::max<size_t>(encodedSize, 1));
+          m_cipher->Encrypt(data, size, buffer.GetData());
+        }
+        else
+        {
+          return;
+        }
+        data = buffer.GetData();
+        size = encodedSize;
+      }
+
+    private:
+      const UploadBlockBlobFromOptions& m_options;
+      std::shared_ptr<BufferPool> m_bufferPool;
+      std::unique_ptr<_detail::SegmentedContentCipher> m_cipher;
+      std::string m_encryptionData;
+    };
+  } // namespace
+
   BlockBlobClient BlockBlobClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& blobContainerName,
@@ -94,27 +248,78 @@ namespace Azure { namespace Storage { namespace Blobs {
       const UploadBlockBlobOptions& options,
       const Azure::Core::Context& context) const
   {
-    _detail::BlobRestClient::BlockBlob::UploadBlockBlobOptions protocolLayerOptions;
-    protocolLayerOptions.TransactionalContentHash = options.TransactionalContentHash;
-    protocolLayerOptions.HttpHeaders = options.HttpHeaders;
-    protocolLayerOptions.Metadata = options.Metadata;
-    protocolLayerOptions.Tags = options.Tags;
-    protocolLayerOptions.AccessTier = options.AccessTier;
-    protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
-    protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
-    protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
-    protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
-    protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
-    protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
-    if (m_customerProvidedKey.HasValue())
+    auto protocolLayerOptions = GetUploadProtocolLayerOptions(options);
+    if (options.ComputeTransactionalContentHash.HasValue())
     {
-      protocolLayerOptions.EncryptionKey = m_customerProvidedKey.Value().Key;
-      protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.Value().KeyHash;
-      protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm;
+      if (options.TransactionalContentHash.HasValue())
+      {
+        throw Azure::Core::RequestFailedException(
+            "ComputeTransactionalContentHash can't be used with TransactionalContentHash.");
+      }
+      _internal::HashingBodyStream hashingStream(
+          content, options.ComputeTransactionalContentHash.Value());
+      auto response = _detail::BlobRestClient::BlockBlob::Upload(
+          *m_pipeline, m_blobUrl, hashingStream, protocolLayerOptions, context);
+      if (m_propertiesCache)
+      {
+        m_propertiesCache->Remove(m_blobUrl.GetAbsoluteUrl());
+      }
+      CheckTransactionalContentHash(
+          hashingStream.GetHash(), response.Value.TransactionalContentHash);
+      return response;
     }
-    protocolLayerOptions.EncryptionScope = m_encryptionScope;
-    return _detail::BlobRestClient::BlockBlob::Upload(
+    auto response = _detail::BlobRestClient::BlockBlob::Upload(
         *m_pipeline, m_blobUrl, content, protocolLayerOptions, context);
+    if (m_propertiesCache)
+    {
+      m_propertiesCache->Remove(m_blobUrl.GetAbsoluteUrl());
+    }
+    return response;
+  }
+
+  void BlockBlobClient::UploadAsync(
+      Azure::Core::IO::BodyStream& content,
+      const UploadBlockBlobOptions& options,
+      const Azure::Core::Context& context,
+      Azure::Core::ResponseCallback<Models::UploadBlockBlobResult> callback) const
+  {
+    auto protocolLayerOptions = GetUploadProtocolLayerOptions(options);
+    std::shared_ptr<_internal::HashingBodyStream> hashingStream;
+    if (options.ComputeTransactionalContentHash.HasValue())
+    {
+      if (options.TransactionalContentHash.HasValue())
+      {
+        throw Azure::Core::RequestFailedException(
+            "ComputeTransactionalContentHash can't be used with TransactionalContentHash.");
+      }
+      hashingStream = std::make_shared<_internal::HashingBodyStream>(
+          content, options.ComputeTransactionalContentHash.Value());
+    }
+    auto propertiesCache = m_propertiesCache;
+    const std::string blobUrl = m_blobUrl.GetAbsoluteUrl();
+    _internal::SendAsync<Models::UploadBlockBlobResult>(
+        m_pipeline,
+        _detail::BlobRestClient::BlockBlob::UploadCreateMessage(
+            m_blobUrl,
+            hashingStream ? *hashingStream : content,
+            protocolLayerOptions),
+        context,
+        [hashingStream, propertiesCache, blobUrl, context](
+            std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse) {
+          auto response = _detail::BlobRestClient::BlockBlob::UploadCreateResponse(
+              std::move(rawResponse), context);
+          if (propertiesCache)
+          {
+            propertiesCache->Remove(blobUrl);
+          }
+          if (hashingStream)
+          {
+            CheckTransactionalContentHash(
+                hashingStream->GetHash(), response.Value.TransactionalContentHash);
+          }
+          return response;
+        },
+        std::move(callback));
   }
 
   Azure::Response<Models::UploadBlockBlobFromResult> BlockBlobClient::UploadFrom(
@@ -127,7 +332,20 @@ namespace Azure { namespace Storage { namespace Blobs {
     constexpr int64_t MaxStageBlockSize = 4000 * 1024 * 1024ULL;
     constexpr int64_t MaxBlockNumber = 50000;
     constexpr int64_t BlockGrainSize = 1 * 1024 * 1024;
+    constexpr int64_t MaxAdaptiveStageBlockSize = 256 * 1024 * 1024ULL;
 
+    if (options.TransferOptions.ComputeContentMd5)
+    {
+      throw Azure::Core::RequestFailedException(
+          "ComputeContentMd5 is only supported when uploading from a stream.");
+    }
+    BlockEncoder encoder(options, m_bufferPool, context);
+    _internal::TransferProgressReporter progressReporter(
+        m_transferCounters,
+        true,
+        options.TransferOptions.ProgressHandler,
+        options.TransferOptions.ProgressInterval);
+    progressReporter.SetTotalBytes(static_cast<int64_t>(bufferSize));
     if (static_cast<uint64_t>(options.TransferOptions.SingleUploadThreshold)
         > std::numeric_limits<size_t>::max())
     {
@@ -135,15 +353,30 @@ namespace Azure { namespace Storage { namespace Blobs {
     }
     if (bufferSize <= static_cast<size_t>(options.TransferOptions.SingleUploadThreshold))
     {
-      Azure::Core::IO::MemoryBodyStream contentStream(buffer, bufferSize);
+      const uint8_t* data = buffer;
+      size_t size = bufferSize;
+      _internal::PooledBuffer encodedBuffer;
+      encoder.Encode(data, size, encodedBuffer);
+      Azure::Core::IO::MemoryBodyStream contentStream(data, size);
       UploadBlockBlobOptions uploadBlockBlobOptions;
-      uploadBlockBlobOptions.HttpHeaders = options.HttpHeaders;
-      uploadBlockBlobOptions.Metadata = options.Metadata;
+      uploadBlockBlobOptions.HttpHeaders = encoder.GetHttpHeaders();
+      uploadBlockBlobOptions.Metadata = encoder.GetMetadata();
       uploadBlockBlobOptions.Tags = options.Tags;
       uploadBlockBlobOptions.AccessTier = options.AccessTier;
-      return Upload(contentStream, uploadBlockBlobOptions, context);
+      Azure::Nullable<ContentHash> contentCrc64;
+      if (options.TransferOptions.ComputeContentCrc64)
+      {
+        contentCrc64 = _internal::ChunkedCrc64().Append(0, buffer, bufferSize);
+        uploadBlockBlobOptions.TransactionalContentHash = contentCrc64;
+      }
+      auto uploadResponse = Upload(contentStream, uploadBlockBlobOptions, context);
+      progressReporter.OnBytesTransferred(static_cast<int64_t>(bufferSize));
+      progressReporter.OnTransferDone();
+      return FromUploadBlockBlobResult(std::move(uploadResponse), std::move(contentCrc64));
     }
 
+    int64_t minChunkSize = (bufferSize + MaxBlockNumber - 1) / MaxBlockNumber;
+    minChunkSize = (minChunkSize + BlockGrainSize - 1) / BlockGrainSize * BlockGrainSize;
     int64_t chunkSize;
     if (options.TransferOptions.ChunkSize.HasValue())
     {
@@ -151,16 +384,15 @@ namespace Azure { namespace Storage { namespace Blobs {
     }
     else
     {
-      int64_t minChunkSize = (bufferSize + MaxBlockNumber - 1) / MaxBlockNumber;
-      minChunkSize = (minChunkSize + BlockGrainSize - 1) / BlockGrainSize * BlockGrainSize;
       chunkSize = std::max(DefaultStageBlockSize, minChunkSize);
     }
+    chunkSize = encoder.AlignBlockSize(chunkSize);
     if (chunkSize > MaxStageBlockSize)
     {
       throw Azure::Core::RequestFailedException("Block size is too big.");
     }
 
-    std::vector<std::string> blockIds;
+    int64_t numBlocks = 0;
     auto getBlockId = [](int64_t id) {
       constexpr size_t BlockIdLength = 64;
       std::string blockId = std::to_string(id);
@@ -169,29 +401,74 @@ namespace Azure { namespace Storage { namespace Blobs {
           std::vector<uint8_t>(blockId.begin(), blockId.end()));
     };
 
-    auto uploadBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-      Azure::Core::IO::MemoryBodyStream contentStream(buffer + offset, static_cast<size_t>(length));
+    std::unique_ptr<_internal::ChunkedCrc64> contentCrc64;
+    if (options.TransferOptions.ComputeContentCrc64)
+    {
+      contentCrc64 = std::make_unique<_internal::ChunkedCrc64>();
+    }
+
+    auto uploadBlockFunc = [&](int64_t offset,
+                               int64_t length,
+                               int64_t chunkId,
+                               int64_t numChunks,
+                               const Azure::Core::Context& chunkContext) {
+      const uint8_t* data = buffer + offset;
+      size_t size = static_cast<size_t>(length);
+      _internal::PooledBuffer encodedBuffer;
+      encoder.Encode(data, size, encodedBuffer);
+      Azure::Core::IO::MemoryBodyStream contentStream(data, size);
       StageBlockOptions chunkOptions;
-      auto blockInfo = StageBlock(getBlockId(chunkId), contentStream, chunkOptions, context);
+      if (contentCrc64)
+      {
+        chunkOptions.TransactionalContentHash
+            = contentCrc64->Append(offset, buffer + offset, static_cast<size_t>(length));
+      }
+      auto blockInfo = StageBlock(getBlockId(chunkId), contentStream, chunkOptions, chunkContext);
       if (chunkId == numChunks - 1)
       {
-        blockIds.resize(static_cast<size_t>(numChunks));
+        numBlocks = numChunks;
       }
+      progressReporter.OnBytesTransferred(length);
     };
 
-    _internal::ConcurrentTransfer(
-        0, bufferSize, chunkSize, options.TransferOptions.Concurrency, uploadBlockFunc);
-
-    for (size_t i = 0; i < blockIds.size(); ++i)
+    if (options.TransferOptions.Strategy == TransferStrategy::Adaptive && !encoder.IsEncrypting())
+    {
+      // Blocks never get smaller than minChunkSize, so there are no more than MaxBlockNumber.
+      _internal::AdaptiveChunkController controller(
+          chunkSize,
+          minChunkSize,
+          std::max(chunkSize, MaxAdaptiveStageBlockSize),
+          options.TransferOptions.Concurrency);
+      _internal::AdaptiveConcurrentTransfer(
+          0,
+          bufferSize,
+          controller,
+          uploadBlockFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    else
     {
-      blockIds[i] = getBlockId(static_cast<int64_t>(i));
+      _internal::ConcurrentTransfer(
+          0,
+          bufferSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadBlockFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
     }
+
     CommitBlockListOptions commitBlockListOptions;
-    commitBlockListOptions.HttpHeaders = options.HttpHeaders;
-    commitBlockListOptions.Metadata = options.Metadata;
+    commitBlockListOptions.HttpHeaders = encoder.GetHttpHeaders();
+    commitBlockListOptions.Metadata = encoder.GetMetadata();
     commitBlockListOptions.Tags = options.Tags;
     commitBlockListOptions.AccessTier = options.AccessTier;
-    auto commitBlockListResponse = CommitBlockList(blockIds, commitBlockListOptions, context);
+    auto commitBlockListResponse
+        = CommitNumberedBlockList(numBlocks, commitBlockListOptions, context);
+    progressReporter.OnTransferDone();
 
     Models::UploadBlockBlobFromResult ret;
     ret.ETag = std::move(commitBlockListResponse.Value.ETag);
@@ -200,6 +477,10 @@ namespace Azure { namespace Storage { namespace Blobs {
     ret.IsServerEncrypted = commitBlockListResponse.Value.IsServerEncrypted;
     ret.EncryptionKeySha256 = std::move(commitBlockListResponse.Value.EncryptionKeySha256);
     ret.EncryptionScope = std::move(commitBlockListResponse.Value.EncryptionScope);
+    if (contentCrc64)
+    {
+      ret.ContentCrc64 = contentCrc64->Final();
+    }
     return Azure::Response<Models::UploadBlockBlobFromResult>(
         std::move(ret), std::move(commitBlockListResponse.RawResponse));
   }
@@ -213,22 +494,81 @@ namespace Azure { namespace Storage { namespace Blobs {
     constexpr int64_t MaxStageBlockSize = 4000 * 1024 * 1024ULL;
     constexpr int64_t MaxBlockNumber = 50000;
     constexpr int64_t BlockGrainSize = 1 * 1024 * 1024;
+    constexpr int64_t MaxAdaptiveStageBlockSize = 256 * 1024 * 1024ULL;
 
+    if (options.TransferOptions.ComputeContentMd5)
+    {
+      throw Azure::Core::RequestFailedException(
+          "ComputeContentMd5 is only supported when uploading from a stream.");
+    }
+    BlockEncoder encoder(options, m_bufferPool, context);
+    _internal::TransferProgressReporter progressReporter(
+        m_transferCounters,
+        true,
+        options.TransferOptions.ProgressHandler,
+        options.TransferOptions.ProgressInterval);
     {
       Azure::Core::IO::FileBodyStream contentStream(fileName);
+      progressReporter.SetTotalBytes(contentStream.Length());
 
       if (contentStream.Length() <= options.TransferOptions.SingleUploadThreshold)
       {
         UploadBlockBlobOptions uploadBlockBlobOptions;
-        uploadBlockBlobOptions.HttpHeaders = options.HttpHeaders;
-        uploadBlockBlobOptions.Metadata = options.Metadata;
+        uploadBlockBlobOptions.HttpHeaders = encoder.GetHttpHeaders();
+        uploadBlockBlobOptions.Metadata = encoder.GetMetadata();
         uploadBlockBlobOptions.Tags = options.Tags;
         uploadBlockBlobOptions.AccessTier = options.AccessTier;
-        return Upload(contentStream, uploadBlockBlobOptions, context);
+        if (encoder.IsEnabled())
+        {
+          // The file is read in memory to be compressed or encrypted before it's sent.
+          size_t size = static_cast<size_t>(contentStream.Length());
+          _internal::PooledBuffer buffer(m_bufferPool, std::max<size_t>(size, 1));
+          if (contentStream.ReadToCount(buffer.GetData(), size, context) != size)
+          {
+            throw std::runtime_error("Failed to read file.");
+          }
+          const uint8_t* data = buffer.GetData();
+          _internal::PooledBuffer encodedBuffer;
+          encoder.Encode(data, size, encodedBuffer);
+          Azure::Core::IO::MemoryBodyStream encodedStream(data, size);
+          auto uploadResponse = Upload(encodedStream, uploadBlockBlobOptions, context);
+          progressReporter.OnBytesTransferred(contentStream.Length());
+          progressReporter.OnTransferDone();
+          return FromUploadBlockBlobResult(
+              std::move(uploadResponse), Azure::Nullable<ContentHash>());
+        }
+        Azure::Nullable<ContentHash> contentCrc64;
+        if (options.TransferOptions.ComputeContentCrc64)
+        {
+          // The file is read once more to be hashed before it's uploaded.
+          _internal::ChunkedCrc64 crc64;
+          _internal::PooledBuffer buffer(
+              m_bufferPool,
+              static_cast<size_t>(std::min<int64_t>(
+                  std::max<int64_t>(contentStream.Length(), 1), FileCrc64BufferSize)));
+          for (int64_t offset = 0; offset < contentStream.Length();)
+          {
+            const size_t bytesRead
+                = contentStream.ReadToCount(buffer.GetData(), buffer.GetSize(), context);
+            if (bytesRead == 0)
+            {
+              throw std::runtime_error("Failed to read file.");
+            }
+            crc64.Append(offset, buffer.GetData(), bytesRead);
+            offset += bytesRead;
+          }
+          contentStream.Rewind();
+          contentCrc64 = crc64.Final();
+          uploadBlockBlobOptions.TransactionalContentHash = contentCrc64;
+        }
+        auto uploadResponse = Upload(contentStream, uploadBlockBlobOptions, context);
+        progressReporter.OnBytesTransferred(contentStream.Length());
+        progressReporter.OnTransferDone();
+        return FromUploadBlockBlobResult(std::move(uploadResponse), std::move(contentCrc64));
       }
     }
 
-    std::vector<std::string> blockIds;
+    int64_t numBlocks = 0;
     auto getBlockId = [](int64_t id) {
       constexpr size_t BlockIdLength = 64;
       std::string blockId = std::to_string(id);
@@ -237,19 +577,93 @@ namespace Azure { namespace Storage { namespace Blobs {
           std::vector<uint8_t>(blockId.begin(), blockId.end()));
     };
 
-    _internal::FileReader fileReader(fileName);
+    _internal::FileReader fileReader(fileName, options.TransferOptions.UseUnbufferedFileIo);
+    std::unique_ptr<_internal::FileMapping> fileMapping;
+    if (options.TransferOptions.UseMemoryMappedFile)
+    {
+      fileMapping = std::make_unique<_internal::FileMapping>(fileReader);
+    }
 
-    auto uploadBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-      Azure::Core::IO::_internal::RandomAccessFileBodyStream contentStream(
-          fileReader.GetHandle(), offset, length);
-      StageBlockOptions chunkOptions;
-      auto blockInfo = StageBlock(getBlockId(chunkId), contentStream, chunkOptions, context);
+    std::unique_ptr<_internal::ChunkedCrc64> contentCrc64;
+    if (options.TransferOptions.ComputeContentCrc64)
+    {
+      contentCrc64 = std::make_unique<_internal::ChunkedCrc64>();
+    }
+    if (options.TransferOptions.Journal && contentCrc64)
+    {
+      throw Azure::Core::RequestFailedException(
+          "ComputeContentCrc64 can't be used with a transfer journal.");
+    }
+
+    std::unique_ptr<_internal::TransferProgress> progress;
+    std::map<std::string, int64_t> stagedBlocks;
+
+    auto uploadBlockFunc = [&](int64_t offset,
+                               int64_t length,
+                               int64_t chunkId,
+                               int64_t numChunks,
+                               const Azure::Core::Context& chunkContext) {
       if (chunkId == numChunks - 1)
       {
-        blockIds.resize(static_cast<size_t>(numChunks));
+        numBlocks = numChunks;
+      }
+      if (progress && progress->IsChunkDone(chunkId))
+      {
+        // The size of a compressed block isn't known before it's compressed again.
+        auto stagedBlock = stagedBlocks.find(getBlockId(chunkId));
+        if (stagedBlock != stagedBlocks.end()
+            && (options.TransferOptions.CompressContent || stagedBlock->second == length))
+        {
+          return;
+        }
+      }
+      StageBlockOptions chunkOptions;
+      auto stageBlockFromMemory = [&](const uint8_t* data, size_t size) {
+        _internal::PooledBuffer encodedBuffer;
+        encoder.Encode(data, size, encodedBuffer);
+        Azure::Core::IO::MemoryBodyStream contentStream(data, size);
+        StageBlock(getBlockId(chunkId), contentStream, chunkOptions, chunkContext);
+      };
+      if (fileMapping)
+      {
+        const uint8_t* data = fileMapping->GetData() + offset;
+        if (contentCrc64)
+        {
+          chunkOptions.TransactionalContentHash
+              = contentCrc64->Append(offset, data, static_cast<size_t>(length));
+        }
+        stageBlockFromMemory(data, static_cast<size_t>(length));
+      }
+      else if (options.TransferOptions.UseUnbufferedFileIo || contentCrc64 || encoder.IsEnabled())
+      {
+        // The block is read in memory to be hashed, compressed or encrypted before it's sent.
+        _internal::PooledBuffer buffer(m_bufferPool, static_cast<size_t>(length));
+        if (fileReader.Read(buffer.GetData(), buffer.GetSize(), offset) != buffer.GetSize())
+        {
+          throw std::runtime_error("Failed to read file.");
+        }
+        if (contentCrc64)
+        {
+          chunkOptions.TransactionalContentHash
+              = contentCrc64->Append(offset, buffer.GetData(), buffer.GetSize());
+        }
+        stageBlockFromMemory(buffer.GetData(), buffer.GetSize());
+      }
+      else
+      {
+        Azure::Core::IO::_internal::RandomAccessFileBodyStream contentStream(
+            fileReader.GetHandle(), offset, length);
+        StageBlock(getBlockId(chunkId), contentStream, chunkOptions, chunkContext);
+      }
+      if (progress)
+      {
+        progress->OnChunkDone(chunkId);
       }
+      progressReporter.OnBytesTransferred(length);
     };
 
+    int64_t minChunkSize = (fileReader.GetFileSize() + MaxBlockNumber - 1) / MaxBlockNumber;
+    minChunkSize = (minChunkSize + BlockGrainSize - 1) / BlockGrainSize * BlockGrainSize;
     int64_t chunkSize;
     if (options.TransferOptions.ChunkSize.HasValue())
     {
@@ -257,41 +671,406 @@ namespace Azure { namespace Storage { namespace Blobs {
     }
     else
     {
-      int64_t minChunkSize = (fileReader.GetFileSize() + MaxBlockNumber - 1) / MaxBlockNumber;
-      minChunkSize = (minChunkSize + BlockGrainSize - 1) / BlockGrainSize * BlockGrainSize;
       chunkSize = std::max(DefaultStageBlockSize, minChunkSize);
     }
+    chunkSize = encoder.AlignBlockSize(chunkSize);
     if (chunkSize > MaxStageBlockSize)
     {
       throw Azure::Core::RequestFailedException("Block size is too big.");
     }
 
-    _internal::ConcurrentTransfer(
-        0,
-        fileReader.GetFileSize(),
+    if (options.TransferOptions.Journal)
+    {
+      // The SAS token of the URL is left out of the journal. The time of the last write of the
+      // file makes an upload of a file changed since start over, even if its size is the same.
+      progress = std::make_unique<_internal::TransferProgress>(
+          options.TransferOptions.Journal,
+          "upload " + m_blobUrl.GetHost() + "/" + m_blobUrl.GetPath() + " "
+              + std::to_string(fileReader.GetFileSize()) + " "
+              + std::to_string(fileReader.GetLastWriteTime()) + " " + std::to_string(chunkSize)
+              + (options.TransferOptions.CompressContent ? " gzip" : ""));
+      if (progress->IsResumed())
+      {
+        // Uncommitted blocks may have been discarded since, so the blocks done are only skipped
+        // if they are still staged.
+        GetBlockListOptions getBlockListOptions;
+        getBlockListOptions.ListType = Models::BlockListType::Uncommitted;
+        for (const auto& block : GetBlockList(getBlockListOptions, context).Value.UncommittedBlocks)
+        {
+          stagedBlocks[block.Name] = block.Size;
+        }
+      }
+    }
+
+    if (options.TransferOptions.Strategy == TransferStrategy::Adaptive && !progress
+        && !encoder.IsEncrypting())
+    {
+      // Blocks never get smaller than minChunkSize, so there are no more than MaxBlockNumber.
+      _internal::AdaptiveChunkController controller(
+          chunkSize,
+          minChunkSize,
+          std::max(chunkSize, MaxAdaptiveStageBlockSize),
+          options.TransferOptions.Concurrency);
+      _internal::AdaptiveConcurrentTransfer(
+          0,
+          fileReader.GetFileSize(),
+          controller,
+          uploadBlockFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    else
+    {
+      _internal::ConcurrentTransfer(
+          0,
+          fileReader.GetFileSize(),
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadBlockFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+
+    CommitBlockListOptions commitBlockListOptions;
+    commitBlockListOptions.HttpHeaders = encoder.GetHttpHeaders();
+    commitBlockListOptions.Metadata = encoder.GetMetadata();
+    commitBlockListOptions.Tags = options.Tags;
+    commitBlockListOptions.AccessTier = options.AccessTier;
+    auto commitBlockListResponse
+        = CommitNumberedBlockList(numBlocks, commitBlockListOptions, context);
+    if (progress)
+    {
+      progress->OnTransferDone();
+    }
+    progressReporter.OnTransferDone();
+
+    Models::UploadBlockBlobFromResult result;
+    result.ETag = std::move(commitBlockListResponse.Value.ETag);
+    result.LastModified = std::move(commitBlockListResponse.Value.LastModified);
+    result.VersionId = std::move(commitBlockListResponse.Value.VersionId);
+    result.IsServerEncrypted = commitBlockListResponse.Value.IsServerEncrypted;
+    result.EncryptionKeySha256 = std::move(commitBlockListResponse.Value.EncryptionKeySha256);
+    result.EncryptionScope = std::move(commitBlockListResponse.Value.EncryptionScope);
+    if (contentCrc64)
+    {
+      result.ContentCrc64 = contentCrc64->Final();
+    }
+    return Azure::Response<Models::UploadBlockBlobFromResult>(
+        std::move(result), std::move(commitBlockListResponse.RawResponse));
+  }
+
+  Azure::Response<Models::UploadBlockBlobFromResult> BlockBlobClient::UploadFrom(
+      Azure::Core::IO::BodyStream& content,
+      const UploadBlockBlobFromOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    constexpr int64_t DefaultStageBlockSize = 4 * 1024 * 1024ULL;
+    constexpr int64_t MaxStageBlockSize = 4000 * 1024 * 1024ULL;
+    constexpr int64_t MaxBlockNumber = 50000;
+
+    BlockEncoder encoder(options, m_bufferPool, context);
+    _internal::TransferProgressReporter progressReporter(
+        m_transferCounters,
+        true,
+        options.TransferOptions.ProgressHandler,
+        options.TransferOptions.ProgressInterval);
+    if (options.TransferOptions.ComputeContentMd5 && encoder.IsEnabled())
+    {
+      throw Azure::Core::RequestFailedException(
+          "ComputeContentMd5 can't be used with CompressContent or ClientSideEncryption.");
+    }
+    const int64_t chunkSize = encoder.AlignBlockSize(
+        options.TransferOptions.ChunkSize.HasValue() ? options.TransferOptions.ChunkSize.Value()
+                                                     : DefaultStageBlockSize);
+    if (chunkSize > MaxStageBlockSize)
+    {
+      throw Azure::Core::RequestFailedException("Block size is too big.");
+    }
+
+    auto getBlockId = [](int64_t id) {
+      constexpr size_t BlockIdLength = 64;
+      std::string blockId = std::to_string(id);
+      blockId = std::string(BlockIdLength - blockId.length(), '0') + blockId;
+      return Azure::Core::Convert::Base64Encode(
+          std::vector<uint8_t>(blockId.begin(), blockId.end()));
+    };
+
+    std::unique_ptr<_internal::ChunkedCrc64> contentCrc64;
+    if (options.TransferOptions.ComputeContentCrc64)
+    {
+      contentCrc64 = std::make_unique<_internal::ChunkedCrc64>();
+    }
+
+    // Set when the content fits in the first block, which is uploaded with a single upload.
+    std::unique_ptr<Azure::Response<Models::UploadBlockBlobResult>> uploadResponse;
+
+    // The stream is read in order, so the MD5 of the whole content is computed as it's read.
+    std::unique_ptr<Azure::Core::Cryptography::Md5Hash> contentMd5;
+    Models::BlobHttpHeaders httpHeaders = encoder.GetHttpHeaders();
+    if (options.TransferOptions.ComputeContentMd5 && httpHeaders.ContentHash.Value.empty())
+    {
+      contentMd5 = std::make_unique<Azure::Core::Cryptography::Md5Hash>();
+    }
+
+    auto readFunc = [&](uint8_t* buffer, size_t size) {
+      const size_t readBytes = content.ReadToCount(buffer, size, context);
+      if (contentMd5)
+      {
+        contentMd5->Append(buffer, readBytes);
+      }
+      return readBytes;
+    };
+    auto finalizeContentMd5 = [&]() {
+      if (contentMd5)
+      {
+        httpHeaders.ContentHash.Algorithm = HashAlgorithm::Md5;
+        httpHeaders.ContentHash.Value = contentMd5->Final();
+        contentMd5.reset();
+      }
+    };
+
+    auto uploadFunc = [&](int64_t chunkId,
+                          int64_t numChunks,
+                          const uint8_t* data,
+                          size_t size,
+                          const Azure::Core::Context& chunkContext) {
+      if (chunkId >= MaxBlockNumber)
+      {
+        throw Azure::Core::RequestFailedException("The content has too many blocks.");
+      }
+      Azure::Nullable<ContentHash> transactionalContentHash;
+      if (contentCrc64)
+      {
+        transactionalContentHash = contentCrc64->Append(chunkId * chunkSize, data, size);
+      }
+      const auto contentSize = static_cast<int64_t>(size);
+      _internal::PooledBuffer encodedBuffer;
+      encoder.Encode(data, size, encodedBuffer);
+      Azure::Core::IO::MemoryBodyStream contentStream(data, size);
+      if (numChunks == 1)
+      {
+        // The whole stream has been read once the number of chunks is known.
+        finalizeContentMd5();
+        UploadBlockBlobOptions uploadBlockBlobOptions;
+        uploadBlockBlobOptions.HttpHeaders = httpHeaders;
+        uploadBlockBlobOptions.Metadata = encoder.GetMetadata();
+        uploadBlockBlobOptions.Tags = options.Tags;
+        uploadBlockBlobOptions.AccessTier = options.AccessTier;
+        uploadBlockBlobOptions.TransactionalContentHash = std::move(transactionalContentHash);
+        uploadResponse = std::make_unique<Azure::Response<Models::UploadBlockBlobResult>>(
+            Upload(contentStream, uploadBlockBlobOptions, chunkContext));
+        progressReporter.OnBytesTransferred(contentSize);
+        return;
+      }
+      StageBlockOptions chunkOptions;
+      chunkOptions.TransactionalContentHash = std::move(transactionalContentHash);
+      StageBlock(getBlockId(chunkId), contentStream, chunkOptions, chunkContext);
+      progressReporter.OnBytesTransferred(contentSize);
+    };
+
+    const int64_t numChunks = _internal::StreamingConcurrentTransfer(
         chunkSize,
         options.TransferOptions.Concurrency,
-        uploadBlockFunc);
+        readFunc,
+        uploadFunc,
+        context,
+        m_transferScheduler.get(),
+        m_bufferPool,
+        _internal::GetTransferThreadPool(m_bufferPool));
+
+    Azure::Nullable<ContentHash> contentCrc64Result;
+    if (contentCrc64)
+    {
+      contentCrc64Result = contentCrc64->Final();
+    }
+    if (uploadResponse)
+    {
+      progressReporter.OnTransferDone();
+      return FromUploadBlockBlobResult(std::move(*uploadResponse), std::move(contentCrc64Result));
+    }
+
+    // An empty stream commits an empty block list, which creates an empty blob.
+    finalizeContentMd5();
+    CommitBlockListOptions commitBlockListOptions;
+    commitBlockListOptions.HttpHeaders = std::move(httpHeaders);
+    commitBlockListOptions.Metadata = encoder.GetMetadata();
+    commitBlockListOptions.Tags = options.Tags;
+    commitBlockListOptions.AccessTier = options.AccessTier;
+    auto commitBlockListResponse
+        = CommitNumberedBlockList(numChunks, commitBlockListOptions, context);
+    progressReporter.OnTransferDone();
+
+    Models::UploadBlockBlobFromResult result;
+    result.ETag = std::move(commitBlockListResponse.Value.ETag);
+    result.LastModified = std::move(commitBlockListResponse.Value.LastModified);
+    result.VersionId = std::move(commitBlockListResponse.Value.VersionId);
+    result.IsServerEncrypted = commitBlockListResponse.Value.IsServerEncrypted;
+    result.EncryptionKeySha256 = std::move(commitBlockListResponse.Value.EncryptionKeySha256);
+    result.EncryptionScope = std::move(commitBlockListResponse.Value.EncryptionScope);
+    result.ContentCrc64 = std::move(contentCrc64Result);
+    return Azure::Response<Models::UploadBlockBlobFromResult>(
+        std::move(result), std::move(commitBlockListResponse.RawResponse));
+  }
+
+  Azure::Response<Models::UploadBlockBlobDeltaFromResult> BlockBlobClient::UploadDeltaFrom(
+      const std::string& fileName,
+      const UploadBlockBlobDeltaFromOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    constexpr int64_t MaxStageBlockSize = 4000 * 1024 * 1024ULL;
+    constexpr size_t MaxBlockNumber = 50000;
 
-    for (size_t i = 0; i < blockIds.size(); ++i)
+    if (options.TransferOptions.AverageBlockSize < 64
+        || options.TransferOptions.AverageBlockSize > MaxStageBlockSize / 4)
     {
-      blockIds[i] = getBlockId(static_cast<int64_t>(i));
+      throw Azure::Core::RequestFailedException("Average block size is out of range.");
     }
+
+    // The block ID is the hex SHA-256 of the block, 64 characters long like the block IDs of
+    // UploadFrom, as all the block IDs of a blob must have the same length.
+    auto getBlockId = [](const std::vector<uint8_t>& hash) {
+      const char* hexDigits = "0123456789abcdef";
+      std::string blockId;
+      blockId.reserve(hash.size() * 2);
+      for (const uint8_t byte : hash)
+      {
+        blockId += hexDigits[byte >> 4];
+        blockId += hexDigits[byte & 0x0f];
+      }
+      return Azure::Core::Convert::Base64Encode(
+          std::vector<uint8_t>(blockId.begin(), blockId.end()));
+    };
+
+    struct Block final
+    {
+      int64_t Offset;
+      int64_t Length;
+      std::string Id;
+    };
+    std::vector<Block> blocks;
+
+    // The file is read once to find and hash the blocks, then once more for the blocks staged.
+    _internal::FileReader fileReader(fileName);
+    const int64_t fileSize = fileReader.GetFileSize();
+    {
+      _internal::ContentDefinedChunker chunker(options.TransferOptions.AverageBlockSize);
+      Azure::Core::Cryptography::_internal::Sha256Hash blockHash;
+      _internal::PooledBuffer buffer(m_bufferPool, FileCrc64BufferSize);
+      int64_t blockOffset = 0;
+      for (int64_t offset = 0; offset < fileSize;)
+      {
+        const size_t bytesRead = fileReader.Read(
+            buffer.GetData(),
+            static_cast<size_t>(std::min<int64_t>(buffer.GetSize(), fileSize - offset)),
+            offset);
+        if (bytesRead == 0)
+        {
+          throw std::runtime_error("Failed to read file.");
+        }
+        for (size_t i = 0; i < bytesRead;)
+        {
+          bool blockEnd;
+          const size_t length = chunker.FindChunkEnd(buffer.GetData() + i, bytesRead - i, blockEnd);
+          blockHash.Append(buffer.GetData() + i, length);
+          i += length;
+          offset += length;
+          if (blockEnd || offset == fileSize)
+          {
+            blocks.push_back(
+                Block{blockOffset, offset - blockOffset, getBlockId(blockHash.Final())});
+            blockHash.Reset();
+            blockOffset = offset;
+          }
+        }
+      }
+    }
+    if (blocks.size() > MaxBlockNumber)
+    {
+      throw Azure::Core::RequestFailedException(
+          "The file is split into more than 50000 blocks. Use a larger average block size.");
+    }
+
+    // The commit is conditioned on the blob the committed blocks were listed from, so the blocks
+    // reused are still in the blob.
     CommitBlockListOptions commitBlockListOptions;
     commitBlockListOptions.HttpHeaders = options.HttpHeaders;
     commitBlockListOptions.Metadata = options.Metadata;
     commitBlockListOptions.Tags = options.Tags;
     commitBlockListOptions.AccessTier = options.AccessTier;
+    commitBlockListOptions.AccessConditions.LeaseId = options.AccessConditions.LeaseId;
+    std::set<std::string> committedBlockIds;
+    try
+    {
+      GetBlockListOptions getBlockListOptions;
+      getBlockListOptions.AccessConditions.LeaseId = options.AccessConditions.LeaseId;
+      auto blockList = GetBlockList(getBlockListOptions, context);
+      for (const auto& block : blockList.Value.CommittedBlocks)
+      {
+        committedBlockIds.insert(block.Name);
+      }
+      commitBlockListOptions.AccessConditions.IfMatch = blockList.Value.ETag;
+    }
+    catch (StorageException& e)
+    {
+      if (e.StatusCode != Core::Http::HttpStatusCode::NotFound || e.ErrorCode != "BlobNotFound")
+      {
+        throw;
+      }
+      commitBlockListOptions.AccessConditions.IfNoneMatch = Azure::ETag::Any();
+    }
+
+    // A block found several times in the file is only staged once.
+    std::vector<const Block*> blocksToStage;
+    std::set<std::string> blockIdsToStage;
+    int64_t uploadedSize = 0;
+    for (const auto& block : blocks)
+    {
+      if (committedBlockIds.count(block.Id) == 0 && blockIdsToStage.insert(block.Id).second)
+      {
+        blocksToStage.push_back(&block);
+        uploadedSize += block.Length;
+      }
+    }
+
+    // The blocks are transferred as the chunks of a range of block indices, so the scheduler bounds
+    // the blocks in flight, but not their bandwidth.
+    _internal::ConcurrentTransfer(
+        0,
+        static_cast<int64_t>(blocksToStage.size()),
+        1,
+        options.TransferOptions.Concurrency,
+        [&](int64_t index, int64_t, int64_t, int64_t, const Azure::Core::Context& chunkContext) {
+          const Block& block = *blocksToStage[static_cast<size_t>(index)];
+          Azure::Core::IO::_internal::RandomAccessFileBodyStream contentStream(
+              fileReader.GetHandle(), block.Offset, block.Length);
+          StageBlockOptions stageBlockOptions;
+          stageBlockOptions.AccessConditions.LeaseId = options.AccessConditions.LeaseId;
+          StageBlock(block.Id, contentStream, stageBlockOptions, chunkContext);
+        },
+        context,
+        m_transferScheduler.get(),
+        _internal::GetTransferThreadPool(m_bufferPool));
+
+    std::vector<std::string> blockIds;
+    blockIds.reserve(blocks.size());
+    for (const auto& block : blocks)
+    {
+      blockIds.push_back(block.Id);
+    }
     auto commitBlockListResponse = CommitBlockList(blockIds, commitBlockListOptions, context);
 
-    Models::UploadBlockBlobFromResult result;
-    result.ETag = commitBlockListResponse.Value.ETag;
-    result.LastModified = commitBlockListResponse.Value.LastModified;
-    result.VersionId = commitBlockListResponse.Value.VersionId;
+    Models::UploadBlockBlobDeltaFromResult result;
+    result.ETag = std::move(commitBlockListResponse.Value.ETag);
+    result.LastModified = std::move(commitBlockListResponse.Value.LastModified);
+    result.VersionId = std::move(commitBlockListResponse.Value.VersionId);
     result.IsServerEncrypted = commitBlockListResponse.Value.IsServerEncrypted;
-    result.EncryptionKeySha256 = commitBlockListResponse.Value.EncryptionKeySha256;
-    result.EncryptionScope = commitBlockListResponse.Value.EncryptionScope;
-    return Azure::Response<Models::UploadBlockBlobFromResult>(
+    result.EncryptionKeySha256 = std::move(commitBlockListResponse.Value.EncryptionKeySha256);
+    result.EncryptionScope = std::move(commitBlockListResponse.Value.EncryptionScope);
+    result.BlobSize = fileSize;
+    result.UploadedSize = uploadedSize;
+    return Azure::Response<Models::UploadBlockBlobDeltaFromResult>(
         std::move(result), std::move(commitBlockListResponse.RawResponse));
   }
 
@@ -301,21 +1080,65 @@ namespace Azure { namespace Storage { namespace Blobs {
       const StageBlockOptions& options,
       const Azure::Core::Context& context) const
   {
-    _detail::BlobRestClient::BlockBlob::StageBlockOptions protocolLayerOptions;
-    protocolLayerOptions.BlockId = blockId;
-    protocolLayerOptions.TransactionalContentHash = options.TransactionalContentHash;
-    protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
-    if (m_customerProvidedKey.HasValue())
+    auto protocolLayerOptions = GetStageBlockProtocolLayerOptions(blockId, options);
+    if (options.ComputeTransactionalContentHash.HasValue())
     {
-      protocolLayerOptions.EncryptionKey = m_customerProvidedKey.Value().Key;
-      protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.Value().KeyHash;
-      protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm;
+      if (options.TransactionalContentHash.HasValue())
+      {
+        throw Azure::Core::RequestFailedException(
+            "ComputeTransactionalContentHash can't be used with TransactionalContentHash.");
+      }
+      _internal::HashingBodyStream hashingStream(
+          content, options.ComputeTransactionalContentHash.Value());
+      auto response = _detail::BlobRestClient::BlockBlob::StageBlock(
+          *m_pipeline, m_blobUrl, hashingStream, protocolLayerOptions, context);
+      CheckTransactionalContentHash(
+          hashingStream.GetHash(), response.Value.TransactionalContentHash);
+      return response;
     }
-    protocolLayerOptions.EncryptionScope = m_encryptionScope;
     return _detail::BlobRestClient::BlockBlob::StageBlock(
         *m_pipeline, m_blobUrl, content, protocolLayerOptions, context);
   }
 
+  void BlockBlobClient::StageBlockAsync(
+      const std::string& blockId,
+      Azure::Core::IO::BodyStream& content,
+      const StageBlockOptions& options,
+      const Azure::Core::Context& context,
+      Azure::Core::ResponseCallback<Models::StageBlockResult> callback) const
+  {
+    auto protocolLayerOptions = GetStageBlockProtocolLayerOptions(blockId, options);
+    std::shared_ptr<_internal::HashingBodyStream> hashingStream;
+    if (options.ComputeTransactionalContentHash.HasValue())
+    {
+      if (options.TransactionalContentHash.HasValue())
+      {
+        throw Azure::Core::RequestFailedException(
+            "ComputeTransactionalContentHash can't be used with TransactionalContentHash.");
+      }
+      hashingStream = std::make_shared<_internal::HashingBodyStream>(
+          content, options.ComputeTransactionalContentHash.Value());
+    }
+    _internal::SendAsync<Models::StageBlockResult>(
+        m_pipeline,
+        _detail::BlobRestClient::BlockBlob::StageBlockCreateMessage(
+            m_blobUrl,
+            hashingStream ? *hashingStream : content,
+            protocolLayerOptions),
+        context,
+        [hashingStream, context](std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse) {
+          auto response = _detail::BlobRestClient::BlockBlob::StageBlockCreateResponse(
+              std::move(rawResponse), context);
+          if (hashingStream)
+          {
+            CheckTransactionalContentHash(
+                hashingStream->GetHash(), response.Value.TransactionalContentHash);
+          }
+          return response;
+        },
+        std::move(callback));
+  }
+
   Azure::Response<Models::StageBlockFromUriResult> BlockBlobClient::StageBlockFromUri(
       const std::string& blockId,
       const std::string& sourceUri,
@@ -343,10 +1166,119 @@ namespace Azure { namespace Storage { namespace Blobs {
         *m_pipeline, m_blobUrl, protocolLayerOptions, context);
   }
 
+  Azure::Response<Models::CommitBlockListResult> BlockBlobClient::CopyFromUriParallel(
+      const std::string& sourceUri,
+      const CopyBlockBlobFromUriParallelOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    constexpr int64_t DefaultStageBlockSize = 8 * 1024 * 1024ULL;
+    constexpr int64_t MaxStageBlockSize = 4000 * 1024 * 1024ULL;
+    constexpr int64_t MaxBlockNumber = 50000;
+    constexpr int64_t BlockGrainSize = 1 * 1024 * 1024;
+
+    // The source is authorized by its URI, not by the credential of this client. Its properties
+    // are got with the transport, retry and telemetry options of this client all the same, the
+    // clients created from a pipeline only have the default ones.
+    const auto sourcePipeline
+        = m_sourcePipeline ? m_sourcePipeline : BlockBlobClient(sourceUri).m_sourcePipeline;
+    const auto sourcePropertiesResponse = _detail::BlobRestClient::Blob::GetProperties(
+        *sourcePipeline,
+        Azure::Core::Url(sourceUri),
+        _detail::BlobRestClient::Blob::GetBlobPropertiesOptions(),
+        context);
+    const auto& sourceProperties = sourcePropertiesResponse.Value;
+    const int64_t sourceLength = sourceProperties.BlobSize;
+
+    int64_t minChunkSize = (sourceLength + MaxBlockNumber - 1) / MaxBlockNumber;
+    minChunkSize = (minChunkSize + BlockGrainSize - 1) / BlockGrainSize * BlockGrainSize;
+    int64_t chunkSize;
+    if (options.TransferOptions.ChunkSize.HasValue())
+    {
+      chunkSize = options.TransferOptions.ChunkSize.Value();
+      if (chunkSize <= 0)
+      {
+        throw Azure::Core::RequestFailedException("Block size must be positive.");
+      }
+      if ((sourceLength + chunkSize - 1) / chunkSize > MaxBlockNumber)
+      {
+        throw Azure::Core::RequestFailedException(
+            "Block size is too small, the source would need more than 50000 blocks.");
+      }
+    }
+    else
+    {
+      chunkSize = std::max(DefaultStageBlockSize, minChunkSize);
+    }
+    if (chunkSize > MaxStageBlockSize)
+    {
+      throw Azure::Core::RequestFailedException("Block size is too big.");
+    }
+
+    auto getBlockId = [](int64_t id) {
+      constexpr size_t BlockIdLength = 64;
+      std::string blockId = std::to_string(id);
+      blockId = std::string(BlockIdLength - blockId.length(), '0') + blockId;
+      return Azure::Core::Convert::Base64Encode(
+          std::vector<uint8_t>(blockId.begin(), blockId.end()));
+    };
+
+    auto stageBlockFunc = [&](int64_t offset,
+                              int64_t length,
+                              int64_t chunkId,
+                              int64_t,
+                              const Azure::Core::Context& chunkContext) {
+      StageBlockFromUriOptions chunkOptions;
+      chunkOptions.SourceRange = Core::Http::HttpRange();
+      chunkOptions.SourceRange.Value().Offset = offset;
+      chunkOptions.SourceRange.Value().Length = length;
+      // The blocks fail rather than mixing two versions of the source.
+      chunkOptions.SourceAccessConditions.IfMatch = sourceProperties.ETag;
+      chunkOptions.AccessConditions.LeaseId = options.AccessConditions.LeaseId;
+      StageBlockFromUri(getBlockId(chunkId), sourceUri, chunkOptions, chunkContext);
+    };
+
+    _internal::ConcurrentTransfer(
+        0,
+        sourceLength,
+        chunkSize,
+        options.TransferOptions.Concurrency,
+        stageBlockFunc,
+        context,
+        m_transferScheduler.get(),
+        _internal::GetTransferThreadPool(m_bufferPool));
+
+    // An empty source commits an empty block list, which creates an empty blob.
+    const int64_t numChunks = (sourceLength + chunkSize - 1) / chunkSize;
+    CommitBlockListOptions commitBlockListOptions;
+    commitBlockListOptions.HttpHeaders = sourceProperties.HttpHeaders;
+    commitBlockListOptions.Metadata = sourceProperties.Metadata;
+    commitBlockListOptions.Tags = options.Tags;
+    commitBlockListOptions.AccessTier = options.AccessTier;
+    commitBlockListOptions.AccessConditions = options.AccessConditions;
+    return CommitNumberedBlockList(numChunks, commitBlockListOptions, context);
+  }
+
   Azure::Response<Models::CommitBlockListResult> BlockBlobClient::CommitBlockList(
       const std::vector<std::string>& blockIds,
       const CommitBlockListOptions& options,
       const Azure::Core::Context& context) const
+  {
+    return CommitBlockList(blockIds, 0, options, context);
+  }
+
+  Azure::Response<Models::CommitBlockListResult> BlockBlobClient::CommitNumberedBlockList(
+      int64_t numBlocks,
+      const CommitBlockListOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    return CommitBlockList(std::vector<std::string>(), numBlocks, options, context);
+  }
+
+  Azure::Response<Models::CommitBlockListResult> BlockBlobClient::CommitBlockList(
+      const std::vector<std::string>& blockIds,
+      int64_t numNumberedBlocks,
+      const CommitBlockListOptions& options,
+      const Azure::Core::Context& context) const
   {
     _detail::BlobRestClient::BlockBlob::CommitBlockListOptions protocolLayerOptions;
     protocolLayerOptions.BlockList.reserve(blockIds.size());
@@ -354,6 +1286,7 @@ namespace Azure { namespace Storage { namespace Blobs {
     {
       protocolLayerOptions.BlockList.emplace_back(std::make_pair(Models::BlockType::Latest, id));
     }
+    protocolLayerOptions.NumberedBlockCount = numNumberedBlocks;
     protocolLayerOptions.HttpHeaders = options.HttpHeaders;
     protocolLayerOptions.Metadata = options.Metadata;
     protocolLayerOptions.Tags = options.Tags;
@@ -371,8 +1304,13 @@ namespace Azure { namespace Storage { namespace Blobs {
       protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm;
     }
     protocolLayerOptions.EncryptionScope = m_encryptionScope;
-    return _detail::BlobRestClient::BlockBlob::CommitBlockList(
+    auto response = _detail::BlobRestClient::BlockBlob::CommitBlockList(
         *m_pipeline, m_blobUrl, protocolLayerOptions, context);
+    if (m_propertiesCache)
+    {
+      m_propertiesCache->Remove(m_blobUrl.GetAbsoluteUrl());
+    }
+    return response;
   }
 
   Azure::Response<Models::GetBlockListResult> BlockBlobClient::GetBlockList(
@@ -387,4 +1325,65 @@ namespace Azure { namespace Storage { namespace Blobs {
         *m_pipeline, m_blobUrl, protocolLayerOptions, _internal::WithReplicaStatus(context));
   }
 
+  Azure::Response<Models::GetBlockListStreamingResult> BlockBlobClient::GetBlockListStreaming(
+      const std::function<void(const Models::CompactBlobBlock* blocks, size_t count)>& blocksFunc,
+      const GetBlockListOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    _detail::BlobRestClient::BlockBlob::GetBlockListOptions protocolLayerOptions;
+    protocolLayerOptions.ListType = options.ListType;
+    protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
+    protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
+    return _detail::BlobRestClient::BlockBlob::GetBlockListStreaming(
+        *m_pipeline,
+        m_blobUrl,
+        protocolLayerOptions,
+        blocksFunc,
+        _internal::WithReplicaStatus(context));
+  }
+
+  _detail::BlobRestClient::BlockBlob::UploadBlockBlobOptions
+  BlockBlobClient::GetUploadProtocolLayerOptions(const UploadBlockBlobOptions& options) const
+  {
+    _detail::BlobRestClient::BlockBlob::UploadBlockBlobOptions protocolLayerOptions;
+    protocolLayerOptions.TransactionalContentHash = options.TransactionalContentHash;
+    protocolLayerOptions.HttpHeaders = options.HttpHeaders;
+    protocolLayerOptions.Metadata = options.Metadata;
+    protocolLayerOptions.Tags = options.Tags;
+    protocolLayerOptions.AccessTier = options.AccessTier;
+    protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
+    protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
+    protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
+    protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
+    protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
+    protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
+    if (m_customerProvidedKey.HasValue())
+    {
+      protocolLayerOptions.EncryptionKey = m_customerProvidedKey.Value().Key;
+      protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.Value().KeyHash;
+      protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm;
+    }
+    protocolLayerOptions.EncryptionScope = m_encryptionScope;
+    return protocolLayerOptions;
+  }
+
+  _detail::BlobRestClient::BlockBlob::StageBlockOptions
+  BlockBlobClient::GetStageBlockProtocolLayerOptions(
+      const std::string& blockId,
+      const StageBlockOptions& options) const
+  {
+    _detail::BlobRestClient::BlockBlob::StageBlockOptions protocolLayerOptions;
+    protocolLayerOptions.BlockId = blockId;
+    protocolLayerOptions.TransactionalContentHash = options.TransactionalContentHash;
+    protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
+    if (m_customerProvidedKey.HasValue())
+    {
+      protocolLayerOptions.EncryptionKey = m_customerProvidedKey.Value().Key;
+      protocolLayerOptions.EncryptionKeySha256 = m_customerProvidedKey.Value().KeyHash;
+      protocolLayerOptions.EncryptionAlgorithm = m_customerProvidedKey.Value().Algorithm;
+    }
+    protocolLayerOptions.EncryptionScope = m_encryptionScope;
+    return protocolLayerOptions;
+  }
+
 }}} // namespace Azure::Storage::Blobs
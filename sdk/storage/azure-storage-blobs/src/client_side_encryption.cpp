@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "private/client_side_encryption.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <azure/core/base64.hpp>
+#include <azure/core/internal/json/json.hpp>
+#include <azure/storage/common/crypt.hpp>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace _detail {
+
+  namespace {
+    constexpr int64_t DefaultSegmentSize = 4 * 1024 * 1024;
+    constexpr const char* EncryptionProtocol = "2.0";
+    constexpr const char* ContentEncryptionAlgorithm = "AES_GCM_256";
+    constexpr int64_t SegmentOverhead
+        = static_cast<int64_t>(_internal::AesGcmNonceSize + _internal::AesGcmTagSize);
+  } // namespace
+
+  using Azure::Core::Json::_internal::json;
+
+  SegmentedContentCipher::SegmentedContentCipher()
+      : m_contentKey(_internal::AesGcmKeySize), m_segmentSize(DefaultSegmentSize)
+  {
+    _internal::GenerateRandomBytes(m_contentKey.data(), m_contentKey.size());
+  }
+
+  SegmentedContentCipher SegmentedContentCipher::FromEncryptionData(
+      const std::string& encryptionData,
+      int64_t encryptedSize,
+      KeyEncryptionKey& keyEncryptionKey,
+      const Azure::Core::Context& context)
+  {
+    std::string algorithm;
+    std::vector<uint8_t> encryptedKey;
+    int64_t segmentSize = 0;
+    try
+    {
+      const auto encryptionDataJson = json::parse(encryptionData);
+      const auto& agent = encryptionDataJson.at("EncryptionAgent");
+      if (agent.at("Protocol").get<std::string>() != EncryptionProtocol
+          || agent.at("EncryptionAlgorithm").get<std::string>() != ContentEncryptionAlgorithm
+          || encryptionDataJson.at("EncryptedRegionInfo").at("NonceLength").get<int64_t>()
+              != static_cast<int64_t>(_internal::AesGcmNonceSize))
+      {
+        throw std::runtime_error("The blob is encrypted with an unsupported algorithm.");
+      }
+      segmentSize = encryptionDataJson.at("EncryptedRegionInfo").at("DataLength").get<int64_t>();
+      const auto& wrappedContentKey = encryptionDataJson.at("WrappedContentKey");
+      algorithm = wrappedContentKey.at("Algorithm").get<std::string>();
+      encryptedKey = Azure::Core::Convert::Base64Decode(
+          wrappedContentKey.at("EncryptedKey").get<std::string>());
+    }
+    catch (json::exception const&)
+    {
+      throw std::runtime_error("The encryption data of the blob is invalid.");
+    }
+    if (segmentSize <= 0 || encryptedSize < 0)
+    {
+      throw std::runtime_error("The encryption data of the blob is invalid.");
+    }
+    // A segment larger than the content is the whole content, so the segment size from the
+    // metadata never sizes a buffer past the blob or overflows the chunk arithmetic.
+    segmentSize = std::min(segmentSize, std::max<int64_t>(encryptedSize - SegmentOverhead, 1));
+    auto contentKey = keyEncryptionKey.UnwrapKey(algorithm, encryptedKey, context);
+    if (contentKey.size() != _internal::AesGcmKeySize)
+    {
+      throw std::runtime_error("The content key of the blob is invalid.");
+    }
+    return SegmentedContentCipher(std::move(contentKey), segmentSize);
+  }
+
+  std::string SegmentedContentCipher::GetEncryptionData(
+      const ClientSideEncryptionOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    json encryptionData;
+    encryptionData["EncryptionAgent"]["Protocol"] = EncryptionProtocol;
+    encryptionData["EncryptionAgent"]["EncryptionAlgorithm"] = ContentEncryptionAlgorithm;
+    encryptionData["EncryptedRegionInfo"]["DataLength"] = m_segmentSize;
+    encryptionData["EncryptedRegionInfo"]["NonceLength"] = _internal::AesGcmNonceSize;
+    encryptionData["WrappedContentKey"]["KeyId"] = options.KeyEncryptionKey->GetKeyId();
+    encryptionData["WrappedContentKey"]["Algorithm"] = options.KeyWrapAlgorithm;
+    encryptionData["WrappedContentKey"]["EncryptedKey"] = Azure::Core::Convert::Base64Encode(
+        options.KeyEncryptionKey->WrapKey(options.KeyWrapAlgorithm, m_contentKey, context));
+    return encryptionData.dump();
+  }
+
+  int64_t SegmentedContentCipher::GetEncryptedSegmentSize() const
+  {
+    return m_segmentSize + SegmentOverhead;
+  }
+
+  int64_t SegmentedContentCipher::GetEncryptedSize(int64_t size) const
+  {
+    const int64_t numSegments = (size + m_segmentSize - 1) / m_segmentSize;
+    return size + numSegments * SegmentOverhead;
+  }
+
+  int64_t SegmentedContentCipher::GetDecryptedSize(int64_t encryptedSize) const
+  {
+    const int64_t numSegments
+        = (encryptedSize + GetEncryptedSegmentSize() - 1) / GetEncryptedSegmentSize();
+    const int64_t lastSegmentSize = encryptedSize - (numSegments - 1) * GetEncryptedSegmentSize();
+    if (numSegments > 0 && lastSegmentSize <= SegmentOverhead)
+    {
+      throw std::runtime_error("The size of the encrypted content is invalid.");
+    }
+    return encryptedSize - numSegments * SegmentOverhead;
+  }
+
+  void SegmentedContentCipher::Encrypt(const uint8_t* data, size_t size, uint8_t* output) const
+  {
+    for (size_t offset = 0; offset < size; offset += static_cast<size_t>(m_segmentSize))
+    {
+      const size_t segmentSize = std::min(size - offset, static_cast<size_t>(m_segmentSize));
+      // A random nonce per segment, the content key is never used by another blob.
+      _internal::GenerateRandomBytes(output, _internal::AesGcmNonceSize);
+      uint8_t* encrypted = output + _internal::AesGcmNonceSize;
+      _internal::Aes256GcmEncrypt(
+          m_contentKey, output, data + offset, segmentSize, encrypted, encrypted + segmentSize);
+      output += segmentSize + SegmentOverhead;
+    }
+  }
+
+  void SegmentedContentCipher::Decrypt(const uint8_t* data, size_t size, uint8_t* output) const
+  {
+    GetDecryptedSize(static_cast<int64_t>(size));
+    const size_t encryptedSegmentSize = static_cast<size_t>(GetEncryptedSegmentSize());
+    for (size_t offset = 0; offset < size; offset += encryptedSegmentSize)
+    {
+      const size_t segmentSize
+          = std::min(size - offset, encryptedSegmentSize) - static_cast<size_t>(SegmentOverhead);
+      const uint8_t* nonce = data + offset;
+      const uint8_t* encrypted = nonce + _internal::AesGcmNonceSize;
+      _internal::Aes256GcmDecrypt(
+          m_contentKey, nonce, encrypted, segmentSize, encrypted + segmentSize, output);
+      output += segmentSize;
+    }
+  }
+
+}}}} // namespace Azure::Storage::Blobs::_detail
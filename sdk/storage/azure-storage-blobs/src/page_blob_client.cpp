@@ -3,14 +3,216 @@
 
 #include "azure/storage/blobs/page_blob_client.hpp"
 
+#include <azure/storage/common/buffer_pool.hpp>
 #include <azure/storage/common/internal/concurrent_transfer.hpp>
 #include <azure/storage/common/internal/constants.hpp>
 #include <azure/storage/common/internal/file_io.hpp>
 #include <azure/storage/common/internal/storage_switch_to_secondary_policy.hpp>
 #include <azure/storage/common/storage_common.hpp>
 
+#include <atomic>
+#include <cstring>
+#include <functional>
+
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace {
+    // The size of the buffer a chunk is written to the file through.
+    constexpr int64_t ChunkBufferSize = 4 * 1024 * 1024;
+
+    // Appends the ranges split into chunks of at most chunkSize bytes, returns their total length.
+    int64_t SplitIntoChunks(
+        const std::vector<Core::Http::HttpRange>& ranges,
+        int64_t chunkSize,
+        std::vector<Core::Http::HttpRange>& chunks)
+    {
+      chunkSize = std::max<int64_t>(chunkSize, 1);
+      int64_t totalLength = 0;
+      for (const auto& range : ranges)
+      {
+        const int64_t rangeEnd = range.Offset + range.Length.Value();
+        for (int64_t offset = range.Offset; offset < rangeEnd; offset += chunkSize)
+        {
+          Core::Http::HttpRange chunk;
+          chunk.Offset = offset;
+          chunk.Length = std::min(chunkSize, rangeEnd - offset);
+          chunks.push_back(chunk);
+        }
+        totalLength += range.Length.Value();
+      }
+      return totalLength;
+    }
+
+    // Downloads the chunks in parallel, each to its offset in the file. Each unit of the
+    // transfer is one chunk, the chunks of a range may differ in size.
+    void DownloadChunksTo(
+        const PageBlobClient& client,
+        _internal::FileWriter& fileWriter,
+        const std::vector<Core::Http::HttpRange>& chunks,
+        const Azure::ETag& eTag,
+        const Azure::Nullable<std::string>& leaseId,
+        int32_t concurrency,
+        const std::shared_ptr<BufferPool>& bufferPool,
+        TransferScheduler* scheduler,
+        const Azure::Core::Context& context)
+    {
+      auto downloadChunkFunc = [&](int64_t chunkId,
+                                   int64_t,
+                                   int64_t,
+                                   int64_t,
+                                   const Azure::Core::Context& chunkContext) {
+        const auto& chunk = chunks[static_cast<size_t>(chunkId)];
+        DownloadBlobOptions chunkOptions;
+        chunkOptions.Range = chunk;
+        chunkOptions.AccessConditions.LeaseId = leaseId;
+        chunkOptions.AccessConditions.IfMatch = eTag;
+        auto download = client.Download(chunkOptions, chunkContext);
+
+        _internal::PooledBuffer buffer(
+            bufferPool, static_cast<size_t>(std::min(chunk.Length.Value(), ChunkBufferSize)));
+        int64_t offset = chunk.Offset;
+        int64_t length = chunk.Length.Value();
+        while (length > 0)
+        {
+          const size_t readSize = static_cast<size_t>(
+              std::min<int64_t>(static_cast<int64_t>(buffer.GetSize()), length));
+          if (download.Value.BodyStream->ReadToCount(buffer.GetData(), readSize, chunkContext)
+              != readSize)
+          {
+            throw Azure::Core::RequestFailedException("Error when reading body stream.");
+          }
+          fileWriter.Write(buffer.GetData(), readSize, offset);
+          offset += readSize;
+          length -= readSize;
+        }
+      };
+
+      if (!chunks.empty())
+      {
+        _internal::ConcurrentTransfer(
+            0,
+            static_cast<int64_t>(chunks.size()),
+            1,
+            concurrency,
+            downloadChunkFunc,
+            context,
+            scheduler,
+            _internal::GetTransferThreadPool(bufferPool));
+      }
+    }
+
+    // The size of a page of a page blob.
+    constexpr int64_t PageSize = 512;
+    // The maximum number of bytes of an Upload Pages request.
+    constexpr int64_t MaxUploadPagesSize = 4 * 1024 * 1024;
+
+    int64_t RoundUpToPageSize(int64_t size) { return (size + PageSize - 1) / PageSize * PageSize; }
+
+    // Uploads the pages of a chunk that aren't all zeros, each run of them in a single request.
+    // Returns the number of bytes uploaded.
+    int64_t UploadNonZeroPages(
+        const PageBlobClient& client,
+        const uint8_t* data,
+        int64_t offset,
+        int64_t length,
+        const Azure::Nullable<std::string>& leaseId,
+        const Azure::Core::Context& context)
+    {
+      static_assert(
+          static_cast<int64_t>(_internal::ZeroCheckBlockSize) == PageSize,
+          "Zeros are checked page by page.");
+      std::vector<_internal::FileRange> runs;
+      _internal::FindNonZeroRanges(data, static_cast<size_t>(length), offset, runs);
+      int64_t uploadedSize = 0;
+      for (const auto& run : runs)
+      {
+        Azure::Core::IO::MemoryBodyStream content(
+            data + (run.Offset - offset), static_cast<size_t>(run.Length));
+        UploadPagesOptions uploadOptions;
+        uploadOptions.AccessConditions.LeaseId = leaseId;
+        client.UploadPages(run.Offset, content, uploadOptions, context);
+        uploadedSize += run.Length;
+      }
+      return uploadedSize;
+    }
+
+    // Creates the page blob, then gets the content in chunks of whole pages in parallel and
+    // uploads the pages that aren't all zeros. getChunk returns the content of a chunk padded with
+    // zeros to whole pages, possibly copied to the buffer it's given.
+    Azure::Response<Models::UploadPageBlobFromResult> UploadNonZeroPagesFrom(
+        const PageBlobClient& client,
+        int64_t contentSize,
+        const std::function<const uint8_t*(
+            int64_t offset,
+            int64_t length,
+            _internal::PooledBuffer& buffer)>& getChunk,
+        const UploadPageBlobFromOptions& options,
+        const std::shared_ptr<BufferPool>& bufferPool,
+        TransferScheduler* scheduler,
+        const Azure::Core::Context& context)
+    {
+      Models::UploadPageBlobFromResult ret;
+      ret.BlobSize = RoundUpToPageSize(contentSize);
+
+      CreatePageBlobOptions createOptions;
+      createOptions.HttpHeaders = options.HttpHeaders;
+      createOptions.Metadata = options.Metadata;
+      createOptions.Tags = options.Tags;
+      createOptions.AccessTier = options.AccessTier;
+      createOptions.AccessConditions = options.AccessConditions;
+      auto createResult = client.Create(ret.BlobSize, createOptions, context);
+      ret.ETag = std::move(createResult.Value.ETag);
+      ret.LastModified = std::move(createResult.Value.LastModified);
+      auto rawResponse = std::move(createResult.RawResponse);
+
+      const int64_t chunkSize = std::min(
+          std::max(options.TransferOptions.ChunkSize / PageSize * PageSize, PageSize),
+          MaxUploadPagesSize);
+      std::atomic<int64_t> uploadedSize{0};
+      auto uploadChunkFunc = [&](int64_t offset,
+                                 int64_t length,
+                                 int64_t,
+                                 int64_t,
+                                 const Azure::Core::Context& chunkContext) {
+        _internal::PooledBuffer buffer;
+        const uint8_t* data = getChunk(offset, length, buffer);
+        uploadedSize += UploadNonZeroPages(
+            client,
+            data,
+            offset,
+            RoundUpToPageSize(length),
+            options.AccessConditions.LeaseId,
+            chunkContext);
+      };
+      if (contentSize > 0)
+      {
+        _internal::ConcurrentTransfer(
+            0,
+            contentSize,
+            chunkSize,
+            options.TransferOptions.Concurrency,
+            uploadChunkFunc,
+            context,
+            scheduler,
+            _internal::GetTransferThreadPool(bufferPool));
+      }
+      ret.UploadedSize = uploadedSize;
+
+      // The pages uploaded in parallel changed the blob in no particular order.
+      if (ret.UploadedSize > 0)
+      {
+        GetBlobPropertiesOptions getPropertiesOptions;
+        getPropertiesOptions.AccessConditions.LeaseId = options.AccessConditions.LeaseId;
+        auto properties = client.GetProperties(getPropertiesOptions, context);
+        ret.ETag = std::move(properties.Value.ETag);
+        ret.LastModified = std::move(properties.Value.LastModified);
+        rawResponse = std::move(properties.RawResponse);
+      }
+      return Azure::Response<Models::UploadPageBlobFromResult>(
+          std::move(ret), std::move(rawResponse));
+    }
+  } // namespace
+
   PageBlobClient PageBlobClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& blobContainerName,
@@ -268,6 +470,27 @@ namespace Azure { namespace Storage { namespace Blobs {
     return pagedResponse;
   }
 
+  Azure::Response<Models::GetPageRangesStreamingResult> PageBlobClient::GetPageRangesStreaming(
+      const std::function<void(const Models::CompactPageRange* ranges, size_t count)>& rangesFunc,
+      const GetPageRangesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    _detail::BlobRestClient::PageBlob::GetPageBlobPageRangesOptions protocolLayerOptions;
+    protocolLayerOptions.Range = options.Range;
+    protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
+    protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
+    protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
+    protocolLayerOptions.IfMatch = options.AccessConditions.IfMatch;
+    protocolLayerOptions.IfNoneMatch = options.AccessConditions.IfNoneMatch;
+    protocolLayerOptions.IfTags = options.AccessConditions.TagConditions;
+    return _detail::BlobRestClient::PageBlob::GetPageRangesStreaming(
+        *m_pipeline,
+        m_blobUrl,
+        protocolLayerOptions,
+        rangesFunc,
+        _internal::WithReplicaStatus(context));
+  }
+
   GetPageRangesDiffPagedResponse PageBlobClient::GetPageRangesDiff(
       const std::string& previousSnapshot,
       const GetPageRangesOptions& options,
@@ -357,4 +580,162 @@ namespace Azure { namespace Storage { namespace Blobs {
     return res;
   }
 
+  Azure::Response<Models::DownloadSparseBlobToResult> PageBlobClient::DownloadSparseTo(
+      const std::string& fileName,
+      const DownloadSparseBlobToOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    GetPageRangesOptions getPageRangesOptions;
+    getPageRangesOptions.AccessConditions = options.AccessConditions;
+    auto pageRanges = GetPageRanges(getPageRangesOptions, context);
+
+    Models::DownloadSparseBlobToResult ret;
+    ret.ETag = pageRanges.ETag;
+    ret.LastModified = pageRanges.LastModified;
+    ret.BlobSize = pageRanges.BlobSize;
+    auto rawResponse = std::move(pageRanges.RawResponse);
+
+    std::vector<Core::Http::HttpRange> chunks;
+    for (; pageRanges.HasPage(); pageRanges.MoveToNextPage(context))
+    {
+      ret.DownloadedSize
+          += SplitIntoChunks(pageRanges.PageRanges, options.TransferOptions.ChunkSize, chunks);
+    }
+
+    _internal::FileWriter fileWriter(fileName);
+    // The clear ranges are never written, so they remain holes of the file.
+    fileWriter.SetSparseSize(ret.BlobSize);
+
+    DownloadChunksTo(
+        *this,
+        fileWriter,
+        chunks,
+        ret.ETag,
+        options.AccessConditions.LeaseId,
+        options.TransferOptions.Concurrency,
+        m_bufferPool,
+        m_transferScheduler.get(),
+        context);
+
+    return Azure::Response<Models::DownloadSparseBlobToResult>(
+        std::move(ret), std::move(rawResponse));
+  }
+
+  Azure::Response<Models::SyncPageBlobFromSnapshotDiffResult> PageBlobClient::SyncFromSnapshotDiff(
+      const std::string& fileName,
+      const std::string& previousSnapshot,
+      const std::string& snapshot,
+      const SyncPageBlobFromSnapshotDiffOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    const PageBlobClient snapshotClient = WithSnapshot(snapshot);
+
+    GetPageRangesOptions getPageRangesOptions;
+    getPageRangesOptions.AccessConditions = options.AccessConditions;
+    auto pageRanges
+        = snapshotClient.GetPageRangesDiff(previousSnapshot, getPageRangesOptions, context);
+
+    Models::SyncPageBlobFromSnapshotDiffResult ret;
+    ret.ETag = pageRanges.ETag;
+    ret.LastModified = pageRanges.LastModified;
+    ret.BlobSize = pageRanges.BlobSize;
+    auto rawResponse = std::move(pageRanges.RawResponse);
+
+    std::vector<Core::Http::HttpRange> chunks;
+    std::vector<Core::Http::HttpRange> clearRanges;
+    for (; pageRanges.HasPage(); pageRanges.MoveToNextPage(context))
+    {
+      ret.DownloadedSize
+          += SplitIntoChunks(pageRanges.PageRanges, options.TransferOptions.ChunkSize, chunks);
+      clearRanges.insert(
+          clearRanges.end(), pageRanges.ClearRanges.begin(), pageRanges.ClearRanges.end());
+    }
+
+    _internal::FileWriter fileWriter(fileName, false, false);
+    // The blob may have been resized between the snapshots.
+    fileWriter.SetSparseSize(ret.BlobSize);
+    for (const auto& range : clearRanges)
+    {
+      const int64_t length = std::min(range.Length.Value(), ret.BlobSize - range.Offset);
+      if (length > 0)
+      {
+        fileWriter.Zero(range.Offset, length);
+        ret.ClearedSize += length;
+      }
+    }
+
+    DownloadChunksTo(
+        snapshotClient,
+        fileWriter,
+        chunks,
+        ret.ETag,
+        options.AccessConditions.LeaseId,
+        options.TransferOptions.Concurrency,
+        m_bufferPool,
+        m_transferScheduler.get(),
+        context);
+
+    return Azure::Response<Models::SyncPageBlobFromSnapshotDiffResult>(
+        std::move(ret), std::move(rawResponse));
+  }
+
+  Azure::Response<Models::UploadPageBlobFromResult> PageBlobClient::UploadFrom(
+      const uint8_t* buffer,
+      size_t bufferSize,
+      const UploadPageBlobFromOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    auto getChunk = [this, buffer, bufferSize](
+                        int64_t offset, int64_t length, _internal::PooledBuffer& chunkBuffer) {
+      const int64_t pagesLength = RoundUpToPageSize(length);
+      if (offset + pagesLength <= static_cast<int64_t>(bufferSize))
+      {
+        return buffer + offset;
+      }
+      // The last page is padded.
+      chunkBuffer = _internal::PooledBuffer(m_bufferPool, static_cast<size_t>(pagesLength));
+      std::memcpy(chunkBuffer.GetData(), buffer + offset, static_cast<size_t>(length));
+      std::memset(
+          chunkBuffer.GetData() + length, 0, static_cast<size_t>(pagesLength - length));
+      return static_cast<const uint8_t*>(chunkBuffer.GetData());
+    };
+    return UploadNonZeroPagesFrom(
+        *this,
+        static_cast<int64_t>(bufferSize),
+        getChunk,
+        options,
+        m_bufferPool,
+        m_transferScheduler.get(),
+        context);
+  }
+
+  Azure::Response<Models::UploadPageBlobFromResult> PageBlobClient::UploadFrom(
+      const std::string& fileName,
+      const UploadPageBlobFromOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    _internal::FileReader fileReader(fileName);
+    auto getChunk = [this, &fileReader](
+                        int64_t offset, int64_t length, _internal::PooledBuffer& chunkBuffer) {
+      const int64_t pagesLength = RoundUpToPageSize(length);
+      chunkBuffer = _internal::PooledBuffer(m_bufferPool, static_cast<size_t>(pagesLength));
+      if (fileReader.Read(chunkBuffer.GetData(), static_cast<size_t>(length), offset)
+          != static_cast<size_t>(length))
+      {
+        throw std::runtime_error("Failed to read file.");
+      }
+      std::memset(
+          chunkBuffer.GetData() + length, 0, static_cast<size_t>(pagesLength - length));
+      return static_cast<const uint8_t*>(chunkBuffer.GetData());
+    };
+    return UploadNonZeroPagesFrom(
+        *this,
+        fileReader.GetFileSize(),
+        getChunk,
+        options,
+        m_bufferPool,
+        m_transferScheduler.get(),
+        context);
+  }
+
 }}} // namespace Azure::Storage::Blobs
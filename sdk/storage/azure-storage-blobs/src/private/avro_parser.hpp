@@ -0,0 +1,138 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <azure/core/context.hpp>
+#include <azure/core/io/body_stream.hpp>
+
+#include "azure/storage/blobs/blob_options.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs { namespace _detail {
+
+  enum class AvroDatumType
+  {
+    Null,
+    Bool,
+    Int,
+    Long,
+    Float,
+    Double,
+    Bytes,
+    String,
+    Record,
+    Enum,
+    Array,
+    Map,
+    Union,
+    Fixed,
+  };
+
+  struct AvroSchema final
+  {
+    AvroDatumType Type = AvroDatumType::Null;
+    // The name of a record, an enum or a fixed, without its namespace.
+    std::string Name;
+    // The names of the fields of a record, or the symbols of an enum.
+    std::vector<std::string> Names;
+    // The schemas of the fields of a record, of the items of an array or a map, or of the branches
+    // of a union.
+    std::vector<const AvroSchema*> Children;
+    // The size of a fixed.
+    size_t Size = 0;
+  };
+
+  /**
+   * A decoded value. Unions are decoded into the value of their branch.
+   */
+  struct AvroDatum final
+  {
+    const AvroSchema* Schema = nullptr;
+    bool Bool = false;
+    // Value of an int, a long or the index of an enum.
+    int64_t Long = 0;
+    // Value of a float or a double.
+    double Double = 0;
+    // Value of a string, bytes, a fixed or the symbol of an enum.
+    std::string String;
+    // Values of the fields of a record, or of the items of an array or a map.
+    std::vector<AvroDatum> Items;
+    // Keys of a map.
+    std::vector<std::string> Keys;
+
+    const AvroDatum& Field(const std::string& name) const;
+  };
+
+  /**
+   * Decodes the objects of an Avro object container file while it's read from a stream, which must
+   * outlive the reader.
+   */
+  class AvroObjectContainerReader final {
+  public:
+    explicit AvroObjectContainerReader(Azure::Core::IO::BodyStream& stream);
+
+    /**
+     * Decodes the next object, returns false at the end of the file.
+     */
+    bool Next(AvroDatum& datum, const Azure::Core::Context& context);
+
+  private:
+    uint8_t ReadByte(const Azure::Core::Context& context);
+    void Read(uint8_t* buffer, size_t count, const Azure::Core::Context& context);
+    void ReadString(std::string& value, size_t count, const Azure::Core::Context& context);
+    int64_t ReadLong(const Azure::Core::Context& context);
+    bool AtEnd(const Azure::Core::Context& context);
+    void ReadHeader(const Azure::Core::Context& context);
+    void ReadSyncMarker(const Azure::Core::Context& context);
+    void Decode(const AvroSchema& schema, AvroDatum& datum, const Azure::Core::Context& context);
+
+    Azure::Core::IO::BodyStream& m_stream;
+    std::vector<uint8_t> m_buffer;
+    size_t m_bufferOffset = 0;
+    size_t m_bufferLength = 0;
+
+    bool m_headerRead = false;
+    std::vector<std::unique_ptr<AvroSchema>> m_schemas;
+    std::map<std::string, const AvroSchema*> m_namedSchemas;
+    const AvroSchema* m_schema = nullptr;
+    uint8_t m_syncMarker[16] = {};
+    int64_t m_remainingObjects = 0;
+  };
+
+  /**
+   * Decodes the Avro records of the response of a blob query into the results they carry, and
+   * reports the progress and the errors they carry.
+   */
+  class BlobQueryBodyStream final : public Azure::Core::IO::BodyStream {
+  public:
+    explicit BlobQueryBodyStream(
+        std::unique_ptr<Azure::Core::IO::BodyStream> inner,
+        std::function<void(int64_t, int64_t)> progressHandler,
+        std::function<void(Models::BlobQueryError)> errorHandler)
+        : m_inner(std::move(inner)), m_reader(*m_inner),
+          m_progressHandler(std::move(progressHandler)), m_errorHandler(std::move(errorHandler))
+    {
+    }
+
+    int64_t Length() const override { return -1; }
+
+  private:
+    size_t OnRead(uint8_t* buffer, size_t count, const Azure::Core::Context& context) override;
+
+    std::unique_ptr<Azure::Core::IO::BodyStream> m_inner;
+    AvroObjectContainerReader m_reader;
+    std::function<void(int64_t, int64_t)> m_progressHandler;
+    std::function<void(Models::BlobQueryError)> m_errorHandler;
+    AvroDatum m_record;
+    size_t m_resultOffset = 0;
+    bool m_ended = false;
+  };
+
+}}}} // namespace Azure::Storage::Blobs::_detail
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <azure/core/context.hpp>
+
+#include "azure/storage/blobs/client_side_encryption.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs { namespace _detail {
+
+  constexpr static const char* EncryptionDataMetadataKey = "encryptiondata";
+
+  /**
+   * @brief Encrypts the content of a blob in segments, each stored as its nonce, its encrypted
+   * bytes and its authentication tag, so that the segments of a chunk are encrypted and decrypted
+   * independently of the other chunks.
+   */
+  class SegmentedContentCipher final {
+  public:
+    /**
+     * @brief Constructs a cipher with a new random content key.
+     */
+    SegmentedContentCipher();
+
+    /**
+     * @brief Constructs the cipher of an encrypted blob, unwrapping its content key.
+     *
+     * @param encryptionData The encryption data in the metadata of the blob.
+     * @param encryptedSize The size of the blob.
+     */
+    static SegmentedContentCipher FromEncryptionData(
+        const std::string& encryptionData,
+        int64_t encryptedSize,
+        KeyEncryptionKey& keyEncryptionKey,
+        const Azure::Core::Context& context);
+
+    /**
+     * @brief Gets the encryption data stored in the metadata of the blob, with the content key
+     * wrapped by the key encryption key of \p options.
+     */
+    std::string GetEncryptionData(
+        const ClientSideEncryptionOptions& options,
+        const Azure::Core::Context& context) const;
+
+    int64_t GetSegmentSize() const { return m_segmentSize; }
+    int64_t GetEncryptedSegmentSize() const;
+    int64_t GetEncryptedSize(int64_t size) const;
+    int64_t GetDecryptedSize(int64_t encryptedSize) const;
+
+    /**
+     * @brief Encrypts content starting at a segment boundary into GetEncryptedSize(size) bytes.
+     */
+    void Encrypt(const uint8_t* data, size_t size, uint8_t* output) const;
+
+    /**
+     * @brief Decrypts whole encrypted segments into GetDecryptedSize(size) bytes.
+     */
+    void Decrypt(const uint8_t* data, size_t size, uint8_t* output) const;
+
+  private:
+    SegmentedContentCipher(std::vector<uint8_t> contentKey, int64_t segmentSize)
+        : m_contentKey(std::move(contentKey)), m_segmentSize(segmentSize)
+    {
+    }
+
+    std::vector<uint8_t> m_contentKey;
+    int64_t m_segmentSize;
+  };
+
+}}}} // namespace Azure::Storage::Blobs::_detail
@@ -0,0 +1,327 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/blobs/sharded_blob_container_client.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+#include <azure/core/url.hpp>
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
+#include <azure/storage/common/internal/thread_pool.hpp>
+
+#include "azure/storage/blobs/append_blob_client.hpp"
+#include "azure/storage/blobs/block_blob_client.hpp"
+#include "azure/storage/blobs/page_blob_client.hpp"
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  namespace {
+    constexpr uint64_t FnvOffsetBasis = 14695981039346656037ULL;
+    constexpr uint64_t FnvPrime = 1099511628211ULL;
+
+    // Continues the FNV-1a hash `hash` with the bytes of `data`.
+    uint64_t HashBytes(uint64_t hash, const std::string& data)
+    {
+      for (unsigned char c : data)
+      {
+        hash ^= c;
+        hash *= FnvPrime;
+      }
+      return hash;
+    }
+
+    // The splitmix64 finalizer, so that the scores of names differing by a byte are unrelated.
+    uint64_t MixHash(uint64_t hash)
+    {
+      hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+      return hash ^ (hash >> 31);
+    }
+
+    // The url of the container of a shard, without its query, so that a new SAS token doesn't
+    // move the blobs.
+    std::string GetShardKey(const BlobContainerClient& shard)
+    {
+      Azure::Core::Url url(shard.GetUrl());
+      std::string key = url.GetHost();
+      if (url.GetPort() != 0)
+      {
+        key += ":" + std::to_string(url.GetPort());
+      }
+      return key + "/" + url.GetPath() + "/";
+    }
+
+    // The continuation token of a page lists the shards with blobs left, each as
+    // `<shard index>:<token length>:<token>`.
+    std::string EncodeShardToken(size_t shardIndex, const std::string& token)
+    {
+      return std::to_string(shardIndex) + ":" + std::to_string(token.size()) + ":" + token;
+    }
+
+    std::vector<std::pair<size_t, Azure::Nullable<std::string>>> DecodeShardTokens(
+        const std::string& continuationToken,
+        size_t numShards)
+    {
+      std::vector<std::pair<size_t, Azure::Nullable<std::string>>> shardTokens;
+      size_t position = 0;
+      auto readNumber = [&]() {
+        const auto separator = continuationToken.find(':', position);
+        // Up to 9 digits, which can't overflow.
+        if (separator == std::string::npos || separator == position || separator - position > 9)
+        {
+          throw std::invalid_argument("Invalid continuation token.");
+        }
+        size_t number = 0;
+        for (; position < separator; ++position)
+        {
+          const char c = continuationToken[position];
+          if (c < '0' || c > '9')
+          {
+            throw std::invalid_argument("Invalid continuation token.");
+          }
+          number = number * 10 + static_cast<size_t>(c - '0');
+        }
+        ++position;
+        return number;
+      };
+      while (position < continuationToken.size())
+      {
+        const auto shardIndex = readNumber();
+        const auto tokenLength = readNumber();
+        if (shardIndex >= numShards || tokenLength > continuationToken.size() - position)
+        {
+          throw std::invalid_argument("Invalid continuation token.");
+        }
+        shardTokens.emplace_back(shardIndex, continuationToken.substr(position, tokenLength));
+        position += tokenLength;
+      }
+      return shardTokens;
+    }
+
+    // Shares the access tokens of a credential between the pipelines of the shards, which would
+    // otherwise each fetch their own.
+    class SharedTokenCredential final : public Core::Credentials::TokenCredential {
+    public:
+      explicit SharedTokenCredential(std::shared_ptr<Core::Credentials::TokenCredential> credential)
+          : m_credential(std::move(credential))
+      {
+      }
+
+      Core::Credentials::AccessToken GetToken(
+          const Core::Credentials::TokenRequestContext& tokenRequestContext,
+          const Azure::Core::Context& context) const override
+      {
+        // Held while fetching a token, so that the pipelines needing one wait for the same fetch.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // The pipelines refresh their token 5 minutes before it expires, a token expiring sooner
+        // is fetched again.
+        if (m_accessToken && m_scopes == tokenRequestContext.Scopes
+            && std::chrono::system_clock::now()
+                < m_accessToken->ExpiresOn - std::chrono::minutes(5))
+        {
+          return *m_accessToken;
+        }
+        auto accessToken = m_credential->GetToken(tokenRequestContext, context);
+        m_accessToken = accessToken;
+        m_scopes = tokenRequestContext.Scopes;
+        return accessToken;
+      }
+
+    private:
+      std::shared_ptr<Core::Credentials::TokenCredential> m_credential;
+      mutable std::mutex m_mutex;
+      mutable Azure::Nullable<Core::Credentials::AccessToken> m_accessToken;
+      mutable std::vector<std::string> m_scopes;
+    };
+
+    std::vector<BlobContainerClient> CreateShards(
+        const std::vector<std::string>& blobContainerUrls,
+        std::shared_ptr<Core::Credentials::TokenCredential> credential,
+        const BlobClientOptions& options)
+    {
+      std::vector<BlobContainerClient> shards;
+      shards.reserve(blobContainerUrls.size());
+      for (const auto& blobContainerUrl : blobContainerUrls)
+      {
+        if (credential)
+        {
+          shards.emplace_back(blobContainerUrl, credential, options);
+        }
+        else
+        {
+          shards.emplace_back(blobContainerUrl, options);
+        }
+      }
+      return shards;
+    }
+  } // namespace
+
+  ShardedBlobContainerClient::ShardedBlobContainerClient(
+      const std::vector<std::string>& blobContainerUrls,
+      std::shared_ptr<Core::Credentials::TokenCredential> credential,
+      const BlobClientOptions& options)
+      : ShardedBlobContainerClient(CreateShards(
+          blobContainerUrls,
+          std::make_shared<SharedTokenCredential>(std::move(credential)),
+          options))
+  {
+  }
+
+  ShardedBlobContainerClient::ShardedBlobContainerClient(
+      const std::vector<std::string>& blobContainerUrls,
+      const BlobClientOptions& options)
+      : ShardedBlobContainerClient(CreateShards(blobContainerUrls, nullptr, options))
+  {
+  }
+
+  ShardedBlobContainerClient::ShardedBlobContainerClient(std::vector<BlobContainerClient> shards)
+      : m_shards(std::move(shards))
+  {
+    if (m_shards.empty())
+    {
+      throw std::invalid_argument("There must be at least one shard.");
+    }
+    std::set<std::string> shardKeys;
+    m_shardSeeds.reserve(m_shards.size());
+    for (const auto& shard : m_shards)
+    {
+      auto shardKey = GetShardKey(shard);
+      m_shardSeeds.push_back(HashBytes(FnvOffsetBasis, shardKey));
+      if (!shardKeys.insert(std::move(shardKey)).second)
+      {
+        throw std::invalid_argument("The shards must be different containers.");
+      }
+    }
+  }
+
+  size_t ShardedBlobContainerClient::GetShardIndex(const std::string& blobName) const
+  {
+    size_t shardIndex = 0;
+    uint64_t maxScore = 0;
+    for (size_t i = 0; i < m_shardSeeds.size(); ++i)
+    {
+      const auto score = MixHash(HashBytes(m_shardSeeds[i], blobName));
+      if (i == 0 || score > maxScore)
+      {
+        shardIndex = i;
+        maxScore = score;
+      }
+    }
+    return shardIndex;
+  }
+
+  BlobClient ShardedBlobContainerClient::GetBlobClient(const std::string& blobName) const
+  {
+    return m_shards[GetShardIndex(blobName)].GetBlobClient(blobName);
+  }
+
+  BlockBlobClient ShardedBlobContainerClient::GetBlockBlobClient(const std::string& blobName) const
+  {
+    return m_shards[GetShardIndex(blobName)].GetBlockBlobClient(blobName);
+  }
+
+  AppendBlobClient ShardedBlobContainerClient::GetAppendBlobClient(
+      const std::string& blobName) const
+  {
+    return m_shards[GetShardIndex(blobName)].GetAppendBlobClient(blobName);
+  }
+
+  PageBlobClient ShardedBlobContainerClient::GetPageBlobClient(const std::string& blobName) const
+  {
+    return m_shards[GetShardIndex(blobName)].GetPageBlobClient(blobName);
+  }
+
+  ShardedListBlobsPagedResponse ShardedBlobContainerClient::ListBlobs(
+      const ListBlobsOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    // The shards with blobs left, and the continuation token of each, null for the first page.
+    std::vector<std::pair<size_t, Azure::Nullable<std::string>>> shardTokens;
+    if (options.ContinuationToken.HasValue() && !options.ContinuationToken.Value().empty())
+    {
+      shardTokens = DecodeShardTokens(options.ContinuationToken.Value(), m_shards.size());
+    }
+    else
+    {
+      for (size_t i = 0; i < m_shards.size(); ++i)
+      {
+        shardTokens.emplace_back(i, Azure::Nullable<std::string>());
+      }
+    }
+
+    std::vector<std::unique_ptr<ListBlobsPagedResponse>> pages(shardTokens.size());
+    std::atomic<size_t> nextPage{0};
+    std::mutex mutex;
+    std::exception_ptr firstError;
+    auto threadFunc = [&]() {
+      while (true)
+      {
+        const size_t i = nextPage++;
+        if (i >= pages.size())
+        {
+          break;
+        }
+        ListBlobsOptions shardOptions = options;
+        shardOptions.ContinuationToken = shardTokens[i].second;
+        try
+        {
+          pages[i] = std::make_unique<ListBlobsPagedResponse>(
+              m_shards[shardTokens[i].first].ListBlobs(shardOptions, context));
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> guard(mutex);
+          if (!firstError)
+          {
+            firstError = std::current_exception();
+          }
+        }
+      }
+    };
+    Storage::_detail::RunConcurrently(
+        static_cast<int64_t>(pages.size()) - 1, threadFunc, _internal::ThreadPool::GetDefault());
+    if (firstError)
+    {
+      std::rethrow_exception(firstError);
+    }
+
+    ShardedListBlobsPagedResponse pagedResponse;
+    std::string nextPageToken;
+    for (size_t i = 0; i < pages.size(); ++i)
+    {
+      auto& page = *pages[i];
+      pagedResponse.Blobs.insert(
+          pagedResponse.Blobs.end(),
+          std::make_move_iterator(page.Blobs.begin()),
+          std::make_move_iterator(page.Blobs.end()));
+      if (page.NextPageToken.HasValue() && !page.NextPageToken.Value().empty())
+      {
+        nextPageToken += EncodeShardToken(shardTokens[i].first, page.NextPageToken.Value());
+      }
+      // The raw response is the one of the first shard listed.
+      if (!pagedResponse.RawResponse)
+      {
+        pagedResponse.RawResponse = std::move(page.RawResponse);
+      }
+    }
+    pagedResponse.Prefix = options.Prefix.ValueOr(std::string());
+    pagedResponse.m_shardedBlobContainerClient
+        = std::make_shared<ShardedBlobContainerClient>(*this);
+    pagedResponse.m_operationOptions = options;
+    pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
+    if (!nextPageToken.empty())
+    {
+      pagedResponse.NextPageToken = std::move(nextPageToken);
+    }
+
+    return pagedResponse;
+  }
+
+}}} // namespace Azure::Storage::Blobs
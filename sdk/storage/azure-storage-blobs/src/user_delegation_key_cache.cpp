@@ -0,0 +1,151 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/blobs/user_delegation_key_cache.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  namespace {
+    std::chrono::system_clock::time_point GetExpiresOn(const Models::UserDelegationKey& key)
+    {
+      return static_cast<std::chrono::system_clock::time_point>(key.SignedExpiresOn);
+    }
+  } // namespace
+
+  UserDelegationKeyCache::UserDelegationKeyCache(
+      BlobServiceClient serviceClient,
+      std::string accountName,
+      const UserDelegationKeyCacheOptions& options)
+      : m_serviceClient(std::move(serviceClient)), m_accountName(std::move(accountName)),
+        m_options(options)
+  {
+    if (m_options.KeyValidity.count() <= 0 || m_options.KeyValidity > std::chrono::hours(24 * 7))
+    {
+      throw std::invalid_argument("KeyValidity must be positive and up to 7 days.");
+    }
+    if (m_options.RefreshBeforeExpiry.count() < 0
+        || m_options.RefreshBeforeExpiry >= m_options.KeyValidity)
+    {
+      throw std::invalid_argument(
+          "RefreshBeforeExpiry must not be negative and must be shorter than KeyValidity.");
+    }
+    m_refreshThread = std::thread([this]() { RunRefresh(); });
+  }
+
+  UserDelegationKeyCache::~UserDelegationKeyCache() { Stop(); }
+
+  void UserDelegationKeyCache::Stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+      m_stateChanged.notify_all();
+    }
+    m_refreshContext.Cancel();
+    if (m_refreshThread.joinable())
+    {
+      m_refreshThread.join();
+    }
+  }
+
+  Models::UserDelegationKey UserDelegationKeyCache::FetchKey(const Azure::Core::Context& context)
+  {
+    const auto expiresOn = std::chrono::system_clock::now() + m_options.KeyValidity;
+    return m_serviceClient
+        .GetUserDelegationKey(expiresOn, GetUserDelegationKeyOptions(), context)
+        .Value;
+  }
+
+  Models::UserDelegationKey UserDelegationKeyCache::GetKey(const Azure::Core::Context& context)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+      // A key being refreshed is still used until it expires.
+      if (m_key.HasValue() && std::chrono::system_clock::now() < GetExpiresOn(m_key.Value()))
+      {
+        return m_key.Value();
+      }
+      if (!m_fetching)
+      {
+        break;
+      }
+      m_stateChanged.wait(lock);
+    }
+
+    m_fetching = true;
+    lock.unlock();
+    Models::UserDelegationKey key;
+    try
+    {
+      key = FetchKey(context);
+    }
+    catch (...)
+    {
+      lock.lock();
+      m_fetching = false;
+      m_stateChanged.notify_all();
+      throw;
+    }
+    lock.lock();
+    m_fetching = false;
+    m_key = key;
+    m_refreshTime = GetExpiresOn(key) - m_options.RefreshBeforeExpiry;
+    m_stateChanged.notify_all();
+    return key;
+  }
+
+  std::string UserDelegationKeyCache::GenerateSasToken(
+      Sas::BlobSasBuilder sasBuilder,
+      const Azure::Core::Context& context)
+  {
+    return sasBuilder.GenerateSasToken(GetKey(context), m_accountName);
+  }
+
+  void UserDelegationKeyCache::RunRefresh()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping)
+    {
+      // The first key is got by the first call needing it, and a key expired is got again the
+      // same way.
+      if (!m_key.HasValue() || m_fetching)
+      {
+        m_stateChanged.wait(lock);
+        continue;
+      }
+      if (std::chrono::system_clock::now() < m_refreshTime)
+      {
+        m_stateChanged.wait_until(lock, m_refreshTime);
+        continue;
+      }
+
+      m_fetching = true;
+      lock.unlock();
+      Azure::Nullable<Models::UserDelegationKey> key;
+      try
+      {
+        key = FetchKey(m_refreshContext);
+      }
+      catch (...)
+      {
+      }
+      lock.lock();
+      m_fetching = false;
+      if (key.HasValue())
+      {
+        m_key = key;
+        m_refreshTime = GetExpiresOn(key.Value()) - m_options.RefreshBeforeExpiry;
+      }
+      else
+      {
+        m_refreshTime = std::chrono::system_clock::now() + m_options.RetryDelay;
+      }
+      m_stateChanged.notify_all();
+    }
+  }
+
+}}} // namespace Azure::Storage::Blobs
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Define the base bahavior of the tests using a blobs client with canned responses.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/base64.hpp>
+#include <azure/core/http/http.hpp>
+#include <azure/perf.hpp>
+#include <azure/perf/canned_response_transport.hpp>
+
+#include <azure/storage/blobs.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test {
+
+  /**
+   * @brief A base test for the blobs clients answered by a canned response instead of the
+   * service.
+   *
+   * @remark There's no network, so that the tests measure the CPU cost of the client: building
+   * and signing the request, the pipeline, and deserializing the response.
+   */
+  class BlobsOfflineTest : public Azure::Perf::PerfTest {
+  protected:
+    const std::string m_accountUrl = "https://account.blob.core.windows.net";
+    const std::string m_containerName = "container";
+    const std::string m_blobName = "blob";
+    std::shared_ptr<Azure::Storage::StorageSharedKeyCredential> m_credential;
+
+    /**
+     * @brief Get the options of a client answered by \p transport.
+     *
+     * @param transport The transport answering the requests of the client.
+     */
+    Azure::Storage::Blobs::BlobClientOptions GetClientOptions(
+        std::shared_ptr<Azure::Perf::CannedResponseTransport> transport) const
+    {
+      Azure::Storage::Blobs::BlobClientOptions options;
+      options.Transport.Transport = std::move(transport);
+      return options;
+    }
+
+    /**
+     * @brief Get the headers of a blobs service response.
+     *
+     */
+    static std::map<std::string, std::string> GetResponseHeaders()
+    {
+      return {
+          {"Date", "Mon, 27 Sep 2021 18:22:03 GMT"},
+          {"Server", "Windows-Azure-Blob/1.0 Microsoft-HTTPAPI/2.0"},
+          {"x-ms-client-request-id", "6f3c5b0e-2b3e-4c0a-5d3f-8a0e9b1c7d21"},
+          {"x-ms-request-id", "0f1e2d3c-401e-0062-5a2b-b3c1d4000000"},
+          {"x-ms-version", "2020-02-10"}};
+    }
+
+  public:
+    /**
+     * @brief Create the credential, with a fake account key.
+     *
+     */
+    void Setup() override
+    {
+      m_credential = std::make_shared<Azure::Storage::StorageSharedKeyCredential>(
+          "account", Azure::Core::Convert::Base64Encode(std::vector<uint8_t>(64, 0x5A)));
+    }
+
+    /**
+     * @brief Construct a new BlobsOfflineTest test.
+     *
+     * @param options The test options.
+     */
+    BlobsOfflineTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+  };
+
+}}}} // namespace Azure::Storage::Blobs::Test
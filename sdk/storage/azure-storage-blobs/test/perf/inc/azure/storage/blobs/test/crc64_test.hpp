@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of computing the CRC64 of a buffer.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+#include <azure/storage/common/crypt.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test {
+
+  /**
+   * @brief A test to measure computing the CRC64 used for transactional content validation.
+   *
+   * @remark With `--parallel 1`, the operations per second times the size is the throughput of a
+   * core.
+   */
+  class Crc64 : public Azure::Perf::PerfTest {
+  private:
+    std::vector<uint8_t> m_buffer;
+
+  public:
+    /**
+     * @brief Construct a new Crc64 test.
+     *
+     * @param options The test options.
+     */
+    Crc64(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief The size of the buffer is defined by a mandatory parameter.
+     *
+     */
+    void Setup() override
+    {
+      long size = m_options.GetMandatoryOption<long>("Size");
+
+      m_buffer.resize(size);
+      for (size_t i = 0; i < m_buffer.size(); ++i)
+      {
+        m_buffer[i] = static_cast<uint8_t>(i * 2654435761U >> 13);
+      }
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      Azure::Storage::Crc64Hash crc64;
+      crc64.Final(m_buffer.data(), m_buffer.size());
+    }
+
+    /**
+     * @brief Gets the size of the buffer.
+     *
+     */
+    int64_t GetBytesPerOperation() override { return static_cast<int64_t>(m_buffer.size()); }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {{"Size", {"--size"}, "Size of the buffer (in bytes)", 1, true}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {"Crc64", "Compute the CRC64 of a buffer.", [](Azure::Perf::TestOptions options) {
+                return std::make_unique<Azure::Storage::Blobs::Test::Crc64>(options);
+              }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Blobs::Test
@@ -27,6 +27,7 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
   class DownloadBlob : public Azure::Storage::Blobs::Test::BlobsTest {
   private:
     std::unique_ptr<std::vector<uint8_t>> m_downloadBuffer;
+    Azure::Storage::Blobs::DownloadBlobToOptions m_downloadOptions;
 
   public:
     /**
@@ -49,6 +50,14 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
 
       m_downloadBuffer = std::make_unique<std::vector<uint8_t>>(size);
 
+      auto& transferOptions = m_downloadOptions.TransferOptions;
+      transferOptions.Concurrency
+          = m_options.GetOptionOrDefault("Concurrency", transferOptions.Concurrency);
+      transferOptions.ChunkSize
+          = m_options.GetOptionOrDefault("ChunkSize", transferOptions.ChunkSize);
+      transferOptions.InitialChunkSize
+          = m_options.GetOptionOrDefault("InitialChunkSize", transferOptions.InitialChunkSize);
+
       auto rawData = std::make_unique<std::vector<uint8_t>>(size);
       auto content = Azure::Core::IO::MemoryBodyStream(*rawData);
       m_blobClient->Upload(content);
@@ -58,9 +67,10 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
      * @brief Define the test
      *
      */
-    void Run(Azure::Core::Context const&) override
+    void Run(Azure::Core::Context const& context) override
     {
-      m_blobClient->DownloadTo(m_downloadBuffer->data(), m_downloadBuffer->size());
+      m_blobClient->DownloadTo(
+          m_downloadBuffer->data(), m_downloadBuffer->size(), m_downloadOptions, context);
     }
 
     /**
@@ -71,7 +81,15 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
     std::vector<Azure::Perf::TestOption> GetTestOptions() override
     {
       // TODO: Merge with base options
-      return {{"Size", {"--size"}, "Size of payload (in bytes)", 1, true}};
+      return {
+          {"Size", {"--size"}, "Size of payload (in bytes)", 1, true},
+          {"Concurrency", {"--concurrency"}, "Number of threads of the transfer. Default to 5.", 1},
+          {"ChunkSize", {"--chunk-size"}, "Size of each range request (in bytes).", 1},
+          {"InitialChunkSize",
+           {"--initial-chunk-size"},
+           "Size of the first range request (in bytes). Smaller blobs are downloaded in a single "
+           "request.",
+           1}};
     }
 
     /**
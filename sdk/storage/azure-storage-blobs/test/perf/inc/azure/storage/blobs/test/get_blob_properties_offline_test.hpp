@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the CPU cost of getting the properties of a blob, with a canned response.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+#include <azure/perf/canned_response_transport.hpp>
+
+#include "azure/storage/blobs/test/blob_offline_base_test.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test {
+
+  /**
+   * @brief A test to measure getting the properties of a blob, without network.
+   *
+   */
+  class GetBlobPropertiesOffline : public Azure::Storage::Blobs::Test::BlobsOfflineTest {
+  private:
+    std::unique_ptr<Azure::Storage::Blobs::BlobClient> m_blobClient;
+
+  public:
+    /**
+     * @brief Construct a new GetBlobPropertiesOffline test.
+     *
+     * @param options The test options.
+     */
+    GetBlobPropertiesOffline(Azure::Perf::TestOptions options) : BlobsOfflineTest(options) {}
+
+    /**
+     * @brief Create the blob client, answered with the properties of a block blob.
+     *
+     */
+    void Setup() override
+    {
+      BlobsOfflineTest::Setup();
+
+      auto headers = GetResponseHeaders();
+      headers.insert({
+          {"Accept-Ranges", "bytes"},
+          {"Content-Length", "10485760"},
+          {"Content-MD5", "8Pbk1yAc2BpEXwbe3eP4mg=="},
+          {"Content-Type", "application/octet-stream"},
+          {"ETag", "\"0x8D981DE4B7C2C5F\""},
+          {"Last-Modified", "Mon, 27 Sep 2021 18:21:57 GMT"},
+          {"x-ms-access-tier", "Hot"},
+          {"x-ms-access-tier-inferred", "true"},
+          {"x-ms-blob-type", "BlockBlob"},
+          {"x-ms-creation-time", "Mon, 27 Sep 2021 18:21:57 GMT"},
+          {"x-ms-is-current-version", "true"},
+          {"x-ms-lease-state", "available"},
+          {"x-ms-lease-status", "unlocked"},
+          {"x-ms-meta-owner", "perf"},
+          {"x-ms-server-encrypted", "true"},
+          {"x-ms-version-id", "2021-09-27T18:21:57.1234567Z"},
+      });
+      m_blobClient = std::make_unique<Azure::Storage::Blobs::BlobClient>(
+          m_accountUrl + "/" + m_containerName + "/" + m_blobName,
+          m_credential,
+          GetClientOptions(std::make_shared<Azure::Perf::CannedResponseTransport>(
+              Azure::Core::Http::HttpStatusCode::Ok, std::move(headers))));
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_blobClient->GetProperties({}, context);
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "GetBlobPropertiesOffline",
+          "Get the properties of a blob, answered by a canned response.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Storage::Blobs::Test::GetBlobPropertiesOffline>(
+                options);
+          }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Blobs::Test
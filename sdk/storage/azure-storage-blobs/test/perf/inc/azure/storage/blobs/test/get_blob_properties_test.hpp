@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of getting the properties of a blob.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+
+#include "azure/storage/blobs/test/blob_base_test.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test {
+
+  /**
+   * @brief A test to measure getting the properties of a blob, a small operation without
+   * payload.
+   *
+   */
+  class GetBlobProperties : public Azure::Storage::Blobs::Test::BlobsTest {
+  public:
+    /**
+     * @brief Construct a new GetBlobProperties test.
+     *
+     * @param options The test options.
+     */
+    GetBlobProperties(Azure::Perf::TestOptions options) : BlobsTest(options) {}
+
+    /**
+     * @brief Upload an empty blob on setup.
+     *
+     */
+    void Setup() override
+    {
+      // Call base to create blob client
+      BlobsTest::Setup();
+
+      m_blobClient->UploadFrom(nullptr, 0);
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_blobClient->GetProperties({}, context);
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "GetBlobProperties",
+          "Get the properties of a blob.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Storage::Blobs::Test::GetBlobProperties>(options);
+          }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Blobs::Test
@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the CPU cost of listing the blobs of a container, with a canned response.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+#include <azure/perf/canned_response_transport.hpp>
+
+#include "azure/storage/blobs/test/blob_offline_base_test.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test {
+
+  /**
+   * @brief A test to measure listing a page of blobs, without network.
+   *
+   */
+  class ListBlobsOffline : public Azure::Storage::Blobs::Test::BlobsOfflineTest {
+  private:
+    std::unique_ptr<Azure::Storage::Blobs::BlobContainerClient> m_containerClient;
+
+    /**
+     * @brief Get the XML document of a page of \p count blobs.
+     *
+     * @param count The number of blobs in the page.
+     */
+    std::string GetResponseBody(int count) const
+    {
+      std::string body = "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+                         "<EnumerationResults ServiceEndpoint=\""
+          + m_accountUrl + "/\" ContainerName=\"" + m_containerName
+          + "\"><MaxResults>5000</MaxResults><Blobs>";
+      for (int i = 0; i < count; ++i)
+      {
+        body += "<Blob><Name>" + m_blobName + std::to_string(i)
+            + "</Name><Properties>"
+              "<Creation-Time>Mon, 27 Sep 2021 18:21:57 GMT</Creation-Time>"
+              "<Last-Modified>Mon, 27 Sep 2021 18:21:57 GMT</Last-Modified>"
+              "<Etag>0x8D981DE4B7C2C5F</Etag>"
+              "<Content-Length>10485760</Content-Length>"
+              "<Content-Type>application/octet-stream</Content-Type>"
+              "<Content-Encoding /><Content-Language /><Content-CRC64 />"
+              "<Content-MD5>8Pbk1yAc2BpEXwbe3eP4mg==</Content-MD5>"
+              "<Cache-Control /><Content-Disposition />"
+              "<BlobType>BlockBlob</BlobType>"
+              "<AccessTier>Hot</AccessTier><AccessTierInferred>true</AccessTierInferred>"
+              "<LeaseStatus>unlocked</LeaseStatus><LeaseState>available</LeaseState>"
+              "<ServerEncrypted>true</ServerEncrypted>"
+              "</Properties><OrMetadata /></Blob>";
+      }
+      body += "</Blobs><NextMarker /></EnumerationResults>";
+      return body;
+    }
+
+  public:
+    /**
+     * @brief Construct a new ListBlobsOffline test.
+     *
+     * @param options The test options.
+     */
+    ListBlobsOffline(Azure::Perf::TestOptions options) : BlobsOfflineTest(options) {}
+
+    /**
+     * @brief Create the container client, answered with a page of the number of blobs defined
+     * by the `count` option.
+     *
+     */
+    void Setup() override
+    {
+      BlobsOfflineTest::Setup();
+
+      auto headers = GetResponseHeaders();
+      headers.emplace("Content-Type", "application/xml");
+      m_containerClient = std::make_unique<Azure::Storage::Blobs::BlobContainerClient>(
+          m_accountUrl + "/" + m_containerName,
+          m_credential,
+          GetClientOptions(std::make_shared<Azure::Perf::CannedResponseTransport>(
+              Azure::Core::Http::HttpStatusCode::Ok,
+              std::move(headers),
+              GetResponseBody(m_options.GetOptionOrDefault("Count", 100)))));
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_containerClient->ListBlobs({}, context);
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {{"Count", {"--count"}, "Number of blobs in the page. Default to 100.", 1}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "ListBlobsOffline",
+          "List a page of blobs, answered by a canned response.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Storage::Blobs::Test::ListBlobsOffline>(options);
+          }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Blobs::Test
@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of listing the blobs of a container.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+
+#include "azure/storage/blobs/test/blob_base_test.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test {
+
+  /**
+   * @brief A test to measure listing all the blobs of a container, page by page.
+   *
+   */
+  class ListBlobs : public Azure::Storage::Blobs::Test::BlobsTest {
+  private:
+    Azure::Storage::Blobs::ListBlobsOptions m_listOptions;
+
+  public:
+    /**
+     * @brief Construct a new ListBlobs test.
+     *
+     * @param options The test options.
+     */
+    ListBlobs(Azure::Perf::TestOptions options) : BlobsTest(options) {}
+
+    /**
+     * @brief The number of empty blobs to upload on setup is defined by a mandatory parameter.
+     *
+     */
+    void Setup() override
+    {
+      // Call base to create container client
+      BlobsTest::Setup();
+
+      auto count = m_options.GetMandatoryOption<int>("Count");
+      for (int i = 0; i < count; ++i)
+      {
+        m_containerClient->GetBlockBlobClient(m_blobName + std::to_string(i))
+            .UploadFrom(nullptr, 0);
+      }
+
+      auto pageSize = m_options.GetOptionOrDefault("PageSize", 0);
+      if (pageSize != 0)
+      {
+        m_listOptions.PageSizeHint = pageSize;
+      }
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      for (auto page = m_containerClient->ListBlobs(m_listOptions, context); page.HasPage();
+           page.MoveToNextPage(context))
+      {
+      }
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Count", {"--count", "-c"}, "Number of blobs in the container", 1, true},
+          {"PageSize", {"--page-size"}, "Number of blobs per page. Default to 5000.", 1}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {"ListBlobs", "List the blobs of a container.", [](Azure::Perf::TestOptions options) {
+                return std::make_unique<Azure::Storage::Blobs::Test::ListBlobs>(options);
+              }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Blobs::Test
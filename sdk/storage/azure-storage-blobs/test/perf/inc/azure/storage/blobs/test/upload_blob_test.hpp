@@ -29,6 +29,7 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
   private:
     // C++ can upload and download from contiguos memory or file only
     std::vector<uint8_t> m_uploadBuffer;
+    Azure::Storage::Blobs::UploadBlockBlobFromOptions m_uploadOptions;
 
   public:
     /**
@@ -50,15 +51,27 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
       long size = m_options.GetMandatoryOption<long>("Size");
       m_uploadBuffer = Azure::Perf::RandomStream::Create(size)->ReadToEnd(
           Azure::Core::Context::ApplicationContext);
+
+      auto& transferOptions = m_uploadOptions.TransferOptions;
+      transferOptions.Concurrency
+          = m_options.GetOptionOrDefault("Concurrency", transferOptions.Concurrency);
+      transferOptions.SingleUploadThreshold = m_options.GetOptionOrDefault(
+          "SingleUploadThreshold", transferOptions.SingleUploadThreshold);
+      auto chunkSize = m_options.GetOptionOrDefault<int64_t>("ChunkSize", 0);
+      if (chunkSize != 0)
+      {
+        transferOptions.ChunkSize = chunkSize;
+      }
     }
 
     /**
      * @brief Define the test
      *
      */
-    void Run(Azure::Core::Context const&) override
+    void Run(Azure::Core::Context const& context) override
     {
-      m_blobClient->UploadFrom(m_uploadBuffer.data(), m_uploadBuffer.size());
+      m_blobClient->UploadFrom(
+          m_uploadBuffer.data(), m_uploadBuffer.size(), m_uploadOptions, context);
     }
 
     /**
@@ -69,7 +82,14 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
     std::vector<Azure::Perf::TestOption> GetTestOptions() override
     {
       // TODO: Merge with base options
-      return {{"Size", {"--size", "-s"}, "Size of payload (in bytes)", 1, true}};
+      return {
+          {"Size", {"--size", "-s"}, "Size of payload (in bytes)", 1, true},
+          {"Concurrency", {"--concurrency"}, "Number of threads of the transfer. Default to 5.", 1},
+          {"ChunkSize", {"--chunk-size"}, "Size of each staged block (in bytes).", 1},
+          {"SingleUploadThreshold",
+           {"--single-upload-threshold"},
+           "Blobs smaller than this (in bytes) are uploaded in a single request.",
+           1}};
     }
 
     /**
@@ -3,7 +3,12 @@
 
 #include <azure/perf.hpp>
 
+#include "azure/storage/blobs/test/crc64_test.hpp"
 #include "azure/storage/blobs/test/download_blob_test.hpp"
+#include "azure/storage/blobs/test/get_blob_properties_offline_test.hpp"
+#include "azure/storage/blobs/test/get_blob_properties_test.hpp"
+#include "azure/storage/blobs/test/list_blobs_offline_test.hpp"
+#include "azure/storage/blobs/test/list_blobs_test.hpp"
 #include "azure/storage/blobs/test/upload_blob_test.hpp"
 
 int main(int argc, char** argv)
@@ -11,7 +16,12 @@ int main(int argc, char** argv)
 
   // Create the test list
   std::vector<Azure::Perf::TestMetadata> tests{
+      Azure::Storage::Blobs::Test::Crc64::GetTestMetadata(),
       Azure::Storage::Blobs::Test::DownloadBlob::GetTestMetadata(),
+      Azure::Storage::Blobs::Test::GetBlobProperties::GetTestMetadata(),
+      Azure::Storage::Blobs::Test::GetBlobPropertiesOffline::GetTestMetadata(),
+      Azure::Storage::Blobs::Test::ListBlobs::GetTestMetadata(),
+      Azure::Storage::Blobs::Test::ListBlobsOffline::GetTestMetadata(),
       Azure::Storage::Blobs::Test::UploadBlob::GetTestMetadata()};
 
   Azure::Perf::Program::Run(Azure::Core::Context::ApplicationContext, tests, argc, argv);
@@ -3,6 +3,15 @@
 
 #include "append_blob_client_test.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#include <azure/storage/blobs/append_blob_tail_reader.hpp>
+#include <azure/storage/blobs/append_blob_writer.hpp>
 #include <azure/storage/blobs/blob_lease_client.hpp>
 
 namespace Azure { namespace Storage { namespace Test {
@@ -340,4 +349,199 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_EQ(downloadStream->ReadToEnd(Azure::Core::Context()), m_blobContent);
   }
 
+  TEST_F(AppendBlobClientTest, AppendBlobWriter)
+  {
+    auto blobClient = Azure::Storage::Blobs::AppendBlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, RandomString());
+    blobClient.Create();
+
+    const size_t numThreads = 4;
+    const size_t numWrites = 50;
+    const size_t writeSize = 1000;
+    std::vector<std::future<void>> committed[numThreads];
+    {
+      Blobs::AppendBlobWriterOptions options;
+      options.MaxBlockSize = 16 * 1024;
+      options.Concurrency = 2;
+      Blobs::AppendBlobWriter writer(blobClient, options);
+      std::vector<std::thread> threads;
+      for (size_t i = 0; i < numThreads; ++i)
+      {
+        threads.emplace_back([&, i]() {
+          // Each write holds the index of its thread, so the order of a thread's writes can be
+          // checked.
+          const std::vector<uint8_t> data(writeSize, static_cast<uint8_t>(i));
+          for (size_t j = 0; j < numWrites; ++j)
+          {
+            committed[i].push_back(writer.Write(data.data(), data.size()));
+          }
+        });
+      }
+      for (auto& thread : threads)
+      {
+        thread.join();
+      }
+      writer.Flush();
+    }
+    for (auto& futures : committed)
+    {
+      for (auto& future : futures)
+      {
+        EXPECT_NO_THROW(future.get());
+      }
+    }
+
+    auto properties = blobClient.GetProperties().Value;
+    EXPECT_EQ(properties.BlobSize, static_cast<int64_t>(numThreads * numWrites * writeSize));
+    EXPECT_LT(properties.CommittedBlockCount.Value(), static_cast<int32_t>(numThreads * numWrites));
+    auto downloadStream = std::move(blobClient.Download().Value.BodyStream);
+    auto content = downloadStream->ReadToEnd(Azure::Core::Context());
+    ASSERT_EQ(content.size(), numThreads * numWrites * writeSize);
+    for (size_t i = 0; i < content.size(); i += writeSize)
+    {
+      EXPECT_EQ(
+          std::count(content.begin() + i, content.begin() + i + writeSize, content[i]),
+          static_cast<std::ptrdiff_t>(writeSize));
+    }
+
+    Blobs::AppendBlobWriterOptions options;
+    options.Position = 0;
+    Blobs::AppendBlobWriter writer(blobClient, options);
+    auto future = writer.Write(m_blobContent.data(), m_blobContent.size());
+    EXPECT_THROW(writer.Flush(), StorageException);
+    EXPECT_THROW(future.get(), StorageException);
+  }
+
+  namespace {
+    // Appends the blocks to an in-memory blob, checking their append position. The block at
+    // offset 0 is held until a block behind it has been rejected, so the pipelined blocks reach
+    // the blob out of order.
+    class OutOfOrderAppendTransport final : public Azure::Core::Http::HttpTransport {
+    public:
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Http::Request& request,
+          Azure::Core::Context const& context) override
+      {
+        const auto data = request.GetBodyStream()->ReadToEnd(context);
+        const auto position = std::stoll(request.GetHeaders().at("x-ms-blob-condition-appendpos"));
+
+        std::unique_lock<std::mutex> lock(Mutex);
+        if (position == 0)
+        {
+          m_rejected.wait(lock, [&]() { return NumRejected != 0; });
+        }
+        std::unique_ptr<Azure::Core::Http::RawResponse> response;
+        if (position != static_cast<int64_t>(Content.size()))
+        {
+          ++NumRejected;
+          m_rejected.notify_all();
+          response = std::make_unique<Azure::Core::Http::RawResponse>(
+              1, 1, Azure::Core::Http::HttpStatusCode::PreconditionFailed, "Precondition Failed");
+          response->SetHeader("Content-Type", "application/xml");
+          response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(
+              reinterpret_cast<const uint8_t*>(m_errorBody.data()), m_errorBody.size()));
+        }
+        else
+        {
+          response = std::make_unique<Azure::Core::Http::RawResponse>(
+              1, 1, Azure::Core::Http::HttpStatusCode::Created, "Created");
+          response->SetHeader("ETag", "\"etag\"");
+          response->SetHeader("Last-Modified", "Fri, 01 Jan 2021 00:00:00 GMT");
+          response->SetHeader("x-ms-blob-append-offset", std::to_string(Content.size()));
+          response->SetHeader("x-ms-blob-committed-block-count", "1");
+          response->SetHeader("x-ms-request-server-encrypted", "true");
+          response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(nullptr, 0));
+          Content.insert(Content.end(), data.begin(), data.end());
+        }
+        response->SetHeader("x-ms-request-id", "request-id");
+        response->SetHeader("Date", "Fri, 01 Jan 2021 00:00:00 GMT");
+        return response;
+      }
+
+      std::mutex Mutex;
+      std::vector<uint8_t> Content;
+      int NumRejected = 0;
+
+    private:
+      std::condition_variable m_rejected;
+      const std::string m_errorBody
+          = "<?xml version=\"1.0\" encoding=\"utf-8\"?><Error><Code>"
+            "AppendPositionConditionNotMet</Code><Message>message</Message></Error>";
+    };
+  } // namespace
+
+  TEST(AppendBlobClientOfflineTest, AppendBlobWriterOutOfOrderBlocks)
+  {
+    auto transport = std::make_shared<OutOfOrderAppendTransport>();
+    Blobs::BlobClientOptions clientOptions;
+    clientOptions.Transport.Transport = transport;
+    Blobs::AppendBlobClient blobClient(
+        "https://account.blob.core.windows.net/container/blob", clientOptions);
+
+    const std::vector<uint8_t> data{0, 1, 2, 3, 4, 5, 6, 7};
+    Blobs::AppendBlobWriterOptions options;
+    options.MaxBlockSize = 4;
+    options.Concurrency = 2;
+    options.Position = 0;
+    {
+      Blobs::AppendBlobWriter writer(blobClient, options);
+      auto future = writer.Write(data.data(), data.size());
+      writer.Flush();
+      EXPECT_NO_THROW(future.get());
+    }
+
+    // The second block was rejected once, and sent again after the first one was committed.
+    std::lock_guard<std::mutex> lock(transport->Mutex);
+    EXPECT_EQ(transport->NumRejected, 1);
+    EXPECT_EQ(transport->Content, data);
+  }
+
+  TEST_F(AppendBlobClientTest, AppendBlobTailReader)
+  {
+    auto blobClient = Azure::Storage::Blobs::AppendBlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, RandomString());
+    blobClient.Create();
+    const std::vector<uint8_t> firstBlock(RandomBuffer(100));
+    blobClient.AppendBlock(
+        *std::make_unique<Azure::Core::IO::MemoryBodyStream>(firstBlock.data(), firstBlock.size()));
+
+    std::mutex mutex;
+    std::condition_variable received;
+    std::vector<uint8_t> content;
+    int64_t expectedOffset = 10;
+    Blobs::AppendBlobTailReaderOptions options;
+    options.Offset = expectedOffset;
+    options.MaxReadSize = 64;
+    options.MinPollInterval = std::chrono::milliseconds(10);
+    options.MaxPollInterval = std::chrono::milliseconds(200);
+    Blobs::AppendBlobTailReader reader(
+        blobClient,
+        [&](int64_t offset, Azure::Core::IO::SharedBuffer data) {
+          std::lock_guard<std::mutex> lock(mutex);
+          EXPECT_EQ(offset, expectedOffset);
+          expectedOffset += static_cast<int64_t>(data.GetSize());
+          content.insert(content.end(), data.GetData(), data.GetData() + data.GetSize());
+          received.notify_all();
+        },
+        [](std::exception_ptr) { ADD_FAILURE(); },
+        options);
+
+    auto waitForSize = [&](size_t size) {
+      std::unique_lock<std::mutex> lock(mutex);
+      return received.wait_for(
+          lock, std::chrono::seconds(30), [&]() { return content.size() >= size; });
+    };
+    ASSERT_TRUE(waitForSize(90));
+    EXPECT_EQ(content, std::vector<uint8_t>(firstBlock.begin() + 10, firstBlock.end()));
+
+    // The bytes appended later are read too.
+    const std::vector<uint8_t> secondBlock(RandomBuffer(1000));
+    blobClient.AppendBlock(*std::make_unique<Azure::Core::IO::MemoryBodyStream>(
+        secondBlock.data(), secondBlock.size()));
+    ASSERT_TRUE(waitForSize(1090));
+    reader.Stop();
+    EXPECT_EQ(std::vector<uint8_t>(content.begin() + 90, content.end()), secondBlock);
+    EXPECT_EQ(reader.GetOffset(), 1100);
+  }
+
 }}} // namespace Azure::Storage::Test
@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/blobs.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(BlobBatchClientTest, SubmitBatch)
+  {
+    const std::string containerName = LowercaseRandomString();
+    auto containerClient = Azure::Storage::Blobs::BlobContainerClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), containerName);
+    containerClient.Create();
+
+    const std::string blob1Name = RandomString();
+    const std::string blob2Name = RandomString();
+    const std::string blob3Name = RandomString();
+    std::vector<uint8_t> content(10);
+    for (const auto& blobName : {blob1Name, blob2Name, blob3Name})
+    {
+      containerClient.GetBlockBlobClient(blobName).UploadFrom(content.data(), content.size());
+    }
+
+    auto batchClient = Azure::Storage::Blobs::BlobBatchClient::CreateFromConnectionString(
+        StandardStorageConnectionString());
+    Azure::Storage::Blobs::BlobBatch batch;
+    auto delete1Index = batch.DeleteBlob(containerName, blob1Name);
+    auto delete2Index = batch.DeleteBlob(containerName, blob2Name);
+    auto deleteMissingIndex = batch.DeleteBlob(containerName, RandomString());
+    auto setTierIndex
+        = batch.SetBlobAccessTier(containerName, blob3Name, Blobs::Models::AccessTier::Cool);
+    auto batchResult = batchClient.SubmitBatch(batch);
+
+    ASSERT_EQ(batchResult.Value.DeleteBlobResults.size(), 3U);
+    ASSERT_EQ(batchResult.Value.SetBlobAccessTierResults.size(), 1U);
+    EXPECT_TRUE(batchResult.Value.DeleteBlobResults[delete1Index].Value.Deleted);
+    EXPECT_TRUE(batchResult.Value.DeleteBlobResults[delete2Index].Value.Deleted);
+    EXPECT_FALSE(batchResult.Value.DeleteBlobResults[deleteMissingIndex].Value.Deleted);
+    EXPECT_EQ(
+        batchResult.Value.DeleteBlobResults[deleteMissingIndex].RawResponse->GetStatusCode(),
+        Azure::Core::Http::HttpStatusCode::NotFound);
+    EXPECT_EQ(
+        batchResult.Value.SetBlobAccessTierResults[setTierIndex].RawResponse->GetStatusCode(),
+        Azure::Core::Http::HttpStatusCode::Ok);
+
+    EXPECT_THROW(containerClient.GetBlobClient(blob1Name).GetProperties(), StorageException);
+    EXPECT_EQ(
+        containerClient.GetBlobClient(blob3Name).GetProperties().Value.AccessTier.Value(),
+        Blobs::Models::AccessTier::Cool);
+
+    Azure::Storage::Blobs::BlobBatch emptyBatch;
+    EXPECT_THROW(batchClient.SubmitBatch(emptyBatch), std::invalid_argument);
+
+    containerClient.Delete();
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -4,11 +4,14 @@
 #include "blob_container_client_test.hpp"
 
 #include <chrono>
+#include <set>
 #include <thread>
 
 #include <azure/storage/blobs/blob_lease_client.hpp>
+#include <azure/storage/blobs/blob_properties_cache.hpp>
 #include <azure/storage/blobs/blob_sas_builder.hpp>
 #include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/file_io.hpp>
 
 namespace Azure { namespace Storage { namespace Blobs { namespace Models {
 
@@ -246,6 +249,240 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_TRUE(std::includes(listBlobs.begin(), listBlobs.end(), p1Blobs.begin(), p1Blobs.end()));
   }
 
+  TEST_F(BlobContainerClientTest, ListBlobsStreaming)
+  {
+    const std::string prefix = RandomString() + "-";
+    std::set<std::string> blobs;
+    for (int i = 0; i < 7; ++i)
+    {
+      std::string blobName = prefix + RandomString();
+      auto blobClient = m_blobContainerClient->GetBlockBlobClient(blobName);
+      auto emptyContent = Azure::Core::IO::MemoryBodyStream(nullptr, 0);
+      blobClient.Upload(emptyContent);
+      blobs.insert(blobName);
+    }
+
+    Azure::Storage::Blobs::ListBlobsOptions options;
+    options.Prefix = prefix;
+    options.PageSizeHint = 3;
+    std::set<std::string> listBlobs;
+    int numPages = 0;
+    for (auto pageStream = m_blobContainerClient->ListBlobsStreaming(options);
+         pageStream.HasPage();
+         pageStream.MoveToNextPage())
+    {
+      ++numPages;
+      ASSERT_NE(pageStream.RawResponse, nullptr);
+      EXPECT_FALSE(pageStream.RawResponse->GetHeaders().at(_internal::HttpHeaderRequestId).empty());
+      EXPECT_FALSE(pageStream.ServiceEndpoint.empty());
+      EXPECT_EQ(pageStream.BlobContainerName, m_containerName);
+      EXPECT_EQ(pageStream.Prefix, prefix);
+      // Only the first two blobs of the second page are read, the third one is skipped when
+      // moving to the next page.
+      for (int i = 0; numPages != 2 || i < 2; ++i)
+      {
+        auto blob = pageStream.ReadNextBlob();
+        if (!blob.HasValue())
+        {
+          break;
+        }
+        EXPECT_TRUE(IsValidTime(blob.Value().Details.LastModified));
+        EXPECT_TRUE(blob.Value().Details.IsAccessTierInferred.HasValue());
+        listBlobs.insert(blob.Value().Name);
+      }
+    }
+    EXPECT_EQ(numPages, 3);
+    EXPECT_EQ(listBlobs.size(), blobs.size() - 1);
+    for (const auto& blob : listBlobs)
+    {
+      EXPECT_NE(blobs.find(blob), blobs.end());
+    }
+  }
+
+  TEST_F(BlobContainerClientTest, ListBlobsCompact)
+  {
+    const std::string prefix = RandomString() + "-";
+    std::vector<uint8_t> content(10);
+    for (int i = 0; i < 5; ++i)
+    {
+      auto blobClient = m_blobContainerClient->GetBlockBlobClient(prefix + RandomString());
+      blobClient.UploadFrom(content.data(), content.size());
+    }
+
+    Azure::Storage::Blobs::ListBlobsOptions options;
+    options.Prefix = prefix;
+    std::map<std::string, Blobs::Models::BlobItem> blobs;
+    for (auto pageResult = m_blobContainerClient->ListBlobs(options); pageResult.HasPage();
+         pageResult.MoveToNextPage())
+    {
+      for (auto& blob : pageResult.Blobs)
+      {
+        blobs.emplace(blob.Name, std::move(blob));
+      }
+    }
+    EXPECT_EQ(blobs.size(), 5U);
+
+    Azure::Storage::Blobs::ListBlobsCompactOptions compactOptions;
+    compactOptions.Prefix = prefix;
+    compactOptions.PageSizeHint = 2;
+    compactOptions.Fields |= Blobs::Models::CompactBlobItemFields::LastModified;
+    size_t numBlobs = 0;
+    for (auto pageResult = m_blobContainerClient->ListBlobsCompact(compactOptions);
+         pageResult.HasPage();
+         pageResult.MoveToNextPage())
+    {
+      EXPECT_EQ(pageResult.BlobContainerName, m_containerName);
+      for (const auto& blob : pageResult.Blobs)
+      {
+        const std::string name(blob.Name, blob.NameLength);
+        ASSERT_NE(blobs.find(name), blobs.end());
+        const auto& expected = blobs.at(name);
+        EXPECT_EQ(blob.BlobSize, expected.BlobSize);
+        EXPECT_EQ(std::string(blob.ETag), expected.Details.ETag.ToString());
+        EXPECT_EQ(blob.LastModified, expected.Details.LastModified);
+        ++numBlobs;
+      }
+    }
+    EXPECT_EQ(numBlobs, blobs.size());
+  }
+
+  TEST_F(BlobContainerClientTest, ListBlobsParallel)
+  {
+    const std::string prefix = RandomString() + "-";
+    std::set<std::string> blobs;
+    for (const auto& blobName :
+         {prefix + "blob",
+          prefix + "dir1/blob1",
+          prefix + "dir1/blob2",
+          prefix + "dir1/dir2/blob",
+          prefix + "dir3/blob",
+          prefix + "dir3/dir4/dir5/blob"})
+    {
+      auto blobClient = m_blobContainerClient->GetBlockBlobClient(blobName);
+      auto emptyContent = Azure::Core::IO::MemoryBodyStream(nullptr, 0);
+      blobClient.Upload(emptyContent);
+      blobs.insert(blobName);
+    }
+
+    for (int32_t partitionDepth : {1, 2, 5})
+    {
+      Azure::Storage::Blobs::ListBlobsParallelOptions options;
+      options.Prefix = prefix;
+      options.PageSizeHint = 1;
+      options.PartitionDepth = partitionDepth;
+      options.Concurrency = 3;
+      std::multiset<std::string> listBlobs;
+      m_blobContainerClient->ListBlobsParallel(
+          [&listBlobs](std::vector<Blobs::Models::BlobItem> page) {
+            EXPECT_FALSE(page.empty());
+            for (const auto& blob : page)
+            {
+              listBlobs.insert(blob.Name);
+            }
+          },
+          options);
+      EXPECT_EQ(std::set<std::string>(listBlobs.begin(), listBlobs.end()), blobs);
+      EXPECT_EQ(listBlobs.size(), blobs.size());
+    }
+  }
+
+  TEST_F(BlobContainerClientTest, ShardedListBlobs)
+  {
+    std::vector<Blobs::BlobContainerClient> shards;
+    for (int i = 0; i < 3; ++i)
+    {
+      shards.push_back(Blobs::BlobContainerClient::CreateFromConnectionString(
+          StandardStorageConnectionString(), LowercaseRandomString()));
+      shards.back().Create();
+    }
+    Blobs::ShardedBlobContainerClient shardedClient(shards);
+
+    const std::string prefix = RandomString() + "-";
+    std::set<std::string> blobs;
+    for (int i = 0; i < 12; ++i)
+    {
+      const auto blobName = prefix + std::to_string(i);
+      auto emptyContent = Azure::Core::IO::MemoryBodyStream(nullptr, 0);
+      shardedClient.GetBlockBlobClient(blobName).Upload(emptyContent);
+      EXPECT_NO_THROW(
+          shards[shardedClient.GetShardIndex(blobName)].GetBlobClient(blobName).GetProperties());
+      blobs.insert(blobName);
+    }
+
+    Blobs::ListBlobsOptions options;
+    options.Prefix = prefix;
+    options.PageSizeHint = 2;
+    std::multiset<std::string> listBlobs;
+    for (auto page = shardedClient.ListBlobs(options); page.HasPage(); page.MoveToNextPage())
+    {
+      EXPECT_EQ(page.Prefix, prefix);
+      EXPECT_LE(page.Blobs.size(), shards.size() * 2);
+      for (const auto& blob : page.Blobs)
+      {
+        listBlobs.insert(blob.Name);
+      }
+    }
+    EXPECT_EQ(std::set<std::string>(listBlobs.begin(), listBlobs.end()), blobs);
+    EXPECT_EQ(listBlobs.size(), blobs.size());
+
+    for (auto& shard : shards)
+    {
+      shard.Delete();
+    }
+  }
+
+  TEST(ShardedBlobContainerClientTest, ConsistentHashing)
+  {
+    std::vector<std::string> blobContainerUrls;
+    for (int i = 0; i < 5; ++i)
+    {
+      blobContainerUrls.push_back(
+          "https://account" + std::to_string(i) + ".blob.core.windows.net/container");
+    }
+    const std::vector<std::string> fourUrls(blobContainerUrls.begin(), blobContainerUrls.end() - 1);
+    const std::vector<std::string> reversedUrls(fourUrls.rbegin(), fourUrls.rend());
+    Blobs::ShardedBlobContainerClient fourShards(fourUrls);
+    Blobs::ShardedBlobContainerClient reversedShards(reversedUrls);
+    Blobs::ShardedBlobContainerClient fiveShards(blobContainerUrls);
+
+    std::vector<int> blobsPerShard(4);
+    int movedBlobs = 0;
+    const int numBlobs = 10000;
+    for (int i = 0; i < numBlobs; ++i)
+    {
+      const auto blobName = "blob" + std::to_string(i);
+      const auto shardIndex = fourShards.GetShardIndex(blobName);
+      ++blobsPerShard[shardIndex];
+
+      // The shard of a blob doesn't depend on the order of the shards.
+      const auto blobUrl = fourShards.GetBlobClient(blobName).GetUrl();
+      EXPECT_EQ(blobUrl, fourUrls[shardIndex] + "/" + blobName);
+      EXPECT_EQ(reversedShards.GetBlobClient(blobName).GetUrl(), blobUrl);
+
+      // A new shard only takes blobs from the others.
+      const auto newShardIndex = fiveShards.GetShardIndex(blobName);
+      if (newShardIndex != shardIndex)
+      {
+        EXPECT_EQ(newShardIndex, 4U);
+        ++movedBlobs;
+      }
+    }
+    for (auto count : blobsPerShard)
+    {
+      EXPECT_GT(count, numBlobs / 4 * 8 / 10);
+      EXPECT_LT(count, numBlobs / 4 * 12 / 10);
+    }
+    EXPECT_GT(movedBlobs, numBlobs / 5 * 8 / 10);
+    EXPECT_LT(movedBlobs, numBlobs / 5 * 12 / 10);
+
+    EXPECT_THROW(
+        Blobs::ShardedBlobContainerClient(std::vector<std::string>()), std::invalid_argument);
+    EXPECT_THROW(
+        Blobs::ShardedBlobContainerClient(
+            std::vector<std::string>{fourUrls[0], fourUrls[0] + "?sig=signature"}),
+        std::invalid_argument);
+  }
+
   TEST_F(BlobContainerClientTest, ListBlobsByHierarchy)
   {
     const std::string delimiter = "/";
@@ -853,6 +1090,53 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_EQ(findResults[0].BlobContainerName, m_containerName);
   }
 
+  TEST_F(BlobContainerClientTest, FindBlobsByTagsParallel)
+  {
+    const std::string tagKey = "k" + RandomString();
+    const std::string tagValue = RandomString();
+    std::set<std::string> blobNames;
+    for (int i = 0; i < 3; ++i)
+    {
+      const std::string blobName = RandomString();
+      Blobs::CreateAppendBlobOptions createOptions;
+      createOptions.Tags = {{tagKey, tagValue}};
+      m_blobContainerClient->GetAppendBlobClient(blobName).Create(createOptions);
+      blobNames.insert(blobName);
+    }
+
+    auto blobServiceClient = Azure::Storage::Blobs::BlobServiceClient::CreateFromConnectionString(
+        StandardStorageConnectionString());
+    Blobs::FindBlobsByTagsParallelOptions options;
+    options.BlobContainerNames = {m_containerName, LowercaseRandomString()};
+    options.PageSizeHint = 1;
+    options.PrefetchPages = 1;
+    std::set<std::string> foundBlobNames;
+    for (int i = 0; i < 30 && foundBlobNames.size() < blobNames.size(); ++i)
+    {
+      foundBlobNames.clear();
+      auto stream = blobServiceClient.FindBlobsByTagsParallel(
+          "\"" + tagKey + "\" = '" + tagValue + "'", options);
+      for (auto page = stream.ReadNextPage(); page.HasValue(); page = stream.ReadNextPage())
+      {
+        for (const auto& item : page.Value())
+        {
+          EXPECT_EQ(item.BlobContainerName, m_containerName);
+          foundBlobNames.insert(item.BlobName);
+        }
+      }
+      if (foundBlobNames.size() < blobNames.size())
+      {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+      }
+    }
+    EXPECT_EQ(foundBlobNames, blobNames);
+
+    EXPECT_THROW(
+        blobServiceClient.FindBlobsByTagsParallel(
+            "@container = '" + m_containerName + "' AND \"" + tagKey + "\" = '" + tagValue + "'"),
+        std::invalid_argument);
+  }
+
   TEST_F(BlobContainerClientTest, AccessConditionTags)
   {
     std::map<std::string, std::string> tags;
@@ -1173,4 +1457,260 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_THROW(blobClient.GetProperties(), StorageException);
   }
 
+  TEST_F(BlobContainerClientTest, UploadFiles)
+  {
+    std::vector<std::pair<std::string, std::string>> files;
+    std::vector<std::vector<uint8_t>> contents;
+    for (int size : {0, 10, 100, 3000})
+    {
+      contents.push_back(RandomBuffer(static_cast<size_t>(size)));
+      files.emplace_back(RandomString(), RandomString());
+      Azure::Storage::_internal::FileWriter fileWriter(files.back().first);
+      fileWriter.Write(contents.back().data(), contents.back().size(), 0);
+    }
+    files.emplace_back(RandomString(), RandomString());
+
+    Blobs::UploadBlobFilesOptions options;
+    options.Concurrency = 2;
+    // The largest file is uploaded in blocks.
+    options.SingleUploadThreshold = 1000;
+    options.AccessTier = Blobs::Models::AccessTier::Cool;
+    auto result = m_blobContainerClient->UploadFiles(files, options);
+
+    ASSERT_EQ(result.Errors.size(), files.size());
+    // The last file doesn't exist.
+    EXPECT_EQ(result.FailedCount, 1);
+    EXPECT_TRUE(result.Errors.back());
+    for (size_t i = 0; i < contents.size(); ++i)
+    {
+      EXPECT_FALSE(result.Errors[i]);
+      auto blobClient = m_blobContainerClient->GetBlobClient(files[i].second);
+      auto download = blobClient.Download();
+      EXPECT_EQ(download.Value.BodyStream->ReadToEnd(), contents[i]);
+      EXPECT_EQ(
+          blobClient.GetProperties().Value.AccessTier.Value(), Blobs::Models::AccessTier::Cool);
+      DeleteFile(files[i].first);
+    }
+  }
+
+  TEST_F(BlobContainerClientTest, SyncFromDirectory)
+  {
+    const std::string directoryName = RandomString();
+    const std::vector<std::string> fileNames = {"a", "b", "dir/c"};
+    _internal::CreateLocalDirectories(directoryName + "/dir");
+    for (const auto& fileName : fileNames)
+    {
+      auto content = RandomBuffer(100);
+      _internal::FileWriter fileWriter(directoryName + "/" + fileName);
+      fileWriter.Write(content.data(), content.size(), 0);
+    }
+
+    Blobs::SyncBlobsFromDirectoryOptions options;
+    options.Prefix = "sync/";
+    options.HashCacheFile = directoryName + ".cache";
+    auto result = m_blobContainerClient->SyncFromDirectory(directoryName, options);
+    EXPECT_EQ(result.NumberOfUploadedFiles, 3);
+    EXPECT_EQ(result.NumberOfSkippedFiles, 0);
+    EXPECT_EQ(result.UploadedSize, 300);
+    auto properties = m_blobContainerClient->GetBlobClient("sync/dir/c").GetProperties().Value;
+    EXPECT_EQ(properties.BlobSize, 100);
+    EXPECT_EQ(properties.HttpHeaders.ContentHash.Algorithm, HashAlgorithm::Md5);
+
+    // Nothing changed.
+    result = m_blobContainerClient->SyncFromDirectory(directoryName, options);
+    EXPECT_EQ(result.NumberOfUploadedFiles, 0);
+    EXPECT_EQ(result.NumberOfSkippedFiles, 3);
+
+    // A changed file is uploaded again, and the blob of a deleted file is deleted.
+    auto content = RandomBuffer(200);
+    {
+      _internal::FileWriter fileWriter(directoryName + "/a");
+      fileWriter.Write(content.data(), content.size(), 0);
+    }
+    DeleteFile(directoryName + "/b");
+    options.DeleteExtraBlobs = true;
+    result = m_blobContainerClient->SyncFromDirectory(directoryName, options);
+    EXPECT_EQ(result.NumberOfUploadedFiles, 1);
+    EXPECT_EQ(result.NumberOfSkippedFiles, 1);
+    EXPECT_EQ(result.NumberOfDeletedBlobs, 1);
+    EXPECT_EQ(result.UploadedSize, 200);
+    EXPECT_EQ(
+        m_blobContainerClient->GetBlobClient("sync/a").Download().Value.BodyStream->ReadToEnd(),
+        content);
+    EXPECT_THROW(
+        m_blobContainerClient->GetBlobClient("sync/b").GetProperties(), StorageException);
+
+    DeleteFile(directoryName + "/a");
+    DeleteFile(directoryName + "/dir/c");
+    DeleteFile(directoryName + ".cache");
+  }
+
+  TEST_F(BlobContainerClientTest, PropertiesCache)
+  {
+    Blobs::BlobClientOptions options;
+    options.PropertiesCache = std::make_shared<Blobs::BlobPropertiesCache>();
+    auto containerClient = Blobs::BlobContainerClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, options);
+    const std::string blobName = RandomString();
+    auto blobClient = containerClient.GetBlockBlobClient(blobName);
+    std::vector<uint8_t> content(100, 'a');
+    blobClient.UploadFrom(content.data(), content.size());
+
+    auto properties = blobClient.GetProperties().Value;
+    EXPECT_EQ(properties.BlobSize, 100);
+    EXPECT_TRUE(options.PropertiesCache->Get(blobClient.GetUrl()).HasValue());
+
+    // Changed by another client, the blob is downloaded again without the cached ETag, and its
+    // properties are got again.
+    auto otherClient = Blobs::BlockBlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, blobName);
+    content.resize(200, 'b');
+    otherClient.UploadFrom(content.data(), content.size());
+    EXPECT_EQ(blobClient.GetProperties().Value.ETag, properties.ETag);
+    EXPECT_EQ(blobClient.Download().Value.BlobSize, 200);
+    EXPECT_FALSE(options.PropertiesCache->Get(blobClient.GetUrl()).HasValue());
+    EXPECT_EQ(blobClient.GetProperties().Value.BlobSize, 200);
+
+    blobClient.Delete();
+    EXPECT_FALSE(options.PropertiesCache->Get(blobClient.GetUrl()).HasValue());
+  }
+
+  namespace {
+    // Serves a blob whose ETag is "new", and records the If-Match header of the requests.
+    class ChangedBlobTransport final : public Azure::Core::Http::HttpTransport {
+    public:
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Http::Request& request,
+          Azure::Core::Context const&) override
+      {
+        const auto& headers = request.GetHeaders();
+        const auto ifMatch = headers.find("if-match");
+        IfMatches.push_back(ifMatch == headers.end() ? std::string() : ifMatch->second);
+        std::unique_ptr<Azure::Core::Http::RawResponse> response;
+        if (ifMatch != headers.end() && ifMatch->second != "\"new\"")
+        {
+          response = std::make_unique<Azure::Core::Http::RawResponse>(
+              1, 1, Azure::Core::Http::HttpStatusCode::PreconditionFailed, "Precondition Failed");
+          response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(nullptr, 0));
+        }
+        else
+        {
+          response = std::make_unique<Azure::Core::Http::RawResponse>(
+              1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+          response->SetHeader("ETag", "\"new\"");
+          response->SetHeader("Last-Modified", "Fri, 01 Jan 2021 00:00:00 GMT");
+          response->SetHeader("x-ms-creation-time", "Fri, 01 Jan 2021 00:00:00 GMT");
+          response->SetHeader("x-ms-blob-type", "BlockBlob");
+          response->SetHeader("x-ms-server-encrypted", "true");
+          response->SetHeader("Content-Length", std::to_string(m_content.size()));
+          response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(
+              reinterpret_cast<const uint8_t*>(m_content.data()), m_content.size()));
+        }
+        response->SetHeader("x-ms-request-id", "request-id");
+        response->SetHeader("Date", "Fri, 01 Jan 2021 00:00:00 GMT");
+        return response;
+      }
+
+      std::vector<std::string> IfMatches;
+
+    private:
+      const std::string m_content = "content";
+    };
+  } // namespace
+
+  TEST(BlobPropertiesCacheTest, DownloadChangedBlob)
+  {
+    auto transport = std::make_shared<ChangedBlobTransport>();
+    Blobs::BlobClientOptions clientOptions;
+    clientOptions.Transport.Transport = transport;
+    clientOptions.PropertiesCache = std::make_shared<Blobs::BlobPropertiesCache>();
+    const std::string url = "https://account.blob.core.windows.net/container/blob";
+    Blobs::BlobClient blobClient(url, clientOptions);
+    auto cacheOldProperties = [&]() {
+      Blobs::Models::BlobProperties properties;
+      properties.ETag = Azure::ETag("\"old\"");
+      clientOptions.PropertiesCache->Set(
+          url,
+          Azure::Response<Blobs::Models::BlobProperties>(
+              std::move(properties),
+              std::make_unique<Azure::Core::Http::RawResponse>(
+                  1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK")));
+    };
+
+    // The download conditioned on the cached ETag fails, the properties are evicted and the blob
+    // is downloaded again without the condition.
+    cacheOldProperties();
+    EXPECT_EQ(blobClient.Download().Value.BlobSize, 7);
+    EXPECT_EQ(transport->IfMatches, std::vector<std::string>({"\"old\"", ""}));
+    EXPECT_FALSE(clientOptions.PropertiesCache->Get(url).HasValue());
+
+    transport->IfMatches.clear();
+    cacheOldProperties();
+    Azure::Nullable<Azure::Response<Blobs::Models::DownloadBlobResult>> asyncResponse;
+    std::exception_ptr asyncError;
+    blobClient.DownloadAsync(
+        Blobs::DownloadBlobOptions(),
+        Azure::Core::Context(),
+        [&](Azure::Nullable<Azure::Response<Blobs::Models::DownloadBlobResult>> response,
+            std::exception_ptr error) {
+          asyncResponse = std::move(response);
+          asyncError = error;
+        });
+    EXPECT_FALSE(asyncError);
+    ASSERT_TRUE(asyncResponse.HasValue());
+    EXPECT_EQ(asyncResponse.Value().Value.BlobSize, 7);
+    EXPECT_EQ(transport->IfMatches, std::vector<std::string>({"\"old\"", ""}));
+    EXPECT_FALSE(clientOptions.PropertiesCache->Get(url).HasValue());
+
+    // The downloads with conditions of the caller aren't conditioned on the cached ETag.
+    transport->IfMatches.clear();
+    cacheOldProperties();
+    Blobs::DownloadBlobOptions options;
+    options.AccessConditions.IfModifiedSince = Azure::DateTime(2000, 1, 1);
+    EXPECT_NO_THROW(blobClient.Download(options));
+    options.AccessConditions.IfMatch = Azure::ETag("\"other\"");
+    EXPECT_THROW(blobClient.Download(options), StorageException);
+    EXPECT_EQ(transport->IfMatches, std::vector<std::string>({"", "\"other\""}));
+    EXPECT_TRUE(clientOptions.PropertiesCache->Get(url).HasValue());
+  }
+
+  TEST(BlobPropertiesCacheTest, EvictsLeastRecentlyUsed)
+  {
+    auto makeResponse = [](int64_t blobSize) {
+      Blobs::Models::BlobProperties properties;
+      properties.BlobSize = blobSize;
+      auto rawResponse = std::make_unique<Azure::Core::Http::RawResponse>(
+          1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+      rawResponse->SetHeader("x-ms-blob-type", "BlockBlob");
+      return Azure::Response<Blobs::Models::BlobProperties>(
+          std::move(properties), std::move(rawResponse));
+    };
+
+    Blobs::BlobPropertiesCacheOptions options;
+    options.Capacity = 2;
+    options.ShardCount = 1;
+    Blobs::BlobPropertiesCache cache(options);
+    cache.Set("a", makeResponse(1));
+    cache.Set("b", makeResponse(2));
+    auto cached = cache.Get("a");
+    ASSERT_TRUE(cached.HasValue());
+    EXPECT_EQ(cached.Value().Value.BlobSize, 1);
+    EXPECT_EQ(cached.Value().RawResponse->GetHeaders().at("x-ms-blob-type"), "BlockBlob");
+    cache.Set("c", makeResponse(3));
+    EXPECT_TRUE(cache.Get("a").HasValue());
+    EXPECT_FALSE(cache.Get("b").HasValue());
+    EXPECT_TRUE(cache.Get("c").HasValue());
+
+    cache.Set("a", makeResponse(4));
+    EXPECT_EQ(cache.Get("a").Value().Value.BlobSize, 4);
+    cache.Remove("a");
+    EXPECT_FALSE(cache.Get("a").HasValue());
+
+    options.TimeToLive = std::chrono::milliseconds(1);
+    Blobs::BlobPropertiesCache expiringCache(options);
+    expiringCache.Set("a", makeResponse(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(expiringCache.Get("a").HasValue());
+  }
+
 }}} // namespace Azure::Storage::Test
@@ -3,6 +3,8 @@
 
 #include <azure/identity/client_secret_credential.hpp>
 #include <azure/storage/blobs/blob_sas_builder.hpp>
+#include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/constants.hpp>
 
 #include <chrono>
 
@@ -548,4 +550,41 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST(BlobSasBuilderTest, GenerateSasTokens)
+  {
+    const std::string accountKey = Azure::Core::Convert::Base64Encode(RandomBuffer(64));
+    StorageSharedKeyCredential credential("account", accountKey);
+
+    Sas::BlobSasBuilder builder;
+    builder.Protocol = Sas::SasProtocol::HttpsOnly;
+    builder.ExpiresOn
+        = Azure::DateTime::Parse("2030-01-01T00:00:00Z", Azure::DateTime::DateFormat::Rfc3339);
+    builder.BlobContainerName = "container";
+    builder.Resource = Sas::BlobSasResource::Blob;
+    builder.ContentType = "text/plain";
+    builder.SetPermissions(Sas::BlobSasPermissions::Read);
+
+    const std::vector<std::string> blobNames = {"a", "b/c", "d e"};
+    const auto sasTokens = builder.GenerateSasTokens(blobNames, credential);
+    ASSERT_EQ(sasTokens.size(), blobNames.size());
+    for (size_t i = 0; i < blobNames.size(); ++i)
+    {
+      builder.BlobName = blobNames[i];
+      EXPECT_EQ(sasTokens[i], builder.GenerateSasToken(credential));
+    }
+
+    const std::string stringToSign
+        = std::string("r\n\n2030-01-01T00:00:00Z\n/blob/account/container/d e\n\n\nhttps\n")
+        + _internal::DefaultSasVersion + "\nb\n\n\n\n\n\ntext/plain";
+    const std::string signature = Azure::Core::Convert::Base64Encode(_internal::HmacSha256(
+        std::vector<uint8_t>(stringToSign.begin(), stringToSign.end()),
+        Azure::Core::Convert::Base64Decode(accountKey)));
+    EXPECT_NE(
+        sasTokens[2].find("&sig=" + _internal::UrlEncodeQueryParameter(signature) + "&"),
+        std::string::npos);
+
+    builder.Resource = Sas::BlobSasResource::BlobContainer;
+    EXPECT_THROW(builder.GenerateSasTokens(blobNames, credential), std::invalid_argument);
+  }
+
 }}} // namespace Azure::Storage::Test
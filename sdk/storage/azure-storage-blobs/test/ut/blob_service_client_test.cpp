@@ -431,4 +431,113 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_FALSE(userDelegationKey.Value.empty());
   }
 
+  TEST_F(BlobServiceClientTest, UserDelegationKeyCache)
+  {
+    auto blobServiceClient1 = Blobs::BlobServiceClient(
+        m_blobServiceClient.GetUrl(),
+        std::make_shared<Azure::Identity::ClientSecretCredential>(
+            AadTenantId(), AadClientId(), AadClientSecret()));
+    auto accountName
+        = _internal::ParseConnectionString(StandardStorageConnectionString()).AccountName;
+
+    Blobs::UserDelegationKeyCacheOptions options;
+    options.KeyValidity = std::chrono::hours(2);
+    options.RefreshBeforeExpiry = std::chrono::hours(1);
+    Blobs::UserDelegationKeyCache keyCache(blobServiceClient1, accountName, options);
+
+    std::vector<std::thread> threads;
+    std::vector<Blobs::Models::UserDelegationKey> keys(4);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+      threads.emplace_back([&, i]() { keys[i] = keyCache.GetKey(); });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    for (const auto& key : keys)
+    {
+      EXPECT_EQ(key.Value, keys[0].Value);
+    }
+    EXPECT_GT(
+        static_cast<std::chrono::system_clock::time_point>(keys[0].SignedExpiresOn),
+        std::chrono::system_clock::now() + std::chrono::minutes(90));
+
+    Sas::BlobSasBuilder sasBuilder;
+    sasBuilder.ExpiresOn = std::chrono::system_clock::now() + std::chrono::minutes(30);
+    sasBuilder.BlobContainerName = LowercaseRandomString();
+    sasBuilder.Resource = Sas::BlobSasResource::BlobContainer;
+    sasBuilder.SetPermissions(Sas::BlobContainerSasPermissions::Read);
+    auto sasToken = keyCache.GenerateSasToken(sasBuilder);
+    EXPECT_EQ(sasToken, sasBuilder.GenerateSasToken(keys[0], accountName));
+
+    keyCache.Stop();
+  }
+
+  TEST_F(BlobServiceClientTest, SubmitBulkOperations)
+  {
+    const std::string containerName = LowercaseRandomString();
+    auto containerClient = m_blobServiceClient.GetBlobContainerClient(containerName);
+
+    // The containers are created before their blobs. One of two creations of a container fails.
+    Blobs::BlobBulkOperations createOperations;
+    createOperations.CreateBlobContainer(containerName);
+    createOperations.CreateBlobContainer(containerName);
+    auto createResult = m_blobServiceClient.SubmitBulkOperations(createOperations);
+    EXPECT_EQ(createResult.FailedCount, 1);
+
+    std::vector<std::string> blobNames;
+    std::vector<uint8_t> content(10);
+    for (int i = 0; i < 5; ++i)
+    {
+      blobNames.push_back(RandomString());
+      containerClient.GetBlockBlobClient(blobNames.back())
+          .UploadFrom(content.data(), content.size());
+    }
+
+    for (bool useBatch : {false, true})
+    {
+      Blobs::SubmitBlobBulkOperationsOptions options;
+      if (useBatch)
+      {
+        options.BatchClient = std::make_shared<Blobs::BlobBatchClient>(
+            Blobs::BlobBatchClient::CreateFromConnectionString(StandardStorageConnectionString()));
+      }
+      options.Concurrency = 2;
+      Blobs::BlobBulkOperations operations;
+      operations.SetBlobContainerMetadata(containerName, {{"key", useBatch ? "batch" : "single"}});
+      operations.SetBlobMetadata(containerName, blobNames[0], {{"key", "value"}});
+      operations.SetBlobAccessTier(containerName, blobNames[1], Blobs::Models::AccessTier::Cool);
+      auto deleteId = operations.DeleteBlob(containerName, blobNames[useBatch ? 2 : 3]);
+      auto deleteMissingId = operations.DeleteBlob(containerName, RandomString());
+      auto result = m_blobServiceClient.SubmitBulkOperations(operations, options);
+
+      ASSERT_EQ(result.Errors.size(), 5U);
+      EXPECT_EQ(result.FailedCount, 1);
+      EXPECT_FALSE(result.Errors[deleteId]);
+      try
+      {
+        std::rethrow_exception(result.Errors[deleteMissingId]);
+      }
+      catch (const StorageException& e)
+      {
+        EXPECT_EQ(e.StatusCode, Azure::Core::Http::HttpStatusCode::NotFound);
+      }
+      EXPECT_EQ(
+          containerClient.GetProperties().Value.Metadata.at("key"), useBatch ? "batch" : "single");
+    }
+    EXPECT_EQ(
+        containerClient.GetBlobClient(blobNames[0]).GetProperties().Value.Metadata.at("key"),
+        "value");
+    EXPECT_EQ(
+        containerClient.GetBlobClient(blobNames[1]).GetProperties().Value.AccessTier.Value(),
+        Blobs::Models::AccessTier::Cool);
+    EXPECT_THROW(containerClient.GetBlobClient(blobNames[2]).GetProperties(), StorageException);
+    EXPECT_THROW(containerClient.GetBlobClient(blobNames[3]).GetProperties(), StorageException);
+
+    Blobs::BlobBulkOperations deleteOperations;
+    deleteOperations.DeleteBlobContainer(containerName);
+    EXPECT_EQ(m_blobServiceClient.SubmitBulkOperations(deleteOperations).FailedCount, 0);
+  }
+
 }}} // namespace Azure::Storage::Test
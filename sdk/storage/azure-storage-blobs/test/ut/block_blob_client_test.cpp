@@ -3,6 +3,7 @@
 
 #include "block_blob_client_test.hpp"
 
+#include <cstdio>
 #include <future>
 #include <random>
 #include <vector>
@@ -10,6 +11,7 @@
 #include <azure/core/cryptography/hash.hpp>
 #include <azure/storage/common/crypt.hpp>
 #include <azure/storage/common/internal/file_io.hpp>
+#include <azure/storage/common/internal/xml_wrapper.hpp>
 
 namespace Azure { namespace Storage { namespace Blobs { namespace Models {
 
@@ -528,6 +530,159 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_TRUE(res.Value.UncommittedBlocks.empty());
   }
 
+  TEST_F(BlockBlobClientTest, GetBlockListStreaming)
+  {
+    auto blockBlobClient = Azure::Storage::Blobs::BlockBlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, RandomString());
+    const auto content = RandomBuffer(10);
+    std::vector<std::string> committedBlockIds;
+    for (int i = 0; i < 3; ++i)
+    {
+      committedBlockIds.push_back(Base64EncodeText(std::to_string(i)));
+      auto blockContent = Azure::Core::IO::MemoryBodyStream(content.data(), content.size());
+      blockBlobClient.StageBlock(committedBlockIds.back(), blockContent);
+    }
+    blockBlobClient.CommitBlockList(committedBlockIds);
+    const std::string uncommittedBlockId = Base64EncodeText("3");
+    auto blockContent = Azure::Core::IO::MemoryBodyStream(content.data(), content.size() / 2);
+    blockBlobClient.StageBlock(uncommittedBlockId, blockContent);
+
+    Blobs::GetBlockListOptions options;
+    options.ListType = Blobs::Models::BlockListType::All;
+    const auto expected = blockBlobClient.GetBlockList(options).Value;
+    std::vector<Blobs::Models::BlobBlock> committedBlocks;
+    std::vector<Blobs::Models::BlobBlock> uncommittedBlocks;
+    auto res = blockBlobClient.GetBlockListStreaming(
+        [&](const Blobs::Models::CompactBlobBlock* blocks, size_t count) {
+          for (size_t i = 0; i < count; ++i)
+          {
+            Blobs::Models::BlobBlock block;
+            block.Name = std::string(blocks[i].Name, blocks[i].NameLength);
+            block.Size = blocks[i].Size;
+            (blocks[i].IsCommitted ? committedBlocks : uncommittedBlocks).push_back(block);
+          }
+        },
+        options);
+    EXPECT_EQ(res.Value.ETag, expected.ETag);
+    EXPECT_EQ(res.Value.LastModified, expected.LastModified);
+    EXPECT_EQ(res.Value.BlobSize, expected.BlobSize);
+    ASSERT_EQ(committedBlocks.size(), expected.CommittedBlocks.size());
+    for (size_t i = 0; i < committedBlocks.size(); ++i)
+    {
+      EXPECT_EQ(committedBlocks[i].Name, expected.CommittedBlocks[i].Name);
+      EXPECT_EQ(committedBlocks[i].Size, expected.CommittedBlocks[i].Size);
+    }
+    ASSERT_EQ(uncommittedBlocks.size(), 1U);
+    EXPECT_EQ(uncommittedBlocks[0].Name, uncommittedBlockId);
+    EXPECT_EQ(uncommittedBlocks[0].Size, static_cast<int64_t>(content.size() / 2));
+  }
+
+  TEST_F(BlockBlobClientTest, AsyncOperations)
+  {
+    auto blockBlobClient = Azure::Storage::Blobs::BlockBlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, RandomString());
+    auto content = RandomBuffer(100);
+
+    // The results are got through futures, as a caller without coroutines would.
+    auto memoryStream = Azure::Core::IO::MemoryBodyStream(content.data(), content.size());
+    Blobs::UploadBlockBlobOptions uploadOptions;
+    uploadOptions.ComputeTransactionalContentHash = HashAlgorithm::Md5;
+    std::promise<Blobs::Models::UploadBlockBlobResult> uploadResult;
+    blockBlobClient.UploadAsync(
+        memoryStream,
+        uploadOptions,
+        Azure::Core::Context(),
+        [&](Azure::Nullable<Azure::Response<Blobs::Models::UploadBlockBlobResult>> response,
+            std::exception_ptr error) {
+          if (error)
+          {
+            uploadResult.set_exception(error);
+            return;
+          }
+          uploadResult.set_value(std::move(response.Value().Value));
+        });
+    EXPECT_TRUE(uploadResult.get_future().get().ETag.HasValue());
+
+    std::promise<std::vector<uint8_t>> downloadedContent;
+    blockBlobClient.DownloadAsync(
+        Blobs::DownloadBlobOptions(),
+        Azure::Core::Context(),
+        [&](Azure::Nullable<Azure::Response<Blobs::Models::DownloadBlobResult>> response,
+            std::exception_ptr error) {
+          if (error)
+          {
+            downloadedContent.set_exception(error);
+            return;
+          }
+          downloadedContent.set_value(response.Value().Value.BodyStream->ReadToEnd());
+        });
+    EXPECT_EQ(downloadedContent.get_future().get(), content);
+
+    memoryStream.Rewind();
+    std::promise<void> stageResult;
+    blockBlobClient.StageBlockAsync(
+        Base64EncodeText("0"),
+        memoryStream,
+        Blobs::StageBlockOptions(),
+        Azure::Core::Context(),
+        [&](Azure::Nullable<Azure::Response<Blobs::Models::StageBlockResult>>,
+            std::exception_ptr error) {
+          if (error)
+          {
+            stageResult.set_exception(error);
+            return;
+          }
+          stageResult.set_value();
+        });
+    stageResult.get_future().get();
+    Blobs::GetBlockListOptions blockListOptions;
+    blockListOptions.ListType = Blobs::Models::BlockListType::Uncommitted;
+    EXPECT_EQ(blockBlobClient.GetBlockList(blockListOptions).Value.UncommittedBlocks.size(), 1U);
+
+    // The errors are passed to the callback.
+    auto missingBlobClient = m_blobContainerClient->GetBlobClient(RandomString());
+    std::promise<void> missingResult;
+    missingBlobClient.DownloadAsync(
+        Blobs::DownloadBlobOptions(),
+        Azure::Core::Context(),
+        [&](Azure::Nullable<Azure::Response<Blobs::Models::DownloadBlobResult>>,
+            std::exception_ptr error) {
+          if (error)
+          {
+            missingResult.set_exception(error);
+            return;
+          }
+          missingResult.set_value();
+        });
+    EXPECT_THROW(missingResult.get_future().get(), StorageException);
+  }
+
+  TEST_F(BlockBlobClientTest, CopyFromUriParallel)
+  {
+    auto blockBlobClient = Azure::Storage::Blobs::BlockBlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, RandomString());
+
+    Blobs::CopyBlockBlobFromUriParallelOptions options;
+    options.TransferOptions.ChunkSize = 3_MB;
+    options.TransferOptions.Concurrency = 2;
+    options.Tags = {{"key1", "value1"}};
+    auto res = blockBlobClient.CopyFromUriParallel(m_blockBlobClient->GetUrl() + GetSas(), options);
+    EXPECT_TRUE(res.Value.ETag.HasValue());
+
+    // The blocks are staged from ranges of the source, with its HTTP headers and metadata.
+    Blobs::GetBlockListOptions getBlockListOptions;
+    getBlockListOptions.ListType = Blobs::Models::BlockListType::All;
+    auto blockList = blockBlobClient.GetBlockList(getBlockListOptions).Value;
+    EXPECT_EQ(blockList.CommittedBlocks.size(), 3U);
+    EXPECT_TRUE(blockList.UncommittedBlocks.empty());
+    auto properties = blockBlobClient.GetProperties().Value;
+    EXPECT_EQ(properties.BlobSize, static_cast<int64_t>(m_blobContent.size()));
+    EXPECT_EQ(properties.Metadata, m_blobUploadOptions.Metadata);
+    EXPECT_EQ(properties.HttpHeaders.ContentType, m_blobUploadOptions.HttpHeaders.ContentType);
+    EXPECT_EQ(properties.TagCount.Value(), 1);
+    EXPECT_EQ(blockBlobClient.Download().Value.BodyStream->ReadToEnd(), m_blobContent);
+  }
+
   TEST_F(BlockBlobClientTest, ConcurrentDownload)
   {
     auto testDownloadToBuffer = [](int concurrency,
@@ -760,6 +915,893 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(BlockBlobClientTest, DownloadWithPrefetch)
+  {
+    for (int c : {1, 2, 4})
+    {
+      Blobs::DownloadBlobOptions options;
+      options.PrefetchOptions.Concurrency = c;
+      options.PrefetchOptions.ChunkSize = 64_KB;
+      auto res = m_blockBlobClient->Download(options);
+      EXPECT_EQ(res.Value.BodyStream->Length(), static_cast<int64_t>(m_blobContent.size()));
+      EXPECT_EQ(res.Value.BodyStream->ReadToEnd(), m_blobContent);
+      EXPECT_EQ(res.Value.BlobSize, static_cast<int64_t>(m_blobContent.size()));
+      EXPECT_EQ(res.Value.ContentRange.Offset, 0);
+      EXPECT_EQ(
+          res.Value.ContentRange.Length.Value(), static_cast<int64_t>(m_blobContent.size()));
+
+      options.Range = Core::Http::HttpRange();
+      options.Range.Value().Offset = 3_KB;
+      options.Range.Value().Length = 300_KB;
+      res = m_blockBlobClient->Download(options);
+      EXPECT_EQ(
+          res.Value.BodyStream->ReadToEnd(),
+          std::vector<uint8_t>(
+              m_blobContent.begin() + static_cast<ptrdiff_t>(3_KB),
+              m_blobContent.begin() + static_cast<ptrdiff_t>(303_KB)));
+      EXPECT_EQ(res.Value.ContentRange.Offset, static_cast<int64_t>(3_KB));
+      EXPECT_EQ(res.Value.ContentRange.Length.Value(), static_cast<int64_t>(300_KB));
+    }
+
+    // Destroying the stream before it's read cancels the fetches.
+    Blobs::DownloadBlobOptions options;
+    options.PrefetchOptions.Concurrency = 4;
+    options.PrefetchOptions.ChunkSize = 4_KB;
+    auto res = m_blockBlobClient->Download(options);
+    std::vector<uint8_t> buffer(1_KB);
+    EXPECT_EQ(res.Value.BodyStream->ReadToCount(buffer.data(), buffer.size()), buffer.size());
+    res.Value.BodyStream.reset();
+  }
+
+  TEST_F(BlockBlobClientTest, ConcurrentDownloadToSink)
+  {
+    for (int c : {1, 2, 4})
+    {
+      for (int64_t chunkSize :
+           {static_cast<int64_t>(64_KB),
+            static_cast<int64_t>(1_MB),
+            static_cast<int64_t>(m_blobContent.size())})
+      {
+        Blobs::DownloadBlobToOptions options;
+        options.TransferOptions.Concurrency = c;
+        options.TransferOptions.InitialChunkSize = 16_KB;
+        options.TransferOptions.ChunkSize = chunkSize;
+        std::vector<uint8_t> downloadContent;
+        auto res = m_blockBlobClient->DownloadTo(
+            [&downloadContent, chunkSize](const uint8_t* data, size_t size) {
+              EXPECT_LE(static_cast<int64_t>(size), chunkSize);
+              downloadContent.insert(downloadContent.end(), data, data + size);
+            },
+            options);
+        EXPECT_EQ(downloadContent, m_blobContent);
+        EXPECT_EQ(res.Value.BlobSize, static_cast<int64_t>(m_blobContent.size()));
+        EXPECT_EQ(res.Value.ContentRange.Offset, 0);
+        EXPECT_EQ(
+            res.Value.ContentRange.Length.Value(), static_cast<int64_t>(m_blobContent.size()));
+
+        options.Range = Core::Http::HttpRange();
+        options.Range.Value().Offset = 3_KB;
+        options.Range.Value().Length = 100_KB;
+        downloadContent.clear();
+        res = m_blockBlobClient->DownloadTo(
+            [&downloadContent](const uint8_t* data, size_t size) {
+              downloadContent.insert(downloadContent.end(), data, data + size);
+            },
+            options);
+        EXPECT_EQ(
+            downloadContent,
+            std::vector<uint8_t>(
+                m_blobContent.begin() + static_cast<ptrdiff_t>(3_KB),
+                m_blobContent.begin() + static_cast<ptrdiff_t>(103_KB)));
+        EXPECT_EQ(res.Value.ContentRange.Offset, static_cast<int64_t>(3_KB));
+        EXPECT_EQ(res.Value.ContentRange.Length.Value(), static_cast<int64_t>(100_KB));
+      }
+    }
+
+    // The download stops at the first exception of the sink.
+    Blobs::DownloadBlobToOptions options;
+    options.TransferOptions.InitialChunkSize = 4_KB;
+    options.TransferOptions.ChunkSize = 4_KB;
+    EXPECT_THROW(
+        m_blockBlobClient->DownloadTo(
+            [](const uint8_t*, size_t) { throw std::runtime_error("sink failed"); }, options),
+        std::runtime_error);
+  }
+
+  TEST_F(BlockBlobClientTest, ConcurrentTransferProgress)
+  {
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    const auto blobSize = static_cast<int64_t>(m_blobContent.size());
+    std::vector<std::pair<int64_t, int64_t>> reports;
+    auto progressHandler = [&reports](int64_t bytesTransferred, int64_t totalBytes) {
+      reports.emplace_back(bytesTransferred, totalBytes);
+    };
+
+    Blobs::UploadBlockBlobFromOptions uploadOptions;
+    uploadOptions.TransferOptions.SingleUploadThreshold = 0;
+    uploadOptions.TransferOptions.ChunkSize = 1_MB;
+    uploadOptions.TransferOptions.Concurrency = 4;
+    uploadOptions.TransferOptions.ProgressHandler = progressHandler;
+    uploadOptions.TransferOptions.ProgressInterval = std::chrono::milliseconds(0);
+    blockBlobClient.UploadFrom(m_blobContent.data(), m_blobContent.size(), uploadOptions);
+    ASSERT_FALSE(reports.empty());
+    for (size_t i = 1; i < reports.size(); ++i)
+    {
+      EXPECT_LE(reports[i - 1].first, reports[i].first);
+    }
+    EXPECT_EQ(reports.back(), std::make_pair(blobSize, blobSize));
+
+    reports.clear();
+    Blobs::DownloadBlobToOptions downloadOptions;
+    downloadOptions.TransferOptions.InitialChunkSize = 1_MB;
+    downloadOptions.TransferOptions.ChunkSize = 1_MB;
+    downloadOptions.TransferOptions.Concurrency = 4;
+    downloadOptions.TransferOptions.ProgressHandler = progressHandler;
+    downloadOptions.TransferOptions.ProgressInterval = std::chrono::hours(1);
+    std::vector<uint8_t> downloadContent(m_blobContent.size());
+    blockBlobClient.DownloadTo(downloadContent.data(), downloadContent.size(), downloadOptions);
+    EXPECT_EQ(downloadContent, m_blobContent);
+    // Only the final count is reported within the interval.
+    ASSERT_EQ(reports.size(), 1U);
+    EXPECT_EQ(reports.back(), std::make_pair(blobSize, blobSize));
+
+    auto statistics = blockBlobClient.GetTransferStatistics();
+    EXPECT_EQ(statistics.BytesUploaded, blobSize);
+    EXPECT_EQ(statistics.BytesDownloaded, blobSize);
+    EXPECT_EQ(statistics.UploadsCompleted, 1);
+    EXPECT_EQ(statistics.DownloadsCompleted, 1);
+  }
+
+  TEST_F(BlockBlobClientTest, DownloadToWithContentCache)
+  {
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    blockBlobClient.UploadFrom(m_blobContent.data(), m_blobContent.size());
+    const auto blobSize = static_cast<int64_t>(m_blobContent.size());
+
+    Blobs::BlobContentCacheOptions cacheOptions;
+    cacheOptions.Directory = RandomString();
+    Blobs::DownloadBlobToOptions options;
+    options.ContentCache = std::make_shared<Blobs::BlobContentCache>(cacheOptions);
+    std::vector<uint8_t> downloadContent(m_blobContent.size());
+    blockBlobClient.DownloadTo(downloadContent.data(), downloadContent.size(), options);
+    EXPECT_EQ(downloadContent, m_blobContent);
+    EXPECT_EQ(options.ContentCache->GetSize(), blobSize);
+
+    // Served from the cache, to a file and as a range.
+    const std::string tempFilename = RandomString();
+    auto response = blockBlobClient.DownloadTo(tempFilename, options);
+    EXPECT_EQ(ReadFile(tempFilename), m_blobContent);
+    EXPECT_EQ(response.Value.BlobSize, blobSize);
+    EXPECT_EQ(response.Value.Details.ETag, blockBlobClient.GetProperties().Value.ETag);
+    DeleteFile(tempFilename);
+    options.Range = Core::Http::HttpRange();
+    options.Range.Value().Offset = 100;
+    options.Range.Value().Length = 200;
+    response = blockBlobClient.DownloadTo(downloadContent.data(), downloadContent.size(), options);
+    EXPECT_EQ(response.Value.ContentRange.Offset, 100);
+    EXPECT_EQ(response.Value.ContentRange.Length.Value(), 200);
+    EXPECT_TRUE(std::equal(
+        downloadContent.begin(), downloadContent.begin() + 200, m_blobContent.begin() + 100));
+    options.Range.Reset();
+
+    // A blob changed is downloaded again.
+    std::vector<uint8_t> newContent(1024, 'x');
+    blockBlobClient.UploadFrom(newContent.data(), newContent.size());
+    response = blockBlobClient.DownloadTo(downloadContent.data(), downloadContent.size(), options);
+    EXPECT_EQ(response.Value.BlobSize, static_cast<int64_t>(newContent.size()));
+    EXPECT_TRUE(std::equal(newContent.begin(), newContent.end(), downloadContent.begin()));
+    EXPECT_EQ(options.ContentCache->GetSize(), static_cast<int64_t>(newContent.size()));
+
+    // The content is reused by another cache.
+    options.ContentCache.reset();
+    options.ContentCache = std::make_shared<Blobs::BlobContentCache>(cacheOptions);
+    EXPECT_EQ(options.ContentCache->GetSize(), static_cast<int64_t>(newContent.size()));
+
+    // Blobs larger than the cache aren't cached.
+    cacheOptions.MaxSize = 100;
+    options.ContentCache = std::make_shared<Blobs::BlobContentCache>(cacheOptions);
+    EXPECT_EQ(options.ContentCache->GetSize(), 0);
+    blockBlobClient.DownloadTo(downloadContent.data(), downloadContent.size(), options);
+    EXPECT_EQ(options.ContentCache->GetSize(), 0);
+    DeleteFile(cacheOptions.Directory);
+  }
+
+  TEST_F(BlockBlobClientTest, ConcurrentUploadFromMemoryMappedFile)
+  {
+    std::string tempFilename = RandomString();
+    {
+      _internal::FileWriter fileWriter(tempFilename);
+      fileWriter.Write(m_blobContent.data(), m_blobContent.size(), 0);
+    }
+    for (int c : {1, 4})
+    {
+      auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+      Blobs::UploadBlockBlobFromOptions options;
+      options.TransferOptions.SingleUploadThreshold = 0;
+      options.TransferOptions.ChunkSize = 1_MB;
+      options.TransferOptions.Concurrency = c;
+      options.TransferOptions.UseMemoryMappedFile = true;
+      blockBlobClient.UploadFrom(tempFilename, options);
+
+      EXPECT_EQ(
+          blockBlobClient.GetBlockList().Value.CommittedBlocks.size(),
+          (m_blobContent.size() + 1_MB - 1) / 1_MB);
+      std::vector<uint8_t> downloadContent(m_blobContent.size());
+      blockBlobClient.DownloadTo(downloadContent.data(), downloadContent.size());
+      EXPECT_EQ(downloadContent, m_blobContent);
+    }
+    DeleteFile(tempFilename);
+  }
+
+  TEST_F(BlockBlobClientTest, ConcurrentUnbufferedFileIo)
+  {
+    std::string tempFilename = RandomString();
+    {
+      _internal::FileWriter fileWriter(tempFilename);
+      fileWriter.Write(m_blobContent.data(), m_blobContent.size(), 0);
+    }
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    Blobs::UploadBlockBlobFromOptions uploadOptions;
+    uploadOptions.TransferOptions.SingleUploadThreshold = 0;
+    uploadOptions.TransferOptions.ChunkSize = 1_MB;
+    uploadOptions.TransferOptions.Concurrency = 4;
+    uploadOptions.TransferOptions.UseUnbufferedFileIo = true;
+    blockBlobClient.UploadFrom(tempFilename, uploadOptions);
+    DeleteFile(tempFilename);
+
+    // Chunks of unaligned sizes, at unaligned offsets.
+    Blobs::DownloadBlobToOptions downloadOptions;
+    downloadOptions.Range = Core::Http::HttpRange();
+    downloadOptions.Range.Value().Offset = 123;
+    downloadOptions.TransferOptions.InitialChunkSize = 1_MB + 1;
+    downloadOptions.TransferOptions.ChunkSize = 1_MB - 1;
+    downloadOptions.TransferOptions.Concurrency = 4;
+    downloadOptions.TransferOptions.UseUnbufferedFileIo = true;
+    downloadOptions.TransferOptions.PreallocateFile = true;
+    blockBlobClient.DownloadTo(tempFilename, downloadOptions);
+    EXPECT_EQ(
+        ReadFile(tempFilename),
+        std::vector<uint8_t>(m_blobContent.begin() + 123, m_blobContent.end()));
+    DeleteFile(tempFilename);
+  }
+
+  TEST_F(BlockBlobClientTest, ConcurrentDownloadToFileAsync)
+  {
+    for (bool unbuffered : {false, true})
+    {
+      std::string tempFilename = RandomString();
+      Blobs::DownloadBlobToOptions options;
+      options.TransferOptions.InitialChunkSize = 1_MB + 1;
+      options.TransferOptions.ChunkSize = 1_MB - 1;
+      options.TransferOptions.Concurrency = 4;
+      options.TransferOptions.UseUnbufferedFileIo = unbuffered;
+      options.TransferOptions.UseAsyncFileIo = true;
+      m_blockBlobClient->DownloadTo(tempFilename, options);
+      EXPECT_EQ(ReadFile(tempFilename), m_blobContent);
+      DeleteFile(tempFilename);
+    }
+  }
+
+  TEST_F(BlockBlobClientTest, ConcurrentDownloadToMemoryMappedFile)
+  {
+    std::string tempFilename = RandomString();
+    Blobs::DownloadBlobToOptions options;
+    options.Range = Core::Http::HttpRange();
+    options.Range.Value().Offset = 123;
+    options.TransferOptions.InitialChunkSize = 1_MB + 1;
+    options.TransferOptions.ChunkSize = 1_MB - 1;
+    options.TransferOptions.Concurrency = 4;
+    options.TransferOptions.UseMemoryMappedFile = true;
+    options.TransferOptions.ComputeContentCrc64 = true;
+    auto res = m_blockBlobClient->DownloadTo(tempFilename, options);
+    const std::vector<uint8_t> expected(m_blobContent.begin() + 123, m_blobContent.end());
+    EXPECT_EQ(ReadFile(tempFilename), expected);
+    ASSERT_TRUE(res.Value.ContentCrc64.HasValue());
+    EXPECT_EQ(
+        res.Value.ContentCrc64.Value().Value, Crc64Hash().Final(expected.data(), expected.size()));
+    DeleteFile(tempFilename);
+  }
+
+  namespace {
+    // Answers every request with the properties of a 1GiB blob, and records the requests.
+    class BlobPropertiesTransport final : public Azure::Core::Http::HttpTransport {
+    public:
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Http::Request& request,
+          Azure::Core::Context const&) override
+      {
+        const auto& headers = request.GetHeaders();
+        Hosts.push_back(request.GetUrl().GetHost());
+        Authorized.push_back(headers.find("Authorization") != headers.end());
+        auto response = std::make_unique<Azure::Core::Http::RawResponse>(
+            1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+        response->SetHeader("x-ms-request-id", "request-id");
+        response->SetHeader("Date", "Fri, 01 Jan 2021 00:00:00 GMT");
+        response->SetHeader("ETag", "\"etag\"");
+        response->SetHeader("Last-Modified", "Fri, 01 Jan 2021 00:00:00 GMT");
+        response->SetHeader("x-ms-creation-time", "Fri, 01 Jan 2021 00:00:00 GMT");
+        response->SetHeader("x-ms-blob-type", "BlockBlob");
+        response->SetHeader("x-ms-server-encrypted", "true");
+        response->SetHeader("Content-Length", std::to_string(1024 * 1024 * 1024));
+        response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(nullptr, 0));
+        return response;
+      }
+
+      std::vector<std::string> Hosts;
+      std::vector<bool> Authorized;
+    };
+  } // namespace
+
+  TEST(BlockBlobClientOfflineTest, CopyFromUriParallelSourceOptions)
+  {
+    auto transport = std::make_shared<BlobPropertiesTransport>();
+    Blobs::BlobClientOptions clientOptions;
+    clientOptions.Transport.Transport = transport;
+    Blobs::BlockBlobClient blockBlobClient(
+        "https://destination.blob.core.windows.net/container/blob",
+        std::make_shared<StorageSharedKeyCredential>("destination", "a2V5"),
+        clientOptions);
+    const std::string sourceUri = "https://source.blob.core.windows.net/container/blob?sig=abc";
+
+    // The properties of the source are got with the transport of the client, without its
+    // credential. The block size is checked against them.
+    Blobs::CopyBlockBlobFromUriParallelOptions options;
+    options.TransferOptions.ChunkSize = 0;
+    EXPECT_THROW(
+        blockBlobClient.CopyFromUriParallel(sourceUri, options),
+        Azure::Core::RequestFailedException);
+    ASSERT_EQ(transport->Hosts.size(), 1U);
+    EXPECT_EQ(transport->Hosts[0], "source.blob.core.windows.net");
+    EXPECT_FALSE(transport->Authorized[0]);
+
+    // 1GiB in 1KiB blocks would be more than 50000 blocks.
+    options.TransferOptions.ChunkSize = 1024;
+    EXPECT_THROW(
+        blockBlobClient.CopyFromUriParallel(sourceUri, options),
+        Azure::Core::RequestFailedException);
+    EXPECT_EQ(transport->Hosts.size(), 2U);
+  }
+
+  TEST(BlockBlobClientOfflineTest, ClientSideEncryptionRequired)
+  {
+    class NullKeyEncryptionKey final : public Blobs::KeyEncryptionKey {
+    public:
+      std::string GetKeyId() const override { return "null-key"; }
+      std::vector<uint8_t> WrapKey(
+          const std::string&,
+          const std::vector<uint8_t>& key,
+          const Azure::Core::Context&) override
+      {
+        return key;
+      }
+      std::vector<uint8_t> UnwrapKey(
+          const std::string&,
+          const std::vector<uint8_t>& encryptedKey,
+          const Azure::Core::Context&) override
+      {
+        return encryptedKey;
+      }
+    };
+    auto transport = std::make_shared<BlobPropertiesTransport>();
+    Blobs::BlobClientOptions clientOptions;
+    clientOptions.Transport.Transport = transport;
+    Blobs::BlockBlobClient blockBlobClient(
+        "https://account.blob.core.windows.net/container/blob", clientOptions);
+
+    // The blob has no encryption data, its content isn't downloaded.
+    Blobs::DownloadBlobToOptions options;
+    options.ClientSideEncryption = Blobs::ClientSideEncryptionOptions();
+    options.ClientSideEncryption.Value().KeyEncryptionKey
+        = std::make_shared<NullKeyEncryptionKey>();
+    const std::string fileName = "ClientSideEncryptionRequired";
+    EXPECT_THROW(
+        blockBlobClient.DownloadTo(fileName, options), Azure::Core::RequestFailedException);
+    EXPECT_EQ(transport->Hosts.size(), 1U);
+    std::remove(fileName.data());
+  }
+
+  TEST(BlockListBodyStreamTest, MatchesXmlWriter)
+  {
+    using BlockBlob = Blobs::_detail::BlobRestClient::BlockBlob;
+    auto getBlockId = [](int64_t id) {
+      std::string blockId = std::to_string(id);
+      blockId = std::string(64 - blockId.length(), '0') + blockId;
+      return Azure::Core::Convert::Base64Encode(
+          std::vector<uint8_t>(blockId.begin(), blockId.end()));
+    };
+
+    BlockBlob::CommitBlockListOptions options;
+    options.BlockList.emplace_back(Blobs::Models::BlockType::Committed, "YWJj");
+    options.BlockList.emplace_back(Blobs::Models::BlockType::Uncommitted, "a<b&c>");
+    options.NumberedBlockCount = 12345;
+
+    _internal::XmlWriter writer;
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "BlockList"});
+    for (const auto& block : options.BlockList)
+    {
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::StartTag, block.first.ToString(), block.second});
+    }
+    for (int64_t i = 0; i < options.NumberedBlockCount; ++i)
+    {
+      writer.Write(_internal::XmlNode{
+          _internal::XmlNodeType::StartTag,
+          Blobs::Models::BlockType::Latest.ToString(),
+          getBlockId(i)});
+    }
+    writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+    const std::string expected = writer.GetDocument();
+
+    BlockBlob::BlockListBodyStream stream(options);
+    EXPECT_EQ(stream.Length(), static_cast<int64_t>(expected.length()));
+    for (size_t pieceSize : {size_t(7), size_t(64 * 1024)})
+    {
+      stream.Rewind();
+      std::string body;
+      std::vector<uint8_t> buffer(pieceSize);
+      for (size_t bytesRead; (bytesRead = stream.Read(buffer.data(), buffer.size())) != 0;)
+      {
+        body.append(buffer.begin(), buffer.begin() + bytesRead);
+      }
+      EXPECT_EQ(body, expected);
+    }
+  }
+
+  TEST_F(BlockBlobClientTest, ResumeTransferWithJournal)
+  {
+    // A journal failing to record more than MaxRecords records interrupts the transfer.
+    class InterruptedJournal final : public TransferJournal {
+    public:
+      std::vector<std::string> Records;
+      size_t MaxRecords = 0;
+
+      std::vector<std::string> ReadRecords() override { return Records; }
+      void AppendRecord(const std::string& record) override
+      {
+        if (Records.size() >= MaxRecords)
+        {
+          throw std::runtime_error("Journal is full.");
+        }
+        Records.push_back(record);
+      }
+      void Clear() override { Records.clear(); }
+    };
+    auto journal = std::make_shared<InterruptedJournal>();
+
+    std::string tempFilename = RandomString();
+    Blobs::DownloadBlobToOptions downloadOptions;
+    downloadOptions.TransferOptions.ChunkSize = 1_MB;
+    downloadOptions.TransferOptions.Concurrency = 1;
+    downloadOptions.TransferOptions.Journal = journal;
+    journal->MaxRecords = 4;
+    EXPECT_THROW(m_blockBlobClient->DownloadTo(tempFilename, downloadOptions), std::runtime_error);
+    EXPECT_EQ(journal->Records.size(), 4U);
+    journal->MaxRecords = 100;
+    m_blockBlobClient->DownloadTo(tempFilename, downloadOptions);
+    EXPECT_TRUE(journal->Records.empty());
+    EXPECT_EQ(ReadFile(tempFilename), m_blobContent);
+
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    Blobs::UploadBlockBlobFromOptions uploadOptions;
+    uploadOptions.TransferOptions.SingleUploadThreshold = 0;
+    uploadOptions.TransferOptions.ChunkSize = 1_MB;
+    uploadOptions.TransferOptions.Concurrency = 1;
+    uploadOptions.TransferOptions.Journal = journal;
+    journal->MaxRecords = 4;
+    EXPECT_THROW(blockBlobClient.UploadFrom(tempFilename, uploadOptions), std::runtime_error);
+    EXPECT_EQ(journal->Records.size(), 4U);
+    journal->MaxRecords = 100;
+    blockBlobClient.UploadFrom(tempFilename, uploadOptions);
+    EXPECT_TRUE(journal->Records.empty());
+    EXPECT_EQ(blockBlobClient.GetBlockList().Value.CommittedBlocks.size(), 8U);
+    EXPECT_EQ(blockBlobClient.Download().Value.BodyStream->ReadToEnd(), m_blobContent);
+
+    // A file written after the upload was interrupted is uploaded again, even if its size is the
+    // same.
+    journal->MaxRecords = 4;
+    EXPECT_THROW(blockBlobClient.UploadFrom(tempFilename, uploadOptions), std::runtime_error);
+    const auto newContent = RandomBuffer(m_blobContent.size());
+    {
+      _internal::FileWriter fileWriter(tempFilename);
+      fileWriter.Write(newContent.data(), newContent.size(), 0);
+    }
+    journal->MaxRecords = 100;
+    blockBlobClient.UploadFrom(tempFilename, uploadOptions);
+    DeleteFile(tempFilename);
+    EXPECT_EQ(blockBlobClient.Download().Value.BodyStream->ReadToEnd(), newContent);
+  }
+
+  TEST_F(BlockBlobClientTest, CompressContent)
+  {
+    std::vector<uint8_t> content = m_blobContent;
+    // Makes a part of the content compressible.
+    std::fill(content.begin(), content.begin() + content.size() / 2, static_cast<uint8_t>('a'));
+
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    Blobs::UploadBlockBlobFromOptions uploadOptions;
+    uploadOptions.TransferOptions.SingleUploadThreshold = 0;
+    uploadOptions.TransferOptions.ChunkSize = 1_MB;
+    uploadOptions.TransferOptions.CompressContent = true;
+    blockBlobClient.UploadFrom(content.data(), content.size(), uploadOptions);
+    auto properties = blockBlobClient.GetProperties().Value;
+    EXPECT_EQ(properties.HttpHeaders.ContentEncoding, "gzip");
+    EXPECT_LT(properties.BlobSize, static_cast<int64_t>(content.size()));
+
+    Blobs::DownloadBlobToOptions downloadOptions;
+    downloadOptions.TransferOptions.InitialChunkSize = 1_MB;
+    downloadOptions.TransferOptions.ChunkSize = 512_KB;
+    downloadOptions.TransferOptions.DecompressContent = true;
+    std::vector<uint8_t> downloaded;
+    blockBlobClient.DownloadTo(
+        [&downloaded](const uint8_t* data, size_t size) {
+          downloaded.insert(downloaded.end(), data, data + size);
+        },
+        downloadOptions);
+    EXPECT_EQ(downloaded, content);
+
+    std::string tempFilename = RandomString();
+    blockBlobClient.DownloadTo(tempFilename, downloadOptions);
+    EXPECT_EQ(ReadFile(tempFilename), content);
+
+    uploadOptions.TransferOptions.SingleUploadThreshold = 256_MB;
+    blockBlobClient.UploadFrom(tempFilename, uploadOptions);
+    DeleteFile(tempFilename);
+    blockBlobClient.DownloadTo(tempFilename, downloadOptions);
+    EXPECT_EQ(ReadFile(tempFilename), content);
+    DeleteFile(tempFilename);
+
+    Azure::Core::IO::MemoryBodyStream contentStream(content.data(), content.size());
+    uploadOptions.TransferOptions.SingleUploadThreshold = 0;
+    blockBlobClient.UploadFrom(contentStream, uploadOptions);
+    downloaded.clear();
+    blockBlobClient.DownloadTo(
+        [&downloaded](const uint8_t* data, size_t size) {
+          downloaded.insert(downloaded.end(), data, data + size);
+        },
+        downloadOptions);
+    EXPECT_EQ(downloaded, content);
+
+    uploadOptions.TransferOptions.ComputeContentCrc64 = true;
+    EXPECT_THROW(
+        blockBlobClient.UploadFrom(content.data(), content.size(), uploadOptions),
+        Azure::Core::RequestFailedException);
+  }
+
+  TEST_F(BlockBlobClientTest, ClientSideEncryption)
+  {
+    // Wraps the content keys by XORing them with a local key.
+    class LocalKeyEncryptionKey final : public Blobs::KeyEncryptionKey {
+    public:
+      std::vector<uint8_t> Key = RandomBuffer(32);
+
+      std::string GetKeyId() const override { return "local-key"; }
+      std::vector<uint8_t> WrapKey(
+          const std::string& algorithm,
+          const std::vector<uint8_t>& key,
+          const Azure::Core::Context&) override
+      {
+        EXPECT_EQ(algorithm, "XOR");
+        std::vector<uint8_t> wrappedKey = key;
+        for (size_t i = 0; i < wrappedKey.size(); ++i)
+        {
+          wrappedKey[i] ^= Key[i % Key.size()];
+        }
+        return wrappedKey;
+      }
+      std::vector<uint8_t> UnwrapKey(
+          const std::string& algorithm,
+          const std::vector<uint8_t>& encryptedKey,
+          const Azure::Core::Context& context) override
+      {
+        return WrapKey(algorithm, encryptedKey, context);
+      }
+    };
+    Blobs::ClientSideEncryptionOptions encryptionOptions;
+    encryptionOptions.KeyEncryptionKey = std::make_shared<LocalKeyEncryptionKey>();
+    encryptionOptions.KeyWrapAlgorithm = "XOR";
+
+    // Spans a partial last segment.
+    const std::vector<uint8_t> content = RandomBuffer(static_cast<size_t>(9_MB + 123));
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    Blobs::UploadBlockBlobFromOptions uploadOptions;
+    uploadOptions.ClientSideEncryption = encryptionOptions;
+    uploadOptions.TransferOptions.SingleUploadThreshold = 0;
+    uploadOptions.TransferOptions.ChunkSize = 1_MB;
+    blockBlobClient.UploadFrom(content.data(), content.size(), uploadOptions);
+    // The blocks are rounded up to whole segments.
+    EXPECT_EQ(blockBlobClient.GetBlockList().Value.CommittedBlocks.size(), 3U);
+    auto encrypted = blockBlobClient.Download().Value.BodyStream->ReadToEnd();
+    EXPECT_EQ(encrypted.size(), content.size() + 3 * 28);
+
+    Blobs::DownloadBlobToOptions downloadOptions;
+    downloadOptions.ClientSideEncryption = encryptionOptions;
+    downloadOptions.TransferOptions.ChunkSize = 1_MB;
+    std::vector<uint8_t> downloaded(content.size());
+    auto downloadResult
+        = blockBlobClient.DownloadTo(downloaded.data(), downloaded.size(), downloadOptions);
+    EXPECT_EQ(downloadResult.Value.BlobSize, static_cast<int64_t>(content.size()));
+    EXPECT_EQ(downloaded, content);
+
+    std::string tempFilename = RandomString();
+    uploadOptions.TransferOptions.SingleUploadThreshold = 256_MB;
+    {
+      Azure::Core::IO::MemoryBodyStream contentStream(content.data(), content.size());
+      blockBlobClient.UploadFrom(contentStream, uploadOptions);
+    }
+    blockBlobClient.DownloadTo(tempFilename, downloadOptions);
+    EXPECT_EQ(ReadFile(tempFilename), content);
+    DeleteFile(tempFilename);
+
+    // The content key can't be unwrapped by another key.
+    std::dynamic_pointer_cast<LocalKeyEncryptionKey>(encryptionOptions.KeyEncryptionKey)->Key
+        = RandomBuffer(32);
+    EXPECT_THROW(
+        blockBlobClient.DownloadTo(downloaded.data(), downloaded.size(), downloadOptions),
+        std::runtime_error);
+
+    // Blobs without encryption data aren't downloaded, unless encryption isn't required.
+    blockBlobClient.UploadFrom(content.data(), content.size());
+    EXPECT_THROW(
+        blockBlobClient.DownloadTo(downloaded.data(), downloaded.size(), downloadOptions),
+        Azure::Core::RequestFailedException);
+    downloadOptions.ClientSideEncryption.Value().RequireEncryption = false;
+    downloaded.assign(content.size(), 0);
+    blockBlobClient.DownloadTo(downloaded.data(), downloaded.size(), downloadOptions);
+    EXPECT_EQ(downloaded, content);
+  }
+
+  TEST_F(BlockBlobClientTest, ComputeContentHash)
+  {
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    const std::vector<uint8_t> contentMd5
+        = Azure::Core::Cryptography::Md5Hash().Final(m_blobContent.data(), m_blobContent.size());
+
+    Azure::Core::IO::MemoryBodyStream contentStream(m_blobContent.data(), m_blobContent.size());
+    Blobs::UploadBlockBlobOptions uploadOptions;
+    uploadOptions.ComputeTransactionalContentHash = HashAlgorithm::Md5;
+    auto uploadResult = blockBlobClient.Upload(contentStream, uploadOptions).Value;
+    ASSERT_TRUE(uploadResult.TransactionalContentHash.HasValue());
+    EXPECT_EQ(uploadResult.TransactionalContentHash.Value().Value, contentMd5);
+
+    contentStream.Rewind();
+    Blobs::StageBlockOptions stageBlockOptions;
+    stageBlockOptions.ComputeTransactionalContentHash = HashAlgorithm::Crc64;
+    auto stageBlockResult
+        = blockBlobClient.StageBlock("AAAA", contentStream, stageBlockOptions).Value;
+    ASSERT_TRUE(stageBlockResult.TransactionalContentHash.HasValue());
+    EXPECT_EQ(stageBlockResult.TransactionalContentHash.Value().Algorithm, HashAlgorithm::Crc64);
+
+    stageBlockOptions.TransactionalContentHash = stageBlockResult.TransactionalContentHash;
+    contentStream.Rewind();
+    EXPECT_THROW(
+        blockBlobClient.StageBlock("AAAA", contentStream, stageBlockOptions),
+        Azure::Core::RequestFailedException);
+
+    for (int64_t singleUploadThreshold : {int64_t(0), int64_t(256_MB)})
+    {
+      Blobs::UploadBlockBlobFromOptions uploadFromOptions;
+      uploadFromOptions.TransferOptions.SingleUploadThreshold = singleUploadThreshold;
+      uploadFromOptions.TransferOptions.ChunkSize = 1_MB;
+      uploadFromOptions.TransferOptions.ComputeContentMd5 = true;
+      contentStream.Rewind();
+      blockBlobClient.UploadFrom(contentStream, uploadFromOptions);
+      EXPECT_EQ(blockBlobClient.GetProperties().Value.HttpHeaders.ContentHash.Value, contentMd5);
+    }
+
+    Blobs::UploadBlockBlobFromOptions uploadFromOptions;
+    uploadFromOptions.TransferOptions.ComputeContentMd5 = true;
+    EXPECT_THROW(
+        blockBlobClient.UploadFrom(m_blobContent.data(), m_blobContent.size(), uploadFromOptions),
+        Azure::Core::RequestFailedException);
+  }
+
+  TEST_F(BlockBlobClientTest, DownloadRanges)
+  {
+    auto makeRange = [](int64_t offset, int64_t length) {
+      Azure::Core::Http::HttpRange range;
+      range.Offset = offset;
+      range.Length = length;
+      return range;
+    };
+    // The first two ranges and the last two are merged, the last one is truncated.
+    const int64_t blobSize = static_cast<int64_t>(m_blobContent.size());
+    const std::vector<Azure::Core::Http::HttpRange> ranges{
+        makeRange(blobSize - 100, 200),
+        makeRange(1_MB, 10),
+        makeRange(0, 100),
+        makeRange(50, 1000),
+        makeRange(blobSize - 1000, 10)};
+
+    Blobs::DownloadBlobRangesOptions options;
+    options.TransferOptions.MaxGapSize = 4_KB;
+    for (bool pinETag : {false, true})
+    {
+      if (pinETag)
+      {
+        options.AccessConditions.IfMatch = m_blockBlobClient->GetProperties().Value.ETag;
+      }
+      auto result = m_blockBlobClient->DownloadRanges(ranges, options).Value;
+      ASSERT_EQ(result.Contents.size(), ranges.size());
+      for (size_t i = 0; i < ranges.size(); ++i)
+      {
+        const size_t offset = static_cast<size_t>(ranges[i].Offset);
+        const size_t length = std::min(
+            static_cast<size_t>(ranges[i].Length.Value()), m_blobContent.size() - offset);
+        EXPECT_EQ(
+            std::vector<uint8_t>(
+                result.Contents[i].GetData(), result.Contents[i].GetData() + length),
+            std::vector<uint8_t>(
+                m_blobContent.begin() + offset, m_blobContent.begin() + offset + length));
+        EXPECT_EQ(result.Contents[i].GetSize(), length);
+      }
+      EXPECT_EQ(result.BlobSize, blobSize);
+      EXPECT_EQ(result.DownloadedSize, 1050 + 10 + 1000);
+      EXPECT_TRUE(result.ETag.HasValue());
+    }
+
+    options.AccessConditions.IfMatch = DummyETag;
+    EXPECT_THROW(m_blockBlobClient->DownloadRanges(ranges, options), StorageException);
+    EXPECT_THROW(
+        m_blockBlobClient->DownloadRanges(std::vector<Azure::Core::Http::HttpRange>()),
+        std::invalid_argument);
+  }
+
+  TEST_F(BlockBlobClientTest, RandomAccessReader)
+  {
+    Blobs::BlobRandomAccessReaderOptions options;
+    options.BlockSize = 64_KB;
+    options.CacheSize = 256_KB;
+    options.ShardCount = 2;
+    Blobs::BlobRandomAccessReader reader(*m_blockBlobClient, options);
+    const int64_t blobSize = static_cast<int64_t>(m_blobContent.size());
+    EXPECT_EQ(reader.GetSize(), blobSize);
+    EXPECT_EQ(reader.GetETag(), m_blockBlobClient->GetProperties().Value.ETag);
+
+    // Reads across blocks, from random offsets and past the end of the blob.
+    std::mt19937_64 random(0);
+    std::vector<uint8_t> buffer(200_KB);
+    for (int i = 0; i < 20; ++i)
+    {
+      const int64_t offset = std::uniform_int_distribution<int64_t>(0, blobSize)(random);
+      const size_t bytesRead = reader.Read(offset, buffer.data(), buffer.size());
+      ASSERT_EQ(
+          bytesRead, std::min<size_t>(buffer.size(), static_cast<size_t>(blobSize - offset)));
+      EXPECT_EQ(
+          std::vector<uint8_t>(buffer.begin(), buffer.begin() + bytesRead),
+          std::vector<uint8_t>(
+              m_blobContent.begin() + offset, m_blobContent.begin() + offset + bytesRead));
+    }
+
+    // The stream reads sequentially, with read-ahead.
+    auto bodyStream = reader.GetBodyStream();
+    EXPECT_EQ(bodyStream->Length(), blobSize);
+    EXPECT_EQ(bodyStream->ReadToEnd(), m_blobContent);
+
+    // The reads are of the version of the blob first read.
+    m_blockBlobClient->SetMetadata({{"key", "value"}});
+    Blobs::BlobRandomAccessReader staleReader(*m_blockBlobClient, options);
+    EXPECT_EQ(staleReader.Read(0, buffer.data(), 1), 1U);
+    m_blockBlobClient->SetMetadata({});
+    EXPECT_THROW(staleReader.Read(blobSize - 1, buffer.data(), 1), StorageException);
+  }
+
+  TEST_F(BlockBlobClientTest, UploadDeltaFrom)
+  {
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    Blobs::UploadBlockBlobDeltaFromOptions options;
+    options.TransferOptions.AverageBlockSize = 256_KB;
+    options.Metadata = {{"key1", "value1"}};
+
+    std::string tempFilename = RandomString();
+    std::vector<uint8_t> content = m_blobContent;
+    {
+      _internal::FileWriter fileWriter(tempFilename);
+      fileWriter.Write(content.data(), content.size(), 0);
+    }
+    auto res = blockBlobClient.UploadDeltaFrom(tempFilename, options);
+    EXPECT_EQ(res.Value.BlobSize, static_cast<int64_t>(content.size()));
+    EXPECT_EQ(res.Value.UploadedSize, res.Value.BlobSize);
+    DeleteFile(tempFilename);
+
+    // Only the blocks around the changes are staged.
+    content.insert(content.begin() + 1_MB, 1000, uint8_t('a'));
+    content.insert(content.end(), 1000, uint8_t('b'));
+    {
+      _internal::FileWriter fileWriter(tempFilename);
+      fileWriter.Write(content.data(), content.size(), 0);
+    }
+    res = blockBlobClient.UploadDeltaFrom(tempFilename, options);
+    EXPECT_EQ(res.Value.BlobSize, static_cast<int64_t>(content.size()));
+    EXPECT_LT(res.Value.UploadedSize, res.Value.BlobSize / 4);
+    DeleteFile(tempFilename);
+
+    auto downloadResult = blockBlobClient.Download();
+    EXPECT_EQ(downloadResult.Value.BodyStream->ReadToEnd(), content);
+    EXPECT_EQ(downloadResult.Value.Details.Metadata, options.Metadata);
+  }
+
+  TEST_F(BlockBlobClientTest, ConcurrentContentCrc64)
+  {
+    const std::vector<uint8_t> expected
+        = Crc64Hash().Final(m_blobContent.data(), m_blobContent.size());
+    std::string tempFilename = RandomString();
+    {
+      _internal::FileWriter fileWriter(tempFilename);
+      fileWriter.Write(m_blobContent.data(), m_blobContent.size(), 0);
+    }
+    for (int64_t singleUploadThreshold : {int64_t(0), int64_t(256_MB)})
+    {
+      auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+      Blobs::UploadBlockBlobFromOptions uploadOptions;
+      uploadOptions.TransferOptions.SingleUploadThreshold = singleUploadThreshold;
+      uploadOptions.TransferOptions.ChunkSize = 1_MB;
+      uploadOptions.TransferOptions.Concurrency = 4;
+      uploadOptions.TransferOptions.ComputeContentCrc64 = true;
+      auto uploadResult = blockBlobClient.UploadFrom(tempFilename, uploadOptions).Value;
+      ASSERT_TRUE(uploadResult.ContentCrc64.HasValue());
+      EXPECT_EQ(uploadResult.ContentCrc64.Value().Algorithm, HashAlgorithm::Crc64);
+      EXPECT_EQ(uploadResult.ContentCrc64.Value().Value, expected);
+      uploadResult = blockBlobClient
+                         .UploadFrom(m_blobContent.data(), m_blobContent.size(), uploadOptions)
+                         .Value;
+      ASSERT_TRUE(uploadResult.ContentCrc64.HasValue());
+      EXPECT_EQ(uploadResult.ContentCrc64.Value().Value, expected);
+    }
+    DeleteFile(tempFilename);
+
+    Blobs::DownloadBlobToOptions downloadOptions;
+    downloadOptions.TransferOptions.InitialChunkSize = 1_MB + 1;
+    downloadOptions.TransferOptions.ChunkSize = 1_MB - 1;
+    downloadOptions.TransferOptions.Concurrency = 4;
+    downloadOptions.TransferOptions.ComputeContentCrc64 = true;
+    std::vector<uint8_t> downloadContent(m_blobContent.size());
+    auto downloadResult = m_blockBlobClient
+                              ->DownloadTo(
+                                  downloadContent.data(), downloadContent.size(), downloadOptions)
+                              .Value;
+    ASSERT_TRUE(downloadResult.ContentCrc64.HasValue());
+    EXPECT_EQ(downloadResult.ContentCrc64.Value().Value, expected);
+
+    downloadResult = m_blockBlobClient->DownloadTo(tempFilename, downloadOptions).Value;
+    ASSERT_TRUE(downloadResult.ContentCrc64.HasValue());
+    EXPECT_EQ(downloadResult.ContentCrc64.Value().Value, expected);
+    DeleteFile(tempFilename);
+
+    downloadResult
+        = m_blockBlobClient->DownloadTo([](const uint8_t*, size_t) {}, downloadOptions).Value;
+    ASSERT_TRUE(downloadResult.ContentCrc64.HasValue());
+    EXPECT_EQ(downloadResult.ContentCrc64.Value().Value, expected);
+
+    // The chunks are limited to the ranges the service hashes.
+    downloadOptions.TransferOptions.InitialChunkSize = 8_MB;
+    downloadOptions.TransferOptions.ChunkSize = 8_MB;
+    downloadOptions.TransferOptions.ValidateContentCrc64 = true;
+    downloadResult
+        = m_blockBlobClient
+              ->DownloadTo(downloadContent.data(), downloadContent.size(), downloadOptions)
+              .Value;
+    ASSERT_TRUE(downloadResult.ContentCrc64.HasValue());
+    EXPECT_EQ(downloadResult.ContentCrc64.Value().Value, expected);
+    EXPECT_EQ(downloadContent, m_blobContent);
+
+    downloadResult = m_blockBlobClient->DownloadTo(tempFilename, downloadOptions).Value;
+    ASSERT_TRUE(downloadResult.ContentCrc64.HasValue());
+    EXPECT_EQ(downloadResult.ContentCrc64.Value().Value, expected);
+    DeleteFile(tempFilename);
+
+    downloadResult
+        = m_blockBlobClient->DownloadTo([](const uint8_t*, size_t) {}, downloadOptions).Value;
+    ASSERT_TRUE(downloadResult.ContentCrc64.HasValue());
+    EXPECT_EQ(downloadResult.ContentCrc64.Value().Value, expected);
+
+    auto emptyBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    std::vector<uint8_t> emptyContent;
+    emptyBlobClient.UploadFrom(emptyContent.data(), emptyContent.size());
+    downloadResult
+        = emptyBlobClient.DownloadTo([](const uint8_t*, size_t) {}, downloadOptions).Value;
+    EXPECT_EQ(downloadResult.BlobSize, 0);
+  }
+
   TEST_F(BlockBlobClientTest, ConcurrentUploadFromNonExistingFile)
   {
     auto blockBlobClient = Azure::Storage::Blobs::BlockBlobClient::CreateFromConnectionString(
@@ -977,6 +2019,33 @@ namespace Azure { namespace Storage { namespace Test {
       DeleteFile(tempFilename);
     };
 
+    auto testUploadFromStream = [&](int concurrency, int64_t blobSize) {
+      auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+
+      Azure::Storage::Blobs::UploadBlockBlobFromOptions options;
+      options.TransferOptions.ChunkSize = 1_MB;
+      options.TransferOptions.Concurrency = concurrency;
+      options.TransferOptions.ComputeContentCrc64 = true;
+      options.Metadata = m_blobUploadOptions.Metadata;
+
+      Azure::Core::IO::MemoryBodyStream stream(blobContent.data(), static_cast<size_t>(blobSize));
+      auto res = blockBlobClient.UploadFrom(stream, options);
+      EXPECT_TRUE(res.Value.ETag.HasValue());
+      EXPECT_EQ(
+          res.Value.ContentCrc64.Value().Value,
+          Crc64Hash().Final(blobContent.data(), static_cast<size_t>(blobSize)));
+      auto properties = blockBlobClient.GetProperties().Value;
+      EXPECT_EQ(properties.BlobSize, blobSize);
+      EXPECT_EQ(properties.Metadata, options.Metadata);
+      EXPECT_EQ(properties.ETag, res.Value.ETag);
+      std::vector<uint8_t> downloadContent(static_cast<size_t>(blobSize), '\x00');
+      blockBlobClient.DownloadTo(downloadContent.data(), static_cast<size_t>(blobSize));
+      EXPECT_EQ(
+          downloadContent,
+          std::vector<uint8_t>(
+              blobContent.begin(), blobContent.begin() + static_cast<size_t>(blobSize)));
+    };
+
     std::vector<std::future<void>> futures;
     for (int c : {1, 2, 5})
     {
@@ -986,6 +2055,7 @@ namespace Azure { namespace Storage { namespace Test {
         ASSERT_GE(blobContent.size(), static_cast<size_t>(l));
         futures.emplace_back(std::async(std::launch::async, testUploadFromBuffer, c, l));
         futures.emplace_back(std::async(std::launch::async, testUploadFromFile, c, l));
+        futures.emplace_back(std::async(std::launch::async, testUploadFromStream, c, l));
       }
     }
     for (auto& f : futures)
@@ -1066,6 +2136,30 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_THROW(blobClient.WithSnapshot(s2).GetProperties(), StorageException);
   }
 
+  TEST_F(BlockBlobClientTest, Query)
+  {
+    const std::string csvContent = "name,value\nfoo,1\nbar,2\nbaz,3\n";
+    auto blobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    blobClient.UploadFrom(reinterpret_cast<const uint8_t*>(csvContent.data()), csvContent.size());
+
+    Blobs::QueryBlobOptions options;
+    options.InputTextConfiguration
+        = Blobs::BlobQueryTextOptions::CreateCsvTextOptions("\n", ",", "", "", true);
+    options.OutputTextConfiguration = Blobs::BlobQueryTextOptions::CreateJsonTextOptions();
+    int64_t bytesScanned = 0;
+    options.ProgressHandler = [&bytesScanned](int64_t scanned, int64_t totalBytes) {
+      EXPECT_LE(scanned, totalBytes);
+      bytesScanned = scanned;
+    };
+    auto queryResult
+        = blobClient.Query("SELECT value FROM BlobStorage WHERE name <> 'bar'", options);
+    auto results = queryResult.Value.BodyStream->ReadToEnd();
+    EXPECT_EQ(
+        std::string(results.begin(), results.end()), "{\"value\":\"1\"}\n{\"value\":\"3\"}\n");
+    EXPECT_EQ(bytesScanned, static_cast<int64_t>(csvContent.size()));
+    EXPECT_EQ(queryResult.Value.ETag, blobClient.GetProperties().Value.ETag);
+  }
+
   TEST_F(BlockBlobClientTest, SetTier)
   {
     std::vector<uint8_t> emptyContent;
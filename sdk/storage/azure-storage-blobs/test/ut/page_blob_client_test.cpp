@@ -164,6 +164,180 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_EQ(static_cast<uint64_t>(clearRanges[0].Length.Value()), 1_KB);
   }
 
+  TEST_F(PageBlobClientTest, GetPageRangesStreaming)
+  {
+    auto pageBlobClient = Azure::Storage::Blobs::PageBlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, RandomString());
+    pageBlobClient.Create(64_KB, m_blobUploadOptions);
+    std::vector<uint8_t> pageContent(512, 'x');
+    // Every other page, so that no two ranges are merged.
+    for (int64_t offset = 0; offset < static_cast<int64_t>(64_KB); offset += 1_KB)
+    {
+      auto pageStream = Azure::Core::IO::MemoryBodyStream(pageContent.data(), pageContent.size());
+      pageBlobClient.UploadPages(offset, pageStream);
+    }
+
+    std::vector<Core::Http::HttpRange> expected;
+    for (auto pageResult = pageBlobClient.GetPageRanges(); pageResult.HasPage();
+         pageResult.MoveToNextPage())
+    {
+      expected.insert(expected.end(), pageResult.PageRanges.begin(), pageResult.PageRanges.end());
+    }
+    std::vector<Blobs::Models::CompactPageRange> pageRanges;
+    auto res = pageBlobClient.GetPageRangesStreaming(
+        [&](const Blobs::Models::CompactPageRange* ranges, size_t count) {
+          pageRanges.insert(pageRanges.end(), ranges, ranges + count);
+        });
+    EXPECT_TRUE(res.Value.ETag.HasValue());
+    EXPECT_EQ(res.Value.BlobSize, static_cast<int64_t>(64_KB));
+    ASSERT_EQ(pageRanges.size(), expected.size());
+    ASSERT_EQ(pageRanges.size(), 64U);
+    for (size_t i = 0; i < pageRanges.size(); ++i)
+    {
+      EXPECT_EQ(pageRanges[i].Offset, expected[i].Offset);
+      EXPECT_EQ(pageRanges[i].Length, expected[i].Length.Value());
+    }
+
+    Azure::Storage::Blobs::GetPageRangesOptions options;
+    options.Range = Core::Http::HttpRange();
+    options.Range.Value().Offset = 4_KB;
+    options.Range.Value().Length = 2_KB;
+    pageRanges.clear();
+    pageBlobClient.GetPageRangesStreaming(
+        [&](const Blobs::Models::CompactPageRange* ranges, size_t count) {
+          pageRanges.insert(pageRanges.end(), ranges, ranges + count);
+        },
+        options);
+    ASSERT_EQ(pageRanges.size(), 2U);
+    EXPECT_EQ(pageRanges[0].Offset, static_cast<int64_t>(4_KB));
+    EXPECT_EQ(pageRanges[0].Length, 512);
+  }
+
+  TEST_F(PageBlobClientTest, DownloadSparseTo)
+  {
+    auto pageBlobClient = Azure::Storage::Blobs::PageBlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, RandomString());
+    pageBlobClient.Create(64_KB, m_blobUploadOptions);
+    std::vector<uint8_t> blobContent(static_cast<size_t>(64_KB), '\x00');
+    // Two populated ranges, the second one spans several chunks.
+    for (auto range : {std::make_pair(4_KB, 2_KB), std::make_pair(32_KB, 9_KB)})
+    {
+      std::vector<uint8_t> pages = RandomBuffer(static_cast<size_t>(range.second));
+      auto pageContent = Azure::Core::IO::MemoryBodyStream(pages.data(), pages.size());
+      pageBlobClient.UploadPages(range.first, pageContent);
+      std::copy(pages.begin(), pages.end(), blobContent.begin() + static_cast<size_t>(range.first));
+    }
+
+    const std::string tempFilename = RandomString();
+    Azure::Storage::Blobs::DownloadSparseBlobToOptions options;
+    options.TransferOptions.ChunkSize = 4_KB;
+    options.TransferOptions.Concurrency = 2;
+    auto res = pageBlobClient.DownloadSparseTo(tempFilename, options);
+    EXPECT_EQ(static_cast<uint64_t>(res.Value.BlobSize), 64_KB);
+    EXPECT_EQ(static_cast<uint64_t>(res.Value.DownloadedSize), 11_KB);
+    EXPECT_TRUE(res.Value.ETag.HasValue());
+    EXPECT_EQ(ReadFile(tempFilename), blobContent);
+    DeleteFile(tempFilename);
+  }
+
+  TEST_F(PageBlobClientTest, SyncFromSnapshotDiff)
+  {
+    auto pageBlobClient = Azure::Storage::Blobs::PageBlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, RandomString());
+    pageBlobClient.Create(16_KB, m_blobUploadOptions);
+    std::vector<uint8_t> pages = RandomBuffer(static_cast<size_t>(8_KB));
+    auto pageContent = Azure::Core::IO::MemoryBodyStream(pages.data(), pages.size());
+    pageBlobClient.UploadPages(0, pageContent);
+    const std::string previousSnapshot = pageBlobClient.CreateSnapshot().Value.Snapshot;
+
+    const std::string tempFilename = RandomString();
+    pageBlobClient.WithSnapshot(previousSnapshot).DownloadSparseTo(tempFilename);
+
+    // |x|x|x|x|  |_|_|_|_| -> |x|_|_|x|  |_|_|x|x|
+    pageBlobClient.ClearPages({2_KB, 4_KB});
+    std::vector<uint8_t> changedPages = RandomBuffer(static_cast<size_t>(5_KB));
+    auto changedPageContent
+        = Azure::Core::IO::MemoryBodyStream(changedPages.data(), changedPages.size());
+    pageBlobClient.UploadPages(11_KB, changedPageContent);
+    pageBlobClient.Resize(20_KB);
+    const std::string snapshot = pageBlobClient.CreateSnapshot().Value.Snapshot;
+
+    std::vector<uint8_t> blobContent(static_cast<size_t>(20_KB), '\x00');
+    std::copy(pages.begin(), pages.begin() + static_cast<size_t>(2_KB), blobContent.begin());
+    std::copy(
+        pages.begin() + static_cast<size_t>(6_KB),
+        pages.end(),
+        blobContent.begin() + static_cast<size_t>(6_KB));
+    std::copy(
+        changedPages.begin(), changedPages.end(), blobContent.begin() + static_cast<size_t>(11_KB));
+
+    Azure::Storage::Blobs::SyncPageBlobFromSnapshotDiffOptions options;
+    options.TransferOptions.ChunkSize = 2_KB;
+    auto res
+        = pageBlobClient.SyncFromSnapshotDiff(tempFilename, previousSnapshot, snapshot, options);
+    EXPECT_EQ(static_cast<uint64_t>(res.Value.BlobSize), 20_KB);
+    EXPECT_EQ(static_cast<uint64_t>(res.Value.DownloadedSize), 5_KB);
+    EXPECT_EQ(static_cast<uint64_t>(res.Value.ClearedSize), 4_KB);
+    EXPECT_EQ(ReadFile(tempFilename), blobContent);
+    DeleteFile(tempFilename);
+  }
+
+  TEST_F(PageBlobClientTest, UploadFrom)
+  {
+    // Non-zero pages at the start, across two chunks and in a padded last page.
+    std::vector<uint8_t> content(static_cast<size_t>(20_KB + 100), '\x00');
+    for (auto range : {std::make_pair(0_KB, 1_KB), std::make_pair(7_KB, 2_KB)})
+    {
+      std::vector<uint8_t> pages = RandomBuffer(static_cast<size_t>(range.second));
+      std::copy(pages.begin(), pages.end(), content.begin() + static_cast<size_t>(range.first));
+    }
+    content.back() = 1;
+    std::vector<uint8_t> blobContent = content;
+    blobContent.resize(static_cast<size_t>(20_KB + 512), '\x00');
+
+    const std::string tempFilename = RandomString();
+    {
+      _internal::FileWriter fileWriter(tempFilename);
+      fileWriter.Write(content.data(), content.size(), 0);
+    }
+
+    Azure::Storage::Blobs::UploadPageBlobFromOptions options;
+    options.Metadata = RandomMetadata();
+    options.TransferOptions.ChunkSize = 8_KB;
+    options.TransferOptions.Concurrency = 2;
+    for (bool fromFile : {false, true})
+    {
+      auto pageBlobClient = m_blobContainerClient->GetPageBlobClient(RandomString());
+      auto res = fromFile ? pageBlobClient.UploadFrom(tempFilename, options)
+                          : pageBlobClient.UploadFrom(content.data(), content.size(), options);
+      EXPECT_EQ(static_cast<uint64_t>(res.Value.BlobSize), 20_KB + 512);
+      EXPECT_EQ(static_cast<uint64_t>(res.Value.UploadedSize), 3_KB + 512);
+
+      auto properties = pageBlobClient.GetProperties().Value;
+      EXPECT_EQ(res.Value.ETag, properties.ETag);
+      EXPECT_EQ(properties.Metadata, options.Metadata);
+
+      std::vector<Core::Http::HttpRange> pageRanges;
+      for (auto pageResult = pageBlobClient.GetPageRanges(); pageResult.HasPage();
+           pageResult.MoveToNextPage())
+      {
+        pageRanges.insert(
+            pageRanges.end(), pageResult.PageRanges.begin(), pageResult.PageRanges.end());
+      }
+      int64_t populatedSize = 0;
+      for (const auto& range : pageRanges)
+      {
+        populatedSize += range.Length.Value();
+      }
+      EXPECT_EQ(static_cast<uint64_t>(populatedSize), 3_KB + 512);
+
+      std::vector<uint8_t> downloaded(blobContent.size());
+      pageBlobClient.DownloadTo(downloaded.data(), downloaded.size());
+      EXPECT_EQ(downloaded, blobContent);
+    }
+    DeleteFile(tempFilename);
+  }
+
   TEST_F(PageBlobClientTest, UploadFromUri)
   {
     auto pageBlobClient = Azure::Storage::Blobs::PageBlobClient::CreateFromConnectionString(
@@ -3,6 +3,7 @@
 
 #include <chrono>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include <azure/storage/blobs.hpp>
@@ -444,4 +445,69 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_NE(numSecondaryTrial, 0);
   }
 
+  TEST(StorageRetryPolicyTest, StickySecondaryWhilePrimaryUnhealthy)
+  {
+    std::string primaryContent = "primary content";
+    std::string secondaryContent = "secondary content";
+    auto transportPolicyPtr
+        = std::make_unique<MockTransportPolicy>(primaryContent, secondaryContent);
+
+    int numPrimaryTrial = 0;
+    int numSecondaryTrial = 0;
+    auto failPolicy = [&numPrimaryTrial, &numSecondaryTrial](
+                          MockTransportPolicy::Region region) -> MockTransportPolicy::ResponseType {
+      if (region == MockTransportPolicy::Region::Primary)
+      {
+        numPrimaryTrial++;
+        return MockTransportPolicy::ResponseType::TransportException;
+      }
+      numSecondaryTrial++;
+      return MockTransportPolicy::ResponseType::Success;
+    };
+
+    transportPolicyPtr->SetFailPolicy(failPolicy);
+
+    EndpointHealthTrackerOptions trackerOptions;
+    trackerOptions.FailureThreshold = 2;
+    trackerOptions.CoolingOffPeriod = std::chrono::milliseconds(500);
+
+    Blobs::BlobClientOptions clientOptions;
+    clientOptions.PerRetryPolicies.emplace_back(std::move(transportPolicyPtr));
+    clientOptions.Retry.RetryDelay = std::chrono::milliseconds(0);
+    clientOptions.EndpointHealthTracker = std::make_shared<EndpointHealthTracker>(trackerOptions);
+    {
+      std::string primaryUrl
+          = Azure::Storage::Blobs::BlobClient::CreateFromConnectionString(
+                StandardStorageConnectionString(), RandomString(), RandomString())
+                .GetUrl();
+      std::string secondaryUrl = InferSecondaryUrl(primaryUrl);
+      std::string secondaryHost = Core::Url(secondaryUrl).GetHost();
+      clientOptions.SecondaryHostForRetryReads = secondaryHost;
+    }
+    auto blobClient = Azure::Storage::Blobs::BlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), RandomString(), RandomString(), clientOptions);
+
+    // Each download fails on the primary host before succeeding on the secondary host, until the
+    // primary host is unhealthy.
+    for (int i = 0; i < 2; ++i)
+    {
+      auto ret = blobClient.Download();
+      auto responseBody = ret.Value.BodyStream->ReadToEnd(Azure::Core::Context());
+      EXPECT_EQ(std::string(responseBody.begin(), responseBody.end()), secondaryContent);
+    }
+    EXPECT_EQ(numPrimaryTrial, 2);
+    EXPECT_EQ(numSecondaryTrial, 2);
+
+    blobClient.Download();
+    EXPECT_EQ(numPrimaryTrial, 2);
+    EXPECT_EQ(numSecondaryTrial, 3);
+
+    // Once the cooling-off period is over, one download probes the primary host.
+    std::this_thread::sleep_for(trackerOptions.CoolingOffPeriod);
+    blobClient.Download();
+    blobClient.Download();
+    EXPECT_EQ(numPrimaryTrial, 3);
+    EXPECT_EQ(numSecondaryTrial, 5);
+  }
+
 }}} // namespace Azure::Storage::Test
@@ -0,0 +1,215 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Azure { namespace Storage {
+
+  class BufferPool;
+
+  namespace _internal {
+    class PooledBuffer;
+    class ThreadPool;
+
+    /**
+     * @brief Gets the threads which run the chunks of the transfers using \p pool: the threads of
+     * \p pool when its options have a CPU affinity, or else the threads shared by the process.
+     */
+    ThreadPool& GetTransferThreadPool(const std::shared_ptr<BufferPool>& pool);
+  } // namespace _internal
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::BufferPool.
+   */
+  struct BufferPoolOptions final
+  {
+    /**
+     * @brief The maximum number of bytes of the free buffers kept by the pool for reuse. The
+     * buffers given back beyond it are freed.
+     */
+    int64_t MaxPooledBytes = 256 * 1024 * 1024;
+
+    /**
+     * @brief The maximum number of bytes of the buffers in use by the transfers of the clients
+     * using the pool. 0 means no limit.
+     *
+     * @remark A transfer needing a buffer while the limit is reached waits for other buffers to be
+     * given back, unless the thread already holds a buffer, so the chunks under way always finish.
+     * Downloads delivering their chunks in order keep fewer chunks ahead instead. A buffer larger
+     * than the limit is given once no other buffer is in use.
+     */
+    int64_t MaxBytesInUse = 0;
+
+    /**
+     * @brief The NUMA node the buffers of the pool are allocated on, or -1 to let the operating
+     * system place them.
+     *
+     * @remark Supported on Linux and Windows. The memory falls back to other nodes when the node
+     * is out of memory, or when it doesn't exist.
+     */
+    int NumaNode = -1;
+
+    /**
+     * @brief The CPUs the chunks of the transfers of the clients using the pool are run on. If
+     * empty, the transfers run on the threads shared by the process.
+     *
+     * @remark When set, the pool has its own transfer threads, twice as many as the CPUs and at
+     * least 8, each of them allowed to run on these CPUs only. Supported on Linux and Windows, for
+     * the first 64 CPUs of the processor group of the process on Windows. Along with #NumaNode,
+     * it keeps the threads copying the chunks and their buffers on the NUMA node of the network
+     * adapter.
+     */
+    std::vector<int> CpuAffinity;
+  };
+
+  /**
+   * @brief Reuses the chunk buffers of uploads and downloads across chunks, operations and
+   * clients.
+   *
+   * @remark The size of a buffer is rounded up to a power of two, from 64KiB up to 1GiB. The free
+   * buffers are kept in shards picked by thread, so the threads of concurrent transfers seldom
+   * contend for a lock. Once a transfer is under way, its next chunks reuse the buffers of the
+   * previous ones instead of allocating memory. Larger buffers aren't pooled.
+   *
+   * @remark Clients created with no pool in their options share #GetDefault().
+   */
+  class BufferPool final {
+  public:
+    /**
+     * @brief Constructs a pool.
+     *
+     * @param options Optional parameters for the pool.
+     */
+    explicit BufferPool(BufferPoolOptions options = BufferPoolOptions());
+
+    ~BufferPool();
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    /**
+     * @brief Gets the options of the pool.
+     *
+     */
+    const BufferPoolOptions& GetOptions() const { return m_options; }
+
+    /**
+     * @brief Gets the number of bytes of the free buffers kept by the pool.
+     *
+     */
+    int64_t GetPooledBytes() const { return m_pooledBytes; }
+
+    /**
+     * @brief Gets the number of bytes of the buffers taken from the pool and not given back yet.
+     *
+     */
+    int64_t GetBytesInUse() const { return m_bytesInUse; }
+
+    /**
+     * @brief Gets the pool of the clients created with no pool in their options.
+     *
+     */
+    static const std::shared_ptr<BufferPool>& GetDefault();
+
+  private:
+    // 64KiB, 128KiB, ..., 1GiB.
+    static constexpr size_t NumSizeClasses = 15;
+    static constexpr size_t NumShards = 16;
+
+    struct Shard final
+    {
+      std::mutex Mutex;
+      // The free buffers of each size class.
+      std::array<std::vector<uint8_t*>, NumSizeClasses> FreeBuffers;
+    };
+
+    BufferPoolOptions m_options;
+    std::array<Shard, NumShards> m_shards;
+    std::atomic<int64_t> m_pooledBytes{0};
+    // The transfer threads of the pool, when its options have a CPU affinity.
+    std::unique_ptr<_internal::ThreadPool> m_threadPool;
+
+    // Guards the waits for the budget of MaxBytesInUse. Not used without a limit.
+    std::mutex m_budgetMutex;
+    std::condition_variable m_budgetReleased;
+    std::atomic<int64_t> m_bytesInUse{0};
+
+    // Counts bytes as in use. When they don't fit in the budget, waits for them if `wait` is true,
+    // otherwise returns false, or counts them anyway if `exceed` is true.
+    bool AcquireBytes(int64_t bytes, bool wait, bool exceed);
+    void ReleaseBytes(int64_t bytes);
+
+    uint8_t* Acquire(size_t sizeClass);
+    void Release(uint8_t* buffer, size_t sizeClass);
+    // Allocates and frees the buffers of the pool, on the NUMA node of the options.
+    uint8_t* Allocate(size_t sizeClass) const;
+    void Free(uint8_t* buffer, size_t sizeClass) const;
+
+    friend class _internal::PooledBuffer;
+    friend _internal::ThreadPool& _internal::GetTransferThreadPool(
+        const std::shared_ptr<BufferPool>& pool);
+  };
+
+  namespace _internal {
+    /**
+     * @brief A buffer from a #Azure::Storage::BufferPool, given back to it when destroyed. The
+     * buffer is aligned for unbuffered file I/O.
+     *
+     */
+    class PooledBuffer final {
+    public:
+      /**
+       * @brief Constructs an empty buffer.
+       */
+      PooledBuffer() = default;
+
+      /**
+       * @brief Gets a buffer of \p size bytes from \p pool, or from the default pool when
+       * \p pool is null. Nothing is taken from the pool when \p size is 0.
+       */
+      explicit PooledBuffer(std::shared_ptr<BufferPool> pool, size_t size);
+
+      /**
+       * @brief Gets a buffer of \p size bytes from \p pool, or from the default pool when
+       * \p pool is null, without waiting. The buffer is empty when it doesn't fit in the
+       * `MaxBytesInUse` of the pool.
+       */
+      static PooledBuffer TryCreate(std::shared_ptr<BufferPool> pool, size_t size);
+
+      ~PooledBuffer();
+
+      PooledBuffer(PooledBuffer&& other) noexcept;
+      PooledBuffer& operator=(PooledBuffer&& other) noexcept;
+
+      uint8_t* GetData() const { return m_data; }
+
+      size_t GetSize() const { return m_size; }
+
+    private:
+      std::shared_ptr<BufferPool> m_pool;
+      // The allocation the buffer is aligned in.
+      uint8_t* m_allocation = nullptr;
+      uint8_t* m_data = nullptr;
+      size_t m_size = 0;
+      size_t m_sizeClass = 0;
+      // The bytes counted as in use by the pool.
+      int64_t m_bytesInUse = 0;
+      // The count of buffers held by the thread which took this one, when the pool has a budget.
+      std::shared_ptr<std::atomic<int>> m_threadBuffers;
+
+      // Takes the buffer from `pool`. Returns false, with nothing taken, when `tryOnly` is true
+      // and the buffer doesn't fit in the budget of the pool.
+      bool Create(std::shared_ptr<BufferPool> pool, size_t size, bool tryOnly);
+      void Reset();
+    };
+  } // namespace _internal
+
+}} // namespace Azure::Storage
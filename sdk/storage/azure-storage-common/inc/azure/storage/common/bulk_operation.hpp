@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <vector>
+
+#include <azure/core/context.hpp>
+
+namespace Azure { namespace Storage {
+
+  /**
+   * @brief An operation run by #Azure::Storage::ExecuteBulkOperations, typically a single request
+   * of a client.
+   */
+  using BulkOperation = std::function<void(const Azure::Core::Context& context)>;
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::ExecuteBulkOperations.
+   */
+  struct BulkOperationOptions final
+  {
+    /**
+     * @brief The maximum number of operations run at the same time.
+     */
+    int32_t Concurrency = 16;
+  };
+
+  /**
+   * @brief The results of a bulk of operations.
+   */
+  struct BulkOperationResult final
+  {
+    /**
+     * @brief The exception each operation failed with, in the order of the operations. Null for
+     * the operations that succeeded.
+     */
+    std::vector<std::exception_ptr> Errors;
+
+    /**
+     * @brief The number of operations that failed.
+     */
+    int32_t FailedCount = 0;
+  };
+
+  /**
+   * @brief Runs many independent operations in parallel on the storage thread pool. A failed
+   * operation doesn't stop the other ones.
+   *
+   * @param operations The operations to run, in no particular order.
+   * @param options Optional parameters to execute this function.
+   * @param context Context for cancelling long running operations, passed to every operation.
+   * @return The error of each operation.
+   */
+  BulkOperationResult ExecuteBulkOperations(
+      const std::vector<BulkOperation>& operations,
+      const BulkOperationOptions& options = BulkOperationOptions(),
+      const Azure::Core::Context& context = Azure::Core::Context());
+
+}} // namespace Azure::Storage
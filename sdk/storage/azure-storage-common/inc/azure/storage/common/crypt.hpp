@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -34,6 +35,11 @@ namespace Azure { namespace Storage {
 
     void OnAppend(const uint8_t* data, size_t length) override;
     std::vector<uint8_t> OnFinal(const uint8_t* data, size_t length) override;
+    void OnReset() override
+    {
+      m_context = 0ULL;
+      m_length = 0ULL;
+    }
   };
 
   namespace _internal {
@@ -41,6 +47,86 @@ namespace Azure { namespace Storage {
     std::vector<uint8_t> HmacSha256(
         const std::vector<uint8_t>& data,
         const std::vector<uint8_t>& key);
+
+    /**
+     * @brief HMAC-SHA256 with a precomputed key schedule. The padded key is hashed once when the
+     * context is created, so signing a message only hashes the message itself.
+     */
+    class HmacSha256Context final {
+    public:
+      /**
+       * @brief Constructs the key schedule of a key.
+       *
+       * @param key The HMAC key.
+       */
+      explicit HmacSha256Context(const std::vector<uint8_t>& key);
+      ~HmacSha256Context();
+
+      HmacSha256Context(const HmacSha256Context&) = delete;
+      HmacSha256Context& operator=(const HmacSha256Context&) = delete;
+
+      /**
+       * @brief Computes the HMAC-SHA256 of some data with the key of this context. Can be called
+       * concurrently.
+       *
+       * @param data The data to sign.
+       * @param length The length of the data, in bytes.
+       * @return The HMAC-SHA256 of the data.
+       */
+      std::vector<uint8_t> Sign(const uint8_t* data, size_t length) const;
+
+    private:
+      struct Implementation;
+      std::unique_ptr<Implementation> m_implementation;
+    };
+
+    constexpr size_t AesGcmKeySize = 32;
+    constexpr size_t AesGcmNonceSize = 12;
+    constexpr size_t AesGcmTagSize = 16;
+
+    /**
+     * @brief Fills a buffer with cryptographically secure random bytes.
+     */
+    void GenerateRandomBytes(uint8_t* data, size_t length);
+
+    /**
+     * @brief Encrypts data with AES-256-GCM. Can be called concurrently.
+     *
+     * @param key The key, of AesGcmKeySize bytes.
+     * @param nonce The nonce, of AesGcmNonceSize bytes. Must not be used twice with a key.
+     * @param data The data to encrypt.
+     * @param length The length of the data, in bytes.
+     * @param output Receives the \p length bytes of encrypted data.
+     * @param tag Receives the authentication tag, of AesGcmTagSize bytes.
+     */
+    void Aes256GcmEncrypt(
+        const std::vector<uint8_t>& key,
+        const uint8_t* nonce,
+        const uint8_t* data,
+        size_t length,
+        uint8_t* output,
+        uint8_t* tag);
+
+    /**
+     * @brief Decrypts data encrypted with AES-256-GCM, and checks its authentication tag. Can be
+     * called concurrently.
+     *
+     * @param key The key, of AesGcmKeySize bytes.
+     * @param nonce The nonce, of AesGcmNonceSize bytes.
+     * @param data The data to decrypt.
+     * @param length The length of the data, in bytes.
+     * @param tag The authentication tag, of AesGcmTagSize bytes.
+     * @param output Receives the \p length bytes of decrypted data.
+     * @throw std::runtime_error if the data doesn't match the tag.
+     */
+    void Aes256GcmDecrypt(
+        const std::vector<uint8_t>& key,
+        const uint8_t* nonce,
+        const uint8_t* data,
+        size_t length,
+        const uint8_t* tag,
+        uint8_t* output);
+
     std::string UrlEncodeQueryParameter(const std::string& value);
     std::string UrlEncodePath(const std::string& value);
   } // namespace _internal
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace Azure { namespace Storage {
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::EndpointHealthTracker.
+   */
+  struct EndpointHealthTrackerOptions final
+  {
+    /**
+     * @brief The number of consecutive failed requests after which a host is unhealthy.
+     */
+    int32_t FailureThreshold = 3;
+
+    /**
+     * @brief How long the read requests are sent to the secondary host once the primary host is
+     * unhealthy, before one of them probes the primary host again.
+     */
+    std::chrono::milliseconds CoolingOffPeriod = std::chrono::seconds(30);
+  };
+
+  /**
+   * @brief Tracks the health of the primary hosts of storage accounts, so that the read requests
+   * of the clients sharing it are sent to the secondary host first while the primary host is
+   * unhealthy.
+   *
+   * @remark A host is unhealthy after #EndpointHealthTrackerOptions::FailureThreshold consecutive
+   * requests failed with a transport error or a `408`, `500`, `502`, `503` or `504` response. Its
+   * read requests then start on the secondary host, and are retried on the primary host. Once the
+   * cooling-off period is over, the next read request probes the primary host: if it succeeds,
+   * the primary host is healthy again; otherwise, another cooling-off period starts. The tracker is
+   * only used by the clients with a secondary host for retry reads.
+   */
+  class EndpointHealthTracker final {
+  public:
+    /**
+     * @brief Constructs a tracker.
+     *
+     * @param options Optional parameters for the tracker.
+     */
+    explicit EndpointHealthTracker(
+        EndpointHealthTrackerOptions options = EndpointHealthTrackerOptions());
+
+    EndpointHealthTracker(const EndpointHealthTracker&) = delete;
+    EndpointHealthTracker& operator=(const EndpointHealthTracker&) = delete;
+
+    /**
+     * @brief Checks whether a request should be sent to \p host first.
+     *
+     * @return `true` if \p host is healthy, or if the request probes it once the cooling-off
+     * period is over; otherwise, `false`.
+     */
+    bool IsAvailable(const std::string& host);
+
+    /**
+     * @brief Records a request to \p host which got a response that isn't a failure.
+     */
+    void ReportSuccess(const std::string& host);
+
+    /**
+     * @brief Records a request to \p host which failed.
+     */
+    void ReportFailure(const std::string& host);
+
+  private:
+    struct HostHealth final
+    {
+      int32_t ConsecutiveFailures = 0;
+      std::chrono::steady_clock::time_point UnavailableUntil;
+    };
+
+    EndpointHealthTrackerOptions m_options;
+    std::mutex m_mutex;
+    std::map<std::string, HostHealth> m_hosts;
+  };
+
+}} // namespace Azure::Storage
@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "azure/storage/common/internal/file_io.hpp"
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  /**
+   * @brief Writes to a file in the background, from a pool of buffers reused across writes.
+   *
+   * @remark On Linux, the writes are submitted to an io_uring, with the buffers registered to it
+   * when possible, so the threads producing the content don't wait for the disk. On Windows, they
+   * are overlapped writes completing to an I/O completion port. Elsewhere, or when neither is
+   * available, Write writes synchronously.
+   */
+  class AsyncFileWriter final {
+  public:
+    /**
+     * @brief Constructs a writer of \p fileWriter, with \p numBuffers buffers of \p bufferSize
+     * bytes.
+     */
+    explicit AsyncFileWriter(FileWriter& fileWriter, size_t bufferSize, size_t numBuffers);
+
+    /**
+     * @brief Waits for the writes in progress, without reporting their failures.
+     */
+    ~AsyncFileWriter();
+
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    size_t GetBufferSize() const { return m_bufferSize; }
+
+    /**
+     * @brief Gets a free buffer of GetBufferSize() bytes, waiting for a write to complete if all
+     * of them are in use.
+     */
+    uint8_t* AcquireBuffer();
+
+    /**
+     * @brief Gives back a buffer from AcquireBuffer without writing it.
+     */
+    void ReleaseBuffer(uint8_t* buffer);
+
+    /**
+     * @brief Writes \p length bytes of a buffer from AcquireBuffer at \p offset of the file. The
+     * buffer goes back to the pool once written.
+     */
+    void Write(uint8_t* buffer, size_t length, int64_t offset);
+
+    /**
+     * @brief Waits for the writes in progress, and throws if any write failed.
+     */
+    void Flush();
+
+  private:
+    struct Ring;
+
+    struct WriteRequest final
+    {
+      FileHandle Handle;
+      size_t BufferIndex;
+      const uint8_t* Data;
+      size_t Length;
+      int64_t Offset;
+    };
+
+    FileWriter& m_fileWriter;
+    const size_t m_bufferSize;
+    AlignedBuffer m_buffers;
+
+    // Guards the free buffers, the writes in progress, the requests and the error.
+    std::mutex m_mutex;
+    std::condition_variable m_writeCompleted;
+    std::vector<uint8_t*> m_freeBuffers;
+    // The number of writes in progress of each buffer.
+    std::vector<int32_t> m_bufferWrites;
+    size_t m_numWrites = 0;
+    std::exception_ptr m_error;
+    // The writes not submitted to the ring yet.
+    std::vector<WriteRequest> m_requests;
+    bool m_stopped = false;
+
+    // io_uring cancels the requests of a thread when it exits, so a single thread owned by the
+    // writer submits all the requests, and reaps their completions. The completion port works the
+    // same way.
+    std::unique_ptr<Ring> m_ring;
+    std::thread m_ringThread;
+
+    void RunRing();
+    void OnRingFailed();
+    void OnWriteCompleted(size_t bufferIndex, std::exception_ptr error);
+  };
+
+}}} // namespace Azure::Storage::_internal
@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include <azure/core/async_response.hpp>
+#include <azure/core/context.hpp>
+#include <azure/core/http/http.hpp>
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/core/nullable.hpp>
+#include <azure/core/response.hpp>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  /**
+   * @brief Sends a request through a pipeline asynchronously, and calls back with the response
+   * created from the raw response, or with the error.
+   *
+   * @remark The request, the pipeline and a copy of the context are kept alive until the
+   * callback is called. The body stream of the request must be kept alive by the caller.
+   *
+   * @param pipeline The pipeline to send the request through.
+   * @param request The request to send.
+   * @param context A context to control the request lifetime.
+   * @param createResponse Creates the response from the raw response, or throws the error it
+   * describes.
+   * @param callback The function called with the response or the error.
+   */
+  template <class T>
+  void SendAsync(
+      std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline,
+      Azure::Core::Http::Request request,
+      const Azure::Core::Context& context,
+      std::function<Azure::Response<T>(std::unique_ptr<Azure::Core::Http::RawResponse>)>
+          createResponse,
+      Azure::Core::ResponseCallback<T> callback)
+  {
+    struct State final
+    {
+      std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> Pipeline;
+      Azure::Core::Http::Request Request;
+      Azure::Core::Context Context;
+    };
+    auto state = std::make_shared<State>(State{std::move(pipeline), std::move(request), context});
+    state->Pipeline->SendAsync(
+        state->Request,
+        state->Context,
+        [state, createResponse = std::move(createResponse), callback = std::move(callback)](
+            std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse,
+            std::exception_ptr error) {
+          Azure::Nullable<Azure::Response<T>> response;
+          if (!error)
+          {
+            try
+            {
+              response = createResponse(std::move(rawResponse));
+            }
+            catch (...)
+            {
+              error = std::current_exception();
+            }
+          }
+          callback(std::move(response), error);
+        });
+  }
+
+}}} // namespace Azure::Storage::_internal
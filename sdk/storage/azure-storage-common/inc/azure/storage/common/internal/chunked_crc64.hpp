@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "azure/storage/common/crypt.hpp"
+#include "azure/storage/common/storage_common.hpp"
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  /**
+   * @brief Computes the CRC64 of a content transferred in chunks, from the CRC64 of the chunks.
+   *
+   * @remark The transfer threads hash the chunks as they read or write them, in any order. The
+   * CRC64 of the chunks are then concatenated in the order of their offsets, so the content isn't
+   * read again.
+   */
+  class ChunkedCrc64 final {
+  public:
+    /**
+     * @brief Hashes the \p size bytes at \p offset in the content. The calls are thread-safe, by
+     * the end they must have covered the content once.
+     *
+     * @return The CRC64 of the bytes.
+     */
+    ContentHash Append(int64_t offset, const uint8_t* data, size_t size);
+
+    /**
+     * @brief Gets the CRC64 of the \p length bytes at \p offset in the content, concatenated from
+     * the pieces appended, which must cover them exactly.
+     */
+    ContentHash GetRangeHash(int64_t offset, int64_t length);
+
+    /**
+     * @brief Gets the CRC64 of the content.
+     */
+    ContentHash Final();
+
+  private:
+    std::mutex m_mutex;
+    // The CRC64 of each piece of the content, by offset.
+    std::map<int64_t, std::unique_ptr<Crc64Hash>> m_pieces;
+  };
+
+}}} // namespace Azure::Storage::_internal
@@ -3,66 +3,788 @@
 
 #pragma once
 
+#include "azure/storage/common/buffer_pool.hpp"
+#include "azure/storage/common/internal/thread_pool.hpp"
+#include "azure/storage/common/transfer_scheduler.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/core/datetime.hpp>
+#include <azure/core/http/request_priority.hpp>
+
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
+#include <exception>
 #include <functional>
-#include <future>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <vector>
 
-namespace Azure { namespace Storage { namespace _internal {
+namespace Azure { namespace Storage {
+
+  namespace _detail {
+    // Runs threadFunc on the calling thread and as up to numTasks tasks of the pool. The tasks
+    // still queued in the pool when the calling thread is done don't run anymore, so a busy pool
+    // doesn't delay the transfer. Only the tasks already running are waited for.
+    inline void RunConcurrently(
+        int64_t numTasks,
+        const std::function<void()>& threadFunc,
+        _internal::ThreadPool& threadPool)
+    {
+      struct TasksState final
+      {
+        std::mutex Mutex;
+        std::condition_variable Finished;
+        int Running = 0;
+        bool Closed = false;
+      };
+      auto state = std::make_shared<TasksState>();
+
+      for (int64_t i = 0; i < numTasks; ++i)
+      {
+        threadPool.Submit([state, &threadFunc]() {
+          {
+            std::lock_guard<std::mutex> lock(state->Mutex);
+            if (state->Closed)
+            {
+              return;
+            }
+            ++state->Running;
+          }
+          threadFunc();
+          {
+            std::lock_guard<std::mutex> lock(state->Mutex);
+            --state->Running;
+          }
+          state->Finished.notify_all();
+        });
+      }
+
+      threadFunc();
+
+      std::unique_lock<std::mutex> lock(state->Mutex);
+      state->Closed = true;
+      state->Finished.wait(lock, [&state]() { return state->Running == 0; });
+    }
+  } // namespace _detail
+
+  namespace _internal {
+
+    /**
+     * @brief Transfers the chunks of a range concurrently.
+     *
+     * @remark The chunks get a child context of \p context, which is cancelled when a chunk fails,
+     * so the chunks in flight abort at once rather than complete for nothing. The exception of
+     * the failed chunk is the one rethrown.
+     */
+    inline void ConcurrentTransfer(
+        int64_t offset,
+        int64_t length,
+        int64_t chunkSize,
+        int concurrency,
+        // offset, length, chunk ID, number of chunks, context of the chunk
+        std::function<void(int64_t, int64_t, int64_t, int64_t, const Azure::Core::Context&)>
+            transferFunc,
+        const Azure::Core::Context& context,
+        TransferScheduler* scheduler = nullptr,
+        ThreadPool& threadPool = ThreadPool::GetDefault())
+    {
+      std::atomic<int> nextChunkId{0};
+      std::atomic<bool> failed{false};
+      std::exception_ptr firstError;
+      auto transferContext = context.WithDeadline((Azure::DateTime::max)());
+      const auto priority = Azure::Core::Http::GetRequestPriority(context);
+
+      const auto numChunks = (length + chunkSize - 1) / chunkSize;
+
+      auto threadFunc = [&]() {
+        while (true)
+        {
+          int chunkId = nextChunkId.fetch_add(1);
+          if (chunkId >= numChunks || failed)
+          {
+            break;
+          }
+          int64_t chunkOffset = offset + chunkSize * chunkId;
+          int64_t chunkLength = std::min(length - chunkSize * chunkId, chunkSize);
+          try
+          {
+            // This call is the operation the scheduler shares its slots fairly between.
+            TransferChunkSlot slot(scheduler, &nextChunkId, chunkLength, priority);
+            transferFunc(chunkOffset, chunkLength, chunkId, numChunks, transferContext);
+          }
+          catch (...)
+          {
+            if (failed.exchange(true) == false)
+            {
+              firstError = std::current_exception();
+              transferContext.Cancel();
+            }
+          }
+        }
+      };
+
+      _detail::RunConcurrently(
+          std::min<int64_t>(concurrency - 1, numChunks - 1), threadFunc, threadPool);
 
-  inline void ConcurrentTransfer(
-      int64_t offset,
-      int64_t length,
-      int64_t chunkSize,
-      int concurrency,
-      // offset, length, chunk ID, number of chunks
-      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc)
-  {
-    std::atomic<int> numWorkingThreads{concurrency};
-    std::atomic<int> nextChunkId{0};
-    std::atomic<bool> failed{false};
+      if (firstError)
+      {
+        std::rethrow_exception(firstError);
+      }
+    }
 
-    const auto numChunks = (length + chunkSize - 1) / chunkSize;
+    inline void ConcurrentTransfer(
+        int64_t offset,
+        int64_t length,
+        int64_t chunkSize,
+        int concurrency,
+        // offset, length, chunk ID, number of chunks
+        std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+        TransferScheduler* scheduler = nullptr,
+        ThreadPool& threadPool = ThreadPool::GetDefault())
+    {
+      ConcurrentTransfer(
+          offset,
+          length,
+          chunkSize,
+          concurrency,
+          [&transferFunc](
+              int64_t chunkOffset,
+              int64_t chunkLength,
+              int64_t chunkId,
+              int64_t numChunks,
+              const Azure::Core::Context&) {
+            transferFunc(chunkOffset, chunkLength, chunkId, numChunks);
+          },
+          Azure::Core::Context(),
+          scheduler,
+          threadPool);
+    }
+
+    /**
+     * @brief Transfers the chunks of a range concurrently and passes them in order to
+     * \p deliverFunc.
+     *
+     * @remark Chunks are transferred into one of `concurrency` buffers of \p chunkSize bytes,
+     * taken from \p bufferPool, or from the default pool if null. A chunk starts only when its
+     * buffer has been delivered, so no more than `concurrency` chunks ahead of the next one to
+     * deliver are held in memory. \p deliverFunc is called by one thread at a time.
+     *
+     * @remark When the `MaxBytesInUse` of the pool is reached, fewer buffers are used, down to
+     * one, and so fewer chunks are transferred at the same time.
+     *
+     * @remark The chunks get a child context of \p context, which is cancelled when a chunk or a
+     * delivery fails.
+     */
+    inline void OrderedConcurrentTransfer(
+        int64_t offset,
+        int64_t length,
+        int64_t chunkSize,
+        int concurrency,
+        // offset, length, chunk ID, number of chunks, buffer of the chunk, context of the chunk
+        std::function<
+            void(int64_t, int64_t, int64_t, int64_t, uint8_t*, const Azure::Core::Context&)>
+            transferFunc,
+        // data, size
+        std::function<void(const uint8_t*, size_t)> deliverFunc,
+        const Azure::Core::Context& context,
+        TransferScheduler* scheduler = nullptr,
+        const std::shared_ptr<BufferPool>& bufferPool = nullptr,
+        ThreadPool& threadPool = ThreadPool::GetDefault())
+    {
+      const int64_t numChunks = (length + chunkSize - 1) / chunkSize;
+      const int64_t maxWindowSize
+          = (std::max<int64_t>)((std::min<int64_t>)(concurrency, numChunks), 1);
+      auto chunkLength = [&](int64_t chunkId) {
+        return (std::min)(length - chunkSize * chunkId, chunkSize);
+      };
 
-    auto threadFunc = [&]() {
-      while (true)
+      // The first buffer waits for the budget of the pool, the others are only taken while they
+      // fit in it.
+      const auto bufferSize = static_cast<size_t>((std::min)(chunkSize, length));
+      std::vector<PooledBuffer> buffers;
+      buffers.reserve(static_cast<size_t>(maxWindowSize));
+      buffers.emplace_back(bufferPool, bufferSize);
+      while (static_cast<int64_t>(buffers.size()) < maxWindowSize)
       {
-        int chunkId = nextChunkId.fetch_add(1);
-        if (chunkId >= numChunks || failed)
+        auto buffer = PooledBuffer::TryCreate(bufferPool, bufferSize);
+        if (buffer.GetSize() == 0)
         {
           break;
         }
-        int64_t chunkOffset = offset + chunkSize * chunkId;
-        int64_t chunkLength = std::min(length - chunkSize * chunkId, chunkSize);
-        try
+        buffers.push_back(std::move(buffer));
+      }
+      const auto windowSize = static_cast<int64_t>(buffers.size());
+
+      // Guards all the variables below but the buffers. A buffer is only used by the chunk
+      // transferred into it, then by the thread delivering it.
+      std::mutex mutex;
+      std::condition_variable chunkDelivered;
+      std::vector<bool> transferred(static_cast<size_t>(windowSize), false);
+      int64_t nextChunkId = 0;
+      int64_t nextChunkToDeliver = 0;
+      bool delivering = false;
+      bool failed = false;
+      std::exception_ptr firstError;
+      auto transferContext = context.WithDeadline((Azure::DateTime::max)());
+      const auto priority = Azure::Core::Http::GetRequestPriority(context);
+
+      auto fail = [&](std::exception_ptr error) {
+        if (!failed)
         {
-          transferFunc(chunkOffset, chunkLength, chunkId, numChunks);
+          failed = true;
+          firstError = error;
+          transferContext.Cancel();
         }
-        catch (const std::exception&)
+        chunkDelivered.notify_all();
+      };
+
+      auto threadFunc = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
         {
-          if (failed.exchange(true) == false)
+          chunkDelivered.wait(lock, [&]() {
+            return failed || nextChunkId >= numChunks
+                || nextChunkId < nextChunkToDeliver + windowSize;
+          });
+          if (failed || nextChunkId >= numChunks)
+          {
+            break;
+          }
+          const int64_t chunkId = nextChunkId++;
+          const size_t slot = static_cast<size_t>(chunkId % windowSize);
+          lock.unlock();
+
+          std::exception_ptr error;
+          try
+          {
+            TransferChunkSlot chunkSlot(scheduler, &mutex, chunkLength(chunkId), priority);
+            transferFunc(
+                offset + chunkSize * chunkId,
+                chunkLength(chunkId),
+                chunkId,
+                numChunks,
+                buffers[slot].GetData(),
+                transferContext);
+          }
+          catch (...)
           {
-            numWorkingThreads.fetch_sub(1);
-            throw;
+            error = std::current_exception();
           }
+
+          lock.lock();
+          if (error)
+          {
+            fail(error);
+            break;
+          }
+          transferred[slot] = true;
+          if (delivering)
+          {
+            // The thread delivering the chunks before this one delivers it as well.
+            continue;
+          }
+          delivering = true;
+          while (!failed && nextChunkToDeliver < numChunks
+                 && transferred[static_cast<size_t>(nextChunkToDeliver % windowSize)])
+          {
+            const size_t deliverySlot = static_cast<size_t>(nextChunkToDeliver % windowSize);
+            const auto deliverySize = static_cast<size_t>(chunkLength(nextChunkToDeliver));
+            lock.unlock();
+            try
+            {
+              deliverFunc(buffers[deliverySlot].GetData(), deliverySize);
+            }
+            catch (...)
+            {
+              error = std::current_exception();
+            }
+            lock.lock();
+            if (error)
+            {
+              fail(error);
+              break;
+            }
+            transferred[deliverySlot] = false;
+            ++nextChunkToDeliver;
+            chunkDelivered.notify_all();
+          }
+          delivering = false;
+        }
+      };
+
+      _detail::RunConcurrently(windowSize - 1, threadFunc, threadPool);
+
+      if (firstError)
+      {
+        std::rethrow_exception(firstError);
+      }
+    }
+
+    inline void OrderedConcurrentTransfer(
+        int64_t offset,
+        int64_t length,
+        int64_t chunkSize,
+        int concurrency,
+        // offset, length, chunk ID, number of chunks, buffer of the chunk
+        std::function<void(int64_t, int64_t, int64_t, int64_t, uint8_t*)> transferFunc,
+        // data, size
+        std::function<void(const uint8_t*, size_t)> deliverFunc,
+        TransferScheduler* scheduler = nullptr,
+        const std::shared_ptr<BufferPool>& bufferPool = nullptr,
+        ThreadPool& threadPool = ThreadPool::GetDefault())
+    {
+      OrderedConcurrentTransfer(
+          offset,
+          length,
+          chunkSize,
+          concurrency,
+          [&transferFunc](
+              int64_t chunkOffset,
+              int64_t chunkLength,
+              int64_t chunkId,
+              int64_t numChunks,
+              uint8_t* buffer,
+              const Azure::Core::Context&) {
+            transferFunc(chunkOffset, chunkLength, chunkId, numChunks, buffer);
+          },
+          std::move(deliverFunc),
+          Azure::Core::Context(),
+          scheduler,
+          bufferPool,
+          threadPool);
+    }
+
+    /**
+     * @brief Sizes the chunks of an adaptive transfer and bounds how many of them are transferred
+     * at the same time, from the throughput and the latency of the chunks already transferred.
+     *
+     * @remark Like TCP congestion control, the chunk size and the concurrency grow additively while
+     * the throughput of the chunks holds up, and are halved when it drops below half of its average
+     * or when a chunk takes more than 10 seconds. The controller isn't thread-safe.
+     */
+    class AdaptiveChunkController final {
+    public:
+      /**
+       * @brief Constructs a controller starting with chunks of \p initialChunkSize bytes
+       * transferred one at a time.
+       *
+       * @param initialChunkSize The size of the first chunks, and of the chunk size increments.
+       * @param minChunkSize The smallest chunk size.
+       * @param maxChunkSize The largest chunk size.
+       * @param maxConcurrency The maximum number of chunks transferred at the same time.
+       */
+      explicit AdaptiveChunkController(
+          int64_t initialChunkSize,
+          int64_t minChunkSize,
+          int64_t maxChunkSize,
+          int32_t maxConcurrency)
+          : m_chunkSizeIncrement((std::max)(initialChunkSize, int64_t(1))),
+            m_minChunkSize((std::max)(minChunkSize, int64_t(1))),
+            m_maxChunkSize((std::max)(maxChunkSize, m_minChunkSize)),
+            m_chunkSize((std::min)((std::max)(initialChunkSize, m_minChunkSize), m_maxChunkSize)),
+            m_maxConcurrency((std::max)(maxConcurrency, 1))
+      {
+      }
+
+      /**
+       * @brief Gets the size of the next chunk.
+       *
+       */
+      int64_t GetChunkSize() const { return m_chunkSize; }
+
+      /**
+       * @brief Gets the number of chunks to transfer at the same time.
+       *
+       */
+      int32_t GetConcurrency() const { return m_concurrency; }
+
+      /**
+       * @brief Gets the maximum number of chunks transferred at the same time.
+       *
+       */
+      int32_t GetMaxConcurrency() const { return m_maxConcurrency; }
+
+      /**
+       * @brief Adjusts the chunk size and the concurrency after a chunk of \p length bytes has been
+       * transferred in \p duration.
+       */
+      void OnChunkTransferred(int64_t length, std::chrono::steady_clock::duration duration)
+      {
+        const auto maxChunkDuration = std::chrono::seconds(10);
+        const double seconds
+            = (std::max)(std::chrono::duration<double>(duration).count(), 1e-6);
+        const double throughput = static_cast<double>(length) / seconds;
+
+        if (m_averageThroughput > 0.0
+            && (throughput < m_averageThroughput / 2 || duration > maxChunkDuration))
+        {
+          m_chunkSize = (std::max)(m_chunkSize / 2, m_minChunkSize);
+          m_concurrency = (std::max)(m_concurrency / 2, 1);
         }
+        else
+        {
+          m_chunkSize = (std::min)(m_chunkSize + m_chunkSizeIncrement, m_maxChunkSize);
+          m_concurrency = (std::min)(m_concurrency + 1, m_maxConcurrency);
+        }
+
+        m_averageThroughput = m_averageThroughput > 0.0
+            ? m_averageThroughput * 0.75 + throughput * 0.25
+            : throughput;
       }
-      numWorkingThreads.fetch_sub(1);
+
+    private:
+      int64_t m_chunkSizeIncrement;
+      int64_t m_minChunkSize;
+      int64_t m_maxChunkSize;
+      int64_t m_chunkSize;
+      int32_t m_maxConcurrency;
+      int32_t m_concurrency = 1;
+      double m_averageThroughput = 0.0;
     };
 
-    std::vector<std::future<void>> threadHandles;
-    for (int i = 0; i < concurrency - 1; ++i)
+    /**
+     * @brief Transfers the chunks of a range with the sizes and the concurrency given by
+     * \p controller, which is updated after each chunk.
+     *
+     * @remark The number of chunks passed to \p transferFunc is only known by the last chunk, the
+     * others get -1. The chunks get a child context of \p context, which is cancelled when a
+     * chunk fails.
+     *
+     * @return The number of chunks.
+     */
+    inline int64_t AdaptiveConcurrentTransfer(
+        int64_t offset,
+        int64_t length,
+        AdaptiveChunkController& controller,
+        // offset, length, chunk ID, number of chunks, context of the chunk
+        std::function<void(int64_t, int64_t, int64_t, int64_t, const Azure::Core::Context&)>
+            transferFunc,
+        const Azure::Core::Context& context,
+        TransferScheduler* scheduler = nullptr,
+        ThreadPool& threadPool = ThreadPool::GetDefault())
     {
-      threadHandles.emplace_back(std::async(std::launch::async, threadFunc));
+      const int64_t end = offset + length;
+
+      // Guards the controller and all the variables below.
+      std::mutex mutex;
+      std::condition_variable chunkTransferred;
+      int64_t nextOffset = offset;
+      int64_t nextChunkId = 0;
+      int32_t chunksInFlight = 0;
+      bool failed = false;
+      std::exception_ptr firstError;
+      auto transferContext = context.WithDeadline((Azure::DateTime::max)());
+      const auto priority = Azure::Core::Http::GetRequestPriority(context);
+
+      auto threadFunc = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+          chunkTransferred.wait(lock, [&]() {
+            return failed || nextOffset >= end || chunksInFlight < controller.GetConcurrency();
+          });
+          if (failed || nextOffset >= end)
+          {
+            break;
+          }
+          const int64_t chunkOffset = nextOffset;
+          const int64_t chunkLength = (std::min)(end - chunkOffset, controller.GetChunkSize());
+          const int64_t chunkId = nextChunkId++;
+          nextOffset += chunkLength;
+          const int64_t numChunks = nextOffset >= end ? nextChunkId : -1;
+          ++chunksInFlight;
+          lock.unlock();
+
+          std::chrono::steady_clock::duration duration;
+          std::exception_ptr error;
+          try
+          {
+            TransferChunkSlot slot(scheduler, &mutex, chunkLength, priority);
+            const auto start = std::chrono::steady_clock::now();
+            transferFunc(chunkOffset, chunkLength, chunkId, numChunks, transferContext);
+            duration = std::chrono::steady_clock::now() - start;
+          }
+          catch (...)
+          {
+            error = std::current_exception();
+          }
+
+          lock.lock();
+          --chunksInFlight;
+          if (error)
+          {
+            if (!failed)
+            {
+              failed = true;
+              firstError = error;
+              transferContext.Cancel();
+            }
+          }
+          else
+          {
+            controller.OnChunkTransferred(chunkLength, duration);
+          }
+          chunkTransferred.notify_all();
+        }
+      };
+
+      _detail::RunConcurrently(controller.GetMaxConcurrency() - 1, threadFunc, threadPool);
+
+      if (firstError)
+      {
+        std::rethrow_exception(firstError);
+      }
+      return nextChunkId;
     }
-    threadFunc();
-    for (auto& handle : threadHandles)
+
+    inline int64_t AdaptiveConcurrentTransfer(
+        int64_t offset,
+        int64_t length,
+        AdaptiveChunkController& controller,
+        // offset, length, chunk ID, number of chunks
+        std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+        TransferScheduler* scheduler = nullptr,
+        ThreadPool& threadPool = ThreadPool::GetDefault())
     {
-      handle.get();
+      return AdaptiveConcurrentTransfer(
+          offset,
+          length,
+          controller,
+          [&transferFunc](
+              int64_t chunkOffset,
+              int64_t chunkLength,
+              int64_t chunkId,
+              int64_t numChunks,
+              const Azure::Core::Context&) {
+            transferFunc(chunkOffset, chunkLength, chunkId, numChunks);
+          },
+          Azure::Core::Context(),
+          scheduler,
+          threadPool);
     }
-  }
 
-}}} // namespace Azure::Storage::_internal
+    /**
+     * @brief Reads the chunks of a stream of unknown length one after the other, and transfers
+     * them concurrently.
+     *
+     * @remark Each of up to `concurrency` threads reads a chunk of \p chunkSize bytes with
+     * \p readFunc into its own buffer, taken from \p bufferPool, or from the default pool if null,
+     * then transfers it while the other threads read and transfer the next chunks. So no more than
+     * `concurrency` chunks are held in memory. \p readFunc is called by one thread at a time, and
+     * the stream ends with the first chunk it doesn't fill. The number of chunks passed to
+     * \p transferFunc is only known by a chunk shorter than \p chunkSize, the others get -1.
+     *
+     * @remark The chunks get a child context of \p context, which is cancelled when a read or a
+     * chunk fails.
+     *
+     * @return The number of chunks.
+     */
+    inline int64_t StreamingConcurrentTransfer(
+        int64_t chunkSize,
+        int concurrency,
+        // buffer, size, returns the number of bytes read
+        std::function<size_t(uint8_t*, size_t)> readFunc,
+        // chunk ID, number of chunks, data, size, context of the chunk
+        std::function<
+            void(int64_t, int64_t, const uint8_t*, size_t, const Azure::Core::Context&)>
+            transferFunc,
+        const Azure::Core::Context& context,
+        TransferScheduler* scheduler = nullptr,
+        const std::shared_ptr<BufferPool>& bufferPool = nullptr,
+        ThreadPool& threadPool = ThreadPool::GetDefault())
+    {
+      // Guards the stream and all the variables below.
+      std::mutex mutex;
+      int64_t nextChunkId = 0;
+      bool endOfStream = false;
+      bool failed = false;
+      std::exception_ptr firstError;
+      auto transferContext = context.WithDeadline((Azure::DateTime::max)());
+      const auto priority = Azure::Core::Http::GetRequestPriority(context);
+
+      auto fail = [&](std::exception_ptr error) {
+        if (!failed)
+        {
+          failed = true;
+          firstError = error;
+          transferContext.Cancel();
+        }
+      };
+
+      auto threadFunc = [&]() {
+        // Taken when the thread reads its first chunk, so a short stream only takes one buffer.
+        PooledBuffer buffer;
+        while (true)
+        {
+          int64_t chunkId;
+          int64_t numChunks = -1;
+          size_t size = 0;
+          std::exception_ptr error;
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (failed || endOfStream)
+            {
+              break;
+            }
+            try
+            {
+              if (buffer.GetSize() == 0)
+              {
+                buffer = PooledBuffer(bufferPool, static_cast<size_t>(chunkSize));
+              }
+              size = readFunc(buffer.GetData(), buffer.GetSize());
+            }
+            catch (...)
+            {
+              fail(std::current_exception());
+              break;
+            }
+            if (size < buffer.GetSize())
+            {
+              endOfStream = true;
+              if (size == 0)
+              {
+                break;
+              }
+              numChunks = nextChunkId + 1;
+            }
+            chunkId = nextChunkId++;
+          }
+
+          try
+          {
+            TransferChunkSlot slot(scheduler, &mutex, static_cast<int64_t>(size), priority);
+            transferFunc(chunkId, numChunks, buffer.GetData(), size, transferContext);
+          }
+          catch (...)
+          {
+            error = std::current_exception();
+          }
+          if (error)
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            fail(error);
+            break;
+          }
+        }
+      };
+
+      _detail::RunConcurrently(std::max(concurrency, 1) - 1, threadFunc, threadPool);
+
+      if (firstError)
+      {
+        std::rethrow_exception(firstError);
+      }
+      return nextChunkId;
+    }
+
+    inline int64_t StreamingConcurrentTransfer(
+        int64_t chunkSize,
+        int concurrency,
+        // buffer, size, returns the number of bytes read
+        std::function<size_t(uint8_t*, size_t)> readFunc,
+        // chunk ID, number of chunks, data, size
+        std::function<void(int64_t, int64_t, const uint8_t*, size_t)> transferFunc,
+        TransferScheduler* scheduler = nullptr,
+        const std::shared_ptr<BufferPool>& bufferPool = nullptr,
+        ThreadPool& threadPool = ThreadPool::GetDefault())
+    {
+      return StreamingConcurrentTransfer(
+          chunkSize,
+          concurrency,
+          std::move(readFunc),
+          [&transferFunc](
+              int64_t chunkId,
+              int64_t numChunks,
+              const uint8_t* data,
+              size_t size,
+              const Azure::Core::Context&) { transferFunc(chunkId, numChunks, data, size); },
+          Azure::Core::Context(),
+          scheduler,
+          bufferPool,
+          threadPool);
+    }
+
+    // Runs tasks, which can add more tasks, on up to a number of threads until none is left. The
+    // urgent tasks run before the others, so the tasks discovering more work aren't held behind
+    // the transfers. After a task throws, no other task starts.
+    class TaskQueue final {
+    public:
+      void Push(std::function<void()> task, bool urgent = false)
+      {
+        {
+          std::lock_guard<std::mutex> guard(m_mutex);
+          if (urgent)
+          {
+            m_tasks.push_front(std::move(task));
+          }
+          else
+          {
+            m_tasks.push_back(std::move(task));
+          }
+        }
+        m_tasksChanged.notify_one();
+      }
+
+      // Runs the tasks on the calling thread and on up to concurrency - 1 tasks of the pool, and
+      // throws the exception of the first failed task.
+      void Run(int32_t concurrency, ThreadPool& threadPool = ThreadPool::GetDefault())
+      {
+        auto threadFunc = [this]() {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          while (true)
+          {
+            // Running tasks may still add new ones.
+            m_tasksChanged.wait(
+                lock, [this]() { return m_firstError || !m_tasks.empty() || m_numRunning == 0; });
+            if (m_firstError || m_tasks.empty())
+            {
+              break;
+            }
+            auto task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            ++m_numRunning;
+            lock.unlock();
+            std::exception_ptr error;
+            try
+            {
+              task();
+            }
+            catch (...)
+            {
+              error = std::current_exception();
+            }
+            lock.lock();
+            --m_numRunning;
+            if (error && !m_firstError)
+            {
+              m_firstError = error;
+            }
+            m_tasksChanged.notify_all();
+          }
+        };
+
+        _detail::RunConcurrently(std::max(concurrency, 1) - 1, threadFunc, threadPool);
+
+        if (m_firstError)
+        {
+          std::rethrow_exception(m_firstError);
+        }
+      }
+
+    private:
+      std::mutex m_mutex;
+      std::condition_variable m_tasksChanged;
+      std::deque<std::function<void()>> m_tasks;
+      int32_t m_numRunning = 0;
+      std::exception_ptr m_firstError;
+    };
+
+  } // namespace _internal
+
+}} // namespace Azure::Storage
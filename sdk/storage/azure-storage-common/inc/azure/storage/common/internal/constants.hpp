@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace Azure { namespace Storage { namespace _internal {
   constexpr static const char* BlobServicePackageName = "storage-blobs";
   constexpr static const char* DatalakeServicePackageName = "storage-files-datalake";
@@ -19,4 +21,5 @@ namespace Azure { namespace Storage { namespace _internal {
   constexpr static const char* DefaultSasVersion = "2020-02-10";
 
   constexpr int ReliableStreamRetryCount = 3;
+  constexpr int64_t ReliableStreamMinBytesPerSecond = 16 * 1024;
 }}} // namespace Azure::Storage::_internal
@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  /**
+   * @brief Splits a content into chunks whose boundaries only depend on the bytes before them,
+   * found with a gear rolling hash.
+   *
+   * @remark An insertion or a deletion in the content only changes the chunks around it, so the
+   * chunks of two versions of a content are mostly the same. The chunks are between a quarter of
+   * and four times the average chunk size.
+   */
+  class ContentDefinedChunker final {
+  public:
+    /**
+     * @brief Constructs a chunker, starting the first chunk.
+     *
+     * @param averageChunkSize The average size of the chunks, at least 64 bytes.
+     */
+    explicit ContentDefinedChunker(int64_t averageChunkSize);
+
+    /**
+     * @brief Gets the size of the largest chunks.
+     */
+    int64_t GetMaxChunkSize() const { return m_maxChunkSize; }
+
+    /**
+     * @brief Looks for the end of the current chunk in the next bytes of the content.
+     *
+     * @param data The next bytes of the content.
+     * @param size The number of bytes.
+     * @param chunkEnd Set to `true` if the chunk ends in \p data; the next call then starts a new
+     * chunk.
+     * @return The number of bytes of \p data in the current chunk.
+     */
+    size_t FindChunkEnd(const uint8_t* data, size_t size, bool& chunkEnd);
+
+  private:
+    int64_t m_minChunkSize;
+    int64_t m_maxChunkSize;
+    uint64_t m_mask;
+    uint64_t m_hash = 0;
+    int64_t m_chunkSize = 0;
+  };
+
+}}} // namespace Azure::Storage::_internal
@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <azure/core/nullable.hpp>
 #include <azure/core/platform.hpp>
 
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace Azure { namespace Storage { namespace _internal {
 
@@ -16,9 +19,50 @@ namespace Azure { namespace Storage { namespace _internal {
   using FileHandle = int;
 #endif
 
+  // The alignment of the buffers, offsets and lengths of unbuffered file I/O.
+  constexpr size_t UnbufferedFileIoAlignment = 4096;
+
+  // The length of the beginning of an I/O which can bypass the page cache.
+  size_t GetUnbufferedLength(const void* buffer, size_t length, int64_t offset);
+
+  // A range of bytes of a file, or of a buffer.
+  struct FileRange final
+  {
+    int64_t Offset = 0;
+    int64_t Length = 0;
+  };
+
+  // The size of the blocks content is checked for zeros by, the page size of page blobs.
+  constexpr size_t ZeroCheckBlockSize = 512;
+
+  // Appends the ranges of the length bytes of data made of the blocks of ZeroCheckBlockSize bytes
+  // that aren't all zeros, the last one possibly shorter, with the offset of data added.
+  void FindNonZeroRanges(
+      const uint8_t* data,
+      size_t length,
+      int64_t offset,
+      std::vector<FileRange>& ranges);
+
+  // A buffer aligned for unbuffered file I/O.
+  class AlignedBuffer final {
+  public:
+    explicit AlignedBuffer(size_t size);
+
+    uint8_t* GetData() { return m_data; }
+
+    size_t GetSize() const { return m_size; }
+
+  private:
+    std::unique_ptr<uint8_t[]> m_buffer;
+    uint8_t* m_data;
+    size_t m_size;
+  };
+
   class FileReader final {
   public:
-    FileReader(const std::string& filename);
+    // With unbuffered, the aligned part of the reads bypasses the page cache, if the file system
+    // supports it.
+    FileReader(const std::string& filename, bool unbuffered = false);
 
     ~FileReader();
 
@@ -26,23 +70,118 @@ namespace Azure { namespace Storage { namespace _internal {
 
     int64_t GetFileSize() const { return m_fileSize; }
 
+    // The time of the last write of the file, as in LocalDirectoryEntry::LastWriteTime.
+    int64_t GetLastWriteTime() const;
+
+    // Reads up to length bytes at offset, fewer only at the end of the file.
+    size_t Read(uint8_t* buffer, size_t length, int64_t offset) const;
+
+    // Lists the ranges of the file holding data, without the holes of a sparse file. If the file
+    // system can't tell, the whole file is a single range.
+    std::vector<FileRange> GetDataRanges() const;
+
   private:
     FileHandle m_handle;
+    Azure::Nullable<FileHandle> m_unbufferedHandle;
     int64_t m_fileSize;
   };
 
+  // Maps the whole content of a file in memory, read-only and for sequential access.
+  class FileMapping final {
+  public:
+    explicit FileMapping(const FileReader& fileReader);
+
+    ~FileMapping();
+
+    FileMapping(const FileMapping&) = delete;
+
+    FileMapping& operator=(const FileMapping&) = delete;
+
+    const uint8_t* GetData() const { return m_data; }
+
+    int64_t GetSize() const { return m_size; }
+
+  private:
+#if defined(AZ_PLATFORM_WINDOWS)
+    void* m_mappingHandle = nullptr;
+#endif
+    const uint8_t* m_data = nullptr;
+    int64_t m_size;
+  };
+
   class FileWriter final {
   public:
-    FileWriter(const std::string& filename);
+    // With unbuffered, the aligned part of the writes bypasses the page cache, if the file system
+    // supports it. Without truncate, an existing file is kept as is, to be written in place.
+    FileWriter(const std::string& filename, bool unbuffered = false, bool truncate = true);
 
     ~FileWriter();
 
     FileHandle GetHandle() const { return m_handle; }
 
+    // The handle bypassing the page cache, if the writer is unbuffered and the file system
+    // supports it.
+    const Azure::Nullable<FileHandle>& GetUnbufferedHandle() const { return m_unbufferedHandle; }
+
     void Write(const uint8_t* buffer, size_t length, int64_t offset);
 
+    // Allocates the space for a file of size bytes, if the file system supports it.
+    void Preallocate(int64_t size);
+
+    // Marks the file as sparse, if the file system supports it, and resizes it to size bytes. The
+    // bytes never written read as zeros and, in a sparse file, take no space on disk.
+    void SetSparseSize(int64_t size);
+
+    // Zeros length bytes from offset, deallocating them if the file system supports it.
+    void Zero(int64_t offset, int64_t length);
+
+  private:
+    FileHandle m_handle;
+    Azure::Nullable<FileHandle> m_unbufferedHandle;
+  };
+
+  // Creates a file of size bytes, truncating an existing one, and maps it in memory to be written
+  // in place. The space of the file is allocated first if the file system supports it, since
+  // running out of space while writing to the mapping isn't reported as an error.
+  class WritableFileMapping final {
+  public:
+    WritableFileMapping(const std::string& filename, int64_t size);
+
+    ~WritableFileMapping();
+
+    WritableFileMapping(const WritableFileMapping&) = delete;
+
+    WritableFileMapping& operator=(const WritableFileMapping&) = delete;
+
+    uint8_t* GetData() { return m_data; }
+
+    int64_t GetSize() const { return m_size; }
+
   private:
     FileHandle m_handle;
+#if defined(AZ_PLATFORM_WINDOWS)
+    void* m_mappingHandle = nullptr;
+#endif
+    uint8_t* m_data = nullptr;
+    int64_t m_size;
+  };
+
+  struct LocalDirectoryEntry final
+  {
+    std::string Name;
+    bool IsDirectory = false;
+    // The size of a file.
+    int64_t Size = 0;
+    // The time of the last write of a file, in nanoseconds since an epoch specific to the
+    // platform. Only meant to be compared to another time of the same file.
+    int64_t LastWriteTime = 0;
   };
 
+  // Lists the files and the directories in a directory, following symbolic links. Other kinds of
+  // entries are skipped.
+  std::vector<LocalDirectoryEntry> ListLocalDirectory(const std::string& path);
+
+  // Creates a directory and the parents missing. A directory already there isn't an error.
+  void CreateLocalDirectories(const std::string& path);
+
 }}} // namespace Azure::Storage::_internal
@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  /**
+   * @brief Gets the largest size of the gzip member compressing \p size bytes.
+   */
+  size_t GzipMaxCompressedSize(size_t size);
+
+  /**
+   * @brief Compresses \p size bytes of \p data into a gzip member.
+   *
+   * @remark A content compressed in chunks is the concatenation of their members, which is a
+   * valid gzip content, so the chunks can be compressed concurrently.
+   *
+   * @param output The buffer the member is written to, of at least GzipMaxCompressedSize(size)
+   * bytes.
+   * @return The size of the member.
+   */
+  size_t GzipCompress(const uint8_t* data, size_t size, uint8_t* output, size_t outputSize);
+
+  /**
+   * @brief Decompresses a gzip content of one or more members, passed in pieces in order.
+   */
+  class GzipDecoder final {
+  public:
+    GzipDecoder();
+    ~GzipDecoder();
+
+    GzipDecoder(const GzipDecoder&) = delete;
+    GzipDecoder& operator=(const GzipDecoder&) = delete;
+
+    /**
+     * @brief Decompresses the next \p size bytes of the content, passing the decompressed bytes
+     * to \p sink.
+     */
+    void Decode(
+        const uint8_t* data,
+        size_t size,
+        const std::function<void(const uint8_t*, size_t)>& sink);
+
+    /**
+     * @brief Checks that the content ended with a complete member.
+     */
+    void Finish();
+
+  private:
+    struct Implementation;
+    std::unique_ptr<Implementation> m_impl;
+  };
+
+}}} // namespace Azure::Storage::_internal
@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <azure/core/context.hpp>
+#include <azure/core/cryptography/hash.hpp>
+#include <azure/core/io/body_stream.hpp>
+
+#include "azure/storage/common/storage_common.hpp"
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  /**
+   * @brief Decorates a body stream by hashing the bytes read from it, so a request body is
+   * hashed while the transport sends it instead of being read once more beforehand.
+   *
+   * @remark Rewinding the stream, as a retry does, restarts the hash.
+   */
+  class HashingBodyStream final : public Azure::Core::IO::BodyStream {
+  public:
+    /**
+     * @brief Constructs a `%HashingBodyStream` reading from \p inner.
+     *
+     * @param inner The stream to read from, which must outlive this stream.
+     * @param algorithm The hash algorithm.
+     */
+    HashingBodyStream(Azure::Core::IO::BodyStream& inner, HashAlgorithm algorithm);
+
+    int64_t Length() const override { return m_inner.Length(); }
+
+    void Rewind() override;
+
+    /**
+     * @brief Gets the hash of the bytes read since the stream was last rewound. Can only be
+     * called once.
+     */
+    ContentHash GetHash();
+
+  private:
+    size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
+
+    Azure::Core::IO::BodyStream& m_inner;
+    HashAlgorithm m_algorithm;
+    std::unique_ptr<Azure::Core::Cryptography::Hash> m_hash;
+  };
+
+}}} // namespace Azure::Storage::_internal
@@ -0,0 +1,115 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <azure/core/context.hpp>
+#include <azure/core/io/body_stream.hpp>
+
+#include "azure/storage/common/buffer_pool.hpp"
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  // Options used by parallel prefetch stream
+  struct ParallelPrefetchStreamOptions final
+  {
+    // The size of each range fetched ahead of the reader.
+    int64_t ChunkSize;
+
+    // The maximum number of ranges fetched or held ahead of the reader.
+    int32_t Concurrency;
+
+    // The pool of the buffers of the ranges. If null, the default pool.
+    std::shared_ptr<Azure::Storage::BufferPool> BufferPool;
+  };
+
+  /**
+   * @brief Reads a range of a resource sequentially, while the ranges which follow are fetched
+   * ahead of the reader with parallel requests.
+   *
+   * @remark The stream reads the beginning of the range from an initial body stream. Meanwhile,
+   * threads owned by the stream call a chunk fetcher for the next `Concurrency` chunks, and store
+   * them in memory until they are read. A chunk fetcher is expected to verify the `eTag` from the
+   * initial request, so all the chunks come from the same content.
+   *
+   * @remark Destroying the stream cancels the fetches in progress and waits for them.
+   */
+  class ParallelPrefetchBodyStream final : public Azure::Core::IO::BodyStream {
+  public:
+    /**
+     * @brief Constructs a stream over \p length bytes of a resource, the first ones of which are
+     * read from \p initial.
+     *
+     * @param initial The body stream with the beginning of the range.
+     * @param offset The offset of the range in the resource.
+     * @param length The length of the range.
+     * @param options The chunk size and the concurrency of the fetches.
+     * @param chunkFetcher Gets a body stream with a given length, at a given offset of the
+     * resource.
+     * @param context The context of the fetches. It can cancel them.
+     */
+    explicit ParallelPrefetchBodyStream(
+        std::unique_ptr<Azure::Core::IO::BodyStream> initial,
+        int64_t offset,
+        int64_t length,
+        ParallelPrefetchStreamOptions options,
+        std::function<std::unique_ptr<Azure::Core::IO::BodyStream>(
+            int64_t,
+            int64_t,
+            Azure::Core::Context const&)> chunkFetcher,
+        Azure::Core::Context const& context);
+
+    ~ParallelPrefetchBodyStream() override;
+
+    int64_t Length() const override { return m_length; }
+
+  private:
+    struct Chunk final
+    {
+      int64_t Offset = 0;
+      int64_t Length = 0;
+      PooledBuffer Data;
+      bool Fetched = false;
+      std::exception_ptr Error;
+    };
+
+    std::unique_ptr<Azure::Core::IO::BodyStream> m_initial;
+    int64_t m_initialRemaining;
+    const int64_t m_length;
+    int64_t m_position = 0;
+    const ParallelPrefetchStreamOptions m_options;
+    const std::function<std::unique_ptr<Azure::Core::IO::BodyStream>(
+        int64_t,
+        int64_t,
+        Azure::Core::Context const&)>
+        m_chunkFetcher;
+    // A child of the context of the stream, cancelled when the stream is destroyed.
+    Azure::Core::Context m_context;
+
+    // Guards the chunks, the next offset to fetch and the stop flag.
+    std::mutex m_mutex;
+    std::condition_variable m_chunksChanged;
+    // The chunks being fetched or not fully read yet, in order.
+    std::deque<std::unique_ptr<Chunk>> m_chunks;
+    size_t m_chunkReadOffset = 0;
+    int64_t m_nextFetchOffset;
+    const int64_t m_end;
+    bool m_stopped = false;
+    std::vector<std::thread> m_threads;
+
+    void FetchChunks();
+
+    size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
+  };
+
+}}} // namespace Azure::Storage::_internal
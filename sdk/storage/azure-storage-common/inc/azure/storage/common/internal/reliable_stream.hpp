@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <memory>
 
@@ -15,6 +16,14 @@ namespace Azure { namespace Storage { namespace _internal {
   {
     // configures the maximun retries to be done.
     int32_t MaxRetryRequests;
+    // The delay before the first retry, doubled for each subsequent retry up to MaxRetryDelay.
+    std::chrono::milliseconds RetryDelay = std::chrono::milliseconds(100);
+    std::chrono::milliseconds MaxRetryDelay = std::chrono::seconds(4);
+    // A connection which reads less than MinBytesPerSecond over StallWindow of reads, or which is
+    // blocked in a read for StallWindow, is stalled and reconnected from the current offset. 0
+    // disables the stall detection.
+    int64_t MinBytesPerSecond = 0;
+    std::chrono::milliseconds StallWindow = std::chrono::seconds(30);
   };
 
   /**
@@ -41,8 +50,15 @@ namespace Azure { namespace Storage { namespace _internal {
         m_streamReconnector;
     // Options to use when getting a new bodyStream like current offset
     int64_t m_retryOffset;
+    int64_t const m_length;
+    // The bytes read from the inner stream, and the time spent reading them, since the stall
+    // detection window started.
+    int64_t m_windowBytes = 0;
+    std::chrono::steady_clock::duration m_windowReadTime{};
+    int32_t m_stallReconnects = 0;
 
     size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
+    bool IsStalled(size_t readBytes, std::chrono::steady_clock::duration readTime);
 
   public:
     explicit ReliableStream(
@@ -52,15 +68,19 @@ namespace Azure { namespace Storage { namespace _internal {
             std::unique_ptr<Azure::Core::IO::BodyStream>(int64_t, Azure::Core::Context const&)>
             streamReconnector)
         : m_inner(std::move(inner)), m_options(options),
-          m_streamReconnector(std::move(streamReconnector)), m_retryOffset(0)
+          m_streamReconnector(std::move(streamReconnector)), m_retryOffset(0),
+          m_length(m_inner->Length())
     {
     }
 
-    int64_t Length() const override { return this->m_inner->Length(); }
+    int64_t Length() const override { return this->m_length; }
     void Rewind() override
     {
       // Rewind directly from a transportAdapter body stream (like libcurl) would throw
-      this->m_inner->Rewind();
+      if (this->m_inner)
+      {
+        this->m_inner->Rewind();
+      }
       this->m_retryOffset = 0;
     }
   };
@@ -22,6 +22,12 @@ namespace Azure { namespace Storage { namespace _internal {
         Core::Http::Request& request,
         Core::Http::Policies::NextHttpPolicy nextPolicy,
         Core::Context const& context) const override;
+
+    void SendAsync(
+        Core::Http::Request& request,
+        Core::Http::Policies::NextHttpPolicy nextPolicy,
+        Core::Context const& context,
+        Core::Http::SendCompletionCallback callback) const override;
   };
 
 }}} // namespace Azure::Storage::_internal
@@ -5,6 +5,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <azure/core/http/policies/policy.hpp>
 
@@ -13,7 +15,9 @@ namespace Azure { namespace Storage { namespace _internal {
   class StorageServiceVersionPolicy final : public Azure::Core::Http::Policies::HttpPolicy {
   public:
     explicit StorageServiceVersionPolicy(std::string apiVersion)
-        : m_apiVersion(std::move(apiVersion))
+        : m_headerBlock(std::make_shared<const Azure::Core::Http::_internal::HttpHeaderBlock>(
+            std::vector<std::pair<std::string, std::string>>{
+                {HttpHeaderXMsVersion, std::move(apiVersion)}}))
     {
     }
 
@@ -27,12 +31,13 @@ namespace Azure { namespace Storage { namespace _internal {
         Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
         const Azure::Core::Context& context) const override
     {
-      request.SetHeader(HttpHeaderXMsVersion, m_apiVersion);
+      request.AddHeaderBlock(m_headerBlock);
       return nextPolicy.Send(request, context);
     }
 
   private:
-    std::string m_apiVersion;
+    // The x-ms-version header, validated and serialized once for all the requests.
+    std::shared_ptr<const Azure::Core::Http::_internal::HttpHeaderBlock> m_headerBlock;
   };
 
 }}} // namespace Azure::Storage::_internal
@@ -9,6 +9,7 @@
 #include <azure/core/http/policies/policy.hpp>
 
 #include "azure/storage/common/dll_import_export.hpp"
+#include "azure/storage/common/endpoint_health_tracker.hpp"
 
 namespace Azure { namespace Storage { namespace _internal {
 
@@ -21,8 +22,12 @@ namespace Azure { namespace Storage { namespace _internal {
 
   class StorageSwitchToSecondaryPolicy final : public Azure::Core::Http::Policies::HttpPolicy {
   public:
-    explicit StorageSwitchToSecondaryPolicy(std::string primaryHost, std::string secondaryHost)
-        : m_primaryHost(std::move(primaryHost)), m_secondaryHost(std::move(secondaryHost))
+    explicit StorageSwitchToSecondaryPolicy(
+        std::string primaryHost,
+        std::string secondaryHost,
+        std::shared_ptr<EndpointHealthTracker> endpointHealthTracker = nullptr)
+        : m_primaryHost(std::move(primaryHost)), m_secondaryHost(std::move(secondaryHost)),
+          m_endpointHealthTracker(std::move(endpointHealthTracker))
     {
     }
 
@@ -37,8 +42,16 @@ namespace Azure { namespace Storage { namespace _internal {
         const Azure::Core::Context& context) const override;
 
   private:
+    // Sends the request, and reports its outcome to the health tracker if it is sent to the
+    // primary host.
+    std::unique_ptr<Azure::Core::Http::RawResponse> SendToHost(
+        Azure::Core::Http::Request& request,
+        Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
+        const Azure::Core::Context& context) const;
+
     std::string m_primaryHost;
     std::string m_secondaryHost;
+    std::shared_ptr<EndpointHealthTracker> m_endpointHealthTracker;
   };
 
 }}} // namespace Azure::Storage::_internal
@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  /**
+   * @brief A work-stealing pool of threads to run the chunks of concurrent transfers.
+   *
+   * @remark Each thread has its own queue of tasks. A task submitted from a thread of the pool
+   * goes to the queue of that thread, any other task is spread over the queues. Threads run the
+   * tasks from the back of their own queue and, when it is empty, steal from the front of the
+   * others. Each queue has its own lock, and the lock of the pool is only taken to start a thread
+   * or to park and wake idle threads.
+   *
+   * @remark Threads are started as tasks are submitted, until there are `maxThreads` of them.
+   * They can be restricted to a set of CPUs.
+   */
+  class ThreadPool final {
+  public:
+    /**
+     * @brief Constructs a pool which runs up to \p maxThreads tasks at the same time.
+     *
+     * @param maxThreads The maximum number of threads of the pool. At least one thread is used.
+     * @param cpuAffinity The CPUs the threads of the pool are allowed to run on, or empty to let
+     * them run on any CPU. The CPUs which can't be set are ignored.
+     */
+    explicit ThreadPool(size_t maxThreads, std::vector<int> cpuAffinity = {});
+
+    /**
+     * @brief Runs the tasks already submitted and stops the threads of the pool.
+     *
+     */
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    /**
+     * @brief Queues \p task to be run by a thread of the pool.
+     *
+     * @remark Exceptions thrown by \p task are ignored, tasks are expected to report their own
+     * errors.
+     */
+    void Submit(std::function<void()> task);
+
+    /**
+     * @brief Gets the maximum number of tasks the pool runs at the same time.
+     *
+     */
+    size_t GetMaxThreads() const { return m_workers.size(); }
+
+    /**
+     * @brief Gets the pool shared by all the transfers of the process.
+     *
+     * @remark It has twice as many threads as the hardware has cores, and at least 8. Transfers
+     * are network bound, so their threads spend most of the time waiting.
+     */
+    static ThreadPool& GetDefault();
+
+  private:
+    struct Worker final
+    {
+      std::mutex Mutex;
+      std::deque<std::function<void()>> Tasks;
+    };
+
+    std::vector<int> m_cpuAffinity;
+
+    // One queue per thread, created up front so they can be stolen from without a lock on the list.
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+    // The tasks queued and not taken by a thread yet, and the threads parked waiting for one. A
+    // thread parks after incrementing m_idleThreads and checking m_queuedTasks, and a task is
+    // submitted by incrementing m_queuedTasks and checking m_idleThreads, so that the lock below is
+    // only taken to wake a parked thread.
+    std::atomic<size_t> m_queuedTasks{0};
+    std::atomic<size_t> m_idleThreads{0};
+    std::atomic<size_t> m_numThreads{0};
+    std::atomic<size_t> m_nextWorker{0};
+
+    // Guards the threads and the stop flag, and the parking of the threads.
+    std::mutex m_mutex;
+    std::condition_variable m_taskAvailable;
+    std::vector<std::thread> m_threads;
+    bool m_stop = false;
+
+    void Run(size_t workerIndex);
+    bool TryClaimTask();
+    bool TryGetTask(size_t workerIndex, std::function<void()>& task);
+  };
+
+}}} // namespace Azure::Storage::_internal
@@ -4,8 +4,13 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
+#include <memory>
 #include <string>
 
+#include <azure/core/context.hpp>
+#include <azure/core/io/body_stream.hpp>
+
 namespace Azure { namespace Storage { namespace _internal {
 
   enum class XmlNodeType
@@ -18,31 +23,72 @@ namespace Azure { namespace Storage { namespace _internal {
     End,
   };
 
+  /**
+   * @brief A reference to a NUL-terminated string, which doesn't own it. The strings of the nodes
+   * returned by XmlReader stay valid until the next call to XmlReader::Read().
+   */
+  class XmlString final {
+  public:
+    XmlString() noexcept : m_data(""), m_length(0) {}
+    XmlString(const char* data) noexcept : m_data(data), m_length(std::strlen(data)) {}
+    XmlString(const std::string& data) noexcept : m_data(data.data()), m_length(data.length()) {}
+
+    const char* data() const noexcept { return m_data; }
+    size_t length() const noexcept { return m_length; }
+    bool empty() const noexcept { return m_length == 0; }
+
+    operator std::string() const { return std::string(m_data, m_length); }
+
+    // Comparing with a literal checks its length, known at compile time, first.
+    template <size_t N> bool operator==(const char (&other)[N]) const noexcept
+    {
+      return m_length == N - 1 && std::memcmp(m_data, other, N - 1) == 0;
+    }
+    template <size_t N> bool operator!=(const char (&other)[N]) const noexcept
+    {
+      return !(*this == other);
+    }
+    bool operator==(const std::string& other) const noexcept
+    {
+      return m_length == other.length() && std::memcmp(m_data, other.data(), m_length) == 0;
+    }
+    bool operator!=(const std::string& other) const noexcept { return !(*this == other); }
+
+  private:
+    const char* m_data;
+    size_t m_length;
+  };
+
   struct XmlNode final
   {
-    explicit XmlNode(
-        XmlNodeType type,
-        std::string name = std::string(),
-        std::string value = std::string())
-        : Type(type), Name(std::move(name)), Value(std::move(value))
+    explicit XmlNode(XmlNodeType type, XmlString name = XmlString(), XmlString value = XmlString())
+        : Type(type), Name(name), Value(value)
     {
     }
 
     XmlNodeType Type;
-    std::string Name;
-    std::string Value;
+    XmlString Name;
+    XmlString Value;
   };
 
   class XmlReader final {
   public:
     explicit XmlReader(const char* data, size_t length);
+    /**
+     * @brief Parses a document while it is read from a stream, which must outlive the reader.
+     * Reading the stream is cancelled with the context.
+     */
+    explicit XmlReader(Azure::Core::IO::BodyStream& stream, const Azure::Core::Context& context);
     ~XmlReader();
 
     XmlNode Read();
 
   private:
+    struct StreamSource;
+
     void* m_reader = nullptr;
     bool m_readingAttributes = false;
+    std::unique_ptr<StreamSource> m_streamSource;
   };
 
   class XmlWriter final {
@@ -52,6 +98,11 @@ namespace Azure { namespace Storage { namespace _internal {
 
     void Write(XmlNode node);
 
+    /**
+     * @brief Writes the Base64 encoding of binary data as text, straight into the document.
+     */
+    void WriteBase64(const uint8_t* data, size_t length);
+
     std::string GetDocument();
 
   private:
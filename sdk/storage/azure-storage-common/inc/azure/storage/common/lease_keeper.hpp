@@ -0,0 +1,180 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <azure/core/context.hpp>
+
+namespace Azure { namespace Storage {
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::LeaseKeeper.
+   */
+  struct LeaseKeeperOptions final
+  {
+    /**
+     * @brief The resolution of the timer renewing the leases.
+     */
+    std::chrono::milliseconds TickInterval = std::chrono::milliseconds(100);
+
+    /**
+     * @brief Each renewal is brought forward by a random delay up to this one, up to a quarter of
+     * the lease duration, so that the leases acquired together aren't renewed in bursts.
+     */
+    std::chrono::milliseconds MaxJitter = std::chrono::seconds(1);
+
+    /**
+     * @brief The maximum number of renewals in progress at the same time, for all the leases.
+     */
+    int32_t MaxConcurrentRenewals = 16;
+
+    /**
+     * @brief A renewal failing with a transient error is retried after this delay, as long as the
+     * lease hasn't expired by then.
+     */
+    std::chrono::milliseconds RetryDelay = std::chrono::seconds(1);
+  };
+
+  /**
+   * @brief LeaseKeeper renews many leases in the background with a single thread, until they're
+   * removed or lost.
+   *
+   * @remark Each lease is renewed when half its duration has elapsed since it was last renewed.
+   * The renewals are scheduled on a hierarchical timer wheel, so that adding, renewing or removing
+   * a lease takes the same time however many leases are kept, and run on the storage thread pool,
+   * at most `MaxConcurrentRenewals` at a time. They reuse the connections of the clients of the
+   * leases.
+   *
+   * @remark A lease is lost when a renewal fails with a client error, such as when the lease was
+   * broken or changed, or when it couldn't be renewed before it expired. The lost leases are
+   * removed and reported to their handlers.
+   *
+   * @remark The leases of blobs, containers, paths and file systems are added with the
+   * `KeepRenewed` function of their lease client.
+   */
+  class LeaseKeeper final {
+  public:
+    /**
+     * @brief Renews a lease. Throws if the renewal fails.
+     */
+    using RenewFunction = std::function<void(const Azure::Core::Context& context)>;
+
+    /**
+     * @brief Handles the exception of the renewal a lease was lost with. Exceptions thrown by the
+     * handler are ignored.
+     */
+    using LostLeaseHandler = std::function<void(std::exception_ptr error)>;
+
+    /**
+     * @brief Initializes a new instance of the LeaseKeeper, which starts the thread scheduling the
+     * renewals.
+     *
+     * @param options Optional parameters of the keeper.
+     */
+    explicit LeaseKeeper(const LeaseKeeperOptions& options = LeaseKeeperOptions());
+
+    /**
+     * @brief Stops renewing, see #Stop.
+     */
+    ~LeaseKeeper();
+
+    LeaseKeeper(const LeaseKeeper&) = delete;
+    LeaseKeeper& operator=(const LeaseKeeper&) = delete;
+
+    /**
+     * @brief Starts renewing a lease which was just acquired or renewed. Can be called from
+     * several threads at the same time.
+     *
+     * @param renew Renews the lease.
+     * @param duration The duration of the lease. Leases with an infinite duration don't need to be
+     * renewed.
+     * @param onLost Handles the loss of the lease. If null, it's ignored.
+     * @return The key of the lease in the keeper, to remove it.
+     */
+    int64_t AddLease(
+        RenewFunction renew,
+        std::chrono::seconds duration,
+        LostLeaseHandler onLost = LostLeaseHandler());
+
+    /**
+     * @brief Stops renewing a lease. A renewal in progress isn't waited for.
+     *
+     * @param leaseKey The key returned when the lease was added.
+     */
+    void RemoveLease(int64_t leaseKey);
+
+    /**
+     * @brief Stops renewing all the leases, cancels the renewals in progress and waits for them.
+     */
+    void Stop();
+
+  private:
+    static constexpr int WheelBits = 6;
+    static constexpr size_t WheelSize = size_t(1) << WheelBits;
+    static constexpr size_t WheelLevels = 3;
+
+    struct KeptLease final
+    {
+      int64_t Key;
+      RenewFunction Renew;
+      LostLeaseHandler OnLost;
+      std::chrono::steady_clock::duration Duration;
+      // When the lease expires unless it's renewed before.
+      std::chrono::steady_clock::time_point ExpiresOn;
+      // The tick of the timer wheel the next renewal is due at.
+      uint64_t DueTick = 0;
+      bool Removed = false;
+    };
+
+    using WheelSlot = std::vector<std::shared_ptr<KeptLease>>;
+
+    // The functions below must be called with m_mutex locked.
+    void Schedule(std::shared_ptr<KeptLease> lease, std::chrono::steady_clock::time_point dueTime);
+    void InsertIntoWheel(std::shared_ptr<KeptLease> lease);
+    void AdvanceTicks(std::chrono::steady_clock::time_point now);
+    void StartRenewals();
+    std::chrono::steady_clock::time_point GetNextRenewalTime(const KeptLease& lease);
+
+    void Renew(std::shared_ptr<KeptLease> lease);
+    void RunTimer();
+
+    LeaseKeeperOptions m_options;
+    // Cancelled when the keeper is stopped.
+    Azure::Core::Context m_renewalContext;
+
+    // Guards the variables below.
+    std::mutex m_mutex;
+    std::condition_variable m_stateChanged;
+    std::unordered_map<int64_t, std::shared_ptr<KeptLease>> m_leases;
+    int64_t m_nextLeaseKey = 0;
+    // The slot j of the level i holds the leases due at the ticks t within WheelSize^(i + 1)
+    // ticks such that (t >> (i * WheelBits)) % WheelSize == j. The slots of the upper levels are
+    // moved down as the wheel turns.
+    std::array<std::array<WheelSlot, WheelSize>, WheelLevels> m_wheel;
+    std::chrono::steady_clock::time_point m_startTime;
+    uint64_t m_currentTick = 0;
+    // The leases due, waiting for a renewal slot.
+    std::deque<std::shared_ptr<KeptLease>> m_dueLeases;
+    // The renewals and the handlers running.
+    int32_t m_numRunning = 0;
+    std::mt19937_64 m_random;
+    bool m_stopping = false;
+
+    std::thread m_timerThread;
+  };
+
+}} // namespace Azure::Storage
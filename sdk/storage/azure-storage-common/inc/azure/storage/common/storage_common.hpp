@@ -52,6 +52,25 @@ namespace Azure { namespace Storage {
     HashAlgorithm Algorithm = HashAlgorithm::Md5;
   };
 
+  /**
+   * @brief How the chunks of a parallel transfer are sized.
+   */
+  enum class TransferStrategy
+  {
+    /**
+     * @brief All the chunks have the configured size and the configured concurrency is used for
+     * the whole transfer.
+     */
+    Fixed,
+
+    /**
+     * @brief The chunks start with the configured size, one at a time, and the chunk size and the
+     * concurrency adapt to the throughput and the latency measured during the transfer. The
+     * configured concurrency is the maximum.
+     */
+    Adaptive,
+  };
+
   namespace _internal {
     ContentHash FromBase64String(const std::string& base64String, HashAlgorithm algorithm);
     std::string ToBase64String(const ContentHash& hash);
@@ -20,7 +20,8 @@ namespace Azure { namespace Storage {
 
   namespace _internal {
     class SharedKeyPolicy;
-  }
+    class HmacSha256Context;
+  } // namespace _internal
 
   /**
    * @brief A StorageSharedKeyCredential is a credential backed by a storage account's name and
@@ -50,6 +51,7 @@ namespace Azure { namespace Storage {
     {
       std::lock_guard<std::mutex> guard(m_mutex);
       m_accountKey = std::move(accountKey);
+      m_signingContext.reset();
     }
 
     /**
@@ -69,8 +71,13 @@ namespace Azure { namespace Storage {
       return m_accountKey;
     }
 
+    // Returns the HMAC-SHA256 key schedule of the decoded account key, built on first use and
+    // rebuilt after Update().
+    std::shared_ptr<const _internal::HmacSha256Context> GetSigningContext() const;
+
     mutable std::mutex m_mutex;
     std::string m_accountKey;
+    mutable std::shared_ptr<const _internal::HmacSha256Context> m_signingContext;
   };
 
   namespace _internal {
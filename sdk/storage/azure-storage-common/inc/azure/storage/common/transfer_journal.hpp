@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage {
+
+  /**
+   * @brief A store for the progress of a chunked transfer, so that a transfer which was
+   * interrupted can be resumed by a later one, possibly in another process.
+   *
+   * @remark A journal holds the records of one transfer at a time. The records are short lines of
+   * text, without line breaks, written in the order they are appended. A journal is only used by
+   * one transfer at a time, but the records of a transfer may be appended from several threads.
+   */
+  class TransferJournal {
+  public:
+    virtual ~TransferJournal() = default;
+
+    /**
+     * @brief Reads the records appended since the journal was last cleared.
+     *
+     * @return The records, in the order they were appended.
+     */
+    virtual std::vector<std::string> ReadRecords() = 0;
+
+    /**
+     * @brief Appends a record to the journal.
+     *
+     * @remark The record must be stored durably once this function returns, so that it is read
+     * back by a transfer resumed after a crash.
+     *
+     * @param record The record to append.
+     */
+    virtual void AppendRecord(const std::string& record) = 0;
+
+    /**
+     * @brief Removes all the records from the journal.
+     */
+    virtual void Clear() = 0;
+
+  protected:
+    TransferJournal() = default;
+    TransferJournal(const TransferJournal&) = default;
+    TransferJournal& operator=(const TransferJournal&) = default;
+  };
+
+  /**
+   * @brief A #Azure::Storage::TransferJournal stored in a file, one record per line.
+   *
+   * @remark The file is created by the first record appended, and deleted when the journal is
+   * cleared.
+   */
+  class FileTransferJournal final : public TransferJournal {
+  public:
+    /**
+     * @brief Constructs a journal stored in a file.
+     *
+     * @param fileName The name of the file the journal is stored in.
+     */
+    explicit FileTransferJournal(std::string fileName);
+
+    std::vector<std::string> ReadRecords() override;
+    void AppendRecord(const std::string& record) override;
+    void Clear() override;
+
+  private:
+    std::string m_fileName;
+    std::mutex m_mutex;
+  };
+
+  namespace _internal {
+
+    /**
+     * @brief Tracks the chunks of a transfer in a #Azure::Storage::TransferJournal.
+     *
+     * @remark The first record of the journal describes the transfer, and the others the chunks
+     * done. A transfer described by the same record resumes the progress it finds; any other
+     * transfer starts over and replaces the records.
+     */
+    class TransferProgress final {
+    public:
+      /**
+       * @brief Reads the progress of a transfer from a journal.
+       *
+       * @param journal The journal, or null if the transfer isn't journaled.
+       * @param transfer A description of the transfer, which changes along with anything that
+       * makes the chunks done useless, like the ETag of the source or the chunk size.
+       */
+      TransferProgress(std::shared_ptr<TransferJournal> journal, std::string transfer);
+
+      TransferProgress(const TransferProgress&) = delete;
+      TransferProgress& operator=(const TransferProgress&) = delete;
+
+      /**
+       * @brief Checks whether the chunk was done by the transfer being resumed.
+       *
+       * @remark The chunks done by this transfer aren't tracked, so this can be called
+       * concurrently.
+       */
+      bool IsChunkDone(int64_t chunkId) const
+      {
+        return m_chunksDone.find(chunkId) != m_chunksDone.end();
+      }
+
+      /**
+       * @brief Checks whether the journal had chunks of this transfer done.
+       */
+      bool IsResumed() const { return !m_chunksDone.empty(); }
+
+      /**
+       * @brief Records a chunk done.
+       */
+      void OnChunkDone(int64_t chunkId);
+
+      /**
+       * @brief Clears the journal once the transfer is done.
+       */
+      void OnTransferDone();
+
+    private:
+      std::shared_ptr<TransferJournal> m_journal;
+      std::set<int64_t> m_chunksDone;
+    };
+
+  } // namespace _internal
+
+}} // namespace Azure::Storage
@@ -0,0 +1,154 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <azure/core/http/request_priority.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace Azure { namespace Storage {
+
+  namespace _internal {
+    class TransferChunkSlot;
+  } // namespace _internal
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::TransferScheduler.
+   */
+  struct TransferSchedulerOptions final
+  {
+    /**
+     * @brief The maximum number of chunks transferred at the same time by all the operations
+     * sharing the scheduler. 0 means no limit.
+     */
+    int32_t MaxConcurrentChunks = 16;
+
+    /**
+     * @brief The maximum number of bytes per second transferred by all the operations sharing the
+     * scheduler. 0 means no limit.
+     */
+    int64_t MaxBytesPerSecond = 0;
+
+    /**
+     * @brief The number of chunks of `MaxConcurrentChunks` which only the operations of
+     * #Azure::Core::Http::RequestPriority::High can transfer. At least one chunk is left to the
+     * other operations.
+     */
+    int32_t HighPriorityReservedChunks = 0;
+  };
+
+  /**
+   * @brief Bounds the chunks of concurrent uploads and downloads across operations and clients.
+   *
+   * @remark The `Concurrency` of transfer options applies to a single call. Clients created with
+   * the same scheduler in their options also share its budgets: a chunk starts only when fewer
+   * than `MaxConcurrentChunks` chunks of all the operations are in flight. When a chunk finishes,
+   * the next one to start belongs to the waiting operation with the fewest chunks in flight, so a
+   * large transfer doesn't starve the others.
+   *
+   * @remark The priority of an operation is the one set to its context by
+   * #Azure::Core::Http::WithRequestPriority. The chunks of the operations with a higher priority
+   * start before any other waiting chunk, and only they can use the `HighPriorityReservedChunks`
+   * slots, so a background transfer doesn't delay latency-sensitive ones.
+   *
+   * @remark The bandwidth budget is charged with the size of each chunk when it starts.
+   */
+  class TransferScheduler final {
+  public:
+    /**
+     * @brief Constructs a scheduler.
+     *
+     * @param options Optional parameters for the scheduler.
+     */
+    explicit TransferScheduler(TransferSchedulerOptions options = TransferSchedulerOptions());
+
+    TransferScheduler(const TransferScheduler&) = delete;
+    TransferScheduler& operator=(const TransferScheduler&) = delete;
+
+    /**
+     * @brief Gets the options of the scheduler.
+     *
+     */
+    const TransferSchedulerOptions& GetOptions() const { return m_options; }
+
+  private:
+    struct Waiter final
+    {
+      const void* Operation;
+      Azure::Core::Http::RequestPriority Priority;
+      bool Granted = false;
+    };
+
+    TransferSchedulerOptions m_options;
+
+    std::mutex m_mutex;
+    std::condition_variable m_slotGranted;
+    int32_t m_chunksInFlight = 0;
+    // The number of chunks in flight for each operation with at least one chunk in flight.
+    std::map<const void*, int32_t> m_operationChunks;
+    // In the order they started waiting, whatever their priority.
+    std::list<Waiter*> m_waiters;
+
+    // Bytes which can be sent without waiting, negative when the last chunks went over budget.
+    double m_availableBytes = 0.0;
+    std::chrono::steady_clock::time_point m_lastRefill;
+
+    void Acquire(
+        const void* operation,
+        int64_t chunkSize,
+        Azure::Core::Http::RequestPriority priority);
+    void Release(const void* operation);
+    void GrantSlots();
+    std::chrono::steady_clock::duration ConsumeBytes(int64_t chunkSize);
+
+    friend class _internal::TransferChunkSlot;
+  };
+
+  namespace _internal {
+    /**
+     * @brief Holds a slot of a #Azure::Storage::TransferScheduler while a chunk is transferred.
+     *
+     */
+    class TransferChunkSlot final {
+    public:
+      /**
+       * @brief Waits for a slot for a chunk of \p operation, of priority \p priority. Nothing is
+       * waited for when \p scheduler is null.
+       */
+      explicit TransferChunkSlot(
+          TransferScheduler* scheduler,
+          const void* operation,
+          int64_t chunkSize,
+          Azure::Core::Http::RequestPriority priority = Azure::Core::Http::RequestPriority::Normal)
+          : m_scheduler(scheduler), m_operation(operation)
+      {
+        if (m_scheduler)
+        {
+          m_scheduler->Acquire(m_operation, chunkSize, priority);
+        }
+      }
+
+      ~TransferChunkSlot()
+      {
+        if (m_scheduler)
+        {
+          m_scheduler->Release(m_operation);
+        }
+      }
+
+      TransferChunkSlot(const TransferChunkSlot&) = delete;
+      TransferChunkSlot& operator=(const TransferChunkSlot&) = delete;
+
+    private:
+      TransferScheduler* m_scheduler;
+      const void* m_operation;
+    };
+  } // namespace _internal
+
+}} // namespace Azure::Storage
@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Azure { namespace Storage {
+
+  /**
+   * @brief The bytes transferred by the parallel uploads and downloads of a client, since it was
+   * created.
+   *
+   * @remark The bytes are counted as the chunks are done, so they include the ones of the
+   * transfers in progress and of the transfers which failed. Sampling them periodically gives the
+   * throughput of the client.
+   */
+  struct TransferStatistics final
+  {
+    /**
+     * @brief The number of bytes downloaded.
+     */
+    int64_t BytesDownloaded = 0;
+
+    /**
+     * @brief The number of bytes uploaded.
+     */
+    int64_t BytesUploaded = 0;
+
+    /**
+     * @brief The number of downloads completed.
+     */
+    int64_t DownloadsCompleted = 0;
+
+    /**
+     * @brief The number of uploads completed.
+     */
+    int64_t UploadsCompleted = 0;
+  };
+
+  namespace _internal {
+
+    /**
+     * @brief The counters of the transfers of a client, shared by its copies.
+     */
+    struct TransferCounters final
+    {
+      std::atomic<int64_t> BytesDownloaded{0};
+      std::atomic<int64_t> BytesUploaded{0};
+      std::atomic<int64_t> DownloadsCompleted{0};
+      std::atomic<int64_t> UploadsCompleted{0};
+
+      /**
+       * @brief Reads the counters.
+       */
+      TransferStatistics GetStatistics() const;
+    };
+
+    /**
+     * @brief Counts the bytes of a transfer as its chunks are done, and passes them to a progress
+     * handler.
+     *
+     * @remark The chunks are counted with relaxed atomic additions, so the transfer threads don't
+     * synchronize unless the handler is due. The handler is called by one thread at a time, at
+     * most once per interval, and once more when the transfer is done.
+     */
+    class TransferProgressReporter final {
+    public:
+      /**
+       * @brief Constructs a reporter.
+       *
+       * @param counters The counters of the client, or null.
+       * @param isUpload Whether the bytes are counted as uploaded or downloaded by the client.
+       * @param handler The handler called with the bytes transferred and the total bytes, or
+       * null.
+       * @param interval The minimum interval between two calls of the handler.
+       */
+      TransferProgressReporter(
+          std::shared_ptr<TransferCounters> counters,
+          bool isUpload,
+          std::function<void(int64_t, int64_t)> handler,
+          std::chrono::milliseconds interval);
+
+      TransferProgressReporter(const TransferProgressReporter&) = delete;
+      TransferProgressReporter& operator=(const TransferProgressReporter&) = delete;
+
+      /**
+       * @brief Sets the total number of bytes of the transfer, once it's known. It's -1 until
+       * then.
+       */
+      void SetTotalBytes(int64_t totalBytes)
+      {
+        m_totalBytes.store(totalBytes, std::memory_order_relaxed);
+      }
+
+      /**
+       * @brief Counts the bytes of a chunk done, and calls the handler if it's due.
+       */
+      void OnBytesTransferred(int64_t bytes);
+
+      /**
+       * @brief Counts the transfer as completed, and calls the handler with the final count.
+       */
+      void OnTransferDone();
+
+    private:
+      void Report();
+
+      std::shared_ptr<TransferCounters> m_counters;
+      bool m_isUpload;
+      std::function<void(int64_t, int64_t)> m_handler;
+      std::chrono::steady_clock::duration m_interval;
+      std::atomic<int64_t> m_bytesTransferred{0};
+      std::atomic<int64_t> m_totalBytes{-1};
+      // The time the handler is next due, in ticks of the steady clock.
+      std::atomic<std::chrono::steady_clock::rep> m_nextReport;
+      std::mutex m_reportMutex;
+    };
+
+  } // namespace _internal
+}} // namespace Azure::Storage
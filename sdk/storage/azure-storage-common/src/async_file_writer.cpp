@@ -0,0 +1,606 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/internal/async_file_writer.hpp"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+// IORING_FEAT_RW_CUR_POS comes with IORING_OP_READ and IORING_OP_WRITE, in Linux 5.6.
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) \
+    && defined(__NR_io_uring_register) && defined(IORING_FEAT_RW_CUR_POS)
+#define AZ_STORAGE_IO_URING
+#endif
+#endif
+#endif
+
+#if defined(AZ_PLATFORM_WINDOWS)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <windows.h>
+// ReOpenFile is only available to desktop apps.
+#if !defined(WINAPI_PARTITION_DESKTOP) \
+    || WINAPI_PARTITION_DESKTOP // See azure/core/platform.hpp for explanation.
+#define AZ_STORAGE_IOCP
+#endif
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+#if defined(AZ_STORAGE_IO_URING)
+  namespace {
+    // The user data of the read of the event waking the ring thread.
+    constexpr uint64_t WakeUserData = ~uint64_t(0);
+
+    // Retries the interrupted calls, and the calls failing for a lack of resources.
+    int IoUringEnter(int ringFd, unsigned toSubmit, unsigned minComplete, unsigned flags)
+    {
+      while (true)
+      {
+        int ret = static_cast<int>(
+            syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0));
+        if (ret >= 0)
+        {
+          return ret;
+        }
+        if (errno == EAGAIN || errno == EBUSY)
+        {
+          std::this_thread::yield();
+        }
+        else if (errno != EINTR)
+        {
+          return ret;
+        }
+      }
+    }
+  } // namespace
+
+  struct AsyncFileWriter::Ring final
+  {
+    int Fd = -1;
+    int WakeFd = -1;
+    uint64_t WakeValue = 0;
+    void* Rings = MAP_FAILED;
+    size_t RingsSize = 0;
+    io_uring_sqe* Sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t SqesSize = 0;
+    bool FixedBuffers = false;
+    // The requests pushed since the last submission.
+    unsigned NumPushed = 0;
+
+    unsigned* SqTail = nullptr;
+    unsigned* SqMask = nullptr;
+    unsigned* SqArray = nullptr;
+    unsigned* CqHead = nullptr;
+    unsigned* CqTail = nullptr;
+    unsigned* CqMask = nullptr;
+    io_uring_cqe* Cqes = nullptr;
+
+    // Returns nullptr when io_uring isn't available.
+    static std::unique_ptr<Ring> Create(unsigned entries, uint8_t* buffers, size_t buffersSize)
+    {
+      io_uring_params params;
+      std::memset(&params, 0, sizeof(params));
+      auto ring = std::make_unique<Ring>();
+      ring->Fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+      if (ring->Fd < 0 || !(params.features & IORING_FEAT_SINGLE_MMAP)
+          || !(params.features & IORING_FEAT_RW_CUR_POS))
+      {
+        return nullptr;
+      }
+      ring->WakeFd = eventfd(0, EFD_CLOEXEC);
+      if (ring->WakeFd < 0)
+      {
+        return nullptr;
+      }
+
+      // With IORING_FEAT_SINGLE_MMAP, the submission and completion rings share one mapping.
+      ring->RingsSize = (std::max)(
+          params.sq_off.array + params.sq_entries * sizeof(unsigned),
+          params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+      ring->Rings = mmap(
+          nullptr,
+          ring->RingsSize,
+          PROT_READ | PROT_WRITE,
+          MAP_SHARED | MAP_POPULATE,
+          ring->Fd,
+          IORING_OFF_SQ_RING);
+      if (ring->Rings == MAP_FAILED)
+      {
+        return nullptr;
+      }
+      ring->SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+      ring->Sqes = static_cast<io_uring_sqe*>(mmap(
+          nullptr,
+          ring->SqesSize,
+          PROT_READ | PROT_WRITE,
+          MAP_SHARED | MAP_POPULATE,
+          ring->Fd,
+          IORING_OFF_SQES));
+      if (ring->Sqes == MAP_FAILED)
+      {
+        return nullptr;
+      }
+
+      auto* rings = static_cast<uint8_t*>(ring->Rings);
+      ring->SqTail = reinterpret_cast<unsigned*>(rings + params.sq_off.tail);
+      ring->SqMask = reinterpret_cast<unsigned*>(rings + params.sq_off.ring_mask);
+      ring->SqArray = reinterpret_cast<unsigned*>(rings + params.sq_off.array);
+      ring->CqHead = reinterpret_cast<unsigned*>(rings + params.cq_off.head);
+      ring->CqTail = reinterpret_cast<unsigned*>(rings + params.cq_off.tail);
+      ring->CqMask = reinterpret_cast<unsigned*>(rings + params.cq_off.ring_mask);
+      ring->Cqes = reinterpret_cast<io_uring_cqe*>(rings + params.cq_off.cqes);
+
+      // Registering the buffers saves mapping them on each write. It fails when they're over the
+      // locked memory limit, then the writes use unregistered buffers.
+      iovec buffersIovec;
+      buffersIovec.iov_base = buffers;
+      buffersIovec.iov_len = buffersSize;
+      ring->FixedBuffers
+          = syscall(__NR_io_uring_register, ring->Fd, IORING_REGISTER_BUFFERS, &buffersIovec, 1)
+          == 0;
+      return ring;
+    }
+
+    ~Ring()
+    {
+      if (Sqes != MAP_FAILED)
+      {
+        munmap(Sqes, SqesSize);
+      }
+      if (Rings != MAP_FAILED)
+      {
+        munmap(Rings, RingsSize);
+      }
+      if (WakeFd >= 0)
+      {
+        close(WakeFd);
+      }
+      if (Fd >= 0)
+      {
+        close(Fd);
+      }
+    }
+
+    // Adds a request to the submission queue. Only the ring thread adds requests.
+    io_uring_sqe& Push()
+    {
+      const unsigned index = (*SqTail + NumPushed++) & *SqMask;
+      io_uring_sqe& sqe = Sqes[index];
+      std::memset(&sqe, 0, sizeof(sqe));
+      SqArray[index] = index;
+      return sqe;
+    }
+
+    void PushWakeRead()
+    {
+      io_uring_sqe& sqe = Push();
+      sqe.opcode = IORING_OP_READ;
+      sqe.fd = WakeFd;
+      sqe.addr = reinterpret_cast<uint64_t>(&WakeValue);
+      sqe.len = sizeof(WakeValue);
+      sqe.user_data = WakeUserData;
+    }
+
+    // Submits the requests pushed, then waits for a completion.
+    bool SubmitAndWait()
+    {
+      unsigned toSubmit = NumPushed;
+      NumPushed = 0;
+      __atomic_store_n(SqTail, *SqTail + toSubmit, __ATOMIC_RELEASE);
+      while (toSubmit != 0)
+      {
+        int ret = IoUringEnter(Fd, toSubmit, 0, 0);
+        if (ret < 0)
+        {
+          return false;
+        }
+        toSubmit -= static_cast<unsigned>(ret);
+      }
+      return IoUringEnter(Fd, 0, 1, IORING_ENTER_GETEVENTS) >= 0;
+    }
+
+    void Wake()
+    {
+      const uint64_t value = 1;
+      // The event counter can't overflow, so the write doesn't fail.
+      (void)write(WakeFd, &value, sizeof(value));
+    }
+  };
+#elif defined(AZ_STORAGE_IOCP)
+  namespace {
+    // The completion key of the packets waking the ring thread, which have no OVERLAPPED.
+    constexpr ULONG_PTR WakeCompletionKey = 1;
+    // The completion key of the writes.
+    constexpr ULONG_PTR WriteCompletionKey = 2;
+  } // namespace
+
+  struct AsyncFileWriter::Ring final
+  {
+    // A write in progress. Its OVERLAPPED comes first, so the completion gets the write back.
+    struct OverlappedWrite final
+    {
+      OVERLAPPED Overlapped;
+      size_t BufferIndex;
+      DWORD Length;
+    };
+
+    HANDLE Port = NULL;
+    // The handles of the writer are synchronous, so the ring writes through handles of the same
+    // file reopened for overlapped I/O.
+    HANDLE Handle = INVALID_HANDLE_VALUE;
+    HANDLE UnbufferedHandle = INVALID_HANDLE_VALUE;
+
+    // Returns nullptr when the file can't be reopened for overlapped I/O.
+    static std::unique_ptr<Ring> Create(const FileWriter& fileWriter)
+    {
+      auto ring = std::make_unique<Ring>();
+      ring->Port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 1);
+      if (ring->Port == NULL)
+      {
+        return nullptr;
+      }
+      ring->Handle = ReOpenFile(
+          static_cast<HANDLE>(fileWriter.GetHandle()),
+          GENERIC_WRITE,
+          FILE_SHARE_READ | FILE_SHARE_WRITE,
+          FILE_FLAG_OVERLAPPED);
+      if (ring->Handle == INVALID_HANDLE_VALUE
+          || CreateIoCompletionPort(ring->Handle, ring->Port, WriteCompletionKey, 0) == NULL)
+      {
+        return nullptr;
+      }
+      const Azure::Nullable<FileHandle>& unbufferedHandle = fileWriter.GetUnbufferedHandle();
+      if (unbufferedHandle.HasValue())
+      {
+        ring->UnbufferedHandle = ReOpenFile(
+            static_cast<HANDLE>(unbufferedHandle.Value()),
+            GENERIC_WRITE,
+            FILE_SHARE_READ | FILE_SHARE_WRITE,
+            FILE_FLAG_OVERLAPPED | FILE_FLAG_NO_BUFFERING);
+        if (ring->UnbufferedHandle == INVALID_HANDLE_VALUE
+            || CreateIoCompletionPort(ring->UnbufferedHandle, ring->Port, WriteCompletionKey, 0)
+                == NULL)
+        {
+          return nullptr;
+        }
+      }
+      return ring;
+    }
+
+    ~Ring()
+    {
+      if (UnbufferedHandle != INVALID_HANDLE_VALUE)
+      {
+        CloseHandle(UnbufferedHandle);
+      }
+      if (Handle != INVALID_HANDLE_VALUE)
+      {
+        CloseHandle(Handle);
+      }
+      if (Port != NULL)
+      {
+        CloseHandle(Port);
+      }
+    }
+
+    // Starts a write. Its completion is queued to the port even when it completes at once, and
+    // isn't when it fails to start.
+    bool StartWrite(HANDLE handle, const WriteRequest& request)
+    {
+      auto write = std::make_unique<OverlappedWrite>();
+      std::memset(&write->Overlapped, 0, sizeof(write->Overlapped));
+      const auto offset = static_cast<uint64_t>(request.Offset);
+      write->Overlapped.Offset = static_cast<DWORD>(offset);
+      write->Overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+      write->BufferIndex = request.BufferIndex;
+      write->Length = static_cast<DWORD>(request.Length);
+      if (!WriteFile(handle, request.Data, write->Length, nullptr, &write->Overlapped)
+          && GetLastError() != ERROR_IO_PENDING)
+      {
+        return false;
+      }
+      write.release();
+      return true;
+    }
+
+    void Wake()
+    {
+      // Posting fails only when the system is out of memory, the ring thread then waits for the
+      // next wake.
+      (void)PostQueuedCompletionStatus(Port, 0, WakeCompletionKey, nullptr);
+    }
+  };
+#else
+  struct AsyncFileWriter::Ring final
+  {
+    void Wake() {}
+  };
+#endif
+
+  AsyncFileWriter::AsyncFileWriter(FileWriter& fileWriter, size_t bufferSize, size_t numBuffers)
+      : m_fileWriter(fileWriter),
+        // Aligned sizes keep every buffer aligned for unbuffered I/O.
+        m_bufferSize(
+            (bufferSize + UnbufferedFileIoAlignment - 1) / UnbufferedFileIoAlignment
+            * UnbufferedFileIoAlignment),
+        m_buffers(m_bufferSize * numBuffers), m_bufferWrites(numBuffers, 0)
+  {
+    for (size_t i = 0; i < numBuffers; ++i)
+    {
+      m_freeBuffers.push_back(m_buffers.GetData() + i * m_bufferSize);
+    }
+
+#if defined(AZ_STORAGE_IO_URING)
+    // A buffer has at most two writes in progress, plus the read of the wake event.
+    m_ring = Ring::Create(
+        static_cast<unsigned>(numBuffers * 2 + 1), m_buffers.GetData(), m_buffers.GetSize());
+#elif defined(AZ_STORAGE_IOCP)
+    m_ring = Ring::Create(m_fileWriter);
+#endif
+    if (m_ring)
+    {
+      m_ringThread = std::thread(&AsyncFileWriter::RunRing, this);
+    }
+  }
+
+  AsyncFileWriter::~AsyncFileWriter()
+  {
+    if (m_ringThread.joinable())
+    {
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_writeCompleted.wait(lock, [this]() { return m_numWrites == 0; });
+        m_stopped = true;
+      }
+      m_ring->Wake();
+      m_ringThread.join();
+    }
+  }
+
+  uint8_t* AsyncFileWriter::AcquireBuffer()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_writeCompleted.wait(lock, [this]() { return !m_freeBuffers.empty() || m_error; });
+    if (m_error)
+    {
+      std::rethrow_exception(m_error);
+    }
+    uint8_t* buffer = m_freeBuffers.back();
+    m_freeBuffers.pop_back();
+    return buffer;
+  }
+
+  void AsyncFileWriter::ReleaseBuffer(uint8_t* buffer)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_freeBuffers.push_back(buffer);
+    m_writeCompleted.notify_all();
+  }
+
+  void AsyncFileWriter::Write(uint8_t* buffer, size_t length, int64_t offset)
+  {
+    if (!m_ring || length == 0)
+    {
+      std::exception_ptr error;
+      try
+      {
+        m_fileWriter.Write(buffer, length, offset);
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_freeBuffers.push_back(buffer);
+      m_writeCompleted.notify_all();
+      if (error)
+      {
+        std::rethrow_exception(error);
+      }
+      return;
+    }
+
+    WriteRequest request;
+    request.BufferIndex = static_cast<size_t>(buffer - m_buffers.GetData()) / m_bufferSize;
+    // Like FileWriter::Write, the aligned beginning bypasses the page cache if possible.
+    const Azure::Nullable<FileHandle>& unbufferedHandle = m_fileWriter.GetUnbufferedHandle();
+    const size_t unbufferedLength
+        = unbufferedHandle.HasValue() ? GetUnbufferedLength(buffer, length, offset) : 0;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      // The ring thread stops at its first failure.
+      if (m_error)
+      {
+        std::rethrow_exception(m_error);
+      }
+      if (unbufferedLength != 0)
+      {
+        request.Handle = unbufferedHandle.Value();
+        request.Data = buffer;
+        request.Length = unbufferedLength;
+        request.Offset = offset;
+        m_requests.push_back(request);
+        ++m_bufferWrites[request.BufferIndex];
+        ++m_numWrites;
+      }
+      if (length != unbufferedLength)
+      {
+        request.Handle = m_fileWriter.GetHandle();
+        request.Data = buffer + unbufferedLength;
+        request.Length = length - unbufferedLength;
+        request.Offset = offset + static_cast<int64_t>(unbufferedLength);
+        m_requests.push_back(request);
+        ++m_bufferWrites[request.BufferIndex];
+        ++m_numWrites;
+      }
+    }
+    m_ring->Wake();
+  }
+
+  void AsyncFileWriter::Flush()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_writeCompleted.wait(lock, [this]() { return m_numWrites == 0; });
+    if (m_error)
+    {
+      std::rethrow_exception(m_error);
+    }
+  }
+
+  void AsyncFileWriter::RunRing()
+  {
+#if defined(AZ_STORAGE_IO_URING)
+    m_ring->PushWakeRead();
+    std::vector<WriteRequest> requests;
+    while (true)
+    {
+      if (!m_ring->SubmitAndWait())
+      {
+        OnRingFailed();
+        return;
+      }
+
+      bool woken = false;
+      unsigned head = *m_ring->CqHead;
+      const unsigned tail = __atomic_load_n(m_ring->CqTail, __ATOMIC_ACQUIRE);
+      for (; head != tail; ++head)
+      {
+        const io_uring_cqe& cqe = m_ring->Cqes[head & *m_ring->CqMask];
+        if (cqe.user_data == WakeUserData)
+        {
+          woken = true;
+          continue;
+        }
+        // The user data has the index of the buffer, and the length of the write.
+        const auto bufferIndex = static_cast<size_t>(cqe.user_data >> 32);
+        const auto length = static_cast<int32_t>(cqe.user_data & 0xFFFFFFFF);
+        std::exception_ptr error;
+        if (cqe.res != length)
+        {
+          error = std::make_exception_ptr(std::runtime_error("Failed to write file."));
+        }
+        OnWriteCompleted(bufferIndex, error);
+      }
+      __atomic_store_n(m_ring->CqHead, head, __ATOMIC_RELEASE);
+
+      if (!woken)
+      {
+        continue;
+      }
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopped)
+        {
+          return;
+        }
+        requests.swap(m_requests);
+      }
+      for (const auto& request : requests)
+      {
+        io_uring_sqe& sqe = m_ring->Push();
+        sqe.opcode = m_ring->FixedBuffers ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+        sqe.fd = request.Handle;
+        sqe.addr = reinterpret_cast<uint64_t>(request.Data);
+        sqe.len = static_cast<uint32_t>(request.Length);
+        sqe.off = static_cast<uint64_t>(request.Offset);
+        sqe.user_data = (static_cast<uint64_t>(request.BufferIndex) << 32)
+            | static_cast<uint32_t>(request.Length);
+      }
+      requests.clear();
+      m_ring->PushWakeRead();
+    }
+#elif defined(AZ_STORAGE_IOCP)
+    std::vector<WriteRequest> requests;
+    while (true)
+    {
+      DWORD bytesTransferred = 0;
+      ULONG_PTR completionKey = 0;
+      OVERLAPPED* overlapped = nullptr;
+      const BOOL succeeded = GetQueuedCompletionStatus(
+          m_ring->Port, &bytesTransferred, &completionKey, &overlapped, INFINITE);
+      if (overlapped != nullptr)
+      {
+        std::unique_ptr<Ring::OverlappedWrite> write(
+            reinterpret_cast<Ring::OverlappedWrite*>(overlapped));
+        std::exception_ptr error;
+        if (!succeeded || bytesTransferred != write->Length)
+        {
+          error = std::make_exception_ptr(std::runtime_error("Failed to write file."));
+        }
+        OnWriteCompleted(write->BufferIndex, error);
+        continue;
+      }
+      if (!succeeded)
+      {
+        OnRingFailed();
+        return;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopped)
+        {
+          return;
+        }
+        requests.swap(m_requests);
+      }
+      for (const auto& request : requests)
+      {
+        HANDLE handle = request.Handle == m_fileWriter.GetHandle() ? m_ring->Handle
+                                                                    : m_ring->UnbufferedHandle;
+        if (!m_ring->StartWrite(handle, request))
+        {
+          OnWriteCompleted(
+              request.BufferIndex,
+              std::make_exception_ptr(std::runtime_error("Failed to write file.")));
+        }
+      }
+      requests.clear();
+    }
+#endif
+  }
+
+  void AsyncFileWriter::OnRingFailed()
+  {
+    // The writes in progress can't complete anymore.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_error)
+    {
+      m_error = std::make_exception_ptr(std::runtime_error("Failed to write file."));
+    }
+    m_requests.clear();
+    m_numWrites = 0;
+    m_writeCompleted.notify_all();
+  }
+
+  void AsyncFileWriter::OnWriteCompleted(size_t bufferIndex, std::exception_ptr error)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (error && !m_error)
+    {
+      m_error = error;
+    }
+    if (--m_bufferWrites[bufferIndex] == 0)
+    {
+      m_freeBuffers.push_back(m_buffers.GetData() + bufferIndex * m_bufferSize);
+    }
+    --m_numWrites;
+    m_writeCompleted.notify_all();
+  }
+
+}}} // namespace Azure::Storage::_internal
@@ -0,0 +1,358 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/buffer_pool.hpp"
+
+#include <azure/core/platform.hpp>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(AZ_PLATFORM_WINDOWS)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "azure/storage/common/internal/file_io.hpp"
+#include "azure/storage/common/internal/thread_pool.hpp"
+
+namespace Azure { namespace Storage {
+
+  namespace {
+    constexpr size_t MinSizeClassSize = 64 * 1024;
+
+    size_t GetSizeClassSize(size_t sizeClass) { return MinSizeClassSize << sizeClass; }
+
+    size_t GetThreadShard(size_t numShards)
+    {
+      return std::hash<std::thread::id>()(std::this_thread::get_id()) % numShards;
+    }
+
+    uint8_t* AllocateAligned(size_t size)
+    {
+      return new uint8_t[size + _internal::UnbufferedFileIoAlignment];
+    }
+
+#if defined(__linux__)
+    // From linux/mempolicy.h: the pages are allocated on the node while it has free memory.
+    constexpr int MpolPreferred = 1;
+
+    uint8_t* AllocateOnNumaNode(size_t size, int numaNode)
+    {
+      void* buffer
+          = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (buffer == MAP_FAILED)
+      {
+        throw std::bad_alloc();
+      }
+      // The pages are only allocated when first written, so the policy applies to all of them. It
+      // isn't set on kernels without NUMA support, and the buffer is used anyway.
+      constexpr size_t BitsPerMask = sizeof(unsigned long) * 8;
+      std::vector<unsigned long> nodeMask(static_cast<size_t>(numaNode) / BitsPerMask + 1, 0);
+      nodeMask.back() = 1UL << (static_cast<size_t>(numaNode) % BitsPerMask);
+      syscall(
+          SYS_mbind,
+          buffer,
+          size,
+          MpolPreferred,
+          nodeMask.data(),
+          nodeMask.size() * BitsPerMask + 1,
+          0);
+      return static_cast<uint8_t*>(buffer);
+    }
+
+    void FreeOnNumaNode(uint8_t* buffer, size_t size) { munmap(buffer, size); }
+#elif defined(AZ_PLATFORM_WINDOWS)
+    uint8_t* AllocateOnNumaNode(size_t size, int numaNode)
+    {
+      void* buffer = VirtualAllocExNuma(
+          GetCurrentProcess(),
+          nullptr,
+          size,
+          MEM_RESERVE | MEM_COMMIT,
+          PAGE_READWRITE,
+          static_cast<DWORD>(numaNode));
+      if (buffer == nullptr)
+      {
+        throw std::bad_alloc();
+      }
+      return static_cast<uint8_t*>(buffer);
+    }
+
+    void FreeOnNumaNode(uint8_t* buffer, size_t) { VirtualFree(buffer, 0, MEM_RELEASE); }
+#endif
+  } // namespace
+
+  BufferPool::BufferPool(BufferPoolOptions options) : m_options(std::move(options))
+  {
+    if (!m_options.CpuAffinity.empty())
+    {
+      m_threadPool = std::make_unique<_internal::ThreadPool>(
+          (std::max)(static_cast<size_t>(8), m_options.CpuAffinity.size() * 2),
+          m_options.CpuAffinity);
+    }
+  }
+
+  BufferPool::~BufferPool()
+  {
+    // The clients using the pool keep it alive until their transfers are done, so its threads are
+    // idle.
+    m_threadPool.reset();
+    for (auto& shard : m_shards)
+    {
+      for (size_t sizeClass = 0; sizeClass < NumSizeClasses; ++sizeClass)
+      {
+        for (auto buffer : shard.FreeBuffers[sizeClass])
+        {
+          Free(buffer, sizeClass);
+        }
+      }
+    }
+  }
+
+  uint8_t* BufferPool::Allocate(size_t sizeClass) const
+  {
+#if defined(__linux__) || defined(AZ_PLATFORM_WINDOWS)
+    if (m_options.NumaNode >= 0)
+    {
+      // Page aligned, so aligned for unbuffered file I/O too.
+      return AllocateOnNumaNode(
+          GetSizeClassSize(sizeClass) + _internal::UnbufferedFileIoAlignment,
+          m_options.NumaNode);
+    }
+#endif
+    return AllocateAligned(GetSizeClassSize(sizeClass));
+  }
+
+  void BufferPool::Free(uint8_t* buffer, size_t sizeClass) const
+  {
+#if defined(__linux__) || defined(AZ_PLATFORM_WINDOWS)
+    if (m_options.NumaNode >= 0)
+    {
+      FreeOnNumaNode(buffer, GetSizeClassSize(sizeClass) + _internal::UnbufferedFileIoAlignment);
+      return;
+    }
+#else
+    (void)sizeClass;
+#endif
+    delete[] buffer;
+  }
+
+  const std::shared_ptr<BufferPool>& BufferPool::GetDefault()
+  {
+    static const std::shared_ptr<BufferPool> defaultPool = std::make_shared<BufferPool>();
+    return defaultPool;
+  }
+
+  uint8_t* BufferPool::Acquire(size_t sizeClass)
+  {
+    // The shard of the calling thread first, then the others, since the buffers are often given
+    // back by other threads than the ones which took them.
+    const size_t firstShard = GetThreadShard(NumShards);
+    for (size_t i = 0; i < NumShards; ++i)
+    {
+      auto& shard = m_shards[(firstShard + i) % NumShards];
+      std::lock_guard<std::mutex> lock(shard.Mutex);
+      auto& freeBuffers = shard.FreeBuffers[sizeClass];
+      if (!freeBuffers.empty())
+      {
+        uint8_t* buffer = freeBuffers.back();
+        freeBuffers.pop_back();
+        m_pooledBytes -= static_cast<int64_t>(GetSizeClassSize(sizeClass));
+        return buffer;
+      }
+    }
+    return Allocate(sizeClass);
+  }
+
+  bool BufferPool::AcquireBytes(int64_t bytes, bool wait, bool exceed)
+  {
+    if (m_options.MaxBytesInUse <= 0)
+    {
+      m_bytesInUse += bytes;
+      return true;
+    }
+    std::unique_lock<std::mutex> lock(m_budgetMutex);
+    auto fits = [this, bytes]() {
+      return m_bytesInUse == 0 || m_bytesInUse + bytes <= m_options.MaxBytesInUse;
+    };
+    if (wait)
+    {
+      m_budgetReleased.wait(lock, fits);
+    }
+    else if (!exceed && !fits())
+    {
+      return false;
+    }
+    m_bytesInUse += bytes;
+    return true;
+  }
+
+  void BufferPool::ReleaseBytes(int64_t bytes)
+  {
+    if (m_options.MaxBytesInUse <= 0)
+    {
+      m_bytesInUse -= bytes;
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_budgetMutex);
+      m_bytesInUse -= bytes;
+    }
+    m_budgetReleased.notify_all();
+  }
+
+  void BufferPool::Release(uint8_t* buffer, size_t sizeClass)
+  {
+    const auto size = static_cast<int64_t>(GetSizeClassSize(sizeClass));
+    if (m_pooledBytes.fetch_add(size) + size > m_options.MaxPooledBytes)
+    {
+      m_pooledBytes -= size;
+      Free(buffer, sizeClass);
+      return;
+    }
+    auto& shard = m_shards[GetThreadShard(NumShards)];
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    shard.FreeBuffers[sizeClass].push_back(buffer);
+  }
+
+  namespace _internal {
+
+    ThreadPool& GetTransferThreadPool(const std::shared_ptr<BufferPool>& pool)
+    {
+      return pool && pool->m_threadPool ? *pool->m_threadPool : ThreadPool::GetDefault();
+    }
+
+    PooledBuffer::PooledBuffer(std::shared_ptr<BufferPool> pool, size_t size)
+    {
+      Create(std::move(pool), size, false);
+    }
+
+    PooledBuffer PooledBuffer::TryCreate(std::shared_ptr<BufferPool> pool, size_t size)
+    {
+      PooledBuffer buffer;
+      buffer.Create(std::move(pool), size, true);
+      return buffer;
+    }
+
+    bool PooledBuffer::Create(std::shared_ptr<BufferPool> pool, size_t size, bool tryOnly)
+    {
+      if (size == 0)
+      {
+        return true;
+      }
+      auto sizeClass = static_cast<size_t>(0);
+      while (sizeClass < BufferPool::NumSizeClasses && GetSizeClassSize(sizeClass) < size)
+      {
+        ++sizeClass;
+      }
+      pool = pool ? std::move(pool) : BufferPool::GetDefault();
+      const auto bytesInUse = static_cast<int64_t>(
+          sizeClass < BufferPool::NumSizeClasses ? GetSizeClassSize(sizeClass) : size);
+      if (pool->m_options.MaxBytesInUse > 0)
+      {
+        // A thread holding a buffer doesn't wait, since the buffers it holds might be what the
+        // others are waiting for.
+        thread_local auto threadBuffers = std::make_shared<std::atomic<int>>(0);
+        const bool isHoldingBuffers = *threadBuffers > 0;
+        if (!pool->AcquireBytes(bytesInUse, !tryOnly && !isHoldingBuffers, !tryOnly))
+        {
+          return false;
+        }
+        ++*threadBuffers;
+        m_threadBuffers = threadBuffers;
+      }
+      else
+      {
+        pool->AcquireBytes(bytesInUse, false, true);
+      }
+
+      m_pool = std::move(pool);
+      m_size = size;
+      m_sizeClass = sizeClass;
+      m_bytesInUse = bytesInUse;
+      m_allocation = m_sizeClass < BufferPool::NumSizeClasses ? m_pool->Acquire(m_sizeClass)
+                                                             : AllocateAligned(size);
+      const size_t misalignment
+          = reinterpret_cast<uintptr_t>(m_allocation) % UnbufferedFileIoAlignment;
+      m_data = m_allocation
+          + (UnbufferedFileIoAlignment - misalignment) % UnbufferedFileIoAlignment;
+      return true;
+    }
+
+    PooledBuffer::~PooledBuffer() { Reset(); }
+
+    PooledBuffer::PooledBuffer(PooledBuffer&& other) noexcept
+        : m_pool(std::move(other.m_pool)), m_allocation(other.m_allocation),
+          m_data(other.m_data), m_size(other.m_size), m_sizeClass(other.m_sizeClass),
+          m_bytesInUse(other.m_bytesInUse), m_threadBuffers(std::move(other.m_threadBuffers))
+    {
+      other.m_allocation = nullptr;
+      other.m_data = nullptr;
+      other.m_size = 0;
+      other.m_bytesInUse = 0;
+    }
+
+    PooledBuffer& PooledBuffer::operator=(PooledBuffer&& other) noexcept
+    {
+      if (this != &other)
+      {
+        Reset();
+        m_pool = std::move(other.m_pool);
+        m_allocation = other.m_allocation;
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_sizeClass = other.m_sizeClass;
+        m_bytesInUse = other.m_bytesInUse;
+        m_threadBuffers = std::move(other.m_threadBuffers);
+        other.m_allocation = nullptr;
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_bytesInUse = 0;
+      }
+      return *this;
+    }
+
+    void PooledBuffer::Reset()
+    {
+      if (m_pool)
+      {
+        if (m_sizeClass < BufferPool::NumSizeClasses)
+        {
+          m_pool->Release(m_allocation, m_sizeClass);
+        }
+        else
+        {
+          delete[] m_allocation;
+        }
+        if (m_threadBuffers)
+        {
+          --*m_threadBuffers;
+          m_threadBuffers.reset();
+        }
+        m_pool->ReleaseBytes(m_bytesInUse);
+        m_pool.reset();
+      }
+      m_allocation = nullptr;
+      m_data = nullptr;
+      m_size = 0;
+      m_bytesInUse = 0;
+    }
+
+  } // namespace _internal
+
+}} // namespace Azure::Storage
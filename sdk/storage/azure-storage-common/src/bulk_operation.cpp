@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/bulk_operation.hpp"
+
+#include <stdexcept>
+
+#include "azure/storage/common/internal/concurrent_transfer.hpp"
+
+namespace Azure { namespace Storage {
+
+  BulkOperationResult ExecuteBulkOperations(
+      const std::vector<BulkOperation>& operations,
+      const BulkOperationOptions& options,
+      const Azure::Core::Context& context)
+  {
+    if (options.Concurrency <= 0)
+    {
+      throw std::invalid_argument("Concurrency must be positive.");
+    }
+    BulkOperationResult ret;
+    ret.Errors.resize(operations.size());
+    if (operations.empty())
+    {
+      return ret;
+    }
+
+    // Each operation records its own error, so the transfer never stops early.
+    auto runOperation = [&](int64_t, int64_t, int64_t operationId, int64_t) {
+      try
+      {
+        operations[static_cast<size_t>(operationId)](context);
+      }
+      catch (...)
+      {
+        ret.Errors[static_cast<size_t>(operationId)] = std::current_exception();
+      }
+    };
+    _internal::ConcurrentTransfer(
+        0, static_cast<int64_t>(operations.size()), 1, options.Concurrency, runOperation);
+
+    for (const auto& error : ret.Errors)
+    {
+      if (error)
+      {
+        ++ret.FailedCount;
+      }
+    }
+    return ret;
+  }
+
+}} // namespace Azure::Storage
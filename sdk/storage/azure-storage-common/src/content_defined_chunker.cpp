@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/internal/content_defined_chunker.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include <azure/core/azure_assert.hpp>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  namespace {
+    // The gear table must never change, or the chunks of a content wouldn't match the chunks
+    // found by an earlier version anymore.
+    const std::array<uint64_t, 256>& GetGearTable()
+    {
+      static const std::array<uint64_t, 256> gearTable = []() {
+        std::array<uint64_t, 256> table{};
+        // SplitMix64 from a fixed seed.
+        uint64_t state = 0x6a09e667f3bcc908ULL;
+        for (auto& value : table)
+        {
+          uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+          z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+          z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+          value = z ^ (z >> 31);
+        }
+        return table;
+      }();
+      return gearTable;
+    }
+  } // namespace
+
+  ContentDefinedChunker::ContentDefinedChunker(int64_t averageChunkSize)
+      : m_minChunkSize(averageChunkSize / 4), m_maxChunkSize(averageChunkSize * 4)
+  {
+    AZURE_ASSERT(averageChunkSize >= 64);
+
+    // After the minimum size, a chunk ends where the hash has its top bits cleared, on average
+    // every averageChunkSize - m_minChunkSize bytes. The top bits of the hash depend on the last 64
+    // bytes.
+    int maskBits = 0;
+    while ((int64_t(2) << maskBits) <= averageChunkSize - m_minChunkSize)
+    {
+      ++maskBits;
+    }
+    m_mask = ~uint64_t(0) << (64 - maskBits);
+  }
+
+  size_t ContentDefinedChunker::FindChunkEnd(const uint8_t* data, size_t size, bool& chunkEnd)
+  {
+    const auto& gearTable = GetGearTable();
+    chunkEnd = false;
+    size_t i = 0;
+    // The bytes before the last 64 of the minimum size don't change the hash of the chunk end.
+    const int64_t skipped = std::min<int64_t>(
+        std::max<int64_t>(m_minChunkSize - 64 - m_chunkSize, 0), static_cast<int64_t>(size));
+    i += static_cast<size_t>(skipped);
+    m_chunkSize += skipped;
+    for (; i < size; ++i)
+    {
+      m_hash = (m_hash << 1) + gearTable[data[i]];
+      ++m_chunkSize;
+      if ((m_chunkSize >= m_minChunkSize && (m_hash & m_mask) == 0)
+          || m_chunkSize == m_maxChunkSize)
+      {
+        chunkEnd = true;
+        m_hash = 0;
+        m_chunkSize = 0;
+        return i + 1;
+      }
+    }
+    return size;
+  }
+
+}}} // namespace Azure::Storage::_internal
@@ -18,15 +18,50 @@
 #include <openssl/buffer.h>
 #include <openssl/evp.h>
 #include <openssl/hmac.h>
+#include <openssl/rand.h>
 #include <openssl/sha.h>
 #endif
 
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(_M_ARM64EC)
+#define AZ_STORAGE_CRC64_FOLD
+#define AZ_STORAGE_CRC64_FOLD_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define AZ_STORAGE_CRC64_FOLD_TARGET
+#else
+#include <cpuid.h>
+#include <immintrin.h>
+#define AZ_STORAGE_CRC64_FOLD_TARGET __attribute__((target("pclmul,sse2")))
+#endif
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define AZ_STORAGE_CRC64_FOLD
+#define AZ_STORAGE_CRC64_FOLD_ARM64
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#if __has_include(<asm/hwcap.h>)
+#include <asm/hwcap.h>
+#endif
+#endif
+#if defined(__clang__)
+#define AZ_STORAGE_CRC64_FOLD_TARGET __attribute__((target("aes")))
+#else
+#define AZ_STORAGE_CRC64_FOLD_TARGET __attribute__((target("+crypto")))
+#endif
+#endif
+
 #include <algorithm>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <new>
 #include <stdexcept>
 #include <vector>
 
 #include <azure/core/http/http.hpp>
+#include <azure/core/url.hpp>
 
+#include "azure/storage/common/internal/chunked_crc64.hpp"
 #include "azure/storage/common/storage_common.hpp"
 
 namespace Azure { namespace Storage {
@@ -36,8 +71,8 @@ namespace Azure { namespace Storage {
 
     std::string UrlEncodeQueryParameter(const std::string& value)
     {
-      const static std::string DoNotEncodeCharacters = []() {
-        // Core::Url::Encode won't encode unreserved characters.
+      const static Core::_internal::UrlEncoder Encoder = []() {
+        // The encoder won't encode unreserved characters.
         std::string doNotEncodeCharacters = Subdelimiters;
         doNotEncodeCharacters += "/:@?";
         doNotEncodeCharacters.erase(
@@ -52,15 +87,15 @@ namespace Azure { namespace Storage {
                   return x == '+' || x == '=';
                 }),
             doNotEncodeCharacters.end());
-        return doNotEncodeCharacters;
+        return Core::_internal::UrlEncoder(doNotEncodeCharacters);
       }();
-      return Core::Url::Encode(value, DoNotEncodeCharacters);
+      return Encoder.Encode(value);
     }
 
     std::string UrlEncodePath(const std::string& value)
     {
-      const static std::string DoNotEncodeCharacters = []() {
-        // Core::Url::Encode won't encode unreserved characters.
+      const static Core::_internal::UrlEncoder Encoder = []() {
+        // The encoder won't encode unreserved characters.
         std::string doNotEncodeCharacters = Subdelimiters;
         doNotEncodeCharacters += "/:@";
         doNotEncodeCharacters.erase(
@@ -72,9 +107,9 @@ namespace Azure { namespace Storage {
                   return x == '+';
                 }),
             doNotEncodeCharacters.end());
-        return doNotEncodeCharacters;
+        return Core::_internal::UrlEncoder(doNotEncodeCharacters);
       }();
-      return Core::Url::Encode(value, DoNotEncodeCharacters);
+      return Encoder.Encode(value);
     }
   } // namespace _internal
 
@@ -244,20 +279,269 @@ namespace Azure { namespace Storage {
 
       return hash;
     }
+
+    struct HmacSha256Context::Implementation final
+    {
+      std::string Context;
+      BCRYPT_HASH_HANDLE Handle = nullptr;
+      // BCrypt hash objects can't be used by several threads at once, even to duplicate them.
+      std::mutex Mutex;
+    };
+
+    static const AlgorithmProviderInstance& HmacSha256AlgorithmProvider()
+    {
+      static AlgorithmProviderInstance AlgorithmProvider(AlgorithmType::HmacSha256);
+      return AlgorithmProvider;
+    }
+
+    HmacSha256Context::HmacSha256Context(const std::vector<uint8_t>& key)
+        : m_implementation(std::make_unique<Implementation>())
+    {
+      const auto& algorithmProvider = HmacSha256AlgorithmProvider();
+      m_implementation->Context.resize(algorithmProvider.ContextSize);
+      NTSTATUS status = BCryptCreateHash(
+          algorithmProvider.Handle,
+          &m_implementation->Handle,
+          reinterpret_cast<PUCHAR>(&m_implementation->Context[0]),
+          static_cast<ULONG>(m_implementation->Context.size()),
+          reinterpret_cast<PUCHAR>(const_cast<uint8_t*>(key.data())),
+          static_cast<ULONG>(key.size()),
+          0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptCreateHash failed.");
+      }
+    }
+
+    HmacSha256Context::~HmacSha256Context() { BCryptDestroyHash(m_implementation->Handle); }
+
+    std::vector<uint8_t> HmacSha256Context::Sign(const uint8_t* data, size_t length) const
+    {
+      AZURE_ASSERT_MSG(length <= std::numeric_limits<ULONG>::max(), "Data size is too big.");
+
+      const auto& algorithmProvider = HmacSha256AlgorithmProvider();
+
+      // The duplicate starts from the state after the padded key, which BCryptCreateHash has
+      // already hashed.
+      thread_local std::string context;
+      context.resize(algorithmProvider.ContextSize);
+
+      BCRYPT_HASH_HANDLE hashHandle;
+      NTSTATUS status;
+      {
+        std::lock_guard<std::mutex> guard(m_implementation->Mutex);
+        status = BCryptDuplicateHash(
+            m_implementation->Handle,
+            &hashHandle,
+            reinterpret_cast<PUCHAR>(&context[0]),
+            static_cast<ULONG>(context.size()),
+            0);
+      }
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptDuplicateHash failed.");
+      }
+
+      status = BCryptHashData(
+          hashHandle,
+          reinterpret_cast<PBYTE>(const_cast<uint8_t*>(data)),
+          static_cast<ULONG>(length),
+          0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        BCryptDestroyHash(hashHandle);
+        throw std::runtime_error("BCryptHashData failed.");
+      }
+
+      std::vector<uint8_t> hash;
+      hash.resize(algorithmProvider.HashLength);
+      status = BCryptFinishHash(
+          hashHandle, reinterpret_cast<PUCHAR>(&hash[0]), static_cast<ULONG>(hash.size()), 0);
+      BCryptDestroyHash(hashHandle);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptFinishHash failed.");
+      }
+
+      return hash;
+    }
+
+    struct AesGcmAlgorithmProvider final
+    {
+      BCRYPT_ALG_HANDLE Handle;
+
+      AesGcmAlgorithmProvider()
+      {
+        NTSTATUS status = BCryptOpenAlgorithmProvider(&Handle, BCRYPT_AES_ALGORITHM, nullptr, 0);
+        if (!BCRYPT_SUCCESS(status))
+        {
+          throw std::runtime_error("BCryptOpenAlgorithmProvider failed.");
+        }
+        status = BCryptSetProperty(
+            Handle,
+            BCRYPT_CHAINING_MODE,
+            reinterpret_cast<PUCHAR>(const_cast<wchar_t*>(BCRYPT_CHAIN_MODE_GCM)),
+            static_cast<ULONG>(sizeof(BCRYPT_CHAIN_MODE_GCM)),
+            0);
+        if (!BCRYPT_SUCCESS(status))
+        {
+          BCryptCloseAlgorithmProvider(Handle, 0);
+          throw std::runtime_error("BCryptSetProperty failed.");
+        }
+      }
+
+      ~AesGcmAlgorithmProvider() { BCryptCloseAlgorithmProvider(Handle, 0); }
+    };
+
+    struct AesGcmKey final
+    {
+      BCRYPT_KEY_HANDLE Handle = nullptr;
+
+      explicit AesGcmKey(const std::vector<uint8_t>& key)
+      {
+        static AesGcmAlgorithmProvider AlgorithmProvider;
+        NTSTATUS status = BCryptGenerateSymmetricKey(
+            AlgorithmProvider.Handle,
+            &Handle,
+            nullptr,
+            0,
+            reinterpret_cast<PUCHAR>(const_cast<uint8_t*>(key.data())),
+            static_cast<ULONG>(key.size()),
+            0);
+        if (!BCRYPT_SUCCESS(status))
+        {
+          throw std::runtime_error("BCryptGenerateSymmetricKey failed.");
+        }
+      }
+
+      ~AesGcmKey() { BCryptDestroyKey(Handle); }
+    };
+
+    void GenerateRandomBytes(uint8_t* data, size_t length)
+    {
+      AZURE_ASSERT_MSG(length <= std::numeric_limits<ULONG>::max(), "Data size is too big.");
+
+      NTSTATUS status = BCryptGenRandom(
+          nullptr, data, static_cast<ULONG>(length), BCRYPT_USE_SYSTEM_PREFERRED_RNG);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptGenRandom failed.");
+      }
+    }
+
+    void Aes256GcmEncrypt(
+        const std::vector<uint8_t>& key,
+        const uint8_t* nonce,
+        const uint8_t* data,
+        size_t length,
+        uint8_t* output,
+        uint8_t* tag)
+    {
+      AZURE_ASSERT_MSG(length <= std::numeric_limits<ULONG>::max(), "Data size is too big.");
+
+      AesGcmKey keyHandle(key);
+      BCRYPT_AUTHENTICATED_CIPHER_MODE_INFO authInfo;
+      BCRYPT_INIT_AUTH_MODE_INFO(authInfo);
+      authInfo.pbNonce = const_cast<PUCHAR>(nonce);
+      authInfo.cbNonce = static_cast<ULONG>(AesGcmNonceSize);
+      authInfo.pbTag = tag;
+      authInfo.cbTag = static_cast<ULONG>(AesGcmTagSize);
+      ULONG outputLength = 0;
+      NTSTATUS status = BCryptEncrypt(
+          keyHandle.Handle,
+          const_cast<PUCHAR>(data),
+          static_cast<ULONG>(length),
+          &authInfo,
+          nullptr,
+          0,
+          output,
+          static_cast<ULONG>(length),
+          &outputLength,
+          0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptEncrypt failed.");
+      }
+    }
+
+    void Aes256GcmDecrypt(
+        const std::vector<uint8_t>& key,
+        const uint8_t* nonce,
+        const uint8_t* data,
+        size_t length,
+        const uint8_t* tag,
+        uint8_t* output)
+    {
+      AZURE_ASSERT_MSG(length <= std::numeric_limits<ULONG>::max(), "Data size is too big.");
+
+      AesGcmKey keyHandle(key);
+      BCRYPT_AUTHENTICATED_CIPHER_MODE_INFO authInfo;
+      BCRYPT_INIT_AUTH_MODE_INFO(authInfo);
+      authInfo.pbNonce = const_cast<PUCHAR>(nonce);
+      authInfo.cbNonce = static_cast<ULONG>(AesGcmNonceSize);
+      authInfo.pbTag = const_cast<PUCHAR>(tag);
+      authInfo.cbTag = static_cast<ULONG>(AesGcmTagSize);
+      ULONG outputLength = 0;
+      NTSTATUS status = BCryptDecrypt(
+          keyHandle.Handle,
+          const_cast<PUCHAR>(data),
+          static_cast<ULONG>(length),
+          &authInfo,
+          nullptr,
+          0,
+          output,
+          static_cast<ULONG>(length),
+          &outputLength,
+          0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("Failed to decrypt data, the data or the key is invalid.");
+      }
+    }
   } // namespace _internal
 
 #elif defined(AZ_PLATFORM_POSIX)
 
   namespace _internal {
 
+    namespace {
+      struct DigestContext final
+      {
+        EVP_MD_CTX* Handle = EVP_MD_CTX_new();
+
+        DigestContext()
+        {
+          if (Handle == nullptr)
+          {
+            throw std::bad_alloc();
+          }
+        }
+
+        ~DigestContext() { EVP_MD_CTX_free(Handle); }
+      };
+
+      // The context the signatures of the calling thread are computed in, so that signing
+      // doesn't allocate one each time.
+      EVP_MD_CTX* GetSigningDigestContext()
+      {
+        thread_local DigestContext context;
+        return context.Handle;
+      }
+
+      void Sha256Digest(const uint8_t* data, size_t length, uint8_t* hash)
+      {
+        if (EVP_Digest(data, length, hash, nullptr, EVP_sha256(), nullptr) != 1)
+        {
+          throw std::runtime_error("Failed to compute the SHA-256 hash.");
+        }
+      }
+    } // namespace
+
     std::vector<uint8_t> Sha256(const std::vector<uint8_t>& data)
     {
-      SHA256_CTX context;
-      SHA256_Init(&context);
-      SHA256_Update(&context, data.data(), data.size());
-      unsigned char hash[SHA256_DIGEST_LENGTH];
-      SHA256_Final(hash, &context);
-      return std::vector<uint8_t>(std::begin(hash), std::end(hash));
+      std::vector<uint8_t> hash(SHA256_DIGEST_LENGTH);
+      Sha256Digest(data.data(), data.size(), hash.data());
+      return hash;
     }
 
     std::vector<uint8_t> HmacSha256(
@@ -278,6 +562,157 @@ namespace Azure { namespace Storage {
       return std::vector<uint8_t>(std::begin(hash), std::begin(hash) + hashLength);
     }
 
+    struct HmacSha256Context::Implementation final
+    {
+      // SHA-256 states after hashing the key XORed with the inner and the outer pads.
+      DigestContext Inner;
+      DigestContext Outer;
+    };
+
+    HmacSha256Context::HmacSha256Context(const std::vector<uint8_t>& key)
+        : m_implementation(std::make_unique<Implementation>())
+    {
+      uint8_t block[SHA256_CBLOCK] = {};
+      if (key.size() > sizeof(block))
+      {
+        Sha256Digest(key.data(), key.size(), block);
+      }
+      else if (!key.empty())
+      {
+        std::memcpy(block, key.data(), key.size());
+      }
+
+      uint8_t innerPad[SHA256_CBLOCK];
+      uint8_t outerPad[SHA256_CBLOCK];
+      for (size_t i = 0; i < sizeof(block); ++i)
+      {
+        innerPad[i] = block[i] ^ 0x36;
+        outerPad[i] = block[i] ^ 0x5c;
+      }
+      if (EVP_DigestInit_ex(m_implementation->Inner.Handle, EVP_sha256(), nullptr) != 1
+          || EVP_DigestUpdate(m_implementation->Inner.Handle, innerPad, sizeof(innerPad)) != 1
+          || EVP_DigestInit_ex(m_implementation->Outer.Handle, EVP_sha256(), nullptr) != 1
+          || EVP_DigestUpdate(m_implementation->Outer.Handle, outerPad, sizeof(outerPad)) != 1)
+      {
+        throw std::runtime_error("Failed to initialize the HMAC-SHA256 context.");
+      }
+    }
+
+    HmacSha256Context::~HmacSha256Context() = default;
+
+    std::vector<uint8_t> HmacSha256Context::Sign(const uint8_t* data, size_t length) const
+    {
+      // The precomputed states are only copied, so that a context signs from several threads.
+      EVP_MD_CTX* context = GetSigningDigestContext();
+      std::vector<uint8_t> hash(SHA256_DIGEST_LENGTH);
+      if (EVP_MD_CTX_copy_ex(context, m_implementation->Inner.Handle) != 1
+          || EVP_DigestUpdate(context, data, length) != 1
+          || EVP_DigestFinal_ex(context, hash.data(), nullptr) != 1
+          || EVP_MD_CTX_copy_ex(context, m_implementation->Outer.Handle) != 1
+          || EVP_DigestUpdate(context, hash.data(), hash.size()) != 1
+          || EVP_DigestFinal_ex(context, hash.data(), nullptr) != 1)
+      {
+        throw std::runtime_error("Failed to compute the HMAC-SHA256.");
+      }
+      return hash;
+    }
+
+    namespace {
+      struct CipherContext final
+      {
+        EVP_CIPHER_CTX* Handle = EVP_CIPHER_CTX_new();
+
+        CipherContext()
+        {
+          if (Handle == nullptr)
+          {
+            throw std::bad_alloc();
+          }
+        }
+
+        ~CipherContext() { EVP_CIPHER_CTX_free(Handle); }
+      };
+    } // namespace
+
+    void GenerateRandomBytes(uint8_t* data, size_t length)
+    {
+      AZURE_ASSERT_MSG(length <= std::numeric_limits<int>::max(), "Data size is too big.");
+
+      if (RAND_bytes(data, static_cast<int>(length)) != 1)
+      {
+        throw std::runtime_error("Failed to generate random bytes.");
+      }
+    }
+
+    void Aes256GcmEncrypt(
+        const std::vector<uint8_t>& key,
+        const uint8_t* nonce,
+        const uint8_t* data,
+        size_t length,
+        uint8_t* output,
+        uint8_t* tag)
+    {
+      AZURE_ASSERT_MSG(length <= std::numeric_limits<int>::max(), "Data size is too big.");
+      AZURE_ASSERT(key.size() == AesGcmKeySize);
+
+      CipherContext context;
+      int outputLength = 0;
+      if (EVP_EncryptInit_ex(context.Handle, EVP_aes_256_gcm(), nullptr, nullptr, nullptr) != 1
+          || EVP_CIPHER_CTX_ctrl(
+                 context.Handle,
+                 EVP_CTRL_GCM_SET_IVLEN,
+                 static_cast<int>(AesGcmNonceSize),
+                 nullptr)
+              != 1
+          || EVP_EncryptInit_ex(context.Handle, nullptr, nullptr, key.data(), nonce) != 1
+          || EVP_EncryptUpdate(
+                 context.Handle, output, &outputLength, data, static_cast<int>(length))
+              != 1
+          || EVP_EncryptFinal_ex(context.Handle, output + outputLength, &outputLength) != 1
+          || EVP_CIPHER_CTX_ctrl(
+                 context.Handle, EVP_CTRL_GCM_GET_TAG, static_cast<int>(AesGcmTagSize), tag)
+              != 1)
+      {
+        throw std::runtime_error("Failed to encrypt data.");
+      }
+    }
+
+    void Aes256GcmDecrypt(
+        const std::vector<uint8_t>& key,
+        const uint8_t* nonce,
+        const uint8_t* data,
+        size_t length,
+        const uint8_t* tag,
+        uint8_t* output)
+    {
+      AZURE_ASSERT_MSG(length <= std::numeric_limits<int>::max(), "Data size is too big.");
+      AZURE_ASSERT(key.size() == AesGcmKeySize);
+
+      CipherContext context;
+      int outputLength = 0;
+      if (EVP_DecryptInit_ex(context.Handle, EVP_aes_256_gcm(), nullptr, nullptr, nullptr) != 1
+          || EVP_CIPHER_CTX_ctrl(
+                 context.Handle,
+                 EVP_CTRL_GCM_SET_IVLEN,
+                 static_cast<int>(AesGcmNonceSize),
+                 nullptr)
+              != 1
+          || EVP_DecryptInit_ex(context.Handle, nullptr, nullptr, key.data(), nonce) != 1
+          || EVP_DecryptUpdate(
+                 context.Handle, output, &outputLength, data, static_cast<int>(length))
+              != 1
+          || EVP_CIPHER_CTX_ctrl(
+                 context.Handle,
+                 EVP_CTRL_GCM_SET_TAG,
+                 static_cast<int>(AesGcmTagSize),
+                 const_cast<uint8_t*>(tag))
+              != 1
+          || EVP_DecryptFinal_ex(context.Handle, output + outputLength, &outputLength) != 1)
+      {
+        throw std::runtime_error("Failed to decrypt data, the data or the key is invalid.");
+      }
+    }
+
   } // namespace _internal
 
 #endif
@@ -913,12 +1348,10 @@ namespace Azure { namespace Storage {
     return vr[0] ^ vr[1];
   }
 
-  void Crc64Hash::OnAppend(const uint8_t* data, size_t length)
+  // Updates the CRC with the slicing-by-32 tables. The CRC is given and returned without its final
+  // inversion.
+  static uint64_t Crc64UpdateTable(uint64_t uCrc, const uint8_t* data, size_t length)
   {
-    m_length += length;
-
-    uint64_t uCrc = m_context ^ ~0ULL;
-
     uint64_t pData = 0;
 
     size_t uStop = length - (length % 32);
@@ -1058,7 +1491,189 @@ namespace Azure { namespace Storage {
     {
       uCrc = (uCrc >> 8) ^ Crc64MU1[(uCrc ^ data[pData]) & 0xff];
     }
-    m_context = uCrc ^ ~0ULL;
+    return uCrc;
+  }
+
+#if defined(AZ_STORAGE_CRC64_FOLD)
+  /*
+   * Carry-less multiplication folding, as described in "Fast CRC Computation for Generic
+   * Polynomials Using PCLMULQDQ Instruction" by Intel. Eight 128-bit lanes are loaded from the
+   * first block. Each next block is folded into them by multiplying each lane by x^1024 mod P.
+   * The lanes are then folded into the last one, which is reduced with the tables.
+   *
+   * In the bit-reflected order of the CRC, the carry-less product of two 64-bit values is x times
+   * the product of the polynomials, which is why the constants are x^(n - 1) mod P.
+   */
+  static constexpr size_t Crc64FoldBlockSize = 128;
+  static constexpr size_t Crc64FoldMinLength = 2 * Crc64FoldBlockSize;
+
+  // x^n mod P, bit-reflected.
+  static constexpr uint64_t Crc64XPowN(int n)
+  {
+    uint64_t r = 1ULL << 63;
+    for (int i = 0; i < n; ++i)
+    {
+      r = (r >> 1) ^ ((r & 1) ? Crc64Poly : 0);
+    }
+    return r;
+  }
+
+  // The constants to fold a lane forward by i + 1 lanes: x^(128(i + 1) + 63) for its first 64
+  // bits and x^(128(i + 1) - 1) for its last 64 bits.
+  static constexpr uint64_t Crc64FoldConstants[8][2] = {
+      {Crc64XPowN(191), Crc64XPowN(127)},
+      {Crc64XPowN(319), Crc64XPowN(255)},
+      {Crc64XPowN(447), Crc64XPowN(383)},
+      {Crc64XPowN(575), Crc64XPowN(511)},
+      {Crc64XPowN(703), Crc64XPowN(639)},
+      {Crc64XPowN(831), Crc64XPowN(767)},
+      {Crc64XPowN(959), Crc64XPowN(895)},
+      {Crc64XPowN(1087), Crc64XPowN(1023)},
+  };
+
+#if defined(AZ_STORAGE_CRC64_FOLD_X86)
+  static bool IsCrc64FoldSupported()
+  {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 1)) != 0;
+#else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & bit_PCLMUL) != 0;
+#endif
+  }
+
+  AZ_STORAGE_CRC64_FOLD_TARGET static inline __m128i
+  Crc64FoldLane(__m128i lane, __m128i constants, __m128i next)
+  {
+    return _mm_xor_si128(
+        _mm_xor_si128(
+            _mm_clmulepi64_si128(lane, constants, 0x00),
+            _mm_clmulepi64_si128(lane, constants, 0x11)),
+        next);
+  }
+
+  AZ_STORAGE_CRC64_FOLD_TARGET static inline __m128i Crc64LoadFoldConstants(size_t lanes)
+  {
+    return _mm_set_epi64x(
+        static_cast<long long>(Crc64FoldConstants[lanes - 1][1]),
+        static_cast<long long>(Crc64FoldConstants[lanes - 1][0]));
+  }
+
+  // The length is a non-zero multiple of the block size.
+  AZ_STORAGE_CRC64_FOLD_TARGET static uint64_t
+  Crc64Fold(uint64_t uCrc, const uint8_t* data, size_t length)
+  {
+    const __m128i* blocks = reinterpret_cast<const __m128i*>(data);
+    __m128i lanes[8];
+    for (int i = 0; i < 8; ++i)
+    {
+      lanes[i] = _mm_loadu_si128(blocks + i);
+    }
+    lanes[0] = _mm_xor_si128(lanes[0], _mm_cvtsi64_si128(static_cast<long long>(uCrc)));
+
+    const __m128i blockConstants = Crc64LoadFoldConstants(8);
+    for (size_t offset = Crc64FoldBlockSize; offset < length; offset += Crc64FoldBlockSize)
+    {
+      blocks += 8;
+      for (int i = 0; i < 8; ++i)
+      {
+        lanes[i] = Crc64FoldLane(lanes[i], blockConstants, _mm_loadu_si128(blocks + i));
+      }
+    }
+
+    __m128i last = lanes[7];
+    for (int i = 0; i < 7; ++i)
+    {
+      last = Crc64FoldLane(lanes[i], Crc64LoadFoldConstants(7 - i), last);
+    }
+    uint8_t lastBytes[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lastBytes), last);
+    return Crc64UpdateTable(0, lastBytes, sizeof(lastBytes));
+  }
+#elif defined(AZ_STORAGE_CRC64_FOLD_ARM64)
+  static bool IsCrc64FoldSupported()
+  {
+#if defined(__APPLE__)
+    return true;
+#elif defined(AZ_PLATFORM_WINDOWS)
+    return IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE) != 0;
+#elif defined(__linux__) && defined(HWCAP_PMULL)
+    return (getauxval(AT_HWCAP) & HWCAP_PMULL) != 0;
+#else
+    return false;
+#endif
+  }
+
+  AZ_STORAGE_CRC64_FOLD_TARGET static inline uint64x2_t
+  Crc64FoldLane(uint64x2_t lane, uint64x2_t constants, uint64x2_t next)
+  {
+    const uint64x2_t low = vreinterpretq_u64_p128(vmull_p64(
+        static_cast<poly64_t>(vgetq_lane_u64(lane, 0)),
+        static_cast<poly64_t>(vgetq_lane_u64(constants, 0))));
+    const uint64x2_t high = vreinterpretq_u64_p128(vmull_p64(
+        static_cast<poly64_t>(vgetq_lane_u64(lane, 1)),
+        static_cast<poly64_t>(vgetq_lane_u64(constants, 1))));
+    return veorq_u64(veorq_u64(low, high), next);
+  }
+
+  AZ_STORAGE_CRC64_FOLD_TARGET static inline uint64x2_t Crc64LoadFoldConstants(size_t lanes)
+  {
+    return vld1q_u64(Crc64FoldConstants[lanes - 1]);
+  }
+
+  // The length is a non-zero multiple of the block size.
+  AZ_STORAGE_CRC64_FOLD_TARGET static uint64_t
+  Crc64Fold(uint64_t uCrc, const uint8_t* data, size_t length)
+  {
+    uint64x2_t lanes[8];
+    for (int i = 0; i < 8; ++i)
+    {
+      lanes[i] = vreinterpretq_u64_u8(vld1q_u8(data + 16 * i));
+    }
+    lanes[0] = veorq_u64(lanes[0], vcombine_u64(vcreate_u64(uCrc), vcreate_u64(0)));
+
+    const uint64x2_t blockConstants = Crc64LoadFoldConstants(8);
+    for (size_t offset = Crc64FoldBlockSize; offset < length; offset += Crc64FoldBlockSize)
+    {
+      for (int i = 0; i < 8; ++i)
+      {
+        lanes[i] = Crc64FoldLane(
+            lanes[i], blockConstants, vreinterpretq_u64_u8(vld1q_u8(data + offset + 16 * i)));
+      }
+    }
+
+    uint64x2_t last = lanes[7];
+    for (int i = 0; i < 7; ++i)
+    {
+      last = Crc64FoldLane(lanes[i], Crc64LoadFoldConstants(7 - i), last);
+    }
+    uint8_t lastBytes[16];
+    vst1q_u8(lastBytes, vreinterpretq_u8_u64(last));
+    return Crc64UpdateTable(0, lastBytes, sizeof(lastBytes));
+  }
+#endif
+#endif
+
+  void Crc64Hash::OnAppend(const uint8_t* data, size_t length)
+  {
+    m_length += length;
+
+    uint64_t uCrc = m_context ^ ~0ULL;
+
+#if defined(AZ_STORAGE_CRC64_FOLD)
+    static const bool foldSupported = IsCrc64FoldSupported();
+    if (length >= Crc64FoldMinLength && foldSupported)
+    {
+      const size_t foldLength = length - length % Crc64FoldBlockSize;
+      uCrc = Crc64Fold(uCrc, data, foldLength);
+      data += foldLength;
+      length -= foldLength;
+    }
+#endif
+
+    m_context = Crc64UpdateTable(uCrc, data, length) ^ ~0ULL;
   }
 
   void Crc64Hash::Concatenate(const Crc64Hash& other)
@@ -1102,4 +1717,52 @@ namespace Azure { namespace Storage {
     return binary;
   }
 
+  namespace _internal {
+    ContentHash ChunkedCrc64::Append(int64_t offset, const uint8_t* data, size_t size)
+    {
+      auto crc64 = std::make_unique<Crc64Hash>();
+      crc64->Append(data, size);
+      // Concatenating to an empty hash copies it, the piece is kept for Final.
+      Crc64Hash pieceCrc64;
+      pieceCrc64.Concatenate(*crc64);
+      ContentHash hash;
+      hash.Value = pieceCrc64.Final();
+      hash.Algorithm = HashAlgorithm::Crc64;
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_pieces[offset] = std::move(crc64);
+      return hash;
+    }
+
+    ContentHash ChunkedCrc64::GetRangeHash(int64_t offset, int64_t length)
+    {
+      Crc64Hash crc64;
+      std::lock_guard<std::mutex> lock(m_mutex);
+      for (auto piece = m_pieces.lower_bound(offset);
+           piece != m_pieces.end() && piece->first < offset + length;
+           ++piece)
+      {
+        crc64.Concatenate(*piece->second);
+      }
+      ContentHash hash;
+      hash.Value = crc64.Final();
+      hash.Algorithm = HashAlgorithm::Crc64;
+      return hash;
+    }
+
+    ContentHash ChunkedCrc64::Final()
+    {
+      Crc64Hash crc64;
+      std::lock_guard<std::mutex> lock(m_mutex);
+      for (const auto& piece : m_pieces)
+      {
+        crc64.Concatenate(*piece.second);
+      }
+      ContentHash hash;
+      hash.Value = crc64.Final();
+      hash.Algorithm = HashAlgorithm::Crc64;
+      return hash;
+    }
+  } // namespace _internal
+
 }} // namespace Azure::Storage
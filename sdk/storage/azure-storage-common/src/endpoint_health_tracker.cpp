@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/endpoint_health_tracker.hpp"
+
+#include <utility>
+
+namespace Azure { namespace Storage {
+
+  EndpointHealthTracker::EndpointHealthTracker(EndpointHealthTrackerOptions options)
+      : m_options(std::move(options))
+  {
+  }
+
+  bool EndpointHealthTracker::IsAvailable(const std::string& host)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto ite = m_hosts.find(host);
+    if (ite == m_hosts.end() || ite->second.ConsecutiveFailures < m_options.FailureThreshold)
+    {
+      return true;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (now < ite->second.UnavailableUntil)
+    {
+      return false;
+    }
+    // This request probes the host. The others keep away from it until the probe is reported, or
+    // for another cooling-off period if it never is.
+    ite->second.UnavailableUntil = now + m_options.CoolingOffPeriod;
+    return true;
+  }
+
+  void EndpointHealthTracker::ReportSuccess(const std::string& host)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto ite = m_hosts.find(host);
+    if (ite != m_hosts.end())
+    {
+      m_hosts.erase(ite);
+    }
+  }
+
+  void EndpointHealthTracker::ReportFailure(const std::string& host)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto& health = m_hosts[host];
+    if (++health.ConsecutiveFailures >= m_options.FailureThreshold)
+    {
+      health.ConsecutiveFailures = m_options.FailureThreshold;
+      health.UnavailableUntil = std::chrono::steady_clock::now() + m_options.CoolingOffPeriod;
+    }
+  }
+
+}} // namespace Azure::Storage
@@ -6,7 +6,9 @@
 #include <azure/core/platform.hpp>
 
 #if defined(AZ_PLATFORM_POSIX)
+#include <dirent.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -20,39 +22,197 @@
 #define NOMINMAX
 #endif
 #include <windows.h>
+#include <winioctl.h>
 #endif
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <limits>
 #include <stdexcept>
+#include <vector>
 
 namespace Azure { namespace Storage { namespace _internal {
 
-#if defined(AZ_PLATFORM_WINDOWS)
-  FileReader::FileReader(const std::string& filename)
+  namespace {
+    // The maximum length of a single system call, a multiple of the alignment.
+    constexpr size_t MaxIoLength = 1024 * 1024 * 1024;
+  } // namespace
+
+  size_t GetUnbufferedLength(const void* buffer, size_t length, int64_t offset)
   {
-    int sizeNeeded = MultiByteToWideChar(
-        CP_UTF8,
-        MB_ERR_INVALID_CHARS,
-        filename.data(),
-        static_cast<int>(filename.length()),
-        nullptr,
-        0);
-    if (sizeNeeded == 0)
-    {
-      throw std::runtime_error("Invalid filename.");
-    }
-    std::wstring filenameW(sizeNeeded, L'\0');
-    if (MultiByteToWideChar(
-            CP_UTF8,
-            MB_ERR_INVALID_CHARS,
-            filename.data(),
-            static_cast<int>(filename.length()),
-            &filenameW[0],
-            sizeNeeded)
-        == 0)
+    if (reinterpret_cast<uintptr_t>(buffer) % UnbufferedFileIoAlignment != 0
+        || offset % static_cast<int64_t>(UnbufferedFileIoAlignment) != 0)
     {
-      throw std::runtime_error("Invalid filename.");
+      return 0;
     }
+    return length / UnbufferedFileIoAlignment * UnbufferedFileIoAlignment;
+  }
+
+  void FindNonZeroRanges(
+      const uint8_t* data,
+      size_t length,
+      int64_t offset,
+      std::vector<FileRange>& ranges)
+  {
+    bool inRange = false;
+    for (size_t blockOffset = 0; blockOffset < length; blockOffset += ZeroCheckBlockSize)
+    {
+      const size_t blockLength = std::min(ZeroCheckBlockSize, length - blockOffset);
+      // The bytes are ORed together without branching, so that compilers vectorize the loop.
+      uint8_t bits = 0;
+      for (size_t i = 0; i < blockLength; ++i)
+      {
+        bits |= data[blockOffset + i];
+      }
+      if (bits == 0)
+      {
+        inRange = false;
+      }
+      else if (inRange)
+      {
+        ranges.back().Length += static_cast<int64_t>(blockLength);
+      }
+      else
+      {
+        ranges.push_back(FileRange{
+            offset + static_cast<int64_t>(blockOffset), static_cast<int64_t>(blockLength)});
+        inRange = true;
+      }
+    }
+  }
+
+#if defined(AZ_PLATFORM_WINDOWS)
+  namespace {
+    std::wstring ToWideFilename(const std::string& filename)
+    {
+      int sizeNeeded = MultiByteToWideChar(
+          CP_UTF8,
+          MB_ERR_INVALID_CHARS,
+          filename.data(),
+          static_cast<int>(filename.length()),
+          nullptr,
+          0);
+      if (sizeNeeded == 0)
+      {
+        throw std::runtime_error("Invalid filename.");
+      }
+      std::wstring filenameW(sizeNeeded, L'\0');
+      if (MultiByteToWideChar(
+              CP_UTF8,
+              MB_ERR_INVALID_CHARS,
+              filename.data(),
+              static_cast<int>(filename.length()),
+              &filenameW[0],
+              sizeNeeded)
+          == 0)
+      {
+        throw std::runtime_error("Invalid filename.");
+      }
+      return filenameW;
+    }
+
+    // Opens a second handle of a file, which bypasses the page cache.
+    Azure::Nullable<FileHandle> OpenUnbuffered(
+        const std::wstring& filenameW,
+        DWORD desiredAccess,
+        DWORD shareMode)
+    {
+#if !defined(WINAPI_PARTITION_DESKTOP) \
+    || WINAPI_PARTITION_DESKTOP // See azure/core/platform.hpp for explanation.
+      HANDLE fileHandle = CreateFileW(
+          filenameW.data(),
+          desiredAccess,
+          shareMode,
+          nullptr,
+          OPEN_EXISTING,
+          FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING,
+          NULL);
+      if (fileHandle != INVALID_HANDLE_VALUE)
+      {
+        return static_cast<void*>(fileHandle);
+      }
+#else
+      (void)filenameW;
+      (void)desiredAccess;
+      (void)shareMode;
+#endif
+      return Azure::Nullable<FileHandle>();
+    }
+
+    size_t ReadAt(FileHandle handle, uint8_t* buffer, size_t length, int64_t offset)
+    {
+      size_t bytesRead = 0;
+      while (bytesRead < length)
+      {
+        const uint64_t readOffset = static_cast<uint64_t>(offset) + bytesRead;
+        OVERLAPPED overlapped;
+        std::memset(&overlapped, 0, sizeof(overlapped));
+        overlapped.Offset = static_cast<DWORD>(readOffset);
+        overlapped.OffsetHigh = static_cast<DWORD>(readOffset >> 32);
+
+        const DWORD readSize = static_cast<DWORD>(std::min(length - bytesRead, MaxIoLength));
+        DWORD bytesReadOnce;
+        BOOL ret = ReadFile(
+            static_cast<HANDLE>(handle),
+            buffer + bytesRead,
+            readSize,
+            &bytesReadOnce,
+            &overlapped);
+        if (!ret && GetLastError() != ERROR_HANDLE_EOF)
+        {
+          throw std::runtime_error("Failed to read file.");
+        }
+        bytesRead += ret ? bytesReadOnce : 0;
+        // A short read means the end of the file.
+        if (!ret || bytesReadOnce != readSize)
+        {
+          break;
+        }
+      }
+      return bytesRead;
+    }
+
+    void WriteAt(FileHandle handle, const uint8_t* buffer, size_t length, int64_t offset)
+    {
+      size_t bytesWritten = 0;
+      while (bytesWritten < length)
+      {
+        const uint64_t writeOffset = static_cast<uint64_t>(offset) + bytesWritten;
+        OVERLAPPED overlapped;
+        std::memset(&overlapped, 0, sizeof(overlapped));
+        overlapped.Offset = static_cast<DWORD>(writeOffset);
+        overlapped.OffsetHigh = static_cast<DWORD>(writeOffset >> 32);
+
+        const DWORD writeSize = static_cast<DWORD>(std::min(length - bytesWritten, MaxIoLength));
+        DWORD bytesWrittenOnce;
+        BOOL ret = WriteFile(
+            static_cast<HANDLE>(handle),
+            buffer + bytesWritten,
+            writeSize,
+            &bytesWrittenOnce,
+            &overlapped);
+        if (!ret || bytesWrittenOnce != writeSize)
+        {
+          throw std::runtime_error("Failed to write file.");
+        }
+        bytesWritten += writeSize;
+      }
+    }
+
+    // In nanoseconds since 1601.
+    int64_t ToLastWriteTime(const FILETIME& fileTime)
+    {
+      ULARGE_INTEGER lastWriteTime;
+      lastWriteTime.LowPart = fileTime.dwLowDateTime;
+      lastWriteTime.HighPart = fileTime.dwHighDateTime;
+      return static_cast<int64_t>(lastWriteTime.QuadPart) * 100;
+    }
+  } // namespace
+
+  FileReader::FileReader(const std::string& filename, bool unbuffered)
+  {
+    const std::wstring filenameW = ToWideFilename(filename);
 
     HANDLE fileHandle;
 
@@ -83,35 +243,128 @@ namespace Azure { namespace Storage { namespace _internal {
     }
     m_handle = static_cast<void*>(fileHandle);
     m_fileSize = fileSize.QuadPart;
+    if (unbuffered)
+    {
+      m_unbufferedHandle = OpenUnbuffered(filenameW, GENERIC_READ, FILE_SHARE_READ);
+    }
   }
 
-  FileReader::~FileReader() { CloseHandle(static_cast<HANDLE>(m_handle)); }
+  FileReader::~FileReader()
+  {
+    if (m_unbufferedHandle.HasValue())
+    {
+      CloseHandle(static_cast<HANDLE>(m_unbufferedHandle.Value()));
+    }
+    CloseHandle(static_cast<HANDLE>(m_handle));
+  }
 
-  FileWriter::FileWriter(const std::string& filename)
+  int64_t FileReader::GetLastWriteTime() const
   {
-    int sizeNeeded = MultiByteToWideChar(
-        CP_UTF8,
-        MB_ERR_INVALID_CHARS,
-        filename.data(),
-        static_cast<int>(filename.length()),
-        nullptr,
-        0);
-    if (sizeNeeded == 0)
-    {
-      throw std::runtime_error("Invalid filename.");
-    }
-    std::wstring filenameW(sizeNeeded, L'\0');
-    if (MultiByteToWideChar(
-            CP_UTF8,
-            MB_ERR_INVALID_CHARS,
-            filename.data(),
-            static_cast<int>(filename.length()),
-            &filenameW[0],
-            sizeNeeded)
-        == 0)
+    FILETIME lastWriteTime;
+    if (!GetFileTime(static_cast<HANDLE>(m_handle), nullptr, nullptr, &lastWriteTime))
     {
-      throw std::runtime_error("Invalid filename.");
+      throw std::runtime_error("Failed to get status of file.");
     }
+    return ToLastWriteTime(lastWriteTime);
+  }
+
+  std::vector<FileRange> FileReader::GetDataRanges() const
+  {
+    std::vector<FileRange> ranges;
+    if (m_fileSize == 0)
+    {
+      return ranges;
+    }
+#if !defined(WINAPI_PARTITION_DESKTOP) \
+    || WINAPI_PARTITION_DESKTOP // See azure/core/platform.hpp for explanation.
+    FILE_ALLOCATED_RANGE_BUFFER query;
+    query.FileOffset.QuadPart = 0;
+    query.Length.QuadPart = m_fileSize;
+    std::vector<FILE_ALLOCATED_RANGE_BUFFER> allocatedRanges(64);
+    for (;;)
+    {
+      DWORD bytesReturned = 0;
+      const BOOL succeeded = DeviceIoControl(
+          static_cast<HANDLE>(m_handle),
+          FSCTL_QUERY_ALLOCATED_RANGES,
+          &query,
+          sizeof(query),
+          allocatedRanges.data(),
+          static_cast<DWORD>(allocatedRanges.size() * sizeof(FILE_ALLOCATED_RANGE_BUFFER)),
+          &bytesReturned,
+          nullptr);
+      const size_t count = bytesReturned / sizeof(FILE_ALLOCATED_RANGE_BUFFER);
+      if (!succeeded && (GetLastError() != ERROR_MORE_DATA || count == 0))
+      {
+        // The file system can't tell.
+        ranges.clear();
+        break;
+      }
+      for (size_t i = 0; i < count; ++i)
+      {
+        const int64_t offset = allocatedRanges[i].FileOffset.QuadPart;
+        const int64_t length
+            = std::min(allocatedRanges[i].Length.QuadPart, m_fileSize - offset);
+        if (length > 0)
+        {
+          ranges.push_back(FileRange{offset, length});
+        }
+      }
+      if (succeeded)
+      {
+        return ranges;
+      }
+      const int64_t next = allocatedRanges[count - 1].FileOffset.QuadPart
+          + allocatedRanges[count - 1].Length.QuadPart;
+      query.Length.QuadPart = m_fileSize - next;
+      query.FileOffset.QuadPart = next;
+    }
+#endif
+    ranges.push_back(FileRange{0, m_fileSize});
+    return ranges;
+  }
+
+  FileMapping::FileMapping(const FileReader& fileReader) : m_size(fileReader.GetFileSize())
+  {
+    // An empty file can't be mapped.
+    if (m_size == 0)
+    {
+      return;
+    }
+    if (static_cast<uint64_t>(m_size) > std::numeric_limits<SIZE_T>::max())
+    {
+      throw std::runtime_error("Failed to map file.");
+    }
+
+    HANDLE mappingHandle = CreateFileMappingW(
+        static_cast<HANDLE>(fileReader.GetHandle()), nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle == NULL)
+    {
+      throw std::runtime_error("Failed to map file.");
+    }
+    void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, static_cast<SIZE_T>(m_size));
+    if (data == nullptr)
+    {
+      CloseHandle(mappingHandle);
+      throw std::runtime_error("Failed to map file.");
+    }
+    m_mappingHandle = static_cast<void*>(mappingHandle);
+    m_data = static_cast<const uint8_t*>(data);
+  }
+
+  FileMapping::~FileMapping()
+  {
+    if (m_data != nullptr)
+    {
+      UnmapViewOfFile(m_data);
+      CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    }
+  }
+
+  FileWriter::FileWriter(const std::string& filename, bool unbuffered, bool truncate)
+  {
+    const std::wstring filenameW = ToWideFilename(filename);
+    const DWORD creationDisposition = truncate ? CREATE_ALWAYS : OPEN_ALWAYS;
 
     HANDLE fileHandle;
 
@@ -122,48 +375,356 @@ namespace Azure { namespace Storage { namespace _internal {
         GENERIC_WRITE,
         FILE_SHARE_READ | FILE_SHARE_WRITE,
         nullptr,
-        CREATE_ALWAYS,
+        creationDisposition,
         FILE_ATTRIBUTE_NORMAL,
         NULL);
 #else
     fileHandle = CreateFile2(
-        filenameW.data(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, CREATE_ALWAYS, NULL);
+        filenameW.data(),
+        GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE,
+        creationDisposition,
+        NULL);
 #endif
     if (fileHandle == INVALID_HANDLE_VALUE)
     {
       throw std::runtime_error("Failed to open file.");
     }
     m_handle = static_cast<void*>(fileHandle);
+    if (unbuffered)
+    {
+      m_unbufferedHandle
+          = OpenUnbuffered(filenameW, GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE);
+    }
   }
 
-  FileWriter::~FileWriter() { CloseHandle(static_cast<HANDLE>(m_handle)); }
-
-  void FileWriter::Write(const uint8_t* buffer, size_t length, int64_t offset)
+  FileWriter::~FileWriter()
   {
-    if (length > std::numeric_limits<DWORD>::max())
+    if (m_unbufferedHandle.HasValue())
     {
-      throw std::runtime_error("Failed to write file.");
+      CloseHandle(static_cast<HANDLE>(m_unbufferedHandle.Value()));
     }
+    CloseHandle(static_cast<HANDLE>(m_handle));
+  }
 
-    OVERLAPPED overlapped;
-    std::memset(&overlapped, 0, sizeof(overlapped));
-    overlapped.Offset = static_cast<DWORD>(static_cast<uint64_t>(offset));
-    overlapped.OffsetHigh = static_cast<DWORD>(static_cast<uint64_t>(offset) >> 32);
+  void FileWriter::Preallocate(int64_t size)
+  {
+    FILE_ALLOCATION_INFO allocationInfo;
+    allocationInfo.AllocationSize.QuadPart = size;
+    // Preallocation is only an optimization, its failure isn't an error.
+    SetFileInformationByHandle(
+        static_cast<HANDLE>(m_handle), FileAllocationInfo, &allocationInfo, sizeof(allocationInfo));
+  }
 
-    DWORD bytesWritten;
-    BOOL ret = WriteFile(
+  void FileWriter::SetSparseSize(int64_t size)
+  {
+#if !defined(WINAPI_PARTITION_DESKTOP) \
+    || WINAPI_PARTITION_DESKTOP // See azure/core/platform.hpp for explanation.
+    // Without the sparse attribute the file is still valid, only fully allocated.
+    DWORD bytesReturned;
+    DeviceIoControl(
         static_cast<HANDLE>(m_handle),
-        buffer,
-        static_cast<DWORD>(length),
-        &bytesWritten,
-        &overlapped);
-    if (!ret)
+        FSCTL_SET_SPARSE,
+        nullptr,
+        0,
+        nullptr,
+        0,
+        &bytesReturned,
+        nullptr);
+#endif
+    FILE_END_OF_FILE_INFO endOfFileInfo;
+    endOfFileInfo.EndOfFile.QuadPart = size;
+    if (!SetFileInformationByHandle(
+            static_cast<HANDLE>(m_handle),
+            FileEndOfFileInfo,
+            &endOfFileInfo,
+            sizeof(endOfFileInfo)))
+    {
+      throw std::runtime_error("Failed to resize file.");
+    }
+  }
+
+  void FileWriter::Zero(int64_t offset, int64_t length)
+  {
+    // On a sparse file, the zeroed range is deallocated.
+    FILE_ZERO_DATA_INFORMATION zeroDataInfo;
+    zeroDataInfo.FileOffset.QuadPart = offset;
+    zeroDataInfo.BeyondFinalZero.QuadPart = offset + length;
+    DWORD bytesReturned;
+    if (!DeviceIoControl(
+            static_cast<HANDLE>(m_handle),
+            FSCTL_SET_ZERO_DATA,
+            &zeroDataInfo,
+            sizeof(zeroDataInfo),
+            nullptr,
+            0,
+            &bytesReturned,
+            nullptr))
     {
       throw std::runtime_error("Failed to write file.");
     }
   }
+
+  WritableFileMapping::WritableFileMapping(const std::string& filename, int64_t size)
+      : m_size(size)
+  {
+    if (static_cast<uint64_t>(m_size) > std::numeric_limits<SIZE_T>::max())
+    {
+      throw std::runtime_error("Failed to map file.");
+    }
+    const std::wstring filenameW = ToWideFilename(filename);
+
+    HANDLE fileHandle;
+
+#if !defined(WINAPI_PARTITION_DESKTOP) \
+    || WINAPI_PARTITION_DESKTOP // See azure/core/platform.hpp for explanation.
+    fileHandle = CreateFileW(
+        filenameW.data(),
+        GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr,
+        CREATE_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL,
+        NULL);
+#else
+    fileHandle = CreateFile2(
+        filenameW.data(),
+        GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE,
+        CREATE_ALWAYS,
+        NULL);
+#endif
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+      throw std::runtime_error("Failed to open file.");
+    }
+    m_handle = static_cast<void*>(fileHandle);
+
+    FILE_END_OF_FILE_INFO endOfFileInfo;
+    endOfFileInfo.EndOfFile.QuadPart = m_size;
+    if (!SetFileInformationByHandle(
+            fileHandle, FileEndOfFileInfo, &endOfFileInfo, sizeof(endOfFileInfo)))
+    {
+      CloseHandle(fileHandle);
+      throw std::runtime_error("Failed to resize file.");
+    }
+    // An empty file can't be mapped.
+    if (m_size == 0)
+    {
+      return;
+    }
+
+    HANDLE mappingHandle
+        = CreateFileMappingW(fileHandle, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+    if (mappingHandle == NULL)
+    {
+      CloseHandle(fileHandle);
+      throw std::runtime_error("Failed to map file.");
+    }
+    void* data = MapViewOfFile(mappingHandle, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(m_size));
+    if (data == nullptr)
+    {
+      CloseHandle(mappingHandle);
+      CloseHandle(fileHandle);
+      throw std::runtime_error("Failed to map file.");
+    }
+    m_mappingHandle = static_cast<void*>(mappingHandle);
+    m_data = static_cast<uint8_t*>(data);
+  }
+
+  WritableFileMapping::~WritableFileMapping()
+  {
+    if (m_data != nullptr)
+    {
+      UnmapViewOfFile(m_data);
+      CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    }
+    CloseHandle(static_cast<HANDLE>(m_handle));
+  }
+  namespace {
+    std::string FromWideFilename(const std::wstring& filenameW)
+    {
+      int sizeNeeded = WideCharToMultiByte(
+          CP_UTF8,
+          WC_ERR_INVALID_CHARS,
+          filenameW.data(),
+          static_cast<int>(filenameW.length()),
+          nullptr,
+          0,
+          nullptr,
+          nullptr);
+      if (sizeNeeded == 0)
+      {
+        throw std::runtime_error("Invalid filename.");
+      }
+      std::string filename(sizeNeeded, '\0');
+      if (WideCharToMultiByte(
+              CP_UTF8,
+              WC_ERR_INVALID_CHARS,
+              filenameW.data(),
+              static_cast<int>(filenameW.length()),
+              &filename[0],
+              sizeNeeded,
+              nullptr,
+              nullptr)
+          == 0)
+      {
+        throw std::runtime_error("Invalid filename.");
+      }
+      return filename;
+    }
+  } // namespace
+
+  std::vector<LocalDirectoryEntry> ListLocalDirectory(const std::string& path)
+  {
+    const std::wstring patternW = ToWideFilename(path + "/*");
+    WIN32_FIND_DATAW findData;
+    HANDLE findHandle = FindFirstFileExW(
+        patternW.data(), FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, 0);
+    if (findHandle == INVALID_HANDLE_VALUE)
+    {
+      throw std::runtime_error("Failed to open directory.");
+    }
+    std::vector<LocalDirectoryEntry> entries;
+    do
+    {
+      const std::wstring nameW(findData.cFileName);
+      if (nameW == L"." || nameW == L"..")
+      {
+        continue;
+      }
+      LocalDirectoryEntry entry;
+      entry.Name = FromWideFilename(nameW);
+      entry.IsDirectory = (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+      if (!entry.IsDirectory)
+      {
+        entry.Size = static_cast<int64_t>(
+            (static_cast<uint64_t>(findData.nFileSizeHigh) << 32) | findData.nFileSizeLow);
+        entry.LastWriteTime = ToLastWriteTime(findData.ftLastWriteTime);
+      }
+      entries.push_back(std::move(entry));
+    } while (FindNextFileW(findHandle, &findData));
+    const DWORD error = GetLastError();
+    FindClose(findHandle);
+    if (error != ERROR_NO_MORE_FILES)
+    {
+      throw std::runtime_error("Failed to list directory.");
+    }
+    return entries;
+  }
+
+  void CreateLocalDirectories(const std::string& path)
+  {
+    const std::wstring pathW = ToWideFilename(path);
+    if (CreateDirectoryW(pathW.data(), nullptr))
+    {
+      return;
+    }
+    if (GetLastError() == ERROR_PATH_NOT_FOUND)
+    {
+      const size_t separator = path.find_last_of("/\\", path.find_last_not_of("/\\"));
+      if (separator != std::string::npos && separator != 0)
+      {
+        CreateLocalDirectories(path.substr(0, separator));
+        if (CreateDirectoryW(pathW.data(), nullptr))
+        {
+          return;
+        }
+      }
+    }
+    const DWORD attributes = GetFileAttributesW(pathW.data());
+    if (attributes == INVALID_FILE_ATTRIBUTES || (attributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+    {
+      throw std::runtime_error("Failed to create directory.");
+    }
+  }
 #elif defined(AZ_PLATFORM_POSIX)
-  FileReader::FileReader(const std::string& filename)
+  namespace {
+    // Opens a second descriptor of a file, which bypasses the page cache.
+    Azure::Nullable<FileHandle> OpenUnbuffered(const std::string& filename, int flags)
+    {
+#if defined(O_DIRECT)
+      int fileDescriptor = open(filename.data(), flags | O_DIRECT);
+      if (fileDescriptor != -1)
+      {
+        return fileDescriptor;
+      }
+#elif defined(F_NOCACHE)
+      int fileDescriptor = open(filename.data(), flags);
+      if (fileDescriptor != -1)
+      {
+        fcntl(fileDescriptor, F_NOCACHE, 1);
+        return fileDescriptor;
+      }
+#else
+      (void)filename;
+      (void)flags;
+#endif
+      return Azure::Nullable<FileHandle>();
+    }
+
+    size_t ReadAt(FileHandle handle, uint8_t* buffer, size_t length, int64_t offset)
+    {
+      size_t bytesRead = 0;
+      while (bytesRead < length)
+      {
+        const int64_t readOffset = offset + static_cast<int64_t>(bytesRead);
+        if (readOffset > static_cast<int64_t>(std::numeric_limits<off_t>::max()))
+        {
+          throw std::runtime_error("Failed to read file.");
+        }
+        const size_t readSize = std::min(length - bytesRead, MaxIoLength);
+        ssize_t bytesReadOnce
+            = pread(handle, buffer + bytesRead, readSize, static_cast<off_t>(readOffset));
+        if (bytesReadOnce < 0)
+        {
+          throw std::runtime_error("Failed to read file.");
+        }
+        bytesRead += static_cast<size_t>(bytesReadOnce);
+        // A short read means the end of the file.
+        if (static_cast<size_t>(bytesReadOnce) != readSize)
+        {
+          break;
+        }
+      }
+      return bytesRead;
+    }
+
+    void WriteAt(FileHandle handle, const uint8_t* buffer, size_t length, int64_t offset)
+    {
+      size_t bytesWritten = 0;
+      while (bytesWritten < length)
+      {
+        const int64_t writeOffset = offset + static_cast<int64_t>(bytesWritten);
+        if (writeOffset > static_cast<int64_t>(std::numeric_limits<off_t>::max()))
+        {
+          throw std::runtime_error("Failed to write file.");
+        }
+        const size_t writeSize = std::min(length - bytesWritten, MaxIoLength);
+        ssize_t bytesWrittenOnce
+            = pwrite(handle, buffer + bytesWritten, writeSize, static_cast<off_t>(writeOffset));
+        if (bytesWrittenOnce < 0 || static_cast<size_t>(bytesWrittenOnce) != writeSize)
+        {
+          throw std::runtime_error("Failed to write file.");
+        }
+        bytesWritten += writeSize;
+      }
+    }
+
+    // In nanoseconds since 1970.
+    int64_t ToLastWriteTime(const struct stat& status)
+    {
+#if defined(__APPLE__)
+      const auto& lastWriteTime = status.st_mtimespec;
+#else
+      const auto& lastWriteTime = status.st_mtim;
+#endif
+      return static_cast<int64_t>(lastWriteTime.tv_sec) * 1000000000
+          + static_cast<int64_t>(lastWriteTime.tv_nsec);
+    }
+  } // namespace
+
+  FileReader::FileReader(const std::string& filename, bool unbuffered)
   {
     m_handle = open(filename.data(), O_RDONLY);
     if (m_handle == -1)
@@ -176,34 +737,334 @@ namespace Azure { namespace Storage { namespace _internal {
       close(m_handle);
       throw std::runtime_error("Failed to get size of file.");
     }
+    if (unbuffered)
+    {
+      m_unbufferedHandle = OpenUnbuffered(filename, O_RDONLY);
+    }
+  }
+
+  FileReader::~FileReader()
+  {
+    if (m_unbufferedHandle.HasValue())
+    {
+      close(m_unbufferedHandle.Value());
+    }
+    close(m_handle);
+  }
+
+  int64_t FileReader::GetLastWriteTime() const
+  {
+    struct stat status;
+    if (fstat(m_handle, &status) != 0)
+    {
+      throw std::runtime_error("Failed to get status of file.");
+    }
+    return ToLastWriteTime(status);
+  }
+
+  std::vector<FileRange> FileReader::GetDataRanges() const
+  {
+    std::vector<FileRange> ranges;
+#if defined(SEEK_DATA) && defined(SEEK_HOLE)
+    int64_t offset = 0;
+    while (offset < m_fileSize)
+    {
+      const off_t dataStart = lseek(m_handle, static_cast<off_t>(offset), SEEK_DATA);
+      if (dataStart == -1)
+      {
+        // ENXIO means there's no data after offset. Otherwise the file system can't tell.
+        if (errno != ENXIO)
+        {
+          ranges.push_back(FileRange{offset, m_fileSize - offset});
+        }
+        return ranges;
+      }
+      off_t dataEnd = lseek(m_handle, dataStart, SEEK_HOLE);
+      if (dataEnd == -1 || dataEnd > m_fileSize)
+      {
+        dataEnd = static_cast<off_t>(m_fileSize);
+      }
+      if (dataEnd > dataStart)
+      {
+        ranges.push_back(FileRange{dataStart, dataEnd - dataStart});
+      }
+      offset = std::max<int64_t>(dataEnd, offset + 1);
+    }
+#else
+    if (m_fileSize > 0)
+    {
+      ranges.push_back(FileRange{0, m_fileSize});
+    }
+#endif
+    return ranges;
+  }
+
+  FileMapping::FileMapping(const FileReader& fileReader) : m_size(fileReader.GetFileSize())
+  {
+    // An empty file can't be mapped.
+    if (m_size == 0)
+    {
+      return;
+    }
+    if (static_cast<uint64_t>(m_size) > std::numeric_limits<size_t>::max())
+    {
+      throw std::runtime_error("Failed to map file.");
+    }
+
+    void* data = mmap(
+        nullptr, static_cast<size_t>(m_size), PROT_READ, MAP_SHARED, fileReader.GetHandle(), 0);
+    if (data == MAP_FAILED)
+    {
+      throw std::runtime_error("Failed to map file.");
+    }
+    // The advice only tunes the read-ahead of the page cache, so its failure isn't an error.
+    madvise(data, static_cast<size_t>(m_size), MADV_SEQUENTIAL);
+    m_data = static_cast<const uint8_t*>(data);
+  }
+
+  FileMapping::~FileMapping()
+  {
+    if (m_data != nullptr)
+    {
+      munmap(const_cast<uint8_t*>(m_data), static_cast<size_t>(m_size));
+    }
+  }
+
+  FileWriter::FileWriter(const std::string& filename, bool unbuffered, bool truncate)
+  {
+    m_handle = open(
+        filename.data(),
+        O_WRONLY | O_CREAT | (truncate ? O_TRUNC : 0),
+        S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (m_handle == -1)
+    {
+      throw std::runtime_error("Failed to open file.");
+    }
+    if (unbuffered)
+    {
+      m_unbufferedHandle = OpenUnbuffered(filename, O_WRONLY);
+    }
   }
 
-  FileReader::~FileReader() { close(m_handle); }
+  FileWriter::~FileWriter()
+  {
+    if (m_unbufferedHandle.HasValue())
+    {
+      close(m_unbufferedHandle.Value());
+    }
+    close(m_handle);
+  }
 
-  FileWriter::FileWriter(const std::string& filename)
+  void FileWriter::Preallocate(int64_t size)
   {
+    // Preallocation is only an optimization, its failure isn't an error.
+#if defined(__linux__)
+    fallocate(m_handle, 0, 0, static_cast<off_t>(size));
+#elif defined(F_PREALLOCATE)
+    fstore_t store;
+    std::memset(&store, 0, sizeof(store));
+    store.fst_flags = F_ALLOCATEALL;
+    store.fst_posmode = F_PEOFPOSMODE;
+    store.fst_length = static_cast<off_t>(size);
+    fcntl(m_handle, F_PREALLOCATE, &store);
+#else
+    (void)size;
+#endif
+  }
+
+  void FileWriter::SetSparseSize(int64_t size)
+  {
+    // Extending a file doesn't allocate the extension on the file systems supporting sparse files.
+    if (size > static_cast<int64_t>(std::numeric_limits<off_t>::max())
+        || ftruncate(m_handle, static_cast<off_t>(size)) != 0)
+    {
+      throw std::runtime_error("Failed to resize file.");
+    }
+  }
+
+  void FileWriter::Zero(int64_t offset, int64_t length)
+  {
+#if defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+    if (fallocate(
+            m_handle,
+            FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+            static_cast<off_t>(offset),
+            static_cast<off_t>(length))
+        == 0)
+    {
+      return;
+    }
+#endif
+    // Without hole punching, the zeros are written.
+    constexpr size_t ZerosSize = 64 * 1024;
+    const std::vector<uint8_t> zeros(static_cast<size_t>(std::min<int64_t>(length, ZerosSize)));
+    while (length > 0)
+    {
+      const size_t writeSize = static_cast<size_t>(std::min<int64_t>(length, ZerosSize));
+      WriteAt(m_handle, zeros.data(), writeSize, offset);
+      offset += writeSize;
+      length -= writeSize;
+    }
+  }
+
+  WritableFileMapping::WritableFileMapping(const std::string& filename, int64_t size)
+      : m_size(size)
+  {
+    if (static_cast<uint64_t>(m_size) > std::numeric_limits<size_t>::max()
+        || m_size > static_cast<int64_t>(std::numeric_limits<off_t>::max()))
+    {
+      throw std::runtime_error("Failed to map file.");
+    }
+    // The mapping is written, so the file is opened for reading too.
     m_handle = open(
-        filename.data(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+        filename.data(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
     if (m_handle == -1)
     {
       throw std::runtime_error("Failed to open file.");
     }
+    if (ftruncate(m_handle, static_cast<off_t>(m_size)) != 0)
+    {
+      close(m_handle);
+      throw std::runtime_error("Failed to resize file.");
+    }
+    // An empty file can't be mapped.
+    if (m_size == 0)
+    {
+      return;
+    }
+    // Allocation is only a safeguard against running out of space, its failure isn't an error.
+#if defined(__linux__)
+    fallocate(m_handle, 0, 0, static_cast<off_t>(m_size));
+#endif
+
+    void* data = mmap(
+        nullptr, static_cast<size_t>(m_size), PROT_READ | PROT_WRITE, MAP_SHARED, m_handle, 0);
+    if (data == MAP_FAILED)
+    {
+      close(m_handle);
+      throw std::runtime_error("Failed to map file.");
+    }
+    m_data = static_cast<uint8_t*>(data);
   }
 
-  FileWriter::~FileWriter() { close(m_handle); }
+  WritableFileMapping::~WritableFileMapping()
+  {
+    if (m_data != nullptr)
+    {
+      munmap(m_data, static_cast<size_t>(m_size));
+    }
+    close(m_handle);
+  }
 
-  void FileWriter::Write(const uint8_t* buffer, size_t length, int64_t offset)
+  std::vector<LocalDirectoryEntry> ListLocalDirectory(const std::string& path)
   {
-    if (offset > static_cast<int64_t>(std::numeric_limits<off_t>::max()))
+    DIR* directory = opendir(path.data());
+    if (directory == nullptr)
     {
-      throw std::runtime_error("Failed to write file.");
+      throw std::runtime_error("Failed to open directory.");
     }
-    ssize_t bytesWritten = pwrite(m_handle, buffer, length, static_cast<off_t>(offset));
-    if (bytesWritten < 0 || static_cast<size_t>(bytesWritten) != length)
+    std::vector<LocalDirectoryEntry> entries;
+    while (const dirent* directoryEntry = readdir(directory))
     {
-      throw std::runtime_error("Failed to write file.");
+      const std::string name(directoryEntry->d_name);
+      if (name == "." || name == "..")
+      {
+        continue;
+      }
+      struct stat status;
+      if (stat((path + "/" + name).data(), &status) != 0)
+      {
+        closedir(directory);
+        throw std::runtime_error("Failed to get status of file.");
+      }
+      if (!S_ISDIR(status.st_mode) && !S_ISREG(status.st_mode))
+      {
+        continue;
+      }
+      LocalDirectoryEntry entry;
+      entry.Name = name;
+      entry.IsDirectory = S_ISDIR(status.st_mode);
+      if (!entry.IsDirectory)
+      {
+        entry.Size = static_cast<int64_t>(status.st_size);
+        entry.LastWriteTime = ToLastWriteTime(status);
+      }
+      entries.push_back(std::move(entry));
+    }
+    closedir(directory);
+    return entries;
+  }
+
+  void CreateLocalDirectories(const std::string& path)
+  {
+    if (mkdir(path.data(), 0777) == 0)
+    {
+      return;
+    }
+    if (errno == ENOENT)
+    {
+      const size_t separator = path.find_last_of('/', path.find_last_not_of('/'));
+      if (separator != std::string::npos && separator != 0)
+      {
+        CreateLocalDirectories(path.substr(0, separator));
+        if (mkdir(path.data(), 0777) == 0)
+        {
+          return;
+        }
+      }
+    }
+    struct stat status;
+    if (stat(path.data(), &status) != 0 || !S_ISDIR(status.st_mode))
+    {
+      throw std::runtime_error("Failed to create directory.");
     }
   }
 #endif
 
+  AlignedBuffer::AlignedBuffer(size_t size)
+      : m_buffer(new uint8_t[size + UnbufferedFileIoAlignment]), m_size(size)
+  {
+    const size_t misalignment
+        = reinterpret_cast<uintptr_t>(m_buffer.get()) % UnbufferedFileIoAlignment;
+    m_data = m_buffer.get()
+        + (UnbufferedFileIoAlignment - misalignment) % UnbufferedFileIoAlignment;
+  }
+
+  size_t FileReader::Read(uint8_t* buffer, size_t length, int64_t offset) const
+  {
+    // The aligned beginning bypasses the page cache, the remaining bytes go through it.
+    size_t bytesRead = 0;
+    if (m_unbufferedHandle.HasValue())
+    {
+      const size_t unbufferedLength = GetUnbufferedLength(buffer, length, offset);
+      bytesRead = ReadAt(m_unbufferedHandle.Value(), buffer, unbufferedLength, offset);
+      if (bytesRead != unbufferedLength)
+      {
+        return bytesRead;
+      }
+    }
+    return bytesRead
+        + ReadAt(
+               m_handle,
+               buffer + bytesRead,
+               length - bytesRead,
+               offset + static_cast<int64_t>(bytesRead));
+  }
+
+  void FileWriter::Write(const uint8_t* buffer, size_t length, int64_t offset)
+  {
+    // The aligned beginning bypasses the page cache, the remaining bytes go through it.
+    size_t bytesWritten = 0;
+    if (m_unbufferedHandle.HasValue())
+    {
+      bytesWritten = GetUnbufferedLength(buffer, length, offset);
+      WriteAt(m_unbufferedHandle.Value(), buffer, bytesWritten, offset);
+    }
+    WriteAt(
+        m_handle,
+        buffer + bytesWritten,
+        length - bytesWritten,
+        offset + static_cast<int64_t>(bytesWritten));
+  }
+
 }}} // namespace Azure::Storage::_internal
@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/internal/gzip.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include <zlib.h>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  namespace {
+    // Adds a gzip header and trailer instead of a zlib one.
+    constexpr int GzipWindowBits = 15 + 16;
+    constexpr int DefaultMemoryLevel = 8;
+    constexpr size_t DecodeBufferSize = 64 * 1024;
+    // The sizes passed to zlib at a time, which are 32-bit.
+    constexpr size_t MaxZlibSize = std::numeric_limits<uInt>::max();
+
+    struct Deflater final
+    {
+      z_stream Stream{};
+
+      Deflater()
+      {
+        if (deflateInit2(
+                &Stream,
+                Z_DEFAULT_COMPRESSION,
+                Z_DEFLATED,
+                GzipWindowBits,
+                DefaultMemoryLevel,
+                Z_DEFAULT_STRATEGY)
+            != Z_OK)
+        {
+          throw std::runtime_error("Failed to initialize gzip compression.");
+        }
+      }
+
+      ~Deflater() { deflateEnd(&Stream); }
+    };
+  } // namespace
+
+  size_t GzipMaxCompressedSize(size_t size)
+  {
+    Deflater deflater;
+    // deflateBound takes a 32-bit size on some platforms, the bound grows linearly above it.
+    size_t bound = 0;
+    for (; size > MaxZlibSize; size -= MaxZlibSize)
+    {
+      bound += static_cast<size_t>(deflateBound(&deflater.Stream, static_cast<uLong>(MaxZlibSize)));
+    }
+    return bound + static_cast<size_t>(deflateBound(&deflater.Stream, static_cast<uLong>(size)));
+  }
+
+  size_t GzipCompress(const uint8_t* data, size_t size, uint8_t* output, size_t outputSize)
+  {
+    Deflater deflater;
+    z_stream& stream = deflater.Stream;
+    size_t inputOffset = 0;
+    size_t outputOffset = 0;
+    int ret;
+    do
+    {
+      const size_t inputSize = std::min(size - inputOffset, MaxZlibSize);
+      const size_t availableOutput = std::min(outputSize - outputOffset, MaxZlibSize);
+      stream.next_in = const_cast<Bytef*>(data + inputOffset);
+      stream.avail_in = static_cast<uInt>(inputSize);
+      stream.next_out = output + outputOffset;
+      stream.avail_out = static_cast<uInt>(availableOutput);
+      ret = deflate(&stream, inputOffset + inputSize == size ? Z_FINISH : Z_NO_FLUSH);
+      if (ret != Z_OK && ret != Z_STREAM_END)
+      {
+        throw std::runtime_error("Failed to compress gzip content.");
+      }
+      inputOffset += inputSize - stream.avail_in;
+      outputOffset += availableOutput - stream.avail_out;
+    } while (ret != Z_STREAM_END);
+    return outputOffset;
+  }
+
+  struct GzipDecoder::Implementation final
+  {
+    z_stream Stream{};
+    bool HasInput = false;
+    bool MemberEnded = false;
+    uint8_t Buffer[DecodeBufferSize];
+  };
+
+  GzipDecoder::GzipDecoder() : m_impl(std::make_unique<Implementation>())
+  {
+    if (inflateInit2(&m_impl->Stream, GzipWindowBits) != Z_OK)
+    {
+      throw std::runtime_error("Failed to initialize gzip decompression.");
+    }
+  }
+
+  GzipDecoder::~GzipDecoder() { inflateEnd(&m_impl->Stream); }
+
+  void GzipDecoder::Decode(
+      const uint8_t* data,
+      size_t size,
+      const std::function<void(const uint8_t*, size_t)>& sink)
+  {
+    z_stream& stream = m_impl->Stream;
+    while (size > 0)
+    {
+      const size_t inputSize = std::min(size, MaxZlibSize);
+      stream.next_in = const_cast<Bytef*>(data);
+      stream.avail_in = static_cast<uInt>(inputSize);
+      m_impl->HasInput = true;
+      while (true)
+      {
+        // The next member starts right after the end of the previous one.
+        if (m_impl->MemberEnded)
+        {
+          if (stream.avail_in == 0)
+          {
+            break;
+          }
+          inflateReset(&stream);
+          m_impl->MemberEnded = false;
+        }
+        stream.next_out = m_impl->Buffer;
+        stream.avail_out = static_cast<uInt>(DecodeBufferSize);
+        const int ret = inflate(&stream, Z_NO_FLUSH);
+        if (ret == Z_STREAM_END)
+        {
+          m_impl->MemberEnded = true;
+        }
+        else if (ret != Z_OK && ret != Z_BUF_ERROR)
+        {
+          throw std::runtime_error("Failed to decompress gzip content.");
+        }
+        const size_t decodedSize = DecodeBufferSize - stream.avail_out;
+        if (decodedSize > 0)
+        {
+          sink(m_impl->Buffer, decodedSize);
+        }
+        // Without room left in the buffer, more bytes may be decoded from the input consumed.
+        if (ret != Z_STREAM_END && stream.avail_out != 0)
+        {
+          break;
+        }
+      }
+      data += inputSize;
+      size -= inputSize;
+    }
+  }
+
+  void GzipDecoder::Finish()
+  {
+    if (m_impl->HasInput && !m_impl->MemberEnded)
+    {
+      throw std::runtime_error("Gzip content is truncated.");
+    }
+  }
+
+}}} // namespace Azure::Storage::_internal
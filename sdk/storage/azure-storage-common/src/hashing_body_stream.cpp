@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/internal/hashing_body_stream.hpp"
+
+#include "azure/storage/common/crypt.hpp"
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  HashingBodyStream::HashingBodyStream(
+      Azure::Core::IO::BodyStream& inner,
+      HashAlgorithm algorithm)
+      : m_inner(inner), m_algorithm(algorithm)
+  {
+    if (algorithm == HashAlgorithm::Md5)
+    {
+      m_hash = std::make_unique<Azure::Core::Cryptography::Md5Hash>();
+    }
+    else
+    {
+      m_hash = std::make_unique<Crc64Hash>();
+    }
+  }
+
+  void HashingBodyStream::Rewind()
+  {
+    m_inner.Rewind();
+    m_hash->Reset();
+  }
+
+  ContentHash HashingBodyStream::GetHash()
+  {
+    ContentHash hash;
+    hash.Algorithm = m_algorithm;
+    hash.Value = m_hash->Final();
+    return hash;
+  }
+
+  size_t HashingBodyStream::OnRead(
+      uint8_t* buffer,
+      size_t count,
+      Azure::Core::Context const& context)
+  {
+    const size_t bytesRead = m_inner.Read(buffer, count, context);
+    m_hash->Append(buffer, bytesRead);
+    return bytesRead;
+  }
+
+}}} // namespace Azure::Storage::_internal
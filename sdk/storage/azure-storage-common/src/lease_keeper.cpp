@@ -0,0 +1,294 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/lease_keeper.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include <azure/core/exception.hpp>
+
+#include "azure/storage/common/internal/thread_pool.hpp"
+
+namespace Azure { namespace Storage {
+
+  namespace {
+    // Whether the lease can't be renewed anymore, rather than the renewal failed transiently.
+    bool IsLeaseLost(Azure::Core::Http::HttpStatusCode statusCode)
+    {
+      const auto code = static_cast<int>(statusCode);
+      return code >= 400 && code < 500
+          && statusCode != Azure::Core::Http::HttpStatusCode::RequestTimeout
+          && statusCode != Azure::Core::Http::HttpStatusCode::TooManyRequests;
+    }
+  } // namespace
+
+  LeaseKeeper::LeaseKeeper(const LeaseKeeperOptions& options)
+      : m_options(options), m_startTime(std::chrono::steady_clock::now()),
+        m_random(std::random_device()())
+  {
+    if (m_options.TickInterval.count() <= 0)
+    {
+      throw std::invalid_argument("TickInterval must be positive.");
+    }
+    if (m_options.MaxConcurrentRenewals <= 0)
+    {
+      throw std::invalid_argument("MaxConcurrentRenewals must be positive.");
+    }
+    m_timerThread = std::thread([this]() { RunTimer(); });
+  }
+
+  LeaseKeeper::~LeaseKeeper() { Stop(); }
+
+  int64_t LeaseKeeper::AddLease(
+      RenewFunction renew,
+      std::chrono::seconds duration,
+      LostLeaseHandler onLost)
+  {
+    if (duration.count() <= 0)
+    {
+      throw std::invalid_argument("Only leases with a finite duration can be renewed.");
+    }
+    auto lease = std::make_shared<KeptLease>();
+    lease->Renew = std::move(renew);
+    lease->OnLost = std::move(onLost);
+    lease->Duration = duration;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stopping)
+    {
+      throw std::runtime_error("The lease keeper is stopped.");
+    }
+    lease->Key = m_nextLeaseKey++;
+    lease->ExpiresOn = std::chrono::steady_clock::now() + lease->Duration;
+    m_leases.emplace(lease->Key, lease);
+    Schedule(lease, GetNextRenewalTime(*lease));
+    StartRenewals();
+    // The timer may be sleeping without any lease.
+    m_stateChanged.notify_all();
+    return lease->Key;
+  }
+
+  void LeaseKeeper::RemoveLease(int64_t leaseKey)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto ite = m_leases.find(leaseKey);
+    if (ite != m_leases.end())
+    {
+      // Dropped from the wheel when its slot is reached.
+      ite->second->Removed = true;
+      m_leases.erase(ite);
+    }
+  }
+
+  void LeaseKeeper::Stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+      m_stateChanged.notify_all();
+    }
+    m_renewalContext.Cancel();
+    if (m_timerThread.joinable())
+    {
+      m_timerThread.join();
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_stateChanged.wait(lock, [&]() { return m_numRunning == 0; });
+  }
+
+  std::chrono::steady_clock::time_point LeaseKeeper::GetNextRenewalTime(const KeptLease& lease)
+  {
+    const auto maxJitter = std::min<std::chrono::steady_clock::duration>(
+        m_options.MaxJitter, lease.Duration / 4);
+    std::chrono::steady_clock::duration jitter(0);
+    if (maxJitter.count() > 0)
+    {
+      jitter = std::chrono::steady_clock::duration(
+          std::uniform_int_distribution<std::chrono::steady_clock::rep>(
+              0, maxJitter.count())(m_random));
+    }
+    return lease.ExpiresOn - lease.Duration / 2 - jitter;
+  }
+
+  void LeaseKeeper::Schedule(
+      std::shared_ptr<KeptLease> lease,
+      std::chrono::steady_clock::time_point dueTime)
+  {
+    // The wheel may be behind when the timer sleeps.
+    AdvanceTicks(std::chrono::steady_clock::now());
+
+    const std::chrono::steady_clock::duration tickInterval = m_options.TickInterval;
+    uint64_t dueTick = 0;
+    if (dueTime > m_startTime)
+    {
+      dueTick = static_cast<uint64_t>(
+          (dueTime - m_startTime + tickInterval - std::chrono::steady_clock::duration(1))
+          / tickInterval);
+    }
+    lease->DueTick = std::max(dueTick, m_currentTick + 1);
+    InsertIntoWheel(std::move(lease));
+  }
+
+  void LeaseKeeper::InsertIntoWheel(std::shared_ptr<KeptLease> lease)
+  {
+    // Beyond the span of the wheel, the lease is moved down from the top level until it's due.
+    const uint64_t maxDelta = (uint64_t(1) << (WheelBits * WheelLevels)) - 1;
+    const uint64_t slotTick = std::min(lease->DueTick, m_currentTick + maxDelta);
+    const uint64_t delta = slotTick - m_currentTick;
+    size_t level = 0;
+    while (level + 1 < WheelLevels && delta >= (uint64_t(1) << (WheelBits * (level + 1))))
+    {
+      ++level;
+    }
+    const size_t slot = static_cast<size_t>(slotTick >> (WheelBits * level)) % WheelSize;
+    m_wheel[level][slot].push_back(std::move(lease));
+  }
+
+  void LeaseKeeper::AdvanceTicks(std::chrono::steady_clock::time_point now)
+  {
+    const std::chrono::steady_clock::duration tickInterval = m_options.TickInterval;
+    while (m_startTime + tickInterval * static_cast<int64_t>(m_currentTick + 1) <= now)
+    {
+      ++m_currentTick;
+      // When a level turns over, the next slot of the level above is moved down, from the top.
+      size_t cascadeLevels = 0;
+      while (cascadeLevels + 1 < WheelLevels
+             && (m_currentTick >> (WheelBits * cascadeLevels)) % WheelSize == 0)
+      {
+        ++cascadeLevels;
+      }
+      for (size_t level = cascadeLevels; level > 0; --level)
+      {
+        WheelSlot leases;
+        leases.swap(
+            m_wheel[level][static_cast<size_t>(m_currentTick >> (WheelBits * level)) % WheelSize]);
+        for (auto& lease : leases)
+        {
+          if (!lease->Removed)
+          {
+            InsertIntoWheel(std::move(lease));
+          }
+        }
+      }
+
+      WheelSlot leases;
+      leases.swap(m_wheel[0][static_cast<size_t>(m_currentTick) % WheelSize]);
+      for (auto& lease : leases)
+      {
+        if (lease->Removed)
+        {
+          continue;
+        }
+        if (lease->DueTick > m_currentTick)
+        {
+          // Was beyond the span of the wheel.
+          InsertIntoWheel(std::move(lease));
+        }
+        else
+        {
+          m_dueLeases.push_back(std::move(lease));
+        }
+      }
+    }
+  }
+
+  void LeaseKeeper::StartRenewals()
+  {
+    while (!m_stopping && !m_dueLeases.empty()
+           && m_numRunning < m_options.MaxConcurrentRenewals)
+    {
+      auto lease = std::move(m_dueLeases.front());
+      m_dueLeases.pop_front();
+      if (lease->Removed)
+      {
+        continue;
+      }
+      ++m_numRunning;
+      _internal::ThreadPool::GetDefault().Submit([this, lease]() { Renew(lease); });
+    }
+  }
+
+  void LeaseKeeper::Renew(std::shared_ptr<KeptLease> lease)
+  {
+    const auto renewalTime = std::chrono::steady_clock::now();
+    std::exception_ptr error;
+    bool lost = false;
+    try
+    {
+      lease->Renew(m_renewalContext);
+    }
+    catch (const Azure::Core::RequestFailedException& e)
+    {
+      error = std::current_exception();
+      lost = IsLeaseLost(e.StatusCode);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    LostLeaseHandler onLost;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!lease->Removed && !m_stopping)
+      {
+        const auto now = std::chrono::steady_clock::now();
+        if (!error)
+        {
+          lease->ExpiresOn = renewalTime + lease->Duration;
+          Schedule(lease, GetNextRenewalTime(*lease));
+        }
+        else if (!lost && now + m_options.RetryDelay < lease->ExpiresOn)
+        {
+          Schedule(lease, now + m_options.RetryDelay);
+        }
+        else
+        {
+          lease->Removed = true;
+          m_leases.erase(lease->Key);
+          onLost = std::move(lease->OnLost);
+        }
+      }
+    }
+
+    if (onLost)
+    {
+      try
+      {
+        onLost(error);
+      }
+      catch (...)
+      {
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_numRunning;
+    StartRenewals();
+    // Notified under the lock, the keeper may be destroyed as soon as it's released.
+    m_stateChanged.notify_all();
+  }
+
+  void LeaseKeeper::RunTimer()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping)
+    {
+      AdvanceTicks(std::chrono::steady_clock::now());
+      StartRenewals();
+      if (m_leases.empty())
+      {
+        m_stateChanged.wait(lock);
+      }
+      else
+      {
+        const std::chrono::steady_clock::duration tickInterval = m_options.TickInterval;
+        m_stateChanged.wait_until(
+            lock, m_startTime + tickInterval * static_cast<int64_t>(m_currentTick + 1));
+      }
+    }
+  }
+
+}} // namespace Azure::Storage
@@ -0,0 +1,156 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/internal/parallel_prefetch_stream.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include <azure/core/exception.hpp>
+
+using Azure::Core::Context;
+using Azure::Core::IO::BodyStream;
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  ParallelPrefetchBodyStream::ParallelPrefetchBodyStream(
+      std::unique_ptr<BodyStream> initial,
+      int64_t offset,
+      int64_t length,
+      ParallelPrefetchStreamOptions options,
+      std::function<std::unique_ptr<BodyStream>(int64_t, int64_t, Context const&)> chunkFetcher,
+      Context const& context)
+      : m_initial(std::move(initial)),
+        m_initialRemaining((std::min)(m_initial->Length(), length)), m_length(length),
+        m_options(options), m_chunkFetcher(std::move(chunkFetcher)),
+        m_context(context.WithDeadline((Azure::DateTime::max)())),
+        m_nextFetchOffset(offset + m_initialRemaining), m_end(offset + length)
+  {
+    const int64_t chunkSize = (std::max)(m_options.ChunkSize, int64_t(1));
+    const int64_t numChunks = (m_end - m_nextFetchOffset + chunkSize - 1) / chunkSize;
+    const int64_t numThreads
+        = (std::min)(static_cast<int64_t>((std::max)(m_options.Concurrency, 1)), numChunks);
+    for (int64_t i = 0; i < numThreads; ++i)
+    {
+      m_threads.emplace_back(&ParallelPrefetchBodyStream::FetchChunks, this);
+    }
+  }
+
+  ParallelPrefetchBodyStream::~ParallelPrefetchBodyStream()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopped = true;
+      m_context.Cancel();
+    }
+    m_chunksChanged.notify_all();
+    for (auto& thread : m_threads)
+    {
+      thread.join();
+    }
+  }
+
+  void ParallelPrefetchBodyStream::FetchChunks()
+  {
+    const int64_t chunkSize = (std::max)(m_options.ChunkSize, int64_t(1));
+    const size_t maxChunks = static_cast<size_t>((std::max)(m_options.Concurrency, 1));
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+      m_chunksChanged.wait(lock, [&]() {
+        return m_stopped || m_nextFetchOffset >= m_end || m_chunks.size() < maxChunks;
+      });
+      if (m_stopped || m_nextFetchOffset >= m_end)
+      {
+        return;
+      }
+
+      // The chunk isn't touched by the reader until it's fetched.
+      m_chunks.emplace_back(std::make_unique<Chunk>());
+      Chunk& chunk = *m_chunks.back();
+      chunk.Offset = m_nextFetchOffset;
+      chunk.Length = (std::min)(chunkSize, m_end - m_nextFetchOffset);
+      m_nextFetchOffset += chunk.Length;
+      lock.unlock();
+
+      std::exception_ptr error;
+      try
+      {
+        auto stream = m_chunkFetcher(chunk.Offset, chunk.Length, m_context);
+        chunk.Data = PooledBuffer(m_options.BufferPool, static_cast<size_t>(chunk.Length));
+        const size_t bytesRead
+            = stream->ReadToCount(chunk.Data.GetData(), chunk.Data.GetSize(), m_context);
+        if (bytesRead != chunk.Data.GetSize())
+        {
+          throw Azure::Core::RequestFailedException("Error when reading body stream.");
+        }
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+
+      lock.lock();
+      chunk.Fetched = true;
+      chunk.Error = error;
+      m_chunksChanged.notify_all();
+    }
+  }
+
+  size_t ParallelPrefetchBodyStream::OnRead(uint8_t* buffer, size_t count, Context const& context)
+  {
+    if (m_initialRemaining > 0)
+    {
+      const size_t readSize
+          = static_cast<size_t>((std::min)(static_cast<int64_t>(count), m_initialRemaining));
+      const size_t bytesRead = m_initial->Read(buffer, readSize, context);
+      if (bytesRead == 0)
+      {
+        throw Azure::Core::RequestFailedException("Error when reading body stream.");
+      }
+      m_initialRemaining -= bytesRead;
+      m_position += bytesRead;
+      if (m_initialRemaining == 0)
+      {
+        m_initial.reset();
+      }
+      return bytesRead;
+    }
+    if (m_position >= m_length || count == 0)
+    {
+      return 0;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // Waits in steps, so cancelling the context of the read is noticed while a chunk is fetched.
+    while (m_chunks.empty() || !m_chunks.front()->Fetched)
+    {
+      context.ThrowIfCancelled();
+      m_chunksChanged.wait_for(lock, std::chrono::milliseconds(100));
+    }
+    Chunk& chunk = *m_chunks.front();
+    if (chunk.Error)
+    {
+      std::rethrow_exception(chunk.Error);
+    }
+    lock.unlock();
+
+    const size_t bytesRead = (std::min)(count, chunk.Data.GetSize() - m_chunkReadOffset);
+    std::memcpy(buffer, chunk.Data.GetData() + m_chunkReadOffset, bytesRead);
+    m_chunkReadOffset += bytesRead;
+    m_position += bytesRead;
+
+    if (m_chunkReadOffset == chunk.Data.GetSize())
+    {
+      lock.lock();
+      m_chunks.pop_front();
+      m_chunkReadOffset = 0;
+      lock.unlock();
+      m_chunksChanged.notify_all();
+    }
+    return bytesRead;
+  }
+
+}}} // namespace Azure::Storage::_internal
@@ -3,6 +3,9 @@
 
 #include "azure/storage/common/internal/reliable_stream.hpp"
 
+#include <thread>
+
+#include <azure/core/datetime.hpp>
 #include <azure/core/http/http.hpp>
 
 using Azure::Core::Context;
@@ -12,23 +15,48 @@ namespace Azure { namespace Storage { namespace _internal {
 
   size_t ReliableStream::OnRead(uint8_t* buffer, size_t count, Context const& context)
   {
-    (void)context;
     for (int64_t intent = 1;; intent++)
     {
       // check if we need to get inner stream
       if (this->m_inner == nullptr)
       {
+        // The inner stream was dropped after its last bytes were read, as it was stalled.
+        if (this->m_length >= 0 && this->m_retryOffset >= this->m_length)
+        {
+          return 0;
+        }
         // Get a bodyStream that starts from last known offset
         // if this fails, throw bubbles up
         // As m_inner is unique_pr, it will be destructed on reassignment, cleaning up network
         // session.
         this->m_inner = this->m_streamReconnector(this->m_retryOffset, context);
+        this->m_windowBytes = 0;
+        this->m_windowReadTime = std::chrono::steady_clock::duration::zero();
       }
       try
       {
-        auto const readBytes = this->m_inner->Read(buffer, count, context);
+        size_t readBytes;
+        auto const readStart = std::chrono::steady_clock::now();
+        if (this->m_options.MinBytesPerSecond > 0)
+        {
+          // A read blocked for the whole window is cancelled, and retried on a new connection.
+          readBytes = this->m_inner->Read(
+              buffer,
+              count,
+              context.WithDeadline(
+                  Azure::DateTime(std::chrono::system_clock::now() + m_options.StallWindow)));
+        }
+        else
+        {
+          readBytes = this->m_inner->Read(buffer, count, context);
+        }
         // update offset
         this->m_retryOffset += readBytes;
+        if (IsStalled(readBytes, std::chrono::steady_clock::now() - readStart))
+        {
+          // The next read reconnects from the current offset.
+          this->m_inner.reset();
+        }
         return readBytes;
       }
       catch (std::runtime_error const& e)
@@ -38,12 +66,47 @@ namespace Azure { namespace Storage { namespace _internal {
         // session).
         this->m_inner.reset();
         (void)e; // todo: maybe log the exception in the future?
-        if (intent == this->m_options.MaxRetryRequests)
+        if (intent == this->m_options.MaxRetryRequests || context.IsCancelled())
         {
-          // max retry. End loop. Rethrow
+          // max retry, or cancelled by the caller. End loop. Rethrow
           throw;
         }
       }
+
+      auto retryDelay = this->m_options.RetryDelay;
+      for (int64_t i = 1; i < intent && retryDelay < this->m_options.MaxRetryDelay; ++i)
+      {
+        retryDelay *= 2;
+      }
+      std::this_thread::sleep_for(std::min(retryDelay, this->m_options.MaxRetryDelay));
+    }
+  }
+
+  bool ReliableStream::IsStalled(size_t readBytes, std::chrono::steady_clock::duration readTime)
+  {
+    // Once the reconnections are used up, a slow connection is read to the end.
+    if (this->m_options.MinBytesPerSecond <= 0 || readBytes == 0
+        || this->m_stallReconnects >= this->m_options.MaxRetryRequests)
+    {
+      return false;
+    }
+    // Only the time spent in reads counts, so that a slow consumer isn't taken for a slow
+    // connection.
+    this->m_windowBytes += static_cast<int64_t>(readBytes);
+    this->m_windowReadTime += readTime;
+    if (this->m_windowReadTime < this->m_options.StallWindow)
+    {
+      return false;
+    }
+    auto const windowSeconds = std::chrono::duration<double>(this->m_windowReadTime).count();
+    bool const isStalled = static_cast<double>(this->m_windowBytes)
+        < static_cast<double>(this->m_options.MinBytesPerSecond) * windowSeconds;
+    this->m_windowBytes = 0;
+    this->m_windowReadTime = std::chrono::steady_clock::duration::zero();
+    if (isStalled)
+    {
+      ++this->m_stallReconnects;
     }
+    return isStalled;
   }
 }}} // namespace Azure::Storage::_internal
@@ -5,6 +5,9 @@
 
 #include <algorithm>
 #include <cctype>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <azure/core/http/http.hpp>
 #include <azure/core/internal/strings.hpp>
@@ -13,29 +16,61 @@
 
 namespace Azure { namespace Storage { namespace _internal {
 
+  namespace {
+    // Decodes a query parameter into the existing buffer of decodedValue. The parameters without
+    // escapes, which are most of them, are copied without allocating.
+    void DecodeQueryParameter(const std::string& value, bool toLower, std::string& decodedValue)
+    {
+      if (value.find_first_of("%+") != std::string::npos)
+      {
+        decodedValue = Azure::Core::Url::Decode(
+            toLower ? Azure::Core::_internal::StringExtensions::ToLower(value) : value);
+        return;
+      }
+      decodedValue.assign(value);
+      if (toLower)
+      {
+        for (auto& c : decodedValue)
+        {
+          c = static_cast<char>(
+              Azure::Core::_internal::StringExtensions::ToLower(static_cast<unsigned char>(c)));
+        }
+      }
+    }
+  } // namespace
+
   std::string SharedKeyPolicy::GetSignature(const Core::Http::Request& request) const
   {
-    std::string string_to_sign;
-    string_to_sign += request.GetMethod().ToString() + "\n";
+    // The string to sign is built in a buffer reused by the requests signed on this thread, so
+    // that it doesn't need to grow again for every request.
+    thread_local std::string string_to_sign;
+    string_to_sign.clear();
+    string_to_sign += request.GetMethod().ToString();
+    string_to_sign += '\n';
+
+    // Request header names are lowercase.
+    static const std::string HeaderNames[] = {
+        "content-encoding",
+        "content-language",
+        "content-length",
+        "content-md5",
+        "content-type",
+        "date",
+        "if-modified-since",
+        "if-match",
+        "if-none-match",
+        "if-unmodified-since",
+        "range",
+    };
+    static const std::string& ContentLengthHeaderName = HeaderNames[2];
 
-    const auto& headers = request.GetHeaders();
-    for (std::string headerName :
-         {"Content-Encoding",
-          "Content-Language",
-          "Content-Length",
-          "Content-MD5",
-          "Content-Type",
-          "Date",
-          "If-Modified-Since",
-          "If-Match",
-          "If-None-Match",
-          "If-Unmodified-Since",
-          "Range"})
+    const auto& headers = request.GetHeadersReference();
+    for (const auto& headerName : HeaderNames)
     {
-      auto ite = headers.find(Azure::Core::_internal::StringExtensions::ToLower(headerName));
+      auto ite = headers.find(headerName);
       if (ite != headers.end())
       {
-        if (headerName == "Content-Length" && ite->second == "0")
+        if (&headerName == &ContentLengthHeaderName && ite->second == "0")
         {
           // do nothing
         }
@@ -44,45 +79,61 @@ namespace Azure { namespace Storage { namespace _internal {
           string_to_sign += ite->second;
         }
       }
-      string_to_sign += "\n";
+      string_to_sign += '\n';
     }
 
     // canonicalized headers
+    // The header map orders its keys case-insensitively, which is the order of their lowercase
+    // forms, so they don't need to be sorted again.
     const std::string prefix = "x-ms-";
-    std::vector<std::pair<std::string, std::string>> ordered_kv;
     for (auto ite = headers.lower_bound(prefix);
-         ite != headers.end() && ite->first.substr(0, prefix.length()) == prefix;
+         ite != headers.end() && ite->first.compare(0, prefix.length(), prefix) == 0;
          ++ite)
     {
-      std::string key = Azure::Core::_internal::StringExtensions::ToLower(ite->first);
-      ordered_kv.emplace_back(std::make_pair(std::move(key), ite->second));
-    }
-    std::sort(ordered_kv.begin(), ordered_kv.end());
-    for (const auto& p : ordered_kv)
-    {
-      string_to_sign += p.first + ":" + p.second + "\n";
+      for (char c : ite->first)
+      {
+        string_to_sign += static_cast<char>(
+            Azure::Core::_internal::StringExtensions::ToLower(static_cast<unsigned char>(c)));
+      }
+      string_to_sign += ':';
+      string_to_sign += ite->second;
+      string_to_sign += '\n';
     }
-    ordered_kv.clear();
 
     // canonicalized resource
-    string_to_sign += "/" + m_credential->AccountName + "/" + request.GetUrl().GetPath() + "\n";
-    for (const auto& query : request.GetUrl().GetQueryParameters())
+    string_to_sign += '/';
+    string_to_sign += m_credential->AccountName;
+    string_to_sign += '/';
+    string_to_sign += request.GetUrl().GetPath();
+    string_to_sign += '\n';
+    // The decoded query parameters are also kept for the next requests, so that their strings
+    // keep their capacity.
+    thread_local std::vector<std::pair<std::string, std::string>> ordered_kv;
+    const auto& queryParameters = request.GetUrl().GetQueryParameters();
+    if (ordered_kv.size() < queryParameters.size())
+    {
+      ordered_kv.resize(queryParameters.size());
+    }
+    auto ordered_end = ordered_kv.begin();
+    for (const auto& query : queryParameters)
     {
-      std::string key = Azure::Core::_internal::StringExtensions::ToLower(query.first);
-      ordered_kv.emplace_back(
-          std::make_pair(Azure::Core::Url::Decode(key), Azure::Core::Url::Decode(query.second)));
+      DecodeQueryParameter(query.first, true, ordered_end->first);
+      DecodeQueryParameter(query.second, false, ordered_end->second);
+      ++ordered_end;
     }
-    std::sort(ordered_kv.begin(), ordered_kv.end());
-    for (const auto& p : ordered_kv)
+    std::sort(ordered_kv.begin(), ordered_end);
+    for (auto ite = ordered_kv.begin(); ite != ordered_end; ++ite)
     {
-      string_to_sign += p.first + ":" + p.second + "\n";
+      string_to_sign += ite->first;
+      string_to_sign += ':';
+      string_to_sign += ite->second;
+      string_to_sign += '\n';
     }
 
     // remove last linebreak
     string_to_sign.pop_back();
 
-    return Azure::Core::Convert::Base64Encode(_internal::HmacSha256(
-        std::vector<uint8_t>(string_to_sign.begin(), string_to_sign.end()),
-        Azure::Core::Convert::Base64Decode(m_credential->GetAccountKey())));
+    return Azure::Core::Convert::Base64Encode(m_credential->GetSigningContext()->Sign(
+        reinterpret_cast<const uint8_t*>(string_to_sign.data()), string_to_sign.length()));
   }
 }}} // namespace Azure::Storage::_internal
@@ -42,7 +42,7 @@ namespace Azure { namespace Storage {
       if (response->GetHeaders().at(_internal::HttpHeaderContentType).find("xml")
           != std::string::npos)
       {
-        auto xmlReader = _internal::XmlReader(
+        _internal::XmlReader xmlReader(
             reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
 
         enum class XmlTagName
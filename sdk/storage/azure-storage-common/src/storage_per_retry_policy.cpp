@@ -8,44 +8,76 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <string>
+#include <utility>
 
 namespace Azure { namespace Storage { namespace _internal {
 
+  namespace {
+    void PrepareAttempt(Core::Http::Request& request, Core::Context const& context)
+    {
+      const char* HttpHeaderDate = "Date";
+      const char* HttpHeaderXMsDate = "x-ms-date";
+
+      const auto& headers = request.GetHeadersReference();
+      if (headers.find(HttpHeaderDate) == headers.end())
+      {
+        // add x-ms-date header in RFC1123 format
+        request.SetHeader(
+            HttpHeaderXMsDate,
+            DateTime(std::chrono::system_clock::now())
+                .ToString(Azure::DateTime::DateFormat::Rfc1123));
+      }
+
+      // The remaining time before the deadline is sent as the server timeout of each attempt, so
+      // the service stops working on a request the client no longer waits for. A timeout set by
+      // the caller is kept if it's shorter. The timeout of the previous attempt is never shorter
+      // than the one set by the caller, nor than the remaining time, so keeping the shorter one
+      // is right on retries too.
+      const char* HttpQueryTimeout = "timeout";
+      auto cancelTimepoint = context.GetDeadline();
+      if (cancelTimepoint == Azure::DateTime::max())
+      {
+        return;
+      }
+      auto currentTimepoint = std::chrono::system_clock::now();
+      int64_t numSeconds = std::max(
+          std::chrono::duration_cast<std::chrono::seconds>(
+              std::chrono::system_clock::time_point(cancelTimepoint) - currentTimepoint)
+              .count(),
+          int64_t(1));
+      const auto& queryParameters = request.GetUrl().GetQueryParameters();
+      auto timeoutIterator = queryParameters.find(HttpQueryTimeout);
+      if (timeoutIterator != queryParameters.end())
+      {
+        const int64_t timeout = std::strtoll(timeoutIterator->second.data(), nullptr, 10);
+        if (timeout > 0 && timeout <= numSeconds)
+        {
+          return;
+        }
+      }
+      request.GetUrl().AppendQueryParameter(HttpQueryTimeout, std::to_string(numSeconds));
+    }
+  } // namespace
+
   std::unique_ptr<Core::Http::RawResponse> StoragePerRetryPolicy::Send(
       Core::Http::Request& request,
       Core::Http::Policies::NextHttpPolicy nextPolicy,
       Core::Context const& context) const
   {
-    const char* HttpHeaderDate = "Date";
-    const char* HttpHeaderXMsDate = "x-ms-date";
-
-    const auto& headers = request.GetHeaders();
-    if (headers.find(HttpHeaderDate) == headers.end())
-    {
-      // add x-ms-date header in RFC1123 format
-      request.SetHeader(
-          HttpHeaderXMsDate,
-          DateTime(std::chrono::system_clock::now())
-              .ToString(Azure::DateTime::DateFormat::Rfc1123));
-    }
-
-    const char* HttpHeaderTimeout = "timeout";
-    auto cancelTimepoint = context.GetDeadline();
-    if (cancelTimepoint == Azure::DateTime::max())
-    {
-      request.GetUrl().RemoveQueryParameter(HttpHeaderTimeout);
-    }
-    else
-    {
-      auto currentTimepoint = std::chrono::system_clock::now();
-      int64_t numSeconds
-          = std::chrono::duration_cast<std::chrono::seconds>(
-                std::chrono::system_clock::time_point(cancelTimepoint) - currentTimepoint)
-                .count();
-      request.GetUrl().AppendQueryParameter(
-          HttpHeaderTimeout, std::to_string(std::max(numSeconds, int64_t(1))));
-    }
+    PrepareAttempt(request, context);
     return nextPolicy.Send(request, context);
   }
 
+  void StoragePerRetryPolicy::SendAsync(
+      Core::Http::Request& request,
+      Core::Http::Policies::NextHttpPolicy nextPolicy,
+      Core::Context const& context,
+      Core::Http::SendCompletionCallback callback) const
+  {
+    PrepareAttempt(request, context);
+    nextPolicy.SendAsync(request, context, std::move(callback));
+  }
+
 }}} // namespace Azure::Storage::_internal
@@ -7,6 +7,49 @@ namespace Azure { namespace Storage { namespace _internal {
 
   Azure::Core::Context::Key const SecondaryHostReplicaStatusKey;
 
+  namespace {
+    bool IsPrimaryHostFailure(Azure::Core::Http::HttpStatusCode statusCode)
+    {
+      using Azure::Core::Http::HttpStatusCode;
+      return statusCode == HttpStatusCode::RequestTimeout
+          || statusCode == HttpStatusCode::InternalServerError
+          || statusCode == HttpStatusCode::BadGateway
+          || statusCode == HttpStatusCode::ServiceUnavailable
+          || statusCode == HttpStatusCode::GatewayTimeout;
+    }
+  } // namespace
+
+  std::unique_ptr<Azure::Core::Http::RawResponse> StorageSwitchToSecondaryPolicy::SendToHost(
+      Azure::Core::Http::Request& request,
+      Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
+      const Azure::Core::Context& context) const
+  {
+    if (!m_endpointHealthTracker || request.GetUrl().GetHost() != m_primaryHost)
+    {
+      return nextPolicy.Send(request, context);
+    }
+
+    std::unique_ptr<Azure::Core::Http::RawResponse> response;
+    try
+    {
+      response = nextPolicy.Send(request, context);
+    }
+    catch (Azure::Core::Http::TransportException&)
+    {
+      m_endpointHealthTracker->ReportFailure(m_primaryHost);
+      throw;
+    }
+    if (IsPrimaryHostFailure(response->GetStatusCode()))
+    {
+      m_endpointHealthTracker->ReportFailure(m_primaryHost);
+    }
+    else
+    {
+      m_endpointHealthTracker->ReportSuccess(m_primaryHost);
+    }
+    return response;
+  }
+
   std::unique_ptr<Azure::Core::Http::RawResponse> StorageSwitchToSecondaryPolicy::Send(
       Azure::Core::Http::Request& request,
       Azure::Core::Http::Policies::NextHttpPolicy nextPolicy,
@@ -19,8 +62,20 @@ namespace Azure { namespace Storage { namespace _internal {
                               || request.GetMethod() == Azure::Core::Http::HttpMethod::Head)
         && !m_secondaryHost.empty() && replicaStatus && *replicaStatus;
 
-    if (considerSecondary
-        && Azure::Core::Http::Policies::_internal::RetryPolicy::GetRetryCount(context) > 0)
+    // The copy of a hedged request is sent to the other host than the request itself.
+    bool const isRetry
+        = Azure::Core::Http::Policies::_internal::RetryPolicy::GetRetryCount(context) > 0;
+    bool const isHedgedTry
+        = Azure::Core::Http::Policies::_internal::HedgingPolicy::IsHedgedTry(context);
+    bool switchHost = isRetry != isHedgedTry;
+    // While the primary host is unhealthy, the first try is sent to the secondary host, and the
+    // retries alternate from there.
+    if (considerSecondary && !isRetry && m_endpointHealthTracker
+        && !m_endpointHealthTracker->IsAvailable(m_primaryHost))
+    {
+      switchHost = !switchHost;
+    }
+    if (considerSecondary && switchHost)
     {
       // switch host
       if (request.GetUrl().GetHost() == m_primaryHost)
@@ -33,7 +88,7 @@ namespace Azure { namespace Storage { namespace _internal {
       }
     }
 
-    auto response = nextPolicy.Send(request, context);
+    auto response = SendToHost(request, nextPolicy, context);
 
     if (considerSecondary
         && (response->GetStatusCode() == Azure::Core::Http::HttpStatusCode::NotFound
@@ -43,7 +98,7 @@ namespace Azure { namespace Storage { namespace _internal {
       *replicaStatus = false;
       // switch back
       request.GetUrl().SetHost(m_primaryHost);
-      response = nextPolicy.Send(request, context);
+      response = SendToHost(request, nextPolicy, context);
     }
 
     return response;
@@ -0,0 +1,216 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/internal/thread_pool.hpp"
+
+#include <azure/core/platform.hpp>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(AZ_PLATFORM_WINDOWS)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  namespace {
+    // The pool and the queue of the calling thread, when it belongs to a pool.
+    thread_local ThreadPool const* CurrentPool = nullptr;
+    thread_local size_t CurrentWorkerIndex = 0;
+
+    // Restricts the calling thread to the CPUs of cpuAffinity. The thread keeps running anywhere
+    // if none of them can be set.
+    void SetCurrentThreadAffinity(const std::vector<int>& cpuAffinity)
+    {
+#if defined(__linux__)
+      cpu_set_t cpuSet;
+      CPU_ZERO(&cpuSet);
+      bool isAnySet = false;
+      for (auto cpu : cpuAffinity)
+      {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+        {
+          CPU_SET(cpu, &cpuSet);
+          isAnySet = true;
+        }
+      }
+      if (isAnySet)
+      {
+        pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+      }
+#elif defined(AZ_PLATFORM_WINDOWS)
+      DWORD_PTR mask = 0;
+      for (auto cpu : cpuAffinity)
+      {
+        if (cpu >= 0 && cpu < static_cast<int>(sizeof(mask) * 8))
+        {
+          mask |= DWORD_PTR(1) << cpu;
+        }
+      }
+      if (mask != 0)
+      {
+        SetThreadAffinityMask(GetCurrentThread(), mask);
+      }
+#else
+      (void)cpuAffinity;
+#endif
+    }
+  } // namespace
+
+  ThreadPool::ThreadPool(size_t maxThreads, std::vector<int> cpuAffinity)
+      : m_cpuAffinity(std::move(cpuAffinity))
+  {
+    maxThreads = (std::max)(maxThreads, static_cast<size_t>(1));
+    m_workers.reserve(maxThreads);
+    for (size_t i = 0; i < maxThreads; ++i)
+    {
+      m_workers.emplace_back(std::make_unique<Worker>());
+    }
+  }
+
+  ThreadPool::~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_taskAvailable.notify_all();
+    for (auto& thread : m_threads)
+    {
+      thread.join();
+    }
+  }
+
+  void ThreadPool::Submit(std::function<void()> task)
+  {
+    auto const workerIndex = CurrentPool == this
+        ? CurrentWorkerIndex
+        : m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+    {
+      auto& worker = *m_workers[workerIndex];
+      std::lock_guard<std::mutex> workerLock(worker.Mutex);
+      worker.Tasks.emplace_back(std::move(task));
+    }
+    ++m_queuedTasks;
+
+    if (m_idleThreads != 0)
+    {
+      // Notified under the lock, a thread can't be between checking the tasks and waiting.
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_taskAvailable.notify_one();
+    }
+    else if (m_numThreads.load(std::memory_order_relaxed) < m_workers.size())
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_threads.size() < m_workers.size())
+      {
+        m_threads.emplace_back(&ThreadPool::Run, this, m_threads.size());
+        ++m_numThreads;
+      }
+    }
+  }
+
+  bool ThreadPool::TryClaimTask()
+  {
+    size_t queuedTasks = m_queuedTasks.load();
+    while (queuedTasks != 0)
+    {
+      if (m_queuedTasks.compare_exchange_weak(queuedTasks, queuedTasks - 1))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ThreadPool::TryGetTask(size_t workerIndex, std::function<void()>& task)
+  {
+    {
+      auto& worker = *m_workers[workerIndex];
+      std::lock_guard<std::mutex> workerLock(worker.Mutex);
+      if (!worker.Tasks.empty())
+      {
+        task = std::move(worker.Tasks.back());
+        worker.Tasks.pop_back();
+        return true;
+      }
+    }
+
+    for (size_t i = 1; i < m_workers.size(); ++i)
+    {
+      auto& worker = *m_workers[(workerIndex + i) % m_workers.size()];
+      std::lock_guard<std::mutex> workerLock(worker.Mutex);
+      if (!worker.Tasks.empty())
+      {
+        task = std::move(worker.Tasks.front());
+        worker.Tasks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void ThreadPool::Run(size_t workerIndex)
+  {
+    CurrentPool = this;
+    CurrentWorkerIndex = workerIndex;
+    if (!m_cpuAffinity.empty())
+    {
+      SetCurrentThreadAffinity(m_cpuAffinity);
+    }
+
+    while (true)
+    {
+      if (!TryClaimTask())
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        ++m_idleThreads;
+        m_taskAvailable.wait(lock, [this]() { return m_queuedTasks != 0 || m_stop; });
+        --m_idleThreads;
+        if (m_stop && m_queuedTasks == 0)
+        {
+          // Stopping, and all the tasks have been run.
+          return;
+        }
+        continue;
+      }
+
+      // One of the queued tasks was claimed. It's in one of the queues, even if another thread
+      // takes the one just queued to this thread.
+      std::function<void()> task;
+      while (!TryGetTask(workerIndex, task))
+      {
+        std::this_thread::yield();
+      }
+      try
+      {
+        task();
+      }
+      catch (...)
+      {
+      }
+    }
+  }
+
+  ThreadPool& ThreadPool::GetDefault()
+  {
+    // Never destroyed, so the transfers still running when the process exits don't join threads
+    // from a static destructor.
+    static ThreadPool* pool = new ThreadPool((std::max)(
+        static_cast<size_t>(8), static_cast<size_t>(std::thread::hardware_concurrency()) * 2));
+    return *pool;
+  }
+
+}}} // namespace Azure::Storage::_internal
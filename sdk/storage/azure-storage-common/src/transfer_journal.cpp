@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/transfer_journal.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace Azure { namespace Storage {
+
+  namespace {
+    const std::string ChunkRecordPrefix = "chunk ";
+  } // namespace
+
+  FileTransferJournal::FileTransferJournal(std::string fileName) : m_fileName(std::move(fileName))
+  {
+  }
+
+  std::vector<std::string> FileTransferJournal::ReadRecords()
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    std::vector<std::string> records;
+    std::ifstream file(m_fileName, std::ios::in | std::ios::binary);
+    std::string content(
+        (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    // A line cut short by a crash has no line break, and isn't a complete record.
+    for (size_t begin = 0, end; (end = content.find('\n', begin)) != std::string::npos;
+         begin = end + 1)
+    {
+      records.push_back(content.substr(begin, end - begin));
+    }
+    return records;
+  }
+
+  void FileTransferJournal::AppendRecord(const std::string& record)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    std::ofstream file(m_fileName, std::ios::out | std::ios::app);
+    file << record << '\n';
+    file.flush();
+    if (!file)
+    {
+      throw std::runtime_error("Failed to write transfer journal " + m_fileName + ".");
+    }
+  }
+
+  void FileTransferJournal::Clear()
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    std::remove(m_fileName.data());
+  }
+
+  namespace _internal {
+
+    TransferProgress::TransferProgress(
+        std::shared_ptr<TransferJournal> journal,
+        std::string transfer)
+        : m_journal(std::move(journal))
+    {
+      if (!m_journal)
+      {
+        return;
+      }
+      auto records = m_journal->ReadRecords();
+      if (!records.empty() && records[0] == transfer)
+      {
+        for (size_t i = 1; i < records.size(); ++i)
+        {
+          if (records[i].compare(0, ChunkRecordPrefix.length(), ChunkRecordPrefix) == 0)
+          {
+            m_chunksDone.insert(std::stoll(records[i].substr(ChunkRecordPrefix.length())));
+          }
+        }
+        return;
+      }
+      m_journal->Clear();
+      m_journal->AppendRecord(transfer);
+    }
+
+    void TransferProgress::OnChunkDone(int64_t chunkId)
+    {
+      if (m_journal)
+      {
+        m_journal->AppendRecord(ChunkRecordPrefix + std::to_string(chunkId));
+      }
+    }
+
+    void TransferProgress::OnTransferDone()
+    {
+      if (m_journal)
+      {
+        m_journal->Clear();
+      }
+    }
+
+  } // namespace _internal
+
+}} // namespace Azure::Storage
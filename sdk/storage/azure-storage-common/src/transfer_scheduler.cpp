@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/transfer_scheduler.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace Azure { namespace Storage {
+
+  TransferScheduler::TransferScheduler(TransferSchedulerOptions options)
+      : m_options(std::move(options)),
+        m_availableBytes(static_cast<double>((std::max)(m_options.MaxBytesPerSecond, int64_t(0)))),
+        m_lastRefill(std::chrono::steady_clock::now())
+  {
+  }
+
+  void TransferScheduler::Acquire(
+      const void* operation,
+      int64_t chunkSize,
+      Azure::Core::Http::RequestPriority priority)
+  {
+    std::chrono::steady_clock::duration delay;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      Waiter waiter;
+      waiter.Operation = operation;
+      waiter.Priority = priority;
+      m_waiters.push_back(&waiter);
+      GrantSlots();
+      m_slotGranted.wait(lock, [&waiter]() { return waiter.Granted; });
+      delay = ConsumeBytes(chunkSize);
+    }
+    // The slot is held while waiting for the bandwidth budget, so the chunks over budget don't let
+    // other chunks start in the meantime.
+    if (delay > std::chrono::steady_clock::duration::zero())
+    {
+      std::this_thread::sleep_for(delay);
+    }
+  }
+
+  void TransferScheduler::Release(const void* operation)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_chunksInFlight;
+    auto ite = m_operationChunks.find(operation);
+    if (--ite->second == 0)
+    {
+      m_operationChunks.erase(ite);
+    }
+    GrantSlots();
+  }
+
+  void TransferScheduler::GrantSlots()
+  {
+    bool granted = false;
+    while (!m_waiters.empty()
+           && (m_options.MaxConcurrentChunks <= 0
+               || m_chunksInFlight < m_options.MaxConcurrentChunks))
+    {
+      // Of the waiters with the highest priority, the first of the operation with the fewest
+      // chunks in flight.
+      auto next = m_waiters.end();
+      int32_t nextChunks = 0;
+      for (auto ite = m_waiters.begin(); ite != m_waiters.end(); ++ite)
+      {
+        auto operationChunks = m_operationChunks.find((*ite)->Operation);
+        int32_t chunks = operationChunks == m_operationChunks.end() ? 0 : operationChunks->second;
+        if (next == m_waiters.end() || (*ite)->Priority > (*next)->Priority
+            || ((*ite)->Priority == (*next)->Priority && chunks < nextChunks))
+        {
+          next = ite;
+          nextChunks = chunks;
+        }
+        if (nextChunks == 0 && (*next)->Priority == Azure::Core::Http::RequestPriority::High)
+        {
+          break;
+        }
+      }
+
+      // The slots reserved for the high priority are left free for the next ones.
+      if ((*next)->Priority != Azure::Core::Http::RequestPriority::High
+          && m_options.MaxConcurrentChunks > 0
+          && m_chunksInFlight >= (std::max)(
+                 m_options.MaxConcurrentChunks - m_options.HighPriorityReservedChunks, 1))
+      {
+        break;
+      }
+
+      (*next)->Granted = true;
+      ++m_chunksInFlight;
+      ++m_operationChunks[(*next)->Operation];
+      m_waiters.erase(next);
+      granted = true;
+    }
+    if (granted)
+    {
+      m_slotGranted.notify_all();
+    }
+  }
+
+  std::chrono::steady_clock::duration TransferScheduler::ConsumeBytes(int64_t chunkSize)
+  {
+    if (m_options.MaxBytesPerSecond <= 0)
+    {
+      return std::chrono::steady_clock::duration::zero();
+    }
+
+    // Token bucket holding up to one second worth of bytes.
+    const auto bytesPerSecond = static_cast<double>(m_options.MaxBytesPerSecond);
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed = now - m_lastRefill;
+    m_lastRefill = now;
+    m_availableBytes
+        = (std::min)(bytesPerSecond, m_availableBytes + elapsed.count() * bytesPerSecond);
+    m_availableBytes -= static_cast<double>(chunkSize);
+    if (m_availableBytes >= 0.0)
+    {
+      return std::chrono::steady_clock::duration::zero();
+    }
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(-m_availableBytes / bytesPerSecond));
+  }
+
+}} // namespace Azure::Storage
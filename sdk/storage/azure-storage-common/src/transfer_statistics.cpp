@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/transfer_statistics.hpp"
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  TransferStatistics TransferCounters::GetStatistics() const
+  {
+    TransferStatistics statistics;
+    statistics.BytesDownloaded = BytesDownloaded.load(std::memory_order_relaxed);
+    statistics.BytesUploaded = BytesUploaded.load(std::memory_order_relaxed);
+    statistics.DownloadsCompleted = DownloadsCompleted.load(std::memory_order_relaxed);
+    statistics.UploadsCompleted = UploadsCompleted.load(std::memory_order_relaxed);
+    return statistics;
+  }
+
+  TransferProgressReporter::TransferProgressReporter(
+      std::shared_ptr<TransferCounters> counters,
+      bool isUpload,
+      std::function<void(int64_t, int64_t)> handler,
+      std::chrono::milliseconds interval)
+      : m_counters(std::move(counters)), m_isUpload(isUpload), m_handler(std::move(handler)),
+        m_interval(interval),
+        m_nextReport((std::chrono::steady_clock::now() + m_interval).time_since_epoch().count())
+  {
+  }
+
+  void TransferProgressReporter::OnBytesTransferred(int64_t bytes)
+  {
+    m_bytesTransferred.fetch_add(bytes, std::memory_order_relaxed);
+    if (m_counters)
+    {
+      (m_isUpload ? m_counters->BytesUploaded : m_counters->BytesDownloaded)
+          .fetch_add(bytes, std::memory_order_relaxed);
+    }
+    if (!m_handler)
+    {
+      return;
+    }
+    // The thread which moves the due time forward is the one calling the handler.
+    const auto now = std::chrono::steady_clock::now();
+    auto nextReport = m_nextReport.load(std::memory_order_relaxed);
+    if (now.time_since_epoch().count() < nextReport
+        || !m_nextReport.compare_exchange_strong(
+            nextReport, (now + m_interval).time_since_epoch().count(), std::memory_order_relaxed))
+    {
+      return;
+    }
+    Report();
+  }
+
+  void TransferProgressReporter::OnTransferDone()
+  {
+    if (m_counters)
+    {
+      (m_isUpload ? m_counters->UploadsCompleted : m_counters->DownloadsCompleted)
+          .fetch_add(1, std::memory_order_relaxed);
+    }
+    if (m_totalBytes.load(std::memory_order_relaxed) < 0)
+    {
+      SetTotalBytes(m_bytesTransferred.load(std::memory_order_relaxed));
+    }
+    if (m_handler)
+    {
+      Report();
+    }
+  }
+
+  void TransferProgressReporter::Report()
+  {
+    // The bytes are read under the lock, so the handler sees them increasing.
+    std::lock_guard<std::mutex> lock(m_reportMutex);
+    m_handler(
+        m_bytesTransferred.load(std::memory_order_relaxed),
+        m_totalBytes.load(std::memory_order_relaxed));
+  }
+
+}}} // namespace Azure::Storage::_internal
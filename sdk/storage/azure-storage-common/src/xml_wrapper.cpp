@@ -3,6 +3,7 @@
 
 #include "azure/storage/common/internal/xml_wrapper.hpp"
 
+#include <exception>
 #include <limits>
 #include <stdexcept>
 
@@ -35,6 +36,60 @@ namespace Azure { namespace Storage { namespace _internal {
     }
   }
 
+  struct XmlReader::StreamSource final
+  {
+    StreamSource(Azure::Core::IO::BodyStream& stream, const Azure::Core::Context& context)
+        : Stream(stream), Context(context)
+    {
+    }
+
+    Azure::Core::IO::BodyStream& Stream;
+    Azure::Core::Context Context;
+    // Exceptions can't go through libxml2, they are rethrown once it fails.
+    std::exception_ptr Exception;
+
+    static int Read(void* source, char* buffer, int length)
+    {
+      auto streamSource = static_cast<StreamSource*>(source);
+      try
+      {
+        return static_cast<int>(streamSource->Stream.Read(
+            reinterpret_cast<uint8_t*>(buffer),
+            static_cast<size_t>(length),
+            streamSource->Context));
+      }
+      catch (...)
+      {
+        streamSource->Exception = std::current_exception();
+        return -1;
+      }
+    }
+
+    static int Close(void*) { return 0; }
+
+    void RethrowException() const
+    {
+      if (Exception)
+      {
+        std::rethrow_exception(Exception);
+      }
+    }
+  };
+
+  XmlReader::XmlReader(Azure::Core::IO::BodyStream& stream, const Azure::Core::Context& context)
+      : m_streamSource(std::make_unique<StreamSource>(stream, context))
+  {
+    XmlGlobalInitialize();
+
+    m_reader = xmlReaderForIO(
+        &StreamSource::Read, &StreamSource::Close, m_streamSource.get(), nullptr, nullptr, 0);
+    if (!m_reader)
+    {
+      m_streamSource->RethrowException();
+      throw std::runtime_error("Failed to parse xml.");
+    }
+  }
+
   XmlReader::~XmlReader() { xmlFreeTextReader(static_cast<xmlTextReaderPtr>(m_reader)); }
 
   XmlNode XmlReader::Read()
@@ -66,6 +121,10 @@ namespace Azure { namespace Storage { namespace _internal {
     }
     if (ret != 1)
     {
+      if (m_streamSource)
+      {
+        m_streamSource->RethrowException();
+      }
       throw std::runtime_error("Failed to parse xml.");
     }
 
@@ -98,7 +157,7 @@ namespace Azure { namespace Storage { namespace _internal {
     {
       if (has_value)
       {
-        return XmlNode{XmlNodeType::Text, std::string(), value};
+        return XmlNode{XmlNodeType::Text, XmlString(), value};
       }
     }
     else if (type == XML_READER_TYPE_SIGNIFICANT_WHITESPACE)
@@ -177,6 +236,19 @@ namespace Azure { namespace Storage { namespace _internal {
     }
   }
 
+  void XmlWriter::WriteBase64(const uint8_t* data, size_t length)
+  {
+    if (length > static_cast<size_t>(std::numeric_limits<int>::max()))
+    {
+      throw std::invalid_argument("Data is too large to be written as Base64.");
+    }
+    xmlTextWriterWriteBase64(
+        static_cast<xmlTextWriterPtr>(m_writer),
+        reinterpret_cast<const char*>(data),
+        0,
+        static_cast<int>(length));
+  }
+
   std::string XmlWriter::GetDocument()
   {
     xmlTextWriterPtr writer = static_cast<xmlTextWriterPtr>(m_writer);
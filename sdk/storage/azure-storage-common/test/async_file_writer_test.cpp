@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/internal/async_file_writer.hpp>
+#include <azure/storage/common/internal/file_io.hpp>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(AsyncFileWriterTest, ConcurrentWrites)
+  {
+    const size_t fileSize = 8 * 1024 * 1024 + 1234;
+    const std::vector<uint8_t> content = RandomBuffer(fileSize);
+    for (bool unbuffered : {false, true})
+    {
+      const std::string filename = RandomString();
+      {
+        _internal::FileWriter fileWriter(filename, unbuffered);
+        _internal::AsyncFileWriter asyncFileWriter(fileWriter, 64 * 1024, 4);
+        const size_t bufferSize = asyncFileWriter.GetBufferSize();
+        // Each thread writes every fourth piece, the pieces before an aligned offset are short.
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < 4; ++t)
+        {
+          threads.emplace_back([&, t]() {
+            for (size_t offset = t * bufferSize; offset < fileSize; offset += 4 * bufferSize)
+            {
+              const size_t length
+                  = std::min(bufferSize - (offset == 0 ? 100 : 0), fileSize - offset);
+              uint8_t* buffer = asyncFileWriter.AcquireBuffer();
+              std::copy(
+                  content.begin() + static_cast<ptrdiff_t>(offset),
+                  content.begin() + static_cast<ptrdiff_t>(offset + length),
+                  buffer);
+              asyncFileWriter.Write(buffer, length, static_cast<int64_t>(offset));
+            }
+          });
+        }
+        for (auto& thread : threads)
+        {
+          thread.join();
+        }
+        // The first piece is short, its remaining bytes go last.
+        uint8_t* buffer = asyncFileWriter.AcquireBuffer();
+        std::copy(
+            content.begin() + static_cast<ptrdiff_t>(bufferSize - 100),
+            content.begin() + static_cast<ptrdiff_t>(bufferSize),
+            buffer);
+        asyncFileWriter.Write(buffer, 100, static_cast<int64_t>(bufferSize - 100));
+        asyncFileWriter.Flush();
+      }
+      EXPECT_EQ(ReadFile(filename), content);
+      DeleteFile(filename);
+    }
+  }
+
+}}} // namespace Azure::Storage::Test
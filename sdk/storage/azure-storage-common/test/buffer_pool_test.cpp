@@ -0,0 +1,262 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/buffer_pool.hpp>
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
+#include <azure/storage/common/internal/file_io.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(BufferPoolTest, ReusesBuffers)
+  {
+    auto pool = std::make_shared<BufferPool>();
+    uint8_t* data = nullptr;
+    {
+      _internal::PooledBuffer buffer(pool, 100000);
+      EXPECT_EQ(buffer.GetSize(), 100000U);
+      EXPECT_EQ(
+          reinterpret_cast<uintptr_t>(buffer.GetData()) % _internal::UnbufferedFileIoAlignment, 0U);
+      std::memset(buffer.GetData(), 0xab, buffer.GetSize());
+      data = buffer.GetData();
+      EXPECT_EQ(pool->GetPooledBytes(), 0);
+    }
+    // Rounded up to 128KiB.
+    EXPECT_EQ(pool->GetPooledBytes(), 128 * 1024);
+    {
+      _internal::PooledBuffer buffer(pool, 128 * 1024);
+      EXPECT_EQ(buffer.GetData(), data);
+      EXPECT_EQ(pool->GetPooledBytes(), 0);
+
+      _internal::PooledBuffer moved(std::move(buffer));
+      EXPECT_EQ(moved.GetData(), data);
+      EXPECT_EQ(buffer.GetData(), nullptr);
+      EXPECT_EQ(buffer.GetSize(), 0U);
+    }
+    EXPECT_EQ(pool->GetPooledBytes(), 128 * 1024);
+    {
+      // Another size class.
+      _internal::PooledBuffer buffer(pool, 128 * 1024 + 1);
+      EXPECT_NE(buffer.GetData(), data);
+    }
+    EXPECT_EQ(pool->GetPooledBytes(), 384 * 1024);
+  }
+
+  TEST(BufferPoolTest, MaxPooledBytes)
+  {
+    BufferPoolOptions options;
+    options.MaxPooledBytes = 256 * 1024;
+    auto pool = std::make_shared<BufferPool>(options);
+    {
+      std::vector<_internal::PooledBuffer> buffers;
+      for (int i = 0; i < 4; ++i)
+      {
+        buffers.emplace_back(pool, 64 * 1024);
+        buffers.emplace_back(pool, 64 * 1024 + 1);
+      }
+    }
+    EXPECT_LE(pool->GetPooledBytes(), options.MaxPooledBytes);
+    EXPECT_GT(pool->GetPooledBytes(), 0);
+
+    // Nothing is taken from the pool for an empty buffer.
+    _internal::PooledBuffer empty(pool, 0);
+    EXPECT_EQ(empty.GetData(), nullptr);
+  }
+
+  TEST(BufferPoolTest, DefaultPool)
+  {
+    const auto& pool = BufferPool::GetDefault();
+    ASSERT_TRUE(pool);
+    EXPECT_EQ(pool, BufferPool::GetDefault());
+    _internal::PooledBuffer buffer(nullptr, 10);
+    ASSERT_NE(buffer.GetData(), nullptr);
+    buffer.GetData()[9] = 1;
+  }
+
+  TEST(BufferPoolTest, SharedAcrossThreads)
+  {
+    BufferPoolOptions options;
+    options.MaxPooledBytes = 64 * 1024 * 1024;
+    auto pool = std::make_shared<BufferPool>(options);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i)
+    {
+      threads.emplace_back([&pool, i]() {
+        for (int j = 0; j < 200; ++j)
+        {
+          _internal::PooledBuffer buffer(pool, static_cast<size_t>(64 * 1024 << (j % 4)));
+          std::memset(buffer.GetData(), i, buffer.GetSize());
+          for (size_t k = 0; k < buffer.GetSize(); k += 4096)
+          {
+            EXPECT_EQ(buffer.GetData()[k], static_cast<uint8_t>(i));
+          }
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    // Each thread holds one buffer at a time, so the buffers taken are at most one per size class
+    // and thread.
+    EXPECT_LE(pool->GetPooledBytes(), 8 * (64 + 128 + 256 + 512) * 1024);
+  }
+
+  TEST(BufferPoolTest, OrderedTransferBuffersPooled)
+  {
+    auto pool = std::make_shared<BufferPool>();
+    for (int i = 0; i < 3; ++i)
+    {
+      std::vector<uint8_t> delivered;
+      _internal::OrderedConcurrentTransfer(
+          0,
+          1024 * 1024,
+          256 * 1024,
+          4,
+          [](int64_t offset, int64_t length, int64_t, int64_t, uint8_t* buffer) {
+            std::memset(
+                buffer, static_cast<int>(offset / (256 * 1024)), static_cast<size_t>(length));
+          },
+          [&](const uint8_t* data, size_t size) {
+            delivered.insert(delivered.end(), data, data + size);
+          },
+          nullptr,
+          pool);
+      ASSERT_EQ(delivered.size(), 1024U * 1024U);
+      EXPECT_EQ(delivered[300 * 1024], 1);
+      // The buffers of the previous transfers are reused.
+      EXPECT_EQ(pool->GetPooledBytes(), 4 * 256 * 1024);
+    }
+  }
+
+  TEST(BufferPoolTest, MaxBytesInUse)
+  {
+    BufferPoolOptions options;
+    options.MaxBytesInUse = 256 * 1024;
+    auto pool = std::make_shared<BufferPool>(options);
+    {
+      _internal::PooledBuffer first(pool, 128 * 1024);
+      EXPECT_EQ(pool->GetBytesInUse(), 128 * 1024);
+      {
+        // A thread holding a buffer gets the next ones even over the budget.
+        _internal::PooledBuffer second(pool, 128 * 1024);
+        _internal::PooledBuffer third(pool, 64 * 1024);
+        EXPECT_EQ(pool->GetBytesInUse(), 320 * 1024);
+        EXPECT_EQ(_internal::PooledBuffer::TryCreate(pool, 64 * 1024).GetSize(), 0U);
+      }
+      EXPECT_EQ(pool->GetBytesInUse(), 128 * 1024);
+
+      // Another thread waits until the buffers fit in the budget.
+      _internal::PooledBuffer second(pool, 128 * 1024);
+      auto waiting = std::async(std::launch::async, [&pool]() {
+        _internal::PooledBuffer buffer(pool, 64 * 1024);
+        return pool->GetBytesInUse();
+      });
+      EXPECT_EQ(waiting.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+      first = _internal::PooledBuffer();
+      EXPECT_EQ(waiting.get(), 192 * 1024);
+    }
+    EXPECT_EQ(pool->GetBytesInUse(), 0);
+
+    // A buffer larger than the budget is given when no other buffer is in use.
+    {
+      _internal::PooledBuffer buffer(pool, 512 * 1024);
+      EXPECT_EQ(pool->GetBytesInUse(), 512 * 1024);
+    }
+
+    // An ordered transfer uses as many buffers as fit in the budget.
+    std::vector<uint8_t> delivered;
+    int64_t maxBytesInUse = 0;
+    _internal::OrderedConcurrentTransfer(
+        0,
+        1024 * 1024,
+        128 * 1024,
+        8,
+        [&](int64_t offset, int64_t length, int64_t, int64_t, uint8_t* buffer) {
+          std::memset(buffer, static_cast<int>(offset / (128 * 1024)), static_cast<size_t>(length));
+        },
+        [&](const uint8_t* data, size_t size) {
+          maxBytesInUse = (std::max)(maxBytesInUse, pool->GetBytesInUse());
+          delivered.insert(delivered.end(), data, data + size);
+        },
+        nullptr,
+        pool);
+    ASSERT_EQ(delivered.size(), 1024U * 1024U);
+    EXPECT_EQ(delivered[1024 * 1024 - 1], 7);
+    EXPECT_EQ(maxBytesInUse, 256 * 1024);
+    EXPECT_EQ(pool->GetBytesInUse(), 0);
+  }
+
+  TEST(BufferPoolTest, NumaNodeAndCpuAffinity)
+  {
+    EXPECT_EQ(
+        &_internal::GetTransferThreadPool(nullptr), &_internal::ThreadPool::GetDefault());
+    EXPECT_EQ(
+        &_internal::GetTransferThreadPool(std::make_shared<BufferPool>()),
+        &_internal::ThreadPool::GetDefault());
+
+    BufferPoolOptions options;
+    options.NumaNode = 0;
+    options.CpuAffinity = {0};
+    auto pool = std::make_shared<BufferPool>(options);
+    auto& threadPool = _internal::GetTransferThreadPool(pool);
+    EXPECT_NE(&threadPool, &_internal::ThreadPool::GetDefault());
+    EXPECT_EQ(threadPool.GetMaxThreads(), 8U);
+
+    // The chunks run on the threads of the pool, in buffers allocated on the NUMA node.
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::atomic<int64_t> transferred{0};
+    _internal::ConcurrentTransfer(
+        0,
+        1024 * 1024,
+        128 * 1024,
+        4,
+        [&](int64_t, int64_t length, int64_t, int64_t) {
+          _internal::PooledBuffer buffer(pool, static_cast<size_t>(length));
+          EXPECT_EQ(
+              reinterpret_cast<uintptr_t>(buffer.GetData()) % _internal::UnbufferedFileIoAlignment,
+              0U);
+          std::memset(buffer.GetData(), 0xab, buffer.GetSize());
+          transferred += length;
+          std::lock_guard<std::mutex> lock(mutex);
+          threads.insert(std::this_thread::get_id());
+        },
+        nullptr,
+        threadPool);
+    EXPECT_EQ(transferred, 1024 * 1024);
+    EXPECT_GE(threads.size(), 1U);
+    EXPECT_GT(pool->GetPooledBytes(), 0);
+
+#if defined(__linux__)
+    // The threads of the pool only run on the CPUs of the options.
+    std::promise<bool> isPinned;
+    threadPool.Submit([&isPinned]() {
+      cpu_set_t cpuSet;
+      CPU_ZERO(&cpuSet);
+      isPinned.set_value(
+          sched_getaffinity(0, sizeof(cpuSet), &cpuSet) == 0 && CPU_COUNT(&cpuSet) == 1
+          && CPU_ISSET(0, &cpuSet));
+    });
+    EXPECT_TRUE(isPinned.get_future().get());
+#endif
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/bulk_operation.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(BulkOperationTest, ExecuteBulkOperations)
+  {
+    std::atomic<int> numRunning{0};
+    std::atomic<int> maxRunning{0};
+    std::vector<int> numRuns(100, 0);
+    std::vector<BulkOperation> operations;
+    for (size_t i = 0; i < numRuns.size(); ++i)
+    {
+      operations.push_back([&, i](const Azure::Core::Context&) {
+        const int running = ++numRunning;
+        int expected = maxRunning;
+        while (running > expected && !maxRunning.compare_exchange_weak(expected, running))
+        {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++numRuns[i];
+        --numRunning;
+        // Every third operation fails, without stopping the other ones.
+        if (i % 3 == 0)
+        {
+          throw std::runtime_error("operation failed");
+        }
+      });
+    }
+
+    BulkOperationOptions options;
+    options.Concurrency = 4;
+    auto result = ExecuteBulkOperations(operations, options);
+    ASSERT_EQ(result.Errors.size(), operations.size());
+    EXPECT_EQ(result.FailedCount, 34);
+    for (size_t i = 0; i < numRuns.size(); ++i)
+    {
+      EXPECT_EQ(numRuns[i], 1);
+      EXPECT_EQ(static_cast<bool>(result.Errors[i]), i % 3 == 0);
+    }
+    EXPECT_LE(maxRunning, 4);
+    EXPECT_THROW(std::rethrow_exception(result.Errors[0]), std::runtime_error);
+
+    EXPECT_EQ(ExecuteBulkOperations({}).FailedCount, 0);
+    options.Concurrency = 0;
+    EXPECT_THROW(ExecuteBulkOperations(operations, options), std::invalid_argument);
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,536 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
+#include <azure/storage/common/internal/thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(ConcurrentTransferTest, AllChunksTransferred)
+  {
+    const int64_t length = 1000;
+    const int64_t chunkSize = 7;
+    std::vector<std::atomic<int>> transferred(static_cast<size_t>(length));
+    std::atomic<int64_t> numChunksSeen{0};
+
+    _internal::ConcurrentTransfer(
+        0,
+        length,
+        chunkSize,
+        8,
+        [&](int64_t offset, int64_t chunkLength, int64_t chunkId, int64_t numChunks) {
+          EXPECT_EQ(offset, chunkId * chunkSize);
+          numChunksSeen = numChunks;
+          for (int64_t i = offset; i < offset + chunkLength; ++i)
+          {
+            ++transferred[static_cast<size_t>(i)];
+          }
+        });
+
+    EXPECT_EQ(numChunksSeen, (length + chunkSize - 1) / chunkSize);
+    for (auto& count : transferred)
+    {
+      EXPECT_EQ(count, 1);
+    }
+  }
+
+  TEST(ConcurrentTransferTest, FirstErrorRethrown)
+  {
+    std::atomic<int> numChunksTransferred{0};
+    EXPECT_THROW(
+        _internal::ConcurrentTransfer(
+            0,
+            100,
+            1,
+            4,
+            [&](int64_t, int64_t, int64_t chunkId, int64_t) {
+              if (chunkId == 10)
+              {
+                throw std::runtime_error("chunk failed");
+              }
+              ++numChunksTransferred;
+            }),
+        std::runtime_error);
+    // The transfer stops after the first error.
+    EXPECT_LT(numChunksTransferred, 100);
+  }
+
+  TEST(ConcurrentTransferTest, FirstErrorCancelsChunksInFlight)
+  {
+    _internal::ThreadPool threadPool(1);
+    std::atomic<bool> waitingChunkStarted{false};
+    std::atomic<bool> waitingChunkCancelled{false};
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    EXPECT_THROW(
+        _internal::ConcurrentTransfer(
+            0,
+            2,
+            1,
+            2,
+            [&](int64_t, int64_t, int64_t chunkId, int64_t, const Azure::Core::Context& context) {
+              if (chunkId == 0)
+              {
+                while (!waitingChunkStarted && std::chrono::steady_clock::now() < timeout)
+                {
+                  std::this_thread::yield();
+                }
+                throw std::runtime_error("chunk failed");
+              }
+              // Stands for a request in flight, which aborts when its context is cancelled.
+              waitingChunkStarted = true;
+              while (!context.IsCancelled() && std::chrono::steady_clock::now() < timeout)
+              {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+              }
+              waitingChunkCancelled = context.IsCancelled();
+              context.ThrowIfCancelled();
+            },
+            Azure::Core::Context(),
+            nullptr,
+            threadPool),
+        std::runtime_error);
+    EXPECT_TRUE(waitingChunkCancelled);
+  }
+
+  TEST(ConcurrentTransferTest, CallerCancellationAbortsChunks)
+  {
+    Azure::Core::Context context;
+    std::atomic<int> numChunksStarted{0};
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    std::thread canceller([&]() {
+      while (numChunksStarted == 0 && std::chrono::steady_clock::now() < timeout)
+      {
+        std::this_thread::yield();
+      }
+      context.Cancel();
+    });
+    EXPECT_THROW(
+        _internal::ConcurrentTransfer(
+            0,
+            100,
+            1,
+            4,
+            [&](int64_t, int64_t, int64_t, int64_t, const Azure::Core::Context& chunkContext) {
+              ++numChunksStarted;
+              while (!chunkContext.IsCancelled() && std::chrono::steady_clock::now() < timeout)
+              {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+              }
+              chunkContext.ThrowIfCancelled();
+            },
+            context),
+        Azure::Core::OperationCancelledException);
+    canceller.join();
+    EXPECT_LT(numChunksStarted, 100);
+  }
+
+  TEST(ConcurrentTransferTest, BusyThreadPool)
+  {
+    // The calling thread transfers the chunks itself when all the threads of the pool are busy.
+    _internal::ThreadPool threadPool(1);
+    std::atomic<bool> release{false};
+    threadPool.Submit([&release]() {
+      while (!release)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    });
+
+    std::atomic<int> numChunksTransferred{0};
+    _internal::ConcurrentTransfer(
+        0,
+        10,
+        1,
+        4,
+        [&](int64_t, int64_t, int64_t, int64_t) { ++numChunksTransferred; },
+        nullptr,
+        threadPool);
+    EXPECT_EQ(numChunksTransferred, 10);
+    release = true;
+  }
+
+  TEST(ConcurrentTransferTest, ConcurrentTransfersShareThreadPool)
+  {
+    _internal::ThreadPool threadPool(4);
+    std::atomic<int> numChunksTransferred{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 16; ++i)
+    {
+      threads.emplace_back([&]() {
+        _internal::ConcurrentTransfer(
+            0,
+            64,
+            1,
+            8,
+            [&](int64_t, int64_t, int64_t, int64_t) { ++numChunksTransferred; },
+            nullptr,
+            threadPool);
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    EXPECT_EQ(numChunksTransferred, 16 * 64);
+    EXPECT_EQ(threadPool.GetMaxThreads(), 4U);
+  }
+
+  TEST(ConcurrentTransferTest, ThreadPoolRunsAllTasks)
+  {
+    // Tasks are submitted from outside the pool and, for every other one, from the task itself,
+    // while the threads go idle and are woken again.
+    std::atomic<int> numTasksRun{0};
+    for (int round = 0; round < 20; ++round)
+    {
+      _internal::ThreadPool threadPool(4);
+      std::vector<std::thread> threads;
+      for (int i = 0; i < 4; ++i)
+      {
+        threads.emplace_back([&]() {
+          for (int j = 0; j < 100; ++j)
+          {
+            threadPool.Submit([&, j]() {
+              ++numTasksRun;
+              if (j % 2 == 0)
+              {
+                threadPool.Submit([&]() { ++numTasksRun; });
+              }
+            });
+            if (j % 25 == 0)
+            {
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+          }
+        });
+      }
+      for (auto& thread : threads)
+      {
+        thread.join();
+      }
+    }
+    EXPECT_EQ(numTasksRun, 20 * 4 * 150);
+  }
+
+  TEST(ConcurrentTransferTest, OrderedDelivery)
+  {
+    const int64_t offset = 10;
+    const int64_t length = 1000;
+    const int64_t chunkSize = 7;
+    const int concurrency = 4;
+    std::mutex mutex;
+    std::set<const uint8_t*> buffers;
+    std::vector<uint8_t> delivered;
+
+    _internal::OrderedConcurrentTransfer(
+        offset,
+        length,
+        chunkSize,
+        concurrency,
+        [&](int64_t chunkOffset, int64_t chunkLength, int64_t chunkId, int64_t, uint8_t* buffer) {
+          // Later chunks are often done first.
+          std::this_thread::sleep_for(std::chrono::microseconds((chunkId % 3) * 500));
+          for (int64_t i = 0; i < chunkLength; ++i)
+          {
+            buffer[i] = static_cast<uint8_t>(chunkOffset + i);
+          }
+          std::lock_guard<std::mutex> lock(mutex);
+          buffers.insert(buffer);
+        },
+        [&](const uint8_t* data, size_t size) {
+          EXPECT_LE(size, static_cast<size_t>(chunkSize));
+          delivered.insert(delivered.end(), data, data + size);
+        });
+
+    ASSERT_EQ(delivered.size(), static_cast<size_t>(length));
+    for (int64_t i = 0; i < length; ++i)
+    {
+      EXPECT_EQ(delivered[static_cast<size_t>(i)], static_cast<uint8_t>(offset + i));
+    }
+    // No more chunks than the concurrency are held in memory.
+    EXPECT_LE(buffers.size(), static_cast<size_t>(concurrency));
+  }
+
+  TEST(ConcurrentTransferTest, OrderedDeliveryErrorRethrown)
+  {
+    std::atomic<int> numChunksDelivered{0};
+    EXPECT_THROW(
+        _internal::OrderedConcurrentTransfer(
+            0,
+            100,
+            1,
+            4,
+            [](int64_t, int64_t, int64_t, int64_t, uint8_t*) {},
+            [&](const uint8_t*, size_t) {
+              if (++numChunksDelivered == 10)
+              {
+                throw std::runtime_error("sink failed");
+              }
+            }),
+        std::runtime_error);
+    EXPECT_EQ(numChunksDelivered, 10);
+  }
+
+  TEST(ConcurrentTransferTest, StreamingTransfer)
+  {
+    const int concurrency = 4;
+    for (const size_t length : {size_t(0), size_t(5), size_t(700), size_t(1000)})
+    {
+      const int64_t chunkSize = 7;
+      std::vector<uint8_t> source(length);
+      for (size_t i = 0; i < length; ++i)
+      {
+        source[i] = static_cast<uint8_t>(i);
+      }
+      size_t readOffset = 0;
+      std::mutex mutex;
+      std::set<const uint8_t*> buffers;
+      std::vector<uint8_t> transferred(length);
+      int64_t numChunksSeen = -1;
+
+      const int64_t numChunks = _internal::StreamingConcurrentTransfer(
+          chunkSize,
+          concurrency,
+          [&](uint8_t* buffer, size_t size) {
+            // The stream is read in order, one chunk at a time.
+            size = std::min(size, length - readOffset);
+            std::copy(source.begin() + readOffset, source.begin() + readOffset + size, buffer);
+            readOffset += size;
+            return size;
+          },
+          [&](int64_t chunkId, int64_t chunkCount, const uint8_t* data, size_t size) {
+            std::this_thread::sleep_for(std::chrono::microseconds((chunkId % 3) * 500));
+            std::copy(
+                data, data + size, transferred.begin() + static_cast<size_t>(chunkId * chunkSize));
+            std::lock_guard<std::mutex> lock(mutex);
+            buffers.insert(data);
+            if (chunkCount != -1)
+            {
+              EXPECT_LT(size, static_cast<size_t>(chunkSize));
+              numChunksSeen = chunkCount;
+            }
+          });
+
+      EXPECT_EQ(numChunks, static_cast<int64_t>((length + chunkSize - 1) / chunkSize));
+      // The number of chunks is only known by a chunk shorter than the others.
+      EXPECT_EQ(numChunksSeen, length % chunkSize == 0 ? -1 : numChunks);
+      EXPECT_EQ(transferred, source);
+      // No more chunks than the concurrency are held in memory.
+      EXPECT_LE(buffers.size(), static_cast<size_t>(concurrency));
+    }
+  }
+
+  TEST(ConcurrentTransferTest, StreamingTransferErrorRethrown)
+  {
+    std::atomic<int> numChunksTransferred{0};
+    EXPECT_THROW(
+        _internal::StreamingConcurrentTransfer(
+            1,
+            4,
+            [](uint8_t*, size_t size) { return size; },
+            [&](int64_t chunkId, int64_t, const uint8_t*, size_t) {
+              ++numChunksTransferred;
+              if (chunkId == 10)
+              {
+                throw std::runtime_error("transfer failed");
+              }
+            }),
+        std::runtime_error);
+    EXPECT_GE(numChunksTransferred, 11);
+
+    EXPECT_THROW(
+        _internal::StreamingConcurrentTransfer(
+            1,
+            4,
+            [](uint8_t*, size_t) -> size_t { throw std::runtime_error("read failed"); },
+            [](int64_t, int64_t, const uint8_t*, size_t) {}),
+        std::runtime_error);
+  }
+
+  TEST(ConcurrentTransferTest, AdaptiveControllerIncreasesAndBacksOff)
+  {
+    _internal::AdaptiveChunkController controller(4, 2, 16, 3);
+    EXPECT_EQ(controller.GetChunkSize(), 4);
+    EXPECT_EQ(controller.GetConcurrency(), 1);
+
+    // Steady throughput, additive increase up to the bounds.
+    for (int i = 0; i < 5; ++i)
+    {
+      controller.OnChunkTransferred(controller.GetChunkSize(), std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(controller.GetChunkSize(), 16);
+    EXPECT_EQ(controller.GetConcurrency(), 3);
+
+    // Throughput collapses, multiplicative decrease down to the bounds.
+    controller.OnChunkTransferred(16, std::chrono::seconds(1));
+    EXPECT_EQ(controller.GetChunkSize(), 8);
+    EXPECT_EQ(controller.GetConcurrency(), 1);
+    controller.OnChunkTransferred(8, std::chrono::seconds(5));
+    controller.OnChunkTransferred(4, std::chrono::seconds(20));
+    EXPECT_EQ(controller.GetChunkSize(), 2);
+    EXPECT_EQ(controller.GetConcurrency(), 1);
+  }
+
+  TEST(ConcurrentTransferTest, AdaptiveControllerBacksOffOnSlowChunk)
+  {
+    _internal::AdaptiveChunkController controller(1024, 1, 1024 * 1024, 8);
+    controller.OnChunkTransferred(1024, std::chrono::seconds(11));
+    controller.OnChunkTransferred(2048, std::chrono::seconds(11));
+    EXPECT_EQ(controller.GetChunkSize(), 1024);
+    EXPECT_EQ(controller.GetConcurrency(), 1);
+  }
+
+  TEST(ConcurrentTransferTest, AdaptiveAllChunksTransferred)
+  {
+    const int64_t offset = 100;
+    const int64_t length = 5000;
+    std::vector<std::atomic<int>> transferred(static_cast<size_t>(length));
+    std::mutex mutex;
+    std::vector<std::pair<int64_t, int64_t>> chunks;
+    int64_t lastChunkNumChunks = 0;
+
+    _internal::AdaptiveChunkController controller(8, 4, 256, 4);
+    auto numChunks = _internal::AdaptiveConcurrentTransfer(
+        offset,
+        length,
+        controller,
+        [&](int64_t chunkOffset, int64_t chunkLength, int64_t chunkId, int64_t numChunks) {
+          for (int64_t i = chunkOffset; i < chunkOffset + chunkLength; ++i)
+          {
+            ++transferred[static_cast<size_t>(i - offset)];
+          }
+          std::lock_guard<std::mutex> lock(mutex);
+          if (chunkOffset + chunkLength == offset + length)
+          {
+            lastChunkNumChunks = numChunks;
+            EXPECT_EQ(chunkId, numChunks - 1);
+          }
+          else
+          {
+            EXPECT_EQ(numChunks, -1);
+          }
+          chunks.emplace_back(chunkId, chunkOffset);
+        });
+
+    for (auto& count : transferred)
+    {
+      EXPECT_EQ(count, 1);
+    }
+    EXPECT_EQ(numChunks, static_cast<int64_t>(chunks.size()));
+    EXPECT_EQ(lastChunkNumChunks, numChunks);
+    // Chunk IDs follow the offsets, so they can name blocks.
+    std::sort(chunks.begin(), chunks.end());
+    for (size_t i = 1; i < chunks.size(); ++i)
+    {
+      EXPECT_EQ(chunks[i].first, static_cast<int64_t>(i));
+      EXPECT_GT(chunks[i].second, chunks[i - 1].second);
+    }
+    // The chunks grew while the throughput held up.
+    EXPECT_LT(numChunks, length / 8);
+  }
+
+  TEST(ConcurrentTransferTest, AdaptiveFirstErrorRethrown)
+  {
+    _internal::AdaptiveChunkController controller(1, 1, 1, 4);
+    std::atomic<int> numChunksTransferred{0};
+    EXPECT_THROW(
+        _internal::AdaptiveConcurrentTransfer(
+            0,
+            100,
+            controller,
+            [&](int64_t, int64_t, int64_t chunkId, int64_t) {
+              if (chunkId == 10)
+              {
+                throw std::runtime_error("chunk failed");
+              }
+              ++numChunksTransferred;
+            }),
+        std::runtime_error);
+    EXPECT_LT(numChunksTransferred, 100);
+  }
+
+  TEST(ConcurrentTransferTest, TaskQueue)
+  {
+    std::mutex mutex;
+    std::vector<int> order;
+    std::atomic<int> numRunning{0};
+    std::atomic<int> maxRunning{0};
+    auto leafTask = [&](int id) {
+      int running = ++numRunning;
+      int expected = maxRunning;
+      while (running > expected && !maxRunning.compare_exchange_weak(expected, running))
+      {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      --numRunning;
+      std::lock_guard<std::mutex> guard(mutex);
+      order.push_back(id);
+    };
+
+    // The urgent tasks run before the tasks queued earlier, and the tasks they push run too.
+    {
+      _internal::TaskQueue tasks;
+      tasks.Push([&]() { leafTask(0); });
+      tasks.Push(
+          [&]() {
+            order.push_back(-1);
+            for (int i = 1; i <= 20; ++i)
+            {
+              tasks.Push([&, i]() { leafTask(i); });
+            }
+          },
+          true);
+      tasks.Run(1);
+      ASSERT_EQ(order.size(), 22U);
+      EXPECT_EQ(order[0], -1);
+      EXPECT_EQ(order[1], 0);
+    }
+
+    order.clear();
+    {
+      _internal::TaskQueue tasks;
+      tasks.Push(
+          [&]() {
+            for (int i = 0; i < 20; ++i)
+            {
+              tasks.Push([&, i]() { leafTask(i); });
+            }
+          },
+          true);
+      tasks.Run(4);
+      EXPECT_EQ(order.size(), 20U);
+      EXPECT_LE(maxRunning, 4);
+    }
+  }
+
+  TEST(ConcurrentTransferTest, TaskQueueFirstErrorRethrown)
+  {
+    _internal::TaskQueue tasks;
+    std::atomic<int> numTasksRun{0};
+    for (int i = 0; i < 100; ++i)
+    {
+      tasks.Push([&, i]() {
+        if (i == 10)
+        {
+          throw std::runtime_error("task failed");
+        }
+        ++numTasksRun;
+      });
+    }
+    EXPECT_THROW(tasks.Run(2), std::runtime_error);
+    // No task starts after the first error.
+    EXPECT_LT(numTasksRun, 100);
+  }
+
+}}} // namespace Azure::Storage::Test
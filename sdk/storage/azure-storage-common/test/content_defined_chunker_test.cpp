@@ -0,0 +1,89 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/internal/content_defined_chunker.hpp>
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    std::vector<std::string> SplitContent(
+        const std::vector<uint8_t>& content,
+        int64_t averageChunkSize,
+        size_t pieceSize)
+    {
+      _internal::ContentDefinedChunker chunker(averageChunkSize);
+      std::vector<std::string> chunks(1);
+      for (size_t offset = 0; offset < content.size();)
+      {
+        const size_t size = std::min(pieceSize, content.size() - offset);
+        bool chunkEnd;
+        const size_t chunkSize = chunker.FindChunkEnd(content.data() + offset, size, chunkEnd);
+        chunks.back().append(content.begin() + offset, content.begin() + offset + chunkSize);
+        offset += chunkSize;
+        if (chunkEnd)
+        {
+          chunks.emplace_back();
+        }
+      }
+      if (chunks.back().empty())
+      {
+        chunks.pop_back();
+      }
+      return chunks;
+    }
+  } // namespace
+
+  TEST(ContentDefinedChunkerTest, ChunkSizes)
+  {
+    constexpr int64_t AverageChunkSize = 16 * 1024;
+    const std::vector<uint8_t> content = RandomBuffer(4 * 1024 * 1024);
+
+    auto chunks = SplitContent(content, AverageChunkSize, content.size());
+    for (size_t i = 0; i + 1 < chunks.size(); ++i)
+    {
+      EXPECT_GE(static_cast<int64_t>(chunks[i].size()), AverageChunkSize / 4);
+      EXPECT_LE(static_cast<int64_t>(chunks[i].size()), AverageChunkSize * 4);
+    }
+    const auto averageSize = static_cast<int64_t>(content.size() / chunks.size());
+    EXPECT_GT(averageSize, AverageChunkSize / 2);
+    EXPECT_LT(averageSize, AverageChunkSize * 2);
+
+    // The chunks don't depend on how the content is passed.
+    EXPECT_EQ(SplitContent(content, AverageChunkSize, 1000), chunks);
+
+    // Content without any boundary is split in chunks of the maximum size.
+    std::vector<uint8_t> zeros(1024 * 1024);
+    auto zeroChunks = SplitContent(zeros, AverageChunkSize, zeros.size());
+    EXPECT_EQ(static_cast<int64_t>(zeroChunks[0].size()), AverageChunkSize * 4);
+  }
+
+  TEST(ContentDefinedChunkerTest, InsertionChangesChunksAround)
+  {
+    constexpr int64_t AverageChunkSize = 16 * 1024;
+    const std::vector<uint8_t> content = RandomBuffer(4 * 1024 * 1024);
+    auto chunks = SplitContent(content, AverageChunkSize, content.size());
+
+    std::vector<uint8_t> changedContent = content;
+    changedContent.insert(changedContent.begin() + 1024 * 1024, 100, uint8_t(42));
+    const auto erased = changedContent.begin() + 3 * 1024 * 1024;
+    changedContent.erase(erased, erased + 10);
+    auto changedChunks = SplitContent(changedContent, AverageChunkSize, changedContent.size());
+
+    std::set<std::string> chunkSet(chunks.begin(), chunks.end());
+    size_t numChanged = 0;
+    for (const auto& chunk : changedChunks)
+    {
+      numChanged += chunkSet.count(chunk) == 0 ? 1 : 0;
+    }
+    EXPECT_GE(numChanged, 2U);
+    EXPECT_LE(numChanged, 8U);
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -1,9 +1,13 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
 #include <cstring>
+#include <random>
+#include <utility>
 
 #include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/chunked_crc64.hpp>
 
 #include "test_base.hpp"
 
@@ -38,6 +42,71 @@ namespace Azure { namespace Storage { namespace Test {
         "+SBESxQVhI53mSEdZJcCBpdBkaqwzfPaVYZMAf5LP3c=");
   }
 
+  TEST(CryptFunctionsTest, HmacSha256Context)
+  {
+    auto data = RandomBuffer(static_cast<size_t>(1_KB));
+    // Keys longer than a SHA-256 block are hashed first.
+    for (size_t keyLength : {1, 32, 63, 64, 65, 200})
+    {
+      auto key = RandomBuffer(keyLength);
+      _internal::HmacSha256Context context(key);
+      for (size_t length : {0, 1, 55, 56, 64, 1024})
+      {
+        EXPECT_EQ(
+            context.Sign(data.data(), length),
+            _internal::HmacSha256(std::vector<uint8_t>(data.begin(), data.begin() + length), key))
+            << keyLength << " " << length;
+      }
+    }
+  }
+
+  TEST(CryptFunctionsTest, Aes256Gcm)
+  {
+    // Test case 14 of the GCM specification.
+    const std::vector<uint8_t> key(_internal::AesGcmKeySize, 0);
+    const std::vector<uint8_t> nonce(_internal::AesGcmNonceSize, 0);
+    const std::vector<uint8_t> data(16, 0);
+    std::vector<uint8_t> encrypted(data.size());
+    std::vector<uint8_t> tag(_internal::AesGcmTagSize);
+    _internal::Aes256GcmEncrypt(
+        key, nonce.data(), data.data(), data.size(), encrypted.data(), tag.data());
+    EXPECT_EQ(Azure::Core::Convert::Base64Encode(encrypted), "zqdAPU1ga24HTsXTuvOdGA==");
+    EXPECT_EQ(Azure::Core::Convert::Base64Encode(tag), "0NHIp5mZa/AmW5i11Iq5GQ==");
+
+    auto randomKey = RandomBuffer(_internal::AesGcmKeySize);
+    std::vector<uint8_t> randomNonce(_internal::AesGcmNonceSize);
+    _internal::GenerateRandomBytes(randomNonce.data(), randomNonce.size());
+    auto content = RandomBuffer(static_cast<size_t>(100_KB + 1));
+    encrypted.resize(content.size());
+    _internal::Aes256GcmEncrypt(
+        randomKey,
+        randomNonce.data(),
+        content.data(),
+        content.size(),
+        encrypted.data(),
+        tag.data());
+    std::vector<uint8_t> decrypted(content.size());
+    _internal::Aes256GcmDecrypt(
+        randomKey,
+        randomNonce.data(),
+        encrypted.data(),
+        encrypted.size(),
+        tag.data(),
+        decrypted.data());
+    EXPECT_EQ(decrypted, content);
+
+    encrypted[100] ^= 1;
+    EXPECT_THROW(
+        _internal::Aes256GcmDecrypt(
+            randomKey,
+            randomNonce.data(),
+            encrypted.data(),
+            encrypted.size(),
+            tag.data(),
+            decrypted.data()),
+        std::runtime_error);
+  }
+
   static std::vector<uint8_t> ComputeHash(const std::string& data)
   {
     const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data.data());
@@ -121,6 +190,92 @@ namespace Azure { namespace Storage { namespace Test {
         crc64Single.Final(reinterpret_cast<const uint8_t*>(allData.data()), allData.size()));
   }
 
+  TEST(CryptFunctionsTest, Crc64Hash_LongBuffers)
+  {
+    // Long buffers may be folded with carry-less multiplications, which must give the same CRC as
+    // short appends.
+    auto data = RandomBuffer(static_cast<size_t>(64_KB + 512));
+    for (size_t offset : {0, 1, 7, 8, 15})
+    {
+      for (size_t length : {256, 257, 383, 384, 1039, 4096, 64 * 1024 + 17})
+      {
+        Crc64Hash whole;
+        whole.Append(&data[offset], length);
+
+        Crc64Hash pieces;
+        for (size_t i = 0; i < length; i += 100)
+        {
+          pieces.Append(&data[offset + i], std::min<size_t>(100, length - i));
+        }
+
+        uint64_t expected = ~0ULL;
+        for (size_t i = offset; i < offset + length; ++i)
+        {
+          expected ^= data[i];
+          for (int bit = 0; bit < 8; ++bit)
+          {
+            expected = (expected >> 1) ^ ((expected & 1) ? 0x9A6C9329AC4BC9B5ULL : 0);
+          }
+        }
+        expected ^= ~0ULL;
+        std::vector<uint8_t> expectedBinary;
+        for (size_t i = 0; i < sizeof(expected); ++i)
+        {
+          expectedBinary.push_back(static_cast<uint8_t>(expected >> (8 * i)));
+        }
+
+        EXPECT_EQ(whole.Final(), expectedBinary) << offset << " " << length;
+        EXPECT_EQ(pieces.Final(), expectedBinary) << offset << " " << length;
+      }
+    }
+  }
+
+  TEST(CryptFunctionsTest, ChunkedCrc64)
+  {
+    auto data = RandomBuffer(static_cast<size_t>(1_MB));
+    std::vector<std::pair<size_t, size_t>> pieces;
+    for (size_t offset = 0; offset < data.size();)
+    {
+      size_t length = std::min(static_cast<size_t>(RandomInt(0, 100_KB)), data.size() - offset);
+      pieces.emplace_back(offset, length);
+      offset += length;
+    }
+    std::shuffle(pieces.begin(), pieces.end(), std::mt19937(std::random_device()()));
+
+    _internal::ChunkedCrc64 chunkedCrc64;
+    for (const auto& piece : pieces)
+    {
+      auto pieceHash = chunkedCrc64.Append(
+          static_cast<int64_t>(piece.first), &data[piece.first], piece.second);
+      EXPECT_EQ(pieceHash.Algorithm, HashAlgorithm::Crc64);
+      EXPECT_EQ(pieceHash.Value, Crc64Hash().Final(&data[piece.first], piece.second));
+    }
+    auto hash = chunkedCrc64.Final();
+    EXPECT_EQ(hash.Algorithm, HashAlgorithm::Crc64);
+    EXPECT_EQ(hash.Value, Crc64Hash().Final(data.data(), data.size()));
+
+    std::sort(pieces.begin(), pieces.end());
+    const size_t rangeOffset = pieces[1].first;
+    const size_t rangeLength = pieces[3].first - rangeOffset;
+    auto rangeHash = chunkedCrc64.GetRangeHash(
+        static_cast<int64_t>(rangeOffset), static_cast<int64_t>(rangeLength));
+    EXPECT_EQ(rangeHash.Algorithm, HashAlgorithm::Crc64);
+    EXPECT_EQ(rangeHash.Value, Crc64Hash().Final(&data[rangeOffset], rangeLength));
+  }
+
+  TEST(CryptFunctionsTest, Crc64Hash_Reset)
+  {
+    Crc64Hash instance;
+    instance.Append(ToBinaryVector("Hello").data(), 5);
+    instance.Reset();
+    EXPECT_EQ(Azure::Core::Convert::Base64Encode(instance.Final()), "AAAAAAAAAAA=");
+    instance.Reset();
+    auto data = ToBinaryVector("Hello Azure!");
+    EXPECT_EQ(
+        Azure::Core::Convert::Base64Encode(instance.Final(data.data(), data.size())),
+        "DtjZpL9/o8c=");
+  }
+
   TEST(CryptFunctionsTest, Crc64Hash_ExpectThrow)
   {
     std::string data = "";
@@ -0,0 +1,233 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/internal/file_io.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(FileIoTest, FileMapping)
+  {
+    const std::vector<size_t> sizes = {0, 1, 4097, 1024 * 1024 + 3};
+    for (size_t size : sizes)
+    {
+      const std::string filename = RandomString();
+      const std::vector<uint8_t> content = RandomBuffer(size);
+      {
+        _internal::FileWriter fileWriter(filename);
+        fileWriter.Write(content.data(), content.size(), 0);
+      }
+      {
+        _internal::FileReader fileReader(filename);
+        _internal::FileMapping fileMapping(fileReader);
+        ASSERT_EQ(fileMapping.GetSize(), static_cast<int64_t>(size));
+        EXPECT_EQ(
+            std::vector<uint8_t>(fileMapping.GetData(), fileMapping.GetData() + size), content);
+      }
+      DeleteFile(filename);
+    }
+  }
+
+  TEST(FileIoTest, WritableFileMapping)
+  {
+    const std::vector<size_t> sizes = {0, 1, 4097, 1024 * 1024 + 3};
+    for (size_t size : sizes)
+    {
+      const std::string filename = RandomString();
+      const std::vector<uint8_t> content = RandomBuffer(size);
+      {
+        // An existing file is truncated.
+        _internal::FileWriter fileWriter(filename);
+        const std::vector<uint8_t> previous = RandomBuffer(2 * 1024 * 1024);
+        fileWriter.Write(previous.data(), previous.size(), 0);
+      }
+      {
+        _internal::WritableFileMapping fileMapping(filename, static_cast<int64_t>(size));
+        ASSERT_EQ(fileMapping.GetSize(), static_cast<int64_t>(size));
+        std::copy(content.begin(), content.end(), fileMapping.GetData());
+      }
+      EXPECT_EQ(ReadFile(filename), content);
+      DeleteFile(filename);
+    }
+  }
+
+  TEST(FileIoTest, UnbufferedReadWrite)
+  {
+    const std::string filename = RandomString();
+    const size_t fileSize = 3 * 1024 * 1024 + 1234;
+    const std::vector<uint8_t> content = RandomBuffer(fileSize);
+    {
+      _internal::FileWriter fileWriter(filename, true);
+      fileWriter.Preallocate(static_cast<int64_t>(fileSize));
+      // Aligned and unaligned pieces, out of order.
+      const size_t splits[] = {0, 100, 8192, 1024 * 1024, 1024 * 1024 + 4095, fileSize};
+      for (size_t i = 5; i > 0; --i)
+      {
+        const size_t offset = splits[i - 1];
+        const size_t length = splits[i] - offset;
+        _internal::AlignedBuffer buffer(length);
+        std::copy(
+            content.begin() + static_cast<ptrdiff_t>(offset),
+            content.begin() + static_cast<ptrdiff_t>(offset + length),
+            buffer.GetData());
+        fileWriter.Write(buffer.GetData(), length, static_cast<int64_t>(offset));
+      }
+    }
+    EXPECT_EQ(ReadFile(filename), content);
+
+    {
+      _internal::FileReader fileReader(filename, true);
+      EXPECT_EQ(fileReader.GetFileSize(), static_cast<int64_t>(fileSize));
+      _internal::AlignedBuffer buffer(fileSize + 10000);
+      EXPECT_EQ(fileReader.Read(buffer.GetData(), buffer.GetSize(), 0), fileSize);
+      EXPECT_EQ(std::vector<uint8_t>(buffer.GetData(), buffer.GetData() + fileSize), content);
+
+      EXPECT_EQ(fileReader.Read(buffer.GetData(), 5000, 4096), 5000U);
+      EXPECT_EQ(
+          std::vector<uint8_t>(buffer.GetData(), buffer.GetData() + 5000),
+          std::vector<uint8_t>(content.begin() + 4096, content.begin() + 9096));
+      EXPECT_EQ(fileReader.Read(buffer.GetData() + 1, 5000, 100), 5000U);
+      EXPECT_EQ(
+          std::vector<uint8_t>(buffer.GetData() + 1, buffer.GetData() + 5001),
+          std::vector<uint8_t>(content.begin() + 100, content.begin() + 5100));
+      EXPECT_EQ(fileReader.Read(buffer.GetData(), 8192, fileSize - 1234), 1234U);
+    }
+    DeleteFile(filename);
+  }
+
+  TEST(FileIoTest, WriteInPlace)
+  {
+    const std::string filename = RandomString();
+    std::vector<uint8_t> content = RandomBuffer(256 * 1024);
+    {
+      _internal::FileWriter fileWriter(filename);
+      fileWriter.Write(content.data(), content.size(), 0);
+    }
+    {
+      _internal::FileWriter fileWriter(filename, false, false);
+      fileWriter.Zero(4096, 128 * 1024);
+      fileWriter.Write(content.data(), 100, 200 * 1024);
+      fileWriter.SetSparseSize(300 * 1024);
+    }
+    std::fill(content.begin() + 4096, content.begin() + 4096 + 128 * 1024, uint8_t(0));
+    std::copy(content.begin(), content.begin() + 100, content.begin() + 200 * 1024);
+    content.resize(300 * 1024, 0);
+    EXPECT_EQ(ReadFile(filename), content);
+    DeleteFile(filename);
+  }
+
+  TEST(FileIoTest, FindNonZeroRanges)
+  {
+    std::vector<uint8_t> data(4096 + 100, 0);
+    data[0] = 1;
+    data[511] = 1;
+    data[1024 + 7] = 1;
+    data[1536] = 1;
+    data[4096 + 99] = 1;
+    std::vector<_internal::FileRange> ranges;
+    _internal::FindNonZeroRanges(data.data(), data.size(), 1000, ranges);
+    ASSERT_EQ(ranges.size(), 3U);
+    EXPECT_EQ(ranges[0].Offset, 1000);
+    EXPECT_EQ(ranges[0].Length, 512);
+    EXPECT_EQ(ranges[1].Offset, 1000 + 1024);
+    EXPECT_EQ(ranges[1].Length, 1024);
+    // The last block is shorter.
+    EXPECT_EQ(ranges[2].Offset, 1000 + 4096);
+    EXPECT_EQ(ranges[2].Length, 100);
+
+    ranges.clear();
+    const std::vector<uint8_t> zeros(2048, 0);
+    _internal::FindNonZeroRanges(zeros.data(), zeros.size(), 0, ranges);
+    EXPECT_TRUE(ranges.empty());
+  }
+
+  TEST(FileIoTest, GetDataRanges)
+  {
+    const std::string filename = RandomString();
+    const int64_t fileSize = 16 * 1024 * 1024;
+    const std::vector<uint8_t> content = RandomBuffer(4096);
+    const std::vector<int64_t> offsets = {0, 8 * 1024 * 1024, fileSize - 4096};
+    {
+      _internal::FileWriter fileWriter(filename);
+      fileWriter.SetSparseSize(fileSize);
+      for (int64_t offset : offsets)
+      {
+        fileWriter.Write(content.data(), content.size(), offset);
+      }
+    }
+    {
+      _internal::FileReader fileReader(filename);
+      const auto ranges = fileReader.GetDataRanges();
+      ASSERT_FALSE(ranges.empty());
+      // The ranges are in order, within the file, and hold the data written. Whether the holes
+      // are left out depends on the file system.
+      int64_t end = 0;
+      for (const auto& range : ranges)
+      {
+        EXPECT_GE(range.Offset, end);
+        EXPECT_GT(range.Length, 0);
+        end = range.Offset + range.Length;
+      }
+      EXPECT_LE(end, fileSize);
+      for (int64_t offset : offsets)
+      {
+        EXPECT_TRUE(std::any_of(
+            ranges.begin(), ranges.end(), [offset](const _internal::FileRange& range) {
+              return range.Offset <= offset && offset + 4096 <= range.Offset + range.Length;
+            }));
+      }
+    }
+    {
+      _internal::FileWriter fileWriter(filename);
+    }
+    EXPECT_TRUE(_internal::FileReader(filename).GetDataRanges().empty());
+    DeleteFile(filename);
+  }
+
+  TEST(FileIoTest, LocalDirectories)
+  {
+    const std::string directoryName = RandomString();
+    _internal::CreateLocalDirectories(directoryName + "/nested/leaf");
+    // Creating an existing directory is fine.
+    _internal::CreateLocalDirectories(directoryName + "/nested");
+    {
+      _internal::FileWriter fileWriter(directoryName + "/nested/file");
+      fileWriter.Write(reinterpret_cast<const uint8_t*>("abc"), 3, 0);
+    }
+
+    EXPECT_TRUE(_internal::ListLocalDirectory(directoryName + "/nested/leaf").empty());
+    auto entries = _internal::ListLocalDirectory(directoryName + "/nested");
+    std::sort(
+        entries.begin(),
+        entries.end(),
+        [](const _internal::LocalDirectoryEntry& lhs, const _internal::LocalDirectoryEntry& rhs) {
+          return lhs.Name < rhs.Name;
+        });
+    ASSERT_EQ(entries.size(), 2U);
+    EXPECT_EQ(entries[0].Name, "file");
+    EXPECT_FALSE(entries[0].IsDirectory);
+    EXPECT_EQ(entries[0].Size, 3);
+    EXPECT_GT(entries[0].LastWriteTime, 0);
+    EXPECT_EQ(
+        _internal::FileReader(directoryName + "/nested/file").GetLastWriteTime(),
+        entries[0].LastWriteTime);
+    EXPECT_EQ(entries[1].Name, "leaf");
+    EXPECT_TRUE(entries[1].IsDirectory);
+
+    EXPECT_THROW(_internal::ListLocalDirectory(directoryName + "/missing"), std::runtime_error);
+    EXPECT_THROW(
+        _internal::CreateLocalDirectories(directoryName + "/nested/file"), std::runtime_error);
+
+    DeleteFile(directoryName + "/nested/file");
+    DeleteFile(directoryName + "/nested/leaf");
+    DeleteFile(directoryName + "/nested");
+    DeleteFile(directoryName);
+  }
+
+}}} // namespace Azure::Storage::Test
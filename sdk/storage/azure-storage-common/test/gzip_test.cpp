@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/internal/gzip.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    std::vector<uint8_t> Compress(const uint8_t* data, size_t size)
+    {
+      std::vector<uint8_t> compressed(_internal::GzipMaxCompressedSize(size));
+      compressed.resize(
+          _internal::GzipCompress(data, size, compressed.data(), compressed.size()));
+      return compressed;
+    }
+
+    std::vector<uint8_t> Decompress(const std::vector<uint8_t>& compressed, size_t pieceSize)
+    {
+      std::vector<uint8_t> content;
+      _internal::GzipDecoder decoder;
+      for (size_t offset = 0; offset < compressed.size(); offset += pieceSize)
+      {
+        decoder.Decode(
+            compressed.data() + offset,
+            std::min(pieceSize, compressed.size() - offset),
+            [&content](const uint8_t* data, size_t size) {
+              content.insert(content.end(), data, data + size);
+            });
+      }
+      decoder.Finish();
+      return content;
+    }
+  } // namespace
+
+  TEST(GzipTest, RoundTrip)
+  {
+    std::vector<uint8_t> content = RandomBuffer(1024 * 1024);
+    // Makes a part of the content compressible.
+    std::fill(content.begin(), content.begin() + 512 * 1024, static_cast<uint8_t>('a'));
+
+    const auto compressed = Compress(content.data(), content.size());
+    EXPECT_LT(compressed.size(), content.size());
+    EXPECT_EQ(Decompress(compressed, compressed.size()), content);
+    EXPECT_EQ(Decompress(compressed, 1000), content);
+
+    EXPECT_TRUE(Decompress(Compress(nullptr, 0), 1000).empty());
+  }
+
+  TEST(GzipTest, MultipleMembers)
+  {
+    const std::vector<uint8_t> content = RandomBuffer(300 * 1024);
+
+    std::vector<uint8_t> compressed;
+    for (size_t offset = 0; offset < content.size(); offset += 100 * 1024)
+    {
+      const auto member = Compress(content.data() + offset, 100 * 1024);
+      compressed.insert(compressed.end(), member.begin(), member.end());
+    }
+    EXPECT_EQ(Decompress(compressed, compressed.size()), content);
+    EXPECT_EQ(Decompress(compressed, 777), content);
+  }
+
+  TEST(GzipTest, TruncatedContent)
+  {
+    const std::vector<uint8_t> content = RandomBuffer(64 * 1024);
+    auto compressed = Compress(content.data(), content.size());
+    compressed.resize(compressed.size() - 1);
+    EXPECT_THROW(Decompress(compressed, compressed.size()), std::runtime_error);
+
+    compressed[0] = 0;
+    EXPECT_THROW(Decompress(compressed, compressed.size()), std::runtime_error);
+  }
+
+}}} // namespace Azure::Storage::Test
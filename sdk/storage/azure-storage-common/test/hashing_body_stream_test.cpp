@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/hashing_body_stream.hpp>
+
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(HashingBodyStreamTest, HashesBytesRead)
+  {
+    const std::vector<uint8_t> content = RandomBuffer(static_cast<size_t>(100_KB + 7));
+    std::vector<uint8_t> buffer(content.size());
+
+    Azure::Core::IO::MemoryBodyStream inner(content);
+    _internal::HashingBodyStream stream(inner, HashAlgorithm::Crc64);
+    EXPECT_EQ(stream.Length(), static_cast<int64_t>(content.size()));
+    // A retry rewinds the stream after a partial read.
+    stream.Read(buffer.data(), 1000);
+    stream.Rewind();
+    EXPECT_EQ(stream.ReadToCount(buffer.data(), buffer.size()), content.size());
+    EXPECT_EQ(buffer, content);
+    auto hash = stream.GetHash();
+    EXPECT_EQ(hash.Algorithm, HashAlgorithm::Crc64);
+    EXPECT_EQ(hash.Value, Crc64Hash().Final(content.data(), content.size()));
+
+    inner.Rewind();
+    _internal::HashingBodyStream md5Stream(inner, HashAlgorithm::Md5);
+    md5Stream.ReadToEnd();
+    hash = md5Stream.GetHash();
+    EXPECT_EQ(hash.Algorithm, HashAlgorithm::Md5);
+    EXPECT_EQ(
+        hash.Value, Azure::Core::Cryptography::Md5Hash().Final(content.data(), content.size()));
+  }
+
+}}} // namespace Azure::Storage::Test
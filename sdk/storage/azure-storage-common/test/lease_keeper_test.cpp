@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/lease_keeper.hpp>
+#include <azure/storage/common/storage_exception.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(LeaseKeeperTest, RenewsLeases)
+  {
+    LeaseKeeperOptions options;
+    // The renewals are due hundreds of ticks ahead, in the second level of the wheel.
+    options.TickInterval = std::chrono::milliseconds(1);
+    options.MaxJitter = std::chrono::milliseconds(50);
+    options.MaxConcurrentRenewals = 4;
+    LeaseKeeper leaseKeeper(options);
+
+    // With a duration of 1 second, the leases are renewed every half second or so.
+    std::vector<std::unique_ptr<std::atomic<int>>> numRenewals;
+    std::vector<int64_t> leaseKeys;
+    for (int i = 0; i < 100; ++i)
+    {
+      numRenewals.push_back(std::make_unique<std::atomic<int>>(0));
+      auto& counter = *numRenewals.back();
+      leaseKeys.push_back(leaseKeeper.AddLease(
+          [&counter](const Azure::Core::Context&) { ++counter; }, std::chrono::seconds(1)));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1300));
+    for (auto& counter : numRenewals)
+    {
+      EXPECT_GE(*counter, 2);
+      EXPECT_LE(*counter, 3);
+    }
+
+    for (auto leaseKey : leaseKeys)
+    {
+      leaseKeeper.RemoveLease(leaseKey);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    std::vector<int> renewalsAfterRemoval;
+    for (auto& counter : numRenewals)
+    {
+      renewalsAfterRemoval.push_back(*counter);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(700));
+    for (size_t i = 0; i < numRenewals.size(); ++i)
+    {
+      EXPECT_EQ(*numRenewals[i], renewalsAfterRemoval[i]);
+    }
+
+    EXPECT_THROW(
+        leaseKeeper.AddLease([](const Azure::Core::Context&) {}, std::chrono::seconds(-1)),
+        std::invalid_argument);
+  }
+
+  TEST(LeaseKeeperTest, ReportsLostLeases)
+  {
+    LeaseKeeperOptions options;
+    options.TickInterval = std::chrono::milliseconds(10);
+    options.RetryDelay = std::chrono::milliseconds(50);
+    LeaseKeeper leaseKeeper(options);
+
+    // A transient failure is retried, a client error loses the lease.
+    std::atomic<int> numTransientRenewals{0};
+    std::atomic<int> numTransientLost{0};
+    leaseKeeper.AddLease(
+        [&](const Azure::Core::Context&) {
+          if (++numTransientRenewals == 1)
+          {
+            throw std::runtime_error("connection reset");
+          }
+        },
+        std::chrono::seconds(1),
+        [&](std::exception_ptr) { ++numTransientLost; });
+
+    std::atomic<int> numBrokenRenewals{0};
+    std::atomic<int> numBrokenLost{0};
+    Azure::Core::Http::HttpStatusCode lostStatusCode = Azure::Core::Http::HttpStatusCode::None;
+    leaseKeeper.AddLease(
+        [&](const Azure::Core::Context&) {
+          ++numBrokenRenewals;
+          StorageException e("The lease ID specified did not match the lease ID for the blob.");
+          e.StatusCode = Azure::Core::Http::HttpStatusCode::Conflict;
+          throw e;
+        },
+        std::chrono::seconds(1),
+        [&](std::exception_ptr error) {
+          try
+          {
+            std::rethrow_exception(error);
+          }
+          catch (const StorageException& e)
+          {
+            lostStatusCode = e.StatusCode;
+          }
+          ++numBrokenLost;
+        });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1300));
+    EXPECT_GE(numTransientRenewals, 3);
+    EXPECT_EQ(numTransientLost, 0);
+    EXPECT_EQ(numBrokenRenewals, 1);
+    EXPECT_EQ(numBrokenLost, 1);
+    leaseKeeper.Stop();
+    EXPECT_EQ(lostStatusCode, Azure::Core::Http::HttpStatusCode::Conflict);
+  }
+
+}}} // namespace Azure::Storage::Test
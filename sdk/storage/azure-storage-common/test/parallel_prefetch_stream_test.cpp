@@ -0,0 +1,172 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/internal/parallel_prefetch_stream.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <azure/core/io/body_stream.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    // A memory body stream owning its content.
+    class VectorBodyStream final : public Azure::Core::IO::BodyStream {
+    public:
+      explicit VectorBodyStream(std::vector<uint8_t> data)
+          : m_data(std::move(data)), m_stream(m_data)
+      {
+      }
+
+      int64_t Length() const override { return m_stream.Length(); }
+
+    private:
+      std::vector<uint8_t> m_data;
+      Azure::Core::IO::MemoryBodyStream m_stream;
+
+      size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override
+      {
+        return m_stream.Read(buffer, count, context);
+      }
+    };
+
+    std::vector<uint8_t> MakeContent(size_t size)
+    {
+      std::vector<uint8_t> content(size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        content[i] = static_cast<uint8_t>(i * 7 + i / 256);
+      }
+      return content;
+    }
+
+    std::unique_ptr<Azure::Core::IO::BodyStream> MakeStream(
+        const std::vector<uint8_t>& content,
+        int64_t offset,
+        int64_t length)
+    {
+      return std::make_unique<VectorBodyStream>(std::vector<uint8_t>(
+          content.begin() + static_cast<ptrdiff_t>(offset),
+          content.begin() + static_cast<ptrdiff_t>(offset + length)));
+    }
+  } // namespace
+
+  TEST(ParallelPrefetchBodyStreamTest, ReadsRangeInOrder)
+  {
+    const auto content = MakeContent(100000);
+    const int64_t offset = 123;
+    const int64_t length = 90000;
+    for (int32_t concurrency : {1, 3, 8})
+    {
+      std::atomic<int> inFlight{0};
+      std::atomic<int> maxInFlight{0};
+      _internal::ParallelPrefetchStreamOptions options;
+      options.ChunkSize = 4096;
+      options.Concurrency = concurrency;
+      _internal::ParallelPrefetchBodyStream stream(
+          MakeStream(content, offset, 5000),
+          offset,
+          length,
+          options,
+          [&](int64_t chunkOffset, int64_t chunkLength, Azure::Core::Context const&) {
+            int current = ++inFlight;
+            int previousMax = maxInFlight;
+            while (current > previousMax
+                   && !maxInFlight.compare_exchange_weak(previousMax, current))
+            {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            --inFlight;
+            return MakeStream(content, chunkOffset, chunkLength);
+          },
+          Azure::Core::Context());
+      EXPECT_EQ(stream.Length(), length);
+
+      std::vector<uint8_t> read;
+      std::vector<uint8_t> buffer(1000);
+      while (true)
+      {
+        auto bytesRead = stream.Read(buffer.data(), buffer.size());
+        if (bytesRead == 0)
+        {
+          break;
+        }
+        read.insert(read.end(), buffer.begin(), buffer.begin() + bytesRead);
+      }
+      EXPECT_EQ(
+          read,
+          std::vector<uint8_t>(
+              content.begin() + offset, content.begin() + static_cast<ptrdiff_t>(offset + length)));
+      EXPECT_LE(maxInFlight, concurrency);
+    }
+  }
+
+  TEST(ParallelPrefetchBodyStreamTest, FetchErrorRethrown)
+  {
+    const auto content = MakeContent(10000);
+    _internal::ParallelPrefetchStreamOptions options;
+    options.ChunkSize = 1000;
+    options.Concurrency = 2;
+    _internal::ParallelPrefetchBodyStream stream(
+        MakeStream(content, 0, 1000),
+        0,
+        10000,
+        options,
+        [&](int64_t chunkOffset,
+            int64_t chunkLength,
+            Azure::Core::Context const&) -> std::unique_ptr<Azure::Core::IO::BodyStream> {
+          if (chunkOffset == 3000)
+          {
+            throw std::runtime_error("fetch failed");
+          }
+          return MakeStream(content, chunkOffset, chunkLength);
+        },
+        Azure::Core::Context());
+
+    std::vector<uint8_t> buffer(3000);
+    EXPECT_EQ(stream.ReadToCount(buffer.data(), buffer.size()), 3000U);
+    EXPECT_THROW(stream.Read(buffer.data(), buffer.size()), std::runtime_error);
+  }
+
+  TEST(ParallelPrefetchBodyStreamTest, DestroyCancelsFetches)
+  {
+    const auto content = MakeContent(10000);
+    std::atomic<int> numStarted{0};
+    std::atomic<int> numCancelled{0};
+    {
+      _internal::ParallelPrefetchStreamOptions options;
+      options.ChunkSize = 1000;
+      options.Concurrency = 4;
+      _internal::ParallelPrefetchBodyStream stream(
+          MakeStream(content, 0, 1000),
+          0,
+          10000,
+          options,
+          [&](int64_t chunkOffset, int64_t chunkLength, Azure::Core::Context const& context) {
+            ++numStarted;
+            while (!context.IsCancelled())
+            {
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            ++numCancelled;
+            return MakeStream(content, chunkOffset, chunkLength);
+          },
+          Azure::Core::Context());
+      std::vector<uint8_t> buffer(1000);
+      EXPECT_EQ(stream.ReadToCount(buffer.data(), buffer.size()), 1000U);
+      while (numStarted != 4)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+    EXPECT_EQ(numCancelled, 4);
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of computing the HMAC-SHA256 of a buffer.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+#include <azure/storage/common/crypt.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  /**
+   * @brief A test to measure computing the HMAC-SHA256 used for the shared key signatures and the
+   * SAS tokens, with the key schedule computed once as done for a credential.
+   *
+   * @remark With `--parallel 1`, the throughput reported is the one of a core.
+   */
+  class HmacSha256Sign : public Azure::Perf::PerfTest {
+  private:
+    std::vector<uint8_t> m_buffer;
+    std::unique_ptr<Azure::Storage::_internal::HmacSha256Context> m_context;
+
+  public:
+    /**
+     * @brief Construct a new HmacSha256Sign test.
+     *
+     * @param options The test options.
+     */
+    HmacSha256Sign(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief The size of the buffer is defined by a mandatory parameter.
+     *
+     */
+    void Setup() override
+    {
+      long size = m_options.GetMandatoryOption<long>("Size");
+
+      m_buffer.resize(size);
+      for (size_t i = 0; i < m_buffer.size(); ++i)
+      {
+        m_buffer[i] = static_cast<uint8_t>(i * 2654435761U >> 13);
+      }
+      m_context = std::make_unique<Azure::Storage::_internal::HmacSha256Context>(
+          std::vector<uint8_t>(64, 0x5a));
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      m_context->Sign(m_buffer.data(), m_buffer.size());
+    }
+
+    /**
+     * @brief Gets the size of the buffer.
+     *
+     */
+    int64_t GetBytesPerOperation() override { return static_cast<int64_t>(m_buffer.size()); }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {{"Size", {"--size"}, "Size of the buffer (in bytes)", 1, true}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "HmacSha256Sign",
+          "Compute the HMAC-SHA256 of a buffer.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Storage::Test::HmacSha256Sign>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,256 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the overhead of the HTTP pipeline of a client.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/credentials/credentials.hpp>
+#include <azure/core/http/http.hpp>
+#include <azure/core/http/policies/policy.hpp>
+#include <azure/core/http/transport.hpp>
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/core/io/body_stream.hpp>
+#include <azure/perf.hpp>
+#include <azure/storage/common/internal/shared_key_policy.hpp>
+#include <azure/storage/common/storage_credential.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  /**
+   * @brief A test to measure the fixed cost of sending a request through the policies of a client
+   * pipeline, with a transport returning a response without any I/O.
+   *
+   * @remark The pipeline has the policies of the storage clients: request ID, telemetry, retry,
+   * authentication with a bearer token or a shared key, and log. With `--breakdown 1`, the time
+   * spent in each policy, excluding the policies after it, is printed at the end of the test.
+   */
+  class PipelineOverhead : public Azure::Perf::PerfTest {
+  private:
+    class NullTransport final : public Azure::Core::Http::HttpTransport {
+    public:
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Http::Request&,
+          Azure::Core::Context const&) override
+      {
+        auto response = std::make_unique<Azure::Core::Http::RawResponse>(
+            1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+        response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(nullptr, 0));
+        return response;
+      }
+    };
+
+    class StaticTokenCredential final : public Azure::Core::Credentials::TokenCredential {
+    public:
+      Azure::Core::Credentials::AccessToken GetToken(
+          Azure::Core::Credentials::TokenRequestContext const&,
+          Azure::Core::Context const&) const override
+      {
+        return {"token", std::chrono::system_clock::now() + std::chrono::hours(24)};
+      }
+    };
+
+    // Sums the time spent in the policies and their calls, per index in the pipeline.
+    class PipelineObserver final
+        : public Azure::Core::Http::Policies::_internal::HttpPolicyObserver {
+    public:
+      static constexpr size_t MaxPolicyCount = 16;
+
+      std::array<std::atomic<int64_t>, MaxPolicyCount> Nanoseconds{};
+      std::array<std::atomic<int64_t>, MaxPolicyCount> Calls{};
+
+      void OnPolicyCalled(
+          Azure::Core::Http::Policies::HttpPolicy const&,
+          size_t index,
+          std::chrono::nanoseconds elapsed) override
+      {
+        if (index < MaxPolicyCount)
+        {
+          Nanoseconds[index] += elapsed.count();
+          ++Calls[index];
+        }
+      }
+    };
+
+    static PipelineObserver& GetObserver()
+    {
+      static PipelineObserver observer;
+      return observer;
+    }
+
+    std::vector<std::string> m_policyNames;
+    std::unique_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    bool m_breakdown = false;
+
+    void CreatePipeline()
+    {
+      using namespace Azure::Core::Http::Policies;
+      using namespace Azure::Core::Http::Policies::_internal;
+
+      auto const auth = m_options.GetOptionOrDefault<std::string>("Auth", "sharedkey");
+      std::vector<std::unique_ptr<HttpPolicy>> policies;
+      m_policyNames.clear();
+      policies.emplace_back(std::make_unique<RequestIdPolicy>());
+      m_policyNames.emplace_back("RequestIdPolicy");
+      policies.emplace_back(std::make_unique<TelemetryPolicy>("storage-common-perf", "1.0.0"));
+      m_policyNames.emplace_back("TelemetryPolicy");
+      policies.emplace_back(std::make_unique<RetryPolicy>(RetryOptions()));
+      m_policyNames.emplace_back("RetryPolicy");
+      if (auth == "bearer")
+      {
+        Azure::Core::Credentials::TokenRequestContext tokenRequestContext;
+        tokenRequestContext.Scopes = {"https://storage.azure.com/.default"};
+        policies.emplace_back(std::make_unique<BearerTokenAuthenticationPolicy>(
+            std::make_shared<StaticTokenCredential>(), tokenRequestContext));
+        m_policyNames.emplace_back("BearerTokenAuthenticationPolicy");
+      }
+      else if (auth == "sharedkey")
+      {
+        policies.emplace_back(std::make_unique<Azure::Storage::_internal::SharedKeyPolicy>(
+            std::make_shared<Azure::Storage::StorageSharedKeyCredential>(
+                "account",
+                "S2V5IG9mIHRoZSBhY2NvdW50IHVzZWQgZm9yIHRoZSBwZXJmb3JtYW5jZSB0ZXN0cy4=")));
+        m_policyNames.emplace_back("SharedKeyPolicy");
+      }
+      else if (auth != "none")
+      {
+        throw std::invalid_argument("Unknown authentication " + auth + ".");
+      }
+      policies.emplace_back(std::make_unique<LogPolicy>(LogOptions()));
+      m_policyNames.emplace_back("LogPolicy");
+      TransportOptions transportOptions;
+      transportOptions.Transport = std::make_shared<NullTransport>();
+      policies.emplace_back(std::make_unique<TransportPolicy>(transportOptions));
+      m_policyNames.emplace_back("TransportPolicy");
+      m_pipeline = std::make_unique<Azure::Core::Http::_internal::HttpPipeline>(policies);
+    }
+
+  public:
+    /**
+     * @brief Construct a new PipelineOverhead test.
+     *
+     * @param options The test options.
+     */
+    PipelineOverhead(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Starts observing the policies when the breakdown is requested.
+     *
+     */
+    void GlobalSetup() override
+    {
+      m_breakdown = m_options.GetOptionOrDefault<bool>("Breakdown", false);
+      if (m_breakdown)
+      {
+        Azure::Core::Http::Policies::_internal::HttpPolicyObserver::Install(&GetObserver());
+      }
+    }
+
+    /**
+     * @brief Set up the pipeline.
+     *
+     */
+    void Setup() override { CreatePipeline(); }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      Azure::Core::Http::Request request(
+          Azure::Core::Http::HttpMethod::Get,
+          Azure::Core::Url("https://account.blob.core.windows.net/container/blob"));
+      request.SetHeader("x-ms-version", "2020-08-04");
+      m_pipeline->Send(request, context);
+    }
+
+    /**
+     * @brief Prints the time spent in each policy, excluding the policies after it.
+     *
+     */
+    void GlobalCleanup() override
+    {
+      if (!m_breakdown)
+      {
+        return;
+      }
+      Azure::Core::Http::Policies::_internal::HttpPolicyObserver::Install(nullptr);
+      if (m_policyNames.empty())
+      {
+        CreatePipeline();
+      }
+
+      auto& observer = GetObserver();
+      auto const requests = observer.Calls[0].load();
+      if (requests == 0)
+      {
+        return;
+      }
+      std::cout << "=== Pipeline Breakdown ===" << std::endl
+                << std::left << std::setw(32) << "Policy"
+                << "Calls/request\tns/request" << std::endl;
+      for (size_t i = 0; i < m_policyNames.size() && i < PipelineObserver::MaxPolicyCount; ++i)
+      {
+        auto selfNanoseconds = observer.Nanoseconds[i].load();
+        if (i + 1 < PipelineObserver::MaxPolicyCount)
+        {
+          selfNanoseconds -= observer.Nanoseconds[i + 1].load();
+        }
+        std::cout << std::left << std::setw(32) << m_policyNames[i] << std::fixed
+                  << std::setprecision(2)
+                  << static_cast<double>(observer.Calls[i].load()) / requests << "\t\t"
+                  << static_cast<double>(selfNanoseconds) / requests << std::endl;
+      }
+      std::cout << std::endl;
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Auth",
+           {"--auth"},
+           "Authentication policy, bearer, sharedkey or none. Default to sharedkey.",
+           1},
+          {"Breakdown",
+           {"--breakdown"},
+           "Print the time spent in each policy. Default to false.",
+           1}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "PipelineOverhead",
+          "Send a request through the policies of a client to a transport without I/O.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Storage::Test::PipelineOverhead>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of signing a request with a shared key.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/http/http.hpp>
+#include <azure/core/http/policies/policy.hpp>
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/perf.hpp>
+#include <azure/storage/common/internal/shared_key_policy.hpp>
+#include <azure/storage/common/storage_credential.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  /**
+   * @brief A test to measure signing a request with a shared key, as done for every request of a
+   * client constructed with a #Azure::Storage::StorageSharedKeyCredential.
+   *
+   * @remark The request is the one staging a block, sent through the shared key policy to a policy
+   * returning a response without any I/O. The time of an operation includes the creation of that
+   * response.
+   */
+  class SharedKeySignature : public Azure::Perf::PerfTest {
+  private:
+    class NoOpTransportPolicy final : public Azure::Core::Http::Policies::HttpPolicy {
+    public:
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Http::Request&,
+          Azure::Core::Http::Policies::NextHttpPolicy,
+          Azure::Core::Context const&) const override
+      {
+        return std::make_unique<Azure::Core::Http::RawResponse>(
+            1, 1, Azure::Core::Http::HttpStatusCode::Created, "Created");
+      }
+
+      std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy> Clone() const override
+      {
+        return std::make_unique<NoOpTransportPolicy>(*this);
+      }
+    };
+
+    std::unique_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    std::unique_ptr<Azure::Core::Http::Request> m_request;
+
+  public:
+    /**
+     * @brief Construct a new SharedKeySignature test.
+     *
+     * @param options The test options.
+     */
+    SharedKeySignature(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Set up the pipeline and the request.
+     *
+     */
+    void Setup() override
+    {
+      auto credential = std::make_shared<Azure::Storage::StorageSharedKeyCredential>(
+          "account", "S2V5IG9mIHRoZSBhY2NvdW50IHVzZWQgZm9yIHRoZSBwZXJmb3JtYW5jZSB0ZXN0cy4=");
+      std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+      policies.emplace_back(
+          std::make_unique<Azure::Storage::_internal::SharedKeyPolicy>(credential));
+      policies.emplace_back(std::make_unique<NoOpTransportPolicy>());
+      m_pipeline = std::make_unique<Azure::Core::Http::_internal::HttpPipeline>(policies);
+
+      m_request = std::make_unique<Azure::Core::Http::Request>(
+          Azure::Core::Http::HttpMethod::Put,
+          Azure::Core::Url("https://account.blob.core.windows.net/container/folder/blob?comp=block"
+                           "&blockid=MDAwMDAwMDAwMDAwMDAwMDAwMDAwMDAwMDAwMDAwMDA%3D"));
+      m_request->SetHeader("Content-Length", "4194304");
+      m_request->SetHeader("Content-Type", "application/octet-stream");
+      m_request->SetHeader("x-ms-client-request-id", "c9bf1c2a-7f1d-4b8a-9a3e-5f0d8e6b1c2d");
+      m_request->SetHeader("x-ms-date", "Tue, 15 Nov 1994 08:12:31 GMT");
+      m_request->SetHeader("x-ms-version", "2020-08-04");
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_pipeline->Send(*m_request, context);
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "SharedKeySignature",
+          "Sign a request with a shared key.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Storage::Test::SharedKeySignature>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Storage::Test
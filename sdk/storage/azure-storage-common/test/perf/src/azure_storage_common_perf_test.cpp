@@ -0,0 +1,22 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/perf.hpp>
+
+#include "azure/storage/common/test/hmac_sha256_test.hpp"
+#include "azure/storage/common/test/pipeline_overhead_test.hpp"
+#include "azure/storage/common/test/shared_key_signature_test.hpp"
+
+int main(int argc, char** argv)
+{
+
+  // Create the test list
+  std::vector<Azure::Perf::TestMetadata> tests{
+      Azure::Storage::Test::HmacSha256Sign::GetTestMetadata(),
+      Azure::Storage::Test::PipelineOverhead::GetTestMetadata(),
+      Azure::Storage::Test::SharedKeySignature::GetTestMetadata()};
+
+  Azure::Perf::Program::Run(Azure::Core::Context::ApplicationContext, tests, argc, argv);
+
+  return 0;
+}
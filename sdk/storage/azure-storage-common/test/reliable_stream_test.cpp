@@ -0,0 +1,165 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/internal/reliable_stream.hpp>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <azure/core/io/body_stream.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    enum class StreamBehavior
+    {
+      Fast,
+      Slow,
+      Blocked,
+      Failing,
+    };
+
+    // Reads a part of the content, as the body stream of a range download.
+    class RangeBodyStream final : public Azure::Core::IO::BodyStream {
+    public:
+      RangeBodyStream(const std::vector<uint8_t>& content, int64_t offset, StreamBehavior behavior)
+          : m_content(content), m_offset(offset), m_behavior(behavior)
+      {
+      }
+
+      int64_t Length() const override
+      {
+        return static_cast<int64_t>(m_content.size()) - m_offset;
+      }
+
+    private:
+      const std::vector<uint8_t>& m_content;
+      int64_t m_offset;
+      StreamBehavior m_behavior;
+
+      size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override
+      {
+        switch (m_behavior)
+        {
+          case StreamBehavior::Slow:
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            count = std::min(count, size_t(1));
+            break;
+          case StreamBehavior::Blocked:
+            while (true)
+            {
+              context.ThrowIfCancelled();
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+          case StreamBehavior::Failing:
+            throw std::runtime_error("Connection reset.");
+          default:;
+        }
+        count = std::min(count, static_cast<size_t>(m_content.size() - m_offset));
+        std::copy(m_content.begin() + m_offset, m_content.begin() + m_offset + count, buffer);
+        m_offset += static_cast<int64_t>(count);
+        return count;
+      }
+    };
+
+    std::vector<uint8_t> MakeContent(size_t size)
+    {
+      std::vector<uint8_t> content(size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        content[i] = static_cast<uint8_t>(i * 7 + i / 256);
+      }
+      return content;
+    }
+
+    _internal::ReliableStreamOptions MakeOptions()
+    {
+      _internal::ReliableStreamOptions options;
+      options.MaxRetryRequests = 3;
+      options.RetryDelay = std::chrono::milliseconds(10);
+      options.MinBytesPerSecond = 64 * 1024;
+      options.StallWindow = std::chrono::milliseconds(50);
+      return options;
+    }
+  } // namespace
+
+  TEST(ReliableStreamTest, ReconnectsSlowStream)
+  {
+    const auto content = MakeContent(100000);
+    std::vector<int64_t> reconnectOffsets;
+    _internal::ReliableStream stream(
+        std::make_unique<RangeBodyStream>(content, 0, StreamBehavior::Slow),
+        MakeOptions(),
+        [&](int64_t offset, Azure::Core::Context const&) {
+          reconnectOffsets.push_back(offset);
+          return std::make_unique<RangeBodyStream>(content, offset, StreamBehavior::Fast);
+        });
+
+    EXPECT_EQ(stream.ReadToEnd(), content);
+    ASSERT_EQ(reconnectOffsets.size(), 1U);
+    EXPECT_GT(reconnectOffsets[0], 0);
+  }
+
+  TEST(ReliableStreamTest, ReconnectsBlockedStream)
+  {
+    const auto content = MakeContent(1000);
+    int reconnectCount = 0;
+    _internal::ReliableStream stream(
+        std::make_unique<RangeBodyStream>(content, 0, StreamBehavior::Blocked),
+        MakeOptions(),
+        [&](int64_t offset, Azure::Core::Context const&) {
+          ++reconnectCount;
+          return std::make_unique<RangeBodyStream>(content, offset, StreamBehavior::Fast);
+        });
+
+    EXPECT_EQ(stream.ReadToEnd(), content);
+    EXPECT_EQ(reconnectCount, 1);
+  }
+
+  TEST(ReliableStreamTest, BacksOffBetweenRetries)
+  {
+    const auto content = MakeContent(1000);
+    int reconnectCount = 0;
+    _internal::ReliableStream stream(
+        std::make_unique<RangeBodyStream>(content, 0, StreamBehavior::Failing),
+        MakeOptions(),
+        [&](int64_t offset, Azure::Core::Context const&) {
+          ++reconnectCount;
+          return std::make_unique<RangeBodyStream>(content, offset, StreamBehavior::Failing);
+        });
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<uint8_t> buffer(100);
+    EXPECT_THROW(stream.Read(buffer.data(), buffer.size()), std::runtime_error);
+    // 10ms before the first retry, and 20ms before the second one.
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(30));
+    EXPECT_EQ(reconnectCount, 2);
+  }
+
+  TEST(ReliableStreamTest, CancelledReadIsNotRetried)
+  {
+    const auto content = MakeContent(1000);
+    int reconnectCount = 0;
+    _internal::ReliableStream stream(
+        std::make_unique<RangeBodyStream>(content, 0, StreamBehavior::Blocked),
+        MakeOptions(),
+        [&](int64_t offset, Azure::Core::Context const&) {
+          ++reconnectCount;
+          return std::make_unique<RangeBodyStream>(content, offset, StreamBehavior::Fast);
+        });
+
+    auto context = Azure::Core::Context::ApplicationContext.WithDeadline(
+        std::chrono::system_clock::now() + std::chrono::milliseconds(20));
+    std::vector<uint8_t> buffer(100);
+    EXPECT_THROW(
+        stream.Read(buffer.data(), buffer.size(), context),
+        Azure::Core::OperationCancelledException);
+    EXPECT_EQ(reconnectCount, 0);
+  }
+
+}}} // namespace Azure::Storage::Test
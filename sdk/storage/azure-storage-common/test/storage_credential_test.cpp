@@ -1,6 +1,10 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // SPDX-License-Identifier: MIT
 
+#include <azure/core/base64.hpp>
+#include <azure/core/http/policies/policy.hpp>
+#include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/shared_key_policy.hpp>
 #include <azure/storage/common/storage_credential.hpp>
 
 #include "test_base.hpp"
@@ -23,4 +27,83 @@ namespace Azure { namespace Storage { namespace Test {
         "testaccount.blob.core.windows.net");
   }
 
+  namespace {
+    class AuthorizationCapturePolicy final : public Azure::Core::Http::Policies::HttpPolicy {
+    public:
+      explicit AuthorizationCapturePolicy(std::shared_ptr<std::string> authorization)
+          : m_authorization(std::move(authorization))
+      {
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<AuthorizationCapturePolicy>(m_authorization);
+      }
+
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Http::Request& request,
+          Azure::Core::Http::Policies::NextHttpPolicy,
+          Azure::Core::Context const&) const override
+      {
+        *m_authorization = request.GetHeaders().at("authorization");
+        return std::make_unique<Azure::Core::Http::RawResponse>(
+            1, 1, Azure::Core::Http::HttpStatusCode::Created, "Created");
+      }
+
+    private:
+      std::shared_ptr<std::string> m_authorization;
+    };
+  } // namespace
+
+  TEST(StorageCredentialTest, SharedKeySignature)
+  {
+    const std::string accountKey1 = Azure::Core::Convert::Base64Encode(RandomBuffer(64));
+    const std::string accountKey2 = Azure::Core::Convert::Base64Encode(RandomBuffer(64));
+    auto credential = std::make_shared<StorageSharedKeyCredential>("account", accountKey1);
+
+    auto authorization = std::make_shared<std::string>();
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+    policies.push_back(std::make_unique<_internal::SharedKeyPolicy>(credential));
+    policies.push_back(std::make_unique<AuthorizationCapturePolicy>(authorization));
+
+    auto send = [&](const std::string& query = "?comp=block&BlockId=a%2Bb") {
+      Azure::Core::Http::Request request(
+          Azure::Core::Http::HttpMethod::Put,
+          Azure::Core::Url("https://account.blob.core.windows.net/container/blob" + query));
+      request.SetHeader("Content-Length", "5");
+      request.SetHeader("Content-Type", "application/octet-stream");
+      request.SetHeader("x-ms-version", "2020-08-04");
+      request.SetHeader("X-MS-Date", "Thu, 01 Jul 2021 00:00:00 GMT");
+      request.SetHeader("x-ms-blob-type", "BlockBlob");
+      policies[0]->Send(
+          request,
+          Azure::Core::Http::Policies::NextHttpPolicy(0, policies),
+          Azure::Core::Context::ApplicationContext);
+      return *authorization;
+    };
+
+    const std::string stringToSignPrefix = "PUT\n\n\n5\n\napplication/octet-stream\n\n\n\n\n\n\n"
+                                           "x-ms-blob-type:BlockBlob\n"
+                                           "x-ms-date:Thu, 01 Jul 2021 00:00:00 GMT\n"
+                                           "x-ms-version:2020-08-04\n"
+                                           "/account/container/blob\n";
+    auto expectedAuthorization = [&](const std::string& accountKey,
+                                     const std::string& canonicalizedQuery
+                                     = "blockid:a+b\ncomp:block") {
+      const std::string stringToSign = stringToSignPrefix + canonicalizedQuery;
+      return "SharedKey account:"
+          + Azure::Core::Convert::Base64Encode(_internal::HmacSha256(
+              std::vector<uint8_t>(stringToSign.begin(), stringToSign.end()),
+              Azure::Core::Convert::Base64Decode(accountKey)));
+    };
+
+    EXPECT_EQ(send(), expectedAuthorization(accountKey1));
+    EXPECT_EQ(send(), expectedAuthorization(accountKey1));
+    credential->Update(accountKey2);
+    EXPECT_EQ(send(), expectedAuthorization(accountKey2));
+    // The query parameters of the previous requests aren't signed again.
+    EXPECT_EQ(send("?comp=Block"), expectedAuthorization(accountKey2, "comp:Block"));
+    EXPECT_EQ(send(), expectedAuthorization(accountKey2));
+  }
+
 }}} // namespace Azure::Storage::Test
@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/storage/common/internal/storage_per_retry_policy.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    class NoResponsePolicy final : public Core::Http::Policies::HttpPolicy {
+    public:
+      std::unique_ptr<Core::Http::RawResponse> Send(
+          Core::Http::Request&,
+          Core::Http::Policies::NextHttpPolicy,
+          Core::Context const&) const override
+      {
+        return nullptr;
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<NoResponsePolicy>(*this);
+      }
+    };
+
+    Core::Http::_internal::HttpPipeline CreatePipeline()
+    {
+      std::vector<std::unique_ptr<Core::Http::Policies::HttpPolicy>> policies;
+      policies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
+      policies.emplace_back(std::make_unique<NoResponsePolicy>());
+      return Core::Http::_internal::HttpPipeline(policies);
+    }
+
+    Core::Context ContextWithDeadlineIn(std::chrono::milliseconds duration)
+    {
+      return Core::Context().WithDeadline(
+          Azure::DateTime(std::chrono::system_clock::now() + duration));
+    }
+
+    std::string GetTimeout(const Core::Http::Request& request)
+    {
+      const auto& queryParameters = request.GetUrl().GetQueryParameters();
+      auto ite = queryParameters.find("timeout");
+      return ite == queryParameters.end() ? std::string() : ite->second;
+    }
+  } // namespace
+
+  TEST(StoragePerRetryPolicyTest, DeadlineSetsTimeout)
+  {
+    auto pipeline = CreatePipeline();
+    Core::Http::Request request(
+        Core::Http::HttpMethod::Get, Core::Url("https://account.blob.core.windows.net/c/b"));
+
+    pipeline.Send(request, Core::Context());
+    EXPECT_TRUE(GetTimeout(request).empty());
+    EXPECT_FALSE(request.GetHeaders().at("x-ms-date").empty());
+
+    auto context = ContextWithDeadlineIn(std::chrono::milliseconds(20500));
+    pipeline.Send(request, context);
+    EXPECT_EQ(GetTimeout(request), "20");
+
+    // The remaining time shrinks on the next attempts.
+    context = ContextWithDeadlineIn(std::chrono::milliseconds(5500));
+    pipeline.Send(request, context);
+    EXPECT_EQ(GetTimeout(request), "5");
+
+    // An expired deadline still leaves a valid timeout.
+    context = ContextWithDeadlineIn(std::chrono::milliseconds(0));
+    pipeline.Send(request, context);
+    EXPECT_EQ(GetTimeout(request), "1");
+  }
+
+  TEST(StoragePerRetryPolicyTest, ShorterTimeoutKept)
+  {
+    auto pipeline = CreatePipeline();
+    Core::Http::Request request(
+        Core::Http::HttpMethod::Get, Core::Url("https://account.blob.core.windows.net/c/b"));
+    request.GetUrl().AppendQueryParameter("timeout", "10");
+
+    pipeline.Send(request, Core::Context());
+    EXPECT_EQ(GetTimeout(request), "10");
+
+    auto context = ContextWithDeadlineIn(std::chrono::milliseconds(60500));
+    pipeline.Send(request, context);
+    EXPECT_EQ(GetTimeout(request), "10");
+
+    context = ContextWithDeadlineIn(std::chrono::milliseconds(3500));
+    pipeline.Send(request, context);
+    EXPECT_EQ(GetTimeout(request), "3");
+  }
+
+}}} // namespace Azure::Storage::Test
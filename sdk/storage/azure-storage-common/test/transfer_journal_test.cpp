@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/transfer_journal.hpp>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(TransferJournalTest, FileJournal)
+  {
+    const std::string filename = RandomString();
+    FileTransferJournal journal(filename);
+    EXPECT_TRUE(journal.ReadRecords().empty());
+
+    journal.AppendRecord("transfer");
+    journal.AppendRecord("chunk 1");
+    EXPECT_EQ(journal.ReadRecords(), std::vector<std::string>({"transfer", "chunk 1"}));
+
+    // A record cut short isn't read back.
+    {
+      std::ofstream file(filename, std::ios::out | std::ios::app);
+      file << "chun";
+    }
+    EXPECT_EQ(journal.ReadRecords(), std::vector<std::string>({"transfer", "chunk 1"}));
+
+    journal.Clear();
+    EXPECT_TRUE(journal.ReadRecords().empty());
+    EXPECT_FALSE(std::ifstream(filename).good());
+  }
+
+  TEST(TransferJournalTest, ResumeProgress)
+  {
+    const std::string filename = RandomString();
+    auto journal = std::make_shared<FileTransferJournal>(filename);
+    {
+      _internal::TransferProgress progress(journal, "transfer 1");
+      EXPECT_FALSE(progress.IsResumed());
+      progress.OnChunkDone(0);
+      progress.OnChunkDone(2);
+    }
+    {
+      _internal::TransferProgress progress(journal, "transfer 1");
+      EXPECT_TRUE(progress.IsResumed());
+      EXPECT_TRUE(progress.IsChunkDone(0));
+      EXPECT_FALSE(progress.IsChunkDone(1));
+      EXPECT_TRUE(progress.IsChunkDone(2));
+      progress.OnChunkDone(1);
+    }
+    {
+      // Another transfer starts over.
+      _internal::TransferProgress progress(journal, "transfer 2");
+      EXPECT_FALSE(progress.IsResumed());
+      EXPECT_FALSE(progress.IsChunkDone(0));
+      progress.OnChunkDone(3);
+      EXPECT_EQ(journal->ReadRecords(), std::vector<std::string>({"transfer 2", "chunk 3"}));
+      progress.OnTransferDone();
+    }
+    EXPECT_TRUE(journal->ReadRecords().empty());
+
+    _internal::TransferProgress progress(nullptr, "transfer 3");
+    EXPECT_FALSE(progress.IsResumed());
+    progress.OnChunkDone(0);
+    progress.OnTransferDone();
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,170 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
+#include <azure/storage/common/transfer_scheduler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(TransferSchedulerTest, ChunksBoundedAcrossOperations)
+  {
+    TransferSchedulerOptions options;
+    options.MaxConcurrentChunks = 3;
+    TransferScheduler scheduler(options);
+
+    std::atomic<int> inFlight{0};
+    std::atomic<int> maxInFlight{0};
+    std::atomic<int> numChunksTransferred{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+      threads.emplace_back([&]() {
+        _internal::ConcurrentTransfer(
+            0,
+            32,
+            1,
+            8,
+            [&](int64_t, int64_t, int64_t, int64_t) {
+              int current = ++inFlight;
+              int previousMax = maxInFlight;
+              while (current > previousMax
+                     && !maxInFlight.compare_exchange_weak(previousMax, current))
+              {
+              }
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+              --inFlight;
+              ++numChunksTransferred;
+            },
+            &scheduler);
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    EXPECT_EQ(numChunksTransferred, 4 * 32);
+    EXPECT_LE(maxInFlight, 3);
+  }
+
+  TEST(TransferSchedulerTest, FreedSlotGoesToOperationWithFewestChunks)
+  {
+    TransferSchedulerOptions options;
+    options.MaxConcurrentChunks = 2;
+    TransferScheduler scheduler(options);
+    int operationA = 0;
+    int operationB = 0;
+
+    auto slotA1 = std::make_unique<_internal::TransferChunkSlot>(&scheduler, &operationA, 1);
+    auto slotA2 = std::make_unique<_internal::TransferChunkSlot>(&scheduler, &operationA, 1);
+
+    std::mutex mutex;
+    std::vector<const void*> grantOrder;
+    auto waitForSlot = [&](const void* operation) {
+      _internal::TransferChunkSlot slot(&scheduler, operation, 1);
+      std::lock_guard<std::mutex> lock(mutex);
+      grantOrder.push_back(operation);
+    };
+
+    // Operation A starts waiting first, but B has no chunk in flight.
+    std::thread waiterA(waitForSlot, &operationA);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    std::thread waiterB(waitForSlot, &operationB);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      EXPECT_TRUE(grantOrder.empty());
+    }
+
+    slotA1.reset();
+    waiterB.join();
+    slotA2.reset();
+    waiterA.join();
+
+    ASSERT_EQ(grantOrder.size(), 2U);
+    EXPECT_EQ(grantOrder[0], &operationB);
+    EXPECT_EQ(grantOrder[1], &operationA);
+  }
+
+  TEST(TransferSchedulerTest, HighPriorityGoesFirstToReservedSlots)
+  {
+    using Azure::Core::Http::RequestPriority;
+    TransferSchedulerOptions options;
+    options.MaxConcurrentChunks = 2;
+    options.HighPriorityReservedChunks = 1;
+    TransferScheduler scheduler(options);
+    int operationA = 0;
+    int operationB = 0;
+    int operationC = 0;
+    int operationD = 0;
+
+    std::mutex mutex;
+    std::vector<const void*> grantOrder;
+    auto waitForSlot = [&](const void* operation, RequestPriority priority) {
+      _internal::TransferChunkSlot slot(&scheduler, operation, 1, priority);
+      std::lock_guard<std::mutex> lock(mutex);
+      grantOrder.push_back(operation);
+    };
+
+    // The normal priority uses the slot left to it, and waits for the reserved one.
+    auto slotA = std::make_unique<_internal::TransferChunkSlot>(&scheduler, &operationA, 1);
+    std::thread waiterB(waitForSlot, &operationB, RequestPriority::Normal);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // The high priority uses the reserved slot, and goes first when another slot is released.
+    auto slotC = std::make_unique<_internal::TransferChunkSlot>(
+        &scheduler, &operationC, 1, RequestPriority::High);
+    std::thread waiterD(waitForSlot, &operationD, RequestPriority::High);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      EXPECT_TRUE(grantOrder.empty());
+    }
+
+    slotA.reset();
+    waiterD.join();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      EXPECT_EQ(grantOrder.size(), 1U);
+    }
+    slotC.reset();
+    waiterB.join();
+
+    ASSERT_EQ(grantOrder.size(), 2U);
+    EXPECT_EQ(grantOrder[0], &operationD);
+    EXPECT_EQ(grantOrder[1], &operationB);
+  }
+
+  TEST(TransferSchedulerTest, BandwidthBounded)
+  {
+    TransferSchedulerOptions options;
+    options.MaxConcurrentChunks = 0;
+    options.MaxBytesPerSecond = 10000;
+    TransferScheduler scheduler(options);
+
+    // The first second worth of bytes goes without waiting, the other 10000 bytes take a second.
+    const auto start = std::chrono::steady_clock::now();
+    std::atomic<int> numChunksTransferred{0};
+    _internal::ConcurrentTransfer(
+        0,
+        20000,
+        2000,
+        4,
+        [&](int64_t, int64_t, int64_t, int64_t) { ++numChunksTransferred; },
+        &scheduler);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(numChunksTransferred, 10);
+    EXPECT_GE(elapsed, std::chrono::milliseconds(900));
+  }
+
+}}} // namespace Azure::Storage::Test
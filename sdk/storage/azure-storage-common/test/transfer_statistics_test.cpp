@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
+#include <azure/storage/common/transfer_statistics.hpp>
+
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(TransferStatisticsTest, ProgressReportedInOrderAndRateLimited)
+  {
+    auto counters = std::make_shared<_internal::TransferCounters>();
+    std::vector<std::pair<int64_t, int64_t>> reports;
+    _internal::TransferProgressReporter reporter(
+        counters,
+        false,
+        [&](int64_t bytesTransferred, int64_t totalBytes) {
+          reports.emplace_back(bytesTransferred, totalBytes);
+        },
+        std::chrono::hours(1));
+    reporter.SetTotalBytes(64 * 1024);
+    _internal::ConcurrentTransfer(
+        0, 64 * 1024, 1024, 8, [&](int64_t, int64_t length, int64_t, int64_t) {
+          reporter.OnBytesTransferred(length);
+        });
+    // Not due within the interval, so only the final count is reported.
+    EXPECT_TRUE(reports.empty());
+    reporter.OnTransferDone();
+    ASSERT_EQ(reports.size(), 1U);
+    EXPECT_EQ(reports[0].first, 64 * 1024);
+    EXPECT_EQ(reports[0].second, 64 * 1024);
+
+    auto statistics = counters->GetStatistics();
+    EXPECT_EQ(statistics.BytesDownloaded, 64 * 1024);
+    EXPECT_EQ(statistics.BytesUploaded, 0);
+    EXPECT_EQ(statistics.DownloadsCompleted, 1);
+    EXPECT_EQ(statistics.UploadsCompleted, 0);
+
+    reports.clear();
+    _internal::TransferProgressReporter uploadReporter(
+        counters,
+        true,
+        [&](int64_t bytesTransferred, int64_t totalBytes) {
+          reports.emplace_back(bytesTransferred, totalBytes);
+        },
+        std::chrono::milliseconds(0));
+    _internal::ConcurrentTransfer(
+        0, 64 * 1024, 1024, 8, [&](int64_t, int64_t length, int64_t, int64_t) {
+          uploadReporter.OnBytesTransferred(length);
+        });
+    uploadReporter.OnTransferDone();
+    ASSERT_GE(reports.size(), 2U);
+    for (size_t i = 1; i < reports.size(); ++i)
+    {
+      EXPECT_LE(reports[i - 1].first, reports[i].first);
+    }
+    // The total isn't known until the transfer is done.
+    EXPECT_EQ(reports.front().second, -1);
+    EXPECT_EQ(reports.back().first, 64 * 1024);
+    EXPECT_EQ(reports.back().second, 64 * 1024);
+
+    statistics = counters->GetStatistics();
+    EXPECT_EQ(statistics.BytesDownloaded, 64 * 1024);
+    EXPECT_EQ(statistics.BytesUploaded, 64 * 1024);
+    EXPECT_EQ(statistics.UploadsCompleted, 1);
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,136 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <string>
+
+#include <azure/storage/common/internal/xml_wrapper.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(XmlWrapperTest, XmlString)
+  {
+    _internal::XmlString empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(std::string(empty), "");
+    EXPECT_TRUE(empty == "");
+
+    std::string text = "Name";
+    _internal::XmlString name(text);
+    EXPECT_EQ(name.length(), 4U);
+    EXPECT_TRUE(name == "Name");
+    EXPECT_FALSE(name == "Nam");
+    EXPECT_FALSE(name == "Names");
+    EXPECT_FALSE(name == "name");
+    EXPECT_TRUE(name != "Names");
+    EXPECT_TRUE(name == std::string("Name"));
+    EXPECT_TRUE(name != std::string("Name2"));
+    std::string copy = name;
+    EXPECT_EQ(copy, text);
+  }
+
+  TEST(XmlWrapperTest, ReadWrite)
+  {
+    std::string document;
+    {
+      _internal::XmlWriter writer;
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Blobs"});
+      writer.Write(
+          _internal::XmlNode{_internal::XmlNodeType::StartTag, "Name", std::string("a&b")});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::SelfClosingTag, "Deleted"});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
+      writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
+      document = writer.GetDocument();
+    }
+
+    _internal::XmlReader reader(document.data(), document.length());
+    auto node = reader.Read();
+    EXPECT_EQ(node.Type, _internal::XmlNodeType::StartTag);
+    EXPECT_TRUE(node.Name == "Blobs");
+    node = reader.Read();
+    EXPECT_EQ(node.Type, _internal::XmlNodeType::StartTag);
+    EXPECT_TRUE(node.Name == "Name");
+    node = reader.Read();
+    EXPECT_EQ(node.Type, _internal::XmlNodeType::Text);
+    EXPECT_EQ(std::string(node.Value), "a&b");
+    node = reader.Read();
+    EXPECT_EQ(node.Type, _internal::XmlNodeType::EndTag);
+    EXPECT_TRUE(node.Name == "Name");
+    node = reader.Read();
+    EXPECT_EQ(node.Type, _internal::XmlNodeType::SelfClosingTag);
+    EXPECT_TRUE(node.Name == "Deleted");
+    node = reader.Read();
+    EXPECT_EQ(node.Type, _internal::XmlNodeType::EndTag);
+    EXPECT_TRUE(node.Name == "Blobs");
+    node = reader.Read();
+    EXPECT_EQ(node.Type, _internal::XmlNodeType::End);
+  }
+
+  namespace {
+    // Returns at most a few bytes per read, like a response body received in small chunks.
+    class ChunkedBodyStream final : public Azure::Core::IO::BodyStream {
+    public:
+      explicit ChunkedBodyStream(const std::string& data) : m_data(data) {}
+
+      int64_t Length() const override { return static_cast<int64_t>(m_data.length()); }
+
+    private:
+      size_t OnRead(uint8_t* buffer, size_t count, const Azure::Core::Context& context) override
+      {
+        context.ThrowIfCancelled();
+        count = std::min({count, size_t(3), m_data.length() - m_offset});
+        std::copy(m_data.begin() + m_offset, m_data.begin() + m_offset + count, buffer);
+        m_offset += count;
+        return count;
+      }
+
+      std::string m_data;
+      size_t m_offset = 0;
+    };
+  } // namespace
+
+  TEST(XmlWrapperTest, ReadStream)
+  {
+    const std::string document
+        = "<?xml version=\"1.0\" encoding=\"utf-8\"?><Blobs><Blob>a</Blob><Blob>bc</Blob></Blobs>";
+
+    ChunkedBodyStream stream(document);
+    _internal::XmlReader reader(stream, Azure::Core::Context());
+    std::string text;
+    int numTags = 0;
+    while (true)
+    {
+      auto node = reader.Read();
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        break;
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        ++numTags;
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        text += node.Value;
+      }
+    }
+    EXPECT_EQ(numTags, 3);
+    EXPECT_EQ(text, "abc");
+
+    // Exceptions thrown by the stream are rethrown by the reader.
+    ChunkedBodyStream cancelledStream(document);
+    Azure::Core::Context context;
+    context.Cancel();
+    EXPECT_THROW(
+        {
+          _internal::XmlReader cancelledReader(cancelledStream, context);
+          while (cancelledReader.Read().Type != _internal::XmlNodeType::End)
+          {
+          }
+        },
+        Azure::Core::OperationCancelledException);
+  }
+
+}}} // namespace Azure::Storage::Test
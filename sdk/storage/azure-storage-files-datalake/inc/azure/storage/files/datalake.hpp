@@ -11,6 +11,7 @@
 #include "azure/storage/files/datalake/datalake_directory_client.hpp"
 #include "azure/storage/files/datalake/datalake_file_client.hpp"
 #include "azure/storage/files/datalake/datalake_file_system_client.hpp"
+#include "azure/storage/files/datalake/datalake_file_writer.hpp"
 #include "azure/storage/files/datalake/datalake_lease_client.hpp"
 #include "azure/storage/files/datalake/datalake_path_client.hpp"
 #include "azure/storage/files/datalake/datalake_sas_builder.hpp"
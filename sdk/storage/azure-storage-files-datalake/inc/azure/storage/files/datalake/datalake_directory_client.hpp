@@ -229,12 +229,149 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         const ListPathsOptions& options = ListPathsOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Sets POSIX access control rights on the directory and on all the files and
+     * directories under it, processing the subtree of each path directly in the directory
+     * concurrently instead of the whole tree one page after the other.
+     * @param acls Sets POSIX access control rights on files and directories. Each access control
+     * entry (ACE) consists of a scope, a type, a user or group identifier, and permissions.
+     * @param options Optional parameters to set an access control recursively to the resource the
+     * directory points to.
+     * @param context Context for cancelling long running operations.
+     * @return Models::SetPathAccessControlListRecursiveParallelResult containing summary stats of
+     * all the subtrees.
+     * @remark The first error stops the operation, once the pages in flight are processed. The
+     * operation can be resumed from the ContinuationTokens gathered from the ProgressHandler. This
+     * request is sent to dfs endpoint.
+     */
+    Models::SetPathAccessControlListRecursiveParallelResult SetAccessControlListRecursiveParallel(
+        const std::vector<Models::Acl>& acls,
+        const SetPathAccessControlListRecursiveParallelOptions& options
+        = SetPathAccessControlListRecursiveParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const
+    {
+      return SetAccessControlListRecursiveParallelInternal(
+          _detail::PathSetAccessControlRecursiveMode::Set, acls, options, context);
+    }
+
+    /**
+     * @brief Updates POSIX access control rights on the directory and on all the files and
+     * directories under it, processing the subtree of each path directly in the directory
+     * concurrently instead of the whole tree one page after the other.
+     * @param acls Updates POSIX access control rights on files and directories. Each access control
+     * entry (ACE) consists of a scope, a type, a user or group identifier, and permissions.
+     * @param options Optional parameters to set an access control recursively to the resource the
+     * directory points to.
+     * @param context Context for cancelling long running operations.
+     * @return Models::UpdatePathAccessControlListRecursiveParallelResult containing summary stats
+     * of all the subtrees.
+     * @remark The first error stops the operation, once the pages in flight are processed. The
+     * operation can be resumed from the ContinuationTokens gathered from the ProgressHandler. This
+     * request is sent to dfs endpoint.
+     */
+    Models::UpdatePathAccessControlListRecursiveParallelResult
+    UpdateAccessControlListRecursiveParallel(
+        const std::vector<Models::Acl>& acls,
+        const UpdatePathAccessControlListRecursiveParallelOptions& options
+        = UpdatePathAccessControlListRecursiveParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const
+    {
+      return SetAccessControlListRecursiveParallelInternal(
+          _detail::PathSetAccessControlRecursiveMode::Modify, acls, options, context);
+    }
+
+    /**
+     * @brief Removes POSIX access control rights on the directory and on all the files and
+     * directories under it, processing the subtree of each path directly in the directory
+     * concurrently instead of the whole tree one page after the other.
+     * @param acls Removes POSIX access control rights on files and directories. Each access control
+     * entry (ACE) consists of a scope, a type, a user or group identifier, and permissions.
+     * @param options Optional parameters to set an access control recursively to the resource the
+     * directory points to.
+     * @param context Context for cancelling long running operations.
+     * @return Models::RemovePathAccessControlListRecursiveParallelResult containing summary stats
+     * of all the subtrees.
+     * @remark The first error stops the operation, once the pages in flight are processed. The
+     * operation can be resumed from the ContinuationTokens gathered from the ProgressHandler. This
+     * request is sent to dfs endpoint.
+     */
+    Models::RemovePathAccessControlListRecursiveParallelResult
+    RemoveAccessControlListRecursiveParallel(
+        const std::vector<Models::Acl>& acls,
+        const RemovePathAccessControlListRecursiveParallelOptions& options
+        = RemovePathAccessControlListRecursiveParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const
+    {
+      return SetAccessControlListRecursiveParallelInternal(
+          _detail::PathSetAccessControlRecursiveMode::Remove, acls, options, context);
+    }
+
+    /**
+     * @brief Downloads all the files and directories in this directory to a local directory,
+     * created if it doesn't exist. The paths are listed while the files are downloaded, up to
+     * Concurrency files at the same time.
+     * @param localDirectoryName The local directory. Its files with the same name as a downloaded
+     * file are overwritten.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return Models::DownloadDirectoryToResult containing the number of files and directories
+     * downloaded.
+     * @remark The chunks of all the files share the TransferScheduler of the client, or one
+     * created for the operation allowing Concurrency chunks. This request is sent to dfs and blob
+     * endpoints.
+     */
+    Models::DownloadDirectoryToResult DownloadTo(
+        const std::string& localDirectoryName,
+        const DownloadDirectoryToOptions& options = DownloadDirectoryToOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Uploads all the files and directories in a local directory to this directory,
+     * created if it doesn't exist. The local directories are listed while the files are
+     * uploaded, up to Concurrency files at the same time.
+     * @param localDirectoryName The local directory. The files with the same name as an uploaded
+     * file are overwritten.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return Models::UploadDirectoryFromResult containing the number of files and directories
+     * uploaded.
+     * @remark The chunks of all the files share the TransferScheduler of the client, or one
+     * created for the operation allowing Concurrency chunks. This request is sent to dfs and blob
+     * endpoints.
+     */
+    Models::UploadDirectoryFromResult UploadFrom(
+        const std::string& localDirectoryName,
+        const UploadDirectoryFromOptions& options = UploadDirectoryFromOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Creates many directories and empty files in this directory, those that already
+     * exist being left as they are. The paths of a level of the tree are created concurrently, and
+     * by default the directories containing another path aren't requested at all, the service
+     * creating them along with their content.
+     * @param directoryPaths The directories to create, relative to this directory.
+     * @param filePaths The files to create, relative to this directory.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return Models::CreateDirectoryTreeResult containing the outcome of each path. A failed path
+     * doesn't stop the other ones.
+     * @remark This request is sent to dfs endpoint.
+     */
+    Models::CreateDirectoryTreeResult CreateTree(
+        const std::vector<std::string>& directoryPaths,
+        const std::vector<std::string>& filePaths,
+        const CreateDirectoryTreeOptions& options = CreateDirectoryTreeOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
   private:
     explicit DataLakeDirectoryClient(
         Azure::Core::Url directoryUrl,
         Blobs::BlobClient blobClient,
         std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline)
-        : DataLakePathClient(std::move(directoryUrl), std::move(blobClient), pipeline)
+        : DataLakePathClient(
+            std::move(directoryUrl),
+            std::move(blobClient),
+            std::move(pipeline))
     {
     }
 
@@ -248,6 +385,17 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         const DeleteDirectoryOptions& options = DeleteDirectoryOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    // A copy of this client whose transfers share a scheduler, the one of this client or a new
+    // one allowing concurrency chunks.
+    DataLakeDirectoryClient WithSharedTransferScheduler(int32_t concurrency) const;
+
+    Models::SetPathAccessControlListRecursiveParallelResult
+    SetAccessControlListRecursiveParallelInternal(
+        _detail::PathSetAccessControlRecursiveMode mode,
+        const std::vector<Models::Acl>& acls,
+        const SetPathAccessControlListRecursiveParallelOptions& options,
+        const Azure::Core::Context& context) const;
+
     friend class DataLakeFileSystemClient;
   };
 }}}} // namespace Azure::Storage::Files::DataLake
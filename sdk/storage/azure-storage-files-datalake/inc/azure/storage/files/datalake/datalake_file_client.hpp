@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -252,6 +253,23 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         const DownloadFileToOptions& options = DownloadFileToOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Downloads a file or a file range from the service using parallel requests, and
+     * passes its content in order to a sink.
+     * @param sink Called with consecutive pieces of the file content, from one thread at a time.
+     * An exception thrown by the sink stops the download and is rethrown.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return Azure::Response<Models::DownloadFileToResult> containing the
+     * information returned when downloading a file.
+     * @remark Only Concurrency chunks of ChunkSize bytes are held in memory. This request is sent
+     * to blob endpoint.
+     */
+    Azure::Response<Models::DownloadFileToResult> DownloadTo(
+        const std::function<void(const uint8_t* data, size_t size)>& sink,
+        const DownloadFileToOptions& options = DownloadFileToOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Schedules the file for deletion.
      * @param expiryOrigin Specify the origin of expiry.
@@ -271,7 +289,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         Azure::Core::Url fileUrl,
         Blobs::BlobClient blobClient,
         std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline)
-        : DataLakePathClient(std::move(fileUrl), std::move(blobClient), pipeline)
+        : DataLakePathClient(std::move(fileUrl), std::move(blobClient), std::move(pipeline))
     {
     }
 
@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <azure/core/credentials/credentials.hpp>
 #include <azure/core/internal/http/pipeline.hpp>
@@ -181,6 +183,27 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         const ListPathsOptions& options = ListPathsOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Lists all the paths in this file system with several concurrent sequences of
+     * requests, instead of one recursive listing. Each directory is listed on its own, and its
+     * subdirectories are queued to be listed by the first thread free.
+     *
+     * @remark Paths are passed page by page, in no particular order across directories.
+     * \p pageReceivedFunc is called by one thread at a time, and the listings wait for it, so
+     * the paths are listed no faster than they're consumed. The directories are listed last
+     * discovered first, which bounds the number of directories queued by the depth of the tree
+     * times its fan-out rather than by its width.
+     *
+     * @param pageReceivedFunc Called with each page of paths.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @remark This request is sent to dfs endpoint.
+     */
+    void ListPathsParallel(
+        const std::function<void(std::vector<Models::PathItem>)>& pageReceivedFunc,
+        const ListPathsParallelOptions& options = ListPathsParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Gets the permissions for this file system. The permissions indicate whether
      * file system data may be accessed publicly.
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+
+#include <azure/core/context.hpp>
+#include <azure/core/response.hpp>
+#include <azure/storage/common/buffer_pool.hpp>
+
+#include "azure/storage/files/datalake/datalake_file_client.hpp"
+#include "azure/storage/files/datalake/datalake_options.hpp"
+#include "azure/storage/files/datalake/datalake_responses.hpp"
+
+namespace Azure { namespace Storage { namespace Files { namespace DataLake {
+
+  /**
+   * @brief DataLakeFileWriter appends a stream of writes to a file. The writes are gathered into
+   * large buffers, several buffers are appended at increasing offsets at the same time, and the
+   * appended data is flushed only as often as the options ask for, so the throughput isn't bound
+   * by the latency of an append.
+   *
+   * @remark A writer isn't thread-safe. It must be flushed or closed before it's destroyed, the
+   * data written since the last flush isn't committed to the file otherwise.
+   */
+  class DataLakeFileWriter final {
+  public:
+    /**
+     * @brief Initializes a new instance of the DataLakeFileWriter.
+     *
+     * @param fileClient A DataLakeFileClient representing the file to write, which must exist.
+     * @param options Optional parameters of the writer.
+     */
+    explicit DataLakeFileWriter(
+        DataLakeFileClient fileClient,
+        const DataLakeFileWriterOptions& options = DataLakeFileWriterOptions());
+
+    /**
+     * @brief Waits for the appends in flight, without flushing them.
+     */
+    ~DataLakeFileWriter();
+
+    DataLakeFileWriter(const DataLakeFileWriter&) = delete;
+    DataLakeFileWriter& operator=(const DataLakeFileWriter&) = delete;
+
+    /**
+     * @brief Writes data at the end of the file. The data is copied into the current buffer,
+     * which is appended once it's full, and the file is flushed if the options ask for it.
+     *
+     * @param data The data to write.
+     * @param size The size of the data in bytes.
+     * @param context Context for cancelling long running operations.
+     * @remark The error of an append in the background is thrown by the next write or flush.
+     */
+    void Write(
+        const uint8_t* data,
+        size_t size,
+        const Azure::Core::Context& context = Azure::Core::Context());
+
+    /**
+     * @brief Appends the current buffer, waits for all the appends in flight and flushes the
+     * data written so far to the file.
+     *
+     * @param context Context for cancelling long running operations.
+     * @return Azure::Response<Models::FlushFileResult> containing the information returned when
+     * flushing the file.
+     */
+    Azure::Response<Models::FlushFileResult> Flush(
+        const Azure::Core::Context& context = Azure::Core::Context());
+
+    /**
+     * @brief Flushes the data written so far to the file, signaling the change notifications
+     * that the file is closed. The writer mustn't be written anymore.
+     *
+     * @param context Context for cancelling long running operations.
+     * @return Azure::Response<Models::FlushFileResult> containing the information returned when
+     * flushing the file.
+     */
+    Azure::Response<Models::FlushFileResult> Close(
+        const Azure::Core::Context& context = Azure::Core::Context());
+
+    /**
+     * @brief Gets the offset the next write is appended at.
+     *
+     * @return The size of the file once the data written so far is flushed.
+     */
+    int64_t GetPosition() const { return m_appendOffset + static_cast<int64_t>(m_bufferLength); }
+
+  private:
+    // Appends the current buffer in the background, once fewer than Concurrency appends are in
+    // flight.
+    void AppendBuffer(const Azure::Core::Context& context);
+    // Waits for all the appends in flight and throws the first error of an append.
+    void WaitForAppends();
+    Azure::Response<Models::FlushFileResult> FlushAppended(
+        bool close,
+        const Azure::Core::Context& context);
+
+    DataLakeFileClient m_fileClient;
+    DataLakeFileWriterOptions m_options;
+
+    _internal::PooledBuffer m_buffer;
+    size_t m_bufferLength = 0;
+    // The offset the current buffer is appended at.
+    int64_t m_appendOffset;
+    int64_t m_flushedPosition;
+    std::chrono::steady_clock::time_point m_lastFlushTime;
+
+    // Guards the variables below, shared with the appends in flight.
+    std::mutex m_mutex;
+    std::condition_variable m_appendFinished;
+    int32_t m_numAppending = 0;
+    std::exception_ptr m_firstError;
+  };
+
+}}}} // namespace Azure::Storage::Files::DataLake
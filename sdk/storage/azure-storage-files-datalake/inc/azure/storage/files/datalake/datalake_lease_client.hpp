@@ -6,6 +6,7 @@
 #include <chrono>
 
 #include <azure/storage/blobs/blob_lease_client.hpp>
+#include <azure/storage/common/lease_keeper.hpp>
 
 #include "azure/storage/files/datalake/datalake_file_system_client.hpp"
 #include "azure/storage/files/datalake/datalake_path_client.hpp"
@@ -140,6 +141,25 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
       return m_blobLeaseClient.Break(options, context);
     }
 
+    /**
+     * @brief Renews the lease in the background with a LeaseKeeper, until it's removed from the
+     * keeper or lost.
+     *
+     * @remark The lease is renewed with its current ID, so it's lost if it's changed afterwards.
+     *
+     * @param leaseKeeper The keeper renewing the lease.
+     * @param duration The duration the lease was acquired with.
+     * @param onLost Handles the loss of the lease. If null, it's ignored.
+     * @return The key of the lease in \p leaseKeeper, to remove it.
+     */
+    int64_t KeepRenewed(
+        LeaseKeeper& leaseKeeper,
+        std::chrono::seconds duration,
+        LeaseKeeper::LostLeaseHandler onLost = LeaseKeeper::LostLeaseHandler())
+    {
+      return m_blobLeaseClient.KeepRenewed(leaseKeeper, duration, std::move(onLost));
+    }
+
   private:
     Blobs::BlobLeaseClient m_blobLeaseClient;
   };
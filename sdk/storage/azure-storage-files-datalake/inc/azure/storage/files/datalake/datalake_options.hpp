@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -11,6 +14,9 @@
 #include <azure/core/nullable.hpp>
 #include <azure/storage/blobs/blob_options.hpp>
 #include <azure/storage/common/access_conditions.hpp>
+#include <azure/storage/common/buffer_pool.hpp>
+#include <azure/storage/common/endpoint_health_tracker.hpp>
+#include <azure/storage/common/transfer_scheduler.hpp>
 
 #include "azure/storage/files/datalake/protocol/datalake_rest_client.hpp"
 
@@ -38,10 +44,29 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
      */
     std::string SecondaryHostForRetryReads;
 
+    /**
+     * @brief Tracks the health of the primary host for the clients sharing it, so that their read
+     * requests are sent to #SecondaryHostForRetryReads first while the primary host is unhealthy.
+     * If null, each read request is sent to the primary host first.
+     */
+    std::shared_ptr<Azure::Storage::EndpointHealthTracker> EndpointHealthTracker;
+
     /**
      * API version used by this client.
      */
     std::string ApiVersion = _detail::DefaultServiceApiVersion;
+
+    /**
+     * @brief Bounds the chunks of the concurrent uploads and downloads of all the clients sharing
+     * it. If null, only the `Concurrency` of each call bounds its chunks.
+     */
+    std::shared_ptr<Azure::Storage::TransferScheduler> TransferScheduler;
+
+    /**
+     * @brief Provides the chunk buffers of the uploads and downloads of all the clients sharing
+     * it. If null, the clients share #Azure::Storage::BufferPool::GetDefault().
+     */
+    std::shared_ptr<Azure::Storage::BufferPool> BufferPool;
   };
 
   /**
@@ -180,6 +205,31 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     Azure::Nullable<int32_t> PageSizeHint;
   };
 
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Files::DataLake::DataLakeFileSystemClient::ListPathsParallel.
+   */
+  struct ListPathsParallelOptions final
+  {
+    /**
+     * Valid only when Hierarchical Namespace is enabled for the account. If "true", the user
+     * identity values returned in the owner and group fields of each list entry will be transformed
+     * from Azure Active Directory Object IDs to User Principal Names.
+     */
+    Azure::Nullable<bool> UserPrincipalName;
+
+    /**
+     * An optional value that specifies the maximum number of items to return in each page. If
+     * omitted or greater than 5,000, the response will include up to 5,000 items.
+     */
+    Azure::Nullable<int32_t> PageSizeHint;
+
+    /**
+     * @brief The maximum number of directories listed concurrently.
+     */
+    int32_t Concurrency = 16;
+  };
+
   /**
    * @brief Optional parameters for
    * #Azure::Storage::Files::DataLake::FileSystemClient::GetAccessPolicy.
@@ -567,6 +617,89 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
 
   using RemovePathAccessControlListRecursiveOptions = SetPathAccessControlListRecursiveOptions;
 
+  namespace Models {
+    /**
+     * @brief The progress of DataLakeDirectoryClient::SetAccessControlListRecursiveParallel after
+     * a subtree is discovered or a page of one is processed.
+     */
+    struct SetPathAccessControlListRecursiveProgress final
+    {
+      /**
+       * The path of the subtree, relative to the file system.
+       */
+      std::string Path;
+
+      /**
+       * The continuation token to resume the subtree from, empty if the subtree wasn't started
+       * yet, or null once the subtree is done.
+       */
+      Azure::Nullable<std::string> ContinuationToken;
+
+      /**
+       * Number of directories where Access Control List has been updated successfully so far, in
+       * all the subtrees.
+       */
+      int64_t NumberOfSuccessfulDirectories = 0;
+
+      /**
+       * Number of files where Access Control List has been updated successfully so far, in all
+       * the subtrees.
+       */
+      int64_t NumberOfSuccessfulFiles = 0;
+
+      /**
+       * Number of paths where Access Control List update has failed so far, in all the subtrees.
+       */
+      int64_t NumberOfFailures = 0;
+    };
+  } // namespace Models
+
+  /**
+   * @brief Optional parameters for DataLakeDirectoryClient::SetAccessControlListRecursiveParallel.
+   */
+  struct SetPathAccessControlListRecursiveParallelOptions final
+  {
+    /**
+     * It specifies the maximum number of files or directories on which the acl change will be
+     * applied with each request. If omitted or greater than 2,000, each request will process up to
+     * 2,000 items.
+     */
+    Azure::Nullable<int32_t> PageSizeHint;
+
+    /**
+     * Optional. If set to false, a subtree will terminate quickly on encountering user errors
+     * (4XX), the other subtrees aren't affected. If true, the operation will ignore user errors
+     * and proceed with the operation on other sub-entities of the directory.
+     */
+    Azure::Nullable<bool> ContinueOnFailure;
+
+    /**
+     * The maximum number of subtrees processed concurrently.
+     */
+    int32_t Concurrency = 5;
+
+    /**
+     * Resumes an interrupted operation. The subtrees left to process, keyed by path, with the
+     * continuation token to resume each of them from. If not empty, the directory isn't listed
+     * and the access control list of the directory itself isn't changed again.
+     */
+    std::map<std::string, std::string> ContinuationTokens;
+
+    /**
+     * Called by one thread at a time when a subtree is discovered, and after each page of a
+     * subtree is processed. Applying the progress of every call to a map of continuation tokens,
+     * erasing the subtrees that are done, gives the ContinuationTokens to resume the operation
+     * with if it's interrupted.
+     */
+    std::function<void(const Models::SetPathAccessControlListRecursiveProgress&)> ProgressHandler;
+  };
+
+  using UpdatePathAccessControlListRecursiveParallelOptions
+      = SetPathAccessControlListRecursiveParallelOptions;
+
+  using RemovePathAccessControlListRecursiveParallelOptions
+      = SetPathAccessControlListRecursiveParallelOptions;
+
   using CreateFileOptions = CreatePathOptions;
   using CreateDirectoryOptions = CreatePathOptions;
 
@@ -606,9 +739,172 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
        * The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * How the chunks are sized. With TransferStrategy::Adaptive, ChunkSize is the size of the
+       * first chunks, then the chunk size grows or shrinks with the observed throughput.
+       */
+      TransferStrategy Strategy = TransferStrategy::Fixed;
+
+      /**
+       * When uploading from a file, maps it in memory and uploads each chunk from a view of the
+       * mapping, instead of reading the chunks from the file. The file must not be truncated
+       * while it's uploaded.
+       */
+      bool UseMemoryMappedFile = false;
+
+      /**
+       * When uploading from a file, reads the chunks bypassing the page cache if the file system
+       * supports it. Has no effect with UseMemoryMappedFile, or when the file is uploaded with a
+       * single upload operation.
+       */
+      bool UseUnbufferedFileIo = false;
+
+      /**
+       * Computes the CRC64 of each chunk in the transfer threads, and sends it for the service to
+       * verify the chunk. The CRC64 of the chunks are combined into the CRC64 of the whole
+       * content, returned in the ContentCrc64 of the result.
+       */
+      bool ComputeContentCrc64 = false;
     } TransferOptions;
   };
 
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Files::DataLake::DataLakeDirectoryClient::DownloadTo.
+   */
+  struct DownloadDirectoryToOptions final
+  {
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * Files up to this size are downloaded with a single request, many of them one after the
+       * other by each thread. Larger files are downloaded in chunks of ChunkSize.
+       */
+      int64_t InitialChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * The maximum number of bytes in a single request.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * The maximum number of files, and of chunks of the larger files, transferred at the same
+       * time.
+       */
+      int32_t Concurrency = 5;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Files::DataLake::DataLakeDirectoryClient::UploadFrom.
+   */
+  struct UploadDirectoryFromOptions final
+  {
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * Files up to this size are uploaded with a single request, many of them one after the other
+       * by each thread. Larger files are uploaded in chunks of ChunkSize.
+       */
+      int64_t SingleUploadThreshold = 4 * 1024 * 1024;
+
+      /**
+       * The maximum number of bytes in a single request.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * The maximum number of files, and of chunks of the larger files, transferred at the same
+       * time.
+       */
+      int32_t Concurrency = 5;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Files::DataLake::DataLakeDirectoryClient::CreateTree.
+   */
+  struct CreateDirectoryTreeOptions final
+  {
+    /**
+     * @brief Optional parameters to create each directory.
+     */
+    CreateDirectoryOptions DirectoryOptions;
+
+    /**
+     * @brief Optional parameters to create each file.
+     */
+    CreateFileOptions FileOptions;
+
+    /**
+     * @brief If true, the directories containing another path to create aren't created with
+     * requests of their own, the service creating them along with the paths they contain, with
+     * the default properties rather than DirectoryOptions. Otherwise every path is created, one
+     * level of the tree after the other.
+     */
+    bool CreateParentsImplicitly = true;
+
+    /**
+     * @brief The maximum number of paths created at the same time.
+     */
+    int32_t Concurrency = 16;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Files::DataLake::DataLakeFileWriter.
+   */
+  struct DataLakeFileWriterOptions final
+  {
+    /**
+     * The offset the first write is appended at. It must be the size of the file when appending to
+     * an existing file.
+     */
+    int64_t Position = 0;
+
+    /**
+     * The size of the append buffers. The writes are gathered into a buffer until it's full, then
+     * it's appended in the background while the next buffer is filled.
+     */
+    int64_t BufferSize = 4 * 1024 * 1024;
+
+    /**
+     * The maximum number of appends in flight. A write waits while that many buffers are being
+     * appended.
+     */
+    int32_t Concurrency = 5;
+
+    /**
+     * Flushes once this many bytes were written since the last flush.
+     */
+    Azure::Nullable<int64_t> FlushSize;
+
+    /**
+     * Flushes when data is written at least this long after the last flush. There is no timer, a
+     * writer with no incoming data doesn't flush.
+     */
+    Azure::Nullable<std::chrono::milliseconds> FlushInterval;
+
+    /**
+     * The standard HTTP header system properties set by every flush. A flush clears the ones not
+     * specified.
+     */
+    Models::PathHttpHeaders HttpHeaders;
+
+    /**
+     * Specify the lease access conditions of the appends and the flushes.
+     */
+    LeaseAccessConditions AccessConditions;
+  };
+
   using ScheduleFileExpiryOriginType = Blobs::Models::ScheduleBlobExpiryOriginType;
 
   /**
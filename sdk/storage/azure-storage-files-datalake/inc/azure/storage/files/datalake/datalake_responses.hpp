@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstdint>
+#include <exception>
 #include <string>
 #include <vector>
 
@@ -478,7 +479,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
 
     // FileClient models:
 
-    using UploadFileFromResult = Blobs::Models::UploadBlockBlobResult;
+    using UploadFileFromResult = Blobs::Models::UploadBlockBlobFromResult;
     using ScheduleFileDeletionResult = Blobs::Models::SetBlobExpiryResult;
     using CopyStatus = Blobs::Models::CopyStatus;
 
@@ -650,6 +651,12 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
        */
       Azure::Core::Http::HttpRange ContentRange;
 
+      /**
+       * The CRC64 of the downloaded content, computed while it was downloaded, if
+       * ComputeContentCrc64 was set in the options.
+       */
+      Azure::Nullable<ContentHash> ContentCrc64;
+
       /**
        * The detailed information of the downloaded file.
        */
@@ -663,6 +670,122 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     using CreateDirectoryResult = CreatePathResult;
     using DeleteDirectoryResult = DeletePathResult;
 
+    /**
+     * @brief The information returned when downloading a directory to a local directory.
+     */
+    struct DownloadDirectoryToResult final
+    {
+      /**
+       * The number of directories created under the local directory.
+       */
+      int64_t NumberOfDirectories = 0;
+
+      /**
+       * The number of files downloaded.
+       */
+      int64_t NumberOfFiles = 0;
+
+      /**
+       * The total size of the files downloaded.
+       */
+      int64_t DownloadedSize = 0;
+    };
+
+    /**
+     * @brief The information returned when uploading a local directory to a directory.
+     */
+    struct UploadDirectoryFromResult final
+    {
+      /**
+       * The number of directories created under the directory.
+       */
+      int64_t NumberOfDirectories = 0;
+
+      /**
+       * The number of files uploaded.
+       */
+      int64_t NumberOfFiles = 0;
+
+      /**
+       * The total size of the files uploaded.
+       */
+      int64_t UploadedSize = 0;
+    };
+
+    /**
+     * @brief The outcome of creating a path with DataLakeDirectoryClient::CreateTree.
+     */
+    struct CreateTreePathResult final
+    {
+      /**
+       * The path, relative to the directory.
+       */
+      std::string Name;
+
+      /**
+       * Indicates whether the path is a directory.
+       */
+      bool IsDirectory = false;
+
+      /**
+       * Indicates if the path was created by a request of its own. False if it already existed,
+       * failed, or is a directory created implicitly along with the paths it contains.
+       */
+      bool Created = false;
+
+      /**
+       * The exception the path failed to be created with, null if it didn't fail.
+       */
+      std::exception_ptr Error;
+    };
+
+    /**
+     * @brief The information returned when creating a tree of paths in a directory.
+     */
+    struct CreateDirectoryTreeResult final
+    {
+      /**
+       * The outcome of each path, the directories first and then the files, in the order they
+       * were given.
+       */
+      std::vector<CreateTreePathResult> Paths;
+
+      /**
+       * The number of paths that failed to be created.
+       */
+      int32_t FailedCount = 0;
+    };
+
+    /**
+     * @brief The summary of DataLakeDirectoryClient::SetAccessControlListRecursiveParallel.
+     */
+    struct SetPathAccessControlListRecursiveParallelResult final
+    {
+      /**
+       * Number of directories where Access Control List has been updated successfully.
+       */
+      int64_t NumberOfSuccessfulDirectories = 0;
+
+      /**
+       * Number of files where Access Control List has been updated successfully.
+       */
+      int64_t NumberOfSuccessfulFiles = 0;
+
+      /**
+       * Number of paths where Access Control List update has failed.
+       */
+      int64_t NumberOfFailures = 0;
+
+      /**
+       * A collection of path entries that failed to update ACL.
+       */
+      std::vector<AclFailedEntry> FailedEntries;
+    };
+
+    using UpdatePathAccessControlListRecursiveParallelResult
+        = SetPathAccessControlListRecursiveParallelResult;
+    using RemovePathAccessControlListRecursiveParallelResult
+        = SetPathAccessControlListRecursiveParallelResult;
   } // namespace Models
 
   /**
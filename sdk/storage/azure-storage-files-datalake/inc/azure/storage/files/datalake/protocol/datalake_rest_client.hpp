@@ -18,7 +18,7 @@
 #include <azure/core/etag.hpp>
 #include <azure/core/http/http.hpp>
 #include <azure/core/internal/http/pipeline.hpp>
-#include <azure/core/internal/json/json.hpp>
+#include <azure/core/internal/json/json_reader.hpp>
 #include <azure/core/nullable.hpp>
 #include <azure/core/response.hpp>
 #include <azure/storage/common/crypt.hpp>
@@ -681,8 +681,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
             const auto& bodyBuffer = response.GetBody();
             FileSystemListPathsResult result = bodyBuffer.empty()
                 ? FileSystemListPathsResult()
-                : FileSystemListPathsResultFromPathList(
-                    PathListFromJson(Azure::Core::Json::_internal::json::parse(bodyBuffer)));
+                : FileSystemListPathsResultFromPathList(PathListFromJson(bodyBuffer));
             if (response.GetHeaders().find(_detail::HeaderContinuationToken)
                 != response.GetHeaders().end())
             {
@@ -698,33 +697,92 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
           }
         }
 
-        static PathItem PathItemFromJson(const Azure::Core::Json::_internal::json& node)
+        // Reads the members of a path object, the reader being at its start.
+        static PathItem PathItemFromJson(Azure::Core::Json::_internal::JsonReader& reader)
         {
+          using Azure::Core::Json::_internal::JsonTokenType;
           PathItem result;
-          result.Name = node["name"].get<std::string>();
-          if (node.contains("isDirectory"))
+          while (reader.ReadNextProperty())
           {
-            result.IsDirectory = (node["isDirectory"].get<std::string>() == "true");
-          }
-          result.LastModified = DateTime::Parse(
-              node["lastModified"].get<std::string>(), DateTime::DateFormat::Rfc1123);
-          result.ETag = node["etag"].get<std::string>();
-          if (node.contains("contentLength"))
-          {
-            result.FileSize = std::stoll(node["contentLength"].get<std::string>());
+            if (reader.ValueEquals("name"))
+            {
+              reader.Read();
+              result.Name = reader.GetString();
+            }
+            else if (reader.ValueEquals("isDirectory"))
+            {
+              reader.Read();
+              result.IsDirectory
+                  = reader.GetTokenType() == JsonTokenType::True || reader.ValueEquals("true");
+            }
+            else if (reader.ValueEquals("lastModified"))
+            {
+              reader.Read();
+              result.LastModified
+                  = DateTime::Parse(reader.GetString(), DateTime::DateFormat::Rfc1123);
+            }
+            else if (reader.ValueEquals("etag"))
+            {
+              reader.Read();
+              result.ETag = reader.GetString();
+            }
+            else if (reader.ValueEquals("contentLength"))
+            {
+              reader.Read();
+              result.FileSize = reader.GetTokenType() == JsonTokenType::Number
+                  ? reader.GetInt64()
+                  : std::stoll(reader.GetString());
+            }
+            else if (reader.ValueEquals("owner"))
+            {
+              reader.Read();
+              result.Owner = reader.GetString();
+            }
+            else if (reader.ValueEquals("group"))
+            {
+              reader.Read();
+              result.Group = reader.GetString();
+            }
+            else if (reader.ValueEquals("permissions"))
+            {
+              reader.Read();
+              result.Permissions = reader.GetString();
+            }
+            else
+            {
+              reader.Skip();
+            }
           }
-          result.Owner = node["owner"].get<std::string>();
-          result.Group = node["group"].get<std::string>();
-          result.Permissions = node["permissions"].get<std::string>();
           return result;
         }
 
-        static PathList PathListFromJson(const Azure::Core::Json::_internal::json& node)
+        // Listing pages hold thousands of paths, they are read without building a document.
+        static PathList PathListFromJson(const std::vector<uint8_t>& body)
         {
+          using Azure::Core::Json::_internal::JsonTokenType;
+          Azure::Core::Json::_internal::JsonReader reader(body);
+          if (!reader.Read() || reader.GetTokenType() != JsonTokenType::StartObject)
+          {
+            throw std::runtime_error("Expected a JSON object.");
+          }
           PathList result;
-          for (const auto& element : node["paths"])
+          while (reader.ReadNextProperty())
           {
-            result.Items.emplace_back(PathItemFromJson(element));
+            if (!reader.ValueEquals("paths"))
+            {
+              reader.Skip();
+              continue;
+            }
+            reader.Read();
+            if (reader.GetTokenType() != JsonTokenType::StartArray)
+            {
+              reader.Skip();
+              continue;
+            }
+            while (reader.Read() && reader.GetTokenType() == JsonTokenType::StartObject)
+            {
+              result.Items.emplace_back(PathItemFromJson(reader));
+            }
           }
           return result;
         }
@@ -1559,8 +1617,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
             PathSetAccessControlRecursiveResult result = bodyBuffer.empty()
                 ? PathSetAccessControlRecursiveResult()
                 : PathSetAccessControlRecursiveResultFromSetAccessControlRecursiveResponse(
-                    SetAccessControlRecursiveResponseFromJson(
-                        Azure::Core::Json::_internal::json::parse(bodyBuffer)));
+                    SetAccessControlRecursiveResponseFromJson(bodyBuffer));
             if (response.GetHeaders().find(_detail::HeaderContinuationToken)
                 != response.GetHeaders().end())
             {
@@ -1576,25 +1633,80 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
           }
         }
 
-        static AclFailedEntry AclFailedEntryFromJson(const Azure::Core::Json::_internal::json& node)
+        // Reads the members of a failed entry object, the reader being at its start.
+        static AclFailedEntry AclFailedEntryFromJson(
+            Azure::Core::Json::_internal::JsonReader& reader)
         {
           AclFailedEntry result;
-          result.Name = node["name"].get<std::string>();
-          result.Type = node["type"].get<std::string>();
-          result.ErrorMessage = node["errorMessage"].get<std::string>();
+          while (reader.ReadNextProperty())
+          {
+            if (reader.ValueEquals("name"))
+            {
+              reader.Read();
+              result.Name = reader.GetString();
+            }
+            else if (reader.ValueEquals("type"))
+            {
+              reader.Read();
+              result.Type = reader.GetString();
+            }
+            else if (reader.ValueEquals("errorMessage"))
+            {
+              reader.Read();
+              result.ErrorMessage = reader.GetString();
+            }
+            else
+            {
+              reader.Skip();
+            }
+          }
           return result;
         }
 
         static SetAccessControlRecursiveResponse SetAccessControlRecursiveResponseFromJson(
-            const Azure::Core::Json::_internal::json& node)
+            const std::vector<uint8_t>& body)
         {
+          using Azure::Core::Json::_internal::JsonTokenType;
+          Azure::Core::Json::_internal::JsonReader reader(body);
+          if (!reader.Read() || reader.GetTokenType() != JsonTokenType::StartObject)
+          {
+            throw std::runtime_error("Expected a JSON object.");
+          }
           SetAccessControlRecursiveResponse result;
-          result.NumberOfSuccessfulDirectories = node["directoriesSuccessful"].get<int32_t>();
-          result.NumberOfSuccessfulFiles = node["filesSuccessful"].get<int32_t>();
-          result.NumberOfFailures = node["failureCount"].get<int32_t>();
-          for (const auto& element : node["failedEntries"])
+          while (reader.ReadNextProperty())
           {
-            result.FailedEntries.emplace_back(AclFailedEntryFromJson(element));
+            if (reader.ValueEquals("directoriesSuccessful"))
+            {
+              reader.Read();
+              result.NumberOfSuccessfulDirectories = static_cast<int32_t>(reader.GetInt64());
+            }
+            else if (reader.ValueEquals("filesSuccessful"))
+            {
+              reader.Read();
+              result.NumberOfSuccessfulFiles = static_cast<int32_t>(reader.GetInt64());
+            }
+            else if (reader.ValueEquals("failureCount"))
+            {
+              reader.Read();
+              result.NumberOfFailures = static_cast<int32_t>(reader.GetInt64());
+            }
+            else if (reader.ValueEquals("failedEntries"))
+            {
+              reader.Read();
+              if (reader.GetTokenType() != JsonTokenType::StartArray)
+              {
+                reader.Skip();
+                continue;
+              }
+              while (reader.Read() && reader.GetTokenType() == JsonTokenType::StartObject)
+              {
+                result.FailedEntries.emplace_back(AclFailedEntryFromJson(reader));
+              }
+            }
+            else
+            {
+              reader.Skip();
+            }
           }
           return result;
         }
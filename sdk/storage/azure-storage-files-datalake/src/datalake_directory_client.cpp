@@ -3,9 +3,23 @@
 
 #include "azure/storage/files/datalake/datalake_directory_client.hpp"
 
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
 #include <azure/core/http/policies/policy.hpp>
+#include <azure/storage/common/bulk_operation.hpp>
 #include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
 #include <azure/storage/common/internal/constants.hpp>
+#include <azure/storage/common/internal/file_io.hpp>
 #include <azure/storage/common/internal/shared_key_policy.hpp>
 #include <azure/storage/common/internal/storage_switch_to_secondary_policy.hpp>
 #include <azure/storage/common/storage_common.hpp>
@@ -15,6 +29,51 @@
 
 namespace Azure { namespace Storage { namespace Files { namespace DataLake {
 
+  namespace {
+    // Updates or removes entries of an access control list, as the recursive operation does to
+    // each path.
+    std::vector<Models::Acl> MergeAcls(
+        _detail::PathSetAccessControlRecursiveMode mode,
+        std::vector<Models::Acl> currentAcls,
+        const std::vector<Models::Acl>& acls)
+    {
+      for (const auto& acl : acls)
+      {
+        auto sameEntry
+            = std::find_if(currentAcls.begin(), currentAcls.end(), [&](const Models::Acl& entry) {
+                return entry.Scope == acl.Scope && entry.Type == acl.Type && entry.Id == acl.Id;
+              });
+        if (mode == _detail::PathSetAccessControlRecursiveMode::Remove)
+        {
+          if (sameEntry != currentAcls.end())
+          {
+            currentAcls.erase(sameEntry);
+          }
+        }
+        else if (sameEntry != currentAcls.end())
+        {
+          sameEntry->Permissions = acl.Permissions;
+        }
+        else
+        {
+          currentAcls.push_back(acl);
+        }
+      }
+      return currentAcls;
+    }
+
+    // A path relative to a directory, without the leading and trailing slashes.
+    std::string TrimRelativePath(const std::string& path)
+    {
+      const auto begin = path.find_first_not_of('/');
+      if (begin == std::string::npos)
+      {
+        return std::string();
+      }
+      return path.substr(begin, path.find_last_not_of('/') - begin + 1);
+    }
+  } // namespace
+
   DataLakeDirectoryClient DataLakeDirectoryClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& fileSystemName,
@@ -227,7 +286,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
 
     auto clientCopy = *this;
     std::function<ListPathsPagedResponse(std::string, const Azure::Core::Context&)> func;
-    func = [func, clientCopy, protocolLayerOptions, fileSystemUrl](
+    func = [clientCopy, protocolLayerOptions, fileSystemUrl](
                std::string continuationToken, const Azure::Core::Context& context) {
       auto protocolLayerOptionsCopy = protocolLayerOptions;
       if (!continuationToken.empty())
@@ -243,15 +302,401 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
       ListPathsPagedResponse pagedResponse;
 
       pagedResponse.Paths = std::move(response.Value.Items);
-      pagedResponse.m_onNextPageFunc = func;
       pagedResponse.CurrentPageToken = continuationToken;
-      pagedResponse.NextPageToken = response.Value.ContinuationToken;
+      pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
       pagedResponse.RawResponse = std::move(response.RawResponse);
 
       return pagedResponse;
     };
 
-    return func(options.ContinuationToken.ValueOr(std::string()), context);
+    auto pagedResponse = func(options.ContinuationToken.ValueOr(std::string()), context);
+    pagedResponse.m_onNextPageFunc = std::move(func);
+    return pagedResponse;
+  }
+
+  Models::SetPathAccessControlListRecursiveParallelResult
+  DataLakeDirectoryClient::SetAccessControlListRecursiveParallelInternal(
+      _detail::PathSetAccessControlRecursiveMode mode,
+      const std::vector<Models::Acl>& acls,
+      const SetPathAccessControlListRecursiveParallelOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    struct Subtree final
+    {
+      std::string Path;
+      std::string ContinuationToken;
+    };
+
+    Models::SetPathAccessControlListRecursiveParallelResult result;
+    std::mutex mutex;
+    std::exception_ptr firstError;
+    std::deque<Subtree> subtrees;
+
+    // Must be called with the mutex locked.
+    auto reportProgress = [&](const std::string& path, Azure::Nullable<std::string> token) {
+      if (options.ProgressHandler)
+      {
+        Models::SetPathAccessControlListRecursiveProgress progress;
+        progress.Path = path;
+        progress.ContinuationToken = std::move(token);
+        progress.NumberOfSuccessfulDirectories = result.NumberOfSuccessfulDirectories;
+        progress.NumberOfSuccessfulFiles = result.NumberOfSuccessfulFiles;
+        progress.NumberOfFailures = result.NumberOfFailures;
+        options.ProgressHandler(progress);
+      }
+    };
+
+    if (options.ContinuationTokens.empty())
+    {
+      // The directory itself is changed first, on its own: the recursive operation on it would
+      // go through the whole tree.
+      if (mode == _detail::PathSetAccessControlRecursiveMode::Set)
+      {
+        SetAccessControlList(acls, SetPathAccessControlListOptions(), context);
+      }
+      else
+      {
+        auto currentAcls = GetAccessControlList(GetPathAccessControlListOptions(), context);
+        SetPathAccessControlListOptions setOptions;
+        setOptions.AccessConditions.IfMatch
+            = Azure::ETag(currentAcls.RawResponse->GetHeaders().at("etag"));
+        SetAccessControlList(
+            MergeAcls(mode, std::move(currentAcls.Value.Acls), acls), setOptions, context);
+      }
+
+      for (auto page = ListPaths(false, ListPathsOptions(), context); page.HasPage();
+           page.MoveToNextPage(context))
+      {
+        for (auto& path : page.Paths)
+        {
+          subtrees.push_back(Subtree{std::move(path.Name), std::string()});
+        }
+      }
+      std::lock_guard<std::mutex> guard(mutex);
+      for (const auto& subtree : subtrees)
+      {
+        reportProgress(subtree.Path, subtree.ContinuationToken);
+      }
+    }
+    else
+    {
+      for (const auto& token : options.ContinuationTokens)
+      {
+        subtrees.push_back(Subtree{token.first, token.second});
+      }
+    }
+
+    const std::string currentPath = m_pathUrl.GetPath();
+    const std::string fileSystemName(
+        currentPath.begin(), std::find(currentPath.begin(), currentPath.end(), '/'));
+
+    auto processSubtree = [&](const Subtree& subtree) {
+      // Files and directories alike, the recursive operation on a file only changes the file.
+      auto subtreeUrl = m_pathUrl;
+      subtreeUrl.SetPath(fileSystemName);
+      subtreeUrl.AppendPath(_internal::UrlEncodePath(subtree.Path));
+      auto blobClient = m_blobClient;
+      blobClient.m_blobUrl.SetPath(fileSystemName);
+      blobClient.m_blobUrl.AppendPath(_internal::UrlEncodePath(subtree.Path));
+      const DataLakeDirectoryClient subtreeClient(
+          std::move(subtreeUrl), std::move(blobClient), m_pipeline);
+
+      SetPathAccessControlListRecursiveOptions recursiveOptions;
+      if (!subtree.ContinuationToken.empty())
+      {
+        recursiveOptions.ContinuationToken = subtree.ContinuationToken;
+      }
+      recursiveOptions.PageSizeHint = options.PageSizeHint;
+      recursiveOptions.ContinueOnFailure = options.ContinueOnFailure;
+      auto page = mode == _detail::PathSetAccessControlRecursiveMode::Set
+          ? subtreeClient.SetAccessControlListRecursive(acls, recursiveOptions, context)
+          : mode == _detail::PathSetAccessControlRecursiveMode::Modify
+          ? subtreeClient.UpdateAccessControlListRecursive(acls, recursiveOptions, context)
+          : subtreeClient.RemoveAccessControlListRecursive(acls, recursiveOptions, context);
+      for (; page.HasPage(); page.MoveToNextPage(context))
+      {
+        std::lock_guard<std::mutex> guard(mutex);
+        result.NumberOfSuccessfulDirectories += page.NumberOfSuccessfulDirectories;
+        result.NumberOfSuccessfulFiles += page.NumberOfSuccessfulFiles;
+        result.NumberOfFailures += page.NumberOfFailures;
+        result.FailedEntries.insert(
+            result.FailedEntries.end(),
+            std::make_move_iterator(page.FailedEntries.begin()),
+            std::make_move_iterator(page.FailedEntries.end()));
+        Azure::Nullable<std::string> nextToken;
+        if (page.NextPageToken.HasValue() && !page.NextPageToken.Value().empty())
+        {
+          nextToken = page.NextPageToken.Value();
+        }
+        reportProgress(subtree.Path, std::move(nextToken));
+        if (firstError)
+        {
+          break;
+        }
+      }
+    };
+
+    auto threadFunc = [&]() {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (!firstError && !subtrees.empty())
+      {
+        auto subtree = std::move(subtrees.front());
+        subtrees.pop_front();
+        lock.unlock();
+        std::exception_ptr error;
+        try
+        {
+          processSubtree(subtree);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+        lock.lock();
+        if (error && !firstError)
+        {
+          firstError = error;
+        }
+      }
+    };
+
+    Storage::_detail::RunConcurrently(
+        std::min(
+            static_cast<int64_t>(std::max(options.Concurrency, 1)),
+            static_cast<int64_t>(subtrees.size()))
+            - 1,
+        threadFunc,
+        _internal::ThreadPool::GetDefault());
+
+    if (firstError)
+    {
+      std::rethrow_exception(firstError);
+    }
+    return result;
+  }
+
+  DataLakeDirectoryClient DataLakeDirectoryClient::WithSharedTransferScheduler(
+      int32_t concurrency) const
+  {
+    auto newClient = *this;
+    if (!newClient.m_blobClient.m_transferScheduler)
+    {
+      TransferSchedulerOptions schedulerOptions;
+      schedulerOptions.MaxConcurrentChunks = std::max(concurrency, 1);
+      newClient.m_blobClient.m_transferScheduler
+          = std::make_shared<TransferScheduler>(schedulerOptions);
+    }
+    return newClient;
+  }
+
+  Models::DownloadDirectoryToResult DataLakeDirectoryClient::DownloadTo(
+      const std::string& localDirectoryName,
+      const DownloadDirectoryToOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    const auto operationClient = WithSharedTransferScheduler(options.TransferOptions.Concurrency);
+
+    // The paths are listed relative to the file system.
+    const std::string currentPath = Azure::Core::Url::Decode(m_pathUrl.GetPath());
+    const auto firstSlashPos = currentPath.find('/');
+    std::string pathPrefix;
+    if (firstSlashPos != std::string::npos && firstSlashPos + 1 != currentPath.length())
+    {
+      pathPrefix = currentPath.substr(firstSlashPos + 1);
+      pathPrefix.erase(pathPrefix.find_last_not_of('/') + 1);
+      pathPrefix += '/';
+    }
+
+    DownloadFileToOptions fileOptions;
+    fileOptions.TransferOptions.InitialChunkSize = options.TransferOptions.InitialChunkSize;
+    fileOptions.TransferOptions.ChunkSize = options.TransferOptions.ChunkSize;
+    fileOptions.TransferOptions.Concurrency = options.TransferOptions.Concurrency;
+
+    Models::DownloadDirectoryToResult result;
+    std::mutex resultMutex;
+    _internal::TaskQueue tasks;
+
+    _internal::CreateLocalDirectories(localDirectoryName);
+    tasks.Push(
+        [&]() {
+          for (auto page = operationClient.ListPaths(true, ListPathsOptions(), context);
+               page.HasPage();
+               page.MoveToNextPage(context))
+          {
+            for (const auto& path : page.Paths)
+            {
+              if (path.Name.compare(0, pathPrefix.length(), pathPrefix) != 0)
+              {
+                continue;
+              }
+              std::string relativePath = path.Name.substr(pathPrefix.length());
+              std::string localPath = localDirectoryName + "/" + relativePath;
+              if (path.IsDirectory)
+              {
+                // Parents are listed before their children.
+                _internal::CreateLocalDirectories(localPath);
+                std::lock_guard<std::mutex> guard(resultMutex);
+                ++result.NumberOfDirectories;
+                continue;
+              }
+              tasks.Push([&, relativePath, localPath]() {
+                auto fileResult = operationClient.GetFileClient(relativePath)
+                                      .DownloadTo(localPath, fileOptions, context);
+                std::lock_guard<std::mutex> guard(resultMutex);
+                ++result.NumberOfFiles;
+                result.DownloadedSize += fileResult.Value.FileSize;
+              });
+            }
+          }
+        },
+        true);
+    tasks.Run(options.TransferOptions.Concurrency);
+
+    return result;
+  }
+
+  Models::UploadDirectoryFromResult DataLakeDirectoryClient::UploadFrom(
+      const std::string& localDirectoryName,
+      const UploadDirectoryFromOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    const auto operationClient = WithSharedTransferScheduler(options.TransferOptions.Concurrency);
+
+    UploadFileFromOptions fileOptions;
+    fileOptions.TransferOptions.SingleUploadThreshold
+        = options.TransferOptions.SingleUploadThreshold;
+    fileOptions.TransferOptions.ChunkSize = options.TransferOptions.ChunkSize;
+    fileOptions.TransferOptions.Concurrency = options.TransferOptions.Concurrency;
+
+    Models::UploadDirectoryFromResult result;
+    std::mutex resultMutex;
+    _internal::TaskQueue tasks;
+
+    // Lists a local directory, relative to localDirectoryName, once it's created in this
+    // directory.
+    std::function<void(const std::string&)> uploadDirectory;
+    uploadDirectory = [&](const std::string& relativePath) {
+      const std::string localPath
+          = relativePath.empty() ? localDirectoryName : localDirectoryName + "/" + relativePath;
+      for (const auto& entry : _internal::ListLocalDirectory(localPath))
+      {
+        std::string entryPath = relativePath.empty() ? entry.Name : relativePath + "/" + entry.Name;
+        if (entry.IsDirectory)
+        {
+          tasks.Push(
+              [&, entryPath]() {
+                operationClient.GetSubdirectoryClient(entryPath).CreateIfNotExists(
+                    CreateDirectoryOptions(), context);
+                {
+                  std::lock_guard<std::mutex> guard(resultMutex);
+                  ++result.NumberOfDirectories;
+                }
+                uploadDirectory(entryPath);
+              },
+              true);
+          continue;
+        }
+        const int64_t fileSize = entry.Size;
+        tasks.Push([&, entryPath, fileSize]() {
+          operationClient.GetFileClient(entryPath).UploadFrom(
+              localDirectoryName + "/" + entryPath, fileOptions, context);
+          std::lock_guard<std::mutex> guard(resultMutex);
+          ++result.NumberOfFiles;
+          result.UploadedSize += fileSize;
+        });
+      }
+    };
+
+    operationClient.CreateIfNotExists(CreateDirectoryOptions(), context);
+    tasks.Push([&]() { uploadDirectory(std::string()); }, true);
+    tasks.Run(options.TransferOptions.Concurrency);
+
+    return result;
+  }
+
+  Models::CreateDirectoryTreeResult DataLakeDirectoryClient::CreateTree(
+      const std::vector<std::string>& directoryPaths,
+      const std::vector<std::string>& filePaths,
+      const CreateDirectoryTreeOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    Models::CreateDirectoryTreeResult result;
+    auto addPath = [&result](const std::string& path, bool isDirectory) {
+      Models::CreateTreePathResult pathResult;
+      pathResult.Name = TrimRelativePath(path);
+      if (pathResult.Name.empty())
+      {
+        throw std::invalid_argument("Paths to create cannot be empty.");
+      }
+      pathResult.IsDirectory = isDirectory;
+      result.Paths.push_back(std::move(pathResult));
+    };
+    for (const auto& path : directoryPaths)
+    {
+      addPath(path, true);
+    }
+    for (const auto& path : filePaths)
+    {
+      addPath(path, false);
+    }
+
+    // The directories the service creates along with the paths they contain.
+    std::set<std::string> implicitDirectories;
+    if (options.CreateParentsImplicitly)
+    {
+      for (const auto& path : result.Paths)
+      {
+        for (auto pos = path.Name.find('/'); pos != std::string::npos;
+             pos = path.Name.find('/', pos + 1))
+        {
+          implicitDirectories.insert(path.Name.substr(0, pos));
+        }
+      }
+    }
+
+    // The paths to request, by depth. A level is only created once the one above it is, unless
+    // the parents are created implicitly, in which case all the paths are at the same level.
+    std::map<size_t, std::vector<size_t>> levels;
+    for (size_t i = 0; i < result.Paths.size(); ++i)
+    {
+      const auto& path = result.Paths[i];
+      if (path.IsDirectory && implicitDirectories.count(path.Name) != 0)
+      {
+        continue;
+      }
+      const size_t depth = options.CreateParentsImplicitly
+          ? 0
+          : static_cast<size_t>(std::count(path.Name.begin(), path.Name.end(), '/'));
+      levels[depth].push_back(i);
+    }
+
+    BulkOperationOptions bulkOptions;
+    bulkOptions.Concurrency = options.Concurrency;
+    for (const auto& level : levels)
+    {
+      std::vector<BulkOperation> operations;
+      for (const auto pathId : level.second)
+      {
+        operations.push_back(
+            [this, &options, &result, pathId](const Azure::Core::Context& operationContext) {
+              auto& path = result.Paths[pathId];
+              path.Created = path.IsDirectory
+                  ? GetSubdirectoryClient(path.Name)
+                        .CreateIfNotExists(options.DirectoryOptions, operationContext)
+                        .Value.Created
+                  : GetFileClient(path.Name)
+                        .CreateIfNotExists(options.FileOptions, operationContext)
+                        .Value.Created;
+            });
+      }
+      auto bulkResult = ExecuteBulkOperations(operations, bulkOptions, context);
+      for (size_t i = 0; i < level.second.size(); ++i)
+      {
+        result.Paths[level.second[i]].Error = bulkResult.Errors[i];
+      }
+      result.FailedCount += bulkResult.FailedCount;
+    }
+    return result;
   }
 
 }}}} // namespace Azure::Storage::Files::DataLake
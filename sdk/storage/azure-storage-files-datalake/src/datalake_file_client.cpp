@@ -75,6 +75,46 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
       }
       return Models::LeaseStatus();
     }
+
+    Azure::Response<Models::DownloadFileToResult> FromDownloadBlobToResult(
+        Azure::Response<Blobs::Models::DownloadBlobToResult> result)
+    {
+      Models::DownloadFileToResult ret;
+      ret.ContentRange = std::move(result.Value.ContentRange);
+      ret.FileSize = result.Value.BlobSize;
+      ret.ContentCrc64 = std::move(result.Value.ContentCrc64);
+      ret.Details.HttpHeaders = FromBlobHttpHeaders(std::move(result.Value.Details.HttpHeaders));
+      ret.Details.ETag = std::move(result.Value.Details.ETag);
+      ret.Details.LastModified = std::move(result.Value.Details.LastModified);
+      if (result.Value.Details.LeaseDuration.HasValue())
+      {
+        ret.Details.LeaseDuration
+            = Models::LeaseDuration(result.Value.Details.LeaseDuration.Value().ToString());
+      }
+      ret.Details.LeaseState = result.Value.Details.LeaseState.HasValue()
+          ? FromBlobLeaseState(result.Value.Details.LeaseState.Value())
+          : ret.Details.LeaseState;
+      ret.Details.LeaseStatus = result.Value.Details.LeaseStatus.HasValue()
+          ? FromBlobLeaseStatus(result.Value.Details.LeaseStatus.Value())
+          : ret.Details.LeaseStatus;
+      ret.Details.Metadata = std::move(result.Value.Details.Metadata);
+      ret.Details.CreatedOn = std::move(result.Value.Details.CreatedOn);
+      ret.Details.ExpiresOn = std::move(result.Value.Details.ExpiresOn);
+      ret.Details.LastAccessedOn = std::move(result.Value.Details.LastAccessedOn);
+      ret.Details.CopyId = std::move(result.Value.Details.CopyId);
+      ret.Details.CopySource = std::move(result.Value.Details.CopySource);
+      ret.Details.CopyStatus = std::move(result.Value.Details.CopyStatus);
+      ret.Details.CopyStatusDescription = std::move(result.Value.Details.CopyStatusDescription);
+      ret.Details.CopyProgress = std::move(result.Value.Details.CopyProgress);
+      ret.Details.CopyCompletedOn = std::move(result.Value.Details.CopyCompletedOn);
+      ret.Details.VersionId = std::move(result.Value.Details.VersionId);
+      ret.Details.IsCurrentVersion = std::move(result.Value.Details.IsCurrentVersion);
+      ret.Details.EncryptionKeySha256 = std::move(result.Value.Details.EncryptionKeySha256);
+      ret.Details.EncryptionScope = std::move(result.Value.Details.EncryptionScope);
+      ret.Details.IsServerEncrypted = result.Value.Details.IsServerEncrypted;
+      return Azure::Response<Models::DownloadFileToResult>(
+          std::move(ret), std::move(result.RawResponse));
+    }
   } // namespace
 
   DataLakeFileClient DataLakeFileClient::CreateFromConnectionString(
@@ -264,6 +304,10 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         = options.TransferOptions.SingleUploadThreshold;
     blobOptions.TransferOptions.ChunkSize = options.TransferOptions.ChunkSize;
     blobOptions.TransferOptions.Concurrency = options.TransferOptions.Concurrency;
+    blobOptions.TransferOptions.Strategy = options.TransferOptions.Strategy;
+    blobOptions.TransferOptions.ComputeContentCrc64 = options.TransferOptions.ComputeContentCrc64;
+    blobOptions.TransferOptions.UseMemoryMappedFile = options.TransferOptions.UseMemoryMappedFile;
+    blobOptions.TransferOptions.UseUnbufferedFileIo = options.TransferOptions.UseUnbufferedFileIo;
     blobOptions.HttpHeaders = FromPathHttpHeaders(options.HttpHeaders);
     blobOptions.Metadata = options.Metadata;
     return m_blobClient.AsBlockBlobClient().UploadFrom(fileName, blobOptions, context);
@@ -280,6 +324,8 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         = options.TransferOptions.SingleUploadThreshold;
     blobOptions.TransferOptions.ChunkSize = options.TransferOptions.ChunkSize;
     blobOptions.TransferOptions.Concurrency = options.TransferOptions.Concurrency;
+    blobOptions.TransferOptions.Strategy = options.TransferOptions.Strategy;
+    blobOptions.TransferOptions.ComputeContentCrc64 = options.TransferOptions.ComputeContentCrc64;
     blobOptions.HttpHeaders = FromPathHttpHeaders(options.HttpHeaders);
     blobOptions.Metadata = options.Metadata;
     return m_blobClient.AsBlockBlobClient().UploadFrom(buffer, bufferSize, blobOptions, context);
@@ -292,40 +338,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
       const Azure::Core::Context& context) const
   {
     auto result = m_blobClient.AsBlockBlobClient().DownloadTo(buffer, bufferSize, options, context);
-    Models::DownloadFileToResult ret;
-    ret.ContentRange = std::move(result.Value.ContentRange);
-    ret.FileSize = result.Value.BlobSize;
-    ret.Details.HttpHeaders = FromBlobHttpHeaders(std::move(result.Value.Details.HttpHeaders));
-    ret.Details.ETag = std::move(result.Value.Details.ETag);
-    ret.Details.LastModified = std::move(result.Value.Details.LastModified);
-    if (result.Value.Details.LeaseDuration.HasValue())
-    {
-      ret.Details.LeaseDuration
-          = Models::LeaseDuration(result.Value.Details.LeaseDuration.Value().ToString());
-    }
-    ret.Details.LeaseState = result.Value.Details.LeaseState.HasValue()
-        ? FromBlobLeaseState(result.Value.Details.LeaseState.Value())
-        : ret.Details.LeaseState;
-    ret.Details.LeaseStatus = result.Value.Details.LeaseStatus.HasValue()
-        ? FromBlobLeaseStatus(result.Value.Details.LeaseStatus.Value())
-        : ret.Details.LeaseStatus;
-    ret.Details.Metadata = std::move(result.Value.Details.Metadata);
-    ret.Details.CreatedOn = std::move(result.Value.Details.CreatedOn);
-    ret.Details.ExpiresOn = std::move(result.Value.Details.ExpiresOn);
-    ret.Details.LastAccessedOn = std::move(result.Value.Details.LastAccessedOn);
-    ret.Details.CopyId = std::move(result.Value.Details.CopyId);
-    ret.Details.CopySource = std::move(result.Value.Details.CopySource);
-    ret.Details.CopyStatus = std::move(result.Value.Details.CopyStatus);
-    ret.Details.CopyStatusDescription = std::move(result.Value.Details.CopyStatusDescription);
-    ret.Details.CopyProgress = std::move(result.Value.Details.CopyProgress);
-    ret.Details.CopyCompletedOn = std::move(result.Value.Details.CopyCompletedOn);
-    ret.Details.VersionId = std::move(result.Value.Details.VersionId);
-    ret.Details.IsCurrentVersion = std::move(result.Value.Details.IsCurrentVersion);
-    ret.Details.EncryptionKeySha256 = std::move(result.Value.Details.EncryptionKeySha256);
-    ret.Details.EncryptionScope = std::move(result.Value.Details.EncryptionScope);
-    ret.Details.IsServerEncrypted = result.Value.Details.IsServerEncrypted;
-    return Azure::Response<Models::DownloadFileToResult>(
-        std::move(ret), std::move(result.RawResponse));
+    return FromDownloadBlobToResult(std::move(result));
   }
 
   Azure::Response<Models::DownloadFileToResult> DataLakeFileClient::DownloadTo(
@@ -334,40 +347,16 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
       const Azure::Core::Context& context) const
   {
     auto result = m_blobClient.AsBlockBlobClient().DownloadTo(fileName, options, context);
-    Models::DownloadFileToResult ret;
-    ret.ContentRange = std::move(result.Value.ContentRange);
-    ret.FileSize = result.Value.BlobSize;
-    ret.Details.HttpHeaders = FromBlobHttpHeaders(std::move(result.Value.Details.HttpHeaders));
-    ret.Details.ETag = std::move(result.Value.Details.ETag);
-    ret.Details.LastModified = std::move(result.Value.Details.LastModified);
-    if (result.Value.Details.LeaseDuration.HasValue())
-    {
-      ret.Details.LeaseDuration
-          = Models::LeaseDuration(result.Value.Details.LeaseDuration.Value().ToString());
-    }
-    ret.Details.LeaseState = result.Value.Details.LeaseState.HasValue()
-        ? FromBlobLeaseState(result.Value.Details.LeaseState.Value())
-        : ret.Details.LeaseState;
-    ret.Details.LeaseStatus = result.Value.Details.LeaseStatus.HasValue()
-        ? FromBlobLeaseStatus(result.Value.Details.LeaseStatus.Value())
-        : ret.Details.LeaseStatus;
-    ret.Details.Metadata = std::move(result.Value.Details.Metadata);
-    ret.Details.CreatedOn = std::move(result.Value.Details.CreatedOn);
-    ret.Details.ExpiresOn = std::move(result.Value.Details.ExpiresOn);
-    ret.Details.LastAccessedOn = std::move(result.Value.Details.LastAccessedOn);
-    ret.Details.CopyId = std::move(result.Value.Details.CopyId);
-    ret.Details.CopySource = std::move(result.Value.Details.CopySource);
-    ret.Details.CopyStatus = std::move(result.Value.Details.CopyStatus);
-    ret.Details.CopyStatusDescription = std::move(result.Value.Details.CopyStatusDescription);
-    ret.Details.CopyProgress = std::move(result.Value.Details.CopyProgress);
-    ret.Details.CopyCompletedOn = std::move(result.Value.Details.CopyCompletedOn);
-    ret.Details.VersionId = std::move(result.Value.Details.VersionId);
-    ret.Details.IsCurrentVersion = std::move(result.Value.Details.IsCurrentVersion);
-    ret.Details.EncryptionKeySha256 = std::move(result.Value.Details.EncryptionKeySha256);
-    ret.Details.EncryptionScope = std::move(result.Value.Details.EncryptionScope);
-    ret.Details.IsServerEncrypted = result.Value.Details.IsServerEncrypted;
-    return Azure::Response<Models::DownloadFileToResult>(
-        std::move(ret), std::move(result.RawResponse));
+    return FromDownloadBlobToResult(std::move(result));
+  }
+
+  Azure::Response<Models::DownloadFileToResult> DataLakeFileClient::DownloadTo(
+      const std::function<void(const uint8_t* data, size_t size)>& sink,
+      const DownloadFileToOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    auto result = m_blobClient.AsBlockBlobClient().DownloadTo(sink, options, context);
+    return FromDownloadBlobToResult(std::move(result));
   }
 
   Azure::Response<Models::ScheduleFileDeletionResult> DataLakeFileClient::ScheduleDeletion(
@@ -3,9 +3,15 @@
 
 #include "azure/storage/files/datalake/datalake_file_system_client.hpp"
 
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+
 #include <azure/core/http/policies/policy.hpp>
 #include <azure/storage/blobs/protocol/blob_rest_client.hpp>
 #include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
 #include <azure/storage/common/internal/constants.hpp>
 #include <azure/storage/common/internal/shared_key_policy.hpp>
 #include <azure/storage/common/internal/storage_per_retry_policy.hpp>
@@ -59,7 +65,9 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_fileSystemUrl.GetHost(), newOptions.SecondaryHostForRetryReads));
+        m_fileSystemUrl.GetHost(),
+        newOptions.SecondaryHostForRetryReads,
+        newOptions.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     perOperationPolicies.emplace_back(
         std::make_unique<_internal::StorageServiceVersionPolicy>(newOptions.ApiVersion));
@@ -83,7 +91,9 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_fileSystemUrl.GetHost(), options.SecondaryHostForRetryReads));
+        m_fileSystemUrl.GetHost(),
+        options.SecondaryHostForRetryReads,
+        options.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     {
       Azure::Core::Credentials::TokenRequestContext tokenContext;
@@ -112,7 +122,9 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_fileSystemUrl.GetHost(), options.SecondaryHostForRetryReads));
+        m_fileSystemUrl.GetHost(),
+        options.SecondaryHostForRetryReads,
+        options.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     perOperationPolicies.emplace_back(
         std::make_unique<_internal::StorageServiceVersionPolicy>(options.ApiVersion));
@@ -138,7 +150,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     auto builder = m_fileSystemUrl;
     builder.AppendPath(_internal::UrlEncodePath(directoryName));
     return DataLakeDirectoryClient(
-        builder, m_blobContainerClient.GetBlobClient(directoryName), m_pipeline);
+        std::move(builder), m_blobContainerClient.GetBlobClient(directoryName), m_pipeline);
   }
 
   Azure::Response<Models::CreateFileSystemResult> DataLakeFileSystemClient::Create(
@@ -272,7 +284,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
 
     auto clientCopy = *this;
     std::function<ListPathsPagedResponse(std::string, const Azure::Core::Context&)> func;
-    func = [func, clientCopy, protocolLayerOptions](
+    func = [clientCopy, protocolLayerOptions](
                std::string continuationToken, const Azure::Core::Context& context) {
       auto protocolLayerOptionsCopy = protocolLayerOptions;
       if (!continuationToken.empty())
@@ -287,15 +299,105 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
 
       ListPathsPagedResponse pagedResponse;
       pagedResponse.Paths = std::move(response.Value.Items);
-      pagedResponse.m_onNextPageFunc = func;
       pagedResponse.CurrentPageToken = continuationToken;
-      pagedResponse.NextPageToken = response.Value.ContinuationToken;
+      pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
       pagedResponse.RawResponse = std::move(response.RawResponse);
 
       return pagedResponse;
     };
 
-    return func(options.ContinuationToken.ValueOr(std::string()), context);
+    auto pagedResponse = func(options.ContinuationToken.ValueOr(std::string()), context);
+    pagedResponse.m_onNextPageFunc = std::move(func);
+    return pagedResponse;
+  }
+
+  void DataLakeFileSystemClient::ListPathsParallel(
+      const std::function<void(std::vector<Models::PathItem>)>& pageReceivedFunc,
+      const ListPathsParallelOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    if (options.Concurrency <= 0)
+    {
+      throw std::invalid_argument("Concurrency must be positive.");
+    }
+
+    std::mutex mutex;
+    std::condition_variable directoriesChanged;
+    // The directories to list, the root first. Taken from the back.
+    std::vector<Azure::Nullable<std::string>> directories{Azure::Nullable<std::string>()};
+    int numListing = 0;
+    std::exception_ptr firstError;
+    std::mutex pageReceivedMutex;
+
+    auto listDirectory = [&](const Azure::Nullable<std::string>& directoryPath) {
+      ListPathsOptions listOptions;
+      listOptions.UserPrincipalName = options.UserPrincipalName;
+      listOptions.PageSizeHint = options.PageSizeHint;
+      auto page = directoryPath.HasValue()
+          ? GetDirectoryClient(directoryPath.Value()).ListPaths(false, listOptions, context)
+          : ListPaths(false, listOptions, context);
+      for (; page.HasPage(); page.MoveToNextPage(context))
+      {
+        {
+          std::lock_guard<std::mutex> guard(mutex);
+          for (const auto& path : page.Paths)
+          {
+            if (path.IsDirectory)
+            {
+              directories.push_back(path.Name);
+            }
+          }
+        }
+        directoriesChanged.notify_all();
+        if (!page.Paths.empty())
+        {
+          std::lock_guard<std::mutex> guard(pageReceivedMutex);
+          pageReceivedFunc(std::move(page.Paths));
+        }
+      }
+    };
+
+    auto threadFunc = [&]() {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (true)
+      {
+        // Directories being listed may still discover new ones.
+        directoriesChanged.wait(
+            lock, [&]() { return firstError || !directories.empty() || numListing == 0; });
+        if (firstError || directories.empty())
+        {
+          break;
+        }
+        auto directoryPath = std::move(directories.back());
+        directories.pop_back();
+        ++numListing;
+        lock.unlock();
+        std::exception_ptr error;
+        try
+        {
+          listDirectory(directoryPath);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+        lock.lock();
+        --numListing;
+        if (error && !firstError)
+        {
+          firstError = error;
+        }
+        directoriesChanged.notify_all();
+      }
+    };
+
+    Storage::_detail::RunConcurrently(
+        options.Concurrency - 1, threadFunc, Storage::_internal::ThreadPool::GetDefault());
+
+    if (firstError)
+    {
+      std::rethrow_exception(firstError);
+    }
   }
 
   Azure::Response<Models::FileSystemAccessPolicy> DataLakeFileSystemClient::GetAccessPolicy(
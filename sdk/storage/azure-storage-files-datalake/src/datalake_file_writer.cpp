@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/files/datalake/datalake_file_writer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+#include <azure/core/io/body_stream.hpp>
+#include <azure/storage/common/internal/thread_pool.hpp>
+
+namespace Azure { namespace Storage { namespace Files { namespace DataLake {
+
+  DataLakeFileWriter::DataLakeFileWriter(
+      DataLakeFileClient fileClient,
+      const DataLakeFileWriterOptions& options)
+      : m_fileClient(std::move(fileClient)), m_options(options),
+        m_appendOffset(options.Position), m_flushedPosition(options.Position),
+        m_lastFlushTime(std::chrono::steady_clock::now())
+  {
+    if (m_options.BufferSize <= 0)
+    {
+      throw std::invalid_argument("BufferSize must be positive.");
+    }
+  }
+
+  DataLakeFileWriter::~DataLakeFileWriter()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_appendFinished.wait(lock, [&]() { return m_numAppending == 0; });
+  }
+
+  void DataLakeFileWriter::Write(
+      const uint8_t* data,
+      size_t size,
+      const Azure::Core::Context& context)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_firstError)
+      {
+        std::rethrow_exception(m_firstError);
+      }
+    }
+
+    const size_t bufferSize = static_cast<size_t>(m_options.BufferSize);
+    while (size > 0)
+    {
+      if (m_buffer.GetData() == nullptr)
+      {
+        m_buffer = _internal::PooledBuffer(nullptr, bufferSize);
+      }
+      const size_t copySize = std::min(size, bufferSize - m_bufferLength);
+      std::memcpy(m_buffer.GetData() + m_bufferLength, data, copySize);
+      m_bufferLength += copySize;
+      data += copySize;
+      size -= copySize;
+      if (m_bufferLength == bufferSize)
+      {
+        AppendBuffer(context);
+      }
+    }
+
+    const bool flushBySize = m_options.FlushSize.HasValue()
+        && GetPosition() - m_flushedPosition >= m_options.FlushSize.Value();
+    const bool flushByTime = m_options.FlushInterval.HasValue()
+        && std::chrono::steady_clock::now() - m_lastFlushTime >= m_options.FlushInterval.Value();
+    if (flushBySize || flushByTime)
+    {
+      Flush(context);
+    }
+  }
+
+  Azure::Response<Models::FlushFileResult> DataLakeFileWriter::Flush(
+      const Azure::Core::Context& context)
+  {
+    return FlushAppended(false, context);
+  }
+
+  Azure::Response<Models::FlushFileResult> DataLakeFileWriter::Close(
+      const Azure::Core::Context& context)
+  {
+    return FlushAppended(true, context);
+  }
+
+  void DataLakeFileWriter::AppendBuffer(const Azure::Core::Context& context)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_appendFinished.wait(
+          lock, [&]() { return m_numAppending < std::max(m_options.Concurrency, 1); });
+      if (m_firstError)
+      {
+        std::rethrow_exception(m_firstError);
+      }
+      ++m_numAppending;
+    }
+
+    // The task must be copyable, so it shares the buffer instead of owning it.
+    auto buffer = std::make_shared<_internal::PooledBuffer>(std::move(m_buffer));
+    const size_t length = m_bufferLength;
+    const int64_t offset = m_appendOffset;
+    m_bufferLength = 0;
+    m_appendOffset += static_cast<int64_t>(length);
+
+    _internal::ThreadPool::GetDefault().Submit([this, buffer, length, offset, context]() {
+      std::exception_ptr error;
+      try
+      {
+        Azure::Core::IO::MemoryBodyStream content(buffer->GetData(), length);
+        AppendFileOptions appendOptions;
+        appendOptions.AccessConditions.LeaseId = m_options.AccessConditions.LeaseId;
+        m_fileClient.Append(content, offset, appendOptions, context);
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+      // The buffer goes back to the pool before the writer can be destroyed.
+      *buffer = _internal::PooledBuffer();
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+      --m_numAppending;
+      if (error && !m_firstError)
+      {
+        m_firstError = error;
+      }
+      // Notified under the lock, the writer may be destroyed as soon as it's released.
+      m_appendFinished.notify_all();
+    });
+  }
+
+  void DataLakeFileWriter::WaitForAppends()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_appendFinished.wait(lock, [&]() { return m_numAppending == 0; });
+    if (m_firstError)
+    {
+      std::rethrow_exception(m_firstError);
+    }
+  }
+
+  Azure::Response<Models::FlushFileResult> DataLakeFileWriter::FlushAppended(
+      bool close,
+      const Azure::Core::Context& context)
+  {
+    if (m_bufferLength != 0)
+    {
+      AppendBuffer(context);
+    }
+    WaitForAppends();
+
+    FlushFileOptions flushOptions;
+    flushOptions.HttpHeaders = m_options.HttpHeaders;
+    flushOptions.AccessConditions.LeaseId = m_options.AccessConditions.LeaseId;
+    if (close)
+    {
+      flushOptions.Close = true;
+    }
+    auto response = m_fileClient.Flush(m_appendOffset, flushOptions, context);
+    m_flushedPosition = m_appendOffset;
+    m_lastFlushTime = std::chrono::steady_clock::now();
+    return response;
+  }
+
+}}}} // namespace Azure::Storage::Files::DataLake
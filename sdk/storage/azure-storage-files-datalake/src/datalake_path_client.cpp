@@ -96,7 +96,9 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_pathUrl.GetHost(), newOptions.SecondaryHostForRetryReads));
+        m_pathUrl.GetHost(),
+        newOptions.SecondaryHostForRetryReads,
+        newOptions.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     perOperationPolicies.emplace_back(
         std::make_unique<_internal::StorageServiceVersionPolicy>(newOptions.ApiVersion));
@@ -120,7 +122,9 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_pathUrl.GetHost(), options.SecondaryHostForRetryReads));
+        m_pathUrl.GetHost(),
+        options.SecondaryHostForRetryReads,
+        options.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     {
       Azure::Core::Credentials::TokenRequestContext tokenContext;
@@ -148,7 +152,9 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
     perRetryPolicies.emplace_back(std::make_unique<_internal::StorageSwitchToSecondaryPolicy>(
-        m_pathUrl.GetHost(), options.SecondaryHostForRetryReads));
+        m_pathUrl.GetHost(),
+        options.SecondaryHostForRetryReads,
+        options.EndpointHealthTracker));
     perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
     perOperationPolicies.emplace_back(
         std::make_unique<_internal::StorageServiceVersionPolicy>(options.ApiVersion));
@@ -442,7 +448,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         m_pathUrl, *m_pipeline, context, protocolLayerOptions);
 
     SetPathAccessControlListRecursivePagedResponse pagedResponse;
-    pagedResponse.NumberOfSuccessfulFiles = response.Value.NumberOfSuccessfulDirectories;
+    pagedResponse.NumberOfSuccessfulDirectories = response.Value.NumberOfSuccessfulDirectories;
     pagedResponse.NumberOfSuccessfulFiles = response.Value.NumberOfSuccessfulFiles;
     pagedResponse.NumberOfFailures = response.Value.NumberOfFailures;
     pagedResponse.FailedEntries = std::move(response.Value.FailedEntries);
@@ -451,7 +457,7 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     pagedResponse.m_acls = acls;
     pagedResponse.m_mode = mode;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken;
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
     pagedResponse.RawResponse = std::move(response.RawResponse);
 
     return pagedResponse;
@@ -89,7 +89,10 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
 
   void ListPathsPagedResponse::OnNextPage(const Azure::Core::Context& context)
   {
-    *this = m_onNextPageFunc(NextPageToken.Value(), context);
+    // The function can't hold itself, it's passed from page to page instead.
+    auto onNextPageFunc = std::move(m_onNextPageFunc);
+    *this = onNextPageFunc(NextPageToken.Value(), context);
+    m_onNextPageFunc = std::move(onNextPageFunc);
   }
 
   void SetPathAccessControlListRecursivePagedResponse::OnNextPage(
@@ -100,16 +103,19 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     {
       *this = m_dataLakePathClient->SetAccessControlListRecursive(
           m_acls, m_operationOptions, context);
+      return;
     }
     else if (m_mode == _detail::PathSetAccessControlRecursiveMode::Modify)
     {
       *this = m_dataLakePathClient->UpdateAccessControlListRecursive(
           m_acls, m_operationOptions, context);
+      return;
     }
     else if (m_mode == _detail::PathSetAccessControlRecursiveMode::Remove)
     {
       *this = m_dataLakePathClient->RemoveAccessControlListRecursive(
           m_acls, m_operationOptions, context);
+      return;
     }
     AZURE_UNREACHABLE_CODE();
   }
@@ -138,9 +138,8 @@ namespace Azure { namespace Storage { namespace Sas {
         + CacheControl + "\n" + ContentDisposition + "\n" + ContentEncoding + "\n" + ContentLanguage
         + "\n" + ContentType;
 
-    std::string signature = Azure::Core::Convert::Base64Encode(_internal::HmacSha256(
-        std::vector<uint8_t>(stringToSign.begin(), stringToSign.end()),
-        Azure::Core::Convert::Base64Decode(credential.GetAccountKey())));
+    std::string signature = Azure::Core::Convert::Base64Encode(credential.GetSigningContext()->Sign(
+        reinterpret_cast<const uint8_t*>(stringToSign.data()), stringToSign.length()));
 
     Azure::Core::Url builder;
     builder.AppendQueryParameter(
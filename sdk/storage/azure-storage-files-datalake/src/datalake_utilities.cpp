@@ -96,7 +96,10 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake { nam
     *(static_cast<Azure::Core::_internal::ClientOptions*>(&blobOptions)) = options;
     blobOptions.SecondaryHostForRetryReads
         = _detail::GetBlobUrlFromUrl(options.SecondaryHostForRetryReads);
+    blobOptions.EndpointHealthTracker = options.EndpointHealthTracker;
     blobOptions.ApiVersion = options.ApiVersion;
+    blobOptions.TransferScheduler = options.TransferScheduler;
+    blobOptions.BufferPool = options.BufferPool;
     return blobOptions;
   }
 
@@ -4,9 +4,12 @@
 #include "datalake_directory_client_test.hpp"
 
 #include <algorithm>
+#include <map>
 #include <thread>
+#include <vector>
 
 #include <azure/identity/client_secret_credential.hpp>
+#include <azure/storage/common/internal/file_io.hpp>
 #include <azure/storage/common/internal/shared_key_policy.hpp>
 
 namespace Azure { namespace Storage { namespace Test {
@@ -631,6 +634,169 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(DataLakeDirectoryClientTest, DirectoryAccessControlRecursiveParallel)
+  {
+    auto rootDirectoryName = RandomString();
+    auto rootDirectoryClient = m_fileSystemClient->GetDirectoryClient(rootDirectoryName);
+    rootDirectoryClient.Create();
+    std::vector<std::string> directoryNames;
+    std::vector<Files::DataLake::DataLakePathClient> pathClients;
+    for (int i = 0; i < 2; ++i)
+    {
+      directoryNames.push_back(RandomString());
+      auto directoryClient = rootDirectoryClient.GetSubdirectoryClient(directoryNames.back());
+      directoryClient.Create();
+      auto fileClient = directoryClient.GetFileClient(RandomString());
+      fileClient.Create();
+      pathClients.push_back(directoryClient);
+      pathClients.push_back(fileClient);
+    }
+    auto fileClient = rootDirectoryClient.GetFileClient(RandomString());
+    fileClient.Create();
+    pathClients.push_back(fileClient);
+    pathClients.push_back(rootDirectoryClient);
+
+    auto groupFinder = [](const Files::DataLake::Models::Acl& targetAcl) {
+      return targetAcl.Type == "group" && targetAcl.Id.empty();
+    };
+
+    Files::DataLake::SetPathAccessControlListRecursiveParallelOptions options;
+    options.PageSizeHint = 1;
+    options.Concurrency = 2;
+    std::map<std::string, std::string> continuationTokens;
+    options.ProgressHandler
+        = [&](const Files::DataLake::Models::SetPathAccessControlListRecursiveProgress& progress) {
+            if (progress.ContinuationToken.HasValue())
+            {
+              continuationTokens[progress.Path] = progress.ContinuationToken.Value();
+            }
+            else
+            {
+              continuationTokens.erase(progress.Path);
+            }
+          };
+    auto result
+        = rootDirectoryClient.SetAccessControlListRecursiveParallel(GetValidAcls(), options);
+    EXPECT_EQ(result.NumberOfSuccessfulDirectories, 2);
+    EXPECT_EQ(result.NumberOfSuccessfulFiles, 3);
+    EXPECT_EQ(result.NumberOfFailures, 0);
+    EXPECT_TRUE(continuationTokens.empty());
+
+    Files::DataLake::Models::Acl newAcl;
+    newAcl.Type = "group";
+    newAcl.Permissions = "rw-";
+    result = rootDirectoryClient.UpdateAccessControlListRecursiveParallel({newAcl}, options);
+    EXPECT_EQ(result.NumberOfSuccessfulDirectories, 2);
+    EXPECT_EQ(result.NumberOfSuccessfulFiles, 3);
+    for (const auto& pathClient : pathClients)
+    {
+      auto acls = pathClient.GetAccessControlList().Value.Acls;
+      auto iter = std::find_if(acls.begin(), acls.end(), groupFinder);
+      ASSERT_NE(iter, acls.end());
+      EXPECT_EQ(iter->Permissions, "rw-");
+    }
+
+    // Resuming only processes the subtrees left.
+    newAcl.Permissions = "r--";
+    options.ContinuationTokens[rootDirectoryName + "/" + directoryNames[0]] = std::string();
+    result = rootDirectoryClient.UpdateAccessControlListRecursiveParallel({newAcl}, options);
+    EXPECT_EQ(result.NumberOfSuccessfulDirectories, 1);
+    EXPECT_EQ(result.NumberOfSuccessfulFiles, 1);
+    auto acls = pathClients[1].GetAccessControlList().Value.Acls;
+    EXPECT_EQ(std::find_if(acls.begin(), acls.end(), groupFinder)->Permissions, "r--");
+    acls = rootDirectoryClient.GetAccessControlList().Value.Acls;
+    EXPECT_EQ(std::find_if(acls.begin(), acls.end(), groupFinder)->Permissions, "rw-");
+  }
+
+  TEST_F(DataLakeDirectoryClientTest, DirectoryUploadDownload)
+  {
+    const std::string localDirectoryName = RandomString();
+    const std::vector<std::string> fileNames
+        = {"small", "nested/small", "nested/leaf/large", "nested/leaf/empty"};
+    const std::vector<size_t> fileSizes = {100, 2000, 3 * 1024 * 1024 + 123, 0};
+    std::vector<std::vector<uint8_t>> fileContents;
+    _internal::CreateLocalDirectories(localDirectoryName + "/nested/leaf");
+    for (size_t i = 0; i < fileNames.size(); ++i)
+    {
+      fileContents.push_back(RandomBuffer(fileSizes[i]));
+      _internal::FileWriter fileWriter(localDirectoryName + "/" + fileNames[i]);
+      fileWriter.Write(fileContents[i].data(), fileContents[i].size(), 0);
+    }
+    const int64_t totalSize = 100 + 2000 + 3 * 1024 * 1024 + 123;
+
+    auto directoryClient = m_fileSystemClient->GetDirectoryClient(RandomString());
+    Files::DataLake::UploadDirectoryFromOptions uploadOptions;
+    uploadOptions.TransferOptions.SingleUploadThreshold = 1024 * 1024;
+    uploadOptions.TransferOptions.ChunkSize = 1024 * 1024;
+    uploadOptions.TransferOptions.Concurrency = 3;
+    auto uploadResult = directoryClient.UploadFrom(localDirectoryName, uploadOptions);
+    EXPECT_EQ(uploadResult.NumberOfDirectories, 2);
+    EXPECT_EQ(uploadResult.NumberOfFiles, 4);
+    EXPECT_EQ(uploadResult.UploadedSize, totalSize);
+
+    const std::string downloadDirectoryName = RandomString();
+    Files::DataLake::DownloadDirectoryToOptions downloadOptions;
+    downloadOptions.TransferOptions.InitialChunkSize = 1024 * 1024;
+    downloadOptions.TransferOptions.ChunkSize = 1024 * 1024;
+    downloadOptions.TransferOptions.Concurrency = 3;
+    auto downloadResult = directoryClient.DownloadTo(downloadDirectoryName, downloadOptions);
+    EXPECT_EQ(downloadResult.NumberOfDirectories, 2);
+    EXPECT_EQ(downloadResult.NumberOfFiles, 4);
+    EXPECT_EQ(downloadResult.DownloadedSize, totalSize);
+    for (size_t i = 0; i < fileNames.size(); ++i)
+    {
+      EXPECT_EQ(ReadFile(downloadDirectoryName + "/" + fileNames[i]), fileContents[i]);
+      DeleteFile(downloadDirectoryName + "/" + fileNames[i]);
+      DeleteFile(localDirectoryName + "/" + fileNames[i]);
+    }
+    for (const auto& name : {localDirectoryName, downloadDirectoryName})
+    {
+      DeleteFile(name + "/nested/leaf");
+      DeleteFile(name + "/nested");
+      DeleteFile(name);
+    }
+  }
+
+  TEST_F(DataLakeDirectoryClientTest, CreateTree)
+  {
+    auto directoryClient = m_fileSystemClient->GetDirectoryClient(RandomString());
+    directoryClient.Create();
+    directoryClient.GetFileClient("existing").Create();
+
+    const std::vector<std::string> directoryPaths = {"a", "a/b/", "a/b/c", "d"};
+    const std::vector<std::string> filePaths = {"a/b/file", "/e/file", "existing"};
+    auto result = directoryClient.CreateTree(directoryPaths, filePaths);
+    EXPECT_EQ(result.FailedCount, 0);
+    ASSERT_EQ(result.Paths.size(), 7U);
+    EXPECT_EQ(result.Paths[1].Name, "a/b");
+    EXPECT_TRUE(result.Paths[1].IsDirectory);
+    EXPECT_EQ(result.Paths[5].Name, "e/file");
+    EXPECT_FALSE(result.Paths[5].IsDirectory);
+    // a and a/b are created implicitly, existing already exists.
+    const std::vector<bool> created = {false, false, true, true, true, true, false};
+    for (size_t i = 0; i < created.size(); ++i)
+    {
+      EXPECT_EQ(result.Paths[i].Created, created[i]);
+      EXPECT_FALSE(result.Paths[i].Error);
+    }
+    EXPECT_TRUE(directoryClient.GetSubdirectoryClient("a/b").GetProperties().Value.IsDirectory);
+    EXPECT_TRUE(directoryClient.GetSubdirectoryClient("e").GetProperties().Value.IsDirectory);
+
+    Files::DataLake::CreateDirectoryTreeOptions options;
+    options.CreateParentsImplicitly = false;
+    options.Concurrency = 2;
+    result = directoryClient.CreateTree({"f", "f/g", "f/g/h"}, {"f/g/file"}, options);
+    EXPECT_EQ(result.FailedCount, 0);
+    for (const auto& path : result.Paths)
+    {
+      EXPECT_TRUE(path.Created);
+    }
+    result = directoryClient.CreateTree({"f/g"}, {}, options);
+    EXPECT_FALSE(result.Paths[0].Created);
+
+    EXPECT_THROW(directoryClient.CreateTree({"/"}, {}), std::invalid_argument);
+  }
+
   TEST_F(DataLakeDirectoryClientTest, ConstructorsWorks)
   {
     {
@@ -241,6 +241,51 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_EQ(buffer, downloaded);
   }
 
+  TEST_F(DataLakeFileClientTest, FileWriter)
+  {
+    auto fileClient = m_fileSystemClient->GetFileClient(RandomString());
+    fileClient.Create();
+    const std::vector<uint8_t> fileContent = RandomBuffer(static_cast<size_t>(300_KB));
+
+    Files::DataLake::DataLakeFileWriterOptions options;
+    options.BufferSize = 64_KB;
+    options.Concurrency = 3;
+    options.FlushSize = 128_KB;
+    options.HttpHeaders = GetInterestingHttpHeaders();
+    {
+      Files::DataLake::DataLakeFileWriter writer(fileClient, options);
+      // Small records, not aligned to the buffers.
+      for (size_t offset = 0; offset < fileContent.size(); offset += 1000)
+      {
+        writer.Write(
+            fileContent.data() + offset, std::min<size_t>(1000, fileContent.size() - offset));
+        if (offset == 150000)
+        {
+          // Flushed by size once 128KiB were written, by the write ending at 132000.
+          EXPECT_EQ(fileClient.GetProperties().Value.FileSize, 132000);
+        }
+      }
+      EXPECT_EQ(writer.GetPosition(), static_cast<int64_t>(fileContent.size()));
+      auto res = writer.Close();
+      EXPECT_TRUE(res.Value.ETag.HasValue());
+    }
+    auto properties = fileClient.GetProperties().Value;
+    EXPECT_EQ(properties.FileSize, static_cast<int64_t>(fileContent.size()));
+    EXPECT_EQ(properties.HttpHeaders, options.HttpHeaders);
+    EXPECT_EQ(ReadBodyStream(fileClient.Download().Value.Body), fileContent);
+
+    // Appending to the existing file.
+    options.Position = properties.FileSize;
+    options.FlushSize.Reset();
+    {
+      Files::DataLake::DataLakeFileWriter writer(fileClient, options);
+      writer.Write(fileContent.data(), 100);
+      writer.Flush();
+    }
+    EXPECT_EQ(
+        fileClient.GetProperties().Value.FileSize, static_cast<int64_t>(fileContent.size()) + 100);
+  }
+
   TEST_F(DataLakeFileClientTest, FileReadReturns)
   {
     const int32_t bufferSize = 4 * 1024; // 4KB data size
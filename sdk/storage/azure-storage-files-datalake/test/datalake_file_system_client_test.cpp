@@ -294,6 +294,39 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(DataLakeFileSystemClientTest, ListPathsParallel)
+  {
+    std::vector<std::string> expectedNames;
+    for (const auto& path : ListAllPaths(true))
+    {
+      expectedNames.push_back(path.Name);
+    }
+
+    Files::DataLake::ListPathsParallelOptions options;
+    options.PageSizeHint = 2;
+    options.Concurrency = 4;
+    std::vector<std::string> names;
+    m_fileSystemClient->ListPathsParallel(
+        [&](std::vector<Files::DataLake::Models::PathItem> paths) {
+          EXPECT_LE(paths.size(), 2U);
+          for (const auto& path : paths)
+          {
+            names.push_back(path.Name);
+          }
+        },
+        options);
+    std::sort(expectedNames.begin(), expectedNames.end());
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(names, expectedNames);
+    EXPECT_NE(std::find(names.begin(), names.end(), m_pathNameSetA[0]), names.end());
+
+    options.Concurrency = 0;
+    EXPECT_THROW(
+        m_fileSystemClient->ListPathsParallel(
+            [](std::vector<Files::DataLake::Models::PathItem>) {}, options),
+        std::invalid_argument);
+  }
+
   TEST_F(DataLakeFileSystemClientTest, UnencodedPathDirectoryFileNameWorks)
   {
     const std::string non_ascii_word = "\xE6\xB5\x8B\xE8\xAF\x95";
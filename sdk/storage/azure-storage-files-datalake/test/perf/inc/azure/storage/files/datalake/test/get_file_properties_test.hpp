@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of getting the properties of a datalake file.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+
+#include "azure/storage/files/datalake/test/datalake_base_test.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Files { namespace DataLake { namespace Test {
+
+  /**
+   * @brief A test to measure getting the properties of a file, a small operation without
+   * payload.
+   *
+   */
+  class GetFileProperties : public Azure::Storage::Files::DataLake::Test::DataLakeTest {
+  public:
+    /**
+     * @brief Construct a new GetFileProperties test.
+     *
+     * @param options The test options.
+     */
+    GetFileProperties(Azure::Perf::TestOptions options) : DataLakeTest(options) {}
+
+    /**
+     * @brief Create an empty file on setup.
+     *
+     */
+    void Setup() override
+    {
+      // Call base to create file client
+      DataLakeTest::Setup();
+
+      m_fileClient->Create();
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_fileClient->GetProperties({}, context);
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "GetFileProperties",
+          "Get the properties of a file.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Storage::Files::DataLake::Test::GetFileProperties>(
+                options);
+          }};
+    }
+  };
+
+}}}}} // namespace Azure::Storage::Files::DataLake::Test
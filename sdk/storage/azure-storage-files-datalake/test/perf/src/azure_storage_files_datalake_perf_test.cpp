@@ -0,0 +1,22 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/perf.hpp>
+
+#include "azure/storage/files/datalake/test/download_file_test.hpp"
+#include "azure/storage/files/datalake/test/get_file_properties_test.hpp"
+#include "azure/storage/files/datalake/test/upload_file_test.hpp"
+
+int main(int argc, char** argv)
+{
+
+  // Create the test list
+  std::vector<Azure::Perf::TestMetadata> tests{
+      Azure::Storage::Files::DataLake::Test::DownloadFile::GetTestMetadata(),
+      Azure::Storage::Files::DataLake::Test::GetFileProperties::GetTestMetadata(),
+      Azure::Storage::Files::DataLake::Test::UploadFile::GetTestMetadata()};
+
+  Azure::Perf::Program::Run(Azure::Core::Context::ApplicationContext, tests, argc, argv);
+
+  return 0;
+}
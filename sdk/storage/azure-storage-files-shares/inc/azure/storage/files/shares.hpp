@@ -11,6 +11,7 @@
 #include "azure/storage/files/shares/dll_import_export.hpp"
 #include "azure/storage/files/shares/share_client.hpp"
 #include "azure/storage/files/shares/share_directory_client.hpp"
+#include "azure/storage/files/shares/share_directory_listing_cache.hpp"
 #include "azure/storage/files/shares/share_file_client.hpp"
 #include "azure/storage/files/shares/share_lease_client.hpp"
 #include "azure/storage/files/shares/share_sas_builder.hpp"
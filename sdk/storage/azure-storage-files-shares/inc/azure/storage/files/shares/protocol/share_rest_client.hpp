@@ -1490,6 +1490,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   } // namespace Models
   namespace _detail {
     using namespace Models;
+    using Azure::Core::Http::_internal::WellKnownHeader;
     constexpr static const char* DefaultServiceApiVersion = "2020-02-10";
     constexpr static const char* QueryCopyId = "copyid";
     constexpr static const char* QueryIncludeFlags = "include";
@@ -2261,59 +2262,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
 
     class ShareRestClient final {
     private:
-      static Azure::Core::Http::HttpRange HttpRangeFromXml(_internal::XmlReader& reader)
-      {
-        int depth = 0;
-        bool is_start = false;
-        bool is_end = false;
-        int64_t start = 0;
-        int64_t end = 0;
-        while (true)
-        {
-          auto node = reader.Read();
-          if (node.Type == _internal::XmlNodeType::End)
-          {
-            break;
-          }
-          else if (
-              node.Type == _internal::XmlNodeType::StartTag
-              && strcmp(node.Name.data(), "Start") == 0)
-          {
-            ++depth;
-            is_start = true;
-          }
-          else if (
-              node.Type == _internal::XmlNodeType::StartTag && strcmp(node.Name.data(), "End") == 0)
-          {
-            ++depth;
-            is_end = true;
-          }
-          else if (node.Type == _internal::XmlNodeType::EndTag)
-          {
-            is_start = false;
-            is_end = false;
-            if (depth-- == 0)
-            {
-              break;
-            }
-          }
-          if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
-          {
-            if (is_start)
-            {
-              start = std::stoll(node.Value);
-            }
-            else if (is_end)
-            {
-              end = std::stoll(node.Value);
-            }
-          }
-        }
-        Azure::Core::Http::HttpRange ret;
-        ret.Offset = start;
-        ret.Length = end - start + 1;
-        return ret;
-      }
+      static Azure::Core::Http::HttpRange HttpRangeFromXml(_internal::XmlReader& reader);
 
     public:
       class Service final {
@@ -2329,32 +2278,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const SetPropertiesOptions& setPropertiesOptions)
-        {
-
-          std::string xml_body;
-          {
-            _internal::XmlWriter writer;
-            ShareServicePropertiesToXml(writer, setPropertiesOptions.ServiceProperties);
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
-            xml_body = writer.GetDocument();
-          }
-          auto body = Azure::Core::IO::MemoryBodyStream(
-              reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url, &body);
-          request.SetHeader("Content-Length", std::to_string(body.Length()));
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "service");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "properties");
-          if (setPropertiesOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(setPropertiesOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, setPropertiesOptions.ApiVersionParameter);
-          return SetPropertiesParseResult(context, pipeline.Send(request, context));
-        }
+            const SetPropertiesOptions& setPropertiesOptions);
 
         struct GetPropertiesOptions final
         {
@@ -2366,21 +2290,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const GetPropertiesOptions& getPropertiesOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "service");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "properties");
-          if (getPropertiesOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(getPropertiesOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, getPropertiesOptions.ApiVersionParameter);
-          return GetPropertiesParseResult(context, pipeline.Send(request, context));
-        }
+            const GetPropertiesOptions& getPropertiesOptions);
 
         struct ListSharesSinglePageOptions final
         {
@@ -2396,1320 +2306,74 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const ListSharesSinglePageOptions& listSharesSinglePageOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "list");
-          if (listSharesSinglePageOptions.Prefix.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryPrefix,
-                _internal::UrlEncodeQueryParameter(listSharesSinglePageOptions.Prefix.Value()));
-          }
-          if (listSharesSinglePageOptions.ContinuationToken.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryContinuationToken,
-                _internal::UrlEncodeQueryParameter(
-                    listSharesSinglePageOptions.ContinuationToken.Value()));
-          }
-          if (listSharesSinglePageOptions.MaxResults.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryPageSizeHint,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(listSharesSinglePageOptions.MaxResults.Value())));
-          }
-          if (listSharesSinglePageOptions.IncludeFlags.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryIncludeFlags,
-                _internal::UrlEncodeQueryParameter(ListSharesIncludeFlagsToString(
-                    listSharesSinglePageOptions.IncludeFlags.Value())));
-          }
-          if (listSharesSinglePageOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(listSharesSinglePageOptions.Timeout.Value())));
-          }
-          request.SetHeader(
-              _detail::HeaderVersion, listSharesSinglePageOptions.ApiVersionParameter);
-          return ListSharesSinglePageParseResult(context, pipeline.Send(request, context));
-        }
+            const ListSharesSinglePageOptions& listSharesSinglePageOptions);
 
       private:
         static Azure::Response<Models::SetServicePropertiesResult> SetPropertiesParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Accepted)
-          {
-            // Success (Accepted)
-            Models::SetServicePropertiesResult result;
-            return Azure::Response<Models::SetServicePropertiesResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static void RetentionPolicyToXml(
             _internal::XmlWriter& writer,
-            const RetentionPolicy& object)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Enabled"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), object.Enabled ? "true" : "false"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          if (object.Days.HasValue())
-          {
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Days"});
-            writer.Write(_internal::XmlNode{
-                _internal::XmlNodeType::Text, std::string(), std::to_string(object.Days.Value())});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          }
-        }
+            const RetentionPolicy& object);
 
-        static void MetricsToXml(_internal::XmlWriter& writer, const Metrics& object)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Version"});
-          writer.Write(
-              _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), object.Version});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Enabled"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), object.Enabled ? "true" : "false"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          if (object.IncludeApis.HasValue())
-          {
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "IncludeAPIs"});
-            writer.Write(_internal::XmlNode{
-                _internal::XmlNodeType::Text,
-                std::string(),
-                object.IncludeApis.Value() ? "true" : "false"});
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          }
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "RetentionPolicy"});
-          RetentionPolicyToXml(writer, object.RetentionPolicy);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+        static void MetricsToXml(_internal::XmlWriter& writer, const Metrics& object);
 
-        static void CorsRuleToXml(_internal::XmlWriter& writer, const CorsRule& object)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "CorsRule"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AllowedOrigins"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), object.AllowedOrigins});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AllowedMethods"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), object.AllowedMethods});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AllowedHeaders"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), object.AllowedHeaders});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "ExposedHeaders"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), object.ExposedHeaders});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "MaxAgeInSeconds"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), std::to_string(object.MaxAgeInSeconds)});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+        static void CorsRuleToXml(_internal::XmlWriter& writer, const CorsRule& object);
 
         static void SmbMultichannelToXml(
             _internal::XmlWriter& writer,
-            const SmbMultichannel& object)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Multichannel"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Enabled"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text, std::string(), object.Enabled ? "true" : "false"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+            const SmbMultichannel& object);
 
-        static void SmbSettingsToXml(_internal::XmlWriter& writer, const SmbSettings& object)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "SMB"});
-          SmbMultichannelToXml(writer, object.Multichannel);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+        static void SmbSettingsToXml(_internal::XmlWriter& writer, const SmbSettings& object);
 
         static void ProtocolSettingsToXml(
             _internal::XmlWriter& writer,
-            const ProtocolSettings& object)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "ProtocolSettings"});
-          SmbSettingsToXml(writer, object.Settings);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+            const ProtocolSettings& object);
 
         static void ShareServicePropertiesToXml(
             _internal::XmlWriter& writer,
-            const ShareServiceProperties& object)
-        {
-          writer.Write(
-              _internal::XmlNode{_internal::XmlNodeType::StartTag, "StorageServiceProperties"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "HourMetrics"});
-          MetricsToXml(writer, object.HourMetrics);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "MinuteMetrics"});
-          MetricsToXml(writer, object.MinuteMetrics);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          if (object.Cors.size() > 0)
-          {
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Cors"});
-            for (const auto& item : object.Cors)
-            {
-              CorsRuleToXml(writer, item);
-            }
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          }
-          if (object.Protocol.HasValue())
-          {
-            ProtocolSettingsToXml(writer, object.Protocol.Value());
-          }
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+            const ShareServiceProperties& object);
         static Azure::Response<ServiceGetPropertiesResult> GetPropertiesParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success.
-            const auto& bodyBuffer = response.GetBody();
-            auto reader = _internal::XmlReader(
-                reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
-            ServiceGetPropertiesResult result = bodyBuffer.empty()
-                ? ServiceGetPropertiesResult()
-                : ServiceGetPropertiesResultFromShareServiceProperties(
-                    ShareServicePropertiesFromXml(reader));
-            return Azure::Response<ServiceGetPropertiesResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
-
-        static RetentionPolicy RetentionPolicyFromXml(_internal::XmlReader& reader)
-        {
-          auto result = RetentionPolicy();
-          enum class XmlTagName
-          {
-            Days,
-            Enabled,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Days") == 0)
-              {
-                path.emplace_back(XmlTagName::Days);
-              }
-              else if (std::strcmp(node.Name.data(), "Enabled") == 0)
-              {
-                path.emplace_back(XmlTagName::Enabled);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::Days)
-              {
-                result.Days = std::stoi(node.Value);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Enabled)
-              {
-                result.Enabled = (std::strcmp(node.Value.data(), "true") == 0);
-              }
-            }
-          }
-          return result;
-        }
-
-        static Metrics MetricsFromXml(_internal::XmlReader& reader)
-        {
-          auto result = Metrics();
-          enum class XmlTagName
-          {
-            Enabled,
-            IncludeAPIs,
-            RetentionPolicy,
-            Unknown,
-            Version,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Enabled") == 0)
-              {
-                path.emplace_back(XmlTagName::Enabled);
-              }
-              else if (std::strcmp(node.Name.data(), "IncludeAPIs") == 0)
-              {
-                path.emplace_back(XmlTagName::IncludeAPIs);
-              }
-              else if (std::strcmp(node.Name.data(), "RetentionPolicy") == 0)
-              {
-                path.emplace_back(XmlTagName::RetentionPolicy);
-              }
-              else if (std::strcmp(node.Name.data(), "Version") == 0)
-              {
-                path.emplace_back(XmlTagName::Version);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-
-              if (path.size() == 1 && path[0] == XmlTagName::RetentionPolicy)
-              {
-                result.RetentionPolicy = RetentionPolicyFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::Enabled)
-              {
-                result.Enabled = (std::strcmp(node.Value.data(), "true") == 0);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::IncludeAPIs)
-              {
-                result.IncludeApis = (std::strcmp(node.Value.data(), "true") == 0);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Version)
-              {
-                result.Version = node.Value;
-              }
-            }
-          }
-          return result;
-        }
-
-        static CorsRule CorsRuleFromXml(_internal::XmlReader& reader)
-        {
-          auto result = CorsRule();
-          enum class XmlTagName
-          {
-            AllowedHeaders,
-            AllowedMethods,
-            AllowedOrigins,
-            ExposedHeaders,
-            MaxAgeInSeconds,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "AllowedHeaders") == 0)
-              {
-                path.emplace_back(XmlTagName::AllowedHeaders);
-              }
-              else if (std::strcmp(node.Name.data(), "AllowedMethods") == 0)
-              {
-                path.emplace_back(XmlTagName::AllowedMethods);
-              }
-              else if (std::strcmp(node.Name.data(), "AllowedOrigins") == 0)
-              {
-                path.emplace_back(XmlTagName::AllowedOrigins);
-              }
-              else if (std::strcmp(node.Name.data(), "ExposedHeaders") == 0)
-              {
-                path.emplace_back(XmlTagName::ExposedHeaders);
-              }
-              else if (std::strcmp(node.Name.data(), "MaxAgeInSeconds") == 0)
-              {
-                path.emplace_back(XmlTagName::MaxAgeInSeconds);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::AllowedHeaders)
-              {
-                result.AllowedHeaders = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::AllowedMethods)
-              {
-                result.AllowedMethods = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::AllowedOrigins)
-              {
-                result.AllowedOrigins = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::ExposedHeaders)
-              {
-                result.ExposedHeaders = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::MaxAgeInSeconds)
-              {
-                result.MaxAgeInSeconds = std::stoi(node.Value);
-              }
-            }
-          }
-          return result;
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
-        static SmbMultichannel SmbMultichannelFromXml(_internal::XmlReader& reader)
-        {
-          auto result = SmbMultichannel();
-          enum class XmlTagName
-          {
-            Enabled,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
+        static RetentionPolicy RetentionPolicyFromXml(_internal::XmlReader& reader);
 
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Enabled") == 0)
-              {
-                path.emplace_back(XmlTagName::Enabled);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::Enabled)
-              {
-                result.Enabled = (std::strcmp(node.Value.data(), "true") == 0);
-              }
-            }
-          }
-          return result;
-        }
+        static Metrics MetricsFromXml(_internal::XmlReader& reader);
 
-        static SmbSettings SmbSettingsFromXml(_internal::XmlReader& reader)
-        {
-          auto result = SmbSettings();
-          enum class XmlTagName
-          {
-            Multichannel,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
+        static CorsRule CorsRuleFromXml(_internal::XmlReader& reader);
 
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Multichannel") == 0)
-              {
-                path.emplace_back(XmlTagName::Multichannel);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-
-              if (path.size() == 1 && path[0] == XmlTagName::Multichannel)
-              {
-                result.Multichannel = SmbMultichannelFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-            }
-          }
-          return result;
-        }
+        static SmbMultichannel SmbMultichannelFromXml(_internal::XmlReader& reader);
 
-        static ProtocolSettings ProtocolSettingsFromXml(_internal::XmlReader& reader)
-        {
-          auto result = ProtocolSettings();
-          enum class XmlTagName
-          {
-            SMB,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
+        static SmbSettings SmbSettingsFromXml(_internal::XmlReader& reader);
 
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "SMB") == 0)
-              {
-                path.emplace_back(XmlTagName::SMB);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-
-              if (path.size() == 1 && path[0] == XmlTagName::SMB)
-              {
-                result.Settings = SmbSettingsFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-            }
-          }
-          return result;
-        }
+        static ProtocolSettings ProtocolSettingsFromXml(_internal::XmlReader& reader);
 
-        static ShareServiceProperties ShareServicePropertiesFromXml(_internal::XmlReader& reader)
-        {
-          auto result = ShareServiceProperties();
-          enum class XmlTagName
-          {
-            Cors,
-            CorsRule,
-            HourMetrics,
-            MinuteMetrics,
-            ProtocolSettings,
-            StorageServiceProperties,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Cors") == 0)
-              {
-                path.emplace_back(XmlTagName::Cors);
-              }
-              else if (std::strcmp(node.Name.data(), "CorsRule") == 0)
-              {
-                path.emplace_back(XmlTagName::CorsRule);
-              }
-              else if (std::strcmp(node.Name.data(), "HourMetrics") == 0)
-              {
-                path.emplace_back(XmlTagName::HourMetrics);
-              }
-              else if (std::strcmp(node.Name.data(), "MinuteMetrics") == 0)
-              {
-                path.emplace_back(XmlTagName::MinuteMetrics);
-              }
-              else if (std::strcmp(node.Name.data(), "ProtocolSettings") == 0)
-              {
-                path.emplace_back(XmlTagName::ProtocolSettings);
-              }
-              else if (std::strcmp(node.Name.data(), "StorageServiceProperties") == 0)
-              {
-                path.emplace_back(XmlTagName::StorageServiceProperties);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-
-              if (path.size() == 2 && path[0] == XmlTagName::StorageServiceProperties
-                  && path[1] == XmlTagName::HourMetrics)
-              {
-                result.HourMetrics = MetricsFromXml(reader);
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::StorageServiceProperties
-                  && path[1] == XmlTagName::MinuteMetrics)
-              {
-                result.MinuteMetrics = MetricsFromXml(reader);
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::StorageServiceProperties
-                  && path[1] == XmlTagName::ProtocolSettings)
-              {
-                result.Protocol = ProtocolSettingsFromXml(reader);
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 3 && path[0] == XmlTagName::StorageServiceProperties
-                  && path[1] == XmlTagName::Cors && path[2] == XmlTagName::CorsRule)
-              {
-                result.Cors.emplace_back(CorsRuleFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-            }
-          }
-          return result;
-        }
+        static ShareServiceProperties ShareServicePropertiesFromXml(_internal::XmlReader& reader);
 
         static ServiceGetPropertiesResult ServiceGetPropertiesResultFromShareServiceProperties(
-            ShareServiceProperties object)
-        {
-          ServiceGetPropertiesResult result;
-          result.HourMetrics = std::move(object.HourMetrics);
-          result.MinuteMetrics = std::move(object.MinuteMetrics);
-          result.Cors = std::move(object.Cors);
-          result.Protocol = std::move(object.Protocol);
-
-          return result;
-        }
+            ShareServiceProperties object);
         static Azure::Response<ServiceListSharesSinglePageResult> ListSharesSinglePageParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success.
-            const auto& bodyBuffer = response.GetBody();
-            auto reader = _internal::XmlReader(
-                reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
-            ServiceListSharesSinglePageResult result = bodyBuffer.empty()
-                ? ServiceListSharesSinglePageResult()
-                : ServiceListSharesSinglePageResultFromListSharesResponse(
-                    ListSharesResponseFromXml(reader));
-            return Azure::Response<ServiceListSharesSinglePageResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
-
-        static LeaseStatus LeaseStatusFromXml(_internal::XmlReader& reader)
-        {
-          LeaseStatus result;
-          enum class XmlTagName
-          {
-            LeaseStatus,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "LeaseStatus") == 0)
-              {
-                path.emplace_back(XmlTagName::LeaseStatus);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::LeaseStatus)
-              {
-                result = LeaseStatus(node.Value);
-              }
-            }
-          }
-          return result;
-        }
-
-        static LeaseState LeaseStateFromXml(_internal::XmlReader& reader)
-        {
-          LeaseState result;
-          enum class XmlTagName
-          {
-            LeaseState,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "LeaseState") == 0)
-              {
-                path.emplace_back(XmlTagName::LeaseState);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::LeaseState)
-              {
-                result = LeaseState(node.Value);
-              }
-            }
-          }
-          return result;
-        }
+        static LeaseStatus LeaseStatusFromXml(_internal::XmlReader& reader);
 
-        static LeaseDuration LeaseDurationFromXml(_internal::XmlReader& reader)
-        {
-          LeaseDuration result;
-          enum class XmlTagName
-          {
-            LeaseDuration,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
+        static LeaseState LeaseStateFromXml(_internal::XmlReader& reader);
 
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "LeaseDuration") == 0)
-              {
-                path.emplace_back(XmlTagName::LeaseDuration);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::LeaseDuration)
-              {
-                result = LeaseDuration(node.Value);
-              }
-            }
-          }
-          return result;
-        }
+        static LeaseDuration LeaseDurationFromXml(_internal::XmlReader& reader);
 
-        static ShareItemDetails ShareItemDetailsFromXml(_internal::XmlReader& reader)
-        {
-          auto result = ShareItemDetails();
-          enum class XmlTagName
-          {
-            AccessTier,
-            AccessTierChangeTime,
-            AccessTierTransitionState,
-            DeletedTime,
-            Etag,
-            LastModified,
-            LeaseDuration,
-            LeaseState,
-            LeaseStatus,
-            NextAllowedQuotaDowngradeTime,
-            ProvisionedEgressMBps,
-            ProvisionedIngressMBps,
-            ProvisionedIops,
-            Quota,
-            RemainingRetentionDays,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "AccessTier") == 0)
-              {
-                path.emplace_back(XmlTagName::AccessTier);
-              }
-              else if (std::strcmp(node.Name.data(), "AccessTierChangeTime") == 0)
-              {
-                path.emplace_back(XmlTagName::AccessTierChangeTime);
-              }
-              else if (std::strcmp(node.Name.data(), "AccessTierTransitionState") == 0)
-              {
-                path.emplace_back(XmlTagName::AccessTierTransitionState);
-              }
-              else if (std::strcmp(node.Name.data(), "DeletedTime") == 0)
-              {
-                path.emplace_back(XmlTagName::DeletedTime);
-              }
-              else if (std::strcmp(node.Name.data(), "Etag") == 0)
-              {
-                path.emplace_back(XmlTagName::Etag);
-              }
-              else if (std::strcmp(node.Name.data(), "Last-Modified") == 0)
-              {
-                path.emplace_back(XmlTagName::LastModified);
-              }
-              else if (std::strcmp(node.Name.data(), "LeaseDuration") == 0)
-              {
-                path.emplace_back(XmlTagName::LeaseDuration);
-              }
-              else if (std::strcmp(node.Name.data(), "LeaseState") == 0)
-              {
-                path.emplace_back(XmlTagName::LeaseState);
-              }
-              else if (std::strcmp(node.Name.data(), "LeaseStatus") == 0)
-              {
-                path.emplace_back(XmlTagName::LeaseStatus);
-              }
-              else if (std::strcmp(node.Name.data(), "NextAllowedQuotaDowngradeTime") == 0)
-              {
-                path.emplace_back(XmlTagName::NextAllowedQuotaDowngradeTime);
-              }
-              else if (std::strcmp(node.Name.data(), "ProvisionedEgressMBps") == 0)
-              {
-                path.emplace_back(XmlTagName::ProvisionedEgressMBps);
-              }
-              else if (std::strcmp(node.Name.data(), "ProvisionedIngressMBps") == 0)
-              {
-                path.emplace_back(XmlTagName::ProvisionedIngressMBps);
-              }
-              else if (std::strcmp(node.Name.data(), "ProvisionedIops") == 0)
-              {
-                path.emplace_back(XmlTagName::ProvisionedIops);
-              }
-              else if (std::strcmp(node.Name.data(), "Quota") == 0)
-              {
-                path.emplace_back(XmlTagName::Quota);
-              }
-              else if (std::strcmp(node.Name.data(), "RemainingRetentionDays") == 0)
-              {
-                path.emplace_back(XmlTagName::RemainingRetentionDays);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-
-              if (path.size() == 1 && path[0] == XmlTagName::LeaseStatus)
-              {
-                result.LeaseStatus = LeaseStatusFromXml(reader);
-                path.pop_back();
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::LeaseState)
-              {
-                result.LeaseState = LeaseStateFromXml(reader);
-                path.pop_back();
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::LeaseDuration)
-              {
-                result.LeaseDuration = LeaseDurationFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::AccessTier)
-              {
-                result.AccessTier = AccessTier(node.Value);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::AccessTierChangeTime)
-              {
-                result.AccessTierChangedOn
-                    = DateTime::Parse(node.Value, DateTime::DateFormat::Rfc1123);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::AccessTierTransitionState)
-              {
-                result.AccessTierTransitionState = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::DeletedTime)
-              {
-                result.DeletedOn = DateTime::Parse(node.Value, DateTime::DateFormat::Rfc1123);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Etag)
-              {
-                result.Etag = Azure::ETag(node.Value);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::LastModified)
-              {
-                result.LastModified = DateTime::Parse(node.Value, DateTime::DateFormat::Rfc1123);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::NextAllowedQuotaDowngradeTime)
-              {
-                result.NextAllowedQuotaDowngradeTime
-                    = DateTime::Parse(node.Value, DateTime::DateFormat::Rfc1123);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::ProvisionedEgressMBps)
-              {
-                result.ProvisionedEgressMBps = std::stoi(node.Value);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::ProvisionedIngressMBps)
-              {
-                result.ProvisionedIngressMBps = std::stoi(node.Value);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::ProvisionedIops)
-              {
-                result.ProvisionedIops = std::stoi(node.Value);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Quota)
-              {
-                result.Quota = std::stoll(node.Value);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::RemainingRetentionDays)
-              {
-                result.RemainingRetentionDays = std::stoi(node.Value);
-              }
-            }
-          }
-          return result;
-        }
+        static ShareItemDetails ShareItemDetailsFromXml(_internal::XmlReader& reader);
 
-        static Metadata MetadataFromXml(_internal::XmlReader& reader)
-        {
-          Metadata result;
-          int depth = 0;
-          std::string key;
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-              if (depth++ == 0)
-              {
-                key = node.Name;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (depth-- == 0)
-              {
-                break;
-              }
-            }
-            else if (depth == 1 && node.Type == _internal::XmlNodeType::Text)
-            {
-              result.emplace(std::move(key), node.Value);
-            }
-          }
-          return result;
-        }
+        static Metadata MetadataFromXml(_internal::XmlReader& reader);
 
-        static ShareItem ShareItemFromXml(_internal::XmlReader& reader)
-        {
-          auto result = ShareItem();
-          enum class XmlTagName
-          {
-            Deleted,
-            Metadata,
-            Name,
-            Properties,
-            Snapshot,
-            Unknown,
-            Version,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Deleted") == 0)
-              {
-                path.emplace_back(XmlTagName::Deleted);
-              }
-              else if (std::strcmp(node.Name.data(), "Metadata") == 0)
-              {
-                path.emplace_back(XmlTagName::Metadata);
-              }
-              else if (std::strcmp(node.Name.data(), "Name") == 0)
-              {
-                path.emplace_back(XmlTagName::Name);
-              }
-              else if (std::strcmp(node.Name.data(), "Properties") == 0)
-              {
-                path.emplace_back(XmlTagName::Properties);
-              }
-              else if (std::strcmp(node.Name.data(), "Snapshot") == 0)
-              {
-                path.emplace_back(XmlTagName::Snapshot);
-              }
-              else if (std::strcmp(node.Name.data(), "Version") == 0)
-              {
-                path.emplace_back(XmlTagName::Version);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-
-              if (path.size() == 1 && path[0] == XmlTagName::Properties)
-              {
-                result.Details = ShareItemDetailsFromXml(reader);
-                path.pop_back();
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Metadata)
-              {
-                result.Metadata = MetadataFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::Deleted)
-              {
-                result.Deleted = (std::strcmp(node.Value.data(), "true") == 0);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Name)
-              {
-                result.Name = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Snapshot)
-              {
-                result.Snapshot = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Version)
-              {
-                result.Version = node.Value;
-              }
-            }
-          }
-          return result;
-        }
+        static ShareItem ShareItemFromXml(_internal::XmlReader& reader);
 
-        static ListSharesResponse ListSharesResponseFromXml(_internal::XmlReader& reader)
-        {
-          auto result = ListSharesResponse();
-          enum class XmlTagName
-          {
-            EnumerationResults,
-            MaxResults,
-            NextMarker,
-            Prefix,
-            Share,
-            Shares,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::EnumerationResults);
-              }
-              else if (std::strcmp(node.Name.data(), "MaxResults") == 0)
-              {
-                path.emplace_back(XmlTagName::MaxResults);
-              }
-              else if (std::strcmp(node.Name.data(), "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::NextMarker);
-              }
-              else if (std::strcmp(node.Name.data(), "Prefix") == 0)
-              {
-                path.emplace_back(XmlTagName::Prefix);
-              }
-              else if (std::strcmp(node.Name.data(), "Share") == 0)
-              {
-                path.emplace_back(XmlTagName::Share);
-              }
-              else if (std::strcmp(node.Name.data(), "Shares") == 0)
-              {
-                path.emplace_back(XmlTagName::Shares);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-              if (path.size() == 3 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::Shares && path[2] == XmlTagName::Share)
-              {
-                result.Items.emplace_back(ShareItemFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 2 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::NextMarker)
-              {
-                result.ContinuationToken = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::MaxResults)
-              {
-                result.PageSizeHint = std::stoi(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::Prefix)
-              {
-                result.Prefix = node.Value;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Attribute)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::EnumerationResults
-                  && (std::strcmp(node.Name.data(), "ServiceEndpoint") == 0))
-              {
-                result.ServiceEndpoint = node.Value;
-              }
-            }
-          }
-          return result;
-        }
+        static ListSharesResponse ListSharesResponseFromXml(_internal::XmlReader& reader);
 
         static ServiceListSharesSinglePageResult
-        ServiceListSharesSinglePageResultFromListSharesResponse(ListSharesResponse object)
-        {
-          ServiceListSharesSinglePageResult result;
-          result.ServiceEndpoint = std::move(object.ServiceEndpoint);
-          result.Prefix = std::move(object.Prefix);
-          result.PageSizeHint = object.PageSizeHint;
-          result.Items = std::move(object.Items);
-          result.ContinuationToken = std::move(object.ContinuationToken);
-
-          return result;
-        }
+        ServiceListSharesSinglePageResultFromListSharesResponse(ListSharesResponse object);
       };
 
       class Share final {
@@ -3727,34 +2391,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const CreateOptions& createOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          if (createOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(std::to_string(createOptions.Timeout.Value())));
-          }
-          for (const auto& pair : createOptions.Metadata)
-          {
-            request.SetHeader(_detail::HeaderMetadata + ("-" + pair.first), pair.second);
-          }
-          if (createOptions.ShareQuota.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderQuota, std::to_string(createOptions.ShareQuota.Value()));
-          }
-          if (createOptions.XMsAccessTier.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderAccessTier, createOptions.XMsAccessTier.Value().ToString());
-          }
-          request.SetHeader(_detail::HeaderVersion, createOptions.ApiVersionParameter);
-          return CreateParseResult(context, pipeline.Send(request, context));
-        }
+            const CreateOptions& createOptions);
 
         struct GetPropertiesOptions final
         {
@@ -3768,30 +2405,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const GetPropertiesOptions& getPropertiesOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          if (getPropertiesOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(getPropertiesOptions.ShareSnapshot.Value()));
-          }
-          if (getPropertiesOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(getPropertiesOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, getPropertiesOptions.ApiVersionParameter);
-          if (getPropertiesOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, getPropertiesOptions.LeaseIdOptional.Value());
-          }
-          return GetPropertiesParseResult(context, pipeline.Send(request, context));
-        }
+            const GetPropertiesOptions& getPropertiesOptions);
 
         struct DeleteOptions final
         {
@@ -3806,35 +2420,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const DeleteOptions& deleteOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Delete, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          if (deleteOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(deleteOptions.ShareSnapshot.Value()));
-          }
-          if (deleteOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(std::to_string(deleteOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, deleteOptions.ApiVersionParameter);
-          if (deleteOptions.XMsDeleteSnapshots.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderDeleteSnapshots,
-                deleteOptions.XMsDeleteSnapshots.Value().ToString());
-          }
-          if (deleteOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, deleteOptions.LeaseIdOptional.Value());
-          }
-          return DeleteParseResult(context, pipeline.Send(request, context));
-        }
+            const DeleteOptions& deleteOptions);
 
         struct AcquireLeaseOptions final
         {
@@ -3849,37 +2435,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const AcquireLeaseOptions& acquireLeaseOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "lease");
-          request.SetHeader(_detail::HeaderAction, "acquire");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          if (acquireLeaseOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(acquireLeaseOptions.Timeout.Value())));
-          }
-          request.SetHeader(
-              _detail::HeaderDuration, std::to_string(acquireLeaseOptions.LeaseDuration));
-          if (acquireLeaseOptions.ProposedLeaseIdOptional.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderProposedLeaseId,
-                acquireLeaseOptions.ProposedLeaseIdOptional.Value());
-          }
-          request.SetHeader(_detail::HeaderVersion, acquireLeaseOptions.ApiVersionParameter);
-          if (acquireLeaseOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(acquireLeaseOptions.ShareSnapshot.Value()));
-          }
-          return AcquireLeaseParseResult(context, pipeline.Send(request, context));
-        }
+            const AcquireLeaseOptions& acquireLeaseOptions);
 
         struct ReleaseLeaseOptions final
         {
@@ -3893,30 +2449,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const ReleaseLeaseOptions& releaseLeaseOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "lease");
-          request.SetHeader(_detail::HeaderAction, "release");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          if (releaseLeaseOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(releaseLeaseOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderLeaseId, releaseLeaseOptions.LeaseIdRequired);
-          request.SetHeader(_detail::HeaderVersion, releaseLeaseOptions.ApiVersionParameter);
-          if (releaseLeaseOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(releaseLeaseOptions.ShareSnapshot.Value()));
-          }
-          return ReleaseLeaseParseResult(context, pipeline.Send(request, context));
-        }
+            const ReleaseLeaseOptions& releaseLeaseOptions);
 
         struct ChangeLeaseOptions final
         {
@@ -3931,35 +2464,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const ChangeLeaseOptions& changeLeaseOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "lease");
-          request.SetHeader(_detail::HeaderAction, "change");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          if (changeLeaseOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(changeLeaseOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderLeaseId, changeLeaseOptions.LeaseIdRequired);
-          if (changeLeaseOptions.ProposedLeaseIdOptional.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderProposedLeaseId, changeLeaseOptions.ProposedLeaseIdOptional.Value());
-          }
-          request.SetHeader(_detail::HeaderVersion, changeLeaseOptions.ApiVersionParameter);
-          if (changeLeaseOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(changeLeaseOptions.ShareSnapshot.Value()));
-          }
-          return ChangeLeaseParseResult(context, pipeline.Send(request, context));
-        }
+            const ChangeLeaseOptions& changeLeaseOptions);
 
         struct RenewLeaseOptions final
         {
@@ -3973,30 +2478,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const RenewLeaseOptions& renewLeaseOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "lease");
-          request.SetHeader(_detail::HeaderAction, "renew");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          if (renewLeaseOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(renewLeaseOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderLeaseId, renewLeaseOptions.LeaseIdRequired);
-          request.SetHeader(_detail::HeaderVersion, renewLeaseOptions.ApiVersionParameter);
-          if (renewLeaseOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(renewLeaseOptions.ShareSnapshot.Value()));
-          }
-          return RenewLeaseParseResult(context, pipeline.Send(request, context));
-        }
+            const RenewLeaseOptions& renewLeaseOptions);
 
         struct BreakLeaseOptions final
         {
@@ -4011,39 +2493,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const BreakLeaseOptions& breakLeaseOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "lease");
-          request.SetHeader(_detail::HeaderAction, "break");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          if (breakLeaseOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(breakLeaseOptions.Timeout.Value())));
-          }
-          if (breakLeaseOptions.LeaseBreakPeriod.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderBreakPeriod,
-                std::to_string(breakLeaseOptions.LeaseBreakPeriod.Value()));
-          }
-          if (breakLeaseOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, breakLeaseOptions.LeaseIdOptional.Value());
-          }
-          request.SetHeader(_detail::HeaderVersion, breakLeaseOptions.ApiVersionParameter);
-          if (breakLeaseOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(breakLeaseOptions.ShareSnapshot.Value()));
-          }
-          return BreakLeaseParseResult(context, pipeline.Send(request, context));
-        }
+            const BreakLeaseOptions& breakLeaseOptions);
 
         struct CreateSnapshotOptions final
         {
@@ -4056,26 +2506,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const CreateSnapshotOptions& createSnapshotOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "snapshot");
-          if (createSnapshotOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(createSnapshotOptions.Timeout.Value())));
-          }
-          for (const auto& pair : createSnapshotOptions.Metadata)
-          {
-            request.SetHeader(_detail::HeaderMetadata + ("-" + pair.first), pair.second);
-          }
-          request.SetHeader(_detail::HeaderVersion, createSnapshotOptions.ApiVersionParameter);
-          return CreateSnapshotParseResult(context, pipeline.Send(request, context));
-        }
+            const CreateSnapshotOptions& createSnapshotOptions);
 
         struct CreatePermissionOptions final
         {
@@ -4088,31 +2519,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const CreatePermissionOptions& createPermissionOptions)
-        {
-
-          std::string json_body;
-          {
-            Azure::Core::Json::_internal::json json;
-            SharePermissionToJson(json, createPermissionOptions.Permission);
-            json_body = json.dump();
-          }
-          auto body = Azure::Core::IO::MemoryBodyStream(
-              reinterpret_cast<const uint8_t*>(json_body.data()), json_body.length());
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url, &body);
-          request.SetHeader("Content-Length", std::to_string(body.Length()));
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "filepermission");
-          if (createPermissionOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(createPermissionOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, createPermissionOptions.ApiVersionParameter);
-          return CreatePermissionParseResult(context, pipeline.Send(request, context));
-        }
+            const CreatePermissionOptions& createPermissionOptions);
 
         struct GetPermissionOptions final
         {
@@ -4125,23 +2532,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const GetPermissionOptions& getPermissionOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "filepermission");
-          request.SetHeader(
-              _detail::HeaderFilePermissionKey, getPermissionOptions.FilePermissionKeyRequired);
-          if (getPermissionOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(getPermissionOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, getPermissionOptions.ApiVersionParameter);
-          return GetPermissionParseResult(context, pipeline.Send(request, context));
-        }
+            const GetPermissionOptions& getPermissionOptions);
 
         struct SetPropertiesOptions final
         {
@@ -4156,36 +2547,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const SetPropertiesOptions& setPropertiesOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "properties");
-          if (setPropertiesOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(setPropertiesOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, setPropertiesOptions.ApiVersionParameter);
-          if (setPropertiesOptions.ShareQuota.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderQuota, std::to_string(setPropertiesOptions.ShareQuota.Value()));
-          }
-          if (setPropertiesOptions.XMsAccessTier.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderAccessTier, setPropertiesOptions.XMsAccessTier.Value().ToString());
-          }
-          if (setPropertiesOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, setPropertiesOptions.LeaseIdOptional.Value());
-          }
-          return SetPropertiesParseResult(context, pipeline.Send(request, context));
-        }
+            const SetPropertiesOptions& setPropertiesOptions);
 
         struct SetMetadataOptions final
         {
@@ -4199,32 +2561,9 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const SetMetadataOptions& setMetadataOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "metadata");
-          if (setMetadataOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(setMetadataOptions.Timeout.Value())));
-          }
-          for (const auto& pair : setMetadataOptions.Metadata)
-          {
-            request.SetHeader(_detail::HeaderMetadata + ("-" + pair.first), pair.second);
-          }
-          request.SetHeader(_detail::HeaderVersion, setMetadataOptions.ApiVersionParameter);
-          if (setMetadataOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, setMetadataOptions.LeaseIdOptional.Value());
-          }
-          return SetMetadataParseResult(context, pipeline.Send(request, context));
-        }
-
-        struct GetAccessPolicyOptions final
+            const SetMetadataOptions& setMetadataOptions);
+
+        struct GetAccessPolicyOptions final
         {
           Azure::Nullable<int32_t> Timeout;
           std::string ApiVersionParameter = _detail::DefaultServiceApiVersion;
@@ -4235,26 +2574,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const GetAccessPolicyOptions& getAccessPolicyOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "acl");
-          if (getAccessPolicyOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(getAccessPolicyOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, getAccessPolicyOptions.ApiVersionParameter);
-          if (getAccessPolicyOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderLeaseId, getAccessPolicyOptions.LeaseIdOptional.Value());
-          }
-          return GetAccessPolicyParseResult(context, pipeline.Send(request, context));
-        }
+            const GetAccessPolicyOptions& getAccessPolicyOptions);
 
         struct SetAccessPolicyOptions final
         {
@@ -4268,37 +2588,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const SetAccessPolicyOptions& setAccessPolicyOptions)
-        {
-
-          std::string xml_body;
-          {
-            _internal::XmlWriter writer;
-            SignedIdentifiersToXml(writer, setAccessPolicyOptions.ShareAcl);
-            writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
-            xml_body = writer.GetDocument();
-          }
-          auto body = Azure::Core::IO::MemoryBodyStream(
-              reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, url, &body);
-          request.SetHeader("Content-Length", std::to_string(body.Length()));
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "acl");
-          if (setAccessPolicyOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(setAccessPolicyOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, setAccessPolicyOptions.ApiVersionParameter);
-          if (setAccessPolicyOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderLeaseId, setAccessPolicyOptions.LeaseIdOptional.Value());
-          }
-          return SetAccessPolicyParseResult(context, pipeline.Send(request, context));
-        }
+            const SetAccessPolicyOptions& setAccessPolicyOptions);
 
         struct GetStatisticsOptions final
         {
@@ -4311,25 +2601,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const GetStatisticsOptions& getStatisticsOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "stats");
-          if (getStatisticsOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(getStatisticsOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, getStatisticsOptions.ApiVersionParameter);
-          if (getStatisticsOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, getStatisticsOptions.LeaseIdOptional.Value());
-          }
-          return GetStatisticsParseResult(context, pipeline.Send(request, context));
-        }
+            const GetStatisticsOptions& getStatisticsOptions);
 
         struct RestoreOptions final
         {
@@ -4343,825 +2615,105 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const RestoreOptions& restoreOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "share");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "undelete");
-          if (restoreOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(std::to_string(restoreOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, restoreOptions.ApiVersionParameter);
-          if (restoreOptions.DeletedShareName.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderDeletedShareName, restoreOptions.DeletedShareName.Value());
-          }
-          if (restoreOptions.DeletedShareVersion.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderDeletedShareVersion, restoreOptions.DeletedShareVersion.Value());
-          }
-          return RestoreParseResult(context, pipeline.Send(request, context));
-        }
+            const RestoreOptions& restoreOptions);
 
       private:
         static Azure::Response<Models::CreateShareResult> CreateParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Created)
-          {
-            // Success, Share created.
-            Models::CreateShareResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            return Azure::Response<Models::CreateShareResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::ShareProperties> GetPropertiesParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success
-            Models::ShareProperties result;
-
-            for (auto i = response.GetHeaders().lower_bound(_detail::HeaderMetadata);
-                 i != response.GetHeaders().end()
-                 && i->first.substr(0, 9) == _detail::HeaderMetadata;
-                 ++i)
-            {
-              result.Metadata.emplace(i->first.substr(10), i->second);
-            }
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.Quota = std::stoll(response.GetHeaders().at(_detail::HeaderQuota));
-            if (response.GetHeaders().find(_detail::HeaderProvisionedIops)
-                != response.GetHeaders().end())
-            {
-              result.ProvisionedIops
-                  = std::stoi(response.GetHeaders().at(_detail::HeaderProvisionedIops));
-            }
-            if (response.GetHeaders().find(_detail::HeaderProvisionedIngressMBps)
-                != response.GetHeaders().end())
-            {
-              result.ProvisionedIngressMBps
-                  = std::stoi(response.GetHeaders().at(_detail::HeaderProvisionedIngressMBps));
-            }
-            if (response.GetHeaders().find(_detail::HeaderProvisionedEgressMBps)
-                != response.GetHeaders().end())
-            {
-              result.ProvisionedEgressMBps
-                  = std::stoi(response.GetHeaders().at(_detail::HeaderProvisionedEgressMBps));
-            }
-            if (response.GetHeaders().find(_detail::HeaderNextAllowedQuotaDowngradeTime)
-                != response.GetHeaders().end())
-            {
-              result.NextAllowedQuotaDowngradeTime = DateTime::Parse(
-                  response.GetHeaders().at(_detail::HeaderNextAllowedQuotaDowngradeTime),
-                  DateTime::DateFormat::Rfc1123);
-            }
-            if (response.GetHeaders().find(_detail::HeaderLeaseDuration)
-                != response.GetHeaders().end())
-            {
-              result.LeaseDuration
-                  = LeaseDuration(response.GetHeaders().at(_detail::HeaderLeaseDuration));
-            }
-            if (response.GetHeaders().find(_detail::HeaderLeaseState)
-                != response.GetHeaders().end())
-            {
-              result.LeaseState = LeaseState(response.GetHeaders().at(_detail::HeaderLeaseState));
-            }
-            if (response.GetHeaders().find(_detail::HeaderLeaseStatus)
-                != response.GetHeaders().end())
-            {
-              result.LeaseStatus
-                  = LeaseStatus(response.GetHeaders().at(_detail::HeaderLeaseStatus));
-            }
-            if (response.GetHeaders().find("x-ms-access-tier") != response.GetHeaders().end())
-            {
-              result.AccessTier = AccessTier(response.GetHeaders().at("x-ms-access-tier"));
-            }
-            if (response.GetHeaders().find(_detail::HeaderAccessTierChangedOn)
-                != response.GetHeaders().end())
-            {
-              result.AccessTierChangedOn = DateTime::Parse(
-                  response.GetHeaders().at(_detail::HeaderAccessTierChangedOn),
-                  DateTime::DateFormat::Rfc1123);
-            }
-            if (response.GetHeaders().find(_detail::HeaderAccessTierTransitionState)
-                != response.GetHeaders().end())
-            {
-              result.AccessTierTransitionState
-                  = response.GetHeaders().at(_detail::HeaderAccessTierTransitionState);
-            }
-            return Azure::Response<Models::ShareProperties>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::DeleteShareResult> DeleteParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Accepted)
-          {
-            // Accepted
-            Models::DeleteShareResult result;
-            return Azure::Response<Models::DeleteShareResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::AcquireLeaseResult> AcquireLeaseParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Created)
-          {
-            // The Acquire operation completed successfully.
-            Models::AcquireLeaseResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.LeaseId = response.GetHeaders().at(_detail::HeaderLeaseId);
-            return Azure::Response<Models::AcquireLeaseResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::ReleaseLeaseResult> ReleaseLeaseParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // The Release operation completed successfully.
-            Models::ReleaseLeaseResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            return Azure::Response<Models::ReleaseLeaseResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::ChangeLeaseResult> ChangeLeaseParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // The Change operation completed successfully.
-            Models::ChangeLeaseResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.LeaseId = response.GetHeaders().at(_detail::HeaderLeaseId);
-            return Azure::Response<Models::ChangeLeaseResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::RenewLeaseResult> RenewLeaseParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // The Renew operation completed successfully.
-            Models::RenewLeaseResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.LeaseId = response.GetHeaders().at(_detail::HeaderLeaseId);
-            return Azure::Response<Models::RenewLeaseResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::BreakLeaseResult> BreakLeaseParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Accepted)
-          {
-            // The Break operation completed successfully.
-            Models::BreakLeaseResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            return Azure::Response<Models::BreakLeaseResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::CreateShareSnapshotResult> CreateSnapshotParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Created)
-          {
-            // Success, Share snapshot created.
-            Models::CreateShareSnapshotResult result;
-            result.Snapshot = response.GetHeaders().at(_detail::HeaderSnapshot);
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            return Azure::Response<Models::CreateShareSnapshotResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::CreateSharePermissionResult> CreatePermissionParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Created)
-          {
-            // Success, Share level permission created.
-            Models::CreateSharePermissionResult result;
-            result.FilePermissionKey = response.GetHeaders().at(_detail::HeaderFilePermissionKey);
-            return Azure::Response<Models::CreateSharePermissionResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static void SharePermissionToJson(
             Azure::Core::Json::_internal::json& node,
-            const SharePermission& object)
-        {
-          node["permission"] = object.FilePermission;
-        }
+            const SharePermission& object);
 
         static Azure::Response<ShareGetPermissionResult> GetPermissionParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success
-            const auto& bodyBuffer = response.GetBody();
-            ShareGetPermissionResult result = bodyBuffer.empty()
-                ? ShareGetPermissionResult()
-                : ShareGetPermissionResultFromSharePermission(
-                    SharePermissionFromJson(Azure::Core::Json::_internal::json::parse(bodyBuffer)));
-            return Azure::Response<ShareGetPermissionResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static SharePermission SharePermissionFromJson(
-            const Azure::Core::Json::_internal::json& node)
-        {
-          SharePermission result;
-          result.FilePermission = node["permission"].get<std::string>();
-          return result;
-        }
+            const Azure::Core::Json::_internal::json& node);
 
         static ShareGetPermissionResult ShareGetPermissionResultFromSharePermission(
-            SharePermission object)
-        {
-          ShareGetPermissionResult result;
-          result.FilePermission = std::move(object.FilePermission);
-
-          return result;
-        }
+            SharePermission object);
         static Azure::Response<Models::SetSharePropertiesResult> SetPropertiesParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success
-            Models::SetSharePropertiesResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            return Azure::Response<Models::SetSharePropertiesResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::SetShareMetadataResult> SetMetadataParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success
-            Models::SetShareMetadataResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            return Azure::Response<Models::SetShareMetadataResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::ShareAccessPolicy> GetAccessPolicyParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success
-            const auto& bodyBuffer = response.GetBody();
-            auto reader = _internal::XmlReader(
-                reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
-            Models::ShareAccessPolicy result = bodyBuffer.empty()
-                ? Models::ShareAccessPolicy()
-                : ShareAccessPolicyFromSignedIdentifiers(SignedIdentifiersFromXml(reader));
-            return Azure::Response<Models::ShareAccessPolicy>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
-
-        static AccessPolicy AccessPolicyFromXml(_internal::XmlReader& reader)
-        {
-          auto result = AccessPolicy();
-          enum class XmlTagName
-          {
-            Expiry,
-            Permission,
-            Start,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Expiry") == 0)
-              {
-                path.emplace_back(XmlTagName::Expiry);
-              }
-              else if (std::strcmp(node.Name.data(), "Permission") == 0)
-              {
-                path.emplace_back(XmlTagName::Permission);
-              }
-              else if (std::strcmp(node.Name.data(), "Start") == 0)
-              {
-                path.emplace_back(XmlTagName::Start);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::Expiry)
-              {
-                result.ExpiresOn = DateTime::Parse(node.Value, DateTime::DateFormat::Rfc3339);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Permission)
-              {
-                result.Permission = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Start)
-              {
-                result.StartsOn = DateTime::Parse(node.Value, DateTime::DateFormat::Rfc3339);
-              }
-            }
-          }
-          return result;
-        }
-
-        static SignedIdentifier SignedIdentifierFromXml(_internal::XmlReader& reader)
-        {
-          auto result = SignedIdentifier();
-          enum class XmlTagName
-          {
-            AccessPolicy,
-            Id,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "AccessPolicy") == 0)
-              {
-                path.emplace_back(XmlTagName::AccessPolicy);
-              }
-              else if (std::strcmp(node.Name.data(), "Id") == 0)
-              {
-                path.emplace_back(XmlTagName::Id);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-
-              if (path.size() == 1 && path[0] == XmlTagName::AccessPolicy)
-              {
-                result.Policy = AccessPolicyFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::Id)
-              {
-                result.Id = node.Value;
-              }
-            }
-          }
-          return result;
-        }
+        static AccessPolicy AccessPolicyFromXml(_internal::XmlReader& reader);
 
-        static std::vector<SignedIdentifier> SignedIdentifiersFromXml(_internal::XmlReader& reader)
-        {
-          auto result = std::vector<SignedIdentifier>();
-          enum class XmlTagName
-          {
-            SignedIdentifier,
-            SignedIdentifiers,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
+        static SignedIdentifier SignedIdentifierFromXml(_internal::XmlReader& reader);
 
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "SignedIdentifier") == 0)
-              {
-                path.emplace_back(XmlTagName::SignedIdentifier);
-              }
-              else if (std::strcmp(node.Name.data(), "SignedIdentifiers") == 0)
-              {
-                path.emplace_back(XmlTagName::SignedIdentifiers);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-
-              if (path.size() == 2 && path[0] == XmlTagName::SignedIdentifiers
-                  && path[1] == XmlTagName::SignedIdentifier)
-              {
-                result.emplace_back(SignedIdentifierFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-            }
-          }
-          return result;
-        }
+        static std::vector<SignedIdentifier> SignedIdentifiersFromXml(_internal::XmlReader& reader);
 
         static Models::ShareAccessPolicy ShareAccessPolicyFromSignedIdentifiers(
-            std::vector<SignedIdentifier> object)
-        {
-          Models::ShareAccessPolicy result;
-          result.SignedIdentifiers = std::move(object);
-
-          return result;
-        }
+            std::vector<SignedIdentifier> object);
         static Azure::Response<Models::SetShareAccessPolicyResult> SetAccessPolicyParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success.
-            Models::SetShareAccessPolicyResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            return Azure::Response<Models::SetShareAccessPolicyResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
-        static void AccessPolicyToXml(_internal::XmlWriter& writer, const AccessPolicy& object)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "AccessPolicy"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Start"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text,
-              std::string(),
-              object.StartsOn.ToString(
-                  Azure::DateTime::DateFormat::Rfc3339, DateTime::TimeFractionFormat::AllDigits)});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Expiry"});
-          writer.Write(_internal::XmlNode{
-              _internal::XmlNodeType::Text,
-              std::string(),
-              object.ExpiresOn.ToString(
-                  Azure::DateTime::DateFormat::Rfc3339, DateTime::TimeFractionFormat::AllDigits)});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Permission"});
-          writer.Write(
-              _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), object.Permission});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+        static void AccessPolicyToXml(_internal::XmlWriter& writer, const AccessPolicy& object);
 
         static void SignedIdentifierToXml(
             _internal::XmlWriter& writer,
-            const SignedIdentifier& object)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "SignedIdentifier"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "Id"});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::Text, std::string(), object.Id});
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-          AccessPolicyToXml(writer, object.Policy);
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+            const SignedIdentifier& object);
 
         static void SignedIdentifiersToXml(
             _internal::XmlWriter& writer,
-            const std::vector<SignedIdentifier>& object)
-        {
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "SignedIdentifiers"});
-          for (const auto& item : object)
-          {
-            SignedIdentifierToXml(writer, item);
-          }
-          writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
-        }
+            const std::vector<SignedIdentifier>& object);
         static Azure::Response<Models::ShareStatistics> GetStatisticsParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success
-            const auto& bodyBuffer = response.GetBody();
-            auto reader = _internal::XmlReader(
-                reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
-            Models::ShareStatistics result = bodyBuffer.empty()
-                ? Models::ShareStatistics()
-                : ShareStatisticsFromShareStats(ShareStatsFromXml(reader));
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            return Azure::Response<Models::ShareStatistics>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
-
-        static ShareStats ShareStatsFromXml(_internal::XmlReader& reader)
-        {
-          auto result = ShareStats();
-          enum class XmlTagName
-          {
-            ShareStats,
-            ShareUsageBytes,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "ShareStats") == 0)
-              {
-                path.emplace_back(XmlTagName::ShareStats);
-              }
-              else if (std::strcmp(node.Name.data(), "ShareUsageBytes") == 0)
-              {
-                path.emplace_back(XmlTagName::ShareUsageBytes);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 2 && path[0] == XmlTagName::ShareStats
-                  && path[1] == XmlTagName::ShareUsageBytes)
-              {
-                result.ShareUsageInBytes = std::stoll(node.Value);
-              }
-            }
-          }
-          return result;
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
-        static Models::ShareStatistics ShareStatisticsFromShareStats(ShareStats object)
-        {
-          Models::ShareStatistics result;
-          result.ShareUsageInBytes = object.ShareUsageInBytes;
+        static ShareStats ShareStatsFromXml(_internal::XmlReader& reader);
 
-          return result;
-        }
+        static Models::ShareStatistics ShareStatisticsFromShareStats(ShareStats object);
         static Azure::Response<ShareRestoreResult> RestoreParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Created)
-          {
-            // Created
-            ShareRestoreResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            return Azure::Response<ShareRestoreResult>(std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
       };
 
       class Directory final {
@@ -5182,36 +2734,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const CreateOptions& createOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "directory");
-          if (createOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(std::to_string(createOptions.Timeout.Value())));
-          }
-          for (const auto& pair : createOptions.Metadata)
-          {
-            request.SetHeader(_detail::HeaderMetadata + ("-" + pair.first), pair.second);
-          }
-          request.SetHeader(_detail::HeaderVersion, createOptions.ApiVersionParameter);
-          if (createOptions.FilePermission.HasValue())
-          {
-            request.SetHeader(_detail::HeaderFilePermission, createOptions.FilePermission.Value());
-          }
-          if (createOptions.FilePermissionKey.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFilePermissionKey, createOptions.FilePermissionKey.Value());
-          }
-          request.SetHeader(_detail::HeaderFileAttributes, createOptions.FileAttributes);
-          request.SetHeader(_detail::HeaderFileCreatedOn, createOptions.FileCreationTime);
-          request.SetHeader(_detail::HeaderFileLastWrittenOn, createOptions.FileLastWriteTime);
-          return CreateParseResult(context, pipeline.Send(request, context));
-        }
+            const CreateOptions& createOptions);
 
         struct GetPropertiesOptions final
         {
@@ -5224,26 +2747,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const GetPropertiesOptions& getPropertiesOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "directory");
-          if (getPropertiesOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(getPropertiesOptions.ShareSnapshot.Value()));
-          }
-          if (getPropertiesOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(getPropertiesOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, getPropertiesOptions.ApiVersionParameter);
-          return GetPropertiesParseResult(context, pipeline.Send(request, context));
-        }
+            const GetPropertiesOptions& getPropertiesOptions);
 
         struct DeleteOptions final
         {
@@ -5255,19 +2759,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const DeleteOptions& deleteOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Delete, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "directory");
-          if (deleteOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(std::to_string(deleteOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, deleteOptions.ApiVersionParameter);
-          return DeleteParseResult(context, pipeline.Send(request, context));
-        }
+            const DeleteOptions& deleteOptions);
 
         struct SetPropertiesOptions final
         {
@@ -5284,36 +2776,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const SetPropertiesOptions& setPropertiesOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "directory");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "properties");
-          if (setPropertiesOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(setPropertiesOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, setPropertiesOptions.ApiVersionParameter);
-          if (setPropertiesOptions.FilePermission.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFilePermission, setPropertiesOptions.FilePermission.Value());
-          }
-          if (setPropertiesOptions.FilePermissionKey.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFilePermissionKey, setPropertiesOptions.FilePermissionKey.Value());
-          }
-          request.SetHeader(_detail::HeaderFileAttributes, setPropertiesOptions.FileAttributes);
-          request.SetHeader(_detail::HeaderFileCreatedOn, setPropertiesOptions.FileCreationTime);
-          request.SetHeader(
-              _detail::HeaderFileLastWrittenOn, setPropertiesOptions.FileLastWriteTime);
-          return SetPropertiesParseResult(context, pipeline.Send(request, context));
-        }
+            const SetPropertiesOptions& setPropertiesOptions);
 
         struct SetMetadataOptions final
         {
@@ -5326,26 +2789,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const SetMetadataOptions& setMetadataOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "directory");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "metadata");
-          if (setMetadataOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(setMetadataOptions.Timeout.Value())));
-          }
-          for (const auto& pair : setMetadataOptions.Metadata)
-          {
-            request.SetHeader(_detail::HeaderMetadata + ("-" + pair.first), pair.second);
-          }
-          request.SetHeader(_detail::HeaderVersion, setMetadataOptions.ApiVersionParameter);
-          return SetMetadataParseResult(context, pipeline.Send(request, context));
-        }
+            const SetMetadataOptions& setMetadataOptions);
 
         struct ListFilesAndDirectoriesSinglePageOptions final
         {
@@ -5363,51 +2807,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
             const ListFilesAndDirectoriesSinglePageOptions&
-                listFilesAndDirectoriesSinglePageOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryRestype, "directory");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "list");
-          if (listFilesAndDirectoriesSinglePageOptions.Prefix.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryPrefix,
-                _internal::UrlEncodeQueryParameter(
-                    listFilesAndDirectoriesSinglePageOptions.Prefix.Value()));
-          }
-          if (listFilesAndDirectoriesSinglePageOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(
-                    listFilesAndDirectoriesSinglePageOptions.ShareSnapshot.Value()));
-          }
-          if (listFilesAndDirectoriesSinglePageOptions.ContinuationToken.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryContinuationToken,
-                _internal::UrlEncodeQueryParameter(
-                    listFilesAndDirectoriesSinglePageOptions.ContinuationToken.Value()));
-          }
-          if (listFilesAndDirectoriesSinglePageOptions.MaxResults.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryPageSizeHint,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(listFilesAndDirectoriesSinglePageOptions.MaxResults.Value())));
-          }
-          if (listFilesAndDirectoriesSinglePageOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(listFilesAndDirectoriesSinglePageOptions.Timeout.Value())));
-          }
-          request.SetHeader(
-              _detail::HeaderVersion, listFilesAndDirectoriesSinglePageOptions.ApiVersionParameter);
-          return ListFilesAndDirectoriesSinglePageParseResult(
-              context, pipeline.Send(request, context));
-        }
+                listFilesAndDirectoriesSinglePageOptions);
 
         struct ListHandlesOptions final
         {
@@ -5423,45 +2823,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const ListHandlesOptions& listHandlesOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "listhandles");
-          if (listHandlesOptions.ContinuationToken.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryContinuationToken,
-                _internal::UrlEncodeQueryParameter(listHandlesOptions.ContinuationToken.Value()));
-          }
-          if (listHandlesOptions.MaxResults.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryPageSizeHint,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(listHandlesOptions.MaxResults.Value())));
-          }
-          if (listHandlesOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(listHandlesOptions.Timeout.Value())));
-          }
-          if (listHandlesOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(listHandlesOptions.ShareSnapshot.Value()));
-          }
-          if (listHandlesOptions.Recursive.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderRecursive,
-                (listHandlesOptions.Recursive.Value() ? "true" : "false"));
-          }
-          request.SetHeader(_detail::HeaderVersion, listHandlesOptions.ApiVersionParameter);
-          return ListHandlesParseResult(context, pipeline.Send(request, context));
-        }
+            const ListHandlesOptions& listHandlesOptions);
 
         struct ForceCloseHandlesOptions final
         {
@@ -5477,847 +2839,62 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const ForceCloseHandlesOptions& forceCloseHandlesOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "forceclosehandles");
-          if (forceCloseHandlesOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(forceCloseHandlesOptions.Timeout.Value())));
-          }
-          if (forceCloseHandlesOptions.ContinuationToken.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryContinuationToken,
-                _internal::UrlEncodeQueryParameter(
-                    forceCloseHandlesOptions.ContinuationToken.Value()));
-          }
-          if (forceCloseHandlesOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(forceCloseHandlesOptions.ShareSnapshot.Value()));
-          }
-          request.SetHeader(_detail::HeaderHandleId, forceCloseHandlesOptions.HandleId);
-          if (forceCloseHandlesOptions.Recursive.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderRecursive,
-                (forceCloseHandlesOptions.Recursive.Value() ? "true" : "false"));
-          }
-          request.SetHeader(_detail::HeaderVersion, forceCloseHandlesOptions.ApiVersionParameter);
-          return ForceCloseHandlesParseResult(context, pipeline.Send(request, context));
-        }
+            const ForceCloseHandlesOptions& forceCloseHandlesOptions);
 
       private:
         static Azure::Response<Models::CreateDirectoryResult> CreateParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Created)
-          {
-            // Success, Directory created.
-            Models::CreateDirectoryResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.IsServerEncrypted
-                = response.GetHeaders().at(_detail::HeaderRequestIsServerEncrypted) == "true";
-            result.SmbProperties.PermissionKey
-                = response.GetHeaders().at(_detail::HeaderFilePermissionKey);
-            result.SmbProperties.Attributes
-                = FileAttributes(response.GetHeaders().at(_detail::HeaderAttributes));
-            result.SmbProperties.CreatedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderCreatedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.LastWrittenOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastWrittenOn),
-                DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.ChangedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderChangedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.FileId = response.GetHeaders().at(_detail::HeaderFileId);
-            result.SmbProperties.ParentFileId
-                = response.GetHeaders().at(_detail::HeaderParentFileId);
-            return Azure::Response<Models::CreateDirectoryResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::DirectoryProperties> GetPropertiesParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success.
-            Models::DirectoryProperties result;
-
-            for (auto i = response.GetHeaders().lower_bound(_detail::HeaderMetadata);
-                 i != response.GetHeaders().end()
-                 && i->first.substr(0, 9) == _detail::HeaderMetadata;
-                 ++i)
-            {
-              result.Metadata.emplace(i->first.substr(10), i->second);
-            }
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.IsServerEncrypted
-                = response.GetHeaders().at(_detail::HeaderIsServerEncrypted) == "true";
-            result.SmbProperties.Attributes
-                = FileAttributes(response.GetHeaders().at(_detail::HeaderAttributes));
-            result.SmbProperties.CreatedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderCreatedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.LastWrittenOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastWrittenOn),
-                DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.ChangedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderChangedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.PermissionKey
-                = response.GetHeaders().at(_detail::HeaderFilePermissionKey);
-            result.SmbProperties.FileId = response.GetHeaders().at(_detail::HeaderFileId);
-            result.SmbProperties.ParentFileId
-                = response.GetHeaders().at(_detail::HeaderParentFileId);
-            return Azure::Response<Models::DirectoryProperties>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::DeleteDirectoryResult> DeleteParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Accepted)
-          {
-            // Success (Accepted).
-            Models::DeleteDirectoryResult result;
-            return Azure::Response<Models::DeleteDirectoryResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::SetDirectoryPropertiesResult> SetPropertiesParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success
-            Models::SetDirectoryPropertiesResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.IsServerEncrypted
-                = response.GetHeaders().at(_detail::HeaderRequestIsServerEncrypted) == "true";
-            result.SmbProperties.PermissionKey
-                = response.GetHeaders().at(_detail::HeaderFilePermissionKey);
-            result.SmbProperties.Attributes
-                = FileAttributes(response.GetHeaders().at(_detail::HeaderAttributes));
-            result.SmbProperties.CreatedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderCreatedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.LastWrittenOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastWrittenOn),
-                DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.ChangedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderChangedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.FileId = response.GetHeaders().at(_detail::HeaderFileId);
-            result.SmbProperties.ParentFileId
-                = response.GetHeaders().at(_detail::HeaderParentFileId);
-            return Azure::Response<Models::SetDirectoryPropertiesResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::SetDirectoryMetadataResult> SetMetadataParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success (OK).
-            Models::SetDirectoryMetadataResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.IsServerEncrypted
-                = response.GetHeaders().at(_detail::HeaderRequestIsServerEncrypted) == "true";
-            return Azure::Response<Models::SetDirectoryMetadataResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<DirectoryListFilesAndDirectoriesSinglePageResult>
         ListFilesAndDirectoriesSinglePageParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success.
-            const auto& bodyBuffer = response.GetBody();
-            auto reader = _internal::XmlReader(
-                reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
-            DirectoryListFilesAndDirectoriesSinglePageResult result = bodyBuffer.empty()
-                ? DirectoryListFilesAndDirectoriesSinglePageResult()
-                : DirectoryListFilesAndDirectoriesSinglePageResultFromListFilesAndDirectoriesSinglePageResponse(
-                    ListFilesAndDirectoriesSinglePageResponseFromXml(reader));
-            result.HttpHeaders.ContentType = response.GetHeaders().at(_detail::HeaderContentType);
-            return Azure::Response<DirectoryListFilesAndDirectoriesSinglePageResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
-        static DirectoryItem DirectoryItemFromXml(_internal::XmlReader& reader)
-        {
-          auto result = DirectoryItem();
-          enum class XmlTagName
-          {
-            Name,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
+        static DirectoryItem DirectoryItemFromXml(_internal::XmlReader& reader);
 
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Name") == 0)
-              {
-                path.emplace_back(XmlTagName::Name);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::Name)
-              {
-                result.Name = node.Value;
-              }
-            }
-          }
-          return result;
-        }
+        static FileItemDetails FileItemDetailsFromXml(_internal::XmlReader& reader);
 
-        static FileItemDetails FileItemDetailsFromXml(_internal::XmlReader& reader)
-        {
-          auto result = FileItemDetails();
-          enum class XmlTagName
-          {
-            ContentLength,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Content-Length") == 0)
-              {
-                path.emplace_back(XmlTagName::ContentLength);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::ContentLength)
-              {
-                result.FileSize = std::stoll(node.Value);
-              }
-            }
-          }
-          return result;
-        }
-
-        static FileItem FileItemFromXml(_internal::XmlReader& reader)
-        {
-          auto result = FileItem();
-          enum class XmlTagName
-          {
-            Name,
-            Properties,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Name") == 0)
-              {
-                path.emplace_back(XmlTagName::Name);
-              }
-              else if (std::strcmp(node.Name.data(), "Properties") == 0)
-              {
-                path.emplace_back(XmlTagName::Properties);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-
-              if (path.size() == 1 && path[0] == XmlTagName::Properties)
-              {
-                result.Details = FileItemDetailsFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::Name)
-              {
-                result.Name = node.Value;
-              }
-            }
-          }
-          return result;
-        }
+        static FileItem FileItemFromXml(_internal::XmlReader& reader);
 
         static FilesAndDirectoriesListSinglePage FilesAndDirectoriesListSinglePageFromXml(
-            _internal::XmlReader& reader)
-        {
-          auto result = FilesAndDirectoriesListSinglePage();
-          enum class XmlTagName
-          {
-            Directory,
-            File,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Directory") == 0)
-              {
-                path.emplace_back(XmlTagName::Directory);
-              }
-              else if (std::strcmp(node.Name.data(), "File") == 0)
-              {
-                path.emplace_back(XmlTagName::File);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-              if (path.size() == 1 && path[0] == XmlTagName::Directory)
-              {
-                result.DirectoryItems.emplace_back(DirectoryItemFromXml(reader));
-                path.pop_back();
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::File)
-              {
-                result.FileItems.emplace_back(FileItemFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-            }
-          }
-          return result;
-        }
+            _internal::XmlReader& reader);
 
         static ListFilesAndDirectoriesSinglePageResponse
-        ListFilesAndDirectoriesSinglePageResponseFromXml(_internal::XmlReader& reader)
-        {
-          auto result = ListFilesAndDirectoriesSinglePageResponse();
-          enum class XmlTagName
-          {
-            Entries,
-            EnumerationResults,
-            MaxResults,
-            NextMarker,
-            Prefix,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Entries") == 0)
-              {
-                path.emplace_back(XmlTagName::Entries);
-              }
-              else if (std::strcmp(node.Name.data(), "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::EnumerationResults);
-              }
-              else if (std::strcmp(node.Name.data(), "MaxResults") == 0)
-              {
-                path.emplace_back(XmlTagName::MaxResults);
-              }
-              else if (std::strcmp(node.Name.data(), "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::NextMarker);
-              }
-              else if (std::strcmp(node.Name.data(), "Prefix") == 0)
-              {
-                path.emplace_back(XmlTagName::Prefix);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-
-              if (path.size() == 2 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::Entries)
-              {
-                result.SinglePage = FilesAndDirectoriesListSinglePageFromXml(reader);
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 2 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::NextMarker)
-              {
-                result.ContinuationToken = node.Value;
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::MaxResults)
-              {
-                result.PageSizeHint = std::stoi(node.Value);
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::Prefix)
-              {
-                result.Prefix = node.Value;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Attribute)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::EnumerationResults
-                  && (std::strcmp(node.Name.data(), "DirectoryPath") == 0))
-              {
-                result.DirectoryPath = node.Value;
-              }
-              else if (
-                  path.size() == 1 && path[0] == XmlTagName::EnumerationResults
-                  && (std::strcmp(node.Name.data(), "ServiceEndpoint") == 0))
-              {
-                result.ServiceEndpoint = node.Value;
-              }
-              else if (
-                  path.size() == 1 && path[0] == XmlTagName::EnumerationResults
-                  && (std::strcmp(node.Name.data(), "ShareName") == 0))
-              {
-                result.ShareName = node.Value;
-              }
-              else if (
-                  path.size() == 1 && path[0] == XmlTagName::EnumerationResults
-                  && (std::strcmp(node.Name.data(), "ShareSnapshot") == 0))
-              {
-                result.ShareSnapshot = node.Value;
-              }
-            }
-          }
-          return result;
-        }
+        ListFilesAndDirectoriesSinglePageResponseFromXml(_internal::XmlReader& reader);
 
         static DirectoryListFilesAndDirectoriesSinglePageResult
         DirectoryListFilesAndDirectoriesSinglePageResultFromListFilesAndDirectoriesSinglePageResponse(
-            ListFilesAndDirectoriesSinglePageResponse object)
-        {
-          DirectoryListFilesAndDirectoriesSinglePageResult result;
-          result.ServiceEndpoint = std::move(object.ServiceEndpoint);
-          result.ShareName = std::move(object.ShareName);
-          result.ShareSnapshot = std::move(object.ShareSnapshot);
-          result.DirectoryPath = std::move(object.DirectoryPath);
-          result.Prefix = std::move(object.Prefix);
-          result.PageSizeHint = object.PageSizeHint;
-          result.SinglePage = std::move(object.SinglePage);
-          result.ContinuationToken = std::move(object.ContinuationToken);
-
-          return result;
-        }
+            ListFilesAndDirectoriesSinglePageResponse object);
         static Azure::Response<DirectoryListHandlesResult> ListHandlesParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success.
-            const auto& bodyBuffer = response.GetBody();
-            auto reader = _internal::XmlReader(
-                reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
-            DirectoryListHandlesResult result = bodyBuffer.empty()
-                ? DirectoryListHandlesResult()
-                : DirectoryListHandlesResultFromListHandlesResponse(
-                    ListHandlesResponseFromXml(reader));
-            result.HttpHeaders.ContentType = response.GetHeaders().at(_detail::HeaderContentType);
-            return Azure::Response<DirectoryListHandlesResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
-        static HandleItem HandleItemFromXml(_internal::XmlReader& reader)
-        {
-          auto result = HandleItem();
-          enum class XmlTagName
-          {
-            ClientIp,
-            FileId,
-            HandleId,
-            LastReconnectTime,
-            OpenTime,
-            ParentId,
-            Path,
-            SessionId,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "ClientIp") == 0)
-              {
-                path.emplace_back(XmlTagName::ClientIp);
-              }
-              else if (std::strcmp(node.Name.data(), "FileId") == 0)
-              {
-                path.emplace_back(XmlTagName::FileId);
-              }
-              else if (std::strcmp(node.Name.data(), "HandleId") == 0)
-              {
-                path.emplace_back(XmlTagName::HandleId);
-              }
-              else if (std::strcmp(node.Name.data(), "LastReconnectTime") == 0)
-              {
-                path.emplace_back(XmlTagName::LastReconnectTime);
-              }
-              else if (std::strcmp(node.Name.data(), "OpenTime") == 0)
-              {
-                path.emplace_back(XmlTagName::OpenTime);
-              }
-              else if (std::strcmp(node.Name.data(), "ParentId") == 0)
-              {
-                path.emplace_back(XmlTagName::ParentId);
-              }
-              else if (std::strcmp(node.Name.data(), "Path") == 0)
-              {
-                path.emplace_back(XmlTagName::Path);
-              }
-              else if (std::strcmp(node.Name.data(), "SessionId") == 0)
-              {
-                path.emplace_back(XmlTagName::SessionId);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::ClientIp)
-              {
-                result.ClientIp = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::FileId)
-              {
-                result.FileId = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::HandleId)
-              {
-                result.HandleId = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::LastReconnectTime)
-              {
-                result.LastReconnectedOn
-                    = DateTime::Parse(node.Value, DateTime::DateFormat::Rfc1123);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::OpenTime)
-              {
-                result.OpenedOn = DateTime::Parse(node.Value, DateTime::DateFormat::Rfc1123);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::ParentId)
-              {
-                result.ParentId = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Path)
-              {
-                result.Path = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::SessionId)
-              {
-                result.SessionId = node.Value;
-              }
-            }
-          }
-          return result;
-        }
+        static HandleItem HandleItemFromXml(_internal::XmlReader& reader);
 
-        static ListHandlesResponse ListHandlesResponseFromXml(_internal::XmlReader& reader)
-        {
-          auto result = ListHandlesResponse();
-          enum class XmlTagName
-          {
-            Entries,
-            EnumerationResults,
-            Handle,
-            NextMarker,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Entries") == 0)
-              {
-                path.emplace_back(XmlTagName::Entries);
-              }
-              else if (std::strcmp(node.Name.data(), "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::EnumerationResults);
-              }
-              else if (std::strcmp(node.Name.data(), "Handle") == 0)
-              {
-                path.emplace_back(XmlTagName::Handle);
-              }
-              else if (std::strcmp(node.Name.data(), "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::NextMarker);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-              if (path.size() == 3 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::Entries && path[2] == XmlTagName::Handle)
-              {
-                result.HandleList.emplace_back(HandleItemFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 2 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::NextMarker)
-              {
-                result.ContinuationToken = node.Value;
-              }
-            }
-          }
-          return result;
-        }
+        static ListHandlesResponse ListHandlesResponseFromXml(_internal::XmlReader& reader);
 
         static DirectoryListHandlesResult DirectoryListHandlesResultFromListHandlesResponse(
-            ListHandlesResponse object)
-        {
-          DirectoryListHandlesResult result;
-          result.HandleList = std::move(object.HandleList);
-          result.ContinuationToken = std::move(object.ContinuationToken);
-
-          return result;
-        }
+            ListHandlesResponse object);
         static Azure::Response<DirectoryForceCloseHandlesResult> ForceCloseHandlesParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success.
-            DirectoryForceCloseHandlesResult result;
-            if (response.GetHeaders().find(_detail::HeaderContinuationToken)
-                != response.GetHeaders().end())
-            {
-              result.ContinuationToken = response.GetHeaders().at(_detail::HeaderContinuationToken);
-            }
-            result.NumberOfHandlesClosed
-                = std::stoi(response.GetHeaders().at(_detail::HeaderNumberOfHandlesClosed));
-            result.NumberOfHandlesFailedToClose
-                = std::stoi(response.GetHeaders().at(_detail::HeaderNumberOfHandlesFailedToClose));
-            return Azure::Response<DirectoryForceCloseHandlesResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
       };
 
       class File final {
@@ -6346,74 +2923,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const CreateOptions& createOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          if (createOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(std::to_string(createOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, createOptions.ApiVersionParameter);
-          request.SetHeader(
-              _detail::HeaderXMsContentLength, std::to_string(createOptions.XMsContentLength));
-          request.SetHeader(_detail::HeaderFileTypeConstant, "file");
-          if (createOptions.FileContentType.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileContentType, createOptions.FileContentType.Value());
-          }
-          if (createOptions.FileContentEncoding.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileContentEncoding, createOptions.FileContentEncoding.Value());
-          }
-          if (createOptions.FileContentLanguage.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileContentLanguage, createOptions.FileContentLanguage.Value());
-          }
-          if (createOptions.FileCacheControl.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileCacheControl, createOptions.FileCacheControl.Value());
-          }
-          if (createOptions.ContentMd5.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderContentHashMd5,
-                _internal::ToBase64String(createOptions.ContentMd5.Value()));
-          }
-          if (createOptions.FileContentDisposition.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileContentDisposition,
-                createOptions.FileContentDisposition.Value());
-          }
-          for (const auto& pair : createOptions.Metadata)
-          {
-            request.SetHeader(_detail::HeaderMetadata + ("-" + pair.first), pair.second);
-          }
-          if (createOptions.FilePermission.HasValue())
-          {
-            request.SetHeader(_detail::HeaderFilePermission, createOptions.FilePermission.Value());
-          }
-          if (createOptions.FilePermissionKey.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFilePermissionKey, createOptions.FilePermissionKey.Value());
-          }
-          request.SetHeader(_detail::HeaderFileAttributes, createOptions.FileAttributes);
-          request.SetHeader(_detail::HeaderFileCreatedOn, createOptions.FileCreationTime);
-          request.SetHeader(_detail::HeaderFileLastWrittenOn, createOptions.FileLastWriteTime);
-          if (createOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, createOptions.LeaseIdOptional.Value());
-          }
-          return CreateParseResult(context, pipeline.Send(request, context));
-        }
+            const CreateOptions& createOptions);
 
         struct DownloadOptions final
         {
@@ -6428,33 +2938,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const DownloadOptions& downloadOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url, false);
-          if (downloadOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(downloadOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, downloadOptions.ApiVersionParameter);
-          if (downloadOptions.Range.HasValue())
-          {
-            request.SetHeader(_detail::HeaderRange, downloadOptions.Range.Value());
-          }
-          if (downloadOptions.GetRangeContentMd5.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderRangeGetContentMd5,
-                (downloadOptions.GetRangeContentMd5.Value() ? "true" : "false"));
-          }
-          if (downloadOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, downloadOptions.LeaseIdOptional.Value());
-          }
-          return DownloadParseResult(context, pipeline.Send(request, context));
-        }
+            const DownloadOptions& downloadOptions);
 
         struct GetPropertiesOptions final
         {
@@ -6468,29 +2952,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const GetPropertiesOptions& getPropertiesOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Head, url);
-          if (getPropertiesOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(getPropertiesOptions.ShareSnapshot.Value()));
-          }
-          if (getPropertiesOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(getPropertiesOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, getPropertiesOptions.ApiVersionParameter);
-          if (getPropertiesOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, getPropertiesOptions.LeaseIdOptional.Value());
-          }
-          return GetPropertiesParseResult(context, pipeline.Send(request, context));
-        }
+            const GetPropertiesOptions& getPropertiesOptions);
 
         struct DeleteOptions final
         {
@@ -6503,22 +2965,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const DeleteOptions& deleteOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Delete, url);
-          if (deleteOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(std::to_string(deleteOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, deleteOptions.ApiVersionParameter);
-          if (deleteOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, deleteOptions.LeaseIdOptional.Value());
-          }
-          return DeleteParseResult(context, pipeline.Send(request, context));
-        }
+            const DeleteOptions& deleteOptions);
 
         struct SetHttpHeadersOptions final
         {
@@ -6543,80 +2990,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const SetHttpHeadersOptions& setHttpHeadersOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "properties");
-          if (setHttpHeadersOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(setHttpHeadersOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, setHttpHeadersOptions.ApiVersionParameter);
-          if (setHttpHeadersOptions.XMsContentLength.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderXMsContentLength,
-                std::to_string(setHttpHeadersOptions.XMsContentLength.Value()));
-          }
-          if (setHttpHeadersOptions.FileContentType.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileContentType, setHttpHeadersOptions.FileContentType.Value());
-          }
-          if (setHttpHeadersOptions.FileContentEncoding.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileContentEncoding,
-                setHttpHeadersOptions.FileContentEncoding.Value());
-          }
-          if (setHttpHeadersOptions.FileContentLanguage.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileContentLanguage,
-                setHttpHeadersOptions.FileContentLanguage.Value());
-          }
-          if (setHttpHeadersOptions.FileCacheControl.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileCacheControl, setHttpHeadersOptions.FileCacheControl.Value());
-          }
-          if (setHttpHeadersOptions.ContentMd5.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderContentHashMd5,
-                _internal::ToBase64String(setHttpHeadersOptions.ContentMd5.Value()));
-          }
-          if (setHttpHeadersOptions.FileContentDisposition.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileContentDisposition,
-                setHttpHeadersOptions.FileContentDisposition.Value());
-          }
-          if (setHttpHeadersOptions.FilePermission.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFilePermission, setHttpHeadersOptions.FilePermission.Value());
-          }
-          if (setHttpHeadersOptions.FilePermissionKey.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFilePermissionKey, setHttpHeadersOptions.FilePermissionKey.Value());
-          }
-          request.SetHeader(_detail::HeaderFileAttributes, setHttpHeadersOptions.FileAttributes);
-          request.SetHeader(_detail::HeaderFileCreatedOn, setHttpHeadersOptions.FileCreationTime);
-          request.SetHeader(
-              _detail::HeaderFileLastWrittenOn, setHttpHeadersOptions.FileLastWriteTime);
-          if (setHttpHeadersOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderLeaseId, setHttpHeadersOptions.LeaseIdOptional.Value());
-          }
-          return SetHttpHeadersParseResult(context, pipeline.Send(request, context));
-        }
+            const SetHttpHeadersOptions& setHttpHeadersOptions);
 
         struct SetMetadataOptions final
         {
@@ -6630,29 +3004,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const SetMetadataOptions& setMetadataOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "metadata");
-          if (setMetadataOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(setMetadataOptions.Timeout.Value())));
-          }
-          for (const auto& pair : setMetadataOptions.Metadata)
-          {
-            request.SetHeader(_detail::HeaderMetadata + ("-" + pair.first), pair.second);
-          }
-          request.SetHeader(_detail::HeaderVersion, setMetadataOptions.ApiVersionParameter);
-          if (setMetadataOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, setMetadataOptions.LeaseIdOptional.Value());
-          }
-          return SetMetadataParseResult(context, pipeline.Send(request, context));
-        }
+            const SetMetadataOptions& setMetadataOptions);
 
         struct AcquireLeaseOptions final
         {
@@ -6666,30 +3018,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const AcquireLeaseOptions& acquireLeaseOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "lease");
-          request.SetHeader(_detail::HeaderAction, "acquire");
-          if (acquireLeaseOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(acquireLeaseOptions.Timeout.Value())));
-          }
-          request.SetHeader(
-              _detail::HeaderDuration, std::to_string(acquireLeaseOptions.LeaseDuration));
-          if (acquireLeaseOptions.ProposedLeaseIdOptional.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderProposedLeaseId,
-                acquireLeaseOptions.ProposedLeaseIdOptional.Value());
-          }
-          request.SetHeader(_detail::HeaderVersion, acquireLeaseOptions.ApiVersionParameter);
-          return AcquireLeaseParseResult(context, pipeline.Send(request, context));
-        }
+            const AcquireLeaseOptions& acquireLeaseOptions);
 
         struct ReleaseLeaseOptions final
         {
@@ -6702,23 +3031,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const ReleaseLeaseOptions& releaseLeaseOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "lease");
-          request.SetHeader(_detail::HeaderAction, "release");
-          if (releaseLeaseOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(releaseLeaseOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderLeaseId, releaseLeaseOptions.LeaseIdRequired);
-          request.SetHeader(_detail::HeaderVersion, releaseLeaseOptions.ApiVersionParameter);
-          return ReleaseLeaseParseResult(context, pipeline.Send(request, context));
-        }
+            const ReleaseLeaseOptions& releaseLeaseOptions);
 
         struct ChangeLeaseOptions final
         {
@@ -6732,28 +3045,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const ChangeLeaseOptions& changeLeaseOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "lease");
-          request.SetHeader(_detail::HeaderAction, "change");
-          if (changeLeaseOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(changeLeaseOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderLeaseId, changeLeaseOptions.LeaseIdRequired);
-          if (changeLeaseOptions.ProposedLeaseIdOptional.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderProposedLeaseId, changeLeaseOptions.ProposedLeaseIdOptional.Value());
-          }
-          request.SetHeader(_detail::HeaderVersion, changeLeaseOptions.ApiVersionParameter);
-          return ChangeLeaseParseResult(context, pipeline.Send(request, context));
-        }
+            const ChangeLeaseOptions& changeLeaseOptions);
 
         struct BreakLeaseOptions final
         {
@@ -6766,26 +3058,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const BreakLeaseOptions& breakLeaseOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "lease");
-          request.SetHeader(_detail::HeaderAction, "break");
-          if (breakLeaseOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(breakLeaseOptions.Timeout.Value())));
-          }
-          if (breakLeaseOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, breakLeaseOptions.LeaseIdOptional.Value());
-          }
-          request.SetHeader(_detail::HeaderVersion, breakLeaseOptions.ApiVersionParameter);
-          return BreakLeaseParseResult(context, pipeline.Send(request, context));
-        }
+            const BreakLeaseOptions& breakLeaseOptions);
 
         struct UploadRangeOptions final
         {
@@ -6803,34 +3076,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             Azure::Core::IO::BodyStream& bodyStream,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const UploadRangeOptions& uploadRangeOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url, &bodyStream);
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "range");
-          if (uploadRangeOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(uploadRangeOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderXMsRange, uploadRangeOptions.XMsRange);
-          request.SetHeader(_detail::HeaderFileRangeWrite, uploadRangeOptions.XMsWrite.ToString());
-          request.SetHeader(
-              _detail::HeaderContentLength, std::to_string(uploadRangeOptions.ContentLength));
-          if (uploadRangeOptions.ContentMd5.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderContentHashMd5,
-                _internal::ToBase64String(uploadRangeOptions.ContentMd5.Value()));
-          }
-          request.SetHeader(_detail::HeaderVersion, uploadRangeOptions.ApiVersionParameter);
-          if (uploadRangeOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, uploadRangeOptions.LeaseIdOptional.Value());
-          }
-          return UploadRangeParseResult(context, pipeline.Send(request, context));
-        }
+            const UploadRangeOptions& uploadRangeOptions);
 
         struct UploadRangeFromUrlOptions final
         {
@@ -6851,57 +3097,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const UploadRangeFromUrlOptions& uploadRangeFromUrlOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "range");
-          if (uploadRangeFromUrlOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(uploadRangeFromUrlOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderRange, uploadRangeFromUrlOptions.TargetRange);
-          request.SetHeader(_detail::HeaderCopySource, uploadRangeFromUrlOptions.CopySource);
-          if (uploadRangeFromUrlOptions.SourceRange.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderSourceRange, uploadRangeFromUrlOptions.SourceRange.Value());
-          }
-          request.SetHeader(
-              _detail::HeaderFileRangeWriteFromUrl, uploadRangeFromUrlOptions.XMsWrite.ToString());
-          request.SetHeader(
-              _detail::HeaderContentLength,
-              std::to_string(uploadRangeFromUrlOptions.ContentLength));
-          if (uploadRangeFromUrlOptions.SourceContentCrc64.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderSourceContentHashCrc64,
-                _internal::ToBase64String(uploadRangeFromUrlOptions.SourceContentCrc64.Value()));
-          }
-          if (uploadRangeFromUrlOptions.SourceIfMatchCrc64.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderSourceIfMatchHashCrc64,
-                _internal::ToBase64String(uploadRangeFromUrlOptions.SourceIfMatchCrc64.Value()));
-          }
-          if (uploadRangeFromUrlOptions.SourceIfNoneMatchCrc64.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderSourceIfNoneMatchHashCrc64,
-                _internal::ToBase64String(
-                    uploadRangeFromUrlOptions.SourceIfNoneMatchCrc64.Value()));
-          }
-          request.SetHeader(_detail::HeaderVersion, uploadRangeFromUrlOptions.ApiVersionParameter);
-          if (uploadRangeFromUrlOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderLeaseId, uploadRangeFromUrlOptions.LeaseIdOptional.Value());
-          }
-          return UploadRangeFromUrlParseResult(context, pipeline.Send(request, context));
-        }
+            const UploadRangeFromUrlOptions& uploadRangeFromUrlOptions);
 
         struct GetRangeListOptions final
         {
@@ -6917,40 +3113,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const GetRangeListOptions& getRangeListOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "rangelist");
-          if (getRangeListOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(getRangeListOptions.ShareSnapshot.Value()));
-          }
-          if (getRangeListOptions.PrevShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryPrevShareSnapshot,
-                _internal::UrlEncodeQueryParameter(getRangeListOptions.PrevShareSnapshot.Value()));
-          }
-          if (getRangeListOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(getRangeListOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, getRangeListOptions.ApiVersionParameter);
-          if (getRangeListOptions.XMsRange.HasValue())
-          {
-            request.SetHeader(_detail::HeaderXMsRange, getRangeListOptions.XMsRange.Value());
-          }
-          if (getRangeListOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, getRangeListOptions.LeaseIdOptional.Value());
-          }
-          return GetRangeListParseResult(context, pipeline.Send(request, context));
-        }
+            const GetRangeListOptions& getRangeListOptions);
 
         struct StartCopyOptions final
         {
@@ -6973,73 +3136,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const StartCopyOptions& startCopyOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          if (startCopyOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(startCopyOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderVersion, startCopyOptions.ApiVersionParameter);
-          for (const auto& pair : startCopyOptions.Metadata)
-          {
-            request.SetHeader(_detail::HeaderMetadata + ("-" + pair.first), pair.second);
-          }
-          request.SetHeader(_detail::HeaderCopySource, startCopyOptions.CopySource);
-          if (startCopyOptions.FilePermission.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFilePermission, startCopyOptions.FilePermission.Value());
-          }
-          if (startCopyOptions.FilePermissionKey.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFilePermissionKey, startCopyOptions.FilePermissionKey.Value());
-          }
-          if (startCopyOptions.XMsFilePermissionCopyMode.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFilePermissionCopyMode,
-                startCopyOptions.XMsFilePermissionCopyMode.Value().ToString());
-          }
-          if (startCopyOptions.FileCopyIgnoreReadOnly.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderIgnoreReadOnly,
-                (startCopyOptions.FileCopyIgnoreReadOnly.Value() ? "true" : "false"));
-          }
-          if (startCopyOptions.FileCopyFileAttributes.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileAttributes, startCopyOptions.FileCopyFileAttributes.Value());
-          }
-          if (startCopyOptions.FileCopyFileCreationTime.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileCreatedOn, startCopyOptions.FileCopyFileCreationTime.Value());
-          }
-          if (startCopyOptions.FileCopyFileLastWriteTime.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderFileLastWrittenOn,
-                startCopyOptions.FileCopyFileLastWriteTime.Value());
-          }
-          if (startCopyOptions.FileCopySetArchiveAttribute.HasValue())
-          {
-            request.SetHeader(
-                _detail::HeaderSetArchiveAttribute,
-                (startCopyOptions.FileCopySetArchiveAttribute.Value() ? "true" : "false"));
-          }
-          if (startCopyOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, startCopyOptions.LeaseIdOptional.Value());
-          }
-          return StartCopyParseResult(context, pipeline.Send(request, context));
-        }
+            const StartCopyOptions& startCopyOptions);
 
         struct AbortCopyOptions final
         {
@@ -7053,28 +3150,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const AbortCopyOptions& abortCopyOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "copy");
-          request.GetUrl().AppendQueryParameter(
-              _detail::QueryCopyId, _internal::UrlEncodeQueryParameter(abortCopyOptions.CopyId));
-          if (abortCopyOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(abortCopyOptions.Timeout.Value())));
-          }
-          request.SetHeader(_detail::HeaderCopyActionAbortConstant, "abort");
-          request.SetHeader(_detail::HeaderVersion, abortCopyOptions.ApiVersionParameter);
-          if (abortCopyOptions.LeaseIdOptional.HasValue())
-          {
-            request.SetHeader(_detail::HeaderLeaseId, abortCopyOptions.LeaseIdOptional.Value());
-          }
-          return AbortCopyParseResult(context, pipeline.Send(request, context));
-        }
+            const AbortCopyOptions& abortCopyOptions);
 
         struct ListHandlesOptions final
         {
@@ -7089,39 +3165,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const ListHandlesOptions& listHandlesOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "listhandles");
-          if (listHandlesOptions.ContinuationToken.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryContinuationToken,
-                _internal::UrlEncodeQueryParameter(listHandlesOptions.ContinuationToken.Value()));
-          }
-          if (listHandlesOptions.MaxResults.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryPageSizeHint,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(listHandlesOptions.MaxResults.Value())));
-          }
-          if (listHandlesOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(listHandlesOptions.Timeout.Value())));
-          }
-          if (listHandlesOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(listHandlesOptions.ShareSnapshot.Value()));
-          }
-          request.SetHeader(_detail::HeaderVersion, listHandlesOptions.ApiVersionParameter);
-          return ListHandlesParseResult(context, pipeline.Send(request, context));
-        }
+            const ListHandlesOptions& listHandlesOptions);
 
         struct ForceCloseHandlesOptions final
         {
@@ -7136,1185 +3180,85 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             const Azure::Core::Url& url,
             Azure::Core::Http::_internal::HttpPipeline& pipeline,
             Azure::Core::Context context,
-            const ForceCloseHandlesOptions& forceCloseHandlesOptions)
-        {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Put, url);
-          request.SetHeader(_detail::HeaderContentLength, "0");
-          request.GetUrl().AppendQueryParameter(_detail::QueryComp, "forceclosehandles");
-          if (forceCloseHandlesOptions.Timeout.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryTimeout,
-                _internal::UrlEncodeQueryParameter(
-                    std::to_string(forceCloseHandlesOptions.Timeout.Value())));
-          }
-          if (forceCloseHandlesOptions.ContinuationToken.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryContinuationToken,
-                _internal::UrlEncodeQueryParameter(
-                    forceCloseHandlesOptions.ContinuationToken.Value()));
-          }
-          if (forceCloseHandlesOptions.ShareSnapshot.HasValue())
-          {
-            request.GetUrl().AppendQueryParameter(
-                _detail::QueryShareSnapshot,
-                _internal::UrlEncodeQueryParameter(forceCloseHandlesOptions.ShareSnapshot.Value()));
-          }
-          request.SetHeader(_detail::HeaderHandleId, forceCloseHandlesOptions.HandleId);
-          request.SetHeader(_detail::HeaderVersion, forceCloseHandlesOptions.ApiVersionParameter);
-          return ForceCloseHandlesParseResult(context, pipeline.Send(request, context));
-        }
+            const ForceCloseHandlesOptions& forceCloseHandlesOptions);
 
       private:
         static Azure::Response<Models::CreateFileResult> CreateParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Created)
-          {
-            // Success, File created.
-            Models::CreateFileResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.IsServerEncrypted
-                = response.GetHeaders().at(_detail::HeaderRequestIsServerEncrypted) == "true";
-            result.SmbProperties.PermissionKey
-                = response.GetHeaders().at(_detail::HeaderFilePermissionKey);
-            result.SmbProperties.Attributes
-                = FileAttributes(response.GetHeaders().at(_detail::HeaderAttributes));
-            result.SmbProperties.CreatedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderCreatedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.LastWrittenOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastWrittenOn),
-                DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.ChangedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderChangedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.FileId = response.GetHeaders().at(_detail::HeaderFileId);
-            result.SmbProperties.ParentFileId
-                = response.GetHeaders().at(_detail::HeaderParentFileId);
-            return Azure::Response<Models::CreateFileResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<FileDownloadResult> DownloadParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Succeeded to read the entire file.
-            FileDownloadResult result;
-            result.BodyStream = response.ExtractBodyStream();
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-
-            for (auto i = response.GetHeaders().lower_bound(_detail::HeaderMetadata);
-                 i != response.GetHeaders().end()
-                 && i->first.substr(0, 9) == _detail::HeaderMetadata;
-                 ++i)
-            {
-              result.Metadata.emplace(i->first.substr(10), i->second);
-            }
-            result.HttpHeaders.ContentType = response.GetHeaders().at(_detail::HeaderContentType);
-
-            auto content_range_iterator = response.GetHeaders().find(_detail::HeaderContentRange);
-            if (content_range_iterator != response.GetHeaders().end())
-            {
-              const std::string& content_range = content_range_iterator->second;
-              auto bytes_pos = content_range.find("bytes ");
-              auto dash_pos = content_range.find("-", bytes_pos + 6);
-              auto slash_pos = content_range.find("/", dash_pos + 1);
-              int64_t range_start_offset = std::stoll(std::string(
-                  content_range.begin() + bytes_pos + 6, content_range.begin() + dash_pos));
-              int64_t range_end_offset = std::stoll(std::string(
-                  content_range.begin() + dash_pos + 1, content_range.begin() + slash_pos));
-              result.ContentRange = Azure::Core::Http::HttpRange{
-                  range_start_offset, range_end_offset - range_start_offset + 1};
-            }
-            else
-            {
-              result.ContentRange = Azure::Core::Http::HttpRange{
-                  0, std::stoll(response.GetHeaders().at(_detail::HeaderContentLength))};
-            }
-            if (content_range_iterator != response.GetHeaders().end())
-            {
-              const std::string& content_range = content_range_iterator->second;
-              auto slash_pos = content_range.find("/");
-              result.FileSize = std::stoll(content_range.substr(slash_pos + 1));
-            }
-            else
-            {
-              result.FileSize = std::stoll(response.GetHeaders().at(_detail::HeaderContentLength));
-            }
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            if (response.GetHeaders().find(_detail::HeaderTransactionalContentHashMd5)
-                != response.GetHeaders().end())
-            {
-              result.TransactionalContentHash = _internal::FromBase64String(
-                  response.GetHeaders().at(_detail::HeaderTransactionalContentHashMd5),
-                  HashAlgorithm::Md5);
-            }
-            if (response.GetHeaders().find(_detail::HeaderContentEncoding)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentEncoding
-                  = response.GetHeaders().at(_detail::HeaderContentEncoding);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCacheControl)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.CacheControl
-                  = response.GetHeaders().at(_detail::HeaderCacheControl);
-            }
-            if (response.GetHeaders().find(_detail::HeaderContentDisposition)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentDisposition
-                  = response.GetHeaders().at(_detail::HeaderContentDisposition);
-            }
-            if (response.GetHeaders().find(_detail::HeaderContentLanguage)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentLanguage
-                  = response.GetHeaders().at(_detail::HeaderContentLanguage);
-            }
-            result.AcceptRanges = response.GetHeaders().at(_detail::HeaderAcceptRanges);
-            if (response.GetHeaders().find(_detail::HeaderCopyCompletedOn)
-                != response.GetHeaders().end())
-            {
-              result.CopyCompletedOn = DateTime::Parse(
-                  response.GetHeaders().at(_detail::HeaderCopyCompletedOn),
-                  DateTime::DateFormat::Rfc1123);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyStatusDescription)
-                != response.GetHeaders().end())
-            {
-              result.CopyStatusDescription
-                  = response.GetHeaders().at(_detail::HeaderCopyStatusDescription);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyId) != response.GetHeaders().end())
-            {
-              result.CopyId = response.GetHeaders().at(_detail::HeaderCopyId);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyProgress)
-                != response.GetHeaders().end())
-            {
-              result.CopyProgress = response.GetHeaders().at(_detail::HeaderCopyProgress);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopySource)
-                != response.GetHeaders().end())
-            {
-              result.CopySource = response.GetHeaders().at(_detail::HeaderCopySource);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyStatus)
-                != response.GetHeaders().end())
-            {
-              result.CopyStatus = CopyStatus(response.GetHeaders().at(_detail::HeaderCopyStatus));
-            }
-            if (response.GetHeaders().find(_detail::HeaderContentHashMd5)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentHash = _internal::FromBase64String(
-                  response.GetHeaders().at(_detail::HeaderContentHashMd5), HashAlgorithm::Md5);
-            }
-            if (response.GetHeaders().find(_detail::HeaderIsServerEncrypted)
-                != response.GetHeaders().end())
-            {
-              result.IsServerEncrypted
-                  = response.GetHeaders().at(_detail::HeaderIsServerEncrypted) == "true";
-            }
-            result.SmbProperties.Attributes
-                = FileAttributes(response.GetHeaders().at(_detail::HeaderAttributes));
-            result.SmbProperties.CreatedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderCreatedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.LastWrittenOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastWrittenOn),
-                DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.ChangedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderChangedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.PermissionKey
-                = response.GetHeaders().at(_detail::HeaderFilePermissionKey);
-            result.SmbProperties.FileId = response.GetHeaders().at(_detail::HeaderFileId);
-            result.SmbProperties.ParentFileId
-                = response.GetHeaders().at(_detail::HeaderParentFileId);
-            if (response.GetHeaders().find(_detail::HeaderLeaseDuration)
-                != response.GetHeaders().end())
-            {
-              result.LeaseDuration
-                  = LeaseDuration(response.GetHeaders().at(_detail::HeaderLeaseDuration));
-            }
-            if (response.GetHeaders().find(_detail::HeaderLeaseState)
-                != response.GetHeaders().end())
-            {
-              result.LeaseState = LeaseState(response.GetHeaders().at(_detail::HeaderLeaseState));
-            }
-            if (response.GetHeaders().find(_detail::HeaderLeaseStatus)
-                != response.GetHeaders().end())
-            {
-              result.LeaseStatus
-                  = LeaseStatus(response.GetHeaders().at(_detail::HeaderLeaseStatus));
-            }
-            return Azure::Response<FileDownloadResult>(std::move(result), std::move(responsePtr));
-          }
-          else if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::PartialContent)
-          {
-            // Succeeded to read a specified range of the file.
-            FileDownloadResult result;
-            result.BodyStream = response.ExtractBodyStream();
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-
-            for (auto i = response.GetHeaders().lower_bound(_detail::HeaderMetadata);
-                 i != response.GetHeaders().end()
-                 && i->first.substr(0, 9) == _detail::HeaderMetadata;
-                 ++i)
-            {
-              result.Metadata.emplace(i->first.substr(10), i->second);
-            }
-            result.HttpHeaders.ContentType = response.GetHeaders().at(_detail::HeaderContentType);
-
-            auto content_range_iterator = response.GetHeaders().find(_detail::HeaderContentRange);
-            if (content_range_iterator != response.GetHeaders().end())
-            {
-              const std::string& content_range = content_range_iterator->second;
-              auto bytes_pos = content_range.find("bytes ");
-              auto dash_pos = content_range.find("-", bytes_pos + 6);
-              auto slash_pos = content_range.find("/", dash_pos + 1);
-              int64_t range_start_offset = std::stoll(std::string(
-                  content_range.begin() + bytes_pos + 6, content_range.begin() + dash_pos));
-              int64_t range_end_offset = std::stoll(std::string(
-                  content_range.begin() + dash_pos + 1, content_range.begin() + slash_pos));
-              result.ContentRange = Azure::Core::Http::HttpRange{
-                  range_start_offset, range_end_offset - range_start_offset + 1};
-            }
-            else
-            {
-              result.ContentRange = Azure::Core::Http::HttpRange{
-                  0, std::stoll(response.GetHeaders().at(_detail::HeaderContentLength))};
-            }
-            if (content_range_iterator != response.GetHeaders().end())
-            {
-              const std::string& content_range = content_range_iterator->second;
-              auto slash_pos = content_range.find("/");
-              result.FileSize = std::stoll(content_range.substr(slash_pos + 1));
-            }
-            else
-            {
-              result.FileSize = std::stoll(response.GetHeaders().at(_detail::HeaderContentLength));
-            }
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            if (response.GetHeaders().find(_detail::HeaderTransactionalContentHashMd5)
-                != response.GetHeaders().end())
-            {
-              result.TransactionalContentHash = _internal::FromBase64String(
-                  response.GetHeaders().at(_detail::HeaderTransactionalContentHashMd5),
-                  HashAlgorithm::Md5);
-            }
-            if (response.GetHeaders().find(_detail::HeaderContentEncoding)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentEncoding
-                  = response.GetHeaders().at(_detail::HeaderContentEncoding);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCacheControl)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.CacheControl
-                  = response.GetHeaders().at(_detail::HeaderCacheControl);
-            }
-            if (response.GetHeaders().find(_detail::HeaderContentDisposition)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentDisposition
-                  = response.GetHeaders().at(_detail::HeaderContentDisposition);
-            }
-            if (response.GetHeaders().find(_detail::HeaderContentLanguage)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentLanguage
-                  = response.GetHeaders().at(_detail::HeaderContentLanguage);
-            }
-            result.AcceptRanges = response.GetHeaders().at(_detail::HeaderAcceptRanges);
-            if (response.GetHeaders().find(_detail::HeaderCopyCompletedOn)
-                != response.GetHeaders().end())
-            {
-              result.CopyCompletedOn = DateTime::Parse(
-                  response.GetHeaders().at(_detail::HeaderCopyCompletedOn),
-                  DateTime::DateFormat::Rfc1123);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyStatusDescription)
-                != response.GetHeaders().end())
-            {
-              result.CopyStatusDescription
-                  = response.GetHeaders().at(_detail::HeaderCopyStatusDescription);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyId) != response.GetHeaders().end())
-            {
-              result.CopyId = response.GetHeaders().at(_detail::HeaderCopyId);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyProgress)
-                != response.GetHeaders().end())
-            {
-              result.CopyProgress = response.GetHeaders().at(_detail::HeaderCopyProgress);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopySource)
-                != response.GetHeaders().end())
-            {
-              result.CopySource = response.GetHeaders().at(_detail::HeaderCopySource);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyStatus)
-                != response.GetHeaders().end())
-            {
-              result.CopyStatus = CopyStatus(response.GetHeaders().at(_detail::HeaderCopyStatus));
-            }
-            if (response.GetHeaders().find(_detail::HeaderContentHashMd5)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentHash = _internal::FromBase64String(
-                  response.GetHeaders().at(_detail::HeaderContentHashMd5), HashAlgorithm::Md5);
-            }
-            if (response.GetHeaders().find(_detail::HeaderIsServerEncrypted)
-                != response.GetHeaders().end())
-            {
-              result.IsServerEncrypted
-                  = response.GetHeaders().at(_detail::HeaderIsServerEncrypted) == "true";
-            }
-            result.SmbProperties.Attributes
-                = FileAttributes(response.GetHeaders().at(_detail::HeaderAttributes));
-            result.SmbProperties.CreatedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderCreatedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.LastWrittenOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastWrittenOn),
-                DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.ChangedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderChangedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.PermissionKey
-                = response.GetHeaders().at(_detail::HeaderFilePermissionKey);
-            result.SmbProperties.FileId = response.GetHeaders().at(_detail::HeaderFileId);
-            result.SmbProperties.ParentFileId
-                = response.GetHeaders().at(_detail::HeaderParentFileId);
-            if (response.GetHeaders().find(_detail::HeaderLeaseDuration)
-                != response.GetHeaders().end())
-            {
-              result.LeaseDuration
-                  = LeaseDuration(response.GetHeaders().at(_detail::HeaderLeaseDuration));
-            }
-            if (response.GetHeaders().find(_detail::HeaderLeaseState)
-                != response.GetHeaders().end())
-            {
-              result.LeaseState = LeaseState(response.GetHeaders().at(_detail::HeaderLeaseState));
-            }
-            if (response.GetHeaders().find(_detail::HeaderLeaseStatus)
-                != response.GetHeaders().end())
-            {
-              result.LeaseStatus
-                  = LeaseStatus(response.GetHeaders().at(_detail::HeaderLeaseStatus));
-            }
-            return Azure::Response<FileDownloadResult>(std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::FileProperties> GetPropertiesParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success.
-            Models::FileProperties result;
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-
-            for (auto i = response.GetHeaders().lower_bound(_detail::HeaderMetadata);
-                 i != response.GetHeaders().end()
-                 && i->first.substr(0, 9) == _detail::HeaderMetadata;
-                 ++i)
-            {
-              result.Metadata.emplace(i->first.substr(10), i->second);
-            }
-            result.FileSize = std::stoll(response.GetHeaders().at(_detail::HeaderContentLength));
-            if (response.GetHeaders().find(_detail::HeaderContentType)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentType = response.GetHeaders().at(_detail::HeaderContentType);
-            }
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            if (response.GetHeaders().find(_detail::HeaderTransactionalContentHashMd5)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentHash = _internal::FromBase64String(
-                  response.GetHeaders().at(_detail::HeaderTransactionalContentHashMd5),
-                  HashAlgorithm::Md5);
-            }
-            if (response.GetHeaders().find(_detail::HeaderContentEncoding)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentEncoding
-                  = response.GetHeaders().at(_detail::HeaderContentEncoding);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCacheControl)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.CacheControl
-                  = response.GetHeaders().at(_detail::HeaderCacheControl);
-            }
-            if (response.GetHeaders().find(_detail::HeaderContentDisposition)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentDisposition
-                  = response.GetHeaders().at(_detail::HeaderContentDisposition);
-            }
-            if (response.GetHeaders().find(_detail::HeaderContentLanguage)
-                != response.GetHeaders().end())
-            {
-              result.HttpHeaders.ContentLanguage
-                  = response.GetHeaders().at(_detail::HeaderContentLanguage);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyCompletedOn)
-                != response.GetHeaders().end())
-            {
-              result.CopyCompletedOn = DateTime::Parse(
-                  response.GetHeaders().at(_detail::HeaderCopyCompletedOn),
-                  DateTime::DateFormat::Rfc1123);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyStatusDescription)
-                != response.GetHeaders().end())
-            {
-              result.CopyStatusDescription
-                  = response.GetHeaders().at(_detail::HeaderCopyStatusDescription);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyId) != response.GetHeaders().end())
-            {
-              result.CopyId = response.GetHeaders().at(_detail::HeaderCopyId);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyProgress)
-                != response.GetHeaders().end())
-            {
-              result.CopyProgress = response.GetHeaders().at(_detail::HeaderCopyProgress);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopySource)
-                != response.GetHeaders().end())
-            {
-              result.CopySource = response.GetHeaders().at(_detail::HeaderCopySource);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyStatus)
-                != response.GetHeaders().end())
-            {
-              result.CopyStatus = CopyStatus(response.GetHeaders().at(_detail::HeaderCopyStatus));
-            }
-            if (response.GetHeaders().find(_detail::HeaderIsServerEncrypted)
-                != response.GetHeaders().end())
-            {
-              result.IsServerEncrypted
-                  = response.GetHeaders().at(_detail::HeaderIsServerEncrypted) == "true";
-            }
-            result.SmbProperties.Attributes
-                = FileAttributes(response.GetHeaders().at(_detail::HeaderAttributes));
-            result.SmbProperties.CreatedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderCreatedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.LastWrittenOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastWrittenOn),
-                DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.ChangedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderChangedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.PermissionKey
-                = response.GetHeaders().at(_detail::HeaderFilePermissionKey);
-            result.SmbProperties.FileId = response.GetHeaders().at(_detail::HeaderFileId);
-            result.SmbProperties.ParentFileId
-                = response.GetHeaders().at(_detail::HeaderParentFileId);
-            if (response.GetHeaders().find(_detail::HeaderLeaseDuration)
-                != response.GetHeaders().end())
-            {
-              result.LeaseDuration
-                  = LeaseDuration(response.GetHeaders().at(_detail::HeaderLeaseDuration));
-            }
-            if (response.GetHeaders().find(_detail::HeaderLeaseState)
-                != response.GetHeaders().end())
-            {
-              result.LeaseState = LeaseState(response.GetHeaders().at(_detail::HeaderLeaseState));
-            }
-            if (response.GetHeaders().find(_detail::HeaderLeaseStatus)
-                != response.GetHeaders().end())
-            {
-              result.LeaseStatus
-                  = LeaseStatus(response.GetHeaders().at(_detail::HeaderLeaseStatus));
-            }
-            return Azure::Response<Models::FileProperties>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::DeleteFileResult> DeleteParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Accepted)
-          {
-            // Success (Accepted).
-            Models::DeleteFileResult result;
-            return Azure::Response<Models::DeleteFileResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::SetFilePropertiesResult> SetHttpHeadersParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success
-            Models::SetFilePropertiesResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.IsServerEncrypted
-                = response.GetHeaders().at(_detail::HeaderRequestIsServerEncrypted) == "true";
-            result.SmbProperties.PermissionKey
-                = response.GetHeaders().at(_detail::HeaderFilePermissionKey);
-            result.SmbProperties.Attributes
-                = FileAttributes(response.GetHeaders().at(_detail::HeaderAttributes));
-            result.SmbProperties.CreatedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderCreatedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.LastWrittenOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastWrittenOn),
-                DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.ChangedOn = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderChangedOn), DateTime::DateFormat::Rfc3339);
-            result.SmbProperties.FileId = response.GetHeaders().at(_detail::HeaderFileId);
-            result.SmbProperties.ParentFileId
-                = response.GetHeaders().at(_detail::HeaderParentFileId);
-            return Azure::Response<Models::SetFilePropertiesResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::SetFileMetadataResult> SetMetadataParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success (OK).
-            Models::SetFileMetadataResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.IsServerEncrypted
-                = response.GetHeaders().at(_detail::HeaderRequestIsServerEncrypted) == "true";
-            return Azure::Response<Models::SetFileMetadataResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<FileAcquireLeaseResult> AcquireLeaseParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Created)
-          {
-            // The Acquire operation completed successfully.
-            FileAcquireLeaseResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.LeaseId = response.GetHeaders().at(_detail::HeaderLeaseId);
-            return Azure::Response<FileAcquireLeaseResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<FileReleaseLeaseResult> ReleaseLeaseParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // The Release operation completed successfully.
-            FileReleaseLeaseResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            return Azure::Response<FileReleaseLeaseResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<FileChangeLeaseResult> ChangeLeaseParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // The Change operation completed successfully.
-            FileChangeLeaseResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.LeaseId = response.GetHeaders().at(_detail::HeaderLeaseId);
-            return Azure::Response<FileChangeLeaseResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<FileBreakLeaseResult> BreakLeaseParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Accepted)
-          {
-            // The Break operation completed successfully.
-            FileBreakLeaseResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            if (response.GetHeaders().find(_detail::HeaderLeaseId) != response.GetHeaders().end())
-            {
-              result.LeaseId = response.GetHeaders().at(_detail::HeaderLeaseId);
-            }
-            return Azure::Response<FileBreakLeaseResult>(std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::UploadFileRangeResult> UploadRangeParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Created)
-          {
-            // Success (Created).
-            Models::UploadFileRangeResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            if (response.GetHeaders().find(_detail::HeaderTransactionalContentHashMd5)
-                != response.GetHeaders().end())
-            {
-              result.TransactionalContentHash = _internal::FromBase64String(
-                  response.GetHeaders().at(_detail::HeaderTransactionalContentHashMd5),
-                  HashAlgorithm::Md5);
-            }
-            if (response.GetHeaders().find(_detail::HeaderRequestIsServerEncrypted)
-                != response.GetHeaders().end())
-            {
-              result.IsServerEncrypted
-                  = response.GetHeaders().at(_detail::HeaderRequestIsServerEncrypted) == "true";
-            }
-            return Azure::Response<Models::UploadFileRangeResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::UploadFileRangeFromUriResult> UploadRangeFromUrlParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Created)
-          {
-            // Success (Created).
-            Models::UploadFileRangeFromUriResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.TransactionalContentHash = _internal::FromBase64String(
-                response.GetHeaders().at(_detail::HeaderTransactionalContentHashCrc64),
-                HashAlgorithm::Crc64);
-            result.IsServerEncrypted
-                = response.GetHeaders().at(_detail::HeaderRequestIsServerEncrypted) == "true";
-            return Azure::Response<Models::UploadFileRangeFromUriResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::GetFileRangeListResult> GetRangeListParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success.
-            const auto& bodyBuffer = response.GetBody();
-            auto reader = _internal::XmlReader(
-                reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
-            Models::GetFileRangeListResult result = bodyBuffer.empty()
-                ? Models::GetFileRangeListResult()
-                : GetFileRangeListResultFromRangeList(RangeListFromXml(reader));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.FileSize = std::stoll(response.GetHeaders().at(_detail::HeaderXMsContentLength));
-            return Azure::Response<Models::GetFileRangeListResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
-        static RangeList RangeListFromXml(_internal::XmlReader& reader)
-        {
-          auto result = RangeList();
-          enum class XmlTagName
-          {
-            ClearRange,
-            Range,
-            Ranges,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "ClearRange") == 0)
-              {
-                path.emplace_back(XmlTagName::ClearRange);
-              }
-              else if (std::strcmp(node.Name.data(), "Range") == 0)
-              {
-                path.emplace_back(XmlTagName::Range);
-              }
-              else if (std::strcmp(node.Name.data(), "Ranges") == 0)
-              {
-                path.emplace_back(XmlTagName::Ranges);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-              if (path.size() == 2 && path[0] == XmlTagName::Ranges && path[1] == XmlTagName::Range)
-              {
-                result.Ranges.emplace_back(HttpRangeFromXml(reader));
-                path.pop_back();
-              }
-              else if (
-                  path.size() == 2 && path[0] == XmlTagName::Ranges
-                  && path[1] == XmlTagName::ClearRange)
-              {
-                result.ClearRanges.emplace_back(HttpRangeFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-            }
-          }
-          return result;
-        }
-
-        static Models::GetFileRangeListResult GetFileRangeListResultFromRangeList(RangeList object)
-        {
-          Models::GetFileRangeListResult result;
-          result.Ranges = std::move(object.Ranges);
-          result.ClearRanges = std::move(object.ClearRanges);
+        static RangeList RangeListFromXml(_internal::XmlReader& reader);
 
-          return result;
-        }
+        static Models::GetFileRangeListResult GetFileRangeListResultFromRangeList(RangeList object);
         static Azure::Response<FileStartCopyResult> StartCopyParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Accepted)
-          {
-            // The copy file has been accepted with the specified copy status.
-            FileStartCopyResult result;
-            result.ETag = Azure::ETag(response.GetHeaders().at(_detail::HeaderETag));
-            result.LastModified = DateTime::Parse(
-                response.GetHeaders().at(_detail::HeaderLastModified),
-                DateTime::DateFormat::Rfc1123);
-            if (response.GetHeaders().find(_detail::HeaderCopyId) != response.GetHeaders().end())
-            {
-              result.CopyId = response.GetHeaders().at(_detail::HeaderCopyId);
-            }
-            if (response.GetHeaders().find(_detail::HeaderCopyStatus)
-                != response.GetHeaders().end())
-            {
-              result.CopyStatus = CopyStatus(response.GetHeaders().at(_detail::HeaderCopyStatus));
-            }
-            return Azure::Response<FileStartCopyResult>(std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<Models::AbortFileCopyResult> AbortCopyParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::NoContent)
-          {
-            // The delete request was accepted and the file will be deleted.
-            Models::AbortFileCopyResult result;
-            return Azure::Response<Models::AbortFileCopyResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
         static Azure::Response<FileListHandlesResult> ListHandlesParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success.
-            const auto& bodyBuffer = response.GetBody();
-            auto reader = _internal::XmlReader(
-                reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
-            FileListHandlesResult result = bodyBuffer.empty()
-                ? FileListHandlesResult()
-                : FileListHandlesResultFromListHandlesResponse(ListHandlesResponseFromXml(reader));
-            result.HttpHeaders.ContentType = response.GetHeaders().at(_detail::HeaderContentType);
-            return Azure::Response<FileListHandlesResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
 
-        static HandleItem HandleItemFromXml(_internal::XmlReader& reader)
-        {
-          auto result = HandleItem();
-          enum class XmlTagName
-          {
-            ClientIp,
-            FileId,
-            HandleId,
-            LastReconnectTime,
-            OpenTime,
-            ParentId,
-            Path,
-            SessionId,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "ClientIp") == 0)
-              {
-                path.emplace_back(XmlTagName::ClientIp);
-              }
-              else if (std::strcmp(node.Name.data(), "FileId") == 0)
-              {
-                path.emplace_back(XmlTagName::FileId);
-              }
-              else if (std::strcmp(node.Name.data(), "HandleId") == 0)
-              {
-                path.emplace_back(XmlTagName::HandleId);
-              }
-              else if (std::strcmp(node.Name.data(), "LastReconnectTime") == 0)
-              {
-                path.emplace_back(XmlTagName::LastReconnectTime);
-              }
-              else if (std::strcmp(node.Name.data(), "OpenTime") == 0)
-              {
-                path.emplace_back(XmlTagName::OpenTime);
-              }
-              else if (std::strcmp(node.Name.data(), "ParentId") == 0)
-              {
-                path.emplace_back(XmlTagName::ParentId);
-              }
-              else if (std::strcmp(node.Name.data(), "Path") == 0)
-              {
-                path.emplace_back(XmlTagName::Path);
-              }
-              else if (std::strcmp(node.Name.data(), "SessionId") == 0)
-              {
-                path.emplace_back(XmlTagName::SessionId);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 1 && path[0] == XmlTagName::ClientIp)
-              {
-                result.ClientIp = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::FileId)
-              {
-                result.FileId = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::HandleId)
-              {
-                result.HandleId = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::LastReconnectTime)
-              {
-                result.LastReconnectedOn
-                    = DateTime::Parse(node.Value, DateTime::DateFormat::Rfc1123);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::OpenTime)
-              {
-                result.OpenedOn = DateTime::Parse(node.Value, DateTime::DateFormat::Rfc1123);
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::ParentId)
-              {
-                result.ParentId = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::Path)
-              {
-                result.Path = node.Value;
-              }
-              else if (path.size() == 1 && path[0] == XmlTagName::SessionId)
-              {
-                result.SessionId = node.Value;
-              }
-            }
-          }
-          return result;
-        }
+        static HandleItem HandleItemFromXml(_internal::XmlReader& reader);
 
-        static ListHandlesResponse ListHandlesResponseFromXml(_internal::XmlReader& reader)
-        {
-          auto result = ListHandlesResponse();
-          enum class XmlTagName
-          {
-            Entries,
-            EnumerationResults,
-            Handle,
-            NextMarker,
-            Unknown,
-          };
-          std::vector<XmlTagName> path;
-
-          while (true)
-          {
-            auto node = reader.Read();
-            if (node.Type == _internal::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == _internal::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::StartTag)
-            {
-
-              if (std::strcmp(node.Name.data(), "Entries") == 0)
-              {
-                path.emplace_back(XmlTagName::Entries);
-              }
-              else if (std::strcmp(node.Name.data(), "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::EnumerationResults);
-              }
-              else if (std::strcmp(node.Name.data(), "Handle") == 0)
-              {
-                path.emplace_back(XmlTagName::Handle);
-              }
-              else if (std::strcmp(node.Name.data(), "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::NextMarker);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::Unknown);
-              }
-              if (path.size() == 3 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::Entries && path[2] == XmlTagName::Handle)
-              {
-                result.HandleList.emplace_back(HandleItemFromXml(reader));
-                path.pop_back();
-              }
-            }
-            else if (node.Type == _internal::XmlNodeType::Text)
-            {
-              if (path.size() == 2 && path[0] == XmlTagName::EnumerationResults
-                  && path[1] == XmlTagName::NextMarker)
-              {
-                result.ContinuationToken = node.Value;
-              }
-            }
-          }
-          return result;
-        }
+        static ListHandlesResponse ListHandlesResponseFromXml(_internal::XmlReader& reader);
 
         static FileListHandlesResult FileListHandlesResultFromListHandlesResponse(
-            ListHandlesResponse object)
-        {
-          FileListHandlesResult result;
-          result.HandleList = std::move(object.HandleList);
-          result.ContinuationToken = std::move(object.ContinuationToken);
-
-          return result;
-        }
+            ListHandlesResponse object);
         static Azure::Response<FileForceCloseHandlesResult> ForceCloseHandlesParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
-        {
-          auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
-          {
-            // Success.
-            FileForceCloseHandlesResult result;
-            if (response.GetHeaders().find(_detail::HeaderContinuationToken)
-                != response.GetHeaders().end())
-            {
-              result.ContinuationToken = response.GetHeaders().at(_detail::HeaderContinuationToken);
-            }
-            result.NumberOfHandlesClosed
-                = std::stoi(response.GetHeaders().at(_detail::HeaderNumberOfHandlesClosed));
-            result.NumberOfHandlesFailedToClose
-                = std::stoi(response.GetHeaders().at(_detail::HeaderNumberOfHandlesFailedToClose));
-            return Azure::Response<FileForceCloseHandlesResult>(
-                std::move(result), std::move(responsePtr));
-          }
-          else
-          {
-            (void)context;
-            throw Storage::StorageException::CreateFromResponse(std::move(responsePtr));
-          }
-        }
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr);
       };
 
     }; // class ShareRestClient
@@ -228,14 +228,34 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         const GetSharePermissionOptions& options = GetSharePermissionOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Closes all the handles opened on the files and directories of the share, the
+     * directories at the fan out depth concurrently.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return Models::ForceCloseAllHandlesParallelResult containing the number of handles closed
+     * and failed to close.
+     */
+    Models::ForceCloseAllHandlesParallelResult ForceCloseAllHandles(
+        const ForceCloseAllHandlesParallelOptions& options = ForceCloseAllHandlesParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
   private:
     Azure::Core::Url m_shareUrl;
     std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    std::shared_ptr<TransferScheduler> m_transferScheduler;
+    std::shared_ptr<BufferPool> m_bufferPool;
+    std::shared_ptr<ShareDirectoryListingCache> m_listingCache;
 
     explicit ShareClient(
         Azure::Core::Url shareUrl,
-        std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline)
-        : m_shareUrl(std::move(shareUrl)), m_pipeline(std::move(pipeline))
+        std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline,
+        std::shared_ptr<TransferScheduler> transferScheduler,
+        std::shared_ptr<BufferPool> bufferPool,
+        std::shared_ptr<ShareDirectoryListingCache> listingCache)
+        : m_shareUrl(std::move(shareUrl)), m_pipeline(std::move(pipeline)),
+          m_transferScheduler(std::move(transferScheduler)), m_bufferPool(std::move(bufferPool)),
+          m_listingCache(std::move(listingCache))
     {
     }
     friend class ShareLeaseClient;
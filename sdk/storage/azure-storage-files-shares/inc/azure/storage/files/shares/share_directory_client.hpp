@@ -183,6 +183,9 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
      * @param options Optional parameters to list the files and directories under this directory.
      * @param context Context for cancelling long running operations.
      * @return ListFilesAndDirectoriesPagedResponse describing the items in the directory.
+     * @remark With a ShareClientOptions::ListingCache, listing from the first page gets the
+     * properties of the directory, and returns all of its items in a single page, from the cache
+     * if the directory is unchanged since it was cached.
      */
     ListFilesAndDirectoriesPagedResponse ListFilesAndDirectories(
         const ListFilesAndDirectoriesOptions& options = ListFilesAndDirectoriesOptions(),
@@ -225,17 +228,85 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         = ForceCloseAllDirectoryHandlesOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Closes all the handles opened on this directory, its files, its subdirectories and
+     * their files. The subtrees at the fan out depth are closed concurrently, instead of paging
+     * through the whole directory one request after the other.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return Models::ForceCloseAllHandlesParallelResult containing the number of handles closed
+     * and failed to close.
+     * @remark After a request fails, no other request is sent and the exception is thrown once
+     * the requests in flight are done.
+     */
+    Models::ForceCloseAllHandlesParallelResult ForceCloseAllHandlesParallel(
+        const ForceCloseAllHandlesParallelOptions& options = ForceCloseAllHandlesParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Downloads all the files and directories in this directory to a local directory,
+     * created if it doesn't exist. The directories are listed while the files are downloaded, up
+     * to Concurrency files at the same time.
+     * @param localDirectoryName The local directory. Its files with the same name as a downloaded
+     * file are overwritten.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return Models::DownloadDirectoryToResult containing the number of files and directories
+     * downloaded.
+     * @remark The chunks of all the files share the TransferScheduler of the client, or one
+     * created for the operation allowing Concurrency chunks.
+     */
+    Models::DownloadDirectoryToResult DownloadTo(
+        const std::string& localDirectoryName,
+        const DownloadDirectoryToOptions& options = DownloadDirectoryToOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Uploads all the files and directories in a local directory to this directory,
+     * created if it doesn't exist. The local directories are listed while the files are
+     * uploaded, up to Concurrency files at the same time.
+     * @param localDirectoryName The local directory. The files with the same name as an uploaded
+     * file are overwritten.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return Models::UploadDirectoryFromResult containing the number of files and directories
+     * uploaded.
+     * @remark The chunks of all the files share the TransferScheduler of the client, or one
+     * created for the operation allowing Concurrency chunks.
+     */
+    Models::UploadDirectoryFromResult UploadFrom(
+        const std::string& localDirectoryName,
+        const UploadDirectoryFromOptions& options = UploadDirectoryFromOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
   private:
     Azure::Core::Url m_shareDirectoryUrl;
     std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    std::shared_ptr<TransferScheduler> m_transferScheduler;
+    std::shared_ptr<BufferPool> m_bufferPool;
+    std::shared_ptr<ShareDirectoryListingCache> m_listingCache;
 
     explicit ShareDirectoryClient(
         Azure::Core::Url shareDirectoryUrl,
-        std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline)
-        : m_shareDirectoryUrl(std::move(shareDirectoryUrl)), m_pipeline(std::move(pipeline))
+        std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline,
+        std::shared_ptr<TransferScheduler> transferScheduler,
+        std::shared_ptr<BufferPool> bufferPool,
+        std::shared_ptr<ShareDirectoryListingCache> listingCache)
+        : m_shareDirectoryUrl(std::move(shareDirectoryUrl)), m_pipeline(std::move(pipeline)),
+          m_transferScheduler(std::move(transferScheduler)), m_bufferPool(std::move(bufferPool)),
+          m_listingCache(std::move(listingCache))
     {
     }
 
+    // Lists a single page of the directory, bypassing the listing cache.
+    ListFilesAndDirectoriesPagedResponse ListFilesAndDirectoriesSinglePage(
+        const ListFilesAndDirectoriesOptions& options,
+        const Azure::Core::Context& context) const;
+
+    // A copy of this client whose transfers share a scheduler, the one of this client or a new
+    // one allowing concurrency chunks.
+    ShareDirectoryClient WithSharedTransferScheduler(int32_t concurrency) const;
+
     friend class ShareClient;
   };
 }}}} // namespace Azure::Storage::Files::Shares
@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <azure/core/etag.hpp>
+#include <azure/core/url.hpp>
+
+#include "azure/storage/files/shares/share_responses.hpp"
+
+namespace Azure { namespace Storage { namespace Files { namespace Shares {
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Files::Shares::ShareDirectoryListingCache.
+   */
+  struct ShareDirectoryListingCacheOptions final
+  {
+    /**
+     * @brief The number of directories whose listings are cached. Once it's reached, the
+     * listings used least recently are evicted.
+     */
+    size_t Capacity = 256;
+
+    /**
+     * @brief How long a listing is reused while the directory keeps its ETag. Older listings are
+     * listed again.
+     */
+    std::chrono::milliseconds MaxAge = std::chrono::minutes(5);
+
+    /**
+     * @brief The number of parts of the cache with their own lock, so that the clients sharing it
+     * from several threads seldom wait for each other.
+     */
+    size_t ShardCount = 16;
+  };
+
+  /**
+   * @brief Caches the listings of the directories listed by the clients sharing it, so that
+   * listing an unchanged directory again takes a single request for its properties.
+   *
+   * @remark The directories are identified by their URLs, and a listing is cached for each prefix
+   * it was filtered by. A listing is reused while the directory has the ETag it was listed with,
+   * and isn't older than #ShareDirectoryListingCacheOptions::MaxAge. The service doesn't always
+   * change the ETag of a directory when its files change, so the listings of a directory are also
+   * evicted when a file or subdirectory is created or deleted in it through a client sharing the
+   * cache, and MaxAge bounds how stale a listing can be otherwise.
+   */
+  class ShareDirectoryListingCache final {
+  public:
+    /**
+     * @brief Constructs a cache.
+     *
+     * @param options Optional parameters for the cache.
+     */
+    explicit ShareDirectoryListingCache(
+        ShareDirectoryListingCacheOptions options = ShareDirectoryListingCacheOptions());
+
+    ~ShareDirectoryListingCache();
+
+    ShareDirectoryListingCache(const ShareDirectoryListingCache&) = delete;
+    ShareDirectoryListingCache& operator=(const ShareDirectoryListingCache&) = delete;
+
+    /**
+     * @brief Gets the cached listing of a directory.
+     *
+     * @param directoryUrl The URL of the directory.
+     * @param prefix The prefix the listing is filtered by, empty for none.
+     * @param eTag The current ETag of the directory.
+     * @return The listing, or null if it isn't cached, was listed with another ETag, or is older
+     * than #ShareDirectoryListingCacheOptions::MaxAge.
+     */
+    std::shared_ptr<const Models::DirectoryListing> Get(
+        const std::string& directoryUrl,
+        const std::string& prefix,
+        const Azure::ETag& eTag);
+
+    /**
+     * @brief Caches the listing of a directory, for the prefix it's filtered by.
+     *
+     * @param directoryUrl The URL of the directory.
+     * @param listing The listing, with the ETag the directory had before it was listed.
+     */
+    void Set(
+        const std::string& directoryUrl,
+        std::shared_ptr<const Models::DirectoryListing> listing);
+
+    /**
+     * @brief Evicts the listings of a directory.
+     *
+     * @param directoryUrl The URL of the directory.
+     */
+    void Remove(const std::string& directoryUrl);
+
+  private:
+    struct Shard;
+
+    Shard& GetShard(const std::string& directoryUrl);
+
+    ShareDirectoryListingCacheOptions m_options;
+    size_t m_shardCapacity;
+    std::vector<std::unique_ptr<Shard>> m_shards;
+  };
+
+  namespace _detail {
+    // The URL of the directory containing a file or a directory.
+    inline std::string GetParentDirectoryUrl(Azure::Core::Url url)
+    {
+      const std::string path = url.GetPath();
+      const auto pos = path.rfind('/');
+      if (pos != std::string::npos)
+      {
+        url.SetPath(path.substr(0, pos));
+      }
+      return url.GetAbsoluteUrl();
+    }
+  } // namespace _detail
+
+}}}} // namespace Azure::Storage::Files::Shares
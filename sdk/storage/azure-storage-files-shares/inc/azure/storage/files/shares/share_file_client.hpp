@@ -154,6 +154,45 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         const DownloadFileToOptions& options = DownloadFileToOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Downloads this file to a sparse local file. Only the valid ranges are downloaded, in
+     * parallel, and the rest are left as holes of the local file, which read as zeros without
+     * taking space on disk.
+     *
+     * @param fileName A file path to write the downloaded content to.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return Azure::Response<Models::DownloadSparseFileToResult> describing the downloaded file.
+     * @remark On a file system not supporting sparse files, the holes are written as zeros by the
+     * file system itself, still without being downloaded.
+     */
+    Azure::Response<Models::DownloadSparseFileToResult> DownloadSparseTo(
+        const std::string& fileName,
+        const DownloadSparseFileToOptions& options = DownloadSparseFileToOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Brings a local copy of this file in a share snapshot up to date with a later share
+     * snapshot. Only the ranges changed between the two snapshots are downloaded, in parallel,
+     * and the cleared ones are zeroed in the local file, as holes where the file system supports
+     * it.
+     *
+     * @param fileName A file path holding the content of previousShareSnapshot, updated in place.
+     * @param previousShareSnapshot The share snapshot the local file holds the content of.
+     * @param shareSnapshot The later share snapshot to update the local file to. An empty string
+     * updates it to the current content of the file.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return Azure::Response<Models::SyncFileFromSnapshotDiffResult> describing the synced file.
+     * @remark If an error occurs, the local file holds neither snapshot and must be synced again.
+     */
+    Azure::Response<Models::SyncFileFromSnapshotDiffResult> SyncFromSnapshotDiff(
+        const std::string& fileName,
+        const std::string& previousShareSnapshot,
+        const std::string& shareSnapshot,
+        const SyncFileFromSnapshotDiffOptions& options = SyncFileFromSnapshotDiffOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Creates a new file, or updates the content of an existing file. Updating
      * an existing file overwrites any existing metadata on the file.
@@ -361,14 +400,42 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         const UploadFileRangeFromUriOptions& options = UploadFileRangeFromUriOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Copies a file to this file by copying the valid ranges of the source concurrently
+     * with UploadRangeFromUri. The bytes are copied by the service, without going through this
+     * host. An existing file is replaced.
+     *
+     * @remark Unlike StartCopy, the copy is done when the function returns, and its throughput is
+     * set by TransferOptions.Concurrency and the transfer scheduler of the client. The source must
+     * be a file, public or authorized with a SAS, like with UploadRangeFromUri. Its HTTP headers
+     * and metadata are copied. The copy fails if the source is modified while it runs.
+     *
+     * @param sourceUri The URI of the source file.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return Azure::Response<Models::CopyFileFromUriParallelResult> describing the copied file.
+     */
+    Azure::Response<Models::CopyFileFromUriParallelResult> CopyFromUriParallel(
+        const std::string& sourceUri,
+        const CopyFileFromUriParallelOptions& options = CopyFileFromUriParallelOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
   private:
     Azure::Core::Url m_shareFileUrl;
     std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    std::shared_ptr<TransferScheduler> m_transferScheduler;
+    std::shared_ptr<BufferPool> m_bufferPool;
+    std::shared_ptr<ShareDirectoryListingCache> m_listingCache;
 
     explicit ShareFileClient(
         Azure::Core::Url shareFileUrl,
-        std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline)
-        : m_shareFileUrl(std::move(shareFileUrl)), m_pipeline(std::move(pipeline))
+        std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline,
+        std::shared_ptr<TransferScheduler> transferScheduler,
+        std::shared_ptr<BufferPool> bufferPool,
+        std::shared_ptr<ShareDirectoryListingCache> listingCache)
+        : m_shareFileUrl(std::move(shareFileUrl)), m_pipeline(std::move(pipeline)),
+          m_transferScheduler(std::move(transferScheduler)), m_bufferPool(std::move(bufferPool)),
+          m_listingCache(std::move(listingCache))
     {
     }
 
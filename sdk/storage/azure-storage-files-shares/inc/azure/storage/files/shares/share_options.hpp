@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -10,11 +11,16 @@
 #include <azure/core/internal/client_options.hpp>
 #include <azure/core/nullable.hpp>
 #include <azure/storage/common/access_conditions.hpp>
+#include <azure/storage/common/buffer_pool.hpp>
+#include <azure/storage/common/storage_common.hpp>
+#include <azure/storage/common/transfer_scheduler.hpp>
 
 #include "azure/storage/files/shares/protocol/share_rest_client.hpp"
 
 namespace Azure { namespace Storage { namespace Files { namespace Shares {
 
+  class ShareDirectoryListingCache;
+
   /**
    * @brief Client options used to initialize share clients.
    */
@@ -24,6 +30,24 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
      * API version used by this client.
      */
     std::string ApiVersion = _detail::DefaultServiceApiVersion;
+
+    /**
+     * @brief Bounds the chunks of the concurrent uploads and downloads of all the clients sharing
+     * it. If null, only the `Concurrency` of each call bounds its chunks.
+     */
+    std::shared_ptr<Azure::Storage::TransferScheduler> TransferScheduler;
+
+    /**
+     * @brief Provides the chunk buffers of the uploads and downloads of all the clients sharing
+     * it. If null, the clients share #Azure::Storage::BufferPool::GetDefault().
+     */
+    std::shared_ptr<Azure::Storage::BufferPool> BufferPool;
+
+    /**
+     * @brief Caches the listings of the directories listed by all the clients sharing it, which
+     * are only listed again once they changed. If null, the directories are always listed.
+     */
+    std::shared_ptr<ShareDirectoryListingCache> ListingCache;
   };
 
   /**
@@ -330,6 +354,34 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     Azure::Nullable<bool> Recursive;
   };
 
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Files::Shares::ShareDirectoryClient::ForceCloseAllHandlesParallel and
+   * #Azure::Storage::Files::Shares::ShareClient::ForceCloseAllHandles.
+   */
+  struct ForceCloseAllHandlesParallelOptions final
+  {
+    /**
+     * The maximum number of requests sent at the same time.
+     */
+    int32_t Concurrency = 5;
+
+    /**
+     * The depth of the directories whose handles are closed recursively, each with its own
+     * sequence of requests. The handles of the directories above this depth, and of their files,
+     * are closed path by path while the directories are listed. With 0, the handles of the whole
+     * directory are closed with a single sequence of requests.
+     */
+    int32_t FanOutDepth = 1;
+
+    /**
+     * Called with the total number of handles closed and failed to close so far, after each
+     * request. It's called by one thread at a time.
+     */
+    std::function<void(int64_t numberOfHandlesClosed, int64_t numberOfHandlesFailedToClose)>
+        ProgressHandler;
+  };
+
   /**
    * @brief Optional parameters for #Azure::Storage::Files::Shares::ShareFileClient::Create.
    */
@@ -548,6 +600,46 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     LeaseAccessConditions AccessConditions;
   };
 
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Files::Shares::ShareFileClient::CopyFromUriParallel.
+   */
+  struct CopyFileFromUriParallelOptions final
+  {
+    /**
+     * This permission is the security descriptor for the file specified in the Security
+     * Descriptor Definition Language (SDDL). If not specified, 'inherit' is used.
+     */
+    Azure::Nullable<std::string> Permission;
+
+    /**
+     * SMB properties to set for the file.
+     */
+    Models::FileSmbProperties SmbProperties;
+
+    /**
+     * The operation will only succeed if the lease access condition is met.
+     */
+    LeaseAccessConditions AccessConditions;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * The maximum number of bytes of the source copied by each request. Larger values are
+       * capped at 4 MiB, the largest range a request copies.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * The maximum number of ranges copied at the same time.
+       */
+      int32_t Concurrency = 5;
+    } TransferOptions;
+  };
+
   /**
    * @brief Optional parameters for #Azure::Storage::Files::Shares::ShareFileClient::GetRangeList.
    */
@@ -639,6 +731,78 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
        * The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * @brief How the chunks are sized. With TransferStrategy::Adaptive, InitialChunkSize isn't
+       * used: the first request downloads ChunkSize bytes, then the chunk size grows or shrinks
+       * with the observed throughput.
+       */
+      TransferStrategy Strategy = TransferStrategy::Fixed;
+
+      /**
+       * @brief When downloading to a file, sizes the file once the size of the share file is
+       * known and maps it in memory, so the transfer threads receive the chunks straight into the
+       * file, without copying them through a buffer nor writing them with system calls.
+       */
+      bool UseMemoryMappedFile = false;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Files::Shares::ShareFileClient::DownloadSparseTo.
+   */
+  struct DownloadSparseFileToOptions final
+  {
+    /**
+     * The operation will only succeed if the access condition is met.
+     */
+    LeaseAccessConditions AccessConditions;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief The maximum number of bytes in a single request. Valid ranges larger than this are
+       * downloaded in several requests.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of threads that may be used in a parallel transfer.
+       */
+      int32_t Concurrency = 5;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Files::Shares::ShareFileClient::SyncFromSnapshotDiff.
+   */
+  struct SyncFileFromSnapshotDiffOptions final
+  {
+    /**
+     * The operation will only succeed if the access condition is met.
+     */
+    LeaseAccessConditions AccessConditions;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief The maximum number of bytes in a single request. Changed ranges larger than this
+       * are downloaded in several requests.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of threads that may be used in a parallel transfer.
+       */
+      int32_t Concurrency = 5;
     } TransferOptions;
   };
 
@@ -682,7 +846,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       int64_t SingleUploadThreshold = 4 * 1024 * 1024;
 
       /**
-       * The maximum number of bytes in a single request.
+       * The maximum number of bytes in a single request. Larger values are lowered to 4 MiB, the
+       * largest range a request can upload.
        */
       int64_t ChunkSize = 4 * 1024 * 1024;
 
@@ -690,6 +855,82 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
        * The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * @brief How the ranges are sized. With TransferStrategy::Adaptive, ChunkSize is the size of
+       * the first ranges, then the range size grows up to 4 MiB or shrinks with the observed
+       * throughput, and so does the number of ranges uploaded at the same time.
+       */
+      TransferStrategy Strategy = TransferStrategy::Fixed;
+
+      /**
+       * @brief When uploading from a file, skips the holes of a sparse file, as reported by the
+       * file system, and the blocks of 512 bytes that are all zeros, since a new share file reads
+       * as zeros. Only the data ranges are read, and their parts that aren't zeros uploaded in
+       * parallel. The ranges are sized with TransferStrategy::Fixed.
+       */
+      bool SkipZeroRanges = false;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Files::Shares::ShareDirectoryClient::DownloadTo.
+   */
+  struct DownloadDirectoryToOptions final
+  {
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * Files up to this size are downloaded with a single request, many of them one after the
+       * other by each thread. Larger files are downloaded in chunks of ChunkSize.
+       */
+      int64_t InitialChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * The maximum number of bytes in a single request.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * The maximum number of files, and of chunks of the larger files, transferred at the same
+       * time.
+       */
+      int32_t Concurrency = 5;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Files::Shares::ShareDirectoryClient::UploadFrom.
+   */
+  struct UploadDirectoryFromOptions final
+  {
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * Files smaller than this are uploaded with a single request, many of them one after the
+       * other by each thread. Larger files are uploaded in chunks of ChunkSize. This value cannot
+       * be larger than 4 MiB.
+       */
+      int64_t SingleUploadThreshold = 4 * 1024 * 1024;
+
+      /**
+       * The maximum number of bytes in a single request.
+       */
+      int64_t ChunkSize = 4 * 1024 * 1024;
+
+      /**
+       * The maximum number of files, and of chunks of the larger files, transferred at the same
+       * time.
+       */
+      int32_t Concurrency = 5;
     } TransferOptions;
   };
 
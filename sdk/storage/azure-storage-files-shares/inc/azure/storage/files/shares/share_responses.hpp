@@ -184,6 +184,90 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       DownloadFileDetails Details;
     };
 
+    /**
+     * @brief The information returned when downloading a file to a sparse file.
+     */
+    struct DownloadSparseFileToResult final
+    {
+      /**
+       * An HTTP entity tag associated with the file.
+       */
+      Azure::ETag ETag;
+
+      /**
+       * The data and time the file was last modified.
+       */
+      DateTime LastModified;
+
+      /**
+       * The size of the file.
+       */
+      int64_t FileSize = 0;
+
+      /**
+       * The number of bytes downloaded, which is the total size of the valid ranges.
+       */
+      int64_t DownloadedSize = 0;
+    };
+
+    /**
+     * @brief The information returned when syncing a local file from a snapshot diff.
+     */
+    struct SyncFileFromSnapshotDiffResult final
+    {
+      /**
+       * An HTTP entity tag associated with the file.
+       */
+      Azure::ETag ETag;
+
+      /**
+       * The data and time the file was last modified.
+       */
+      DateTime LastModified;
+
+      /**
+       * The size of the file, which is the size of the local file after the sync.
+       */
+      int64_t FileSize = 0;
+
+      /**
+       * The number of bytes downloaded, which is the total size of the changed ranges.
+       */
+      int64_t DownloadedSize = 0;
+
+      /**
+       * The number of bytes zeroed in the local file, which is the total size of the cleared
+       * ranges.
+       */
+      int64_t ClearedSize = 0;
+    };
+
+    /**
+     * @brief The information returned when copying a file from a URI in parallel.
+     */
+    struct CopyFileFromUriParallelResult final
+    {
+      /**
+       * An HTTP entity tag associated with the file, once all the ranges are copied.
+       */
+      Azure::ETag ETag;
+
+      /**
+       * The data and time the file was last modified, once all the ranges are copied.
+       */
+      DateTime LastModified;
+
+      /**
+       * The size of the file, which is the size of the source.
+       */
+      int64_t FileSize = 0;
+
+      /**
+       * The number of bytes copied, which is the total size of the valid ranges of the source.
+       */
+      int64_t CopiedSize = 0;
+    };
+
     /**
      * @brief The information returned when forcing a file handle to close.
      */
@@ -200,6 +284,117 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
        * A boolean indicates if the service is encrypted.
        */
       bool IsServerEncrypted = false;
+
+      /**
+       * The number of bytes uploaded, smaller than the size of the content when zero ranges are
+       * skipped.
+       */
+      int64_t UploadedSize = 0;
+    };
+
+    /**
+     * @brief The number of handles closed by ShareDirectoryClient::ForceCloseAllHandlesParallel.
+     */
+    struct ForceCloseAllHandlesParallelResult final
+    {
+      /**
+       * The number of handles closed.
+       */
+      int64_t NumberOfHandlesClosed = 0;
+
+      /**
+       * The number of handles that failed to close.
+       */
+      int64_t NumberOfHandlesFailedToClose = 0;
+    };
+
+    /**
+     * @brief The information returned when downloading a directory to a local directory.
+     */
+    struct DownloadDirectoryToResult final
+    {
+      /**
+       * The number of directories created under the local directory.
+       */
+      int64_t NumberOfDirectories = 0;
+
+      /**
+       * The number of files downloaded.
+       */
+      int64_t NumberOfFiles = 0;
+
+      /**
+       * The total size of the files downloaded.
+       */
+      int64_t DownloadedSize = 0;
+    };
+
+    /**
+     * @brief The information returned when uploading a local directory to a directory.
+     */
+    struct UploadDirectoryFromResult final
+    {
+      /**
+       * The number of directories created under the directory.
+       */
+      int64_t NumberOfDirectories = 0;
+
+      /**
+       * The number of files uploaded.
+       */
+      int64_t NumberOfFiles = 0;
+
+      /**
+       * The total size of the files uploaded.
+       */
+      int64_t UploadedSize = 0;
+    };
+
+    /**
+     * @brief All the files and subdirectories of a directory, as cached by
+     * #Azure::Storage::Files::Shares::ShareDirectoryListingCache.
+     */
+    struct DirectoryListing final
+    {
+      /**
+       * The ETag of the directory when it was listed.
+       */
+      Azure::ETag ETag;
+
+      /**
+       * Service endpoint.
+       */
+      std::string ServiceEndpoint;
+
+      /**
+       * Name of the file share.
+       */
+      std::string ShareName;
+
+      /**
+       * The share snapshot for the list operation.
+       */
+      std::string ShareSnapshot;
+
+      /**
+       * Directory path for the list operation.
+       */
+      std::string DirectoryPath;
+
+      /**
+       * Name prefix that's used to filter the result.
+       */
+      std::string Prefix;
+
+      /**
+       * Directory items.
+       */
+      std::vector<DirectoryItem> Directories;
+
+      /**
+       * File items.
+       */
+      std::vector<FileItem> Files;
     };
 
   } // namespace Models
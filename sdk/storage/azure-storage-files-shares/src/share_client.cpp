@@ -42,7 +42,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const std::string& shareUrl,
       std::shared_ptr<StorageSharedKeyCredential> credential,
       const ShareClientOptions& options)
-      : m_shareUrl(shareUrl)
+      : m_shareUrl(shareUrl), m_transferScheduler(options.TransferScheduler),
+        m_bufferPool(options.BufferPool), m_listingCache(options.ListingCache)
   {
     ShareClientOptions newOptions = options;
     newOptions.PerRetryPolicies.emplace_back(
@@ -62,7 +63,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   }
 
   ShareClient::ShareClient(const std::string& shareUrl, const ShareClientOptions& options)
-      : m_shareUrl(shareUrl)
+      : m_shareUrl(shareUrl), m_transferScheduler(options.TransferScheduler),
+        m_bufferPool(options.BufferPool), m_listingCache(options.ListingCache)
   {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
@@ -79,7 +81,12 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
 
   ShareDirectoryClient ShareClient::GetRootDirectoryClient() const
   {
-    return ShareDirectoryClient(m_shareUrl, m_pipeline);
+    return ShareDirectoryClient(
+        m_shareUrl,
+        m_pipeline,
+        m_transferScheduler,
+        m_bufferPool,
+        m_listingCache);
   }
 
   ShareClient ShareClient::WithSnapshot(const std::string& snapshot) const
@@ -273,4 +280,11 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     return Azure::Response<std::string>(result.Value.FilePermission, std::move(result.RawResponse));
   }
 
+  Models::ForceCloseAllHandlesParallelResult ShareClient::ForceCloseAllHandles(
+      const ForceCloseAllHandlesParallelOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    return GetRootDirectoryClient().ForceCloseAllHandlesParallel(options, context);
+  }
+
 }}}} // namespace Azure::Storage::Files::Shares
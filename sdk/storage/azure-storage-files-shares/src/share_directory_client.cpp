@@ -3,15 +3,23 @@
 
 #include "azure/storage/files/shares/share_directory_client.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+
 #include <azure/core/credentials/credentials.hpp>
 #include <azure/core/http/policies/policy.hpp>
 #include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
 #include <azure/storage/common/internal/constants.hpp>
+#include <azure/storage/common/internal/file_io.hpp>
 #include <azure/storage/common/internal/shared_key_policy.hpp>
 #include <azure/storage/common/internal/storage_per_retry_policy.hpp>
 #include <azure/storage/common/internal/storage_service_version_policy.hpp>
 #include <azure/storage/common/storage_common.hpp>
 
+#include "azure/storage/files/shares/share_directory_listing_cache.hpp"
 #include "azure/storage/files/shares/share_file_client.hpp"
 
 #include "private/package_version.hpp"
@@ -44,7 +52,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const std::string& shareDirectoryUrl,
       std::shared_ptr<StorageSharedKeyCredential> credential,
       const ShareClientOptions& options)
-      : m_shareDirectoryUrl(shareDirectoryUrl)
+      : m_shareDirectoryUrl(shareDirectoryUrl), m_transferScheduler(options.TransferScheduler),
+        m_bufferPool(options.BufferPool), m_listingCache(options.ListingCache)
   {
     ShareClientOptions newOptions = options;
     newOptions.PerRetryPolicies.emplace_back(
@@ -66,7 +75,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   ShareDirectoryClient::ShareDirectoryClient(
       const std::string& shareDirectoryUrl,
       const ShareClientOptions& options)
-      : m_shareDirectoryUrl(shareDirectoryUrl)
+      : m_shareDirectoryUrl(shareDirectoryUrl), m_transferScheduler(options.TransferScheduler),
+        m_bufferPool(options.BufferPool), m_listingCache(options.ListingCache)
   {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
@@ -86,14 +96,24 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   {
     auto builder = m_shareDirectoryUrl;
     builder.AppendPath(_internal::UrlEncodePath(subdirectoryName));
-    return ShareDirectoryClient(builder, m_pipeline);
+    return ShareDirectoryClient(
+        std::move(builder),
+        m_pipeline,
+        m_transferScheduler,
+        m_bufferPool,
+        m_listingCache);
   }
 
   ShareFileClient ShareDirectoryClient::GetFileClient(const std::string& fileName) const
   {
     auto builder = m_shareDirectoryUrl;
     builder.AppendPath(_internal::UrlEncodePath(fileName));
-    return ShareFileClient(builder, m_pipeline);
+    return ShareFileClient(
+        std::move(builder),
+        m_pipeline,
+        m_transferScheduler,
+        m_bufferPool,
+        m_listingCache);
   }
 
   ShareDirectoryClient ShareDirectoryClient::WithShareSnapshot(
@@ -155,6 +175,10 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     }
     auto result = _detail::ShareRestClient::Directory::Create(
         m_shareDirectoryUrl, *m_pipeline, context, protocolLayerOptions);
+    if (m_listingCache)
+    {
+      m_listingCache->Remove(_detail::GetParentDirectoryUrl(m_shareDirectoryUrl));
+    }
     Models::CreateDirectoryResult ret;
     ret.Created = true;
     ret.ETag = std::move(result.Value.ETag);
@@ -196,6 +220,11 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     auto protocolLayerOptions = _detail::ShareRestClient::Directory::DeleteOptions();
     auto result = _detail::ShareRestClient::Directory::Delete(
         m_shareDirectoryUrl, *m_pipeline, context, protocolLayerOptions);
+    if (m_listingCache)
+    {
+      m_listingCache->Remove(m_shareDirectoryUrl.GetAbsoluteUrl());
+      m_listingCache->Remove(_detail::GetParentDirectoryUrl(m_shareDirectoryUrl));
+    }
     Models::DeleteDirectoryResult ret;
     ret.Deleted = true;
     return Azure::Response<Models::DeleteDirectoryResult>(
@@ -290,6 +319,68 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   ListFilesAndDirectoriesPagedResponse ShareDirectoryClient::ListFilesAndDirectories(
       const ListFilesAndDirectoriesOptions& options,
       const Azure::Core::Context& context) const
+  {
+    // The pages after the first one are never cached, a cached listing has a single page.
+    if (!m_listingCache
+        || (options.ContinuationToken.HasValue() && !options.ContinuationToken.Value().empty()))
+    {
+      return ListFilesAndDirectoriesSinglePage(options, context);
+    }
+
+    auto properties = GetProperties(GetDirectoryPropertiesOptions(), context);
+    std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse
+        = std::move(properties.RawResponse);
+    const std::string directoryUrl = m_shareDirectoryUrl.GetAbsoluteUrl();
+    const std::string prefix = options.Prefix.ValueOr(std::string());
+    auto listing = m_listingCache->Get(directoryUrl, prefix, properties.Value.ETag);
+    if (!listing)
+    {
+      // Listed after the ETag was got, so a change made meanwhile is listed again next time.
+      auto newListing = std::make_shared<Models::DirectoryListing>();
+      newListing->ETag = properties.Value.ETag;
+      newListing->Prefix = prefix;
+      for (auto page = ListFilesAndDirectoriesSinglePage(options, context); page.HasPage();
+           page.MoveToNextPage(context))
+      {
+        newListing->ServiceEndpoint = std::move(page.ServiceEndpoint);
+        newListing->ShareName = std::move(page.ShareName);
+        newListing->ShareSnapshot = std::move(page.ShareSnapshot);
+        newListing->DirectoryPath = std::move(page.DirectoryPath);
+        newListing->Directories.insert(
+            newListing->Directories.end(),
+            std::make_move_iterator(page.Directories.begin()),
+            std::make_move_iterator(page.Directories.end()));
+        newListing->Files.insert(
+            newListing->Files.end(),
+            std::make_move_iterator(page.Files.begin()),
+            std::make_move_iterator(page.Files.end()));
+        rawResponse = std::move(page.RawResponse);
+      }
+      m_listingCache->Set(directoryUrl, newListing);
+      listing = std::move(newListing);
+    }
+
+    ListFilesAndDirectoriesPagedResponse pagedResponse;
+
+    pagedResponse.ServiceEndpoint = listing->ServiceEndpoint;
+    pagedResponse.ShareName = listing->ShareName;
+    pagedResponse.ShareSnapshot = listing->ShareSnapshot;
+    pagedResponse.DirectoryPath = listing->DirectoryPath;
+    pagedResponse.Prefix = listing->Prefix;
+    pagedResponse.Directories = listing->Directories;
+    pagedResponse.Files = listing->Files;
+    pagedResponse.m_shareDirectoryClient = std::make_shared<ShareDirectoryClient>(*this);
+    pagedResponse.m_operationOptions = options;
+    pagedResponse.CurrentPageToken = std::string();
+    pagedResponse.NextPageToken = std::string();
+    pagedResponse.RawResponse = std::move(rawResponse);
+
+    return pagedResponse;
+  }
+
+  ListFilesAndDirectoriesPagedResponse ShareDirectoryClient::ListFilesAndDirectoriesSinglePage(
+      const ListFilesAndDirectoriesOptions& options,
+      const Azure::Core::Context& context) const
   {
     auto protocolLayerOptions
         = _detail::ShareRestClient::Directory::ListFilesAndDirectoriesSinglePageOptions();
@@ -314,7 +405,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     pagedResponse.m_shareDirectoryClient = std::make_shared<ShareDirectoryClient>(*this);
     pagedResponse.m_operationOptions = options;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken;
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
     pagedResponse.RawResponse = std::move(response.RawResponse);
 
     return pagedResponse;
@@ -340,7 +431,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     pagedResponse.m_shareDirectoryClient = std::make_shared<ShareDirectoryClient>(*this);
     pagedResponse.m_operationOptions = options;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken;
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
     pagedResponse.RawResponse = std::move(response.RawResponse);
 
     return pagedResponse;
@@ -382,10 +473,215 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     pagedResponse.m_shareDirectoryClient = std::make_shared<ShareDirectoryClient>(*this);
     pagedResponse.m_operationOptions = options;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken.ValueOr(std::string());
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken).ValueOr(std::string());
     pagedResponse.RawResponse = std::move(response.RawResponse);
 
     return pagedResponse;
   }
 
+  Models::ForceCloseAllHandlesParallelResult ShareDirectoryClient::ForceCloseAllHandlesParallel(
+      const ForceCloseAllHandlesParallelOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    Models::ForceCloseAllHandlesParallelResult result;
+    std::mutex resultMutex;
+    _internal::TaskQueue tasks;
+
+    auto addPage = [&](int32_t numberOfHandlesClosed, int32_t numberOfHandlesFailedToClose) {
+      std::lock_guard<std::mutex> guard(resultMutex);
+      result.NumberOfHandlesClosed += numberOfHandlesClosed;
+      result.NumberOfHandlesFailedToClose += numberOfHandlesFailedToClose;
+      if (options.ProgressHandler)
+      {
+        options.ProgressHandler(result.NumberOfHandlesClosed, result.NumberOfHandlesFailedToClose);
+      }
+    };
+    auto closeDirectoryHandles = [&](const ShareDirectoryClient& directoryClient, bool recursive) {
+      ForceCloseAllDirectoryHandlesOptions closeOptions;
+      closeOptions.Recursive = recursive;
+      for (auto page = directoryClient.ForceCloseAllHandles(closeOptions, context); page.HasPage();
+           page.MoveToNextPage(context))
+      {
+        addPage(page.NumberOfHandlesClosed, page.NumberOfHandlesFailedToClose);
+      }
+    };
+
+    // Above the fan out depth, a directory is listed and its children are closed separately.
+    std::function<void(const ShareDirectoryClient&, int32_t)> closeSubtree;
+    closeSubtree = [&](const ShareDirectoryClient& directoryClient, int32_t depth) {
+      if (depth >= options.FanOutDepth)
+      {
+        closeDirectoryHandles(directoryClient, true);
+        return;
+      }
+      closeDirectoryHandles(directoryClient, false);
+      for (auto page = directoryClient.ListFilesAndDirectories(
+               ListFilesAndDirectoriesOptions(), context);
+           page.HasPage();
+           page.MoveToNextPage(context))
+      {
+        for (const auto& directory : page.Directories)
+        {
+          auto subdirectoryClient = directoryClient.GetSubdirectoryClient(directory.Name);
+          tasks.Push(
+              [&, subdirectoryClient, depth]() { closeSubtree(subdirectoryClient, depth + 1); },
+              depth + 1 < options.FanOutDepth);
+        }
+        for (const auto& file : page.Files)
+        {
+          auto fileClient = directoryClient.GetFileClient(file.Name);
+          tasks.Push([&, fileClient]() {
+            for (auto filePage = fileClient.ForceCloseAllHandles(
+                     ForceCloseAllFileHandlesOptions(), context);
+                 filePage.HasPage();
+                 filePage.MoveToNextPage(context))
+            {
+              addPage(filePage.NumberOfHandlesClosed, filePage.NumberOfHandlesFailedToClose);
+            }
+          });
+        }
+      }
+    };
+
+    tasks.Push([&]() { closeSubtree(*this, 0); }, true);
+    tasks.Run(options.Concurrency);
+
+    return result;
+  }
+
+  ShareDirectoryClient ShareDirectoryClient::WithSharedTransferScheduler(
+      int32_t concurrency) const
+  {
+    ShareDirectoryClient newClient(*this);
+    if (!newClient.m_transferScheduler)
+    {
+      TransferSchedulerOptions schedulerOptions;
+      schedulerOptions.MaxConcurrentChunks = std::max(concurrency, 1);
+      newClient.m_transferScheduler = std::make_shared<TransferScheduler>(schedulerOptions);
+    }
+    return newClient;
+  }
+
+  Models::DownloadDirectoryToResult ShareDirectoryClient::DownloadTo(
+      const std::string& localDirectoryName,
+      const DownloadDirectoryToOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    const auto operationClient = WithSharedTransferScheduler(options.TransferOptions.Concurrency);
+
+    DownloadFileToOptions fileOptions;
+    fileOptions.TransferOptions.InitialChunkSize = options.TransferOptions.InitialChunkSize;
+    fileOptions.TransferOptions.ChunkSize = options.TransferOptions.ChunkSize;
+    fileOptions.TransferOptions.Concurrency = options.TransferOptions.Concurrency;
+
+    Models::DownloadDirectoryToResult result;
+    std::mutex resultMutex;
+    _internal::TaskQueue tasks;
+
+    // Lists a directory, relative to this one, once it's created under localDirectoryName.
+    std::function<void(const std::string&)> downloadDirectory;
+    downloadDirectory = [&](const std::string& relativePath) {
+      const auto directoryClient = relativePath.empty()
+          ? operationClient
+          : operationClient.GetSubdirectoryClient(relativePath);
+      for (auto page = directoryClient.ListFilesAndDirectories(
+               ListFilesAndDirectoriesOptions(), context);
+           page.HasPage();
+           page.MoveToNextPage(context))
+      {
+        for (const auto& directory : page.Directories)
+        {
+          std::string directoryPath
+              = relativePath.empty() ? directory.Name : relativePath + "/" + directory.Name;
+          tasks.Push(
+              [&, directoryPath]() {
+                _internal::CreateLocalDirectories(localDirectoryName + "/" + directoryPath);
+                {
+                  std::lock_guard<std::mutex> guard(resultMutex);
+                  ++result.NumberOfDirectories;
+                }
+                downloadDirectory(directoryPath);
+              },
+              true);
+        }
+        for (const auto& file : page.Files)
+        {
+          std::string filePath = relativePath.empty() ? file.Name : relativePath + "/" + file.Name;
+          tasks.Push([&, filePath]() {
+            auto fileResult = operationClient.GetFileClient(filePath).DownloadTo(
+                localDirectoryName + "/" + filePath, fileOptions, context);
+            std::lock_guard<std::mutex> guard(resultMutex);
+            ++result.NumberOfFiles;
+            result.DownloadedSize += fileResult.Value.FileSize;
+          });
+        }
+      }
+    };
+
+    _internal::CreateLocalDirectories(localDirectoryName);
+    tasks.Push([&]() { downloadDirectory(std::string()); }, true);
+    tasks.Run(options.TransferOptions.Concurrency);
+
+    return result;
+  }
+
+  Models::UploadDirectoryFromResult ShareDirectoryClient::UploadFrom(
+      const std::string& localDirectoryName,
+      const UploadDirectoryFromOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    const auto operationClient = WithSharedTransferScheduler(options.TransferOptions.Concurrency);
+
+    UploadFileFromOptions fileOptions;
+    fileOptions.TransferOptions.SingleUploadThreshold
+        = options.TransferOptions.SingleUploadThreshold;
+    fileOptions.TransferOptions.ChunkSize = options.TransferOptions.ChunkSize;
+    fileOptions.TransferOptions.Concurrency = options.TransferOptions.Concurrency;
+
+    Models::UploadDirectoryFromResult result;
+    std::mutex resultMutex;
+    _internal::TaskQueue tasks;
+
+    // Lists a local directory, relative to localDirectoryName, once it's created in this
+    // directory.
+    std::function<void(const std::string&)> uploadDirectory;
+    uploadDirectory = [&](const std::string& relativePath) {
+      const std::string localPath
+          = relativePath.empty() ? localDirectoryName : localDirectoryName + "/" + relativePath;
+      for (const auto& entry : _internal::ListLocalDirectory(localPath))
+      {
+        std::string entryPath = relativePath.empty() ? entry.Name : relativePath + "/" + entry.Name;
+        if (entry.IsDirectory)
+        {
+          tasks.Push(
+              [&, entryPath]() {
+                operationClient.GetSubdirectoryClient(entryPath).CreateIfNotExists(
+                    CreateDirectoryOptions(), context);
+                {
+                  std::lock_guard<std::mutex> guard(resultMutex);
+                  ++result.NumberOfDirectories;
+                }
+                uploadDirectory(entryPath);
+              },
+              true);
+          continue;
+        }
+        const int64_t fileSize = entry.Size;
+        tasks.Push([&, entryPath, fileSize]() {
+          operationClient.GetFileClient(entryPath).UploadFrom(
+              localDirectoryName + "/" + entryPath, fileOptions, context);
+          std::lock_guard<std::mutex> guard(resultMutex);
+          ++result.NumberOfFiles;
+          result.UploadedSize += fileSize;
+        });
+      }
+    };
+
+    operationClient.CreateIfNotExists(CreateDirectoryOptions(), context);
+    tasks.Push([&]() { uploadDirectory(std::string()); }, true);
+    tasks.Run(options.TransferOptions.Concurrency);
+
+    return result;
+  }
+
 }}}} // namespace Azure::Storage::Files::Shares
@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/files/shares/share_directory_listing_cache.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace Azure { namespace Storage { namespace Files { namespace Shares {
+
+  struct ShareDirectoryListingCache::Shard final
+  {
+    struct Listing final
+    {
+      std::shared_ptr<const Models::DirectoryListing> Value;
+      std::chrono::steady_clock::time_point ExpiresOn;
+    };
+
+    struct Entry final
+    {
+      std::string DirectoryUrl;
+      // The listings of the directory, by prefix.
+      std::map<std::string, Listing> Listings;
+    };
+
+    std::mutex Mutex;
+    // The entries used most recently come first.
+    std::list<Entry> Entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> Index;
+  };
+
+  ShareDirectoryListingCache::ShareDirectoryListingCache(ShareDirectoryListingCacheOptions options)
+      : m_options(std::move(options))
+  {
+    const size_t shardCount = std::max<size_t>(m_options.ShardCount, 1);
+    m_shardCapacity = std::max<size_t>((m_options.Capacity + shardCount - 1) / shardCount, 1);
+    for (size_t i = 0; i < shardCount; ++i)
+    {
+      m_shards.push_back(std::make_unique<Shard>());
+    }
+  }
+
+  ShareDirectoryListingCache::~ShareDirectoryListingCache() = default;
+
+  ShareDirectoryListingCache::Shard& ShareDirectoryListingCache::GetShard(
+      const std::string& directoryUrl)
+  {
+    return *m_shards[std::hash<std::string>()(directoryUrl) % m_shards.size()];
+  }
+
+  std::shared_ptr<const Models::DirectoryListing> ShareDirectoryListingCache::Get(
+      const std::string& directoryUrl,
+      const std::string& prefix,
+      const Azure::ETag& eTag)
+  {
+    auto& shard = GetShard(directoryUrl);
+    std::lock_guard<std::mutex> guard(shard.Mutex);
+    auto ite = shard.Index.find(directoryUrl);
+    if (ite == shard.Index.end())
+    {
+      return nullptr;
+    }
+    auto& listings = ite->second->Listings;
+    auto listingIte = listings.find(prefix);
+    if (listingIte == listings.end())
+    {
+      return nullptr;
+    }
+    if (listingIte->second.Value->ETag != eTag
+        || std::chrono::steady_clock::now() >= listingIte->second.ExpiresOn)
+    {
+      listings.erase(listingIte);
+      return nullptr;
+    }
+    shard.Entries.splice(shard.Entries.begin(), shard.Entries, ite->second);
+    return listingIte->second.Value;
+  }
+
+  void ShareDirectoryListingCache::Set(
+      const std::string& directoryUrl,
+      std::shared_ptr<const Models::DirectoryListing> listing)
+  {
+    if (m_options.MaxAge <= std::chrono::milliseconds::zero())
+    {
+      return;
+    }
+    const std::string prefix = listing->Prefix;
+    Shard::Listing newListing{
+        std::move(listing), std::chrono::steady_clock::now() + m_options.MaxAge};
+
+    auto& shard = GetShard(directoryUrl);
+    std::lock_guard<std::mutex> guard(shard.Mutex);
+    auto ite = shard.Index.find(directoryUrl);
+    if (ite == shard.Index.end())
+    {
+      if (shard.Entries.size() >= m_shardCapacity)
+      {
+        shard.Index.erase(shard.Entries.back().DirectoryUrl);
+        shard.Entries.pop_back();
+      }
+      shard.Entries.push_front(Shard::Entry{directoryUrl, {}});
+      ite = shard.Index.emplace(directoryUrl, shard.Entries.begin()).first;
+    }
+    else
+    {
+      shard.Entries.splice(shard.Entries.begin(), shard.Entries, ite->second);
+    }
+    ite->second->Listings[prefix] = std::move(newListing);
+  }
+
+  void ShareDirectoryListingCache::Remove(const std::string& directoryUrl)
+  {
+    auto& shard = GetShard(directoryUrl);
+    std::lock_guard<std::mutex> guard(shard.Mutex);
+    auto ite = shard.Index.find(directoryUrl);
+    if (ite != shard.Index.end())
+    {
+      shard.Entries.erase(ite->second);
+      shard.Index.erase(ite);
+    }
+  }
+
+}}}} // namespace Azure::Storage::Files::Shares
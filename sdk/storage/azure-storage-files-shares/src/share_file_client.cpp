@@ -3,6 +3,10 @@
 
 #include "azure/storage/files/shares/share_file_client.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
 #include <azure/core/credentials/credentials.hpp>
 #include <azure/core/http/policies/policy.hpp>
 #include <azure/core/internal/io/null_body_stream.hpp>
@@ -18,11 +22,111 @@
 #include <azure/storage/common/storage_common.hpp>
 
 #include "azure/storage/files/shares/share_constants.hpp"
+#include "azure/storage/files/shares/share_directory_listing_cache.hpp"
 
 #include "private/package_version.hpp"
 
 namespace Azure { namespace Storage { namespace Files { namespace Shares {
 
+  namespace {
+    // The largest range a Put Range request writes.
+    constexpr int64_t MaxUploadRangeSize = 4 * 1024 * 1024;
+
+    // Bounds of the chunk size of adaptive transfers, unless the configured chunk size is outside.
+    constexpr int64_t MinAdaptiveChunkSize = 1 * 1024 * 1024;
+    constexpr int64_t MaxAdaptiveDownloadChunkSize = 256 * 1024 * 1024;
+
+    // The size of the buffer a chunk is written to the local file through.
+    constexpr int64_t ChunkBufferSize = 4 * 1024 * 1024;
+
+    // Appends the ranges, clamped to the file size, split into chunks of at most chunkSize bytes.
+    // Returns their total length.
+    int64_t SplitIntoChunks(
+        const std::vector<Core::Http::HttpRange>& ranges,
+        int64_t fileSize,
+        int64_t chunkSize,
+        std::vector<Core::Http::HttpRange>& chunks)
+    {
+      chunkSize = std::max<int64_t>(chunkSize, 1);
+      int64_t totalLength = 0;
+      for (const auto& range : ranges)
+      {
+        const int64_t rangeEnd = std::min(range.Offset + range.Length.Value(), fileSize);
+        for (int64_t offset = range.Offset; offset < rangeEnd; offset += chunkSize)
+        {
+          Core::Http::HttpRange chunk;
+          chunk.Offset = offset;
+          chunk.Length = std::min(chunkSize, rangeEnd - offset);
+          chunks.push_back(chunk);
+          totalLength += chunk.Length.Value();
+        }
+      }
+      return totalLength;
+    }
+
+    // Downloads the chunks in parallel, each to its offset in the local file. The service doesn't
+    // take If-Match on downloads, so the ETag of each chunk is checked instead.
+    void DownloadChunksTo(
+        const ShareFileClient& client,
+        _internal::FileWriter& fileWriter,
+        const std::vector<Core::Http::HttpRange>& chunks,
+        const Azure::ETag& eTag,
+        const LeaseAccessConditions& accessConditions,
+        int32_t concurrency,
+        const std::shared_ptr<BufferPool>& bufferPool,
+        TransferScheduler* scheduler,
+        const Azure::Core::Context& context)
+    {
+      auto downloadChunkFunc = [&](int64_t chunkId,
+                                   int64_t,
+                                   int64_t,
+                                   int64_t,
+                                   const Azure::Core::Context& chunkContext) {
+        const auto& chunk = chunks[static_cast<size_t>(chunkId)];
+        DownloadFileOptions chunkOptions;
+        chunkOptions.Range = chunk;
+        chunkOptions.AccessConditions = accessConditions;
+        auto download = client.Download(chunkOptions, chunkContext);
+        if (download.Value.Details.ETag != eTag)
+        {
+          throw Azure::Core::RequestFailedException(
+              "File was modified in the middle of download.");
+        }
+
+        _internal::PooledBuffer buffer(
+            bufferPool, static_cast<size_t>(std::min(chunk.Length.Value(), ChunkBufferSize)));
+        int64_t offset = chunk.Offset;
+        int64_t length = chunk.Length.Value();
+        while (length > 0)
+        {
+          const size_t readSize = static_cast<size_t>(
+              std::min<int64_t>(static_cast<int64_t>(buffer.GetSize()), length));
+          if (download.Value.BodyStream->ReadToCount(buffer.GetData(), readSize, chunkContext)
+              != readSize)
+          {
+            throw Azure::Core::RequestFailedException("Error when reading body stream.");
+          }
+          fileWriter.Write(buffer.GetData(), readSize, offset);
+          offset += readSize;
+          length -= readSize;
+        }
+      };
+
+      if (!chunks.empty())
+      {
+        _internal::ConcurrentTransfer(
+            0,
+            static_cast<int64_t>(chunks.size()),
+            1,
+            concurrency,
+            downloadChunkFunc,
+            context,
+            scheduler,
+            _internal::GetTransferThreadPool(bufferPool));
+      }
+    }
+  } // namespace
+
   ShareFileClient ShareFileClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& shareName,
@@ -49,7 +153,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const std::string& shareFileUrl,
       std::shared_ptr<StorageSharedKeyCredential> credential,
       const ShareClientOptions& options)
-      : m_shareFileUrl(shareFileUrl)
+      : m_shareFileUrl(shareFileUrl), m_transferScheduler(options.TransferScheduler),
+        m_bufferPool(options.BufferPool), m_listingCache(options.ListingCache)
   {
     ShareClientOptions newOptions = options;
     newOptions.PerRetryPolicies.emplace_back(
@@ -71,7 +176,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   ShareFileClient::ShareFileClient(
       const std::string& shareFileUrl,
       const ShareClientOptions& options)
-      : m_shareFileUrl(shareFileUrl)
+      : m_shareFileUrl(shareFileUrl), m_transferScheduler(options.TransferScheduler),
+        m_bufferPool(options.BufferPool), m_listingCache(options.ListingCache)
   {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
@@ -174,6 +280,10 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     protocolLayerOptions.LeaseIdOptional = options.AccessConditions.LeaseId;
     auto result = _detail::ShareRestClient::File::Create(
         m_shareFileUrl, *m_pipeline, context, protocolLayerOptions);
+    if (m_listingCache)
+    {
+      m_listingCache->Remove(_detail::GetParentDirectoryUrl(m_shareFileUrl));
+    }
     Models::CreateFileResult ret;
     ret.Created = true;
     ret.ETag = std::move(result.Value.ETag);
@@ -192,6 +302,10 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     protocolLayerOptions.LeaseIdOptional = options.AccessConditions.LeaseId;
     auto result = _detail::ShareRestClient::File::Delete(
         m_shareFileUrl, *m_pipeline, context, protocolLayerOptions);
+    if (m_listingCache)
+    {
+      m_listingCache->Remove(_detail::GetParentDirectoryUrl(m_shareFileUrl));
+    }
     Models::DeleteFileResult ret;
     ret.Deleted = true;
     return Azure::Response<Models::DeleteFileResult>(std::move(ret), std::move(result.RawResponse));
@@ -279,6 +393,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
 
       _internal::ReliableStreamOptions reliableStreamOptions;
       reliableStreamOptions.MaxRetryRequests = _internal::ReliableStreamRetryCount;
+      reliableStreamOptions.MinBytesPerSecond = _internal::ReliableStreamMinBytesPerSecond;
       downloadResponse.Value.BodyStream = std::make_unique<_internal::ReliableStream>(
           std::move(downloadResponse.Value.BodyStream), reliableStreamOptions, retryFunction);
     }
@@ -363,6 +478,10 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     protocolLayerOptions.LeaseIdOptional = options.AccessConditions.LeaseId;
     auto response = _detail::ShareRestClient::File::StartCopy(
         m_shareFileUrl, *m_pipeline, context, protocolLayerOptions);
+    if (m_listingCache)
+    {
+      m_listingCache->Remove(_detail::GetParentDirectoryUrl(m_shareFileUrl));
+    }
 
     StartFileCopyOperation res;
     res.m_rawResponse = std::move(response.RawResponse);
@@ -597,7 +716,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     pagedResponse.m_shareFileClient = std::make_shared<ShareFileClient>(*this);
     pagedResponse.m_operationOptions = options;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken;
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
     pagedResponse.RawResponse = std::move(response.RawResponse);
 
     return pagedResponse;
@@ -637,7 +756,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     pagedResponse.m_shareFileClient = std::make_shared<ShareFileClient>(*this);
     pagedResponse.m_operationOptions = options;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken.ValueOr(std::string());
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken).ValueOr(std::string());
     pagedResponse.RawResponse = std::move(response.RawResponse);
 
     return pagedResponse;
@@ -653,7 +772,9 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     // thing in one shot. If it's a large file, we'll get its full size in Content-Range and can
     // keep downloading it in chunks.
     int64_t firstChunkOffset = options.Range.HasValue() ? options.Range.Value().Offset : 0;
-    int64_t firstChunkLength = options.TransferOptions.InitialChunkSize;
+    const bool adaptive = options.TransferOptions.Strategy == TransferStrategy::Adaptive;
+    int64_t firstChunkLength
+        = adaptive ? options.TransferOptions.ChunkSize : options.TransferOptions.InitialChunkSize;
 
     if (options.Range.HasValue() && options.Range.Value().Length.HasValue())
     {
@@ -667,6 +788,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       firstChunkOptions.Range.Value().Length = firstChunkLength;
     }
 
+    const auto firstChunkStart = std::chrono::steady_clock::now();
     auto firstChunk = Download(firstChunkOptions, context);
     const Azure::ETag etag = firstChunk.Value.Details.ETag;
 
@@ -702,6 +824,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       throw Azure::Core::RequestFailedException("Error when reading body stream.");
     }
     firstChunk.Value.BodyStream.reset();
+    const auto firstChunkDuration = std::chrono::steady_clock::now() - firstChunkStart;
 
     auto returnTypeConverter = [](Azure::Response<Models::DownloadFileResult>& response) {
       Models::DownloadFileToResult ret;
@@ -714,42 +837,67 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     auto ret = returnTypeConverter(firstChunk);
 
     // Keep downloading the remaining in parallel
-    auto downloadChunkFunc
-        = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-            DownloadFileOptions chunkOptions;
-            chunkOptions.Range = Core::Http::HttpRange();
-            chunkOptions.Range.Value().Offset = offset;
-            chunkOptions.Range.Value().Length = length;
-            auto chunk = Download(chunkOptions, context);
-            int64_t bytesRead = chunk.Value.BodyStream->ReadToCount(
-                buffer + (offset - firstChunkOffset),
-                static_cast<size_t>(chunkOptions.Range.Value().Length.Value()),
-                context);
-            if (bytesRead != chunkOptions.Range.Value().Length.Value())
-            {
-              throw Azure::Core::RequestFailedException("Error when reading body stream.");
-            }
-            if (chunk.Value.Details.ETag != etag)
-            {
-              throw Azure::Core::RequestFailedException(
-                  "File was modified in the middle of download.");
-            }
-
-            if (chunkId == numChunks - 1)
-            {
-              ret = returnTypeConverter(chunk);
-            }
-          };
+    auto downloadChunkFunc = [&](int64_t offset,
+                                 int64_t length,
+                                 int64_t chunkId,
+                                 int64_t numChunks,
+                                 const Azure::Core::Context& chunkContext) {
+      DownloadFileOptions chunkOptions;
+      chunkOptions.Range = Core::Http::HttpRange();
+      chunkOptions.Range.Value().Offset = offset;
+      chunkOptions.Range.Value().Length = length;
+      auto chunk = Download(chunkOptions, chunkContext);
+      int64_t bytesRead = chunk.Value.BodyStream->ReadToCount(
+          buffer + (offset - firstChunkOffset),
+          static_cast<size_t>(chunkOptions.Range.Value().Length.Value()),
+          chunkContext);
+      if (bytesRead != chunkOptions.Range.Value().Length.Value())
+      {
+        throw Azure::Core::RequestFailedException("Error when reading body stream.");
+      }
+      if (chunk.Value.Details.ETag != etag)
+      {
+        throw Azure::Core::RequestFailedException("File was modified in the middle of download.");
+      }
+
+      if (chunkId == numChunks - 1)
+      {
+        ret = returnTypeConverter(chunk);
+      }
+    };
 
     int64_t remainingOffset = firstChunkOffset + firstChunkLength;
     int64_t remainingSize = fileRangeSize - firstChunkLength;
 
-    _internal::ConcurrentTransfer(
-        remainingOffset,
-        remainingSize,
-        options.TransferOptions.ChunkSize,
-        options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+    if (adaptive)
+    {
+      _internal::AdaptiveChunkController controller(
+          options.TransferOptions.ChunkSize,
+          std::min(options.TransferOptions.ChunkSize, MinAdaptiveChunkSize),
+          std::max(options.TransferOptions.ChunkSize, MaxAdaptiveDownloadChunkSize),
+          options.TransferOptions.Concurrency);
+      controller.OnChunkTransferred(firstChunkLength, firstChunkDuration);
+      _internal::AdaptiveConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          controller,
+          downloadChunkFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    else
+    {
+      _internal::ConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          options.TransferOptions.ChunkSize,
+          options.TransferOptions.Concurrency,
+          downloadChunkFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = fileRangeSize;
     return ret;
@@ -764,7 +912,9 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     // thing in one shot. If it's a large file, we'll get its full size in Content-Range and can
     // keep downloading it in chunks.
     int64_t firstChunkOffset = options.Range.HasValue() ? options.Range.Value().Offset : 0;
-    int64_t firstChunkLength = options.TransferOptions.InitialChunkSize;
+    const bool adaptive = options.TransferOptions.Strategy == TransferStrategy::Adaptive;
+    int64_t firstChunkLength
+        = adaptive ? options.TransferOptions.ChunkSize : options.TransferOptions.InitialChunkSize;
     if (options.Range.HasValue() && options.Range.Value().Length.HasValue())
     {
       firstChunkLength = std::min(firstChunkLength, options.Range.Value().Length.Value());
@@ -779,6 +929,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
 
     _internal::FileWriter fileWriter(fileName);
 
+    const auto firstChunkStart = std::chrono::steady_clock::now();
     auto firstChunk = Download(firstChunkOptions, context);
     const Azure::ETag etag = firstChunk.Value.Details.ETag;
 
@@ -800,22 +951,40 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     }
     firstChunkLength = std::min(firstChunkLength, fileRangeSize);
 
-    auto bodyStreamToFile = [](Azure::Core::IO::BodyStream& stream,
-                               _internal::FileWriter& fileWriter,
-                               int64_t offset,
-                               int64_t length,
-                               const Azure::Core::Context& context) {
+    // The chunks are received straight into the mapped file.
+    std::unique_ptr<_internal::WritableFileMapping> fileMapping;
+    if (options.TransferOptions.UseMemoryMappedFile)
+    {
+      fileMapping = std::make_unique<_internal::WritableFileMapping>(fileName, fileRangeSize);
+    }
+
+    auto bodyStreamToFile = [this, &fileMapping](
+                                Azure::Core::IO::BodyStream& stream,
+                                _internal::FileWriter& fileWriter,
+                                int64_t offset,
+                                int64_t length,
+                                const Azure::Core::Context& context) {
+      if (fileMapping)
+      {
+        if (stream.ReadToCount(
+                fileMapping->GetData() + offset, static_cast<size_t>(length), context)
+            != static_cast<size_t>(length))
+        {
+          throw Azure::Core::RequestFailedException("Error when reading body stream.");
+        }
+        return;
+      }
       constexpr size_t bufferSize = 4 * 1024 * 1024;
-      std::vector<uint8_t> buffer(bufferSize);
+      _internal::PooledBuffer buffer(m_bufferPool, bufferSize);
       while (length > 0)
       {
         size_t readSize = static_cast<size_t>(std::min<int64_t>(bufferSize, length));
-        size_t bytesRead = stream.ReadToCount(buffer.data(), readSize, context);
+        size_t bytesRead = stream.ReadToCount(buffer.GetData(), readSize, context);
         if (bytesRead != readSize)
         {
           throw Azure::Core::RequestFailedException("Error when reading body stream.");
         }
-        fileWriter.Write(buffer.data(), bytesRead, offset);
+        fileWriter.Write(buffer.GetData(), bytesRead, offset);
         length -= bytesRead;
         offset += bytesRead;
       }
@@ -823,6 +992,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
 
     bodyStreamToFile(*(firstChunk.Value.BodyStream), fileWriter, 0, firstChunkLength, context);
     firstChunk.Value.BodyStream.reset();
+    const auto firstChunkDuration = std::chrono::steady_clock::now() - firstChunkStart;
 
     auto returnTypeConverter = [](Azure::Response<Models::DownloadFileResult>& response) {
       Models::DownloadFileToResult ret;
@@ -835,45 +1005,159 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     auto ret = returnTypeConverter(firstChunk);
 
     // Keep downloading the remaining in parallel
-    auto downloadChunkFunc
-        = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-            DownloadFileOptions chunkOptions;
-            chunkOptions.Range = Core::Http::HttpRange();
-            chunkOptions.Range.Value().Offset = offset;
-            chunkOptions.Range.Value().Length = length;
-            auto chunk = Download(chunkOptions, context);
-            if (chunk.Value.Details.ETag != etag)
-            {
-              throw Azure::Core::RequestFailedException(
-                  "File was modified in the middle of download.");
-            }
-            bodyStreamToFile(
-                *(chunk.Value.BodyStream),
-                fileWriter,
-                offset - firstChunkOffset,
-                chunkOptions.Range.Value().Length.Value(),
-                context);
-
-            if (chunkId == numChunks - 1)
-            {
-              ret = returnTypeConverter(chunk);
-            }
-          };
+    auto downloadChunkFunc = [&](int64_t offset,
+                                 int64_t length,
+                                 int64_t chunkId,
+                                 int64_t numChunks,
+                                 const Azure::Core::Context& chunkContext) {
+      DownloadFileOptions chunkOptions;
+      chunkOptions.Range = Core::Http::HttpRange();
+      chunkOptions.Range.Value().Offset = offset;
+      chunkOptions.Range.Value().Length = length;
+      auto chunk = Download(chunkOptions, chunkContext);
+      if (chunk.Value.Details.ETag != etag)
+      {
+        throw Azure::Core::RequestFailedException("File was modified in the middle of download.");
+      }
+      bodyStreamToFile(
+          *(chunk.Value.BodyStream),
+          fileWriter,
+          offset - firstChunkOffset,
+          chunkOptions.Range.Value().Length.Value(),
+          chunkContext);
+
+      if (chunkId == numChunks - 1)
+      {
+        ret = returnTypeConverter(chunk);
+      }
+    };
 
     int64_t remainingOffset = firstChunkOffset + firstChunkLength;
     int64_t remainingSize = fileRangeSize - firstChunkLength;
 
-    _internal::ConcurrentTransfer(
-        remainingOffset,
-        remainingSize,
-        options.TransferOptions.ChunkSize,
-        options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+    if (adaptive)
+    {
+      _internal::AdaptiveChunkController controller(
+          options.TransferOptions.ChunkSize,
+          std::min(options.TransferOptions.ChunkSize, MinAdaptiveChunkSize),
+          std::max(options.TransferOptions.ChunkSize, MaxAdaptiveDownloadChunkSize),
+          options.TransferOptions.Concurrency);
+      controller.OnChunkTransferred(firstChunkLength, firstChunkDuration);
+      _internal::AdaptiveConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          controller,
+          downloadChunkFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    else
+    {
+      _internal::ConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          options.TransferOptions.ChunkSize,
+          options.TransferOptions.Concurrency,
+          downloadChunkFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    fileMapping.reset();
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = fileRangeSize;
     return ret;
   }
 
+  Azure::Response<Models::DownloadSparseFileToResult> ShareFileClient::DownloadSparseTo(
+      const std::string& fileName,
+      const DownloadSparseFileToOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    GetFileRangeListOptions getRangeListOptions;
+    getRangeListOptions.AccessConditions = options.AccessConditions;
+    auto rangeList = GetRangeList(getRangeListOptions, context);
+
+    Models::DownloadSparseFileToResult ret;
+    ret.ETag = rangeList.Value.ETag;
+    ret.LastModified = rangeList.Value.LastModified;
+    ret.FileSize = rangeList.Value.FileSize;
+
+    std::vector<Core::Http::HttpRange> chunks;
+    ret.DownloadedSize = SplitIntoChunks(
+        rangeList.Value.Ranges, ret.FileSize, options.TransferOptions.ChunkSize, chunks);
+
+    _internal::FileWriter fileWriter(fileName);
+    // The ranges not valid are never written, so they remain holes of the file.
+    fileWriter.SetSparseSize(ret.FileSize);
+
+    DownloadChunksTo(
+        *this,
+        fileWriter,
+        chunks,
+        ret.ETag,
+        options.AccessConditions,
+        options.TransferOptions.Concurrency,
+        m_bufferPool,
+        m_transferScheduler.get(),
+        context);
+
+    return Azure::Response<Models::DownloadSparseFileToResult>(
+        std::move(ret), std::move(rangeList.RawResponse));
+  }
+
+  Azure::Response<Models::SyncFileFromSnapshotDiffResult> ShareFileClient::SyncFromSnapshotDiff(
+      const std::string& fileName,
+      const std::string& previousShareSnapshot,
+      const std::string& shareSnapshot,
+      const SyncFileFromSnapshotDiffOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    const ShareFileClient snapshotClient = WithShareSnapshot(shareSnapshot);
+
+    GetFileRangeListOptions getRangeListOptions;
+    getRangeListOptions.AccessConditions = options.AccessConditions;
+    auto rangeList
+        = snapshotClient.GetRangeListDiff(previousShareSnapshot, getRangeListOptions, context);
+
+    Models::SyncFileFromSnapshotDiffResult ret;
+    ret.ETag = rangeList.Value.ETag;
+    ret.LastModified = rangeList.Value.LastModified;
+    ret.FileSize = rangeList.Value.FileSize;
+
+    std::vector<Core::Http::HttpRange> chunks;
+    ret.DownloadedSize = SplitIntoChunks(
+        rangeList.Value.Ranges, ret.FileSize, options.TransferOptions.ChunkSize, chunks);
+
+    _internal::FileWriter fileWriter(fileName, false, false);
+    // The file may have been resized between the snapshots.
+    fileWriter.SetSparseSize(ret.FileSize);
+    for (const auto& range : rangeList.Value.ClearRanges)
+    {
+      const int64_t length = std::min(range.Length.Value(), ret.FileSize - range.Offset);
+      if (length > 0)
+      {
+        fileWriter.Zero(range.Offset, length);
+        ret.ClearedSize += length;
+      }
+    }
+
+    DownloadChunksTo(
+        snapshotClient,
+        fileWriter,
+        chunks,
+        ret.ETag,
+        options.AccessConditions,
+        options.TransferOptions.Concurrency,
+        m_bufferPool,
+        m_transferScheduler.get(),
+        context);
+
+    return Azure::Response<Models::SyncFileFromSnapshotDiffResult>(
+        std::move(ret), std::move(rangeList.RawResponse));
+  }
+
   Azure::Response<Models::UploadFileFromResult> ShareFileClient::UploadFrom(
       const uint8_t* buffer,
       size_t bufferSize,
@@ -949,30 +1233,58 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     auto createResult = _detail::ShareRestClient::File::Create(
         m_shareFileUrl, *m_pipeline, context, protocolLayerOptions);
 
-    auto uploadPageFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
+    auto uploadPageFunc = [&](int64_t offset,
+                              int64_t length,
+                              int64_t chunkId,
+                              int64_t numChunks,
+                              const Azure::Core::Context& chunkContext) {
       (void)chunkId;
       (void)numChunks;
       // TODO: Investigate changing lambda parameters to be size_t, unless they need to be int64_t
       // for some reason.
       Azure::Core::IO::MemoryBodyStream contentStream(buffer + offset, static_cast<size_t>(length));
       UploadFileRangeOptions uploadRangeOptions;
-      UploadRange(offset, contentStream, uploadRangeOptions, context);
+      UploadRange(offset, contentStream, uploadRangeOptions, chunkContext);
     };
 
-    int64_t chunkSize = options.TransferOptions.ChunkSize;
+    int64_t chunkSize = std::min(options.TransferOptions.ChunkSize, MaxUploadRangeSize);
     if (bufferSize < static_cast<size_t>(options.TransferOptions.SingleUploadThreshold))
     {
-      chunkSize = bufferSize;
+      chunkSize = std::min(static_cast<int64_t>(bufferSize), MaxUploadRangeSize);
     }
 
-    if (bufferSize > 0)
+    if (bufferSize > 0 && options.TransferOptions.Strategy == TransferStrategy::Adaptive)
+    {
+      _internal::AdaptiveChunkController controller(
+          chunkSize,
+          std::min(chunkSize, MinAdaptiveChunkSize),
+          MaxUploadRangeSize,
+          options.TransferOptions.Concurrency);
+      _internal::AdaptiveConcurrentTransfer(
+          0,
+          bufferSize,
+          controller,
+          uploadPageFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    else if (bufferSize > 0)
     {
       _internal::ConcurrentTransfer(
-          0, bufferSize, chunkSize, options.TransferOptions.Concurrency, uploadPageFunc);
+          0,
+          bufferSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadPageFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
     }
 
     Models::UploadFileFromResult result;
     result.IsServerEncrypted = createResult.Value.IsServerEncrypted;
+    result.UploadedSize = static_cast<int64_t>(bufferSize);
     return Azure::Response<Models::UploadFileFromResult>(
         std::move(result), std::move(createResult.RawResponse));
   }
@@ -1053,30 +1365,118 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     auto createResult = _detail::ShareRestClient::File::Create(
         m_shareFileUrl, *m_pipeline, context, protocolLayerOptions);
 
-    auto uploadPageFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
+    if (options.TransferOptions.SkipZeroRanges)
+    {
+      // A new file reads as zeros, so only the data ranges are read and their non-zero parts
+      // uploaded.
+      const int64_t chunkSize
+          = std::max<int64_t>(std::min(options.TransferOptions.ChunkSize, MaxUploadRangeSize), 1);
+      std::vector<_internal::FileRange> chunks;
+      for (const auto& range : fileReader.GetDataRanges())
+      {
+        const int64_t rangeEnd = range.Offset + range.Length;
+        for (int64_t offset = range.Offset; offset < rangeEnd; offset += chunkSize)
+        {
+          chunks.push_back(_internal::FileRange{offset, std::min(chunkSize, rangeEnd - offset)});
+        }
+      }
+
+      std::atomic<int64_t> uploadedSize{0};
+      auto uploadChunkFunc = [&](int64_t chunkId,
+                                 int64_t,
+                                 int64_t,
+                                 int64_t,
+                                 const Azure::Core::Context& chunkContext) {
+        const auto& chunk = chunks[static_cast<size_t>(chunkId)];
+        _internal::PooledBuffer buffer(m_bufferPool, static_cast<size_t>(chunk.Length));
+        if (fileReader.Read(buffer.GetData(), static_cast<size_t>(chunk.Length), chunk.Offset)
+            != static_cast<size_t>(chunk.Length))
+        {
+          throw std::runtime_error("Failed to read file.");
+        }
+        std::vector<_internal::FileRange> nonZeroRanges;
+        _internal::FindNonZeroRanges(
+            buffer.GetData(), static_cast<size_t>(chunk.Length), chunk.Offset, nonZeroRanges);
+        for (const auto& range : nonZeroRanges)
+        {
+          Azure::Core::IO::MemoryBodyStream contentStream(
+              buffer.GetData() + (range.Offset - chunk.Offset), static_cast<size_t>(range.Length));
+          UploadRange(range.Offset, contentStream, UploadFileRangeOptions(), chunkContext);
+          uploadedSize += range.Length;
+        }
+      };
+      if (!chunks.empty())
+      {
+        _internal::ConcurrentTransfer(
+            0,
+            static_cast<int64_t>(chunks.size()),
+            1,
+            options.TransferOptions.Concurrency,
+            uploadChunkFunc,
+            context,
+            m_transferScheduler.get(),
+            _internal::GetTransferThreadPool(m_bufferPool));
+      }
+
+      Models::UploadFileFromResult result;
+      result.IsServerEncrypted = createResult.Value.IsServerEncrypted;
+      result.UploadedSize = uploadedSize;
+      return Azure::Response<Models::UploadFileFromResult>(
+          std::move(result), std::move(createResult.RawResponse));
+    }
+
+    auto uploadPageFunc = [&](int64_t offset,
+                              int64_t length,
+                              int64_t chunkId,
+                              int64_t numChunks,
+                              const Azure::Core::Context& chunkContext) {
       (void)chunkId;
       (void)numChunks;
       Azure::Core::IO::_internal::RandomAccessFileBodyStream contentStream(
           fileReader.GetHandle(), offset, length);
       UploadFileRangeOptions uploadRangeOptions;
-      UploadRange(offset, contentStream, uploadRangeOptions, context);
+      UploadRange(offset, contentStream, uploadRangeOptions, chunkContext);
     };
 
     const int64_t fileSize = fileReader.GetFileSize();
-    int64_t chunkSize = options.TransferOptions.ChunkSize;
+    int64_t chunkSize = std::min(options.TransferOptions.ChunkSize, MaxUploadRangeSize);
     if (fileSize < options.TransferOptions.SingleUploadThreshold)
     {
-      chunkSize = fileSize;
+      chunkSize = std::min(fileSize, MaxUploadRangeSize);
     }
 
-    if (fileSize > 0)
+    if (fileSize > 0 && options.TransferOptions.Strategy == TransferStrategy::Adaptive)
+    {
+      _internal::AdaptiveChunkController controller(
+          chunkSize,
+          std::min(chunkSize, MinAdaptiveChunkSize),
+          MaxUploadRangeSize,
+          options.TransferOptions.Concurrency);
+      _internal::AdaptiveConcurrentTransfer(
+          0,
+          fileSize,
+          controller,
+          uploadPageFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+    else if (fileSize > 0)
     {
       _internal::ConcurrentTransfer(
-          0, fileSize, chunkSize, options.TransferOptions.Concurrency, uploadPageFunc);
+          0,
+          fileSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadPageFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
     }
 
     Models::UploadFileFromResult result;
     result.IsServerEncrypted = createResult.Value.IsServerEncrypted;
+    result.UploadedSize = fileSize;
     return Azure::Response<Models::UploadFileFromResult>(
         std::move(result), std::move(createResult.RawResponse));
   }
@@ -1128,4 +1528,74 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     return _detail::ShareRestClient::File::UploadRangeFromUrl(
         m_shareFileUrl, *m_pipeline, context, protocolLayerOptions);
   }
+
+  Azure::Response<Models::CopyFileFromUriParallelResult> ShareFileClient::CopyFromUriParallel(
+      const std::string& sourceUri,
+      const CopyFileFromUriParallelOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    const int64_t chunkSize
+        = std::min(std::max<int64_t>(options.TransferOptions.ChunkSize, 1), MaxUploadRangeSize);
+
+    // The source is authorized by its URI, not by the credential of this client.
+    const ShareFileClient sourceClient(sourceUri);
+    const auto sourceProperties = sourceClient.GetProperties(GetFilePropertiesOptions(), context);
+    const auto sourceRangeList = sourceClient.GetRangeList(GetFileRangeListOptions(), context);
+    const Azure::ETag sourceETag = sourceProperties.Value.ETag;
+    if (sourceRangeList.Value.ETag != sourceETag)
+    {
+      throw Azure::Core::RequestFailedException("Source file was modified in the middle of copy.");
+    }
+
+    Models::CopyFileFromUriParallelResult ret;
+    ret.FileSize = sourceProperties.Value.FileSize;
+
+    CreateFileOptions createOptions;
+    createOptions.Permission = options.Permission;
+    createOptions.SmbProperties = options.SmbProperties;
+    createOptions.HttpHeaders = sourceProperties.Value.HttpHeaders;
+    createOptions.Metadata = sourceProperties.Value.Metadata;
+    createOptions.AccessConditions = options.AccessConditions;
+    Create(ret.FileSize, createOptions, context);
+
+    // Only the valid ranges are copied, the rest of the new file reads as zeros.
+    std::vector<Core::Http::HttpRange> chunks;
+    ret.CopiedSize
+        = SplitIntoChunks(sourceRangeList.Value.Ranges, ret.FileSize, chunkSize, chunks);
+
+    auto copyChunkFunc = [&](int64_t chunkId,
+                             int64_t,
+                             int64_t,
+                             int64_t,
+                             const Azure::Core::Context& chunkContext) {
+      const auto& chunk = chunks[static_cast<size_t>(chunkId)];
+      UploadFileRangeFromUriOptions chunkOptions;
+      chunkOptions.AccessConditions = options.AccessConditions;
+      UploadRangeFromUri(chunk.Offset, sourceUri, chunk, chunkOptions, chunkContext);
+    };
+    if (!chunks.empty())
+    {
+      _internal::ConcurrentTransfer(
+          0,
+          static_cast<int64_t>(chunks.size()),
+          1,
+          options.TransferOptions.Concurrency,
+          copyChunkFunc,
+          context,
+          m_transferScheduler.get(),
+          _internal::GetTransferThreadPool(m_bufferPool));
+    }
+
+    // Ranges can't be copied on the condition of the ETag of the source, so it's checked after.
+    if (sourceClient.GetProperties(GetFilePropertiesOptions(), context).Value.ETag != sourceETag)
+    {
+      throw Azure::Core::RequestFailedException("Source file was modified in the middle of copy.");
+    }
+
+    auto properties = GetProperties(GetFilePropertiesOptions(), context);
+    ret.ETag = std::move(properties.Value.ETag);
+    ret.LastModified = std::move(properties.Value.LastModified);
+    return Azure::Response<Models::CopyFileFromUriParallelResult>(
+        std::move(ret), std::move(properties.RawResponse));
+  }
 }}}} // namespace Azure::Storage::Files::Shares
@@ -39,7 +39,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const std::string& serviceUrl,
       std::shared_ptr<StorageSharedKeyCredential> credential,
       const ShareClientOptions& options)
-      : m_serviceUrl(serviceUrl)
+      : m_serviceUrl(serviceUrl), m_transferScheduler(options.TransferScheduler),
+        m_bufferPool(options.BufferPool), m_listingCache(options.ListingCache)
   {
     ShareClientOptions newOptions = options;
     newOptions.PerRetryPolicies.emplace_back(
@@ -61,7 +62,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   ShareServiceClient::ShareServiceClient(
       const std::string& serviceUrl,
       const ShareClientOptions& options)
-      : m_serviceUrl(serviceUrl)
+      : m_serviceUrl(serviceUrl), m_transferScheduler(options.TransferScheduler),
+        m_bufferPool(options.BufferPool), m_listingCache(options.ListingCache)
   {
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
     std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
@@ -80,7 +82,12 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   {
     auto builder = m_serviceUrl;
     builder.AppendPath(_internal::UrlEncodePath(shareName));
-    return ShareClient(builder, m_pipeline);
+    return ShareClient(
+        std::move(builder),
+        m_pipeline,
+        m_transferScheduler,
+        m_bufferPool,
+        m_listingCache);
   }
 
   ListSharesPagedResponse ShareServiceClient::ListShares(
@@ -105,7 +112,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     pagedResponse.m_shareServiceClient = std::make_shared<ShareServiceClient>(*this);
     pagedResponse.m_operationOptions = options;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken;
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
     pagedResponse.RawResponse = std::move(response.RawResponse);
 
     return pagedResponse;
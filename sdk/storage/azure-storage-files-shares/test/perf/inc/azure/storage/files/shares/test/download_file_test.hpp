@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of downloading a share file.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+#include <azure/perf/random_stream.hpp>
+
+#include "azure/storage/files/shares/test/share_base_test.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Files { namespace Shares { namespace Test {
+
+  /**
+   * @brief A test to measure downloading a file.
+   *
+   */
+  class DownloadFile : public Azure::Storage::Files::Shares::Test::SharesTest {
+  private:
+    std::vector<uint8_t> m_downloadBuffer;
+    Azure::Storage::Files::Shares::DownloadFileToOptions m_downloadOptions;
+
+  public:
+    /**
+     * @brief Construct a new DownloadFile test.
+     *
+     * @param options The test options.
+     */
+    DownloadFile(Azure::Perf::TestOptions options) : SharesTest(options) {}
+
+    /**
+     * @brief The size to upload on setup is defined by a mandatory parameter.
+     *
+     */
+    void Setup() override
+    {
+      // Call base to create file client
+      SharesTest::Setup();
+
+      long size = m_options.GetMandatoryOption<long>("Size");
+      m_downloadBuffer.resize(size);
+
+      auto& transferOptions = m_downloadOptions.TransferOptions;
+      transferOptions.Concurrency
+          = m_options.GetOptionOrDefault("Concurrency", transferOptions.Concurrency);
+      transferOptions.ChunkSize
+          = m_options.GetOptionOrDefault("ChunkSize", transferOptions.ChunkSize);
+      transferOptions.InitialChunkSize
+          = m_options.GetOptionOrDefault("InitialChunkSize", transferOptions.InitialChunkSize);
+
+      auto rawData = Azure::Perf::RandomStream::Create(size)->ReadToEnd(
+          Azure::Core::Context::ApplicationContext);
+      m_fileClient->UploadFrom(rawData.data(), rawData.size());
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_fileClient->DownloadTo(
+          m_downloadBuffer.data(), m_downloadBuffer.size(), m_downloadOptions, context);
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Size", {"--size", "-s"}, "Size of payload (in bytes)", 1, true},
+          {"Concurrency", {"--concurrency"}, "Number of threads of the transfer. Default to 5.", 1},
+          {"ChunkSize", {"--chunk-size"}, "Size of each range request (in bytes).", 1},
+          {"InitialChunkSize",
+           {"--initial-chunk-size"},
+           "Size of the first range request (in bytes). Smaller files are downloaded in a single "
+           "request.",
+           1}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {"DownloadFile", "Download a file.", [](Azure::Perf::TestOptions options) {
+                return std::make_unique<Azure::Storage::Files::Shares::Test::DownloadFile>(
+                    options);
+              }};
+    }
+  };
+
+}}}}} // namespace Azure::Storage::Files::Shares::Test
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Define the base behavior of the tests using a share client.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/uuid.hpp>
+#include <azure/perf.hpp>
+
+#include <azure/storage/files/shares.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Files { namespace Shares { namespace Test {
+
+  /**
+   * @brief A base test that set up a share performance test.
+   *
+   */
+  class SharesTest : public Azure::Perf::PerfTest {
+  protected:
+    std::string m_shareName;
+    std::string m_fileName;
+    std::string m_connectionString;
+    std::unique_ptr<Azure::Storage::Files::Shares::ShareClient> m_shareClient;
+    std::unique_ptr<Azure::Storage::Files::Shares::ShareFileClient> m_fileClient;
+
+  public:
+    /**
+     * @brief Create the share client
+     *
+     */
+    void Setup() override
+    {
+      // Get connection string from env
+      const static std::string envConnectionString = std::getenv("STORAGE_CONNECTION_STRING");
+      m_connectionString = envConnectionString;
+
+      // Generate random share and file names.
+      m_shareName = "share" + Azure::Core::Uuid::CreateUuid().ToString();
+      m_fileName = "file" + Azure::Core::Uuid::CreateUuid().ToString();
+
+      // Create client, share and fileClient
+      m_shareClient = std::make_unique<Azure::Storage::Files::Shares::ShareClient>(
+          Azure::Storage::Files::Shares::ShareClient::CreateFromConnectionString(
+              m_connectionString, m_shareName));
+      m_shareClient->CreateIfNotExists();
+      m_fileClient = std::make_unique<Azure::Storage::Files::Shares::ShareFileClient>(
+          m_shareClient->GetRootDirectoryClient().GetFileClient(m_fileName));
+    }
+
+    void Cleanup() override { m_shareClient->DeleteIfExists(); };
+
+    /**
+     * @brief Construct a new SharesTest test.
+     *
+     * @param options The test options.
+     */
+    SharesTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override { return {}; }
+  };
+
+}}}}} // namespace Azure::Storage::Files::Shares::Test
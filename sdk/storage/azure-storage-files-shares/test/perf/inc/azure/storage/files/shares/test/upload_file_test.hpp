@@ -0,0 +1,103 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of uploading a share file.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+#include <azure/perf/random_stream.hpp>
+
+#include "azure/storage/files/shares/test/share_base_test.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Files { namespace Shares { namespace Test {
+
+  /**
+   * @brief A test to measure uploading a file.
+   *
+   */
+  class UploadFile : public Azure::Storage::Files::Shares::Test::SharesTest {
+  private:
+    std::vector<uint8_t> m_uploadBuffer;
+    Azure::Storage::Files::Shares::UploadFileFromOptions m_uploadOptions;
+
+  public:
+    /**
+     * @brief Construct a new UploadFile test.
+     *
+     * @param options The test options.
+     */
+    UploadFile(Azure::Perf::TestOptions options) : SharesTest(options) {}
+
+    /**
+     * @brief The size to upload is defined by a mandatory parameter.
+     *
+     */
+    void Setup() override
+    {
+      // Call base to create file client
+      SharesTest::Setup();
+
+      long size = m_options.GetMandatoryOption<long>("Size");
+      m_uploadBuffer = Azure::Perf::RandomStream::Create(size)->ReadToEnd(
+          Azure::Core::Context::ApplicationContext);
+
+      auto& transferOptions = m_uploadOptions.TransferOptions;
+      transferOptions.Concurrency
+          = m_options.GetOptionOrDefault("Concurrency", transferOptions.Concurrency);
+      transferOptions.SingleUploadThreshold = m_options.GetOptionOrDefault(
+          "SingleUploadThreshold", transferOptions.SingleUploadThreshold);
+      transferOptions.ChunkSize
+          = m_options.GetOptionOrDefault("ChunkSize", transferOptions.ChunkSize);
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_fileClient->UploadFrom(
+          m_uploadBuffer.data(), m_uploadBuffer.size(), m_uploadOptions, context);
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Size", {"--size", "-s"}, "Size of payload (in bytes)", 1, true},
+          {"Concurrency", {"--concurrency"}, "Number of threads of the transfer. Default to 5.", 1},
+          {"ChunkSize", {"--chunk-size"}, "Size of each uploaded range (in bytes).", 1},
+          {"SingleUploadThreshold",
+           {"--single-upload-threshold"},
+           "Files smaller than this (in bytes) are uploaded in a single request.",
+           1}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {"UploadFile", "Upload a file.", [](Azure::Perf::TestOptions options) {
+                return std::make_unique<Azure::Storage::Files::Shares::Test::UploadFile>(
+                    options);
+              }};
+    }
+  };
+
+}}}}} // namespace Azure::Storage::Files::Shares::Test
@@ -5,6 +5,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <string>
+#include <vector>
+
+#include <azure/storage/common/internal/file_io.hpp>
 
 namespace Azure { namespace Storage { namespace Test {
 
@@ -431,6 +435,39 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(FileShareDirectoryClientTest, ListingCache)
+  {
+    auto listingCache = std::make_shared<Files::Shares::ShareDirectoryListingCache>();
+    Files::Shares::ShareClientOptions clientOptions;
+    clientOptions.ListingCache = listingCache;
+    auto directoryClient = Files::Shares::ShareClient::CreateFromConnectionString(
+                               StandardStorageConnectionString(), m_shareName, clientOptions)
+                               .GetRootDirectoryClient()
+                               .GetSubdirectoryClient(LowercaseRandomString());
+    directoryClient.Create();
+    for (int i = 0; i < 3; ++i)
+    {
+      directoryClient.GetFileClient(LowercaseRandomString()).Create(1024);
+    }
+
+    // All the items are returned in a single page, which is cached.
+    Files::Shares::ListFilesAndDirectoriesOptions listOptions;
+    listOptions.PageSizeHint = 2;
+    auto listing = directoryClient.ListFilesAndDirectories(listOptions);
+    EXPECT_EQ(listing.Files.size(), 3U);
+    EXPECT_FALSE(listing.NextPageToken.HasValue() && !listing.NextPageToken.Value().empty());
+    const auto eTag = directoryClient.GetProperties().Value.ETag;
+    auto cachedListing = listingCache->Get(directoryClient.GetUrl(), std::string(), eTag);
+    ASSERT_NE(cachedListing, nullptr);
+    EXPECT_EQ(cachedListing->Files.size(), 3U);
+    EXPECT_EQ(directoryClient.ListFilesAndDirectories(listOptions).Files.size(), 3U);
+
+    // Creating a file through a client sharing the cache evicts the listing.
+    directoryClient.GetFileClient(LowercaseRandomString()).Create(1024);
+    EXPECT_EQ(listingCache->Get(directoryClient.GetUrl(), std::string(), eTag), nullptr);
+    EXPECT_EQ(directoryClient.ListFilesAndDirectories(listOptions).Files.size(), 4U);
+  }
+
   TEST_F(FileShareDirectoryClientTest, HandlesFunctionalityWorks)
   {
     auto result = m_fileShareDirectoryClient->ListHandles();
@@ -446,4 +483,85 @@ namespace Azure { namespace Storage { namespace Test {
     {
     }
   }
+
+  TEST_F(FileShareDirectoryClientTest, ForceCloseAllHandlesParallel)
+  {
+    auto directoryClient
+        = m_shareClient->GetRootDirectoryClient().GetSubdirectoryClient(LowercaseRandomString());
+    directoryClient.Create();
+    for (int i = 0; i < 2; ++i)
+    {
+      auto subdirectoryClient = directoryClient.GetSubdirectoryClient(LowercaseRandomString());
+      subdirectoryClient.Create();
+      subdirectoryClient.GetFileClient(LowercaseRandomString()).Create(1);
+      directoryClient.GetFileClient(LowercaseRandomString()).Create(1);
+    }
+
+    for (int32_t fanOutDepth : {0, 1, 2})
+    {
+      Files::Shares::ForceCloseAllHandlesParallelOptions options;
+      options.FanOutDepth = fanOutDepth;
+      options.Concurrency = 2;
+      int numProgressCalls = 0;
+      options.ProgressHandler = [&](int64_t, int64_t) { ++numProgressCalls; };
+      auto result = directoryClient.ForceCloseAllHandlesParallel(options);
+      EXPECT_EQ(result.NumberOfHandlesClosed, 0);
+      EXPECT_EQ(result.NumberOfHandlesFailedToClose, 0);
+      EXPECT_GT(numProgressCalls, 0);
+    }
+
+    auto result = m_shareClient->ForceCloseAllHandles();
+    EXPECT_EQ(result.NumberOfHandlesFailedToClose, 0);
+  }
+
+  TEST_F(FileShareDirectoryClientTest, DirectoryUploadDownload)
+  {
+    const std::string localDirectoryName = RandomString();
+    const std::vector<std::string> fileNames
+        = {"small", "nested/small", "nested/leaf/large", "nested/leaf/empty"};
+    const std::vector<size_t> fileSizes = {100, 2000, 3 * 1024 * 1024 + 123, 0};
+    std::vector<std::vector<uint8_t>> fileContents;
+    _internal::CreateLocalDirectories(localDirectoryName + "/nested/leaf");
+    for (size_t i = 0; i < fileNames.size(); ++i)
+    {
+      fileContents.push_back(RandomBuffer(fileSizes[i]));
+      _internal::FileWriter fileWriter(localDirectoryName + "/" + fileNames[i]);
+      fileWriter.Write(fileContents[i].data(), fileContents[i].size(), 0);
+    }
+    const int64_t totalSize = 100 + 2000 + 3 * 1024 * 1024 + 123;
+
+    auto directoryClient
+        = m_shareClient->GetRootDirectoryClient().GetSubdirectoryClient(LowercaseRandomString());
+    Files::Shares::UploadDirectoryFromOptions uploadOptions;
+    uploadOptions.TransferOptions.SingleUploadThreshold = 1024 * 1024;
+    uploadOptions.TransferOptions.ChunkSize = 1024 * 1024;
+    uploadOptions.TransferOptions.Concurrency = 3;
+    auto uploadResult = directoryClient.UploadFrom(localDirectoryName, uploadOptions);
+    EXPECT_EQ(uploadResult.NumberOfDirectories, 2);
+    EXPECT_EQ(uploadResult.NumberOfFiles, 4);
+    EXPECT_EQ(uploadResult.UploadedSize, totalSize);
+
+    const std::string downloadDirectoryName = RandomString();
+    Files::Shares::DownloadDirectoryToOptions downloadOptions;
+    downloadOptions.TransferOptions.InitialChunkSize = 1024 * 1024;
+    downloadOptions.TransferOptions.ChunkSize = 1024 * 1024;
+    downloadOptions.TransferOptions.Concurrency = 3;
+    auto downloadResult = directoryClient.DownloadTo(downloadDirectoryName, downloadOptions);
+    EXPECT_EQ(downloadResult.NumberOfDirectories, 2);
+    EXPECT_EQ(downloadResult.NumberOfFiles, 4);
+    EXPECT_EQ(downloadResult.DownloadedSize, totalSize);
+    for (size_t i = 0; i < fileNames.size(); ++i)
+    {
+      EXPECT_EQ(ReadFile(downloadDirectoryName + "/" + fileNames[i]), fileContents[i]);
+      DeleteFile(downloadDirectoryName + "/" + fileNames[i]);
+      DeleteFile(localDirectoryName + "/" + fileNames[i]);
+    }
+    for (const auto& name : {localDirectoryName, downloadDirectoryName})
+    {
+      DeleteFile(name + "/nested/leaf");
+      DeleteFile(name + "/nested");
+      DeleteFile(name);
+    }
+  }
+
 }}} // namespace Azure::Storage::Test
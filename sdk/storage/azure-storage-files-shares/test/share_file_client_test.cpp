@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <chrono>
 #include <future>
+#include <random>
 
 #include <azure/core/cryptography/hash.hpp>
 #include <azure/storage/common/crypt.hpp>
@@ -398,6 +399,44 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(FileShareFileClientTest, UploadFromSkipZeroRanges)
+  {
+    // A sparse file with data at both ends, a zero block in the data and a short last block.
+    const int64_t fileSize = 9_MB + 100;
+    std::vector<uint8_t> fileContent(static_cast<size_t>(fileSize), '\x00');
+    for (auto range : {std::make_pair(0_KB, 3_KB), std::make_pair(9_MB - 1_KB, 1_KB + 100)})
+    {
+      std::vector<uint8_t> data = RandomBuffer(static_cast<size_t>(range.second));
+      std::copy(data.begin(), data.end(), fileContent.begin() + static_cast<size_t>(range.first));
+    }
+    std::fill(fileContent.begin() + 1024, fileContent.begin() + 1536, uint8_t(0));
+
+    const std::string tempFilename = RandomString();
+    {
+      Azure::Storage::_internal::FileWriter fileWriter(tempFilename);
+      fileWriter.SetSparseSize(fileSize);
+      fileWriter.Write(fileContent.data(), static_cast<size_t>(3_KB), 0);
+      fileWriter.Write(
+          fileContent.data() + static_cast<size_t>(9_MB - 1_KB),
+          static_cast<size_t>(1_KB + 100),
+          static_cast<int64_t>(9_MB - 1_KB));
+    }
+
+    auto fileClient = m_fileShareDirectoryClient->GetFileClient(RandomString());
+    Files::Shares::UploadFileFromOptions options;
+    options.TransferOptions.ChunkSize = 1_MB;
+    options.TransferOptions.Concurrency = 4;
+    options.TransferOptions.SkipZeroRanges = true;
+    auto res = fileClient.UploadFrom(tempFilename, options);
+    EXPECT_EQ(static_cast<uint64_t>(res.Value.UploadedSize), 2_KB + 512 + 1_KB + 100);
+
+    EXPECT_EQ(fileClient.GetProperties().Value.FileSize, fileSize);
+    std::vector<uint8_t> downloadContent(static_cast<size_t>(fileSize));
+    fileClient.DownloadTo(downloadContent.data(), downloadContent.size());
+    EXPECT_EQ(downloadContent, fileContent);
+    DeleteFile(tempFilename);
+  }
+
   TEST_F(FileShareFileClientTest, ConcurrentDownload)
   {
     m_fileContent = RandomBuffer(8 * 1024 * 1024);
@@ -620,6 +659,52 @@ namespace Azure { namespace Storage { namespace Test {
     return instance.Final(reinterpret_cast<const uint8_t*>(data.data()), data.size());
   }
 
+  TEST_F(FileShareFileClientTest, AdaptiveUploadDownload)
+  {
+    std::vector<uint8_t> fileContent = RandomBuffer(static_cast<size_t>(10_MB + 123));
+
+    for (auto strategy : {TransferStrategy::Fixed, TransferStrategy::Adaptive})
+    {
+      auto fileClient = m_fileShareDirectoryClient->GetFileClient(RandomString());
+
+      // Ranges larger than a Put Range request can write are split.
+      Files::Shares::UploadFileFromOptions uploadOptions;
+      uploadOptions.TransferOptions.ChunkSize = 8_MB;
+      uploadOptions.TransferOptions.Concurrency = 4;
+      uploadOptions.TransferOptions.Strategy = strategy;
+      fileClient.UploadFrom(fileContent.data(), fileContent.size(), uploadOptions);
+
+      Files::Shares::DownloadFileToOptions downloadOptions;
+      downloadOptions.TransferOptions.ChunkSize = 1_MB;
+      downloadOptions.TransferOptions.Concurrency = 4;
+      downloadOptions.TransferOptions.Strategy = strategy;
+      std::vector<uint8_t> downloadContent(fileContent.size());
+      auto res = fileClient.DownloadTo(
+          downloadContent.data(), downloadContent.size(), downloadOptions);
+      EXPECT_EQ(res.Value.FileSize, static_cast<int64_t>(fileContent.size()));
+      EXPECT_EQ(downloadContent, fileContent);
+    }
+  }
+
+  TEST_F(FileShareFileClientTest, DownloadToMemoryMappedFile)
+  {
+    const std::string tempFilename = RandomString();
+    Files::Shares::DownloadFileToOptions options;
+    options.Range = Core::Http::HttpRange();
+    options.Range.Value().Offset = 123;
+    options.TransferOptions.InitialChunkSize = 1_MB + 1;
+    options.TransferOptions.ChunkSize = 1_MB - 1;
+    options.TransferOptions.Concurrency = 4;
+    options.TransferOptions.UseMemoryMappedFile = true;
+    auto res = m_fileClient->DownloadTo(tempFilename, options);
+    EXPECT_EQ(
+        res.Value.ContentRange.Length.Value(), static_cast<int64_t>(m_fileContent.size() - 123));
+    EXPECT_EQ(
+        ReadFile(tempFilename),
+        std::vector<uint8_t>(m_fileContent.begin() + 123, m_fileContent.end()));
+    DeleteFile(tempFilename);
+  }
+
   TEST_F(FileShareFileClientTest, RangeUploadDownload)
   {
     auto rangeSize = 1 * 1024 * 1024;
@@ -792,6 +877,73 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_EQ(1536, result.ClearRanges[1].Length.Value());
   }
 
+  TEST_F(FileShareFileClientTest, DownloadSparseTo)
+  {
+    auto fileClient
+        = m_shareClient->GetRootDirectoryClient().GetFileClient(LowercaseRandomString(10));
+    fileClient.Create(64 * 1024);
+    std::vector<uint8_t> fileContent(64 * 1024, '\x00');
+    // Two valid ranges, the second one spans several chunks.
+    for (auto range : {std::make_pair(4 * 1024, 2 * 1024), std::make_pair(32 * 1024, 9 * 1024)})
+    {
+      auto rangeContent = RandomBuffer(static_cast<size_t>(range.second));
+      auto memBodyStream = Core::IO::MemoryBodyStream(rangeContent);
+      fileClient.UploadRange(range.first, memBodyStream);
+      std::copy(rangeContent.begin(), rangeContent.end(), fileContent.begin() + range.first);
+    }
+
+    const std::string tempFilename = RandomString();
+    Files::Shares::DownloadSparseFileToOptions options;
+    options.TransferOptions.ChunkSize = 4 * 1024;
+    options.TransferOptions.Concurrency = 2;
+    auto res = fileClient.DownloadSparseTo(tempFilename, options);
+    EXPECT_EQ(res.Value.FileSize, 64 * 1024);
+    EXPECT_EQ(res.Value.DownloadedSize, 11 * 1024);
+    EXPECT_TRUE(res.Value.ETag.HasValue());
+    EXPECT_EQ(ReadFile(tempFilename), fileContent);
+    DeleteFile(tempFilename);
+  }
+
+  TEST_F(FileShareFileClientTest, SyncFromSnapshotDiff)
+  {
+    auto fileClient
+        = m_shareClient->GetRootDirectoryClient().GetFileClient(LowercaseRandomString(10));
+    fileClient.Create(16 * 1024);
+    auto rangeContent = RandomBuffer(8 * 1024);
+    auto memBodyStream = Core::IO::MemoryBodyStream(rangeContent);
+    fileClient.UploadRange(0, memBodyStream);
+    auto snapshot1 = m_shareClient->CreateSnapshot().Value.Snapshot;
+
+    const std::string tempFilename = RandomString();
+    fileClient.WithShareSnapshot(snapshot1).DownloadSparseTo(tempFilename);
+
+    fileClient.ClearRange(2 * 1024, 4 * 1024);
+    auto changedContent = RandomBuffer(5 * 1024);
+    auto changedBodyStream = Core::IO::MemoryBodyStream(changedContent);
+    fileClient.UploadRange(11 * 1024, changedBodyStream);
+    Files::Shares::SetFilePropertiesOptions setPropertiesOptions;
+    setPropertiesOptions.Size = 20 * 1024;
+    fileClient.SetProperties(
+        Files::Shares::Models::FileHttpHeaders(),
+        Files::Shares::Models::FileSmbProperties(),
+        setPropertiesOptions);
+    auto snapshot2 = m_shareClient->CreateSnapshot().Value.Snapshot;
+
+    std::vector<uint8_t> fileContent(20 * 1024, '\x00');
+    std::copy(rangeContent.begin(), rangeContent.begin() + 2 * 1024, fileContent.begin());
+    std::copy(rangeContent.begin() + 6 * 1024, rangeContent.end(), fileContent.begin() + 6 * 1024);
+    std::copy(changedContent.begin(), changedContent.end(), fileContent.begin() + 11 * 1024);
+
+    Files::Shares::SyncFileFromSnapshotDiffOptions options;
+    options.TransferOptions.ChunkSize = 2 * 1024;
+    auto res = fileClient.SyncFromSnapshotDiff(tempFilename, snapshot1, snapshot2, options);
+    EXPECT_EQ(res.Value.FileSize, 20 * 1024);
+    EXPECT_EQ(res.Value.DownloadedSize, 5 * 1024);
+    EXPECT_EQ(res.Value.ClearedSize, 4 * 1024);
+    EXPECT_EQ(ReadFile(tempFilename), fileContent);
+    DeleteFile(tempFilename);
+  }
+
   TEST_F(FileShareFileClientTest, StorageExceptionAdditionalInfo)
   {
     Azure::Storage::Files::Shares::ShareClientOptions options;
@@ -951,4 +1103,50 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(FileShareFileClientTest, CopyFromUriParallel)
+  {
+    std::string fileName = RandomString();
+    auto sourceFileClient = m_shareClient->GetRootDirectoryClient().GetFileClient(fileName);
+    Files::Shares::CreateFileOptions createOptions;
+    createOptions.Metadata = RandomMetadata();
+    createOptions.HttpHeaders.ContentType = "application/x-binary";
+    sourceFileClient.Create(64 * 1024, createOptions);
+    std::vector<uint8_t> fileContent(64 * 1024, '\x00');
+    // Two valid ranges, the second one spans several chunks.
+    for (auto range : {std::make_pair(4 * 1024, 2 * 1024), std::make_pair(32 * 1024, 9 * 1024)})
+    {
+      auto rangeContent = RandomBuffer(static_cast<size_t>(range.second));
+      auto memBodyStream = Core::IO::MemoryBodyStream(rangeContent);
+      sourceFileClient.UploadRange(range.first, memBodyStream);
+      std::copy(rangeContent.begin(), rangeContent.end(), fileContent.begin() + range.first);
+    }
+
+    Sas::ShareSasBuilder fileSasBuilder;
+    fileSasBuilder.Protocol = Sas::SasProtocol::HttpsAndHttp;
+    fileSasBuilder.StartsOn = std::chrono::system_clock::now() - std::chrono::minutes(5);
+    fileSasBuilder.ExpiresOn = std::chrono::system_clock::now() + std::chrono::minutes(60);
+    fileSasBuilder.ShareName = m_shareName;
+    fileSasBuilder.FilePath = fileName;
+    fileSasBuilder.Resource = Sas::ShareSasResource::File;
+    fileSasBuilder.SetPermissions(Sas::ShareSasPermissions::Read);
+    std::string sourceSas = fileSasBuilder.GenerateSasToken(
+        *_internal::ParseConnectionString(StandardStorageConnectionString()).KeyCredential);
+
+    auto destFileClient = m_shareClient->GetRootDirectoryClient().GetFileClient(RandomString(10));
+    Files::Shares::CopyFileFromUriParallelOptions options;
+    options.TransferOptions.ChunkSize = 4 * 1024;
+    options.TransferOptions.Concurrency = 2;
+    auto res = destFileClient.CopyFromUriParallel(sourceFileClient.GetUrl() + sourceSas, options);
+    EXPECT_EQ(res.Value.FileSize, 64 * 1024);
+    EXPECT_EQ(res.Value.CopiedSize, 11 * 1024);
+    EXPECT_TRUE(res.Value.ETag.HasValue());
+
+    auto properties = destFileClient.GetProperties().Value;
+    EXPECT_EQ(properties.ETag, res.Value.ETag);
+    EXPECT_EQ(properties.Metadata, createOptions.Metadata);
+    EXPECT_EQ(properties.HttpHeaders.ContentType, createOptions.HttpHeaders.ContentType);
+    EXPECT_EQ(destFileClient.GetRangeList().Value.Ranges.size(), 2U);
+    EXPECT_EQ(destFileClient.Download().Value.BodyStream->ReadToEnd(), fileContent);
+  }
+
 }}} // namespace Azure::Storage::Test
@@ -7,3 +7,11 @@
  */
 
 #pragma once
+
+#include "azure/storage/queues/dll_import_export.hpp"
+#include "azure/storage/queues/queue_client.hpp"
+#include "azure/storage/queues/queue_message_consumer.hpp"
+#include "azure/storage/queues/queue_message_lease_manager.hpp"
+#include "azure/storage/queues/queue_message_producer.hpp"
+#include "azure/storage/queues/queue_receive_scheduler.hpp"
+#include "azure/storage/queues/queue_service_client.hpp"
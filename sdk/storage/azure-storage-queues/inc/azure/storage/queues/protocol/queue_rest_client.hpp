@@ -1787,17 +1787,13 @@ namespace Azure { namespace Storage { namespace Queues {
         {
           Azure::Nullable<int32_t> Timeout;
           std::string Body;
+          bool EncodeBodyAsBase64 = false;
           Azure::Nullable<int32_t> VisibilityTimeout;
           Azure::Nullable<int32_t> TimeToLive;
         }; // struct SendMessageOptions
 
-        static Azure::Response<SendMessageResult> SendMessage(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
-            const Azure::Core::Url& url,
-            const SendMessageOptions& options,
-            const Azure::Core::Context& context)
+        static std::string SendMessageCreateBody(const SendMessageOptions& options)
         {
-          (void)options;
           std::string xml_body;
           {
             _internal::XmlWriter writer;
@@ -1805,8 +1801,15 @@ namespace Azure { namespace Storage { namespace Queues {
             xml_body = writer.GetDocument();
             writer.Write(_internal::XmlNode{_internal::XmlNodeType::End});
           }
-          Azure::Core::IO::MemoryBodyStream xml_body_stream(
-              reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
+          return xml_body;
+        }
+
+        static Azure::Core::Http::Request SendMessageCreateMessage(
+            const Azure::Core::Url& url,
+            Azure::Core::IO::BodyStream& xml_body_stream,
+            const SendMessageOptions& options)
+        {
+          (void)options;
           auto request = Azure::Core::Http::Request(
               Azure::Core::Http::HttpMethod::Post, url, &xml_body_stream);
           request.SetHeader("Content-Length", std::to_string(xml_body_stream.Length()));
@@ -1826,7 +1829,14 @@ namespace Azure { namespace Storage { namespace Queues {
             request.GetUrl().AppendQueryParameter(
                 "messagettl", std::to_string(options.TimeToLive.Value()));
           }
-          auto pHttpResponse = pipeline.Send(request, context);
+          return request;
+        }
+
+        static Azure::Response<SendMessageResult> SendMessageCreateResponse(
+            std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
+            const Azure::Core::Context& context)
+        {
+          (void)context;
           Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
           SendMessageResult response;
           auto http_status_code
@@ -1845,6 +1855,20 @@ namespace Azure { namespace Storage { namespace Queues {
           return Azure::Response<SendMessageResult>(std::move(response), std::move(pHttpResponse));
         }
 
+        static Azure::Response<SendMessageResult> SendMessage(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const SendMessageOptions& options,
+            const Azure::Core::Context& context)
+        {
+          std::string xml_body = SendMessageCreateBody(options);
+          Azure::Core::IO::MemoryBodyStream xml_body_stream(
+              reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
+          auto request = SendMessageCreateMessage(url, xml_body_stream, options);
+          auto pHttpResponse = pipeline.Send(request, context);
+          return SendMessageCreateResponse(std::move(pHttpResponse), context);
+        }
+
         struct ReceiveMessagesOptions final
         {
           Azure::Nullable<int32_t> Timeout;
@@ -1852,11 +1876,9 @@ namespace Azure { namespace Storage { namespace Queues {
           Azure::Nullable<int32_t> VisibilityTimeout;
         }; // struct ReceiveMessagesOptions
 
-        static Azure::Response<Models::_detail::ReceiveMessagesResult> ReceiveMessages(
-            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+        static Azure::Core::Http::Request ReceiveMessagesCreateMessage(
             const Azure::Core::Url& url,
-            const ReceiveMessagesOptions& options,
-            const Azure::Core::Context& context)
+            const ReceiveMessagesOptions& options)
         {
           (void)options;
           auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
@@ -1876,7 +1898,15 @@ namespace Azure { namespace Storage { namespace Queues {
             request.GetUrl().AppendQueryParameter(
                 "visibilitytimeout", std::to_string(options.VisibilityTimeout.Value()));
           }
-          auto pHttpResponse = pipeline.Send(request, context);
+          return request;
+        }
+
+        static Azure::Response<Models::_detail::ReceiveMessagesResult>
+        ReceiveMessagesCreateResponse(
+            std::unique_ptr<Azure::Core::Http::RawResponse> pHttpResponse,
+            const Azure::Core::Context& context)
+        {
+          (void)context;
           Azure::Core::Http::RawResponse& httpResponse = *pHttpResponse;
           Models::_detail::ReceiveMessagesResult response;
           auto http_status_code
@@ -1896,6 +1926,17 @@ namespace Azure { namespace Storage { namespace Queues {
               std::move(response), std::move(pHttpResponse));
         }
 
+        static Azure::Response<Models::_detail::ReceiveMessagesResult> ReceiveMessages(
+            Azure::Core::Http::_internal::HttpPipeline& pipeline,
+            const Azure::Core::Url& url,
+            const ReceiveMessagesOptions& options,
+            const Azure::Core::Context& context)
+        {
+          auto request = ReceiveMessagesCreateMessage(url, options);
+          auto pHttpResponse = pipeline.Send(request, context);
+          return ReceiveMessagesCreateResponse(std::move(pHttpResponse), context);
+        }
+
         struct PeekMessagesOptions final
         {
           Azure::Nullable<int32_t> Timeout;
@@ -2014,6 +2055,7 @@ namespace Azure { namespace Storage { namespace Queues {
         struct UpdateMessageOptions final
         {
           std::string Body;
+          bool EncodeBodyAsBase64 = false;
           Azure::Nullable<int32_t> Timeout;
           std::string PopReceipt;
           int32_t VisibilityTimeout;
@@ -2635,8 +2677,16 @@ namespace Azure { namespace Storage { namespace Queues {
         {
           writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "QueueMessage"});
           writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "MessageText"});
-          writer.Write(
-              _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Body});
+          if (options.EncodeBodyAsBase64)
+          {
+            writer.WriteBase64(
+                reinterpret_cast<const uint8_t*>(options.Body.data()), options.Body.length());
+          }
+          else
+          {
+            writer.Write(
+                _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Body});
+          }
           writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
           writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
         }
@@ -2659,8 +2709,16 @@ namespace Azure { namespace Storage { namespace Queues {
         {
           writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "QueueMessage"});
           writer.Write(_internal::XmlNode{_internal::XmlNodeType::StartTag, "MessageText"});
-          writer.Write(
-              _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Body});
+          if (options.EncodeBodyAsBase64)
+          {
+            writer.WriteBase64(
+                reinterpret_cast<const uint8_t*>(options.Body.data()), options.Body.length());
+          }
+          else
+          {
+            writer.Write(
+                _internal::XmlNode{_internal::XmlNodeType::Text, std::string(), options.Body});
+          }
           writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
           writer.Write(_internal::XmlNode{_internal::XmlNodeType::EndTag});
         }
@@ -0,0 +1,278 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <azure/core/async_response.hpp>
+#include <azure/core/credentials/credentials.hpp>
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/core/response.hpp>
+#include <azure/storage/common/storage_credential.hpp>
+
+#include "azure/storage/queues/protocol/queue_rest_client.hpp"
+#include "azure/storage/queues/queue_options.hpp"
+#include "azure/storage/queues/queue_responses.hpp"
+#include "azure/storage/queues/queue_service_client.hpp"
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  /**
+   * The QueueClient allows you to manipulate an Azure Storage queue and its messages.
+   */
+  class QueueClient final {
+  public:
+    /**
+     * @brief Initialize a new instance of QueueClient.
+     *
+     * @param connectionString A connection string includes the authentication information required
+     * for your application to access data in an Azure Storage account at runtime.
+     * @param queueName The name of the queue.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     * @return A new QueueClient instance.
+     */
+    static QueueClient CreateFromConnectionString(
+        const std::string& connectionString,
+        const std::string& queueName,
+        const QueueClientOptions& options = QueueClientOptions());
+
+    /**
+     * @brief Initialize a new instance of QueueClient.
+     *
+     * @param queueUrl A URL referencing the queue that is the target of this client.
+     * @param credential The shared key credential used to sign requests.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     */
+    explicit QueueClient(
+        const std::string& queueUrl,
+        std::shared_ptr<StorageSharedKeyCredential> credential,
+        const QueueClientOptions& options = QueueClientOptions());
+
+    /**
+     * @brief Initialize a new instance of QueueClient.
+     *
+     * @param queueUrl A URL referencing the queue that is the target of this client.
+     * @param credential The token credential used to sign requests.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     */
+    explicit QueueClient(
+        const std::string& queueUrl,
+        std::shared_ptr<Core::Credentials::TokenCredential> credential,
+        const QueueClientOptions& options = QueueClientOptions());
+
+    /**
+     * @brief Initialize a new instance of QueueClient.
+     *
+     * @param queueUrl A URL referencing the queue that is the target of this client, and includes
+     * a shared access signature if it needs one.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     */
+    explicit QueueClient(
+        const std::string& queueUrl,
+        const QueueClientOptions& options = QueueClientOptions());
+
+    /**
+     * @brief Gets the queue's primary URL endpoint.
+     *
+     * @return The queue's primary URL endpoint.
+     */
+    std::string GetUrl() const { return m_queueUrl.GetAbsoluteUrl(); }
+
+    /**
+     * @brief Creates a new queue under the specified account.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A CreateQueueResult describing the newly created queue.
+     */
+    Azure::Response<Models::CreateQueueResult> Create(
+        const CreateQueueOptions& options = CreateQueueOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Marks the specified queue for deletion.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A DeleteQueueResult if successful.
+     */
+    Azure::Response<Models::DeleteQueueResult> Delete(
+        const DeleteQueueOptions& options = DeleteQueueOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Returns the metadata of the queue and the approximate number of messages in it.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A QueueProperties describing the queue.
+     */
+    Azure::Response<Models::QueueProperties> GetProperties(
+        const GetQueuePropertiesOptions& options = GetQueuePropertiesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Sets one or more user-defined name-value pairs for the specified queue.
+     *
+     * @param metadata Custom metadata to set for this queue.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A SetQueueMetadataResult if successful.
+     */
+    Azure::Response<Models::SetQueueMetadataResult> SetMetadata(
+        Storage::Metadata metadata,
+        const SetQueueMetadataOptions& options = SetQueueMetadataOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Adds a new message to the back of the queue.
+     *
+     * @param messageText The content of the message, which can be up to 64KiB in size once
+     * encoded. With QueueMessageEncoding::Base64, it can hold any bytes, which are encoded straight
+     * into the request body.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A SendMessageResult describing the message sent.
+     */
+    Azure::Response<Models::SendMessageResult> SendMessage(
+        std::string messageText,
+        const SendMessageOptions& options = SendMessageOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Adds a new message to the back of the queue, without waiting for the response.
+     *
+     * @remark The calling thread is only blocked by the policies and the transport without an
+     * asynchronous implementation. Use Azure::Core::ResponseAwaitable to `co_await` the message
+     * sent.
+     *
+     * @param messageText The content of the message, which can be up to 64KiB in size once
+     * encoded.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @param callback The function called with the SendMessageResult, or with the error.
+     */
+    void SendMessageAsync(
+        std::string messageText,
+        const SendMessageOptions& options,
+        const Azure::Core::Context& context,
+        Azure::Core::ResponseCallback<Models::SendMessageResult> callback) const;
+
+    /**
+     * @brief Receives one or more messages from the front of the queue, which become invisible to
+     * the other consumers of the queue for the visibility timeout.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A ReceivedMessages holding the messages received, none if the queue is empty.
+     */
+    Azure::Response<Models::ReceivedMessages> ReceiveMessages(
+        const ReceiveMessagesOptions& options = ReceiveMessagesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Receives one or more messages from the front of the queue, without waiting for the
+     * response.
+     *
+     * @remark The calling thread is only blocked by the policies and the transport without an
+     * asynchronous implementation. Use Azure::Core::ResponseAwaitable to `co_await` the messages
+     * received.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @param callback The function called with the ReceivedMessages, or with the error.
+     */
+    void ReceiveMessagesAsync(
+        const ReceiveMessagesOptions& options,
+        const Azure::Core::Context& context,
+        Azure::Core::ResponseCallback<Models::ReceivedMessages> callback) const;
+
+    /**
+     * @brief Retrieves one or more messages from the front of the queue, but doesn't alter the
+     * visibility of the messages.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A PeekedMessages holding the messages peeked.
+     */
+    Azure::Response<Models::PeekedMessages> PeekMessages(
+        const PeekMessagesOptions& options = PeekMessagesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Changes the content and the visibility timeout of a message received before.
+     *
+     * @param messageId The ID of the message to update.
+     * @param popReceipt The pop receipt returned for the message by the last receive or update.
+     * @param messageText The new content of the message, encoded as the one sent.
+     * @param visibilityTimeout How long the message is invisible from now on.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return An UpdateMessageResult holding the new pop receipt of the message.
+     */
+    Azure::Response<Models::UpdateMessageResult> UpdateMessage(
+        const std::string& messageId,
+        const std::string& popReceipt,
+        std::string messageText,
+        std::chrono::seconds visibilityTimeout,
+        const UpdateMessageOptions& options = UpdateMessageOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Permanently removes a message received before from the queue.
+     *
+     * @param messageId The ID of the message to delete.
+     * @param popReceipt The pop receipt returned for the message by the last receive or update.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A DeleteMessageResult if successful.
+     */
+    Azure::Response<Models::DeleteMessageResult> DeleteMessage(
+        const std::string& messageId,
+        const std::string& popReceipt,
+        const DeleteMessageOptions& options = DeleteMessageOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Deletes all the messages of the queue.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A ClearMessagesResult if successful.
+     */
+    Azure::Response<Models::ClearMessagesResult> ClearMessages(
+        const ClearMessagesOptions& options = ClearMessagesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+  private:
+    Azure::Core::Url m_queueUrl;
+    std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    QueueMessageEncoding m_messageEncoding = QueueMessageEncoding::None;
+
+    _detail::QueueRestClient::Queue::SendMessageOptions GetSendMessageProtocolLayerOptions(
+        std::string messageText,
+        const SendMessageOptions& options) const;
+
+    _detail::QueueRestClient::Queue::ReceiveMessagesOptions GetReceiveMessagesProtocolLayerOptions(
+        const ReceiveMessagesOptions& options) const;
+
+    explicit QueueClient(
+        Azure::Core::Url queueUrl,
+        std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> pipeline,
+        QueueMessageEncoding messageEncoding)
+        : m_queueUrl(std::move(queueUrl)), m_pipeline(std::move(pipeline)),
+          m_messageEncoding(messageEncoding)
+    {
+    }
+
+    friend class QueueServiceClient;
+  };
+
+}}} // namespace Azure::Storage::Queues
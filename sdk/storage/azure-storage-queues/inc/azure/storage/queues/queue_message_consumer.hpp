@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <azure/core/nullable.hpp>
+
+#include "azure/storage/queues/queue_client.hpp"
+#include "azure/storage/queues/queue_options.hpp"
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  /**
+   * @brief QueueMessageConsumer drains a queue with receive calls kept outstanding in the
+   * background: the messages they return are buffered and handed out by #Receive without a round
+   * trip, and the messages given to #Delete are deleted by parallel tasks.
+   *
+   * @remark Receive calls are only started while messages are being received, so nothing polls
+   * the queue when #Receive isn't called. The messages still buffered when the consumer is
+   * destroyed become visible again after their visibility timeout, and the buffered messages whose
+   * visibility timeout has expired are dropped instead of handed out.
+   */
+  class QueueMessageConsumer final {
+  public:
+    /**
+     * @brief Initializes a new instance of the QueueMessageConsumer.
+     *
+     * @param queueClient A QueueClient representing the queue to receive the messages of.
+     * @param options Optional parameters of the consumer.
+     */
+    explicit QueueMessageConsumer(
+        QueueClient queueClient,
+        const QueueMessageConsumerOptions& options = QueueMessageConsumerOptions());
+
+    /**
+     * @brief Waits for the outstanding receive calls and for the queued deletes to finish.
+     */
+    ~QueueMessageConsumer();
+
+    QueueMessageConsumer(const QueueMessageConsumer&) = delete;
+    QueueMessageConsumer& operator=(const QueueMessageConsumer&) = delete;
+
+    /**
+     * @brief Hands out the next message received. Can be called from several threads at the same
+     * time.
+     *
+     * @param timeout How long to wait for a message if none is buffered.
+     * @return The next message, or null if none was received before the timeout.
+     * @throw StorageException if a receive call failed since the last call. The following calls
+     * start receiving again.
+     */
+    Azure::Nullable<Models::QueueMessage> Receive(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Queues a message handed out by #Receive to be deleted. Can be called from several
+     * threads at the same time.
+     *
+     * @param message The message to delete.
+     */
+    void Delete(const Models::QueueMessage& message);
+
+    /**
+     * @brief Waits for all the deletes queued so far to finish, and throws the exception of the
+     * first delete which failed since the last call, if any.
+     */
+    void Flush();
+
+  private:
+    // Starts the receive calls and the delete tasks allowed by the options. Must be called with
+    // m_mutex locked.
+    void StartReceives();
+    void StartDeletes();
+    void ReceiveBatch();
+    void DeleteBatch(const std::deque<std::pair<std::string, std::string>>& messages);
+
+    QueueClient m_queueClient;
+    QueueMessageConsumerOptions m_options;
+
+    // Guards the variables below.
+    std::mutex m_mutex;
+    std::condition_variable m_received;
+    std::condition_variable m_finished;
+    std::deque<Models::QueueMessage> m_messages;
+    int32_t m_numReceiving = 0;
+    // When the queue was last found empty, no receive call starts before this time.
+    std::chrono::steady_clock::time_point m_nextReceiveTime;
+    // Zero while the receive calls find messages.
+    std::chrono::milliseconds m_emptyQueueDelay{0};
+    std::exception_ptr m_receiveError;
+    // The ID and pop receipt of the messages waiting to be deleted.
+    std::deque<std::pair<std::string, std::string>> m_pendingDeletes;
+    int32_t m_numDeleting = 0;
+    std::exception_ptr m_deleteError;
+    bool m_stopping = false;
+  };
+
+}}} // namespace Azure::Storage::Queues
@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <azure/core/context.hpp>
+#include <azure/core/response.hpp>
+#include <azure/storage/common/lease_keeper.hpp>
+
+#include "azure/storage/queues/queue_client.hpp"
+#include "azure/storage/queues/queue_options.hpp"
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  /**
+   * @brief QueueMessageLeaseManager keeps the messages being processed invisible to the other
+   * consumers of a queue, however long the processing takes, by extending their visibility
+   * timeout in the background until they're completed or released.
+   *
+   * @remark The extensions of all the messages are scheduled by the single timer thread of a
+   * LeaseKeeper, jittered so that the messages received together aren't extended in bursts, and
+   * run on the storage thread pool up to `MaxConcurrentRenewals` at a time. Each extension
+   * returns a new pop receipt, which the manager uses to delete the message when it's completed.
+   *
+   * @remark A message is lost when an extension fails with a client error, such as when the
+   * message was deleted or its pop receipt changed by another call, or when it couldn't be
+   * extended before it became visible again. The lost messages are reported to their handlers,
+   * and may be received by another consumer.
+   */
+  class QueueMessageLeaseManager final {
+  public:
+    /**
+     * @brief Handles the loss of a message, with the ID of the message and the exception of the
+     * extension it was lost with. Exceptions thrown by the handler are ignored.
+     */
+    using LostMessageHandler
+        = std::function<void(const std::string& messageId, std::exception_ptr error)>;
+
+    /**
+     * @brief Initializes a new instance of the QueueMessageLeaseManager.
+     *
+     * @param queueClient A QueueClient representing the queue the messages were received from.
+     * @param options Optional parameters of the manager.
+     */
+    explicit QueueMessageLeaseManager(
+        QueueClient queueClient,
+        const QueueMessageLeaseManagerOptions& options = QueueMessageLeaseManagerOptions());
+
+    /**
+     * @brief Stops extending the messages, see #Stop.
+     */
+    ~QueueMessageLeaseManager();
+
+    QueueMessageLeaseManager(const QueueMessageLeaseManager&) = delete;
+    QueueMessageLeaseManager& operator=(const QueueMessageLeaseManager&) = delete;
+
+    /**
+     * @brief Starts extending the visibility timeout of a message which was just received. Can be
+     * called from several threads at the same time.
+     *
+     * @param message The message received.
+     * @param onLost Handles the loss of the message. If null, it's ignored.
+     * @return The key of the message in the manager, to complete or release it.
+     */
+    int64_t Add(
+        const Models::QueueMessage& message,
+        LostMessageHandler onLost = LostMessageHandler());
+
+    /**
+     * @brief Stops extending the visibility timeout of a message, and deletes it from the queue
+     * with its latest pop receipt.
+     *
+     * @param messageKey The key returned when the message was added. Throws
+     * std::invalid_argument if it's unknown, or the message was completed, released or lost.
+     * @param context Context for cancelling long running operations.
+     * @return A DeleteMessageResult if successful.
+     */
+    Azure::Response<Models::DeleteMessageResult> Complete(
+        int64_t messageKey,
+        const Azure::Core::Context& context = Azure::Core::Context());
+
+    /**
+     * @brief Stops extending the visibility timeout of a message, which becomes visible again
+     * once its current visibility timeout expires.
+     *
+     * @param messageKey The key returned when the message was added. Throws
+     * std::invalid_argument if it's unknown, or the message was completed, released or lost.
+     * @return The latest pop receipt of the message, to update or delete it.
+     */
+    std::string Release(int64_t messageKey);
+
+    /**
+     * @brief Stops extending all the messages, cancels the extensions in progress and waits for
+     * them.
+     */
+    void Stop();
+
+  private:
+    struct LeasedMessage final
+    {
+      std::string MessageId;
+      std::string MessageText;
+      int64_t Key = 0;
+      // Held during an extension, so the pop receipt read afterwards is the latest one.
+      std::mutex Mutex;
+      std::string PopReceipt;
+      bool Done = false;
+    };
+
+    // Removes a message, which isn't extended anymore once its mutex is locked.
+    std::shared_ptr<LeasedMessage> Remove(int64_t messageKey);
+
+    QueueClient m_queueClient;
+    QueueMessageLeaseManagerOptions m_options;
+
+    // Guards m_messages.
+    std::mutex m_mutex;
+    std::unordered_map<int64_t, std::shared_ptr<LeasedMessage>> m_messages;
+
+    // Destroyed first, so no extension refers to the members above anymore.
+    LeaseKeeper m_leaseKeeper;
+  };
+
+}}} // namespace Azure::Storage::Queues
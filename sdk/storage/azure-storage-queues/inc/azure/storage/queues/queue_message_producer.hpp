@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+
+#include "azure/storage/queues/queue_client.hpp"
+#include "azure/storage/queues/queue_options.hpp"
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  /**
+   * @brief QueueMessageProducer sends the messages of many threads to a queue with up to
+   * `Concurrency` sends in flight, so the throughput grows with the number of connections rather
+   * than with the number of threads sending.
+   *
+   * @remark The messages are sent by tasks of the storage thread pool, each of them sending the
+   * queued messages one after the other on its connection. The messages of different threads, or
+   * sent at the same time, may reach the queue in any order.
+   */
+  class QueueMessageProducer final {
+  public:
+    /**
+     * @brief Initializes a new instance of the QueueMessageProducer.
+     *
+     * @param queueClient A QueueClient representing the queue to send the messages to.
+     * @param options Optional parameters of the producer.
+     */
+    explicit QueueMessageProducer(
+        QueueClient queueClient,
+        const QueueMessageProducerOptions& options = QueueMessageProducerOptions());
+
+    /**
+     * @brief Waits for all the messages to be sent.
+     */
+    ~QueueMessageProducer();
+
+    QueueMessageProducer(const QueueMessageProducer&) = delete;
+    QueueMessageProducer& operator=(const QueueMessageProducer&) = delete;
+
+    /**
+     * @brief Queues a message to be sent. Can be called from several threads at the same time.
+     *
+     * @param messageText The content of the message, which can be up to 64KiB in size.
+     * @return A future which becomes ready once the message is added to the queue, or holds the
+     * exception the message failed to be sent with.
+     */
+    std::future<Models::SendMessageResult> Send(std::string messageText);
+
+    /**
+     * @brief Waits for all the messages queued so far to be sent. The failures are reported by
+     * the futures of the messages.
+     */
+    void Flush();
+
+  private:
+    struct PendingMessage final
+    {
+      std::string MessageText;
+      std::promise<Models::SendMessageResult> Sent;
+    };
+
+    // Starts the tasks allowed by the options. Must be called with m_mutex locked.
+    void StartSends();
+    void SendMessages();
+
+    QueueClient m_queueClient;
+    QueueMessageProducerOptions m_options;
+
+    // Guards the variables below.
+    std::mutex m_mutex;
+    std::condition_variable m_sendFinished;
+    std::deque<PendingMessage> m_pendingMessages;
+    int32_t m_numSending = 0;
+  };
+
+}}} // namespace Azure::Storage::Queues
@@ -0,0 +1,326 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <azure/core/internal/client_options.hpp>
+#include <azure/core/nullable.hpp>
+#include <azure/storage/common/lease_keeper.hpp>
+#include <azure/storage/common/storage_common.hpp>
+
+#include "azure/storage/queues/protocol/queue_rest_client.hpp"
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  /**
+   * @brief How the content of the messages is encoded in the requests and the responses.
+   */
+  enum class QueueMessageEncoding
+  {
+    /**
+     * The content is sent and received as it is. It must be text valid in XML.
+     */
+    None,
+
+    /**
+     * The content is sent Base64-encoded, and decoded when it's received, so it can hold any
+     * bytes.
+     */
+    Base64,
+  };
+
+  /**
+   * @brief Client options used to initialize queue clients.
+   */
+  struct QueueClientOptions final : Azure::Core::_internal::ClientOptions
+  {
+    /**
+     * API version used by this client.
+     */
+    std::string ApiVersion = _detail::ApiVersion;
+
+    /**
+     * How the content of the messages is encoded. The messages sent with one encoding can only be
+     * read back with the same one.
+     */
+    QueueMessageEncoding MessageEncoding = QueueMessageEncoding::None;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueServiceClient::ListQueues.
+   */
+  struct ListQueuesOptions final
+  {
+    /**
+     * Filters the results to return only queues whose name begins with the specified prefix.
+     */
+    Azure::Nullable<std::string> Prefix;
+
+    /**
+     * A string value that identifies the portion of the list to be returned with the next
+     * list operation. The operation returns a marker value within the response body if the list
+     * returned was not complete. The marker value may then be used in a subsequent call to
+     * request the next set of list items. The marker value is opaque to the client.
+     */
+    Azure::Nullable<std::string> ContinuationToken;
+
+    /**
+     * Specifies the maximum number of queues to return. If the request does not specify
+     * PageSizeHint, or specifies a value greater than 5,000, the server will return up to 5,000
+     * items.
+     */
+    Azure::Nullable<int32_t> PageSizeHint;
+
+    /**
+     * Specifies that the queue's metadata be returned.
+     */
+    Models::ListQueuesIncludeFlags Include = Models::ListQueuesIncludeFlags::None;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueServiceClient::SetProperties.
+   */
+  struct SetServicePropertiesOptions final
+  {
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueServiceClient::GetProperties.
+   */
+  struct GetServicePropertiesOptions final
+  {
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueServiceClient::GetStatistics.
+   */
+  struct GetServiceStatisticsOptions final
+  {
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueClient::Create.
+   */
+  struct CreateQueueOptions final
+  {
+    /**
+     * A set of name-value pairs associated with the queue as user-defined metadata.
+     */
+    Storage::Metadata Metadata;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueClient::Delete.
+   */
+  struct DeleteQueueOptions final
+  {
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueClient::GetProperties.
+   */
+  struct GetQueuePropertiesOptions final
+  {
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueClient::SetMetadata.
+   */
+  struct SetQueueMetadataOptions final
+  {
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueClient::SendMessage.
+   */
+  struct SendMessageOptions final
+  {
+    /**
+     * Specifies how long the message is invisible after it's sent. It must be shorter than the
+     * time to live of the message. If null, the message is visible right away.
+     */
+    Azure::Nullable<std::chrono::seconds> VisibilityTimeout;
+
+    /**
+     * Specifies the time to live of the message, -1 second for a message which never expires. If
+     * null, the message expires after seven days.
+     */
+    Azure::Nullable<std::chrono::seconds> TimeToLive;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueClient::ReceiveMessages.
+   */
+  struct ReceiveMessagesOptions final
+  {
+    /**
+     * The maximum number of messages to receive, up to 32. If null, a single message is received.
+     */
+    Azure::Nullable<int64_t> MaxMessages;
+
+    /**
+     * Specifies how long the received messages are invisible to the other consumers of the queue.
+     * If null, the messages are invisible for 30 seconds.
+     */
+    Azure::Nullable<std::chrono::seconds> VisibilityTimeout;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueClient::PeekMessages.
+   */
+  struct PeekMessagesOptions final
+  {
+    /**
+     * The maximum number of messages to peek, up to 32. If null, a single message is peeked.
+     */
+    Azure::Nullable<int64_t> MaxMessages;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueClient::UpdateMessage.
+   */
+  struct UpdateMessageOptions final
+  {
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueClient::DeleteMessage.
+   */
+  struct DeleteMessageOptions final
+  {
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueClient::ClearMessages.
+   */
+  struct ClearMessagesOptions final
+  {
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueMessageConsumer.
+   */
+  struct QueueMessageConsumerOptions final
+  {
+    /**
+     * @brief The number of messages asked for by each receive call, up to 32.
+     */
+    int32_t MessagesPerReceive = 32;
+
+    /**
+     * @brief The maximum number of receive calls outstanding at the same time.
+     */
+    int32_t ReceiveConcurrency = 4;
+
+    /**
+     * @brief No other receive call is started while this many messages are buffered, so that
+     * the prefetched messages are handed out before they become visible again.
+     */
+    size_t MaxBufferedMessages = 256;
+
+    /**
+     * @brief Specifies how long the received messages are invisible to the other consumers of the
+     * queue. If null, the messages are invisible for 30 seconds.
+     */
+    Azure::Nullable<std::chrono::seconds> VisibilityTimeout;
+
+    /**
+     * @brief After a receive call finds the queue empty, the next one starts after this delay, so
+     * that waiting on an empty queue doesn't flood the service. The delay doubles every time the
+     * queue is found empty again, up to `MaxEmptyQueueDelay`, and is reset by the first message
+     * received.
+     */
+    std::chrono::milliseconds EmptyQueueDelay = std::chrono::milliseconds(100);
+
+    /**
+     * @brief The longest delay between two receive calls finding the queue empty.
+     */
+    std::chrono::milliseconds MaxEmptyQueueDelay = std::chrono::seconds(5);
+
+    /**
+     * @brief The maximum number of messages deleted by each delete task.
+     */
+    int32_t DeleteBatchSize = 32;
+
+    /**
+     * @brief The maximum number of delete tasks running at the same time.
+     */
+    int32_t DeleteConcurrency = 8;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueMessageProducer.
+   */
+  struct QueueMessageProducerOptions final
+  {
+    /**
+     * @brief The maximum number of messages sent at the same time.
+     */
+    int32_t Concurrency = 16;
+
+    /**
+     * @brief The options every message is sent with.
+     */
+    SendMessageOptions MessageOptions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueReceiveScheduler.
+   */
+  struct QueueReceiveSchedulerOptions final
+  {
+    /**
+     * @brief The number of messages asked for by each receive call, up to 32.
+     */
+    int32_t MessagesPerReceive = 32;
+
+    /**
+     * @brief The maximum number of receive calls outstanding at the same time for a queue, reached
+     * as soon as a receive call returns as many messages as it asked for.
+     */
+    int32_t MaxReceivesPerQueue = 4;
+
+    /**
+     * @brief Specifies how long the received messages are invisible to the other consumers of the
+     * queue. If null, the messages are invisible for 30 seconds.
+     */
+    Azure::Nullable<std::chrono::seconds> VisibilityTimeout;
+
+    /**
+     * @brief After a receive call finds a queue empty, the queue is received from again after this
+     * delay. The delay doubles every time the queue is found empty again, up to `MaxIdleDelay`,
+     * and is reset by the first message received.
+     */
+    std::chrono::milliseconds MinIdleDelay = std::chrono::milliseconds(100);
+
+    /**
+     * @brief The longest delay between two receive calls finding a queue empty.
+     */
+    std::chrono::milliseconds MaxIdleDelay = std::chrono::seconds(30);
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Queues::QueueMessageLeaseManager.
+   */
+  struct QueueMessageLeaseManagerOptions final
+  {
+    /**
+     * @brief How long a message is invisible from each extension on. A message is extended when
+     * half of it has elapsed, so the messages must be received with a visibility timeout of at
+     * least half of it.
+     */
+    std::chrono::seconds VisibilityTimeout = std::chrono::seconds(30);
+
+    /**
+     * @brief The options of the LeaseKeeper extending the messages, such as the jitter of the
+     * extensions and the maximum number of extensions in progress at the same time.
+     */
+    LeaseKeeperOptions KeeperOptions;
+  };
+
+}}} // namespace Azure::Storage::Queues
@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "azure/storage/queues/queue_client.hpp"
+#include "azure/storage/queues/queue_options.hpp"
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  /**
+   * @brief QueueReceiveScheduler receives the messages of many queues on the storage thread pool
+   * and hands them to a handler per queue, adapting how often each queue is received from to its
+   * traffic.
+   *
+   * @remark A queue found empty is received from again after an idle delay, which doubles every
+   * time it's found empty again, up to `MaxIdleDelay`. As soon as messages are received, the queue
+   * is received from again right away, with up to `MaxReceivesPerQueue` receive calls at the same
+   * time while the calls return full batches. So idle queues cost few transactions, and busy ones
+   * are drained without waiting.
+   *
+   * @remark The handler of a queue runs on a thread of the pool, after the next receive calls of
+   * the queue are started, and is responsible for deleting the messages it processed.
+   */
+  class QueueReceiveScheduler final {
+  public:
+    /**
+     * @brief Handles the messages received from a queue, at most `MessagesPerReceive` at a time.
+     * Exceptions thrown by the handler are ignored.
+     */
+    using MessageHandler = std::function<void(std::vector<Models::QueueMessage> messages)>;
+
+    /**
+     * @brief Handles the exception a receive call of a queue failed with. The queue is received
+     * from again after an idle delay.
+     */
+    using ErrorHandler = std::function<void(std::exception_ptr error)>;
+
+    /**
+     * @brief Initializes a new instance of the QueueReceiveScheduler, which starts the thread
+     * scheduling the receive calls.
+     *
+     * @param options Optional parameters of the scheduler.
+     */
+    explicit QueueReceiveScheduler(
+        const QueueReceiveSchedulerOptions& options = QueueReceiveSchedulerOptions());
+
+    /**
+     * @brief Stops receiving, see #Stop.
+     */
+    ~QueueReceiveScheduler();
+
+    QueueReceiveScheduler(const QueueReceiveScheduler&) = delete;
+    QueueReceiveScheduler& operator=(const QueueReceiveScheduler&) = delete;
+
+    /**
+     * @brief Starts receiving the messages of a queue. Can be called from several threads at the
+     * same time.
+     *
+     * @param queueClient A QueueClient representing the queue to receive the messages of.
+     * @param messageHandler Handles the messages received.
+     * @param errorHandler Handles the failures of the receive calls. If null, they're ignored.
+     */
+    void AddQueue(
+        QueueClient queueClient,
+        MessageHandler messageHandler,
+        ErrorHandler errorHandler = ErrorHandler());
+
+    /**
+     * @brief Stops receiving from all the queues, and waits for the outstanding receive calls and
+     * for the handlers running.
+     */
+    void Stop();
+
+  private:
+    struct ScheduledQueue final
+    {
+      explicit ScheduledQueue(
+          QueueClient queueClient,
+          MessageHandler messageHandler,
+          ErrorHandler errorHandler)
+          : Client(std::move(queueClient)), OnMessages(std::move(messageHandler)),
+            OnError(std::move(errorHandler))
+      {
+      }
+
+      QueueClient Client;
+      MessageHandler OnMessages;
+      ErrorHandler OnError;
+      // The queue isn't received from before this time.
+      std::chrono::steady_clock::time_point NextReceiveTime;
+      // Zero while the receive calls find messages.
+      std::chrono::milliseconds IdleDelay{0};
+      // Whether the last receive call returned a full batch.
+      bool LastReceiveFull = false;
+      int32_t NumReceiving = 0;
+    };
+
+    // Starts the receive calls of a queue allowed by its state. Must be called with m_mutex
+    // locked.
+    void StartReceives(ScheduledQueue& queue);
+    void Receive(ScheduledQueue& queue);
+    void RunTimer();
+
+    QueueReceiveSchedulerOptions m_options;
+
+    // Guards the variables below.
+    std::mutex m_mutex;
+    std::condition_variable m_stateChanged;
+    std::vector<std::unique_ptr<ScheduledQueue>> m_queues;
+    // The receive calls and the handlers running, for all the queues.
+    int32_t m_numRunning = 0;
+    bool m_stopping = false;
+
+    std::thread m_timerThread;
+  };
+
+}}} // namespace Azure::Storage::Queues
@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <azure/core/credentials/credentials.hpp>
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/core/response.hpp>
+#include <azure/storage/common/storage_credential.hpp>
+
+#include "azure/storage/queues/protocol/queue_rest_client.hpp"
+#include "azure/storage/queues/queue_options.hpp"
+#include "azure/storage/queues/queue_responses.hpp"
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  class QueueClient;
+
+  /**
+   * The QueueServiceClient allows you to manipulate Azure Storage service resources and queues.
+   * The storage account provides the top-level namespace for the Queue service.
+   */
+  class QueueServiceClient final {
+  public:
+    /**
+     * @brief Initialize a new instance of QueueServiceClient.
+     *
+     * @param connectionString A connection string includes the authentication information required
+     * for your application to access data in an Azure Storage account at runtime.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     * @return A new QueueServiceClient instance.
+     */
+    static QueueServiceClient CreateFromConnectionString(
+        const std::string& connectionString,
+        const QueueClientOptions& options = QueueClientOptions());
+
+    /**
+     * @brief Initialize a new instance of QueueServiceClient.
+     *
+     * @param serviceUrl A URL referencing the queue service that is the target of this client.
+     * @param credential The shared key credential used to sign requests.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     */
+    explicit QueueServiceClient(
+        const std::string& serviceUrl,
+        std::shared_ptr<StorageSharedKeyCredential> credential,
+        const QueueClientOptions& options = QueueClientOptions());
+
+    /**
+     * @brief Initialize a new instance of QueueServiceClient.
+     *
+     * @param serviceUrl A URL referencing the queue service that is the target of this client.
+     * @param credential The token credential used to sign requests.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     */
+    explicit QueueServiceClient(
+        const std::string& serviceUrl,
+        std::shared_ptr<Core::Credentials::TokenCredential> credential,
+        const QueueClientOptions& options = QueueClientOptions());
+
+    /**
+     * @brief Initialize a new instance of QueueServiceClient.
+     *
+     * @param serviceUrl A URL referencing the queue service that is the target of this client, and
+     * includes a shared access signature if it needs one.
+     * @param options Optional client options that define the transport pipeline policies for
+     * authentication, retries, etc., that are applied to every request.
+     */
+    explicit QueueServiceClient(
+        const std::string& serviceUrl,
+        const QueueClientOptions& options = QueueClientOptions());
+
+    /**
+     * @brief Creates a new QueueClient object with the queue name appended to the URL of this
+     * QueueServiceClient. The new QueueClient uses the same request policy pipeline as this
+     * QueueServiceClient.
+     *
+     * @param queueName The name of the queue to reference.
+     * @return A new QueueClient instance.
+     */
+    QueueClient GetQueueClient(const std::string& queueName) const;
+
+    /**
+     * @brief Gets the queue service's primary URL endpoint.
+     *
+     * @return The queue service's primary URL endpoint.
+     */
+    std::string GetUrl() const { return m_serviceUrl.GetAbsoluteUrl(); }
+
+    /**
+     * @brief Returns a paginated collection of the queues in the storage account. Enumerating the
+     * queues may make multiple requests to the service while fetching all the values.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return ListQueuesPagedResponse describing the queues in the storage account.
+     */
+    ListQueuesPagedResponse ListQueues(
+        const ListQueuesOptions& options = ListQueuesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Sets properties for a storage account's Queue service endpoint, including properties
+     * for Storage Analytics and CORS (Cross-Origin Resource Sharing) rules.
+     *
+     * @param properties The queue service properties.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A SetServicePropertiesResult on successfully setting the properties.
+     */
+    Azure::Response<Models::SetServicePropertiesResult> SetProperties(
+        Models::QueueServiceProperties properties,
+        const SetServicePropertiesOptions& options = SetServicePropertiesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Gets the properties of a storage account's queue service, including properties for
+     * Storage Analytics and CORS (Cross-Origin Resource Sharing) rules.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A QueueServiceProperties describing the service properties.
+     */
+    Azure::Response<Models::QueueServiceProperties> GetProperties(
+        const GetServicePropertiesOptions& options = GetServicePropertiesOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Retrieves statistics related to replication for the Queue service. It is only
+     * available on the secondary location endpoint when read-access geo-redundant replication is
+     * enabled for the storage account.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A ServiceStatistics describing the service replication statistics.
+     */
+    Azure::Response<Models::ServiceStatistics> GetStatistics(
+        const GetServiceStatisticsOptions& options = GetServiceStatisticsOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+  private:
+    Azure::Core::Url m_serviceUrl;
+    std::shared_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    QueueMessageEncoding m_messageEncoding = QueueMessageEncoding::None;
+  };
+
+}}} // namespace Azure::Storage::Queues
@@ -0,0 +1,360 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/queues/queue_client.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+
+#include <azure/core/base64.hpp>
+#include <azure/core/http/policies/policy.hpp>
+#include <azure/core/io/body_stream.hpp>
+#include <azure/storage/common/internal/async_operation.hpp>
+#include <azure/storage/common/internal/constants.hpp>
+#include <azure/storage/common/internal/shared_key_policy.hpp>
+#include <azure/storage/common/internal/storage_per_retry_policy.hpp>
+#include <azure/storage/common/internal/storage_service_version_policy.hpp>
+#include <azure/storage/common/storage_common.hpp>
+
+#include "private/package_version.hpp"
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  namespace {
+    // Decodes Base64 into the string holding it, whose decoded content is never longer.
+    void Base64DecodeInPlace(std::string& text)
+    {
+      try
+      {
+        text.resize(Azure::Core::Convert::Base64Decode(
+            text.data(), text.length(), reinterpret_cast<uint8_t*>(&text[0]), text.length()));
+      }
+      catch (const std::invalid_argument&)
+      {
+        throw std::runtime_error("The content of the message isn't valid Base64.");
+      }
+    }
+
+    // Gets the messages received, decoded with QueueMessageEncoding::Base64.
+    Azure::Response<Models::ReceivedMessages> CreateReceivedMessagesResponse(
+        Azure::Response<Models::_detail::ReceiveMessagesResult> response,
+        QueueMessageEncoding messageEncoding)
+    {
+      Models::ReceivedMessages ret;
+      ret.Messages = std::move(response.Value.Messages);
+      if (messageEncoding == QueueMessageEncoding::Base64)
+      {
+        for (auto& message : ret.Messages)
+        {
+          Base64DecodeInPlace(message.Body);
+        }
+      }
+      return Azure::Response<Models::ReceivedMessages>(
+          std::move(ret), std::move(response.RawResponse));
+    }
+  } // namespace
+
+  QueueClient QueueClient::CreateFromConnectionString(
+      const std::string& connectionString,
+      const std::string& queueName,
+      const QueueClientOptions& options)
+  {
+    auto parsedConnectionString = _internal::ParseConnectionString(connectionString);
+    auto queueUrl = std::move(parsedConnectionString.QueueServiceUrl);
+    queueUrl.AppendPath(_internal::UrlEncodePath(queueName));
+
+    if (parsedConnectionString.KeyCredential)
+    {
+      return QueueClient(queueUrl.GetAbsoluteUrl(), parsedConnectionString.KeyCredential, options);
+    }
+    else
+    {
+      return QueueClient(queueUrl.GetAbsoluteUrl(), options);
+    }
+  }
+
+  QueueClient::QueueClient(
+      const std::string& queueUrl,
+      std::shared_ptr<StorageSharedKeyCredential> credential,
+      const QueueClientOptions& options)
+      : m_queueUrl(queueUrl), m_messageEncoding(options.MessageEncoding)
+  {
+    QueueClientOptions newOptions = options;
+    newOptions.PerRetryPolicies.emplace_back(
+        std::make_unique<_internal::SharedKeyPolicy>(credential));
+
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
+    perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
+    perOperationPolicies.emplace_back(
+        std::make_unique<_internal::StorageServiceVersionPolicy>(newOptions.ApiVersion));
+    m_pipeline = std::make_shared<Azure::Core::Http::_internal::HttpPipeline>(
+        newOptions,
+        _internal::QueueServicePackageName,
+        _detail::PackageVersion::ToString(),
+        std::move(perRetryPolicies),
+        std::move(perOperationPolicies));
+  }
+
+  QueueClient::QueueClient(
+      const std::string& queueUrl,
+      std::shared_ptr<Core::Credentials::TokenCredential> credential,
+      const QueueClientOptions& options)
+      : m_queueUrl(queueUrl), m_messageEncoding(options.MessageEncoding)
+  {
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
+    perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
+    {
+      Azure::Core::Credentials::TokenRequestContext tokenContext;
+      tokenContext.Scopes.emplace_back(_internal::StorageScope);
+      perRetryPolicies.emplace_back(
+          std::make_unique<Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicy>(
+              credential, tokenContext));
+    }
+    perOperationPolicies.emplace_back(
+        std::make_unique<_internal::StorageServiceVersionPolicy>(options.ApiVersion));
+    m_pipeline = std::make_shared<Azure::Core::Http::_internal::HttpPipeline>(
+        options,
+        _internal::QueueServicePackageName,
+        _detail::PackageVersion::ToString(),
+        std::move(perRetryPolicies),
+        std::move(perOperationPolicies));
+  }
+
+  QueueClient::QueueClient(const std::string& queueUrl, const QueueClientOptions& options)
+      : m_queueUrl(queueUrl), m_messageEncoding(options.MessageEncoding)
+  {
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
+    perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
+    perOperationPolicies.emplace_back(
+        std::make_unique<_internal::StorageServiceVersionPolicy>(options.ApiVersion));
+    m_pipeline = std::make_shared<Azure::Core::Http::_internal::HttpPipeline>(
+        options,
+        _internal::QueueServicePackageName,
+        _detail::PackageVersion::ToString(),
+        std::move(perRetryPolicies),
+        std::move(perOperationPolicies));
+  }
+
+  Azure::Response<Models::CreateQueueResult> QueueClient::Create(
+      const CreateQueueOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    _detail::QueueRestClient::Queue::CreateQueueOptions protocolLayerOptions;
+    protocolLayerOptions.Metadata = options.Metadata;
+    return _detail::QueueRestClient::Queue::Create(
+        *m_pipeline, m_queueUrl, protocolLayerOptions, context);
+  }
+
+  Azure::Response<Models::DeleteQueueResult> QueueClient::Delete(
+      const DeleteQueueOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    (void)options;
+    _detail::QueueRestClient::Queue::DeleteQueueOptions protocolLayerOptions;
+    return _detail::QueueRestClient::Queue::Delete(
+        *m_pipeline, m_queueUrl, protocolLayerOptions, context);
+  }
+
+  Azure::Response<Models::QueueProperties> QueueClient::GetProperties(
+      const GetQueuePropertiesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    (void)options;
+    _detail::QueueRestClient::Queue::GetQueuePropertiesOptions protocolLayerOptions;
+    return _detail::QueueRestClient::Queue::GetProperties(
+        *m_pipeline, m_queueUrl, protocolLayerOptions, context);
+  }
+
+  Azure::Response<Models::SetQueueMetadataResult> QueueClient::SetMetadata(
+      Storage::Metadata metadata,
+      const SetQueueMetadataOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    (void)options;
+    _detail::QueueRestClient::Queue::SetQueueMetadataOptions protocolLayerOptions;
+    protocolLayerOptions.Metadata = std::move(metadata);
+    return _detail::QueueRestClient::Queue::SetMetadata(
+        *m_pipeline, m_queueUrl, protocolLayerOptions, context);
+  }
+
+  Azure::Response<Models::SendMessageResult> QueueClient::SendMessage(
+      std::string messageText,
+      const SendMessageOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    auto protocolLayerOptions = GetSendMessageProtocolLayerOptions(std::move(messageText), options);
+    auto messagesUrl = m_queueUrl;
+    messagesUrl.AppendPath("messages");
+    return _detail::QueueRestClient::Queue::SendMessage(
+        *m_pipeline, messagesUrl, protocolLayerOptions, context);
+  }
+
+  void QueueClient::SendMessageAsync(
+      std::string messageText,
+      const SendMessageOptions& options,
+      const Azure::Core::Context& context,
+      Azure::Core::ResponseCallback<Models::SendMessageResult> callback) const
+  {
+    auto protocolLayerOptions = GetSendMessageProtocolLayerOptions(std::move(messageText), options);
+    auto messagesUrl = m_queueUrl;
+    messagesUrl.AppendPath("messages");
+    // The request body is kept alive by the function creating the response.
+    auto body = std::make_shared<std::string>(
+        _detail::QueueRestClient::Queue::SendMessageCreateBody(protocolLayerOptions));
+    auto bodyStream = std::make_shared<Azure::Core::IO::MemoryBodyStream>(
+        reinterpret_cast<const uint8_t*>(body->data()), body->length());
+    _internal::SendAsync<Models::SendMessageResult>(
+        m_pipeline,
+        _detail::QueueRestClient::Queue::SendMessageCreateMessage(
+            messagesUrl, *bodyStream, protocolLayerOptions),
+        context,
+        [body, bodyStream, context](std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse) {
+          return _detail::QueueRestClient::Queue::SendMessageCreateResponse(
+              std::move(rawResponse), context);
+        },
+        std::move(callback));
+  }
+
+  Azure::Response<Models::ReceivedMessages> QueueClient::ReceiveMessages(
+      const ReceiveMessagesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    auto messagesUrl = m_queueUrl;
+    messagesUrl.AppendPath("messages");
+    return CreateReceivedMessagesResponse(
+        _detail::QueueRestClient::Queue::ReceiveMessages(
+            *m_pipeline, messagesUrl, GetReceiveMessagesProtocolLayerOptions(options), context),
+        m_messageEncoding);
+  }
+
+  void QueueClient::ReceiveMessagesAsync(
+      const ReceiveMessagesOptions& options,
+      const Azure::Core::Context& context,
+      Azure::Core::ResponseCallback<Models::ReceivedMessages> callback) const
+  {
+    auto messagesUrl = m_queueUrl;
+    messagesUrl.AppendPath("messages");
+    const auto messageEncoding = m_messageEncoding;
+    _internal::SendAsync<Models::ReceivedMessages>(
+        m_pipeline,
+        _detail::QueueRestClient::Queue::ReceiveMessagesCreateMessage(
+            messagesUrl, GetReceiveMessagesProtocolLayerOptions(options)),
+        context,
+        [messageEncoding, context](std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse) {
+          return CreateReceivedMessagesResponse(
+              _detail::QueueRestClient::Queue::ReceiveMessagesCreateResponse(
+                  std::move(rawResponse), context),
+              messageEncoding);
+        },
+        std::move(callback));
+  }
+
+  Azure::Response<Models::PeekedMessages> QueueClient::PeekMessages(
+      const PeekMessagesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    _detail::QueueRestClient::Queue::PeekMessagesOptions protocolLayerOptions;
+    protocolLayerOptions.MaxMessages = options.MaxMessages;
+    auto messagesUrl = m_queueUrl;
+    messagesUrl.AppendPath("messages");
+    auto response = _detail::QueueRestClient::Queue::PeekMessages(
+        *m_pipeline, messagesUrl, protocolLayerOptions, context);
+    Models::PeekedMessages ret;
+    ret.Messages = std::move(response.Value.Messages);
+    if (m_messageEncoding == QueueMessageEncoding::Base64)
+    {
+      for (auto& message : ret.Messages)
+      {
+        Base64DecodeInPlace(message.Body);
+      }
+    }
+    return Azure::Response<Models::PeekedMessages>(
+        std::move(ret), std::move(response.RawResponse));
+  }
+
+  Azure::Response<Models::UpdateMessageResult> QueueClient::UpdateMessage(
+      const std::string& messageId,
+      const std::string& popReceipt,
+      std::string messageText,
+      std::chrono::seconds visibilityTimeout,
+      const UpdateMessageOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    (void)options;
+    _detail::QueueRestClient::Queue::UpdateMessageOptions protocolLayerOptions;
+    protocolLayerOptions.Body = std::move(messageText);
+    protocolLayerOptions.EncodeBodyAsBase64 = m_messageEncoding == QueueMessageEncoding::Base64;
+    protocolLayerOptions.PopReceipt = popReceipt;
+    protocolLayerOptions.VisibilityTimeout = static_cast<int32_t>(visibilityTimeout.count());
+    auto messageUrl = m_queueUrl;
+    messageUrl.AppendPath("messages");
+    messageUrl.AppendPath(_internal::UrlEncodePath(messageId));
+    return _detail::QueueRestClient::Queue::UpdateMessage(
+        *m_pipeline, messageUrl, protocolLayerOptions, context);
+  }
+
+  Azure::Response<Models::DeleteMessageResult> QueueClient::DeleteMessage(
+      const std::string& messageId,
+      const std::string& popReceipt,
+      const DeleteMessageOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    (void)options;
+    _detail::QueueRestClient::Queue::DeleteMessageOptions protocolLayerOptions;
+    protocolLayerOptions.PopReceipt = popReceipt;
+    auto messageUrl = m_queueUrl;
+    messageUrl.AppendPath("messages");
+    messageUrl.AppendPath(_internal::UrlEncodePath(messageId));
+    return _detail::QueueRestClient::Queue::DeleteMessage(
+        *m_pipeline, messageUrl, protocolLayerOptions, context);
+  }
+
+  Azure::Response<Models::ClearMessagesResult> QueueClient::ClearMessages(
+      const ClearMessagesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    (void)options;
+    _detail::QueueRestClient::Queue::ClearMessagesOptions protocolLayerOptions;
+    auto messagesUrl = m_queueUrl;
+    messagesUrl.AppendPath("messages");
+    return _detail::QueueRestClient::Queue::ClearMessages(
+        *m_pipeline, messagesUrl, protocolLayerOptions, context);
+  }
+
+  _detail::QueueRestClient::Queue::SendMessageOptions
+  QueueClient::GetSendMessageProtocolLayerOptions(
+      std::string messageText,
+      const SendMessageOptions& options) const
+  {
+    _detail::QueueRestClient::Queue::SendMessageOptions protocolLayerOptions;
+    protocolLayerOptions.Body = std::move(messageText);
+    protocolLayerOptions.EncodeBodyAsBase64 = m_messageEncoding == QueueMessageEncoding::Base64;
+    if (options.VisibilityTimeout.HasValue())
+    {
+      protocolLayerOptions.VisibilityTimeout
+          = static_cast<int32_t>(options.VisibilityTimeout.Value().count());
+    }
+    if (options.TimeToLive.HasValue())
+    {
+      protocolLayerOptions.TimeToLive = static_cast<int32_t>(options.TimeToLive.Value().count());
+    }
+    return protocolLayerOptions;
+  }
+
+  _detail::QueueRestClient::Queue::ReceiveMessagesOptions
+  QueueClient::GetReceiveMessagesProtocolLayerOptions(const ReceiveMessagesOptions& options) const
+  {
+    _detail::QueueRestClient::Queue::ReceiveMessagesOptions protocolLayerOptions;
+    protocolLayerOptions.MaxMessages = options.MaxMessages;
+    if (options.VisibilityTimeout.HasValue())
+    {
+      protocolLayerOptions.VisibilityTimeout
+          = static_cast<int32_t>(options.VisibilityTimeout.Value().count());
+    }
+    return protocolLayerOptions;
+  }
+
+}}} // namespace Azure::Storage::Queues
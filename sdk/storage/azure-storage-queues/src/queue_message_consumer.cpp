@@ -0,0 +1,204 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/queues/queue_message_consumer.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <azure/storage/common/internal/thread_pool.hpp>
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  QueueMessageConsumer::QueueMessageConsumer(
+      QueueClient queueClient,
+      const QueueMessageConsumerOptions& options)
+      : m_queueClient(std::move(queueClient)), m_options(options)
+  {
+    if (m_options.MessagesPerReceive <= 0 || m_options.MessagesPerReceive > 32)
+    {
+      throw std::invalid_argument("MessagesPerReceive must be between 1 and 32.");
+    }
+  }
+
+  QueueMessageConsumer::~QueueMessageConsumer()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_stopping = true;
+    m_finished.wait(lock, [&]() {
+      return m_numReceiving == 0 && m_numDeleting == 0 && m_pendingDeletes.empty();
+    });
+  }
+
+  Azure::Nullable<Models::QueueMessage> QueueMessageConsumer::Receive(
+      std::chrono::milliseconds timeout)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+      while (!m_messages.empty())
+      {
+        auto message = std::move(m_messages.front());
+        m_messages.pop_front();
+        // Its pop receipt is stale once the message is visible again, another consumer may have
+        // it.
+        if (message.NextVisibleOn <= std::chrono::system_clock::now())
+        {
+          continue;
+        }
+        StartReceives();
+        return Azure::Nullable<Models::QueueMessage>(std::move(message));
+      }
+      if (m_receiveError)
+      {
+        auto error = m_receiveError;
+        m_receiveError = nullptr;
+        std::rethrow_exception(error);
+      }
+
+      StartReceives();
+      const auto now = std::chrono::steady_clock::now();
+      if (now >= deadline)
+      {
+        return Azure::Nullable<Models::QueueMessage>();
+      }
+      // Wakes up when the queue can be received from again after it was found empty.
+      auto wakeUpTime = deadline;
+      if (m_numReceiving == 0 && m_nextReceiveTime > now)
+      {
+        wakeUpTime = std::min(deadline, m_nextReceiveTime);
+      }
+      m_received.wait_until(lock, wakeUpTime);
+    }
+  }
+
+  void QueueMessageConsumer::Delete(const Models::QueueMessage& message)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pendingDeletes.emplace_back(message.MessageId, message.PopReceipt);
+    StartDeletes();
+  }
+
+  void QueueMessageConsumer::Flush()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finished.wait(lock, [&]() { return m_numDeleting == 0 && m_pendingDeletes.empty(); });
+    if (m_deleteError)
+    {
+      auto error = m_deleteError;
+      m_deleteError = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  void QueueMessageConsumer::StartReceives()
+  {
+    const size_t messagesPerReceive = static_cast<size_t>(m_options.MessagesPerReceive);
+    const size_t maxBufferedMessages = std::max(m_options.MaxBufferedMessages, messagesPerReceive);
+    while (!m_stopping && !m_receiveError
+           && m_numReceiving < std::max(m_options.ReceiveConcurrency, 1)
+           && m_messages.size() + static_cast<size_t>(m_numReceiving + 1) * messagesPerReceive
+               <= maxBufferedMessages
+           && std::chrono::steady_clock::now() >= m_nextReceiveTime)
+    {
+      ++m_numReceiving;
+      _internal::ThreadPool::GetDefault().Submit([this]() { ReceiveBatch(); });
+    }
+  }
+
+  void QueueMessageConsumer::StartDeletes()
+  {
+    const size_t batchSize = static_cast<size_t>(std::max(m_options.DeleteBatchSize, 1));
+    while (!m_pendingDeletes.empty() && m_numDeleting < std::max(m_options.DeleteConcurrency, 1))
+    {
+      // The task must be copyable, so it shares the batch instead of owning it.
+      auto batch = std::make_shared<std::deque<std::pair<std::string, std::string>>>();
+      while (!m_pendingDeletes.empty() && batch->size() < batchSize)
+      {
+        batch->push_back(std::move(m_pendingDeletes.front()));
+        m_pendingDeletes.pop_front();
+      }
+      ++m_numDeleting;
+      _internal::ThreadPool::GetDefault().Submit([this, batch]() { DeleteBatch(*batch); });
+    }
+  }
+
+  void QueueMessageConsumer::ReceiveBatch()
+  {
+    std::vector<Models::QueueMessage> messages;
+    std::exception_ptr error;
+    try
+    {
+      ReceiveMessagesOptions receiveOptions;
+      receiveOptions.MaxMessages = m_options.MessagesPerReceive;
+      receiveOptions.VisibilityTimeout = m_options.VisibilityTimeout;
+      messages = m_queueClient.ReceiveMessages(receiveOptions).Value.Messages;
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_numReceiving;
+    if (error)
+    {
+      if (!m_receiveError)
+      {
+        m_receiveError = error;
+      }
+    }
+    else if (messages.empty())
+    {
+      m_emptyQueueDelay = m_emptyQueueDelay.count() == 0
+          ? m_options.EmptyQueueDelay
+          : std::min(m_emptyQueueDelay * 2, m_options.MaxEmptyQueueDelay);
+      m_nextReceiveTime = std::chrono::steady_clock::now() + m_emptyQueueDelay;
+    }
+    else
+    {
+      m_emptyQueueDelay = std::chrono::milliseconds(0);
+      std::move(messages.begin(), messages.end(), std::back_inserter(m_messages));
+    }
+    // Keeps the buffer filled while the queue has messages.
+    StartReceives();
+    // Notified under the lock, the consumer may be destroyed as soon as it's released.
+    m_received.notify_all();
+    m_finished.notify_all();
+  }
+
+  void QueueMessageConsumer::DeleteBatch(
+      const std::deque<std::pair<std::string, std::string>>& messages)
+  {
+    std::exception_ptr error;
+    for (const auto& message : messages)
+    {
+      try
+      {
+        m_queueClient.DeleteMessage(message.first, message.second);
+      }
+      catch (...)
+      {
+        if (!error)
+        {
+          error = std::current_exception();
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_numDeleting;
+    if (error && !m_deleteError)
+    {
+      m_deleteError = error;
+    }
+    StartDeletes();
+    // Notified under the lock, the consumer may be destroyed as soon as it's released.
+    m_finished.notify_all();
+  }
+
+}}} // namespace Azure::Storage::Queues
@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/queues/queue_message_lease_manager.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  QueueMessageLeaseManager::QueueMessageLeaseManager(
+      QueueClient queueClient,
+      const QueueMessageLeaseManagerOptions& options)
+      : m_queueClient(std::move(queueClient)), m_options(options),
+        m_leaseKeeper(options.KeeperOptions)
+  {
+    if (m_options.VisibilityTimeout.count() <= 0)
+    {
+      throw std::invalid_argument("VisibilityTimeout must be positive.");
+    }
+  }
+
+  QueueMessageLeaseManager::~QueueMessageLeaseManager() { Stop(); }
+
+  int64_t QueueMessageLeaseManager::Add(
+      const Models::QueueMessage& message,
+      LostMessageHandler onLost)
+  {
+    auto leasedMessage = std::make_shared<LeasedMessage>();
+    leasedMessage->MessageId = message.MessageId;
+    leasedMessage->MessageText = message.Body;
+    leasedMessage->PopReceipt = message.PopReceipt;
+
+    auto extend = [this, leasedMessage](const Azure::Core::Context& context) {
+      std::lock_guard<std::mutex> guard(leasedMessage->Mutex);
+      if (leasedMessage->Done)
+      {
+        return;
+      }
+      auto response = m_queueClient.UpdateMessage(
+          leasedMessage->MessageId,
+          leasedMessage->PopReceipt,
+          leasedMessage->MessageText,
+          m_options.VisibilityTimeout,
+          UpdateMessageOptions(),
+          context);
+      leasedMessage->PopReceipt = std::move(response.Value.PopReceipt);
+    };
+    auto lost = [this, leasedMessage, onLost](std::exception_ptr error) {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto ite = m_messages.find(leasedMessage->Key);
+        if (ite != m_messages.end() && ite->second == leasedMessage)
+        {
+          m_messages.erase(ite);
+        }
+      }
+      {
+        std::lock_guard<std::mutex> guard(leasedMessage->Mutex);
+        leasedMessage->Done = true;
+      }
+      if (onLost)
+      {
+        onLost(leasedMessage->MessageId, error);
+      }
+    };
+
+    // Locked while the message is added, so that it's known by the time it's lost.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    leasedMessage->Key
+        = m_leaseKeeper.AddLease(std::move(extend), m_options.VisibilityTimeout, std::move(lost));
+    m_messages.emplace(leasedMessage->Key, leasedMessage);
+    return leasedMessage->Key;
+  }
+
+  std::shared_ptr<QueueMessageLeaseManager::LeasedMessage> QueueMessageLeaseManager::Remove(
+      int64_t messageKey)
+  {
+    std::shared_ptr<LeasedMessage> leasedMessage;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto ite = m_messages.find(messageKey);
+      if (ite == m_messages.end())
+      {
+        throw std::invalid_argument("The message isn't extended by this manager.");
+      }
+      leasedMessage = std::move(ite->second);
+      m_messages.erase(ite);
+    }
+    m_leaseKeeper.RemoveLease(messageKey);
+    // Waits for an extension in progress.
+    std::lock_guard<std::mutex> guard(leasedMessage->Mutex);
+    leasedMessage->Done = true;
+    return leasedMessage;
+  }
+
+  Azure::Response<Models::DeleteMessageResult> QueueMessageLeaseManager::Complete(
+      int64_t messageKey,
+      const Azure::Core::Context& context)
+  {
+    auto leasedMessage = Remove(messageKey);
+    return m_queueClient.DeleteMessage(
+        leasedMessage->MessageId, leasedMessage->PopReceipt, DeleteMessageOptions(), context);
+  }
+
+  std::string QueueMessageLeaseManager::Release(int64_t messageKey)
+  {
+    return Remove(messageKey)->PopReceipt;
+  }
+
+  void QueueMessageLeaseManager::Stop() { m_leaseKeeper.Stop(); }
+
+}}} // namespace Azure::Storage::Queues
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/queues/queue_message_producer.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <azure/storage/common/internal/thread_pool.hpp>
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  QueueMessageProducer::QueueMessageProducer(
+      QueueClient queueClient,
+      const QueueMessageProducerOptions& options)
+      : m_queueClient(std::move(queueClient)), m_options(options)
+  {
+    if (m_options.Concurrency <= 0)
+    {
+      throw std::invalid_argument("Concurrency must be positive.");
+    }
+  }
+
+  QueueMessageProducer::~QueueMessageProducer() { Flush(); }
+
+  std::future<Models::SendMessageResult> QueueMessageProducer::Send(std::string messageText)
+  {
+    PendingMessage message;
+    message.MessageText = std::move(messageText);
+    auto future = message.Sent.get_future();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pendingMessages.push_back(std::move(message));
+    StartSends();
+    return future;
+  }
+
+  void QueueMessageProducer::Flush()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_sendFinished.wait(lock, [&]() { return m_pendingMessages.empty() && m_numSending == 0; });
+  }
+
+  void QueueMessageProducer::StartSends()
+  {
+    // A task sends the messages queued behind its own, so one is started per message only up to
+    // the concurrency.
+    while (m_numSending < m_options.Concurrency
+           && static_cast<size_t>(m_numSending) < m_pendingMessages.size())
+    {
+      ++m_numSending;
+      _internal::ThreadPool::GetDefault().Submit([this]() { SendMessages(); });
+    }
+  }
+
+  void QueueMessageProducer::SendMessages()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_pendingMessages.empty())
+    {
+      auto message = std::move(m_pendingMessages.front());
+      m_pendingMessages.pop_front();
+      lock.unlock();
+      try
+      {
+        message.Sent.set_value(
+            m_queueClient.SendMessage(std::move(message.MessageText), m_options.MessageOptions)
+                .Value);
+      }
+      catch (...)
+      {
+        message.Sent.set_exception(std::current_exception());
+      }
+      lock.lock();
+    }
+    --m_numSending;
+    // Notified under the lock, the producer may be destroyed as soon as it's released.
+    m_sendFinished.notify_all();
+  }
+
+}}} // namespace Azure::Storage::Queues
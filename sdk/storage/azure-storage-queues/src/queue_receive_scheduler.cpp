@@ -0,0 +1,172 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/queues/queue_receive_scheduler.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <azure/storage/common/internal/thread_pool.hpp>
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  QueueReceiveScheduler::QueueReceiveScheduler(const QueueReceiveSchedulerOptions& options)
+      : m_options(options)
+  {
+    if (m_options.MessagesPerReceive <= 0 || m_options.MessagesPerReceive > 32)
+    {
+      throw std::invalid_argument("MessagesPerReceive must be between 1 and 32.");
+    }
+    if (m_options.MinIdleDelay.count() <= 0 || m_options.MaxIdleDelay < m_options.MinIdleDelay)
+    {
+      throw std::invalid_argument(
+          "MinIdleDelay must be positive and MaxIdleDelay must not be shorter.");
+    }
+    m_timerThread = std::thread([this]() { RunTimer(); });
+  }
+
+  QueueReceiveScheduler::~QueueReceiveScheduler() { Stop(); }
+
+  void QueueReceiveScheduler::AddQueue(
+      QueueClient queueClient,
+      MessageHandler messageHandler,
+      ErrorHandler errorHandler)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stopping)
+    {
+      throw std::runtime_error("The scheduler is stopped.");
+    }
+    m_queues.push_back(std::make_unique<ScheduledQueue>(
+        std::move(queueClient), std::move(messageHandler), std::move(errorHandler)));
+    StartReceives(*m_queues.back());
+  }
+
+  void QueueReceiveScheduler::Stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+      m_stateChanged.notify_all();
+    }
+    if (m_timerThread.joinable())
+    {
+      m_timerThread.join();
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_stateChanged.wait(lock, [&]() { return m_numRunning == 0; });
+  }
+
+  void QueueReceiveScheduler::StartReceives(ScheduledQueue& queue)
+  {
+    if (m_stopping || std::chrono::steady_clock::now() < queue.NextReceiveTime)
+    {
+      return;
+    }
+    // Ramps up only while the queue has more messages than a receive call returns.
+    const int32_t maxReceives
+        = queue.LastReceiveFull ? std::max(m_options.MaxReceivesPerQueue, 1) : 1;
+    while (queue.NumReceiving < maxReceives)
+    {
+      ++queue.NumReceiving;
+      ++m_numRunning;
+      ScheduledQueue* scheduledQueue = &queue;
+      _internal::ThreadPool::GetDefault().Submit(
+          [this, scheduledQueue]() { Receive(*scheduledQueue); });
+    }
+  }
+
+  void QueueReceiveScheduler::Receive(ScheduledQueue& queue)
+  {
+    std::vector<Models::QueueMessage> messages;
+    std::exception_ptr error;
+    try
+    {
+      ReceiveMessagesOptions receiveOptions;
+      receiveOptions.MaxMessages = m_options.MessagesPerReceive;
+      receiveOptions.VisibilityTimeout = m_options.VisibilityTimeout;
+      messages = queue.Client.ReceiveMessages(receiveOptions).Value.Messages;
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      --queue.NumReceiving;
+      const auto now = std::chrono::steady_clock::now();
+      if (error || messages.empty())
+      {
+        queue.IdleDelay = queue.IdleDelay.count() == 0
+            ? m_options.MinIdleDelay
+            : std::min(queue.IdleDelay * 2, m_options.MaxIdleDelay);
+        queue.NextReceiveTime = now + queue.IdleDelay;
+        queue.LastReceiveFull = false;
+      }
+      else
+      {
+        queue.IdleDelay = std::chrono::milliseconds(0);
+        queue.NextReceiveTime = now;
+        queue.LastReceiveFull
+            = messages.size() >= static_cast<size_t>(m_options.MessagesPerReceive);
+      }
+      // The next receive calls are outstanding while the messages are handled.
+      StartReceives(queue);
+      m_stateChanged.notify_all();
+    }
+
+    try
+    {
+      if (error)
+      {
+        if (queue.OnError)
+        {
+          queue.OnError(error);
+        }
+      }
+      else if (!messages.empty())
+      {
+        queue.OnMessages(std::move(messages));
+      }
+    }
+    catch (...)
+    {
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_numRunning;
+    // Notified under the lock, the scheduler may be destroyed as soon as it's released.
+    m_stateChanged.notify_all();
+  }
+
+  void QueueReceiveScheduler::RunTimer()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping)
+    {
+      // Sleeps until the earliest idle queue is due, the queues being received from are started
+      // again as their receive calls finish.
+      bool hasIdleQueue = false;
+      std::chrono::steady_clock::time_point wakeUpTime;
+      for (auto& queue : m_queues)
+      {
+        StartReceives(*queue);
+        if (queue->NumReceiving == 0 && (!hasIdleQueue || queue->NextReceiveTime < wakeUpTime))
+        {
+          hasIdleQueue = true;
+          wakeUpTime = queue->NextReceiveTime;
+        }
+      }
+      if (hasIdleQueue)
+      {
+        m_stateChanged.wait_until(lock, wakeUpTime);
+      }
+      else
+      {
+        m_stateChanged.wait(lock);
+      }
+    }
+  }
+
+}}} // namespace Azure::Storage::Queues
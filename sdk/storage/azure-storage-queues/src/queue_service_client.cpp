@@ -0,0 +1,177 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/queues/queue_service_client.hpp"
+
+#include <azure/core/http/policies/policy.hpp>
+#include <azure/storage/common/internal/constants.hpp>
+#include <azure/storage/common/internal/shared_key_policy.hpp>
+#include <azure/storage/common/internal/storage_per_retry_policy.hpp>
+#include <azure/storage/common/internal/storage_service_version_policy.hpp>
+#include <azure/storage/common/storage_common.hpp>
+
+#include "azure/storage/queues/queue_client.hpp"
+
+#include "private/package_version.hpp"
+
+namespace Azure { namespace Storage { namespace Queues {
+
+  QueueServiceClient QueueServiceClient::CreateFromConnectionString(
+      const std::string& connectionString,
+      const QueueClientOptions& options)
+  {
+    auto parsedConnectionString = _internal::ParseConnectionString(connectionString);
+    auto serviceUrl = std::move(parsedConnectionString.QueueServiceUrl);
+
+    if (parsedConnectionString.KeyCredential)
+    {
+      return QueueServiceClient(
+          serviceUrl.GetAbsoluteUrl(), parsedConnectionString.KeyCredential, options);
+    }
+    else
+    {
+      return QueueServiceClient(serviceUrl.GetAbsoluteUrl(), options);
+    }
+  }
+
+  QueueServiceClient::QueueServiceClient(
+      const std::string& serviceUrl,
+      std::shared_ptr<StorageSharedKeyCredential> credential,
+      const QueueClientOptions& options)
+      : m_serviceUrl(serviceUrl), m_messageEncoding(options.MessageEncoding)
+  {
+    QueueClientOptions newOptions = options;
+    newOptions.PerRetryPolicies.emplace_back(
+        std::make_unique<_internal::SharedKeyPolicy>(credential));
+
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
+    perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
+    perOperationPolicies.emplace_back(
+        std::make_unique<_internal::StorageServiceVersionPolicy>(newOptions.ApiVersion));
+    m_pipeline = std::make_shared<Azure::Core::Http::_internal::HttpPipeline>(
+        newOptions,
+        _internal::QueueServicePackageName,
+        _detail::PackageVersion::ToString(),
+        std::move(perRetryPolicies),
+        std::move(perOperationPolicies));
+  }
+
+  QueueServiceClient::QueueServiceClient(
+      const std::string& serviceUrl,
+      std::shared_ptr<Core::Credentials::TokenCredential> credential,
+      const QueueClientOptions& options)
+      : m_serviceUrl(serviceUrl), m_messageEncoding(options.MessageEncoding)
+  {
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
+    perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
+    {
+      Azure::Core::Credentials::TokenRequestContext tokenContext;
+      tokenContext.Scopes.emplace_back(_internal::StorageScope);
+      perRetryPolicies.emplace_back(
+          std::make_unique<Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicy>(
+              credential, tokenContext));
+    }
+    perOperationPolicies.emplace_back(
+        std::make_unique<_internal::StorageServiceVersionPolicy>(options.ApiVersion));
+    m_pipeline = std::make_shared<Azure::Core::Http::_internal::HttpPipeline>(
+        options,
+        _internal::QueueServicePackageName,
+        _detail::PackageVersion::ToString(),
+        std::move(perRetryPolicies),
+        std::move(perOperationPolicies));
+  }
+
+  QueueServiceClient::QueueServiceClient(
+      const std::string& serviceUrl,
+      const QueueClientOptions& options)
+      : m_serviceUrl(serviceUrl), m_messageEncoding(options.MessageEncoding)
+  {
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perRetryPolicies;
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> perOperationPolicies;
+    perRetryPolicies.emplace_back(std::make_unique<_internal::StoragePerRetryPolicy>());
+    perOperationPolicies.emplace_back(
+        std::make_unique<_internal::StorageServiceVersionPolicy>(options.ApiVersion));
+    m_pipeline = std::make_shared<Azure::Core::Http::_internal::HttpPipeline>(
+        options,
+        _internal::QueueServicePackageName,
+        _detail::PackageVersion::ToString(),
+        std::move(perRetryPolicies),
+        std::move(perOperationPolicies));
+  }
+
+  void ListQueuesPagedResponse::OnNextPage(const Azure::Core::Context& context)
+  {
+    m_operationOptions.ContinuationToken = NextPageToken;
+    *this = m_queueServiceClient->ListQueues(m_operationOptions, context);
+  }
+
+  QueueClient QueueServiceClient::GetQueueClient(const std::string& queueName) const
+  {
+    auto queueUrl = m_serviceUrl;
+    queueUrl.AppendPath(_internal::UrlEncodePath(queueName));
+    return QueueClient(std::move(queueUrl), m_pipeline, m_messageEncoding);
+  }
+
+  ListQueuesPagedResponse QueueServiceClient::ListQueues(
+      const ListQueuesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    _detail::QueueRestClient::Service::ListQueuesOptions protocolLayerOptions;
+    protocolLayerOptions.Prefix = options.Prefix;
+    if (options.ContinuationToken.HasValue() && !options.ContinuationToken.Value().empty())
+    {
+      protocolLayerOptions.ContinuationToken = options.ContinuationToken;
+    }
+    protocolLayerOptions.MaxResults = options.PageSizeHint;
+    protocolLayerOptions.Include = options.Include;
+    auto response = _detail::QueueRestClient::Service::ListQueues(
+        *m_pipeline, m_serviceUrl, protocolLayerOptions, context);
+
+    ListQueuesPagedResponse pagedResponse;
+    pagedResponse.ServiceEndpoint = std::move(response.Value.ServiceEndpoint);
+    pagedResponse.Prefix = std::move(response.Value.Prefix);
+    pagedResponse.Queues = std::move(response.Value.Items);
+    pagedResponse.m_queueServiceClient = std::make_shared<QueueServiceClient>(*this);
+    pagedResponse.m_operationOptions = options;
+    pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
+    pagedResponse.NextPageToken = std::move(response.Value.ContinuationToken);
+    pagedResponse.RawResponse = std::move(response.RawResponse);
+
+    return pagedResponse;
+  }
+
+  Azure::Response<Models::SetServicePropertiesResult> QueueServiceClient::SetProperties(
+      Models::QueueServiceProperties properties,
+      const SetServicePropertiesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    (void)options;
+    _detail::QueueRestClient::Service::SetServicePropertiesOptions protocolLayerOptions;
+    protocolLayerOptions.Properties = std::move(properties);
+    return _detail::QueueRestClient::Service::SetProperties(
+        *m_pipeline, m_serviceUrl, protocolLayerOptions, context);
+  }
+
+  Azure::Response<Models::QueueServiceProperties> QueueServiceClient::GetProperties(
+      const GetServicePropertiesOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    (void)options;
+    _detail::QueueRestClient::Service::GetServicePropertiesOptions protocolLayerOptions;
+    return _detail::QueueRestClient::Service::GetProperties(
+        *m_pipeline, m_serviceUrl, protocolLayerOptions, context);
+  }
+
+  Azure::Response<Models::ServiceStatistics> QueueServiceClient::GetStatistics(
+      const GetServiceStatisticsOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    (void)options;
+    _detail::QueueRestClient::Service::GetServiceStatisticsOptions protocolLayerOptions;
+    return _detail::QueueRestClient::Service::GetStatistics(
+        *m_pipeline, m_serviceUrl, protocolLayerOptions, context);
+  }
+
+}}} // namespace Azure::Storage::Queues
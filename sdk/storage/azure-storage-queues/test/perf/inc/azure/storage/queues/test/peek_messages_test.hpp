@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of peeking the messages of a queue.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+
+#include "azure/storage/queues/test/queue_base_test.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Queues { namespace Test {
+
+  /**
+   * @brief A test to measure peeking messages, which leaves them visible in the queue.
+   *
+   */
+  class PeekMessages : public Azure::Storage::Queues::Test::QueuesTest {
+  private:
+    Azure::Storage::Queues::PeekMessagesOptions m_peekOptions;
+
+  public:
+    /**
+     * @brief Construct a new PeekMessages test.
+     *
+     * @param options The test options.
+     */
+    PeekMessages(Azure::Perf::TestOptions options) : QueuesTest(options) {}
+
+    /**
+     * @brief The number of messages to send on setup is defined by a parameter.
+     *
+     */
+    void Setup() override
+    {
+      // Call base to create queue client
+      QueuesTest::Setup();
+
+      auto count = m_options.GetOptionOrDefault("Count", 32);
+      for (int i = 0; i < count; ++i)
+      {
+        m_queueClient->SendMessage(std::string(1024, 'm'));
+      }
+      m_peekOptions.MaxMessages = count;
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_queueClient->PeekMessages(m_peekOptions, context);
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Count", {"--count", "-c"}, "Number of messages to peek, up to 32. Default to 32.", 1}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "PeekMessages",
+          "Peek the messages of a queue.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Storage::Queues::Test::PeekMessages>(options);
+          }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Queues::Test
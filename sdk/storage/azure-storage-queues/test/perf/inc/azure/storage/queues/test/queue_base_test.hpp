@@ -0,0 +1,71 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Define the base behavior of the tests using a queue client.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/uuid.hpp>
+#include <azure/perf.hpp>
+
+#include <azure/storage/queues.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Queues { namespace Test {
+
+  /**
+   * @brief A base test that set up a queues performance test.
+   *
+   */
+  class QueuesTest : public Azure::Perf::PerfTest {
+  protected:
+    std::string m_queueName;
+    std::string m_connectionString;
+    std::unique_ptr<Azure::Storage::Queues::QueueClient> m_queueClient;
+
+  public:
+    /**
+     * @brief Create the queue client
+     *
+     */
+    void Setup() override
+    {
+      // Get connection string from env
+      const static std::string envConnectionString = std::getenv("STORAGE_CONNECTION_STRING");
+      m_connectionString = envConnectionString;
+
+      // Generate a random queue name.
+      m_queueName = "queue" + Azure::Core::Uuid::CreateUuid().ToString();
+
+      // Create client and queue
+      m_queueClient = std::make_unique<Azure::Storage::Queues::QueueClient>(
+          Azure::Storage::Queues::QueueClient::CreateFromConnectionString(
+              m_connectionString, m_queueName));
+      m_queueClient->Create();
+    }
+
+    void Cleanup() override { m_queueClient->Delete(); };
+
+    /**
+     * @brief Construct a new QueuesTest test.
+     *
+     * @param options The test options.
+     */
+    QueuesTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override { return {}; }
+  };
+
+}}}} // namespace Azure::Storage::Queues::Test
@@ -0,0 +1,82 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ * @brief Test the performance of sending a message to a queue.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+
+#include "azure/storage/queues/test/queue_base_test.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Queues { namespace Test {
+
+  /**
+   * @brief A test to measure sending a message.
+   *
+   */
+  class SendMessage : public Azure::Storage::Queues::Test::QueuesTest {
+  private:
+    std::string m_messageText;
+
+  public:
+    /**
+     * @brief Construct a new SendMessage test.
+     *
+     * @param options The test options.
+     */
+    SendMessage(Azure::Perf::TestOptions options) : QueuesTest(options) {}
+
+    /**
+     * @brief The size of the message is defined by a parameter.
+     *
+     */
+    void Setup() override
+    {
+      // Call base to create queue client
+      QueuesTest::Setup();
+
+      m_messageText = std::string(m_options.GetOptionOrDefault<size_t>("Size", 1024), 'm');
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_queueClient->SendMessage(m_messageText, {}, context);
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {{"Size", {"--size", "-s"}, "Size of the message (in bytes). Default to 1024.", 1}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {"SendMessage", "Send a message to a queue.", [](Azure::Perf::TestOptions options) {
+                return std::make_unique<Azure::Storage::Queues::Test::SendMessage>(options);
+              }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Queues::Test
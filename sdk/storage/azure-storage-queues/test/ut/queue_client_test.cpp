@@ -0,0 +1,358 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <azure/storage/queues.hpp>
+
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  class QueueClientTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+      m_queueClient = std::make_shared<Queues::QueueClient>(
+          Queues::QueueClient::CreateFromConnectionString(
+              StandardStorageConnectionString(), LowercaseRandomString()));
+      m_queueClient->Create();
+    }
+
+    void TearDown() override
+    {
+      if (m_queueClient)
+      {
+        m_queueClient->Delete();
+      }
+    }
+
+    std::shared_ptr<Queues::QueueClient> m_queueClient;
+  };
+
+  TEST_F(QueueClientTest, Metadata)
+  {
+    auto metadata = RandomMetadata();
+    m_queueClient->SetMetadata(metadata);
+    auto properties = m_queueClient->GetProperties().Value;
+    EXPECT_EQ(properties.Metadata, metadata);
+    EXPECT_EQ(properties.ApproximateMessageCount, 0);
+
+    auto serviceClient = Queues::QueueServiceClient::CreateFromConnectionString(
+        StandardStorageConnectionString());
+    Queues::ListQueuesOptions listOptions;
+    listOptions.Prefix = m_queueClient->GetUrl().substr(m_queueClient->GetUrl().rfind('/') + 1);
+    listOptions.Include = Queues::Models::ListQueuesIncludeFlags::Metadata;
+    auto listResponse = serviceClient.ListQueues(listOptions);
+    ASSERT_EQ(listResponse.Queues.size(), 1U);
+    EXPECT_EQ(listResponse.Queues[0].Metadata, metadata);
+  }
+
+  TEST_F(QueueClientTest, SendReceiveMessages)
+  {
+    const std::string messageText = RandomString();
+    auto sent = m_queueClient->SendMessage(messageText).Value;
+    EXPECT_FALSE(sent.MessageId.empty());
+
+    auto peeked = m_queueClient->PeekMessages().Value.Messages;
+    ASSERT_EQ(peeked.size(), 1U);
+    EXPECT_EQ(peeked[0].Body, messageText);
+
+    Queues::ReceiveMessagesOptions receiveOptions;
+    receiveOptions.MaxMessages = 32;
+    auto received = m_queueClient->ReceiveMessages(receiveOptions).Value.Messages;
+    ASSERT_EQ(received.size(), 1U);
+    EXPECT_EQ(received[0].MessageId, sent.MessageId);
+    EXPECT_EQ(received[0].Body, messageText);
+    EXPECT_EQ(received[0].DequeueCount, 1);
+
+    auto updated = m_queueClient
+                       ->UpdateMessage(
+                           received[0].MessageId,
+                           received[0].PopReceipt,
+                           messageText + messageText,
+                           std::chrono::seconds(0))
+                       .Value;
+    received = m_queueClient->ReceiveMessages().Value.Messages;
+    ASSERT_EQ(received.size(), 1U);
+    EXPECT_EQ(received[0].Body, messageText + messageText);
+    EXPECT_THROW(
+        m_queueClient->DeleteMessage(received[0].MessageId, updated.PopReceipt), StorageException);
+    m_queueClient->DeleteMessage(received[0].MessageId, received[0].PopReceipt);
+    EXPECT_TRUE(m_queueClient->PeekMessages().Value.Messages.empty());
+
+    m_queueClient->SendMessage(messageText);
+    m_queueClient->ClearMessages();
+    EXPECT_TRUE(m_queueClient->ReceiveMessages().Value.Messages.empty());
+  }
+
+  TEST_F(QueueClientTest, AsyncSendReceiveMessages)
+  {
+    const std::string messageText = RandomString();
+
+    // The results are got through futures, as a caller without coroutines would.
+    std::promise<Queues::Models::SendMessageResult> sent;
+    m_queueClient->SendMessageAsync(
+        messageText,
+        Queues::SendMessageOptions(),
+        Azure::Core::Context(),
+        [&](Azure::Nullable<Azure::Response<Queues::Models::SendMessageResult>> response,
+            std::exception_ptr error) {
+          if (error)
+          {
+            sent.set_exception(error);
+            return;
+          }
+          sent.set_value(std::move(response.Value().Value));
+        });
+    const auto messageId = sent.get_future().get().MessageId;
+    EXPECT_FALSE(messageId.empty());
+
+    std::promise<Queues::Models::ReceivedMessages> received;
+    m_queueClient->ReceiveMessagesAsync(
+        Queues::ReceiveMessagesOptions(),
+        Azure::Core::Context(),
+        [&](Azure::Nullable<Azure::Response<Queues::Models::ReceivedMessages>> response,
+            std::exception_ptr error) {
+          if (error)
+          {
+            received.set_exception(error);
+            return;
+          }
+          received.set_value(std::move(response.Value().Value));
+        });
+    auto messages = received.get_future().get().Messages;
+    ASSERT_EQ(messages.size(), 1U);
+    EXPECT_EQ(messages[0].MessageId, messageId);
+    EXPECT_EQ(messages[0].Body, messageText);
+  }
+
+  TEST_F(QueueClientTest, Base64MessageEncoding)
+  {
+    Queues::QueueClientOptions options;
+    options.MessageEncoding = Queues::QueueMessageEncoding::Base64;
+    auto queueClient = Queues::QueueClient::CreateFromConnectionString(
+        StandardStorageConnectionString(),
+        m_queueClient->GetUrl().substr(m_queueClient->GetUrl().rfind('/') + 1),
+        options);
+
+    std::string messageText;
+    for (int i = 0; i < 256; ++i)
+    {
+      messageText.push_back(static_cast<char>(i));
+    }
+    for (const auto& text : {messageText, messageText.substr(1), messageText.substr(2)})
+    {
+      queueClient.SendMessage(text);
+      auto peeked = queueClient.PeekMessages().Value.Messages;
+      ASSERT_EQ(peeked.size(), 1U);
+      EXPECT_EQ(peeked[0].Body, text);
+      auto received = queueClient.ReceiveMessages().Value.Messages;
+      ASSERT_EQ(received.size(), 1U);
+      EXPECT_EQ(received[0].Body, text);
+      queueClient.DeleteMessage(received[0].MessageId, received[0].PopReceipt);
+    }
+
+    // The service keeps the content encoded.
+    queueClient.SendMessage("Hello");
+    EXPECT_EQ(m_queueClient->PeekMessages().Value.Messages[0].Body, "SGVsbG8=");
+    m_queueClient->ClearMessages();
+
+    m_queueClient->SendMessage("not Base64");
+    EXPECT_THROW(queueClient.PeekMessages(), std::runtime_error);
+  }
+
+  TEST_F(QueueClientTest, QueueMessageConsumer)
+  {
+    const size_t numMessages = 100;
+    std::set<std::string> sent;
+    for (size_t i = 0; i < numMessages; ++i)
+    {
+      const std::string messageText = RandomString();
+      sent.insert(messageText);
+      m_queueClient->SendMessage(messageText);
+    }
+
+    std::set<std::string> received;
+    {
+      Queues::QueueMessageConsumerOptions options;
+      options.MaxBufferedMessages = 64;
+      options.DeleteBatchSize = 8;
+      Queues::QueueMessageConsumer consumer(*m_queueClient, options);
+      while (received.size() < numMessages)
+      {
+        auto message = consumer.Receive(std::chrono::seconds(30));
+        ASSERT_TRUE(message.HasValue());
+        EXPECT_TRUE(received.insert(message.Value().Body).second);
+        consumer.Delete(message.Value());
+      }
+      EXPECT_FALSE(consumer.Receive(std::chrono::seconds(1)).HasValue());
+      consumer.Flush();
+    }
+    EXPECT_EQ(received, sent);
+    EXPECT_TRUE(m_queueClient->PeekMessages().Value.Messages.empty());
+
+    EXPECT_THROW(
+        {
+          Queues::QueueMessageConsumerOptions options;
+          options.MessagesPerReceive = 33;
+          Queues::QueueMessageConsumer consumer(*m_queueClient, options);
+        },
+        std::invalid_argument);
+  }
+
+  TEST_F(QueueClientTest, QueueMessageProducer)
+  {
+    const size_t numThreads = 4;
+    const size_t numMessages = 25;
+    std::vector<std::future<Queues::Models::SendMessageResult>> sent[numThreads];
+    {
+      Queues::QueueMessageProducerOptions options;
+      options.Concurrency = 4;
+      Queues::QueueMessageProducer producer(*m_queueClient, options);
+      std::vector<std::thread> threads;
+      for (size_t i = 0; i < numThreads; ++i)
+      {
+        threads.emplace_back([&, i]() {
+          for (size_t j = 0; j < numMessages; ++j)
+          {
+            sent[i].push_back(producer.Send(std::to_string(i * numMessages + j)));
+          }
+        });
+      }
+      for (auto& thread : threads)
+      {
+        thread.join();
+      }
+      producer.Flush();
+    }
+    std::set<std::string> messageIds;
+    for (auto& futures : sent)
+    {
+      for (auto& future : futures)
+      {
+        messageIds.insert(future.get().MessageId);
+      }
+    }
+    EXPECT_EQ(messageIds.size(), numThreads * numMessages);
+    EXPECT_EQ(
+        m_queueClient->GetProperties().Value.ApproximateMessageCount,
+        static_cast<int64_t>(numThreads * numMessages));
+
+    Queues::QueueMessageProducerOptions options;
+    options.MessageOptions.VisibilityTimeout = std::chrono::seconds(10);
+    options.MessageOptions.TimeToLive = std::chrono::seconds(1);
+    Queues::QueueMessageProducer producer(*m_queueClient, options);
+    EXPECT_THROW(producer.Send(RandomString()).get(), StorageException);
+  }
+
+  TEST_F(QueueClientTest, QueueReceiveScheduler)
+  {
+    auto otherQueueClient = Queues::QueueClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), LowercaseRandomString());
+    otherQueueClient.Create();
+
+    const size_t numMessages = 40;
+    std::set<std::string> sent;
+    for (size_t i = 0; i < numMessages; ++i)
+    {
+      const std::string messageText = RandomString();
+      sent.insert(messageText);
+      (i % 2 == 0 ? *m_queueClient : otherQueueClient).SendMessage(messageText);
+    }
+
+    std::mutex mutex;
+    std::condition_variable receivedAll;
+    std::set<std::string> received;
+    {
+      Queues::QueueReceiveSchedulerOptions options;
+      options.MessagesPerReceive = 8;
+      options.MaxIdleDelay = std::chrono::seconds(1);
+      Queues::QueueReceiveScheduler scheduler(options);
+      for (const auto& queueClient : {*m_queueClient, otherQueueClient})
+      {
+        scheduler.AddQueue(
+            queueClient, [&, queueClient](std::vector<Queues::Models::QueueMessage> messages) {
+              for (const auto& message : messages)
+              {
+                queueClient.DeleteMessage(message.MessageId, message.PopReceipt);
+              }
+              std::lock_guard<std::mutex> lock(mutex);
+              for (const auto& message : messages)
+              {
+                received.insert(message.Body);
+              }
+              receivedAll.notify_all();
+            });
+      }
+      std::unique_lock<std::mutex> lock(mutex);
+      EXPECT_TRUE(receivedAll.wait_for(
+          lock, std::chrono::seconds(60), [&]() { return received.size() == numMessages; }));
+    }
+    EXPECT_EQ(received, sent);
+    EXPECT_TRUE(otherQueueClient.PeekMessages().Value.Messages.empty());
+    otherQueueClient.Delete();
+  }
+
+  TEST_F(QueueClientTest, QueueMessageLeaseManager)
+  {
+    m_queueClient->SendMessage("processed");
+    m_queueClient->SendMessage("released");
+    Queues::ReceiveMessagesOptions receiveOptions;
+    receiveOptions.MaxMessages = 2;
+    receiveOptions.VisibilityTimeout = std::chrono::seconds(4);
+    auto received = m_queueClient->ReceiveMessages(receiveOptions).Value.Messages;
+    ASSERT_EQ(received.size(), 2U);
+
+    Queues::QueueMessageLeaseManagerOptions options;
+    options.VisibilityTimeout = std::chrono::seconds(4);
+    Queues::QueueMessageLeaseManager manager(*m_queueClient, options);
+    std::mutex mutex;
+    std::condition_variable lostChanged;
+    std::vector<std::string> lost;
+    auto onLost = [&](const std::string& messageId, std::exception_ptr error) {
+      EXPECT_TRUE(error);
+      std::lock_guard<std::mutex> lock(mutex);
+      lost.push_back(messageId);
+      lostChanged.notify_all();
+    };
+    const auto processedKey = manager.Add(received[0], onLost);
+    const auto releasedKey = manager.Add(received[1], onLost);
+
+    // The messages stay invisible for longer than the timeout they were received with.
+    std::this_thread::sleep_for(std::chrono::seconds(10));
+    EXPECT_TRUE(m_queueClient->PeekMessages().Value.Messages.empty());
+    manager.Complete(processedKey);
+    const auto popReceipt = manager.Release(releasedKey);
+    EXPECT_THROW(manager.Release(releasedKey), std::invalid_argument);
+    m_queueClient->UpdateMessage(
+        received[1].MessageId, popReceipt, received[1].Body, std::chrono::seconds(0));
+    auto peeked = m_queueClient->PeekMessages().Value.Messages;
+    ASSERT_EQ(peeked.size(), 1U);
+    EXPECT_EQ(peeked[0].Body, "released");
+
+    // The pop receipt of a message received again changes, so the message is lost.
+    received = m_queueClient->ReceiveMessages(receiveOptions).Value.Messages;
+    ASSERT_EQ(received.size(), 1U);
+    const auto lostKey = manager.Add(received[0], onLost);
+    m_queueClient->UpdateMessage(
+        received[0].MessageId, received[0].PopReceipt, received[0].Body, std::chrono::seconds(0));
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      EXPECT_TRUE(
+          lostChanged.wait_for(lock, std::chrono::seconds(30), [&]() { return !lost.empty(); }));
+      ASSERT_EQ(lost.size(), 1U);
+      EXPECT_EQ(lost[0], received[0].MessageId);
+    }
+    EXPECT_THROW(manager.Complete(lostKey), std::invalid_argument);
+  }
+
+}}} // namespace Azure::Storage::Test